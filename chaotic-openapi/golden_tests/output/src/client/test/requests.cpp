@@ -2,7 +2,7 @@
 #include <client/test/requests.hpp>
 
 #include <userver/chaotic/openapi/parameters_write.hpp>
-#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/json/string_builder.hpp>
 
 namespace clients::test {
 
@@ -17,8 +17,9 @@ void SerializeRequest(const Request& request, USERVER_NAMESPACE::clients::http::
 
     WriteParameter<openapi::TrivialParameter<openapi::In::kQuery, knumber, int>>(request.number, sink);
 
-    // http_request.data(ToJsonString(request.body));
-    http_request.data(ToString(USERVER_NAMESPACE::formats::json::ValueBuilder(request.body).ExtractValue()));
+    USERVER_NAMESPACE::formats::json::StringBuilder sw;
+    WriteToStream(request.body, sw);
+    http_request.data(sw.GetString());
 }
 
 }  // namespace testme_post
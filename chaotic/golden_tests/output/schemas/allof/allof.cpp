@@ -114,4 +114,41 @@ Serialize([[maybe_unused]] const ns::AllOf& value, USERVER_NAMESPACE::formats::s
     return vb.ExtractValue();
 }
 
+void WriteToStream([[maybe_unused]] const ns::AllOf::Foo__P0& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+    USERVER_NAMESPACE::formats::json::StringBuilder::ObjectGuard guard{sw};
+
+    if (value.foo) {
+        sw.Key("foo");
+        WriteToStream(USERVER_NAMESPACE::chaotic::Primitive<std::string>{*value.foo}, sw);
+    }
+
+    USERVER_NAMESPACE::chaotic::WriteAdditionalPropertiesTrue(value.extra, kns__AllOf__Foo__P0_PropertiesNames, sw);
+}
+
+void WriteToStream([[maybe_unused]] const ns::AllOf::Foo__P1& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+    USERVER_NAMESPACE::formats::json::StringBuilder::ObjectGuard guard{sw};
+
+    if (value.bar) {
+        sw.Key("bar");
+        WriteToStream(USERVER_NAMESPACE::chaotic::Primitive<int>{*value.bar}, sw);
+    }
+
+    USERVER_NAMESPACE::chaotic::WriteAdditionalPropertiesTrue(value.extra, kns__AllOf__Foo__P1_PropertiesNames, sw);
+}
+
+void WriteToStream(const ns::AllOf::Foo& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+    sw.WriteValue(
+        Serialize(value, USERVER_NAMESPACE::formats::serialize::To<USERVER_NAMESPACE::formats::json::Value>{})
+    );
+}
+
+void WriteToStream([[maybe_unused]] const ns::AllOf& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw) {
+    USERVER_NAMESPACE::formats::json::StringBuilder::ObjectGuard guard{sw};
+
+    if (value.foo) {
+        sw.Key("foo");
+        WriteToStream(USERVER_NAMESPACE::chaotic::Primitive<ns::AllOf::Foo>{*value.foo}, sw);
+    }
+}
+
 }  // namespace ns
@@ -26,4 +26,6 @@ Int Parse(USERVER_NAMESPACE::yaml_config::Value json, USERVER_NAMESPACE::formats
 USERVER_NAMESPACE::formats::json::Value
 Serialize(const ns::Int& value, USERVER_NAMESPACE::formats::serialize::To<USERVER_NAMESPACE::formats::json::Value>);
 
+void WriteToStream(const ns::Int& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw);
+
 }  // namespace ns
@@ -33,6 +33,8 @@ A Parse(USERVER_NAMESPACE::formats::json::Value json, USERVER_NAMESPACE::formats
 USERVER_NAMESPACE::formats::json::Value
 Serialize(const ns::A& value, USERVER_NAMESPACE::formats::serialize::To<USERVER_NAMESPACE::formats::json::Value>);
 
+void WriteToStream(const ns::A& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw);
+
 struct B {
     std::optional<std::string> type{};
     std::optional<int> b_prop{};
@@ -53,6 +55,8 @@ B Parse(USERVER_NAMESPACE::formats::json::Value json, USERVER_NAMESPACE::formats
 USERVER_NAMESPACE::formats::json::Value
 Serialize(const ns::B& value, USERVER_NAMESPACE::formats::serialize::To<USERVER_NAMESPACE::formats::json::Value>);
 
+void WriteToStream(const ns::B& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw);
+
 struct OneOfDiscriminator {
     [[maybe_unused]] static constexpr USERVER_NAMESPACE::chaotic::OneOfSettings kFoo_Settings = {
         "type",
@@ -82,4 +86,6 @@ Parse(USERVER_NAMESPACE::formats::json::Value json, USERVER_NAMESPACE::formats::
 USERVER_NAMESPACE::formats::json::Value
 Serialize(const ns::OneOfDiscriminator& value, USERVER_NAMESPACE::formats::serialize::To<USERVER_NAMESPACE::formats::json::Value>);
 
+void WriteToStream(const ns::OneOfDiscriminator& value, USERVER_NAMESPACE::formats::json::StringBuilder& sw);
+
 }  // namespace ns
@@ -48,6 +48,36 @@ ExtractAdditionalProperties(const Value& json, const utils::TrivialSet<BuilderFu
     return map;
 }
 
+template <typename BuilderFunc, typename Value, typename StringBuilder>
+void WriteAdditionalPropertiesTrue(
+    const Value& extra,
+    const utils::TrivialSet<BuilderFunc>& names_to_exclude,
+    StringBuilder& sw
+) {
+    if (!extra.IsObject()) return;
+
+    for (const auto& [name, value] : formats::common::Items(extra)) {
+        if (names_to_exclude.Contains(name)) continue;
+
+        sw.Key(name);
+        WriteToStream(value, sw);
+    }
+}
+
+template <typename T, typename Map, typename BuilderFunc, typename StringBuilder>
+void WriteAdditionalProperties(
+    const Map& extra,
+    const utils::TrivialSet<BuilderFunc>& names_to_exclude,
+    StringBuilder& sw
+) {
+    for (const auto& [name, value] : extra) {
+        if (names_to_exclude.Contains(name)) continue;
+
+        sw.Key(name);
+        WriteToStream(T{value}, sw);
+    }
+}
+
 }  // namespace chaotic
 
 USERVER_NAMESPACE_END
@@ -58,6 +58,16 @@ Value Serialize(const OneOfWithDiscriminator<Settings, T...>& var, formats::seri
     );
 }
 
+template <const auto* Settings, typename... T, typename StringBuilder>
+void WriteToStream(const OneOfWithDiscriminator<Settings, T...>& var, StringBuilder& sw) {
+    using Value = typename StringBuilder::Value;
+    std::visit(
+        USERVER_NAMESPACE::utils::Overloaded{
+            [&sw](const formats::common::ParseType<Value, T>& item) { WriteToStream(T{item}, sw); }...},
+        var.value
+    );
+}
+
 }  // namespace chaotic
 
 USERVER_NAMESPACE_END
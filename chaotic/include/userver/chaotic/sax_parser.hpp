@@ -0,0 +1,662 @@
+#pragma once
+
+/// @file userver/chaotic/sax_parser.hpp
+/// @brief SAX parsers of the chaotic types, see chaotic::sax::ParseToType
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include <fmt/format.h>
+
+#include <userver/formats/common/meta.hpp>
+#include <userver/formats/common/path.hpp>
+#include <userver/formats/common/type.hpp>
+#include <userver/formats/json/parser/bool_parser.hpp>
+#include <userver/formats/json/parser/exception.hpp>
+#include <userver/formats/json/parser/int_parser.hpp>
+#include <userver/formats/json/parser/number_parser.hpp>
+#include <userver/formats/json/parser/parser_json.hpp>
+#include <userver/formats/json/parser/parser_state.hpp>
+#include <userver/formats/json/parser/string_parser.hpp>
+#include <userver/formats/json/parser/typed_parser.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/formats/parse/to.hpp>
+#include <userver/utils/box.hpp>
+#include <userver/utils/constexpr_indices.hpp>
+
+#include <userver/chaotic/array.hpp>
+#include <userver/chaotic/convert.hpp>
+#include <userver/chaotic/oneof_with_discriminator.hpp>
+#include <userver/chaotic/primitive.hpp>
+#include <userver/chaotic/ref.hpp>
+#include <userver/chaotic/with_type.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// @brief SAX parsers of the chaotic types.
+///
+/// The parsers are created by `MakeSaxParser(formats::parse::To<T>)`, where T
+/// is a chaotic parse type. chaotic generates the overloads for the objects and
+/// enums if `--generate-sax-parsers` is passed, the other types either have a
+/// SAX parser here or are parsed from a DOM built for their subtree only.
+namespace chaotic::sax {
+
+/// Type of the result of parsing T
+template <typename T>
+using Result = formats::common::ParseType<formats::json::Value, T>;
+
+template <typename T>
+using ParserPtr = std::unique_ptr<formats::json::parser::TypedParser<Result<T>>>;
+
+ParserPtr<bool> MakeSaxParser(formats::parse::To<bool>);
+
+ParserPtr<std::int32_t> MakeSaxParser(formats::parse::To<std::int32_t>);
+
+ParserPtr<std::int64_t> MakeSaxParser(formats::parse::To<std::int64_t>);
+
+ParserPtr<double> MakeSaxParser(formats::parse::To<double>);
+
+ParserPtr<std::string> MakeSaxParser(formats::parse::To<std::string>);
+
+ParserPtr<formats::json::Value> MakeSaxParser(formats::parse::To<formats::json::Value>);
+
+/// Fallback for the types without a SAX parser: builds formats::json::Value of
+/// the subtree and parses it with `Parse(formats::json::Value, To<T>)`.
+template <typename T>
+ParserPtr<T> MakeSaxParser(formats::parse::To<T>);
+
+template <typename T>
+ParserPtr<std::optional<T>> MakeSaxParser(formats::parse::To<std::optional<T>>);
+
+template <typename RawType, typename... Validators>
+ParserPtr<Primitive<RawType, Validators...>> MakeSaxParser(formats::parse::To<Primitive<RawType, Validators...>>);
+
+template <typename RawType, typename UserType>
+ParserPtr<WithType<RawType, UserType>> MakeSaxParser(formats::parse::To<WithType<RawType, UserType>>);
+
+template <typename T>
+ParserPtr<Ref<T>> MakeSaxParser(formats::parse::To<Ref<T>>);
+
+template <typename ItemType, typename UserType, typename... Validators>
+ParserPtr<Array<ItemType, UserType, Validators...>>
+MakeSaxParser(formats::parse::To<Array<ItemType, UserType, Validators...>>);
+
+template <const auto* Settings, typename... T>
+ParserPtr<OneOfWithDiscriminator<Settings, T...>> MakeSaxParser(formats::parse::To<OneOfWithDiscriminator<Settings, T...>>
+);
+
+/// @brief Parser of T that is created on the first use.
+///
+/// The subparsers are created lazily, otherwise the parser of a recursive type
+/// would be infinite.
+template <typename T>
+class LazyParser final {
+public:
+    formats::json::parser::TypedParser<Result<T>>& Get() {
+        if (!parser_) parser_ = MakeSaxParser(formats::parse::To<T>{});
+        return *parser_;
+    }
+
+private:
+    ParserPtr<T> parser_;
+};
+
+/// @brief Base of the parsers that push a subparser on the first event and
+/// pass the event to it.
+template <typename T, typename InnerResult>
+class DelegatingParser : public formats::json::parser::TypedParser<T>,
+                         public formats::json::parser::Subscriber<InnerResult> {
+protected:
+    virtual formats::json::parser::TypedParser<InnerResult>& GetInner() = 0;
+
+    void Null() override { PushInner().Null(); }
+    void Bool(bool value) override { PushInner().Bool(value); }
+    void Int64(std::int64_t value) override { PushInner().Int64(value); }
+    void Uint64(std::uint64_t value) override { PushInner().Uint64(value); }
+    void Double(double value) override { PushInner().Double(value); }
+    void String(std::string_view value) override { PushInner().String(value); }
+    void StartObject() override { PushInner().StartObject(); }
+    void StartArray() override { PushInner().StartArray(); }
+
+    std::string GetPathItem() const override { return {}; }
+    std::string Expected() const override { return "value"; }
+
+private:
+    formats::json::parser::BaseParser& PushInner() {
+        auto& inner = GetInner();
+        inner.Reset();
+        inner.Subscribe(*this);
+        this->parser_state_->PushParser(inner);
+        return inner;
+    }
+};
+
+/// Parses InnerType and converts the result with `converter`
+template <typename InnerType, typename T, typename Converter>
+class ConvertingParser final : public DelegatingParser<T, Result<InnerType>> {
+public:
+    explicit ConvertingParser(Converter converter) : converter_(std::move(converter)) {}
+
+private:
+    formats::json::parser::TypedParser<Result<InnerType>>& GetInner() override { return inner_.Get(); }
+
+    void OnSend(Result<InnerType>&& value) override { this->SetResult(converter_(std::move(value))); }
+
+    LazyParser<InnerType> inner_;
+    Converter converter_;
+};
+
+/// @brief Returns a parser of InnerType that converts the result with
+/// `converter`. The exceptions of `converter` are reported with the path of
+/// the value.
+template <typename InnerType, typename Converter>
+auto MakeConvertingParser(Converter converter) {
+    using T = std::invoke_result_t<Converter&, Result<InnerType>&&>;
+    return std::unique_ptr<formats::json::parser::TypedParser<T>>{
+        std::make_unique<ConvertingParser<InnerType, T, Converter>>(std::move(converter))};
+}
+
+template <typename T>
+class DomParser final : public DelegatingParser<Result<T>, formats::json::Value> {
+private:
+    formats::json::parser::TypedParser<formats::json::Value>& GetInner() override { return inner_; }
+
+    void OnSend(formats::json::Value&& value) override { this->SetResult(value.template As<T>()); }
+
+    formats::json::parser::JsonValueParser inner_;
+};
+
+template <typename T>
+class OptionalParser final : public DelegatingParser<std::optional<Result<T>>, Result<T>> {
+private:
+    formats::json::parser::TypedParser<Result<T>>& GetInner() override { return inner_.Get(); }
+
+    void Null() override { this->SetResult(std::optional<Result<T>>{}); }
+
+    void OnSend(Result<T>&& value) override { this->SetResult(std::optional<Result<T>>{std::move(value)}); }
+
+    LazyParser<T> inner_;
+};
+
+template <typename ItemType, typename UserType, typename... Validators>
+class ArrayParser final : public formats::json::parser::TypedParser<UserType>,
+                          public formats::json::parser::Subscriber<Result<ItemType>> {
+public:
+    void Reset() override {
+        index_ = 0;
+        state_ = State::kStart;
+        storage_ = UserType{};
+    }
+
+protected:
+    void StartArray() override {
+        if (state_ == State::kStart) {
+            state_ = State::kInside;
+        } else {
+            PushItem("array").StartArray();
+        }
+    }
+
+    void EndArray() override {
+        if (state_ != State::kInside) this->Throw("end of array");
+        state_ = State::kEnd;
+        (Validators::Validate(storage_), ...);
+        this->SetResult(std::move(storage_));
+    }
+
+    void Null() override { PushItem("null").Null(); }
+    void Bool(bool value) override { PushItem("bool").Bool(value); }
+    void Int64(std::int64_t value) override { PushItem("integer").Int64(value); }
+    void Uint64(std::uint64_t value) override { PushItem("integer").Uint64(value); }
+    void Double(double value) override { PushItem("double").Double(value); }
+    void String(std::string_view value) override { PushItem("string").String(value); }
+    void StartObject() override { PushItem("object").StartObject(); }
+
+    std::string GetPathItem() const override {
+        if (state_ != State::kInside || index_ == 0) return {};
+        return formats::common::GetIndexString(index_ - 1);
+    }
+
+    std::string Expected() const override { return "array"; }
+
+private:
+    formats::json::parser::BaseParser& PushItem(std::string_view what) {
+        if (state_ != State::kInside) {
+            // Error path must not include [x] - we're not inside an array yet
+            this->parser_state_->PopMe(*this);
+            this->Throw(std::string(what));
+        }
+        auto& item_parser = item_parser_.Get();
+        item_parser.Reset();
+        item_parser.Subscribe(*this);
+        this->parser_state_->PushParser(item_parser);
+        index_++;
+        return item_parser;
+    }
+
+    void OnSend(Result<ItemType>&& item) override { storage_.insert(storage_.end(), std::move(item)); }
+
+    enum class State {
+        kStart,
+        kInside,
+        kEnd,
+    };
+
+    LazyParser<ItemType> item_parser_;
+    std::size_t index_{0};
+    State state_{State::kStart};
+    UserType storage_;
+};
+
+template <typename Variant, std::size_t Index, typename T>
+class OneOfAlternative final : public formats::json::parser::Subscriber<Result<T>> {
+public:
+    explicit OneOfAlternative(formats::json::parser::Subscriber<Variant>& owner) : owner_(owner) {}
+
+    formats::json::parser::TypedParser<Result<T>>& Prepare() {
+        auto& parser = parser_.Get();
+        parser.Reset();
+        parser.Subscribe(*this);
+        return parser;
+    }
+
+private:
+    void OnSend(Result<T>&& value) override { owner_.OnSend(Variant{std::in_place_index<Index>, std::move(value)}); }
+
+    formats::json::parser::Subscriber<Variant>& owner_;
+    LazyParser<T> parser_;
+};
+
+template <const auto* Settings, typename Indices, typename... T>
+class OneOfParser;
+
+/// @brief Parser of oneOf with discriminator.
+///
+/// If the discriminator is the first member of the object, the object is
+/// passed to the parser of the alternative as is. Otherwise the object is
+/// collected into formats::json::Value and parsed from it.
+template <const auto* Settings, std::size_t... Indices, typename... T>
+class OneOfParser<Settings, std::index_sequence<Indices...>, T...> final
+    : public formats::json::parser::TypedParser<Result<OneOfWithDiscriminator<Settings, T...>>>,
+      public formats::json::parser::Subscriber<Result<OneOfWithDiscriminator<Settings, T...>>>,
+      public formats::json::parser::Subscriber<formats::json::Value> {
+public:
+    using Variant = Result<OneOfWithDiscriminator<Settings, T...>>;
+
+    OneOfParser() : alternatives_(OneOfAlternative<Variant, Indices, T>{*this}...) {}
+
+    void Reset() override { state_ = State::kStart; }
+
+protected:
+    void StartObject() override {
+        if (state_ != State::kStart) this->Throw("object");
+        state_ = State::kFirstKey;
+    }
+
+    void Key(std::string_view key) override {
+        if (key == Settings->property_name) {
+            state_ = State::kDiscriminator;
+            return;
+        }
+
+        auto& buffer = PushBuffer();
+        buffer.StartObject();
+        buffer.Key(key);
+    }
+
+    void EndObject() override {
+        // Empty object, report the missing discriminator as the DOM parser does
+        auto& buffer = PushBuffer();
+        buffer.StartObject();
+        buffer.EndObject(0);
+    }
+
+    void String(std::string_view value) override {
+        if (state_ != State::kDiscriminator) this->Throw("string");
+
+        const auto index = Settings->mapping.GetIndex(value);
+        if (!index.has_value()) {
+            throw formats::json::parser::InternalParseError(
+                fmt::format("Unknown discriminator field value '{}'", value)
+            );
+        }
+        state_ = State::kAlternative;
+
+        utils::WithConstexprIndex<sizeof...(T)>(index.value(), [&](auto index_constant) {
+            this->parser_state_->PushParser(std::get<decltype(index_constant)::value>(alternatives_).Prepare());
+        });
+
+        auto& state = *this->parser_state_;
+        state.GetTopParser().StartObject();
+        state.GetTopParser().Key(Settings->property_name);
+        state.GetTopParser().String(value);
+    }
+
+    std::string GetPathItem() const override {
+        if (state_ == State::kDiscriminator) return std::string{Settings->property_name};
+        return {};
+    }
+
+    std::string Expected() const override { return state_ == State::kDiscriminator ? "string" : "object"; }
+
+private:
+    formats::json::parser::JsonValueParser& PushBuffer() {
+        state_ = State::kBuffer;
+        buffer_.Reset();
+        buffer_.Subscribe(static_cast<formats::json::parser::Subscriber<formats::json::Value>&>(*this));
+        this->parser_state_->PushParser(buffer_);
+        return buffer_;
+    }
+
+    void OnSend(Variant&& value) override { this->SetResult(std::move(value)); }
+
+    void OnSend(formats::json::Value&& value) override {
+        this->SetResult(value.template As<OneOfWithDiscriminator<Settings, T...>>());
+    }
+
+    enum class State {
+        kStart,
+        kFirstKey,
+        kDiscriminator,
+        kAlternative,
+        kBuffer,
+    };
+
+    State state_{State::kStart};
+    std::tuple<OneOfAlternative<Variant, Indices, T>...> alternatives_;
+    formats::json::parser::JsonValueParser buffer_;
+};
+
+/// Skips a value of any type
+class SkipParser final : public formats::json::parser::BaseParser {
+public:
+    void Reset() { depth_ = 0; }
+
+protected:
+    void Null() override { OnScalar(); }
+    void Bool(bool) override { OnScalar(); }
+    void Int64(std::int64_t) override { OnScalar(); }
+    void Uint64(std::uint64_t) override { OnScalar(); }
+    void Double(double) override { OnScalar(); }
+    void String(std::string_view) override { OnScalar(); }
+
+    void StartObject() override { ++depth_; }
+    void Key(std::string_view) override {}
+    void EndObject() override { OnEnd(); }
+
+    void StartArray() override { ++depth_; }
+    void EndArray() override { OnEnd(); }
+
+    std::string GetPathItem() const override { return {}; }
+    std::string Expected() const override { return "value"; }
+
+private:
+    void OnScalar() {
+        if (depth_ == 0) parser_state_->PopMe(*this);
+    }
+
+    void OnEnd() {
+        if (--depth_ == 0) parser_state_->PopMe(*this);
+    }
+
+    std::size_t depth_{0};
+};
+
+/// @brief Base of the generated SAX parsers of objects.
+///
+/// The derived parser dispatches the members by the key in OnKey() and checks
+/// the presence of the required members in OnEnd().
+template <typename T>
+class ObjectParser : public formats::json::parser::TypedParser<T> {
+public:
+    void Reset() final {
+        state_ = State::kStart;
+        key_.clear();
+        result_ = T{};
+        ResetMembers();
+    }
+
+protected:
+    /// Returns the parser of the value of the `key` member
+    virtual formats::json::parser::BaseParser& OnKey(std::string_view key) = 0;
+
+    virtual void OnEnd() = 0;
+
+    virtual void ResetMembers() = 0;
+
+    formats::json::parser::BaseParser& SkipValue() {
+        skip_parser_.Reset();
+        return skip_parser_;
+    }
+
+    [[noreturn]] static void ThrowUnknownProperty(std::string_view key) {
+        throw formats::json::parser::InternalParseError(fmt::format("Unknown property '{}'", key));
+    }
+
+    [[noreturn]] static void ThrowMissingField(std::string_view name) {
+        throw formats::json::parser::InternalParseError(fmt::format("Field '{}' is missing", name));
+    }
+
+    // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+    T result_{};
+
+private:
+    void Null() override {
+        // The same as the DOM parser, null is an object without members
+        if (state_ != State::kStart) this->Throw("null");
+        Finish();
+    }
+
+    void StartObject() override {
+        if (state_ != State::kStart) this->Throw("object");
+        state_ = State::kInside;
+    }
+
+    void Key(std::string_view key) override {
+        key_ = key;
+        this->parser_state_->PushParser(OnKey(key));
+    }
+
+    void EndObject() override {
+        key_.clear();
+        Finish();
+    }
+
+    void Finish() {
+        state_ = State::kEnd;
+        OnEnd();
+        this->SetResult(std::move(result_));
+    }
+
+    std::string GetPathItem() const override { return key_; }
+
+    std::string Expected() const override { return "object"; }
+
+    enum class State {
+        kStart,
+        kInside,
+        kEnd,
+    };
+
+    State state_{State::kStart};
+    std::string key_;
+    SkipParser skip_parser_;
+};
+
+/// Parser of an object member, stores the value into the field
+template <typename ParseType, typename FieldType>
+class Field final : private formats::json::parser::Subscriber<Result<ParseType>> {
+public:
+    formats::json::parser::BaseParser& Prepare(FieldType& field) {
+        field_ = &field;
+        auto& parser = parser_.Get();
+        parser.Reset();
+        parser.Subscribe(*this);
+        return parser;
+    }
+
+private:
+    void OnSend(Result<ParseType>&& value) override { *field_ = std::move(value); }
+
+    LazyParser<ParseType> parser_;
+    FieldType* field_{nullptr};
+};
+
+/// Parser of an object member with a default, null leaves the field as is
+template <typename ParseType, typename FieldType>
+class FieldWithDefault final : private formats::json::parser::Subscriber<std::optional<Result<ParseType>>> {
+public:
+    formats::json::parser::BaseParser& Prepare(FieldType& field) {
+        field_ = &field;
+        auto& parser = parser_.Get();
+        parser.Reset();
+        parser.Subscribe(*this);
+        return parser;
+    }
+
+private:
+    void OnSend(std::optional<Result<ParseType>>&& value) override {
+        if (value) *field_ = std::move(*value);
+    }
+
+    LazyParser<std::optional<ParseType>> parser_;
+    FieldType* field_{nullptr};
+};
+
+/// Collects the unknown object members into a map (`additionalProperties`)
+template <typename ParseType, typename Map>
+class ExtraMembers final : private formats::json::parser::Subscriber<Result<ParseType>> {
+public:
+    formats::json::parser::BaseParser& Prepare(Map& map, std::string_view key) {
+        map_ = &map;
+        key_ = key;
+        auto& parser = parser_.Get();
+        parser.Reset();
+        parser.Subscribe(*this);
+        return parser;
+    }
+
+private:
+    void OnSend(Result<ParseType>&& value) override { map_->emplace(std::move(key_), std::move(value)); }
+
+    LazyParser<ParseType> parser_;
+    Map* map_{nullptr};
+    std::string key_;
+};
+
+/// Collects the unknown object members into a JSON object
+/// (`additionalProperties: true`)
+class ExtraJsonMembers final : private formats::json::parser::Subscriber<formats::json::Value> {
+public:
+    formats::json::parser::BaseParser& Prepare(std::string_view key) {
+        key_ = key;
+        parser_.Reset();
+        parser_.Subscribe(*this);
+        return parser_;
+    }
+
+    void Reset() { builder_ = formats::json::ValueBuilder{formats::common::Type::kObject}; }
+
+    formats::json::Value Extract() { return builder_.ExtractValue(); }
+
+private:
+    void OnSend(formats::json::Value&& value) override { builder_[std::move(key_)] = std::move(value); }
+
+    formats::json::parser::JsonValueParser parser_;
+    formats::json::ValueBuilder builder_{formats::common::Type::kObject};
+    std::string key_;
+};
+
+/// @brief Parses JSON `input` into T in a single pass, without building the
+/// DOM of the whole document.
+/// @throw formats::json::parser::ParseError on invalid JSON or on a value that
+/// does not match the schema.
+template <typename T>
+Result<T> ParseToType(std::string_view input) {
+    auto parser = MakeSaxParser(formats::parse::To<T>{});
+    return formats::json::parser::impl::ParseSingle(*parser, input);
+}
+
+inline ParserPtr<bool> MakeSaxParser(formats::parse::To<bool>) {
+    return std::make_unique<formats::json::parser::BoolParser>();
+}
+
+inline ParserPtr<std::int32_t> MakeSaxParser(formats::parse::To<std::int32_t>) {
+    return std::make_unique<formats::json::parser::Int32Parser>();
+}
+
+inline ParserPtr<std::int64_t> MakeSaxParser(formats::parse::To<std::int64_t>) {
+    return std::make_unique<formats::json::parser::Int64Parser>();
+}
+
+inline ParserPtr<double> MakeSaxParser(formats::parse::To<double>) {
+    return std::make_unique<formats::json::parser::DoubleParser>();
+}
+
+inline ParserPtr<std::string> MakeSaxParser(formats::parse::To<std::string>) {
+    return std::make_unique<formats::json::parser::StringParser>();
+}
+
+inline ParserPtr<formats::json::Value> MakeSaxParser(formats::parse::To<formats::json::Value>) {
+    return std::make_unique<formats::json::parser::JsonValueParser>();
+}
+
+template <typename T>
+ParserPtr<T> MakeSaxParser(formats::parse::To<T>) {
+    return std::make_unique<DomParser<T>>();
+}
+
+template <typename T>
+ParserPtr<std::optional<T>> MakeSaxParser(formats::parse::To<std::optional<T>>) {
+    return std::make_unique<OptionalParser<T>>();
+}
+
+template <typename RawType, typename... Validators>
+ParserPtr<Primitive<RawType, Validators...>> MakeSaxParser(formats::parse::To<Primitive<RawType, Validators...>>) {
+    if constexpr (sizeof...(Validators) == 0) {
+        return MakeSaxParser(formats::parse::To<RawType>{});
+    } else {
+        return MakeConvertingParser<RawType>([](Result<RawType>&& value) {
+            (Validators::Validate(value), ...);
+            return std::move(value);
+        });
+    }
+}
+
+template <typename RawType, typename UserType>
+ParserPtr<WithType<RawType, UserType>> MakeSaxParser(formats::parse::To<WithType<RawType, UserType>>) {
+    return MakeConvertingParser<RawType>([](Result<RawType>&& value) -> UserType {
+        return Convert(value, convert::To<UserType>{});
+    });
+}
+
+template <typename T>
+ParserPtr<Ref<T>> MakeSaxParser(formats::parse::To<Ref<T>>) {
+    return MakeConvertingParser<T>([](Result<T>&& value) { return utils::Box<Result<T>>{std::move(value)}; });
+}
+
+template <typename ItemType, typename UserType, typename... Validators>
+ParserPtr<Array<ItemType, UserType, Validators...>>
+MakeSaxParser(formats::parse::To<Array<ItemType, UserType, Validators...>>) {
+    return std::make_unique<ArrayParser<ItemType, Result<Array<ItemType, UserType, Validators...>>, Validators...>>();
+}
+
+template <const auto* Settings, typename... T>
+ParserPtr<OneOfWithDiscriminator<Settings, T...>> MakeSaxParser(formats::parse::To<OneOfWithDiscriminator<Settings, T...>>
+) {
+    return std::make_unique<OneOfParser<Settings, std::index_sequence_for<T...>, T...>>();
+}
+
+}  // namespace chaotic::sax
+
+USERVER_NAMESPACE_END
@@ -32,6 +32,12 @@ Value Serialize(const WithType<RawType, UserType>& ps, formats::serialize::To<Va
         .ExtractValue();
 }
 
+template <typename RawType, typename UserType, typename StringBuilder>
+void WriteToStream(const WithType<RawType, UserType>& ps, StringBuilder& sw) {
+    const auto raw = Convert(ps.value, convert::To<std::decay_t<decltype(RawType::value)>>());
+    WriteToStream(RawType{raw}, sw);
+}
+
 }  // namespace chaotic
 
 USERVER_NAMESPACE_END
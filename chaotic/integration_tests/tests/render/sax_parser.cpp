@@ -0,0 +1,118 @@
+#include <userver/utest/assert_macros.hpp>
+
+#include <userver/chaotic/sax_parser.hpp>
+#include <userver/formats/json/parser/exception.hpp>
+#include <userver/formats/json/serialize.hpp>
+
+#include <schemas/int_minmax.hpp>
+#include <schemas/object_many_fields.hpp>
+#include <schemas/object_single_field.hpp>
+#include <schemas/oneofdiscriminator.hpp>
+#include <schemas/recursion.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+template <typename T>
+T ParseDom(std::string_view input) {
+    return formats::json::FromString(input).As<T>();
+}
+
+}  // namespace
+
+TEST(SaxParser, SameAsDom) {
+    constexpr std::string_view kSimple = R"({"int3": 7, "integer": 3, "int": 5})";
+    EXPECT_EQ(chaotic::sax::ParseToType<ns::SimpleObject>(kSimple), ParseDom<ns::SimpleObject>(kSimple));
+
+    constexpr std::string_view kDefaults = R"({"int3": 7, "int": null})";
+    const auto defaults = chaotic::sax::ParseToType<ns::SimpleObject>(kDefaults);
+    EXPECT_EQ(defaults, ParseDom<ns::SimpleObject>(kDefaults));
+    EXPECT_EQ(defaults.int_, 1);
+    EXPECT_EQ(defaults.integer, std::nullopt);
+
+    constexpr std::string_view kExtra = R"({"one": 3, "two": 2, "three": 4})";
+    EXPECT_EQ(
+        chaotic::sax::ParseToType<ns::ObjectWithAdditionalPropertiesInt>(kExtra),
+        ParseDom<ns::ObjectWithAdditionalPropertiesInt>(kExtra)
+    );
+
+    constexpr std::string_view kExtraTrue = R"({"one": 3, "two": {"x": [1, 2]}})";
+    EXPECT_EQ(
+        chaotic::sax::ParseToType<ns::ObjectWithAdditionalPropertiesTrue>(kExtraTrue),
+        ParseDom<ns::ObjectWithAdditionalPropertiesTrue>(kExtraTrue)
+    );
+
+    constexpr std::string_view kRecursive = R"({"data": "a", "next": [{"data": "b", "next": [{"data": "c"}]}]})";
+    EXPECT_EQ(
+        chaotic::sax::ParseToType<ns::RecursiveObject>(kRecursive), ParseDom<ns::RecursiveObject>(kRecursive)
+    );
+}
+
+TEST(SaxParser, ManyFields) {
+    constexpr std::string_view kMany = R"({"id": 1, "name": "foo", "field_1": 2, "field_10": 3, "url": "/"})";
+    EXPECT_EQ(chaotic::sax::ParseToType<ns::ObjectManyFields>(kMany), ParseDom<ns::ObjectManyFields>(kMany));
+
+    constexpr std::string_view kExtra = R"({"id": 1, "field_2": 2, "path": 3})";
+    EXPECT_EQ(
+        chaotic::sax::ParseToType<ns::ObjectManyFieldsExtra>(kExtra), ParseDom<ns::ObjectManyFieldsExtra>(kExtra)
+    );
+
+    UEXPECT_THROW_MSG(
+        chaotic::sax::ParseToType<ns::ObjectManyFields>(R"({"id": 1, "field_10": 3, "field_2": 2})"),
+        formats::json::parser::ParseError,
+        "Unknown property 'field_2'"
+    );
+}
+
+TEST(SaxParser, OneOfWithDiscriminator) {
+    // The discriminator goes first, the object is passed to the alternative
+    constexpr std::string_view kFirst = R"({"foo": {"type": "bbb", "b_prop": 2, "extra": true}})";
+    const auto first = chaotic::sax::ParseToType<ns::OneOfDiscriminator>(kFirst);
+    EXPECT_EQ(first, ParseDom<ns::OneOfDiscriminator>(kFirst));
+    ASSERT_TRUE(first.foo);
+    EXPECT_EQ(std::get<ns::B>(*first.foo).b_prop, 2);
+
+    // The discriminator goes last, the object is collected into a DOM
+    constexpr std::string_view kLast = R"({"foo": {"a_prop": 1, "type": "aaa"}})";
+    const auto last = chaotic::sax::ParseToType<ns::OneOfDiscriminator>(kLast);
+    EXPECT_EQ(last, ParseDom<ns::OneOfDiscriminator>(kLast));
+    ASSERT_TRUE(last.foo);
+    EXPECT_EQ(std::get<ns::A>(*last.foo).a_prop, 1);
+
+    UEXPECT_THROW_MSG(
+        chaotic::sax::ParseToType<ns::OneOfDiscriminator>(R"({"foo": {"type": "ccc"}})"),
+        formats::json::parser::ParseError,
+        "Unknown discriminator field value 'ccc'"
+    );
+}
+
+TEST(SaxParser, Errors) {
+    UEXPECT_THROW_MSG(
+        chaotic::sax::ParseToType<ns::SimpleObject>(R"({"int3": 7, "int": 11})"),
+        formats::json::parser::ParseError,
+        "path 'int': Invalid value, maximum=10, given=11"
+    );
+    UEXPECT_THROW_MSG(
+        chaotic::sax::ParseToType<ns::SimpleObject>(R"({"integer": 1})"),
+        formats::json::parser::ParseError,
+        "Field 'int3' is missing"
+    );
+    UEXPECT_THROW_MSG(
+        chaotic::sax::ParseToType<ns::SimpleObject>(R"({"int3": 7, "unknown": 1})"),
+        formats::json::parser::ParseError,
+        "Unknown property 'unknown'"
+    );
+    UEXPECT_THROW_MSG(
+        chaotic::sax::ParseToType<ns::SimpleObject>(R"({"int3": "7"})"),
+        formats::json::parser::ParseError,
+        "path 'int3': integer was expected, but string found"
+    );
+    UEXPECT_THROW_MSG(
+        chaotic::sax::ParseToType<ns::IntegerObject>(R"({"zoo": [1]})"),
+        formats::json::parser::ParseError,
+        "path 'zoo': Too short array, minimum length=2, given=1"
+    );
+}
+
+USERVER_NAMESPACE_END
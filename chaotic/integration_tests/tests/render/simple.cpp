@@ -17,6 +17,7 @@
 #include <schemas/extra_container.hpp>
 #include <schemas/indirect.hpp>
 #include <schemas/object_empty.hpp>
+#include <schemas/object_many_fields.hpp>
 #include <schemas/object_name.hpp>
 #include <schemas/object_object.hpp>
 #include <schemas/object_single_field.hpp>
@@ -153,6 +154,28 @@ TEST(Simple, ObjectWithAdditionalPropertiesFalseStrict) {
     );
 }
 
+TEST(Simple, ObjectManyFields) {
+    auto json = formats::json::MakeObject("id", 1, "name", "foo", "field_1", 2, "field_10", 3, "score", 4);
+    auto obj = json.As<ns::ObjectManyFields>();
+    EXPECT_EQ(obj.id, 1);
+    EXPECT_EQ(obj.name, "foo");
+    EXPECT_EQ(obj.field_1, 2);
+    EXPECT_EQ(obj.field_10, 3);
+    EXPECT_EQ(obj.score, 4);
+    EXPECT_EQ(formats::json::ValueBuilder{obj}.ExtractValue(), json);
+
+    UEXPECT_THROW_MSG(
+        formats::json::MakeObject("id", 1, "field_10", 3, "field_2", 2).As<ns::ObjectManyFields>(),
+        chaotic::Error<formats::json::Value>,
+        "Unknown property 'field_2'"
+    );
+
+    auto extra_json = formats::json::MakeObject("id", 1, "field_2", 2, "path", 3);
+    auto extra_obj = extra_json.As<ns::ObjectManyFieldsExtra>();
+    EXPECT_EQ(extra_obj.path, 3);
+    EXPECT_EQ(extra_obj.extra, (std::unordered_map<std::string, int>{{"field_2", 2}}));
+}
+
 TEST(Simple, IntegerEnum) {
     auto json = formats::json::MakeObject("one", 1);
     auto obj = json["one"].As<ns::IntegerEnum>();
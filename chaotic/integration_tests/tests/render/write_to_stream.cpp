@@ -0,0 +1,65 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/formats/json/value_builder.hpp>
+
+#include <schemas/all_of.hpp>
+#include <schemas/custom_cpp_type.hpp>
+#include <schemas/object_single_field.hpp>
+#include <schemas/oneofdiscriminator.hpp>
+#include <schemas/recursion.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+template <typename T>
+void ExpectSameAsDom(std::string_view input) {
+    const auto json = formats::json::FromString(input);
+    const auto value = json.As<T>();
+
+    formats::json::StringBuilder sw;
+    WriteToStream(value, sw);
+
+    const auto streamed = formats::json::FromString(sw.GetStringView());
+    EXPECT_EQ(streamed, formats::json::ValueBuilder{value}.ExtractValue()) << sw.GetStringView();
+    EXPECT_EQ(streamed, json) << sw.GetStringView();
+}
+
+}  // namespace
+
+TEST(WriteToStream, Simple) {
+    ExpectSameAsDom<ns::SimpleObject>(R"({"int3": 7, "integer": 3, "int": 5})");
+    ExpectSameAsDom<ns::ObjectWithAdditionalPropertiesInt>(R"({"one": 3, "two": 2, "three": 4})");
+    ExpectSameAsDom<ns::ObjectWithAdditionalPropertiesTrue>(R"({"one": 3, "two": {"x": [1, 2]}})");
+}
+
+TEST(WriteToStream, Recursive) {
+    ExpectSameAsDom<ns::RecursiveObject>(R"({"data": "a", "next": [{"data": "b", "next": [{"data": "c"}]}]})");
+}
+
+TEST(WriteToStream, OneOf) {
+    ExpectSameAsDom<ns::OneOfDiscriminator>(R"({"foo": {"type": "bbb", "b_prop": 2, "extra": true}})");
+}
+
+TEST(WriteToStream, Custom) {
+    ExpectSameAsDom<ns::ObjWithCustom>(
+        R"({"integer": 12, "string": "make love", "decimal": "12.3456789", "object": {"foo": "bar"},
+            "std_array": ["bar", "foo"], "oneOf": 5,
+            "oneOfWithDiscriminator": {"type": "CustomStruct1", "field1": 3},
+            "allOf": {"field1": "foo", "field2": "bar"}})"
+    );
+}
+
+TEST(WriteToStream, ExtraDoesNotOverrideProperties) {
+    ns::ObjectWithAdditionalPropertiesTrue value;
+    value.one = 1;
+    value.extra = formats::json::FromString(R"({"one": 2, "two": 3})");
+
+    formats::json::StringBuilder sw;
+    WriteToStream(value, sw);
+    EXPECT_EQ(formats::json::FromString(sw.GetStringView()), formats::json::FromString(R"({"one": 1, "two": 3})"));
+}
+
+USERVER_NAMESPACE_END
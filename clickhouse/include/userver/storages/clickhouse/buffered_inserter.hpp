@@ -0,0 +1,289 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/buffered_inserter.hpp
+/// @brief @copybrief storages::clickhouse::BufferedInserter
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/options.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse {
+
+/// @brief Settings of storages::clickhouse::BufferedInserter
+struct BufferedInserterSettings final {
+    /// Buffered rows are inserted as soon as there are that many of them, and
+    /// no insert has more rows
+    std::size_t max_batch_rows{100000};
+
+    /// Buffered rows are inserted at least that often
+    std::chrono::milliseconds flush_interval{1000};
+
+    /// BufferedInserter::Append waits while that many rows are buffered or
+    /// being inserted
+    std::size_t max_pending_rows{1000000};
+
+    /// Maximum number of concurrent inserts, each of them takes a connection
+    /// from the pool
+    std::size_t max_concurrent_inserts{2};
+
+    /// Attempts to insert a batch before its rows are dropped
+    std::size_t max_attempts{3};
+
+    /// Delay between the attempts to insert a batch
+    std::chrono::milliseconds retry_delay{100};
+
+    /// Command control of the inserts
+    OptionalCommandControl command_control{};
+};
+
+/// @brief Statistics of storages::clickhouse::BufferedInserter
+struct BufferedInserterStatistics final {
+    std::size_t rows_inserted{0};
+    std::size_t rows_dropped{0};
+    std::size_t inserts_failed{0};
+};
+
+/// @brief Thrown by BufferedInserter::Append if the task is cancelled while
+/// waiting for the buffer space
+class BufferedInserterOverflowError : public std::runtime_error {
+    using std::runtime_error::runtime_error;
+};
+
+// clang-format off
+
+/// @brief Buffers the rows appended by many coroutines and inserts them into a
+/// table in batches, in background.
+///
+/// A single Cluster::InsertRows of many rows is much cheaper than many small
+/// inserts, both for the service and for ClickHouse, which creates a data part
+/// per insert. BufferedInserter collects the rows appended by any number of
+/// coroutines and inserts them when `max_batch_rows` rows are collected or
+/// every `flush_interval`, with up to `max_concurrent_inserts` concurrent
+/// inserts over the pooled connections of the cluster. The inserts use the
+/// compression configured for the ClickHouse component.
+///
+/// Failed inserts are retried up to `max_attempts` times, after that their
+/// rows are dropped and accounted in the statistics. A retried insert may
+/// duplicate the rows if the failed attempt actually reached the server;
+/// `Replicated*MergeTree` tables deduplicate such identical blocks.
+///
+/// If the inserts do not keep up with the appends and `max_pending_rows` rows
+/// are pending, BufferedInserter::Append waits for the inserts.
+///
+/// The destructor inserts the rows that are still buffered and waits for all
+/// the inserts.
+///
+/// `Row` must be a clickhouse-mapped type, see @ref clickhouse_io and
+/// Cluster::InsertRows.
+///
+/// The class is thread-safe.
+///
+/// ## Example usage:
+///
+/// @code
+/// storages::clickhouse::BufferedInserter<Event> inserter{
+///     clickhouse.GetCluster(), "events", {"id", "name", "timestamp"}, {}};
+///
+/// inserter.Append(Event{id, name, now});
+/// @endcode
+
+// clang-format on
+
+template <typename Row>
+class BufferedInserter final {
+public:
+    BufferedInserter(
+        std::shared_ptr<Cluster> cluster,
+        std::string table_name,
+        std::vector<std::string> column_names,
+        BufferedInserterSettings settings
+    );
+
+    ~BufferedInserter();
+
+    BufferedInserter(const BufferedInserter&) = delete;
+    BufferedInserter& operator=(const BufferedInserter&) = delete;
+
+    /// @brief Buffers the row to be inserted in background
+    /// @throws BufferedInserterOverflowError if the task is cancelled while
+    /// waiting for the buffer space
+    void Append(Row&& row);
+
+    BufferedInserterStatistics GetStatistics() const;
+
+private:
+    void RunFlusher();
+    void FlushBuffer(std::vector<engine::TaskWithResult<void>>& inserts);
+    void Insert(const std::vector<Row>& rows);
+
+    const std::shared_ptr<Cluster> cluster_;
+    const std::string table_name_;
+    const std::vector<std::string> column_names_;
+    const std::vector<std::string_view> column_name_views_;
+    const BufferedInserterSettings settings_;
+
+    engine::Mutex mutex_;
+    engine::ConditionVariable pending_rows_cv_;
+    std::vector<Row> buffer_;
+    // buffered rows and rows being inserted
+    std::size_t pending_rows_{0};
+
+    engine::SingleConsumerEvent flush_event_;
+
+    std::atomic<std::size_t> rows_inserted_{0};
+    std::atomic<std::size_t> rows_dropped_{0};
+    std::atomic<std::size_t> inserts_failed_{0};
+
+    // Must be the last member, as it uses the ones above
+    engine::TaskWithResult<void> flusher_{};
+};
+
+template <typename Row>
+BufferedInserter<Row>::BufferedInserter(
+    std::shared_ptr<Cluster> cluster,
+    std::string table_name,
+    std::vector<std::string> column_names,
+    BufferedInserterSettings settings
+)
+    : cluster_(std::move(cluster)),
+      table_name_(std::move(table_name)),
+      column_names_(std::move(column_names)),
+      column_name_views_(column_names_.begin(), column_names_.end()),
+      settings_(std::move(settings)) {
+    UINVARIANT(cluster_, "BufferedInserter requires a cluster");
+    UINVARIANT(settings_.max_batch_rows > 0, "max_batch_rows of BufferedInserter must be positive");
+    UINVARIANT(settings_.max_concurrent_inserts > 0, "max_concurrent_inserts of BufferedInserter must be positive");
+    UINVARIANT(settings_.max_attempts > 0, "max_attempts of BufferedInserter must be positive");
+
+    flusher_ = USERVER_NAMESPACE::utils::CriticalAsync("clickhouse_buffered_inserter", [this] { RunFlusher(); });
+}
+
+template <typename Row>
+BufferedInserter<Row>::~BufferedInserter() {
+    // the flusher inserts the rest of the rows on cancellation
+    flusher_.SyncCancel();
+}
+
+template <typename Row>
+void BufferedInserter<Row>::Append(Row&& row) {
+    bool is_batch_full = false;
+    {
+        std::unique_lock lock{mutex_};
+        if (!pending_rows_cv_.Wait(lock, [this] { return pending_rows_ < settings_.max_pending_rows; })) {
+            throw BufferedInserterOverflowError{
+                "Task cancelled while waiting for the buffer space of BufferedInserter for table " + table_name_};
+        }
+        buffer_.push_back(std::move(row));
+        ++pending_rows_;
+        is_batch_full = buffer_.size() >= settings_.max_batch_rows;
+    }
+    if (is_batch_full) flush_event_.Send();
+}
+
+template <typename Row>
+BufferedInserterStatistics BufferedInserter<Row>::GetStatistics() const {
+    return {rows_inserted_.load(), rows_dropped_.load(), inserts_failed_.load()};
+}
+
+template <typename Row>
+void BufferedInserter<Row>::RunFlusher() {
+    std::vector<engine::TaskWithResult<void>> inserts;
+    while (!engine::current_task::ShouldCancel()) {
+        [[maybe_unused]] const bool is_batch_full = flush_event_.WaitForEventFor(settings_.flush_interval);
+        FlushBuffer(inserts);
+    }
+
+    // The inserter is being destroyed, insert the rest of the rows
+    FlushBuffer(inserts);
+    const engine::TaskCancellationBlocker cancel_blocker;
+    for (auto& insert : inserts) insert.Get();
+}
+
+template <typename Row>
+void BufferedInserter<Row>::FlushBuffer(std::vector<engine::TaskWithResult<void>>& inserts) {
+    // The flusher is only cancelled on destruction, and the taken rows must be
+    // inserted anyway
+    const engine::TaskCancellationBlocker cancel_blocker;
+
+    std::vector<Row> rows;
+    {
+        const std::lock_guard lock{mutex_};
+        rows.swap(buffer_);
+    }
+
+    for (std::size_t begin = 0; begin < rows.size(); begin += settings_.max_batch_rows) {
+        const auto end = std::min(rows.size(), begin + settings_.max_batch_rows);
+        std::vector<Row> batch(
+            std::make_move_iterator(rows.begin() + begin), std::make_move_iterator(rows.begin() + end)
+        );
+
+        inserts.erase(
+            std::remove_if(inserts.begin(), inserts.end(), [](const auto& insert) { return insert.IsFinished(); }),
+            inserts.end()
+        );
+        if (inserts.size() >= settings_.max_concurrent_inserts) {
+            inserts.front().Get();
+            inserts.erase(inserts.begin());
+        }
+
+        inserts.push_back(USERVER_NAMESPACE::utils::Async(
+            "clickhouse_buffered_insert", [this, batch = std::move(batch)] { Insert(batch); }
+        ));
+    }
+}
+
+template <typename Row>
+void BufferedInserter<Row>::Insert(const std::vector<Row>& rows) {
+    for (std::size_t attempt = 1;; ++attempt) {
+        try {
+            cluster_->InsertRows(settings_.command_control, table_name_, column_name_views_, rows);
+            rows_inserted_ += rows.size();
+            break;
+        } catch (const std::exception& e) {
+            ++inserts_failed_;
+            if (attempt >= settings_.max_attempts) {
+                LOG_ERROR() << "Dropping " << rows.size() << " rows of table " << table_name_ << " after " << attempt
+                            << " failed insert attempts: " << e;
+                rows_dropped_ += rows.size();
+                break;
+            }
+            LOG_WARNING() << "Failed to insert " << rows.size() << " rows into table " << table_name_
+                          << ", retrying: " << e;
+            engine::SleepFor(settings_.retry_delay);
+        }
+    }
+
+    {
+        const std::lock_guard lock{mutex_};
+        pending_rows_ -= rows.size();
+    }
+    pending_rows_cv_.NotifyAll();
+}
+
+}  // namespace storages::clickhouse
+
+USERVER_NAMESPACE_END
@@ -4,6 +4,7 @@
 /// @brief @copybrief storages::clickhouse::Cluster
 
 #include <atomic>
+#include <functional>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -61,6 +62,40 @@ public:
     template <typename... Args>
     ExecutionResult Execute(OptionalCommandControl, const Query& query, const Args&... args) const;
 
+    /// Handler of a block of the result of ExecuteForEachBlock
+    using BlockHandler = std::function<void(ExecutionResult&&)>;
+
+    /// @brief Execute a statement at some host of the cluster with args as
+    /// query parameters and pass each block of the result to the `handler` as
+    /// soon as the block is received.
+    ///
+    /// Unlike Execute, the result is never collected as a whole, so the memory
+    /// is bounded by the size of a block (see the `max_block_size` setting of
+    /// ClickHouse) and the processing of a block goes on while the server sends
+    /// the next ones. The handler is called in the current task, with a
+    /// non-empty block each time; map it with ExecutionResult::As,
+    /// ExecutionResult::AsRows or ExecutionResult::AsContainer.
+    ///
+    /// An exception thrown by the handler cancels the query and is rethrown.
+    /// @note The `execute` timeout of the command control bounds the whole
+    /// execution including the handler calls, consider increasing it for big
+    /// results.
+    template <typename... Args>
+    void ExecuteForEachBlock(const Query& query, const BlockHandler& handler, const Args&... args) const;
+
+    /// @brief Execute a statement with specified command control settings
+    /// at some host of the cluster with args as query parameters and pass
+    /// each block of the result to the `handler` as soon as the block is
+    /// received.
+    /// @see ExecuteForEachBlock
+    template <typename... Args>
+    void ExecuteForEachBlock(
+        OptionalCommandControl,
+        const Query& query,
+        const BlockHandler& handler,
+        const Args&... args
+    ) const;
+
     /// @brief Insert data at some host of the cluster;
     /// `T` is expected to be a struct of vectors of same length.
     /// @param table_name table to insert into
@@ -136,6 +171,8 @@ private:
 
     ExecutionResult DoExecute(OptionalCommandControl, const Query& query) const;
 
+    void DoExecuteForEachBlock(OptionalCommandControl, const Query& query, const BlockHandler& handler) const;
+
     const impl::Pool& GetPool() const;
 
     std::vector<impl::Pool> pools_;
@@ -194,6 +231,22 @@ ExecutionResult Cluster::Execute(OptionalCommandControl optional_cc, const Query
     return DoExecute(optional_cc, formatted_query);
 }
 
+template <typename... Args>
+void Cluster::ExecuteForEachBlock(const Query& query, const BlockHandler& handler, const Args&... args) const {
+    ExecuteForEachBlock(OptionalCommandControl{}, query, handler, args...);
+}
+
+template <typename... Args>
+void Cluster::ExecuteForEachBlock(
+    OptionalCommandControl optional_cc,
+    const Query& query,
+    const BlockHandler& handler,
+    const Args&... args
+) const {
+    const auto formatted_query = query.WithArgs(args...);
+    DoExecuteForEachBlock(optional_cc, formatted_query, handler);
+}
+
 }  // namespace storages::clickhouse
 
 USERVER_NAMESPACE_END
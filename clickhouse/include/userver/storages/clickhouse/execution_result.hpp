@@ -57,6 +57,18 @@ public:
     template <typename Container>
     Container AsContainer() &&;
 
+    /// Maps underlying block to strongly-typed struct of column views without
+    /// copying the values: numeric columns are viewed as `utils::span` over
+    /// the contiguous storage of the column, String columns as
+    /// io::columns::StringColumnView of `std::string_view`.
+    /// The views are valid while this ExecutionResult lives.
+    /// See @ref clickhouse_io for better understanding of `T`'s requirements.
+    template <typename T>
+    T AsViews() const&;
+
+    template <typename T>
+    T AsViews() && = delete;
+
 private:
     impl::BlockWrapperPtr block_;
 };
@@ -85,6 +97,21 @@ auto ExecutionResult::AsRows() && {
     return io::RowsMapper<T>{std::move(block_)};
 }
 
+template <typename T>
+T ExecutionResult::AsViews() const& {
+    UASSERT(block_);
+    io::impl::ValidateViewsMapping<T>();
+    io::impl::ValidateColumnsCount<T>(GetColumnsCount());
+
+    T result{};
+    using MappedType = typename io::CppToClickhouse<T>::mapped_type;
+    io::ViewsMapper<MappedType> mapper{*block_};
+
+    boost::pfr::for_each_field(result, mapper);
+
+    return result;
+}
+
 template <typename Container>
 Container ExecutionResult::AsContainer() && {
     UASSERT(block_);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 
 #include <userver/storages/clickhouse/execution_result.hpp>
@@ -29,6 +30,12 @@ public:
 
     ExecutionResult Execute(OptionalCommandControl, const Query& query) const;
 
+    void ExecuteForEachBlock(
+        OptionalCommandControl,
+        const Query& query,
+        const std::function<void(ExecutionResult&&)>& handler
+    ) const;
+
     void Insert(OptionalCommandControl, const InsertionRequest& request) const;
 
     void WriteStatistics(USERVER_NAMESPACE::utils::statistics::Writer& writer) const;
@@ -5,6 +5,7 @@
 /// @ingroup userver_clickhouse_types
 
 #include <userver/storages/clickhouse/io/columns/column_includes.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -15,10 +16,14 @@ class Float32Column final : public ClickhouseColumn<Float32Column> {
 public:
     using cpp_type = float;
     using container_type = std::vector<cpp_type>;
+    using view_type = USERVER_NAMESPACE::utils::span<const cpp_type>;
 
     Float32Column(ColumnRef column);
 
     static ColumnRef Serialize(const container_type& from);
+
+    /// Returns the values of the column without copying them
+    static view_type View(const ColumnRef& column);
 };
 
 }  // namespace storages::clickhouse::io::columns
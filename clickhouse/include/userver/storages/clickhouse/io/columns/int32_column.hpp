@@ -5,6 +5,7 @@
 /// @ingroup userver_clickhouse_types
 
 #include <userver/storages/clickhouse/io/columns/column_includes.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -15,10 +16,14 @@ class Int32Column final : public ClickhouseColumn<Int32Column> {
 public:
     using cpp_type = std::int32_t;
     using container_type = std::vector<cpp_type>;
+    using view_type = USERVER_NAMESPACE::utils::span<const cpp_type>;
 
     Int32Column(ColumnRef column);
 
     static ColumnRef Serialize(const container_type& from);
+
+    /// Returns the values of the column without copying them
+    static view_type View(const ColumnRef& column);
 };
 
 }  // namespace storages::clickhouse::io::columns
@@ -4,7 +4,10 @@
 /// @brief String column support
 /// @ingroup userver_clickhouse_types
 
+#include <cstddef>
+#include <iterator>
 #include <string>
+#include <string_view>
 
 #include <userver/storages/clickhouse/io/columns/column_includes.hpp>
 
@@ -12,15 +15,70 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::clickhouse::io::columns {
 
+/// @brief Values of a ClickHouse String column viewed without copying them,
+/// valid while the column lives
+class StringColumnView final {
+public:
+    class Iterator final {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::string_view;
+        using reference = std::string_view;
+        using pointer = void;
+
+        Iterator() = default;
+        Iterator(const StringColumnView& view, std::size_t ind) : view_{&view}, ind_{ind} {}
+
+        std::string_view operator*() const { return (*view_)[ind_]; }
+
+        Iterator& operator++() {
+            ++ind_;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            auto old = *this;
+            ++ind_;
+            return old;
+        }
+
+        bool operator==(const Iterator& other) const { return ind_ == other.ind_; }
+        bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+    private:
+        const StringColumnView* view_{nullptr};
+        std::size_t ind_{0};
+    };
+
+    StringColumnView() = default;
+    explicit StringColumnView(ColumnRef column);
+
+    std::size_t size() const;
+    bool empty() const { return size() == 0; }
+
+    std::string_view operator[](std::size_t ind) const;
+
+    Iterator begin() const { return Iterator{*this, 0}; }
+    Iterator end() const { return Iterator{*this, size()}; }
+
+private:
+    ColumnRef column_;
+};
+
 /// @brief Represents ClickHouse String column
 class StringColumn final : public ClickhouseColumn<StringColumn> {
 public:
     using cpp_type = std::string;
     using container_type = std::vector<cpp_type>;
+    using view_type = StringColumnView;
 
     StringColumn(ColumnRef column);
 
     static ColumnRef Serialize(const container_type& from);
+
+    /// Returns the values of the column without copying them
+    static view_type View(const ColumnRef& column);
 };
 
 }  // namespace storages::clickhouse::io::columns
@@ -78,6 +78,24 @@ constexpr void ValidateColumnsMapping(const T& t) {
     impl::CommonValidateMapping<T>();
 }
 
+template <size_t I, typename T>
+using ClickhouseViewType = typename std::tuple_element_t<I, MappedType<T>>::view_type;
+
+template <typename T, size_t... I>
+constexpr void ValidateViewsFields(std::index_sequence<I...>) {
+    static_assert(
+        (... && std::is_same_v<CppType<I, T>, ClickhouseViewType<I, T>>),
+        "Make sure the fields are the view_type of the mapped columns."
+    );
+}
+
+template <typename T>
+constexpr void ValidateViewsMapping() {
+    impl::CommonValidateMapping<T>();
+
+    impl::ValidateViewsFields<T>(std::make_index_sequence<kClickhouseTypeColumnsCount<T>>());
+}
+
 template <size_t I>
 struct FailIndexAssertion : std::false_type {};
 
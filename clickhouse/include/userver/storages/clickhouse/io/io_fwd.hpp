@@ -37,6 +37,16 @@ namespace storages::clickhouse::io {
 /// ## Example usage:
 ///
 /// @snippet storages/tests/execute_chtest.cpp  Sample CppToClickhouse specialization
+///
+/// @section views Column views
+/// Numeric and String columns may also be mapped to a struct of their
+/// `view_type`s with storages::clickhouse::ExecutionResult::AsViews, which
+/// does not copy the values: numeric values are viewed in place as contiguous
+/// arrays, which is friendly to vectorized loops, and strings as
+/// `std::string_view`s. Such a struct needs its own `CppToClickhouse`
+/// specialization.
+///
+/// @snippet storages/tests/execute_chtest.cpp  Sample column views usage
 // clang-format on
 template <typename T>
 struct CppToClickhouse;
@@ -38,6 +38,23 @@ private:
     clickhouse::impl::BlockWrapper& block_;
 };
 
+template <typename MappedType>
+class ViewsMapper final {
+public:
+    explicit ViewsMapper(clickhouse::impl::BlockWrapper& block) : block_{block} {}
+
+    template <typename Field, size_t Index>
+    void operator()(Field& field, std::integral_constant<size_t, Index> i) {
+        using ColumnType = std::tuple_element_t<Index, MappedType>;
+        static_assert(std::is_same_v<Field, typename ColumnType::view_type>);
+
+        field = ColumnType::View(io::columns::GetWrappedColumn(block_, i));
+    }
+
+private:
+    clickhouse::impl::BlockWrapper& block_;
+};
+
 template <typename Row>
 class RowsMapper final {
 public:
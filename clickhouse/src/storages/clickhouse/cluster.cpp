@@ -54,6 +54,14 @@ ExecutionResult Cluster::DoExecute(OptionalCommandControl optional_cc, const Que
     return GetPool().Execute(optional_cc, query);
 }
 
+void Cluster::DoExecuteForEachBlock(
+    OptionalCommandControl optional_cc,
+    const Query& query,
+    const BlockHandler& handler
+) const {
+    GetPool().ExecuteForEachBlock(optional_cc, query, handler);
+}
+
 void Cluster::DoInsert(OptionalCommandControl optional_cc, const impl::InsertionRequest& request) const {
     GetPool().Insert(optional_cc, request);
 }
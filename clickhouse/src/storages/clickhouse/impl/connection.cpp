@@ -100,6 +100,34 @@ ExecutionResult Connection::Execute(OptionalCommandControl optional_cc, const Qu
     return ExecutionResult{BlockWrapperPtr{result_ptr.release()}};
 }
 
+void Connection::ExecuteForEachBlock(
+    OptionalCommandControl optional_cc,
+    const Query& query,
+    const std::function<void(ExecutionResult&&)>& handler
+) {
+    clickhouse_cpp::Query native_query{query.QueryText()};
+    native_query.OnDataCancelable([]([[maybe_unused]] const auto& block) {
+        // we must return 'true' if we don't want to cancel query
+        return !engine::current_task::ShouldCancel();
+    });
+
+    auto& span = tracing::Span::CurrentSpan();
+    auto scope = span.CreateScopeTime(scopes::kExec);
+
+    native_query.OnData([&handler, &scope](const NativeBlock& data) {
+        // the server sends blocks without rows, e.g. the header of the result
+        if (data.GetRowCount() == 0) return;
+
+        // the copy of the block shares the columns with the original one
+        auto block = std::make_unique<BlockWrapper>(NativeBlock{data});
+        scope.Reset(scopes::kProcess);
+        handler(ExecutionResult{BlockWrapperPtr{block.release()}});
+        scope.Reset(scopes::kExec);
+    });
+
+    DoExecute(optional_cc, native_query);
+}
+
 void Connection::Insert(OptionalCommandControl optional_cc, const InsertionRequest& request) {
     const auto& block = request.GetBlock();
 
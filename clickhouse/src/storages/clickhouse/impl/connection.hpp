@@ -2,6 +2,8 @@
 
 #include <storages/clickhouse/impl/wrap_clickhouse_cpp.hpp>
 
+#include <functional>
+
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/storages/clickhouse/execution_result.hpp>
 #include <userver/storages/clickhouse/options.hpp>
@@ -27,6 +29,8 @@ public:
 
     ExecutionResult Execute(OptionalCommandControl, const Query&);
 
+    void ExecuteForEachBlock(OptionalCommandControl, const Query&, const std::function<void(ExecutionResult&&)>&);
+
     void Insert(OptionalCommandControl, const InsertionRequest&);
 
     void Ping();
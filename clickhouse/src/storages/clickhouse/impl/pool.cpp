@@ -43,6 +43,20 @@ ExecutionResult Pool::Execute(OptionalCommandControl optional_cc, const Query& q
     return conn_ptr->Execute(optional_cc, query);
 }
 
+void Pool::ExecuteForEachBlock(
+    OptionalCommandControl optional_cc,
+    const Query& query,
+    const std::function<void(ExecutionResult&&)>& handler
+) const {
+    auto conn_ptr = impl_->Acquire();
+
+    auto span = PrepareExecutionSpan(impl::scopes::kQuery, impl_->GetHostName());
+    query.FillSpanTags(span);
+
+    const auto timer = impl_->GetExecuteTimer();
+    conn_ptr->ExecuteForEachBlock(optional_cc, query, handler);
+}
+
 void Pool::Insert(OptionalCommandControl optional_cc, const InsertionRequest& request) const {
     auto conn_ptr = impl_->Acquire();
 
@@ -8,6 +8,7 @@ namespace storages::clickhouse::impl::scopes {
 
 inline const std::string kConnect = "clickhouse_connect";
 inline const std::string kExec = "clickhouse_exec";
+inline const std::string kProcess = "clickhouse_process_block";
 
 inline const std::string kQuery = "clickhouse_query";
 inline const std::string kInsert = "clickhouse_insert";
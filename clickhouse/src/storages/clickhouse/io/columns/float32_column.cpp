@@ -22,6 +22,10 @@ ColumnRef Float32Column::Serialize(const container_type& from) {
     return impl::NumericColumn<Float32Column>::Serialize(from);
 }
 
+Float32Column::view_type Float32Column::View(const ColumnRef& column) {
+    return impl::NumericColumn<Float32Column>::View<NativeType>(column);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
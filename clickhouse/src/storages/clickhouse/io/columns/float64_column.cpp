@@ -22,6 +22,10 @@ ColumnRef Float64Column::Serialize(const container_type& from) {
     return impl::NumericColumn<Float64Column>::Serialize(from);
 }
 
+Float64Column::view_type Float64Column::View(const ColumnRef& column) {
+    return impl::NumericColumn<Float64Column>::View<NativeType>(column);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
@@ -21,6 +21,13 @@ struct NumericColumn final {
     static clickhouse::impl::clickhouse_cpp::ColumnRef Serialize(const container_type& from) {
         return std::make_shared<clickhouse::impl::clickhouse_cpp::ColumnVector<value_type>>(from);
     }
+
+    template <typename NativeColumnType>
+    static typename ColumnType::view_type View(const clickhouse::impl::clickhouse_cpp::ColumnRef& column) {
+        // the data is owned by the column, the typed pointer may go away
+        const auto& data = GetTypedColumn<ColumnType, NativeColumnType>(column)->GetWritableData();
+        return {data.data(), data.size()};
+    }
 };
 
 }  // namespace storages::clickhouse::io::columns::impl
@@ -21,6 +21,10 @@ ColumnRef Int32Column::Serialize(const container_type& from) {
     return impl::NumericColumn<Int32Column>::Serialize(from);
 }
 
+Int32Column::view_type Int32Column::View(const ColumnRef& column) {
+    return impl::NumericColumn<Int32Column>::View<NativeType>(column);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
@@ -19,6 +19,10 @@ Int8Column::cpp_type ColumnIterator<Int8Column>::DataHolder::Get() const {
 
 ColumnRef Int8Column::Serialize(const container_type& from) { return impl::NumericColumn<Int8Column>::Serialize(from); }
 
+Int8Column::view_type Int8Column::View(const ColumnRef& column) {
+    return impl::NumericColumn<Int8Column>::View<NativeType>(column);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
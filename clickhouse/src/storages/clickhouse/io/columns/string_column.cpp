@@ -24,6 +24,19 @@ ColumnRef StringColumn::Serialize(const container_type& from) {
     return std::make_shared<clickhouse::impl::clickhouse_cpp::ColumnString>(from);
 }
 
+StringColumn::view_type StringColumn::View(const ColumnRef& column) {
+    return StringColumnView{impl::GetTypedColumn<StringColumn, NativeType>(column)};
+}
+
+StringColumnView::StringColumnView(ColumnRef column) : column_{std::move(column)} {}
+
+std::size_t StringColumnView::size() const { return column_ ? GetColumnSize(column_) : 0; }
+
+std::string_view StringColumnView::operator[](std::size_t ind) const {
+    UASSERT(ind < size());
+    return impl::NativeGetAt<NativeType>(column_, ind);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
@@ -22,6 +22,10 @@ ColumnRef UInt16Column::Serialize(const container_type& from) {
     return impl::NumericColumn<UInt16Column>::Serialize(from);
 }
 
+UInt16Column::view_type UInt16Column::View(const ColumnRef& column) {
+    return impl::NumericColumn<UInt16Column>::View<NativeType>(column);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
@@ -22,6 +22,10 @@ ColumnRef UInt32Column::Serialize(const container_type& from) {
     return impl::NumericColumn<UInt32Column>::Serialize(from);
 }
 
+UInt32Column::view_type UInt32Column::View(const ColumnRef& column) {
+    return impl::NumericColumn<UInt32Column>::View<NativeType>(column);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
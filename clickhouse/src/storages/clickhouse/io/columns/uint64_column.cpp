@@ -22,6 +22,10 @@ ColumnRef UInt64Column::Serialize(const container_type& from) {
     return impl::NumericColumn<UInt64Column>::Serialize(from);
 }
 
+UInt64Column::view_type UInt64Column::View(const ColumnRef& column) {
+    return impl::NumericColumn<UInt64Column>::View<NativeType>(column);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
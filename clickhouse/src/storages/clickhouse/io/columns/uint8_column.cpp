@@ -21,6 +21,10 @@ ColumnRef UInt8Column::Serialize(const container_type& from) {
     return impl::NumericColumn<UInt8Column>::Serialize(from);
 }
 
+UInt8Column::view_type UInt8Column::View(const ColumnRef& column) {
+    return impl::NumericColumn<UInt8Column>::View<NativeType>(column);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
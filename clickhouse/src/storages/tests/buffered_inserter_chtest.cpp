@@ -0,0 +1,96 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/storages/clickhouse/buffered_inserter.hpp>
+#include <userver/storages/clickhouse/cluster.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct BufferedRow final {
+    uint64_t id;
+    std::string value;
+};
+
+struct BufferedCount final {
+    uint64_t count;
+};
+
+std::shared_ptr<storages::clickhouse::Cluster> MakeSharedCluster(ClusterWrapper& cluster) {
+    // the cluster outlives the inserter
+    return {std::shared_ptr<void>{}, &*cluster};
+}
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<BufferedRow> {
+    using mapped_type = std::tuple<columns::UInt64Column, columns::StringColumn>;
+};
+
+template <>
+struct CppToClickhouse<BufferedCount> {
+    using mapped_type = std::tuple<columns::UInt64Column>;
+};
+
+}  // namespace storages::clickhouse::io
+
+UTEST_MT(BufferedInserter, InsertsFromManyTasks, 4) {
+    constexpr std::size_t kTasks = 8;
+    constexpr std::size_t kRowsPerTask = 1000;
+
+    ClusterWrapper cluster{/*use_compression=*/true};
+    cluster->Execute("DROP TABLE IF EXISTS buffered_inserter_table");
+    cluster->Execute("CREATE TABLE buffered_inserter_table (id UInt64, value String) ENGINE = Memory");
+
+    storages::clickhouse::BufferedInserterSettings settings;
+    settings.max_batch_rows = 700;
+    settings.max_pending_rows = 2000;
+    {
+        storages::clickhouse::BufferedInserter<BufferedRow> inserter{
+            MakeSharedCluster(cluster), "buffered_inserter_table", {"id", "value"}, settings};
+
+        std::vector<engine::TaskWithResult<void>> tasks;
+        for (std::size_t task = 0; task < kTasks; ++task) {
+            tasks.push_back(engine::AsyncNoSpan([&inserter, task] {
+                for (std::size_t i = 0; i < kRowsPerTask; ++i) {
+                    inserter.Append(BufferedRow{task * kRowsPerTask + i, "value"});
+                }
+            }));
+        }
+        for (auto& task : tasks) task.Get();
+        // the destructor inserts the rest of the rows
+    }
+
+    const auto result =
+        cluster->Execute("SELECT count() FROM buffered_inserter_table").AsContainer<std::vector<BufferedCount>>();
+    ASSERT_EQ(result.size(), 1);
+    EXPECT_EQ(result.front().count, kTasks * kRowsPerTask);
+}
+
+UTEST(BufferedInserter, DropsRowsAfterAttempts) {
+    ClusterWrapper cluster{};
+
+    storages::clickhouse::BufferedInserterSettings settings;
+    settings.max_attempts = 2;
+    settings.retry_delay = std::chrono::milliseconds{1};
+    storages::clickhouse::BufferedInserter<BufferedRow> inserter{
+        MakeSharedCluster(cluster), "buffered_inserter_missing_table", {"id", "value"}, settings};
+
+    inserter.Append(BufferedRow{1, "value"});
+    inserter.Append(BufferedRow{2, "value"});
+    while (inserter.GetStatistics().rows_dropped == 0) engine::SleepFor(std::chrono::milliseconds{10});
+
+    const auto statistics = inserter.GetStatistics();
+    EXPECT_EQ(statistics.rows_dropped, 2);
+    EXPECT_EQ(statistics.rows_inserted, 0);
+    EXPECT_EQ(statistics.inserts_failed, 2);
+}
+
+USERVER_NAMESPACE_END
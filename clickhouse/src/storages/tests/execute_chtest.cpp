@@ -1,5 +1,8 @@
 #include <userver/utest/utest.hpp>
 
+#include <iterator>
+#include <stdexcept>
+
 #include <userver/storages/clickhouse/query.hpp>
 
 #include "utils_test.hpp"
@@ -72,6 +75,98 @@ UTEST(Execute, MappingWorks) {
     EXPECT_EQ(sum, 10000 * (10000 - 1) / 2);
 }
 
+/// [Sample column views usage]
+namespace {
+
+struct DataViews final {
+    utils::span<const uint64_t> numbers;
+    storages::clickhouse::io::columns::StringColumnView strings;
+    utils::span<const double> doubles;
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<DataViews> final {
+    using mapped_type = std::tuple<columns::UInt64Column, columns::StringColumn, columns::Float64Column>;
+};
+
+}  // namespace storages::clickhouse::io
+
+UTEST(Execute, ColumnViews) {
+    ClusterWrapper cluster{};
+
+    const storages::clickhouse::Query q{
+        "SELECT c.number, toString(c.number), toFloat64(c.number) / 2 "
+        "FROM numbers(0, 10000) c"};
+    const auto result = cluster->Execute(q);
+    const auto views = result.AsViews<DataViews>();
+
+    uint64_t sum = 0;
+    for (const auto number : views.numbers) sum += number;
+    double doubles_sum = 0;
+    for (const auto value : views.doubles) doubles_sum += value;
+    /// [Sample column views usage]
+
+    ASSERT_EQ(views.numbers.size(), 10000);
+    ASSERT_EQ(views.strings.size(), 10000);
+    ASSERT_EQ(views.doubles.size(), 10000);
+    EXPECT_EQ(sum, 10000 * (10000 - 1) / 2);
+    EXPECT_DOUBLE_EQ(doubles_sum, sum / 2.0);
+    EXPECT_EQ(views.strings[5001], "5001");
+    EXPECT_EQ(*views.strings.begin(), "0");
+    EXPECT_EQ(std::distance(views.strings.begin(), views.strings.end()), 10000);
+}
+
+UTEST(Execute, ForEachBlock) {
+    ClusterWrapper cluster{};
+
+    const storages::clickhouse::Query q{
+        "SELECT c.number, randomString(10), c.number as t, NOW64(9) "
+        "FROM numbers(0, 10000) c "
+        "SETTINGS max_block_size = 1000"};
+
+    /// [Sample ExecuteForEachBlock usage]
+    std::size_t blocks = 0;
+    uint64_t sum = 0;
+    cluster->ExecuteForEachBlock(q, [&blocks, &sum](storages::clickhouse::ExecutionResult&& block) {
+        ++blocks;
+        for (const auto& row : std::move(block).AsRows<RowData>()) sum += row.number;
+    });
+    /// [Sample ExecuteForEachBlock usage]
+
+    EXPECT_GT(blocks, 1);
+    EXPECT_EQ(sum, 10000 * (10000 - 1) / 2);
+}
+
+UTEST(Execute, ForEachBlockHandlerThrows) {
+    ClusterWrapper cluster{};
+
+    const storages::clickhouse::Query q{
+        "SELECT c.number, randomString(10), c.number as t, NOW64(9) "
+        "FROM numbers(0, 100000) c "
+        "SETTINGS max_block_size = 1000"};
+
+    std::size_t blocks = 0;
+    UEXPECT_THROW(
+        cluster->ExecuteForEachBlock(
+            q,
+            [&blocks](storages::clickhouse::ExecutionResult&&) {
+                ++blocks;
+                throw std::runtime_error{"stop"};
+            }
+        ),
+        std::runtime_error
+    );
+    EXPECT_EQ(blocks, 1);
+
+    // the connection is replaced, the cluster keeps working
+    const Data as_columns{cluster->Execute(common_query).As<Data>()};
+    EXPECT_EQ(as_columns.numbers.size(), 10000);
+}
+
 namespace {
 namespace io = storages::clickhouse::io;
 
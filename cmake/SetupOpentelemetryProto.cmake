@@ -21,8 +21,10 @@ userver_add_grpc_library(userver-otlp-proto
   PROTOS
     ${opentelemetry_proto_SOURCE_DIR}/opentelemetry/proto/collector/trace/v1/trace_service.proto
     ${opentelemetry_proto_SOURCE_DIR}/opentelemetry/proto/collector/logs/v1/logs_service.proto
+    ${opentelemetry_proto_SOURCE_DIR}/opentelemetry/proto/collector/metrics/v1/metrics_service.proto
     ${opentelemetry_proto_SOURCE_DIR}/opentelemetry/proto/common/v1/common.proto
     ${opentelemetry_proto_SOURCE_DIR}/opentelemetry/proto/logs/v1/logs.proto
+    ${opentelemetry_proto_SOURCE_DIR}/opentelemetry/proto/metrics/v1/metrics.proto
     ${opentelemetry_proto_SOURCE_DIR}/opentelemetry/proto/resource/v1/resource.proto
     ${opentelemetry_proto_SOURCE_DIR}/opentelemetry/proto/trace/v1/trace.proto
 )
@@ -28,3 +28,55 @@ endif()
 if(USERVER_PGO_GENERATE AND USERVER_PGO_USE)
   message(FATAL_ERROR "USERVER_PGO_GENERATE and USERVER_PGO_USE cannot be set simultaneously")
 endif()
+
+# Sample-based PGO (AutoFDO) with a profile converted from `perf record`
+# output, e.g. from server::handlers::PerfRecord
+set(USERVER_PGO_SAMPLE_USE "" CACHE FILEPATH "Path to sample profile file (AutoFDO) for PGO")
+if(USERVER_PGO_SAMPLE_USE)
+  message(STATUS "PGO: use ${USERVER_PGO_SAMPLE_USE} sample profile")
+  if(CMAKE_CXX_COMPILER_ID STREQUAL "Clang")
+    add_compile_options(-fprofile-sample-use=${USERVER_PGO_SAMPLE_USE})
+    add_link_options(-fprofile-sample-use=${USERVER_PGO_SAMPLE_USE})
+  elseif(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+    add_compile_options(-fauto-profile=${USERVER_PGO_SAMPLE_USE})
+    add_link_options(-fauto-profile=${USERVER_PGO_SAMPLE_USE})
+  else()
+    message(FATAL_ERROR "Don't know how to setup PGO for current compiler (${CMAKE_CXX_COMPILER_ID})")
+  endif()
+endif()
+if((USERVER_PGO_GENERATE OR USERVER_PGO_USE) AND USERVER_PGO_SAMPLE_USE)
+  message(FATAL_ERROR "USERVER_PGO_SAMPLE_USE cannot be set together with USERVER_PGO_GENERATE or USERVER_PGO_USE")
+endif()
+
+# BOLT rewrites the linked executables, it needs the relocations both in the
+# profiled binary and in the binary being optimized
+option(USERVER_BOLT_PREPARE "Keep relocations in the executables to collect BOLT profiles" OFF)
+set(USERVER_BOLT_PROFILE "" CACHE FILEPATH "Path to BOLT profile (.fdata) for userver_bolt_optimize()")
+if(USERVER_BOLT_PREPARE OR USERVER_BOLT_PROFILE)
+  message(STATUS "BOLT: emit relocations")
+  add_link_options(-Wl,--emit-relocs)
+endif()
+if(USERVER_BOLT_PROFILE)
+  message(STATUS "BOLT: use ${USERVER_BOLT_PROFILE} profile")
+  find_program(USERVER_LLVM_BOLT NAMES llvm-bolt)
+  if(NOT USERVER_LLVM_BOLT)
+    message(FATAL_ERROR "USERVER_BOLT_PROFILE is set, but llvm-bolt is not found")
+  endif()
+endif()
+
+# Optimizes the executable `target` with BOLT after the link if
+# USERVER_BOLT_PROFILE is set, does nothing otherwise
+function(userver_bolt_optimize target)
+  if(NOT USERVER_BOLT_PROFILE)
+    return()
+  endif()
+
+  add_custom_command(TARGET ${target} POST_BUILD
+      COMMAND "${USERVER_LLVM_BOLT}" "$<TARGET_FILE:${target}>" -o "$<TARGET_FILE:${target}>.bolt"
+          "--data=${USERVER_BOLT_PROFILE}"
+          -reorder-blocks=ext-tsp -reorder-functions=hfsort -split-functions -split-all-cold -dyno-stats
+      COMMAND "${CMAKE_COMMAND}" -E rename "$<TARGET_FILE:${target}>.bolt" "$<TARGET_FILE:${target}>"
+      COMMENT "Optimizing ${target} with BOLT"
+      VERBATIM
+  )
+endfunction()
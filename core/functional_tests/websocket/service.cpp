@@ -5,6 +5,7 @@
 #include <userver/components/minimal_server_component_list.hpp>
 #include <userver/concurrent/queue.hpp>
 #include <userver/server/handlers/tests_control.hpp>
+#include <userver/server/websocket/broadcast_group.hpp>
 #include <userver/server/websocket/websocket_handler.hpp>
 #include <userver/utils/async.hpp>
 #include <userver/utils/daemon_run.hpp>
@@ -109,11 +110,36 @@ public:
     }
 };
 
+class WebsocketsBroadcastHandler final : public server::websocket::WebsocketHandlerBase {
+public:
+    static constexpr std::string_view kName = "websocket-broadcast-handler";
+
+    WebsocketsBroadcastHandler(const components::ComponentConfig& config, const components::ComponentContext& context)
+        : WebsocketHandlerBase(config, context), group_(server::websocket::BroadcastSettings{GetConfig()}) {}
+
+    void Handle(server::websocket::WebSocketConnection& chat, server::request::RequestContext&) const override {
+        const auto subscription = group_.Join(chat);
+        chat.Send({"joined", {}, true});
+
+        server::websocket::Message message;
+        while (!engine::current_task::ShouldCancel()) {
+            chat.Recv(message);
+            if (message.close_status) break;
+            group_.Publish(message.data, message.is_text);
+        }
+        if (message.close_status) chat.Close(*message.close_status);
+    }
+
+private:
+    mutable server::websocket::BroadcastGroup group_;
+};
+
 int main(int argc, char* argv[]) {
     const auto component_list = components::MinimalServerComponentList()
                                     .Append<WebsocketsHandler>()
                                     .Append<WebsocketsHandlerAlt>()
                                     .Append<WebsocketsFullDuplexHandler>()
+                                    .Append<WebsocketsBroadcastHandler>()
                                     .Append<clients::dns::Component>()
                                     .Append<components::HttpClient>()
                                     .Append<components::TestsuiteSupport>()
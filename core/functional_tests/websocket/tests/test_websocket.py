@@ -120,3 +120,20 @@ async def test_two_but_handler_alt(websocket_client):
             for _ in range(10):
                 msg = await chat1.recv()
                 assert msg == 'A'
+
+
+async def test_broadcast(websocket_client):
+    async with websocket_client.get('broadcast') as chat1:
+        async with websocket_client.get('broadcast') as chat2:
+            assert await chat1.recv() == 'joined'
+            assert await chat2.recv() == 'joined'
+
+            # long enough to be sent compressed
+            msg = 'hello' * 100
+            await chat1.send(msg)
+            assert await chat1.recv() == msg
+            assert await chat2.recv() == msg
+
+            await chat2.send('B')
+            assert await chat1.recv() == 'B'
+            assert await chat2.recv() == 'B'
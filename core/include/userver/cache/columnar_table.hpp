@@ -0,0 +1,528 @@
+#pragma once
+
+/// @file userver/cache/columnar_table.hpp
+/// @brief @copybrief cache::ColumnarTable
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/common_containers.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/dump/unsafe.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @brief Declares a column of cache::ColumnarTable with the values of
+/// an arithmetic or an enum type
+/// @tparam Tag type that names the column in the cache::ColumnarTable methods
+/// @tparam Extractor pointer to a data member or to a function that returns
+/// the column value of a row
+template <typename Tag, auto Extractor>
+struct Column final {
+    using TagType = Tag;
+    static constexpr auto kExtractor = Extractor;
+    static constexpr bool kIsDictionary = false;
+};
+
+/// @brief Declares a dictionary-encoded string column of cache::ColumnarTable
+///
+/// Each distinct string is stored once, the column stores 32-bit codes of the
+/// strings. Suits the columns with few distinct values, e.g. names of cities
+/// or statuses.
+/// @tparam Tag type that names the column in the cache::ColumnarTable methods
+/// @tparam Extractor pointer to a data member or to a function that returns
+/// the column value of a row, convertible to `std::string_view`
+template <typename Tag, auto Extractor>
+struct DictionaryColumn final {
+    using TagType = Tag;
+    static constexpr auto kExtractor = Extractor;
+    static constexpr bool kIsDictionary = true;
+};
+
+namespace impl::columnar {
+
+template <typename T>
+class ValueStorage;
+class DictionaryStorage;
+
+}  // namespace impl::columnar
+
+/// @brief Set of the row indexes of cache::ColumnarTable, one bit per row
+///
+/// Results of the filters over different columns are combined with the
+/// bitwise operators.
+class RowBitmap final {
+public:
+    RowBitmap() = default;
+
+    /// Bitmap of `size` rows, all of them are set if `value` is `true`
+    explicit RowBitmap(std::size_t size, bool value = false);
+
+    /// @returns the number of rows, both set and not set
+    std::size_t size() const noexcept { return size_; }
+
+    bool Test(std::size_t row) const noexcept {
+        UASSERT(row < size_);
+        return (words_[row / kWordBits] >> (row % kWordBits)) & 1;
+    }
+
+    void Set(std::size_t row, bool value = true) noexcept {
+        UASSERT(row < size_);
+        const auto bit = std::uint64_t{1} << (row % kWordBits);
+        if (value) {
+            words_[row / kWordBits] |= bit;
+        } else {
+            words_[row / kWordBits] &= ~bit;
+        }
+    }
+
+    /// @returns the number of set rows
+    std::size_t Count() const noexcept;
+
+    /// @returns whether any row is set
+    bool Any() const noexcept;
+
+    /// Inverts all the rows
+    void Flip() noexcept;
+
+    /// @throws std::invalid_argument if the sizes of bitmaps differ
+    RowBitmap& operator&=(const RowBitmap& other);
+
+    /// @throws std::invalid_argument if the sizes of bitmaps differ
+    RowBitmap& operator|=(const RowBitmap& other);
+
+    /// Calls `func(std::size_t row)` for all the set rows in ascending order
+    template <typename Function>
+    void Visit(Function&& func) const {
+        for (std::size_t i = 0; i < words_.size(); ++i) {
+            for (auto word = words_[i]; word != 0; word &= word - 1) {
+                func(i * kWordBits + static_cast<std::size_t>(__builtin_ctzll(word)));
+            }
+        }
+    }
+
+    /// @returns the indexes of the set rows in ascending order
+    std::vector<std::size_t> GetRows() const;
+
+    bool operator==(const RowBitmap& other) const noexcept {
+        return size_ == other.size_ && words_ == other.words_;
+    }
+    bool operator!=(const RowBitmap& other) const noexcept { return !(*this == other); }
+
+private:
+    template <typename T>
+    friend class impl::columnar::ValueStorage;
+    friend class impl::columnar::DictionaryStorage;
+
+    static constexpr std::size_t kWordBits = 64;
+
+    std::uint64_t* GetWordsData() noexcept { return words_.data(); }
+
+    std::size_t size_{0};
+    // bits past the size_ are always zero
+    std::vector<std::uint64_t> words_;
+};
+
+inline RowBitmap operator&(RowBitmap lhs, const RowBitmap& rhs) { return lhs &= rhs; }
+
+inline RowBitmap operator|(RowBitmap lhs, const RowBitmap& rhs) { return lhs |= rhs; }
+
+inline RowBitmap operator~(RowBitmap bitmap) {
+    bitmap.Flip();
+    return bitmap;
+}
+
+namespace impl::columnar {
+
+// Set the bits of the elements of `data` that are equal to `value` or are in
+// [from, to), all the `words` for `size` elements are overwritten. SIMD
+// accelerated, defined for the fixed width integers, float and double.
+template <typename T>
+void FilterEqual(const T* data, std::size_t size, T value, std::uint64_t* words) noexcept;
+
+template <typename T>
+void FilterRange(const T* data, std::size_t size, T from, T to, std::uint64_t* words) noexcept;
+
+template <std::size_t Size, bool IsSigned>
+struct FixedWidthInteger;
+
+template <>
+struct FixedWidthInteger<1, true> {
+    using Type = std::int8_t;
+};
+template <>
+struct FixedWidthInteger<1, false> {
+    using Type = std::uint8_t;
+};
+template <>
+struct FixedWidthInteger<2, true> {
+    using Type = std::int16_t;
+};
+template <>
+struct FixedWidthInteger<2, false> {
+    using Type = std::uint16_t;
+};
+template <>
+struct FixedWidthInteger<4, true> {
+    using Type = std::int32_t;
+};
+template <>
+struct FixedWidthInteger<4, false> {
+    using Type = std::uint32_t;
+};
+template <>
+struct FixedWidthInteger<8, true> {
+    using Type = std::int64_t;
+};
+template <>
+struct FixedWidthInteger<8, false> {
+    using Type = std::uint64_t;
+};
+
+template <typename T, typename = void>
+struct StoredType {
+    static_assert(std::is_arithmetic_v<T>, "cache::Column supports arithmetic and enum types only");
+    static_assert(
+        !std::is_floating_point_v<T> || std::is_same_v<T, float> || std::is_same_v<T, double>,
+        "cache::Column supports float and double floating point types only"
+    );
+    using Type = std::conditional_t<
+        std::is_floating_point_v<T>,
+        T,
+        typename FixedWidthInteger<sizeof(T), std::is_signed_v<T>>::Type>;
+};
+
+template <>
+struct StoredType<bool> {
+    using Type = std::uint8_t;
+};
+
+template <typename T>
+struct StoredType<T, std::enable_if_t<std::is_enum_v<T>>> : StoredType<std::underlying_type_t<T>> {};
+
+template <typename T>
+void WriteVector(dump::Writer& writer, const std::vector<T>& values) {
+    writer.Write(values.size());
+    dump::WriteStringViewUnsafe(
+        writer, std::string_view{reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T)}
+    );
+}
+
+template <typename T>
+std::vector<T> ReadVector(dump::Reader& reader) {
+    const auto size = reader.Read<std::size_t>();
+    if (size > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+        throw dump::Error("Column size in the dump is too large");
+    }
+    const auto bytes = dump::ReadStringViewUnsafe(reader, size * sizeof(T));
+    std::vector<T> result(size);
+    if (size != 0) std::memcpy(result.data(), bytes.data(), bytes.size());
+    return result;
+}
+
+// Column of the values stored as is, bool and enums are stored as integers
+template <typename T>
+class ValueStorage final {
+public:
+    using Value = T;
+    using Stored = typename StoredType<T>::Type;
+
+    void PushBack(const T& value) { values_.push_back(static_cast<Stored>(value)); }
+
+    void Assign(std::size_t row, const T& value) { values_[row] = static_cast<Stored>(value); }
+
+    void EraseUnordered(std::size_t row) {
+        values_[row] = values_.back();
+        values_.pop_back();
+    }
+
+    T Get(std::size_t row) const { return static_cast<T>(values_[row]); }
+
+    RowBitmap FilterEqual(const T& value) const {
+        RowBitmap result(values_.size());
+        columnar::FilterEqual(values_.data(), values_.size(), static_cast<Stored>(value), result.GetWordsData());
+        return result;
+    }
+
+    RowBitmap FilterRange(const T& from, const T& to) const {
+        RowBitmap result(values_.size());
+        if (!(from < to)) return result;
+        columnar::FilterRange(
+            values_.data(), values_.size(), static_cast<Stored>(from), static_cast<Stored>(to), result.GetWordsData()
+        );
+        return result;
+    }
+
+    void Reserve(std::size_t size) { values_.reserve(size); }
+
+    void Clear() noexcept { values_.clear(); }
+
+    std::size_t GetMemoryUsage() const noexcept { return values_.capacity() * sizeof(Stored); }
+
+    void Write(dump::Writer& writer) const { WriteVector(writer, values_); }
+
+    void Read(dump::Reader& reader) { values_ = ReadVector<Stored>(reader); }
+
+    std::size_t Size() const noexcept { return values_.size(); }
+
+private:
+    std::vector<Stored> values_;
+};
+
+// Column of the codes of the strings in the dictionary
+class DictionaryStorage final {
+public:
+    using Value = std::string;
+
+    void PushBack(std::string_view value) { codes_.push_back(GetOrInsertCode(value)); }
+
+    void Assign(std::size_t row, std::string_view value) { codes_[row] = GetOrInsertCode(value); }
+
+    void EraseUnordered(std::size_t row) {
+        codes_[row] = codes_.back();
+        codes_.pop_back();
+    }
+
+    const std::string& Get(std::size_t row) const { return dictionary_[codes_[row]]; }
+
+    RowBitmap FilterEqual(std::string_view value) const;
+
+    void Reserve(std::size_t size) { codes_.reserve(size); }
+
+    void Clear() noexcept;
+
+    std::size_t GetMemoryUsage() const noexcept;
+
+    std::size_t GetDictionarySize() const noexcept { return dictionary_.size(); }
+
+    void Write(dump::Writer& writer) const;
+
+    void Read(dump::Reader& reader);
+
+    std::size_t Size() const noexcept { return codes_.size(); }
+
+private:
+    std::uint32_t GetOrInsertCode(std::string_view value);
+
+    std::vector<std::string> dictionary_;
+    USERVER_NAMESPACE::utils::impl::TransparentMap<std::string, std::uint32_t> codes_by_value_;
+    std::vector<std::uint32_t> codes_;
+};
+
+template <typename Column, typename Row>
+using ColumnValueType = std::decay_t<std::invoke_result_t<decltype(Column::kExtractor), const Row&>>;
+
+template <typename Column, typename Row>
+using Storage =
+    std::conditional_t<Column::kIsDictionary, DictionaryStorage, ValueStorage<ColumnValueType<Column, Row>>>;
+
+}  // namespace impl::columnar
+
+/// @ingroup userver_containers
+///
+/// @brief Rows stored as a set of typed columns (struct-of-arrays) for fast
+/// scans with predicates over the columns
+///
+/// Columns are declared up front with cache::Column and
+/// cache::DictionaryColumn and are referred to by their tags. Only the
+/// declared fields of the rows are stored. Filters return a cache::RowBitmap
+/// of the matching rows, the filters over different columns are combined
+/// with the bitwise operators:
+///
+/// @code
+/// struct ByPrice {};
+/// struct ByCity {};
+///
+/// using Data = cache::ColumnarTable<
+///     Offer,
+///     cache::Column<ByPrice, &Offer::price>,
+///     cache::DictionaryColumn<ByCity, &Offer::city>>;
+///
+/// auto data = (type == cache::UpdateType::kIncremental) ? *Get() : Data{};
+/// for (auto& offer : changes) data.push_back(offer);
+/// Set(std::move(data));
+///
+/// // in handler
+/// const auto data = cache->Get();
+/// const auto rows = data->FilterRange<ByPrice>(100, 200) & data->FilterEqual<ByCity>("Moscow");
+/// rows.Visit([&](std::size_t row) { result.push_back(data->Get<ByPrice>(row)); });
+/// @endcode
+///
+/// A filter scans the whole column using SIMD, e.g. a filter over a million
+/// of `int` values reads 4MB of contiguous memory, that takes a fraction of
+/// a millisecond. Scanning a `std::vector` of the rows instead reads every
+/// row and is limited by the memory bandwidth and the branch mispredictions.
+///
+/// Rows are identified by their indexes, which change only in
+/// EraseUnordered(). Maintain a map from the row key to its index to update
+/// the rows incrementally.
+///
+/// A dictionary keeps the strings that are no longer referenced by the rows,
+/// rebuild the table to drop them.
+template <typename Row, typename... Columns>
+class ColumnarTable final {
+    static_assert(sizeof...(Columns) > 0, "cache::ColumnarTable should have at least one column");
+
+    template <typename Tag>
+    static constexpr std::size_t FindColumn() {
+        constexpr std::array<bool, sizeof...(Columns)> kMatches{std::is_same_v<Tag, typename Columns::TagType>...};
+        for (std::size_t i = 0; i < kMatches.size(); ++i) {
+            if (kMatches[i]) return i;
+        }
+        return kMatches.size();
+    }
+
+    template <typename Tag>
+    using ColumnByTag = std::tuple_element_t<FindColumn<Tag>(), std::tuple<Columns...>>;
+
+    template <typename Tag>
+    using FilterValue = std::conditional_t<
+        ColumnByTag<Tag>::kIsDictionary,
+        std::string_view,
+        impl::columnar::ColumnValueType<ColumnByTag<Tag>, Row>>;
+
+public:
+    using row_type = Row;
+    using size_type = std::size_t;
+
+    /// Type of the values of the column with the tag `Tag`
+    template <typename Tag>
+    using ColumnValue = typename impl::columnar::Storage<ColumnByTag<Tag>, Row>::Value;
+
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    void reserve(size_type size) {
+        std::apply([size](auto&... column) { (column.Reserve(size), ...); }, columns_);
+    }
+
+    void clear() noexcept {
+        std::apply([](auto&... column) { (column.Clear(), ...); }, columns_);
+        size_ = 0;
+    }
+
+    /// Appends the row, its index is the previous size()
+    void push_back(const Row& row) {
+        ForEachColumn([&row](auto& column, const auto& extractor) { column.PushBack(std::invoke(extractor, row)); });
+        ++size_;
+    }
+
+    /// Replaces the values of the row with the index `row`
+    void Assign(size_type row, const Row& value) {
+        UASSERT(row < size_);
+        ForEachColumn([row, &value](auto& column, const auto& extractor) {
+            column.Assign(row, std::invoke(extractor, value));
+        });
+    }
+
+    /// Removes the row with the index `row` by moving the last row in its place
+    void EraseUnordered(size_type row) {
+        UASSERT(row < size_);
+        std::apply([row](auto&... column) { (column.EraseUnordered(row), ...); }, columns_);
+        --size_;
+    }
+
+    /// @returns the value of the column with the tag `Tag` in the row `row`
+    template <typename Tag>
+    decltype(auto) Get(size_type row) const {
+        UASSERT(row < size_);
+        return GetColumn<Tag>().Get(row);
+    }
+
+    /// @returns the rows with the value of the column with the tag `Tag`
+    /// equal to `value`
+    template <typename Tag>
+    RowBitmap FilterEqual(const FilterValue<Tag>& value) const {
+        return GetColumn<Tag>().FilterEqual(value);
+    }
+
+    /// @returns the rows with the value of the column with the tag `Tag` in
+    /// [from, to). Not available for cache::DictionaryColumn.
+    template <typename Tag>
+    RowBitmap FilterRange(const FilterValue<Tag>& from, const FilterValue<Tag>& to) const {
+        static_assert(!ColumnByTag<Tag>::kIsDictionary, "Range filters are not available for cache::DictionaryColumn");
+        return GetColumn<Tag>().FilterRange(from, to);
+    }
+
+    /// @returns the number of distinct strings in the dictionary of the
+    /// column with the tag `Tag`
+    template <typename Tag>
+    size_type GetDictionarySize() const noexcept {
+        static_assert(ColumnByTag<Tag>::kIsDictionary, "The column is not a cache::DictionaryColumn");
+        return GetColumn<Tag>().GetDictionarySize();
+    }
+
+    /// @returns approximate memory usage of all the columns
+    size_type GetMemoryUsage() const noexcept {
+        return std::apply([](const auto&... column) { return (column.GetMemoryUsage() + ...); }, columns_);
+    }
+
+private:
+    template <typename R, typename... C>
+    friend void Write(dump::Writer& writer, const ColumnarTable<R, C...>& table);
+
+    template <typename R, typename... C>
+    friend ColumnarTable<R, C...> Read(dump::Reader& reader, dump::To<ColumnarTable<R, C...>>);
+
+    template <typename Tag>
+    const auto& GetColumn() const noexcept {
+        static_assert(FindColumn<Tag>() < sizeof...(Columns), "No column with such tag in cache::ColumnarTable");
+        return std::get<FindColumn<Tag>()>(columns_);
+    }
+
+    template <typename Function>
+    void ForEachColumn(Function&& func) {
+        std::apply([&func](auto&... column) { (func(column, Columns::kExtractor), ...); }, columns_);
+    }
+
+    size_type size_{0};
+    std::tuple<impl::columnar::Storage<Columns, Row>...> columns_;
+};
+
+/// @brief cache::ColumnarTable serialization for cache dumps
+///
+/// The columns are written as raw bytes, so `format-version` of the dump
+/// should be bumped whenever the columns change.
+template <typename Row, typename... Columns>
+void Write(dump::Writer& writer, const ColumnarTable<Row, Columns...>& table) {
+    writer.Write(table.size_);
+    std::apply([&writer](const auto&... column) { (column.Write(writer), ...); }, table.columns_);
+}
+
+/// @brief cache::ColumnarTable deserialization for cache dumps
+template <typename Row, typename... Columns>
+ColumnarTable<Row, Columns...> Read(dump::Reader& reader, dump::To<ColumnarTable<Row, Columns...>>) {
+    ColumnarTable<Row, Columns...> result;
+    result.size_ = reader.Read<std::size_t>();
+    std::apply([&reader](auto&... column) { (column.Read(reader), ...); }, result.columns_);
+
+    const auto size = result.size_;
+    std::apply(
+        [size](const auto&... column) {
+            if (((column.Size() != size) || ...)) {
+                throw dump::Error("Column sizes of cache::ColumnarTable in the dump do not match");
+            }
+        },
+        result.columns_
+    );
+    return result;
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <memory>
 #include <optional>
 
 #include <userver/cache/lru_cache_config.hpp>
@@ -14,6 +15,7 @@
 #include <userver/dump/common.hpp>
 #include <userver/dump/dumper.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/utils/datetime.hpp>
 #include <userver/utils/impl/cached_time.hpp>
 #include <userver/utils/impl/wait_token_storage.hpp>
@@ -65,9 +67,15 @@ public:
         kUseCache,   ///< Cache value got from update function
     };
 
-    /// For the description of `ways` and `way_size`,
+    /// For the description of `ways`, `way_size` and `policy`,
     /// see the cache::NWayLRU::NWayLRU constructor.
-    ExpirableLruCache(size_t ways, size_t way_size, const Hash& hash = Hash(), const Equal& equal = Equal());
+    ExpirableLruCache(
+        size_t ways,
+        size_t way_size,
+        const Hash& hash = Hash(),
+        const Equal& equal = Equal(),
+        EvictionPolicy policy = EvictionPolicy::kLru
+    );
 
     ~ExpirableLruCache();
 
@@ -75,6 +83,16 @@ public:
     /// see the cache::NWayLRU::NWayLRU constructor.
     void SetWaySize(size_t way_size);
 
+    /// Returns the weight of a value, e.g. its approximate size in bytes. Must
+    /// return the same weight for the same key and value.
+    using Weigher = std::function<size_t(const Key&, const Value&)>;
+
+    /// @see cache::NWayLRU::SetWeigher
+    void SetWeigher(Weigher weigher);
+
+    /// @see cache::NWayLRU::UpdateWayMaxWeight
+    void SetWayMaxWeight(size_t way_max_weight);
+
     std::chrono::milliseconds GetMaxLifetime() const noexcept;
 
     void SetMaxLifetime(std::chrono::milliseconds max_lifetime);
@@ -86,6 +104,16 @@ public:
      */
     void SetBackgroundUpdate(BackgroundUpdateMode background_update);
 
+    /// Sets the fraction of the lifetime before the expiration, during which
+    /// a hit returns the cached value and triggers a background update.
+    /// Should be in (0, 1], is 0.5 by default.
+    void SetBackgroundUpdateWindow(double window);
+
+    /// Sets the task processor for the background updates, the task processor
+    /// of the caller is used by default. The task processor must outlive the
+    /// cache.
+    void SetBackgroundUpdateTaskProcessor(engine::TaskProcessor& task_processor);
+
     /**
      * @returns GetOptional("key", update_func) if it is not std::nullopt.
      * Otherwise the result of update_func(key) is returned, and additionally
@@ -128,6 +156,12 @@ public:
 
     size_t GetSizeApproximate() const;
 
+    /// @see cache::NWayLRU::GetAdmissionRejects
+    size_t GetAdmissionRejectsApproximate() const;
+
+    /// @see cache::NWayLRU::GetWeight
+    size_t GetWeightApproximate() const;
+
     /// Clear cache
     void Invalidate();
 
@@ -138,7 +172,8 @@ public:
     template <typename Predicate>
     void InvalidateByKeyIf(const Key& key, Predicate pred);
 
-    /// Add async task for updating value by update_func(key)
+    /// Add async task for updating value by update_func(key). Does nothing if
+    /// the key is being updated right now.
     void UpdateInBackground(const Key& key, UpdateValueFunc update_func);
 
     void Write(dump::Writer& writer) const;
@@ -150,6 +185,17 @@ public:
     void SetDumper(std::shared_ptr<dump::Dumper> dumper);
 
 private:
+    using KeyMutex = concurrent::ItemMutex<Key, Equal>;
+
+    // Owns the locked mutex of a key until the background update is finished
+    // or cancelled
+    struct KeyMutexUnlocker final {
+        void operator()(KeyMutex* mutex) const {
+            mutex->unlock();
+            delete mutex;
+        }
+    };
+
     bool IsExpired(std::chrono::steady_clock::time_point update_time, std::chrono::steady_clock::time_point now) const;
 
     bool ShouldUpdate(std::chrono::steady_clock::time_point update_time, std::chrono::steady_clock::time_point now)
@@ -158,6 +204,8 @@ private:
     cache::NWayLRU<Key, impl::ExpirableValue<Value>, Hash, Equal> lru_;
     std::atomic<std::chrono::milliseconds> max_lifetime_{std::chrono::milliseconds(0)};
     std::atomic<BackgroundUpdateMode> background_update_mode_{BackgroundUpdateMode::kDisabled};
+    std::atomic<double> background_update_window_{0.5};
+    std::atomic<engine::TaskProcessor*> background_update_task_processor_{nullptr};
     impl::ExpirableLruCacheStatistics stats_;
     concurrent::MutexSet<Key, Hash, Equal> mutex_set_;
     utils::impl::WaitTokenStorage wait_token_storage_;
@@ -168,9 +216,10 @@ ExpirableLruCache<Key, Value, Hash, Equal>::ExpirableLruCache(
     size_t ways,
     size_t way_size,
     const Hash& hash,
-    const Equal& equal
+    const Equal& equal,
+    EvictionPolicy policy
 )
-    : lru_(ways, way_size, hash, equal), mutex_set_{ways, way_size, hash, equal} {}
+    : lru_(ways, way_size, hash, equal, policy), mutex_set_{ways, way_size, hash, equal} {}
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 ExpirableLruCache<Key, Value, Hash, Equal>::~ExpirableLruCache() {
@@ -182,6 +231,23 @@ void ExpirableLruCache<Key, Value, Hash, Equal>::SetWaySize(size_t way_size) {
     lru_.UpdateWaySize(way_size);
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetWeigher(Weigher weigher) {
+    if (!weigher) {
+        lru_.SetWeigher({});
+        return;
+    }
+
+    lru_.SetWeigher([weigher = std::move(weigher)](const Key& key, const impl::ExpirableValue<Value>& value) {
+        return weigher(key, value.value);
+    });
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetWayMaxWeight(size_t way_max_weight) {
+    lru_.UpdateWayMaxWeight(way_max_weight);
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 std::chrono::milliseconds ExpirableLruCache<Key, Value, Hash, Equal>::GetMaxLifetime() const noexcept {
     return max_lifetime_.load();
@@ -197,6 +263,19 @@ void ExpirableLruCache<Key, Value, Hash, Equal>::SetBackgroundUpdate(BackgroundU
     background_update_mode_ = background_update;
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetBackgroundUpdateWindow(double window) {
+    UINVARIANT(window > 0 && window <= 1, "Background update window should be in (0, 1]");
+    background_update_window_ = window;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetBackgroundUpdateTaskProcessor(
+    engine::TaskProcessor& task_processor
+) {
+    background_update_task_processor_ = &task_processor;
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 Value ExpirableLruCache<Key, Value, Hash, Equal>::Get(
     const Key& key,
@@ -218,6 +297,7 @@ Value ExpirableLruCache<Key, Value, Hash, Equal>::Get(
         return std::move(old_value->value);
     }
 
+    impl::CacheBlockingUpdate(stats_);
     auto value = update_func(key);
     if (read_mode == ReadMode::kUseCache) {
         lru_.Put(key, {value, now});
@@ -323,6 +403,16 @@ size_t ExpirableLruCache<Key, Value, Hash, Equal>::GetSizeApproximate() const {
     return lru_.GetSize();
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+size_t ExpirableLruCache<Key, Value, Hash, Equal>::GetAdmissionRejectsApproximate() const {
+    return lru_.GetAdmissionRejects();
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+size_t ExpirableLruCache<Key, Value, Hash, Equal>::GetWeightApproximate() const {
+    return lru_.GetWeight();
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 void ExpirableLruCache<Key, Value, Hash, Equal>::Invalidate() {
     lru_.Invalidate();
@@ -349,22 +439,38 @@ void ExpirableLruCache<Key, Value, Hash, Equal>::InvalidateByKeyIf(const Key& ke
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 void ExpirableLruCache<Key, Value, Hash, Equal>::UpdateInBackground(const Key& key, UpdateValueFunc update_func) {
-    stats_.total.background_updates++;
-    stats_.recent.GetCurrentCounter().background_updates++;
-
-    // cache will wait for all detached tasks in ~ExpirableLruCache()
-    engine::AsyncNoSpan([token = wait_token_storage_.GetToken(), this, key, update_func = std::move(update_func)] {
-        auto mutex = mutex_set_.GetMutexForKey(key);
-        std::unique_lock lock(mutex, std::try_to_lock);
-        if (!lock) {
+    // Locking before starting the task, so that the hits of a hot key do not
+    // start a task each
+    std::unique_ptr<KeyMutex, KeyMutexUnlocker> mutex;
+    {
+        auto key_mutex = std::make_unique<KeyMutex>(mutex_set_.GetMutexForKey(key));
+        if (!key_mutex->try_lock()) {
             // someone is updating the key right now
             return;
         }
+        mutex.reset(key_mutex.release());
+    }
+
+    stats_.total.background_updates++;
+    stats_.recent.GetCurrentCounter().background_updates++;
 
+    auto func = [token = wait_token_storage_.GetToken(),
+                 this,
+                 key,
+                 update_func = std::move(update_func),
+                 mutex = std::move(mutex)] {
         auto now = utils::datetime::SteadyNow();
         auto value = update_func(key);
         lru_.Put(key, {value, now});
-    }).Detach();
+    };
+
+    // cache will wait for all detached tasks in ~ExpirableLruCache()
+    auto* task_processor = background_update_task_processor_.load();
+    if (task_processor) {
+        engine::AsyncNoSpan(*task_processor, std::move(func)).Detach();
+    } else {
+        engine::AsyncNoSpan(std::move(func)).Detach();
+    }
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
@@ -382,8 +488,12 @@ bool ExpirableLruCache<Key, Value, Hash, Equal>::ShouldUpdate(
     std::chrono::steady_clock::time_point now
 ) const {
     auto max_lifetime = max_lifetime_.load();
-    return (background_update_mode_.load() == BackgroundUpdateMode::kEnabled) && max_lifetime.count() != 0 &&
-           update_time + max_lifetime / 2 < now;
+    if (background_update_mode_.load() != BackgroundUpdateMode::kEnabled || max_lifetime.count() == 0) return false;
+
+    const auto fresh_period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        max_lifetime * (1.0 - background_update_window_.load())
+    );
+    return update_time + fresh_period < now;
 }
 
 template <typename Key, typename Value, typename Hash = std::hash<Key>, typename Equal = std::equal_to<Key>>
@@ -441,6 +551,8 @@ void ExpirableLruCache<Key, Value, Hash, Equal>::SetDumper(std::shared_ptr<dump:
 template <typename Key, typename Value, typename Hash, typename Equal>
 void DumpMetric(utils::statistics::Writer& writer, const ExpirableLruCache<Key, Value, Hash, Equal>& cache) {
     writer["current-documents-count"] = cache.GetSizeApproximate();
+    writer["current-weight"] = cache.GetWeightApproximate();
+    writer["admission-rejects"] = cache.GetAdmissionRejectsApproximate();
     writer = cache.GetStatistics();
 }
 
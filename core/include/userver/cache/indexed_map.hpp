@@ -0,0 +1,340 @@
+#pragma once
+
+/// @file userver/cache/indexed_map.hpp
+/// @brief @copybrief cache::IndexedMap
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include <userver/dump/meta.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @brief Declares a hashed secondary index of cache::IndexedMap
+/// @tparam Tag type that names the index in the cache::IndexedMap methods
+/// @tparam Extractor pointer to a data member or to a function that returns
+/// the index key of a value
+template <typename Tag, auto Extractor, typename Hash = void, typename Equal = void>
+struct HashedIndex final {
+    using TagType = Tag;
+    static constexpr auto kExtractor = Extractor;
+    static constexpr bool kIsOrdered = false;
+
+    template <typename IndexKey, typename Key>
+    using Container = std::unordered_multimap<
+        IndexKey,
+        Key,
+        std::conditional_t<std::is_void_v<Hash>, std::hash<IndexKey>, Hash>,
+        std::conditional_t<std::is_void_v<Equal>, std::equal_to<IndexKey>, Equal>>;
+};
+
+/// @brief Declares an ordered secondary index of cache::IndexedMap, that
+/// additionally allows range lookups
+/// @tparam Tag type that names the index in the cache::IndexedMap methods
+/// @tparam Extractor pointer to a data member or to a function that returns
+/// the index key of a value
+template <typename Tag, auto Extractor, typename Compare = void>
+struct OrderedIndex final {
+    using TagType = Tag;
+    static constexpr auto kExtractor = Extractor;
+    static constexpr bool kIsOrdered = true;
+
+    template <typename IndexKey, typename Key>
+    using Container =
+        std::multimap<IndexKey, Key, std::conditional_t<std::is_void_v<Compare>, std::less<IndexKey>, Compare>>;
+};
+
+namespace impl {
+
+template <typename Index, typename Value>
+using IndexKeyType = std::decay_t<std::invoke_result_t<decltype(Index::kExtractor), const Value&>>;
+
+// Approximate sizes of the std containers nodes: the stored pair plus the
+// pointers, the hash or the color of the node
+inline constexpr std::size_t kHashedNodeOverhead = 2 * sizeof(void*);
+inline constexpr std::size_t kOrderedNodeOverhead = 4 * sizeof(void*);
+
+template <typename Index, typename Key, typename Value>
+class IndexStorage final {
+public:
+    using IndexKey = IndexKeyType<Index, Value>;
+    using Container = typename Index::template Container<IndexKey, Key>;
+
+    void Insert(const Key& key, const Value& value) { container_.emplace(Extract(value), key); }
+
+    void Erase(const Key& key, const Value& value) {
+        auto [it, end] = container_.equal_range(Extract(value));
+        for (; it != end; ++it) {
+            if (it->second == key) {
+                container_.erase(it);
+                return;
+            }
+        }
+        UASSERT_MSG(false, "Secondary index of cache::IndexedMap is out of sync");
+    }
+
+    void Update(const Key& key, const Value& old_value, const Value& new_value) {
+        if (IsSameKey(Extract(old_value), Extract(new_value))) return;
+        Erase(key, old_value);
+        Insert(key, new_value);
+    }
+
+    auto EqualRange(const IndexKey& index_key) const { return container_.equal_range(index_key); }
+
+    auto Range(const IndexKey& from, const IndexKey& to) const {
+        static_assert(Index::kIsOrdered, "Range lookups require cache::OrderedIndex");
+        return std::make_pair(container_.lower_bound(from), container_.lower_bound(to));
+    }
+
+    std::size_t GetMemoryUsage() const noexcept {
+        if constexpr (Index::kIsOrdered) {
+            return container_.size() * (sizeof(typename Container::value_type) + kOrderedNodeOverhead);
+        } else {
+            return container_.size() * (sizeof(typename Container::value_type) + kHashedNodeOverhead) +
+                   container_.bucket_count() * sizeof(void*);
+        }
+    }
+
+    void Clear() noexcept { container_.clear(); }
+
+private:
+    static IndexKey Extract(const Value& value) { return std::invoke(Index::kExtractor, value); }
+
+    bool IsSameKey(const IndexKey& lhs, const IndexKey& rhs) const {
+        if constexpr (Index::kIsOrdered) {
+            const auto& less = container_.key_comp();
+            return !less(lhs, rhs) && !less(rhs, lhs);
+        } else {
+            return container_.key_eq()(lhs, rhs);
+        }
+    }
+
+    Container container_;
+};
+
+}  // namespace impl
+
+/// @ingroup userver_containers
+///
+/// @brief Hash map with secondary indexes that are maintained on each change
+///
+/// Secondary indexes are declared up front with cache::HashedIndex and
+/// cache::OrderedIndex and are referred to by their tags:
+///
+/// @code
+/// struct ByName {};
+/// struct ByPrice {};
+///
+/// using Data = cache::IndexedMap<
+///     int, Item,
+///     cache::HashedIndex<ByName, &Item::name>,
+///     cache::OrderedIndex<ByPrice, &Item::price>>;
+///
+/// auto data = (type == cache::UpdateType::kIncremental) ? *Get() : Data{};
+/// for (auto& [id, item] : changes) data.insert_or_assign(id, std::move(item));
+/// Set(std::move(data));
+///
+/// // in handler
+/// cache->Get()->VisitEqual<ByName>(name, [](int id, const Item& item) {...});
+/// @endcode
+///
+/// Unlike the side indexes rebuilt in each update, a change of an element only
+/// touches the index entries of that element, so an incremental update does
+/// not re-extract the keys of the untouched elements. Indexes store the
+/// primary keys, which keeps the map copyable.
+///
+/// Secondary keys are not unique. Removal of a value from an index is linear
+/// in the number of values with the same secondary key.
+///
+/// An exception from a modification, e.g. std::bad_alloc, may leave the
+/// indexes out of sync, clear() the map in that case. Simultaneous reads from
+/// different threads are safe.
+template <typename Key, typename Value, typename... Indexes>
+class IndexedMap final {
+    using Primary = std::unordered_map<Key, Value>;
+
+    template <typename Tag>
+    static constexpr std::size_t FindIndex() {
+        constexpr std::array<bool, sizeof...(Indexes)> kMatches{std::is_same_v<Tag, typename Indexes::TagType>...};
+        for (std::size_t i = 0; i < kMatches.size(); ++i) {
+            if (kMatches[i]) return i;
+        }
+        return kMatches.size();
+    }
+
+    template <typename Tag>
+    using IndexByTag = std::tuple_element_t<FindIndex<Tag>(), std::tuple<Indexes...>>;
+
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = typename Primary::value_type;
+    using size_type = std::size_t;
+    using const_iterator = typename Primary::const_iterator;
+    using iterator = const_iterator;
+
+    /// Type of the secondary key of the index with the tag `Tag`
+    template <typename Tag>
+    using IndexKey = impl::IndexKeyType<IndexByTag<Tag>, Value>;
+
+    size_type size() const noexcept { return primary_.size(); }
+    bool empty() const noexcept { return primary_.empty(); }
+
+    const_iterator begin() const noexcept { return primary_.cbegin(); }
+    const_iterator end() const noexcept { return primary_.cend(); }
+    const_iterator cbegin() const noexcept { return primary_.cbegin(); }
+    const_iterator cend() const noexcept { return primary_.cend(); }
+
+    /// @returns pointer to the value of `key` or nullptr if there is no such
+    /// key
+    const Value* FindOrNullptr(const Key& key) const {
+        const auto it = primary_.find(key);
+        return it == primary_.end() ? nullptr : &it->second;
+    }
+
+    bool contains(const Key& key) const { return primary_.count(key) != 0; }
+
+    /// @throws std::out_of_range if there is no such key
+    const Value& at(const Key& key) const { return primary_.at(key); }
+
+    void reserve(size_type size) { primary_.reserve(size); }
+
+    /// Sets the value of `key` and updates the indexes, returns `true` if the
+    /// key was inserted and `false` if it was assigned
+    template <typename V>
+    bool insert_or_assign(Key key, V&& value) {
+        const auto it = primary_.find(key);
+        if (it == primary_.end()) {
+            const auto inserted = primary_.emplace(std::move(key), std::forward<V>(value)).first;
+            std::apply([&](auto&... index) { (index.Insert(inserted->first, inserted->second), ...); }, indexes_);
+            return true;
+        }
+
+        Value new_value(std::forward<V>(value));
+        std::apply([&](auto&... index) { (index.Update(it->first, it->second, new_value), ...); }, indexes_);
+        it->second = std::move(new_value);
+        return false;
+    }
+
+    /// Returns the number of erased elements, 0 or 1
+    size_type erase(const Key& key) {
+        const auto it = primary_.find(key);
+        if (it == primary_.end()) return 0;
+
+        std::apply([&](auto&... index) { (index.Erase(it->first, it->second), ...); }, indexes_);
+        primary_.erase(it);
+        return 1;
+    }
+
+    void clear() noexcept {
+        std::apply([](auto&... index) { (index.Clear(), ...); }, indexes_);
+        primary_.clear();
+    }
+
+    /// @returns pointer to any value with the secondary key `index_key` or
+    /// nullptr if there are none
+    template <typename Tag>
+    const Value* FindOneOrNullptr(const IndexKey<Tag>& index_key) const {
+        const auto [it, end] = GetIndex<Tag>().EqualRange(index_key);
+        return it == end ? nullptr : &primary_.find(it->second)->second;
+    }
+
+    /// @returns the number of values with the secondary key `index_key`
+    template <typename Tag>
+    size_type Count(const IndexKey<Tag>& index_key) const {
+        const auto [it, end] = GetIndex<Tag>().EqualRange(index_key);
+        return static_cast<size_type>(std::distance(it, end));
+    }
+
+    /// Calls `func(const Key&, const Value&)` for all the values with the
+    /// secondary key `index_key`
+    template <typename Tag, typename Function>
+    void VisitEqual(const IndexKey<Tag>& index_key, Function&& func) const {
+        auto [it, end] = GetIndex<Tag>().EqualRange(index_key);
+        Visit(it, end, func);
+    }
+
+    /// Calls `func(const Key&, const Value&)` for all the values with the
+    /// secondary keys in [from, to) in the order of the keys. Only available
+    /// for cache::OrderedIndex.
+    template <typename Tag, typename Function>
+    void VisitRange(const IndexKey<Tag>& from, const IndexKey<Tag>& to, Function&& func) const {
+        auto [it, end] = GetIndex<Tag>().Range(from, to);
+        Visit(it, end, func);
+    }
+
+    /// @returns approximate memory usage of the hash table with the values,
+    /// not counting the dynamic memory owned by the keys and the values
+    size_type GetPrimaryMemoryUsage() const noexcept {
+        return primary_.size() * (sizeof(value_type) + impl::kHashedNodeOverhead) +
+               primary_.bucket_count() * sizeof(void*);
+    }
+
+    /// @returns approximate memory usage of the index with the tag `Tag`, not
+    /// counting the dynamic memory owned by the keys
+    template <typename Tag>
+    size_type GetIndexMemoryUsage() const noexcept {
+        return GetIndex<Tag>().GetMemoryUsage();
+    }
+
+private:
+    template <typename Tag>
+    const auto& GetIndex() const noexcept {
+        static_assert(FindIndex<Tag>() < sizeof...(Indexes), "No index with such tag in cache::IndexedMap");
+        return std::get<FindIndex<Tag>()>(indexes_);
+    }
+
+    template <typename Iterator, typename Function>
+    void Visit(Iterator it, Iterator end, Function& func) const {
+        for (; it != end; ++it) {
+            const auto primary_it = primary_.find(it->second);
+            UASSERT(primary_it != primary_.end());
+            func(primary_it->first, primary_it->second);
+        }
+    }
+
+    Primary primary_;
+    std::tuple<impl::IndexStorage<Indexes, Key, Value>...> indexes_;
+};
+
+/// @brief cache::IndexedMap serialization for cache dumps
+template <typename Key, typename Value, typename... Indexes>
+std::enable_if_t<dump::kIsWritable<Key> && dump::kIsWritable<Value>>
+Write(dump::Writer& writer, const IndexedMap<Key, Value, Indexes...>& map) {
+    writer.Write(map.size());
+    for (const auto& [key, value] : map) {
+        writer.Write(key);
+        writer.Write(value);
+    }
+}
+
+/// @brief cache::IndexedMap deserialization for cache dumps, the indexes are
+/// rebuilt
+template <typename Key, typename Value, typename... Indexes>
+std::enable_if_t<dump::kIsReadable<Key> && dump::kIsReadable<Value>, IndexedMap<Key, Value, Indexes...>>
+Read(dump::Reader& reader, dump::To<IndexedMap<Key, Value, Indexes...>>) {
+    const auto size = reader.Read<std::size_t>();
+    IndexedMap<Key, Value, Indexes...> result;
+    result.reserve(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        auto key = reader.Read<Key>();
+        result.insert_or_assign(std::move(key), reader.Read<Value>());
+    }
+    return result;
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
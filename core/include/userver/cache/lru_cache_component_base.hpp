@@ -8,6 +8,7 @@
 #include <userver/cache/expirable_lru_cache.hpp>
 #include <userver/cache/lru_cache_config.hpp>
 #include <userver/components/component_base.hpp>
+#include <userver/components/component_context.hpp>
 #include <userver/concurrent/async_event_source.hpp>
 #include <userver/dump/dumper.hpp>
 #include <userver/dump/meta.hpp>
@@ -57,9 +58,13 @@ yaml_config::Schema GetLruCacheComponentBaseSchema();
 /// Name | Description | Default value
 /// ---- | ----------- | -------------
 /// size | max amount of items to store in cache | --
+/// max-bytes | max total weight of items, requires the `lru` eviction-policy and a weigher set with cache::ExpirableLruCache::SetWeigher, e.g. in the constructor of the derived component (0 is unlimited) | 0
 /// ways | number of ways for associative cache | --
+/// eviction-policy | `lru` for the exact LRU, `clock` for the CLOCK approximation with concurrent reads, `tinylfu` for the scan resistant W-TinyLFU, see cache::EvictionPolicy | lru
 /// lifetime | TTL for cache entries (0 is unlimited) | 0
 /// background-update | enables asynchronous updates for expiring values | false
+/// background-update-window | fraction of the lifetime before the expiration, during which a hit returns the cached value and triggers a single asynchronous update, in (0, 1] | 0.5
+/// background-update-task-processor | task processor for the asynchronous updates | task processor of the caller
 /// config-settings | enables dynamic reconfiguration with CacheConfigSet | true
 ///
 /// ## Example usage:
@@ -127,7 +132,13 @@ LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
     : ComponentBase(config, context),
       name_(components::GetCurrentComponentName(config)),
       static_config_(config),
-      cache_(std::make_shared<Cache>(static_config_.ways, static_config_.GetWaySize())) {
+      cache_(std::make_shared<Cache>(
+          static_config_.ways,
+          static_config_.GetWaySize(),
+          Hash{},
+          Equal{},
+          static_config_.eviction_policy
+      )) {
     if (impl::IsDumpSupportEnabled(config)) {
         dumper_ = std::make_shared<dump::Dumper>(config, context, static_cast<dump::DumpableEntity&>(*this));
         cache_->SetDumper(dumper_);
@@ -136,6 +147,13 @@ LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
 
     cache_->SetMaxLifetime(static_config_.config.lifetime);
     cache_->SetBackgroundUpdate(static_config_.config.background_update);
+    cache_->SetBackgroundUpdateWindow(static_config_.config.background_update_window);
+    if (static_config_.background_update_task_processor) {
+        cache_->SetBackgroundUpdateTaskProcessor(
+            context.GetTaskProcessor(*static_config_.background_update_task_processor)
+        );
+    }
+    cache_->SetWayMaxWeight(static_config_.config.GetWayMaxBytes(static_config_.ways));
 
     if (static_config_.use_dynamic_config) {
         LOG_INFO() << "Dynamic LRU cache config is enabled, subscribing on "
@@ -198,8 +216,10 @@ void LruCacheComponent<Key, Value, Hash, Equal>::OnConfigUpdate(const dynamic_co
 template <typename Key, typename Value, typename Hash, typename Equal>
 void LruCacheComponent<Key, Value, Hash, Equal>::UpdateConfig(const LruCacheConfig& config) {
     cache_->SetWaySize(config.GetWaySize(static_config_.ways));
+    cache_->SetWayMaxWeight(config.GetWayMaxBytes(static_config_.ways));
     cache_->SetMaxLifetime(config.lifetime);
     cache_->SetBackgroundUpdate(config.background_update);
+    cache_->SetBackgroundUpdateWindow(config.background_update_window);
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
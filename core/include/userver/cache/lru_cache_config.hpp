@@ -3,6 +3,7 @@
 #include <chrono>
 #include <cstddef>
 #include <optional>
+#include <string>
 #include <unordered_map>
 
 #include <userver/components/component_fwd.hpp>
@@ -19,6 +20,20 @@ enum class BackgroundUpdateMode {
     kDisabled,
 };
 
+/// Eviction policy of cache::NWayLRU
+enum class EvictionPolicy {
+    /// Exact LRU, each hit moves the element under the exclusive lock of a way
+    kLru,
+    /// CLOCK approximation of LRU, see cache::ClockMap. Hits only set a bit
+    /// under the shared lock of a way, so concurrent reads of the hot keys
+    /// do not serialize.
+    kClock,
+    /// W-TinyLFU, see cache::TinyLfuMap. New keys are admitted only if they
+    /// are queried more often than the keys they would evict, so scans over
+    /// cold keys do not evict the hot ones.
+    kTinyLfu,
+};
+
 struct LruCacheConfig final {
     explicit LruCacheConfig(const yaml_config::YamlConfig& config);
     explicit LruCacheConfig(const components::ComponentConfig& config);
@@ -27,9 +42,14 @@ struct LruCacheConfig final {
 
     std::size_t GetWaySize(std::size_t ways) const;
 
+    /// Returns the max weight per way, unlimited if max_bytes is 0
+    std::size_t GetWayMaxBytes(std::size_t ways) const;
+
     std::size_t size;
+    std::size_t max_bytes;
     std::chrono::milliseconds lifetime;
     BackgroundUpdateMode background_update;
+    double background_update_window;
 };
 
 LruCacheConfig Parse(const formats::json::Value& value, formats::parse::To<LruCacheConfig>);
@@ -42,6 +62,8 @@ struct LruCacheConfigStatic final {
 
     LruCacheConfig config;
     std::size_t ways;
+    EvictionPolicy eviction_policy;
+    std::optional<std::string> background_update_task_processor;
     bool use_dynamic_config;
 };
 
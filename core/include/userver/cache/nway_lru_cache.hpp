@@ -1,15 +1,23 @@
 #pragma once
 
 #include <functional>
+#include <limits>
+#include <mutex>
 #include <optional>
+#include <shared_mutex>
+#include <variant>
 #include <vector>
 
 #include <boost/container_hash/hash.hpp>
 
+#include <userver/cache/clock_map.hpp>
+#include <userver/cache/lru_cache_config.hpp>
 #include <userver/cache/lru_map.hpp>
+#include <userver/cache/tiny_lfu_map.hpp>
 #include <userver/dump/dumper.hpp>
 #include <userver/dump/operations.hpp>
-#include <userver/engine/mutex.hpp>
+#include <userver/engine/shared_mutex.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -19,6 +27,9 @@ namespace cache {
 template <typename T, typename U, typename Hash = std::hash<T>, typename Equal = std::equal_to<T>>
 class NWayLRU final {
 public:
+    /// Returns the weight of an element, e.g. its approximate size in bytes
+    using Weigher = std::function<size_t(const T&, const U&)>;
+
     /// @param ways is the number of ways (a.k.a. shards, internal hash-maps),
     /// into which elements are distributed based on their hash. Each shard is
     /// protected by an individual mutex. Larger `ways` means more internal
@@ -32,7 +43,16 @@ public:
     /// according to the LRU policy.
     ///
     /// The maximum total number of elements is `ways * way_size`.
-    NWayLRU(size_t ways, size_t way_size, const Hash& hash = Hash(), const Equal& equal = Equal());
+    ///
+    /// @param policy is the eviction policy within a way, see
+    /// cache::EvictionPolicy.
+    NWayLRU(
+        size_t ways,
+        size_t way_size,
+        const Hash& hash = Hash(),
+        const Equal& equal = Equal(),
+        EvictionPolicy policy = EvictionPolicy::kLru
+    );
 
     void Put(const T& key, U value);
 
@@ -55,10 +75,29 @@ public:
 
     size_t GetSize() const;
 
+    /// Returns the total weight of the elements, 0 if there is no weigher.
+    size_t GetWeight() const;
+
+    /// Returns the number of new elements that were not stored because of the
+    /// cache::EvictionPolicy::kTinyLfu admission, 0 for the other policies.
+    size_t GetAdmissionRejects() const;
+
     /// For the description of `way_size`,
     /// see the cache::NWayLRU::NWayLRU constructor.
     void UpdateWaySize(size_t way_size);
 
+    /// Enables the eviction by the total weight of the elements of a way in
+    /// addition to `way_size`, see UpdateWayMaxWeight. The weights of the
+    /// elements that are already in the cache are recalculated. This method is
+    /// not thread-safe.
+    /// @throws std::logic_error if the policy is not cache::EvictionPolicy::kLru
+    void SetWeigher(Weigher weigher);
+
+    /// Sets the max total weight of the elements per way. The least recently
+    /// used elements are evicted until the weight fits, including a just
+    /// inserted element that is heavier than the limit.
+    void UpdateWayMaxWeight(size_t way_max_weight);
+
     void Write(dump::Writer& writer) const;
     void Read(dump::Reader& reader);
 
@@ -67,41 +106,80 @@ public:
     void SetDumper(std::shared_ptr<dump::Dumper> dumper);
 
 private:
+    using Lru = LruMap<T, U, Hash, Equal>;
+    using Clock = ClockMap<T, U, Hash, Equal>;
+    using TinyLfu = TinyLfuMap<T, U, Hash, Equal>;
+
     struct Way {
-        Way(Way&& other) noexcept : cache(std::move(other.cache)) {}
+        using Cache = std::variant<Lru, Clock, TinyLfu>;
+
+        Way(Way&& other) noexcept
+            : cache(std::move(other.cache)), weight(other.weight), max_weight(other.max_weight) {}
 
         // max_size is not used, will be reset by Resize() in NWayLRU::NWayLRU
-        Way(const Hash& hash, const Equal& equal) : cache(1, hash, equal) {}
+        Way(const Hash& hash, const Equal& equal, EvictionPolicy policy) : cache(MakeCache(hash, equal, policy)) {}
+
+        static Cache MakeCache(const Hash& hash, const Equal& equal, EvictionPolicy policy) {
+            switch (policy) {
+                case EvictionPolicy::kLru:
+                    return Cache{std::in_place_type<Lru>, 1, hash, equal};
+                case EvictionPolicy::kClock:
+                    return Cache{std::in_place_type<Clock>, 1, hash, equal};
+                case EvictionPolicy::kTinyLfu:
+                    return Cache{std::in_place_type<TinyLfu>, 1, hash, equal};
+            }
+            UINVARIANT(false, "Unexpected eviction policy");
+        }
 
-        mutable engine::Mutex mutex;
-        LruMap<T, U, Hash, Equal> cache;
+        mutable engine::SharedMutex mutex;
+        Cache cache;
+        size_t weight{0};
+        size_t max_weight{std::numeric_limits<size_t>::max()};
     };
 
     Way& GetWay(const T& key);
 
+    // Weighted ways are always Lru, see SetWeigher
+    void PutWeighted(Way& way, const T& key, U&& value);
+    void EraseWeighted(Way& way, const T& key);
+    void EvictWeighted(Way& way, size_t max_size);
+
     void NotifyDumper();
 
     std::vector<Way> caches_;
     Hash hash_fn_;
+    Weigher weigher_;
     std::shared_ptr<dump::Dumper> dumper_{nullptr};
 };
 
 template <typename T, typename U, typename Hash, typename Eq>
-NWayLRU<T, U, Hash, Eq>::NWayLRU(size_t ways, size_t way_size, const Hash& hash, const Eq& equal)
+NWayLRU<T, U, Hash, Eq>::NWayLRU(
+    size_t ways,
+    size_t way_size,
+    const Hash& hash,
+    const Eq& equal,
+    EvictionPolicy policy
+)
     : caches_(), hash_fn_(hash) {
     caches_.reserve(ways);
-    for (size_t i = 0; i < ways; ++i) caches_.emplace_back(hash, equal);
+    for (size_t i = 0; i < ways; ++i) caches_.emplace_back(hash, equal, policy);
     if (ways == 0) throw std::logic_error("Ways must be positive");
 
-    for (auto& way : caches_) way.cache.SetMaxSize(way_size);
+    for (auto& way : caches_) {
+        std::visit([way_size](auto& cache) { cache.SetMaxSize(way_size); }, way.cache);
+    }
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::Put(const T& key, U value) {
     auto& way = GetWay(key);
     {
-        std::unique_lock<engine::Mutex> lock(way.mutex);
-        way.cache.Put(key, std::move(value));
+        std::unique_lock lock(way.mutex);
+        if (weigher_) {
+            PutWeighted(way, key, std::move(value));
+        } else {
+            std::visit([&](auto& cache) { cache.Put(key, std::move(value)); }, way.cache);
+        }
     }
     NotifyDumper();
 }
@@ -110,39 +188,72 @@ template <typename T, typename U, typename Hash, typename Eq>
 template <typename Validator>
 std::optional<U> NWayLRU<T, U, Hash, Eq>::Get(const T& key, Validator validator) {
     auto& way = GetWay(key);
-    std::unique_lock<engine::Mutex> lock(way.mutex);
-    auto* value = way.cache.Get(key);
 
-    if (value) {
-        if (validator(*value)) return *value;
-        way.cache.Erase(key);
+    if (auto* clock = std::get_if<Clock>(&way.cache)) {
+        {
+            std::shared_lock lock(way.mutex);
+            const auto* value = clock->Get(key);
+            if (!value) return std::nullopt;
+            if (validator(*value)) return *value;
+        }
+
+        // The value could have been updated while the lock was released
+        std::unique_lock lock(way.mutex);
+        const auto* value = clock->Get(key);
+        if (value) {
+            if (validator(*value)) return *value;
+            clock->Erase(key);
+        }
+        return std::nullopt;
     }
 
-    return std::nullopt;
+    std::unique_lock lock(way.mutex);
+    return std::visit(
+        [&](auto& cache) -> std::optional<U> {
+            auto* value = cache.Get(key);
+
+            if (value) {
+                if (validator(*value)) return *value;
+                if (weigher_) {
+                    EraseWeighted(way, key);
+                } else {
+                    cache.Erase(key);
+                }
+            }
+
+            return std::nullopt;
+        },
+        way.cache
+    );
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::InvalidateByKey(const T& key) {
     auto& way = GetWay(key);
     {
-        std::unique_lock<engine::Mutex> lock(way.mutex);
-        way.cache.Erase(key);
+        std::unique_lock lock(way.mutex);
+        if (weigher_) {
+            EraseWeighted(way, key);
+        } else {
+            std::visit([&key](auto& cache) { cache.Erase(key); }, way.cache);
+        }
     }
     NotifyDumper();
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 U NWayLRU<T, U, Hash, Eq>::GetOr(const T& key, const U& default_value) {
-    auto& way = GetWay(key);
-    std::unique_lock<engine::Mutex> lock(way.mutex);
-    return way.cache.GetOr(key, default_value);
+    auto value = Get(key);
+    if (value) return *std::move(value);
+    return default_value;
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::Invalidate() {
     for (auto& way : caches_) {
-        std::unique_lock<engine::Mutex> lock(way.mutex);
-        way.cache.Clear();
+        std::unique_lock lock(way.mutex);
+        std::visit([](auto& cache) { cache.Clear(); }, way.cache);
+        way.weight = 0;
     }
     NotifyDumper();
 }
@@ -151,8 +262,8 @@ template <typename T, typename U, typename Hash, typename Eq>
 template <typename Function>
 void NWayLRU<T, U, Hash, Eq>::VisitAll(Function func) const {
     for (const auto& way : caches_) {
-        std::unique_lock<engine::Mutex> lock(way.mutex);
-        way.cache.VisitAll(func);
+        std::shared_lock lock(way.mutex);
+        std::visit([&func](const auto& cache) { cache.VisitAll(func); }, way.cache);
     }
 }
 
@@ -160,17 +271,107 @@ template <typename T, typename U, typename Hash, typename Eq>
 size_t NWayLRU<T, U, Hash, Eq>::GetSize() const {
     size_t size{0};
     for (const auto& way : caches_) {
-        std::unique_lock<engine::Mutex> lock(way.mutex);
-        size += way.cache.GetSize();
+        std::shared_lock lock(way.mutex);
+        size += std::visit([](const auto& cache) { return cache.GetSize(); }, way.cache);
     }
     return size;
 }
 
+template <typename T, typename U, typename Hash, typename Eq>
+size_t NWayLRU<T, U, Hash, Eq>::GetWeight() const {
+    size_t weight{0};
+    for (const auto& way : caches_) {
+        std::shared_lock lock(way.mutex);
+        weight += way.weight;
+    }
+    return weight;
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+size_t NWayLRU<T, U, Hash, Eq>::GetAdmissionRejects() const {
+    size_t rejects{0};
+    for (const auto& way : caches_) {
+        std::shared_lock lock(way.mutex);
+        if (const auto* tiny_lfu = std::get_if<TinyLfu>(&way.cache)) rejects += tiny_lfu->GetAdmissionRejects();
+    }
+    return rejects;
+}
+
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::UpdateWaySize(size_t way_size) {
     for (auto& way : caches_) {
-        std::unique_lock<engine::Mutex> lock(way.mutex);
-        way.cache.SetMaxSize(way_size);
+        std::unique_lock lock(way.mutex);
+        // Evict explicitly to keep the weight up to date
+        if (weigher_) EvictWeighted(way, way_size);
+        std::visit([way_size](auto& cache) { cache.SetMaxSize(way_size); }, way.cache);
+    }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayLRU<T, U, Hash, Eq>::SetWeigher(Weigher weigher) {
+    for (auto& way : caches_) {
+        if (!std::holds_alternative<Lru>(way.cache)) {
+            throw std::logic_error("Weighted eviction is supported only for the LRU eviction policy");
+        }
+    }
+
+    weigher_ = std::move(weigher);
+    for (auto& way : caches_) {
+        std::unique_lock lock(way.mutex);
+        auto& lru = std::get<Lru>(way.cache);
+        way.weight = 0;
+        if (!weigher_) continue;
+
+        lru.VisitAll([this, &way](const T& key, const U& value) { way.weight += weigher_(key, value); });
+        EvictWeighted(way, lru.GetCapacity());
+    }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayLRU<T, U, Hash, Eq>::UpdateWayMaxWeight(size_t way_max_weight) {
+    for (auto& way : caches_) {
+        std::unique_lock lock(way.mutex);
+        way.max_weight = way_max_weight;
+        if (weigher_) EvictWeighted(way, std::get<Lru>(way.cache).GetCapacity());
+    }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayLRU<T, U, Hash, Eq>::PutWeighted(Way& way, const T& key, U&& value) {
+    auto& lru = std::get<Lru>(way.cache);
+    const auto weight = weigher_(key, value);
+
+    if (auto* old_value = lru.Get(key)) {
+        way.weight -= weigher_(key, *old_value);
+        *old_value = std::move(value);
+    } else {
+        // Leave room for the new element, so that LruMap does not evict silently
+        if (lru.GetSize() >= lru.GetCapacity()) EvictWeighted(way, lru.GetCapacity() - 1);
+        lru.Put(key, std::move(value));
+    }
+    way.weight += weight;
+
+    EvictWeighted(way, lru.GetCapacity());
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayLRU<T, U, Hash, Eq>::EraseWeighted(Way& way, const T& key) {
+    auto& lru = std::get<Lru>(way.cache);
+    const auto* value = lru.Get(key);
+    if (!value) return;
+
+    way.weight -= weigher_(key, *value);
+    lru.Erase(key);
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayLRU<T, U, Hash, Eq>::EvictWeighted(Way& way, size_t max_size) {
+    auto& lru = std::get<Lru>(way.cache);
+    while (lru.GetSize() > max_size || (lru.GetSize() > 0 && way.weight > way.max_weight)) {
+        const T* key = lru.GetLeastUsedKey();
+        UASSERT(key);
+        way.weight -= weigher_(*key, *lru.GetLeastUsed());
+        lru.Erase(*key);
     }
 }
 
@@ -191,14 +392,19 @@ void NWayLRU<T, U, Hash, Equal>::Write(dump::Writer& writer) const {
     writer.Write(caches_.size());
 
     for (const Way& way : caches_) {
-        std::unique_lock<engine::Mutex> lock(way.mutex);
-
-        writer.Write(way.cache.GetSize());
-
-        way.cache.VisitAll([&writer](const T& key, const U& value) {
-            writer.Write(key);
-            writer.Write(value);
-        });
+        std::shared_lock lock(way.mutex);
+
+        std::visit(
+            [&writer](const auto& cache) {
+                writer.Write(cache.GetSize());
+
+                cache.VisitAll([&writer](const T& key, const U& value) {
+                    writer.Write(key);
+                    writer.Write(value);
+                });
+            },
+            way.cache
+        );
     }
 }
 
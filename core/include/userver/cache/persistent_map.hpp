@@ -0,0 +1,517 @@
+#pragma once
+
+/// @file userver/cache/persistent_map.hpp
+/// @brief @copybrief cache::PersistentMap
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <userver/dump/meta.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @ingroup userver_containers
+///
+/// @brief Hash map that shares the unchanged parts between copies
+///
+/// A copy of the map is O(1), and it is not affected by the later changes
+/// of the original. Changes are O(log n): only the path from the root to the
+/// changed element is copied. This makes the map handy for incremental
+/// updates of a large components::CachingComponentBase data:
+///
+/// @code
+/// using Data = cache::PersistentMap<std::string, Item>;
+///
+/// auto data = (type == cache::UpdateType::kIncremental) ? *Get() : Data{};
+/// for (auto& [key, item] : changes) data.insert_or_assign(key, std::move(item));
+/// Set(std::move(data));
+/// @endcode
+///
+/// The previous and the new cache snapshots then share all the untouched
+/// elements.
+///
+/// Iteration order is unspecified. Simultaneous reads from different threads
+/// are safe, even if the data is shared with a copy that is being modified.
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename Equal = std::equal_to<Key>>
+class PersistentMap final {
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<const Key, Value>;
+    using size_type = std::size_t;
+    using hasher = Hash;
+    using key_equal = Equal;
+
+    class const_iterator;
+    using iterator = const_iterator;
+
+    PersistentMap() = default;
+
+    PersistentMap(std::initializer_list<value_type> values) {
+        for (const auto& value : values) insert_or_assign(value.first, value.second);
+    }
+
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    /// @returns pointer to the value of `key` or nullptr if there is no such
+    /// key
+    const Value* FindOrNullptr(const Key& key) const;
+
+    bool contains(const Key& key) const { return FindOrNullptr(key) != nullptr; }
+
+    /// @throws std::out_of_range if there is no such key
+    const Value& at(const Key& key) const;
+
+    /// Sets the value of `key`, returns `true` if the key was inserted and
+    /// `false` if it was assigned
+    template <typename V>
+    bool insert_or_assign(Key key, V&& value);
+
+    /// Returns the number of erased elements, 0 or 1
+    size_type erase(const Key& key);
+
+    void clear() noexcept {
+        root_.reset();
+        size_ = 0;
+    }
+
+    const_iterator begin() const { return const_iterator{root_.get()}; }
+    const_iterator end() const noexcept { return const_iterator{}; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+private:
+    struct Node;
+    using NodePtr = std::shared_ptr<const Node>;
+
+    static constexpr std::size_t kBitsPerLevel = 5;
+    static constexpr std::size_t kHashBits = sizeof(std::size_t) * 8;
+    static constexpr std::size_t kLevelMask = (std::size_t{1} << kBitsPerLevel) - 1;
+
+    // CHAMP-like node: values and children are indexed by the popcount of the
+    // lower bits of their bitmaps. Nodes deeper than the hash bits keep the
+    // colliding values in a plain list.
+    struct Node final {
+        std::uint32_t value_map{0};
+        std::uint32_t child_map{0};
+        bool is_collision{false};
+        std::vector<value_type> values;
+        std::vector<NodePtr> children;
+    };
+
+    static std::uint32_t GetBit(std::size_t hash, std::size_t shift) noexcept {
+        return std::uint32_t{1} << ((hash >> shift) & kLevelMask);
+    }
+
+    static std::size_t GetIndex(std::uint32_t bitmap, std::uint32_t bit) noexcept {
+        return __builtin_popcount(bitmap & (bit - 1));
+    }
+
+    static std::vector<value_type>
+    CopyReplaced(const std::vector<value_type>& values, std::size_t index, value_type&& value) {
+        std::vector<value_type> result;
+        result.reserve(values.size());
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            if (i == index) {
+                result.push_back(std::move(value));
+            } else {
+                result.push_back(values[i]);
+            }
+        }
+        return result;
+    }
+
+    static std::vector<value_type>
+    CopyInserted(const std::vector<value_type>& values, std::size_t index, value_type&& value) {
+        std::vector<value_type> result;
+        result.reserve(values.size() + 1);
+        for (std::size_t i = 0; i < index; ++i) result.push_back(values[i]);
+        result.push_back(std::move(value));
+        for (std::size_t i = index; i < values.size(); ++i) result.push_back(values[i]);
+        return result;
+    }
+
+    static std::vector<value_type> CopyErased(const std::vector<value_type>& values, std::size_t index) {
+        std::vector<value_type> result;
+        result.reserve(values.size() - 1);
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            if (i != index) result.push_back(values[i]);
+        }
+        return result;
+    }
+
+    NodePtr MergeValues(
+        std::size_t shift,
+        value_type&& first,
+        std::size_t first_hash,
+        value_type&& second,
+        std::size_t second_hash
+    ) const;
+
+    NodePtr DoInsert(const Node* node, std::size_t shift, std::size_t hash, value_type&& value, bool& inserted) const;
+
+    NodePtr DoErase(const NodePtr& node, std::size_t shift, std::size_t hash, const Key& key) const;
+
+    NodePtr root_;
+    size_type size_{0};
+    Hash hash_;
+    Equal equal_;
+};
+
+/// Forward iterator over the elements of cache::PersistentMap
+template <typename Key, typename Value, typename Hash, typename Equal>
+class PersistentMap<Key, Value, Hash, Equal>::const_iterator final {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = PersistentMap::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = const value_type&;
+    using pointer = const value_type*;
+
+    const_iterator() = default;
+
+    reference operator*() const {
+        UASSERT(!frames_.empty());
+        const auto& frame = frames_.back();
+        return frame.node->values[frame.index];
+    }
+
+    pointer operator->() const { return &**this; }
+
+    const_iterator& operator++() {
+        UASSERT(!frames_.empty());
+        ++frames_.back().index;
+        SkipToValue();
+        return *this;
+    }
+
+    const_iterator operator++(int) {
+        auto copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    bool operator==(const const_iterator& other) const noexcept {
+        if (frames_.size() != other.frames_.size()) return false;
+        if (frames_.empty()) return true;
+        return frames_.back().node == other.frames_.back().node && frames_.back().index == other.frames_.back().index;
+    }
+
+    bool operator!=(const const_iterator& other) const noexcept { return !(*this == other); }
+
+private:
+    friend class PersistentMap;
+
+    struct Frame final {
+        const Node* node;
+        // values are visited first, then the children
+        std::size_t index;
+    };
+
+    explicit const_iterator(const Node* root) {
+        if (root) {
+            frames_.push_back({root, 0});
+            SkipToValue();
+        }
+    }
+
+    void SkipToValue() {
+        while (!frames_.empty()) {
+            auto& frame = frames_.back();
+            const auto values_count = frame.node->values.size();
+            if (frame.index < values_count) return;
+
+            const auto child_index = frame.index - values_count;
+            if (child_index < frame.node->children.size()) {
+                ++frame.index;
+                const Node* child = frame.node->children[child_index].get();
+                frames_.push_back({child, 0});
+            } else {
+                frames_.pop_back();
+            }
+        }
+    }
+
+    std::vector<Frame> frames_;
+};
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+const Value* PersistentMap<Key, Value, Hash, Equal>::FindOrNullptr(const Key& key) const {
+    const auto hash = hash_(key);
+    const Node* node = root_.get();
+    std::size_t shift = 0;
+
+    while (node) {
+        if (node->is_collision) {
+            for (const auto& value : node->values) {
+                if (equal_(value.first, key)) return &value.second;
+            }
+            return nullptr;
+        }
+
+        const auto bit = GetBit(hash, shift);
+        if (node->value_map & bit) {
+            const auto& value = node->values[GetIndex(node->value_map, bit)];
+            return equal_(value.first, key) ? &value.second : nullptr;
+        }
+        if (!(node->child_map & bit)) return nullptr;
+
+        node = node->children[GetIndex(node->child_map, bit)].get();
+        shift += kBitsPerLevel;
+    }
+    return nullptr;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+const Value& PersistentMap<Key, Value, Hash, Equal>::at(const Key& key) const {
+    const auto* value = FindOrNullptr(key);
+    if (!value) throw std::out_of_range("No such key in cache::PersistentMap");
+    return *value;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+template <typename V>
+bool PersistentMap<Key, Value, Hash, Equal>::insert_or_assign(Key key, V&& value) {
+    const auto hash = hash_(key);
+    bool inserted = false;
+    root_ = DoInsert(root_.get(), 0, hash, value_type{std::move(key), std::forward<V>(value)}, inserted);
+    if (inserted) ++size_;
+    return inserted;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+typename PersistentMap<Key, Value, Hash, Equal>::size_type PersistentMap<Key, Value, Hash, Equal>::erase(const Key& key
+) {
+    if (!root_) return 0;
+
+    auto new_root = DoErase(root_, 0, hash_(key), key);
+    if (new_root == root_) return 0;
+
+    root_ = std::move(new_root);
+    --size_;
+    return 1;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+typename PersistentMap<Key, Value, Hash, Equal>::NodePtr PersistentMap<Key, Value, Hash, Equal>::MergeValues(
+    std::size_t shift,
+    value_type&& first,
+    std::size_t first_hash,
+    value_type&& second,
+    std::size_t second_hash
+) const {
+    auto node = std::make_shared<Node>();
+    if (shift >= kHashBits) {
+        node->is_collision = true;
+        node->values.reserve(2);
+        node->values.push_back(std::move(first));
+        node->values.push_back(std::move(second));
+        return node;
+    }
+
+    const auto first_bit = GetBit(first_hash, shift);
+    const auto second_bit = GetBit(second_hash, shift);
+    if (first_bit == second_bit) {
+        node->child_map = first_bit;
+        node->children.push_back(
+            MergeValues(shift + kBitsPerLevel, std::move(first), first_hash, std::move(second), second_hash)
+        );
+        return node;
+    }
+
+    node->value_map = first_bit | second_bit;
+    node->values.reserve(2);
+    if (first_bit < second_bit) {
+        node->values.push_back(std::move(first));
+        node->values.push_back(std::move(second));
+    } else {
+        node->values.push_back(std::move(second));
+        node->values.push_back(std::move(first));
+    }
+    return node;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+typename PersistentMap<Key, Value, Hash, Equal>::NodePtr PersistentMap<Key, Value, Hash, Equal>::DoInsert(
+    const Node* node,
+    std::size_t shift,
+    std::size_t hash,
+    value_type&& value,
+    bool& inserted
+) const {
+    if (!node) {
+        auto result = std::make_shared<Node>();
+        result->value_map = GetBit(hash, shift);
+        result->values.push_back(std::move(value));
+        inserted = true;
+        return result;
+    }
+
+    if (!node->is_collision && (node->child_map & GetBit(hash, shift))) {
+        const auto child_index = GetIndex(node->child_map, GetBit(hash, shift));
+        auto result = std::make_shared<Node>(*node);
+        result->children[child_index] =
+            DoInsert(node->children[child_index].get(), shift + kBitsPerLevel, hash, std::move(value), inserted);
+        return result;
+    }
+
+    auto result = std::make_shared<Node>();
+    result->value_map = node->value_map;
+    result->child_map = node->child_map;
+    result->is_collision = node->is_collision;
+
+    if (node->is_collision) {
+        for (std::size_t i = 0; i < node->values.size(); ++i) {
+            if (equal_(node->values[i].first, value.first)) {
+                result->values = CopyReplaced(node->values, i, std::move(value));
+                return result;
+            }
+        }
+        result->values = CopyInserted(node->values, node->values.size(), std::move(value));
+        inserted = true;
+        return result;
+    }
+
+    const auto bit = GetBit(hash, shift);
+    if (node->value_map & bit) {
+        const auto index = GetIndex(node->value_map, bit);
+        const auto& existing = node->values[index];
+        if (equal_(existing.first, value.first)) {
+            result->values = CopyReplaced(node->values, index, std::move(value));
+            result->children = node->children;
+            return result;
+        }
+
+        // Push both values one level down
+        auto child = MergeValues(
+            shift + kBitsPerLevel, value_type{existing}, hash_(existing.first), std::move(value), hash
+        );
+        inserted = true;
+
+        result->values = CopyErased(node->values, index);
+        result->value_map ^= bit;
+        result->child_map |= bit;
+        const auto child_index = GetIndex(result->child_map, bit);
+        result->children.reserve(node->children.size() + 1);
+        result->children.insert(result->children.end(), node->children.begin(), node->children.begin() + child_index);
+        result->children.push_back(std::move(child));
+        result->children.insert(result->children.end(), node->children.begin() + child_index, node->children.end());
+        return result;
+    }
+
+    result->value_map |= bit;
+    result->values = CopyInserted(node->values, GetIndex(node->value_map, bit), std::move(value));
+    result->children = node->children;
+    inserted = true;
+    return result;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+typename PersistentMap<Key, Value, Hash, Equal>::NodePtr PersistentMap<Key, Value, Hash, Equal>::DoErase(
+    const NodePtr& node,
+    std::size_t shift,
+    std::size_t hash,
+    const Key& key
+) const {
+    UASSERT(node);
+
+    if (node->is_collision) {
+        for (std::size_t i = 0; i < node->values.size(); ++i) {
+            if (!equal_(node->values[i].first, key)) continue;
+            if (node->values.size() == 1) return nullptr;
+
+            auto result = std::make_shared<Node>();
+            result->is_collision = true;
+            result->values = CopyErased(node->values, i);
+            return result;
+        }
+        return node;
+    }
+
+    const auto bit = GetBit(hash, shift);
+    if (node->value_map & bit) {
+        const auto index = GetIndex(node->value_map, bit);
+        if (!equal_(node->values[index].first, key)) return node;
+        if (node->values.size() == 1 && node->children.empty()) return nullptr;
+
+        auto result = std::make_shared<Node>();
+        result->value_map = node->value_map ^ bit;
+        result->child_map = node->child_map;
+        result->values = CopyErased(node->values, index);
+        result->children = node->children;
+        return result;
+    }
+
+    if (!(node->child_map & bit)) return node;
+
+    const auto child_index = GetIndex(node->child_map, bit);
+    const auto& child = node->children[child_index];
+    auto new_child = DoErase(child, shift + kBitsPerLevel, hash, key);
+    if (new_child == child) return node;
+
+    // Keep single values inline, so that lookups do not go deeper than needed
+    const bool inline_child = new_child && new_child->values.size() == 1 && new_child->children.empty();
+    if (new_child && !inline_child) {
+        auto result = std::make_shared<Node>(*node);
+        result->children[child_index] = std::move(new_child);
+        return result;
+    }
+    if (!new_child && node->values.empty() && node->children.size() == 1) return nullptr;
+
+    auto result = std::make_shared<Node>();
+    result->value_map = node->value_map;
+    result->child_map = node->child_map ^ bit;
+    if (inline_child) {
+        result->value_map |= bit;
+        result->values =
+            CopyInserted(node->values, GetIndex(node->value_map, bit), value_type{new_child->values.front()});
+    } else {
+        result->values = std::vector<value_type>(node->values.begin(), node->values.end());
+    }
+    result->children.reserve(node->children.size() - 1);
+    for (std::size_t i = 0; i < node->children.size(); ++i) {
+        if (i != child_index) result->children.push_back(node->children[i]);
+    }
+    return result;
+}
+
+/// @brief cache::PersistentMap serialization for cache dumps
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::enable_if_t<dump::kIsWritable<Key> && dump::kIsWritable<Value>>
+Write(dump::Writer& writer, const PersistentMap<Key, Value, Hash, Equal>& map) {
+    writer.Write(map.size());
+    for (const auto& [key, value] : map) {
+        writer.Write(key);
+        writer.Write(value);
+    }
+}
+
+/// @brief cache::PersistentMap deserialization for cache dumps
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::enable_if_t<dump::kIsReadable<Key> && dump::kIsReadable<Value>, PersistentMap<Key, Value, Hash, Equal>>
+Read(dump::Reader& reader, dump::To<PersistentMap<Key, Value, Hash, Equal>>) {
+    const auto size = reader.Read<std::size_t>();
+    PersistentMap<Key, Value, Hash, Equal> result;
+    for (std::size_t i = 0; i < size; ++i) {
+        auto key = reader.Read<Key>();
+        result.insert_or_assign(std::move(key), reader.Read<Value>());
+    }
+    return result;
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,277 @@
+#pragma once
+
+/// @file userver/cache/persistent_vector.hpp
+/// @brief @copybrief cache::PersistentVector
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <userver/dump/meta.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @ingroup userver_containers
+///
+/// @brief Vector that shares the unchanged parts between copies
+///
+/// A copy of the vector is O(1), and it is not affected by the later changes
+/// of the original. Element access, set(), push_back() and pop_back() are
+/// O(log n) with a base of 32: only the path from the root to the changed
+/// element is copied.
+///
+/// Useful for incremental updates of a large
+/// components::CachingComponentBase data, see cache::PersistentMap for an
+/// example.
+template <typename T>
+class PersistentVector final {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = const T&;
+    using const_reference = const T&;
+
+    class const_iterator;
+    using iterator = const_iterator;
+
+    PersistentVector() = default;
+
+    PersistentVector(std::initializer_list<T> values) {
+        for (const auto& value : values) push_back(value);
+    }
+
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    const T& operator[](size_type index) const {
+        UASSERT(index < size_);
+        const Node* node = root_.get();
+        for (auto shift = shift_; shift > 0; shift -= kBitsPerLevel) {
+            node = node->children[(index >> shift) & kLevelMask].get();
+        }
+        return node->values[index & kLevelMask];
+    }
+
+    /// @throws std::out_of_range if `index` is out of range
+    const T& at(size_type index) const {
+        if (index >= size_) throw std::out_of_range("Index is out of range of cache::PersistentVector");
+        return (*this)[index];
+    }
+
+    const T& front() const { return (*this)[0]; }
+    const T& back() const { return (*this)[size_ - 1]; }
+
+    /// Replaces the element at `index`
+    template <typename U>
+    void set(size_type index, U&& value) {
+        UASSERT(index < size_);
+        root_ = DoSet(*root_, shift_, index, std::forward<U>(value));
+    }
+
+    template <typename U>
+    void push_back(U&& value);
+
+    void pop_back();
+
+    void clear() noexcept {
+        root_.reset();
+        size_ = 0;
+        shift_ = 0;
+    }
+
+    const_iterator begin() const noexcept { return const_iterator{this, 0}; }
+    const_iterator end() const noexcept { return const_iterator{this, size_}; }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+private:
+    struct Node;
+    using NodePtr = std::shared_ptr<const Node>;
+
+    static constexpr std::size_t kBitsPerLevel = 5;
+    static constexpr std::size_t kLevelMask = (std::size_t{1} << kBitsPerLevel) - 1;
+
+    // Inner nodes have only children, leaves have only values
+    struct Node final {
+        std::vector<NodePtr> children;
+        std::vector<T> values;
+    };
+
+    template <typename U>
+    static NodePtr DoSet(const Node& node, std::size_t shift, size_type index, U&& value) {
+        auto result = std::make_shared<Node>(node);
+        if (shift == 0) {
+            result->values[index & kLevelMask] = std::forward<U>(value);
+        } else {
+            auto& child = result->children[(index >> shift) & kLevelMask];
+            child = DoSet(*child, shift - kBitsPerLevel, index, std::forward<U>(value));
+        }
+        return result;
+    }
+
+    template <typename U>
+    static NodePtr DoPushBack(const Node* node, std::size_t shift, size_type index, U&& value) {
+        auto result = node ? std::make_shared<Node>(*node) : std::make_shared<Node>();
+        if (shift == 0) {
+            result->values.push_back(std::forward<U>(value));
+            return result;
+        }
+
+        const auto child_index = (index >> shift) & kLevelMask;
+        if (child_index < result->children.size()) {
+            auto& child = result->children[child_index];
+            child = DoPushBack(child.get(), shift - kBitsPerLevel, index, std::forward<U>(value));
+        } else {
+            result->children.push_back(DoPushBack(nullptr, shift - kBitsPerLevel, index, std::forward<U>(value)));
+        }
+        return result;
+    }
+
+    static NodePtr DoPopBack(const Node& node, std::size_t shift, size_type index) {
+        if (shift == 0) {
+            if (node.values.size() == 1) return nullptr;
+            auto result = std::make_shared<Node>();
+            result->values.assign(node.values.begin(), node.values.end() - 1);
+            return result;
+        }
+
+        auto result = std::make_shared<Node>(node);
+        const auto child_index = (index >> shift) & kLevelMask;
+        auto child = DoPopBack(*result->children[child_index], shift - kBitsPerLevel, index);
+        if (child) {
+            result->children[child_index] = std::move(child);
+        } else {
+            result->children.pop_back();
+            if (result->children.empty()) return nullptr;
+        }
+        return result;
+    }
+
+    NodePtr root_;
+    size_type size_{0};
+    std::size_t shift_{0};
+};
+
+/// Random access iterator over the elements of cache::PersistentVector
+template <typename T>
+class PersistentVector<T>::const_iterator final {
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = const T&;
+    using pointer = const T*;
+
+    const_iterator() = default;
+
+    reference operator*() const { return (*vector_)[index_]; }
+    pointer operator->() const { return &**this; }
+    reference operator[](difference_type offset) const { return *(*this + offset); }
+
+    const_iterator& operator++() noexcept {
+        ++index_;
+        return *this;
+    }
+    const_iterator operator++(int) noexcept {
+        auto copy = *this;
+        ++index_;
+        return copy;
+    }
+    const_iterator& operator--() noexcept {
+        --index_;
+        return *this;
+    }
+    const_iterator operator--(int) noexcept {
+        auto copy = *this;
+        --index_;
+        return copy;
+    }
+
+    const_iterator& operator+=(difference_type offset) noexcept {
+        index_ += offset;
+        return *this;
+    }
+    const_iterator& operator-=(difference_type offset) noexcept {
+        index_ -= offset;
+        return *this;
+    }
+    const_iterator operator+(difference_type offset) const noexcept { return const_iterator{vector_, index_ + offset}; }
+    const_iterator operator-(difference_type offset) const noexcept { return const_iterator{vector_, index_ - offset}; }
+    friend const_iterator operator+(difference_type offset, const const_iterator& it) noexcept { return it + offset; }
+
+    difference_type operator-(const const_iterator& other) const noexcept {
+        return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+    }
+
+    bool operator==(const const_iterator& other) const noexcept { return index_ == other.index_; }
+    bool operator!=(const const_iterator& other) const noexcept { return index_ != other.index_; }
+    bool operator<(const const_iterator& other) const noexcept { return index_ < other.index_; }
+    bool operator>(const const_iterator& other) const noexcept { return index_ > other.index_; }
+    bool operator<=(const const_iterator& other) const noexcept { return index_ <= other.index_; }
+    bool operator>=(const const_iterator& other) const noexcept { return index_ >= other.index_; }
+
+private:
+    friend class PersistentVector;
+
+    const_iterator(const PersistentVector* vector, size_type index) noexcept : vector_(vector), index_(index) {}
+
+    const PersistentVector* vector_{nullptr};
+    size_type index_{0};
+};
+
+template <typename T>
+template <typename U>
+void PersistentVector<T>::push_back(U&& value) {
+    // Grow the tree by a level when it is full
+    if (root_ && size_ == (size_type{1} << (shift_ + kBitsPerLevel))) {
+        auto new_root = std::make_shared<Node>();
+        new_root->children.push_back(std::move(root_));
+        root_ = std::move(new_root);
+        shift_ += kBitsPerLevel;
+    }
+    root_ = DoPushBack(root_.get(), shift_, size_, std::forward<U>(value));
+    ++size_;
+}
+
+template <typename T>
+void PersistentVector<T>::pop_back() {
+    UASSERT(size_ > 0);
+    root_ = DoPopBack(*root_, shift_, size_ - 1);
+    --size_;
+
+    // Shrink the tree while the root has a single child
+    while (root_ && shift_ > 0 && root_->children.size() == 1) {
+        root_ = root_->children.front();
+        shift_ -= kBitsPerLevel;
+    }
+    if (!root_) shift_ = 0;
+}
+
+/// @brief cache::PersistentVector serialization for cache dumps
+template <typename T>
+std::enable_if_t<dump::kIsWritable<T>> Write(dump::Writer& writer, const PersistentVector<T>& vector) {
+    writer.Write(vector.size());
+    for (const auto& value : vector) writer.Write(value);
+}
+
+/// @brief cache::PersistentVector deserialization for cache dumps
+template <typename T>
+std::enable_if_t<dump::kIsReadable<T>, PersistentVector<T>> Read(dump::Reader& reader, dump::To<PersistentVector<T>>) {
+    const auto size = reader.Read<std::size_t>();
+    PersistentVector<T> result;
+    for (std::size_t i = 0; i < size; ++i) result.push_back(reader.Read<T>());
+    return result;
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -33,6 +33,7 @@ namespace clients::dns {
 /// cache-size-per-way | size of each way of network cache | 256
 /// cache-max-reply-ttl | TTL limit for network replies caching | 5m
 /// cache-failure-ttl | TTL for network failures caching | 5s
+/// cache-prefetch-ratio | part of the reply TTL at the end of which a resolution of the name refreshes the cached reply in background | 0.1
 ///
 /// ## Static configuration example:
 ///
@@ -39,6 +39,12 @@ struct ResolverConfig {
 
     /// Network cache failure TTL
     std::chrono::milliseconds cache_failure_ttl{std::chrono::seconds{5}};
+
+    /// Part of the reply TTL at the end of which a resolution of the name
+    /// refreshes the cached reply in background, so that the frequently
+    /// resolved names do not expire. The refresh is never started later than
+    /// `network_timeout` before the expiration.
+    double cache_prefetch_ratio{0.1};
 };
 
 }  // namespace clients::dns
@@ -0,0 +1,116 @@
+#pragma once
+
+/// @file userver/clients/http/adaptive_hedging.hpp
+/// @brief @copybrief clients::http::AdaptiveHedging
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <userver/clients/http/request.hpp>
+#include <userver/clients/http/response.hpp>
+#include <userver/clients/http/response_future.hpp>
+#include <userver/utils/hedged_request.hpp>
+#include <userver/utils/retry_budget.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+class Client;
+
+struct AdaptiveHedgingSettings final {
+    /// Percentile of the recent timings of the destination to use as the
+    /// hedging delay
+    double percentile{95};
+    /// Hedging delay until the destination has enough timing samples
+    std::chrono::milliseconds default_delay{50};
+    std::chrono::milliseconds min_delay{1};
+    std::chrono::milliseconds max_delay{1000};
+    /// Number of recent timing samples required to trust the percentile
+    std::uint64_t min_samples{100};
+    /// How often the hedging delay is recomputed
+    std::chrono::milliseconds update_period{1000};
+
+    /// Maximum requests to do, including the first one
+    std::size_t max_attempts{3};
+    /// Max time to wait for all requests
+    std::chrono::milliseconds timeout_all{100};
+
+    /// Every hedge and retry spends a token, every successful reply returns
+    /// `token_ratio` of a token, so once the budget is drained the extra
+    /// requests are limited to about `token_ratio` of the successful ones
+    utils::RetryBudgetSettings budget;
+};
+
+/// @brief Hedging delay that tracks a percentile of the recent timings of a
+/// destination from the HTTP client statistics, with a cap on the extra load.
+///
+/// The destination is the one from Request::SetDestinationMetricName() or the
+/// automatic one, see "httpclient.destinations". Thread-safe, an instance is
+/// expected to be shared by all the requests to the destination.
+class AdaptiveHedging final {
+public:
+    AdaptiveHedging(const Client& client, std::string destination, const AdaptiveHedgingSettings& settings);
+
+    /// Settings for utils::hedging with the current hedging delay
+    utils::hedging::HedgingSettings GetHedgingSettings();
+
+    std::chrono::milliseconds GetHedgingDelay();
+
+    /// Spends the budget on a hedge or a retry, returns false if the extra
+    /// request should not be made
+    bool TryStartExtraAttempt() noexcept;
+
+    /// Returns a part of a token to the budget
+    void AccountSuccess() noexcept;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    const Client& client_;
+    const std::string destination_;
+    const AdaptiveHedgingSettings settings_;
+    utils::RetryBudget budget_;
+
+    std::atomic<std::chrono::milliseconds::rep> delay_ms_;
+    std::atomic<Clock::rep> next_update_{0};
+};
+
+/// @brief RequestStrategy for utils::hedging that performs HTTP requests
+/// created by `make_request` and feeds the replies to AdaptiveHedging.
+///
+/// Transport errors and 5xx responses are retried right away if the budget
+/// allows.
+class AdaptiveHedgingStrategy final {
+public:
+    AdaptiveHedgingStrategy(std::function<Request()> make_request, AdaptiveHedging& hedging);
+
+    /// @cond
+    // Methods needed by utils::hedging::HedgeRequest
+    std::optional<ResponseFuture> Create(std::size_t attempt);
+    std::optional<std::chrono::milliseconds> ProcessReply(ResponseFuture&& future);
+    std::optional<std::shared_ptr<Response>> ExtractReply();
+    void Finish(ResponseFuture&& future);
+    /// @endcond
+
+private:
+    std::function<Request()> make_request_;
+    AdaptiveHedging* hedging_;
+    std::optional<std::shared_ptr<Response>> reply_;
+};
+
+/// @brief Performs a hedged HTTP request with the adaptive hedging delay.
+///
+/// Returns std::nullopt if no attempt has succeeded within
+/// AdaptiveHedgingSettings::timeout_all.
+std::optional<std::shared_ptr<Response>>
+HedgeRequest(std::function<Request()> make_request, AdaptiveHedging& hedging);
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
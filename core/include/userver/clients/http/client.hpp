@@ -8,6 +8,7 @@
 #endif
 
 #include <memory>
+#include <vector>
 
 #include <userver/moodycamel/concurrentqueue_fwd.h>
 
@@ -32,6 +33,7 @@ class TracingManagerBase;
 namespace curl {
 class easy;
 class multi;
+class share;
 class ConnectRateLimiter;
 }  // namespace curl
 
@@ -41,7 +43,10 @@ class ThreadPool;
 
 namespace clients::http {
 namespace impl {
+class AddressBalancer;
+class DestinationSharding;
 class EasyWrapper;
+class RequestCoalescer;
 }  // namespace impl
 
 struct TestsuiteConfig;
@@ -77,6 +82,20 @@ public:
     /// @note This method is thread-safe despite being non-const.
     Request CreateNotSignedRequest() { return CreateRequest(); }
 
+    /// @brief Performs all the `requests` asynchronously, the same as calling
+    /// Request::async_perform() for each of them, but wakes up each of the IO
+    /// threads only once.
+    ///
+    /// Returned futures are in the order of `requests` and work with
+    /// engine::WaitAny and engine::GetAll. The requests that use a custom DNS
+    /// resolver or are coalesced are started separately.
+    ///
+    /// @note This method is thread-safe despite being non-const.
+    [[nodiscard]] std::vector<ResponseFuture> AsyncPerformBatch(
+        std::vector<Request>& requests,
+        utils::impl::SourceLocation location = utils::impl::SourceLocation::Current()
+    );
+
     /// @cond
     // For internal use only.
     void SetMultiplexingEnabled(bool enabled);
@@ -127,6 +146,15 @@ public:
 private:
     void ReinitEasy();
 
+    // Creates a request bound to the `multi_index`-th IO thread
+    Request CreateBoundRequest(std::size_t multi_index);
+
+    void PrepareRequest(Request& request);
+
+    // Opens or refreshes `connections` connections to each of the warm
+    // destinations in each IO thread
+    void WarmUpConnections();
+
     InstanceStatistics GetMultiStatistics(size_t n) const;
 
     size_t FindMultiIndex(const curl::multi*) const;
@@ -146,9 +174,13 @@ private:
     CancellationPolicy cancellation_policy_;
 
     std::shared_ptr<DestinationStatistics> destination_statistics_;
+    std::shared_ptr<impl::RequestCoalescer> request_coalescer_;
+    std::shared_ptr<impl::AddressBalancer> address_balancer_;
     std::unique_ptr<engine::ev::ThreadPool> thread_pool_;
     std::vector<Statistics> statistics_;
     std::vector<std::unique_ptr<curl::multi>> multis_;
+    std::unique_ptr<impl::DestinationSharding> destination_sharding_;
+    std::shared_ptr<curl::share> tls_session_share_;
 
     static constexpr size_t kIdleQueueSize = 616;
     static constexpr size_t kIdleQueueAlignment = 8;
@@ -164,6 +196,9 @@ private:
     utils::SwappingSmart<const curl::easy> easy_;
     utils::PeriodicTask easy_reinit_task_;
 
+    const std::vector<WarmConnectionsConfig> warm_connections_;
+    utils::PeriodicTask warm_connections_task_;
+
     // Testsuite support
     std::shared_ptr<const TestsuiteConfig> testsuite_config_;
     rcu::Variable<std::vector<std::string>> allowed_urls_extra_;
@@ -48,6 +48,10 @@ namespace components {
 /// set-deadline-propagation-header | whether to set http::common::kXYaTaxiClientTimeoutMs request header, see @ref scripts/docs/en/userver/deadline_propagation.md | true
 /// plugins | Plugin names to apply. A plugin component is called "http-client-plugin-" plus the plugin name. | []
 /// cancellation-policy | Cancellation policy for new requests. | cancel
+/// warm-connections | list of `{url, connections}` destinations to keep `connections` established connections to in each IO thread, opened at start and periodically refreshed with HEAD requests to `url` | []
+/// warm-connections-period | how often to refresh the warm connections | 30s
+/// shard-by-destination | perform all the requests to a host (or to a proxy) in the same IO thread, so that keep-alive connections and HTTP/2 multiplexing are reused in its connection cache | false
+/// share-tls-sessions | share TLS sessions between the IO threads and all the HTTP clients of the process, so that the new connections resume them | true
 ///
 /// ## Static configuration example:
 ///
@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <string>
+#include <vector>
 
 #include <userver/dynamic_config/fwd.hpp>
 #include <userver/formats/json_fwd.hpp>
@@ -26,6 +27,15 @@ enum class CancellationPolicy {
 
 CancellationPolicy Parse(yaml_config::YamlConfig value, formats::parse::To<CancellationPolicy>);
 
+/// Destination to keep open connections to in each IO thread
+struct WarmConnectionsConfig final {
+    /// URL that is requested with HEAD to open or refresh a connection
+    std::string url;
+    std::size_t connections{1};
+};
+
+WarmConnectionsConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<WarmConnectionsConfig>);
+
 // Static config
 struct ClientSettings final {
     std::string thread_name_prefix{};
@@ -33,6 +43,13 @@ struct ClientSettings final {
     DeadlinePropagationConfig deadline_propagation{};
     const tracing::TracingManagerBase* tracing_manager{nullptr};
     CancellationPolicy cancellation_policy{CancellationPolicy::kCancel};
+    std::vector<WarmConnectionsConfig> warm_connections{};
+    // Should be less than the idle connection lifetime of cURL (118 seconds)
+    std::chrono::milliseconds warm_connections_period{std::chrono::seconds{30}};
+    // Performs all the requests to a host in the same IO thread
+    bool shard_by_destination{false};
+    // Shares TLS sessions between the IO threads and the clients of the process
+    bool share_tls_sessions{true};
 };
 
 ClientSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<ClientSettings>);
@@ -4,7 +4,9 @@
 /// @brief @copybrief clients::http::Plugin
 
 #include <chrono>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <userver/utils/not_null.hpp>
@@ -34,6 +36,16 @@ public:
 
     void SetTimeout(std::chrono::milliseconds ms);
 
+    /// @brief Returns the URL set by the user, without the query parameters
+    /// added by plugins
+    const std::string& GetOriginalUrl() const;
+
+    /// @brief Returns the HTTP method name, or an empty string for a method
+    /// set via Request::set_custom_http_request_method()
+    std::string_view GetMethod() const;
+
+    std::optional<std::string_view> GetHeader(std::string_view name) const;
+
 private:
     RequestState& state_;
 };
@@ -64,6 +76,12 @@ public:
     ///          not do any heavy work here, offload it to other hooks.
     virtual void HookOnCompleted(PluginRequest& request, Response& response) = 0;
 
+    /// @brief The hook is called after HookCreateSpan() and before the request
+    ///        is sent. A plugin may fill the `response` and return true to
+    ///        complete the request without network I/O, the remaining plugins
+    ///        and hooks are not called in that case.
+    virtual bool HookTryReplyLocally(PluginRequest& request, Response& response);
+
 private:
     const std::string name_;
 };
@@ -80,6 +98,8 @@ public:
 
     void HookOnCompleted(RequestState& request, Response& response);
 
+    bool HookTryReplyLocally(RequestState& request, Response& response);
+
 private:
     const std::vector<utils::NotNull<Plugin*>> plugins_;
 };
@@ -0,0 +1,65 @@
+#pragma once
+
+/// @file userver/clients/http/plugins/response_cache/component.hpp
+/// @brief @copybrief clients::http::plugins::response_cache::Component
+
+#include <memory>
+
+#include <userver/clients/http/plugin_component.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::response_cache {
+
+class Plugin;
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief HTTP client plugin that caches GET responses in memory according to
+/// their `Cache-Control` and `ETag` headers.
+///
+/// Fresh responses are served without network I/O, stale responses with an
+/// ETag are revalidated with `If-None-Match`. Responses with `Vary` or
+/// `Cache-Control: no-store` are not cached. Each destination has its own LRU
+/// with its own memory budget; requests that match no destination are not
+/// cached. Statistics are written as `httpclient.response-cache.*` labeled
+/// with `http_destination`.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// destinations | list of destinations to cache, the first one with a matching prefix is used | []
+/// destinations.[].url-prefix | requests with URLs starting with the prefix are cached | -
+/// destinations.[].max-memory-bytes | memory budget of the destination cache | 16777216
+/// destinations.[].max-entries | max number of cached responses of the destination | 1000
+
+// clang-format on
+class Component final : public plugin::ComponentBase {
+public:
+    /// @ingroup userver_component_names
+    /// @brief The default name of
+    /// clients::http::plugins::response_cache::Component component
+    static constexpr std::string_view kName = "http-client-plugin-response-cache";
+
+    Component(const components::ComponentConfig&, const components::ComponentContext&);
+
+    ~Component() override;
+
+    http::Plugin& GetPlugin() override;
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    std::unique_ptr<response_cache::Plugin> plugin_;
+    utils::statistics::Entry statistics_holder_;
+};
+
+}  // namespace clients::http::plugins::response_cache
+
+template <>
+inline constexpr bool components::kHasValidate<clients::http::plugins::response_cache::Component> = true;
+
+USERVER_NAMESPACE_END
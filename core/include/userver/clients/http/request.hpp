@@ -4,12 +4,15 @@
 /// @brief @copybrief clients::http::Request
 
 #include <memory>
+#include <optional>
+#include <string>
 #include <string_view>
 #include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/clients/http/error.hpp>
 #include <userver/clients/http/plugin.hpp>
+#include <userver/clients/http/request_body_stream.hpp>
 #include <userver/clients/http/response.hpp>
 #include <userver/clients/http/response_future.hpp>
 #include <userver/concurrent/queue.hpp>
@@ -24,9 +27,14 @@ namespace tracing {
 class TracingManagerBase;
 }  // namespace tracing
 
+namespace curl {
+class share;
+}  // namespace curl
+
 /// HTTP client helpers
 namespace clients::http {
 
+class Client;
 class RequestState;
 class StreamedResponse;
 class ConnectTo;
@@ -37,7 +45,10 @@ class DestinationStatistics;
 struct TestsuiteConfig;
 
 namespace impl {
+class AddressBalancer;
+class DestinationSharding;
 class EasyWrapper;
+class RequestCoalescer;
 }  // namespace impl
 
 /// HTTP request method
@@ -111,6 +122,9 @@ public:
     /// POST request with url and data
     Request& post(const std::string& url, std::string data = {}) &;
     Request post(const std::string& url, std::string data = {}) &&;
+    /// POST request with url and shared immutable data, see data()
+    Request& post(const std::string& url, std::shared_ptr<const std::string> data) &;
+    Request post(const std::string& url, std::shared_ptr<const std::string> data) &&;
     /// POST request with url and multipart/form-data
     Request& post(const std::string& url, Form&& form) &;
     Request post(const std::string& url, Form&& form) &&;
@@ -120,6 +134,9 @@ public:
     /// PUT request with url and data
     Request& put(const std::string& url, std::string data = {}) &;
     Request put(const std::string& url, std::string data = {}) &&;
+    /// PUT request with url and shared immutable data, see data()
+    Request& put(const std::string& url, std::shared_ptr<const std::string> data) &;
+    Request put(const std::string& url, std::shared_ptr<const std::string> data) &&;
 
     /// PATCH request
     Request& patch() &;
@@ -127,6 +144,9 @@ public:
     /// PATCH request with url and data
     Request& patch(const std::string& url, std::string data = {}) &;
     Request patch(const std::string& url, std::string data = {}) &&;
+    /// PATCH request with url and shared immutable data, see data()
+    Request& patch(const std::string& url, std::shared_ptr<const std::string> data) &;
+    Request patch(const std::string& url, std::shared_ptr<const std::string> data) &&;
 
     /// DELETE request
     Request& delete_method() &;
@@ -148,6 +168,24 @@ public:
     /// data for POST request
     Request& data(std::string data) &;
     Request data(std::string data) &&;
+    /// Shared immutable data for POST request. The buffer is sent without
+    /// copying, so the same payload may be sent by many requests at once.
+    /// The data must not be modified until all the requests are finished.
+    Request& data(std::shared_ptr<const std::string> data) &;
+    Request data(std::shared_ptr<const std::string> data) &&;
+    /// @brief Makes the body streamed: it is sent while the request is in
+    /// flight, from the chunks pushed into the returned RequestBodyStream.
+    ///
+    /// Must be called after the HTTP method is set. Without `content_length`
+    /// the body is sent with chunked transfer encoding. No more than about
+    /// `max_buffered_size` bytes of the pushed chunks are buffered at once.
+    ///
+    /// @warning The streamed body can not be sent again, so the request is not
+    /// retried and can not be reused.
+    [[nodiscard]] RequestBodyStream stream_body(
+        std::optional<std::size_t> content_length = {},
+        std::size_t max_buffered_size = 1024 * 1024
+    );
     /// form for POST request
     Request& form(Form&& form) &;
     Request form(Form&& form) &&;
@@ -244,6 +282,19 @@ public:
         return *this;
     }
 
+    /// @brief Balances the requests among all the addresses the host name
+    /// resolves to, instead of letting cURL pick one from the DNS answer.
+    ///
+    /// The address is picked by power of two choices on the in-flight requests
+    /// count and latency of the addresses. Addresses that repeatedly reply with
+    /// 5xx or fail with network errors and timeouts are temporarily ejected.
+    /// The state is shared by all the requests of a Client.
+    ///
+    /// Works only with the asynchronous DNS resolver of the Client, ignored
+    /// for the requests with connect_to() or with a proxy.
+    Request& load_balance() &;
+    Request load_balance() &&;
+
     /// Override log URL. Useful for "there's a secret in the query".
     /// @warning The query might be logged by other intermediate HTTP agents
     ///          (nginx, L7 balancer, etc.).
@@ -262,6 +313,14 @@ public:
 
     void SetAllowedUrlsExtra(const std::vector<std::string>& urls) &;
 
+    void SetRequestCoalescer(std::shared_ptr<impl::RequestCoalescer> coalescer) &;
+
+    void SetAddressBalancer(std::shared_ptr<impl::AddressBalancer> balancer) &;
+
+    void SetDestinationSharding(const impl::DestinationSharding* sharding) &;
+
+    void SetTlsSessionShare(std::shared_ptr<curl::share> share) &;
+
     // Set deadline propagation settings. For internal use only.
     void SetDeadlinePropagationConfig(const DeadlinePropagationConfig& deadline_propagation_config) &;
     /// @endcond
@@ -278,6 +337,19 @@ public:
     Request& SetTracingManager(const tracing::TracingManagerBase&) &;
     Request SetTracingManager(const tracing::TracingManagerBase&) &&;
 
+    /// @brief Makes concurrent identical GET and HEAD requests of the client
+    /// share a single in-flight request.
+    ///
+    /// Requests are identical if they have the same method, URL and values of
+    /// the `key_headers`. The shared request is performed with the settings
+    /// (timeouts, retries, deadline) of the request that has started it, and
+    /// all the waiters get the same Response object, which should not be
+    /// modified. The shared request is cancelled only when all of its waiters
+    /// cancel their ResponseFuture. Ignored for the other methods and for
+    /// async_perform_stream_body().
+    Request& coalesce(std::vector<std::string> key_headers = {}) &;
+    Request coalesce(std::vector<std::string> key_headers = {}) &&;
+
     /// Perform request asynchronously.
     ///
     /// Works well with engine::WaitAny, engine::WaitAnyFor, and
@@ -323,6 +395,8 @@ public:
     std::string ExtractData();
 
 private:
+    friend class Client;
+
     std::shared_ptr<RequestState> pimpl_;
 };
 
@@ -0,0 +1,55 @@
+#pragma once
+
+/// @file userver/clients/http/request_body_stream.hpp
+/// @brief @copybrief clients::http::RequestBodyStream
+
+#include <memory>
+#include <string>
+
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace impl {
+class RequestBodyStreamState;
+}  // namespace impl
+
+/// @brief Producer of a request body that is sent while the request is in
+/// flight.
+///
+/// Call Request::stream_body() to get one. It allows uploading bodies that
+/// do not fit into memory, e.g. proxying a large file chunk by chunk.
+///
+/// The body ends on Finish() or on destruction of the RequestBodyStream.
+class RequestBodyStream final {
+public:
+    RequestBodyStream(RequestBodyStream&&) noexcept;
+    RequestBodyStream(const RequestBodyStream&) = delete;
+
+    RequestBodyStream& operator=(RequestBodyStream&&) noexcept;
+    RequestBodyStream& operator=(const RequestBodyStream&) = delete;
+
+    ~RequestBodyStream();
+
+    /// Enqueues the next part of the body, waits while too much data is
+    /// buffered.
+    /// @returns false if the chunk was not enqueued because the request has
+    /// finished or the deadline has expired
+    [[nodiscard]] bool PushChunk(std::string&& chunk, engine::Deadline deadline = {});
+
+    /// Marks the end of the body
+    void Finish();
+
+    /// @cond
+    explicit RequestBodyStream(std::shared_ptr<impl::RequestBodyStreamState> state);
+    /// @endcond
+
+private:
+    std::shared_ptr<impl::RequestBodyStreamState> state_;
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -31,6 +31,7 @@ namespace impl {
 enum class ComponentLifetimeStage;
 class ComponentInfo;
 class ComponentContextImpl;
+struct ComponentLoadTimings;
 
 using ComponentFactory =
     std::function<std::unique_ptr<components::RawComponentBase>(const components::ComponentContext&)>;
@@ -192,6 +193,8 @@ private:
 
     RawComponentBase* DoFindComponent(std::string_view name) const;
 
+    std::vector<impl::ComponentLoadTimings> GetLoadTimeline() const;
+
     std::unique_ptr<impl::ComponentContextImpl> impl_;
 };
 
@@ -8,11 +8,13 @@
 #include <userver/concurrent/async_event_source.hpp>
 #include <userver/dynamic_config/source.hpp>
 #include <userver/rcu/rcu.hpp>
+#include <userver/utils/statistics/entry.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace logging {
 struct DynamicDebugConfig;
+struct LogSamplingConfig;
 }
 
 namespace components {
@@ -28,7 +30,9 @@ namespace components {
 ///
 /// ## LoggingConfigurator Dynamic config
 /// * @ref USERVER_LOG_DYNAMIC_DEBUG
+/// * @ref USERVER_LOG_SAMPLING
 /// * @ref USERVER_NO_LOG_SPANS
+/// * @ref USERVER_TRACING_TAIL_SAMPLING
 ///
 /// ## Static options:
 /// Name | Description | Default value
@@ -36,6 +40,9 @@ namespace components {
 /// limited-logging-enable | set to true to make LOG_LIMITED drop repeated logs | -
 /// limited-logging-interval | utils::StringToDuration suitable duration string to group repeated logs into one message | -
 ///
+/// The count of messages dropped by @ref USERVER_LOG_SAMPLING is reported
+/// in the `logger.sampling.suppressed` metric labeled by `location`.
+///
 /// ## Config example:
 ///
 /// @snippet components/common_component_list_test.cpp Sample logging configurator component config
@@ -58,6 +65,8 @@ private:
 
     concurrent::AsyncEventSubscriberScope config_subscription_;
     rcu::Variable<logging::DynamicDebugConfig> dynamic_debug_;
+    rcu::Variable<logging::LogSamplingConfig> log_sampling_;
+    utils::statistics::Entry statistics_holder_;
 };
 
 /// }@
@@ -9,6 +9,7 @@
 #include <userver/dynamic_config/snapshot.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/utils/statistics/entry.hpp>
+#include <userver/utils/statistics/fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -26,6 +27,8 @@ class Manager;
 /// ## ManagerControllerComponent Dynamic config
 /// * @ref USERVER_TASK_PROCESSOR_PROFILER_DEBUG
 /// * @ref USERVER_TASK_PROCESSOR_QOS
+/// * @ref USERVER_METRICS_CARDINALITY_LIMITS, applied to the
+///   components::StatisticsStorage
 ///
 /// ## Static options:
 /// Name | Description | Default value
@@ -45,6 +48,7 @@ class Manager;
 /// preheat_stacktrace_collector | whether to collect a dummy stacktrace at server start up (usable to avoid loading debug info at random point at runtime) | true
 /// userver_experiments.*NAME* | whether to enable certain userver experiments; these are gradually enabled by userver team, for internal use only | false
 /// graceful_shutdown_interval | at shutdown, first hang for this duration with /ping 5xx to give the balancer a chance to redirect new requests to other hosts | 0s
+/// max_concurrent_component_loads | how many component constructors may run at the same time, a constructor waiting for its dependencies does not count; 0 - no limit | 0
 ///
 /// ## Static task_processor options:
 /// Name | Description | Default value
@@ -84,6 +88,7 @@ private:
     void OnConfigUpdate(const dynamic_config::Snapshot& cfg);
 
     const components::Manager& components_manager_;
+    utils::statistics::Storage& statistics_storage_;
     utils::statistics::Entry statistics_holder_;
     concurrent::AsyncEventSubscriberScope config_subscription_;
 };
@@ -17,6 +17,14 @@ enum class ValidationMode {
 ValidationMode Parse(const yaml_config::YamlConfig& value, formats::parse::To<ValidationMode>);
 
 namespace impl {
+
+// Schemas depend only on the code, build each of them once per process
+template <typename Component>
+const yaml_config::Schema& GetCachedStaticConfigSchema() {
+    static const yaml_config::Schema schema = Component::GetStaticConfigSchema();
+    return schema;
+}
+
 template <typename Component>
 void TryValidateStaticConfig(
     std::string_view component_name,
@@ -24,7 +32,7 @@ void TryValidateStaticConfig(
     ValidationMode validation_condition
 ) {
     if (components::kHasValidate<Component> || validation_condition == ValidationMode::kAll) {
-        yaml_config::Schema schema = Component::GetStaticConfigSchema();
+        yaml_config::Schema schema = GetCachedStaticConfigSchema<Component>();
         schema.path = component_name;
 
         yaml_config::impl::Validate(static_config, schema);
@@ -34,7 +42,7 @@ void TryValidateStaticConfig(
 template <typename Component>
 yaml_config::Schema GetStaticConfigSchema() {
     // TODO: implement for kOnlyTurnedOn
-    return Component::GetStaticConfigSchema();
+    return GetCachedStaticConfigSchema<Component>();
 }
 
 }  // namespace impl
@@ -22,6 +22,10 @@ namespace components {
 /// Returned references to utils::statistics::Storage live for a lifetime
 /// of the component and are safe for concurrent use.
 ///
+/// The number of series that did not fit into the
+/// @ref USERVER_METRICS_CARDINALITY_LIMITS is reported in the
+/// `statistics.cardinality-limiter.dropped-series` metric.
+///
 /// The component does **not** have any options for service config.
 ///
 /// ## Static configuration example:
@@ -53,6 +57,7 @@ private:
     utils::statistics::Storage storage_;
     utils::statistics::MetricsStoragePtr metrics_storage_;
     std::vector<utils::statistics::Entry> metrics_storage_registration_;
+    utils::statistics::Entry cardinality_statistics_holder_;
 };
 
 template <>
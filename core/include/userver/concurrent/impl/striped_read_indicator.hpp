@@ -89,12 +89,17 @@ public:
     /// Get the approximate amount of locks held, useful for metrics.
     std::uintptr_t GetActiveCountApprox() const noexcept;
 
-private:
-    friend class StripedReadIndicatorLock;
-
+    /// @brief Marks the indicator as "used" without a StripedReadIndicatorLock,
+    /// for primitives that cannot store the lock, e.g. shared mutexes.
+    /// @warning Each call must be paired with a DoUnlock call.
     void DoLock() noexcept;
+
+    /// @brief Releases the mark of a DoLock call.
     void DoUnlock() noexcept;
 
+private:
+    friend class StripedReadIndicatorLock;
+
     StripedCounter acquired_count_;
     StripedCounter released_count_;
 };
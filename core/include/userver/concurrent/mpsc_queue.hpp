@@ -3,9 +3,11 @@
 /// @file userver/concurrent/mpsc_queue.hpp
 /// @brief Multiple producer, single consumer queue
 
+#include <algorithm>
 #include <atomic>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include <userver/concurrent/impl/intrusive_mpsc_queue.hpp>
 #include <userver/concurrent/impl/semaphore_capacity_control.hpp>
@@ -118,10 +120,14 @@ private:
     bool Push(ProducerToken&, T&&, engine::Deadline);
     bool PushNoblock(ProducerToken&, T&&);
     bool DoPush(ProducerToken&, T&&);
+    bool PushBatch(ProducerToken&, std::vector<T>&, engine::Deadline);
+
 
     bool Pop(ConsumerToken&, T&, engine::Deadline);
     bool PopNoblock(ConsumerToken&, T&);
     bool DoPop(ConsumerToken&, T&);
+    bool PopBatch(ConsumerToken&, std::vector<T>&, std::size_t, engine::Deadline);
+    bool DoPopBatch(ConsumerToken&, std::vector<T>&, std::size_t);
 
     void MarkConsumerIsDead();
     void MarkProducerIsDead();
@@ -214,6 +220,38 @@ bool MpscQueue<T>::DoPush(ProducerToken& /*unused*/, T&& value) {
     return true;
 }
 
+template <typename T>
+bool MpscQueue<T>::PushBatch(ProducerToken& /*unused*/, std::vector<T>& values, engine::Deadline deadline) {
+    if (values.empty()) return !NoMoreConsumers();
+    if (!remaining_capacity_.try_lock_shared_until_count(deadline, values.size())) return false;
+    if (NoMoreConsumers()) {
+        remaining_capacity_.unlock_shared_count(values.size());
+        return false;
+    }
+
+    std::vector<std::unique_ptr<Node>> nodes;
+    try {
+        nodes.reserve(values.size());
+        for (auto& value : values) nodes.push_back(std::make_unique<Node>(std::move(value)));
+    } catch (...) {
+        // Leave the values unmodified
+        for (std::size_t i = 0; i < nodes.size(); ++i) values[i] = std::move(nodes[i]->value);
+        remaining_capacity_.unlock_shared_count(values.size());
+        throw;
+    }
+
+    for (auto& node : nodes) {
+        queue_.Push(*node);
+        (void)node.release();
+    }
+
+    size_ += values.size();
+    values.clear();
+    nonempty_event_.Send();
+
+    return true;
+}
+
 template <typename T>
 bool MpscQueue<T>::Pop(ConsumerToken& token, T& value, engine::Deadline deadline) {
     bool no_more_producers = false;
@@ -253,6 +291,50 @@ bool MpscQueue<T>::DoPop(ConsumerToken& /*unused*/, T& value) {
     return false;
 }
 
+template <typename T>
+bool MpscQueue<T>::PopBatch(
+    ConsumerToken& token,
+    std::vector<T>& values,
+    std::size_t max_count,
+    engine::Deadline deadline
+) {
+    bool no_more_producers = false;
+    const bool success = nonempty_event_.WaitUntil(deadline, [&] {
+        if (DoPopBatch(token, values, max_count)) {
+            return true;
+        }
+        if (NoMoreProducers()) {
+            // Same TOCTOU as in Pop
+            if (!DoPopBatch(token, values, max_count)) {
+                no_more_producers = true;
+            }
+            return true;
+        }
+        return false;
+    });
+    return success && !no_more_producers;
+}
+
+template <typename T>
+bool MpscQueue<T>::DoPopBatch(ConsumerToken& /*unused*/, std::vector<T>& values, std::size_t max_count) {
+    // Avoid reallocations in the middle of the batch
+    values.reserve(values.size() + std::min<std::size_t>(max_count, size_));
+
+    std::size_t count = 0;
+    while (count < max_count) {
+        const auto node = std::unique_ptr<Node>{queue_.TryPopWeak()};
+        if (!node) break;
+        values.push_back(std::move(node->value));
+        ++count;
+    }
+    if (count == 0) return false;
+
+    size_ -= count;
+    remaining_capacity_.unlock_shared_count(count);
+    nonempty_event_.Reset();
+    return true;
+}
+
 template <typename T>
 void MpscQueue<T>::MarkConsumerIsDead() {
     consumer_is_created_and_dead_ = true;
@@ -3,9 +3,12 @@
 /// @file userver/concurrent/queue.hpp
 /// @brief @copybrief concurrent::GenericQueue
 
+#include <algorithm>
 #include <atomic>
+#include <iterator>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include <moodycamel/concurrentqueue.h>
 
@@ -289,6 +292,19 @@ private:
         return producer_side_.PushNoblock(token, std::move(value), value_size);
     }
 
+    template <typename Token>
+    [[nodiscard]] bool PushBatch(Token& token, std::vector<T>& values, engine::Deadline deadline) {
+        if (values.empty()) return !NoMoreConsumers();
+
+        std::size_t batch_size = 0;
+        for (const auto& value : values) {
+            const std::size_t value_size = QueuePolicy::GetElementSize(value);
+            UASSERT(value_size > 0);
+            batch_size += value_size;
+        }
+        return producer_side_.PushBatch(token, values, deadline, batch_size);
+    }
+
     template <typename Token>
     [[nodiscard]] bool Pop(Token& token, T& value, engine::Deadline deadline) {
         return consumer_side_.Pop(token, value, deadline);
@@ -299,6 +315,11 @@ private:
         return consumer_side_.PopNoblock(token, value);
     }
 
+    template <typename Token>
+    [[nodiscard]] bool PopBatch(Token& token, std::vector<T>& values, std::size_t max_count, engine::Deadline deadline) {
+        return consumer_side_.PopBatch(token, values, max_count, deadline);
+    }
+
     void PrepareProducer() {
         std::size_t old_producers_count{};
         utils::AtomicUpdate(producers_count_, [&](auto old_value) {
@@ -368,6 +389,27 @@ private:
         consumer_side_.OnElementPushed();
     }
 
+    template <typename Token>
+    void DoPushBatch(Token& token, std::vector<T>& values) {
+        const auto count = values.size();
+        const auto first = std::make_move_iterator(values.begin());
+
+        if constexpr (std::is_same_v<Token, moodycamel::ProducerToken>) {
+            static_assert(QueuePolicy::kIsMultipleProducer);
+            queue_.enqueue_bulk(token, first, count);
+        } else if constexpr (std::is_same_v<Token, MultiProducerToken>) {
+            static_assert(QueuePolicy::kIsMultipleProducer);
+            queue_.enqueue_bulk(first, count);
+        } else {
+            static_assert(std::is_same_v<Token, impl::NoToken>);
+            static_assert(!QueuePolicy::kIsMultipleProducer);
+            queue_.enqueue_bulk(single_producer_token_, first, count);
+        }
+
+        values.clear();
+        consumer_side_.OnElementsPushed(count);
+    }
+
     template <typename Token>
     [[nodiscard]] bool DoPop(Token& token, T& value) {
         bool success{};
@@ -392,6 +434,37 @@ private:
         return false;
     }
 
+    // Returns the number of the elements appended to `values`
+    template <typename Token>
+    [[nodiscard]] std::size_t DoPopBatch(Token& token, std::vector<T>& values, std::size_t max_count) {
+        const auto old_size = values.size();
+        // Avoid reallocations in the middle of the dequeue
+        values.reserve(old_size + std::min(max_count, consumer_side_.GetElementCount()));
+        const auto out = std::back_inserter(values);
+
+        std::size_t count{};
+        if constexpr (std::is_same_v<Token, moodycamel::ConsumerToken>) {
+            static_assert(QueuePolicy::kIsMultipleProducer);
+            count = queue_.try_dequeue_bulk(token, out, max_count);
+        } else if constexpr (std::is_same_v<Token, impl::MultiToken>) {
+            static_assert(QueuePolicy::kIsMultipleProducer);
+            count = queue_.try_dequeue_bulk(out, max_count);
+        } else {
+            static_assert(std::is_same_v<Token, impl::NoToken>);
+            static_assert(!QueuePolicy::kIsMultipleProducer);
+            count = queue_.try_dequeue_bulk_from_producer(single_producer_token_, out, max_count);
+        }
+
+        if (count != 0) {
+            std::size_t released_capacity = 0;
+            for (auto it = values.begin() + old_size; it != values.end(); ++it) {
+                released_capacity += QueuePolicy::GetElementSize(*it);
+            }
+            producer_side_.OnElementPopped(released_capacity);
+        }
+        return count;
+    }
+
     moodycamel::ConcurrentQueue<T> queue_{1};
     std::atomic<std::size_t> consumers_count_{0};
     std::atomic<std::size_t> producers_count_{0};
@@ -434,6 +507,19 @@ public:
         return !queue_.NoMoreConsumers() && DoPush(token, std::move(value), value_size);
     }
 
+    template <typename Token>
+    [[nodiscard]] bool PushBatch(Token& token, std::vector<T>& values, engine::Deadline deadline, std::size_t batch_size) {
+        bool failed = false;
+        const bool success = non_full_event_.WaitUntil(deadline, [&] {
+            if (queue_.NoMoreConsumers() || batch_size > total_capacity_.load()) {
+                failed = true;
+                return true;
+            }
+            return DoPushBatch(token, values, batch_size);
+        });
+        return success && !failed;
+    }
+
     void OnElementPopped(std::size_t released_capacity) {
         used_capacity_.fetch_sub(released_capacity);
         non_full_event_.Send();
@@ -464,6 +550,17 @@ private:
         return true;
     }
 
+    template <typename Token>
+    [[nodiscard]] bool DoPushBatch(Token& token, std::vector<T>& values, std::size_t batch_size) {
+        if (used_capacity_.load() + batch_size > total_capacity_.load()) {
+            return false;
+        }
+
+        used_capacity_.fetch_add(batch_size);
+        queue_.DoPushBatch(token, values);
+        return true;
+    }
+
     GenericQueue& queue_;
     engine::SingleConsumerEvent non_full_event_;
     std::atomic<std::size_t> used_capacity_;
@@ -489,6 +586,12 @@ public:
         return remaining_capacity_.try_lock_shared_count(value_size) && DoPush(token, std::move(value), value_size);
     }
 
+    template <typename Token>
+    [[nodiscard]] bool PushBatch(Token& token, std::vector<T>& values, engine::Deadline deadline, std::size_t batch_size) {
+        return remaining_capacity_.try_lock_shared_until_count(deadline, batch_size) &&
+               DoPushBatch(token, values, batch_size);
+    }
+
     void OnElementPopped(std::size_t value_size) { remaining_capacity_.unlock_shared_count(value_size); }
 
     void StopBlockingOnPush() { remaining_capacity_control_.SetCapacityOverride(0); }
@@ -513,6 +616,17 @@ private:
         return true;
     }
 
+    template <typename Token>
+    [[nodiscard]] bool DoPushBatch(Token& token, std::vector<T>& values, std::size_t batch_size) {
+        if (queue_.NoMoreConsumers()) {
+            remaining_capacity_.unlock_shared_count(batch_size);
+            return false;
+        }
+
+        queue_.DoPushBatch(token, values);
+        return true;
+    }
+
     GenericQueue& queue_;
     engine::CancellableSemaphore remaining_capacity_;
     concurrent::impl::SemaphoreCapacityControl remaining_capacity_control_;
@@ -538,6 +652,17 @@ public:
         return Push(token, std::move(value), engine::Deadline{}, value_size);
     }
 
+    template <typename Token>
+    [[nodiscard]] bool
+    PushBatch(Token& token, std::vector<T>& values, engine::Deadline /*deadline*/, std::size_t /*batch_size*/) {
+        if (queue_.NoMoreConsumers()) {
+            return false;
+        }
+
+        queue_.DoPushBatch(token, values);
+        return true;
+    }
+
     void OnElementPopped(std::size_t /*released_capacity*/) {}
 
     void StopBlockingOnPush() {}
@@ -588,11 +713,35 @@ public:
         return DoPop(token, value);
     }
 
+    template <typename Token>
+    [[nodiscard]] bool PopBatch(Token& token, std::vector<T>& values, std::size_t max_count, engine::Deadline deadline) {
+        bool no_more_producers = false;
+        const bool success = nonempty_event_.WaitUntil(deadline, [&] {
+            if (DoPopBatch(token, values, max_count)) {
+                return true;
+            }
+            if (queue_.NoMoreProducers()) {
+                // Same TOCTOU as in Pop
+                if (!DoPopBatch(token, values, max_count)) {
+                    no_more_producers = true;
+                }
+                return true;
+            }
+            return false;
+        });
+        return success && !no_more_producers;
+    }
+
     void OnElementPushed() {
         ++element_count_;
         nonempty_event_.Send();
     }
 
+    void OnElementsPushed(std::size_t count) {
+        element_count_ += count;
+        nonempty_event_.Send();
+    }
+
     void StopBlockingOnPop() { nonempty_event_.Send(); }
 
     void ResumeBlockingOnPop() {}
@@ -610,6 +759,16 @@ private:
         return false;
     }
 
+    template <typename Token>
+    [[nodiscard]] bool DoPopBatch(Token& token, std::vector<T>& values, std::size_t max_count) {
+        if (const auto count = queue_.DoPopBatch(token, values, max_count)) {
+            element_count_ -= count;
+            nonempty_event_.Reset();
+            return true;
+        }
+        return false;
+    }
+
     GenericQueue& queue_;
     engine::SingleConsumerEvent nonempty_event_;
     std::atomic<std::size_t> element_count_;
@@ -637,8 +796,23 @@ public:
         return element_count_.try_lock_shared() && DoPop(token, value);
     }
 
+    template <typename Token>
+    [[nodiscard]] bool PopBatch(Token& token, std::vector<T>& values, std::size_t max_count, engine::Deadline deadline) {
+        if (!element_count_.try_lock_shared_until(deadline)) return false;
+
+        // Take the rest of the batch only if it is already available
+        std::size_t locked_count = 1;
+        const auto extra_count = std::min(max_count - 1, GetElementCount());
+        if (extra_count != 0 && element_count_.try_lock_shared_count(extra_count)) {
+            locked_count += extra_count;
+        }
+        return DoPopBatch(token, values, locked_count);
+    }
+
     void OnElementPushed() { element_count_.unlock_shared(); }
 
+    void OnElementsPushed(std::size_t count) { element_count_.unlock_shared_count(count); }
+
     void StopBlockingOnPop() { element_count_control_.SetCapacityOverride(kUnbounded + kSemaphoreUnlockValue); }
 
     void ResumeBlockingOnPop() { element_count_control_.RemoveCapacityOverride(); }
@@ -669,6 +843,20 @@ private:
         }
     }
 
+    template <typename Token>
+    [[nodiscard]] bool DoPopBatch(Token& token, std::vector<T>& values, std::size_t locked_count) {
+        std::size_t popped_count = 0;
+        while (popped_count < locked_count) {
+            popped_count += queue_.DoPopBatch(token, values, locked_count - popped_count);
+            if (popped_count < locked_count && queue_.NoMoreProducers()) {
+                element_count_.unlock_shared_count(locked_count - popped_count);
+                break;
+            }
+            // See DoPop for the elements stolen by other consumers
+        }
+        return popped_count != 0;
+    }
+
     GenericQueue& queue_;
     engine::CancellableSemaphore element_count_;
     concurrent::impl::SemaphoreCapacityControl element_count_control_;
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <vector>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/task/current_task.hpp>
@@ -69,6 +71,22 @@ public:
         return queue_->PushNoblock(token_, std::move(value));
     }
 
+    /// Push all the elements into queue at once: the capacity for the whole
+    /// batch is acquired in one go and the consumer is woken up once. May wait
+    /// asynchronously if the queue is full. A batch that is bigger than the max
+    /// size of the queue is never pushed.
+    /// Leaves the `values` unmodified if the operation does not succeed,
+    /// clears them otherwise.
+    /// @returns whether push of the whole batch succeeded before the deadline
+    /// and before the task was canceled.
+    /// @note Only concurrent::GenericQueue and concurrent::MpscQueue support
+    /// batches.
+    [[nodiscard]] bool PushBatch(std::vector<ValueType>&& values, engine::Deadline deadline = {}) const {
+        UASSERT_MSG(queue_, "Trying to use a moved-from queue Producer");
+        UASSERT_MSG(engine::current_task::IsTaskProcessorThread(), "Use PushNoblock for non-coroutine producers");
+        return queue_->PushBatch(token_, values, deadline);
+    }
+
     void Reset() && noexcept {
         if (queue_) queue_->MarkProducerIsDead();
         queue_.reset();
@@ -138,6 +156,23 @@ public:
         return queue_->PopNoblock(token_, value);
     }
 
+    /// Pop up to `max_count` elements from queue and append them to `values`.
+    /// May wait asynchronously if the queue is empty, but the producer is
+    /// alive. Once there is something in the queue, takes whatever is
+    /// available up to `max_count` without waiting for more.
+    /// @returns whether something was popped before the deadline.
+    /// @note `false` can be returned before the deadline when the producer is no
+    /// longer alive.
+    /// @note Only concurrent::GenericQueue and concurrent::MpscQueue support
+    /// batches.
+    [[nodiscard]] bool PopBatch(std::vector<ValueType>& values, std::size_t max_count, engine::Deadline deadline = {})
+        const {
+        UASSERT_MSG(queue_, "Trying to use a moved-from queue Consumer");
+        UASSERT_MSG(engine::current_task::IsTaskProcessorThread(), "Use PopNoblock for non-coroutine consumers");
+        UASSERT(max_count > 0);
+        return queue_->PopBatch(token_, values, max_count, deadline);
+    }
+
     void Reset() && {
         if (queue_) queue_->MarkConsumerIsDead();
         queue_.reset();
@@ -0,0 +1,359 @@
+#pragma once
+
+/// @file userver/concurrent/ring_buffer_queue.hpp
+/// @brief @copybrief concurrent::RingBufferQueue
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+#include <userver/concurrent/impl/interference_shield.hpp>
+#include <userver/concurrent/queue_helpers.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/atomic.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent {
+
+/// @brief FIFO single consumer queue on top of a preallocated ring buffer.
+///
+/// @tparam T element type
+/// @tparam MultipleProducer whether concurrent producers are allowed
+///
+/// The capacity is fixed at creation, rounded up to a power of two, and
+/// nothing is allocated on push. Each slot carries a sequence number, so
+/// producers and the consumer only synchronize on the slots they touch. The
+/// producer and the consumer positions live in separate cache lines.
+/// Producers wait in Push while the queue is full, the consumer waits
+/// in Pop while it is empty.
+///
+/// On practice, use an alias:
+///
+/// * concurrent::SpscRingBufferQueue
+/// * concurrent::MpscRingBufferQueue
+///
+/// @see @ref concurrent_queues
+template <typename T, bool MultipleProducer>
+class RingBufferQueue final : public std::enable_shared_from_this<RingBufferQueue<T, MultipleProducer>> {
+    struct EmplaceEnabler final {
+        // Disable {}-initialization in Queue's constructor
+        explicit EmplaceEnabler() = default;
+    };
+
+    using ProducerToken = impl::NoToken;
+    using ConsumerToken = impl::NoToken;
+    using MultiProducerToken = impl::MultiToken;
+
+    friend class Producer<RingBufferQueue, ProducerToken, EmplaceEnabler>;
+    friend class Producer<RingBufferQueue, MultiProducerToken, EmplaceEnabler>;
+    friend class Consumer<RingBufferQueue, ConsumerToken, EmplaceEnabler>;
+
+public:
+    using ValueType = T;
+
+    using Producer = concurrent::Producer<RingBufferQueue, ProducerToken, EmplaceEnabler>;
+    using Consumer = concurrent::Consumer<RingBufferQueue, ConsumerToken, EmplaceEnabler>;
+    using MultiProducer = concurrent::Producer<RingBufferQueue, MultiProducerToken, EmplaceEnabler>;
+
+    static constexpr std::size_t kDefaultCapacity = 1024;
+    static constexpr std::size_t kMaxCapacity = std::size_t{1} << (std::numeric_limits<std::size_t>::digits - 2);
+
+    /// @cond
+    // For internal use only
+    explicit RingBufferQueue(std::size_t capacity, EmplaceEnabler /*unused*/)
+        : capacity_(RoundUpCapacity(capacity)),
+          mask_(capacity_ - 1),
+          queue_(new Cell[capacity_]),
+          soft_max_size_(std::min(capacity, capacity_)) {
+        for (std::size_t i = 0; i < capacity_; ++i) queue_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    ~RingBufferQueue() {
+        UASSERT(consumers_count_ == kCreatedAndDead || !consumers_count_);
+        UASSERT(producers_count_ == kCreatedAndDead || !producers_count_);
+
+        // Clear remaining items in queue
+        T value;
+        while (DoPop(value)) {
+        }
+    }
+
+    RingBufferQueue(RingBufferQueue&&) = delete;
+    RingBufferQueue(const RingBufferQueue&) = delete;
+    RingBufferQueue& operator=(RingBufferQueue&&) = delete;
+    RingBufferQueue& operator=(const RingBufferQueue&) = delete;
+    /// @endcond
+
+    /// Create a new queue that holds up to `capacity` elements, the storage
+    /// for `capacity` rounded up to a power of two elements is allocated
+    /// right away
+    static std::shared_ptr<RingBufferQueue> Create(std::size_t capacity = kDefaultCapacity) {
+        return std::make_shared<RingBufferQueue>(capacity, EmplaceEnabler{});
+    }
+
+    /// Get a `Producer` which makes it possible to push items into the queue.
+    /// The resulting `Producer` is not thread-safe. For a single producer
+    /// queue, the next `Producer` may only be obtained after the previous one
+    /// is destroyed.
+    ///
+    /// @note `Producer` may outlive the queue and the consumer.
+    Producer GetProducer() {
+        PrepareProducer();
+        return Producer(this->shared_from_this(), EmplaceEnabler{});
+    }
+
+    /// Get a `MultiProducer` which makes it possible to push items into the
+    /// queue from multiple coroutines/threads simultaneously.
+    ///
+    /// @note `MultiProducer` may outlive the queue and the consumer.
+    MultiProducer GetMultiProducer() {
+        static_assert(MultipleProducer, "Trying to obtain MultiProducer for a single-producer queue");
+        PrepareProducer();
+        return MultiProducer(this->shared_from_this(), EmplaceEnabler{});
+    }
+
+    /// Get a `Consumer` which makes it possible to read items from the queue.
+    /// There may only be one `Consumer` at a time.
+    ///
+    /// @note `Consumer` may outlive the queue and producers.
+    Consumer GetConsumer() {
+        PrepareConsumer();
+        return Consumer(this->shared_from_this(), EmplaceEnabler{});
+    }
+
+    /// @brief Sets the limit on the queue size, pushes over this limit will
+    /// block. The limit can't exceed GetCapacity().
+    /// @note This is a soft limit and may be slightly overrun by concurrent
+    /// producers, but never over GetCapacity().
+    void SetSoftMaxSize(std::size_t max_size) {
+        const auto new_max_size = std::min(max_size, capacity_);
+        const auto old_max_size = soft_max_size_.exchange(new_max_size);
+        if (new_max_size > old_max_size) non_full_event_.Send();
+    }
+
+    /// @brief Gets the limit on the queue size
+    std::size_t GetSoftMaxSize() const noexcept { return soft_max_size_.load(); }
+
+    /// @brief Gets the size of the ring buffer
+    std::size_t GetCapacity() const noexcept { return capacity_; }
+
+    /// @brief Gets the approximate size of queue
+    std::size_t GetSizeApproximate() const noexcept {
+        const auto head = head_->load(std::memory_order_acquire);
+        const auto tail = tail_->load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    /// @cond
+    bool NoMoreConsumers() const { return consumers_count_ == kCreatedAndDead; }
+
+    bool NoMoreProducers() const { return producers_count_ == kCreatedAndDead; }
+    /// @endcond
+
+private:
+    struct Cell final {
+        std::atomic<std::size_t> sequence{0};
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    static std::size_t RoundUpCapacity(std::size_t capacity) {
+        UINVARIANT(capacity <= kMaxCapacity, "Too big capacity for concurrent::RingBufferQueue");
+        std::size_t result = 1;
+        while (result < capacity) result <<= 1;
+        return result;
+    }
+
+    static T& GetValue(Cell& cell) noexcept { return *std::launder(reinterpret_cast<T*>(&cell.storage)); }
+
+    template <typename Token>
+    [[nodiscard]] bool Push(Token& /*token*/, T&& value, engine::Deadline deadline) {
+        if (NoMoreConsumers()) return false;
+        if (DoPush(value)) return true;
+
+        if constexpr (MultipleProducer) {
+            // engine::SingleConsumerEvent allows a single waiter, so the
+            // producers of a full queue wait one by one
+            if (!waiting_producer_mutex_.try_lock_until(deadline)) return false;
+            const std::unique_lock lock(waiting_producer_mutex_, std::adopt_lock);
+            return WaitAndPush(value, deadline);
+        } else {
+            return WaitAndPush(value, deadline);
+        }
+    }
+
+    template <typename Token>
+    [[nodiscard]] bool PushNoblock(Token& /*token*/, T&& value) {
+        return !NoMoreConsumers() && DoPush(value);
+    }
+
+    template <typename Token>
+    [[nodiscard]] bool Pop(Token& /*token*/, T& value, engine::Deadline deadline) {
+        bool no_more_producers = false;
+        const bool success = nonempty_event_.WaitUntil(deadline, [&] {
+            if (DoPop(value)) {
+                return true;
+            }
+            if (NoMoreProducers()) {
+                // Producer might have pushed something in queue between DoPop
+                // and NoMoreProducers check. Check twice to avoid TOCTOU.
+                if (!DoPop(value)) {
+                    no_more_producers = true;
+                }
+                return true;
+            }
+            return false;
+        });
+        return success && !no_more_producers;
+    }
+
+    template <typename Token>
+    [[nodiscard]] bool PopNoblock(Token& /*token*/, T& value) {
+        return DoPop(value);
+    }
+
+    [[nodiscard]] bool WaitAndPush(T& value, engine::Deadline deadline) {
+        bool no_more_consumers = false;
+        const bool success = non_full_event_.WaitUntil(deadline, [&] {
+            if (NoMoreConsumers()) {
+                no_more_consumers = true;
+                return true;
+            }
+            return DoPush(value);
+        });
+        return success && !no_more_consumers;
+    }
+
+    // Leaves the `value` unmodified on failure
+    [[nodiscard]] bool DoPush(T& value) {
+        const auto max_size = soft_max_size_.load(std::memory_order_relaxed);
+        auto pos = tail_->load(std::memory_order_relaxed);
+
+        while (true) {
+            const auto head = head_->load(std::memory_order_acquire);
+            if (pos >= head && pos - head >= max_size) return false;
+
+            auto& cell = queue_[pos & mask_];
+            const auto sequence = cell.sequence.load(std::memory_order_acquire);
+            if (sequence != pos) {
+                // The slot is either not freed by the consumer yet, or is taken
+                // by a concurrent producer
+                if (sequence < pos) return false;
+                UASSERT(MultipleProducer);
+                pos = tail_->load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if constexpr (MultipleProducer) {
+                if (!tail_->compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) continue;
+            } else {
+                tail_->store(pos + 1, std::memory_order_relaxed);
+            }
+
+            ::new (&cell.storage) T(std::move(value));
+            cell.sequence.store(pos + 1, std::memory_order_release);
+            nonempty_event_.Send();
+            return true;
+        }
+    }
+
+    [[nodiscard]] bool DoPop(T& value) {
+        const auto pos = head_->load(std::memory_order_relaxed);
+        auto& cell = queue_[pos & mask_];
+        if (cell.sequence.load(std::memory_order_acquire) != pos + 1) return false;
+
+        auto& stored = GetValue(cell);
+        value = std::move(stored);
+        stored.~T();
+
+        cell.sequence.store(pos + capacity_, std::memory_order_release);
+        head_->store(pos + 1, std::memory_order_release);
+        nonempty_event_.Reset();
+        non_full_event_.Send();
+        return true;
+    }
+
+    void PrepareProducer() {
+        utils::AtomicUpdate(producers_count_, [](auto old_value) {
+            UINVARIANT(MultipleProducer || old_value != 1, "Incorrect usage of queue producers");
+            return old_value == kCreatedAndDead ? 1 : old_value + 1;
+        });
+    }
+
+    void PrepareConsumer() {
+        utils::AtomicUpdate(consumers_count_, [](auto old_value) {
+            UINVARIANT(old_value != 1, "Incorrect usage of queue consumers");
+            return old_value == kCreatedAndDead ? 1 : old_value + 1;
+        });
+    }
+
+    void MarkConsumerIsDead() {
+        const auto new_consumers_count = utils::AtomicUpdate(consumers_count_, [](auto old_value) {
+            return old_value == 1 ? kCreatedAndDead : old_value - 1;
+        });
+        if (new_consumers_count == kCreatedAndDead) {
+            non_full_event_.Send();
+        }
+    }
+
+    void MarkProducerIsDead() {
+        const auto new_producers_count = utils::AtomicUpdate(producers_count_, [](auto old_value) {
+            return old_value == 1 ? kCreatedAndDead : old_value - 1;
+        });
+        if (new_producers_count == kCreatedAndDead) {
+            nonempty_event_.Send();
+        }
+    }
+
+    static constexpr std::size_t kCreatedAndDead = std::numeric_limits<std::size_t>::max();
+
+    const std::size_t capacity_;
+    const std::size_t mask_;
+    // Named `queue_` for the tokens of concurrent::Producer and
+    // concurrent::Consumer
+    const std::unique_ptr<Cell[]> queue_;
+
+    // Written by the consumer
+    impl::InterferenceShield<std::atomic<std::size_t>> head_{0};
+    // Written by the producers
+    impl::InterferenceShield<std::atomic<std::size_t>> tail_{0};
+
+    std::atomic<std::size_t> soft_max_size_;
+    std::atomic<std::size_t> consumers_count_{0};
+    std::atomic<std::size_t> producers_count_{0};
+
+    engine::SingleConsumerEvent nonempty_event_;
+    engine::SingleConsumerEvent non_full_event_;
+    engine::Mutex waiting_producer_mutex_;
+};
+
+/// @ingroup userver_concurrency
+///
+/// @brief Single producer single consumer FIFO queue with a fixed capacity
+/// and no allocations on push.
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename T>
+using SpscRingBufferQueue = RingBufferQueue<T, false>;
+
+/// @ingroup userver_concurrency
+///
+/// @brief Multiple producers single consumer FIFO queue with a fixed capacity
+/// and no allocations on push.
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename T>
+using MpscRingBufferQueue = RingBufferQueue<T, true>;
+
+}  // namespace concurrent
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+
+#include <userver/congestion_control/controllers/gradient_config.hpp>
+#include <userver/congestion_control/controllers/v2.hpp>
+#include <userver/congestion_control/limiter.hpp>
+#include <userver/utils/sliding_interval.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+/// @brief Gradient based in-flight requests limiter.
+///
+/// Compares the current latency with the minimal latency of the recent epochs:
+/// while the latency is within `rtt_tolerance` of the minimal one, the limit
+/// grows by a square root of itself if it is actually used; above the
+/// tolerance the limit shrinks proportionally to the latency growth, but
+/// at most by half per epoch. The changes are smoothed exponentially.
+///
+/// The limit is applied only after it goes below `max_limit`, starting from
+/// the current number of requests in flight.
+class GradientController final : public Controller {
+public:
+    using StaticConfig = GradientConfig;
+
+    GradientController(
+        const std::string& name,
+        v2::Sensor& sensor,
+        Limiter& limiter,
+        Stats& stats,
+        const StaticConfig& config
+    );
+
+    Limit Update(const Sensor::Data& current) override;
+
+private:
+    Limit MakeLimit(const Sensor::Data& current) const;
+
+    const StaticConfig config_;
+    utils::SlidingInterval<std::int64_t> rtt_;
+    std::size_t epochs_passed_{0};
+    // not applied while it is not less than config_.max_limit
+    double limit_;
+};
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
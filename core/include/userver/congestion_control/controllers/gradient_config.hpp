@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+/// @brief Static config of congestion_control::v2::GradientController
+struct GradientConfig {
+    bool fake_mode{false};
+    bool enabled{true};
+
+    std::size_t min_limit{10};
+
+    /// The limit is not applied while it is not less than max_limit
+    std::size_t max_limit{1000};
+
+    /// Latency up to min_rtt * rtt_tolerance is considered normal
+    double rtt_tolerance{2.0};
+
+    /// Weight of the new limit in the exponential smoothing, (0, 1]
+    double smoothing{0.2};
+
+    /// Epochs with fewer requests are not used to adjust the limit
+    std::size_t min_requests{10};
+};
+
+GradientConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<GradientConfig>);
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,87 @@
+#pragma once
+
+/// @file userver/dist_lock/dist_lock_batcher.hpp
+/// @brief @copybrief dist_lock::DistLockBatcher
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/dist_lock/dist_lock_strategy.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dist_lock {
+
+namespace impl {
+class BatchCoalescer;
+}  // namespace impl
+
+/// @ingroup userver_base_classes userver_concurrency
+///
+/// @brief Interface for distributed lock storages that acquire many locks in
+/// one round-trip
+class DistLockBatchStrategyBase {
+public:
+    struct AcquireRequest {
+        std::string lock_name;
+        std::string locker_id;
+        std::chrono::milliseconds lock_ttl;
+    };
+
+    struct AcquireResult {
+        /// false if the lock is held by another locker
+        bool acquired{false};
+        std::optional<FencingToken> fencing_token;
+    };
+
+    virtual ~DistLockBatchStrategyBase() = default;
+
+    /// Acquires or prolongs the locks, the lock names in a batch are unique.
+    ///
+    /// @returns a result for each request in the same order
+    /// @throws anything when the whole batch fails, the locks are not released
+    virtual std::vector<AcquireResult> AcquireBatch(const std::vector<AcquireRequest>& requests) = 0;
+
+    /// Releases the lock.
+    /// @note Exceptions are ignored.
+    virtual void Release(const std::string& lock_name, const std::string& locker_id) = 0;
+};
+
+/// @ingroup userver_concurrency
+///
+/// @brief Coalesces the acquisitions and prolongations of many distributed
+/// locks into batches of DistLockBatchStrategyBase::AcquireBatch.
+///
+/// Each lock gets its own strategy from MakeStrategy() to be used with
+/// dist_lock::DistLockedWorker or dist_lock::DistLockedTask as usual. The first
+/// acquisition attempt waits for `batch_delay` for the attempts of other locks
+/// and sends them all in one request. The lockers with the same settings
+/// prolong their locks in step, so a process holding hundreds of locks makes
+/// about one request per `prolong_interval`.
+///
+/// The batcher also remembers the leases it has granted: an attempt to acquire
+/// a lock leased to another locker of the same batcher fails without a request.
+///
+/// @note The attempts of a batch fail together if the task that sends the
+/// batch is cancelled, the failed lockers retry after `acquire_interval`.
+class DistLockBatcher final {
+public:
+    DistLockBatcher(std::shared_ptr<DistLockBatchStrategyBase> strategy, std::chrono::milliseconds batch_delay);
+    ~DistLockBatcher();
+
+    DistLockBatcher(const DistLockBatcher&) = delete;
+    DistLockBatcher& operator=(const DistLockBatcher&) = delete;
+
+    /// @returns a strategy of the lock `lock_name`, may outlive the batcher
+    std::shared_ptr<DistLockStrategyBase> MakeStrategy(std::string lock_name);
+
+private:
+    std::shared_ptr<impl::BatchCoalescer> coalescer_;
+};
+
+}  // namespace dist_lock
+
+USERVER_NAMESPACE_END
@@ -4,7 +4,9 @@
 /// @brief @copybrief dist_lock::DistLockStrategyBase
 
 #include <chrono>
+#include <cstdint>
 #include <exception>
+#include <optional>
 #include <string>
 
 USERVER_NAMESPACE_BEGIN
@@ -14,6 +16,11 @@ namespace dist_lock {
 /// Indicates that lock cannot be acquired because it's busy.
 class LockIsAcquiredByAnotherHostException : public std::exception {};
 
+/// Number that grows with each new owner of a lock. Storages guarded by the
+/// lock may reject the writes with a token older than the last seen one, which
+/// protects them from a worker that has lost the lock but has not noticed it.
+using FencingToken = std::int64_t;
+
 /// @ingroup userver_base_classes userver_concurrency
 ///
 /// @brief Interface for distributed lock strategies
@@ -34,6 +41,16 @@ public:
     /// cleanup, Release won't be invoked.
     virtual void Acquire(std::chrono::milliseconds lock_ttl, const std::string& locker_id) = 0;
 
+    /// Acquires the distributed lock and returns its fencing token, if the
+    /// strategy supports them. Same exceptions as in Acquire().
+    ///
+    /// The default implementation calls Acquire() and returns no token.
+    virtual std::optional<FencingToken>
+    AcquireWithFencingToken(std::chrono::milliseconds lock_ttl, const std::string& locker_id) {
+        Acquire(lock_ttl, locker_id);
+        return std::nullopt;
+    }
+
     /// Releases the lock.
     ///
     /// @param locker_id Globally unique ID of the locking entity, must be the
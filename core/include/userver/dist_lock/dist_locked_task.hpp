@@ -95,6 +95,11 @@ public:
     /// may be less than the real duration.
     std::optional<std::chrono::steady_clock::duration> GetLockedDuration() const;
 
+    /// Returns the fencing token of the held lock, if the lock is held and the
+    /// strategy supports fencing tokens.
+    /// @see dist_lock::FencingToken
+    std::optional<FencingToken> GetFencingToken() const noexcept;
+
     void Get() noexcept(false);
 
 private:
@@ -80,6 +80,11 @@ public:
     /// @returns is current worker owns the lock
     bool OwnsLock() const noexcept;
 
+    /// @returns the fencing token of the held lock, if the lock is held and
+    /// the strategy supports fencing tokens
+    /// @see dist_lock::FencingToken
+    std::optional<FencingToken> GetFencingToken() const noexcept;
+
     /// Returns for how long the lock is held (if held at all). Returned value
     /// may be less than the real duration.
     std::optional<std::chrono::steady_clock::duration> GetLockedDuration() const;
@@ -42,6 +42,10 @@ struct Config final {
     std::optional<std::chrono::milliseconds> max_dump_age;
     bool max_dump_age_set;
     bool dump_is_encrypted;
+    bool dump_is_mmapped;
+    bool dump_is_compressed;
+    int compression_level;
+    std::optional<std::string> compression_dictionary_path;
 
     bool static_dumps_enabled;
     std::chrono::milliseconds static_min_dump_interval;
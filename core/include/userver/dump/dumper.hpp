@@ -171,7 +171,7 @@ private:
     Dumper(const Config& initial_config, const components::ComponentContext& context, DumpableEntity& dumpable);
 
     class Impl;
-    utils::FastPimpl<Impl, 1088, 16> impl_;
+    utils::FastPimpl<Impl, 1152, 16> impl_;
 };
 
 }  // namespace dump
@@ -0,0 +1,136 @@
+#pragma once
+
+/// @file userver/dump/flat_array.hpp
+/// @brief @copybrief dump::FlatArray
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <userver/dump/operations.hpp>
+#include <userver/dump/operations_mmap.hpp>
+#include <userver/dump/unsafe.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// @brief Immutable array of trivially copyable elements that can be served
+/// directly from a memory-mapped dump file
+///
+/// The elements are dumped as raw bytes. When read by dump::MmapReader
+/// (see `dump.mmap` static option), the array points into the mapping and
+/// keeps it alive, so loading the dump costs no copying or deserialization.
+/// Other readers get an owning copy of the elements.
+///
+/// The raw bytes layout depends on the platform, so `format-version` of
+/// the dump should be bumped whenever `T` changes.
+template <typename T>
+class FlatArray final {
+    static_assert(std::is_trivially_copyable_v<T>, "FlatArray elements are stored as raw bytes");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using const_iterator = const T*;
+    using iterator = const_iterator;
+
+    FlatArray() = default;
+
+    explicit FlatArray(const std::vector<T>& values) : FlatArray(values.data(), values.size()) {}
+
+    /// Makes an owning copy of `size` elements starting at `data`
+    FlatArray(const T* data, std::size_t size) {
+        if (size == 0) return;
+        auto storage = std::make_shared<std::vector<T>>(data, data + size);
+        data_ = storage->data();
+        size_ = size;
+        owner_ = std::move(storage);
+    }
+
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    const T* data() const noexcept { return data_; }
+
+    const T& operator[](size_type index) const {
+        UASSERT(index < size_);
+        return data_[index];
+    }
+
+    const_iterator begin() const noexcept { return data_; }
+    const_iterator end() const noexcept { return data_ + size_; }
+
+    /// Returns whether the elements point into a memory-mapped dump file
+    bool IsMapped() const noexcept { return is_mapped_; }
+
+private:
+    template <typename U>
+    friend FlatArray<U> Read(Reader& reader, To<FlatArray<U>>);
+
+    std::shared_ptr<const void> owner_;
+    const T* data_{nullptr};
+    size_type size_{0};
+    bool is_mapped_{false};
+};
+
+/// @brief dump::FlatArray serialization
+///
+/// Writes the size, then padding that aligns the elements in the file if
+/// the writer is dump::MmapWriter, then the raw bytes of the elements.
+template <typename T>
+void Write(Writer& writer, const FlatArray<T>& array) {
+    writer.Write(array.size());
+
+    char padding = 0;
+    if (const auto* mmap_writer = dynamic_cast<const MmapWriter*>(&writer)) {
+        const auto data_position = mmap_writer->GetPosition() + 1;
+        padding = static_cast<char>((alignof(T) - data_position % alignof(T)) % alignof(T));
+    }
+    WriteStringViewUnsafe(writer, std::string_view{&padding, 1});
+    WriteStringViewUnsafe(writer, std::string(static_cast<std::size_t>(padding), '\0'));
+
+    WriteStringViewUnsafe(
+        writer, std::string_view{reinterpret_cast<const char*>(array.data()), array.size() * sizeof(T)}
+    );
+}
+
+/// @brief dump::FlatArray deserialization
+template <typename T>
+FlatArray<T> Read(Reader& reader, To<FlatArray<T>>) {
+    const auto size = reader.Read<std::size_t>();
+    if (size > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+        throw Error("FlatArray size in the dump is too large");
+    }
+
+    const auto padding = static_cast<unsigned char>(ReadStringViewUnsafe(reader, 1)[0]);
+    ReadStringViewUnsafe(reader, padding);
+    const auto bytes = ReadStringViewUnsafe(reader, size * sizeof(T));
+    if (size == 0) return {};
+
+    FlatArray<T> result;
+    result.size_ = size;
+
+    const auto* mmap_reader = dynamic_cast<const MmapReader*>(&reader);
+    if (mmap_reader && reinterpret_cast<std::uintptr_t>(bytes.data()) % alignof(T) == 0) {
+        result.owner_ = mmap_reader->GetMappedFile();
+        result.data_ = reinterpret_cast<const T*>(bytes.data());
+        result.is_mapped_ = true;
+    } else {
+        auto storage = std::make_shared<std::vector<T>>(size);
+        std::memcpy(storage->data(), bytes.data(), bytes.size());
+        result.data_ = storage->data();
+        result.owner_ = std::move(storage);
+    }
+    return result;
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
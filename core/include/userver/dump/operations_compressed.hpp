@@ -0,0 +1,86 @@
+#pragma once
+
+/// @file userver/dump/operations_compressed.hpp
+/// @brief Dump Reader and Writer that compress the data with zstd
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <userver/compression/zstd.hpp>
+#include <userver/dump/factory.hpp>
+#include <userver/dump/operations.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+struct CompressionSettings final {
+    int level{compression::zstd::kDefaultCompressionLevel};
+
+    /// A dictionary trained by `zstd --train` on sample dumps, if any.
+    /// The same dictionary is required to read the dump.
+    std::string dictionary;
+};
+
+/// Compresses the data into a single zstd frame and passes it to another
+/// `Writer`, e.g. dump::FileWriter or dump::EncryptedWriter
+class CompressedWriter final : public Writer {
+public:
+    /// @throws `Error` on invalid settings
+    CompressedWriter(std::unique_ptr<Writer> base, const CompressionSettings& settings);
+
+    void Finish() override;
+
+    /// Returns the number of bytes written before the compression
+    std::size_t GetUncompressedSize() const noexcept { return uncompressed_size_; }
+
+private:
+    void WriteRaw(std::string_view data) override;
+
+    void Flush();
+
+    std::unique_ptr<Writer> base_;
+    compression::zstd::StreamCompressor compressor_;
+    std::string buffer_;
+    std::size_t uncompressed_size_{0};
+};
+
+/// Decompresses the data written by dump::CompressedWriter
+class CompressedReader final : public Reader {
+public:
+    /// @throws `Error` on invalid settings
+    CompressedReader(std::unique_ptr<Reader> base, const CompressionSettings& settings);
+
+    void Finish() override;
+
+private:
+    std::string_view ReadRaw(std::size_t max_size) override;
+
+    void BackUp(std::size_t size) override;
+
+    std::unique_ptr<Reader> base_;
+    compression::zstd::StreamDecompressor decompressor_;
+    std::string buffer_;
+    std::size_t pos_{0};
+    bool frame_ended_{false};
+};
+
+/// Wraps the Readers and Writers of another factory into the compressing
+/// ones
+class CompressedOperationsFactory final : public OperationsFactory {
+public:
+    CompressedOperationsFactory(std::unique_ptr<OperationsFactory> base, CompressionSettings settings);
+
+    std::unique_ptr<Reader> CreateReader(std::string full_path) override;
+
+    std::unique_ptr<Writer> CreateWriter(std::string full_path, tracing::ScopeTime& scope) override;
+
+private:
+    const std::unique_ptr<OperationsFactory> base_;
+    const CompressionSettings settings_;
+};
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
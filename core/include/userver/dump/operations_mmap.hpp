@@ -0,0 +1,105 @@
+#pragma once
+
+/// @file userver/dump/operations_mmap.hpp
+/// @brief Dump Reader and Writer that serve the dump from a memory-mapped file
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/dump/factory.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/dump/operations_file.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// @brief A read-only memory mapping of a whole dump file
+///
+/// Stays valid as long as someone holds a pointer to it, even after the
+/// dump::MmapReader is destroyed.
+class MappedFile final {
+public:
+    /// @throws `Error` on a filesystem error
+    explicit MappedFile(const std::string& path);
+
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+    ~MappedFile();
+
+    std::string_view GetContents() const noexcept { return {data_, size_}; }
+
+private:
+    const char* data_{nullptr};
+    std::size_t size_{0};
+};
+
+/// @brief A handle to a dump file that is going to be read by dump::MmapReader
+///
+/// Writes the same format as dump::FileWriter, but additionally tracks
+/// the position in the file, which allows types like dump::FlatArray to align
+/// their data for zero-copy reading.
+class MmapWriter final : public Writer {
+public:
+    /// @brief Creates a new dump file and opens it
+    /// @throws `Error` on a filesystem error
+    explicit MmapWriter(std::string path, boost::filesystem::perms perms, tracing::ScopeTime& scope);
+
+    void Finish() override;
+
+    /// Returns the number of bytes written so far
+    std::size_t GetPosition() const noexcept { return position_; }
+
+private:
+    void WriteRaw(std::string_view data) override;
+
+    FileWriter file_writer_;
+    std::size_t position_{0};
+};
+
+/// @brief A dump file reader that maps the file into memory
+///
+/// `ReadRaw` returns views into the mapping without copying, and the views
+/// are not invalidated by the subsequent reads. Types like dump::FlatArray
+/// use @ref GetMappedFile to keep referring to the mapped data after
+/// the dump is loaded.
+class MmapReader final : public Reader {
+public:
+    /// @brief Opens an existing dump file and maps it into memory
+    /// @throws `Error` on a filesystem error
+    explicit MmapReader(std::string path);
+
+    void Finish() override;
+
+    /// Returns the mapping of the whole dump file
+    const std::shared_ptr<const MappedFile>& GetMappedFile() const noexcept { return file_; }
+
+private:
+    std::string_view ReadRaw(std::size_t max_size) override;
+
+    void BackUp(std::size_t size) override;
+
+    std::string path_;
+    std::shared_ptr<const MappedFile> file_;
+    std::string_view contents_;
+    std::size_t position_{0};
+};
+
+class MmapOperationsFactory final : public OperationsFactory {
+public:
+    explicit MmapOperationsFactory(boost::filesystem::perms perms);
+
+    std::unique_ptr<Reader> CreateReader(std::string full_path) override;
+
+    std::unique_ptr<Writer> CreateWriter(std::string full_path, tracing::ScopeTime& scope) override;
+
+private:
+    const boost::filesystem::perms perms_;
+};
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,175 @@
+#pragma once
+
+/// @file userver/dump/sharded.hpp
+/// @brief Parallel serialization of large containers in cache dumps
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <userver/dump/common_containers.hpp>
+#include <userver/dump/meta_containers.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+namespace impl {
+
+/// A `Writer` that appends to a string buffer
+class StringWriter final : public Writer {
+public:
+    void Finish() override {}
+
+    std::string Extract() && { return std::move(data_); }
+
+private:
+    void WriteRaw(std::string_view data) override;
+
+    std::string data_;
+};
+
+/// A `Reader` that reads from a string buffer
+class StringReader final : public Reader {
+public:
+    explicit StringReader(std::string_view data) noexcept : data_(data) {}
+
+    void Finish() override;
+
+private:
+    std::string_view ReadRaw(std::size_t max_size) override;
+
+    void BackUp(std::size_t size) override;
+
+    std::string_view data_;
+    std::size_t pos_{0};
+};
+
+/// A compressed and checksummed shard as stored in the dump
+struct PackedShard final {
+    std::size_t size{0};
+    std::uint64_t checksum{0};
+    std::string compressed;
+};
+
+PackedShard PackShard(std::string_view data);
+
+/// @throws `Error` if the shard is corrupted
+std::string UnpackShard(const PackedShard& shard);
+
+void WriteShard(Writer& writer, const PackedShard& shard);
+
+PackedShard ReadShard(Reader& reader);
+
+// Map elements are read with a non-const key to be moved into the container
+template <typename T>
+struct MutableValue {
+    using type = T;
+};
+
+template <typename K, typename V>
+struct MutableValue<std::pair<const K, V>> {
+    using type = std::pair<K, V>;
+};
+
+}  // namespace impl
+
+/// @brief Writes a container split into `shards_count` shards
+///
+/// The shards are serialized, compressed with zstd and checksummed in
+/// parallel on the current task processor, which is the `fs-task-processor`
+/// of the dumper. Must be paired with dump::ReadSharded. The order of elements
+/// is preserved.
+///
+/// Use it in `WriteContents` of the large components::CachingComponentBase
+/// caches, where serializing the data on a single thread takes too long.
+template <typename T>
+void WriteSharded(Writer& writer, const T& contents, std::size_t shards_count) {
+    static_assert(kIsContainer<T>, "WriteSharded supports only containers");
+    UINVARIANT(shards_count > 0, "WriteSharded requires at least one shard");
+    using Value = meta::RangeValueType<T>;
+
+    // Contiguous ranges, so that the order is preserved after reading
+    const auto size = std::size(contents);
+    std::vector<engine::TaskWithResult<impl::PackedShard>> tasks;
+    tasks.reserve(shards_count);
+
+    auto shard_begin = std::begin(contents);
+    for (std::size_t i = 0; i < shards_count; ++i) {
+        const auto shard_size = size / shards_count + (i < size % shards_count ? 1 : 0);
+        auto shard_end = std::next(shard_begin, shard_size);
+
+        tasks.push_back(utils::Async("dump-write-shard", [shard_begin, shard_end, shard_size] {
+            impl::StringWriter shard_writer;
+            shard_writer.Write(shard_size);
+            for (auto it = shard_begin; it != shard_end; ++it) {
+                shard_writer.Write(static_cast<const Value&>(*it));
+            }
+            return impl::PackShard(std::move(shard_writer).Extract());
+        }));
+        shard_begin = shard_end;
+    }
+
+    writer.Write(shards_count);
+    for (auto& task : tasks) impl::WriteShard(writer, task.Get());
+}
+
+/// @brief Reads a container written by dump::WriteSharded
+///
+/// The shards are decompressed, verified and deserialized in parallel on
+/// the current task processor, while the following shards are being read.
+/// @throws `Error` if some shard is corrupted
+template <typename T>
+T ReadSharded(Reader& reader) {
+    static_assert(kIsContainer<T>, "ReadSharded supports only containers");
+    using Value = meta::RangeValueType<T>;
+    using ShardValue = typename impl::MutableValue<Value>::type;
+
+    const auto shards_count = reader.Read<std::size_t>();
+    std::vector<engine::TaskWithResult<std::vector<ShardValue>>> tasks;
+    tasks.reserve(shards_count);
+
+    for (std::size_t i = 0; i < shards_count; ++i) {
+        tasks.push_back(utils::Async("dump-read-shard", [shard = impl::ReadShard(reader)] {
+            const auto data = impl::UnpackShard(shard);
+            impl::StringReader shard_reader{data};
+
+            const auto shard_size = shard_reader.Read<std::size_t>();
+            std::vector<ShardValue> values;
+            values.reserve(shard_size);
+            for (std::size_t j = 0; j < shard_size; ++j) values.push_back(shard_reader.Read<ShardValue>());
+            shard_reader.Finish();
+            return values;
+        }));
+    }
+
+    std::vector<std::vector<ShardValue>> shards;
+    shards.reserve(shards_count);
+    std::size_t size = 0;
+    for (auto& task : tasks) {
+        shards.push_back(task.Get());
+        size += shards.back().size();
+    }
+
+    T result{};
+    if constexpr (meta::kIsReservable<T>) {
+        result.reserve(size);
+    }
+    for (auto& shard : shards) {
+        for (auto& value : shard) dump::Insert(result, Value(std::move(value)));
+        // Releasing the memory early
+        std::vector<ShardValue>{}.swap(shard);
+    }
+    return result;
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -61,13 +61,30 @@ public:
 
     Reply FetchDocsMap(const std::optional<Timestamp>& last_update, const std::vector<std::string>& fields_to_load);
 
+    /// @brief Long polling version of FetchDocsMap(): asks the config service
+    /// to hold the request for up to `wait_timeout` until some of the configs
+    /// are updated after `last_update`.
+    ///
+    /// The service replies earlier if it does not support long polling, the
+    /// HTTP timeout of the request is `wait_timeout` plus ClientConfig::timeout.
+    Reply WaitForDocsMapUpdate(
+        const Timestamp& last_update,
+        const std::vector<std::string>& fields_to_load,
+        std::chrono::milliseconds wait_timeout
+    );
+
     JsonReply FetchJson(const std::optional<Timestamp>& last_update, const std::vector<std::string>& fields_to_load);
 
 private:
-    formats::json::Value
-    FetchConfigs(const std::optional<Timestamp>& last_update, const std::vector<std::string>& fields_to_load);
+    formats::json::Value FetchConfigs(
+        const std::optional<Timestamp>& last_update,
+        const std::vector<std::string>& fields_to_load,
+        std::optional<std::chrono::milliseconds> wait_timeout = std::nullopt
+    );
+
+    static Reply ParseDocsMapReply(const formats::json::Value& json_value);
 
-    std::string FetchConfigsValues(std::string_view body);
+    std::string FetchConfigsValues(std::string_view body, std::chrono::milliseconds timeout);
 
     const ClientConfig config_;
     clients::http::Client& http_client_;
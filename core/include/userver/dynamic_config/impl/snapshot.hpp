@@ -4,6 +4,8 @@
 #include <cstddef>
 #include <exception>
 #include <functional>
+#include <memory>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <typeindex>
@@ -54,6 +56,10 @@ public:
 
     SnapshotData(const SnapshotData& defaults, const std::vector<KeyValue>& overrides);
 
+    // Parses only the variables whose docs differ in `docs_map` and
+    // `previous_docs_map`, the other ones are shared with `previous`
+    SnapshotData(const DocsMap& docs_map, const DocsMap& previous_docs_map, const SnapshotData& previous);
+
     SnapshotData(SnapshotData&&) noexcept = default;
     SnapshotData& operator=(SnapshotData&&) noexcept = default;
 
@@ -68,10 +74,29 @@ public:
 
     bool IsEmpty() const noexcept;
 
+    // Whether the variable is shared with `other`, i.e. it was not re-parsed
+    bool IsSameVariable(ConfigId id, const SnapshotData& other) const noexcept;
+
+    // Whether all the variables are shared with `other`
+    bool AreAllVariablesSame(const SnapshotData& other) const noexcept;
+
+    // Number of the variables parsed from a DocsMap by the constructor
+    std::size_t GetParsedCount() const noexcept;
+
 private:
+    struct Variable final {
+        std::any value;
+        // Names of the docs the value is parsed from, std::nullopt if the value
+        // is not parsed from a DocsMap
+        std::optional<std::vector<std::string>> docs_names;
+    };
+
     const std::any& DoGet(ConfigId id) const;
 
-    std::vector<std::any> user_configs_;
+    void ParseVariable(ConfigId id, const DocsMap& docs_map);
+
+    std::vector<std::shared_ptr<const Variable>> user_configs_;
+    std::size_t parsed_count_{0};
 };
 
 class StorageData;
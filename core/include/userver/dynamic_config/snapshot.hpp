@@ -118,8 +118,9 @@ private:
 /// config values in background (it's a snapshot!).
 ///
 /// When a config update comes in via new `DocsMap`, configs of all
-/// the registered types are constructed and stored in `Config`. After that
-/// the `DocsMap` is dropped.
+/// the registered types are constructed and stored in `Config`. On the
+/// subsequent updates only the configs whose docs have changed are
+/// constructed again, the other ones are shared with the previous snapshot.
 ///
 /// Config types are automatically registered if they are used
 /// somewhere in the program.
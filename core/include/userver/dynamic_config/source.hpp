@@ -177,6 +177,9 @@ public:
     /// @note Сallbacks occur only if one of the passed config is changed. This is
     /// true under any components::DynamicConfigClientUpdater options.
     ///
+    /// The check is cheap for the configs whose docs have not changed: such
+    /// configs are not re-parsed on update and are shared between the snapshots.
+    ///
     /// @warning To use this function, configs must have the `operator==`.
     ///
     /// @param obj the subscriber, which is the owner of the listener method, and
@@ -216,10 +219,17 @@ private:
         UASSERT(!current.GetData().IsEmpty());
         UASSERT(!previous.GetData().IsEmpty());
 
-        const bool is_equal = (true && ... && (previous[keys] == current[keys]));
+        const bool is_equal = (true && ... && IsUnchanged(previous, current, keys));
         return !is_equal;
     }
 
+    template <typename VariableType>
+    static bool IsUnchanged(const Snapshot& previous, const Snapshot& current, const Key<VariableType>& key) {
+        // Variables that were not re-parsed are shared between the snapshots
+        if (current.GetData().IsSameVariable(impl::ConfigIdGetter::Get(key), previous.GetData())) return true;
+        return previous[key] == current[key];
+    }
+
     concurrent::AsyncEventSubscriberScope
     DoUpdateAndListen(concurrent::FunctionId id, std::string_view name, SnapshotEventSource::Function&& func);
 
@@ -56,6 +56,20 @@ namespace components {
 /// will be sent to every dynamic config subscriber if *any* part of the config
 /// has updated, not if the interesting part has updated.
 ///
+/// ## Long polling
+///
+/// If `long-poll-timeout` is set, the incremental updates ask the config
+/// service to hold the request until some of the configs change or the timeout
+/// expires, see dynamic_config::Client::WaitForDocsMapUpdate. With a short
+/// `update-interval` the changes are delivered almost immediately, while each
+/// service instance sends one request per `long-poll-timeout` if the configs
+/// do not change.
+///
+/// If the config service replies to a long poll without changes before half of
+/// the `long-poll-timeout` has passed, it is considered not to support long
+/// polling, and the next incremental update is postponed by
+/// `long-poll-fallback-interval` adjusted by a random jitter of up to 10%.
+///
 /// ## Static options:
 /// Name | Description | Default value
 /// ---- | ----------- | -------------
@@ -63,6 +77,8 @@ namespace components {
 /// store-enabled | store the retrieved values into the updates sink determined by the `updates-sink` option | true
 /// load-only-my-values | request from the client only the values used by this service | true
 /// deduplicate-update-types | update types for best-effort update event deduplication, see above | `full-and-incremental`
+/// long-poll-timeout | how long the config service may hold an incremental update request, see above; long polling is disabled if not set | --
+/// long-poll-fallback-interval | interval between the incremental updates if the config service does not support long polling | 10s
 ///
 /// See also the options for components::CachingComponentBase.
 ///
@@ -117,11 +133,17 @@ private:
 
     bool IsDuplicate(cache::UpdateType update_type, const dynamic_config::DocsMap& new_value) const;
 
+    dynamic_config::Client::Reply FetchIncrementalUpdate(const std::vector<std::string>& docs_map_keys);
+
     DynamicConfigUpdatesSinkBase& updates_sink_;
     const bool load_only_my_values_;
     const bool store_enabled_;
     const std::optional<cache::AllowedUpdateTypes> deduplicate_update_types_;
     dynamic_config::Client& config_client_;
+    const std::optional<std::chrono::milliseconds> long_poll_timeout_;
+    const std::chrono::milliseconds long_poll_fallback_interval_;
+    // incremental updates are skipped until then
+    std::chrono::steady_clock::time_point next_long_poll_{};
 
     dynamic_config::Client::Timestamp server_timestamp_;
     // for atomic updates of cached data
@@ -3,6 +3,7 @@
 #include <optional>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #include <userver/formats/json/value.hpp>
 #include <userver/formats/parse/common_containers.hpp>
@@ -42,11 +43,19 @@ public:
 
     // For internal use only.
     const utils::impl::TransparentSet<std::string>& GetConfigsExpectedToBeUsed(utils::impl::InternalTag) const;
+
+    // For internal use only.
+    // While set, the names looked up with 'Get' and 'Has' methods are appended
+    // to `names`. Pass nullptr to stop the recording.
+    void SetAccessedNamesRecorder(std::vector<std::string>* names, utils::impl::InternalTag) const noexcept;
     /// @endcond
 
 private:
+    void RecordAccess(std::string_view name) const;
+
     utils::impl::TransparentMap<std::string, formats::json::Value> docs_;
     mutable utils::impl::TransparentSet<std::string> configs_to_be_used_;
+    mutable std::vector<std::string>* accessed_names_{nullptr};
 };
 
 template <typename ValueType>
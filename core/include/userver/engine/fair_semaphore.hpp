@@ -0,0 +1,132 @@
+#pragma once
+
+/// @file userver/engine/fair_semaphore.hpp
+/// @brief @copybrief engine::FairSemaphore
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <shared_mutex>  // for std locks
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/semaphore.hpp>
+#include <userver/engine/task/task_priority.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// @ingroup userver_concurrency
+///
+/// @brief Semaphore that grants the locks to the waiters fairly, taking the
+/// engine::TaskPriority of the waiting tasks into account.
+///
+/// Unlike engine::Semaphore, the waiters are queued:
+/// * the waiters of each priority are served in FIFO order, so a large
+///   lock_shared_count() request is not starved by a stream of small ones;
+/// * the queues of different priorities share the capacity with
+///   weighted-fair queueing in lock units, with the same 8:4:1 weights as the
+///   task processor queue lanes. So under contention latency-critical tasks
+///   get most of the capacity, while background tasks still make progress;
+/// * a new lock request does not overtake the queued waiters.
+///
+/// The fairness comes at a price: each wait and each wakeup takes an internal
+/// mutex, so prefer engine::Semaphore for uncontended or homogeneous loads.
+///
+/// Honours task cancellation like engine::CancellableSemaphore. Use
+/// engine::TaskCancellationBlocker to wait regardless of the cancellation.
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+class FairSemaphore final {
+public:
+    using Counter = std::size_t;
+
+    /// Creates a semaphore with predefined number of available locks
+    /// @param capacity initial number of available locks
+    explicit FairSemaphore(Counter capacity);
+
+    ~FairSemaphore();
+
+    FairSemaphore(FairSemaphore&&) = delete;
+    FairSemaphore(const FairSemaphore&) = delete;
+    FairSemaphore& operator=(FairSemaphore&&) = delete;
+    FairSemaphore& operator=(const FairSemaphore&) = delete;
+
+    /// Sets the total number of available locks. If the lock count decreases, the
+    /// current acquired lock count may temporarily go above the limit.
+    void SetCapacity(Counter capacity);
+
+    /// Gets the total number of available locks.
+    [[nodiscard]] Counter GetCapacity() const noexcept;
+
+    /// Returns an approximate number of available locks, use only for statistics.
+    [[nodiscard]] std::size_t RemainingApprox() const;
+
+    /// Returns an approximate number of used locks, use only for statistics.
+    [[nodiscard]] std::size_t UsedApprox() const;
+
+    /// Returns an approximate number of queued waiters, use only for statistics.
+    [[nodiscard]] std::size_t WaitersApprox() const;
+
+    /// Acquires a lock, waiting in the queue of the current task priority.
+    ///
+    /// @throws UnreachableSemaphoreLockError if `capacity == 0`
+    /// @throws SemaphoreLockCancelledError if the current task is cancelled
+    void lock_shared();
+
+    /// Releases a lock and grants the released locks to the queued waiters.
+    ///
+    /// @note it is allowed to call lock_shared() in one coroutine and
+    /// subsequently call unlock_shared() in another coroutine.
+    void unlock_shared();
+
+    /// Acquires a lock if it is available and there are no queued waiters.
+    [[nodiscard]] bool try_lock_shared();
+
+    template <typename Rep, typename Period>
+    [[nodiscard]] bool try_lock_shared_for(std::chrono::duration<Rep, Period>);
+
+    template <typename Clock, typename Duration>
+    [[nodiscard]] bool try_lock_shared_until(std::chrono::time_point<Clock, Duration>);
+
+    [[nodiscard]] bool try_lock_shared_until(Deadline deadline);
+
+    void lock_shared_count(Counter count);
+
+    void unlock_shared_count(Counter count);
+
+    [[nodiscard]] bool try_lock_shared_count(Counter count);
+
+    [[nodiscard]] bool try_lock_shared_until_count(Deadline deadline, Counter count);
+
+    /// Time in microseconds that the waiters of the priority spent in the queue.
+    /// Lock acquisitions without waiting are not accounted.
+    [[nodiscard]] const utils::statistics::Histogram& GetWaitTimeHistogram(TaskPriority priority) const;
+
+private:
+    class Impl;
+
+    bool TryLockFastPath(Counter count, bool ignore_waiters) noexcept;
+    bool LockSlowPath(Deadline deadline, Counter count);
+
+    std::atomic<Counter> acquired_locks_{0};
+    std::atomic<Counter> capacity_;
+    // Waiters that have entered the slow path, disables the fast path
+    std::atomic<std::size_t> waiters_{0};
+    std::unique_ptr<Impl> impl_;
+};
+
+template <typename Rep, typename Period>
+bool FairSemaphore::try_lock_shared_for(std::chrono::duration<Rep, Period> duration) {
+    return try_lock_shared_until(Deadline::FromDuration(duration));
+}
+
+template <typename Clock, typename Duration>
+bool FairSemaphore::try_lock_shared_until(std::chrono::time_point<Clock, Duration> until) {
+    return try_lock_shared_until(Deadline::FromTimePoint(until));
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -11,6 +11,7 @@
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/future_status.hpp>
 #include <userver/engine/impl/future_state.hpp>
+#include <userver/engine/impl/pooled_allocator.hpp>
 
 // TODO remove extra includes
 #include <userver/utils/assert.hpp>
@@ -242,7 +243,8 @@ void Future<T>::CheckValid() const {
 }
 
 template <typename T>
-Promise<T>::Promise() : state_(std::make_shared<impl::FutureState<T>>()) {}
+Promise<T>::Promise()
+    : state_(std::allocate_shared<impl::FutureState<T>>(impl::PooledAllocator<impl::FutureState<T>>{})) {}
 
 template <typename T>
 Promise<T>& Promise<T>::operator=(Promise<T>&& other) noexcept {
@@ -283,7 +285,8 @@ void Promise<T>::set_exception(std::exception_ptr ex) {
     state_->SetException(std::move(ex));
 }
 
-inline Promise<void>::Promise() : state_(std::make_shared<impl::FutureState<void>>()) {}
+inline Promise<void>::Promise()
+    : state_(std::allocate_shared<impl::FutureState<void>>(impl::PooledAllocator<impl::FutureState<void>>{})) {}
 
 inline Promise<void>& Promise<void>::operator=(Promise<void>&& other) noexcept {
     if (this == &other) return *this;
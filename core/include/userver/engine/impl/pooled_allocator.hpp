@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+// Returns a block of at least `size` bytes, aligned as by `::operator new`.
+// Small blocks are taken from a per-thread cache of the freed blocks of the
+// same size class. Never returns nullptr, may throw.
+void* AllocatePooled(std::size_t size);
+
+// Puts the block back into the cache of the current thread, which may differ
+// from the one that allocated it. `size` must be the one passed to
+// AllocatePooled.
+void DeallocatePooled(void* block, std::size_t size) noexcept;
+
+// An std::allocator replacement for the short-living objects that are
+// created on the hot paths of the engine, e.g. for std::allocate_shared.
+template <typename T>
+class PooledAllocator final {
+public:
+    using value_type = T;
+
+    PooledAllocator() noexcept = default;
+
+    template <typename U>
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    PooledAllocator(const PooledAllocator<U>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            return std::allocator<T>{}.allocate(n);
+        } else {
+            return static_cast<T*>(AllocatePooled(n * sizeof(T)));
+        }
+    }
+
+    void deallocate(T* ptr, std::size_t n) noexcept {
+        if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            std::allocator<T>{}.deallocate(ptr, n);
+        } else {
+            DeallocatePooled(ptr, n * sizeof(T));
+        }
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const PooledAllocator<T>&, const PooledAllocator<U>&) noexcept {
+    return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const PooledAllocator<T>&, const PooledAllocator<U>&) noexcept {
+    return false;
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
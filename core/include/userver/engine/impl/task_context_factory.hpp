@@ -24,6 +24,9 @@ struct TaskConfig final {
     Task::Importance importance{Task::Importance::kNormal};
     Task::WaitMode wait_mode{Task::WaitMode::kSingleWaiter};
     engine::Deadline deadline;
+    // Run the payload directly on the worker thread, without a coroutine.
+    // The payload must not block.
+    bool is_stackless{false};
 };
 
 [[nodiscard]] TaskContext&
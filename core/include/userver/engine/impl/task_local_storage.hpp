@@ -86,7 +86,8 @@ public:
     Storage& operator=(Storage&&) = delete;
     ~Storage();
 
-    // Copies pointers to inherited variables from 'other'
+    // Shares the inherited variables of 'other', they are copied on the first
+    // modification of the inherited variables by either of the storages
     // 'this' must not contain any variables
     void InheritFrom(Storage& other);
 
@@ -103,7 +104,7 @@ public:
     // Otherwise it is UB.
     template <typename T, VariableKind Kind>
     T& GetOrEmplace(Key key) {
-        DataBase* const old_data = GetGeneric(key);
+        DataBase* const old_data = GetGeneric(key, Kind);
         if (!old_data) {
             const bool has_existing_variable = false;
             return DoEmplace<T, Kind>(key, has_existing_variable);
@@ -113,7 +114,7 @@ public:
 
     template <typename T, VariableKind Kind>
     T* GetOptional(Key key) noexcept {
-        DataBase* const data = GetGeneric(key);
+        DataBase* const data = GetGeneric(key, Kind);
         if (!data) return nullptr;
         return &static_cast<DataImpl<T, Kind>&>(*data).Get();
     }
@@ -127,7 +128,7 @@ public:
 
     template <typename T, VariableKind Kind, typename... Args>
     T& Emplace(Key key, Args&&... args) {
-        DataBase* const old_data = GetGeneric(key);
+        DataBase* const old_data = GetGeneric(key, Kind);
         const bool has_existing_variable = old_data != nullptr;
         auto& result = DoEmplace<T, Kind>(key, has_existing_variable, std::forward<Args>(args)...);
         if (old_data) old_data->DeleteSelf();
@@ -135,21 +136,19 @@ public:
     }
 
     template <typename T, VariableKind Kind>
-    void Erase(Key key) noexcept {
+    void Erase(Key key) {
         static_assert(Kind == VariableKind::kInherited);
         EraseInherited(key);
     }
 
 private:
-    DataBase* GetGeneric(Key key) noexcept;
+    DataBase* GetGeneric(Key key, VariableKind kind) noexcept;
 
     void SetGeneric(Key key, NormalDataBase& node, bool has_existing_variable);
 
     void SetGeneric(Key key, InheritedDataBase& node, bool has_existing_variable);
 
-    void EraseInherited(Key key) noexcept;
-
-    void InheritNode(InheritedDataBase&);
+    void EraseInherited(Key key);
 
     // Provides strong exception guarantee. Does not delete the old data, if any.
     template <typename T, VariableKind Kind, typename... Args>
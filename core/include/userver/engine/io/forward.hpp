@@ -0,0 +1,59 @@
+#pragma once
+
+/// @file userver/engine/io/forward.hpp
+/// @brief Zero-copy forwarding of the data between sockets
+
+#include <cstddef>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/io/socket.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io {
+
+class TlsWrapper;
+
+/// @brief Bytes forwarded by engine::io::ForwardBidirectional
+struct ForwardResult {
+    /// Bytes forwarded from the first socket to the second one
+    std::size_t first_to_second{0};
+
+    /// Bytes forwarded from the second socket to the first one
+    std::size_t second_to_first{0};
+};
+
+/// @brief Forwards the data received from `from` to `to` until `from` is
+/// closed by peer.
+///
+/// On Linux the data is moved by `splice` through a pipe and is never copied
+/// to the userspace. If the sockets do not support splicing, the data is
+/// copied through a buffer.
+///
+/// Suspends the current task only, it is safe to concurrently forward the
+/// data in the opposite direction, see engine::io::ForwardBidirectional.
+///
+/// @returns the number of forwarded bytes
+/// @throws IoInterrupted with the number of forwarded bytes on timeout or
+/// cancellation
+/// @note Can return before `from` is closed if `to` is closed by peer.
+[[nodiscard]] std::size_t Forward(Socket& from, Socket& to, Deadline deadline);
+
+/// @overload
+///
+/// The data is spliced to the socket if the kernel TLS offload is enabled
+/// for `to`, see engine::io::TlsWrapper::StartTlsServer. Otherwise it is
+/// copied and encrypted in the userspace.
+[[nodiscard]] std::size_t Forward(Socket& from, TlsWrapper& to, Deadline deadline);
+
+/// @brief Forwards the data between the sockets in both directions until both
+/// of them are closed by peers.
+///
+/// The data from `second` is forwarded by a separate task. Once one of the
+/// sockets is closed by peer, the other one is shut down for writing, so that
+/// its peer sees the end of the stream.
+[[nodiscard]] ForwardResult ForwardBidirectional(Socket& first, Socket& second, Deadline deadline);
+
+}  // namespace engine::io
+
+USERVER_NAMESPACE_END
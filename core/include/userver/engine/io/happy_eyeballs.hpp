@@ -0,0 +1,48 @@
+#pragma once
+
+/// @file userver/engine/io/happy_eyeballs.hpp
+/// @brief @copybrief engine::io::ConnectHappyEyeballs
+
+#include <chrono>
+#include <vector>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/io/sockaddr.hpp>
+#include <userver/engine/io/socket.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io {
+
+/// @brief Settings of engine::io::ConnectHappyEyeballs
+struct HappyEyeballsSettings final {
+    /// Delay before the next connection attempt is started while the previous
+    /// ones are still in progress, RFC 8305 recommends 250ms
+    std::chrono::milliseconds attempt_delay{250};
+};
+
+/// @brief Reorders the addresses for connection attempts as RFC 8305 section 4
+/// suggests: the address families alternate, starting with the family of the
+/// first address, the order within a family is preserved.
+std::vector<Sockaddr> InterleaveAddressFamilies(std::vector<Sockaddr> addrs);
+
+/// @brief Connects a stream socket to one of the addresses using the "Happy
+/// Eyeballs" algorithm of RFC 8305.
+///
+/// The connection attempts are started in the order of
+/// engine::io::InterleaveAddressFamilies one by one, each one
+/// `settings.attempt_delay` after the previous one or right after the failure
+/// of the previous one. The first established connection is returned, the
+/// other attempts are cancelled. So a blackholed address costs
+/// `attempt_delay` instead of the whole connect timeout.
+///
+/// @param addrs addresses with the ports set
+/// @param deadline deadline of the whole operation
+/// @throws IoTimeout if the deadline is reached
+/// @throws IoCancelled if the task is cancelled
+/// @throws IoException of the last attempt if all the attempts fail
+Socket ConnectHappyEyeballs(const std::vector<Sockaddr>& addrs, Deadline deadline, HappyEyeballsSettings settings = {});
+
+}  // namespace engine::io
+
+USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 
 #include <sys/socket.h>
 
+#include <cstdint>
 #include <initializer_list>
 
 #include <userver/engine/deadline.hpp>
@@ -41,6 +42,35 @@ public:
         Sockaddr src_addr;
     };
 
+    /// @brief A datagram of RecvSomeBatchFrom and SendAllBatchTo
+    struct Datagram {
+        /// Buffer to receive into or data to send
+        void* data{nullptr};
+
+        /// Size of the buffer to receive into or of the data to send
+        size_t len{0};
+
+        /// Source address of a received datagram. Destination address of a
+        /// datagram to send, AddrDomain::kUnspecified for the connected peer.
+        Sockaddr addr;
+
+        /// Size of a received datagram
+        size_t bytes_received{0};
+
+        /// UDP GSO/GRO segment size, 0 if the datagram is not segmented.
+        ///
+        /// A datagram to send with a non-zero segment_size is split by the
+        /// kernel (or the NIC) into datagrams of segment_size bytes, the last
+        /// one may be shorter. A received datagram has a non-zero segment_size
+        /// if the kernel has coalesced several datagrams of the same source
+        /// into it, which happens only if the UDP_GRO socket option is set.
+        /// Linux only.
+        std::uint16_t segment_size{0};
+    };
+
+    /// Max datagrams transferred by a single syscall of the batch I/O
+    static constexpr size_t kMaxBatchSize = 64;
+
     /// Constructs an invalid socket.
     Socket() = default;
 
@@ -129,6 +159,24 @@ public:
     /// @note Not for SocketType::kStream connections, see `man sendto`.
     [[nodiscard]] size_t SendAllTo(const Sockaddr& dest_addr, const void* buf, size_t len, Deadline deadline);
 
+    /// @brief Receives at least one datagram, at most `count` and
+    /// kMaxBatchSize, with a single syscall (`recvmmsg` on Linux).
+    /// @returns the number of received datagrams, their `bytes_received`,
+    /// `addr` and `segment_size` are filled
+    /// @note Datagrams longer than `len` are truncated.
+    /// @note `bytes_transferred` of the thrown exceptions is a number of
+    /// datagrams.
+    [[nodiscard]] size_t RecvSomeBatchFrom(Datagram* datagrams, size_t count, Deadline deadline);
+
+    /// @brief Sends all the datagrams, kMaxBatchSize of them per syscall
+    /// (`sendmmsg` on Linux).
+    /// @returns the number of sent datagrams, less than `count` if sending
+    /// has failed after some of them were sent.
+    /// @note Sockaddr domains must match the socket's domain.
+    /// @note `bytes_transferred` of the thrown exceptions is a number of
+    /// datagrams.
+    [[nodiscard]] size_t SendAllBatchTo(const Datagram* datagrams, size_t count, Deadline deadline);
+
     /// File descriptor corresponding to this socket.
     int Fd() const;
 
@@ -39,13 +39,19 @@ public:
         const std::vector<crypto::Certificate>& extra_cert_authorities = {}
     );
 
-    /// Starts a TLS server on an opened socket
+    /// @brief Starts a TLS server on an opened socket
+    ///
+    /// With `enable_kernel_tls` the record encryption is offloaded to the
+    /// kernel (Linux kTLS, transmit direction only) after the handshake if
+    /// the OpenSSL, the kernel and the negotiated cipher support it.
+    /// Otherwise the userspace encryption is used.
     static TlsWrapper StartTlsServer(
         Socket&& socket,
         const crypto::CertificatesChain& cert_chain,
         const crypto::PrivateKey& key,
         Deadline deadline,
-        const std::vector<crypto::Certificate>& extra_cert_authorities = {}
+        const std::vector<crypto::Certificate>& extra_cert_authorities = {},
+        bool enable_kernel_tls = false
     );
 
     ~TlsWrapper() override;
@@ -59,6 +65,9 @@ public:
     /// Whether the socket is valid.
     bool IsValid() const override;
 
+    /// Whether the data sent is encrypted by the kernel
+    bool IsKernelTlsSendEnabled() const noexcept;
+
     /// Suspends current task until the socket has data available.
     [[nodiscard]] bool WaitReadable(Deadline) override;
 
@@ -78,9 +87,19 @@ public:
     /// @note Can return less than len if socket is closed by peer.
     [[nodiscard]] size_t SendAll(const void* buf, size_t len, Deadline deadline);
 
+    /// @brief Sends a buffer vector to the socket.
+    /// @note Can return less than len if socket is closed by peer.
+    [[nodiscard]] size_t SendAll(std::initializer_list<IoData> list, Deadline deadline);
+
+    /// @brief Sends exactly list_size IoData to the socket. Small buffers are
+    /// coalesced into a single TLS record, large ones are sent without copying.
+    /// @note Can return less than len if socket is closed by peer.
+    [[nodiscard]] size_t SendAll(const IoData* list, std::size_t list_size, Deadline deadline);
+
     /// @brief Finishes TLS session and returns the socket.
     /// @warning Wrapper becomes invalid on entry and can only be used to retry
     ///   socket extraction if interrupted.
+    /// @throws TlsException if the kernel TLS offload is enabled
     [[nodiscard]] Socket StopTls(Deadline deadline);
 
     /// @brief Receives at least one byte from the socket.
@@ -102,7 +121,9 @@ public:
         return SendAll(buf, len, deadline);
     }
 
-    [[nodiscard]] size_t WriteAll(std::initializer_list<IoData> list, Deadline deadline) override;
+    [[nodiscard]] size_t WriteAll(std::initializer_list<IoData> list, Deadline deadline) override {
+        return SendAll(list, deadline);
+    }
 
     int GetRawFd();
 
@@ -0,0 +1,133 @@
+#pragma once
+
+/// @file userver/engine/reader_biased_shared_mutex.hpp
+/// @brief @copybrief engine::ReaderBiasedSharedMutex
+
+#include <atomic>
+#include <chrono>
+
+#include <userver/concurrent/impl/striped_read_indicator.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/mutex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// @ingroup userver_concurrency
+///
+/// @brief std::shared_mutex replacement for asynchronous tasks, optimized for
+/// read-mostly data with many concurrent readers.
+///
+/// Readers only touch a per-CPU stripe of a
+/// concurrent::impl::StripedReadIndicator, so shared locks scale with the
+/// number of cores, unlike engine::SharedMutex where all the readers modify
+/// the same atomic. The price is paid by the writers: a unique lock blocks
+/// new readers and then waits for the stripes to drain, checking them
+/// periodically, which takes from a few microseconds to a millisecond.
+/// The mutex also takes `16 * N_CORES` bytes of memory.
+///
+/// Prefer engine::SharedMutex unless the profile shows contention of readers
+/// and the writes are rare.
+///
+/// Ignores task cancellations (succeeds even if the current task is cancelled).
+///
+/// Writers have priority over readers: new shared locks wait for the pending
+/// writes to finish, which in turn wait for existing shared locks to unlock.
+///
+/// ## Example usage:
+///
+/// @snippet engine/reader_biased_shared_mutex_test.cpp  Sample engine::ReaderBiasedSharedMutex usage
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+class ReaderBiasedSharedMutex final {
+public:
+    ReaderBiasedSharedMutex();
+    ~ReaderBiasedSharedMutex();
+
+    ReaderBiasedSharedMutex(const ReaderBiasedSharedMutex&) = delete;
+    ReaderBiasedSharedMutex(ReaderBiasedSharedMutex&&) = delete;
+    ReaderBiasedSharedMutex& operator=(const ReaderBiasedSharedMutex&) = delete;
+    ReaderBiasedSharedMutex& operator=(ReaderBiasedSharedMutex&&) = delete;
+
+    /// Locks the mutex for unique ownership. Blocks current coroutine if the
+    /// mutex is locked by another coroutine for reading or writing.
+    void lock();
+
+    /// Unlocks the mutex for unique ownership. Must be called by the coroutine
+    /// that has locked the mutex.
+    void unlock();
+
+    /// Tries to lock the mutex for unique ownership without blocking the
+    /// coroutine, returns true if succeeded.
+    [[nodiscard]] bool try_lock();
+
+    /// Tries to lock the mutex for unique ownership in specified duration.
+    template <typename Rep, typename Period>
+    [[nodiscard]] bool try_lock_for(const std::chrono::duration<Rep, Period>&);
+
+    /// Tries to lock the mutex for unique ownership till specified time point.
+    template <typename Clock, typename Duration>
+    [[nodiscard]] bool try_lock_until(const std::chrono::time_point<Clock, Duration>&);
+
+    /// @overload
+    [[nodiscard]] bool try_lock_until(Deadline deadline);
+
+    /// Locks the mutex for shared ownership. Blocks current coroutine only if
+    /// the mutex is locked or is being locked for writing.
+    void lock_shared();
+
+    /// Unlocks the mutex for shared ownership. It is allowed to unlock the
+    /// mutex in another coroutine.
+    void unlock_shared();
+
+    /// Tries to lock the mutex for shared ownership without blocking the
+    /// coroutine, returns true if succeeded.
+    [[nodiscard]] bool try_lock_shared();
+
+    /// Tries to lock the mutex for shared ownership in specified duration.
+    template <typename Rep, typename Period>
+    [[nodiscard]] bool try_lock_shared_for(const std::chrono::duration<Rep, Period>&);
+
+    /// Tries to lock the mutex for shared ownership till specified time point.
+    template <typename Clock, typename Duration>
+    [[nodiscard]] bool try_lock_shared_until(const std::chrono::time_point<Clock, Duration>&);
+
+    /// @overload
+    [[nodiscard]] bool try_lock_shared_until(Deadline deadline);
+
+private:
+    bool TryLockSharedFastPath() noexcept;
+    bool WaitForReaders(Deadline deadline);
+
+    concurrent::impl::StripedReadIndicator readers_;
+
+    // Set by a writer that holds writer_mutex_, sends new readers to the slow
+    // path where they wait for writer_mutex_
+    std::atomic<bool> is_writer_pending_{false};
+    Mutex writer_mutex_;
+};
+
+template <typename Rep, typename Period>
+bool ReaderBiasedSharedMutex::try_lock_for(const std::chrono::duration<Rep, Period>& duration) {
+    return try_lock_until(Deadline::FromDuration(duration));
+}
+
+template <typename Rep, typename Period>
+bool ReaderBiasedSharedMutex::try_lock_shared_for(const std::chrono::duration<Rep, Period>& duration) {
+    return try_lock_shared_until(Deadline::FromDuration(duration));
+}
+
+template <typename Clock, typename Duration>
+bool ReaderBiasedSharedMutex::try_lock_until(const std::chrono::time_point<Clock, Duration>& until) {
+    return try_lock_until(Deadline::FromTimePoint(until));
+}
+
+template <typename Clock, typename Duration>
+bool ReaderBiasedSharedMutex::try_lock_shared_until(const std::chrono::time_point<Clock, Duration>& until) {
+    return try_lock_shared_until(Deadline::FromTimePoint(until));
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -47,7 +47,7 @@ struct ExecOptions final {
 /// @brief Creates a new OS subprocess and executes a command in it.
 class ProcessStarter {
 public:
-    /// @param task_processor will be used for executing asynchronous fork + exec.
+    /// @param task_processor will be used for executing asynchronous posix_spawn.
     /// `main-task-processor is OK for this purpose.
     explicit ProcessStarter(TaskProcessor& task_processor);
 
@@ -59,6 +59,8 @@ public:
     /// @param options @ref ExecOptions settings
     /// @throws std::runtime_error if `use_path` is `true`, `executable_path` contains `/`
     /// and PATH not in environment variables
+    /// @throws std::system_error if the executable is not found or could not
+    /// be started, or the output files could not be opened
     ChildProcess
     Exec(const std::string& executable_path, const std::vector<std::string>& args, ExecOptions&& options = {});
 
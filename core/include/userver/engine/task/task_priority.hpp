@@ -0,0 +1,71 @@
+#pragma once
+
+/// @file userver/engine/task/task_priority.hpp
+/// @brief @copybrief engine::TaskPriority
+
+#include <cstddef>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+namespace impl {
+class TaskContext;
+}  // namespace impl
+
+/// @brief Priority class of a task, selects the task processor queue lane.
+///
+/// Each engine::TaskProcessor keeps a separate queue lane for each priority.
+/// Lanes are served with weighted round-robin, so a burst of background work
+/// does not increase queue wait times of latency-critical tasks, while
+/// background tasks are still guaranteed to make progress.
+///
+/// A new task inherits the priority of the task that has spawned it.
+///
+/// @see engine::TaskPriorityScope
+enum class TaskPriority {
+    kLatencyCritical,  ///< Request handling and other latency-sensitive work
+    kNormal,           ///< Default priority
+    kBackground,       ///< Cache updates, periodic jobs and other bulk work
+};
+
+/// Number of engine::TaskPriority values
+inline constexpr std::size_t kTaskPrioritiesCount = 3;
+
+/// Returns a string representation of a task priority
+std::string_view ToString(TaskPriority priority) noexcept;
+
+namespace current_task {
+
+/// Returns the priority of the current task
+TaskPriority GetPriority() noexcept;
+
+}  // namespace current_task
+
+/// @brief Sets the priority of the current task for the scope lifetime.
+///
+/// Tasks spawned within the scope inherit the priority. Recursive, i.e. can be
+/// instantiated multiple times in a given call stack.
+///
+/// @code
+/// engine::TaskPriorityScope priority_scope{engine::TaskPriority::kBackground};
+/// auto task = utils::Async("bulk-work", [] { ... });  // background priority
+/// @endcode
+class TaskPriorityScope final {
+public:
+    explicit TaskPriorityScope(TaskPriority priority);
+    ~TaskPriorityScope();
+
+    TaskPriorityScope(const TaskPriorityScope&) = delete;
+    TaskPriorityScope(TaskPriorityScope&&) = delete;
+    TaskPriorityScope& operator=(const TaskPriorityScope&) = delete;
+    TaskPriorityScope& operator=(TaskPriorityScope&&) = delete;
+
+private:
+    impl::TaskContext& context_;
+    const TaskPriority old_priority_;
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -51,6 +51,9 @@ FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
 );
 
 /// @brief Reads file contents asynchronously
+///
+/// If `event_thread_pool.file_io_uring_entries` of the components manager is
+/// set, the file is read via io_uring without occupying a thread of `async_tp`.
 /// @param async_tp TaskProcessor for synchronous waiting
 /// @param path file to open
 /// @returns file contents
@@ -28,6 +28,10 @@ void CreateDirectories(engine::TaskProcessor& async_tp, std::string_view path);
 /// @brief Rewrite file contents asynchronously
 /// It doesn't provide strict atomic guarantees. If you need them, use
 /// `fs::RewriteFileContentsAtomically`.
+///
+/// If `event_thread_pool.file_io_uring_entries` of the components manager is
+/// set, the file is written via io_uring without occupying a thread of
+/// `async_tp`.
 /// @param async_tp TaskProcessor for synchronous waiting
 /// @param path file to rewrite
 /// @param contents new file contents
@@ -43,10 +43,14 @@ namespace components {
 /// ---- | ----------- | -------------
 /// file_path | path to the log file | -
 /// level | log verbosity | info
-/// format | log output format, one of `tskv`, `ltsv`, `json`, `json_yadeploy` | tskv
+/// format | log output format, one of `tskv`, `ltsv`, `json`, `json_yadeploy`, `binary` (see userver/logging/binary_log.hpp) | tskv
 /// flush_level | messages of this and higher levels get flushed to the file immediately | warning
 /// message_queue_size | the size of internal message queue, must be a power of 2 | 65536
 /// overflow_behavior | message handling policy while the queue is full: `discard` drops messages, `block` waits until message gets into the queue | discard
+/// deferred_formatting | if `true`, log records are captured with unformatted numbers and tags and are formatted by the logger task on its task processor, making `LOG_*` calls cheaper for the calling task | false
+/// batched_file_sink | if `true`, log records for a file in `file_path` are accumulated into large buffers that are written by a dedicated thread, and the written data is dropped from the page cache | false
+/// zstd_compression | if `true`, the file in `file_path` is written as a sequence of independent zstd frames, each frame is ended on reaching `zstd_frame_size` bytes of logs and on reopening the file; `batched_file_sink` is ignored | false
+/// zstd_frame_size | uncompressed size of the logs in a single zstd frame | 4194304
 /// testsuite-capture | if exists, setups additional TCP log sink for testing purposes | {}
 /// fs-task-processor | task processor for disk I/O operations for this logger | fs-task-processor of the loggers component
 ///
@@ -1,7 +1,10 @@
 #pragma once
 
 /// @file userver/rcu/fwd.hpp
-/// @brief Forward declarations for rcu::Variable and rcu::RcuMap
+/// @brief Forward declarations for rcu::Variable, rcu::RcuMap and
+/// rcu::ShardedRcuMap
+
+#include <cstddef>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -26,6 +29,13 @@ class WritablePtr;
 template <typename Key, typename Value, typename RcuMapTraits = DefaultRcuMapTraits<Key>>
 class RcuMap;
 
+template <
+    typename Key,
+    typename Value,
+    std::size_t ShardsCount = 16,
+    typename RcuMapTraits = DefaultRcuMapTraits<Key>>
+class ShardedRcuMap;
+
 }  // namespace rcu
 
 USERVER_NAMESPACE_END
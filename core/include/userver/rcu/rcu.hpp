@@ -4,9 +4,13 @@
 /// @brief @copybrief rcu::Variable
 
 #include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <cstdlib>
+#include <limits>
 #include <mutex>
 #include <optional>
+#include <thread>
 #include <utility>
 
 #include <userver/concurrent/impl/asymmetric_fence.hpp>
@@ -15,9 +19,13 @@
 #include <userver/concurrent/impl/striped_read_indicator.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/mutex.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/current_task.hpp>
 #include <userver/rcu/fwd.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/impl/wait_token_storage.hpp>
+#include <userver/utils/meta_light.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -36,6 +44,7 @@ struct SnapshotRecord final {
     concurrent::impl::StripedReadIndicator indicator;
     concurrent::impl::SinglyLinkedHook<SnapshotRecord> free_list_hook;
     SnapshotRecord* next_retired{nullptr};
+    std::size_t retired_bytes{0};
 };
 
 // Used instead of concurrent::impl::MemberHook to avoid instantiating
@@ -63,9 +72,16 @@ public:
 
     bool IsEmpty() const noexcept { return head_ == nullptr; }
 
-    void Push(SnapshotRecord<T>& record) noexcept {
+    // May be called without the writer's lock
+    std::size_t GetSize() const noexcept { return size_.load(std::memory_order_relaxed); }
+    std::size_t GetBytes() const noexcept { return bytes_.load(std::memory_order_relaxed); }
+
+    void Push(SnapshotRecord<T>& record, std::size_t bytes) noexcept {
         record.next_retired = head_;
+        record.retired_bytes = bytes;
         head_ = &record;
+        size_.store(GetSize() + 1, std::memory_order_relaxed);
+        bytes_.store(GetBytes() + bytes, std::memory_order_relaxed);
     }
 
     template <typename Predicate, typename Disposer>
@@ -77,6 +93,8 @@ public:
 
             if (predicate(*current)) {
                 *ptr_to_current = std::exchange(current->next_retired, nullptr);
+                size_.store(GetSize() - 1, std::memory_order_relaxed);
+                bytes_.store(GetBytes() - current->retired_bytes, std::memory_order_relaxed);
                 disposer(*current);
             } else {
                 ptr_to_current = &current->next_retired;
@@ -86,10 +104,36 @@ public:
 
 private:
     SnapshotRecord<T>* head_{nullptr};
+    std::atomic<std::size_t> size_{0};
+    std::atomic<std::size_t> bytes_{0};
 };
 
+template <typename RcuTraits, typename T>
+using HasEstimateSnapshotBytes = decltype(RcuTraits::EstimateSnapshotBytes(std::declval<const T&>()));
+
+template <typename RcuTraits, typename T>
+std::size_t EstimateSnapshotBytes(const T& value) {
+    if constexpr (meta::kIsDetected<HasEstimateSnapshotBytes, RcuTraits, T>) {
+        return RcuTraits::EstimateSnapshotBytes(value);
+    } else {
+        return sizeof(T);
+    }
+}
+
 }  // namespace impl
 
+/// @brief Snapshots of rcu::Variable that were replaced by writers, but may
+/// still be used by readers
+/// @see rcu::Variable::GetRetiredStatistics
+struct RetiredStatistics final {
+    /// Count of the retired snapshots that were not freed yet
+    std::size_t snapshots{0};
+
+    /// Memory held by the retired snapshots, `sizeof(T)` per snapshot unless
+    /// `RcuTraits::EstimateSnapshotBytes(const T&)` is provided
+    std::size_t bytes{0};
+};
+
 /// @brief A handle to the retired object version, which an RCU deleter should
 /// clean up.
 /// @see rcu::DefaultRcuTraits
@@ -175,6 +219,14 @@ struct DefaultRcuTraits {
     /// 1. should contain `void Delete(SnapshotHandle<T>) noexcept`;
     /// 2. force synchronous cleanup of remaining handles on destruction.
     using DeleterType = AsyncDeleter;
+
+    /// `kMaxRetiredSnapshots` bounds the count of the retired snapshots that
+    /// are still used by readers. A writer that exceeds the limit waits for the
+    /// readers of the old snapshots to finish, or until the writer is
+    /// cancelled.
+    /// @warning A writer holding rcu::ReadablePtr to the retired snapshots of
+    /// the same variable may wait forever.
+    static constexpr std::size_t kMaxRetiredSnapshots = std::numeric_limits<std::size_t>::max();
 };
 
 /// @brief Deletes garbage synchronously.
@@ -359,6 +411,11 @@ private:
 /// be eventually freed when a subsequent writer identifies that nobody works
 /// with this version.
 ///
+/// Each retired version is tracked by its own read indicator, so a reader
+/// holding an old version keeps only that version alive. Use
+/// GetRetiredStatistics() to monitor the retired versions and
+/// `RcuTraits::kMaxRetiredSnapshots` to bound their count.
+///
 /// @note There is no way to create a "null" `Variable`.
 ///
 /// ## Example usage:
@@ -438,6 +495,12 @@ public:
         WritablePtr<T, RcuTraits>(*this, std::in_place, std::forward<Args>(args)...).Commit();
     }
 
+    /// @returns statistics of the snapshots retired by writers and still
+    /// used by readers
+    RetiredStatistics GetRetiredStatistics() const noexcept {
+        return {retired_list_.GetSize(), retired_list_.GetBytes()};
+    }
+
     void Cleanup() {
         std::unique_lock lock(mutex_, std::try_to_lock);
         if (!lock.owns_lock()) {
@@ -460,8 +523,27 @@ private:
         current_.store(&new_snapshot, std::memory_order_seq_cst);
 
         UASSERT(old_snapshot);
-        retired_list_.Push(*old_snapshot);
+        retired_list_.Push(*old_snapshot, impl::EstimateSnapshotBytes<RcuTraits>(*old_snapshot->data));
         ScanRetiredList(lock);
+
+        if constexpr (RcuTraits::kMaxRetiredSnapshots != std::numeric_limits<std::size_t>::max()) {
+            while (retired_list_.GetSize() > RcuTraits::kMaxRetiredSnapshots) {
+                if (!WaitForReaders()) break;
+                ScanRetiredList(lock);
+            }
+        }
+    }
+
+    // Returns false if the writer should stop waiting
+    static bool WaitForReaders() {
+        constexpr std::chrono::milliseconds kRetiredScanInterval{1};
+        if (engine::current_task::IsTaskProcessorThread()) {
+            if (engine::current_task::ShouldCancel()) return false;
+            engine::SleepFor(kRetiredScanInterval);
+        } else {
+            std::this_thread::sleep_for(kRetiredScanInterval);
+        }
+        return true;
     }
 
     template <typename... Args>
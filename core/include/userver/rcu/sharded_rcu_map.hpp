@@ -0,0 +1,167 @@
+#pragma once
+
+/// @file userver/rcu/sharded_rcu_map.hpp
+/// @brief @copybrief rcu::ShardedRcuMap
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <userver/rcu/fwd.hpp>
+#include <userver/rcu/rcu_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace rcu {
+
+/// @ingroup userver_concurrency userver_containers
+///
+/// @brief rcu::RcuMap split into `ShardsCount` independent rcu::RcuMap shards
+/// by the hash of the key.
+///
+/// A keyset change copies only the shard of the key, and the writers of
+/// different shards do not wait for each other. Reads are the same as in
+/// rcu::RcuMap, but there is no single snapshot of the whole map: the shards
+/// are read independently.
+///
+/// Use InsertOrAssignBatch() to apply many changes at once, it copies each
+/// affected shard once and publishes it in one snapshot swap.
+///
+/// @note No synchronization is provided for value access, it must be
+/// implemented by Value when necessary.
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename Key, typename Value, std::size_t ShardsCount, typename RcuMapTraits>
+class ShardedRcuMap final {
+    static_assert(ShardsCount > 0);
+
+    using Shard = RcuMap<Key, Value, RcuMapTraits>;
+
+public:
+    using Hash = typename Shard::Hash;
+    using ValuePtr = typename Shard::ValuePtr;
+    using ConstValuePtr = typename Shard::ConstValuePtr;
+    using InsertReturnType = typename Shard::InsertReturnType;
+    using Snapshot = typename Shard::Snapshot;
+
+    ShardedRcuMap() = default;
+
+    ShardedRcuMap(const ShardedRcuMap&) = delete;
+    ShardedRcuMap(ShardedRcuMap&&) = delete;
+    ShardedRcuMap& operator=(const ShardedRcuMap&) = delete;
+    ShardedRcuMap& operator=(ShardedRcuMap&&) = delete;
+
+    /// Returns an estimated size of the map, the shards are read at different
+    /// points in time
+    std::size_t SizeApprox() const {
+        std::size_t result = 0;
+        for (const auto& shard : shards_) result += shard.SizeApprox();
+        return result;
+    }
+
+    /// @brief Returns a readonly value pointer by its key if exists
+    /// @throws MissingKeyException if the key is not present
+    const ConstValuePtr operator[](const Key& key) const { return GetShard(key)[key]; }
+
+    /// @brief Returns a modifiable value pointer by key if exists or
+    /// default-creates one
+    /// @note Copies the shard if the key doesn't exist.
+    const ValuePtr operator[](const Key& key) { return GetShard(key)[key]; }
+
+    /// @copydoc rcu::RcuMap::Insert
+    /// @note Copies the shard if the key doesn't exist.
+    InsertReturnType Insert(const Key& key, ValuePtr value) { return GetShard(key).Insert(key, std::move(value)); }
+
+    /// @copydoc rcu::RcuMap::Emplace
+    /// @note Copies the shard if the key doesn't exist.
+    template <typename... Args>
+    InsertReturnType Emplace(const Key& key, Args&&... args) {
+        return GetShard(key).Emplace(key, std::forward<Args>(args)...);
+    }
+
+    /// @copydoc rcu::RcuMap::TryEmplace
+    template <typename... Args>
+    InsertReturnType TryEmplace(const Key& key, Args&&... args) {
+        return GetShard(key).TryEmplace(key, std::forward<Args>(args)...);
+    }
+
+    /// @brief If a key equivalent to `key` already exists in the container,
+    /// replaces the associated value. Otherwise, inserts a new pair into the map.
+    /// @note Copies the shard of the key.
+    template <typename RawKey>
+    void InsertOrAssign(RawKey&& key, ValuePtr value) {
+        auto& shard = GetShard(key);
+        shard.InsertOrAssign(std::forward<RawKey>(key), std::move(value));
+    }
+
+    /// @brief Inserts or replaces all the `items`.
+    /// @details Each affected shard is copied once and the changes of a shard
+    /// become visible to the readers at once.
+    void InsertOrAssignBatch(std::vector<std::pair<Key, ValuePtr>> items) {
+        std::array<std::vector<std::size_t>, ShardsCount> shard_items;
+        for (std::size_t i = 0; i < items.size(); ++i) {
+            shard_items[GetShardIndex(items[i].first)].push_back(i);
+        }
+
+        for (std::size_t shard_index = 0; shard_index < ShardsCount; ++shard_index) {
+            if (shard_items[shard_index].empty()) continue;
+
+            auto txn = shards_[shard_index].StartWrite();
+            for (const auto i : shard_items[shard_index]) {
+                txn->insert_or_assign(std::move(items[i].first), std::move(items[i].second));
+            }
+            txn.Commit();
+        }
+    }
+
+    /// @brief Returns a readonly value pointer by its key or an empty pointer
+    const ConstValuePtr Get(const Key& key) const { return GetShard(key).Get(key); }
+
+    /// @brief Returns a modifiable value pointer by key or an empty pointer
+    const ValuePtr Get(const Key& key) { return GetShard(key).Get(key); }
+
+    /// @brief Removes a key from the map
+    /// @returns whether the key was present
+    /// @note Copies the shard of the key.
+    bool Erase(const Key& key) { return GetShard(key).Erase(key); }
+
+    /// @brief Removes a key from the map returning its value
+    /// @returns a value if the key was present, empty pointer otherwise
+    /// @note Copies the shard of the key.
+    ValuePtr Pop(const Key& key) { return GetShard(key).Pop(key); }
+
+    /// Resets the map to an empty state
+    void Clear() {
+        for (auto& shard : shards_) shard.Clear();
+    }
+
+    /// @brief Returns a readonly copy of the map
+    /// @note The shards are read at different points in time.
+    Snapshot GetSnapshot() const {
+        Snapshot result;
+        result.reserve(SizeApprox());
+        for (const auto& shard : shards_) {
+            for (const auto& [key, value] : shard) result.emplace(key, value);
+        }
+        return result;
+    }
+
+private:
+    static std::size_t GetShardIndex(const Key& key) {
+        // Mixes the hash, otherwise with the identity std::hash of integers
+        // the keys of a shard would share the same residue
+        const auto hash = static_cast<std::uint64_t>(Hash{}(key)) * 0x9e3779b97f4a7c15ULL;
+        return static_cast<std::size_t>(hash >> 32) % ShardsCount;
+    }
+
+    Shard& GetShard(const Key& key) { return shards_[GetShardIndex(key)]; }
+    const Shard& GetShard(const Key& key) const { return shards_[GetShardIndex(key)]; }
+
+    std::array<Shard, ShardsCount> shards_;
+};
+
+}  // namespace rcu
+
+USERVER_NAMESPACE_END
@@ -74,14 +74,20 @@ namespace components {
 /// handler-defaults.deadline_propagation_enabled | when `false`, disables HTTP handler deadline propagation | true
 /// handler-defaults.deadline_expired_status_code | the HTTP status code to return if the request deadline expires | 498
 /// connection.in_buffer_size | size of the buffer to preallocate for request receive: bigger values use more RAM and less CPU | 32 * 1024
+/// connection.read_buffer_pool_size | max number of idle read buffers shared by the connections of a listener; idle keep-alive connections release their buffers while waiting for data; 0 disables the pool | 0
 /// connection.requests_queue_size_threshold | drop requests from handlers that allow throttling if there's more pending requests than allowed by this value | 100
+/// connection.pipeline_in_flight_limit | max number of pipelined HTTP/1.1 requests of a connection that are handled concurrently, responses are sent in the order of requests | 1
 /// connection.keepalive_timeout | timeout in seconds to drop connection if there's not data received from it | 600
 /// connection.stream_close_check_delay | delay in microseconds of the start of stream close check routine; do not set if not sure what it is doing | 20ms
 /// connection.http-version | the HTTP protocol version | '1.1'
 /// connection.http2-session.max_concurrent_streams | max number of concurrent open streams | 100
 /// connection.http2-session.max_frame_size | max size of the HTTP/2.0 frame | 16384
 /// connection.http2-session.initial_window_size | the initial window size of the server | 65536
+/// connection.http2-session.header_table_size | HPACK dynamic table size for the request headers, advertised to the clients | 4096
+/// connection.http2-session.max_deflate_dynamic_table_size | upper bound of the HPACK dynamic table size for the response headers | 4096
+/// connection.http2-session.index_set_cookie | whether Set-Cookie response headers are added to the HPACK dynamic table | true
 /// shards | how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing | -
+/// reuseport-cpu-steering | on Linux, steer each new TCP connection to the shard socket chosen by the CPU that received it (SO_ATTACH_REUSEPORT_CBPF) | false
 /// middleware-pipeline-builder | name of a component to build a server-wide middleware pipeline | default-server-middleware-pipeline-builder
 ///
 /// @see @ref scripts/docs/en/userver/http_server.md
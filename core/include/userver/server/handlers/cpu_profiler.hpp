@@ -0,0 +1,61 @@
+#pragma once
+
+/// @file userver/server/handlers/cpu_profiler.hpp
+/// @brief @copybrief server::handlers::CpuProfiler
+
+#include <userver/server/handlers/http_handler_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers
+///
+/// @brief Handler that profiles the CPU usage of the service.
+///
+/// The handler samples the stacktraces of the threads that consume CPU for
+/// the requested time and responds with the aggregated profile. Each sample is
+/// attributed to the tracing::Span of the task that was running, so the load
+/// of different handlers and background tasks could be told apart. Only one
+/// profiling request may run at a time, concurrent requests get HTTP 409.
+///
+/// The component has no service configuration except the
+/// @ref userver_http_handlers "common handler options".
+///
+/// ## Static configuration example:
+///
+/// @snippet components/common_server_component_list_test.cpp  Sample handler cpu profiler component config
+///
+/// ## Schema
+/// Set the URL arguments:
+/// * `seconds` - profiling duration, 10 by default, at most 300
+/// * `frequency` - samples per second of the consumed CPU time, 99 by default, at most 1000
+/// * `format` - `pprof` (default) for the `profile.proto` format understood by
+///   `pprof` with the span names in the `span` label, or `folded` for the
+///   folded stacks of `flamegraph.pl`
+///
+/// For example: `curl 'localhost:8085/service/cpu-profiler?seconds=30' -o cpu.pb && pprof -http=: cpu.pb`
+
+// clang-format on
+
+class CpuProfiler final : public HttpHandlerBase {
+public:
+    CpuProfiler(const components::ComponentConfig&, const components::ComponentContext&);
+
+    /// @ingroup userver_component_names
+    /// @brief The default name of server::handlers::CpuProfiler
+    static constexpr std::string_view kName = "handler-cpu-profiler";
+
+    std::string HandleRequestThrow(const http::HttpRequest&, request::RequestContext&) const override;
+
+    static yaml_config::Schema GetStaticConfigSchema();
+};
+
+}  // namespace server::handlers
+
+template <>
+inline constexpr bool components::kHasValidate<server::handlers::CpuProfiler> = true;
+
+USERVER_NAMESPACE_END
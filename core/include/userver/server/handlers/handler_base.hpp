@@ -37,11 +37,13 @@ namespace server::handlers {
 /// request_headers_size_log_limit | limit on the total length of logged headers | 512
 /// response_data_size_log_limit | trim responses to this size before logging | 512
 /// max_requests_per_second | integer to limit RPS to this handler | <no limit>
+/// adaptive-concurrency-limit | limit pending requests to this handler by the gradient of their timings, see congestion_control::v2::GradientController; options `enabled`, `fake-mode`, `min-limit`, `max-limit`, `rtt-tolerance`, `smoothing`, `min-requests` | <no limit>
 /// decompress_request | allow decompression of the requests | true
 /// throttling_enabled | allow throttling of the requests by components::Server , for more info see its `max_response_size_in_flight` and `requests_queue_size_threshold` options | true
 /// set-response-server-hostname | set to true to add the `X-YaTaxi-Server-Hostname` header with instance name, set to false to not add the header | <takes the value from components::Server config>
 /// monitor-handler | Overrides the in-code `is_monitor` flag that makes the handler run either on `server.listener` or on `server.listener-monitor` | --
 /// set_tracing_headers | whether to set http tracing headers (X-YaTraceId, X-YaSpanId, X-RequestId) | true
+/// access-log-stage-timings | add the time of each server::http::RequestStage in microseconds to the access_tskv log as `stage_<name>_us` fields | false
 /// deadline_propagation_enabled | when `false`, disables HTTP handler @ref scripts/docs/en/userver/deadline_propagation.md "deadline propagation" | true
 /// deadline_expired_status_code | the HTTP status code to return if the request @ref scripts/docs/en/userver/deadline_propagation.md "deadline expires" | 498
 
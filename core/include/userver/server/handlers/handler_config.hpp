@@ -5,6 +5,7 @@
 #include <variant>
 #include <vector>
 
+#include <userver/congestion_control/controllers/gradient_config.hpp>
 #include <userver/server/handlers/auth/handler_auth_config.hpp>
 #include <userver/server/handlers/fallback_handlers.hpp>
 #include <userver/server/http/http_status.hpp>
@@ -38,11 +39,13 @@ struct HandlerConfig {
     UrlTrailingSlashOption url_trailing_slash{UrlTrailingSlashOption::kDefault};
     std::optional<size_t> max_requests_in_flight;
     std::optional<size_t> max_requests_per_second;
+    std::optional<USERVER_NAMESPACE::congestion_control::v2::GradientConfig> adaptive_concurrency_limit;
     bool decompress_request{true};
     bool throttling_enabled{true};
     bool response_body_stream{false};
     std::optional<bool> set_response_server_hostname;
     bool set_tracing_headers{true};
+    bool access_log_stage_timings{false};
     bool deadline_propagation_enabled{true};
     http::HttpStatus deadline_expired_status_code{498};
 };
@@ -8,6 +8,7 @@
 #include <flatbuffers/flatbuffers.h>
 
 #include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/server/handlers/impl/flatbuf.hpp>
 #include <userver/server/http/http_error.hpp>
 #include <userver/utils/log.hpp>
 #include <userver/yaml_config/schema.hpp>
@@ -33,6 +34,10 @@ inline constexpr std::string_view kFlatbufResponseDataName = "__response_flatbuf
 /// ## Example usage:
 ///
 /// @snippet samples/flatbuf_service/flatbuf_service.cpp Flatbuf service sample - component
+///
+/// The request and the response are converted to the object API types. Use
+/// server::handlers::HttpHandlerFlatbufViewBase to work with the buffers
+/// directly without the conversions.
 
 // clang-format on
 
@@ -107,10 +112,9 @@ std::string HttpHandlerFlatbufBase<InputType, ReturnType>::HandleRequestThrow(
         std::string{impl::kFlatbufResponseDataName}, HandleRequestFlatbufThrow(request, input, context)
     );
 
-    flatbuffers::FlatBufferBuilder fbb;
-    auto ret_fbb = ReturnType::Pack(fbb, &ret);
-    fbb.Finish(ret_fbb);
-    return {reinterpret_cast<const char*>(fbb.GetBufferPointer()), fbb.GetSize()};
+    impl::FlatbufResponseBuilder builder;
+    auto ret_fbb = ReturnType::Pack(builder.GetBuilder(), &ret);
+    return std::move(builder).Finish(ret_fbb);
 }
 
 template <typename InputType, typename ReturnType>
@@ -152,10 +156,8 @@ void HttpHandlerFlatbufBase<InputType, ReturnType>::ParseRequestData(
     const http::HttpRequest& request,
     request::RequestContext& context
 ) const {
-    const auto& body = request.RequestBody();
-    const auto* input_fbb = flatbuffers::GetRoot<InputType>(body.data());
-    flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(body.data()), body.size());
-    if (!input_fbb->Verify(verifier)) {
+    const auto* input_fbb = impl::GetVerifiedFlatbufRoot<InputType>(request.RequestBody());
+    if (!input_fbb) {
         throw ClientError(InternalMessage{"Invalid FlatBuffers format in request body"});
     }
 
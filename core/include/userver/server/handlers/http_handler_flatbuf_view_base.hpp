@@ -0,0 +1,169 @@
+#pragma once
+
+/// @file userver/server/handlers/http_handler_flatbuf_view_base.hpp
+/// @brief @copybrief server::handlers::HttpHandlerFlatbufViewBase
+
+#include <type_traits>
+
+#include <flatbuffers/flatbuffers.h>
+
+#include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/server/handlers/impl/flatbuf.hpp>
+#include <userver/server/http/http_error.hpp>
+#include <userver/utils/log.hpp>
+#include <userver/yaml_config/schema.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace impl {
+
+inline constexpr std::string_view kFlatbufRequestViewDataName = "__request_flatbuf_view";
+
+}  // namespace impl
+
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers userver_base_classes
+///
+/// @brief Convenient base for handlers that accept requests with body in
+/// Flatbuffer format and respond with body in Flatbuffer format without
+/// converting them to the object API types.
+///
+/// Unlike server::handlers::HttpHandlerFlatbufBase, the handler gets a
+/// verified read-only view over the request body and builds the response
+/// directly in the flatbuffers::FlatBufferBuilder whose memory becomes
+/// the response body, so neither the request nor the response is copied.
+///
+/// ## Example usage:
+///
+/// @snippet samples/flatbuf_service/flatbuf_service.cpp Flatbuf service sample - view component
+
+// clang-format on
+
+template <typename InputType, typename ReturnType>
+class HttpHandlerFlatbufViewBase : public HttpHandlerBase {
+    static_assert(
+        std::is_base_of<flatbuffers::Table, InputType>::value,
+        "Input type should be auto-generated FlatBuffers table type"
+    );
+    static_assert(
+        std::is_base_of<flatbuffers::Table, ReturnType>::value,
+        "Return type should be auto-generated FlatBuffers table type"
+    );
+
+public:
+    HttpHandlerFlatbufViewBase(
+        const components::ComponentConfig& config,
+        const components::ComponentContext& component_context
+    );
+
+    std::string HandleRequestThrow(const http::HttpRequest& request, request::RequestContext& context) const final;
+
+    /// @param input verified view over the request body, it is valid while
+    /// the request is alive
+    /// @param builder builder of the response, its buffer becomes the response
+    /// body
+    /// @returns the root of the response built in `builder`
+    virtual flatbuffers::Offset<ReturnType> HandleRequestFlatbufThrow(
+        const http::HttpRequest& request,
+        const InputType& input,
+        flatbuffers::FlatBufferBuilder& builder,
+        request::RequestContext& context
+    ) const = 0;
+
+    /// @returns A pointer to input data if it was verified successfully or
+    /// nullptr otherwise.
+    const InputType* GetInputData(const request::RequestContext& context) const;
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+protected:
+    /// Override it if you need a custom request body logging.
+    std::string GetRequestBodyForLogging(
+        const http::HttpRequest& request,
+        request::RequestContext& context,
+        const std::string& request_body
+    ) const override;
+
+    /// Override it if you need a custom response data logging.
+    std::string GetResponseDataForLogging(
+        const http::HttpRequest& request,
+        request::RequestContext& context,
+        const std::string& response_data
+    ) const override;
+
+    void ParseRequestData(const http::HttpRequest& request, request::RequestContext& context) const final;
+};
+
+template <typename InputType, typename ReturnType>
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::HttpHandlerFlatbufViewBase(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& component_context
+)
+    : HttpHandlerBase(config, component_context) {}
+
+template <typename InputType, typename ReturnType>
+std::string HttpHandlerFlatbufViewBase<InputType, ReturnType>::HandleRequestThrow(
+    const http::HttpRequest& request,
+    request::RequestContext& context
+) const {
+    const auto* input = context.GetData<const InputType*>(impl::kFlatbufRequestViewDataName);
+
+    impl::FlatbufResponseBuilder builder;
+    const auto ret_fbb = HandleRequestFlatbufThrow(request, *input, builder.GetBuilder(), context);
+    return std::move(builder).Finish(ret_fbb);
+}
+
+template <typename InputType, typename ReturnType>
+const InputType* HttpHandlerFlatbufViewBase<InputType, ReturnType>::GetInputData(
+    const request::RequestContext& context
+) const {
+    const auto* input = context.GetDataOptional<const InputType*>(impl::kFlatbufRequestViewDataName);
+    return input ? *input : nullptr;
+}
+
+template <typename InputType, typename ReturnType>
+std::string HttpHandlerFlatbufViewBase<InputType, ReturnType>::GetRequestBodyForLogging(
+    const http::HttpRequest&,
+    request::RequestContext&,
+    const std::string& request_body
+) const {
+    size_t limit = GetConfig().request_body_size_log_limit;
+    return utils::log::ToLimitedHex(request_body, limit);
+}
+
+template <typename InputType, typename ReturnType>
+std::string HttpHandlerFlatbufViewBase<InputType, ReturnType>::GetResponseDataForLogging(
+    const http::HttpRequest&,
+    request::RequestContext&,
+    const std::string& response_data
+) const {
+    size_t limit = GetConfig().response_data_size_log_limit;
+    return utils::log::ToLimitedHex(response_data, limit);
+}
+
+template <typename InputType, typename ReturnType>
+void HttpHandlerFlatbufViewBase<InputType, ReturnType>::ParseRequestData(
+    const http::HttpRequest& request,
+    request::RequestContext& context
+) const {
+    const auto* input_fbb = impl::GetVerifiedFlatbufRoot<InputType>(request.RequestBody());
+    if (!input_fbb) {
+        throw ClientError(InternalMessage{"Invalid FlatBuffers format in request body"});
+    }
+
+    context.SetData(std::string{impl::kFlatbufRequestViewDataName}, input_fbb);
+}
+
+template <typename InputType, typename ReturnType>
+yaml_config::Schema HttpHandlerFlatbufViewBase<InputType, ReturnType>::GetStaticConfigSchema() {
+    auto schema = HttpHandlerBase::GetStaticConfigSchema();
+    schema.UpdateDescription("HTTP handler flatbuf view base config");
+    return schema;
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
@@ -19,6 +19,11 @@ namespace server::handlers {
 /// @brief Handler that returns HTTP 200 if file exist
 /// and returns file data with mapped content/type
 ///
+/// Responses carry a strong ETag computed from the file contents, requests
+/// with a matching `If-None-Match` are answered with HTTP 304 without a body.
+/// With `compress: true` the gzip and zstd variants of each file are computed
+/// once, on the first request to it, and kept in memory until the file changes.
+///
 /// ## HttpHandlerStatic Dynamic config
 /// * @ref USERVER_FILES_CONTENT_TYPE_MAP
 ///
@@ -28,9 +33,11 @@ namespace server::handlers {
 /// Inherits all the options from server::handlers::HttpHandlerBase and adds the
 /// following ones:
 ///
-/// Name               | Description                   | Default value
-/// ------------------ | ----------------------------- | -------------
-/// fs-cache-component | Name of the FsCache component | fs-cache-component
+/// Name               | Description                                                  | Default value
+/// ------------------ | ------------------------------------------------------------ | -------------
+/// fs-cache-component | Name of the FsCache component                                | fs-cache-component
+/// compress           | Serve the cached gzip and zstd variants to accepting clients | false
+/// compress-min-size  | Do not compress the files that are smaller, in bytes         | 1024
 ///
 /// ## Example usage:
 ///
@@ -50,11 +57,21 @@ public:
 
     std::string HandleRequestThrow(const http::HttpRequest& request, request::RequestContext&) const override;
 
+    ~HttpHandlerStatic() override;
+
     static yaml_config::Schema GetStaticConfigSchema();
 
 private:
+    struct FileVariants;
+
+    std::shared_ptr<const FileVariants>
+    GetFileVariants(const std::string& path, const fs::FileInfoWithDataConstPtr& file) const;
+
     dynamic_config::Source config_;
     const fs::FsCacheClient& storage_;
+    const bool compress_;
+    const std::size_t compress_min_size_;
+    mutable rcu::RcuMap<std::string, const FileVariants> variants_;
 };
 
 }  // namespace server::handlers
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include <flatbuffers/flatbuffers.h>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers::impl {
+
+/// @returns the root table of the FlatBuffers buffer that points into `data`
+/// or nullptr if the buffer is malformed.
+template <typename Table>
+const Table* GetVerifiedFlatbufRoot(std::string_view data) {
+    flatbuffers::Verifier verifier(reinterpret_cast<const std::uint8_t*>(data.data()), data.size());
+    if (!verifier.VerifyBuffer<Table>(nullptr)) return nullptr;
+    return flatbuffers::GetRoot<Table>(data.data());
+}
+
+/// Allocates the memory of flatbuffers::FlatBufferBuilder in a std::string, so
+/// that the finished buffer becomes the response body without a copy.
+class FlatbufStringAllocator final : public flatbuffers::Allocator {
+public:
+    std::uint8_t* allocate(std::size_t size) override {
+        UASSERT(buffer_.empty());
+        buffer_.resize(size);
+        return Data();
+    }
+
+    // the memory is owned by the buffer
+    void deallocate(std::uint8_t*, std::size_t) override {}
+
+    std::uint8_t* reallocate_downward(
+        std::uint8_t* old_p,
+        std::size_t old_size,
+        std::size_t new_size,
+        std::size_t in_use_back,
+        std::size_t in_use_front
+    ) override {
+        UASSERT(old_p == Data());
+        UASSERT(old_size == buffer_.size());
+        UASSERT(new_size > old_size);
+        UASSERT(in_use_back + in_use_front <= old_size);
+        static_cast<void>(old_p);
+        static_cast<void>(in_use_front);
+
+        // the scratch data at the front stays in place, the built data is
+        // moved to the back
+        buffer_.resize(new_size);
+        std::memmove(Data() + new_size - in_use_back, Data() + old_size - in_use_back, in_use_back);
+        return Data();
+    }
+
+    /// @returns the finished buffer, the builder must not be used afterwards
+    std::string Extract(const flatbuffers::FlatBufferBuilder& fbb) && {
+        const auto* data = fbb.GetBufferPointer();
+        UASSERT(data >= Data() && data + fbb.GetSize() == Data() + buffer_.size());
+
+        // the data is built downward and is at the back of the buffer, moving
+        // it to the front does not allocate
+        buffer_.erase(0, data - Data());
+        return std::move(buffer_);
+    }
+
+private:
+    std::uint8_t* Data() { return reinterpret_cast<std::uint8_t*>(buffer_.data()); }
+
+    std::string buffer_;
+};
+
+/// flatbuffers::FlatBufferBuilder that builds the response body in place
+class FlatbufResponseBuilder final {
+public:
+    FlatbufResponseBuilder() = default;
+    FlatbufResponseBuilder(const FlatbufResponseBuilder&) = delete;
+    FlatbufResponseBuilder& operator=(const FlatbufResponseBuilder&) = delete;
+
+    flatbuffers::FlatBufferBuilder& GetBuilder() { return fbb_; }
+
+    /// @returns the buffer finished with `root`
+    template <typename Table>
+    std::string Finish(flatbuffers::Offset<Table> root) && {
+        fbb_.Finish(root);
+        return std::move(allocator_).Extract(fbb_);
+    }
+
+private:
+    static constexpr std::size_t kInitialSize = 1024;
+
+    FlatbufStringAllocator allocator_;
+    flatbuffers::FlatBufferBuilder fbb_{kInitialSize, &allocator_};
+};
+
+}  // namespace server::handlers::impl
+
+USERVER_NAMESPACE_END
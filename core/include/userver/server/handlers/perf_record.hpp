@@ -0,0 +1,85 @@
+#pragma once
+
+/// @file userver/server/handlers/perf_record.hpp
+/// @brief @copybrief server::handlers::PerfRecord
+
+#include <atomic>
+#include <string>
+
+#include <userver/engine/subprocess/process_starter.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/server/handlers/http_handler_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers
+///
+/// @brief Handler that records a `perf.data` profile of the running service
+/// for the sample-based PGO and BOLT.
+///
+/// The handler runs `perf record` attached to the current process for the
+/// requested time and responds with the resulting `perf.data`. Unlike the
+/// instrumented builds of `USERVER_PGO_GENERATE` the sampling has a negligible
+/// overhead, so the profile could be taken from the production under the real
+/// load. Convert the profile with `perf2bolt` for the `USERVER_BOLT_PROFILE`
+/// or with `llvm-profgen`/`create_gcov` for the `USERVER_PGO_SAMPLE_USE` CMake
+/// options, see @ref scripts/docs/en/userver/build/build.md.
+///
+/// Requires the `perf` tool on the host, the `process-starter` component and
+/// the permissions to profile the process (see `perf_event_paranoid`). Only
+/// one recording may run at a time, concurrent requests get HTTP 409.
+///
+/// ## Static options:
+/// Inherits all the options from server::handlers::HttpHandlerBase and adds the following ones:
+///
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// perf-path | path to the `perf` executable, searched in `PATH` if it has no `/` | `perf`
+/// event | the sampled perf event | `cycles:u`
+/// fs-task-processor | task processor for the blocking filesystem operations | `fs-task-processor`
+///
+/// ## Static configuration example:
+///
+/// @snippet components/common_server_component_list_test.cpp  Sample handler perf record component config
+///
+/// ## Schema
+/// Set the URL arguments:
+/// * `seconds` - recording duration, 10 by default, at most 300
+/// * `branches` - `1` (default) to record the last branch records (LBR) that
+///   give the most precise profiles for BOLT and AutoFDO, `0` for the CPUs and
+///   virtual machines without LBR
+///
+/// For example: `curl 'localhost:8085/service/perf-record?seconds=60' -o perf.data`
+
+// clang-format on
+
+class PerfRecord final : public HttpHandlerBase {
+public:
+    PerfRecord(const components::ComponentConfig&, const components::ComponentContext&);
+
+    /// @ingroup userver_component_names
+    /// @brief The default name of server::handlers::PerfRecord
+    static constexpr std::string_view kName = "handler-perf-record";
+
+    std::string HandleRequestThrow(const http::HttpRequest&, request::RequestContext&) const override;
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    engine::subprocess::ProcessStarter& process_starter_;
+    engine::TaskProcessor& fs_task_processor_;
+    const std::string perf_path_;
+    const std::string event_;
+    mutable std::atomic<bool> is_recording_{false};
+};
+
+}  // namespace server::handlers
+
+template <>
+inline constexpr bool components::kHasValidate<server::handlers::PerfRecord> = true;
+
+USERVER_NAMESPACE_END
@@ -3,6 +3,8 @@
 /// @file userver/server/handlers/server_monitor.hpp
 /// @brief @copybrief server::handlers::ServerMonitor
 
+#include <memory>
+
 #include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/utils/statistics/fwd.hpp>
 
@@ -14,6 +16,14 @@ namespace impl {
 enum class StatsFormat;
 }
 
+}  // namespace server::handlers
+
+namespace utils::statistics::impl {
+class SerializationCache;
+}  // namespace utils::statistics::impl
+
+namespace server::handlers {
+
 // clang-format off
 
 /// @ingroup userver_components userver_http_handlers
@@ -30,6 +40,13 @@ enum class StatsFormat;
 ///   utils::statistics::ToPrometheusFormatUntyped, utils::statistics::ToGraphiteFormat, utils::statistics::ToJsonFormat,
 ///   utils::statistics::ToSolomonFormat, utils::statistics::ToPrettyFormat.
 ///
+/// Serialization of all the metrics of a big service may take considerable
+/// CPU time, so the handler should run on a separate task processor (see the
+/// `task_processor` option in the example below) to not compete with the
+/// request handling. With the 'cache-max-age' option the serialized response
+/// is reused for the requests with the same arguments during the specified
+/// time, e.g. when several Prometheus replicas scrape the same service.
+///
 /// ## Static configuration example:
 ///
 /// @snippet components/common_server_component_list_test.cpp  Sample handler server monitor component config
@@ -48,6 +65,7 @@ enum class StatsFormat;
 class ServerMonitor final : public HttpHandlerBase {
 public:
     ServerMonitor(const components::ComponentConfig& config, const components::ComponentContext& component_context);
+    ~ServerMonitor() override;
 
     /// @ingroup userver_component_names
     /// @brief The default name of server::handlers::ServerMonitor
@@ -64,11 +82,14 @@ private:
         const std::string& response_data
     ) const override;
 
+    std::string Serialize(impl::StatsFormat format, const utils::statistics::Request& statistics_request) const;
+
     utils::statistics::Storage& statistics_storage_;
 
     using CommonLabels = std::unordered_map<std::string, std::string>;
     const CommonLabels common_labels_;
     const std::optional<impl::StatsFormat> default_format_;
+    const std::unique_ptr<utils::statistics::impl::SerializationCache> cache_;
 };
 
 }  // namespace server::handlers
@@ -3,8 +3,11 @@
 /// @file userver/server/http/http_request.hpp
 /// @brief @copybrief server::http::HttpRequest
 
+#include <array>
 #include <chrono>
+#include <cstddef>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <userver/engine/task/task_processor_fwd.hpp>
@@ -28,6 +31,31 @@ class HttpHandlerBase;
 /// Server parts of the HTTP protocol implementation.
 namespace server::http {
 
+/// @brief Consecutive stages of the request processing, timed by
+/// HttpRequest::GetStageTimings()
+///
+/// Per-handler histograms of the stages are reported in the
+/// `http.stage-timings-us` metric with the `http_request_stage` label. Set
+/// the `access-log-stage-timings` static option of the handler to also write
+/// them into the access_tskv log.
+enum class RequestStage {
+    kParse,         ///< from the first byte of the request to the task creation
+    kQueue,         ///< waiting for a free worker of the handler task processor
+    kMiddlewares,   ///< middlewares before and after the handler
+    kHandler,       ///< the handler itself, including the response body formatting
+    kResponseWait,  ///< waiting for the previous responses on the connection
+    kSerialize,     ///< formatting the status line and headers (HTTP/1.x only)
+    kSend,          ///< writing the response into the socket
+};
+
+inline constexpr std::size_t kRequestStagesCount = static_cast<std::size_t>(RequestStage::kSend) + 1;
+
+/// Durations of each RequestStage, indexed by the stage
+using RequestStageTimings = std::array<std::chrono::microseconds, kRequestStagesCount>;
+
+/// @returns short name of the stage, e.g. "parse"
+std::string_view ToString(RequestStage stage) noexcept;
+
 /// @brief HTTP Request data.
 /// @note do not create HttpRequest by hand in tests,
 ///       use HttpRequestBuilder instead.
@@ -231,6 +259,13 @@ public:
     /// Get approximate time point of request handling start
     std::chrono::steady_clock::time_point GetStartTime() const;
 
+    /// @brief Get the time spent in each RequestStage.
+    ///
+    /// Stages that were skipped, e.g. the handler for a throttled request, or
+    /// have not happened yet take zero time. All the stages are known only
+    /// after the response is sent.
+    RequestStageTimings GetStageTimings() const;
+
     /// @cond
     void MarkAsInternalServerError() const;
 
@@ -283,12 +318,17 @@ private:
     void SetTaskStartTime();
     void SetResponseNotifyTime();
     void SetResponseNotifyTime(std::chrono::steady_clock::time_point now);
+    void SetHandlerStartTime();
+    void SetHandlerFinishTime();
+    void SetResponseSerializedTime() const;
 
     friend class HttpRequestBuilder;
     friend class HttpRequestHandler;
+    friend class HttpResponse;
+    friend class handlers::HttpHandlerBase;
 
     struct Impl;
-    utils::FastPimpl<Impl, 1648, 16> pimpl_;
+    utils::FastPimpl<Impl, 1680, 16> pimpl_;
 };
 
 }  // namespace server::http
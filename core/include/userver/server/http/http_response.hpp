@@ -4,6 +4,7 @@
 /// @brief @copybrief server::http::HttpResponse
 
 #include <chrono>
+#include <memory>
 #include <string>
 #include <variant>
 
@@ -31,9 +32,12 @@ namespace server::http {
 inline constexpr std::string_view kDefaultContentType = "application/octet-stream";
 
 class Http2ResponseWriter;
+class ResponseBodyStream;
 
 namespace impl {
 
+class ResponseBodyCompressor;
+
 void OutputHeader(USERVER_NAMESPACE::http::headers::HeadersString& header, std::string_view key, std::string_view val);
 
 }  // namespace impl
@@ -144,8 +148,15 @@ public:
     // Can be called only once
     Producer GetBodyProducer();
 
+    /// @cond
+    // For internal use only. The compressor is applied to the chunks pushed
+    // via ResponseBodyStream if the handler does not set Content-Encoding.
+    void SetBodyStreamCompressor(std::unique_ptr<impl::ResponseBodyCompressor> compressor);
+    /// @endcond
+
 private:
     friend class Http2ResponseWriter;
+    friend class ResponseBodyStream;
 
     // Returns total size of the response
     std::size_t SetBodyStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header);
@@ -160,7 +171,9 @@ private:
 
     engine::SingleConsumerEvent headers_end_{engine::SingleConsumerEvent::NoAutoReset()};
     std::optional<Queue::Consumer> body_stream_;
+    std::shared_ptr<Queue> body_queue_;
     Producer body_stream_producer_;
+    std::unique_ptr<impl::ResponseBodyCompressor> body_stream_compressor_;
     bool is_stream_body_{false};
 };
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 
 #include <userver/server/http/http_response.hpp>
@@ -20,8 +21,15 @@ public:
 
     // Send a chunk of response data. It may NOT generate
     // exactly one HTTP chunk per call to PushBodyChunk().
+    // Waits for the client to read the data if more than
+    // SetMaxBufferedSize() bytes are not sent yet.
     void PushBodyChunk(std::string&& chunk, engine::Deadline deadline);
 
+    // Limits the amount of the pushed but not yet sent response data, which
+    // is unlimited by default. Bigger chunks are split. Has no effect on
+    // HTTP/2 streams.
+    void SetMaxBufferedSize(std::size_t max_size);
+
     void SetHeader(const std::string&, const std::string&);
 
     void SetHeader(std::string_view, const std::string&);
@@ -37,7 +45,12 @@ private:
 
     ResponseBodyStream(HttpResponse::Producer&& queue_producer, HttpResponse& http_response);
 
+    bool PushChunk(std::string&& chunk, engine::Deadline deadline);
+
+    void FinishCompression() noexcept;
+
     bool headers_ended_{false};
+    std::size_t max_buffered_size_{0};
     HttpResponse::Producer queue_producer_;
     HttpResponse& http_response_;
 };
@@ -0,0 +1,89 @@
+#pragma once
+
+/// @file userver/server/http/json_array_response_writer.hpp
+/// @brief @copybrief server::http::JsonArrayResponseWriter
+
+#include <cstddef>
+#include <optional>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/server/http/http_response_body_stream_fwd.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+/// @brief Writes a JSON array into the server::http::ResponseBodyStream item
+/// by item.
+///
+/// The items are serialized via WriteToStream into a
+/// formats::json::StringBuilder, and the output is pushed into the stream
+/// each time it grows above `chunk_size` bytes. The whole response is never
+/// kept in memory: on HTTP/1.1 connections at most `max_buffered_size` bytes
+/// wait to be sent, and Write() waits for the client if it reads slower than
+/// the items are produced.
+///
+/// The headers should be ended via ResponseBodyStream::SetEndOfHeaders()
+/// before the first item is written.
+///
+/// ## Example usage:
+///
+/// @code
+/// void HandleStreamRequest(server::http::HttpRequest&, server::request::RequestContext&,
+///                          server::http::ResponseBodyStream& stream) const override {
+///     stream.SetHeader(http::headers::kContentType, "application/json");
+///     stream.SetEndOfHeaders();
+///
+///     server::http::JsonArrayResponseWriter writer{stream};
+///     for (const auto& item : storage.Items()) writer.Write(item);
+///     writer.Finish();
+/// }
+/// @endcode
+class JsonArrayResponseWriter final {
+public:
+    struct Settings {
+        /// Output is pushed into the stream in chunks of about this size
+        std::size_t chunk_size{64 * 1024};
+
+        /// Limit for the pushed but not yet sent data, see
+        /// ResponseBodyStream::SetMaxBufferedSize()
+        std::size_t max_buffered_size{1024 * 1024};
+    };
+
+    /// Starts the array
+    explicit JsonArrayResponseWriter(ResponseBodyStream& stream, engine::Deadline deadline = {});
+    JsonArrayResponseWriter(ResponseBodyStream& stream, engine::Deadline deadline, Settings settings);
+
+    JsonArrayResponseWriter(JsonArrayResponseWriter&&) = delete;
+    JsonArrayResponseWriter& operator=(JsonArrayResponseWriter&&) = delete;
+
+    /// Does not push anything, the response body is an incomplete JSON if
+    /// Finish() was not called
+    ~JsonArrayResponseWriter();
+
+    /// Writes the item as the next array element via WriteToStream
+    template <typename T>
+    void Write(const T& item) {
+        UASSERT_MSG(array_guard_.has_value(), "Write() is called after Finish()");
+        WriteToStream(item, builder_);
+        if (builder_.GetStringView().size() >= settings_.chunk_size) Flush();
+    }
+
+    /// Ends the array and pushes the rest of the output into the stream
+    void Finish();
+
+private:
+    void Flush();
+
+    ResponseBodyStream& stream_;
+    const engine::Deadline deadline_;
+    const Settings settings_;
+    formats::json::StringBuilder builder_;
+    std::optional<formats::json::StringBuilder::ArrayGuard> array_guard_;
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
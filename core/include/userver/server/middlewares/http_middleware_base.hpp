@@ -40,6 +40,11 @@ protected:
     /// @brief The method to invoke the next middleware in a pipeline
     void Next(http::HttpRequest& request, request::RequestContext& context) const;
 
+    /// @brief Override this method to return `true` if the middleware does
+    /// nothing for the handler it was created for. Such middlewares are left
+    /// out of the handler pipeline and cost nothing per request.
+    virtual bool IsPassThrough() const noexcept { return false; }
+
 private:
     friend class handlers::HttpHandlerBase;
 
@@ -0,0 +1,147 @@
+#pragma once
+
+/// @file userver/server/websocket/broadcast_group.hpp
+/// @brief @copybrief server::websocket::BroadcastGroup
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include <userver/engine/shared_mutex.hpp>
+#include <userver/server/websocket/server.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket {
+
+/// @brief What BroadcastGroup does with a connection that does not keep up
+/// with the published messages
+enum class SlowConsumerPolicy {
+    /// The messages that do not fit into the send queue of the connection are
+    /// not sent to it
+    kDropMessages,
+
+    /// The connection is closed with CloseStatus::kPolicyViolation
+    kDisconnect,
+};
+
+/// @brief Settings of server::websocket::BroadcastGroup
+struct BroadcastSettings final {
+    /// Options the messages are encoded with, usually
+    /// WebsocketHandlerBase::GetConfig() of the handler of the connections
+    Config config{};
+
+    /// Maximum number of messages waiting to be sent to a connection
+    std::size_t max_queued_messages{100};
+
+    SlowConsumerPolicy slow_consumer_policy{SlowConsumerPolicy::kDropMessages};
+};
+
+/// @brief Statistics of server::websocket::BroadcastGroup
+struct BroadcastStatistics final {
+    std::atomic<std::int64_t> messages_published{0};
+    std::atomic<std::int64_t> messages_queued{0};
+    std::atomic<std::int64_t> messages_dropped{0};
+    std::atomic<std::int64_t> connections_dropped{0};
+};
+
+namespace impl {
+class BroadcastSubscriber;
+}  // namespace impl
+
+// clang-format off
+
+/// @brief Sends the same messages to many WebSocket connections.
+///
+/// BroadcastGroup::Publish encodes a message into frames once (and compresses
+/// it once, see server::websocket::PreparedMessage) and puts a reference to the
+/// shared frames into the send queue of each connection of the group. Every
+/// connection has a writer task that sends the queued messages, so a slow
+/// client does not delay the others; the group applies the
+/// `slow_consumer_policy` to the connections with a full send queue.
+///
+/// A connection joins the group for the lifetime of the returned
+/// BroadcastGroup::Subscription, which must not outlive the connection.
+/// The connection may still be used to send its own messages.
+///
+/// The class is thread-safe.
+///
+/// ## Example usage:
+///
+/// @code
+/// void Handle(server::websocket::WebSocketConnection& chat, server::request::RequestContext&) const override {
+///     const auto subscription = group_.Join(chat);
+///     server::websocket::Message message;
+///     while (!engine::current_task::ShouldCancel()) {
+///         chat.Recv(message);
+///         if (message.close_status) break;
+///         group_.Publish(message.data, message.is_text);
+///     }
+/// }
+/// @endcode
+
+// clang-format on
+
+class BroadcastGroup final {
+public:
+    /// @brief Membership of a connection in the group, the connection leaves
+    /// the group on destruction
+    class Subscription final {
+    public:
+        Subscription(Subscription&&) noexcept;
+        Subscription& operator=(Subscription&&) noexcept;
+        ~Subscription();
+
+        /// @brief Leave the group, waits for the writer task of the connection
+        void Leave() noexcept;
+
+    private:
+        friend class BroadcastGroup;
+
+        Subscription(BroadcastGroup& group, std::shared_ptr<impl::BroadcastSubscriber> subscriber);
+
+        BroadcastGroup* group_;
+        std::shared_ptr<impl::BroadcastSubscriber> subscriber_;
+    };
+
+    explicit BroadcastGroup(BroadcastSettings settings = {});
+
+    BroadcastGroup(const BroadcastGroup&) = delete;
+    BroadcastGroup& operator=(const BroadcastGroup&) = delete;
+
+    ~BroadcastGroup();
+
+    /// @brief Add the connection to the group and start its writer task
+    [[nodiscard]] Subscription Join(WebSocketConnection& connection);
+
+    /// @brief Encode the message once and queue it to all the connections of
+    /// the group, does not wait for the messages to be sent
+    void Publish(std::string_view data, bool is_text);
+
+    /// @brief Queue a message encoded in advance to all the connections of the
+    /// group
+    void Publish(std::shared_ptr<const PreparedMessage> message);
+
+    std::size_t GetConnectionsCount() const;
+
+    const BroadcastStatistics& GetStatistics() const { return stats_; }
+
+private:
+    void Leave(const std::shared_ptr<impl::BroadcastSubscriber>& subscriber) noexcept;
+
+    const BroadcastSettings settings_;
+
+    mutable engine::SharedMutex mutex_;
+    std::vector<std::shared_ptr<impl::BroadcastSubscriber>> subscribers_;
+
+    BroadcastStatistics stats_;
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const BroadcastGroup& group);
+
+}  // namespace server::websocket
+
+USERVER_NAMESPACE_END
@@ -5,6 +5,8 @@
 
 #include <memory>
 #include <optional>
+#include <string>
+#include <string_view>
 
 #include <userver/engine/io/socket.hpp>
 #include <userver/server/http/http_request.hpp>
@@ -48,15 +50,55 @@ class WebSocketConnectionImpl;
 struct Config final {
     unsigned max_remote_payload = 65536;
     unsigned fragment_size = 65536;  // 0 - do not fragment
+
+    /// Accept the permessage-deflate extension (RFC 7692) if the client offers it
+    bool permessage_deflate = false;
+    /// Do not keep the compression context between the sent messages
+    bool server_no_context_takeover = false;
+    /// Ask the client not to keep the compression context between its messages
+    bool client_no_context_takeover = false;
+    /// zlib compression level, 1 (fastest) to 9 (best compression)
+    int deflate_level = 6;
+    /// Messages shorter than that are sent uncompressed
+    unsigned deflate_min_size = 128;
 };
 
 Config Parse(const yaml_config::YamlConfig&, formats::parse::To<Config>);
 
+/// @brief WebSocket message encoded into frames once, to be sent to many
+/// connections without encoding and compressing it for each of them.
+///
+/// @see server::websocket::BroadcastGroup
+class PreparedMessage final {
+public:
+    /// @brief Encodes the message with the `fragment_size` of the config. If
+    /// `permessage_deflate` is set and the message is not shorter than
+    /// `deflate_min_size`, the compressed frames are prepared as well.
+    PreparedMessage(std::string_view data, bool is_text, const Config& config);
+
+    /// @cond
+    const std::string& GetFrames() const { return frames_; }
+
+    // Compressed without the context of other messages, only usable for the
+    // connections with server_no_context_takeover. Empty if not prepared.
+    const std::string& GetCompressedFrames() const { return compressed_frames_; }
+
+    std::size_t GetPayloadSize() const { return payload_size_; }
+    /// @endcond
+
+private:
+    std::string frames_;
+    std::string compressed_frames_;
+    std::size_t payload_size_;
+};
+
 struct Statistics final {
     std::atomic<int64_t> msg_sent{0};
     std::atomic<int64_t> msg_recv{0};
     std::atomic<int64_t> bytes_sent{0};
     std::atomic<int64_t> bytes_recv{0};
+    std::atomic<int64_t> msg_sent_compressed{0};
+    std::atomic<int64_t> msg_recv_compressed{0};
 };
 
 /// @brief Main class for Websocket connection
@@ -97,6 +139,12 @@ public:
     virtual void Send(const Message& message) = 0;
     virtual void SendText(std::string_view message) = 0;
 
+    /// @brief Send a message encoded in advance.
+    /// @throws engine::io::IoException in case of socket errors
+    /// @note Unlike Send(), it is safe to call SendPrepared() concurrently with
+    /// any other method, the frames of different messages are not interleaved.
+    virtual void SendPrepared(const PreparedMessage& message) = 0;
+
     template <typename ContiguousContainer>
     void SendBinary(const ContiguousContainer& message) {
         static_assert(
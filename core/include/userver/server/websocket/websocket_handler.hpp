@@ -28,6 +28,16 @@ namespace server::websocket {
 /// status-codes-log-level | map of "status": log_level items to override span log level for specific status codes | {}
 /// max-remote-payload | max remote payload size | 65536
 /// fragment-size | max output fragment size | 65536
+/// permessage-deflate | accept the permessage-deflate compression extension (RFC 7692) if the client offers it | false
+/// server-no-context-takeover | do not keep the compression context between the sent messages | false
+/// client-no-context-takeover | ask the client not to keep the compression context between its messages | false
+/// deflate-level | compression level of the sent messages, from 1 (fastest) to 9 (best compression) | 6
+/// deflate-min-size | messages shorter than that are sent uncompressed | 128
+///
+/// With permessage-deflate each connection that keeps the compression context
+/// holds about 300KiB of zlib state. With `server-no-context-takeover` and
+/// `client-no-context-takeover` the connections of a thread share the zlib
+/// streams, at the cost of a worse compression ratio of similar messages.
 ///
 /// ## Example usage:
 ///
@@ -49,6 +59,10 @@ public:
         return true;
     }
 
+    /// @brief Options of the connections of the handler, e.g. to prepare the
+    /// messages for them with server::websocket::PreparedMessage
+    const Config& GetConfig() const { return config_; }
+
     /// @cond
     void WriteMetrics(utils::statistics::Writer& writer) const;
 
@@ -23,6 +23,8 @@ class SpanBuilder;
 /// the parent tracing::Spans and stores that info in the log.
 ///
 /// Logging of spans can be controlled at runtime via @ref USERVER_NO_LOG_SPANS.
+/// With @ref USERVER_TRACING_TAIL_SAMPLING the spans are logged only for the
+/// traces that turn out to be slow or erroneous.
 ///
 /// See @ref scripts/docs/en/userver/logging.md for usage examples and more
 /// descriptions.
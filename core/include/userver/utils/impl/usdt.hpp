@@ -0,0 +1,37 @@
+#pragma once
+
+/// @file userver/utils/impl/usdt.hpp
+/// @brief USDT static tracepoints for bpftrace, perf and other tools.
+///
+/// Each probe compiles into a single `nop` and a note in the `.note.stapsdt`
+/// ELF section, so it costs nothing until a tracer attaches to it. The
+/// arguments are still evaluated, keep them cheap: integers, pointers and
+/// pointers to the already available strings.
+///
+/// Probes are provided by the `USERVER_FEATURE_USDT` CMake option, see
+/// @ref scripts/docs/en/userver/usdt.md for the list of the probes and their
+/// arguments.
+
+#ifdef USERVER_FEATURE_USDT_ENABLED
+#include <sys/sdt.h>
+
+/// @brief Fires the `userver:<name>` USDT probe with up to 12 integer or
+/// pointer arguments.
+#define USERVER_IMPL_USDT(name, ...) STAP_PROBEV(userver, name, __VA_ARGS__)
+#else
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::impl {
+
+// Never called, only keeps the arguments of the disabled probes referenced
+template <typename... Args>
+int UsdtDiscard(const Args&...) noexcept;
+
+}  // namespace utils::impl
+
+USERVER_NAMESPACE_END
+
+#define USERVER_IMPL_USDT(name, ...) \
+    static_cast<void>(sizeof(USERVER_NAMESPACE::utils::impl::UsdtDiscard(__VA_ARGS__)))
+#endif
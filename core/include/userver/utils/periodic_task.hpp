@@ -14,6 +14,8 @@
 #include <userver/rcu/rcu.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/flags.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
 
 // TODO remove extra include
 #include <userver/engine/condition_variable.hpp>
@@ -40,6 +42,10 @@ namespace utils {
 ///
 /// TaskProcessor to execute the callback and many other options are specified
 /// in PeriodicTask::Settings.
+///
+/// Services with many periodic tasks may set
+/// PeriodicTask::Settings::coalescing_slack to wake the tasks up together on
+/// shared timer ticks.
 class PeriodicTask final {
 public:
     enum class Flags {
@@ -124,6 +130,27 @@ public:
         /// PeriodicTask::Start() calls engine::current_task::GetTaskProcessor()
         /// to get the TaskProcessor.
         engine::TaskProcessor* task_processor{nullptr};
+
+        /// @brief If set, each wakeup of the task is delayed by less than
+        /// `coalescing_slack` to the nearest tick of a process-wide grid with
+        /// the `coalescing_slack` step. The tasks with the same slack (or with
+        /// slacks that are multiples of each other) wake up together on the
+        /// common ticks instead of on many independent timers.
+        ///
+        /// The grid is shifted by a random phase chosen once per process, so
+        /// the instances of a service started at the same time do not wake up
+        /// synchronously.
+        std::chrono::milliseconds coalescing_slack{0};
+    };
+
+    /// Statistics of the wakeups of PeriodicTask for the next iteration
+    struct Statistics final {
+        /// Number of the wakeups by the period expiration
+        utils::statistics::RateCounter wakeups;
+
+        /// Total delay of the wakeups after the planned time in microseconds,
+        /// including the coalescing delay
+        utils::statistics::RateCounter lateness_us;
     };
 
     /// Signature of the task to be executed each period.
@@ -203,6 +230,9 @@ public:
     /// Get current settings. Note that they might become stale very quickly.
     Settings GetCurrentSettings() const;
 
+    /// Get the wakeup statistics
+    const Statistics& GetStatistics() const noexcept { return statistics_; }
+
 private:
     enum class SuspendState { kRunning, kSuspended };
 
@@ -218,6 +248,9 @@ private:
 
     std::chrono::milliseconds MutatePeriod(std::chrono::milliseconds period);
 
+    std::chrono::steady_clock::time_point
+    PlanWakeup(std::chrono::steady_clock::time_point start, std::chrono::milliseconds period);
+
     std::string_view GetName() const noexcept;
 
     std::string name_;
@@ -228,6 +261,7 @@ private:
     engine::SingleConsumerEvent changed_event_;
     std::atomic<bool> should_force_step_{false};
     std::optional<std::minstd_rand> mutate_period_random_;
+    Statistics statistics_;
 
     // For kNow only
     engine::Mutex step_mutex_;
@@ -236,6 +270,8 @@ private:
     std::optional<USERVER_NAMESPACE::testsuite::PeriodicTaskRegistrationHolder> registration_holder_;
 };
 
+void DumpMetric(utils::statistics::Writer& writer, const PeriodicTask::Statistics& stats);
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
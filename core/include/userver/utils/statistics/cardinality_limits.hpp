@@ -0,0 +1,43 @@
+#pragma once
+
+/// @file userver/utils/statistics/cardinality_limits.hpp
+/// @brief @copybrief utils::statistics::CardinalityLimits
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <userver/formats/json_fwd.hpp>
+#include <userver/formats/parse/to.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+/// The value of the labels of the series that did not fit into the limit
+inline constexpr std::string_view kCardinalityOverflowLabelValue = "__other__";
+
+/// @brief Limits of the number of series written to utils::statistics::Storage
+/// per metric prefix.
+///
+/// When a writer produces more distinct series (metric path + labels) under a
+/// limited prefix than allowed, the extra series are not written as is: they
+/// are aggregated into a single series per metric path, with the values of all
+/// their labels replaced by "__other__". Integer, floating-point and Rate
+/// values are summed up, histograms are merged.
+///
+/// The labels of utils::statistics::Request::add_labels are kept intact.
+///
+/// Usually set via the @ref USERVER_METRICS_CARDINALITY_LIMITS dynamic config.
+struct CardinalityLimits final {
+    /// Maximum number of series for the metrics with the path equal to the
+    /// key or starting with the key followed by '.'
+    std::unordered_map<std::string, std::size_t> max_series_by_prefix;
+};
+
+CardinalityLimits Parse(const formats::json::Value& value, formats::parse::To<CardinalityLimits>);
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
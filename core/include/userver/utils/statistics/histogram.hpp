@@ -58,6 +58,11 @@ struct BoundsBlock;
 /// Histogram metrics can be summed using
 /// utils::statistics::HistogramAggregator.
 ///
+/// For histograms that are accounted into from many threads at a high rate,
+/// consider utils::statistics::StripedHistogram. For integer values with
+/// unknown range, e.g. timings, utils::statistics::LogLinearHistogram needs no
+/// bounds and keeps a bounded relative error.
+///
 /// Histogram can be used in utils::statistics::MetricTag:
 /// @snippet utils/statistics/histogram_test.cpp  metric tag
 class Histogram final {
@@ -0,0 +1,196 @@
+#pragma once
+
+/// @file userver/utils/statistics/log_linear_histogram.hpp
+/// @brief @copybrief utils::statistics::LogLinearHistogram
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <userver/utils/statistics/histogram_aggregator.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+/// @brief A histogram of integer values with log-linear buckets and a bounded
+/// relative error, in the spirit of HdrHistogram.
+///
+/// Values below `2 ^ (SubBucketBits + 1)` are counted exactly. Each next power
+/// of two range is split into `2 ^ SubBucketBits` equal buckets, so the bucket
+/// of a value is found in O(1) with a few bit operations, and any
+/// GetPercentile() result differs from the true value by less than
+/// `2 ^ -SubBucketBits` of it. Values of `MaxValueBits` bits and more fall into
+/// the last bucket.
+///
+/// Unlike utils::statistics::Histogram, requires no manual bucket bounds.
+/// Unlike utils::statistics::Percentile, keeps the same relative precision
+/// for long tails. Histograms with the same parameters can be merged with Add,
+/// e.g. across threads or in utils::statistics::RecentPeriod epochs:
+///
+/// @code
+/// using Timings = utils::statistics::LogLinearHistogram<>;
+/// utils::statistics::RecentPeriod<Timings, Timings> timings;
+///
+/// timings.GetCurrentCounter().Account(elapsed_us.count());
+/// @endcode
+///
+/// The metric is written as a native utils::statistics::HistogramView with one
+/// bucket per power of two, so it is exported as a histogram to Prometheus,
+/// Solomon and the other formats and can be summed across hosts.
+///
+/// Type is safe to read/write concurrently from different threads/coroutines.
+template <std::size_t SubBucketBits = 4, std::size_t MaxValueBits = 40>
+class LogLinearHistogram final {
+    static_assert(SubBucketBits >= 1 && SubBucketBits < MaxValueBits && MaxValueBits <= 64);
+
+public:
+    static constexpr std::size_t kSubBucketCount = std::size_t{1} << SubBucketBits;
+    static constexpr std::size_t kBucketCount = (MaxValueBits - SubBucketBits + 1) * kSubBucketCount;
+    /// Number of buckets in the exported histogram
+    static constexpr std::size_t kExportedBucketCount = MaxValueBits;
+
+    LogLinearHistogram() noexcept = default;
+
+    LogLinearHistogram(const LogLinearHistogram& other) noexcept { *this = other; }
+
+    LogLinearHistogram& operator=(const LogLinearHistogram& rhs) noexcept {
+        if (this == &rhs) return *this;
+
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < kBucketCount; ++i) {
+            const auto value = rhs.buckets_[i].load(std::memory_order_relaxed);
+            buckets_[i].store(value, std::memory_order_relaxed);
+            sum += value;
+        }
+        count_.store(sum, std::memory_order_release);
+        return *this;
+    }
+
+    /// @brief Account for another value `count` times.
+    void Account(std::uint64_t value, std::uint64_t count = 1) noexcept {
+        buckets_[GetBucketIndex(value)].fetch_add(count, std::memory_order_relaxed);
+        count_.fetch_add(count, std::memory_order_release);
+    }
+
+    /// @brief Get X percentile - the highest value of the bucket, such that
+    /// the total number of elements in it and the lower buckets is greater
+    /// than X percent.
+    ///
+    /// @param percent - value in [0..100] - requested percentile.
+    /// If outside of 100, then returns the last bucket that has any element in
+    /// it.
+    std::uint64_t GetPercentile(double percent) const noexcept {
+        const auto count = count_.load(std::memory_order_acquire);
+        if (count == 0) return 0;
+
+        const auto want_sum = static_cast<double>(count) * percent;
+        std::uint64_t sum = 0;
+        std::size_t max_index = 0;
+        for (std::size_t i = 0; i < kBucketCount; ++i) {
+            const auto value = buckets_[i].load(std::memory_order_relaxed);
+            sum += value;
+            if (static_cast<double>(sum) * 100 > want_sum) return GetBucketHighestValue(i);
+
+            if (value) max_index = i;
+        }
+        return GetBucketHighestValue(max_index);
+    }
+
+    /// @brief Merge the other histogram into this one.
+    template <class Duration = std::chrono::seconds>
+    void Add(
+        const LogLinearHistogram& other,
+        [[maybe_unused]] Duration this_epoch_duration = Duration(),
+        [[maybe_unused]] Duration before_this_epoch_duration = Duration()
+    ) noexcept {
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < kBucketCount; ++i) {
+            const auto value = other.buckets_[i].load(std::memory_order_relaxed);
+            if (value == 0) continue;
+            sum += value;
+            buckets_[i].fetch_add(value, std::memory_order_relaxed);
+        }
+        count_.fetch_add(sum, std::memory_order_release);
+    }
+
+    /// @brief Zero out all the buckets and total number of elements.
+    void Reset() noexcept {
+        for (auto& bucket : buckets_) bucket.store(0, std::memory_order_relaxed);
+        count_.store(0, std::memory_order_release);
+    }
+
+    /// @brief Total number of elements
+    std::uint64_t Count() const noexcept { return count_.load(std::memory_order_acquire); }
+
+    /// @brief Sums up the buckets of each power of two range into a regular
+    /// histogram with `kExportedBucketCount` buckets with upper bounds
+    /// `1, 3, 7, ..., 2 ^ MaxValueBits - 1`. The last bucket, that also holds
+    /// the values out of range, goes to the "infinity" bucket.
+    HistogramAggregator ToHistogram() const {
+        std::array<double, kExportedBucketCount> bounds{};
+        for (std::size_t i = 0; i < kExportedBucketCount; ++i) {
+            bounds[i] = static_cast<double>((std::uint64_t{2} << i) - 1);
+        }
+
+        HistogramAggregator result{bounds};
+        for (std::size_t i = 0; i < kBucketCount; ++i) {
+            const auto value = buckets_[i].load(std::memory_order_relaxed);
+            if (value == 0) continue;
+
+            const auto highest_value = GetBucketHighestValue(i);
+            if (i + 1 == kBucketCount) {
+                result.AccountInf(value);
+            } else {
+                result.AccountAt(BitWidth(highest_value | 1) - 1, value);
+            }
+        }
+        return result;
+    }
+
+    /// @brief Returns the index of the bucket for `value`
+    static constexpr std::size_t GetBucketIndex(std::uint64_t value) noexcept {
+        // Values of more than MaxValueBits bits
+        if (value >> (MaxValueBits - 1) >> 1) return kBucketCount - 1;
+
+        const auto significant_bits = BitWidth(value);
+        const std::size_t shift = significant_bits > SubBucketBits + 1 ? significant_bits - SubBucketBits - 1 : 0;
+        return shift * kSubBucketCount + static_cast<std::size_t>(value >> shift);
+    }
+
+    /// @brief Returns the highest value that falls into the bucket
+    static constexpr std::uint64_t GetBucketHighestValue(std::size_t index) noexcept {
+        const std::size_t shift = index < 2 * kSubBucketCount ? 0 : index / kSubBucketCount - 1;
+        const std::uint64_t mantissa = index - shift * kSubBucketCount;
+        return ((mantissa + 1) << shift) - 1;
+    }
+
+private:
+    static constexpr std::size_t BitWidth(std::uint64_t value) noexcept {
+        return value == 0 ? 0 : 64 - static_cast<std::size_t>(__builtin_clzll(value));
+    }
+
+    std::array<std::atomic<std::uint64_t>, kBucketCount> buckets_{};
+    std::atomic<std::uint64_t> count_{0};
+};
+
+/// Metric serialization support for LogLinearHistogram, see
+/// utils::statistics::LogLinearHistogram::ToHistogram.
+template <std::size_t SubBucketBits, std::size_t MaxValueBits>
+void DumpMetric(Writer& writer, const LogLinearHistogram<SubBucketBits, MaxValueBits>& histogram) {
+    const auto aggregated = histogram.ToHistogram();
+    writer = aggregated.GetView();
+}
+
+/// Reset support for LogLinearHistogram
+template <std::size_t SubBucketBits, std::size_t MaxValueBits>
+void ResetMetric(LogLinearHistogram<SubBucketBits, MaxValueBits>& histogram) noexcept {
+    histogram.Reset();
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -12,9 +12,12 @@
 #include <variant>
 #include <vector>
 
+#include <userver/concurrent/variable.hpp>
 #include <userver/engine/shared_mutex.hpp>
 #include <userver/formats/json/value_builder.hpp>
+#include <userver/rcu/rcu.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/cardinality_limits.hpp>
 #include <userver/utils/statistics/entry.hpp>
 #include <userver/utils/statistics/metric_value.hpp>
 #include <userver/utils/statistics/writer.hpp>
@@ -147,12 +150,22 @@ public:
 
     void UnregisterExtender(impl::StorageIterator iterator, impl::UnregisteringKind kind) noexcept;
 
+    /// @brief Limits the number of series written by the writers, see
+    /// utils::statistics::CardinalityLimits. No limits by default.
+    void SetCardinalityLimits(CardinalityLimits limits);
+
+    /// @brief Returns the total number of written series that did not fit into
+    /// the CardinalityLimits, by the limited prefix.
+    std::unordered_map<std::string, Rate> GetCardinalityOverflows() const;
+
 private:
     Entry DoRegisterExtender(impl::MetricsSource&& source);
 
     std::atomic<bool> may_register_extenders_;
     impl::StorageData metrics_sources_;
     mutable engine::SharedMutex mutex_;
+    rcu::Variable<CardinalityLimits> cardinality_limits_;
+    mutable concurrent::Variable<std::unordered_map<std::string, Rate>> cardinality_overflows_;
 };
 
 }  // namespace utils::statistics
@@ -0,0 +1,65 @@
+#pragma once
+
+/// @file userver/utils/statistics/striped_histogram.hpp
+/// @brief @copybrief utils::statistics::StripedHistogram
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <userver/utils/span.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/histogram_aggregator.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent {
+class StripedCounter;
+}  // namespace concurrent
+
+namespace utils::statistics {
+
+/// @brief A histogram with contention-free buckets, with memory consumption
+/// and read performance traded for write performance.
+///
+/// Has the same semantics as utils::statistics::Histogram, but each bucket is
+/// a concurrent::StripedCounter. Use it for histograms that are accounted into
+/// from many threads at a high rate, where the bucket cache lines of
+/// utils::statistics::Histogram bounce between CPUs.
+///
+/// Reads sum up the per-CPU counters into a
+/// utils::statistics::HistogramAggregator and are approx. `nproc` times slower
+/// than those of utils::statistics::Histogram.
+class StripedHistogram final {
+public:
+    /// Sets upper bounds for each non-"infinite" bucket. The lowest bound is
+    /// always 0.
+    explicit StripedHistogram(utils::span<const double> upper_bounds);
+
+    StripedHistogram(StripedHistogram&&) noexcept;
+    StripedHistogram& operator=(StripedHistogram&&) noexcept;
+    ~StripedHistogram();
+
+    /// Increment the bucket corresponding to the given value.
+    void Account(double value, std::uint64_t count = 1) noexcept;
+
+    /// Sum up the buckets into a regular histogram.
+    HistogramAggregator Aggregate() const;
+
+    /// Reset all counters to zero. Accounts concurrent with the reset may or
+    /// may not be reset.
+    friend void ResetMetric(StripedHistogram& histogram) noexcept;
+
+private:
+    std::unique_ptr<double[]> bounds_;
+    // 0th counter is the "infinity" bucket
+    std::unique_ptr<concurrent::StripedCounter[]> counters_;
+    std::size_t bucket_count_;
+};
+
+/// Metric serialization support for StripedHistogram.
+void DumpMetric(Writer& writer, const StripedHistogram& histogram);
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,58 @@
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/cache/persistent_map.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kChangesPerUpdate = 500;
+
+template <typename Map>
+Map MakeData(std::size_t size) {
+    Map map;
+    for (std::size_t i = 0; i < size; ++i) map.insert_or_assign(i, std::to_string(i));
+    return map;
+}
+
+// Simulates an incremental CachingComponentBase update: copies the current
+// snapshot, applies the changes and publishes the new snapshot, while the
+// previous one is still alive
+template <typename Map>
+void IncrementalUpdate(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    auto snapshot = std::make_shared<const Map>(MakeData<Map>(size));
+
+    for ([[maybe_unused]] auto _ : state) {
+        auto data = *snapshot;
+        for (std::size_t i = 0; i < kChangesPerUpdate; ++i) {
+            data.insert_or_assign(utils::RandRange(size * 2), "updated");
+        }
+        auto new_snapshot = std::make_shared<const Map>(std::move(data));
+
+        state.PauseTiming();
+        // Garbage is destroyed asynchronously in CachingComponentBase
+        snapshot = std::move(new_snapshot);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * kChangesPerUpdate);
+}
+
+}  // namespace
+
+void cache_incremental_update_unordered_map(benchmark::State& state) {
+    IncrementalUpdate<std::unordered_map<std::size_t, std::string>>(state);
+}
+BENCHMARK(cache_incremental_update_unordered_map)->RangeMultiplier(10)->Range(1'000, 1'000'000);
+
+void cache_incremental_update_persistent_map(benchmark::State& state) {
+    IncrementalUpdate<cache::PersistentMap<std::size_t, std::string>>(state);
+}
+BENCHMARK(cache_incremental_update_persistent_map)->RangeMultiplier(10)->Range(1'000, 1'000'000);
+
+USERVER_NAMESPACE_END
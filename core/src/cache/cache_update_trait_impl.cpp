@@ -6,6 +6,7 @@
 #include <userver/components/dump_configurator.hpp>
 #include <userver/dynamic_config/source.hpp>
 #include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task_priority.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/testsuite/cache_control.hpp>
 #include <userver/tracing/tracer.hpp>
@@ -314,6 +315,8 @@ UpdateType CacheUpdateTrait::Impl::NextUpdateType(const Config& config) {
 }
 
 void CacheUpdateTrait::Impl::DoPeriodicUpdate() {
+    // Don't let the update and the tasks it spawns delay request handling
+    const engine::TaskPriorityScope priority_scope{engine::TaskPriority::kBackground};
     const std::lock_guard lock(update_mutex_);
     const auto config = GetConfig();
 
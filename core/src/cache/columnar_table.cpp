@@ -0,0 +1,533 @@
+#include <userver/cache/columnar_table.hpp>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <stdexcept>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+namespace impl::columnar {
+
+namespace {
+
+constexpr std::size_t kWordBits = 64;
+
+// Fills the words for `size` elements. `block_mask(data)` returns the bits of
+// kLanes elements starting at `data`, `predicate` is used for the tail.
+template <std::size_t kLanes, typename T, typename BlockMask, typename Predicate>
+void FillWords(const T* data, std::size_t size, std::uint64_t* words, BlockMask block_mask, Predicate predicate) {
+    static_assert(kWordBits % kLanes == 0);
+
+    const std::size_t full_words = size / kWordBits;
+    for (std::size_t w = 0; w < full_words; ++w, data += kWordBits) {
+        std::uint64_t word = 0;
+        for (std::size_t i = 0; i < kWordBits; i += kLanes) {
+            word |= std::uint64_t{block_mask(data + i)} << i;
+        }
+        words[w] = word;
+    }
+
+    const std::size_t tail = size % kWordBits;
+    if (tail != 0) {
+        std::uint64_t word = 0;
+        for (std::size_t i = 0; i < tail; ++i) {
+            word |= std::uint64_t{predicate(data[i])} << i;
+        }
+        words[full_words] = word;
+    }
+}
+
+template <typename T, typename Predicate>
+void FillWordsScalar(const T* data, std::size_t size, std::uint64_t* words, Predicate predicate) {
+    FillWords<1>(
+        data, size, words, [&predicate](const T* element) -> std::uint32_t { return predicate(*element); }, predicate
+    );
+}
+
+#if defined(__AVX2__)
+std::uint32_t Mask(__m256i value, std::size_t lane_size) noexcept {
+    switch (lane_size) {
+        case 1:
+            return static_cast<std::uint32_t>(_mm256_movemask_epi8(value));
+        case 4:
+            return static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(value)));
+        default:
+            return static_cast<std::uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(value)));
+    }
+}
+
+__m256i Load(const void* data) noexcept { return _mm256_loadu_si256(static_cast<const __m256i*>(data)); }
+
+template <typename U>
+__m256i Broadcast(U value) noexcept {
+    if constexpr (sizeof(U) == 1) {
+        return _mm256_set1_epi8(static_cast<char>(value));
+    } else if constexpr (sizeof(U) == 4) {
+        return _mm256_set1_epi32(static_cast<int>(value));
+    } else {
+        return _mm256_set1_epi64x(static_cast<long long>(value));
+    }
+}
+#elif defined(__SSE2__)
+std::uint32_t Mask(__m128i value, std::size_t lane_size) noexcept {
+    switch (lane_size) {
+        case 1:
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(value));
+        case 4:
+            return static_cast<std::uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(value)));
+        default:
+            return static_cast<std::uint32_t>(_mm_movemask_pd(_mm_castsi128_pd(value)));
+    }
+}
+
+__m128i Load(const void* data) noexcept { return _mm_loadu_si128(static_cast<const __m128i*>(data)); }
+
+template <typename U>
+__m128i Broadcast(U value) noexcept {
+    if constexpr (sizeof(U) == 1) {
+        return _mm_set1_epi8(static_cast<char>(value));
+    } else if constexpr (sizeof(U) == 4) {
+        return _mm_set1_epi32(static_cast<int>(value));
+    } else {
+        return _mm_set1_epi64x(static_cast<long long>(value));
+    }
+}
+#endif
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#if defined(__AVX2__)
+constexpr std::size_t kVectorSize = 32;
+#else
+constexpr std::size_t kVectorSize = 16;
+#endif
+
+// Lane sizes with the SIMD comparisons
+template <typename U>
+constexpr bool kHasSimd = sizeof(U) == 1 || sizeof(U) == 4 || sizeof(U) == 8;
+
+template <typename U>
+auto CompareEqual(decltype(Load(nullptr)) lhs, decltype(Load(nullptr)) rhs) noexcept {
+#if defined(__AVX2__)
+    if constexpr (sizeof(U) == 1) return _mm256_cmpeq_epi8(lhs, rhs);
+    if constexpr (sizeof(U) == 4) return _mm256_cmpeq_epi32(lhs, rhs);
+    if constexpr (sizeof(U) == 8) return _mm256_cmpeq_epi64(lhs, rhs);
+#else
+    if constexpr (sizeof(U) == 1) return _mm_cmpeq_epi8(lhs, rhs);
+    if constexpr (sizeof(U) == 4) return _mm_cmpeq_epi32(lhs, rhs);
+    // SSE2 has no 64-bit comparisons, both halves should be equal
+    if constexpr (sizeof(U) == 8) {
+        const auto equal_halves = _mm_cmpeq_epi32(lhs, rhs);
+        return _mm_and_si128(equal_halves, _mm_shuffle_epi32(equal_halves, _MM_SHUFFLE(2, 3, 0, 1)));
+    }
+#endif
+}
+
+// Unsigned `lhs < rhs` for the lanes
+template <typename U>
+auto CompareLess(decltype(Load(nullptr)) lhs, decltype(Load(nullptr)) rhs) noexcept {
+#if defined(__AVX2__)
+    // lhs < rhs if min(lhs, rhs - 1) == lhs, rhs is never zero here
+    if constexpr (sizeof(U) == 1) {
+        const auto max_less = _mm256_sub_epi8(rhs, _mm256_set1_epi8(1));
+        return _mm256_cmpeq_epi8(_mm256_min_epu8(lhs, max_less), lhs);
+    }
+    // flipping the sign bits turns the signed comparison into the unsigned one
+    if constexpr (sizeof(U) == 4) {
+        const auto sign = _mm256_set1_epi32(static_cast<int>(0x80000000U));
+        return _mm256_cmpgt_epi32(_mm256_xor_si256(rhs, sign), _mm256_xor_si256(lhs, sign));
+    }
+    if constexpr (sizeof(U) == 8) {
+        const auto sign = _mm256_set1_epi64x(static_cast<long long>(0x8000000000000000ULL));
+        return _mm256_cmpgt_epi64(_mm256_xor_si256(rhs, sign), _mm256_xor_si256(lhs, sign));
+    }
+#else
+    if constexpr (sizeof(U) == 1) {
+        const auto max_less = _mm_sub_epi8(rhs, _mm_set1_epi8(1));
+        return _mm_cmpeq_epi8(_mm_min_epu8(lhs, max_less), lhs);
+    }
+    if constexpr (sizeof(U) == 4) {
+        const auto sign = _mm_set1_epi32(static_cast<int>(0x80000000U));
+        return _mm_cmpgt_epi32(_mm_xor_si128(rhs, sign), _mm_xor_si128(lhs, sign));
+    }
+    // Signed 64-bit `rhs > lhs` is decided by the high halves if they differ,
+    // otherwise by the borrow from the low halves in `lhs - rhs`. The result
+    // is in the high halves and is copied to the low ones.
+    if constexpr (sizeof(U) == 8) {
+        const auto sign = _mm_set1_epi64x(static_cast<long long>(0x8000000000000000ULL));
+        const auto signed_lhs = _mm_xor_si128(lhs, sign);
+        const auto signed_rhs = _mm_xor_si128(rhs, sign);
+        const auto result = _mm_or_si128(
+            _mm_and_si128(_mm_cmpeq_epi32(signed_rhs, signed_lhs), _mm_sub_epi64(signed_lhs, signed_rhs)),
+            _mm_cmpgt_epi32(signed_rhs, signed_lhs)
+        );
+        return _mm_shuffle_epi32(result, _MM_SHUFFLE(3, 3, 1, 1));
+    }
+#endif
+}
+
+template <typename U>
+auto Subtract(decltype(Load(nullptr)) lhs, decltype(Load(nullptr)) rhs) noexcept {
+#if defined(__AVX2__)
+    if constexpr (sizeof(U) == 1) return _mm256_sub_epi8(lhs, rhs);
+    if constexpr (sizeof(U) == 4) return _mm256_sub_epi32(lhs, rhs);
+    if constexpr (sizeof(U) == 8) return _mm256_sub_epi64(lhs, rhs);
+#else
+    if constexpr (sizeof(U) == 1) return _mm_sub_epi8(lhs, rhs);
+    if constexpr (sizeof(U) == 4) return _mm_sub_epi32(lhs, rhs);
+    if constexpr (sizeof(U) == 8) return _mm_sub_epi64(lhs, rhs);
+#endif
+}
+#endif
+
+template <typename U>
+void EqualUnsigned(const U* data, std::size_t size, U value, std::uint64_t* words) noexcept {
+    const auto predicate = [value](U element) { return element == value; };
+#if defined(__AVX2__) || defined(__SSE2__)
+    if constexpr (kHasSimd<U>) {
+        const auto needle = Broadcast(value);
+        FillWords<kVectorSize / sizeof(U)>(
+            data,
+            size,
+            words,
+            [needle](const U* block) { return Mask(CompareEqual<U>(Load(block), needle), sizeof(U)); },
+            predicate
+        );
+        return;
+    }
+#endif
+    FillWordsScalar(data, size, words, predicate);
+}
+
+// `from <= element < to` is the same as `element - from < to - from` in
+// the unsigned modular arithmetic, which is a single comparison
+template <typename U>
+void RangeUnsigned(const U* data, std::size_t size, U from, U to, std::uint64_t* words) noexcept {
+    const U width = to - from;
+    const auto predicate = [from, width](U element) { return static_cast<U>(element - from) < width; };
+#if defined(__AVX2__) || defined(__SSE2__)
+    if constexpr (kHasSimd<U>) {
+        const auto base = Broadcast(from);
+        const auto bound = Broadcast(width);
+        FillWords<kVectorSize / sizeof(U)>(
+            data,
+            size,
+            words,
+            [base, bound](const U* block) {
+                return Mask(CompareLess<U>(Subtract<U>(Load(block), base), bound), sizeof(U));
+            },
+            predicate
+        );
+        return;
+    }
+#endif
+    FillWordsScalar(data, size, words, predicate);
+}
+
+template <typename T>
+void EqualFloating(const T* data, std::size_t size, T value, std::uint64_t* words) noexcept {
+    const auto predicate = [value](T element) { return element == value; };
+#if defined(__AVX2__)
+    if constexpr (std::is_same_v<T, float>) {
+        const auto needle = _mm256_set1_ps(value);
+        FillWords<8>(
+            data,
+            size,
+            words,
+            [needle](const float* block) {
+                return static_cast<std::uint32_t>(
+                    _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(block), needle, _CMP_EQ_OQ))
+                );
+            },
+            predicate
+        );
+    } else {
+        const auto needle = _mm256_set1_pd(value);
+        FillWords<4>(
+            data,
+            size,
+            words,
+            [needle](const double* block) {
+                return static_cast<std::uint32_t>(
+                    _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(block), needle, _CMP_EQ_OQ))
+                );
+            },
+            predicate
+        );
+    }
+#elif defined(__SSE2__)
+    if constexpr (std::is_same_v<T, float>) {
+        const auto needle = _mm_set1_ps(value);
+        FillWords<4>(
+            data,
+            size,
+            words,
+            [needle](const float* block) {
+                return static_cast<std::uint32_t>(_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(block), needle)));
+            },
+            predicate
+        );
+    } else {
+        const auto needle = _mm_set1_pd(value);
+        FillWords<2>(
+            data,
+            size,
+            words,
+            [needle](const double* block) {
+                return static_cast<std::uint32_t>(_mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(block), needle)));
+            },
+            predicate
+        );
+    }
+#else
+    FillWordsScalar(data, size, words, predicate);
+#endif
+}
+
+template <typename T>
+void RangeFloating(const T* data, std::size_t size, T from, T to, std::uint64_t* words) noexcept {
+    const auto predicate = [from, to](T element) { return from <= element && element < to; };
+#if defined(__AVX2__)
+    if constexpr (std::is_same_v<T, float>) {
+        const auto lower = _mm256_set1_ps(from);
+        const auto upper = _mm256_set1_ps(to);
+        FillWords<8>(
+            data,
+            size,
+            words,
+            [lower, upper](const float* block) {
+                const auto values = _mm256_loadu_ps(block);
+                return static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_and_ps(
+                    _mm256_cmp_ps(values, lower, _CMP_GE_OQ), _mm256_cmp_ps(values, upper, _CMP_LT_OQ)
+                )));
+            },
+            predicate
+        );
+    } else {
+        const auto lower = _mm256_set1_pd(from);
+        const auto upper = _mm256_set1_pd(to);
+        FillWords<4>(
+            data,
+            size,
+            words,
+            [lower, upper](const double* block) {
+                const auto values = _mm256_loadu_pd(block);
+                return static_cast<std::uint32_t>(_mm256_movemask_pd(_mm256_and_pd(
+                    _mm256_cmp_pd(values, lower, _CMP_GE_OQ), _mm256_cmp_pd(values, upper, _CMP_LT_OQ)
+                )));
+            },
+            predicate
+        );
+    }
+#elif defined(__SSE2__)
+    if constexpr (std::is_same_v<T, float>) {
+        const auto lower = _mm_set1_ps(from);
+        const auto upper = _mm_set1_ps(to);
+        FillWords<4>(
+            data,
+            size,
+            words,
+            [lower, upper](const float* block) {
+                const auto values = _mm_loadu_ps(block);
+                return static_cast<std::uint32_t>(
+                    _mm_movemask_ps(_mm_and_ps(_mm_cmpge_ps(values, lower), _mm_cmplt_ps(values, upper)))
+                );
+            },
+            predicate
+        );
+    } else {
+        const auto lower = _mm_set1_pd(from);
+        const auto upper = _mm_set1_pd(to);
+        FillWords<2>(
+            data,
+            size,
+            words,
+            [lower, upper](const double* block) {
+                const auto values = _mm_loadu_pd(block);
+                return static_cast<std::uint32_t>(
+                    _mm_movemask_pd(_mm_and_pd(_mm_cmpge_pd(values, lower), _mm_cmplt_pd(values, upper)))
+                );
+            },
+            predicate
+        );
+    }
+#else
+    FillWordsScalar(data, size, words, predicate);
+#endif
+}
+
+}  // namespace
+
+template <typename T>
+void FilterEqual(const T* data, std::size_t size, T value, std::uint64_t* words) noexcept {
+    if constexpr (std::is_floating_point_v<T>) {
+        EqualFloating(data, size, value, words);
+    } else {
+        // the signed and the unsigned types of the same size may alias
+        using U = std::make_unsigned_t<T>;
+        EqualUnsigned(reinterpret_cast<const U*>(data), size, static_cast<U>(value), words);
+    }
+}
+
+template <typename T>
+void FilterRange(const T* data, std::size_t size, T from, T to, std::uint64_t* words) noexcept {
+    UASSERT(from < to);
+    if constexpr (std::is_floating_point_v<T>) {
+        RangeFloating(data, size, from, to, words);
+    } else {
+        using U = std::make_unsigned_t<T>;
+        RangeUnsigned(reinterpret_cast<const U*>(data), size, static_cast<U>(from), static_cast<U>(to), words);
+    }
+}
+
+#define USERVER_IMPL_INSTANTIATE_FILTERS(T)                                          \
+    template void FilterEqual<T>(const T*, std::size_t, T, std::uint64_t*) noexcept; \
+    template void FilterRange<T>(const T*, std::size_t, T, T, std::uint64_t*) noexcept;
+
+USERVER_IMPL_INSTANTIATE_FILTERS(std::int8_t)
+USERVER_IMPL_INSTANTIATE_FILTERS(std::uint8_t)
+USERVER_IMPL_INSTANTIATE_FILTERS(std::int16_t)
+USERVER_IMPL_INSTANTIATE_FILTERS(std::uint16_t)
+USERVER_IMPL_INSTANTIATE_FILTERS(std::int32_t)
+USERVER_IMPL_INSTANTIATE_FILTERS(std::uint32_t)
+USERVER_IMPL_INSTANTIATE_FILTERS(std::int64_t)
+USERVER_IMPL_INSTANTIATE_FILTERS(std::uint64_t)
+USERVER_IMPL_INSTANTIATE_FILTERS(float)
+USERVER_IMPL_INSTANTIATE_FILTERS(double)
+
+#undef USERVER_IMPL_INSTANTIATE_FILTERS
+
+RowBitmap DictionaryStorage::FilterEqual(std::string_view value) const {
+    RowBitmap result(codes_.size());
+    const auto* code = USERVER_NAMESPACE::utils::impl::FindTransparentOrNullptr(codes_by_value_, value);
+    if (code) {
+        columnar::FilterEqual(codes_.data(), codes_.size(), *code, result.GetWordsData());
+    }
+    return result;
+}
+
+void DictionaryStorage::Clear() noexcept {
+    dictionary_.clear();
+    codes_by_value_.clear();
+    codes_.clear();
+}
+
+std::size_t DictionaryStorage::GetMemoryUsage() const noexcept {
+    // approximate size of a node of the hash map
+    constexpr std::size_t kNodeOverhead = 2 * sizeof(void*);
+
+    std::size_t result = codes_.capacity() * sizeof(std::uint32_t) + dictionary_.capacity() * sizeof(std::string) +
+                         codes_by_value_.size() * (sizeof(std::string) + sizeof(std::uint32_t) + kNodeOverhead) +
+                         codes_by_value_.bucket_count() * sizeof(void*);
+    for (const auto& value : dictionary_) {
+        // the dynamic memory of the strings is allocated twice, in the
+        // dictionary and in the hash map
+        if (value.capacity() > std::string{}.capacity()) result += 2 * value.capacity();
+    }
+    return result;
+}
+
+void DictionaryStorage::Write(dump::Writer& writer) const {
+    writer.Write(dictionary_);
+    WriteVector(writer, codes_);
+}
+
+void DictionaryStorage::Read(dump::Reader& reader) {
+    auto dictionary = reader.Read<std::vector<std::string>>();
+    auto codes = ReadVector<std::uint32_t>(reader);
+
+    const auto dictionary_size = dictionary.size();
+    if (std::any_of(codes.begin(), codes.end(), [dictionary_size](auto code) { return code >= dictionary_size; })) {
+        throw dump::Error("Dictionary code of cache::ColumnarTable in the dump is out of range");
+    }
+
+    Clear();
+    codes_by_value_.reserve(dictionary.size());
+    for (std::size_t i = 0; i < dictionary.size(); ++i) {
+        if (!codes_by_value_.emplace(dictionary[i], static_cast<std::uint32_t>(i)).second) {
+            throw dump::Error("Duplicate dictionary value of cache::ColumnarTable in the dump");
+        }
+    }
+    dictionary_ = std::move(dictionary);
+    codes_ = std::move(codes);
+}
+
+std::uint32_t DictionaryStorage::GetOrInsertCode(std::string_view value) {
+    if (const auto* code = USERVER_NAMESPACE::utils::impl::FindTransparentOrNullptr(codes_by_value_, value)) {
+        return *code;
+    }
+
+    if (dictionary_.size() >= std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("Too many distinct values in cache::DictionaryColumn");
+    }
+    const auto code = static_cast<std::uint32_t>(dictionary_.size());
+    dictionary_.emplace_back(value);
+    try {
+        codes_by_value_.emplace(dictionary_.back(), code);
+    } catch (...) {
+        dictionary_.pop_back();
+        throw;
+    }
+    return code;
+}
+
+}  // namespace impl::columnar
+
+RowBitmap::RowBitmap(std::size_t size, bool value)
+    : size_(size), words_((size + kWordBits - 1) / kWordBits, value ? ~std::uint64_t{0} : 0) {
+    if (value && size % kWordBits != 0) {
+        words_.back() = (std::uint64_t{1} << (size % kWordBits)) - 1;
+    }
+}
+
+std::size_t RowBitmap::Count() const noexcept {
+    std::size_t result = 0;
+    for (const auto word : words_) {
+        result += static_cast<std::size_t>(__builtin_popcountll(word));
+    }
+    return result;
+}
+
+bool RowBitmap::Any() const noexcept {
+    return std::any_of(words_.begin(), words_.end(), [](auto word) { return word != 0; });
+}
+
+void RowBitmap::Flip() noexcept {
+    for (auto& word : words_) word = ~word;
+    if (size_ % kWordBits != 0) {
+        words_.back() &= (std::uint64_t{1} << (size_ % kWordBits)) - 1;
+    }
+}
+
+RowBitmap& RowBitmap::operator&=(const RowBitmap& other) {
+    if (size_ != other.size_) {
+        throw std::invalid_argument("Sizes of cache::RowBitmap differ");
+    }
+    for (std::size_t i = 0; i < words_.size(); ++i) words_[i] &= other.words_[i];
+    return *this;
+}
+
+RowBitmap& RowBitmap::operator|=(const RowBitmap& other) {
+    if (size_ != other.size_) {
+        throw std::invalid_argument("Sizes of cache::RowBitmap differ");
+    }
+    for (std::size_t i = 0; i < words_.size(); ++i) words_[i] |= other.words_[i];
+    return *this;
+}
+
+std::vector<std::size_t> RowBitmap::GetRows() const {
+    std::vector<std::size_t> result;
+    result.reserve(Count());
+    Visit([&result](std::size_t row) { result.push_back(row); });
+    return result;
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
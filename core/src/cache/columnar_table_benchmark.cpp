@@ -0,0 +1,73 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <userver/cache/columnar_table.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Offer {
+    std::int32_t price{0};
+    std::int64_t stock{0};
+    std::string city;
+    std::string description;
+};
+
+struct ByPrice {};
+struct ByStock {};
+struct ByCity {};
+
+using Table = cache::ColumnarTable<
+    Offer,
+    cache::Column<ByPrice, &Offer::price>,
+    cache::Column<ByStock, &Offer::stock>,
+    cache::DictionaryColumn<ByCity, &Offer::city>>;
+
+const std::vector<std::string> kCities{"Moscow", "Berlin", "Paris", "Yerevan", "Istanbul", "Belgrade", "Tbilisi"};
+
+std::vector<Offer> MakeOffers(std::size_t size) {
+    std::vector<Offer> offers(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        offers[i].price = static_cast<std::int32_t>(i * 7919 % 10000);
+        offers[i].stock = static_cast<std::int64_t>(i * 104729 % 1000);
+        offers[i].city = kCities[i * 13 % kCities.size()];
+        offers[i].description = "Offer #" + std::to_string(i);
+    }
+    return offers;
+}
+
+}  // namespace
+
+// price in [1000, 2000) and stock >= 10 and city == "Paris"
+void columnar_table_scan_vector(benchmark::State& state) {
+    const auto offers = MakeOffers(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        std::size_t count = 0;
+        for (const auto& offer : offers) {
+            count += offer.price >= 1000 && offer.price < 2000 && offer.stock >= 10 && offer.city == "Paris";
+        }
+        benchmark::DoNotOptimize(count);
+    }
+}
+BENCHMARK(columnar_table_scan_vector)->RangeMultiplier(10)->Range(10'000, 1'000'000);
+
+void columnar_table_filter(benchmark::State& state) {
+    const auto offers = MakeOffers(state.range(0));
+    Table table;
+    for (const auto& offer : offers) table.push_back(offer);
+
+    for ([[maybe_unused]] auto _ : state) {
+        auto rows = table.FilterRange<ByPrice>(1000, 2000);
+        rows &= table.FilterRange<ByStock>(10, std::numeric_limits<std::int64_t>::max());
+        rows &= table.FilterEqual<ByCity>("Paris");
+        benchmark::DoNotOptimize(rows.Count());
+    }
+}
+BENCHMARK(columnar_table_filter)->RangeMultiplier(10)->Range(10'000, 1'000'000);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,238 @@
+#include <userver/cache/columnar_table.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <userver/dump/test_helpers.hpp>
+#include <userver/utest/assert_macros.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+enum class Status : std::uint8_t { kActive, kBlocked, kDeleted };
+
+struct Offer {
+    std::int32_t price{0};
+    std::int64_t stock{0};
+    double rating{0};
+    Status status{Status::kActive};
+    bool is_promoted{false};
+    std::string city;
+};
+
+struct ByPrice {};
+struct ByStock {};
+struct ByRating {};
+struct ByStatus {};
+struct ByPromoted {};
+struct ByCity {};
+
+using Table = cache::ColumnarTable<
+    Offer,
+    cache::Column<ByPrice, &Offer::price>,
+    cache::Column<ByStock, &Offer::stock>,
+    cache::Column<ByRating, &Offer::rating>,
+    cache::Column<ByStatus, &Offer::status>,
+    cache::Column<ByPromoted, &Offer::is_promoted>,
+    cache::DictionaryColumn<ByCity, &Offer::city>>;
+
+const std::vector<std::string> kCities{"Moscow", "Berlin", "Paris", "Yerevan", "Istanbul"};
+
+Offer MakeOffer(std::size_t i) {
+    Offer offer;
+    offer.price = static_cast<std::int32_t>(i * 7919 % 2000) - 1000;
+    offer.stock = static_cast<std::int64_t>(i * 104729 % 100000) * (i % 2 ? 1 : -1'000'000'000LL);
+    offer.rating = static_cast<double>(i * 31 % 50) / 10;
+    offer.status = static_cast<Status>(i % 3);
+    offer.is_promoted = i % 5 == 0;
+    offer.city = kCities[i * 13 % kCities.size()];
+    return offer;
+}
+
+template <typename Predicate>
+cache::RowBitmap Scan(const std::vector<Offer>& offers, Predicate predicate) {
+    cache::RowBitmap result(offers.size());
+    for (std::size_t i = 0; i < offers.size(); ++i) {
+        if (predicate(offers[i])) result.Set(i);
+    }
+    return result;
+}
+
+void ExpectSameFilters(const Table& table, const std::vector<Offer>& offers) {
+    ASSERT_EQ(table.size(), offers.size());
+
+    EXPECT_EQ(table.FilterRange<ByPrice>(-100, 250), Scan(offers, [](const Offer& offer) {
+                  return offer.price >= -100 && offer.price < 250;
+              }));
+    EXPECT_EQ(table.FilterEqual<ByPrice>(-1000), Scan(offers, [](const Offer& offer) {
+                  return offer.price == -1000;
+              }));
+    EXPECT_EQ(table.FilterRange<ByStock>(-5'000'000'000'000LL, 50'000), Scan(offers, [](const Offer& offer) {
+                  return offer.stock >= -5'000'000'000'000LL && offer.stock < 50'000;
+              }));
+    EXPECT_EQ(table.FilterRange<ByRating>(1.5, 3.0), Scan(offers, [](const Offer& offer) {
+                  return offer.rating >= 1.5 && offer.rating < 3.0;
+              }));
+    EXPECT_EQ(table.FilterEqual<ByRating>(4.2), Scan(offers, [](const Offer& offer) {
+                  return offer.rating == 4.2;
+              }));
+    EXPECT_EQ(table.FilterEqual<ByStatus>(Status::kBlocked), Scan(offers, [](const Offer& offer) {
+                  return offer.status == Status::kBlocked;
+              }));
+    EXPECT_EQ(table.FilterRange<ByStatus>(Status::kBlocked, Status::kDeleted), Scan(offers, [](const Offer& offer) {
+                  return offer.status == Status::kBlocked;
+              }));
+    EXPECT_EQ(table.FilterEqual<ByPromoted>(true), Scan(offers, [](const Offer& offer) {
+                  return offer.is_promoted;
+              }));
+    for (const auto& city : kCities) {
+        EXPECT_EQ(table.FilterEqual<ByCity>(city), Scan(offers, [&city](const Offer& offer) {
+                      return offer.city == city;
+                  }));
+    }
+    EXPECT_FALSE(table.FilterEqual<ByCity>("Atlantis").Any());
+
+    for (std::size_t i = 0; i < offers.size(); ++i) {
+        EXPECT_EQ(table.Get<ByPrice>(i), offers[i].price);
+        EXPECT_EQ(table.Get<ByStatus>(i), offers[i].status);
+        EXPECT_EQ(table.Get<ByCity>(i), offers[i].city);
+    }
+}
+
+}  // namespace
+
+TEST(RowBitmap, Basic) {
+    cache::RowBitmap bitmap(130);
+    EXPECT_EQ(bitmap.size(), 130);
+    EXPECT_FALSE(bitmap.Any());
+
+    bitmap.Set(0);
+    bitmap.Set(64);
+    bitmap.Set(129);
+    EXPECT_TRUE(bitmap.Test(64));
+    EXPECT_FALSE(bitmap.Test(65));
+    EXPECT_EQ(bitmap.Count(), 3);
+    EXPECT_EQ(bitmap.GetRows(), (std::vector<std::size_t>{0, 64, 129}));
+
+    const auto inverted = ~bitmap;
+    EXPECT_EQ(inverted.Count(), 127);
+    EXPECT_EQ((inverted & bitmap).Count(), 0);
+    EXPECT_EQ(inverted | bitmap, cache::RowBitmap(130, true));
+    EXPECT_EQ(cache::RowBitmap(130, true).Count(), 130);
+
+    bitmap.Set(64, false);
+    EXPECT_EQ(bitmap.GetRows(), (std::vector<std::size_t>{0, 129}));
+
+    UEXPECT_THROW(bitmap &= cache::RowBitmap(10), std::invalid_argument);
+}
+
+TEST(ColumnarTable, Filters) {
+    // sizes around the SIMD blocks and the bitmap words
+    for (const std::size_t size : {0, 1, 31, 63, 64, 65, 1000, 4099}) {
+        std::vector<Offer> offers;
+        Table table;
+        for (std::size_t i = 0; i < size; ++i) {
+            offers.push_back(MakeOffer(i));
+            table.push_back(offers.back());
+        }
+        ExpectSameFilters(table, offers);
+    }
+}
+
+TEST(ColumnarTable, IntegerLimits) {
+    struct Row {
+        std::int32_t value;
+    };
+    struct ByValue {};
+    cache::ColumnarTable<Row, cache::Column<ByValue, &Row::value>> table;
+
+    constexpr auto kMin = std::numeric_limits<std::int32_t>::min();
+    constexpr auto kMax = std::numeric_limits<std::int32_t>::max();
+    for (const auto value : {kMin, kMin + 1, -1, 0, 1, kMax - 1, kMax}) table.push_back({value});
+
+    EXPECT_EQ(table.FilterRange<ByValue>(kMin, kMax).Count(), 6);
+    EXPECT_EQ(table.FilterRange<ByValue>(kMin, 0).GetRows(), (std::vector<std::size_t>{0, 1, 2}));
+    EXPECT_EQ(table.FilterRange<ByValue>(0, kMax).GetRows(), (std::vector<std::size_t>{3, 4, 5}));
+    EXPECT_EQ(table.FilterEqual<ByValue>(kMax).GetRows(), std::vector<std::size_t>{6});
+    EXPECT_FALSE(table.FilterRange<ByValue>(1, 1).Any());
+    EXPECT_FALSE(table.FilterRange<ByValue>(1, -1).Any());
+}
+
+TEST(ColumnarTable, NaN) {
+    struct Row {
+        float value;
+    };
+    struct ByValue {};
+    cache::ColumnarTable<Row, cache::Column<ByValue, &Row::value>> table;
+    for (const auto value : {1.0f, std::nanf(""), 2.0f}) table.push_back({value});
+
+    EXPECT_EQ(table.FilterRange<ByValue>(0, 10).GetRows(), (std::vector<std::size_t>{0, 2}));
+    EXPECT_FALSE(table.FilterEqual<ByValue>(std::nanf("")).Any());
+    EXPECT_FALSE(table.FilterRange<ByValue>(std::nanf(""), 10).Any());
+}
+
+TEST(ColumnarTable, IncrementalUpdates) {
+    std::vector<Offer> offers;
+    Table table;
+    for (std::size_t i = 0; i < 500; ++i) {
+        offers.push_back(MakeOffer(i));
+        table.push_back(offers.back());
+    }
+
+    auto copy = table;
+    for (std::size_t i = 0; i < 500; i += 3) {
+        offers[i] = MakeOffer(i + 1000);
+        offers[i].city = "Tbilisi";
+        copy.Assign(i, offers[i]);
+    }
+    for (const std::size_t row : {0, 250, 497}) {
+        offers[row] = offers.back();
+        offers.pop_back();
+        copy.EraseUnordered(row);
+    }
+    ExpectSameFilters(copy, offers);
+    const auto updated = copy.FilterEqual<ByCity>("Tbilisi");
+    EXPECT_EQ(updated, Scan(offers, [](const Offer& offer) { return offer.city == "Tbilisi"; }));
+    EXPECT_GT(updated.Count(), 0);
+    EXPECT_EQ(copy.GetDictionarySize<ByCity>(), kCities.size() + 1);
+
+    // the original is intact
+    EXPECT_EQ(table.size(), 500);
+    EXPECT_FALSE(table.FilterEqual<ByCity>("Tbilisi").Any());
+
+    copy.clear();
+    EXPECT_TRUE(copy.empty());
+    EXPECT_FALSE(copy.FilterEqual<ByCity>("Moscow").Any());
+}
+
+TEST(ColumnarTable, MemoryUsage) {
+    Table table;
+    table.reserve(1000);
+    for (std::size_t i = 0; i < 1000; ++i) table.push_back(MakeOffer(i));
+
+    const auto column_sizes = sizeof(std::int32_t) + sizeof(std::int64_t) + sizeof(double) + 2 + sizeof(std::uint32_t);
+    EXPECT_GE(table.GetMemoryUsage(), 1000 * column_sizes);
+    EXPECT_LT(table.GetMemoryUsage(), 2000 * column_sizes);
+}
+
+TEST(ColumnarTable, Dump) {
+    std::vector<Offer> offers;
+    Table table;
+    for (std::size_t i = 0; i < 1000; ++i) {
+        offers.push_back(MakeOffer(i));
+        table.push_back(offers.back());
+    }
+
+    const auto restored = dump::FromBinary<Table>(dump::ToBinary(table));
+    ExpectSameFilters(restored, offers);
+    EXPECT_EQ(restored.GetDictionarySize<ByCity>(), kCities.size());
+    EXPECT_TRUE(dump::FromBinary<Table>(dump::ToBinary(Table{})).empty());
+}
+
+USERVER_NAMESPACE_END
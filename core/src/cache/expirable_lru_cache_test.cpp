@@ -390,6 +390,39 @@ UTEST(ExpirableLruCache, BackgroundUpdate) {
     EXPECT_EQ(2, cache.Get(key, UpdateNever()));
 }
 
+UTEST(ExpirableLruCache, BackgroundUpdateWindow) {
+    auto counter = std::make_shared<Counter>();
+
+    auto cache = CreateSimpleCache();
+    cache.SetMaxLifetime(std::chrono::seconds(10));
+    cache.SetBackgroundUpdate(cache::BackgroundUpdateMode::kEnabled);
+    cache.SetBackgroundUpdateWindow(0.2);
+
+    SimpleCacheKey key = "my-key";
+
+    utils::datetime::MockNowSet(std::chrono::system_clock::now());
+
+    EXPECT_EQ(1, cache.Get(key, UpdateValue(counter, 1)));
+    EXPECT_EQ(1, cache.GetStatistics().total.blocking_updates);
+
+    utils::datetime::MockSleep(std::chrono::seconds(7));
+    EXPECT_EQ(1, cache.Get(key, UpdateNever()));
+    EngineYield();
+
+    // Hits within the window start a single update
+    utils::datetime::MockSleep(std::chrono::seconds(2));
+    counter->Flush();
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(1, cache.Get(key, UpdateValue(counter, 2)));
+    }
+    EngineYield();
+
+    EXPECT_EQ(Counter::One(), *counter);
+    EXPECT_EQ(2, cache.Get(key, UpdateNever()));
+    EXPECT_EQ(1, cache.GetStatistics().total.background_updates);
+    EXPECT_EQ(1, cache.GetStatistics().total.blocking_updates);
+}
+
 UTEST(ExpirableLruCache, Example) {
     /// [Sample ExpirableLruCache]
     using Key = std::string;
@@ -417,6 +450,34 @@ UTEST(ExpirableLruCache, Example) {
     /// [Sample ExpirableLruCache]
 }
 
+UTEST(ExpirableLruCache, Weigher) {
+    using Cache = cache::ExpirableLruCache<std::string, std::string>;
+
+    Cache cache(/*ways*/ 1, /*way_size*/ 100);
+    cache.Put("small", std::string(10, 'a'));
+    cache.SetWeigher([](const std::string& key, const std::string& value) { return key.size() + value.size(); });
+    EXPECT_EQ(15, cache.GetWeightApproximate());
+
+    cache.SetWayMaxWeight(100);
+    cache.Put("big", std::string(80, 'b'));
+    EXPECT_EQ(98, cache.GetWeightApproximate());
+
+    // "small" is the least recently used one
+    cache.Put("other", std::string(5, 'c'));
+    EXPECT_EQ(std::nullopt, cache.GetOptionalNoUpdate("small"));
+    EXPECT_EQ(93, cache.GetWeightApproximate());
+
+    cache.InvalidateByKey("big");
+    EXPECT_EQ(10, cache.GetWeightApproximate());
+    EXPECT_EQ(1, cache.GetSizeApproximate());
+
+    // Heavier than the whole way
+    cache.Put("huge", std::string(200, 'd'));
+    EXPECT_EQ(std::nullopt, cache.GetOptionalNoUpdate("huge"));
+    EXPECT_EQ(0, cache.GetSizeApproximate());
+    EXPECT_EQ(0, cache.GetWeightApproximate());
+}
+
 UTEST(LruCacheWrapper, HitWrapper) {
     auto counter = std::make_shared<Counter>();
 
@@ -0,0 +1,129 @@
+#include <userver/cache/indexed_map.hpp>
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/test_helpers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Item {
+    std::string name;
+    int price{0};
+};
+
+struct ByName {};
+struct ByPrice {};
+
+using Map = cache::IndexedMap<
+    int,
+    Item,
+    cache::HashedIndex<ByName, &Item::name>,
+    cache::OrderedIndex<ByPrice, &Item::price>>;
+
+std::size_t GetLength(const std::string& value) { return value.size(); }
+
+std::set<int> FindByName(const Map& map, const std::string& name) {
+    std::set<int> result;
+    map.VisitEqual<ByName>(name, [&](int key, const Item& item) {
+        EXPECT_EQ(item.name, name);
+        result.insert(key);
+    });
+    EXPECT_EQ(map.Count<ByName>(name), result.size());
+    return result;
+}
+
+std::vector<int> FindByPrice(const Map& map, int from, int to) {
+    std::vector<int> result;
+    map.VisitRange<ByPrice>(from, to, [&](int /*key*/, const Item& item) { result.push_back(item.price); });
+    return result;
+}
+
+}  // namespace
+
+TEST(IndexedMap, Basic) {
+    Map map;
+    EXPECT_TRUE(map.insert_or_assign(1, Item{"a", 10}));
+    EXPECT_TRUE(map.insert_or_assign(2, Item{"b", 30}));
+    EXPECT_TRUE(map.insert_or_assign(3, Item{"a", 20}));
+    EXPECT_EQ(map.size(), 3);
+    EXPECT_EQ(map.at(2).name, "b");
+
+    EXPECT_EQ(FindByName(map, "a"), (std::set<int>{1, 3}));
+    EXPECT_EQ(FindByName(map, "c"), std::set<int>{});
+    EXPECT_EQ(FindByPrice(map, 10, 30), (std::vector<int>{10, 20}));
+
+    ASSERT_TRUE(map.FindOneOrNullptr<ByName>("b"));
+    EXPECT_EQ(map.FindOneOrNullptr<ByName>("b")->price, 30);
+    EXPECT_EQ(map.FindOneOrNullptr<ByPrice>(42), nullptr);
+}
+
+TEST(IndexedMap, AssignUpdatesIndexes) {
+    Map map;
+    map.insert_or_assign(1, Item{"a", 10});
+    map.insert_or_assign(2, Item{"a", 20});
+
+    EXPECT_FALSE(map.insert_or_assign(1, Item{"b", 10}));
+    EXPECT_EQ(FindByName(map, "a"), std::set<int>{2});
+    EXPECT_EQ(FindByName(map, "b"), std::set<int>{1});
+    EXPECT_EQ(FindByPrice(map, 0, 100), (std::vector<int>{10, 20}));
+
+    EXPECT_FALSE(map.insert_or_assign(2, Item{"a", 5}));
+    EXPECT_EQ(FindByPrice(map, 0, 100), (std::vector<int>{5, 10}));
+
+    EXPECT_EQ(map.erase(1), 1);
+    EXPECT_EQ(map.erase(1), 0);
+    EXPECT_EQ(FindByName(map, "b"), std::set<int>{});
+    EXPECT_EQ(FindByPrice(map, 0, 100), std::vector<int>{5});
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(FindByName(map, "a"), std::set<int>{});
+    EXPECT_EQ(map.GetIndexMemoryUsage<ByPrice>(), 0);
+}
+
+TEST(IndexedMap, CopiesAreIndependent) {
+    Map map;
+    for (int i = 0; i < 100; ++i) map.insert_or_assign(i, Item{std::to_string(i % 10), i});
+
+    auto copy = map;
+    copy.insert_or_assign(0, Item{"new", 1000});
+    copy.erase(1);
+
+    EXPECT_EQ(FindByName(map, "0").size(), 10);
+    EXPECT_EQ(FindByName(copy, "0").size(), 9);
+    EXPECT_EQ(FindByName(copy, "new"), std::set<int>{0});
+    EXPECT_EQ(FindByName(map, "1").size(), 10);
+    EXPECT_EQ(FindByName(copy, "1").size(), 9);
+}
+
+TEST(IndexedMap, MemoryUsage) {
+    Map map;
+    const auto empty_usage = map.GetIndexMemoryUsage<ByName>();
+    for (int i = 0; i < 100; ++i) map.insert_or_assign(i, Item{std::to_string(i), i});
+
+    EXPECT_GT(map.GetPrimaryMemoryUsage(), 100 * sizeof(Map::value_type));
+    EXPECT_GT(map.GetIndexMemoryUsage<ByName>(), empty_usage);
+    EXPECT_GE(map.GetIndexMemoryUsage<ByPrice>(), 100 * (sizeof(int) * 2));
+}
+
+TEST(IndexedMap, Dump) {
+    using StringMap = cache::IndexedMap<int, std::string, cache::HashedIndex<ByName, &GetLength>>;
+
+    StringMap map;
+    for (int i = 0; i < 100; ++i) map.insert_or_assign(i, std::to_string(i));
+
+    const auto restored = dump::FromBinary<StringMap>(dump::ToBinary(map));
+    EXPECT_EQ(restored.size(), 100);
+    EXPECT_EQ(restored.at(42), "42");
+    EXPECT_EQ(restored.Count<ByName>(1), 10);
+    EXPECT_EQ(restored.Count<ByName>(2), 90);
+}
+
+USERVER_NAMESPACE_END
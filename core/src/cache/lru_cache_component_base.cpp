@@ -52,9 +52,21 @@ properties:
     size:
         type: integer
         description: max amount of items to store in cache
+    max-bytes:
+        type: integer
+        description: max total weight of items, requires the lru eviction-policy and cache::ExpirableLruCache::SetWeigher (0 is unlimited)
+        defaultDescription: 0
     ways:
         type: integer
         description: number of ways for associative cache
+    eviction-policy:
+        type: string
+        description: "`lru` for the exact LRU, `clock` for the CLOCK approximation with concurrent reads, `tinylfu` for the scan resistant W-TinyLFU"
+        defaultDescription: lru
+        enum:
+          - lru
+          - clock
+          - tinylfu
     lifetime:
         type: string
         description: TTL for cache entries (0 is unlimited)
@@ -63,6 +75,14 @@ properties:
         type: boolean
         description: enables asynchronous updates for expiring values
         defaultDescription: false
+    background-update-window:
+        type: number
+        description: fraction of the lifetime before the expiration, during which a hit triggers the asynchronous update, in (0, 1]
+        defaultDescription: 0.5
+    background-update-task-processor:
+        type: string
+        description: task processor for the asynchronous updates
+        defaultDescription: task processor of the caller
     config-settings:
         type: boolean
         description: enables dynamic reconfiguration with CacheConfigSet
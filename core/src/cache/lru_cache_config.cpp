@@ -1,11 +1,15 @@
 #include <userver/cache/lru_cache_config.hpp>
 
+#include <limits>
 #include <stdexcept>
 
+#include <fmt/format.h>
+
 #include <userver/components/component_config.hpp>
 #include <userver/dump/config.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/utils/algo.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -15,9 +19,27 @@ namespace {
 
 constexpr std::string_view kWays = "ways";
 constexpr std::string_view kSize = "size";
+constexpr std::string_view kMaxBytes = "max-bytes";
 constexpr std::string_view kLifetime = "lifetime";
 constexpr std::string_view kBackgroundUpdate = "background-update";
+constexpr std::string_view kBackgroundUpdateWindow = "background-update-window";
+constexpr std::string_view kBackgroundUpdateTaskProcessor = "background-update-task-processor";
 constexpr std::string_view kLifetimeMs = "lifetime-ms";
+constexpr std::string_view kEvictionPolicy = "eviction-policy";
+
+void CheckBackgroundUpdateWindow(double window) {
+    if (window <= 0 || window > 1) {
+        throw std::runtime_error(fmt::format("{} should be in (0, 1], got {}", kBackgroundUpdateWindow, window));
+    }
+}
+
+EvictionPolicy ParseEvictionPolicy(const yaml_config::YamlConfig& value) {
+    const auto policy = value.As<std::string>("lru");
+    if (policy == "lru") return EvictionPolicy::kLru;
+    if (policy == "clock") return EvictionPolicy::kClock;
+    if (policy == "tinylfu") return EvictionPolicy::kTinyLfu;
+    throw std::runtime_error(fmt::format("Unknown {} '{}' at '{}'", kEvictionPolicy, policy, value.GetPath()));
+}
 
 }  // namespace
 
@@ -25,11 +47,14 @@ using dump::impl::ParseMs;
 
 LruCacheConfig::LruCacheConfig(const yaml_config::YamlConfig& config)
     : size(config[kSize].As<std::size_t>()),
+      max_bytes(config[kMaxBytes].As<std::size_t>(0)),
       lifetime(config[kLifetime].As<std::chrono::milliseconds>(0)),
       background_update(
           config[kBackgroundUpdate].As<bool>(false) ? BackgroundUpdateMode::kEnabled : BackgroundUpdateMode::kDisabled
-      ) {
+      ),
+      background_update_window(config[kBackgroundUpdateWindow].As<double>(0.5)) {
     if (size == 0) throw std::runtime_error("cache-size is non-positive");
+    CheckBackgroundUpdateWindow(background_update_window);
 }
 
 LruCacheConfig::LruCacheConfig(const components::ComponentConfig& config)
@@ -37,11 +62,14 @@ LruCacheConfig::LruCacheConfig(const components::ComponentConfig& config)
 
 LruCacheConfig::LruCacheConfig(const formats::json::Value& value)
     : size(value[kSize].As<std::size_t>()),
+      max_bytes(value[kMaxBytes].As<std::size_t>(0)),
       lifetime(ParseMs(value[kLifetimeMs])),
       background_update(
           value[kBackgroundUpdate].As<bool>(false) ? BackgroundUpdateMode::kEnabled : BackgroundUpdateMode::kDisabled
-      ) {
+      ),
+      background_update_window(value[kBackgroundUpdateWindow].As<double>(0.5)) {
     if (size == 0) throw std::runtime_error("cache-size is non-positive");
+    CheckBackgroundUpdateWindow(background_update_window);
 }
 
 std::size_t LruCacheConfig::GetWaySize(std::size_t ways) const {
@@ -49,6 +77,12 @@ std::size_t LruCacheConfig::GetWaySize(std::size_t ways) const {
     return way_size == 0 ? 1 : way_size;
 }
 
+std::size_t LruCacheConfig::GetWayMaxBytes(std::size_t ways) const {
+    if (max_bytes == 0) return std::numeric_limits<std::size_t>::max();
+    const auto way_max_bytes = max_bytes / ways;
+    return way_max_bytes == 0 ? 1 : way_max_bytes;
+}
+
 LruCacheConfig Parse(const formats::json::Value& value, formats::parse::To<LruCacheConfig>) {
     return LruCacheConfig{value};
 }
@@ -56,8 +90,13 @@ LruCacheConfig Parse(const formats::json::Value& value, formats::parse::To<LruCa
 LruCacheConfigStatic::LruCacheConfigStatic(const yaml_config::YamlConfig& config)
     : config(config),
       ways(config[kWays].As<std::size_t>()),
+      eviction_policy(ParseEvictionPolicy(config[kEvictionPolicy])),
+      background_update_task_processor(config[kBackgroundUpdateTaskProcessor].As<std::optional<std::string>>()),
       use_dynamic_config(config["config-settings"].As<bool>(true)) {
     if (ways <= 0) throw std::runtime_error("cache-ways is non-positive");
+    if (this->config.max_bytes != 0 && eviction_policy != EvictionPolicy::kLru) {
+        throw std::runtime_error(fmt::format("{} requires the lru {}", kMaxBytes, kEvictionPolicy));
+    }
 }
 
 LruCacheConfigStatic::LruCacheConfigStatic(const components::ComponentConfig& config)
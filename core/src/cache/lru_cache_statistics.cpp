@@ -12,13 +12,15 @@ ExpirableLruCacheStatisticsBase::ExpirableLruCacheStatisticsBase(const Expirable
     : hits(other.hits.load()),
       misses(other.misses.load()),
       stale(other.stale.load()),
-      background_updates(other.background_updates.load()) {}
+      background_updates(other.background_updates.load()),
+      blocking_updates(other.blocking_updates.load()) {}
 
 void ExpirableLruCacheStatisticsBase::Reset() {
     hits = 0;
     misses = 0;
     stale = 0;
     background_updates = 0;
+    blocking_updates = 0;
 }
 
 ExpirableLruCacheStatisticsBase& ExpirableLruCacheStatisticsBase::operator+=(
@@ -28,6 +30,7 @@ ExpirableLruCacheStatisticsBase& ExpirableLruCacheStatisticsBase::operator+=(
     misses += other.misses.load();
     stale += other.stale.load();
     background_updates += other.background_updates.load();
+    blocking_updates += other.blocking_updates.load();
     return *this;
 }
 
@@ -49,11 +52,18 @@ void CacheStale(ExpirableLruCacheStatistics& stats) {
     LOG_TRACE() << "stale cache";
 }
 
+void CacheBlockingUpdate(ExpirableLruCacheStatistics& stats) {
+    ++stats.total.blocking_updates;
+    ++stats.recent.GetCurrentCounter().blocking_updates;
+    LOG_TRACE() << "blocking cache update";
+}
+
 void DumpMetric(utils::statistics::Writer& writer, const ExpirableLruCacheStatistics& stats) {
     writer["hits"] = stats.total.hits.load();
     writer["misses"] = stats.total.misses.load();
     writer["stale"] = stats.total.stale.load();
     writer["background-updates"] = stats.total.background_updates.load();
+    writer["blocking-updates"] = stats.total.blocking_updates.load();
 
     auto s1min = stats.recent.GetStatsForPeriod();
     double s1min_hits = s1min.hits.load();
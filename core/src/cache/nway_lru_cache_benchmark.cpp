@@ -0,0 +1,42 @@
+#include <benchmark/benchmark.h>
+
+#include <userver/cache/nway_lru_cache.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/utils/rand.hpp>
+#include <utils/impl/parallelize_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kWays = 16;
+constexpr std::size_t kWaySize = 1000;
+// A few hot keys in each way, as in a typical skewed workload
+constexpr unsigned kHotKeys = 64;
+
+void GetHotKeys(benchmark::State& state, cache::EvictionPolicy policy) {
+    engine::RunStandalone(state.range(0), [&] {
+        cache::NWayLRU<unsigned, unsigned> cache{kWays, kWaySize, {}, {}, policy};
+        for (unsigned i = 0; i < kWays * kWaySize; ++i) cache.Put(i, i);
+
+        RunParallelBenchmark(state, [&](auto& range) {
+            unsigned i = utils::RandRange(kHotKeys);
+            for ([[maybe_unused]] auto _ : range) {
+                benchmark::DoNotOptimize(cache.Get(++i % kHotKeys));
+            }
+        });
+    });
+}
+
+}  // namespace
+
+void nway_lru_get_hot_keys_lru(benchmark::State& state) { GetHotKeys(state, cache::EvictionPolicy::kLru); }
+BENCHMARK(nway_lru_get_hot_keys_lru)->DenseRange(1, 6);
+
+void nway_lru_get_hot_keys_clock(benchmark::State& state) { GetHotKeys(state, cache::EvictionPolicy::kClock); }
+BENCHMARK(nway_lru_get_hot_keys_clock)->DenseRange(1, 6);
+
+void nway_lru_get_hot_keys_tinylfu(benchmark::State& state) { GetHotKeys(state, cache::EvictionPolicy::kTinyLfu); }
+BENCHMARK(nway_lru_get_hot_keys_tinylfu)->DenseRange(1, 6);
+
+USERVER_NAMESPACE_END
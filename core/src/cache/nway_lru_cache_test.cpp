@@ -1,6 +1,8 @@
 #include <userver/utest/utest.hpp>
 
 #include <userver/cache/nway_lru_cache.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -54,6 +56,110 @@ UTEST(NWayLRU, SetMultipleWays) {
     EXPECT_EQ(1, cache.Get(1));
 }
 
+UTEST(NWayLRU, ClockSet) {
+    Cache cache(1, 2, {}, {}, cache::EvictionPolicy::kClock);
+    cache.Put(1, 1);
+    cache.Put(2, 2);
+    EXPECT_EQ(1, cache.Get(1));
+
+    cache.Put(3, 3);
+    EXPECT_EQ(2, cache.GetSize());
+    EXPECT_EQ(1, cache.Get(1));
+    EXPECT_EQ(3, cache.Get(3));
+    EXPECT_FALSE(cache.Get(2).has_value());
+}
+
+UTEST(NWayLRU, ClockGetExpired) {
+    Cache cache(1, 2, {}, {}, cache::EvictionPolicy::kClock);
+    cache.Put(1, 1);
+    cache.Put(2, 2);
+
+    EXPECT_FALSE(cache.Get(1, [](int) { return false; }).has_value());
+    EXPECT_EQ(1, cache.GetSize());
+    EXPECT_EQ(-1, cache.GetOr(1, -1));
+    EXPECT_EQ(2, cache.GetOr(2, -1));
+
+    cache.InvalidateByKey(2);
+    EXPECT_EQ(0, cache.GetSize());
+}
+
+UTEST_MT(NWayLRU, ClockConcurrentGet, 4) {
+    Cache cache(4, 100, {}, {}, cache::EvictionPolicy::kClock);
+    for (int i = 0; i < 400; ++i) cache.Put(i, i);
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (int task = 0; task < 4; ++task) {
+        tasks.push_back(engine::AsyncNoSpan([&cache, task] {
+            for (int i = 0; i < 10'000; ++i) {
+                const auto key = (i * 7 + task) % 400;
+                const auto value = cache.Get(key);
+                if (value) {
+                    EXPECT_EQ(key, *value);
+                }
+                if (i % 100 == 0) cache.Put(400 + i, 400 + i);
+            }
+        }));
+    }
+    for (auto& task : tasks) task.Get();
+    EXPECT_LE(cache.GetSize(), 400);
+}
+
+UTEST(NWayLRU, TinyLfuScanResistance) {
+    Cache cache(1, 100, {}, {}, cache::EvictionPolicy::kTinyLfu);
+    for (int i = 0; i < 50; ++i) cache.Put(i, i);
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 50; ++i) EXPECT_EQ(i, cache.Get(i));
+    }
+
+    for (int i = 1000; i < 2000; ++i) cache.Put(i, i);
+    EXPECT_EQ(100, cache.GetSize());
+    EXPECT_GT(cache.GetAdmissionRejects(), 0);
+    for (int i = 0; i < 50; ++i) EXPECT_EQ(i, cache.Get(i));
+}
+
+UTEST(NWayLRU, TinyLfuGetExpired) {
+    Cache cache(2, 10, {}, {}, cache::EvictionPolicy::kTinyLfu);
+    cache.Put(1, 1);
+    cache.Put(2, 2);
+
+    EXPECT_FALSE(cache.Get(1, [](int) { return false; }).has_value());
+    EXPECT_EQ(1, cache.GetSize());
+    EXPECT_EQ(2, cache.GetOr(2, -1));
+
+    cache.Invalidate();
+    EXPECT_EQ(0, cache.GetSize());
+}
+
+UTEST(NWayLRU, Weigher) {
+    Cache cache(1, 10);
+    cache.Put(1, 10);
+    cache.SetWeigher([](int, int value) { return static_cast<std::size_t>(value); });
+    cache.UpdateWayMaxWeight(25);
+    EXPECT_EQ(10, cache.GetWeight());
+
+    cache.Put(2, 10);
+    cache.Put(3, 10);
+    EXPECT_EQ(2, cache.GetSize());
+    EXPECT_EQ(20, cache.GetWeight());
+    EXPECT_FALSE(cache.Get(1).has_value());
+
+    // Rewriting updates the weight
+    cache.Put(2, 5);
+    EXPECT_EQ(15, cache.GetWeight());
+
+    cache.UpdateWaySize(1);
+    EXPECT_EQ(1, cache.GetSize());
+    EXPECT_EQ(5, cache.GetWeight());
+
+    cache.Invalidate();
+    EXPECT_EQ(0, cache.GetWeight());
+}
+
+UTEST(NWayLRU, WeigherRequiresLru) {
+    Cache cache(1, 10, {}, {}, cache::EvictionPolicy::kClock);
+    UEXPECT_THROW(cache.SetWeigher([](int, int) { return 1; }), std::logic_error);
+}
+
 UTEST(NWayLRU, HashCombine) {
     for (const auto seed : std::vector<std::size_t>{0, 1, 7, 42, 100, 1000}) {
         /// @note: checking for seed used in way selection to not be equal after
@@ -0,0 +1,127 @@
+#include <userver/cache/persistent_map.hpp>
+
+#include <string>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/test_helpers.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Map = cache::PersistentMap<int, std::string>;
+
+// Makes all the keys collide in groups of 4
+struct BadHash {
+    std::size_t operator()(int key) const noexcept { return static_cast<std::size_t>(key / 4); }
+};
+
+template <typename PersistentMap, typename StdMap>
+void ExpectSameContents(const PersistentMap& map, const StdMap& expected) {
+    ASSERT_EQ(map.size(), expected.size());
+    std::size_t iterated = 0;
+    for (const auto& [key, value] : map) {
+        ++iterated;
+        const auto it = expected.find(key);
+        ASSERT_NE(it, expected.end()) << key;
+        EXPECT_EQ(value, it->second) << key;
+    }
+    EXPECT_EQ(iterated, expected.size());
+    for (const auto& [key, value] : expected) {
+        const auto* found = map.FindOrNullptr(key);
+        ASSERT_TRUE(found) << key;
+        EXPECT_EQ(*found, value) << key;
+    }
+}
+
+}  // namespace
+
+TEST(PersistentMap, Basic) {
+    Map map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+    EXPECT_FALSE(map.FindOrNullptr(1));
+
+    EXPECT_TRUE(map.insert_or_assign(1, "a"));
+    EXPECT_FALSE(map.insert_or_assign(1, "b"));
+    EXPECT_TRUE(map.insert_or_assign(2, "c"));
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_EQ(map.at(1), "b");
+    EXPECT_TRUE(map.contains(2));
+    EXPECT_THROW(map.at(3), std::out_of_range);
+
+    EXPECT_EQ(map.erase(3), 0);
+    EXPECT_EQ(map.erase(1), 1);
+    EXPECT_EQ(map.size(), 1);
+    EXPECT_FALSE(map.contains(1));
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+}
+
+TEST(PersistentMap, CopiesAreIndependent) {
+    const Map original{{1, "a"}, {2, "b"}};
+
+    auto copy = original;
+    copy.insert_or_assign(1, "changed");
+    copy.insert_or_assign(3, "c");
+    copy.erase(2);
+
+    ExpectSameContents(original, std::unordered_map<int, std::string>{{1, "a"}, {2, "b"}});
+    ExpectSameContents(copy, std::unordered_map<int, std::string>{{1, "changed"}, {3, "c"}});
+}
+
+TEST(PersistentMap, Randomized) {
+    Map map;
+    std::unordered_map<int, std::string> expected;
+
+    for (int i = 0; i < 20000; ++i) {
+        const int key = utils::RandRange(5000);
+        if (utils::RandRange(3) == 0) {
+            EXPECT_EQ(map.erase(key), expected.erase(key));
+        } else {
+            const auto value = std::to_string(i);
+            EXPECT_EQ(map.insert_or_assign(key, value), expected.insert_or_assign(key, value).second);
+        }
+    }
+    ExpectSameContents(map, expected);
+
+    while (!expected.empty()) {
+        const auto key = expected.begin()->first;
+        EXPECT_EQ(map.erase(key), 1);
+        expected.erase(key);
+    }
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(PersistentMap, HashCollisions) {
+    cache::PersistentMap<int, int, BadHash> map;
+    std::unordered_map<int, int> expected;
+
+    for (int i = 0; i < 100; ++i) {
+        map.insert_or_assign(i, i * 10);
+        expected.emplace(i, i * 10);
+    }
+    ExpectSameContents(map, expected);
+
+    for (int i = 0; i < 100; i += 3) {
+        EXPECT_EQ(map.erase(i), 1);
+        expected.erase(i);
+    }
+    ExpectSameContents(map, expected);
+}
+
+TEST(PersistentMap, Dump) {
+    Map map;
+    for (int i = 0; i < 100; ++i) map.insert_or_assign(i, std::to_string(i));
+
+    const auto restored = dump::FromBinary<Map>(dump::ToBinary(map));
+    ExpectSameContents(restored, std::unordered_map<int, std::string>(map.begin(), map.end()));
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,100 @@
+#include <userver/cache/persistent_vector.hpp>
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/test_helpers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Vector = cache::PersistentVector<std::string>;
+
+void ExpectSameContents(const Vector& vector, const std::vector<std::string>& expected) {
+    ASSERT_EQ(vector.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(vector[i], expected[i]) << i;
+    }
+    EXPECT_EQ(std::vector<std::string>(vector.begin(), vector.end()), expected);
+}
+
+}  // namespace
+
+TEST(PersistentVector, Basic) {
+    Vector vector;
+    EXPECT_TRUE(vector.empty());
+    EXPECT_EQ(vector.begin(), vector.end());
+    EXPECT_THROW(vector.at(0), std::out_of_range);
+
+    vector.push_back("a");
+    vector.push_back("b");
+    EXPECT_EQ(vector.size(), 2);
+    EXPECT_EQ(vector.front(), "a");
+    EXPECT_EQ(vector.back(), "b");
+
+    vector.set(0, "c");
+    EXPECT_EQ(vector.at(0), "c");
+
+    vector.pop_back();
+    vector.pop_back();
+    EXPECT_TRUE(vector.empty());
+}
+
+TEST(PersistentVector, GrowAndShrink) {
+    Vector vector;
+    std::vector<std::string> expected;
+
+    // Enough for three levels of the tree
+    constexpr std::size_t kSize = 32 * 32 + 100;
+    for (std::size_t i = 0; i < kSize; ++i) {
+        vector.push_back(std::to_string(i));
+        expected.push_back(std::to_string(i));
+    }
+    ExpectSameContents(vector, expected);
+
+    for (std::size_t i = 0; i < kSize; i += 7) {
+        vector.set(i, "x");
+        expected[i] = "x";
+    }
+    ExpectSameContents(vector, expected);
+
+    while (!expected.empty()) {
+        vector.pop_back();
+        expected.pop_back();
+        ASSERT_EQ(vector.size(), expected.size());
+        if (!expected.empty()) {
+            ASSERT_EQ(vector.back(), expected.back());
+        }
+    }
+    EXPECT_TRUE(vector.empty());
+
+    vector.push_back("again");
+    ExpectSameContents(vector, {"again"});
+}
+
+TEST(PersistentVector, CopiesAreIndependent) {
+    Vector original;
+    for (int i = 0; i < 100; ++i) original.push_back(std::to_string(i));
+    const std::vector<std::string> expected(original.begin(), original.end());
+
+    auto copy = original;
+    copy.set(50, "changed");
+    copy.push_back("new");
+    copy.pop_back();
+    copy.pop_back();
+
+    ExpectSameContents(original, expected);
+    EXPECT_EQ(copy.size(), 99);
+    EXPECT_EQ(copy[50], "changed");
+}
+
+TEST(PersistentVector, Dump) {
+    Vector vector{"a", "b", "c"};
+    ExpectSameContents(dump::FromBinary<Vector>(dump::ToBinary(vector)), {"a", "b", "c"});
+}
+
+USERVER_NAMESPACE_END
@@ -19,8 +19,8 @@ Client::Client(clients::http::Client& http_client, const ClientConfig& config)
 
 Client::~Client() = default;
 
-std::string Client::FetchConfigsValues(std::string_view body) {
-    const auto timeout_ms = config_.timeout.count();
+std::string Client::FetchConfigsValues(std::string_view body, std::chrono::milliseconds timeout) {
+    const auto timeout_ms = timeout.count();
     const auto retries = config_.retries;
     const auto url =
         config_.append_path_to_url ? utils::StrCat(config_.config_url, kConfigsValues) : config_.config_url;
@@ -67,8 +67,18 @@ std::string Client::FetchConfigsValues(std::string_view body) {
 
 Client::Reply
 Client::FetchDocsMap(const std::optional<Timestamp>& last_update, const std::vector<std::string>& fields_to_load) {
-    const auto json_value = FetchConfigs(last_update, fields_to_load);
+    return ParseDocsMapReply(FetchConfigs(last_update, fields_to_load));
+}
+
+Client::Reply Client::WaitForDocsMapUpdate(
+    const Timestamp& last_update,
+    const std::vector<std::string>& fields_to_load,
+    std::chrono::milliseconds wait_timeout
+) {
+    return ParseDocsMapReply(FetchConfigs(last_update, fields_to_load, wait_timeout));
+}
 
+Client::Reply Client::ParseDocsMapReply(const formats::json::Value& json_value) {
     Reply reply;
     reply.docs_map.Parse(json_value["configs"], true);
     reply.removed = json_value["removed"].As<std::vector<std::string>>({});
@@ -92,8 +102,11 @@ Client::FetchJson(const std::optional<Timestamp>& last_update, const std::vector
     return reply;
 }
 
-formats::json::Value
-Client::FetchConfigs(const std::optional<Timestamp>& last_update, const std::vector<std::string>& fields_to_load) {
+formats::json::Value Client::FetchConfigs(
+    const std::optional<Timestamp>& last_update,
+    const std::vector<std::string>& fields_to_load,
+    std::optional<std::chrono::milliseconds> wait_timeout
+) {
     formats::json::StringBuilder body;
 
     {
@@ -117,10 +130,16 @@ Client::FetchConfigs(const std::optional<Timestamp>& last_update, const std::vec
             body.Key("service");
             WriteToStream(config_.service_name, body);
         }
+
+        if (wait_timeout) {
+            body.Key("wait_timeout_ms");
+            WriteToStream(wait_timeout->count(), body);
+        }
     }
 
     LOG_TRACE() << "request body: " << body.GetStringView();
-    auto json = FetchConfigsValues(body.GetStringView());
+    const auto timeout = config_.timeout + wait_timeout.value_or(std::chrono::milliseconds{0});
+    auto json = FetchConfigsValues(body.GetStringView(), timeout);
 
     return formats::json::FromString(json);
 }
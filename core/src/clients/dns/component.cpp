@@ -28,6 +28,7 @@ ResolverConfig ParseResolverConfig(const components::ComponentConfig& component_
         component_config["cache_max_reply_ttl"].As<std::chrono::milliseconds>(config.cache_max_reply_ttl);
     config.cache_failure_ttl =
         component_config["cache_failure_ttl"].As<std::chrono::milliseconds>(config.cache_failure_ttl);
+    config.cache_prefetch_ratio = component_config["cache-prefetch-ratio"].As<double>(config.cache_prefetch_ratio);
     return config;
 }
 
@@ -100,6 +101,14 @@ properties:
         type: string
         description: TTL for network failures caching
         defaultDescription: 5s
+    cache-prefetch-ratio:
+        type: number
+        description: |
+            part of the reply TTL at the end of which a resolution of the name
+            refreshes the cached reply in background
+        defaultDescription: 0.1
+        minimum: 0
+        maximum: 1
 )");
 }
 
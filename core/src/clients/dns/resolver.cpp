@@ -2,6 +2,7 @@
 
 #include <arpa/inet.h>
 #include <netinet/in.h>
+#include <algorithm>
 #include <cctype>
 #include <chrono>
 #include <string_view>
@@ -156,6 +157,9 @@ private:
         AddrVector addrs;
         std::chrono::steady_clock::time_point expiration;
         bool is_failure{false};
+        // the reply is refreshed on access starting from this margin before
+        // the expiration
+        std::chrono::milliseconds update_margin{0};
     };
 
     template <typename Mutex>
@@ -182,6 +186,7 @@ private:
     const std::chrono::milliseconds net_cache_update_margin_;
     const std::chrono::milliseconds net_cache_max_reply_ttl_;
     const std::chrono::milliseconds net_cache_failure_ttl_;
+    const double net_cache_prefetch_ratio_;
     cache::NWayLRU<std::string, NetCacheEntry> net_cache_;
     concurrent::MutexSet<std::string> net_cache_update_mutexes_;
     utils::impl::WaitTokenStorage wait_token_storage_;
@@ -193,6 +198,7 @@ Resolver::Impl::Impl(engine::TaskProcessor& fs_task_processor, const ResolverCon
       net_cache_update_margin_{config.network_timeout},
       net_cache_max_reply_ttl_{config.cache_max_reply_ttl},
       net_cache_failure_ttl_{config.cache_failure_ttl},
+      net_cache_prefetch_ratio_{config.cache_prefetch_ratio},
       net_cache_{config.cache_ways, config.cache_size_per_way},
       net_cache_update_mutexes_(config.cache_ways) {}
 
@@ -236,7 +242,7 @@ Resolver::Impl::NetCacheResult Resolver::Impl::QueryNetCache(const std::string&
         ++source_counters_.cached_stale;
     }
 
-    if (cached->expiration - now >= net_cache_update_margin_) {
+    if (cached->expiration - now >= cached->update_margin) {
         result.status = NetCacheResult::Status::kHitReply;
     } else {
         result.status = NetCacheResult::Status::kHitReplyWithUpdate;
@@ -342,8 +348,14 @@ void Resolver::Impl::FinishNetUpdate(
     if (addrs) *addrs = response.addrs;
     if (effective_ttl.count() > 0) {
         LOG_TRACE() << "Updating cache for '" << name << '\'';
+        const auto update_margin = std::max(
+            net_cache_update_margin_,
+            std::chrono::duration_cast<std::chrono::milliseconds>(effective_ttl * net_cache_prefetch_ratio_)
+        );
         net_cache_.Put(
-            name, NetCacheEntry{std::move(response.addrs), utils::datetime::MockSteadyNow() + effective_ttl}
+            name,
+            NetCacheEntry{
+                std::move(response.addrs), utils::datetime::MockSteadyNow() + effective_ttl, false, update_margin}
         );
     } else {
         LOG_TRACE() << "Skipping cache update for '" << name << '\'';
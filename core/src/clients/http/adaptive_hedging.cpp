@@ -0,0 +1,100 @@
+#include <userver/clients/http/adaptive_hedging.hpp>
+
+#include <algorithm>
+
+#include <clients/http/destination_statistics.hpp>
+#include <userver/clients/http/client.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+AdaptiveHedging::AdaptiveHedging(
+    const Client& client,
+    std::string destination,
+    const AdaptiveHedgingSettings& settings
+)
+    : client_(client),
+      destination_(std::move(destination)),
+      settings_(settings),
+      budget_(settings.budget),
+      delay_ms_(settings.default_delay.count()) {
+    UINVARIANT(settings_.min_delay <= settings_.max_delay, "min_delay must not exceed max_delay");
+    UINVARIANT(settings_.percentile > 0 && settings_.percentile <= 100, "percentile must be in (0, 100]");
+}
+
+utils::hedging::HedgingSettings AdaptiveHedging::GetHedgingSettings() {
+    utils::hedging::HedgingSettings settings;
+    settings.max_attempts = settings_.max_attempts;
+    settings.hedging_delay = GetHedgingDelay();
+    settings.timeout_all = settings_.timeout_all;
+    return settings;
+}
+
+std::chrono::milliseconds AdaptiveHedging::GetHedgingDelay() {
+    const auto now = Clock::now().time_since_epoch().count();
+    auto next_update = next_update_.load(std::memory_order_relaxed);
+
+    // A single caller per update period computes the percentile
+    if (now >= next_update &&
+        next_update_.compare_exchange_strong(
+            next_update,
+            now + std::chrono::duration_cast<Clock::duration>(settings_.update_period).count(),
+            std::memory_order_relaxed
+        )) {
+        const auto percentile = client_.GetDestinationStatistics().GetRecentTimingsPercentile(
+            destination_, settings_.percentile, settings_.min_samples
+        );
+        const auto delay =
+            std::clamp(percentile.value_or(settings_.default_delay), settings_.min_delay, settings_.max_delay);
+        delay_ms_.store(delay.count(), std::memory_order_relaxed);
+    }
+
+    return std::chrono::milliseconds{delay_ms_.load(std::memory_order_relaxed)};
+}
+
+bool AdaptiveHedging::TryStartExtraAttempt() noexcept {
+    if (!budget_.CanRetry()) return false;
+    budget_.AccountFail();
+    return true;
+}
+
+void AdaptiveHedging::AccountSuccess() noexcept { budget_.AccountOk(); }
+
+AdaptiveHedgingStrategy::AdaptiveHedgingStrategy(std::function<Request()> make_request, AdaptiveHedging& hedging)
+    : make_request_(std::move(make_request)), hedging_(&hedging) {}
+
+std::optional<ResponseFuture> AdaptiveHedgingStrategy::Create(std::size_t attempt) {
+    if (attempt != 0 && !hedging_->TryStartExtraAttempt()) return std::nullopt;
+    return make_request_().async_perform();
+}
+
+std::optional<std::chrono::milliseconds> AdaptiveHedgingStrategy::ProcessReply(ResponseFuture&& future) {
+    std::shared_ptr<Response> response;
+    try {
+        response = future.Get();
+    } catch (const std::exception&) {
+        return std::chrono::milliseconds::zero();
+    }
+
+    if (static_cast<int>(response->status_code()) >= 500) return std::chrono::milliseconds::zero();
+
+    hedging_->AccountSuccess();
+    reply_ = std::move(response);
+    return std::nullopt;
+}
+
+std::optional<std::shared_ptr<Response>> AdaptiveHedgingStrategy::ExtractReply() { return std::move(reply_); }
+
+void AdaptiveHedgingStrategy::Finish(ResponseFuture&& future) { future.Cancel(); }
+
+std::optional<std::shared_ptr<Response>>
+HedgeRequest(std::function<Request()> make_request, AdaptiveHedging& hedging) {
+    auto settings = hedging.GetHedgingSettings();
+    return utils::hedging::HedgeRequest(AdaptiveHedgingStrategy{std::move(make_request), hedging}, settings);
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,90 @@
+#include <userver/clients/http/adaptive_hedging.hpp>
+
+#include <atomic>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/http_client.hpp>
+#include <userver/utest/simple_server.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using HttpResponse = utest::SimpleServer::Response;
+using HttpRequest = utest::SimpleServer::Request;
+
+constexpr std::string_view kOkResponse = "HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: 2\r\n\r\nok";
+
+}  // namespace
+
+UTEST(HttpClientAdaptiveHedging, DefaultDelayWithoutStatistics) {
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    clients::http::AdaptiveHedgingSettings settings;
+    settings.default_delay = std::chrono::milliseconds{42};
+    clients::http::AdaptiveHedging hedging{*http_client_ptr, "unknown-destination", settings};
+
+    EXPECT_EQ(hedging.GetHedgingDelay(), std::chrono::milliseconds{42});
+    EXPECT_EQ(hedging.GetHedgingSettings().hedging_delay, std::chrono::milliseconds{42});
+}
+
+UTEST(HttpClientAdaptiveHedging, DelayIsClamped) {
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    clients::http::AdaptiveHedgingSettings settings;
+    settings.default_delay = std::chrono::milliseconds{5000};
+    settings.max_delay = std::chrono::milliseconds{100};
+    clients::http::AdaptiveHedging hedging{*http_client_ptr, "unknown-destination", settings};
+
+    EXPECT_EQ(hedging.GetHedgingDelay(), std::chrono::milliseconds{100});
+}
+
+UTEST(HttpClientAdaptiveHedging, BudgetLimitsExtraAttempts) {
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    clients::http::AdaptiveHedgingSettings settings;
+    settings.budget.max_tokens = 10;
+    settings.budget.token_ratio = 0.5;
+    clients::http::AdaptiveHedging hedging{*http_client_ptr, "destination", settings};
+
+    int extra_attempts = 0;
+    while (hedging.TryStartExtraAttempt()) {
+        ++extra_attempts;
+        ASSERT_LT(extra_attempts, 100);
+    }
+    EXPECT_EQ(extra_attempts, 5);
+
+    hedging.AccountSuccess();
+    hedging.AccountSuccess();
+    EXPECT_TRUE(hedging.TryStartExtraAttempt());
+    EXPECT_FALSE(hedging.TryStartExtraAttempt());
+}
+
+UTEST(HttpClientAdaptiveHedging, HedgesSlowRequest) {
+    const auto requests = std::make_shared<std::atomic<int>>(0);
+    const utest::SimpleServer http_server{[requests](const HttpRequest&) {
+        if (++*requests == 1) engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+        return HttpResponse{std::string{kOkResponse}, HttpResponse::kWriteAndClose};
+    }};
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    clients::http::AdaptiveHedgingSettings settings;
+    settings.default_delay = std::chrono::milliseconds{20};
+    settings.max_attempts = 2;
+    settings.timeout_all = utest::kMaxTestWaitTime;
+    clients::http::AdaptiveHedging hedging{*http_client_ptr, "destination", settings};
+
+    const auto response = clients::http::HedgeRequest(
+        [&] {
+            return http_client_ptr->CreateRequest().get(http_server.GetBaseUrl()).timeout(utest::kMaxTestWaitTime);
+        },
+        hedging
+    );
+    ASSERT_TRUE(response);
+    EXPECT_EQ((*response)->body_view(), "ok");
+    EXPECT_EQ(*requests, 2);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,148 @@
+#include <clients/http/address_balancer.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::impl {
+
+namespace {
+
+// Weight of the previous latency EWMA value is (kLatencyDecay - 1) / kLatencyDecay
+constexpr std::int64_t kLatencyDecay = 8;
+
+}  // namespace
+
+struct AddressBalancer::Address final {
+    Address(std::string address, const Settings& settings) : address(std::move(address)), settings(settings) {}
+
+    bool IsEjected(Clock::time_point now) const noexcept {
+        return now.time_since_epoch().count() < ejected_until.load(std::memory_order_relaxed);
+    }
+
+    // Lower is better, addresses without replies yet are preferred
+    std::uint64_t GetLoad() const noexcept {
+        const auto latency = std::max<std::int64_t>(latency_us.load(std::memory_order_relaxed), 1);
+        return (in_flight.load(std::memory_order_relaxed) + 1) * static_cast<std::uint64_t>(latency);
+    }
+
+    const std::string address;
+    const Settings settings;
+
+    std::atomic<std::size_t> in_flight{0};
+    std::atomic<std::int64_t> latency_us{0};
+    std::atomic<std::size_t> consecutive_failures{0};
+    std::atomic<Clock::rep> ejected_until{0};
+};
+
+AddressBalancer::Lease::Lease(std::shared_ptr<Address> address) noexcept : address_(std::move(address)) {
+    UASSERT(address_);
+    ++address_->in_flight;
+}
+
+AddressBalancer::Lease& AddressBalancer::Lease::operator=(Lease&& other) noexcept {
+    if (this != &other) {
+        Release();
+        address_ = std::move(other.address_);
+    }
+    return *this;
+}
+
+AddressBalancer::Lease::~Lease() { Release(); }
+
+const std::string& AddressBalancer::Lease::GetAddress() const noexcept {
+    UASSERT(address_);
+    return address_->address;
+}
+
+void AddressBalancer::Lease::AccountSuccess(std::chrono::microseconds latency) noexcept {
+    if (!address_) return;
+
+    address_->consecutive_failures.store(0, std::memory_order_relaxed);
+
+    // Concurrent updates may lose a sample, that is fine for an estimate
+    const auto old_latency = address_->latency_us.load(std::memory_order_relaxed);
+    const auto new_latency =
+        old_latency == 0 ? latency.count() : old_latency + (latency.count() - old_latency) / kLatencyDecay;
+    address_->latency_us.store(new_latency, std::memory_order_relaxed);
+
+    Release();
+}
+
+void AddressBalancer::Lease::AccountFailure() noexcept {
+    if (!address_) return;
+
+    if (++address_->consecutive_failures >= address_->settings.ejection_failures) {
+        address_->consecutive_failures.store(0, std::memory_order_relaxed);
+        const auto ejected_until = Clock::now() + address_->settings.ejection_time;
+        address_->ejected_until.store(ejected_until.time_since_epoch().count(), std::memory_order_relaxed);
+    }
+
+    Release();
+}
+
+void AddressBalancer::Lease::Release() noexcept {
+    if (!address_) return;
+    --address_->in_flight;
+    address_.reset();
+}
+
+AddressBalancer::AddressBalancer() : AddressBalancer(Settings()) {}
+
+AddressBalancer::AddressBalancer(const Settings& settings) : settings_(settings) {}
+
+AddressBalancer::~AddressBalancer() = default;
+
+AddressBalancer::Lease AddressBalancer::Pick(const std::string& host, const std::vector<std::string>& addresses) {
+    if (addresses.empty()) return {};
+
+    auto hosts = hosts_.Lock();
+    auto& known = (*hosts)[host];
+
+    const bool is_same_addresses =
+        known.size() == addresses.size() &&
+        std::equal(known.begin(), known.end(), addresses.begin(), [](const auto& state, const auto& address) {
+            return state->address == address;
+        });
+    if (!is_same_addresses) {
+        std::vector<std::shared_ptr<Address>> updated;
+        updated.reserve(addresses.size());
+        for (const auto& address : addresses) {
+            const auto it = std::find_if(known.begin(), known.end(), [&address](const auto& state) {
+                return state->address == address;
+            });
+            updated.push_back(it != known.end() ? *it : std::make_shared<Address>(address, settings_));
+        }
+        known = std::move(updated);
+    }
+
+    const auto now = Clock::now();
+    std::vector<const std::shared_ptr<Address>*> candidates;
+    candidates.reserve(known.size());
+    for (const auto& state : known) {
+        if (!state->IsEjected(now)) candidates.push_back(&state);
+    }
+    // Do not let the failures of a few addresses overload the rest of them
+    if (candidates.size() * 2 < known.size()) {
+        candidates.clear();
+        for (const auto& state : known) candidates.push_back(&state);
+    }
+
+    auto index = utils::RandRange(candidates.size());
+    if (candidates.size() > 1) {
+        auto other = utils::RandRange(candidates.size() - 1);
+        if (other >= index) ++other;
+        if ((*candidates[other])->GetLoad() < (*candidates[index])->GetLoad()) index = other;
+    }
+
+    return Lease{*candidates[index]};
+}
+
+}  // namespace clients::http::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/concurrent/variable.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::impl {
+
+/// Client-side balancing among the addresses a host name resolves to.
+///
+/// Picks the address by power of two choices on the in-flight requests count
+/// and the latency EWMA, temporarily ejects the addresses that fail several
+/// requests in a row. At most half of the addresses of a host are ejected at
+/// a time.
+class AddressBalancer final {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Settings final {
+        /// Consecutive failures (5xx or network errors) that eject an address
+        std::size_t ejection_failures{5};
+        std::chrono::milliseconds ejection_time{std::chrono::seconds{10}};
+    };
+
+    struct Address;
+
+    /// Holds the in-flight request to the picked address
+    class Lease final {
+    public:
+        Lease() noexcept = default;
+        explicit Lease(std::shared_ptr<Address> address) noexcept;
+
+        Lease(Lease&&) noexcept = default;
+        Lease& operator=(Lease&&) noexcept;
+        ~Lease();
+
+        explicit operator bool() const noexcept { return address_ != nullptr; }
+
+        /// IP address string
+        const std::string& GetAddress() const noexcept;
+
+        void AccountSuccess(std::chrono::microseconds latency) noexcept;
+        void AccountFailure() noexcept;
+
+    private:
+        void Release() noexcept;
+
+        std::shared_ptr<Address> address_;
+    };
+
+    AddressBalancer();
+    explicit AddressBalancer(const Settings& settings);
+    ~AddressBalancer();
+
+    /// Returns an empty lease if `addresses` is empty. `host` identifies the
+    /// host and port, the state of `host` addresses missing from `addresses`
+    /// is dropped.
+    Lease Pick(const std::string& host, const std::vector<std::string>& addresses);
+
+private:
+    const Settings settings_;
+    concurrent::Variable<std::unordered_map<std::string, std::vector<std::shared_ptr<Address>>>, std::mutex> hosts_;
+};
+
+}  // namespace clients::http::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,75 @@
+#include <clients/http/address_balancer.hpp>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using AddressBalancer = clients::http::impl::AddressBalancer;
+
+const std::string kHost = "example.com:80";
+const std::vector<std::string> kAddresses = {"10.0.0.1", "10.0.0.2"};
+
+}  // namespace
+
+TEST(HttpAddressBalancer, Empty) {
+    AddressBalancer balancer;
+    EXPECT_FALSE(balancer.Pick(kHost, {}));
+}
+
+TEST(HttpAddressBalancer, PrefersLessLoaded) {
+    AddressBalancer balancer;
+
+    for (int i = 0; i < 10; ++i) {
+        auto busy = balancer.Pick(kHost, kAddresses);
+        ASSERT_TRUE(busy);
+        const auto idle = balancer.Pick(kHost, kAddresses);
+        ASSERT_TRUE(idle);
+        EXPECT_NE(busy.GetAddress(), idle.GetAddress());
+    }
+}
+
+TEST(HttpAddressBalancer, EjectsFailingAddress) {
+    AddressBalancer::Settings settings;
+    settings.ejection_failures = 2;
+    AddressBalancer balancer{settings};
+
+    std::string failing;
+    for (std::size_t i = 0; i < settings.ejection_failures; ++i) {
+        auto lease = balancer.Pick(kHost, {kAddresses[0]});
+        failing = lease.GetAddress();
+        lease.AccountFailure();
+    }
+
+    for (int i = 0; i < 10; ++i) {
+        auto lease = balancer.Pick(kHost, kAddresses);
+        EXPECT_NE(lease.GetAddress(), failing);
+        lease.AccountSuccess(std::chrono::milliseconds{1});
+    }
+}
+
+TEST(HttpAddressBalancer, DoesNotEjectMostAddresses) {
+    AddressBalancer::Settings settings;
+    settings.ejection_failures = 1;
+    AddressBalancer balancer{settings};
+
+    for (int i = 0; i < 10; ++i) {
+        auto lease = balancer.Pick(kHost, kAddresses);
+        ASSERT_TRUE(lease);
+        lease.AccountFailure();
+    }
+    EXPECT_TRUE(balancer.Pick(kHost, kAddresses));
+}
+
+TEST(HttpAddressBalancer, FollowsResolvedAddresses) {
+    AddressBalancer balancer;
+    EXPECT_TRUE(balancer.Pick(kHost, kAddresses));
+
+    const std::string updated = "10.0.0.3";
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(balancer.Pick(kHost, {updated}).GetAddress(), updated);
+    }
+}
+
+USERVER_NAMESPACE_END
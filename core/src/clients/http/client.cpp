@@ -3,6 +3,7 @@
 #include <chrono>
 #include <cstdlib>
 #include <limits>
+#include <mutex>
 
 #include <moodycamel/concurrentqueue.h>
 
@@ -13,12 +14,17 @@
 #include <userver/utils/rand.hpp>
 #include <userver/utils/userver_info.hpp>
 
+#include <clients/http/address_balancer.hpp>
+#include <clients/http/destination_sharding.hpp>
 #include <clients/http/destination_statistics.hpp>
 #include <clients/http/easy_wrapper.hpp>
+#include <clients/http/request_coalescer.hpp>
+#include <clients/http/request_state.hpp>
 #include <clients/http/statistics.hpp>
 #include <clients/http/testsuite.hpp>
 #include <curl-ev/multi.hpp>
 #include <curl-ev/ratelimit.hpp>
+#include <curl-ev/share.hpp>
 #include <engine/ev/thread_pool.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -28,11 +34,27 @@ namespace {
 
 const std::string kIoThreadName = "curl";
 const auto kEasyReinitPeriod = std::chrono::minutes{1};
+const auto kWarmUpTimeout = std::chrono::seconds{1};
 
 // cURL accepts options as long, but we use size_t to avoid writing checks.
 // Clamp too high values to LONG_MAX, it shouldn't matter for these magnitudes.
 long ClampToLong(size_t value) { return std::min<size_t>(value, std::numeric_limits<long>::max()); }
 
+// All the clients of the process resume the TLS sessions of each other
+std::shared_ptr<curl::share> GetTlsSessionShare() {
+    static std::mutex mutex;
+    static std::weak_ptr<curl::share> instance;
+
+    const std::lock_guard lock{mutex};
+    auto share = instance.lock();
+    if (!share) {
+        share = std::make_shared<curl::share>();
+        share->set_share_ssl_session(true);
+        instance = share;
+    }
+    return share;
+}
+
 const tracing::TracingManagerBase* GetTracingManager(const ClientSettings& settings) {
     UASSERT(settings.tracing_manager);
     return settings.tracing_manager;
@@ -48,9 +70,12 @@ Client::Client(
     : deadline_propagation_config_(settings.deadline_propagation),
       cancellation_policy_(settings.cancellation_policy),
       destination_statistics_(std::make_shared<DestinationStatistics>()),
+      request_coalescer_(std::make_shared<impl::RequestCoalescer>()),
+      address_balancer_(std::make_shared<impl::AddressBalancer>()),
       statistics_(settings.io_threads),
       fs_task_processor_(fs_task_processor),
       user_agent_(utils::GetUserverIdentifier()),
+      warm_connections_(settings.warm_connections),
       connect_rate_limiter_(std::make_shared<curl::ConnectRateLimiter>()),
       tracing_manager_(GetTracingManager(settings)),
       plugin_pipeline_(std::move(plugin_pipeline)) {
@@ -69,20 +94,35 @@ Client::Client(
     // libcurl synchronously reads some of /etc/* files.
     // As we want httpclient to be non-blocking, we have to shift curl's init code
     // to a fs task processor.
-    engine::AsyncNoSpan(fs_task_processor_, [this, io_threads] {
+    engine::AsyncNoSpan(fs_task_processor_, [this, io_threads, share_tls_sessions = settings.share_tls_sessions] {
         for (std::size_t i = 0; i < io_threads; ++i) {
             multis_.push_back(std::make_unique<curl::multi>(thread_pool_->NextThread(), connect_rate_limiter_));
         }
+
+        if (share_tls_sessions) tls_session_share_ = GetTlsSessionShare();
     }).Get();
 
+    if (settings.shard_by_destination) {
+        destination_sharding_ = std::make_unique<impl::DestinationSharding>(multis_);
+    }
+
     easy_reinit_task_.Start("http_easy_reinit", utils::PeriodicTask::Settings(kEasyReinitPeriod), [this] {
         ReinitEasy();
     });
 
     SetConfig({});
+
+    if (!warm_connections_.empty()) {
+        warm_connections_task_.Start(
+            "http_warm_connections",
+            utils::PeriodicTask::Settings(settings.warm_connections_period, {utils::PeriodicTask::Flags::kNow}),
+            [this] { WarmUpConnections(); }
+        );
+    }
 }
 
 Client::~Client() {
+    warm_connections_task_.Stop();
     easy_reinit_task_.Stop();
 
     // We have to destroy *this only when all the requests are finished, because
@@ -107,46 +147,79 @@ Client::~Client() {
 }
 
 Request Client::CreateRequest() {
-    auto request = [this] {
-        auto easy = TryDequeueIdle();
-        if (easy) {
-            auto idx = FindMultiIndex(easy->GetMulti());
-            auto wrapper = impl::EasyWrapper{std::move(easy), *this};
+    auto easy = TryDequeueIdle();
+    if (!easy) return CreateBoundRequest(utils::RandRange(multis_.size()));
+
+    auto idx = FindMultiIndex(easy->GetMulti());
+    auto wrapper = impl::EasyWrapper{std::move(easy), *this};
+    Request request{
+        std::move(wrapper),
+        statistics_[idx].CreateRequestStats(),
+        destination_statistics_,
+        resolver_,
+        plugin_pipeline_,
+        *tracing_manager_.GetBase()};
+    PrepareRequest(request);
+    return request;
+}
+
+std::vector<ResponseFuture> Client::AsyncPerformBatch(
+    std::vector<Request>& requests,
+    utils::impl::SourceLocation location
+) {
+    std::vector<ResponseFuture> futures;
+    futures.reserve(requests.size());
+
+    curl::easy::perform_batch batch;
+    batch.reserve(requests.size());
+    for (auto& request : requests) {
+        if (auto coalesced = request.pimpl_->JoinOrStartCoalesced()) {
+            futures.push_back(std::move(*coalesced));
+            continue;
+        }
+        futures.emplace_back(request.pimpl_->async_perform(batch, location), request.pimpl_);
+    }
+
+    curl::easy::async_perform_batch(std::move(batch));
+    return futures;
+}
+
+Request Client::CreateBoundRequest(std::size_t multi_index) {
+    UASSERT(multi_index < multis_.size());
+    auto& multi = multis_[multi_index];
+
+    auto request = [&] {
+        try {
+            auto wrapper = engine::AsyncNoSpan(fs_task_processor_, [this, &multi] {
+                               return impl::EasyWrapper{easy_.Get()->GetBoundBlocking(*multi), *this};
+                           }).Get();
             return Request{
                 std::move(wrapper),
-                statistics_[idx].CreateRequestStats(),
+                statistics_[multi_index].CreateRequestStats(),
                 destination_statistics_,
                 resolver_,
                 plugin_pipeline_,
                 *tracing_manager_.GetBase()};
-        } else {
-            auto i = utils::RandRange(multis_.size());
-            auto& multi = multis_[i];
-
-            try {
-                auto wrapper = engine::AsyncNoSpan(fs_task_processor_, [this, &multi] {
-                                   return impl::EasyWrapper{easy_.Get()->GetBoundBlocking(*multi), *this};
-                               }).Get();
-                return Request{
-                    std::move(wrapper),
-                    statistics_[i].CreateRequestStats(),
-                    destination_statistics_,
-                    resolver_,
-                    plugin_pipeline_,
-                    *tracing_manager_.GetBase()};
-            } catch (engine::WaitInterruptedException&) {
-                throw clients::http::CancelException("wait interrupted", {}, ErrorKind::kCancel);
-            } catch (engine::TaskCancelledException&) {
-                throw clients::http::CancelException("task cancelled", {}, ErrorKind::kCancel);
-            }
+        } catch (engine::WaitInterruptedException&) {
+            throw clients::http::CancelException("wait interrupted", {}, ErrorKind::kCancel);
+        } catch (engine::TaskCancelledException&) {
+            throw clients::http::CancelException("task cancelled", {}, ErrorKind::kCancel);
         }
     }();
+    PrepareRequest(request);
+    return request;
+}
 
+void Client::PrepareRequest(Request& request) {
     if (testsuite_config_) {
         request.SetTestsuiteConfig(testsuite_config_);
     }
     auto urls = allowed_urls_extra_.Read();
     request.SetAllowedUrlsExtra(*urls);
+    request.SetRequestCoalescer(request_coalescer_);
+    request.SetAddressBalancer(address_balancer_);
+    if (destination_sharding_) request.SetDestinationSharding(destination_sharding_.get());
+    if (tls_session_share_) request.SetTlsSessionShare(tls_session_share_);
 
     if (user_agent_) {
         request.user_agent(*user_agent_);
@@ -160,8 +233,29 @@ Request Client::CreateRequest() {
     }
     request.SetDeadlinePropagationConfig(deadline_propagation_config_);
     request.SetCancellationPolicy(cancellation_policy_);
+}
 
-    return request;
+void Client::WarmUpConnections() {
+    // Requests are started concurrently, so that a separate connection is
+    // established (or an idle one is reused) for each of them.
+    std::vector<ResponseFuture> futures;
+    for (const auto& destination : warm_connections_) {
+        for (std::size_t i = 0; i < multis_.size(); ++i) {
+            for (std::size_t n = 0; n < destination.connections; ++n) {
+                auto request = CreateBoundRequest(i);
+                request.head(destination.url).timeout(kWarmUpTimeout);
+                futures.push_back(request.async_perform());
+            }
+        }
+    }
+
+    for (auto& future : futures) {
+        try {
+            future.Get();
+        } catch (const std::exception& e) {
+            LOG_WARNING() << "Failed to warm up a connection: " << e;
+        }
+    }
 }
 
 void Client::SetMultiplexingEnabled(bool enabled) {
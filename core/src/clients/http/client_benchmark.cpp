@@ -0,0 +1,136 @@
+#include <userver/clients/http/client.hpp>
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/exception.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/internal/net/net_listener.hpp>
+#include <userver/tracing/manager.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kResponse = "HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n";
+constexpr std::string_view kHeadersEnd = "\r\n\r\n";
+constexpr auto kTimeout = std::chrono::seconds{10};
+
+void ServeConnection(engine::io::Socket socket) {
+    std::array<char, 4096> chunk{};
+    std::string buffer;
+    std::string replies;
+
+    while (!engine::current_task::ShouldCancel()) {
+        const auto size = socket.RecvSome(chunk.data(), chunk.size(), {});
+        if (size == 0) return;
+        buffer.append(chunk.data(), size);
+
+        // Requests have no bodies, replying to each of the complete ones
+        replies.clear();
+        for (auto pos = buffer.find(kHeadersEnd); pos != std::string::npos; pos = buffer.find(kHeadersEnd)) {
+            buffer.erase(0, pos + kHeadersEnd.size());
+            replies += kResponse;
+        }
+        if (!replies.empty()) {
+            [[maybe_unused]] const auto sent = socket.SendAll(replies.data(), replies.size(), {});
+        }
+    }
+}
+
+// Keep-alive HTTP server that replies 200 to every request
+class BenchmarkServer final {
+public:
+    BenchmarkServer()
+        : listener_(internal::net::IpVersion::kV4),
+          acceptor_(engine::AsyncNoSpan([this] {
+              std::vector<engine::TaskWithResult<void>> connections;
+              while (!engine::current_task::ShouldCancel()) {
+                  try {
+                      connections.push_back(engine::AsyncNoSpan([socket = listener_.socket.Accept({})]() mutable {
+                          try {
+                              ServeConnection(std::move(socket));
+                          } catch (const engine::io::IoException&) {
+                              // connection closed or cancelled
+                          }
+                      }));
+                  } catch (const engine::io::IoException&) {
+                      return;
+                  }
+              }
+          })) {}
+
+    ~BenchmarkServer() { acceptor_.SyncCancel(); }
+
+    std::string GetUrl() const { return "http://127.0.0.1:" + std::to_string(listener_.Port()) + "/"; }
+
+private:
+    internal::net::TcpListener listener_;
+    engine::TaskWithResult<void> acceptor_;
+};
+
+clients::http::Client MakeClient() {
+    static const tracing::GenericTracingManager kTracingManager{
+        tracing::Format::kYandexTaxi, tracing::Format::kYandexTaxi};
+
+    clients::http::ClientSettings settings;
+    settings.io_threads = 2;
+    settings.tracing_manager = &kTracingManager;
+    return clients::http::Client{
+        std::move(settings),
+        engine::current_task::GetTaskProcessor(),
+        std::vector<utils::NotNull<clients::http::Plugin*>>{}};
+}
+
+}  // namespace
+
+void http_client_perform_each(benchmark::State& state) {
+    engine::RunStandalone(2, [&] {
+        const BenchmarkServer server;
+        auto client = MakeClient();
+        const auto url = server.GetUrl();
+        const auto requests_count = static_cast<std::size_t>(state.range(0));
+
+        std::vector<clients::http::ResponseFuture> futures;
+        futures.reserve(requests_count);
+        for ([[maybe_unused]] auto _ : state) {
+            for (std::size_t i = 0; i < requests_count; ++i) {
+                futures.push_back(client.CreateRequest().get(url).timeout(kTimeout).async_perform());
+            }
+            for (auto& future : futures) benchmark::DoNotOptimize(future.Get());
+            futures.clear();
+        }
+        state.SetItemsProcessed(state.iterations() * requests_count);
+    });
+}
+BENCHMARK(http_client_perform_each)->Arg(50)->Arg(200);
+
+void http_client_perform_batch(benchmark::State& state) {
+    engine::RunStandalone(2, [&] {
+        const BenchmarkServer server;
+        auto client = MakeClient();
+        const auto url = server.GetUrl();
+        const auto requests_count = static_cast<std::size_t>(state.range(0));
+
+        std::vector<clients::http::Request> requests;
+        requests.reserve(requests_count);
+        for ([[maybe_unused]] auto _ : state) {
+            for (std::size_t i = 0; i < requests_count; ++i) {
+                requests.push_back(client.CreateRequest().get(url).timeout(kTimeout));
+            }
+            for (auto& future : client.AsyncPerformBatch(requests)) benchmark::DoNotOptimize(future.Get());
+            requests.clear();
+        }
+        state.SetItemsProcessed(state.iterations() * requests_count);
+    });
+}
+BENCHMARK(http_client_perform_batch)->Arg(50)->Arg(200);
+
+USERVER_NAMESPACE_END
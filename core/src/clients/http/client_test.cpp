@@ -1,5 +1,6 @@
 #include <userver/clients/http/client.hpp>
 
+#include <atomic>
 #include <set>
 
 #include <fmt/format.h>
@@ -7,6 +8,7 @@
 #include <boost/algorithm/string/trim.hpp>
 
 #include <clients/http/client_utils_test.hpp>
+#include <clients/http/statistics.hpp>
 #include <clients/http/testsuite.hpp>
 #include <engine/task/task_processor.hpp>
 #include <userver/clients/dns/resolver.hpp>
@@ -23,8 +25,10 @@
 #include <userver/http/common_headers.hpp>
 #include <userver/http/http_version.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/tracing/manager.hpp>
 #include <userver/tracing/tracing.hpp>
 #include <userver/utils/async.hpp>
+#include <userver/utils/text_light.hpp>
 #include <userver/utils/userver_info.hpp>
 
 #include <userver/utest/http_client.hpp>
@@ -176,6 +180,31 @@ struct EchoCallback {
     }
 };
 
+HttpResponse ChunkedEchoCallback(const HttpRequest& request) {
+    LOG_INFO() << "HTTP Server receive: " << request;
+
+    const auto data_pos = request.find("\r\n\r\n");
+    if (data_pos == std::string::npos || !utils::text::EndsWith(request, "\r\n0\r\n\r\n")) {
+        return {{}, HttpResponse::kTryReadMore};
+    }
+    EXPECT_NE(request.find("Transfer-Encoding: chunked"), std::string::npos) << request;
+
+    std::string payload;
+    auto pos = data_pos + 4;
+    while (true) {
+        const auto size_end = request.find("\r\n", pos);
+        const auto chunk_size = std::stoul(request.substr(pos, size_end - pos), nullptr, 16);
+        if (chunk_size == 0) break;
+        payload += request.substr(size_end + 2, chunk_size);
+        pos = size_end + 2 + chunk_size + 2;
+    }
+
+    return {
+        "HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: " + std::to_string(payload.size()) + "\r\n\r\n" +
+            payload,
+        HttpResponse::kWriteAndClose};
+}
+
 struct ValidatingSharedCallback {
     const std::shared_ptr<std::string> method_name = std::make_shared<std::string>();
 
@@ -595,6 +624,192 @@ UTEST(HttpClient, PostEcho) {
     }
 }
 
+UTEST(HttpClient, PostSharedData) {
+    EchoCallback cb;
+    const utest::SimpleServer http_server{cb};
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    const auto data = std::make_shared<const std::string>(kTestData);
+    std::vector<clients::http::ResponseFuture> futures;
+    for (int i = 0; i < 3; ++i) {
+        futures.push_back(http_client_ptr->CreateRequest()
+                              .post(http_server.GetBaseUrl(), data)
+                              .retry(1)
+                              .http_version(USERVER_NAMESPACE::http::HttpVersion::k11)
+                              .timeout(kTimeout)
+                              .async_perform());
+    }
+
+    for (auto& future : futures) {
+        EXPECT_EQ(future.Get()->body(), kTestData);
+    }
+    EXPECT_EQ(*cb.responses_200, 3);
+    EXPECT_EQ(*data, kTestData);
+}
+
+UTEST(HttpClient, StreamedRequestBody) {
+    const utest::SimpleServer http_server{&ChunkedEchoCallback};
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    auto request = http_client_ptr->CreateRequest().post(http_server.GetBaseUrl()).timeout(kTimeout);
+    auto body = request.stream_body({}, 16);
+    auto future = request.async_perform();
+
+    std::string expected;
+    for (int i = 0; i < 10; ++i) {
+        auto chunk = fmt::format("chunk-{};", i);
+        expected += chunk;
+        EXPECT_TRUE(body.PushChunk(std::move(chunk)));
+        // Lets the transfer drain the queue and pause
+        engine::SleepFor(std::chrono::milliseconds{5});
+    }
+    body.Finish();
+
+    const auto response = future.Get();
+    EXPECT_EQ(response->status_code(), 200);
+    EXPECT_EQ(response->body(), expected);
+}
+
+UTEST(HttpClient, CoalescedRequests) {
+    const auto requests_received = std::make_shared<std::atomic<int>>(0);
+    const utest::SimpleServer http_server{[requests_received](const HttpRequest& request) {
+        ++*requests_received;
+        return sleep_callback_base(request, std::chrono::milliseconds{200});
+    }};
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    constexpr std::size_t kWaiters = 5;
+    std::vector<clients::http::ResponseFuture> futures;
+    for (std::size_t i = 0; i < kWaiters; ++i) {
+        futures.push_back(http_client_ptr->CreateRequest()
+                              .get(http_server.GetBaseUrl())
+                              .headers({{"X-Key", "same"}})
+                              .coalesce({"X-Key"})
+                              .timeout(kTimeout)
+                              .async_perform());
+    }
+    auto other = http_client_ptr->CreateRequest()
+                     .get(http_server.GetBaseUrl())
+                     .headers({{"X-Key", "other"}})
+                     .coalesce({"X-Key"})
+                     .timeout(kTimeout)
+                     .async_perform();
+
+    // Cancellation of a single waiter does not affect the shared request
+    futures.front().Cancel();
+    futures.erase(futures.begin());
+
+    const auto response = futures.front().Get();
+    EXPECT_EQ(response->status_code(), 200);
+    EXPECT_EQ(response->body(), std::string(4096, '@'));
+    for (auto& future : futures) {
+        EXPECT_EQ(future.Get(), response);
+    }
+    EXPECT_EQ(other.Get()->status_code(), 200);
+    EXPECT_EQ(*requests_received, 2);
+}
+
+UTEST(HttpClient, WarmConnections) {
+    const auto requests_received = std::make_shared<std::atomic<int>>(0);
+    const utest::SimpleServer http_server{[requests_received](const HttpRequest&) {
+        ++*requests_received;
+        return HttpResponse{"HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n", HttpResponse::kWriteAndContinue};
+    }};
+
+    static const tracing::GenericTracingManager kTracingManager{
+        tracing::Format::kYandexTaxi, tracing::Format::kYandexTaxi};
+    clients::http::ClientSettings settings;
+    settings.io_threads = 1;
+    settings.tracing_manager = &kTracingManager;
+    settings.warm_connections = {{http_server.GetBaseUrl(), 2}};
+    clients::http::Client http_client{
+        std::move(settings),
+        engine::current_task::GetTaskProcessor(),
+        std::vector<utils::NotNull<clients::http::Plugin*>>{}};
+
+    const auto get_stats = [&http_client] { return http_client.GetPoolStatistics().multi.at(0); };
+    const auto deadline = engine::Deadline::FromDuration(kTimeout);
+    while (get_stats().cold_connections.value < 2) {
+        ASSERT_FALSE(deadline.IsReached());
+        engine::SleepFor(std::chrono::milliseconds{10});
+    }
+    EXPECT_EQ(*requests_received, 2);
+
+    const auto response = http_client.CreateRequest().get(http_server.GetBaseUrl()).timeout(kTimeout).perform();
+    EXPECT_EQ(response->status_code(), 200);
+
+    const auto stats = get_stats();
+    EXPECT_EQ(stats.cold_connections.value, 2);
+    EXPECT_EQ(stats.warm_connections.value, 1);
+}
+
+UTEST(HttpClient, ShardByDestination) {
+    const utest::SimpleServer http_server{[](const HttpRequest&) {
+        return HttpResponse{"HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n", HttpResponse::kWriteAndContinue};
+    }};
+
+    static const tracing::GenericTracingManager kTracingManager{
+        tracing::Format::kYandexTaxi, tracing::Format::kYandexTaxi};
+    clients::http::ClientSettings settings;
+    settings.io_threads = 4;
+    settings.tracing_manager = &kTracingManager;
+    settings.shard_by_destination = true;
+    clients::http::Client http_client{
+        std::move(settings),
+        engine::current_task::GetTaskProcessor(),
+        std::vector<utils::NotNull<clients::http::Plugin*>>{}};
+
+    // Requests are created on random IO threads, but are performed in the one
+    // of the destination and reuse its connection
+    constexpr std::size_t kRequests = 8;
+    std::vector<clients::http::Request> requests;
+    for (std::size_t i = 0; i < kRequests; ++i) {
+        requests.push_back(http_client.CreateRequest().get(http_server.GetBaseUrl()).timeout(kTimeout));
+    }
+    for (auto& request : requests) {
+        EXPECT_EQ(request.perform()->status_code(), 200);
+    }
+
+    clients::http::InstanceStatistics stats;
+    for (const auto& multi_stats : http_client.GetPoolStatistics().multi) stats += multi_stats;
+    EXPECT_EQ(stats.cold_connections.value, 1);
+    EXPECT_EQ(stats.warm_connections.value, kRequests - 1);
+}
+
+UTEST(HttpClient, AsyncPerformBatch) {
+    const utest::SimpleServer http_server{EchoCallback{}};
+
+    static const tracing::GenericTracingManager kTracingManager{
+        tracing::Format::kYandexTaxi, tracing::Format::kYandexTaxi};
+    clients::http::ClientSettings settings;
+    settings.io_threads = 4;
+    settings.tracing_manager = &kTracingManager;
+    clients::http::Client http_client{
+        std::move(settings),
+        engine::current_task::GetTaskProcessor(),
+        std::vector<utils::NotNull<clients::http::Plugin*>>{}};
+
+    constexpr std::size_t kRequests = 16;
+    std::vector<clients::http::Request> requests;
+    for (std::size_t i = 0; i < kRequests; ++i) {
+        requests.push_back(
+            http_client.CreateRequest().post(http_server.GetBaseUrl(), std::to_string(i)).timeout(kTimeout)
+        );
+    }
+
+    auto futures = http_client.AsyncPerformBatch(requests);
+    ASSERT_EQ(futures.size(), kRequests);
+    for (std::size_t i = 0; i < kRequests; ++i) {
+        EXPECT_EQ(futures[i].Get()->body(), std::to_string(i));
+    }
+
+    // Requests could be reused
+    futures = http_client.AsyncPerformBatch(requests);
+    for (std::size_t i = 0; i < kRequests; ++i) {
+        EXPECT_EQ(futures[i].Get()->body(), std::to_string(i));
+    }
+}
+
 UTEST(HttpClient, StatsOnTimeout) {
     const int kRetries = 5;
     const utest::SimpleServer http_server{&sleep_callback};
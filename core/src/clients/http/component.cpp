@@ -231,6 +231,34 @@ properties:
         enum:
           - cancel
           - ignore
+    warm-connections:
+        type: array
+        description: destinations to keep established connections to in each IO thread
+        items:
+            type: object
+            description: warm destination
+            additionalProperties: false
+            properties:
+                url:
+                    type: string
+                    description: URL that is periodically requested with HEAD to open or refresh the connections
+                connections:
+                    type: integer
+                    description: number of connections to keep in each IO thread
+                    defaultDescription: 1
+                    minimum: 1
+    shard-by-destination:
+        type: boolean
+        description: perform all the requests to a host in the same IO thread to maximize the connection reuse
+        defaultDescription: false
+    share-tls-sessions:
+        type: boolean
+        description: share TLS sessions between the IO threads and all the HTTP clients of the process, so that the new connections resume them
+        defaultDescription: true
+    warm-connections-period:
+        type: string
+        description: how often to refresh the warm connections, should be less than the idle connection lifetime of cURL (118s)
+        defaultDescription: 30s
 )");
 }
 
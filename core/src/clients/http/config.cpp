@@ -4,6 +4,7 @@
 
 #include <userver/dynamic_config/value.hpp>
 #include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/common_containers.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -47,11 +48,24 @@ CancellationPolicy Parse(yaml_config::YamlConfig value, formats::parse::To<Cance
     throw std::runtime_error("Invalid CancellationPolicy value: " + str);
 }
 
+WarmConnectionsConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<WarmConnectionsConfig>) {
+    WarmConnectionsConfig result;
+    result.url = value["url"].As<std::string>();
+    result.connections = value["connections"].As<std::size_t>(result.connections);
+    return result;
+}
+
 ClientSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<ClientSettings>) {
     ClientSettings result;
     result.thread_name_prefix = value["thread-name-prefix"].As<std::string>(result.thread_name_prefix);
     result.io_threads = value["threads"].As<size_t>(result.io_threads);
     result.deadline_propagation = ParseDeadlinePropagationConfig(value);
+    result.warm_connections =
+        value["warm-connections"].As<std::vector<WarmConnectionsConfig>>(result.warm_connections);
+    result.warm_connections_period =
+        value["warm-connections-period"].As<std::chrono::milliseconds>(result.warm_connections_period);
+    result.shard_by_destination = value["shard-by-destination"].As<bool>(result.shard_by_destination);
+    result.share_tls_sessions = value["share-tls-sessions"].As<bool>(result.share_tls_sessions);
     return result;
 }
 
@@ -0,0 +1,22 @@
+#include <clients/http/destination_sharding.hpp>
+
+#include <functional>
+
+#include <curl-ev/multi.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::impl {
+
+DestinationSharding::DestinationSharding(const std::vector<std::unique_ptr<curl::multi>>& multis) noexcept
+    : multis_(multis) {}
+
+curl::multi& DestinationSharding::GetMulti(std::string_view host) const noexcept {
+    UASSERT(!multis_.empty());
+    return *multis_[std::hash<std::string_view>{}(host) % multis_.size()];
+}
+
+}  // namespace clients::http::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace curl {
+class multi;
+}  // namespace curl
+
+namespace clients::http::impl {
+
+/// Maps each destination host to a single curl::multi of a Client, so that
+/// all the connections to the host are in one connection cache and are
+/// reused by keep-alive and HTTP/2 multiplexing
+class DestinationSharding final {
+public:
+    /// The `multis` must outlive the DestinationSharding
+    explicit DestinationSharding(const std::vector<std::unique_ptr<curl::multi>>& multis) noexcept;
+
+    /// `host` is the host and port of the connection
+    curl::multi& GetMulti(std::string_view host) const noexcept;
+
+private:
+    const std::vector<std::unique_ptr<curl::multi>>& multis_;
+};
+
+}  // namespace clients::http::impl
+
+USERVER_NAMESPACE_END
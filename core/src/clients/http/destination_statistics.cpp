@@ -59,6 +59,20 @@ void DestinationStatistics::SetAutoMaxSize(size_t max_auto_destinations) {
     max_auto_destinations_ = max_auto_destinations;
 }
 
+std::optional<std::chrono::milliseconds> DestinationStatistics::GetRecentTimingsPercentile(
+    const std::string& destination,
+    double percent,
+    std::uint64_t min_samples
+) const {
+    const auto stats = rcu_map_.Get(destination);
+    if (!stats) return std::nullopt;
+
+    const InstanceStatistics instance_stats{*stats};
+    const auto& timings = instance_stats.timings_percentile;
+    if (timings.Count() < min_samples || timings.Count() == 0) return std::nullopt;
+    return std::chrono::milliseconds{timings.GetPercentile(percent)};
+}
+
 DestinationStatistics::DestinationsMap::ConstIterator DestinationStatistics::begin() const { return rcu_map_.begin(); }
 
 DestinationStatistics::DestinationsMap::ConstIterator DestinationStatistics::end() const { return rcu_map_.end(); }
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 
 #include <userver/rcu/rcu_map.hpp>
@@ -23,6 +26,11 @@ public:
 
     void SetAutoMaxSize(size_t max_auto_destinations);
 
+    // Return the percentile of the timings for the recent period, or nullopt if
+    // there are less than min_samples of them
+    std::optional<std::chrono::milliseconds>
+    GetRecentTimingsPercentile(const std::string& destination, double percent, std::uint64_t min_samples) const;
+
     using DestinationsMap = rcu::RcuMap<std::string, Statistics>;
 
     DestinationsMap::ConstIterator begin() const;
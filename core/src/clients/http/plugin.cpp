@@ -30,10 +30,20 @@ void PluginRequest::SetTimeout(std::chrono::milliseconds ms) {
     state_.SetEasyTimeout(ms);
 }
 
+const std::string& PluginRequest::GetOriginalUrl() const { return state_.easy().get_original_url(); }
+
+std::string_view PluginRequest::GetMethod() const { return state_.GetMethod(); }
+
+std::optional<std::string_view> PluginRequest::GetHeader(std::string_view name) const {
+    return state_.easy().FindHeaderByName(name);
+}
+
 Plugin::Plugin(std::string name) : name_(std::move(name)) {}
 
 const std::string& Plugin::GetName() const { return name_; }
 
+bool Plugin::HookTryReplyLocally(PluginRequest&, Response&) { return false; }
+
 namespace impl {
 
 PluginPipeline::PluginPipeline(const std::vector<utils::NotNull<Plugin*>>& plugins) : plugins_(plugins) {}
@@ -56,6 +66,15 @@ void PluginPipeline::HookOnCompleted(RequestState& request_state, Response& resp
     }
 }
 
+bool PluginPipeline::HookTryReplyLocally(RequestState& request_state, Response& response) {
+    PluginRequest req(request_state);
+
+    for (const auto& plugin : plugins_) {
+        if (plugin->HookTryReplyLocally(req, response)) return true;
+    }
+    return false;
+}
+
 void PluginPipeline::HookPerformRequest(RequestState& request_state) {
     PluginRequest req(request_state);
 
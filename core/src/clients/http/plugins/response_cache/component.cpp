@@ -0,0 +1,64 @@
+#include <userver/clients/http/plugins/response_cache/component.hpp>
+
+#include <clients/http/plugins/response_cache/plugin.hpp>
+
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::response_cache {
+
+Component::Component(const components::ComponentConfig& config, const components::ComponentContext& context)
+    : ComponentBase(config, context),
+      plugin_(std::make_unique<response_cache::Plugin>(
+          config["destinations"].As<std::vector<DestinationConfig>>(std::vector<DestinationConfig>{})
+      )) {
+    auto& storage = context.FindComponent<components::StatisticsStorage>().GetStorage();
+    statistics_holder_ = storage.RegisterWriter(
+        "httpclient.response-cache",
+        [this](utils::statistics::Writer& writer) { plugin_->WriteStatistics(writer); }
+    );
+}
+
+Component::~Component() { statistics_holder_.Unregister(); }
+
+http::Plugin& Component::GetPlugin() { return *plugin_; }
+
+yaml_config::Schema Component::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<plugin::ComponentBase>(R"(
+type: object
+description: HTTP client plugin that caches GET responses according to Cache-Control and ETag
+additionalProperties: false
+properties:
+    destinations:
+        type: array
+        description: list of destinations to cache, the first one with a matching prefix is used
+        defaultDescription: '[]'
+        items:
+            type: object
+            description: destination settings
+            additionalProperties: false
+            properties:
+                url-prefix:
+                    type: string
+                    description: requests with URLs starting with the prefix are cached
+                max-memory-bytes:
+                    type: integer
+                    description: memory budget of the destination cache
+                    defaultDescription: 16777216
+                    minimum: 1
+                max-entries:
+                    type: integer
+                    description: max number of cached responses of the destination
+                    defaultDescription: 1000
+                    minimum: 1
+)");
+}
+
+}  // namespace clients::http::plugins::response_cache
+
+USERVER_NAMESPACE_END
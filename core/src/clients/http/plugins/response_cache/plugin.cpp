@@ -0,0 +1,301 @@
+#include <clients/http/plugins/response_cache/plugin.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <mutex>
+#include <system_error>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/clients/http/response.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/utils/str_icase.hpp>
+#include <userver/utils/text_light.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::response_cache {
+
+namespace {
+
+const std::string kName = "response-cache";
+
+using Clock = std::chrono::steady_clock;
+
+struct CacheControl final {
+    bool no_store{false};
+    bool no_cache{false};
+    std::chrono::seconds max_age{0};
+};
+
+std::string_view TrimSpaces(std::string_view value) noexcept {
+    while (!value.empty() && value.front() == ' ') value.remove_prefix(1);
+    while (!value.empty() && value.back() == ' ') value.remove_suffix(1);
+    return value;
+}
+
+CacheControl ParseCacheControl(std::string_view value) {
+    static constexpr std::string_view kMaxAge = "max-age=";
+
+    const utils::StrIcaseEqual equal;
+    CacheControl result;
+    while (!value.empty()) {
+        const auto comma_pos = value.find(',');
+        const auto directive = TrimSpaces(value.substr(0, comma_pos));
+        value.remove_prefix(comma_pos == std::string_view::npos ? value.size() : comma_pos + 1);
+
+        if (utils::text::ICaseStartsWith(directive, kMaxAge)) {
+            const auto seconds = directive.substr(kMaxAge.size());
+            std::int64_t max_age = 0;
+            const auto [ptr, ec] = std::from_chars(seconds.data(), seconds.data() + seconds.size(), max_age);
+            if (ec == std::errc{} && ptr == seconds.data() + seconds.size() && max_age > 0) {
+                result.max_age = std::chrono::seconds{max_age};
+            }
+        } else if (equal(directive, "no-store")) {
+            result.no_store = true;
+        } else if (equal(directive, "no-cache")) {
+            result.no_cache = true;
+        }
+    }
+    return result;
+}
+
+CacheControl GetCacheControl(const Response& response) {
+    const auto it = response.headers().find(USERVER_NAMESPACE::http::headers::kCacheControl);
+    if (it == response.headers().end()) return {};
+    return ParseCacheControl(it->second);
+}
+
+Clock::time_point GetExpiration(const CacheControl& cache_control) {
+    if (cache_control.no_cache) return {};
+    return Clock::now() + cache_control.max_age;
+}
+
+struct CachedResponse final {
+    Status status_code;
+    Headers headers;
+    std::string body;
+    std::string etag;
+};
+
+std::size_t GetSizeBytes(const std::string& url, const CachedResponse& response) noexcept {
+    std::size_t size = sizeof(CachedResponse) + url.size() + response.body.size() + response.etag.size();
+    for (const auto& [name, value] : response.headers) size += name.size() + value.size();
+    return size;
+}
+
+void FillResponse(const CachedResponse& cached, Response& response) {
+    response.SetStatusCode(cached.status_code);
+    response.headers() = cached.headers;
+    response.sink_string() = cached.body;
+}
+
+}  // namespace
+
+DestinationConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<DestinationConfig>) {
+    DestinationConfig config;
+    config.url_prefix = value["url-prefix"].As<std::string>();
+    config.max_memory_bytes = value["max-memory-bytes"].As<std::size_t>(config.max_memory_bytes);
+    config.max_entries = value["max-entries"].As<std::size_t>(config.max_entries);
+    return config;
+}
+
+/// Hooks are called from the ev threads and from coroutines, so the entries
+/// are guarded with a plain mutex
+class Plugin::Destination final {
+public:
+    explicit Destination(const DestinationConfig& config)
+        : url_prefix_(config.url_prefix),
+          max_memory_bytes_(config.max_memory_bytes),
+          max_entries_(std::max(config.max_entries, std::size_t{1})),
+          entries_(max_entries_) {}
+
+    const std::string& GetUrlPrefix() const noexcept { return url_prefix_; }
+
+    bool TryReply(PluginRequest& request, Response& response) {
+        const auto& url = request.GetOriginalUrl();
+
+        std::shared_ptr<const CachedResponse> cached;
+        bool is_fresh = false;
+        {
+            const std::lock_guard lock{mutex_};
+            auto* entry = entries_.Get(url);
+            if (entry) {
+                cached = entry->response;
+                is_fresh = Clock::now() < entry->expiration;
+            }
+        }
+
+        if (cached && is_fresh) {
+            ++hits_;
+            FillResponse(*cached, response);
+            return true;
+        }
+
+        if (cached && !cached->etag.empty()) {
+            ++revalidations_;
+            request.SetHeader(USERVER_NAMESPACE::http::headers::kIfNoneMatch, cached->etag);
+        } else {
+            ++misses_;
+        }
+        return false;
+    }
+
+    void OnCompleted(PluginRequest& request, Response& response) {
+        const auto& url = request.GetOriginalUrl();
+        const auto cache_control = GetCacheControl(response);
+
+        if (response.status_code() == Status::kNotModified) {
+            std::shared_ptr<const CachedResponse> cached;
+            {
+                const std::lock_guard lock{mutex_};
+                auto* entry = entries_.Get(url);
+                if (!entry) return;
+                cached = entry->response;
+                entry->expiration = GetExpiration(cache_control);
+            }
+            ++not_modified_;
+            FillResponse(*cached, response);
+            return;
+        }
+
+        if (response.status_code() != Status::kOk || cache_control.no_store ||
+            response.headers().find(USERVER_NAMESPACE::http::headers::kVary) != response.headers().end()) {
+            Erase(url);
+            return;
+        }
+
+        const auto etag_it = response.headers().find(USERVER_NAMESPACE::http::headers::kETag);
+        const bool has_etag = (etag_it != response.headers().end());
+        const bool may_be_fresh = !cache_control.no_cache && cache_control.max_age.count() > 0;
+        if (!may_be_fresh && !has_etag) {
+            Erase(url);
+            return;
+        }
+
+        auto cached = std::make_shared<CachedResponse>(CachedResponse{
+            response.status_code(),
+            response.headers(),
+            std::string{response.body_view()},
+            has_etag ? etag_it->second : std::string{},
+        });
+        Put(url, std::move(cached), GetExpiration(cache_control));
+    }
+
+    void WriteStatistics(utils::statistics::Writer& writer) const {
+        const utils::statistics::LabelView label{"http_destination", url_prefix_};
+        writer["hits"].ValueWithLabels(hits_.Load(), label);
+        writer["misses"].ValueWithLabels(misses_.Load(), label);
+        writer["revalidations"].ValueWithLabels(revalidations_.Load(), label);
+        writer["not-modified"].ValueWithLabels(not_modified_.Load(), label);
+        writer["evictions"].ValueWithLabels(evictions_.Load(), label);
+        writer["memory-bytes"].ValueWithLabels(memory_bytes_.load(std::memory_order_relaxed), label);
+    }
+
+private:
+    struct Entry final {
+        std::string url;
+        std::shared_ptr<const CachedResponse> response;
+        Clock::time_point expiration;
+        std::size_t size_bytes{0};
+    };
+
+    void Put(const std::string& url, std::shared_ptr<const CachedResponse> response, Clock::time_point expiration) {
+        const auto size_bytes = GetSizeBytes(url, *response);
+        if (size_bytes > max_memory_bytes_) {
+            Erase(url);
+            return;
+        }
+
+        const std::lock_guard lock{mutex_};
+        EraseLocked(url);
+        while (entries_.GetSize() != 0 &&
+               (entries_.GetSize() >= max_entries_ || used_bytes_ + size_bytes > max_memory_bytes_)) {
+            EraseLocked(entries_.GetLeastUsed()->url);
+            ++evictions_;
+        }
+
+        entries_.Put(url, Entry{url, std::move(response), expiration, size_bytes});
+        used_bytes_ += size_bytes;
+        memory_bytes_.store(used_bytes_, std::memory_order_relaxed);
+    }
+
+    void Erase(const std::string& url) {
+        const std::lock_guard lock{mutex_};
+        EraseLocked(url);
+    }
+
+    void EraseLocked(const std::string& url) {
+        const auto* entry = entries_.Get(url);
+        if (!entry) return;
+
+        used_bytes_ -= entry->size_bytes;
+        memory_bytes_.store(used_bytes_, std::memory_order_relaxed);
+        // `url` may point into the entry
+        const std::string key = entry->url;
+        entries_.Erase(key);
+    }
+
+    const std::string url_prefix_;
+    const std::size_t max_memory_bytes_;
+    const std::size_t max_entries_;
+
+    std::mutex mutex_;
+    cache::LruMap<std::string, Entry> entries_;
+    std::size_t used_bytes_{0};
+
+    utils::statistics::RateCounter hits_;
+    utils::statistics::RateCounter misses_;
+    utils::statistics::RateCounter revalidations_;
+    utils::statistics::RateCounter not_modified_;
+    utils::statistics::RateCounter evictions_;
+    std::atomic<std::size_t> memory_bytes_{0};
+};
+
+Plugin::Plugin(const std::vector<DestinationConfig>& destinations) : http::Plugin(kName) {
+    destinations_.reserve(destinations.size());
+    for (const auto& destination : destinations) {
+        destinations_.push_back(std::make_unique<Destination>(destination));
+    }
+}
+
+Plugin::~Plugin() = default;
+
+void Plugin::HookPerformRequest(PluginRequest&) {}
+
+void Plugin::HookCreateSpan(PluginRequest&, tracing::Span&) {}
+
+void Plugin::HookOnCompleted(PluginRequest& request, Response& response) {
+    if (request.GetMethod() != "GET") return;
+
+    auto* destination = FindDestination(request.GetOriginalUrl());
+    if (destination) destination->OnCompleted(request, response);
+}
+
+bool Plugin::HookTryReplyLocally(PluginRequest& request, Response& response) {
+    if (request.GetMethod() != "GET") return false;
+
+    auto* destination = FindDestination(request.GetOriginalUrl());
+    return destination && destination->TryReply(request, response);
+}
+
+void Plugin::WriteStatistics(utils::statistics::Writer& writer) const {
+    for (const auto& destination : destinations_) {
+        destination->WriteStatistics(writer);
+    }
+}
+
+Plugin::Destination* Plugin::FindDestination(std::string_view url) const noexcept {
+    for (const auto& destination : destinations_) {
+        if (utils::text::StartsWith(url, destination->GetUrlPrefix())) return destination.get();
+    }
+    return nullptr;
+}
+
+}  // namespace clients::http::plugins::response_cache
+
+USERVER_NAMESPACE_END
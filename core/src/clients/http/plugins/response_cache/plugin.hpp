@@ -0,0 +1,55 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/clients/http/plugin.hpp>
+#include <userver/formats/parse/to.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::response_cache {
+
+struct DestinationConfig final {
+    /// Requests with URLs starting with the prefix are cached
+    std::string url_prefix;
+    std::size_t max_memory_bytes{16 * 1024 * 1024};
+    std::size_t max_entries{1000};
+};
+
+DestinationConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<DestinationConfig>);
+
+/// Caches the GET responses according to their `Cache-Control` and `ETag`
+/// headers. Fresh responses are served without network I/O, stale responses
+/// with an ETag are revalidated with `If-None-Match`.
+class Plugin final : public http::Plugin {
+public:
+    explicit Plugin(const std::vector<DestinationConfig>& destinations);
+    ~Plugin() override;
+
+    void HookPerformRequest(PluginRequest&) override;
+
+    void HookCreateSpan(PluginRequest&, tracing::Span&) override;
+
+    void HookOnCompleted(PluginRequest& request, Response& response) override;
+
+    bool HookTryReplyLocally(PluginRequest& request, Response& response) override;
+
+    void WriteStatistics(utils::statistics::Writer& writer) const;
+
+private:
+    class Destination;
+
+    // The first destination with a matching URL prefix, if any
+    Destination* FindDestination(std::string_view url) const noexcept;
+
+    std::vector<std::unique_ptr<Destination>> destinations_;
+};
+
+}  // namespace clients::http::plugins::response_cache
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,115 @@
+#include <clients/http/plugins/response_cache/plugin.hpp>
+
+#include <atomic>
+
+#include <fmt/format.h>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/tracing/manager.hpp>
+#include <userver/utest/simple_server.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace response_cache = clients::http::plugins::response_cache;
+
+using HttpResponse = utest::SimpleServer::Response;
+using HttpRequest = utest::SimpleServer::Request;
+
+constexpr std::string_view kBody = "cached body";
+
+struct CachingServer {
+    std::string cache_control;
+    std::shared_ptr<std::atomic<int>> requests = std::make_shared<std::atomic<int>>(0);
+    std::shared_ptr<std::atomic<int>> not_modified = std::make_shared<std::atomic<int>>(0);
+
+    HttpResponse operator()(const HttpRequest& request) const {
+        ++*requests;
+        if (request.find("If-None-Match: \"v1\"") != std::string::npos) {
+            ++*not_modified;
+            return {
+                "HTTP/1.1 304 Not Modified\r\nConnection: close\r\nCache-Control: " + cache_control +
+                    "\r\nContent-Length: 0\r\n\r\n",
+                HttpResponse::kWriteAndClose};
+        }
+
+        return {
+            fmt::format(
+                "HTTP/1.1 200 OK\r\nConnection: close\r\nCache-Control: {}\r\nETag: \"v1\"\r\n"
+                "Content-Length: {}\r\n\r\n{}",
+                cache_control,
+                kBody.size(),
+                kBody
+            ),
+            HttpResponse::kWriteAndClose};
+    }
+};
+
+std::shared_ptr<clients::http::Client> CreateHttpClient(clients::http::Plugin& plugin) {
+    static const tracing::GenericTracingManager kDefaultTracingManager{
+        tracing::Format::kYandexTaxi, tracing::Format::kYandexTaxi};
+
+    clients::http::ClientSettings static_config;
+    static_config.io_threads = 1;
+    static_config.tracing_manager = &kDefaultTracingManager;
+
+    return std::make_shared<clients::http::Client>(
+        std::move(static_config),
+        engine::current_task::GetTaskProcessor(),
+        std::vector<utils::NotNull<clients::http::Plugin*>>{utils::NotNull<clients::http::Plugin*>{&plugin}}
+    );
+}
+
+std::shared_ptr<clients::http::Response> Get(clients::http::Client& client, const std::string& url) {
+    return client.CreateRequest().get(url).timeout(utest::kMaxTestWaitTime).perform();
+}
+
+}  // namespace
+
+UTEST(HttpClientResponseCache, ServesFreshResponses) {
+    const CachingServer callback{"max-age=600"};
+    const utest::SimpleServer http_server{callback};
+    response_cache::Plugin plugin{{{http_server.GetBaseUrl()}}};
+    auto client = CreateHttpClient(plugin);
+
+    for (int i = 0; i < 3; ++i) {
+        const auto response = Get(*client, http_server.GetBaseUrl() + "/fresh");
+        EXPECT_EQ(response->status_code(), clients::http::Status::kOk);
+        EXPECT_EQ(response->body_view(), kBody);
+    }
+    EXPECT_EQ(*callback.requests, 1);
+
+    Get(*client, http_server.GetBaseUrl() + "/other");
+    EXPECT_EQ(*callback.requests, 2);
+}
+
+UTEST(HttpClientResponseCache, RevalidatesStaleResponses) {
+    const CachingServer callback{"no-cache"};
+    const utest::SimpleServer http_server{callback};
+    response_cache::Plugin plugin{{{http_server.GetBaseUrl()}}};
+    auto client = CreateHttpClient(plugin);
+
+    for (int i = 0; i < 3; ++i) {
+        const auto response = Get(*client, http_server.GetBaseUrl());
+        EXPECT_EQ(response->status_code(), clients::http::Status::kOk);
+        EXPECT_EQ(response->body_view(), kBody);
+    }
+    EXPECT_EQ(*callback.requests, 3);
+    EXPECT_EQ(*callback.not_modified, 2);
+}
+
+UTEST(HttpClientResponseCache, RespectsMemoryBudget) {
+    const CachingServer callback{"max-age=600"};
+    const utest::SimpleServer http_server{callback};
+    response_cache::Plugin plugin{{{http_server.GetBaseUrl(), /*max_memory_bytes=*/1}}};
+    auto client = CreateHttpClient(plugin);
+
+    Get(*client, http_server.GetBaseUrl());
+    Get(*client, http_server.GetBaseUrl());
+    EXPECT_EQ(*callback.requests, 2);
+}
+
+USERVER_NAMESPACE_END
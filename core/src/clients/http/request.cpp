@@ -225,6 +225,8 @@ Request::Request(
 }
 
 ResponseFuture Request::async_perform(utils::impl::SourceLocation location) {
+    if (auto coalesced = pimpl_->JoinOrStartCoalesced()) return std::move(*coalesced);
+
     ResponseFuture future{pimpl_->async_perform(location), pimpl_};
     return future;
 }
@@ -336,6 +338,12 @@ Request& Request::connect_to(const ConnectTo& connect_to) & {
 }
 Request Request::connect_to(const ConnectTo& connect_to) && { return std::move(this->connect_to(connect_to)); }
 
+Request& Request::load_balance() & {
+    pimpl_->load_balance();
+    return *this;
+}
+Request Request::load_balance() && { return std::move(this->load_balance()); }
+
 Request& Request::data(std::string data) & {
     if (!data.empty()) pimpl_->easy().add_header(kHeaderExpect, "", curl::easy::EmptyHeaderAction::kDoNotSend);
     pimpl_->easy().set_post_fields(std::move(data));
@@ -343,6 +351,20 @@ Request& Request::data(std::string data) & {
 }
 Request Request::data(std::string data) && { return std::move(this->data(std::move(data))); }
 
+Request& Request::data(std::shared_ptr<const std::string> data) & {
+    if (data && !data->empty()) {
+        pimpl_->easy().add_header(kHeaderExpect, "", curl::easy::EmptyHeaderAction::kDoNotSend);
+    }
+    pimpl_->easy().set_post_fields(std::move(data));
+    return *this;
+}
+Request Request::data(std::shared_ptr<const std::string> data) && { return std::move(this->data(std::move(data))); }
+
+RequestBodyStream Request::stream_body(std::optional<std::size_t> content_length, std::size_t max_buffered_size) {
+    pimpl_->easy().add_header(kHeaderExpect, "", curl::easy::EmptyHeaderAction::kDoNotSend);
+    return RequestBodyStream{pimpl_->stream_body(content_length, max_buffered_size)};
+}
+
 Request& Request::form(Form&& form) & {
     pimpl_->easy().set_http_post(std::move(form).GetNative());
     pimpl_->easy().add_header(kHeaderExpect, "", curl::easy::EmptyHeaderAction::kDoNotSend);
@@ -421,6 +443,8 @@ Request Request::cookies(const std::unordered_map<std::string, std::string>& coo
 }
 
 Request& Request::method(HttpMethod method) & {
+    pimpl_->SetMethod(ToStringView(method));
+
     switch (method) {
         case HttpMethod::kDelete:
         case HttpMethod::kOptions:
@@ -440,7 +464,7 @@ Request& Request::method(HttpMethod method) & {
         case HttpMethod::kPatch:
             pimpl_->easy().set_custom_request(ToString(method));
             // ensure a body as we should send Content-Length for this method
-            if (!pimpl_->easy().has_post_data()) data({});
+            if (!pimpl_->easy().has_post_data()) data(std::string{});
             break;
     };
     return *this;
@@ -471,6 +495,7 @@ Request& Request::set_custom_http_request_method(std::string method) & {
                              "changing of request type. Use it only if you need to make "
                              "GET-request with body.";
     pimpl_->easy().set_custom_request(method);
+    pimpl_->SetMethod({});
     return *this;
 }
 Request Request::set_custom_http_request_method(std::string method) && {
@@ -503,6 +528,27 @@ Request Request::patch(const std::string& url, std::string data) && {
     return std::move(this->patch(url, std::move(data)));
 }
 
+Request& Request::post(const std::string& url, std::shared_ptr<const std::string> data) & {
+    return this->url(url).data(std::move(data)).post();
+}
+Request Request::post(const std::string& url, std::shared_ptr<const std::string> data) && {
+    return std::move(this->post(url, std::move(data)));
+}
+
+Request& Request::put(const std::string& url, std::shared_ptr<const std::string> data) & {
+    return this->url(url).data(std::move(data)).put();
+}
+Request Request::put(const std::string& url, std::shared_ptr<const std::string> data) && {
+    return std::move(this->put(url, std::move(data)));
+}
+
+Request& Request::patch(const std::string& url, std::shared_ptr<const std::string> data) & {
+    return this->url(url).data(std::move(data)).patch();
+}
+Request Request::patch(const std::string& url, std::shared_ptr<const std::string> data) && {
+    return std::move(this->patch(url, std::move(data)));
+}
+
 Request& Request::delete_method(const std::string& url) & { return this->url(url).delete_method(); }
 Request Request::delete_method(const std::string& url) && { return std::move(this->delete_method(url)); }
 
@@ -513,6 +559,14 @@ Request Request::delete_method(const std::string& url, std::string data) && {
     return std::move(this->delete_method(url, std::move(data)));
 }
 
+Request& Request::coalesce(std::vector<std::string> key_headers) & {
+    pimpl_->coalesce(std::move(key_headers));
+    return *this;
+}
+Request Request::coalesce(std::vector<std::string> key_headers) && {
+    return std::move(this->coalesce(std::move(key_headers)));
+}
+
 Request& Request::SetLoggedUrl(std::string url) & {
     pimpl_->SetLoggedUrl(std::move(url));
     return *this;
@@ -533,6 +587,20 @@ void Request::SetTestsuiteConfig(const std::shared_ptr<const TestsuiteConfig>& c
 
 void Request::SetAllowedUrlsExtra(const std::vector<std::string>& urls) & { pimpl_->SetAllowedUrlsExtra(urls); }
 
+void Request::SetRequestCoalescer(std::shared_ptr<impl::RequestCoalescer> coalescer) & {
+    pimpl_->SetRequestCoalescer(std::move(coalescer));
+}
+
+void Request::SetAddressBalancer(std::shared_ptr<impl::AddressBalancer> balancer) & {
+    pimpl_->SetAddressBalancer(std::move(balancer));
+}
+
+void Request::SetDestinationSharding(const impl::DestinationSharding* sharding) & {
+    pimpl_->SetDestinationSharding(sharding);
+}
+
+void Request::SetTlsSessionShare(std::shared_ptr<curl::share> share) & { pimpl_->easy().set_share(std::move(share)); }
+
 void Request::SetDeadlinePropagationConfig(const DeadlinePropagationConfig& deadline_propagation_config) & {
     pimpl_->SetDeadlinePropagationConfig(deadline_propagation_config);
 }
@@ -0,0 +1,137 @@
+#include <userver/clients/http/request_body_stream.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#include <clients/http/request_body_stream_state.hpp>
+#include <clients/http/request_state.hpp>
+#include <curl-ev/native.hpp>
+#include <engine/ev/thread_control.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace impl {
+
+RequestBodyStreamState::RequestBodyStreamState(
+    std::size_t max_buffered_size,
+    std::weak_ptr<RequestState> request_state
+)
+    : queue_(Queue::Create(max_buffered_size)),
+      request_state_(std::move(request_state)),
+      producer_(queue_->GetProducer()),
+      consumer_(queue_->GetConsumer()) {}
+
+bool RequestBodyStreamState::Push(std::string&& chunk, engine::Deadline deadline) {
+    UINVARIANT(producer_, "The request body stream is already finished");
+    if (chunk.empty()) return true;
+
+    if (!producer_->Push(std::move(chunk), deadline)) return false;
+    WakeupTransfer();
+    return true;
+}
+
+void RequestBodyStreamState::Finish() {
+    if (!producer_) return;
+
+    producer_.reset();
+    WakeupTransfer();
+}
+
+std::size_t
+RequestBodyStreamState::ReadFunction(void* ptr, std::size_t size, std::size_t nmemb, void* userdata) noexcept {
+    auto* self = static_cast<RequestBodyStreamState*>(userdata);
+    UASSERT(self);
+    return self->Read(static_cast<char*>(ptr), size * nmemb);
+}
+
+void RequestBodyStreamState::Stop() noexcept { consumer_.reset(); }
+
+std::size_t RequestBodyStreamState::Read(char* ptr, std::size_t size) noexcept {
+    if (!consumer_) return CURL_READFUNC_ABORT;
+
+    std::size_t copied = 0;
+    while (copied < size) {
+        if (chunk_offset_ == chunk_.size()) {
+            chunk_offset_ = 0;
+            const auto result = TryPopChunk();
+            if (result == PopResult::kChunk) continue;
+
+            if (copied != 0) break;
+            // An empty read marks the end of the body
+            return result == PopResult::kFinished ? 0 : CURL_READFUNC_PAUSE;
+        }
+
+        const auto part_size = std::min(size - copied, chunk_.size() - chunk_offset_);
+        std::memcpy(ptr + copied, chunk_.data() + chunk_offset_, part_size);
+        copied += part_size;
+        chunk_offset_ += part_size;
+    }
+    return copied;
+}
+
+RequestBodyStreamState::PopResult RequestBodyStreamState::TryPopChunk() noexcept {
+    UASSERT(consumer_);
+
+    // The flag is raised before looking into the queue, so a concurrent Push or
+    // Finish either is seen below or sees the flag and resumes the transfer
+    is_paused_ = true;
+    const bool is_finished = queue_->NoMoreProducers();
+    if (consumer_->PopNoblock(chunk_)) {
+        is_paused_ = false;
+        return PopResult::kChunk;
+    }
+
+    chunk_.clear();
+    if (is_finished) {
+        is_paused_ = false;
+        return PopResult::kFinished;
+    }
+    return PopResult::kEmpty;
+}
+
+void RequestBodyStreamState::WakeupTransfer() {
+    if (!is_paused_.exchange(false)) return;
+
+    auto request_state = request_state_.lock();
+    if (!request_state) return;
+
+    auto& thread_control = request_state->easy().GetThreadControl();
+    thread_control.RunInEvLoopAsync([request_state = std::move(request_state)] { request_state->easy().unpause(); });
+}
+
+}  // namespace impl
+
+RequestBodyStream::RequestBodyStream(std::shared_ptr<impl::RequestBodyStreamState> state) : state_(std::move(state)) {
+    UASSERT(state_);
+}
+
+RequestBodyStream::RequestBodyStream(RequestBodyStream&&) noexcept = default;
+
+RequestBodyStream& RequestBodyStream::operator=(RequestBodyStream&& other) noexcept {
+    if (this != &other) {
+        if (state_) state_->Finish();
+        state_ = std::move(other.state_);
+    }
+    return *this;
+}
+
+RequestBodyStream::~RequestBodyStream() {
+    if (state_) state_->Finish();
+}
+
+bool RequestBodyStream::PushChunk(std::string&& chunk, engine::Deadline deadline) {
+    UINVARIANT(state_, "PushChunk() on a moved-out RequestBodyStream");
+    return state_->Push(std::move(chunk), deadline);
+}
+
+void RequestBodyStream::Finish() {
+    UINVARIANT(state_, "Finish() on a moved-out RequestBodyStream");
+    state_->Finish();
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
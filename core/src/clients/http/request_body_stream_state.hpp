@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+class RequestState;
+
+namespace impl {
+
+/// Chunks of the request body, pushed from a coroutine and read by the
+/// cURL READFUNCTION in the ev thread. The transfer is paused while the queue
+/// is empty and is resumed by the next push.
+class RequestBodyStreamState final {
+public:
+    using Queue = concurrent::StringStreamQueue;
+
+    RequestBodyStreamState(std::size_t max_buffered_size, std::weak_ptr<RequestState> request_state);
+
+    // Producer side, called from a coroutine
+    bool Push(std::string&& chunk, engine::Deadline deadline);
+    void Finish();
+
+    // Consumer side, called from the ev thread by cURL
+    static std::size_t ReadFunction(void* ptr, std::size_t size, std::size_t nmemb, void* userdata) noexcept;
+
+    /// Unblocks the producer once the request is finished
+    void Stop() noexcept;
+
+private:
+    enum class PopResult { kChunk, kEmpty, kFinished };
+
+    std::size_t Read(char* ptr, std::size_t size) noexcept;
+    PopResult TryPopChunk() noexcept;
+    void WakeupTransfer();
+
+    const std::shared_ptr<Queue> queue_;
+    const std::weak_ptr<RequestState> request_state_;
+
+    std::optional<Queue::Producer> producer_;
+
+    std::optional<Queue::Consumer> consumer_;
+    std::string chunk_;
+    std::size_t chunk_offset_{0};
+    std::atomic<bool> is_paused_{false};
+};
+
+}  // namespace impl
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,37 @@
+#include <clients/http/request_coalescer.hpp>
+
+#include <clients/http/request_state.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::impl {
+
+std::optional<ResponseFuture>
+RequestCoalescer::JoinOrRegister(std::string key, const std::shared_ptr<RequestState>& request) {
+    auto in_flight = in_flight_.Lock();
+    auto& entry = (*in_flight)[key];
+
+    if (auto leader = entry.lock()) {
+        // The leader may have already completed and not unregistered yet
+        auto future = leader->TryJoinCoalesced();
+        if (future) return ResponseFuture{std::move(*future), std::move(leader)};
+    }
+
+    entry = request;
+    request->StartCoalesced(std::move(key));
+    return std::nullopt;
+}
+
+void RequestCoalescer::Unregister(const std::string& key, const RequestState& request) {
+    auto in_flight = in_flight_.Lock();
+    const auto it = in_flight->find(key);
+    if (it == in_flight->end()) return;
+
+    // The entry may already belong to a newer request with the same key
+    const auto leader = it->second.lock();
+    if (!leader || leader.get() == &request) in_flight->erase(it);
+}
+
+}  // namespace clients::http::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include <userver/clients/http/response_future.hpp>
+#include <userver/concurrent/variable.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+class RequestState;
+
+namespace impl {
+
+/// In-flight coalesced requests of a Client, keyed by the method, URL and
+/// the selected headers
+class RequestCoalescer final {
+public:
+    /// Returns a future of the identical in-flight request if there is one,
+    /// otherwise registers `request` as the in-flight one for the `key`
+    std::optional<ResponseFuture> JoinOrRegister(std::string key, const std::shared_ptr<RequestState>& request);
+
+    /// Makes the `request` impossible to join
+    void Unregister(const std::string& key, const RequestState& request);
+
+private:
+    concurrent::Variable<std::unordered_map<std::string, std::weak_ptr<RequestState>>, std::mutex> in_flight_;
+};
+
+}  // namespace impl
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -4,6 +4,7 @@
 #include <chrono>
 #include <map>
 #include <string_view>
+#include <utility>
 
 #include <cryptopp/osrng.h>
 #include <fmt/chrono.h>
@@ -15,6 +16,8 @@
 #include <boost/range/adaptor/transformed.hpp>
 
 #include <curl-ev/error_code.hpp>
+#include <clients/http/destination_sharding.hpp>
+#include <clients/http/request_coalescer.hpp>
 #include <userver/baggage/baggage.hpp>
 #include <userver/clients/dns/resolver.hpp>
 #include <userver/clients/http/connect_to.hpp>
@@ -22,6 +25,7 @@
 #include <userver/utils/assert.hpp>
 #include <userver/utils/async.hpp>
 #include <userver/utils/encoding/hex.hpp>
+#include <userver/utils/impl/usdt.hpp>
 #include <userver/utils/overloaded.hpp>
 #include <userver/utils/rand.hpp>
 #include <userver/utils/text_light.hpp>
@@ -245,11 +249,23 @@ RequestState::RequestState(
 }
 
 RequestState::~RequestState() {
+    if (body_stream_) body_stream_->Stop();
+
     std::error_code ec;
     easy().set_error_buffer(nullptr, ec);
     UASSERT(!ec);
 }
 
+std::shared_ptr<impl::RequestBodyStreamState>
+RequestState::stream_body(std::optional<std::size_t> content_length, std::size_t max_buffered_size) {
+    body_stream_ = std::make_shared<impl::RequestBodyStreamState>(max_buffered_size, weak_from_this());
+
+    std::optional<curl::native::curl_off_t> size;
+    if (content_length) size = static_cast<curl::native::curl_off_t>(*content_length);
+    easy().set_post_stream(&impl::RequestBodyStreamState::ReadFunction, body_stream_.get(), size);
+    return body_stream_;
+}
+
 void RequestState::follow_redirects(bool follow) {
     easy().set_follow_location(follow);
     easy().set_post_redir(static_cast<long>(follow));
@@ -342,9 +358,12 @@ void RequestState::connect_to(const ConnectTo& connect_to) {
     curl::native::curl_slist* ptr = connect_to.GetUnderlying();
     if (ptr) {
         easy().set_connect_to(ptr);
+        has_connect_to_ = true;
     }
 }
 
+void RequestState::load_balance() { load_balance_ = true; }
+
 void RequestState::proxy(const std::string& value) {
     proxy_url_ = value;
     easy().set_proxy(value);
@@ -364,11 +383,101 @@ void RequestState::http_auth_type(
 }
 
 void RequestState::Cancel() {
+    if (coalescing_) {
+        const std::lock_guard lock{coalescing_->mutex};
+        if (coalescing_->is_in_flight && --coalescing_->waiters != 0) return;
+    }
+
     // We can not call `retry_.timer.reset();` here because of data race
     is_cancelled_ = true;
     easy().cancel();
 }
 
+void RequestState::coalesce(std::vector<std::string> key_headers) {
+    UINVARIANT(coalescer_, "Request coalescing is not available for this request");
+    if (!coalescing_) coalescing_ = std::make_unique<Coalescing>();
+    coalescing_->key_headers = std::move(key_headers);
+}
+
+void RequestState::SetMethod(std::string_view method) noexcept { method_ = method; }
+
+void RequestState::SetRequestCoalescer(std::shared_ptr<impl::RequestCoalescer> coalescer) {
+    coalescer_ = std::move(coalescer);
+}
+
+void RequestState::SetAddressBalancer(std::shared_ptr<impl::AddressBalancer> balancer) {
+    address_balancer_ = std::move(balancer);
+}
+
+void RequestState::SetDestinationSharding(const impl::DestinationSharding* sharding) noexcept {
+    sharding_ = sharding;
+}
+
+std::optional<ResponseFuture> RequestState::JoinOrStartCoalesced() {
+    if (!coalescing_ || (method_ != "GET" && method_ != "HEAD")) return std::nullopt;
+
+    auto key = fmt::format("{} {}", method_, easy().get_original_url());
+    for (const auto& name : coalescing_->key_headers) {
+        const auto value = easy().FindHeaderByName(name);
+        fmt::format_to(std::back_inserter(key), "\n{}: {}", name, value.value_or(std::string_view{}));
+    }
+    return coalescer_->JoinOrRegister(std::move(key), shared_from_this());
+}
+
+std::optional<engine::Future<std::shared_ptr<Response>>> RequestState::TryJoinCoalesced() {
+    UASSERT(coalescing_);
+    const std::lock_guard lock{coalescing_->mutex};
+    if (!coalescing_->is_in_flight) return std::nullopt;
+
+    ++coalescing_->waiters;
+    return coalescing_->promises.emplace_back().get_future();
+}
+
+void RequestState::StartCoalesced(std::string key) {
+    UASSERT(coalescing_);
+    const std::lock_guard lock{coalescing_->mutex};
+    UASSERT(!coalescing_->is_in_flight && coalescing_->promises.empty());
+    coalescing_->is_in_flight = true;
+    coalescing_->key = std::move(key);
+    coalescing_->waiters = 1;
+}
+
+std::vector<RequestState::ResponsePromise> RequestState::FinishCoalesced() {
+    if (!coalescing_) return {};
+
+    std::vector<ResponsePromise> promises;
+    std::string key;
+    {
+        const std::lock_guard lock{coalescing_->mutex};
+        if (!coalescing_->is_in_flight) return {};
+        coalescing_->is_in_flight = false;
+        promises = std::exchange(coalescing_->promises, {});
+        key = std::move(coalescing_->key);
+    }
+    coalescer_->Unregister(key, *this);
+
+    if (!promises.empty()) {
+        WithRequestStats([count = promises.size()](RequestStats& stats) { stats.AccountCoalesced(count); });
+    }
+    return promises;
+}
+
+void RequestState::SetResponse(ResponsePromise&& promise, std::shared_ptr<Response> response) {
+    for (auto& waiter_promise : FinishCoalesced()) waiter_promise.set_value(response);
+
+    auto local_promise = std::move(promise);
+    // The task will wake up and may reuse RequestState.
+    local_promise.set_value(std::move(response));
+}
+
+void RequestState::SetException(ResponsePromise&& promise, std::exception_ptr exception) {
+    for (auto& waiter_promise : FinishCoalesced()) waiter_promise.set_exception(exception);
+
+    auto local_promise = std::move(promise);
+    // The task will wake up and may reuse RequestState.
+    local_promise.set_exception(std::move(exception));
+}
+
 void RequestState::SetDestinationMetricNameAuto(std::string destination) {
     destination_metric_name_ = std::move(destination);
 }
@@ -440,6 +549,9 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder, std::error
     auto& easy = holder->easy();
 
     // TODO don't swallow errors, report them to StreamedResponse
+    // The producer must not wait for the body to be read anymore
+    if (holder->body_stream_) holder->body_stream_->Stop();
+
     auto* stream_data = std::get_if<StreamData>(&holder->data_);
     if (stream_data && !stream_data->headers_promise_set.exchange(true)) {
         stream_data->headers_promise.set_value();
@@ -455,7 +567,9 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder, std::error
         err = TestsuiteResponseHook(status_code, headers, span);
     }
 
+    USERVER_IMPL_USDT(http_request_finish, holder.get(), static_cast<int>(status_code), err.value());
     holder->AccountResponse(err);
+    holder->AccountBalancedAddress(err, status_code);
     const auto sockets = easy.get_num_connects();
     holder->WithRequestStats([sockets](RequestStats& stats) { stats.AccountOpenSockets(sockets); });
 
@@ -483,9 +597,7 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder, std::error
         const utils::Overloaded visitor{
             [&holder, &err](FullBufferedData& buffered_data) {
                 { [[maybe_unused]] const auto cleanup = holder->response_move(); }
-                auto promise = std::move(buffered_data.promise_);
-                // The task will wake up and may reuse RequestState.
-                promise.set_exception(holder->PrepareException(err));
+                holder->SetException(std::move(buffered_data.promise_), holder->PrepareException(err));
             },
             [](StreamData& stream_data) {
                 auto producer = std::move(stream_data.queue_producer);
@@ -506,9 +618,7 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder, std::error
 
         const utils::Overloaded visitor{
             [&holder](FullBufferedData& buffered_data) {
-                auto promise = std::move(buffered_data.promise_);
-                // The task will wake up and may reuse RequestState.
-                promise.set_value(holder->response_move());
+                holder->SetResponse(std::move(buffered_data.promise_), holder->response_move());
             },
             [](StreamData& stream_data) {
                 auto producer = std::move(stream_data.queue_producer);
@@ -530,9 +640,11 @@ void RequestState::on_retry(std::shared_ptr<RequestState> holder, std::error_cod
     // - if we used all attempts
     // - if failed to reach server, and we should not retry on fails
     // - if this request was cancelled
+    // - if the body was streamed and can not be sent again
     const bool not_need_retry = (!err && !holder->ShouldRetryResponse()) ||
                                 (holder->retry_.current >= holder->retry_.retries) ||
-                                (err && !holder->retry_.on_fails) || holder->is_cancelled_.load();
+                                (err && !holder->retry_.on_fails) || holder->is_cancelled_.load() ||
+                                holder->body_stream_;
 
     if (not_need_retry) {
         // finish if no need to retry
@@ -592,6 +704,7 @@ void RequestState::parse_header(char* ptr, size_t size) try {
     if (ptr == end) {
         const auto status_code = static_cast<Status>(easy().get_response_code());
         response()->SetStatusCode(status_code);
+        AccountTlsHandshake();
         return;
     }
     *end = '\0';
@@ -642,6 +755,16 @@ std::string_view RequestState::GetLoggedEffectiveUrl() noexcept {
 }
 
 engine::Future<std::shared_ptr<Response>> RequestState::async_perform(utils::impl::SourceLocation location) {
+    return DoAsyncPerform(nullptr, location);
+}
+
+engine::Future<std::shared_ptr<Response>>
+RequestState::async_perform(curl::easy::perform_batch& batch, utils::impl::SourceLocation location) {
+    return DoAsyncPerform(&batch, location);
+}
+
+engine::Future<std::shared_ptr<Response>>
+RequestState::DoAsyncPerform(curl::easy::perform_batch* batch, utils::impl::SourceLocation location) {
     data_.emplace<FullBufferedData>();
 
     StartNewSpan(location);
@@ -653,12 +776,23 @@ engine::Future<std::shared_ptr<Response>> RequestState::async_perform(utils::imp
     // set place for response body
     easy().set_sink(&response_->sink_string());
 
-    auto future = std::get_if<FullBufferedData>(&data_)->promise_.get_future();
+    auto& buffered_data = std::get<FullBufferedData>(data_);
+    auto future = buffered_data.promise_.get_future();
+
+    if (plugin_pipeline_.HookTryReplyLocally(*this, *response_)) {
+        span.AddTag("replied_locally", 1);
+        span_storage_.reset();
+        SetResponse(std::move(buffered_data.promise_), response_move());
+        return future;
+    }
 
     if (UpdateTimeoutFromDeadlineAndCheck()) {
-        perform_request([holder = shared_from_this()](std::error_code err) mutable {
-            RequestState::on_retry(std::move(holder), err);
-        });
+        perform_request(
+            [holder = shared_from_this()](std::error_code err) mutable {
+                RequestState::on_retry(std::move(holder), err);
+            },
+            batch
+        );
     }
 
     return future;
@@ -690,7 +824,7 @@ RequestState::async_perform_stream(const std::shared_ptr<Queue>& queue, utils::i
     return future;
 }
 
-void RequestState::perform_request(curl::easy::handler_type handler) {
+void RequestState::perform_request(curl::easy::handler_type handler, curl::easy::perform_batch* batch) {
     UASSERT_MSG(!cert_ || pkey_, "Setting certificate is useless without setting private key");
 
     UASSERT(response_);
@@ -700,6 +834,10 @@ void RequestState::perform_request(curl::easy::handler_type handler) {
     UpdateTimeoutHeader();
 
     plugin_pipeline_.HookPerformRequest(*this);
+    USERVER_IMPL_USDT(http_request_start, this, retry_.current, GetLoggedOriginalUrl().c_str());
+
+    if (sharding_ && retry_.current == 1) BindToDestinationMulti();
+    tls_handshake_accounted_ = false;
 
     if (resolver_ && retry_.current == 1) {
         engine::AsyncNoSpan([this, holder = shared_from_this(), handler = std::move(handler)]() mutable {
@@ -710,15 +848,17 @@ void RequestState::perform_request(curl::easy::handler_type handler) {
                 // TODO: should retry - TAXICOMMON-4932
                 auto* buffered_data = std::get_if<FullBufferedData>(&data_);
                 if (buffered_data) {
-                    buffered_data->promise_.set_exception(std::current_exception());
+                    SetException(std::move(buffered_data->promise_), std::current_exception());
                 }
             } catch (const BaseException& ex) {
                 auto* buffered_data = std::get_if<FullBufferedData>(&data_);
                 if (buffered_data) {
-                    buffered_data->promise_.set_exception(std::current_exception());
+                    SetException(std::move(buffered_data->promise_), std::current_exception());
                 }
             }
         }).Detach();
+    } else if (batch) {
+        batch->emplace_back(easy().shared_from_this(), std::move(handler));
     } else {
         easy().async_perform(std::move(handler));
     }
@@ -785,10 +925,8 @@ void RequestState::HandleDeadlineAlreadyPassed() {
     auto exc = PrepareDeadlinePassedException(GetLoggedOriginalUrl(), easy().get_local_stats());
 
     const utils::Overloaded visitor{
-        [&exc](FullBufferedData& buffered_data) {
-            auto promise = std::move(buffered_data.promise_);
-            // The task will wake up and may reuse RequestState.
-            promise.set_exception(std::move(exc));
+        [this, &exc](FullBufferedData& buffered_data) {
+            SetException(std::move(buffered_data.promise_), std::move(exc));
         },
         [&exc](StreamData& stream_data) {
             if (!stream_data.headers_promise_set.exchange(true)) {
@@ -1010,7 +1148,74 @@ void RequestState::ResolveTargetAddress(clients::dns::Resolver& resolver) {
     auto addr_strings =
         addrs | boost::adaptors::transformed([](const auto& addr) { return addr.PrimaryAddressString(); });
 
-    easy().add_resolve(hostname, target.Get().GetPortPtr().get(), fmt::to_string(fmt::join(addr_strings, ",")));
+    const std::string port = target.Get().GetPortPtr().get();
+    easy().add_resolve(hostname, port, fmt::to_string(fmt::join(addr_strings, ",")));
+
+    // CURLOPT_CONNECT_TO applies to the target host, not to the proxy
+    if (load_balance_ && address_balancer_ && !has_connect_to_ && proxy_url_.empty()) {
+        BalanceTargetAddress(hostname, port, {addr_strings.begin(), addr_strings.end()});
+    }
+}
+
+void RequestState::AccountTlsHandshake() {
+    // The TLS info is available only while the connection is attached to the
+    // transfer, so it is checked once the first headers are received
+    if (std::exchange(tls_handshake_accounted_, true)) return;
+    if (easy().get_num_connects() == 0) return;
+
+    const auto is_resumed = easy().is_tls_session_reused();
+    if (!is_resumed) return;
+    WithRequestStats([is_resumed = *is_resumed](RequestStats& stats) { stats.AccountTlsHandshake(is_resumed); });
+}
+
+void RequestState::BindToDestinationMulti() {
+    std::optional<MaybeOwnedUrl> target_storage;
+    try {
+        target_storage.emplace(proxy_url_, easy());
+    } catch (const BadArgumentException&) {
+        // Reported when the request is performed
+        return;
+    }
+    const auto& target = *target_storage;
+
+    std::error_code ec;
+    const auto host = target.Get().GetHostPtr(ec);
+    if (ec || !host) return;
+    const auto port = target.Get().GetPortPtr(ec);
+    if (ec || !port) return;
+
+    easy().SetMulti(sharding_->GetMulti(fmt::format("{}:{}", host.get(), port.get())));
+}
+
+void RequestState::BalanceTargetAddress(
+    const std::string& hostname,
+    const std::string& port,
+    std::vector<std::string> addresses
+) {
+    balanced_address_ = address_balancer_->Pick(fmt::format("{}:{}", hostname, port), addresses);
+    if (!balanced_address_) return;
+
+    // Connections are reused only for the same CURLOPT_CONNECT_TO target, so
+    // the requests are balanced even over the keep-alive connections
+    const auto& address = balanced_address_.GetAddress();
+    const bool is_ipv6 = address.find(':') != std::string::npos;
+    balanced_connect_to_.emplace(
+        fmt::format(is_ipv6 ? "{0}:{1}:[{2}]:{1}" : "{0}:{1}:{2}:{1}", hostname, port, address)
+    );
+    easy().set_connect_to(balanced_connect_to_->GetUnderlying());
+}
+
+void RequestState::AccountBalancedAddress(std::error_code err, Status status_code) {
+    if (!balanced_address_) return;
+
+    const auto error_group = err ? Statistics::ErrorCodeToGroup(err) : Statistics::ErrorGroup::kOk;
+    if (error_group == Statistics::ErrorGroup::kCancelled) {
+        balanced_address_ = {};
+    } else if (err || static_cast<int>(status_code) >= 500) {
+        balanced_address_.AccountFailure();
+    } else {
+        balanced_address_.AccountSuccess(std::chrono::microseconds{easy().get_total_time_usec()});
+    }
 }
 
 void RequestState::SetTracingManager(const tracing::TracingManagerBase& m) { tracing_manager_ = m; }
@@ -3,12 +3,15 @@
 #include <array>
 #include <cstdlib>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <system_error>
+#include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/clients/http/config.hpp>
+#include <userver/clients/http/connect_to.hpp>
 #include <userver/clients/http/error.hpp>
 #include <userver/clients/http/form.hpp>
 #include <userver/clients/http/plugin.hpp>
@@ -26,8 +29,10 @@
 #include <userver/tracing/tags.hpp>
 #include <userver/utils/not_null.hpp>
 
+#include <clients/http/address_balancer.hpp>
 #include <clients/http/destination_statistics.hpp>
 #include <clients/http/easy_wrapper.hpp>
+#include <clients/http/request_body_stream_state.hpp>
 #include <clients/http/testsuite.hpp>
 #include <crypto/helpers.hpp>
 #include <engine/ev/watcher/timer_watcher.hpp>
@@ -37,7 +42,11 @@ USERVER_NAMESPACE_BEGIN
 namespace clients::http {
 
 class StreamedResponse;
-class ConnectTo;
+
+namespace impl {
+class DestinationSharding;
+class RequestCoalescer;
+}  // namespace impl
 
 class RequestState : public std::enable_shared_from_this<RequestState> {
 public:
@@ -58,12 +67,47 @@ public:
         utils::impl::SourceLocation location = utils::impl::SourceLocation::Current()
     );
 
+    /// Same as async_perform(), but the first attempt is appended to `batch`
+    /// instead of being started, unless it has to resolve the host first
+    engine::Future<std::shared_ptr<Response>>
+    async_perform(curl::easy::perform_batch& batch, utils::impl::SourceLocation location);
+
     /// Perform streaming http request, returns headers future
     engine::Future<void> async_perform_stream(
         const std::shared_ptr<Queue>& queue,
         utils::impl::SourceLocation location = utils::impl::SourceLocation::Current()
     );
 
+    /// Makes the body sent from the returned stream while the request is
+    /// performed, disables retries
+    std::shared_ptr<impl::RequestBodyStreamState>
+    stream_body(std::optional<std::size_t> content_length, std::size_t max_buffered_size);
+
+    /// Makes concurrent identical requests share a single in-flight one, see
+    /// Request::coalesce()
+    void coalesce(std::vector<std::string> key_headers);
+
+    /// Empty for a custom method, such requests are never coalesced
+    void SetMethod(std::string_view method) noexcept;
+    std::string_view GetMethod() const noexcept { return method_; }
+
+    void SetRequestCoalescer(std::shared_ptr<impl::RequestCoalescer> coalescer);
+
+    void SetAddressBalancer(std::shared_ptr<impl::AddressBalancer> balancer);
+
+    /// Makes the request performed in the curl::multi of its destination host
+    void SetDestinationSharding(const impl::DestinationSharding* sharding) noexcept;
+
+    /// Returns a future of an identical in-flight request, or registers this
+    /// one as the in-flight request to be performed by async_perform()
+    std::optional<ResponseFuture> JoinOrStartCoalesced();
+
+    /// @cond
+    // For impl::RequestCoalescer only
+    std::optional<engine::Future<std::shared_ptr<Response>>> TryJoinCoalesced();
+    void StartCoalesced(std::string key);
+    /// @endcond
+
     /// set redirect flags
     void follow_redirects(bool follow);
     /// set verify flags
@@ -86,6 +130,8 @@ public:
     void unix_socket_path(const std::string& path);
     /// set connect_to option
     void connect_to(const ConnectTo& connect_to);
+    /// balance among the resolved addresses, see Request::load_balance()
+    void load_balance();
     /// sets proxy to use
     void proxy(const std::string& value);
     /// sets proxy auth type to use
@@ -104,7 +150,7 @@ public:
 
     [[noreturn]] void ThrowDeadlineExpiredException();
 
-    /// cancel request
+    /// cancel request, a coalesced request is cancelled by its last waiter
     void Cancel();
 
     void SetDestinationMetricNameAuto(std::string destination);
@@ -152,7 +198,9 @@ private:
     /// simply run perform_request if there is now errors from timer
     void on_retry_timer(std::error_code err);
     /// run curl async_request, called once per attempt
-    void perform_request(curl::easy::handler_type handler);
+    void perform_request(curl::easy::handler_type handler, curl::easy::perform_batch* batch = nullptr);
+    engine::Future<std::shared_ptr<Response>>
+    DoAsyncPerform(curl::easy::perform_batch* batch, utils::impl::SourceLocation location);
 
     void UpdateTimeoutFromDeadline(std::chrono::milliseconds backoff);
     [[nodiscard]] bool UpdateTimeoutFromDeadlineAndCheck(std::chrono::milliseconds backoff = {});
@@ -167,6 +215,14 @@ private:
 
     static size_t StreamWriteFunction(char* ptr, size_t size, size_t nmemb, void* userdata);
 
+    using ResponsePromise = engine::Promise<std::shared_ptr<Response>>;
+
+    /// Makes the in-flight coalesced request impossible to join and returns
+    /// the promises of the joined waiters
+    std::vector<ResponsePromise> FinishCoalesced();
+    void SetResponse(ResponsePromise&& promise, std::shared_ptr<Response> response);
+    void SetException(ResponsePromise&& promise, std::exception_ptr exception);
+
     void AccountResponse(std::error_code err);
     std::exception_ptr PrepareException(std::error_code err);
 
@@ -179,6 +235,10 @@ private:
     void WithRequestStats(const Func& func);
 
     void ResolveTargetAddress(clients::dns::Resolver& resolver);
+    void BindToDestinationMulti();
+    void BalanceTargetAddress(const std::string& hostname, const std::string& port, std::vector<std::string> addresses);
+    void AccountBalancedAddress(std::error_code err, Status status_code);
+    void AccountTlsHandshake();
 
     /// curl handler wrapper
     impl::EasyWrapper easy_;
@@ -231,7 +291,15 @@ private:
 
     clients::dns::Resolver* resolver_{nullptr};
     std::string proxy_url_;
+    bool has_connect_to_{false};
+    bool tls_handshake_accounted_{false};
+
+    bool load_balance_{false};
+    std::shared_ptr<impl::AddressBalancer> address_balancer_;
+    impl::AddressBalancer::Lease balanced_address_;
+    std::optional<ConnectTo> balanced_connect_to_;
     impl::PluginPipeline& plugin_pipeline_;
+    const impl::DestinationSharding* sharding_{nullptr};
 
     struct StreamData {
         StreamData(Queue::Producer&& queue_producer) : queue_producer(std::move(queue_producer)) {}
@@ -246,6 +314,23 @@ private:
     };
 
     std::variant<FullBufferedData, StreamData> data_;
+
+    std::shared_ptr<impl::RequestBodyStreamState> body_stream_;
+
+    struct Coalescing {
+        std::vector<std::string> key_headers;
+
+        std::mutex mutex;
+        bool is_in_flight{false};
+        std::string key;
+        // The performing request and the joined ones
+        std::size_t waiters{0};
+        std::vector<ResponsePromise> promises;
+    };
+
+    std::shared_ptr<impl::RequestCoalescer> coalescer_;
+    std::unique_ptr<Coalescing> coalescing_;
+    std::string_view method_;
 };
 
 }  // namespace clients::http
@@ -70,6 +70,17 @@ void RequestStats::StoreTimeToStart(std::chrono::microseconds micro_seconds) noe
 void RequestStats::AccountOpenSockets(size_t sockets) noexcept {
     UASSERT(stats_);
     stats_->socket_open_ += utils::statistics::Rate{sockets};
+    if (sockets) {
+        ++stats_->cold_connections_;
+    } else {
+        ++stats_->warm_connections_;
+    }
+}
+
+void RequestStats::AccountTlsHandshake(bool is_session_resumed) noexcept {
+    UASSERT(stats_);
+    ++stats_->tls_handshakes_;
+    if (is_session_resumed) ++stats_->tls_resumed_;
 }
 
 void RequestStats::AccountTimeoutUpdatedByDeadline() noexcept {
@@ -77,6 +88,11 @@ void RequestStats::AccountTimeoutUpdatedByDeadline() noexcept {
     ++stats_->timeout_updated_by_deadline_;
 }
 
+void RequestStats::AccountCoalesced(std::size_t count) noexcept {
+    UASSERT(stats_);
+    stats_->coalesced_ += utils::statistics::Rate{count};
+}
+
 void RequestStats::AccountCancelledByDeadline() noexcept {
     UASSERT(stats_);
     ++stats_->cancelled_by_deadline_;
@@ -166,8 +182,19 @@ void DumpMetric(utils::statistics::Writer& writer, const DestinationStatisticsVi
 
     writer["timeout-updated-by-deadline"] = stats.timeout_updated_by_deadline;
     writer["cancelled-by-deadline"] = stats.cancelled_by_deadline;
+    // Coalescing ratio is coalesced-requests / (coalesced-requests + errors)
+    writer["coalesced-requests"] = stats.coalesced;
 
     writer["sockets"]["open"] = stats.multi.socket_open;
+
+    // Requests served by already established and by new connections,
+    // connection reuse ratio is warm / (warm + cold)
+    writer["connections"]["warm"] = stats.warm_connections;
+    writer["connections"]["cold"] = stats.cold_connections;
+
+    // TLS session resumption rate is resumed / handshakes
+    writer["tls"]["handshakes"] = stats.tls_handshakes;
+    writer["tls"]["resumed"] = stats.tls_resumed;
 }
 
 void DumpMetric(utils::statistics::Writer& writer, const InstanceStatistics& stats) {
@@ -202,6 +229,11 @@ InstanceStatistics::InstanceStatistics(const Statistics& other)
       retries(other.retries_.Load()),
       timeout_updated_by_deadline(other.timeout_updated_by_deadline_.Load()),
       cancelled_by_deadline(other.cancelled_by_deadline_.Load()),
+      coalesced(other.coalesced_.Load()),
+      warm_connections(other.warm_connections_.Load()),
+      cold_connections(other.cold_connections_.Load()),
+      tls_handshakes(other.tls_handshakes_.Load()),
+      tls_resumed(other.tls_resumed_.Load()),
       reply_status(other.reply_status_) {
     for (size_t i = 0; i < error_count.size(); i++) error_count[i] = other.error_count_[i].Load();
     multi.socket_open = other.socket_open_.Load();
@@ -234,6 +266,11 @@ InstanceStatistics& InstanceStatistics::operator+=(const InstanceStatistics& sta
 
     timeout_updated_by_deadline += stat.timeout_updated_by_deadline;
     cancelled_by_deadline += stat.cancelled_by_deadline;
+    coalesced += stat.coalesced;
+    warm_connections += stat.warm_connections;
+    cold_connections += stat.cold_connections;
+    tls_handshakes += stat.tls_handshakes;
+    tls_resumed += stat.tls_resumed;
     reply_status += stat.reply_status;
 
     multi += stat.multi;
@@ -36,11 +36,18 @@ public:
 
     void StoreTimeToStart(std::chrono::microseconds micro_seconds) noexcept;
 
+    /// Accounts the request as served by a new (cold) connection if it opened
+    /// sockets, by an already established (warm) one otherwise.
     void AccountOpenSockets(size_t sockets) noexcept;
 
+    void AccountTlsHandshake(bool is_session_resumed) noexcept;
+
     void AccountTimeoutUpdatedByDeadline() noexcept;
     void AccountCancelledByDeadline() noexcept;
 
+    /// `count` requests got the response of this one instead of being performed
+    void AccountCoalesced(std::size_t count) noexcept;
+
 private:
     void StoreTiming() noexcept;
 
@@ -103,8 +110,13 @@ private:
     std::array<utils::statistics::RateCounter, kErrorGroupCount> error_count_;
     utils::statistics::RateCounter retries_;
     utils::statistics::RateCounter socket_open_{0};
+    utils::statistics::RateCounter warm_connections_;
+    utils::statistics::RateCounter cold_connections_;
+    utils::statistics::RateCounter tls_handshakes_;
+    utils::statistics::RateCounter tls_resumed_;
     utils::statistics::RateCounter timeout_updated_by_deadline_;
     utils::statistics::RateCounter cancelled_by_deadline_;
+    utils::statistics::RateCounter coalesced_;
     utils::statistics::HttpCodes reply_status_;
 
     friend struct InstanceStatistics;
@@ -132,6 +144,11 @@ struct InstanceStatistics {
 
     utils::statistics::Rate timeout_updated_by_deadline;
     utils::statistics::Rate cancelled_by_deadline;
+    utils::statistics::Rate coalesced;
+    utils::statistics::Rate warm_connections;
+    utils::statistics::Rate cold_connections;
+    utils::statistics::Rate tls_handshakes;
+    utils::statistics::Rate tls_resumed;
     utils::statistics::HttpCodes::Snapshot reply_status;
 
     MultiStats multi;
@@ -3,6 +3,7 @@
 #include <userver/congestion_control/component.hpp>
 #include <userver/server/component.hpp>
 #include <userver/server/handlers/auth/auth_checker_settings_component.hpp>
+#include <userver/server/handlers/cpu_profiler.hpp>
 #include <userver/server/handlers/dns_client_control.hpp>
 #include <userver/server/handlers/dynamic_debug_log.hpp>
 #include <userver/server/handlers/implicit_options.hpp>
@@ -10,6 +11,7 @@
 #include <userver/server/handlers/jemalloc.hpp>
 #include <userver/server/handlers/log_level.hpp>
 #include <userver/server/handlers/on_log_rotate.hpp>
+#include <userver/server/handlers/perf_record.hpp>
 #include <userver/server/handlers/server_monitor.hpp>
 #include <userver/server/handlers/tests_control.hpp>
 #include <userver/server/middlewares/configuration.hpp>
@@ -22,6 +24,7 @@ namespace components {
 ComponentList CommonServerComponentList() {
     return components::ComponentList()
         .Append<components::Server>()
+        .Append<server::handlers::CpuProfiler>()
         .Append<server::handlers::DnsClientControl>()
         .Append<server::handlers::DynamicDebugLog>()
         .Append<server::handlers::ImplicitOptions>()
@@ -29,6 +32,7 @@ ComponentList CommonServerComponentList() {
         .Append<server::handlers::Jemalloc>()
         .Append<server::handlers::LogLevel>()
         .Append<server::handlers::OnLogRotate>()
+        .Append<server::handlers::PerfRecord>()
         .Append<server::handlers::ServerMonitor>()
         .Append<server::handlers::TestsControl>()
         .Append<congestion_control::Component>()
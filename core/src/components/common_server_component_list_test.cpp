@@ -4,6 +4,7 @@
 
 #include <components/component_list_test.hpp>
 #include <userver/components/common_component_list.hpp>
+#include <userver/components/process_starter.hpp>
 #include <userver/components/run.hpp>
 #include <userver/fs/blocking/temp_directory.hpp>  // for fs::blocking::TempDirectory
 #include <userver/fs/blocking/write.hpp>           // for fs::blocking::RewriteFileContents
@@ -200,6 +201,25 @@ components_manager:
         method: POST
         task_processor: monitor-task-processor
 # /// [Sample handler jemalloc component config]
+# /// [Sample handler cpu profiler component config]
+# yaml
+    handler-cpu-profiler:
+        path: /service/cpu-profiler
+        method: GET
+        task_processor: monitor-task-processor
+# /// [Sample handler cpu profiler component config]
+# /// [Sample handler perf record component config]
+# yaml
+    handler-perf-record:
+        path: /service/perf-record
+        method: GET
+        task_processor: monitor-task-processor
+        fs-task-processor: main-task-processor
+        perf-path: perf
+        event: cycles:u
+    process-starter:
+        task_processor: monitor-task-processor
+# /// [Sample handler perf record component config]
 # /// [Sample handler dns client control component config]
 # yaml
     handler-dns-client-control:
@@ -286,6 +306,7 @@ TEST_F(CommonServerComponentList, Smoke) {
         components::CommonComponentList()
             .AppendComponentList(components::CommonServerComponentList())
             .Append<server::handlers::Ping>()
+            .Append<components::ProcessStarter>()
     );
 }
 
@@ -312,6 +333,7 @@ TEST_F(CommonServerComponentList, Logger) {
         components::CommonComponentList()
             .AppendComponentList(components::CommonServerComponentList())
             .Append<server::handlers::Ping>()
+            .Append<components::ProcessStarter>()
     );
 
     logging::SetDefaultLoggerLevel(logging::Level::kInfo);
@@ -344,6 +366,7 @@ TEST_F(CommonServerComponentList, TraceLogging) {
         components::CommonComponentList()
             .AppendComponentList(components::CommonServerComponentList())
             .Append<server::handlers::Ping>()
+            .Append<components::ProcessStarter>()
     );
 }
 
@@ -367,6 +390,7 @@ TEST_F(CommonServerComponentList, NullLogging) {
         components::CommonComponentList()
             .AppendComponentList(components::CommonServerComponentList())
             .Append<server::handlers::Ping>()
+            .Append<components::ProcessStarter>()
     );
 }
 
@@ -388,7 +412,8 @@ TEST_F(CommonServerComponentList, BlockingDefaultLogger) {
     const components::InMemoryConfig config{std::string{kStaticConfig} + GetConfigVarsPath()};
     const auto component_list = components::CommonComponentList()
                                     .AppendComponentList(components::CommonServerComponentList())
-                                    .Append<server::handlers::Ping>();
+                                    .Append<server::handlers::Ping>()
+                                    .Append<components::ProcessStarter>();
     UEXPECT_THROW_MSG(components::RunOnce(config, component_list), std::exception, "efault logger");
 }
 
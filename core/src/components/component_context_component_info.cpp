@@ -20,7 +20,7 @@ namespace components::impl {
 StageSwitchingCancelledException::StageSwitchingCancelledException(const std::string& message)
     : std::runtime_error(message) {}
 
-ComponentInfo::ComponentInfo(std::string name) : name_(std::move(name)) {}
+ComponentInfo::ComponentInfo(std::string name) : name_(std::move(name)) { load_timings_.name = name_; }
 
 void ComponentInfo::SetComponent(std::unique_ptr<RawComponentBase>&& component) {
     bool call_on_loading_cancelled = false;
@@ -112,7 +112,12 @@ void ComponentInfo::OnLoadingCancelled() {
 void ComponentInfo::OnAllComponentsLoaded() {
     if (!HasComponent()) return;
     try {
+        const auto start = std::chrono::steady_clock::now();
         component_->OnAllComponentsLoaded();
+        UpdateLoadTimings([&start](ComponentLoadTimings& timings) {
+            timings.on_all_components_loaded =
+                std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        });
     } catch (const std::exception& ex) {
         std::string message = "OnAllComponentsLoaded() failed for component " + name_ + ": " + ex.what();
         LOG_ERROR() << message;
@@ -158,6 +163,11 @@ std::string ComponentInfo::GetDependencies() const {
     return fmt::format(R"("{}" -> "{}" )", name_, fmt::join(it_depends_on_, delimiter));
 }
 
+ComponentLoadTimings ComponentInfo::GetLoadTimings() const {
+    std::lock_guard lock{mutex_};
+    return load_timings_;
+}
+
 bool ComponentInfo::HasComponent() const {
     std::lock_guard lock{mutex_};
     return !!component_;
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 #include <userver/components/raw_component_base.hpp>
 #include <userver/engine/condition_variable.hpp>
@@ -22,6 +24,29 @@ public:
     explicit StageSwitchingCancelledException(const std::string& message);
 };
 
+/// Startup timeline of a component
+struct ComponentLoadTimings final {
+    std::string name;
+
+    // Since the start of the components loading
+    std::chrono::milliseconds started{0};
+
+    // Wall time of the constructor, including the waits below and the work
+    // done in the constructor, e.g. the first update of a cache
+    std::chrono::milliseconds construction{0};
+
+    // Time the constructor waited in FindComponent() for the other components
+    std::chrono::milliseconds dependencies_wait{0};
+
+    // Time the constructor waited because of max_concurrent_component_loads
+    std::chrono::milliseconds slot_wait{0};
+
+    std::chrono::milliseconds on_all_components_loaded{0};
+
+    // The components that were not loaded yet when this one asked for them
+    std::vector<std::string> waited_dependencies;
+};
+
 class ComponentInfo final {
 public:
     explicit ComponentInfo(std::string name);
@@ -91,6 +116,14 @@ public:
 
     std::string GetDependencies() const;
 
+    template <typename Func>
+    void UpdateLoadTimings(const Func& func) {
+        std::lock_guard lock{mutex_};
+        func(load_timings_);
+    }
+
+    ComponentLoadTimings GetLoadTimings() const;
+
 private:
     bool HasComponent() const;
     std::unique_ptr<RawComponentBase> ExtractComponent();
@@ -105,6 +138,7 @@ private:
     ComponentLifetimeStage stage_ = ComponentLifetimeStage::kNull;
     bool stage_switching_cancelled_{false};
     std::atomic<bool> on_loading_cancelled_called_{false};
+    ComponentLoadTimings load_timings_;
 };
 
 }  // namespace components::impl
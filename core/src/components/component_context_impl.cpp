@@ -1,6 +1,7 @@
 #include <components/component_context_impl.hpp>
 
 #include <algorithm>
+#include <limits>
 #include <queue>
 
 #include <fmt/format.h>
@@ -13,6 +14,7 @@
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/async.hpp>
+#include <userver/utils/scope_guard.hpp>
 
 #include <components/component_context_component_info.hpp>
 #include <components/impl/component_name_from_info.hpp>
@@ -28,6 +30,15 @@ namespace {
 const std::string kOnAllComponentsLoadedRootName = "all_components_loaded";
 const std::string kClearComponentsRootName = "clear_components";
 
+std::chrono::milliseconds MillisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+}
+
+engine::Semaphore::Counter GetLoadSlotsCount(const Manager& manager) {
+    const auto max_concurrent_loads = manager.GetConfig().max_concurrent_component_loads;
+    return max_concurrent_loads ? max_concurrent_loads : std::numeric_limits<engine::Semaphore::Counter>::max();
+}
+
 const std::chrono::seconds kPrintAddingComponentsPeriod{10};
 
 template <class Container>
@@ -82,7 +93,7 @@ ComponentContextImpl::SearchingComponentScope::~SearchingComponentScope() {
 }
 
 ComponentContextImpl::ComponentContextImpl(const Manager& manager, std::vector<std::string>&& loading_component_names)
-    : manager_(manager) {
+    : manager_(manager), load_start_(std::chrono::steady_clock::now()), load_slots_(GetLoadSlotsCount(manager)) {
     UASSERT(std::is_sorted(loading_component_names.begin(), loading_component_names.end()));
     UASSERT(
         std::unique(loading_component_names.begin(), loading_component_names.end()) == loading_component_names.end()
@@ -114,7 +125,18 @@ ComponentContextImpl::AddComponent(std::string_view name, const ComponentFactory
     if (component_info.GetComponent())
         throw std::runtime_error("trying to add component " + std::string{name} + " multiple times");
 
+    const auto started = std::chrono::steady_clock::now();
+    load_slots_.lock_shared();
+    const utils::ScopeGuard release_load_slot([this] { load_slots_.unlock_shared(); });
+    const auto slot_wait = MillisecondsSince(started);
+
+    const auto construction_started = std::chrono::steady_clock::now();
     component_info.SetComponent(factory(context));
+    component_info.UpdateLoadTimings([&](ComponentLoadTimings& timings) {
+        timings.started = std::chrono::duration_cast<std::chrono::milliseconds>(started - load_start_);
+        timings.slot_wait += slot_wait;
+        timings.construction = MillisecondsSince(construction_started);
+    });
     auto* component = component_info.GetComponent();
     if (component) {
         // Call the following command on logs to get the component dependencies:
@@ -433,7 +455,38 @@ RawComponentBase* ComponentContextImpl::DoFindComponent(std::string_view name) {
     }
     SearchingComponentScope finder(*this, this_component_name);
 
-    return component_info.WaitAndGetComponent();
+    // The waiting constructor gives its slot to the components that may be
+    // constructed meanwhile
+    const auto wait_started = std::chrono::steady_clock::now();
+    load_slots_.unlock_shared();
+    RawComponentBase* dependency = nullptr;
+    try {
+        dependency = component_info.WaitAndGetComponent();
+    } catch (...) {
+        load_slots_.lock_shared();
+        throw;
+    }
+    const auto dependencies_wait = MillisecondsSince(wait_started);
+
+    const auto slot_wait_started = std::chrono::steady_clock::now();
+    load_slots_.lock_shared();
+    const auto slot_wait = MillisecondsSince(slot_wait_started);
+
+    components_.at(this_component_name).UpdateLoadTimings([&](ComponentLoadTimings& timings) {
+        timings.dependencies_wait += dependencies_wait;
+        timings.slot_wait += slot_wait;
+        timings.waited_dependencies.emplace_back(name);
+    });
+    return dependency;
+}
+
+std::vector<ComponentLoadTimings> ComponentContextImpl::GetLoadTimeline() const {
+    std::vector<ComponentLoadTimings> result;
+    result.reserve(components_.size());
+    for (const auto& [name, component_info] : components_) {
+        if (component_info.GetComponent()) result.push_back(component_info.GetLoadTimings());
+    }
+    return result;
 }
 
 void ComponentContextImpl::AddDependency(impl::ComponentNameFromInfo name) {
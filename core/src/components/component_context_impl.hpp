@@ -3,6 +3,7 @@
 #include <userver/components/component_context.hpp>
 
 #include <atomic>
+#include <chrono>
 #include <set>
 #include <stdexcept>
 #include <unordered_map>
@@ -12,6 +13,7 @@
 #include <userver/concurrent/variable.hpp>
 #include <userver/engine/condition_variable.hpp>
 #include <userver/engine/mutex.hpp>
+#include <userver/engine/semaphore.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/engine/task/task_with_result.hpp>
@@ -57,6 +59,9 @@ public:
 
     RawComponentBase* DoFindComponent(std::string_view name);
 
+    /// Timings of the loaded components
+    std::vector<ComponentLoadTimings> GetLoadTimeline() const;
+
 private:
     class TaskToComponentMapScope final {
     public:
@@ -152,6 +157,11 @@ private:
     const Manager& manager_;
 
     ComponentMap components_;
+
+    const std::chrono::steady_clock::time_point load_start_;
+    // Held by the constructing components, released while a constructor waits
+    // for its dependencies
+    engine::Semaphore load_slots_;
     std::atomic_flag components_load_cancelled_ ATOMIC_FLAG_INIT;
 
     engine::ConditionVariable print_adding_components_cv_;
@@ -1,12 +1,18 @@
 #include <userver/components/logging_configurator.hpp>
 
+#include <fmt/format.h>
+
 #include <logging/dynamic_debug.hpp>
 #include <logging/dynamic_debug_config.hpp>
 #include <tracing/no_log_spans.hpp>
+#include <tracing/tail_sampling.hpp>
 #include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/tracing/tracer.hpp>
+#include <userver/utils/statistics/rate.hpp>
+#include <userver/utils/statistics/writer.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 #include <logging/rate_limit.hpp>
@@ -29,6 +35,14 @@ const dynamic_config::Key<tracing::NoLogSpans> kNoLogSpans{
 )"}};
 /// [key]
 
+const dynamic_config::Key<tracing::TailSamplingConfig> kTailSampling{
+    "USERVER_TRACING_TAIL_SAMPLING",
+    dynamic_config::DefaultAsJsonString{R"(
+  {
+    "enabled": false
+  }
+)"}};
+
 const dynamic_config::Key<logging::DynamicDebugConfig> kDynamicDebugConfig{
     "USERVER_LOG_DYNAMIC_DEBUG",
     dynamic_config::DefaultAsJsonString{R"(
@@ -38,6 +52,14 @@ const dynamic_config::Key<logging::DynamicDebugConfig> kDynamicDebugConfig{
   }
 )"}};
 
+const dynamic_config::Key<logging::LogSamplingConfig> kLogSamplingConfig{
+    "USERVER_LOG_SAMPLING",
+    dynamic_config::DefaultAsJsonString{R"(
+  {
+    "locations": {}
+  }
+)"}};
+
 }  // namespace
 
 LoggingConfigurator::LoggingConfigurator(const ComponentConfig& config, const ComponentContext& context) {
@@ -47,13 +69,29 @@ LoggingConfigurator::LoggingConfigurator(const ComponentConfig& config, const Co
     config_subscription_ = context.FindComponent<components::DynamicConfig>().GetSource().UpdateAndListen(
         this, kName, &LoggingConfigurator::OnConfigUpdate
     );
+
+    statistics_holder_ = context.FindComponent<components::StatisticsStorage>().GetStorage().RegisterWriter(
+        "logger.sampling",
+        [](utils::statistics::Writer& writer) {
+            logging::ForEachLogSampling([&writer](const logging::LogEntryContent& location, const auto& sampling) {
+                writer["suppressed"].ValueWithLabels(
+                    utils::statistics::Rate{sampling.GetSuppressedCount()},
+                    {"location", fmt::format("{}:{}", location.path, location.line)}
+                );
+            });
+        }
+    );
 }
 
-LoggingConfigurator::~LoggingConfigurator() { config_subscription_.Unsubscribe(); }
+LoggingConfigurator::~LoggingConfigurator() {
+    statistics_holder_.Unregister();
+    config_subscription_.Unsubscribe();
+}
 
 void LoggingConfigurator::OnConfigUpdate(const dynamic_config::Snapshot& config) {
     (void)this;  // silence clang-tidy
     tracing::Tracer::SetNoLogSpans(tracing::NoLogSpans{config[kNoLogSpans]});
+    tracing::impl::SetTailSamplingConfig(tracing::TailSamplingConfig{config[kTailSampling]});
 
     try {
         const auto& dd = config[kDynamicDebugConfig];
@@ -88,6 +126,25 @@ void LoggingConfigurator::OnConfigUpdate(const dynamic_config::Snapshot& config)
     } catch (const std::exception& e) {
         LOG_ERROR() << "Failed to set dynamic debug logs from config: " << e;
     }
+
+    try {
+        const auto& sampling = config[kLogSamplingConfig];
+        auto old_sampling = log_sampling_.Read();
+        if (!(*old_sampling == sampling)) {
+            auto lock = log_sampling_.StartWrite();
+            *lock = sampling;
+
+            logging::RemoveAllLogSampling();
+            for (const auto& [location, settings] : sampling.locations) {
+                const auto [path, line] = logging::SplitLocation(location);
+                logging::SetLogSampling(path, line, settings);
+            }
+
+            lock.Commit();
+        }
+    } catch (const std::exception& e) {
+        LOG_ERROR() << "Failed to set log sampling from config: " << e;
+    }
 }
 
 yaml_config::Schema LoggingConfigurator::GetStaticConfigSchema() {
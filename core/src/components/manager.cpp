@@ -1,5 +1,6 @@
 #include <components/manager.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <future>
 #include <set>
@@ -11,6 +12,7 @@
 #include <boost/range/adaptor/map.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 
+#include <components/component_context_component_info.hpp>
 #include <components/manager_config.hpp>
 #include <engine/task/exception_hacks.hpp>
 #include <engine/task/task_processor.hpp>
@@ -30,6 +32,9 @@ namespace {
 
 constexpr std::size_t kDefaultHwThreadsEstimate = 512;
 
+// The rest of the components are logged at the DEBUG level
+constexpr std::size_t kLoggedSlowestComponents = 10;
+
 template <typename Func>
 auto RunInCoro(engine::TaskProcessor& task_processor, Func&& func) {
     UASSERT(!engine::current_task::IsTaskProcessorThread());
@@ -94,6 +99,33 @@ void ValidateConfigs(
     }
 }
 
+void LogLoadTimeline(std::vector<components::impl::ComponentLoadTimings> timeline) {
+    std::sort(timeline.begin(), timeline.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.construction > rhs.construction;
+    });
+
+    for (std::size_t i = 0; i < timeline.size(); ++i) {
+        const auto& timings = timeline[i];
+        std::string waited_dependencies;
+        for (const auto& dependency : timings.waited_dependencies) {
+            if (!waited_dependencies.empty()) waited_dependencies += ", ";
+            waited_dependencies += dependency;
+        }
+
+        LOG(i < kLoggedSlowestComponents ? logging::Level::kInfo : logging::Level::kDebug) << fmt::format(
+            "Component '{}' started at {}ms, constructed in {}ms, waited {}ms for dependencies [{}] and {}ms for a "
+            "load slot, OnAllComponentsLoaded took {}ms",
+            timings.name,
+            timings.started.count(),
+            timings.construction.count(),
+            timings.dependencies_wait.count(),
+            waited_dependencies,
+            timings.slot_wait.count(),
+            timings.on_all_components_loaded.count()
+        );
+    }
+}
+
 }  // namespace
 
 namespace components {
@@ -231,6 +263,8 @@ std::chrono::steady_clock::time_point Manager::GetStartTime() const { return sta
 
 std::chrono::milliseconds Manager::GetLoadDuration() const { return load_duration_; }
 
+const std::vector<impl::ComponentLoadTimings>& Manager::GetLoadTimeline() const { return load_timeline_; }
+
 void Manager::CreateComponentContext(const ComponentList& component_list) {
     std::set<std::string> loading_component_names;
     for (const auto& adder : component_list) {
@@ -368,8 +402,10 @@ void Manager::AddComponents(const ComponentList& component_list) {
 
     auto stop_time = std::chrono::steady_clock::now();
     load_duration_ = std::chrono::duration_cast<std::chrono::milliseconds>(stop_time - start_time);
+    load_timeline_ = component_context_.GetLoadTimeline();
 
     LOG_INFO() << "All components loaded";
+    LogLoadTimeline(load_timeline_);
 }
 
 void Manager::AddComponentImpl(
@@ -29,6 +29,10 @@ namespace components {
 class ComponentList;
 struct ManagerConfig;
 
+namespace impl {
+struct ComponentLoadTimings;
+}  // namespace impl
+
 using ComponentConfigMap = std::unordered_map<std::string, const ComponentConfig&>;
 
 class Manager final {
@@ -48,6 +52,9 @@ public:
 
     std::chrono::milliseconds GetLoadDuration() const;
 
+    /// Construction timings of the components, available after the load
+    const std::vector<impl::ComponentLoadTimings>& GetLoadTimeline() const;
+
 private:
     class TaskProcessorsStorage final {
     public:
@@ -102,6 +109,7 @@ private:
     engine::TaskProcessor* default_task_processor_{nullptr};
     const std::chrono::steady_clock::time_point start_time_;
     std::chrono::milliseconds load_duration_{0};
+    std::vector<impl::ComponentLoadTimings> load_timeline_;
 
     os_signals::ProcessorComponent* signal_processor_{nullptr};
 };
@@ -111,6 +111,22 @@ properties:
                     lead to inaccuracy in coro pool size estimation.
                     local_cache_size=0 disables local cache.
                 defaultDescription: 8
+            numa_aware:
+                type: boolean
+                description: |
+                    keep a separate pool of used coroutines per NUMA node, so
+                    that worker threads reuse coroutine stacks that were
+                    faulted in on their own node. Works best with
+                    `pin-worker-threads` enabled for task processors.
+                defaultDescription: false
+            huge_pages:
+                type: boolean
+                description: |
+                    ask the kernel to back coroutine stacks with transparent
+                    huge pages to reduce TLB misses. Guard pages are kept, so
+                    only the stacks of at least the huge page size (usually
+                    2MiB) benefit from it.
+                defaultDescription: false
     event_thread_pool:
         type: object
         description: event thread pool options
@@ -121,6 +137,44 @@ properties:
                 description: >
                     number of threads to process low level IO system calls
                     (number of ev loops to start in libev)
+            backend:
+                type: string
+                description: |
+                    kernel event notification mechanism for the ev loops.
+                    `default` lets libev choose the recommended backend
+                    (epoll on Linux). `io_uring` batches the watcher updates
+                    via the submission queue instead of issuing an epoll_ctl
+                    per update, requires libev >= 4.31 and a kernel with
+                    io_uring support. If the backend is not available,
+                    the default one is used.
+                defaultDescription: default
+                enum:
+                  - default
+                  - epoll
+                  - io_uring
+                  - linuxaio
+                  - poll
+                  - select
+            timer_wheel_resolution:
+                type: string
+                description: |
+                    resolution of the per ev thread timer wheel, e.g. `1ms`.
+                    Cancellation deadlines and long sleeps are served by
+                    the wheel with O(1) arming, short sleeps keep using
+                    the precise libev timers. 0 disables the wheel.
+                defaultDescription: 0
+            file_io_uring_entries:
+                type: integer
+                description: |
+                    size of the io_uring submission queue for the file
+                    operations of coroutines (fs::ReadFileContents,
+                    fs::RewriteFileContents and the like). The operations
+                    suspend the coroutine instead of occupying a thread of the
+                    blocking task processor, their completions are reaped by
+                    an ev thread. Requires Linux 5.6+, otherwise the blocking
+                    task processor is used. 0 disables io_uring.
+                defaultDescription: 0
+                minimum: 0
     components:
         type: object
         description: 'dictionary of "component name": "options"'
@@ -162,6 +216,14 @@ properties:
                         tunes the number of spin-wait iterations in case of
                         an empty task queue before threads go to sleep
                     defaultDescription: 10000
+                adaptive-spinning:
+                    type: boolean
+                    description: |
+                        tune the spin-wait duration of each worker thread from
+                        the recently observed idle time between tasks, with
+                        `spinning-iterations` as the upper bound. Works only
+                        with `global-task-queue`.
+                    defaultDescription: false
                 task-processor-queue:
                     type: string
                     description: |
@@ -173,6 +235,26 @@ properties:
                     enum:
                       - global-task-queue
                       - work-stealing-task-queue
+                pin-worker-threads:
+                    type: boolean
+                    description: |
+                        pin each worker thread to a single CPU out of the CPUs
+                        allowed for the process. CPUs are assigned NUMA node by
+                        NUMA node and LLC by LLC, physical cores first.
+                        With `work-stealing-task-queue` workers steal from
+                        the closest workers first: SMT sibling, same LLC,
+                        same NUMA node, remote.
+                    defaultDescription: false
+                dedicated-jemalloc-arena:
+                    type: boolean
+                    description: |
+                        make the worker threads allocate from a jemalloc arena
+                        of their own, so that the memory of the caches updated
+                        on the task processor (see their `task-processor`
+                        option) does not fragment the arenas of the request
+                        handling threads. The arena statistics are reported in
+                        the task processor metrics. Requires jemalloc.
+                    defaultDescription: false
                 task-trace:
                     type: object
                     description: .
@@ -232,6 +314,13 @@ properties:
             the balancer a chance to redirect new requests to other hosts and
             to give the service a chance to finish handling old requests.
         defaultDescription: 0s
+    max_concurrent_component_loads:
+        type: integer
+        description: |
+            how many component constructors may run at the same time, 0 - no
+            limit. A constructor waiting for its dependencies does not count.
+        defaultDescription: 0
+        minimum: 0
 )");
 }
 
@@ -266,6 +355,8 @@ ManagerConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<Man
     );
     config.graceful_shutdown_interval =
         value["graceful_shutdown_interval"].As<std::chrono::milliseconds>(config.graceful_shutdown_interval);
+    config.max_concurrent_component_loads =
+        value["max_concurrent_component_loads"].As<std::size_t>(config.max_concurrent_component_loads);
 
     return config;
 }
@@ -26,6 +26,7 @@ struct ManagerConfig {
     ValidationMode validate_components_configs{};
     utils::impl::UserverExperimentSet enabled_experiments;
     std::chrono::milliseconds graceful_shutdown_interval{};
+    std::size_t max_concurrent_component_loads{0};  // 0 - unlimited
     bool mlock_debug_info{true};
     bool disable_phdr_cache{false};
     bool preheat_stacktrace_collector{true};
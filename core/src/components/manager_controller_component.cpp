@@ -1,13 +1,18 @@
 #include <userver/components/manager_controller_component.hpp>
 
+#include <components/component_context_component_info.hpp>
 #include <components/manager_config.hpp>
 #include <components/manager_controller_component_config.hpp>
+#include <engine/impl/task_accounting.hpp>
+#include <engine/io/tls_client_session_cache.hpp>
 #include <engine/task/task_processor.hpp>
 #include <engine/task/task_processor_pools.hpp>
 #include <userver/components/statistics_storage.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/logging/component.hpp>
+#include <utils/jemalloc.hpp>
+#include <utils/statistics/cardinality_limiter.hpp>
 
 #include <components/manager.hpp>
 
@@ -46,6 +51,39 @@ void DumpMetric(utils::statistics::Writer& writer, const engine::TaskProcessor&
         context_switch["no_overloaded"] = counter.GetTasksNoOverloadSensor().value;
     }
 
+    if (auto queue_wait_time = writer["queue-wait-time-us"]) {
+        for (const auto priority :
+             {engine::TaskPriority::kLatencyCritical, engine::TaskPriority::kNormal, engine::TaskPriority::kBackground}) {
+            queue_wait_time.ValueWithLabels(
+                task_processor.GetQueueWaitTimeHistogram(priority), {{"task_priority", engine::ToString(priority)}}
+            );
+        }
+    }
+
+    writer["execution-slice-us"] = task_processor.GetExecutionSliceHistogram();
+
+    if (const auto spinning_stats = task_processor.GetSpinningStats()) {
+        if (auto spinning = writer["spinning"]) {
+            spinning["budget-iterations"] =
+                spinning_stats->budget_iterations / std::max<std::size_t>(task_processor.GetWorkerCount(), 1);
+            spinning["spin-wakeups"] = spinning_stats->spin_wakeups;
+            spinning["sleep-wakeups"] = spinning_stats->sleep_wakeups;
+        }
+    }
+
+    if (const auto arena = task_processor.GetJemallocArena()) {
+        utils::jemalloc::ArenaStats stats;
+        if (!utils::jemalloc::GetArenaStats(*arena, stats)) {
+            if (auto jemalloc_arena = writer["jemalloc-arena"]) {
+                jemalloc_arena["allocated-bytes"] = stats.allocated;
+                jemalloc_arena["active-bytes"] = stats.active;
+                jemalloc_arena["resident-bytes"] = stats.resident;
+                jemalloc_arena["mapped-bytes"] = stats.mapped;
+                jemalloc_arena["threads"] = stats.threads;
+            }
+        }
+    }
+
     writer["worker-threads"] = task_processor.GetWorkerCount();
 }
 
@@ -57,15 +95,14 @@ ManagerControllerComponent::ManagerControllerComponent(
     const components::ComponentConfig&,
     const components::ComponentContext& context
 )
-    : components_manager_(context.GetManager()) {
-    auto& storage = context.FindComponent<components::StatisticsStorage>().GetStorage();
-
+    : components_manager_(context.GetManager()),
+      statistics_storage_(context.FindComponent<components::StatisticsStorage>().GetStorage()) {
     auto config_source = context.FindComponent<DynamicConfig>().GetSource();
     config_subscription_ =
         config_source.UpdateAndListen(this, "engine_controller", &ManagerControllerComponent::OnConfigUpdate);
 
     statistics_holder_ =
-        storage.RegisterWriter("engine", [this](utils::statistics::Writer& writer) { return WriteStatistics(writer); });
+        statistics_storage_.RegisterWriter("engine", [this](utils::statistics::Writer& writer) { return WriteStatistics(writer); });
 
     auto& logger_component = context.FindComponent<components::Logging>();
     for (const auto& [name, task_processor] : components_manager_.GetTaskProcessorsMap()) {
@@ -103,15 +140,43 @@ void ManagerControllerComponent::WriteStatistics(utils::statistics::Writer& writ
             stack_usage_stats["max-usage-percent"] = stats.max_stack_usage_pct;
             stack_usage_stats["is-monitor-active"] = stats.is_stack_usage_monitor_active;
         }
+        if (auto local_cache = coro_pool["local-cache"]) {
+            for (const auto& thread_stats : stats.thread_cache_stats) {
+                const utils::statistics::LabelView label{"thread_name", thread_stats.thread_name};
+                local_cache["local-hits"].ValueWithLabels(thread_stats.local_hits, label);
+                local_cache["pool-hits"].ValueWithLabels(thread_stats.pool_hits, label);
+                local_cache["misses"].ValueWithLabels(thread_stats.misses, label);
+            }
+        }
+    }
+
+    // TLS clients
+    if (auto tls_client = writer["tls-client"]) {
+        const auto stats = engine::io::impl::GetTlsClientHandshakeStats();
+        tls_client["handshakes"] = stats.handshakes;
+        tls_client["resumed"] = stats.resumed;
     }
 
     // misc
+    if (auto task_accounting = writer["task-accounting"]) {
+        engine::impl::DumpTaskAccounting(task_accounting);
+    }
+
     writer["uptime-seconds"] = std::chrono::duration_cast<std::chrono::seconds>(
                                    std::chrono::steady_clock::now() - components_manager_.GetStartTime()
     )
                                    .count();
     writer["load-ms"] =
         std::chrono::duration_cast<std::chrono::milliseconds>(components_manager_.GetLoadDuration()).count();
+
+    if (auto components = writer["components"]) {
+        for (const auto& timings : components_manager_.GetLoadTimeline()) {
+            const utils::statistics::LabelView label{"component_name", timings.name};
+            components["load-ms"].ValueWithLabels(timings.construction.count(), label);
+            components["dependencies-wait-ms"].ValueWithLabels(timings.dependencies_wait.count(), label);
+            components["slot-wait-ms"].ValueWithLabels(timings.slot_wait.count(), label);
+        }
+    }
 }
 
 void ManagerControllerComponent::OnConfigUpdate(const dynamic_config::Snapshot& cfg) {
@@ -125,6 +190,8 @@ void ManagerControllerComponent::OnConfigUpdate(const dynamic_config::Snapshot&
             task_processor->SetSettings(config.default_settings);
         }
     }
+
+    statistics_storage_.SetCardinalityLimits(cfg[utils::statistics::impl::kCardinalityLimitsConfig]);
 }
 
 }  // namespace components
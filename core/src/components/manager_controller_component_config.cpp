@@ -47,15 +47,19 @@ ManagerControllerDynamicConfig ManagerControllerDynamicConfig::Parse(const dynam
     const auto profiler_doc = docs_map.Get("USERVER_TASK_PROCESSOR_PROFILER_DEBUG");
     for (const auto& [name, value] : Items(profiler_doc)) {
         auto profiler_enabled = value["enabled"].As<bool>();
-        if (profiler_enabled) {
+        auto task_accounting = value["task-accounting"].As<bool>(false);
+        if (profiler_enabled || task_accounting) {
             // If the key is missing, make a copy of default settings and fill the
             // profiler part.
             auto it = result.settings.emplace(name, result.default_settings).first;
             auto& tp_settings = it->second;
 
-            tp_settings.profiler_execution_slice_threshold =
-                std::chrono::microseconds{value["execution-slice-threshold-us"].As<int>()};
-            tp_settings.profiler_force_stacktrace = value["profiler-force-stacktrace"].As<bool>(false);
+            if (profiler_enabled) {
+                tp_settings.profiler_execution_slice_threshold =
+                    std::chrono::microseconds{value["execution-slice-threshold-us"].As<int>()};
+                tp_settings.profiler_force_stacktrace = value["profiler-force-stacktrace"].As<bool>(false);
+            }
+            tp_settings.task_accounting = task_accounting;
         }
     }
 
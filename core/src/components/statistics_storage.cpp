@@ -8,9 +8,17 @@ namespace components {
 
 StatisticsStorage::StatisticsStorage(const ComponentConfig&, const ComponentContext&)
     : metrics_storage_(std::make_shared<utils::statistics::MetricsStorage>()),
-      metrics_storage_registration_(metrics_storage_->RegisterIn(storage_)) {}
+      metrics_storage_registration_(metrics_storage_->RegisterIn(storage_)) {
+    cardinality_statistics_holder_ =
+        storage_.RegisterWriter("statistics.cardinality-limiter", [this](utils::statistics::Writer& writer) {
+            for (const auto& [prefix, dropped] : storage_.GetCardinalityOverflows()) {
+                writer["dropped-series"].ValueWithLabels(dropped, {"metric_prefix", prefix});
+            }
+        });
+}
 
 StatisticsStorage::~StatisticsStorage() {
+    cardinality_statistics_holder_.Unregister();
     for (auto& entry : metrics_storage_registration_) {
         entry.Unregister();
     }
@@ -1,7 +1,7 @@
 #include <compression/gzip.hpp>
 
-#include <boost/iostreams/filter/gzip.hpp>
-#include <boost/iostreams/filtering_stream.hpp>
+#include <fmt/format.h>
+#include <zlib.h>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -9,34 +9,152 @@ namespace compression::gzip {
 
 namespace {
 constexpr auto kDecompressBufferSize = 1024;
-}
 
-std::string Decompress(std::string_view compressed, size_t max_size) {
-    std::string decompressed;
+// 15 bits window + 16 to produce the gzip header and trailer
+constexpr int kGzipWindowBits = 15 + 16;
+constexpr int kMemLevel = 8;
+
+// Room for the sync flush marker and the gzip header/trailer
+constexpr std::size_t kOutputReserve = 64;
+
+class Deflater final {
+public:
+    explicit Deflater(int level) {
+        if (deflateInit2(&stream_, level, Z_DEFLATED, kGzipWindowBits, kMemLevel, Z_DEFAULT_STRATEGY) != Z_OK) {
+            throw CompressionError("Couldn't create gzip compression stream");
+        }
+    }
 
-    // A guess for "small" data chunk
-    // "-1" is required to avoid memory fragmentation
-    // (stdlibc++ allocates capacity+1 bytes).
-    decompressed.reserve(kDecompressBufferSize - 1);
+    Deflater(const Deflater&) = delete;
+    Deflater& operator=(const Deflater&) = delete;
+    ~Deflater() { deflateEnd(&stream_); }
 
-    namespace bio = boost::iostreams;
+    void Reset() noexcept { deflateReset(&stream_); }
 
-    bio::filtering_istream stream;
-    stream.push(bio::gzip_decompressor());
-    stream.push(bio::array_source(compressed.data(), compressed.size()));
+    std::string Process(std::string_view chunk, int flush) {
+        std::string result;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        stream_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(chunk.data()));
+        stream_.avail_in = static_cast<uInt>(chunk.size());
+        do {
+            const auto old_size = result.size();
+            result.resize(old_size + deflateBound(&stream_, stream_.avail_in) + kOutputReserve);
+            stream_.next_out = reinterpret_cast<Bytef*>(result.data() + old_size);
+            stream_.avail_out = static_cast<uInt>(result.size() - old_size);
 
-    while (stream) {
-        char buf[kDecompressBufferSize];
-        stream.read(buf, sizeof(buf));
+            const auto ret = deflate(&stream_, flush);
+            if (ret == Z_STREAM_ERROR) {
+                throw CompressionError(fmt::format("Compression failed: {}", stream_.msg ? stream_.msg : "unknown"));
+            }
+            result.resize(result.size() - stream_.avail_out);
+            if (flush == Z_FINISH && ret == Z_STREAM_END) break;
+        } while (stream_.avail_out == 0 || stream_.avail_in != 0 || flush == Z_FINISH);
+        return result;
+    }
 
-        if (decompressed.size() + stream.gcount() > max_size) {
-            throw TooBigError();
+private:
+    z_stream stream_{};
+};
+
+class Inflater final {
+public:
+    Inflater() {
+        if (inflateInit2(&stream_, kGzipWindowBits) != Z_OK) {
+            throw DecompressionError("Couldn't create gzip decompression stream");
         }
+    }
 
-        decompressed.insert(decompressed.end(), buf, buf + stream.gcount());
+    Inflater(const Inflater&) = delete;
+    Inflater& operator=(const Inflater&) = delete;
+    ~Inflater() { inflateEnd(&stream_); }
+
+    void Reset() noexcept { inflateReset(&stream_); }
+
+    bool Process(std::string_view& input, std::string& output) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        stream_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+        stream_.avail_in = static_cast<uInt>(input.size());
+
+        int ret = Z_OK;
+        do {
+            const auto old_size = output.size();
+            output.resize(old_size + kDecompressBufferSize);
+            stream_.next_out = reinterpret_cast<Bytef*>(output.data() + old_size);
+            stream_.avail_out = kDecompressBufferSize;
+
+            ret = inflate(&stream_, Z_NO_FLUSH);
+            output.resize(output.size() - stream_.avail_out);
+            if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR) {
+                throw ErrWithCode(stream_.msg ? stream_.msg : zError(ret));
+            }
+            // A full output buffer means that there may be more data to flush
+        } while (ret == Z_OK && (stream_.avail_in != 0 || stream_.avail_out == 0));
+
+        input.remove_prefix(input.size() - stream_.avail_in);
+        return ret == Z_STREAM_END;
     }
 
-    if (stream.bad()) throw DecompressionError("failed to decompress gzip'ed data");
+private:
+    z_stream stream_{};
+};
+
+}  // namespace
+
+struct StreamCompressor::Impl final {
+    explicit Impl(int level) : deflater(level) {}
+
+    Deflater deflater;
+};
+
+StreamCompressor::StreamCompressor(int level) : impl_(std::make_unique<Impl>(level)) {}
+
+StreamCompressor::StreamCompressor(StreamCompressor&&) noexcept = default;
+
+StreamCompressor& StreamCompressor::operator=(StreamCompressor&&) noexcept = default;
+
+StreamCompressor::~StreamCompressor() = default;
+
+std::string StreamCompressor::Compress(std::string_view chunk) { return impl_->deflater.Process(chunk, Z_SYNC_FLUSH); }
+
+std::string StreamCompressor::Finish() { return impl_->deflater.Process({}, Z_FINISH); }
+
+void StreamCompressor::Reset() { impl_->deflater.Reset(); }
+
+struct StreamDecompressor::Impl final {
+    Inflater inflater;
+};
+
+StreamDecompressor::StreamDecompressor() : impl_(std::make_unique<Impl>()) {}
+
+StreamDecompressor::StreamDecompressor(StreamDecompressor&&) noexcept = default;
+
+StreamDecompressor& StreamDecompressor::operator=(StreamDecompressor&&) noexcept = default;
+
+StreamDecompressor::~StreamDecompressor() = default;
+
+bool StreamDecompressor::Decompress(std::string_view& input, std::string& output) {
+    return impl_->inflater.Process(input, output);
+}
+
+void StreamDecompressor::Reset() { impl_->inflater.Reset(); }
+
+std::string Compress(std::string_view data, int level) { return Deflater{level}.Process(data, Z_FINISH); }
+
+std::string Decompress(std::string_view compressed, size_t max_size) {
+    std::string decompressed;
+    Inflater inflater;
+    bool member_ended = true;
+    while (!compressed.empty()) {
+        // Feeding the input by parts keeps the output close to the limit
+        auto chunk = compressed.substr(0, kDecompressBufferSize);
+        const auto chunk_size = chunk.size();
+        member_ended = inflater.Process(chunk, decompressed);
+        compressed.remove_prefix(chunk_size - chunk.size());
+
+        if (decompressed.size() > max_size) throw TooBigError();
+        if (member_ended) inflater.Reset();
+    }
+    if (!member_ended) throw DecompressionError("failed to decompress gzip'ed data: truncated input");
 
     return decompressed;
 }
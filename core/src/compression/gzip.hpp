@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+#include <string>
 #include <string_view>
 
 #include <userver/compression/error.hpp>
@@ -8,10 +10,70 @@ USERVER_NAMESPACE_BEGIN
 
 namespace compression::gzip {
 
-/// Decompresses the string.
+/// Faster than the zlib default 6 with a close ratio for the text data
+inline constexpr int kDefaultCompressionLevel = 4;
+
+/// Decompresses the string, concatenated gzip members are decompressed one
+/// after another.
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
 
+/// Compresses the string into a gzip member.
+/// @throws CompressionError
+std::string Compress(std::string_view data, int level = kDefaultCompressionLevel);
+
+/// @brief Compresses a stream of chunks into a single gzip member.
+///
+/// The output of each Compress() call is sync-flushed, so that the peer is
+/// able to decompress a chunk without waiting for the next ones.
+class StreamCompressor final {
+public:
+    explicit StreamCompressor(int level = kDefaultCompressionLevel);
+    StreamCompressor(StreamCompressor&&) noexcept;
+    StreamCompressor& operator=(StreamCompressor&&) noexcept;
+    ~StreamCompressor();
+
+    /// @throws CompressionError
+    std::string Compress(std::string_view chunk);
+
+    /// Writes the gzip trailer, must be called once after the last chunk
+    /// @throws CompressionError
+    std::string Finish();
+
+    /// Starts a new gzip member, reusing the allocated compression state
+    void Reset();
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+/// @brief Decompresses a single gzip member that arrives in chunks
+class StreamDecompressor final {
+public:
+    /// @throws DecompressionError
+    StreamDecompressor();
+    StreamDecompressor(StreamDecompressor&&) noexcept;
+    StreamDecompressor& operator=(StreamDecompressor&&) noexcept;
+    ~StreamDecompressor();
+
+    /// @brief Decompresses a chunk of the member and appends the result to
+    /// `output`.
+    ///
+    /// The consumed bytes are removed from `input`. The input that follows the
+    /// end of the member is left untouched.
+    /// @returns whether the member has ended
+    /// @throws DecompressionError
+    bool Decompress(std::string_view& input, std::string& output);
+
+    /// Prepares to decompress a new member, reusing the allocated state
+    void Reset();
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace compression::gzip
 
 USERVER_NAMESPACE_END
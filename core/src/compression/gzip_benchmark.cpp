@@ -51,4 +51,34 @@ static void GzipDecompress(benchmark::State& state) {
 }
 BENCHMARK(GzipDecompress)->RangeMultiplier(2)->Range(1 << 10, 1 << 15);
 
+static void GzipCompress(benchmark::State& state) {
+    const auto data = GenerateRandomData(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(compression::gzip::Compress(data));
+    }
+}
+BENCHMARK(GzipCompress)->RangeMultiplier(2)->Range(1 << 10, 1 << 15);
+
+// Chunks of a request body decompressed with a reused context
+static void GzipStreamDecompress(benchmark::State& state) {
+    constexpr std::size_t kChunkSize = 4096;
+    const auto compressed = compression::gzip::Compress(GenerateRandomData(state.range(0)));
+
+    compression::gzip::StreamDecompressor decompressor;
+    std::string decompressed;
+    for ([[maybe_unused]] auto _ : state) {
+        decompressed.clear();
+        std::string_view input = compressed;
+        while (!input.empty()) {
+            auto chunk = input.substr(0, kChunkSize);
+            const auto chunk_size = chunk.size();
+            decompressor.Decompress(chunk, decompressed);
+            input.remove_prefix(chunk_size - chunk.size());
+        }
+        decompressor.Reset();
+        benchmark::DoNotOptimize(decompressed);
+    }
+}
+BENCHMARK(GzipStreamDecompress)->RangeMultiplier(2)->Range(1 << 10, 1 << 15);
+
 USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 #include <boost/iostreams/filter/gzip.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
 #include <compression/gzip.hpp>
@@ -28,4 +30,79 @@ TEST(Gzip, TestOverflow) {
     EXPECT_THROW(compression::gzip::Decompress(compressed, big_msg.size() / 2), compression::TooBigError);
 }
 
+TEST(Gzip, CompressRoundTrip) {
+    std::string data;
+    for (int i = 0; i < 10'000; ++i) data += "{\"key\":" + std::to_string(i) + "},";
+
+    const auto compressed = compression::gzip::Compress(data);
+    EXPECT_LT(compressed.size(), data.size() / 4);
+    EXPECT_EQ(compression::gzip::Decompress(compressed, data.size()), data);
+
+    EXPECT_EQ(compression::gzip::Decompress(compression::gzip::Compress({}), 0), "");
+}
+
+TEST(Gzip, StreamCompressor) {
+    const std::string chunk(5'000, 'a');
+    compression::gzip::StreamCompressor compressor;
+
+    std::string compressed;
+    for (int i = 0; i < 10; ++i) {
+        const auto compressed_chunk = compressor.Compress(chunk);
+        // Sync flush makes every chunk decodable right away
+        EXPECT_FALSE(compressed_chunk.empty());
+        compressed += compressed_chunk;
+    }
+    compressed += compressor.Finish();
+
+    std::string expected;
+    for (int i = 0; i < 10; ++i) expected += chunk;
+    EXPECT_EQ(compression::gzip::Decompress(compressed, expected.size()), expected);
+}
+
+TEST(Gzip, StreamDecompressor) {
+    std::string data;
+    for (int i = 0; i < 100'000; ++i) data += std::to_string(i);
+
+    const auto compressed = compression::gzip::Compress(data);
+    const auto trailing = std::string{"trailing"};
+    const auto input_data = compressed + trailing;
+
+    compression::gzip::StreamDecompressor decompressor;
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        std::string decompressed;
+        bool member_ended = false;
+        std::string_view input = input_data;
+        while (!member_ended) {
+            auto chunk = input.substr(0, 100);
+            member_ended = decompressor.Decompress(chunk, decompressed);
+            input.remove_prefix(std::min<std::size_t>(input.size(), 100) - chunk.size());
+        }
+
+        EXPECT_EQ(decompressed, data);
+        EXPECT_EQ(input, trailing);
+        decompressor.Reset();
+    }
+}
+
+TEST(Gzip, DecompressConcatenatedMembers) {
+    compression::gzip::StreamCompressor compressor;
+    auto compressed = compressor.Compress("first ");
+    compressed += compressor.Finish();
+    compressor.Reset();
+    compressed += compressor.Compress("second");
+    compressed += compressor.Finish();
+
+    EXPECT_EQ(compression::gzip::Decompress(compressed, 100), "first second");
+}
+
+TEST(Gzip, DecompressErrors) {
+    const auto compressed = compression::gzip::Compress("Some data to compress");
+
+    EXPECT_THROW(
+        compression::gzip::Decompress(compressed.substr(0, compressed.size() / 2), 100),
+        compression::DecompressionError
+    );
+    EXPECT_THROW(compression::gzip::Decompress("not a gzip", 100), compression::DecompressionError);
+}
+
 USERVER_NAMESPACE_END
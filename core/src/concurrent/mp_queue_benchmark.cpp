@@ -2,6 +2,7 @@
 
 #include <userver/concurrent/mpsc_queue.hpp>
 #include <userver/concurrent/queue.hpp>
+#include <userver/concurrent/ring_buffer_queue.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/utils/async.hpp>
 
@@ -205,4 +206,20 @@ BENCHMARK_TEMPLATE(QueueConsume, concurrent::MpscQueue<std::size_t>)
     ->RangeMultiplier(2)
     ->Ranges({{1, 4}, {1, 1}, {kUnbounded, kUnbounded}});
 
+BENCHMARK_TEMPLATE(QueueProduce, concurrent::SpscRingBufferQueue<std::size_t>)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 1}, {1, 1}, {128, 512}});
+
+BENCHMARK_TEMPLATE(QueueConsume, concurrent::SpscRingBufferQueue<std::size_t>)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 1}, {1, 1}, {128, 512}});
+
+BENCHMARK_TEMPLATE(QueueProduce, concurrent::MpscRingBufferQueue<std::size_t>)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 4}, {1, 1}, {128, 512}});
+
+BENCHMARK_TEMPLATE(QueueConsume, concurrent::MpscRingBufferQueue<std::size_t>)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 4}, {1, 1}, {128, 512}});
+
 USERVER_NAMESPACE_END
@@ -323,4 +323,66 @@ UTEST_MT(MpscQueue, ProducerRace, kProducersCount + 1) {
     }
 }
 
+UTEST(MpscQueue, PushPopBatch) {
+    auto queue = concurrent::MpscQueue<std::unique_ptr<int>>::Create(4);
+    auto producer = queue->GetProducer();
+    auto consumer = queue->GetConsumer();
+
+    std::vector<std::unique_ptr<int>> values;
+    for (int i = 0; i < 5; ++i) values.push_back(std::make_unique<int>(i));
+    EXPECT_FALSE(producer.PushBatch(std::move(values)));
+    ASSERT_EQ(values.size(), 5);
+    EXPECT_TRUE(std::all_of(values.begin(), values.end(), [](const auto& value) { return value != nullptr; }));
+
+    values.pop_back();
+    EXPECT_TRUE(producer.PushBatch(std::move(values)));
+    EXPECT_TRUE(values.empty());
+    EXPECT_EQ(queue->GetSizeApproximate(), 4);
+
+    std::vector<std::unique_ptr<int>> popped;
+    EXPECT_TRUE(consumer.PopBatch(popped, 3));
+    ASSERT_EQ(popped.size(), 3);
+    EXPECT_EQ(*popped[2], 2);
+    EXPECT_EQ(queue->GetSizeApproximate(), 1);
+
+    std::move(producer).Reset();
+    EXPECT_TRUE(consumer.PopBatch(popped, 3));
+    ASSERT_EQ(popped.size(), 4);
+    EXPECT_EQ(*popped[3], 3);
+    EXPECT_FALSE(consumer.PopBatch(popped, 3));
+}
+
+UTEST_MT(MpscQueue, MultiProducerBatches, kProducersCount + 1) {
+    constexpr std::size_t kBatchSize = 10;
+
+    auto queue = concurrent::MpscQueue<std::size_t>::Create(kBatchSize * 2);
+    auto consumer = queue->GetConsumer();
+    auto producer = queue->GetMultiProducer();
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (std::size_t i = 0; i < kProducersCount; ++i) {
+        tasks.push_back(utils::Async("producer", [&producer, i] {
+            std::vector<std::size_t> batch;
+            for (std::size_t message = i * kMessageCount; message < (i + 1) * kMessageCount; ++message) {
+                batch.push_back(message);
+                if (batch.size() == kBatchSize) {
+                    ASSERT_TRUE(producer.PushBatch(std::move(batch)));
+                }
+            }
+            ASSERT_TRUE(producer.PushBatch(std::move(batch)));
+        }));
+    }
+
+    std::vector<std::size_t> popped;
+    while (popped.size() < kProducersCount * kMessageCount) {
+        ASSERT_TRUE(consumer.PopBatch(popped, kBatchSize));
+    }
+    for (auto& task : tasks) task.Get();
+
+    std::vector<int> consumed_messages(kProducersCount * kMessageCount, 0);
+    for (const auto message : popped) ++consumed_messages[message];
+    EXPECT_TRUE(std::all_of(consumed_messages.begin(), consumed_messages.end(), [](int item) { return item == 1; }));
+    EXPECT_EQ(queue->GetSizeApproximate(), 0);
+}
+
 USERVER_NAMESPACE_END
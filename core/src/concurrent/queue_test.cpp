@@ -46,6 +46,17 @@ using TestQueueTypes = testing::Types<
     concurrent::SpmcQueue<std::size_t>,
     concurrent::SpscQueue<std::size_t>>;
 
+template <typename T>
+class BatchTest : public ::testing::Test {};
+
+using TestBatchQueueTypes = testing::Types<
+    concurrent::NonFifoMpmcQueue<int>,
+    concurrent::NonFifoMpscQueue<int>,
+    concurrent::SpmcQueue<int>,
+    concurrent::SpscQueue<int>,
+    concurrent::UnboundedNonFifoMpscQueue<int>,
+    concurrent::UnboundedSpscQueue<int>>;
+
 }  // namespace
 
 INSTANTIATE_TYPED_UTEST_SUITE_P(NonFifoMpmcQueue, QueueFixture, concurrent::NonFifoMpmcQueue<int>);
@@ -58,6 +69,8 @@ INSTANTIATE_TYPED_UTEST_SUITE_P(NonFifoMpscQueue, TypedQueueFixture, TestMpscTyp
 
 TYPED_TEST_SUITE(NonCoroutineTest, TestQueueTypes);
 
+TYPED_UTEST_SUITE(BatchTest, TestBatchQueueTypes);
+
 TYPED_TEST(NonCoroutineTest, PushPopNoblock) {
     auto queue = TypeParam::Create();
 
@@ -400,4 +413,125 @@ TYPED_UTEST_MT(MpMcQueueFixture, MultiConsumerToken, kProducersCount + kConsumer
     EXPECT_EQ(total.size(), kProducersCount * kMessageCount) << "Likely missing messages";
 }
 
+TYPED_UTEST(BatchTest, PushPopBatch) {
+    auto queue = TypeParam::Create();
+    auto producer = queue->GetProducer();
+    auto consumer = queue->GetConsumer();
+
+    std::vector<int> values{1, 2, 3, 4, 5};
+    EXPECT_TRUE(producer.PushBatch(std::move(values)));
+    EXPECT_TRUE(values.empty());
+    EXPECT_TRUE(producer.PushBatch({}));
+    EXPECT_EQ(queue->GetSizeApproximate(), 5);
+
+    std::vector<int> popped;
+    EXPECT_TRUE(consumer.PopBatch(popped, 3));
+    EXPECT_EQ(popped, (std::vector<int>{1, 2, 3}));
+
+    EXPECT_TRUE(consumer.PopBatch(popped, 10));
+    EXPECT_EQ(popped, (std::vector<int>{1, 2, 3, 4, 5}));
+    EXPECT_EQ(queue->GetSizeApproximate(), 0);
+
+    std::move(producer).Reset();
+    EXPECT_FALSE(consumer.PopBatch(popped, 10));
+    EXPECT_EQ(popped.size(), 5);
+}
+
+TYPED_UTEST(BatchTest, PopBatchWaits) {
+    auto queue = TypeParam::Create();
+    auto consumer = queue->GetConsumer();
+
+    auto consumer_task = utils::Async("consumer", [&consumer] {
+        std::vector<int> popped;
+        while (popped.size() < 4) {
+            EXPECT_TRUE(consumer.PopBatch(popped, 4));
+        }
+        EXPECT_EQ(popped, (std::vector<int>{1, 2, 3, 4}));
+    });
+
+    auto producer = queue->GetProducer();
+    EXPECT_TRUE(producer.PushBatch({1, 2}));
+    EXPECT_TRUE(producer.PushBatch({3, 4}));
+    consumer_task.Get();
+}
+
+UTEST(BatchTest, PushBatchMaxSize) {
+    auto queue = concurrent::NonFifoMpscQueue<int>::Create(3);
+    auto producer = queue->GetProducer();
+    auto consumer = queue->GetConsumer();
+
+    std::vector<int> values{1, 2, 3, 4};
+    EXPECT_FALSE(producer.PushBatch(std::move(values)));
+    EXPECT_EQ(values.size(), 4);
+
+    EXPECT_TRUE(producer.PushNoblock(0));
+    values = {1, 2, 3};
+    EXPECT_FALSE(producer.PushBatch(std::move(values), engine::Deadline::FromDuration(std::chrono::milliseconds{10})));
+    EXPECT_EQ(values.size(), 3);
+
+    int value{};
+    EXPECT_TRUE(consumer.PopNoblock(value));
+    EXPECT_TRUE(producer.PushBatch(std::move(values)));
+    EXPECT_EQ(queue->GetSizeApproximate(), 3);
+}
+
+UTEST(BatchTest, StringStreamQueueBatchSize) {
+    auto queue = concurrent::StringStreamQueue::Create(10);
+    auto producer = queue->GetProducer();
+    auto consumer = queue->GetConsumer();
+
+    EXPECT_FALSE(producer.PushBatch({"abcdef", "ghijk"}, engine::Deadline::Passed()));
+    EXPECT_TRUE(producer.PushBatch({"abcdef", "ghij"}));
+    EXPECT_EQ(queue->GetSizeApproximate(), 10);
+
+    std::vector<std::string> popped;
+    EXPECT_TRUE(consumer.PopBatch(popped, 1));
+    EXPECT_EQ(queue->GetSizeApproximate(), 4);
+    EXPECT_TRUE(consumer.PopBatch(popped, 1));
+    EXPECT_EQ(popped, (std::vector<std::string>{"abcdef", "ghij"}));
+}
+
+UTEST_MT(BatchTest, MpmcBatches, kProducersCount + kConsumersCount) {
+    constexpr std::size_t kBatchSize = 10;
+
+    auto queue = concurrent::NonFifoMpmcQueue<std::size_t>::Create(kBatchSize * 4);
+
+    std::vector<concurrent::NonFifoMpmcQueue<std::size_t>::Producer> producers;
+    std::vector<engine::TaskWithResult<void>> producer_tasks;
+    for (std::size_t i = 0; i < kProducersCount; ++i) {
+        producers.push_back(queue->GetProducer());
+    }
+    for (std::size_t i = 0; i < kProducersCount; ++i) {
+        producer_tasks.push_back(utils::Async("producer", [&producer = producers[i], i] {
+            std::vector<std::size_t> batch;
+            for (std::size_t message = i * kMessageCount; message < (i + 1) * kMessageCount; ++message) {
+                batch.push_back(message);
+                if (batch.size() == kBatchSize) {
+                    ASSERT_TRUE(producer.PushBatch(std::move(batch)));
+                }
+            }
+            ASSERT_TRUE(producer.PushBatch(std::move(batch)));
+        }));
+    }
+
+    std::vector<engine::TaskWithResult<std::vector<std::size_t>>> consumer_tasks;
+    for (std::size_t i = 0; i < kConsumersCount; ++i) {
+        consumer_tasks.push_back(utils::Async("consumer", [consumer = queue->GetConsumer()] {
+            std::vector<std::size_t> popped;
+            while (consumer.PopBatch(popped, kBatchSize)) {
+            }
+            return popped;
+        }));
+    }
+
+    for (auto& task : producer_tasks) task.Get();
+    producers.clear();
+
+    std::vector<int> consumed_messages(kProducersCount * kMessageCount, 0);
+    for (auto& task : consumer_tasks) {
+        for (const auto message : task.Get()) ++consumed_messages[message];
+    }
+    EXPECT_TRUE(std::all_of(consumed_messages.begin(), consumed_messages.end(), [](int item) { return item == 1; }));
+}
+
 USERVER_NAMESPACE_END
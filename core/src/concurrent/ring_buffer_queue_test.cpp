@@ -0,0 +1,138 @@
+#include <userver/concurrent/ring_buffer_queue.hpp>
+
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+#include "mp_queue_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+using SpscTestTypes = testing::Types<
+    concurrent::SpscRingBufferQueue<int>,
+    concurrent::SpscRingBufferQueue<std::unique_ptr<int>>,
+    concurrent::SpscRingBufferQueue<std::unique_ptr<RefCountData>>>;
+
+using MpscTestTypes = testing::Types<
+    concurrent::MpscRingBufferQueue<int>,
+    concurrent::MpscRingBufferQueue<std::unique_ptr<int>>,
+    concurrent::MpscRingBufferQueue<std::unique_ptr<RefCountData>>>;
+}  // namespace
+
+INSTANTIATE_TYPED_UTEST_SUITE_P(SpscRingBufferQueue, TypedQueueFixture, SpscTestTypes);
+
+INSTANTIATE_TYPED_UTEST_SUITE_P(MpscRingBufferQueue, TypedQueueFixture, MpscTestTypes);
+
+INSTANTIATE_TYPED_UTEST_SUITE_P(MpscRingBufferQueue, QueueFixture, concurrent::MpscRingBufferQueue<int>);
+
+UTEST(RingBufferQueue, Capacity) {
+    auto queue = concurrent::SpscRingBufferQueue<int>::Create(100);
+    EXPECT_EQ(queue->GetCapacity(), 128);
+    EXPECT_EQ(queue->GetSoftMaxSize(), 100);
+
+    queue->SetSoftMaxSize(1000);
+    EXPECT_EQ(queue->GetSoftMaxSize(), 128);
+
+    auto producer = queue->GetProducer();
+    for (int i = 0; i < 128; ++i) {
+        EXPECT_TRUE(producer.PushNoblock(int{i}));
+    }
+    EXPECT_FALSE(producer.PushNoblock(128));
+    EXPECT_EQ(queue->GetSizeApproximate(), 128);
+}
+
+UTEST(RingBufferQueue, Wraparound) {
+    auto queue = concurrent::SpscRingBufferQueue<int>::Create(4);
+    auto producer = queue->GetProducer();
+    auto consumer = queue->GetConsumer();
+
+    int value{};
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_TRUE(producer.PushNoblock(int{i}));
+        EXPECT_TRUE(producer.PushNoblock(int{-i}));
+        EXPECT_TRUE(consumer.PopNoblock(value));
+        EXPECT_EQ(value, i);
+        EXPECT_TRUE(consumer.PopNoblock(value));
+        EXPECT_EQ(value, -i);
+    }
+    EXPECT_FALSE(consumer.PopNoblock(value));
+}
+
+UTEST(RingBufferQueue, ProducerBlocksWhenFull) {
+    auto queue = concurrent::SpscRingBufferQueue<int>::Create(2);
+    auto consumer = queue->GetConsumer();
+
+    auto producer_task = utils::Async("producer", [producer = queue->GetProducer()] {
+        for (int i = 0; i < 10; ++i) {
+            EXPECT_TRUE(producer.Push(int{i}));
+        }
+    });
+
+    int value{};
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(consumer.Pop(value));
+        EXPECT_EQ(value, i);
+        EXPECT_LE(queue->GetSizeApproximate(), 2);
+    }
+    producer_task.Get();
+    EXPECT_FALSE(consumer.Pop(value));
+}
+
+UTEST(RingBufferQueue, ConsumerIsDeadUnblocksProducer) {
+    auto queue = concurrent::MpscRingBufferQueue<int>::Create(1);
+    auto consumer = queue->GetConsumer();
+    auto producer = queue->GetProducer();
+    EXPECT_TRUE(producer.Push(0));
+
+    engine::SingleConsumerEvent producer_started;
+    auto producer_task = utils::Async("producer", [&producer, &producer_started] {
+        producer_started.Send();
+        EXPECT_FALSE(producer.Push(1));
+    });
+
+    ASSERT_TRUE(producer_started.WaitForEvent());
+    engine::Yield();
+    std::move(consumer).Reset();
+    producer_task.Get();
+}
+
+UTEST_MT(RingBufferQueue, ManyProducersSmallCapacity, 4) {
+    constexpr int kProducersCount = 3;
+    constexpr int kMessageCount = 1000;
+
+    auto queue = concurrent::MpscRingBufferQueue<int>::Create(8);
+    auto consumer = queue->GetConsumer();
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(kProducersCount);
+    for (int i = 0; i < kProducersCount; ++i) {
+        tasks.push_back(utils::Async("pusher", [producer = queue->GetProducer(), i] {
+            for (int message = kMessageCount * i; message < (i + 1) * kMessageCount; ++message) {
+                ASSERT_TRUE(producer.Push(int{message}));
+            }
+        }));
+    }
+
+    std::vector<int> consumed_messages(kProducersCount * kMessageCount);
+    std::vector<int> last_message(kProducersCount, -1);
+    int value{};
+    for (int i = 0; i < kProducersCount * kMessageCount; ++i) {
+        ASSERT_TRUE(consumer.Pop(value));
+        ++consumed_messages[value];
+
+        // Messages of a single producer keep their order
+        auto& last = last_message[value / kMessageCount];
+        EXPECT_LT(last, value);
+        last = value;
+    }
+
+    for (auto& task : tasks) {
+        task.Get();
+    }
+
+    EXPECT_TRUE(std::all_of(consumed_messages.begin(), consumed_messages.end(), [](int item) { return item == 1; }));
+    EXPECT_EQ(queue->GetSizeApproximate(), 0);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,78 @@
+#include <userver/congestion_control/controllers/gradient.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+namespace {
+constexpr std::size_t kRttEpochs = 30;
+constexpr double kMinGradient = 0.5;
+}  // namespace
+
+GradientController::GradientController(
+    const std::string& name,
+    v2::Sensor& sensor,
+    Limiter& limiter,
+    Stats& stats,
+    const StaticConfig& config
+)
+    : Controller(name, sensor, limiter, stats, {config.fake_mode, config.enabled}),
+      config_(config),
+      rtt_(kRttEpochs),
+      limit_(config.max_limit) {
+    UINVARIANT(config_.min_limit <= config_.max_limit, "min-limit must not exceed max-limit");
+    UINVARIANT(config_.smoothing > 0 && config_.smoothing <= 1, "smoothing must be in (0, 1]");
+}
+
+Limit GradientController::Update(const Sensor::Data& current) {
+    if (current.total < config_.min_requests) {
+        // Too few requests, the timings are VERY noisy
+        return MakeLimit(current);
+    }
+
+    // Timings of the sub-millisecond requests are rounded down to zero
+    const auto rtt = std::max<std::int64_t>(static_cast<std::int64_t>(current.timings_avg_ms), 1);
+    rtt_.Update(rtt);
+    if (epochs_passed_ < kRttEpochs) {
+        // The minimal latency is not known yet
+        epochs_passed_++;
+        return MakeLimit(current);
+    }
+
+    const auto min_rtt = rtt_.GetMinimal();
+    const double gradient = std::clamp(config_.rtt_tolerance * min_rtt / rtt, kMinGradient, 1.0);
+
+    const auto min_limit = static_cast<double>(config_.min_limit);
+    const auto max_limit = static_cast<double>(config_.max_limit);
+    if (gradient < 1.0 && limit_ >= max_limit) {
+        LOG_WARNING() << GetName() << " Congestion Control is activated, min_rtt=" << min_rtt << "ms, rtt=" << rtt
+                      << "ms";
+        limit_ = std::clamp(static_cast<double>(current.current_load), min_limit, max_limit);
+    }
+
+    double new_limit = limit_ * gradient;
+    // Do not grow the limit that is not reached, it could grow indefinitely
+    if (gradient == 1.0 && static_cast<double>(current.current_load) * 2 >= limit_) new_limit += std::sqrt(limit_);
+
+    limit_ = limit_ * (1 - config_.smoothing) + new_limit * config_.smoothing;
+    limit_ = std::clamp(limit_, min_limit, max_limit);
+
+    LOG_DEBUG() << GetName() << " gradient CC: sensor=(" << current.ToLogString() << ") min_rtt=" << min_rtt
+                << " gradient=" << gradient << " limit=" << limit_;
+
+    return MakeLimit(current);
+}
+
+Limit GradientController::MakeLimit(const Sensor::Data& current) const {
+    if (limit_ >= static_cast<double>(config_.max_limit)) return {std::nullopt, current.current_load};
+    return {static_cast<std::size_t>(limit_), current.current_load};
+}
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,23 @@
+#include <userver/congestion_control/controllers/gradient_config.hpp>
+
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+GradientConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<GradientConfig>) {
+    GradientConfig config;
+    config.fake_mode = value["fake-mode"].As<bool>(config.fake_mode);
+    config.enabled = value["enabled"].As<bool>(config.enabled);
+    config.min_limit = value["min-limit"].As<std::size_t>(config.min_limit);
+    config.max_limit = value["max-limit"].As<std::size_t>(config.max_limit);
+    config.rtt_tolerance = value["rtt-tolerance"].As<double>(config.rtt_tolerance);
+    config.smoothing = value["smoothing"].As<double>(config.smoothing);
+    config.min_requests = value["min-requests"].As<std::size_t>(config.min_requests);
+    return config;
+}
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,110 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/congestion_control/controllers/gradient.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class FakeSensor : public congestion_control::v2::Sensor {
+    Data GetCurrent() override { return {}; }
+};
+
+class FakeLimiter : public congestion_control::Limiter {
+    void SetLimit(const congestion_control::Limit&) override {}
+};
+
+congestion_control::v2::Stats stats;
+FakeSensor sensor;
+FakeLimiter limiter;
+
+congestion_control::v2::Sensor::Data MakeData(std::size_t timings_avg_ms, std::size_t current_load) {
+    congestion_control::v2::Sensor::Data data;
+    data.total = 100;
+    data.timings_avg_ms = timings_avg_ms;
+    data.current_load = current_load;
+    return data;
+}
+
+void WarmUp(congestion_control::v2::GradientController& controller) {
+    for (std::size_t i = 0; i < 30; i++) {
+        auto limit = controller.Update(MakeData(10, 100));
+        EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+    }
+}
+
+}  // namespace
+
+TEST(CCGradient, Zero) {
+    congestion_control::v2::GradientController controller("test", sensor, limiter, stats, {});
+
+    for (std::size_t i = 0; i < 1000; i++) {
+        auto limit = controller.Update({});
+        EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+    }
+}
+
+TEST(CCGradient, FirstSeconds) {
+    congestion_control::v2::GradientController controller("test", sensor, limiter, stats, {});
+
+    for (std::size_t i = 0; i < 30; i++) {
+        auto limit = controller.Update(MakeData(10000, 100));
+        EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+    }
+}
+
+TEST(CCGradient, StableTimings) {
+    congestion_control::v2::GradientController controller("test", sensor, limiter, stats, {});
+    WarmUp(controller);
+
+    for (std::size_t i = 0; i < 100; i++) {
+        auto limit = controller.Update(MakeData(15, 100));
+        EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+    }
+}
+
+TEST(CCGradient, Overload) {
+    congestion_control::v2::GradientConfig config;
+    config.smoothing = 1.0;
+    congestion_control::v2::GradientController controller("test", sensor, limiter, stats, config);
+    WarmUp(controller);
+
+    // 4x timings halve the limit that starts from the current load
+    auto limit = controller.Update(MakeData(40, 100));
+    EXPECT_EQ(limit.load_limit, 50);
+
+    limit = controller.Update(MakeData(40, 50));
+    EXPECT_EQ(limit.load_limit, 25);
+
+    for (std::size_t i = 0; i < 10; i++) {
+        limit = controller.Update(MakeData(40, 20));
+        EXPECT_EQ(limit.load_limit, config.min_limit) << i;
+    }
+
+    // the limit grows back while it is used and the timings are fine
+    limit = controller.Update(MakeData(10, 10));
+    ASSERT_TRUE(limit.load_limit);
+    EXPECT_GT(*limit.load_limit, config.min_limit);
+
+    for (std::size_t i = 0; i < 1000 && limit.load_limit; i++) {
+        limit = controller.Update(MakeData(10, *limit.load_limit));
+    }
+    EXPECT_EQ(limit.load_limit, std::nullopt);
+}
+
+TEST(CCGradient, UnusedLimitDoesNotGrow) {
+    congestion_control::v2::GradientConfig config;
+    config.smoothing = 1.0;
+    congestion_control::v2::GradientController controller("test", sensor, limiter, stats, config);
+    WarmUp(controller);
+
+    auto limit = controller.Update(MakeData(40, 100));
+    EXPECT_EQ(limit.load_limit, 50);
+
+    for (std::size_t i = 0; i < 100; i++) {
+        limit = controller.Update(MakeData(10, 5));
+        EXPECT_EQ(limit.load_limit, 50) << i;
+    }
+}
+
+USERVER_NAMESPACE_END
@@ -9,6 +9,7 @@
 #include <sys/socket.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <istream>
 #include <utility>
 
@@ -22,6 +23,7 @@
 
 #include <fmt/compile.h>
 #include <fmt/format.h>
+#include <openssl/ssl.h>
 
 #include <engine/ev/thread_control.hpp>
 #include <server/net/listener_impl.hpp>
@@ -144,6 +146,11 @@ easy* easy::from_native(native::CURL* native_easy) {
 
 engine::ev::ThreadControl& easy::GetThreadControl() { return multi_->GetThreadControl(); }
 
+void easy::SetMulti(multi& multi_handle) noexcept {
+    UASSERT(!multi_registered_);
+    multi_ = &multi_handle;
+}
+
 void easy::async_perform(handler_type handler) {
     LOG_TRACE() << "easy::async_perform start " << this;
     size_t request_num = ++request_counter_;
@@ -159,6 +166,40 @@ void easy::async_perform(handler_type handler) {
     LOG_TRACE() << "easy::async_perform finished " << this;
 }
 
+void easy::async_perform_batch(perform_batch&& batch) {
+    struct pending_perform {
+        std::shared_ptr<easy> self;
+        handler_type handler;
+        size_t request_num;
+    };
+    // There are few ev threads, a linear lookup is fine
+    std::vector<std::pair<engine::ev::ThreadControl*, std::vector<pending_perform>>> by_thread;
+
+    for (const auto& item : batch) {
+        if (!item.first->multi_) throw std::runtime_error("no multi!");
+    }
+
+    for (auto& [self, handler] : batch) {
+        auto* thread_control = &self->multi_->GetThreadControl();
+        auto it = std::find_if(by_thread.begin(), by_thread.end(), [thread_control](const auto& item) {
+            return item.first == thread_control;
+        });
+        if (it == by_thread.end()) it = by_thread.emplace(by_thread.end(), thread_control, std::vector<pending_perform>{});
+
+        const size_t request_num = ++self->request_counter_;
+        it->second.push_back({std::move(self), std::move(handler), request_num});
+    }
+    batch.clear();
+
+    for (auto& [thread_control, pending] : by_thread) {
+        thread_control->RunInEvLoopAsync([pending = std::move(pending)]() mutable {
+            for (auto& item : pending) {
+                item.self->do_ev_async_perform(std::move(item.handler), item.request_num);
+            }
+        });
+    }
+}
+
 void easy::do_ev_async_perform(handler_type handler, size_t request_num) {
     if (request_num <= cancelled_request_max_) {
         LOG_DEBUG() << "already cancelled";
@@ -225,6 +266,8 @@ void easy::reset() {
 
     orig_url_str_.clear();
     std::string{}.swap(post_fields_);  // forced memory freeing
+    shared_post_fields_.reset();
+    has_post_stream_ = false;
     form_.reset();
     if (headers_) headers_->clear();
     if (proxy_headers_) proxy_headers_->clear();
@@ -335,6 +378,8 @@ void easy::set_post_fields(std::string&& post_fields) {
 }
 
 void easy::set_post_fields(std::string&& post_fields, std::error_code& ec) {
+    shared_post_fields_.reset();
+    has_post_stream_ = false;
     post_fields_ = std::move(post_fields);
     ec = std::error_code{static_cast<errc::EasyErrorCode>(
         native::curl_easy_setopt(handle_, native::CURLOPT_POSTFIELDS, post_fields_.c_str())
@@ -343,6 +388,56 @@ void easy::set_post_fields(std::string&& post_fields, std::error_code& ec) {
     if (!ec) set_post_field_size_large(static_cast<native::curl_off_t>(post_fields_.length()), ec);
 }
 
+void easy::set_post_fields(std::shared_ptr<const std::string> post_fields) {
+    std::error_code ec;
+    set_post_fields(std::move(post_fields), ec);
+    throw_error(ec, "set_post_fields");
+}
+
+void easy::set_post_fields(std::shared_ptr<const std::string> post_fields, std::error_code& ec) {
+    if (!post_fields) {
+        set_post_fields(std::string{}, ec);
+        return;
+    }
+
+    std::string{}.swap(post_fields_);
+    has_post_stream_ = false;
+    shared_post_fields_ = std::move(post_fields);
+    ec = std::error_code{static_cast<errc::EasyErrorCode>(
+        native::curl_easy_setopt(handle_, native::CURLOPT_POSTFIELDS, shared_post_fields_->c_str())
+    )};
+
+    if (!ec) set_post_field_size_large(static_cast<native::curl_off_t>(shared_post_fields_->length()), ec);
+}
+
+void easy::set_post_stream(
+    read_function_t read_function,
+    void* read_data,
+    std::optional<native::curl_off_t> size
+) {
+    std::error_code ec;
+    set_post_stream(read_function, read_data, size, ec);
+    throw_error(ec, "set_post_stream");
+}
+
+void easy::set_post_stream(
+    read_function_t read_function,
+    void* read_data,
+    std::optional<native::curl_off_t> size,
+    std::error_code& ec
+) {
+    std::string{}.swap(post_fields_);
+    shared_post_fields_.reset();
+    has_post_stream_ = true;
+
+    // Without POSTFIELDS libcURL takes the POST body from the read function
+    set_post_fields(static_cast<void*>(nullptr), ec);
+    if (!ec) set_post(true, ec);
+    if (!ec) set_read_function(read_function, ec);
+    if (!ec) set_read_data(read_data, ec);
+    if (!ec) set_post_field_size_large(size.value_or(-1), ec);
+}
+
 void easy::set_http_post(std::unique_ptr<form> form) {
     std::error_code ec;
     set_http_post(std::move(form), ec);
@@ -590,7 +685,7 @@ void easy::set_share(std::shared_ptr<share> share) {
 void easy::set_share(std::shared_ptr<share> share, std::error_code& ec) {
     share_ = std::move(share);
 
-    if (share) {
+    if (share_) {
         ec = std::error_code{static_cast<errc::EasyErrorCode>(
             native::curl_easy_setopt(handle_, native::CURLOPT_SHARE, share_->native_handle())
         )};
@@ -600,12 +695,34 @@ void easy::set_share(std::shared_ptr<share> share, std::error_code& ec) {
     }
 }
 
-bool easy::has_post_data() const { return !post_fields_.empty() || form_; }
+void easy::unpause() {
+    if (!multi_registered_) return;
+
+    const std::error_code ec{static_cast<errc::EasyErrorCode>(native::curl_easy_pause(handle_, CURLPAUSE_CONT))};
+    if (ec) {
+        LOG_WARNING() << "Failed to resume a paused transfer: " << ec.message();
+    }
+}
+
+bool easy::has_post_data() const { return has_post_stream_ || !get_post_data().empty() || form_; }
 
-const std::string& easy::get_post_data() const { return post_fields_; }
+std::optional<bool> easy::is_tls_session_reused() {
+    native::curl_tlssessioninfo* info = nullptr;
+    if (native::curl_easy_getinfo(handle_, native::CURLINFO_TLS_SSL_PTR, &info) != native::CURLE_OK || !info ||
+        info->backend != native::CURLSSLBACKEND_OPENSSL || !info->internals) {
+        return std::nullopt;
+    }
+    return SSL_session_reused(static_cast<SSL*>(info->internals)) == 1;
+}
+
+const std::string& easy::get_post_data() const {
+    return shared_post_fields_ ? *shared_post_fields_ : post_fields_;
+}
 
 std::string easy::extract_post_data() {
-    auto data = std::move(post_fields_);
+    // The shared buffer may be used by other requests, so it is copied
+    auto data = shared_post_fields_ ? std::string{*shared_post_fields_} : std::move(post_fields_);
+    shared_post_fields_.reset();
     set_post_fields({});
     return data;
 }
@@ -199,6 +199,7 @@ class easy final : public std::enable_shared_from_this<easy> {
 public:
     using handler_type = std::function<void(std::error_code err)>;
     using time_point = std::chrono::steady_clock::time_point;
+    using perform_batch = std::vector<std::pair<std::shared_ptr<easy>, handler_type>>;
 
     static easy* from_native(native::CURL* native_easy);
 
@@ -216,12 +217,18 @@ public:
 
     const multi* GetMulti() const { return multi_; }
 
+    // Must not be called while the request is performed
+    void SetMulti(multi& multi_handle) noexcept;
+
     inline native::CURL* native_handle() { return handle_; }
     engine::ev::ThreadControl& GetThreadControl();
 
     void perform();
     void perform(std::error_code& ec);
     void async_perform(handler_type handler);
+    // Same as async_perform() for each of the easies, but wakes up each ev
+    // thread only once
+    static void async_perform_batch(perform_batch&& batch);
     void cancel();
     void reset();
     void set_source(std::shared_ptr<std::istream> source);
@@ -393,6 +400,18 @@ public:
     IMPLEMENT_CURL_OPTION_BOOLEAN(set_put, native::CURLOPT_PUT);
     void set_post_fields(std::string&& post_fields);
     void set_post_fields(std::string&& post_fields, std::error_code& ec);
+    // libcurl reads the body right from the shared buffer, without a copy
+    void set_post_fields(std::shared_ptr<const std::string> post_fields);
+    void set_post_fields(std::shared_ptr<const std::string> post_fields, std::error_code& ec);
+    // The body is provided by `read_function` while the request is
+    // performed, chunked transfer encoding is used if the size is unknown
+    void set_post_stream(read_function_t read_function, void* read_data, std::optional<native::curl_off_t> size);
+    void set_post_stream(
+        read_function_t read_function,
+        void* read_data,
+        std::optional<native::curl_off_t> size,
+        std::error_code& ec
+    );
     IMPLEMENT_CURL_OPTION(set_post_fields, native::CURLOPT_POSTFIELDS, void*);
     IMPLEMENT_CURL_OPTION(set_post_field_size, native::CURLOPT_POSTFIELDSIZE, long);
     IMPLEMENT_CURL_OPTION(set_post_field_size_large, native::CURLOPT_POSTFIELDSIZE_LARGE, native::curl_off_t);
@@ -649,7 +668,7 @@ public:
     IMPLEMENT_CURL_OPTION_GET_LONG(get_local_port, native::CURLINFO_LOCAL_PORT);
     // CURLINFO_TLS_SESSION
     // CURLINFO_ACTIVESOCKET
-    // CURLINFO_TLS_SSL_PTR
+    // CURLINFO_TLS_SSL_PTR, see is_tls_session_reused()
     IMPLEMENT_CURL_OPTION_GET_LONG(get_http_version, native::CURLINFO_HTTP_VERSION);
     IMPLEMENT_CURL_OPTION_GET_LONG(get_proxy_ssl_verifyresult, native::CURLINFO_PROXY_SSL_VERIFYRESULT);
     IMPLEMENT_CURL_OPTION_GET_LONG(get_protocol, native::CURLINFO_PROTOCOL);
@@ -663,6 +682,14 @@ public:
     IMPLEMENT_CURL_OPTION_GET_CURL_OFF_T(get_appconnect_time_usec, native::CURLINFO_APPCONNECT_TIME_T);
     IMPLEMENT_CURL_OPTION_GET_CURL_OFF_T(get_retry_after_sec, native::CURLINFO_RETRY_AFTER);
 
+    // Resumes the transfer paused by CURL_READFUNC_PAUSE, must be called
+    // from the ev thread
+    void unpause();
+
+    // Whether the TLS session of the current connection was resumed, nullopt
+    // for non-TLS connections. Valid only while the transfer is in progress.
+    std::optional<bool> is_tls_session_reused();
+
     bool has_post_data() const;
 
     const std::string& get_post_data() const;
@@ -719,6 +746,8 @@ private:
     std::shared_ptr<std::istream> source_;
     std::string* sink_{nullptr};
     std::string post_fields_;
+    std::shared_ptr<const std::string> shared_post_fields_;
+    bool has_post_stream_{false};
     std::shared_ptr<form> form_;
     std::shared_ptr<string_list> headers_;
     std::shared_ptr<string_list> proxy_headers_;
@@ -0,0 +1,171 @@
+#include <userver/dist_lock/dist_lock_batcher.hpp>
+
+#include <exception>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/exception.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/datetime.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dist_lock {
+
+namespace impl {
+
+class BatchCoalescer final {
+public:
+    using AcquireRequest = DistLockBatchStrategyBase::AcquireRequest;
+    using AcquireResult = DistLockBatchStrategyBase::AcquireResult;
+
+    BatchCoalescer(std::shared_ptr<DistLockBatchStrategyBase> strategy, std::chrono::milliseconds batch_delay)
+        : strategy_(std::move(strategy)), batch_delay_(batch_delay) {
+        UASSERT(strategy_);
+    }
+
+    AcquireResult Acquire(AcquireRequest&& request) {
+        std::unique_lock lock{mutex_};
+        if (IsLeasedToOther(request)) return {};
+
+        const bool is_leader = !pending_;
+        if (is_leader) pending_ = std::make_shared<Batch>();
+        auto batch = pending_;
+        // the batch strategies expect the lock names of a batch to be unique
+        if (!batch->lock_names.insert(request.lock_name).second) return {};
+        const auto index = batch->requests.size();
+        batch->requests.push_back(std::move(request));
+
+        if (is_leader) {
+            lock.unlock();
+            Send(*batch);
+            lock.lock();
+            cv_.NotifyAll();
+        } else if (!cv_.Wait(lock, [&batch] { return batch->is_done; })) {
+            throw engine::WaitInterruptedException(engine::current_task::CancellationReason());
+        }
+
+        if (batch->error) std::rethrow_exception(batch->error);
+        return batch->results[index];
+    }
+
+    void Release(const std::string& lock_name, const std::string& locker_id) {
+        {
+            const std::lock_guard lock{mutex_};
+            const auto it = leases_.find(lock_name);
+            if (it != leases_.end() && it->second.locker_id == locker_id) leases_.erase(it);
+        }
+        strategy_->Release(lock_name, locker_id);
+    }
+
+private:
+    struct Batch {
+        std::vector<AcquireRequest> requests;
+        std::unordered_set<std::string> lock_names;
+        std::vector<AcquireResult> results;
+        std::exception_ptr error;
+        bool is_done{false};
+    };
+
+    struct Lease {
+        std::string locker_id;
+        std::chrono::steady_clock::time_point expiration;
+    };
+
+    bool IsLeasedToOther(const AcquireRequest& request) const {
+        const auto it = leases_.find(request.lock_name);
+        return it != leases_.end() && it->second.locker_id != request.locker_id &&
+               it->second.expiration > utils::datetime::SteadyNow();
+    }
+
+    void Send(Batch& batch) {
+        engine::InterruptibleSleepFor(batch_delay_);
+        {
+            // the batch is not modified after this point
+            const std::lock_guard lock{mutex_};
+            pending_.reset();
+        }
+
+        // the storage counts the leases from a later moment
+        const auto attempt_start = utils::datetime::SteadyNow();
+        std::vector<AcquireResult> results;
+        std::exception_ptr error;
+        try {
+            results = strategy_->AcquireBatch(batch.requests);
+            UINVARIANT(results.size() == batch.requests.size(), "AcquireBatch must return a result for each request");
+        } catch (const std::exception&) {
+            error = std::current_exception();
+        }
+
+        const std::lock_guard lock{mutex_};
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const auto& request = batch.requests[i];
+            if (results[i].acquired) {
+                leases_[request.lock_name] = {request.locker_id, attempt_start + request.lock_ttl};
+            } else {
+                const auto it = leases_.find(request.lock_name);
+                if (it != leases_.end() && it->second.locker_id == request.locker_id) leases_.erase(it);
+            }
+        }
+        batch.results = std::move(results);
+        batch.error = std::move(error);
+        batch.is_done = true;
+    }
+
+    const std::shared_ptr<DistLockBatchStrategyBase> strategy_;
+    const std::chrono::milliseconds batch_delay_;
+
+    engine::Mutex mutex_;
+    engine::ConditionVariable cv_;
+    std::shared_ptr<Batch> pending_;
+    std::unordered_map<std::string, Lease> leases_;
+};
+
+namespace {
+
+class BatchedLockStrategy final : public DistLockStrategyBase {
+public:
+    BatchedLockStrategy(std::shared_ptr<BatchCoalescer> coalescer, std::string lock_name)
+        : coalescer_(std::move(coalescer)), lock_name_(std::move(lock_name)) {}
+
+    void Acquire(std::chrono::milliseconds lock_ttl, const std::string& locker_id) override {
+        AcquireWithFencingToken(lock_ttl, locker_id);
+    }
+
+    std::optional<FencingToken>
+    AcquireWithFencingToken(std::chrono::milliseconds lock_ttl, const std::string& locker_id) override {
+        const auto result = coalescer_->Acquire({lock_name_, locker_id, lock_ttl});
+        if (!result.acquired) throw LockIsAcquiredByAnotherHostException();
+        return result.fencing_token;
+    }
+
+    void Release(const std::string& locker_id) override { coalescer_->Release(lock_name_, locker_id); }
+
+private:
+    const std::shared_ptr<BatchCoalescer> coalescer_;
+    const std::string lock_name_;
+};
+
+}  // namespace
+
+}  // namespace impl
+
+DistLockBatcher::DistLockBatcher(
+    std::shared_ptr<DistLockBatchStrategyBase> strategy,
+    std::chrono::milliseconds batch_delay
+)
+    : coalescer_(std::make_shared<impl::BatchCoalescer>(std::move(strategy), batch_delay)) {}
+
+DistLockBatcher::~DistLockBatcher() = default;
+
+std::shared_ptr<DistLockStrategyBase> DistLockBatcher::MakeStrategy(std::string lock_name) {
+    return std::make_shared<impl::BatchedLockStrategy>(coalescer_, std::move(lock_name));
+}
+
+}  // namespace dist_lock
+
+USERVER_NAMESPACE_END
@@ -2,12 +2,19 @@
 
 #include <sys/param.h>
 
+#include <unordered_map>
+#include <unordered_set>
+
+#include <fmt/format.h>
+
 #include <userver/concurrent/variable.hpp>
+#include <userver/dist_lock/dist_lock_batcher.hpp>
 #include <userver/dist_lock/dist_lock_settings.hpp>
 #include <userver/dist_lock/dist_lock_strategy.hpp>
 #include <userver/dist_lock/dist_locked_task.hpp>
 #include <userver/dist_lock/dist_locked_worker.hpp>
 #include <userver/engine/condition_variable.hpp>
+#include <userver/engine/deadline.hpp>
 #include <userver/engine/mutex.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
@@ -441,4 +448,143 @@ UTEST_MT(LockedTask, SingleAttemptExample, 3) {
     /// [Sample distributed locked task SingleAttempt]
 }
 
+namespace {
+
+constexpr std::chrono::milliseconds kBatchDelay{5};
+
+class MockDistLockBatchStrategy final : public dist_lock::DistLockBatchStrategyBase {
+public:
+    std::vector<AcquireResult> AcquireBatch(const std::vector<AcquireRequest>& requests) override {
+        batches_++;
+        auto locks = locks_.Lock();
+        auto lockers = lockers_.Lock();
+        std::vector<AcquireResult> results;
+        for (const auto& request : requests) {
+            requests_++;
+            (*lockers)[request.lock_name].insert(request.locker_id);
+            auto& lock = (*locks)[request.lock_name];
+            if (!lock.owner.empty() && lock.owner != request.locker_id) {
+                results.push_back({});
+                continue;
+            }
+            if (lock.owner.empty()) {
+                lock.owner = request.locker_id;
+                lock.fencing_token = ++last_fencing_token_;
+            }
+            results.push_back({true, lock.fencing_token});
+        }
+        return results;
+    }
+
+    void Release(const std::string& lock_name, const std::string& locker_id) override {
+        auto locks = locks_.Lock();
+        auto& lock = (*locks)[lock_name];
+        if (lock.owner == locker_id) lock.owner.clear();
+    }
+
+    std::size_t GetBatchesCount() const { return batches_; }
+    std::size_t GetRequestsCount() const { return requests_; }
+
+    std::size_t GetLockersCount(const std::string& lock_name) {
+        auto lockers = lockers_.Lock();
+        return (*lockers)[lock_name].size();
+    }
+
+private:
+    struct Lock {
+        std::string owner;
+        dist_lock::FencingToken fencing_token{0};
+    };
+
+    concurrent::Variable<std::unordered_map<std::string, Lock>> locks_;
+    concurrent::Variable<std::unordered_map<std::string, std::unordered_set<std::string>>> lockers_;
+    dist_lock::FencingToken last_fencing_token_{0};
+    std::atomic<std::size_t> batches_{0};
+    std::atomic<std::size_t> requests_{0};
+};
+
+}  // namespace
+
+UTEST_MT(DistLockBatcher, Batches, 3) {
+    auto strategy = std::make_shared<MockDistLockBatchStrategy>();
+    dist_lock::DistLockBatcher batcher{strategy, kBatchDelay};
+
+    constexpr std::size_t kLocksCount = 32;
+    std::vector<std::unique_ptr<dist_lock::DistLockedWorker>> workers;
+    for (std::size_t i = 0; i < kLocksCount; ++i) {
+        auto name = fmt::format("shard-{}", i);
+        auto strategy_of_lock = batcher.MakeStrategy(name);
+        workers.push_back(std::make_unique<dist_lock::DistLockedWorker>(
+            std::move(name),
+            [] { engine::InterruptibleSleepFor(utest::kMaxTestWaitTime); },
+            std::move(strategy_of_lock),
+            MakeSettings()
+        ));
+    }
+    for (auto& worker : workers) worker->Start();
+
+    for (const auto& worker : workers) {
+        const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+        while (!worker->OwnsLock() && !deadline.IsReached()) engine::SleepFor(kAttemptInterval);
+        EXPECT_TRUE(worker->OwnsLock()) << worker->Name();
+    }
+    engine::SleepFor(kLockTtl);
+
+    for (auto& worker : workers) worker->Stop();
+
+    EXPECT_GT(strategy->GetRequestsCount(), strategy->GetBatchesCount() * 4);
+}
+
+UTEST_MT(DistLockBatcher, FencingToken, 3) {
+    auto strategy = std::make_shared<MockDistLockBatchStrategy>();
+    dist_lock::DistLockBatcher batcher{strategy, kBatchDelay};
+    DistLockWorkload work;
+
+    dist_lock::DistLockedWorker worker(
+        kWorkerName, [&] { work.Work(); }, batcher.MakeStrategy("lock"), MakeSettings()
+    );
+    EXPECT_FALSE(worker.GetFencingToken());
+
+    worker.Start();
+    ASSERT_TRUE(work.WaitForLocked(true, utest::kMaxTestWaitTime));
+    const auto first_token = worker.GetFencingToken();
+    ASSERT_TRUE(first_token);
+    worker.Stop();
+    EXPECT_FALSE(worker.GetFencingToken());
+
+    worker.Start();
+    ASSERT_TRUE(work.WaitForLocked(true, utest::kMaxTestWaitTime));
+    const auto second_token = worker.GetFencingToken();
+    ASSERT_TRUE(second_token);
+    EXPECT_GT(*second_token, *first_token);
+    worker.Stop();
+}
+
+UTEST_MT(DistLockBatcher, LocalLease, 3) {
+    auto strategy = std::make_shared<MockDistLockBatchStrategy>();
+    dist_lock::DistLockBatcher batcher{strategy, kBatchDelay};
+    DistLockWorkload work;
+
+    dist_lock::DistLockedTask first(
+        kWorkerName, [&] { work.Work(); }, batcher.MakeStrategy("lock"), MakeSettings()
+    );
+    ASSERT_TRUE(work.WaitForLocked(true, utest::kMaxTestWaitTime));
+
+    dist_lock::DistLockedTask second(
+        kWorkerName,
+        [&] { work.Work(); },
+        batcher.MakeStrategy("lock"),
+        MakeSettings(),
+        dist_lock::DistLockWaitingMode::kNoWait
+    );
+    second.WaitFor(utest::kMaxTestWaitTime);
+    EXPECT_TRUE(second.GetState() == engine::Task::State::kCompleted);
+    EXPECT_EQ(1, work.GetStartedWorkCount());
+    // the attempts of the second task do not reach the storage
+    EXPECT_EQ(strategy->GetLockersCount("lock"), 1);
+
+    work.SetWorkLoopOn(false);
+    first.WaitFor(utest::kMaxTestWaitTime);
+}
+
 USERVER_NAMESPACE_END
@@ -63,6 +63,8 @@ std::optional<std::chrono::steady_clock::duration> DistLockedTask::GetLockedDura
     return locker_ptr_->GetLockedDuration();
 }
 
+std::optional<FencingToken> DistLockedTask::GetFencingToken() const noexcept { return locker_ptr_->GetFencingToken(); }
+
 void DistLockedTask::Get() noexcept(false) {
     UINVARIANT(
         IsValid(),
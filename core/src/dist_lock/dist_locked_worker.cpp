@@ -81,6 +81,10 @@ bool DistLockedWorker::IsRunning() const {
 
 bool DistLockedWorker::OwnsLock() const noexcept { return locker_ptr_->OwnsLock(); }
 
+std::optional<FencingToken> DistLockedWorker::GetFencingToken() const noexcept {
+    return locker_ptr_->GetFencingToken();
+}
+
 std::optional<std::chrono::steady_clock::duration> DistLockedWorker::GetLockedDuration() const {
     return locker_ptr_->GetLockedDuration();
 }
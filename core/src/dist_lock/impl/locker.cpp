@@ -105,7 +105,8 @@ void Locker::Run(LockerMode mode, dist_lock::DistLockWaitingMode waiting_mode, t
         const auto attempt_start = utils::datetime::SteadyNow();
 
         try {
-            strategy_->Acquire(settings.lock_ttl, Id());
+            const auto fencing_token = strategy_->AcquireWithFencingToken(settings.lock_ttl, Id());
+            fencing_token_ = fencing_token.value_or(kNoFencingToken);
             stats_.lock_successes++;
             if (!ExchangeLockState(true, attempt_start)) {
                 LOG_DEBUG() << "Starting watchdog task";
@@ -185,6 +186,13 @@ Locker::RunAsync(engine::TaskProcessor& task_processor, LockerMode locker_mode,
 
 bool Locker::OwnsLock() const noexcept { return is_locked_.load(); }
 
+std::optional<FencingToken> Locker::GetFencingToken() const noexcept {
+    if (!is_locked_) return std::nullopt;
+    const auto fencing_token = fencing_token_.load();
+    if (fencing_token == kNoFencingToken) return std::nullopt;
+    return fencing_token;
+}
+
 bool Locker::ExchangeLockState(bool is_locked, std::chrono::steady_clock::time_point when) {
     lock_refresh_since_epoch_.store(when.time_since_epoch(), std::memory_order_release);
 
@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <functional>
+#include <limits>
 #include <optional>
 #include <string>
 
@@ -48,6 +49,8 @@ public:
 
     bool OwnsLock() const noexcept;
 
+    std::optional<FencingToken> GetFencingToken() const noexcept;
+
 private:
     class LockGuard;
 
@@ -71,6 +74,9 @@ private:
     std::atomic<std::chrono::steady_clock::duration> lock_refresh_since_epoch_{};
     std::atomic<std::chrono::steady_clock::duration> lock_acquire_since_epoch_{};
 
+    static constexpr FencingToken kNoFencingToken = std::numeric_limits<FencingToken>::min();
+    std::atomic<FencingToken> fencing_token_{kNoFencingToken};
+
     Statistics stats_;
     const logging::Level base_log_level_;
 };
@@ -18,6 +18,12 @@ constexpr std::string_view kDumpFormatVersion = "format-version";
 constexpr std::string_view kMaxDumpCount = "max-count";
 constexpr std::string_view kWorldReadable = "world-readable";
 constexpr std::string_view kEncrypted = "encrypted";
+constexpr std::string_view kMmap = "mmap";
+constexpr std::string_view kCompressed = "compressed";
+constexpr std::string_view kCompressionLevel = "compression-level";
+constexpr std::string_view kCompressionDictionary = "compression-dictionary";
+
+constexpr int kDefaultCompressionLevel = 3;
 
 constexpr auto kDefaultFsTaskProcessor = std::string_view{"fs-task-processor"};
 constexpr auto kDefaultMaxDumpCount = uint64_t{1};
@@ -61,6 +67,10 @@ Config::Config(std::string name, const yaml_config::YamlConfig& config, std::str
       max_dump_age(config[kMaxDumpAge].As<std::optional<std::chrono::milliseconds>>()),
       max_dump_age_set(config.HasMember(kMaxDumpAge)),
       dump_is_encrypted(config[kEncrypted].As<bool>(false)),
+      dump_is_mmapped(config[kMmap].As<bool>(false)),
+      dump_is_compressed(config[kCompressed].As<bool>(false)),
+      compression_level(config[kCompressionLevel].As<int>(kDefaultCompressionLevel)),
+      compression_dictionary_path(config[kCompressionDictionary].As<std::optional<std::string>>()),
       static_dumps_enabled(config[kDumpsEnabled].As<bool>()),
       static_min_dump_interval(config[kMinDumpInterval].As<std::chrono::milliseconds>(0)) {
     if (max_dump_age && *max_dump_age <= std::chrono::milliseconds::zero()) {
@@ -69,6 +79,12 @@ Config::Config(std::string name, const yaml_config::YamlConfig& config, std::str
     if (max_dump_count == 0) {
         throw std::logic_error(fmt::format("{}: {} must not be 0", this->name, kMaxDumpCount));
     }
+    if (dump_is_encrypted && dump_is_mmapped) {
+        throw std::logic_error(fmt::format("{}: {} and {} can not be used together", this->name, kEncrypted, kMmap));
+    }
+    if (dump_is_compressed && dump_is_mmapped) {
+        throw std::logic_error(fmt::format("{}: {} and {} can not be used together", this->name, kCompressed, kMmap));
+    }
 }
 
 DynamicConfig::DynamicConfig(const Config& config, ConfigPatch&& patch)
@@ -32,6 +32,7 @@
 #include <userver/components/dump_configurator.hpp>
 #include <userver/dump/config.hpp>
 #include <userver/dump/factory.hpp>
+#include <userver/dump/operations_compressed.hpp>
 #include <userver/testsuite/dump_control.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -410,10 +411,13 @@ void Dumper::Impl::DoWriteDump(TimePoint update_time, tracing::ScopeTime& scope,
     dump_data.dumpable.GetAndWrite(*writer);
     writer->Finish();
     const auto dump_size = boost::filesystem::file_size(dump_path);
+    const auto* compressed_writer = dynamic_cast<const CompressedWriter*>(writer.get());
+    const auto uncompressed_size = compressed_writer ? compressed_writer->GetUncompressedSize() : dump_size;
 
     LOG_INFO() << Name() << ": a new dump has been written at \"" << dump_path << '"';
 
     statistics_.last_written_size = dump_size;
+    statistics_.last_written_uncompressed_size = uncompressed_size;
     statistics_.last_nontrivial_write_duration =
         std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - dump_start);
     statistics_.last_nontrivial_write_start_time = dump_start;
@@ -564,6 +568,22 @@ properties:
                 type: boolean
                 description: Whether to encrypt the dump
                 defaultDescription: false
+            mmap:
+                type: boolean
+                description: Whether to read the dump by mapping the file into memory, see dump::FlatArray
+                defaultDescription: false
+            compressed:
+                type: boolean
+                description: Whether to compress the dump with zstd, can be used together with `encrypted`
+                defaultDescription: false
+            compression-level:
+                type: integer
+                description: zstd compression level
+                defaultDescription: 3
+            compression-dictionary:
+                type: string
+                description: path to a zstd dictionary, e.g. trained by `zstd --train` on sample dumps
+                defaultDescription: null
 )");
 }
 
@@ -1,8 +1,11 @@
 #include <userver/dump/factory.hpp>
 
 #include <dump/secdist.hpp>
+#include <userver/dump/operations_compressed.hpp>
 #include <userver/dump/operations_encrypted.hpp>
 #include <userver/dump/operations_file.hpp>
+#include <userver/dump/operations_mmap.hpp>
+#include <userver/fs/blocking/read.hpp>
 #include <userver/storages/secdist/component.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -19,24 +22,43 @@ boost::filesystem::perms GetPerms(const Config& config) {
         return perms::owner_read;
 }
 
+// Compression goes before the encryption, encrypted data is incompressible
+std::unique_ptr<dump::OperationsFactory>
+WrapCompression(const Config& config, std::unique_ptr<dump::OperationsFactory> factory) {
+    if (!config.dump_is_compressed) return factory;
+
+    CompressionSettings settings;
+    settings.level = config.compression_level;
+    if (config.compression_dictionary_path) {
+        settings.dictionary = fs::blocking::ReadFileContents(*config.compression_dictionary_path);
+    }
+    return std::make_unique<dump::CompressedOperationsFactory>(std::move(factory), std::move(settings));
+}
+
 }  // namespace
 
 std::unique_ptr<dump::OperationsFactory>
 CreateOperationsFactory(const Config& config, const components::ComponentContext& context) {
     auto dump_perms = GetPerms(config);
 
+    std::unique_ptr<dump::OperationsFactory> factory;
     if (config.dump_is_encrypted) {
         const auto& secdist = context.FindComponent<components::Secdist>().Get();
         auto secret_key = secdist.Get<dump::Secdist>().GetSecretKey(config.name);
-        return std::make_unique<dump::EncryptedOperationsFactory>(std::move(secret_key), dump_perms);
+        factory = std::make_unique<dump::EncryptedOperationsFactory>(std::move(secret_key), dump_perms);
+    } else if (config.dump_is_mmapped) {
+        factory = std::make_unique<dump::MmapOperationsFactory>(dump_perms);
     } else {
-        return std::make_unique<dump::FileOperationsFactory>(dump_perms);
+        factory = std::make_unique<dump::FileOperationsFactory>(dump_perms);
     }
+
+    return WrapCompression(config, std::move(factory));
 }
 
 std::unique_ptr<dump::OperationsFactory> CreateDefaultOperationsFactory(const Config& config) {
     auto dump_perms = GetPerms(config);
-    return std::make_unique<dump::FileOperationsFactory>(dump_perms);
+    if (config.dump_is_mmapped) return std::make_unique<dump::MmapOperationsFactory>(dump_perms);
+    return WrapCompression(config, std::make_unique<dump::FileOperationsFactory>(dump_perms));
 }
 
 }  // namespace dump
@@ -0,0 +1,130 @@
+#include <userver/dump/operations_compressed.hpp>
+
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <userver/dump/unsafe.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+namespace {
+
+// zstd works best with large chunks, while dump operations are usually tiny
+constexpr std::size_t kChunkSize = 128 * 1024;
+
+compression::zstd::StreamCompressor MakeCompressor(const CompressionSettings& settings) {
+    try {
+        if (settings.dictionary.empty()) return compression::zstd::StreamCompressor{settings.level};
+        return compression::zstd::StreamCompressor{settings.level, settings.dictionary};
+    } catch (const std::exception& ex) {
+        throw Error(fmt::format("Failed to initialize the dump compression: {}", ex.what()));
+    }
+}
+
+compression::zstd::StreamDecompressor MakeDecompressor(const CompressionSettings& settings) {
+    try {
+        return compression::zstd::StreamDecompressor{settings.dictionary};
+    } catch (const std::exception& ex) {
+        throw Error(fmt::format("Failed to initialize the dump decompression: {}", ex.what()));
+    }
+}
+
+}  // namespace
+
+CompressedWriter::CompressedWriter(std::unique_ptr<Writer> base, const CompressionSettings& settings)
+    : base_(std::move(base)), compressor_(MakeCompressor(settings)) {
+    UASSERT(base_);
+    buffer_.reserve(kChunkSize);
+}
+
+void CompressedWriter::WriteRaw(std::string_view data) {
+    buffer_.append(data);
+    uncompressed_size_ += data.size();
+    if (buffer_.size() >= kChunkSize) Flush();
+}
+
+void CompressedWriter::Flush() {
+    try {
+        WriteStringViewUnsafe(*base_, compressor_.Append(buffer_));
+    } catch (const compression::CompressionError& ex) {
+        throw Error(fmt::format("Failed to compress the dump: {}", ex.what()));
+    }
+    buffer_.clear();
+}
+
+void CompressedWriter::Finish() {
+    Flush();
+    try {
+        WriteStringViewUnsafe(*base_, compressor_.Finish());
+    } catch (const compression::CompressionError& ex) {
+        throw Error(fmt::format("Failed to compress the dump: {}", ex.what()));
+    }
+    base_->Finish();
+}
+
+CompressedReader::CompressedReader(std::unique_ptr<Reader> base, const CompressionSettings& settings)
+    : base_(std::move(base)), decompressor_(MakeDecompressor(settings)) {
+    UASSERT(base_);
+}
+
+std::string_view CompressedReader::ReadRaw(std::size_t max_size) {
+    if (buffer_.size() - pos_ < max_size) {
+        buffer_.erase(0, pos_);
+        pos_ = 0;
+
+        while (buffer_.size() < max_size && !frame_ended_) {
+            auto input = ReadUnsafeAtMost(*base_, kChunkSize);
+            if (input.empty()) {
+                throw Error("Unexpected end-of-file in the middle of the compressed dump");
+            }
+
+            try {
+                frame_ended_ = decompressor_.Decompress(input, buffer_);
+            } catch (const compression::DecompressionError& ex) {
+                throw Error(fmt::format("Failed to decompress the dump: {}", ex.what()));
+            }
+            // The data after the end of the frame is checked in Finish
+            if (!input.empty()) BackUpReadUnsafe(*base_, input.size());
+        }
+    }
+
+    const auto result = std::string_view{buffer_}.substr(pos_, max_size);
+    pos_ += result.size();
+    return result;
+}
+
+void CompressedReader::BackUp(std::size_t size) {
+    UASSERT_MSG(size <= pos_, "Trying to BackUp more bytes than returned by the last ReadRaw");
+    pos_ -= size;
+}
+
+void CompressedReader::Finish() {
+    if (!ReadRaw(1).empty()) {
+        throw Error("Unexpected extra data at the end of the compressed dump");
+    }
+    base_->Finish();
+}
+
+CompressedOperationsFactory::CompressedOperationsFactory(
+    std::unique_ptr<OperationsFactory> base,
+    CompressionSettings settings
+)
+    : base_(std::move(base)), settings_(std::move(settings)) {
+    UASSERT(base_);
+}
+
+std::unique_ptr<Reader> CompressedOperationsFactory::CreateReader(std::string full_path) {
+    return std::make_unique<CompressedReader>(base_->CreateReader(std::move(full_path)), settings_);
+}
+
+std::unique_ptr<Writer> CompressedOperationsFactory::CreateWriter(std::string full_path, tracing::ScopeTime& scope) {
+    return std::make_unique<CompressedWriter>(base_->CreateWriter(std::move(full_path), scope), settings_);
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,75 @@
+#include <userver/dump/operations_compressed.hpp>
+
+#include <string>
+#include <vector>
+
+#include <userver/dump/common_containers.hpp>
+#include <userver/dump/operations_mock.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::vector<std::string> MakeData() {
+    std::vector<std::string> data;
+    for (int i = 0; i < 10'000; ++i) data.push_back("some-string-heavy-value-" + std::to_string(i));
+    return data;
+}
+
+template <typename T>
+std::string WriteCompressed(const T& value, const dump::CompressionSettings& settings = {}) {
+    auto base = std::make_unique<dump::MockWriter>();
+    auto& base_ref = *base;
+    dump::CompressedWriter writer{std::move(base), settings};
+    writer.Write(value);
+    writer.Finish();
+    EXPECT_GT(writer.GetUncompressedSize(), 0);
+    return std::move(base_ref).Extract();
+}
+
+template <typename T>
+T ReadCompressed(std::string data, const dump::CompressionSettings& settings = {}) {
+    dump::CompressedReader reader{std::make_unique<dump::MockReader>(std::move(data)), settings};
+    auto result = reader.Read<T>();
+    reader.Finish();
+    return result;
+}
+
+}  // namespace
+
+TEST(DumpOperationsCompressed, WriteRead) {
+    const auto data = MakeData();
+    const auto compressed = WriteCompressed(data);
+
+    dump::MockWriter plain;
+    plain.Write(data);
+    EXPECT_LT(compressed.size(), std::move(plain).Extract().size() / 4);
+
+    EXPECT_EQ(ReadCompressed<std::vector<std::string>>(compressed), data);
+}
+
+TEST(DumpOperationsCompressed, Dictionary) {
+    dump::CompressionSettings settings;
+    settings.level = 10;
+    settings.dictionary = "some-string-heavy-value-";
+
+    const auto data = MakeData();
+    EXPECT_EQ(ReadCompressed<std::vector<std::string>>(WriteCompressed(data, settings), settings), data);
+}
+
+TEST(DumpOperationsCompressed, ExtraData) {
+    auto compressed = WriteCompressed(MakeData());
+    compressed += "extra";
+
+    EXPECT_THROW(ReadCompressed<std::vector<std::string>>(std::move(compressed)), dump::Error);
+}
+
+TEST(DumpOperationsCompressed, Truncated) {
+    auto compressed = WriteCompressed(MakeData());
+    compressed.resize(compressed.size() / 2);
+
+    EXPECT_THROW(ReadCompressed<std::vector<std::string>>(std::move(compressed)), dump::Error);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,92 @@
+#include <userver/dump/operations_mmap.hpp>
+
+#include <sys/mman.h>
+
+#include <cerrno>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <userver/dump/unsafe.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+MappedFile::MappedFile(const std::string& path) {
+    try {
+        auto fd = fs::blocking::FileDescriptor::Open(path, fs::blocking::OpenFlag::kRead);
+        size_ = fd.GetSize();
+        // mmap fails for zero length, an empty dump needs no mapping
+        if (size_ == 0) return;
+
+        void* data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd.GetNative(), 0);
+        if (data == MAP_FAILED) {
+            throw std::system_error(errno, std::generic_category(), "mmap");
+        }
+        data_ = static_cast<const char*>(data);
+        // The mapping stays valid after the file is closed
+        std::move(fd).Close();
+    } catch (const std::exception& ex) {
+        throw Error(fmt::format("Failed to map the dump file \"{}\". Reason: {}", path, ex.what()));
+    }
+}
+
+MappedFile::~MappedFile() {
+    if (data_) ::munmap(const_cast<char*>(data_), size_);
+}
+
+MmapWriter::MmapWriter(std::string path, boost::filesystem::perms perms, tracing::ScopeTime& scope)
+    : file_writer_(std::move(path), perms, scope) {}
+
+void MmapWriter::WriteRaw(std::string_view data) {
+    WriteStringViewUnsafe(file_writer_, data);
+    position_ += data.size();
+}
+
+void MmapWriter::Finish() { file_writer_.Finish(); }
+
+MmapReader::MmapReader(std::string path)
+    : path_(std::move(path)), file_(std::make_shared<const MappedFile>(path_)), contents_(file_->GetContents()) {}
+
+std::string_view MmapReader::ReadRaw(std::size_t max_size) {
+    const auto result = contents_.substr(position_, max_size);
+    position_ += result.size();
+    return result;
+}
+
+void MmapReader::BackUp(std::size_t size) {
+    UASSERT_MSG(size <= position_, "Trying to BackUp more bytes than returned by the last ReadRaw");
+    position_ -= size;
+}
+
+void MmapReader::Finish() {
+    if (position_ != contents_.size()) {
+        throw Error(fmt::format(
+            "Unexpected extra data at the end of the dump file \"{}\": "
+            "file-size={}, position={}, unread-size={}",
+            path_,
+            contents_.size(),
+            position_,
+            contents_.size() - position_
+        ));
+    }
+}
+
+MmapOperationsFactory::MmapOperationsFactory(boost::filesystem::perms perms) : perms_(perms) {}
+
+std::unique_ptr<Reader> MmapOperationsFactory::CreateReader(std::string full_path) {
+    return std::make_unique<MmapReader>(std::move(full_path));
+}
+
+std::unique_ptr<Writer> MmapOperationsFactory::CreateWriter(std::string full_path, tracing::ScopeTime& scope) {
+    return std::make_unique<MmapWriter>(std::move(full_path), perms_, scope);
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,126 @@
+#include <userver/dump/operations_mmap.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/flat_array.hpp>
+#include <userver/dump/unsafe.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string DumpFilePath(const fs::blocking::TempDirectory& dir) { return dir.GetPath() + "/dump"; }
+
+struct Point final {
+    std::int32_t x;
+    std::int64_t y;
+};
+
+template <typename... Args>
+void WriteDump(const std::string& path, const Args&... args) {
+    auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+    dump::MmapWriter writer(path, boost::filesystem::perms::owner_read, scope_time);
+    (writer.Write(args), ...);
+    writer.Finish();
+}
+
+const std::vector<Point> kPoints{{1, -1}, {2, -2}, {3, -3}};
+
+}  // namespace
+
+UTEST(DumpOperationsMmap, WriteReadRaw) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = DumpFilePath(dir);
+
+    auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+    dump::MmapWriter writer(path, boost::filesystem::perms::owner_read, scope_time);
+    WriteStringViewUnsafe(writer, "abc");
+    EXPECT_EQ(writer.GetPosition(), 3);
+    WriteStringViewUnsafe(writer, "de");
+    EXPECT_EQ(writer.GetPosition(), 5);
+    writer.Finish();
+
+    EXPECT_EQ(fs::blocking::ReadFileContents(path), "abcde");
+
+    dump::MmapReader reader(path);
+    const auto first = ReadStringViewUnsafe(reader, 3);
+    const auto second = ReadStringViewUnsafe(reader, 2);
+    // Views into the mapping are not invalidated by the following reads
+    EXPECT_EQ(first, "abc");
+    EXPECT_EQ(second, "de");
+    reader.Finish();
+}
+
+UTEST(DumpOperationsMmap, EmptyDump) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = DumpFilePath(dir);
+
+    WriteDump(path);
+
+    dump::MmapReader reader(path);
+    EXPECT_EQ(ReadUnsafeAtMost(reader, 10), "");
+    reader.Finish();
+}
+
+UTEST(DumpOperationsMmap, FlatArrayIsMapped) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = DumpFilePath(dir);
+
+    // The string is there to misalign the array
+    WriteDump(path, std::string{"x"}, dump::FlatArray<Point>{kPoints}, std::uint64_t{42});
+
+    dump::FlatArray<Point> points;
+    {
+        dump::MmapReader reader(path);
+        EXPECT_EQ(reader.Read<std::string>(), "x");
+        points = reader.Read<dump::FlatArray<Point>>();
+        EXPECT_EQ(reader.Read<std::uint64_t>(), 42);
+        reader.Finish();
+    }
+
+    // The mapping outlives the reader
+    EXPECT_TRUE(points.IsMapped());
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(points.data()) % alignof(Point), 0);
+    ASSERT_EQ(points.size(), kPoints.size());
+    for (std::size_t i = 0; i < kPoints.size(); ++i) {
+        EXPECT_EQ(points[i].x, kPoints[i].x);
+        EXPECT_EQ(points[i].y, kPoints[i].y);
+    }
+}
+
+UTEST(DumpOperationsMmap, FlatArrayFileReader) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = DumpFilePath(dir);
+
+    WriteDump(path, std::string{"x"}, dump::FlatArray<Point>{kPoints}, dump::FlatArray<Point>{});
+
+    dump::FileReader reader(path);
+    EXPECT_EQ(reader.Read<std::string>(), "x");
+    const auto points = reader.Read<dump::FlatArray<Point>>();
+    EXPECT_TRUE(reader.Read<dump::FlatArray<Point>>().empty());
+    reader.Finish();
+
+    EXPECT_FALSE(points.IsMapped());
+    ASSERT_EQ(points.size(), kPoints.size());
+    EXPECT_EQ(points[2].x, 3);
+    EXPECT_EQ(points[2].y, -3);
+}
+
+UTEST(DumpOperationsMmap, ExtraData) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = DumpFilePath(dir);
+
+    WriteDump(path, std::uint64_t{1}, std::uint64_t{2});
+
+    dump::MmapReader reader(path);
+    EXPECT_EQ(reader.Read<std::uint64_t>(), 1);
+    UEXPECT_THROW(reader.Finish(), dump::Error);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,89 @@
+#include <userver/dump/sharded.hpp>
+
+#include <algorithm>
+
+#include <fmt/format.h>
+
+#include <userver/compression/zstd.hpp>
+#include <userver/dump/common.hpp>
+#include <userver/dump/unsafe.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump::impl {
+
+namespace {
+
+// FNV-1a, the shards are checked for accidental corruption only
+std::uint64_t Checksum(std::string_view data) noexcept {
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (const char c : data) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+}  // namespace
+
+void StringWriter::WriteRaw(std::string_view data) { data_.append(data); }
+
+std::string_view StringReader::ReadRaw(std::size_t max_size) {
+    const auto result = data_.substr(pos_, std::min(max_size, data_.size() - pos_));
+    pos_ += result.size();
+    return result;
+}
+
+void StringReader::BackUp(std::size_t size) {
+    UASSERT_MSG(size <= pos_, "Trying to BackUp more bytes than returned by the last ReadRaw");
+    pos_ -= size;
+}
+
+void StringReader::Finish() {
+    if (pos_ != data_.size()) {
+        throw Error(fmt::format(
+            "Unexpected extra data at the end of the dump shard: shard-size={}, position={}, unread-size={}",
+            data_.size(),
+            pos_,
+            data_.size() - pos_
+        ));
+    }
+}
+
+PackedShard PackShard(std::string_view data) {
+    return {data.size(), Checksum(data), compression::zstd::Compress(data)};
+}
+
+std::string UnpackShard(const PackedShard& shard) {
+    std::string data;
+    try {
+        data = compression::zstd::Decompress(shard.compressed, shard.size);
+    } catch (const std::exception& ex) {
+        throw Error(fmt::format("Failed to decompress the dump shard: {}", ex.what()));
+    }
+
+    if (data.size() != shard.size || Checksum(data) != shard.checksum) {
+        throw Error(fmt::format(
+            "Checksum mismatch in the dump shard: expected-size={}, actual-size={}", shard.size, data.size()
+        ));
+    }
+    return data;
+}
+
+void WriteShard(Writer& writer, const PackedShard& shard) {
+    writer.Write(shard.size);
+    writer.Write(shard.checksum);
+    writer.Write(shard.compressed);
+}
+
+PackedShard ReadShard(Reader& reader) {
+    PackedShard shard;
+    shard.size = reader.Read<std::size_t>();
+    shard.checksum = reader.Read<std::uint64_t>();
+    shard.compressed = reader.Read<std::string>();
+    return shard;
+}
+
+}  // namespace dump::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,59 @@
+#include <userver/dump/sharded.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/dump/operations_mock.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+template <typename T>
+std::string WriteSharded(const T& contents, std::size_t shards_count) {
+    dump::MockWriter writer;
+    dump::WriteSharded(writer, contents, shards_count);
+    writer.Finish();
+    return std::move(writer).Extract();
+}
+
+template <typename T>
+T ReadSharded(std::string data) {
+    dump::MockReader reader(std::move(data));
+    auto result = dump::ReadSharded<T>(reader);
+    reader.Finish();
+    return result;
+}
+
+}  // namespace
+
+UTEST_MT(DumpSharded, UnorderedMap, 4) {
+    std::unordered_map<int, std::string> map;
+    for (int i = 0; i < 1000; ++i) map.emplace(i, std::to_string(i));
+
+    EXPECT_EQ(ReadSharded<decltype(map)>(WriteSharded(map, 4)), map);
+}
+
+UTEST(DumpSharded, OrderIsPreserved) {
+    const std::vector<std::string> vector{"a", "b", "c", "d", "e"};
+
+    for (std::size_t shards_count = 1; shards_count <= 7; ++shards_count) {
+        EXPECT_EQ(ReadSharded<std::vector<std::string>>(WriteSharded(vector, shards_count)), vector) << shards_count;
+    }
+}
+
+UTEST(DumpSharded, Empty) {
+    EXPECT_TRUE(ReadSharded<std::vector<int>>(WriteSharded(std::vector<int>{}, 3)).empty());
+}
+
+UTEST(DumpSharded, Corrupted) {
+    const std::vector<std::string> vector(100, std::string(100, 'a'));
+    auto data = WriteSharded(vector, 2);
+    data.back() ^= 1;
+
+    UEXPECT_THROW(ReadSharded<std::vector<std::string>>(std::move(data)), dump::Error);
+}
+
+USERVER_NAMESPACE_END
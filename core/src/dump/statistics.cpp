@@ -24,6 +24,7 @@ void DumpMetric(utils::statistics::Writer& writer, const Statistics& stats) {
                 .count();
         write["duration-ms"] = stats.last_nontrivial_write_duration.load().count();
         write["size-kb"] = stats.last_written_size.load() / 1024;
+        write["uncompressed-size-kb"] = stats.last_written_uncompressed_size.load() / 1024;
     }
 }
 
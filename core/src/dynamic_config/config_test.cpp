@@ -473,6 +473,28 @@ UTEST(DynamicConfig, JsonConfig) {
     EXPECT_EQ(snapshot[kJsonConfig], kJson);
 }
 
+UTEST(DynamicConfig, ParsesOnlyChangedDocs) {
+    const auto docs_map = dynamic_config::impl::MakeDefaultDocsMap();
+    const dynamic_config::impl::SnapshotData first(docs_map, {});
+    EXPECT_GT(first.GetParsedCount(), 0);
+
+    auto changed_docs_map = docs_map;
+    changed_docs_map.Set(
+        "SAMPLE_STRUCT_CONFIG", formats::json::FromString(R"({"is_foo_enabled": true, "bar_period_ms": 1000})")
+    );
+    const dynamic_config::impl::SnapshotData second(changed_docs_map, docs_map, first);
+    EXPECT_EQ(second.GetParsedCount(), 1);
+
+    const auto changed_id = dynamic_config::impl::ConfigIdGetter::Get(kSampleStructConfig);
+    EXPECT_FALSE(second.IsSameVariable(changed_id, first));
+    EXPECT_TRUE(second.Get<SampleStructConfig>(changed_id).is_foo_enabled);
+    EXPECT_TRUE(second.IsSameVariable(dynamic_config::impl::ConfigIdGetter::Get(kDummyConfig), first));
+
+    const dynamic_config::impl::SnapshotData third(changed_docs_map, changed_docs_map, second);
+    EXPECT_EQ(third.GetParsedCount(), 0);
+    EXPECT_TRUE(third.AreAllVariablesSame(second));
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
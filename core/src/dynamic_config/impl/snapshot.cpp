@@ -1,5 +1,7 @@
 #include <userver/dynamic_config/impl/snapshot.hpp>
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
 #include <userver/compiler/demangle.hpp>
@@ -7,6 +9,7 @@
 #include <userver/dynamic_config/storage_mock.hpp>
 #include <userver/utils/cpu_relax.hpp>
 #include <userver/utils/enumerate.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 #include <userver/utils/impl/static_registration.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -34,6 +37,15 @@ bool IsValidJson(std::string_view json_string) {
     }
 }
 
+bool HaveDocsChanged(const std::vector<std::string>& names, const DocsMap& current, const DocsMap& previous) {
+    for (const auto& name : names) {
+        const bool has_current = current.Has(name);
+        if (has_current != previous.Has(name)) return true;
+        if (has_current && current.Get(name) != previous.Get(name)) return true;
+    }
+    return false;
+}
+
 }  // namespace
 
 [[noreturn]] void WrapGetError(const std::exception& ex, std::type_index type) {
@@ -112,23 +124,36 @@ SnapshotData::SnapshotData(const std::vector<KeyValue>& config_variables) {
     user_configs_.resize(Registry().size());
 
     for (const auto& config_variable : config_variables) {
-        user_configs_[config_variable.GetId()] = config_variable.GetValue();
+        user_configs_[config_variable.GetId()] =
+            std::make_shared<const Variable>(Variable{config_variable.GetValue(), std::nullopt});
     }
 }
 
 SnapshotData::SnapshotData(const DocsMap& defaults, const std::vector<KeyValue>& overrides) : SnapshotData(overrides) {
     utils::StreamingCpuRelax relax(1, nullptr);
-    for (const auto [id, metadata] : utils::enumerate(Registry())) {
-        if (!user_configs_[id].has_value()) {
+    for (ConfigId id = 0; id < user_configs_.size(); ++id) {
+        if (!user_configs_[id]) {
             relax.Relax(1);
-            try {
-                user_configs_[id] = metadata.factory(defaults);
-            } catch (const std::exception& ex) {
-                throw ConfigParseError(fmt::format(
-                    "{} while parsing dynamic config values. {}", compiler::GetTypeName(typeid(ex)), ex.what()
-                ));
-            }
+            ParseVariable(id, defaults);
+        }
+    }
+}
+
+SnapshotData::SnapshotData(const DocsMap& docs_map, const DocsMap& previous_docs_map, const SnapshotData& previous)
+    : SnapshotData(std::vector<KeyValue>{}) {
+    UASSERT(previous.IsEmpty() || previous.user_configs_.size() == user_configs_.size());
+
+    utils::StreamingCpuRelax relax(1, nullptr);
+    for (ConfigId id = 0; id < user_configs_.size(); ++id) {
+        const auto* previous_variable = previous.IsEmpty() ? nullptr : previous.user_configs_[id].get();
+        if (previous_variable && previous_variable->docs_names &&
+            !HaveDocsChanged(*previous_variable->docs_names, docs_map, previous_docs_map)) {
+            user_configs_[id] = previous.user_configs_[id];
+            continue;
         }
+
+        relax.Relax(1);
+        ParseVariable(id, docs_map);
     }
 }
 
@@ -137,20 +162,56 @@ SnapshotData::SnapshotData(const SnapshotData& defaults, const std::vector<KeyVa
     if (defaults.IsEmpty()) return;
 
     for (const auto [id, factory] : utils::enumerate(Registry())) {
-        if (user_configs_[id].has_value()) continue;
+        if (user_configs_[id]) continue;
         user_configs_[id] = defaults.user_configs_[id];
     }
 }
 
 bool SnapshotData::IsEmpty() const noexcept { return user_configs_.empty(); }
 
+bool SnapshotData::IsSameVariable(ConfigId id, const SnapshotData& other) const noexcept {
+    if (IsEmpty() || other.IsEmpty()) return false;
+    UASSERT(id < user_configs_.size() && id < other.user_configs_.size());
+    return user_configs_[id] && user_configs_[id] == other.user_configs_[id];
+}
+
+bool SnapshotData::AreAllVariablesSame(const SnapshotData& other) const noexcept {
+    return !IsEmpty() && user_configs_ == other.user_configs_;
+}
+
+std::size_t SnapshotData::GetParsedCount() const noexcept { return parsed_count_; }
+
 const std::any& SnapshotData::DoGet(ConfigId id) const {
     UASSERT_MSG(id < user_configs_.size(), "SnapshotData is in an empty state.");
     const auto& config = user_configs_[id];
-    if (!config.has_value()) {
+    if (!config || !config->value.has_value()) {
         throw std::logic_error("This type is not registered as config");
     }
-    return config;
+    return config->value;
+}
+
+void SnapshotData::ParseVariable(ConfigId id, const DocsMap& docs_map) {
+    Variable variable;
+    auto& docs_names = variable.docs_names.emplace();
+
+    docs_map.SetAccessedNamesRecorder(&docs_names, utils::impl::InternalTag{});
+    const utils::FastScopeGuard stop_recording([&docs_map]() noexcept {
+        docs_map.SetAccessedNamesRecorder(nullptr, utils::impl::InternalTag{});
+    });
+
+    try {
+        variable.value = Registry()[id].factory(docs_map);
+    } catch (const std::exception& ex) {
+        throw ConfigParseError(
+            fmt::format("{} while parsing dynamic config values. {}", compiler::GetTypeName(typeid(ex)), ex.what())
+        );
+    }
+
+    std::sort(docs_names.begin(), docs_names.end());
+    docs_names.erase(std::unique(docs_names.begin(), docs_names.end()), docs_names.end());
+
+    user_configs_[id] = std::make_shared<const Variable>(std::move(variable));
+    ++parsed_count_;
 }
 
 }  // namespace dynamic_config::impl
@@ -40,6 +40,7 @@ constexpr std::chrono::seconds kWaitInterval(5);
 struct DynamicConfigStatistics final {
     std::atomic<bool> was_last_parse_successful{true};
     utils::statistics::RateCounter parse_errors;
+    utils::statistics::RateCounter parsed_variables;
 };
 
 bool AreCacheDumpsEnabled(const components::ComponentContext& context) {
@@ -86,6 +87,10 @@ private:
     engine::TaskProcessor* fs_task_processor_;
 
     dynamic_config::impl::StorageData cache_;
+    // The docs `cache_` is parsed from, only the variables with changed docs
+    // are parsed on update
+    dynamic_config::DocsMap cache_docs_map_;
+    engine::Mutex set_config_mutex_;
     std::string fs_loading_error_msg_;
     dynamic_config::DocsMap fallback_config_;
 
@@ -177,7 +182,9 @@ void DynamicConfig::Impl::NotifyLoadingFailed(std::string_view updater, std::str
 
 dynamic_config::impl::SnapshotData DynamicConfig::Impl::ParseConfig(const dynamic_config::DocsMap& value) {
     try {
-        dynamic_config::impl::SnapshotData config(value, {});
+        const auto previous = cache_.Read();
+        dynamic_config::impl::SnapshotData config(value, cache_docs_map_, *previous);
+        stats_.parsed_variables += utils::statistics::Rate{config.GetParsedCount()};
         stats_.was_last_parse_successful = true;
         alert_storage_.StopAlertNow("config_parse_error");
         return config;
@@ -192,6 +199,7 @@ dynamic_config::impl::SnapshotData DynamicConfig::Impl::ParseConfig(const dynami
 }
 
 void DynamicConfig::Impl::DoSetConfig(const dynamic_config::DocsMap& value) {
+    const std::lock_guard lock(set_config_mutex_);
     auto config = ParseConfig(value);
 
     if (!value.GetConfigsExpectedToBeUsed(utils::impl::InternalTag{}).empty()) {
@@ -207,6 +215,7 @@ void DynamicConfig::Impl::DoSetConfig(const dynamic_config::DocsMap& value) {
         loaded_cv_.NotifyAll();
     };
     cache_.Update(std::move(config), std::move(after_assign_hook));
+    cache_docs_map_ = value;
 }
 
 void DynamicConfig::Impl::SetConfig(std::string_view updater, dynamic_config::DocsMap&& value) {
@@ -325,6 +334,7 @@ void DynamicConfig::Impl::WriteFsCache(const dynamic_config::DocsMap& docs_map)
 void DynamicConfig::Impl::WriteStatistics(utils::statistics::Writer& writer) const {
     writer["was-last-parse-successful"] = stats_.was_last_parse_successful;
     writer["parse-errors"] = stats_.parse_errors;
+    writer["parsed-variables"] = stats_.parsed_variables;
 }
 
 DynamicConfig::NoblockSubscriber::NoblockSubscriber(DynamicConfig& config_component) noexcept
@@ -40,6 +40,12 @@ void StorageData::Update(SnapshotData config, AfterAssignHook after_assign_hook)
         if (!current_config.GetData().IsEmpty()) previous_config = std::move(current_config);
     }
 
+    // None of the variables was re-parsed, the subscribers have nothing to do
+    if (previous_config && config.AreAllVariablesSame(previous_config->GetData())) {
+        after_assign_hook();
+        return;
+    }
+
     config_.Assign(std::move(config));
     after_assign_hook();
 
@@ -12,6 +12,7 @@
 #include <userver/fs/read.hpp>
 #include <userver/utils/algo.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
+#include <userver/utils/rand.hpp>
 #include <userver/utils/string_to_duration.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
@@ -21,6 +22,8 @@ namespace components {
 
 namespace {
 
+constexpr std::chrono::milliseconds kDefaultLongPollFallbackInterval{10000};
+
 std::optional<cache::AllowedUpdateTypes> ParseDeduplicateUpdateTypes(const yaml_config::YamlConfig& value) {
     const auto str = value.As<std::optional<std::string>>();
     if (!str) return cache::AllowedUpdateTypes::kFullAndIncremental;
@@ -69,6 +72,10 @@ DynamicConfigClientUpdater::DynamicConfigClientUpdater(
       store_enabled_(component_config["store-enabled"].As<bool>(true)),
       deduplicate_update_types_(ParseDeduplicateUpdateTypes(component_config["deduplicate-update-types"])),
       config_client_(component_context.FindComponent<components::DynamicConfigClient>().GetClient()),
+      long_poll_timeout_(component_config["long-poll-timeout"].As<std::optional<std::chrono::milliseconds>>()),
+      long_poll_fallback_interval_(component_config["long-poll-fallback-interval"].As<std::chrono::milliseconds>(
+          kDefaultLongPollFallbackInterval
+      )),
       docs_map_defaults_(component_context.FindComponent<components::DynamicConfig>().GetDefaultDocsMap()),
       docs_map_keys_(utils::AsContainer<DocsMapKeys>(docs_map_defaults_.GetNames())) {
     StartPeriodicUpdates();
@@ -170,6 +177,9 @@ void DynamicConfigClientUpdater::Update(
         if (update_type == cache::UpdateType::kFull) {
             UpdateFull(docs_map_keys, stats);
         } else {
+            // Incremental updates keep the additional keys fetched meanwhile,
+            // SetAdditionalKeys() is not blocked by a long poll
+            additional_docs_map_keys.GetLock().unlock();
             UpdateIncremental(docs_map_keys, stats);
         }
     } catch (const std::exception& ex) {
@@ -214,7 +224,12 @@ void DynamicConfigClientUpdater::UpdateIncremental(
     const std::vector<std::string>& docs_map_keys,
     cache::UpdateStatisticsScope& stats
 ) {
-    auto reply = config_client_.FetchDocsMap(server_timestamp_, docs_map_keys);
+    if (long_poll_timeout_ && std::chrono::steady_clock::now() < next_long_poll_) {
+        stats.FinishNoChanges();
+        return;
+    }
+
+    auto reply = FetchIncrementalUpdate(docs_map_keys);
     auto& docs_map = reply.docs_map;
     SetDisabledKillSwitchesToDefault(docs_map, reply.kill_switches_disabled);
 
@@ -269,6 +284,24 @@ void DynamicConfigClientUpdater::UpdateAdditionalKeys(const std::vector<std::str
     }
 }
 
+dynamic_config::Client::Reply DynamicConfigClientUpdater::FetchIncrementalUpdate(
+    const std::vector<std::string>& docs_map_keys
+) {
+    if (!long_poll_timeout_) return config_client_.FetchDocsMap(server_timestamp_, docs_map_keys);
+
+    const auto start = std::chrono::steady_clock::now();
+    auto reply = config_client_.WaitForDocsMapUpdate(server_timestamp_, docs_map_keys, *long_poll_timeout_);
+
+    const auto now = std::chrono::steady_clock::now();
+    if (reply.IsEmpty() && now - start < *long_poll_timeout_ / 2) {
+        // The config service did not hold the request, falling back to polling
+        const auto max_jitter = long_poll_fallback_interval_.count() / 10;
+        const auto jitter = std::chrono::milliseconds{utils::RandRange(-max_jitter, max_jitter + 1)};
+        next_long_poll_ = now + long_poll_fallback_interval_ + jitter;
+    }
+    return reply;
+}
+
 bool DynamicConfigClientUpdater::IsDuplicate(cache::UpdateType update_type, const dynamic_config::DocsMap& new_value)
     const {
     if (ShouldDeduplicate(deduplicate_update_types_, update_type)) {
@@ -306,6 +339,14 @@ properties:
           - only-full
           - only-incremental
           - full-and-incremental
+    long-poll-timeout:
+        type: string
+        description: how long the config service may hold an incremental update request
+        defaultDescription: long polling is disabled
+    long-poll-fallback-interval:
+        type: string
+        description: interval between the incremental updates if the config service does not support long polling
+        defaultDescription: 10s
 )");
 }
 
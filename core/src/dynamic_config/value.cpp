@@ -12,6 +12,7 @@ USERVER_NAMESPACE_BEGIN
 namespace dynamic_config {
 
 formats::json::Value DocsMap::Get(std::string_view name) const {
+    RecordAccess(name);
     const auto it = utils::impl::FindTransparent(docs_, name);
     if (it == docs_.end()) {
         throw std::runtime_error(fmt::format("Can't find doc for '{}'", name));
@@ -26,7 +27,10 @@ formats::json::Value DocsMap::Get(std::string_view name) const {
     return it->second;
 }
 
-bool DocsMap::Has(std::string_view name) const { return utils::impl::FindTransparent(docs_, name) != docs_.end(); }
+bool DocsMap::Has(std::string_view name) const {
+    RecordAccess(name);
+    return utils::impl::FindTransparent(docs_, name) != docs_.end();
+}
 
 void DocsMap::Set(std::string name, formats::json::Value obj) {
     utils::impl::TransparentInsertOrAssign(docs_, std::move(name), std::move(obj));
@@ -80,6 +84,14 @@ const utils::impl::TransparentSet<std::string>& DocsMap::GetConfigsExpectedToBeU
     return configs_to_be_used_;
 }
 
+void DocsMap::SetAccessedNamesRecorder(std::vector<std::string>* names, utils::impl::InternalTag) const noexcept {
+    accessed_names_ = names;
+}
+
+void DocsMap::RecordAccess(std::string_view name) const {
+    if (accessed_names_) accessed_names_->emplace_back(name);
+}
+
 }  // namespace dynamic_config
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,73 @@
+#include <engine/coro/huge_pages_stack_allocator.hpp>
+
+#include <sys/mman.h>
+
+#include <cstdint>
+#include <new>
+
+#include <userver/utils/assert.hpp>
+
+#include <utils/sys_info.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::coro {
+
+namespace {
+
+std::size_t GetStackSizeWithGuardPage(std::size_t stack_size) {
+    const auto page_size = utils::sys_info::GetPageSize();
+    const auto pages = (stack_size + page_size - 1) / page_size;
+    return (pages + 1) * page_size;
+}
+
+}  // namespace
+
+HugePagesStackAllocator::HugePagesStackAllocator(std::size_t stack_size)
+    : size_(GetStackSizeWithGuardPage(stack_size)), huge_page_size_(utils::sys_info::GetHugePageSize()) {}
+
+boost::context::stack_context HugePagesStackAllocator::allocate() {
+    // Map an extra huge page to be able to align the stack top
+    const auto mapped_size = size_ + huge_page_size_;
+    void* const mapped = ::mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapped == MAP_FAILED) throw std::bad_alloc();
+
+    auto* const mapped_begin = static_cast<char*>(mapped);
+    auto* const mapped_end = mapped_begin + mapped_size;
+    auto* const stack_top = reinterpret_cast<char*>(
+        reinterpret_cast<std::uintptr_t>(mapped_end) & ~static_cast<std::uintptr_t>(huge_page_size_ - 1)
+    );
+    auto* const stack_bottom = stack_top - size_;
+    UASSERT(stack_bottom >= mapped_begin);
+
+    if (stack_bottom != mapped_begin) ::munmap(mapped_begin, stack_bottom - mapped_begin);
+    if (stack_top != mapped_end) ::munmap(stack_top, mapped_end - stack_top);
+
+    const auto page_size = utils::sys_info::GetPageSize();
+    [[maybe_unused]] const auto protect_result = ::mprotect(stack_bottom, page_size, PROT_NONE);
+    UASSERT(protect_result == 0);
+
+#ifdef MADV_HUGEPAGE
+    // Fails if transparent huge pages are disabled, stacks still work
+    ::madvise(stack_bottom + page_size, size_ - page_size, MADV_HUGEPAGE);
+#endif
+
+    boost::context::stack_context sctx;
+    sctx.size = size_;
+    sctx.sp = stack_top;
+    return sctx;
+}
+
+void HugePagesStackAllocator::deallocate(boost::context::stack_context& sctx) noexcept {
+    UASSERT(sctx.sp);
+    ::munmap(static_cast<char*>(sctx.sp) - sctx.size, sctx.size);
+}
+
+bool HugePagesStackAllocator::IsUseful(std::size_t stack_size) {
+    // The guard page is below the usable part of the stack
+    return stack_size >= utils::sys_info::GetHugePageSize();
+}
+
+}  // namespace engine::coro
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+
+#include <coroutines/coroutine.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::coro {
+
+/// Coroutine stack allocator with the same memory layout as
+/// boost::coroutines2::protected_fixedsize_stack (guard page at the bottom,
+/// `sctx.size` includes the guard page), that asks the kernel to back stacks
+/// with transparent huge pages.
+///
+/// The top of the stack is aligned to the huge page size, so that the hottest
+/// part of the stack could be backed by a huge page. The guard page
+/// splits the huge page it belongs to, so only stacks of at least the huge page
+/// size plus a guard page benefit from this allocator.
+class HugePagesStackAllocator final {
+public:
+    explicit HugePagesStackAllocator(std::size_t stack_size);
+
+    boost::context::stack_context allocate();
+
+    void deallocate(boost::context::stack_context& sctx) noexcept;
+
+    /// Whether the stack of `stack_size` could be backed by huge pages at all
+    static bool IsUseful(std::size_t stack_size);
+
+private:
+    const std::size_t size_;
+    const std::size_t huge_page_size_;
+};
+
+}  // namespace engine::coro
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,38 @@
+#include <engine/coro/huge_pages_stack_allocator.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include <utils/sys_info.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(HugePagesStackAllocator, Layout) {
+    const auto huge_page_size = utils::sys_info::GetHugePageSize();
+    const auto page_size = utils::sys_info::GetPageSize();
+
+    for (const std::size_t stack_size : {std::size_t{256 * 1024}, huge_page_size, huge_page_size + 1}) {
+        engine::coro::HugePagesStackAllocator allocator{stack_size};
+        auto sctx = allocator.allocate();
+
+        auto* const top = static_cast<char*>(sctx.sp);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(top) % huge_page_size, 0);
+        // The same as boost::coroutines2::protected_fixedsize_stack
+        EXPECT_EQ(sctx.size, (stack_size + page_size - 1) / page_size * page_size + page_size);
+
+        // The whole stack except for the guard page is writable
+        std::memset(top - sctx.size + page_size, 0x42, sctx.size - page_size);
+
+        allocator.deallocate(sctx);
+    }
+}
+
+TEST(HugePagesStackAllocator, IsUseful) {
+    const auto huge_page_size = utils::sys_info::GetHugePageSize();
+    EXPECT_FALSE(engine::coro::HugePagesStackAllocator::IsUseful(256 * 1024));
+    EXPECT_TRUE(engine::coro::HugePagesStackAllocator::IsUseful(huge_page_size));
+}
+
+USERVER_NAMESPACE_END
@@ -6,21 +6,38 @@
 
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/thread_name.hpp>
 
+#include <utils/cpu_topology.hpp>
 #include <utils/sys_info.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::coro {
 
+namespace {
+
+std::optional<HugePagesStackAllocator> MakeHugePagesStackAllocator(const PoolConfig& config) {
+    if (!config.huge_pages) return std::nullopt;
+
+    if (!HugePagesStackAllocator::IsUseful(config.stack_size)) {
+        LOG_WARNING() << "coro_pool.huge_pages is enabled, but the stack_size=" << config.stack_size
+                      << " is less than the huge page size, stacks would not be backed by huge pages";
+    }
+    return HugePagesStackAllocator{config.stack_size};
+}
+
+}  // namespace
+
 Pool::Pool(PoolConfig config, Executor executor)
     : config_(FixupConfig(std::move(config))),
       executor_(executor),
       local_coroutine_move_size_((config_.local_cache_size + 1) / 2),
       stack_allocator_(config_.stack_size),
+      huge_pages_stack_allocator_(MakeHugePagesStackAllocator(config_)),
       stack_usage_monitor_(config_.stack_size),
       initial_coroutines_(config_.initial_size),
-      used_coroutines_(config_.max_size),
+      used_coroutines_(config_.numa_aware ? utils::cpu_topology::GetNumaNodesCount() : 1, config_.max_size),
       idle_coroutines_num_(config_.initial_size),
       total_coroutines_num_(0) {
     UASSERT(local_coroutine_move_size_ <= config_.local_cache_size);
@@ -51,12 +68,24 @@ typename Pool::CoroutinePtr Pool::GetCoroutine() {
     // First try to dequeue from 'working set': if we can get a coroutine
     // from there we are happy, because we saved on minor-page-faulting (thus
     // increasing resident memory usage) a not-yet-de-virtualized coroutine stack.
-    if (!local_coro_buffer_.empty() || TryPopulateLocalCache()) {
+    auto* const counters = local_counters_;
+    if (!local_coro_buffer_.empty()) {
+        if (counters) ++counters->local_hits;
+        coroutine = std::move(local_coro_buffer_.back());
+        local_coro_buffer_.pop_back();
+    } else if (TryPopulateLocalCache()) {
+        if (counters) ++counters->pool_hits;
         coroutine = std::move(local_coro_buffer_.back());
         local_coro_buffer_.pop_back();
     } else if (initial_coroutines_.try_dequeue(mover)) {
+        if (counters) ++counters->pool_hits;
+        --idle_coroutines_num_;
+    } else if (TryDequeueFromRemoteNodes(mover)) {
+        // Reusing a remote stack is still cheaper than allocating a new one
+        if (counters) ++counters->pool_hits;
         --idle_coroutines_num_;
     } else {
+        if (counters) ++counters->misses;
         coroutine.emplace(CreateCoroutine());
     }
 
@@ -67,7 +96,9 @@ void Pool::PutCoroutine(CoroutinePtr&& coroutine_ptr) {
     if (config_.local_cache_size == 0) {
         const bool ok =
             // We only ever return coroutines into our 'working set'.
-            used_coroutines_.enqueue(GetUsedPoolToken<moodycamel::ProducerToken>(), std::move(coroutine_ptr.Get()));
+            used_coroutines_[local_node_].coroutines.enqueue(
+                GetUsedPoolToken<moodycamel::ProducerToken>(), std::move(coroutine_ptr.Get())
+            );
         if (ok) {
             ++idle_coroutines_num_;
         }
@@ -84,10 +115,18 @@ void Pool::PutCoroutine(CoroutinePtr&& coroutine_ptr) {
 PoolStats Pool::GetStats() const {
     PoolStats stats;
     stats.active_coroutines =
-        total_coroutines_num_.load() - (used_coroutines_.size_approx() + initial_coroutines_.size_approx());
+        total_coroutines_num_.load() - (GetUsedCoroutinesSizeApprox() + initial_coroutines_.size_approx());
     stats.total_coroutines = std::max(total_coroutines_num_.load(), stats.active_coroutines);
     stats.max_stack_usage_pct = stack_usage_monitor_.GetMaxStackUsagePct();
     stats.is_stack_usage_monitor_active = stack_usage_monitor_.IsActive();
+
+    const std::lock_guard lock(thread_counters_mutex_);
+    stats.thread_cache_stats.reserve(thread_counters_.size());
+    for (const auto& counters : thread_counters_) {
+        stats.thread_cache_stats.push_back(
+            {counters.thread_name, counters.local_hits.Load(), counters.pool_hits.Load(), counters.misses.Load()}
+        );
+    }
     return stats;
 }
 
@@ -101,7 +140,7 @@ void Pool::ClearLocalCache() {
         return_to_pool_from_local_cache_num =
             std::min(config_.max_size - current_idle_coroutines_num, local_coro_buffer_.size());
 
-        const bool ok = used_coroutines_.enqueue_bulk(
+        const bool ok = used_coroutines_[local_node_].coroutines.enqueue_bulk(
             GetUsedPoolToken<moodycamel::ProducerToken>(),
             std::make_move_iterator(local_coro_buffer_.begin()),
             return_to_pool_from_local_cache_num
@@ -115,11 +154,18 @@ void Pool::ClearLocalCache() {
 
     total_coroutines_num_ -= local_coro_buffer_.size() - return_to_pool_from_local_cache_num;
     local_coro_buffer_.clear();
+
+    if (local_counters_) {
+        const std::lock_guard lock(thread_counters_mutex_);
+        thread_counters_.remove_if([](const ThreadCacheCounters& counters) { return &counters == local_counters_; });
+        local_counters_ = nullptr;
+    }
 }
 
 Pool::Coroutine Pool::CreateCoroutine(bool quiet) {
     try {
-        Coroutine coroutine(stack_allocator_, executor_);
+        Coroutine coroutine = huge_pages_stack_allocator_ ? Coroutine(*huge_pages_stack_allocator_, executor_)
+                                                          : Coroutine(stack_allocator_, executor_);
         const auto new_total = ++total_coroutines_num_;
         if (!quiet) {
             LOG_DEBUG() << "Created a coroutine #" << new_total << '/' << config_.max_size;
@@ -149,7 +195,7 @@ void Pool::OnCoroutineDestruction() noexcept { --total_coroutines_num_; }
 bool Pool::TryPopulateLocalCache() {
     if (local_coroutine_move_size_ == 0) return false;
 
-    const std::size_t dequeued_num = used_coroutines_.try_dequeue_bulk(
+    const std::size_t dequeued_num = used_coroutines_[local_node_].coroutines.try_dequeue_bulk(
         GetUsedPoolToken<moodycamel::ConsumerToken>(),
         std::back_inserter(local_coro_buffer_),
         local_coroutine_move_size_
@@ -168,7 +214,7 @@ void Pool::DepopulateLocalCache() {
         return_to_pool_from_local_cache_num =
             std::min(config_.max_size - current_idle_coroutines_num, local_coroutine_move_size_);
 
-        const bool ok = used_coroutines_.enqueue_bulk(
+        const bool ok = used_coroutines_[local_node_].coroutines.enqueue_bulk(
             GetUsedPoolToken<moodycamel::ProducerToken>(),
             std::make_move_iterator(local_coro_buffer_.end() - return_to_pool_from_local_cache_num),
             return_to_pool_from_local_cache_num
@@ -193,16 +239,42 @@ PoolConfig Pool::FixupConfig(PoolConfig&& config) {
     return std::move(config);
 }
 
-void Pool::RegisterThread() { stack_usage_monitor_.RegisterThread(); }
+void Pool::RegisterThread() {
+    if (used_coroutines_.size() > 1) {
+        local_node_ =
+            std::min(static_cast<std::size_t>(utils::cpu_topology::GetCurrentNumaNode()), used_coroutines_.size() - 1);
+    }
+    stack_usage_monitor_.RegisterThread();
+
+    const std::lock_guard lock(thread_counters_mutex_);
+    local_counters_ = &thread_counters_.emplace_back(utils::GetCurrentThreadName());
+}
 
 void Pool::AccountStackUsage() { stack_usage_monitor_.AccountStackUsage(); }
 
 template <typename Token>
 Token& Pool::GetUsedPoolToken() {
-    thread_local Token token(used_coroutines_);
+    // Worker threads never change their NUMA node after RegisterThread()
+    thread_local Token token(used_coroutines_[local_node_].coroutines);
     return token;
 }
 
+template <typename Mover>
+bool Pool::TryDequeueFromRemoteNodes(Mover& mover) {
+    for (std::size_t i = 0; i < used_coroutines_.size(); ++i) {
+        if (i != local_node_ && used_coroutines_[i].coroutines.try_dequeue(mover)) return true;
+    }
+    return false;
+}
+
+std::size_t Pool::GetUsedCoroutinesSizeApprox() const {
+    std::size_t result = 0;
+    for (const auto& node : used_coroutines_) {
+        result += node.coroutines.size_approx();
+    }
+    return result;
+}
+
 //////////////////////////////////////////////////////////////
 
 Pool::CoroutinePtr::CoroutinePtr(Pool::Coroutine&& coro, Pool& pool) noexcept : coro_(std::move(coro)), pool_(&pool) {}
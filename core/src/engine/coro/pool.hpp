@@ -1,10 +1,19 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
 #include <vector>
 
 #include <moodycamel/concurrentqueue.h>
 
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/relaxed_counter.hpp>
+
+#include <engine/coro/huge_pages_stack_allocator.hpp>
 #include <engine/coro/pool_config.hpp>
 #include <engine/coro/pool_stats.hpp>
 #include <engine/coro/stack_usage_monitor.hpp>
@@ -47,6 +56,26 @@ private:
     template <typename Token>
     Token& GetUsedPoolToken();
 
+    template <typename Mover>
+    bool TryDequeueFromRemoteNodes(Mover& mover);
+
+    std::size_t GetUsedCoroutinesSizeApprox() const;
+
+    struct NodeCoroutines final {
+        explicit NodeCoroutines(std::size_t capacity) : coroutines(capacity) {}
+
+        moodycamel::ConcurrentQueue<Coroutine> coroutines;
+    };
+
+    struct ThreadCacheCounters final {
+        explicit ThreadCacheCounters(std::string thread_name) : thread_name(std::move(thread_name)) {}
+
+        const std::string thread_name;
+        utils::statistics::RelaxedCounter<std::uint64_t> local_hits;
+        utils::statistics::RelaxedCounter<std::uint64_t> pool_hits;
+        utils::statistics::RelaxedCounter<std::uint64_t> misses;
+    };
+
     const PoolConfig config_;
     const Executor executor_;
 
@@ -60,10 +89,21 @@ private:
     // outside of any coroutine.
     static inline thread_local std::vector<Coroutine> local_coro_buffer_;
 
+    // Index of the NUMA node of the current worker thread in used_coroutines_.
+    // Assigned in RegisterThread(), 0 if the pool is not NUMA-aware.
+    static inline thread_local std::size_t local_node_ = 0;
+
+    // Counters of the current worker thread, assigned in RegisterThread().
+    // nullptr for threads that do not belong to a TaskProcessor.
+    static inline thread_local ThreadCacheCounters* local_counters_ = nullptr;
+
     boost::coroutines2::protected_fixedsize_stack stack_allocator_;
     // Some pointers arithmetic in StackUsageMonitor depends on this.
     // If you change the allocator, adjust the math there accordingly.
     static_assert(std::is_same_v<decltype(stack_allocator_), boost::coroutines2::protected_fixedsize_stack>);
+    // Has the same memory layout as stack_allocator_, used if
+    // PoolConfig::huge_pages is set
+    std::optional<HugePagesStackAllocator> huge_pages_stack_allocator_;
     StackUsageMonitor stack_usage_monitor_;
 
     // We aim to reuse coroutines as much as possible,
@@ -72,11 +112,17 @@ private:
     //
     // The same could've been achieved with some LIFO container, but apparently
     // we don't have a container handy enough to not just use 2 queues.
+    //
+    // With PoolConfig::numa_aware used coroutines are kept per NUMA node,
+    // otherwise there is a single node.
     moodycamel::ConcurrentQueue<Coroutine> initial_coroutines_;
-    moodycamel::ConcurrentQueue<Coroutine> used_coroutines_;
+    utils::FixedArray<NodeCoroutines> used_coroutines_;
 
     std::atomic<std::size_t> idle_coroutines_num_;
     std::atomic<std::size_t> total_coroutines_num_;
+
+    mutable std::mutex thread_counters_mutex_;
+    std::list<ThreadCacheCounters> thread_counters_;
 };
 
 class Pool::CoroutinePtr final {
@@ -10,6 +10,8 @@ PoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<PoolCo
     config.max_size = value["max_size"].As<size_t>(config.max_size);
     config.stack_size = value["stack_size"].As<size_t>(config.stack_size);
     config.local_cache_size = value["local_cache_size"].As<size_t>(config.local_cache_size);
+    config.numa_aware = value["numa_aware"].As<bool>(config.numa_aware);
+    config.huge_pages = value["huge_pages"].As<bool>(config.huge_pages);
     return config;
 }
 
@@ -14,6 +14,8 @@ struct PoolConfig {
     std::size_t max_size = 4000;
     std::size_t stack_size = 256 * 1024ULL;
     std::size_t local_cache_size = 8;
+    bool numa_aware = false;
+    bool huge_pages = false;
 };
 
 PoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<PoolConfig>);
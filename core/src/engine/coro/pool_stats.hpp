@@ -1,17 +1,32 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <string>
 #include <utility>
+#include <vector>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::coro {
 
+// Where the coroutines requested by a worker thread came from
+struct ThreadCacheStats {
+    std::string thread_name;
+    // From the thread local cache
+    std::uint64_t local_hits = 0;
+    // From the shared pool, including the batch refills of the local cache
+    std::uint64_t pool_hits = 0;
+    // New coroutines had to be created
+    std::uint64_t misses = 0;
+};
+
 struct PoolStats {
     size_t active_coroutines = 0;
     size_t total_coroutines = 0;
     std::uint16_t max_stack_usage_pct = 0;
     bool is_stack_usage_monitor_active = false;
+    std::vector<ThreadCacheStats> thread_cache_stats;
 };
 
 inline PoolStats& operator+=(PoolStats& lhs, const PoolStats& rhs) {
@@ -21,6 +36,9 @@ inline PoolStats& operator+=(PoolStats& lhs, const PoolStats& rhs) {
         lhs.max_stack_usage_pct = rhs.max_stack_usage_pct;
     }
     lhs.is_stack_usage_monitor_active |= rhs.is_stack_usage_monitor_active;
+    lhs.thread_cache_stats.insert(
+        lhs.thread_cache_stats.end(), rhs.thread_cache_stats.begin(), rhs.thread_cache_stats.end()
+    );
     return lhs;
 }
 
@@ -0,0 +1,35 @@
+#include <engine/coro/pool.hpp>
+
+#include <algorithm>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/current_task.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/thread_name.hpp>
+
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_pools.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(CoroPool, ThreadCacheStats) {
+    auto& pool = engine::current_task::GetTaskProcessor().GetTaskProcessorPools()->GetCoroPool();
+
+    for (int i = 0; i < 100; ++i) {
+        engine::AsyncNoSpan([] {}).Get();
+    }
+
+    const auto stats = pool.GetStats();
+    const auto thread_name = utils::GetCurrentThreadName();
+    const auto it = std::find_if(
+        stats.thread_cache_stats.begin(),
+        stats.thread_cache_stats.end(),
+        [&](const engine::coro::ThreadCacheStats& thread_stats) { return thread_stats.thread_name == thread_name; }
+    );
+    ASSERT_NE(it, stats.thread_cache_stats.end());
+    EXPECT_GE(it->local_hits + it->pool_hits + it->misses, 100);
+    // Most of the coroutines are reused from the local cache
+    EXPECT_GT(it->local_hits, it->misses);
+}
+
+USERVER_NAMESPACE_END
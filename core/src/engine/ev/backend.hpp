@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+/// Kernel event notification mechanism to be used by libev loops
+enum class Backend {
+    kDefault,   ///< let libev choose the recommended backend
+    kEpoll,     ///< epoll(7)
+    kIoUring,   ///< io_uring(7), requires a recent kernel and libev >= 4.31
+    kLinuxAio,  ///< Linux AIO, requires libev >= 4.27
+    kPoll,      ///< poll(2)
+    kSelect,    ///< select(2)
+};
+
+std::string_view ToString(Backend backend);
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
@@ -40,9 +40,77 @@ void ReleaseEvDefaultLoop() {
     GetEvDefaultLoopFlag().clear();
 }
 
+unsigned int ToEvBackendFlags(Backend backend) {
+    switch (backend) {
+        case Backend::kDefault:
+            return 0;
+        case Backend::kEpoll:
+            return EVBACKEND_EPOLL;
+        case Backend::kIoUring:
+#ifdef EVBACKEND_IOURING
+            return EVBACKEND_IOURING;
+#else
+            return 0;
+#endif
+        case Backend::kLinuxAio:
+#ifdef EVBACKEND_LINUXAIO
+            return EVBACKEND_LINUXAIO;
+#else
+            return 0;
+#endif
+        case Backend::kPoll:
+            return EVBACKEND_POLL;
+        case Backend::kSelect:
+            return EVBACKEND_SELECT;
+    }
+
+    UINVARIANT(false, "Unexpected ev backend");
+}
+
+Backend FromEvBackendFlags(unsigned int flags) {
+    for (const auto backend :
+         {Backend::kEpoll, Backend::kIoUring, Backend::kLinuxAio, Backend::kPoll, Backend::kSelect}) {
+        const auto backend_flags = ToEvBackendFlags(backend);
+        if (backend_flags != 0 && (flags & backend_flags) == backend_flags) return backend;
+    }
+    return Backend::kDefault;
+}
+
+unsigned int GetEvLoopFlags(Backend backend) {
+    if (backend == Backend::kDefault) return EVFLAG_AUTO;
+
+    const auto backend_flags = ToEvBackendFlags(backend);
+    if (backend_flags == 0 || (ev_supported_backends() & backend_flags) == 0) {
+        LOG_WARNING() << "ev backend '" << ToString(backend)
+                      << "' is not supported by libev on this platform, falling back to the default one";
+        return EVFLAG_AUTO;
+    }
+    return EVFLAG_AUTO | backend_flags;
+}
+
 }  // namespace
 
-EventLoop::EventLoop(EvLoopType ev_loop_mode) : ev_loop_mode_(ev_loop_mode) {
+std::string_view ToString(Backend backend) {
+    switch (backend) {
+        case Backend::kDefault:
+            return "default";
+        case Backend::kEpoll:
+            return "epoll";
+        case Backend::kIoUring:
+            return "io_uring";
+        case Backend::kLinuxAio:
+            return "linuxaio";
+        case Backend::kPoll:
+            return "poll";
+        case Backend::kSelect:
+            return "select";
+    }
+
+    UINVARIANT(false, "Unexpected ev backend");
+}
+
+EventLoop::EventLoop(EvLoopType ev_loop_mode, Backend backend)
+    : ev_loop_mode_(ev_loop_mode), requested_backend_(backend) {
     if (ev_loop_mode_ == EvLoopType::kDefaultLoop) AcquireEvDefaultLoop();
     Start();
 }
@@ -56,6 +124,8 @@ EventLoop::~EventLoop() {
     }
 }
 
+Backend EventLoop::GetBackend() const { return FromEvBackendFlags(ev_backend(loop_)); }
+
 void EventLoop::RunOnce() noexcept {
     UASSERT(DebugIsSameOsThread());
     ev_run(loop_, EVRUN_ONCE);
@@ -78,9 +148,21 @@ bool EventLoop::DebugIsSameOsThread() noexcept {
 }
 
 void EventLoop::Start() {
-    loop_ = ((ev_loop_mode_ == EvLoopType::kDefaultLoop) ? ev_default_loop(EVFLAG_AUTO) : ev_loop_new(EVFLAG_AUTO));
+    const auto create_loop = [this](unsigned int flags) {
+        return (ev_loop_mode_ == EvLoopType::kDefaultLoop) ? ev_default_loop(flags) : ev_loop_new(flags);
+    };
+
+    const auto flags = GetEvLoopFlags(requested_backend_);
+    loop_ = create_loop(flags);
+    if (!loop_ && flags != EVFLAG_AUTO) {
+        // e.g. io_uring_setup() may be forbidden by seccomp or by the kernel
+        LOG_WARNING() << "Failed to initialize ev loop with '" << ToString(requested_backend_)
+                      << "' backend, falling back to the default one";
+        loop_ = create_loop(EVFLAG_AUTO);
+    }
 
-    UASSERT(loop_);
+    UINVARIANT(loop_, "Failed to initialize ev loop");
+    LOG_DEBUG() << "Using '" << ToString(GetBackend()) << "' ev backend";
 #ifdef EV_HAS_IO_PESSIMISTIC_REMOVE
     ev_set_io_pessimistic_remove(loop_);
 #endif
@@ -5,6 +5,7 @@
 #include <ev.h>
 
 #include <engine/ev/async_payload_base.hpp>
+#include <engine/ev/backend.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -17,12 +18,16 @@ public:
         kDefaultLoop,
     };
 
-    explicit EventLoop(EvLoopType ev_loop_mode);
+    explicit EventLoop(EvLoopType ev_loop_mode, Backend backend = Backend::kDefault);
 
     ~EventLoop();
 
     struct ev_loop* GetEvLoop() const noexcept { return loop_; }
 
+    // Returns the backend that is actually used by the loop, which may differ
+    // from the requested one if it is not supported on the current platform.
+    Backend GetBackend() const;
+
     void RunOnce() noexcept;
 
     // Callbacks passed to RunInEvLoopAsync() are serialized.
@@ -43,6 +48,7 @@ private:
     ev_child watch_child_{};
 
     const EvLoopType ev_loop_mode_;
+    const Backend requested_backend_;
 
 #ifndef NDEBUG
     std::thread::id os_thread_id_{};
@@ -27,14 +27,28 @@ const auto kCpuStatsThrottle = static_cast<std::size_t>(kCpuStatsCollectInterval
 
 }  // namespace
 
-Thread::Thread(const std::string& thread_name) : Thread(thread_name, EventLoop::EvLoopType::kNewLoop) {}
-
-Thread::Thread(const std::string& thread_name, UseDefaultEvLoop)
-    : Thread(thread_name, EventLoop::EvLoopType::kDefaultLoop) {}
-
-Thread::Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type)
-    : event_loop_(ev_loop_type), name_{thread_name}, cpu_stats_storage_{kCpuStatsCollectInterval, kCpuStatsThrottle} {
+Thread::Thread(const std::string& thread_name, Backend backend, std::chrono::microseconds timer_wheel_resolution)
+    : Thread(thread_name, EventLoop::EvLoopType::kNewLoop, backend, timer_wheel_resolution) {}
+
+Thread::Thread(
+    const std::string& thread_name,
+    UseDefaultEvLoop,
+    Backend backend,
+    std::chrono::microseconds timer_wheel_resolution
+)
+    : Thread(thread_name, EventLoop::EvLoopType::kDefaultLoop, backend, timer_wheel_resolution) {}
+
+Thread::Thread(
+    const std::string& thread_name,
+    EventLoop::EvLoopType ev_loop_type,
+    Backend backend,
+    std::chrono::microseconds timer_wheel_resolution
+)
+    : event_loop_(ev_loop_type, backend), name_{thread_name}, cpu_stats_storage_{kCpuStatsCollectInterval, kCpuStatsThrottle} {
     UASSERT_MSG(kDeferredInterval > std::chrono::milliseconds{4}, "Timer events would happen too often");
+    if (timer_wheel_resolution.count() > 0) {
+        timer_wheel_.emplace(timer_wheel_resolution, TimerWheel::Clock::now());
+    }
     Start();
 }
 
@@ -79,6 +93,24 @@ void Thread::RegisterInEvLoop(AsyncPayloadBase& payload) {
 
 bool Thread::IsInEvThread() const { return (std::this_thread::get_id() == thread_.get_id()); }
 
+void Thread::StartWheelTimer(TimerWheel::Entry& entry, Deadline deadline) noexcept {
+    UASSERT(IsInEvThread());
+    UASSERT(timer_wheel_);
+    timer_wheel_->Schedule(entry, TimerWheel::Clock::now() + deadline.TimeLeft());
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+    if (!ev_is_active(&timer_wheel_timer_)) {
+        ev_timer_again(GetEvLoop(), &timer_wheel_timer_);
+    }
+}
+
+void Thread::StopWheelTimer(TimerWheel::Entry& entry) noexcept {
+    UASSERT(IsInEvThread());
+    UASSERT(timer_wheel_);
+    // The ev timer is stopped on the next tick if the wheel becomes empty
+    timer_wheel_->Cancel(entry);
+}
+
 std::uint8_t Thread::GetCurrentLoadPercent() const { return cpu_stats_storage_.GetCurrentLoadPercent(); }
 
 const std::string& Thread::GetName() const { return name_; }
@@ -109,6 +141,12 @@ void Thread::Start() {
     ev_timer_init(&defer_timer_, UpdateTimersWatcher, 0.0, defer_duration.count());
     ev_timer_start(loop, &defer_timer_);
 
+    if (timer_wheel_) {
+        const auto tick_duration = std::chrono::duration_cast<LibEvDuration>(timer_wheel_->GetResolution());
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+        ev_timer_init(&timer_wheel_timer_, TimerWheelWatcher, 0.0, tick_duration.count());
+    }
+
     is_running_ = true;
     thread_ = std::thread([this] {
         utils::SetCurrentThreadName(name_);
@@ -137,6 +175,7 @@ void Thread::RunEvLoop() {
     ev_async_stop(GetEvLoop(), &watch_update_);
     ev_async_stop(GetEvLoop(), &watch_break_);
     ev_timer_stop(GetEvLoop(), &defer_timer_);
+    ev_timer_stop(GetEvLoop(), &timer_wheel_timer_);
 }
 
 void Thread::UpdateLoopWatcher(struct ev_loop* loop, ev_async*, int) noexcept {
@@ -151,6 +190,21 @@ void Thread::UpdateTimersWatcher(struct ev_loop* loop, ev_timer*, int) noexcept
     ev_thread->UpdateLoopWatcherImpl();
 }
 
+void Thread::TimerWheelWatcher(struct ev_loop* loop, ev_timer*, int) noexcept {
+    auto* ev_thread = static_cast<Thread*>(ev_userdata(loop));
+    UASSERT(ev_thread != nullptr);
+    ev_thread->TimerWheelWatcherImpl();
+}
+
+void Thread::TimerWheelWatcherImpl() noexcept {
+    UASSERT(timer_wheel_);
+    timer_wheel_->Advance(TimerWheel::Clock::now());
+
+    if (timer_wheel_->IsEmpty()) {
+        ev_timer_stop(GetEvLoop(), &timer_wheel_timer_);
+    }
+}
+
 void Thread::UpdateLoopWatcherImpl() {
     while (AsyncPayloadBase* payload = func_queue_.TryPopBlocking()) {
         LOG_TRACE() << "Thread::UpdateLoopWatcherImpl(), " << compiler::GetTypeName(typeid(*payload));
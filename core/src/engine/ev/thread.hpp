@@ -3,6 +3,7 @@
 #include <atomic>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <thread>
 
@@ -12,6 +13,7 @@
 
 #include <engine/ev/async_payload_base.hpp>
 #include <engine/ev/event_loop.hpp>
+#include <engine/ev/timer_wheel.hpp>
 #include <userver/concurrent/impl/intrusive_mpsc_queue.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
@@ -27,13 +29,25 @@ public:
     struct UseDefaultEvLoop {};
     static constexpr UseDefaultEvLoop kUseDefaultEvLoop{};
 
-    explicit Thread(const std::string& thread_name);
-    Thread(const std::string& thread_name, UseDefaultEvLoop);
+    /// A zero `timer_wheel_resolution` disables the timer wheel
+    explicit Thread(
+        const std::string& thread_name,
+        Backend backend = Backend::kDefault,
+        std::chrono::microseconds timer_wheel_resolution = {}
+    );
+    Thread(
+        const std::string& thread_name,
+        UseDefaultEvLoop,
+        Backend backend = Backend::kDefault,
+        std::chrono::microseconds timer_wheel_resolution = {}
+    );
 
     ~Thread();
 
     struct ev_loop* GetEvLoop() const { return event_loop_.GetEvLoop(); }
 
+    Backend GetBackend() const { return event_loop_.GetBackend(); }
+
     // Callbacks passed to RunInEvLoopAsync() are serialized.
     // All callbacks are guaranteed to execute.
     void RunInEvLoopAsync(AsyncPayloadBase& payload) noexcept;
@@ -45,11 +59,22 @@ public:
 
     bool IsInEvThread() const;
 
+    bool HasTimerWheel() const noexcept { return timer_wheel_.has_value(); }
+
+    // Must be called from the ev thread
+    void StartWheelTimer(TimerWheel::Entry& entry, Deadline deadline) noexcept;
+    void StopWheelTimer(TimerWheel::Entry& entry) noexcept;
+
     std::uint8_t GetCurrentLoadPercent() const;
     const std::string& GetName() const;
 
 private:
-    Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type);
+    Thread(
+        const std::string& thread_name,
+        EventLoop::EvLoopType ev_loop_type,
+        Backend backend,
+        std::chrono::microseconds timer_wheel_resolution
+    );
 
     void RegisterInEvLoop(AsyncPayloadBase& payload);
 
@@ -60,6 +85,8 @@ private:
 
     static void UpdateLoopWatcher(struct ev_loop*, ev_async* w, int) noexcept;
     static void UpdateTimersWatcher(struct ev_loop*, ev_timer* w, int) noexcept;
+    static void TimerWheelWatcher(struct ev_loop*, ev_timer* w, int) noexcept;
+    void TimerWheelWatcherImpl() noexcept;
     void UpdateLoopWatcherImpl();
     static void BreakLoopWatcher(struct ev_loop*, ev_async* w, int) noexcept;
     void BreakLoopWatcherImpl();
@@ -78,6 +105,10 @@ private:
     std::unique_lock<std::mutex> lock_{loop_mutex_, std::defer_lock};
 
     ev_timer defer_timer_{};
+
+    // Coarse timers for deadlines, ticked by timer_wheel_timer_ while non-empty
+    std::optional<TimerWheel> timer_wheel_;
+    ev_timer timer_wheel_timer_{};
     ev_async watch_update_{};
     ev_async watch_break_{};
 
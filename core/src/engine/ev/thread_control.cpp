@@ -21,6 +21,8 @@ void ThreadControlBase::RunPayloadInEvLoopDeferred(AsyncPayloadBase& payload, De
 
 bool ThreadControlBase::IsInEvThread() const noexcept { return thread_.IsInEvThread(); }
 
+bool ThreadControlBase::HasTimerWheel() const noexcept { return thread_.HasTimerWheel(); }
+
 // NOLINTNEXTLINE(readability-make-member-function-const)
 void ThreadControlBase::DoStart(ev_timer& w) noexcept {
     UASSERT(IsInEvThread());
@@ -68,6 +70,14 @@ void ThreadControlBase::DoStop(ev_io& w) noexcept {
     ev_io_stop(GetEvLoop(), &w);
 }
 
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void ThreadControlBase::DoStart(TimerWheel::Entry& w, Deadline deadline) noexcept {
+    thread_.StartWheelTimer(w, deadline);
+}
+
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void ThreadControlBase::DoStop(TimerWheel::Entry& w) noexcept { thread_.StopWheelTimer(w); }
+
 TimerThreadControl::TimerThreadControl(Thread& thread) noexcept : ThreadControlBase{thread} {}
 
 // NOLINTNEXTLINE(readability-make-member-function-const)
@@ -79,6 +89,12 @@ void TimerThreadControl::Stop(ev_timer& w) noexcept { DoStop(w); }
 // NOLINTNEXTLINE(readability-make-member-function-const)
 void TimerThreadControl::Again(ev_timer& w) noexcept { DoAgain(w); }
 
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void TimerThreadControl::Start(TimerWheel::Entry& w, Deadline deadline) noexcept { DoStart(w, deadline); }
+
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void TimerThreadControl::Stop(TimerWheel::Entry& w) noexcept { DoStop(w); }
+
 ThreadControl::ThreadControl(Thread& thread) noexcept : ThreadControlBase{thread} {}
 
 // NOLINTNEXTLINE(readability-make-member-function-const)
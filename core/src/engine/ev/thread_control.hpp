@@ -9,6 +9,7 @@
 #include <ev.h>
 
 #include <engine/ev/async_payload_base.hpp>
+#include <engine/ev/timer_wheel.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/single_use_event.hpp>
 #include <userver/engine/task/cancel.hpp>
@@ -139,6 +140,9 @@ public:
 
     bool IsInEvThread() const noexcept;
 
+    /// Whether coarse timers could be started on the thread
+    bool HasTimerWheel() const noexcept;
+
 protected:
     explicit ThreadControlBase(Thread& thread) noexcept;
 
@@ -153,6 +157,9 @@ protected:
     void DoStart(ev_io& w) noexcept;
     void DoStop(ev_io& w) noexcept;
 
+    void DoStart(TimerWheel::Entry& w, Deadline deadline) noexcept;
+    void DoStop(TimerWheel::Entry& w) noexcept;
+
 private:
     Thread& thread_;
 };
@@ -214,6 +221,10 @@ public:
     void Start(ev_timer& w) noexcept;
     void Stop(ev_timer& w) noexcept;
     void Again(ev_timer& w) noexcept;
+
+    /// Starts or restarts a coarse timer, requires HasTimerWheel()
+    void Start(TimerWheel::Entry& w, Deadline deadline) noexcept;
+    void Stop(TimerWheel::Entry& w) noexcept;
 };
 
 class ThreadControl final : public ThreadControlBase {
@@ -1,13 +1,33 @@
 #include "thread_pool_config.hpp"
 
+#include <userver/utils/trivial_map.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
 
+Backend Parse(const yaml_config::YamlConfig& value, formats::parse::To<Backend>) {
+    static constexpr utils::TrivialBiMap kMap([](auto selector) {
+        return selector()
+            .Case(Backend::kDefault, "default")
+            .Case(Backend::kEpoll, "epoll")
+            .Case(Backend::kIoUring, "io_uring")
+            .Case(Backend::kLinuxAio, "linuxaio")
+            .Case(Backend::kPoll, "poll")
+            .Case(Backend::kSelect, "select");
+    });
+
+    return utils::ParseFromValueString(value, kMap);
+}
+
 ThreadPoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<ThreadPoolConfig>) {
     ThreadPoolConfig config;
     config.threads = value["threads"].As<std::size_t>(config.threads);
     config.thread_name = value["thread_name"].As<std::string>(config.thread_name);
+    config.backend = value["backend"].As<Backend>(config.backend);
+    config.timer_wheel_resolution =
+        value["timer_wheel_resolution"].As<std::chrono::milliseconds>(config.timer_wheel_resolution);
+    config.file_io_uring_entries = value["file_io_uring_entries"].As<std::uint32_t>(config.file_io_uring_entries);
     return config;
 }
 
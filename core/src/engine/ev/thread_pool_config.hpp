@@ -1,10 +1,14 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <string>
 
 #include <userver/formats/yaml.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
+#include <engine/ev/backend.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
@@ -13,8 +17,15 @@ struct ThreadPoolConfig {
     std::size_t threads = 2;
     std::string thread_name = "event-worker";
     bool ev_default_loop_disabled = false;
+    Backend backend = Backend::kDefault;
+    // Zero disables the timer wheel
+    std::chrono::milliseconds timer_wheel_resolution{0};
+    // Zero performs the file operations on blocking task processors
+    std::uint32_t file_io_uring_entries{0};
 };
 
+Backend Parse(const yaml_config::YamlConfig& value, formats::parse::To<Backend>);
+
 ThreadPoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<ThreadPoolConfig>);
 
 }  // namespace engine::ev
@@ -0,0 +1,122 @@
+#include <engine/ev/timer_wheel.hpp>
+
+#include <algorithm>
+#include <limits>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+TimerWheel::TimerWheel(std::chrono::microseconds resolution, Clock::time_point now)
+    : resolution_(resolution), start_(now) {
+    UINVARIANT(resolution_.count() > 0, "Timer wheel resolution must be positive");
+}
+
+TimerWheel::~TimerWheel() = default;
+
+void TimerWheel::Schedule(Entry& entry, Clock::time_point expiration) noexcept {
+    Cancel(entry);
+
+    // Round up, timers must not fire before the expiration
+    entry.expiration_tick_ = ToTick(expiration + resolution_ - Clock::duration{1});
+    Insert(entry);
+    ++size_;
+}
+
+void TimerWheel::Cancel(Entry& entry) noexcept {
+    if (!entry.IsScheduled()) return;
+
+    UASSERT(size_ > 0);
+    entry.hook_.unlink();
+    --size_;
+}
+
+void TimerWheel::Advance(Clock::time_point now) noexcept {
+    const auto target_tick = ToTick(now);
+
+    while (size_ != 0 && next_tick_ <= target_tick) {
+        next_tick_ = std::min(FindNextTickToProcess(), target_tick + 1);
+        if (next_tick_ > target_tick) break;
+
+        const auto slot_index = next_tick_ & kSlotMask;
+        if (slot_index == 0) {
+            for (std::size_t level = 1; level < kLevels; ++level) {
+                const auto level_slot_index = (next_tick_ >> (kSlotBits * level)) & kSlotMask;
+                Cascade(level, level_slot_index);
+                if (level_slot_index != 0) break;
+            }
+        }
+
+        // Callbacks may reschedule entries into the current slot
+        Slot expired;
+        expired.splice(expired.end(), levels_[0][slot_index]);
+        ++next_tick_;
+
+        while (!expired.empty()) {
+            auto& entry = expired.front();
+            expired.pop_front();
+            --size_;
+            entry.callback_(entry);
+        }
+    }
+
+    // There is nothing to cascade in an empty wheel, idle ticks are skipped
+    next_tick_ = std::max(next_tick_, target_tick + 1);
+}
+
+std::uint64_t TimerWheel::FindNextTickToProcess() const noexcept {
+    if (!levels_[0][next_tick_ & kSlotMask].empty()) return next_tick_;
+
+    // Slot `i` of level `L` is processed on the ticks that are multiples of
+    // 64^L with `i` in the level bits.
+    auto result = std::numeric_limits<std::uint64_t>::max();
+    for (std::size_t level = 0; level < kLevels; ++level) {
+        const auto shift = kSlotBits * level;
+        const auto first_unit = (next_tick_ + (std::uint64_t{1} << shift) - 1) >> shift;
+
+        for (std::uint64_t slot_index = 0; slot_index < kSlotsPerLevel; ++slot_index) {
+            if (levels_[level][slot_index].empty()) continue;
+            const auto unit = first_unit + ((slot_index - first_unit) & kSlotMask);
+            result = std::min(result, unit << shift);
+        }
+    }
+    return result;
+}
+
+std::uint64_t TimerWheel::ToTick(Clock::time_point time_point) const noexcept {
+    if (time_point <= start_) return 0;
+    return static_cast<std::uint64_t>((time_point - start_) / resolution_);
+}
+
+void TimerWheel::Insert(Entry& entry) noexcept {
+    auto expiration_tick = std::max(entry.expiration_tick_, next_tick_);
+    const auto ticks_ahead = std::min(expiration_tick - next_tick_, kMaxTicksAhead);
+    // Too far timers are put into the last level and cascaded again later
+    expiration_tick = next_tick_ + ticks_ahead;
+
+    std::size_t level = 0;
+    while (level + 1 < kLevels && ticks_ahead >= (std::uint64_t{1} << (kSlotBits * (level + 1)))) {
+        ++level;
+    }
+
+    const auto slot_index = (expiration_tick >> (kSlotBits * level)) & kSlotMask;
+    levels_[level][slot_index].push_back(entry);
+}
+
+void TimerWheel::Cascade(std::size_t level, std::size_t slot_index) noexcept {
+    UASSERT(level > 0 && level < kLevels);
+
+    Slot cascaded;
+    cascaded.splice(cascaded.end(), levels_[level][slot_index]);
+    while (!cascaded.empty()) {
+        auto& entry = cascaded.front();
+        cascaded.pop_front();
+        Insert(entry);
+    }
+}
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/intrusive/list.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+/// Hierarchical timing wheel with a fixed resolution.
+///
+/// Scheduling and cancellation are O(1) regardless of the number of timers,
+/// unlike the libev timer heap. Timers fire no earlier than their expiration
+/// time and up to one resolution tick later. Not thread-safe, used from
+/// a single ev thread.
+class TimerWheel final {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    class Entry final {
+    public:
+        using Callback = void (*)(Entry&) noexcept;
+
+        explicit Entry(Callback callback, void* data = nullptr) noexcept : data(data), callback_(callback) {}
+
+        Entry(const Entry&) = delete;
+        Entry& operator=(const Entry&) = delete;
+
+        // Entries must not be destroyed while scheduled
+        bool IsScheduled() const noexcept { return hook_.is_linked(); }
+
+        // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+        void* data;
+
+    private:
+        friend class TimerWheel;
+
+        boost::intrusive::list_member_hook<boost::intrusive::link_mode<boost::intrusive::auto_unlink>> hook_;
+        std::uint64_t expiration_tick_{0};
+        Callback callback_;
+    };
+
+    TimerWheel(std::chrono::microseconds resolution, Clock::time_point now);
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+    ~TimerWheel();
+
+    /// Schedules or reschedules the entry
+    void Schedule(Entry& entry, Clock::time_point expiration) noexcept;
+
+    /// Does nothing for an entry that is not scheduled
+    void Cancel(Entry& entry) noexcept;
+
+    /// Invokes callbacks of all the entries that expired by `now`. Callbacks
+    /// are allowed to schedule and cancel entries.
+    void Advance(Clock::time_point now) noexcept;
+
+    bool IsEmpty() const noexcept { return size_ == 0; }
+
+    std::size_t GetSize() const noexcept { return size_; }
+
+    std::chrono::microseconds GetResolution() const noexcept { return resolution_; }
+
+private:
+    static constexpr std::size_t kSlotBits = 6;
+    static constexpr std::size_t kSlotsPerLevel = std::size_t{1} << kSlotBits;
+    static constexpr std::uint64_t kSlotMask = kSlotsPerLevel - 1;
+    // With 1ms resolution covers ~12 days, farther timers are cascaded again
+    static constexpr std::size_t kLevels = 5;
+    static constexpr std::uint64_t kMaxTicksAhead = (std::uint64_t{1} << (kSlotBits * kLevels)) - 1;
+
+    using Slot = boost::intrusive::list<
+        Entry,
+        boost::intrusive::member_hook<Entry, decltype(Entry::hook_), &Entry::hook_>,
+        boost::intrusive::constant_time_size<false>>;
+    using Level = std::array<Slot, kSlotsPerLevel>;
+
+    std::uint64_t ToTick(Clock::time_point time_point) const noexcept;
+
+    // Skips the ticks that have nothing to fire and nothing to cascade
+    std::uint64_t FindNextTickToProcess() const noexcept;
+
+    void Insert(Entry& entry) noexcept;
+
+    void Cascade(std::size_t level, std::size_t slot_index) noexcept;
+
+    const std::chrono::microseconds resolution_;
+    const Clock::time_point start_;
+    // The next tick to process, all the earlier ticks have fired
+    std::uint64_t next_tick_{0};
+    std::size_t size_{0};
+    std::array<Level, kLevels> levels_;
+};
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,124 @@
+#include <engine/ev/timer_wheel.hpp>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using engine::ev::TimerWheel;
+using namespace std::chrono_literals;
+
+constexpr std::chrono::microseconds kResolution = 1ms;
+
+struct FiredTimer final {
+    TimerWheel::Clock::time_point expiration;
+    TimerWheel::Clock::time_point now;
+};
+
+class TimerWheelTest : public ::testing::Test {
+protected:
+    struct Timer final {
+        explicit Timer(TimerWheelTest& test) : entry(&OnTimer, this), test(test) {}
+
+        static void OnTimer(TimerWheel::Entry& entry) noexcept {
+            auto& self = *static_cast<Timer*>(entry.data);
+            self.test.fired_.push_back({self.expiration, self.test.now_});
+        }
+
+        TimerWheel::Entry entry;
+        TimerWheelTest& test;
+        TimerWheel::Clock::time_point expiration;
+    };
+
+    void Schedule(Timer& timer, TimerWheel::Clock::duration delay) {
+        timer.expiration = now_ + delay;
+        wheel_.Schedule(timer.entry, timer.expiration);
+    }
+
+    void AdvanceBy(TimerWheel::Clock::duration duration, TimerWheel::Clock::duration step = kResolution) {
+        const auto until = now_ + duration;
+        while (now_ < until) {
+            now_ = std::min(now_ + step, until);
+            wheel_.Advance(now_);
+        }
+    }
+
+    TimerWheel::Clock::time_point now_{TimerWheel::Clock::now()};
+    TimerWheel wheel_{kResolution, now_};
+    std::vector<FiredTimer> fired_;
+};
+
+}  // namespace
+
+TEST_F(TimerWheelTest, FiresInTime) {
+    std::vector<std::unique_ptr<Timer>> timers;
+    for (const auto delay : {0ms, 1ms, 5ms, 63ms, 64ms, 65ms, 1000ms, 4096ms, 70000ms, 300000ms}) {
+        timers.push_back(std::make_unique<Timer>(*this));
+        Schedule(*timers.back(), delay);
+    }
+    EXPECT_EQ(wheel_.GetSize(), timers.size());
+
+    AdvanceBy(400s, 1ms);
+    ASSERT_EQ(fired_.size(), timers.size());
+    EXPECT_TRUE(wheel_.IsEmpty());
+    for (const auto& fired : fired_) {
+        EXPECT_GE(fired.now, fired.expiration);
+        EXPECT_LE(fired.now - fired.expiration, 2 * kResolution);
+    }
+}
+
+TEST_F(TimerWheelTest, CoarseAdvance) {
+    Timer timer{*this};
+    Schedule(timer, 123'456ms);
+
+    AdvanceBy(123s, 100ms);
+    EXPECT_TRUE(fired_.empty());
+
+    AdvanceBy(1s, 100ms);
+    ASSERT_EQ(fired_.size(), 1);
+    EXPECT_GE(fired_[0].now, fired_[0].expiration);
+}
+
+TEST_F(TimerWheelTest, Cancel) {
+    Timer timer{*this};
+    Schedule(timer, 100ms);
+    EXPECT_TRUE(timer.entry.IsScheduled());
+
+    wheel_.Cancel(timer.entry);
+    EXPECT_FALSE(timer.entry.IsScheduled());
+    EXPECT_TRUE(wheel_.IsEmpty());
+    wheel_.Cancel(timer.entry);
+
+    AdvanceBy(200ms);
+    EXPECT_TRUE(fired_.empty());
+}
+
+TEST_F(TimerWheelTest, Reschedule) {
+    Timer timer{*this};
+    Schedule(timer, 10s);
+    Schedule(timer, 10ms);
+    EXPECT_EQ(wheel_.GetSize(), 1);
+
+    AdvanceBy(20ms);
+    ASSERT_EQ(fired_.size(), 1);
+    EXPECT_EQ(fired_[0].expiration - (now_ - 20ms), 10ms);
+}
+
+TEST_F(TimerWheelTest, TooFarTimers) {
+    Timer timer{*this};
+    // Farther than the wheel covers with 1ms resolution
+    Schedule(timer, std::chrono::hours{24 * 20});
+
+    AdvanceBy(std::chrono::hours{24 * 20} - 1s, 1s);
+    EXPECT_TRUE(fired_.empty());
+    EXPECT_FALSE(wheel_.IsEmpty());
+
+    AdvanceBy(2s, 1s);
+    ASSERT_EQ(fired_.size(), 1);
+    EXPECT_GE(fired_[0].now, fired_[0].expiration);
+}
+
+USERVER_NAMESPACE_END
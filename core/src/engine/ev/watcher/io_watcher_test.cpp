@@ -2,6 +2,9 @@
 
 #include <fcntl.h>
 #include <sys/param.h>
+#include <unistd.h>
+
+#include <array>
 
 #include <engine/ev/thread.hpp>
 #include <userver/logging/log.hpp>
@@ -49,4 +52,47 @@ UTEST(IoWatcher, DevNull) {
     EXPECT_EQ(counter, 0);
 }
 
+UTEST(IoWatcher, Backends) {
+    using engine::ev::Backend;
+
+    for (const auto backend :
+         {Backend::kDefault, Backend::kEpoll, Backend::kIoUring, Backend::kLinuxAio, Backend::kPoll, Backend::kSelect}) {
+        engine::ev::Thread thread{"test_thread", backend};
+        engine::ev::ThreadControl thread_control(thread);
+        EXPECT_NE(thread.GetBackend(), Backend::kDefault);
+        LOG_INFO() << "Requested '" << engine::ev::ToString(backend) << "' ev backend, got '"
+                   << engine::ev::ToString(thread.GetBackend()) << "'";
+
+        std::array<int, 2> fds{};
+        ASSERT_EQ(0, pipe(fds.data()));
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::atomic_bool done{false};
+
+        engine::ev::IoWatcher watcher(thread_control);
+        watcher.SetFd(fds[0]);
+        watcher.ReadAsync([&](std::error_code ec) {
+            std::lock_guard<std::mutex> lock(mutex);
+            EXPECT_FALSE(ec);
+
+            char c{};
+            EXPECT_EQ(1, read(fds[0], &c, 1));
+            EXPECT_EQ('x', c);
+            done = true;
+
+            cv.notify_all();
+        });
+        ASSERT_EQ(1, write(fds[1], "x", 1));
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait_for(lock, std::chrono::seconds(5), [&done]() { return done.load(); });
+        }
+
+        EXPECT_TRUE(done) << engine::ev::ToString(backend);
+        close(fds[1]);
+    }
+}
+
 USERVER_NAMESPACE_END
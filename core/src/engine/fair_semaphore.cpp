@@ -0,0 +1,251 @@
+#include <userver/engine/fair_semaphore.hpp>
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <mutex>
+
+#include <fmt/format.h>
+
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+// Inverse of the 8:4:1 task processor lane weights, the virtual time a lane is
+// charged for a lock unit
+constexpr std::array<std::uint64_t, kTaskPrioritiesCount> kLaneUnitCosts{1, 2, 8};
+
+// Upper bounds in microseconds
+constexpr std::array<double, 14> kWaitTimeBoundsUs{
+    5, 10, 25, 50, 100, 250, 500, 1'000, 2'500, 5'000, 10'000, 25'000, 100'000, 1'000'000};
+
+struct Waiter final {
+    explicit Waiter(FairSemaphore::Counter count) noexcept : count(count) {}
+
+    const FairSemaphore::Counter count;
+    const std::size_t lane{static_cast<std::size_t>(current_task::GetPriority())};
+    const std::chrono::steady_clock::time_point enqueued_at{std::chrono::steady_clock::now()};
+    // guarded by Impl::mutex
+    bool is_granted{false};
+    bool is_unreachable{false};
+    SingleConsumerEvent completed{SingleConsumerEvent::NoAutoReset{}};
+};
+
+}  // namespace
+
+class FairSemaphore::Impl final {
+public:
+    // Weighted-fair queueing: the non-empty lane with the least virtual time
+    // is served next, serving a waiter advances the virtual time of its lane by
+    // the cost of the acquired locks.
+    struct Lane final {
+        std::deque<Waiter*> waiters;
+        std::uint64_t virtual_time{0};
+    };
+
+    bool IsQueueEmpty() const noexcept {
+        return std::all_of(lanes.begin(), lanes.end(), [](const Lane& lane) { return lane.waiters.empty(); });
+    }
+
+    void Enqueue(Waiter& waiter) {
+        auto& lane = lanes[waiter.lane];
+        // an idle lane does not accumulate credit
+        if (lane.waiters.empty()) lane.virtual_time = std::max(lane.virtual_time, virtual_clock);
+        lane.waiters.push_back(&waiter);
+    }
+
+    void Remove(Waiter& waiter) noexcept {
+        auto& waiters = lanes[waiter.lane].waiters;
+        const auto it = std::find(waiters.begin(), waiters.end(), &waiter);
+        UASSERT(it != waiters.end());
+        waiters.erase(it);
+    }
+
+    // Grants the locks to the queued waiters while the head waiter fits
+    void Dispatch(FairSemaphore& sem) noexcept {
+        while (true) {
+            Lane* next = nullptr;
+            for (auto& lane : lanes) {
+                if (!lane.waiters.empty() && (!next || lane.virtual_time < next->virtual_time)) next = &lane;
+            }
+            if (!next) return;
+
+            auto& waiter = *next->waiters.front();
+            if (waiter.count > sem.capacity_.load()) {
+                waiter.is_unreachable = true;
+            } else if (sem.TryLockFastPath(waiter.count, /*ignore_waiters=*/true)) {
+                virtual_clock = next->virtual_time;
+                next->virtual_time += waiter.count * kLaneUnitCosts[waiter.lane];
+                waiter.is_granted = true;
+            } else {
+                // the head waits for its locks, the others wait behind it
+                return;
+            }
+
+            next->waiters.pop_front();
+            sem.waiters_.fetch_sub(1);
+            // the waiter may be destroyed right after that
+            waiter.completed.Send();
+        }
+    }
+
+    std::mutex mutex;
+    std::array<Lane, kTaskPrioritiesCount> lanes;
+    std::uint64_t virtual_clock{0};
+
+    std::array<utils::statistics::Histogram, kTaskPrioritiesCount> wait_time_histograms{
+        utils::statistics::Histogram{kWaitTimeBoundsUs},
+        utils::statistics::Histogram{kWaitTimeBoundsUs},
+        utils::statistics::Histogram{kWaitTimeBoundsUs},
+    };
+};
+
+FairSemaphore::FairSemaphore(Counter capacity) : capacity_(capacity), impl_(std::make_unique<Impl>()) {}
+
+FairSemaphore::~FairSemaphore() {
+    UASSERT_MSG(
+        acquired_locks_.load() == 0,
+        fmt::format(
+            "FairSemaphore is destroyed while in use "
+            "(acquired={}, capacity={})",
+            acquired_locks_.load(),
+            capacity_.load()
+        )
+    );
+}
+
+void FairSemaphore::SetCapacity(Counter capacity) {
+    capacity_.store(capacity);
+
+    if (waiters_.load() != 0) {
+        const std::lock_guard lock{impl_->mutex};
+        impl_->Dispatch(*this);
+    }
+}
+
+FairSemaphore::Counter FairSemaphore::GetCapacity() const noexcept { return capacity_.load(); }
+
+std::size_t FairSemaphore::RemainingApprox() const {
+    const auto acquired = acquired_locks_.load(std::memory_order_relaxed);
+    const auto capacity = capacity_.load(std::memory_order_relaxed);
+    return capacity >= acquired ? capacity - acquired : 0;
+}
+
+std::size_t FairSemaphore::UsedApprox() const { return acquired_locks_.load(std::memory_order_relaxed); }
+
+std::size_t FairSemaphore::WaitersApprox() const { return waiters_.load(std::memory_order_relaxed); }
+
+void FairSemaphore::lock_shared() { lock_shared_count(1); }
+
+void FairSemaphore::lock_shared_count(const Counter count) {
+    const bool success = try_lock_shared_until_count(Deadline{}, count);
+    if (!success) {
+        if (engine::current_task::ShouldCancel()) {
+            throw SemaphoreLockCancelledError("Semaphore lock is stopped by task cancellation");
+        } else {
+            throw UnreachableSemaphoreLockError(fmt::format(
+                "The amount of locks requested is greater than FairSemaphore "
+                "capacity: count={}, capacity={}",
+                count,
+                capacity_.load()
+            ));
+        }
+    }
+}
+
+void FairSemaphore::unlock_shared() { unlock_shared_count(1); }
+
+void FairSemaphore::unlock_shared_count(const Counter count) {
+    UASSERT(count > 0);
+
+    [[maybe_unused]] const auto old_acquired_locks = acquired_locks_.fetch_sub(count);
+    UASSERT_MSG(
+        old_acquired_locks >= count,
+        fmt::format(
+            "Trying to release more locks than have been "
+            "acquired: count={}, acquired={}",
+            count,
+            old_acquired_locks
+        )
+    );
+
+    // Either a new waiter sees the released locks in LockSlowPath, or we see
+    // the waiter here, both sides use sequentially consistent operations.
+    if (waiters_.load() != 0) {
+        const std::lock_guard lock{impl_->mutex};
+        impl_->Dispatch(*this);
+    }
+}
+
+bool FairSemaphore::try_lock_shared() { return try_lock_shared_count(1); }
+
+bool FairSemaphore::try_lock_shared_count(const Counter count) {
+    UASSERT(count > 0);
+    return TryLockFastPath(count, /*ignore_waiters=*/false);
+}
+
+bool FairSemaphore::try_lock_shared_until(Deadline deadline) { return try_lock_shared_until_count(deadline, 1); }
+
+bool FairSemaphore::try_lock_shared_until_count(Deadline deadline, const Counter count) {
+    UASSERT(count > 0);
+    if (count > capacity_.load()) return false;
+    if (TryLockFastPath(count, /*ignore_waiters=*/false)) return true;
+    return LockSlowPath(deadline, count);
+}
+
+const utils::statistics::Histogram& FairSemaphore::GetWaitTimeHistogram(TaskPriority priority) const {
+    return impl_->wait_time_histograms[static_cast<std::size_t>(priority)];
+}
+
+bool FairSemaphore::TryLockFastPath(const Counter count, bool ignore_waiters) noexcept {
+    if (!ignore_waiters && waiters_.load() != 0) return false;
+
+    const auto capacity = capacity_.load();
+    auto expected = acquired_locks_.load();
+    while (expected <= capacity && count <= capacity - expected) {
+        if (acquired_locks_.compare_exchange_weak(expected, expected + count)) return true;
+    }
+    return false;
+}
+
+bool FairSemaphore::LockSlowPath(Deadline deadline, const Counter count) {
+    Waiter waiter{count};
+    {
+        const std::lock_guard lock{impl_->mutex};
+        waiters_.fetch_add(1);
+        if (impl_->IsQueueEmpty() && TryLockFastPath(count, /*ignore_waiters=*/true)) {
+            waiters_.fetch_sub(1);
+            return true;
+        }
+        impl_->Enqueue(waiter);
+    }
+
+    if (!waiter.completed.WaitForEventUntil(deadline)) {
+        const std::lock_guard lock{impl_->mutex};
+        if (!waiter.is_granted && !waiter.is_unreachable) {
+            impl_->Remove(waiter);
+            waiters_.fetch_sub(1);
+            // the waiter might have blocked the others
+            impl_->Dispatch(*this);
+            return false;
+        }
+    }
+
+    if (waiter.is_unreachable) return false;
+
+    const auto wait_time = std::chrono::steady_clock::now() - waiter.enqueued_at;
+    impl_->wait_time_histograms[waiter.lane].Account(
+        std::chrono::duration_cast<std::chrono::microseconds>(wait_time).count()
+    );
+    return true;
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,145 @@
+#include <userver/engine/fair_semaphore.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/histogram_view.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+void WaitForWaiters(const engine::FairSemaphore& sem, std::size_t count) {
+    while (sem.WaitersApprox() != count) engine::Yield();
+}
+
+}  // namespace
+
+UTEST(FairSemaphore, Sample) {
+    /// [Sample engine::FairSemaphore usage]
+    constexpr auto kMaxSimultaneousRequests = 10;
+    engine::FairSemaphore sem{kMaxSimultaneousRequests};
+
+    auto request = engine::AsyncNoSpan([&sem] {
+        // The waiters of latency-critical tasks are served first
+        const engine::TaskPriorityScope priority_scope{engine::TaskPriority::kLatencyCritical};
+        const std::shared_lock lock{sem};
+        // ... make a request to the dependency
+    });
+    request.Get();
+    /// [Sample engine::FairSemaphore usage]
+}
+
+UTEST(FairSemaphore, LargeLockIsNotStarved) {
+    engine::FairSemaphore sem{4};
+    std::vector<int> order;
+
+    std::shared_lock lock{sem};
+    auto large = engine::AsyncNoSpan([&] {
+        sem.lock_shared_count(4);
+        order.push_back(4);
+        sem.unlock_shared_count(4);
+    });
+    WaitForWaiters(sem, 1);
+
+    // there are free locks, but the small requests must not overtake
+    EXPECT_FALSE(sem.try_lock_shared());
+    std::vector<engine::TaskWithResult<void>> small;
+    for (int i = 0; i < 5; ++i) {
+        small.push_back(engine::AsyncNoSpan([&] {
+            const std::shared_lock small_lock{sem};
+            order.push_back(1);
+        }));
+    }
+    WaitForWaiters(sem, 6);
+
+    lock.unlock();
+    large.Get();
+    engine::WaitAllChecked(small);
+
+    ASSERT_EQ(order.size(), 6);
+    EXPECT_EQ(order.front(), 4);
+    EXPECT_EQ(sem.UsedApprox(), 0);
+    EXPECT_EQ(sem.GetWaitTimeHistogram(engine::TaskPriority::kNormal).GetView().GetTotalCount(), 6);
+}
+
+UTEST(FairSemaphore, PrioritiesAreWeighted) {
+    constexpr std::size_t kTasksPerPriority = 20;
+    engine::FairSemaphore sem{1};
+    std::vector<engine::TaskPriority> order;
+    std::vector<engine::TaskWithResult<void>> tasks;
+
+    std::shared_lock lock{sem};
+    // background waiters are queued first, but the priorities are weighted
+    for (const auto priority : {engine::TaskPriority::kBackground, engine::TaskPriority::kLatencyCritical}) {
+        const engine::TaskPriorityScope priority_scope{priority};
+        for (std::size_t i = 0; i < kTasksPerPriority; ++i) {
+            tasks.push_back(engine::AsyncNoSpan([&sem, &order, priority] {
+                const std::shared_lock task_lock{sem};
+                order.push_back(priority);
+            }));
+        }
+        WaitForWaiters(sem, tasks.size());
+    }
+
+    lock.unlock();
+    engine::WaitAllChecked(tasks);
+
+    ASSERT_EQ(order.size(), kTasksPerPriority * 2);
+    const auto last_critical = std::find(order.rbegin(), order.rend(), engine::TaskPriority::kLatencyCritical);
+    const auto last_background = std::find(order.rbegin(), order.rend(), engine::TaskPriority::kBackground);
+    EXPECT_LT(last_background, last_critical) << "Latency-critical waiters should be served before the background ones";
+    // the background waiters still make progress
+    const auto first_half_end = order.begin() + kTasksPerPriority;
+    EXPECT_NE(std::find(order.begin(), first_half_end, engine::TaskPriority::kBackground), first_half_end);
+}
+
+UTEST(FairSemaphore, TimeoutUnblocksOthers) {
+    engine::FairSemaphore sem{2};
+    std::shared_lock lock{sem};
+
+    auto large = engine::AsyncNoSpan([&sem] {
+        return sem.try_lock_shared_until_count(engine::Deadline::FromDuration(50ms), 2);
+    });
+    WaitForWaiters(sem, 1);
+    auto small = engine::AsyncNoSpan([&sem] { const std::shared_lock small_lock{sem}; });
+
+    EXPECT_FALSE(large.Get());
+    UEXPECT_NO_THROW(small.Get());
+    EXPECT_EQ(sem.WaitersApprox(), 0);
+}
+
+UTEST(FairSemaphore, LockAndCancel) {
+    engine::FairSemaphore sem{1};
+    std::shared_lock lock{sem};
+    auto task = engine::AsyncNoSpan([&sem] { const std::shared_lock task_lock{sem}; });
+    WaitForWaiters(sem, 1);
+
+    task.RequestCancel();
+    UEXPECT_THROW(task.Get(), engine::SemaphoreLockCancelledError);
+    EXPECT_EQ(sem.WaitersApprox(), 0);
+}
+
+UTEST(FairSemaphore, SetCapacity) {
+    engine::FairSemaphore sem{2};
+    std::shared_lock lock{sem};
+    auto unreachable = engine::AsyncNoSpan([&sem] { sem.lock_shared_count(2); });
+    WaitForWaiters(sem, 1);
+
+    sem.SetCapacity(1);
+    UEXPECT_THROW(unreachable.Get(), engine::UnreachableSemaphoreLockError);
+
+    auto waiter = engine::AsyncNoSpan([&sem] { const std::shared_lock task_lock{sem}; });
+    WaitForWaiters(sem, 1);
+    sem.SetCapacity(2);
+    UEXPECT_NO_THROW(waiter.Get());
+}
+
+USERVER_NAMESPACE_END
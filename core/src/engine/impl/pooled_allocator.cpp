@@ -0,0 +1,75 @@
+#include <userver/engine/impl/pooled_allocator.hpp>
+
+#include <array>
+
+#include <userver/compiler/impl/lsan.hpp>
+#include <userver/compiler/thread_local.hpp>
+#include <userver/utils/assert.hpp>
+#include <utils/impl/thread_local_mem_pool.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+namespace {
+
+// Blocks up to 1KiB are cached, which covers the future states and the task
+// contexts with typical payloads
+constexpr std::size_t kSizeClassStep = 64;
+constexpr std::size_t kSizeClassCount = 16;
+constexpr std::size_t kMaxCachedBlocksPerClass = 16;
+
+// Reused blocks would hide use-after-free from the AddressSanitizer
+constexpr bool kIsCacheEnabled = !USERVER_IMPL_HAS_LSAN;
+
+struct BlockDeleter final {
+    void operator()(std::byte* block) const noexcept { ::operator delete(block); }
+};
+
+using Block = std::unique_ptr<std::byte, BlockDeleter>;
+using BlockCache = std::array<utils::impl::StaticVector<Block, kMaxCachedBlocksPerClass>, kSizeClassCount>;
+
+compiler::ThreadLocal local_block_cache = [] { return BlockCache{}; };
+
+constexpr std::size_t GetSizeClass(std::size_t size) noexcept { return (size - 1) / kSizeClassStep; }
+
+}  // namespace
+
+void* AllocatePooled(std::size_t size) {
+    UASSERT(size != 0);
+    const auto size_class = GetSizeClass(size);
+    if (!kIsCacheEnabled || size_class >= kSizeClassCount) return ::operator new(size);
+
+    {
+        auto cache = local_block_cache.Use();
+        auto& blocks = (*cache)[size_class];
+        if (!blocks.IsEmpty()) {
+            auto* const block = blocks.GetBack().release();
+            blocks.PopBack();
+            return block;
+        }
+    }
+
+    // All the blocks of a class have the same size to be interchangeable
+    return ::operator new((size_class + 1) * kSizeClassStep);
+}
+
+void DeallocatePooled(void* block, std::size_t size) noexcept {
+    UASSERT(block);
+    UASSERT(size != 0);
+    const auto size_class = GetSizeClass(size);
+    if (kIsCacheEnabled && size_class < kSizeClassCount) {
+        auto cache = local_block_cache.Use();
+        auto& blocks = (*cache)[size_class];
+        if (!blocks.IsFull()) {
+            blocks.PushBack(Block{static_cast<std::byte*>(block)});
+            return;
+        }
+    }
+
+    ::operator delete(block);
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
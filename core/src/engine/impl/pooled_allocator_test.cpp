@@ -0,0 +1,34 @@
+#include <userver/engine/impl/pooled_allocator.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <userver/engine/async.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(PooledAllocator, Alignment) {
+    for (std::size_t size : {1, 8, 63, 64, 65, 500, 1024, 1025, 4096}) {
+        void* const block = engine::impl::AllocatePooled(size);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(block) % __STDCPP_DEFAULT_NEW_ALIGNMENT__, 0) << size;
+        engine::impl::DeallocatePooled(block, size);
+    }
+}
+
+TEST(PooledAllocator, SharedPtr) {
+    const auto value = std::allocate_shared<std::string>(
+        engine::impl::PooledAllocator<std::string>{}, "a string that does not fit into SSO buffer"
+    );
+    EXPECT_EQ(*value, "a string that does not fit into SSO buffer");
+}
+
+UTEST_MT(PooledAllocator, DeallocateOnAnotherThread, 2) {
+    for (int i = 0; i < 100; ++i) {
+        auto value = std::allocate_shared<int>(engine::impl::PooledAllocator<int>{}, i);
+        engine::AsyncNoSpan([value = std::move(value), i] { EXPECT_EQ(*value, i); }).Get();
+    }
+}
+
+USERVER_NAMESPACE_END
@@ -8,6 +8,8 @@
 #include <engine/task/task_processor_config.hpp>
 #include <engine/task/task_processor_pools.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/task/current_task.hpp>
+#include <userver/utils/assert.hpp>
 
 #include <userver/tracing/span.hpp>
 
@@ -15,7 +17,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
-std::shared_ptr<TaskProcessorPools> MakeTaskProcessorPools(const TaskProcessorPoolsConfig& pools_config) {
+std::shared_ptr<TaskProcessorPools>
+MakeTaskProcessorPools(const TaskProcessorPoolsConfig& pools_config, ev::Backend ev_backend) {
     coro::PoolConfig coro_config;
     coro_config.initial_size = pools_config.initial_coro_pool_size;
     coro_config.max_size = pools_config.max_coro_pool_size;
@@ -25,6 +28,7 @@ std::shared_ptr<TaskProcessorPools> MakeTaskProcessorPools(const TaskProcessorPo
     ev_config.threads = pools_config.ev_threads_num;
     ev_config.thread_name = pools_config.ev_thread_name;
     ev_config.ev_default_loop_disabled = pools_config.ev_default_loop_disabled;
+    ev_config.backend = ev_backend;
 
     return std::make_shared<TaskProcessorPools>(std::move(coro_config), std::move(ev_config));
 }
@@ -54,6 +58,23 @@ void RunOnTaskProcessorSync(TaskProcessor& tp, utils::function_ref<void()> user_
     future.get();
 }
 
+void RunStandalone(
+    std::size_t worker_threads,
+    const TaskProcessorPoolsConfig& config,
+    ev::Backend ev_backend,
+    utils::function_ref<void()> payload
+) {
+    UINVARIANT(
+        !engine::current_task::IsTaskProcessorThread(), "RunStandalone must not be used alongside a running engine"
+    );
+    UINVARIANT(worker_threads != 0, "Unable to run anything using 0 threads");
+
+    auto task_processor_holder =
+        TaskProcessorHolder::Make(worker_threads, "coro-runner", MakeTaskProcessorPools(config, ev_backend));
+
+    RunOnTaskProcessorSync(*task_processor_holder, std::move(payload));
+}
+
 }  // namespace engine::impl
 
 USERVER_NAMESPACE_END
@@ -18,13 +18,18 @@
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/utils/not_null.hpp>
 
+#include <engine/ev/backend.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
 class TaskProcessorPools;
 
-std::shared_ptr<TaskProcessorPools> MakeTaskProcessorPools(const TaskProcessorPoolsConfig& pools_config);
+std::shared_ptr<TaskProcessorPools> MakeTaskProcessorPools(
+    const TaskProcessorPoolsConfig& pools_config,
+    ev::Backend ev_backend = ev::Backend::kDefault
+);
 
 class TaskProcessorHolder final {
 public:
@@ -47,6 +52,15 @@ private:
 // Spawns a single task to run the callback, blocks the current thread to wait until it finishes.
 void RunOnTaskProcessorSync(TaskProcessor& tp, utils::function_ref<void()> user_cb);
 
+// Same as engine::RunStandalone, but allows to choose the backend of ev loops.
+// Mainly designated for benchmarking the ev backends against each other.
+void RunStandalone(
+    std::size_t worker_threads,
+    const TaskProcessorPoolsConfig& config,
+    ev::Backend ev_backend,
+    utils::function_ref<void()> payload
+);
+
 }  // namespace engine::impl
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,139 @@
+#include <engine/impl/task_accounting.hpp>
+
+#include <time.h>
+
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include <engine/task/task_context.hpp>
+#include <tracing/span_impl.hpp>
+#include <userver/compiler/thread_local.hpp>
+#include <userver/utils/statistics/rate.hpp>
+#include <utils/jemalloc.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+namespace {
+
+// Span names are defined by the code and are not expected to be numerous,
+// the limit protects the metrics from the names built from the request data
+constexpr std::size_t kMaxNames = 1000;
+constexpr std::string_view kNoSpanName = "[no span]";
+constexpr std::string_view kOtherName = "[other]";
+
+class Registry final {
+public:
+    TaskAccountingCounters& Get(std::string_view name) {
+        std::string key{name};
+        {
+            const std::shared_lock lock{mutex_};
+            if (const auto it = counters_.find(key); it != counters_.end()) return *it->second;
+        }
+
+        const std::unique_lock lock{mutex_};
+        if (counters_.size() >= kMaxNames && counters_.count(key) == 0) {
+            key = kOtherName;
+        }
+        auto& counters = counters_[key];
+        if (!counters) counters = std::make_unique<TaskAccountingCounters>(key);
+        return *counters;
+    }
+
+    template <typename Func>
+    void ForEach(Func func) const {
+        const std::shared_lock lock{mutex_};
+        for (const auto& [name, counters] : counters_) {
+            func(*counters);
+        }
+    }
+
+private:
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string, std::unique_ptr<TaskAccountingCounters>> counters_;
+};
+
+Registry& GetRegistry() {
+    static Registry registry;
+    return registry;
+}
+
+compiler::ThreadLocal local_allocated_bytes_counter = [] { return utils::jemalloc::GetThreadAllocatedBytesCounter(); };
+
+std::uint64_t GetThreadCpuTimeNs() noexcept {
+    ::timespec ts{};
+    ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<std::uint64_t>(ts.tv_sec) * 1'000'000'000 + ts.tv_nsec;
+}
+
+std::uint64_t GetThreadAllocatedBytes() noexcept {
+    auto counter = local_allocated_bytes_counter.Use();
+    return *counter ? **counter : 0;
+}
+
+std::uint64_t Delta(std::uint64_t start, std::uint64_t finish) noexcept { return finish > start ? finish - start : 0; }
+
+}  // namespace
+
+void StartAccountingSlice(TaskAccountingSlice& slice) noexcept {
+    slice.cpu_time_ns = GetThreadCpuTimeNs();
+    slice.allocated_bytes = GetThreadAllocatedBytes();
+    slice.is_active = true;
+}
+
+void StopAccountingSlice(TaskAccountingSlice& slice, std::string_view span_name) noexcept {
+    if (!slice.is_active) return;
+    slice.is_active = false;
+
+    const auto cpu_time_ns = Delta(slice.cpu_time_ns, GetThreadCpuTimeNs());
+    const auto allocated_bytes = Delta(slice.allocated_bytes, GetThreadAllocatedBytes());
+
+    try {
+        if (!span_name.empty()) {
+            if (!slice.counters || slice.counters->name != span_name) {
+                slice.counters = &GetRegistry().Get(span_name);
+            }
+        } else if (!slice.counters) {
+            slice.counters = &GetRegistry().Get(kNoSpanName);
+        }
+    } catch (const std::exception&) {
+        // Out of memory, the slice is not accounted
+        return;
+    }
+
+    slice.counters->cpu_time_ns.fetch_add(cpu_time_ns, std::memory_order_relaxed);
+    slice.counters->allocated_bytes.fetch_add(allocated_bytes, std::memory_order_relaxed);
+    slice.counters->execution_slices.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool IsCurrentTaskAccounted() noexcept {
+    const auto* const context = current_task::GetCurrentTaskContextUnchecked();
+    return context && context->IsAccounted();
+}
+
+void OnOutermostSpanFinished(std::string_view span_name) noexcept {
+    auto* const context = current_task::GetCurrentTaskContextUnchecked();
+    if (context) context->AccountingCheckpoint(span_name);
+}
+
+void DumpTaskAccounting(utils::statistics::Writer& writer) {
+    GetRegistry().ForEach([&writer](const TaskAccountingCounters& counters) {
+        const utils::statistics::LabelView label{"span", counters.name};
+        writer["cpu-time-us"].ValueWithLabels(
+            utils::statistics::Rate{counters.cpu_time_ns.load(std::memory_order_relaxed) / 1000}, label
+        );
+        writer["allocated-bytes"].ValueWithLabels(
+            utils::statistics::Rate{counters.allocated_bytes.load(std::memory_order_relaxed)}, label
+        );
+        writer["execution-slices"].ValueWithLabels(
+            utils::statistics::Rate{counters.execution_slices.load(std::memory_order_relaxed)}, label
+        );
+    });
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
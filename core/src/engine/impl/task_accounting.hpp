@@ -0,0 +1,50 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+/// Resources consumed by the tasks, grouped by the name of the outermost
+/// tracing::Span of the task. The counters are never destroyed.
+struct TaskAccountingCounters final {
+    explicit TaskAccountingCounters(std::string name) : name(std::move(name)) {}
+
+    const std::string name;
+    std::atomic<std::uint64_t> cpu_time_ns{0};
+    std::atomic<std::uint64_t> allocated_bytes{0};
+    std::atomic<std::uint64_t> execution_slices{0};
+};
+
+/// Thread resources usage at the start of an execution slice of a task
+struct TaskAccountingSlice final {
+    std::uint64_t cpu_time_ns{0};
+    std::uint64_t allocated_bytes{0};
+    // The counters that were charged last, used when the task has no Span
+    TaskAccountingCounters* counters{nullptr};
+    bool is_active{false};
+};
+
+void StartAccountingSlice(TaskAccountingSlice& slice) noexcept;
+
+/// Charges the resources used by the current thread since the slice start to
+/// `span_name`, or to the previously charged counters if the name is empty
+void StopAccountingSlice(TaskAccountingSlice& slice, std::string_view span_name) noexcept;
+
+bool IsCurrentTaskAccounted() noexcept;
+
+/// Called by tracing::Span when the outermost Span of the current task
+/// finishes, so that the short tasks are attributed to their Spans
+void OnOutermostSpanFinished(std::string_view span_name) noexcept;
+
+void DumpTaskAccounting(utils::statistics::Writer& writer);
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
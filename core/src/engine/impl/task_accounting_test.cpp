@@ -0,0 +1,107 @@
+#include <engine/impl/task_accounting.hpp>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+void BurnCpu(std::chrono::milliseconds duration) {
+    const auto deadline = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < deadline) {
+    }
+}
+
+void EnableTaskAccounting(bool enable) {
+    engine::TaskProcessorSettings settings;
+    settings.task_accounting = enable;
+    engine::current_task::GetTaskProcessor().SetSettings(settings);
+}
+
+class TaskAccountingMetrics final {
+public:
+    TaskAccountingMetrics()
+        : holder_(storage_.RegisterWriter("task-accounting", [](utils::statistics::Writer& writer) {
+              engine::impl::DumpTaskAccounting(writer);
+          })) {}
+
+    ~TaskAccountingMetrics() { holder_.Unregister(); }
+
+    std::optional<utils::statistics::Rate> Get(const std::string& metric, const std::string& span_name) const {
+        const utils::statistics::Snapshot snapshot{storage_, "task-accounting"};
+        const auto value = snapshot.SingleMetricOptional(metric, {{"span", span_name}});
+        if (!value) return std::nullopt;
+        return value->AsRate();
+    }
+
+private:
+    utils::statistics::Storage storage_;
+    utils::statistics::Entry holder_;
+};
+
+}  // namespace
+
+UTEST(TaskAccounting, CpuTimeOfShortTask) {
+    EnableTaskAccounting(true);
+    const TaskAccountingMetrics metrics;
+    const std::string span_name = "task_accounting_short_task";
+
+    // The whole Span fits into a single execution slice
+    engine::AsyncNoSpan([&span_name] {
+        const tracing::Span span{span_name};
+        BurnCpu(std::chrono::milliseconds{20});
+    }).Get();
+
+    const auto cpu_time = metrics.Get("cpu-time-us", span_name);
+    ASSERT_TRUE(cpu_time);
+    EXPECT_GE(cpu_time->value, 10'000);
+    EXPECT_LE(cpu_time->value, 1'000'000);
+}
+
+UTEST(TaskAccounting, CpuTimeAcrossContextSwitches) {
+    EnableTaskAccounting(true);
+    const TaskAccountingMetrics metrics;
+    const std::string span_name = "task_accounting_switching_task";
+
+    engine::AsyncNoSpan([&span_name] {
+        const tracing::Span span{span_name};
+        for (int i = 0; i < 5; ++i) {
+            BurnCpu(std::chrono::milliseconds{5});
+            engine::Yield();
+        }
+    }).Get();
+
+    const auto cpu_time = metrics.Get("cpu-time-us", span_name);
+    ASSERT_TRUE(cpu_time);
+    EXPECT_GE(cpu_time->value, 20'000);
+
+    const auto slices = metrics.Get("execution-slices", span_name);
+    ASSERT_TRUE(slices);
+    EXPECT_GE(slices->value, 5);
+}
+
+UTEST(TaskAccounting, Disabled) {
+    EnableTaskAccounting(false);
+    const TaskAccountingMetrics metrics;
+    const std::string span_name = "task_accounting_disabled";
+
+    engine::AsyncNoSpan([&span_name] {
+        const tracing::Span span{span_name};
+        BurnCpu(std::chrono::milliseconds{1});
+    }).Get();
+
+    EXPECT_FALSE(metrics.Get("cpu-time-us", span_name));
+}
+
+USERVER_NAMESPACE_END
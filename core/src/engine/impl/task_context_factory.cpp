@@ -1,6 +1,7 @@
 #include <userver/engine/impl/task_context_factory.hpp>
 
 #include <engine/task/task_context.hpp>
+#include <userver/engine/impl/pooled_allocator.hpp>
 #include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -13,17 +14,27 @@ static_assert(kTaskContextAlignment >= alignof(TaskContext));
 static_assert(sizeof(TaskContext) % kTaskContextAlignment == 0);
 
 TaskContext& PlacementNewTaskContext(std::byte* storage, TaskConfig config, utils::impl::WrappedCallBase& payload) {
-    return *new (storage)
-        TaskContext{config.task_processor, config.importance, config.wait_mode, config.deadline, payload};
+    return *new (storage) TaskContext{
+        config.task_processor, config.importance, config.wait_mode, config.deadline, payload, config.is_stackless};
 }
 
+// The block size is stored in front of the TaskContext, so that
+// DeleteFusedTaskContext could return the block to the right size class
+constexpr std::size_t kBlockSizePrefix = kTaskContextAlignment;
+static_assert(kBlockSizePrefix >= sizeof(std::size_t));
+static_assert(__STDCPP_DEFAULT_NEW_ALIGNMENT__ >= kTaskContextAlignment);
+
 std::byte* AllocateFusedTaskContext(std::size_t total_size) {
-    return static_cast<std::byte*>(::operator new[](total_size, std::align_val_t{kTaskContextAlignment}));
+    const auto block_size = kBlockSizePrefix + total_size;
+    auto* const block = static_cast<std::byte*>(AllocatePooled(block_size));
+    new (block) std::size_t{block_size};
+    return block + kBlockSizePrefix;
 }
 
 void DeleteFusedTaskContext(std::byte* storage) noexcept {
     UASSERT(storage);
-    ::operator delete[](storage, std::align_val_t{kTaskContextAlignment});
+    std::byte* const block = storage - kBlockSizePrefix;
+    DeallocatePooled(block, *std::launder(reinterpret_cast<std::size_t*>(block)));
 }
 
 }  // namespace engine::impl
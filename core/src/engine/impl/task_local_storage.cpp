@@ -1,10 +1,11 @@
 #include <userver/engine/impl/task_local_storage.hpp>
 
+#include <utility>
+
 #include <fmt/format.h>
-#include <boost/intrusive/list.hpp>
 #include <boost/intrusive/list_hook.hpp>
 #include <boost/intrusive/slist.hpp>
-#include <boost/range/adaptor/reversed.hpp>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
 
 #include <engine/task/task_context.hpp>
 #include <userver/compiler/demangle.hpp>
@@ -47,10 +48,49 @@ using NormalDataList = boost::intrusive::slist<
     boost::intrusive::linear<true>,
     boost::intrusive::cache_last<false>>;
 
-using InheritedDataList = boost::intrusive::list<
-    DataPtr,
-    boost::intrusive::member_hook<DataPtr, ListHook, &DataPtr::list_hook>,
-    boost::intrusive::constant_time_size<false>>;
+// An immutable snapshot of the inherited variables shared by a task and its
+// children. A storage copies it before modifying, if the snapshot is shared,
+// so spawning a child task costs a single increment of the reference counter.
+class InheritedData final {
+public:
+    InheritedData() : nodes_(std::make_unique<InheritedDataBase*[]>(variable_count)) {}
+
+    InheritedData(const InheritedData& other) : InheritedData() {
+        for (Key key = 0; key < variable_count; ++key) {
+            auto* const node = other.nodes_[key];
+            if (!node) continue;
+            node->AddRef();
+            nodes_[key] = node;
+        }
+    }
+
+    InheritedData& operator=(const InheritedData&) = delete;
+
+    ~InheritedData() {
+        for (Key key = 0; key < variable_count; ++key) {
+            if (nodes_[key]) nodes_[key]->DeleteSelf();
+        }
+    }
+
+    InheritedDataBase*& operator[](Key key) noexcept {
+        UASSERT(key < variable_count);
+        return nodes_[key];
+    }
+
+    bool IsShared() const noexcept { return ref_counter_.load(std::memory_order_acquire) != 1; }
+
+    friend void intrusive_ptr_add_ref(InheritedData* data) noexcept {
+        data->ref_counter_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    friend void intrusive_ptr_release(InheritedData* data) noexcept {
+        if (data->ref_counter_.fetch_sub(1, std::memory_order_acq_rel) == 1) delete data;
+    }
+
+private:
+    std::atomic<std::size_t> ref_counter_{0};
+    const std::unique_ptr<InheritedDataBase*[]> nodes_;
+};
 
 }  // namespace
 
@@ -71,9 +111,10 @@ void ReportVariableNotSet(const std::type_info& type) {
 struct Storage::Impl final {
     std::unique_ptr<DataPtr[]> data;
     NormalDataList normal_data_storage;
-    InheritedDataList inherited_data_storage;
+    boost::intrusive_ptr<InheritedData> inherited_data;
 
     void DoSetGeneric(Key key, DataBase& node);
+    InheritedData& GetMutableInheritedData();
 };
 
 Storage::Storage() { utils::impl::AssertStaticRegistrationFinished(); }
@@ -91,67 +132,46 @@ Storage::~Storage() {
         impl_->normal_data_storage.pop_front_and_dispose(disposer);
     }
 
-    while (!impl_->inherited_data_storage.empty()) {
-        impl_->inherited_data_storage.pop_front_and_dispose(disposer);
-    }
+    impl_->inherited_data.reset();
 }
 
 void Storage::InheritFrom(Storage& other) {
     UASSERT(impl_->normal_data_storage.empty());
-    UASSERT(impl_->inherited_data_storage.empty());
+    UASSERT(!impl_->inherited_data);
 
-    if (!other.impl_->inherited_data_storage.empty() && !impl_->data) {
-        impl_->data = std::make_unique<DataPtr[]>(variable_count);
-    }
-
-    for (DataPtr& their_ptr : other.impl_->inherited_data_storage | boost::adaptors::reversed) {
-        UASSERT(their_ptr.ptr);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
-        auto& node = static_cast<InheritedDataBase&>(*their_ptr.ptr);
-
-        InheritNode(node);
-    }
+    impl_->inherited_data = other.impl_->inherited_data;
 }
 
 void Storage::InheritNodeIfExists(Storage& other, Key key) {
     UASSERT(key < variable_count);
 
     // we want to stop asap if there is nothing to copy
-    if (!other.impl_->data) {
+    if (!other.impl_->inherited_data) {
         return;
     }
-    auto& their_ptr = other.impl_->data[key];
-    if (!their_ptr.ptr) {
+    auto* const node = (*other.impl_->inherited_data)[key];
+    if (!node) {
         return;
     }
 
-    if (!impl_->data) {
-        impl_->data = std::make_unique<DataPtr[]>(variable_count);
-    }
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
-    auto& node = static_cast<InheritedDataBase&>(*their_ptr.ptr);
-
-    InheritNode(node);
-}
-
-void Storage::InheritNode(InheritedDataBase& node) {
-    UASSERT(node.GetKey() < variable_count);
-
-    auto& our_ptr = impl_->data[node.GetKey()];
-    UASSERT(!our_ptr.ptr);
-    our_ptr.ptr = &node;
-    impl_->inherited_data_storage.push_front(our_ptr);
-    node.AddRef();
+    auto& our_node = impl_->GetMutableInheritedData()[key];
+    UASSERT(!our_node);
+    node->AddRef();
+    our_node = node;
 }
 
 void Storage::InitializeFrom(Storage&& other) noexcept {
     UASSERT(impl_->normal_data_storage.empty());
-    UASSERT(impl_->inherited_data_storage.empty());
+    UASSERT(!impl_->inherited_data);
     impl_ = std::move(other.impl_);
 }
 
-DataBase* Storage::GetGeneric(Key key) noexcept {
+DataBase* Storage::GetGeneric(Key key, VariableKind kind) noexcept {
     UASSERT(key < variable_count);
+    if (kind == VariableKind::kInherited) {
+        if (!impl_->inherited_data) return nullptr;
+        return (*impl_->inherited_data)[key];
+    }
     if (!impl_->data) return nullptr;
     return impl_->data[key].ptr;
 }
@@ -162,6 +182,17 @@ void Storage::Impl::DoSetGeneric(Key key, DataBase& node) {
     data[key].ptr = &node;
 }
 
+InheritedData& Storage::Impl::GetMutableInheritedData() {
+    if (!inherited_data) {
+        inherited_data = new InheritedData();
+    } else if (inherited_data->IsShared()) {
+        // the copy holds its own references to the nodes, the replaced or
+        // erased node is released by the caller
+        inherited_data = new InheritedData(*inherited_data);
+    }
+    return *inherited_data;
+}
+
 void Storage::SetGeneric(Key key, NormalDataBase& node, bool has_existing_variable) {
     impl_->DoSetGeneric(key, node);
     if (!has_existing_variable) {
@@ -170,22 +201,17 @@ void Storage::SetGeneric(Key key, NormalDataBase& node, bool has_existing_variab
 }
 
 void Storage::SetGeneric(Key key, InheritedDataBase& node, bool has_existing_variable) {
-    impl_->DoSetGeneric(key, node);
-    if (!has_existing_variable) {
-        impl_->inherited_data_storage.push_front(impl_->data[key]);
-    }
+    auto& our_node = impl_->GetMutableInheritedData()[key];
+    UASSERT(has_existing_variable == (our_node != nullptr));
+    our_node = &node;
 }
 
-void Storage::EraseInherited(Key key) noexcept {
+void Storage::EraseInherited(Key key) {
     UASSERT(key < variable_count);
-    if (!impl_->data) return;
-
-    auto& data_ptr = impl_->data[key];
-    auto* const data = data_ptr.ptr;
-    if (!data) return;
+    if (!GetGeneric(key, VariableKind::kInherited)) return;
 
-    data_ptr.ptr = nullptr;
-    impl_->inherited_data_storage.erase(InheritedDataList::s_iterator_to(data_ptr));
+    auto& our_node = impl_->GetMutableInheritedData()[key];
+    auto* const data = std::exchange(our_node, nullptr);
     data->DeleteSelf();
 }
 
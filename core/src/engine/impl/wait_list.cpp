@@ -66,6 +66,8 @@ void WaitList::WakeupOne(Lock& lock) {
 
 void WaitList::WakeupAll(Lock& lock) {
     UASSERT(lock);
+    // Push all the woken up waiters into the task queue at once
+    const ScheduleBatchScope schedule_batch;
     while (!waiting_contexts_->empty()) {
         boost::intrusive_ptr<impl::TaskContext> context(&waiting_contexts_->front(), kAdopt);
         context->wait_list_hook.unlink();
@@ -4,8 +4,12 @@
 #include <thread>
 
 #include <userver/engine/async.hpp>
+#include <userver/engine/condition_variable.hpp>
 #include <userver/engine/impl/task_context_holder.hpp>
+#include <userver/engine/mutex.hpp>
 #include <userver/engine/run_standalone.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/wait_all_checked.hpp>
 
 #include <engine/impl/wait_list.hpp>
 #include <engine/task/task_context.hpp>
@@ -195,4 +199,57 @@ BENCHMARK(wait_list_add_remove_contention_unbalanced)
     ->Unit(benchmark::kMillisecond)
     ->UseRealTime();
 
+// NotifyAll on a WaitList with many waiters, the woken up tasks are pushed
+// into the task queue in a single batch.
+void wait_list_broadcast(benchmark::State& state) {
+    constexpr std::size_t kWorkerThreads = 4;
+    const auto waiters_count = static_cast<std::size_t>(state.range(0));
+
+    engine::RunStandalone(kWorkerThreads, [&] {
+        engine::Mutex mutex;
+        engine::ConditionVariable cv;
+        std::uint64_t generation = 0;
+        bool stop = false;
+
+        std::atomic<std::size_t> woken_count{0};
+        engine::SingleConsumerEvent all_woken;
+
+        std::vector<engine::TaskWithResult<void>> waiters;
+        waiters.reserve(waiters_count);
+        for (std::size_t i = 0; i < waiters_count; ++i) {
+            waiters.push_back(engine::AsyncNoSpan([&] {
+                std::uint64_t seen_generation = 0;
+                while (true) {
+                    {
+                        std::unique_lock lock{mutex};
+                        [[maybe_unused]] const bool satisfied =
+                            cv.Wait(lock, [&] { return stop || generation != seen_generation; });
+                        if (stop) return;
+                        seen_generation = generation;
+                    }
+                    if (++woken_count == waiters_count) all_woken.Send();
+                }
+            }));
+        }
+
+        for ([[maybe_unused]] auto _ : state) {
+            {
+                const std::lock_guard lock{mutex};
+                ++generation;
+            }
+            cv.NotifyAll();
+            [[maybe_unused]] const bool all_woken_ok = all_woken.WaitForEvent();
+            woken_count = 0;
+        }
+
+        {
+            const std::lock_guard lock{mutex};
+            stop = true;
+        }
+        cv.NotifyAll();
+        engine::WaitAllChecked(waiters);
+    });
+}
+BENCHMARK(wait_list_broadcast)->RangeMultiplier(4)->Range(16, 1024)->UseRealTime();
+
 USERVER_NAMESPACE_END
@@ -99,6 +99,18 @@ public:
         const Context&... context
     );
 
+    // io_func(fd, processed, count - processed) transfers some of the remaining
+    // messages and returns their count, or -1 with errno set
+    template <typename IoFunc, typename... Context>
+    size_t PerformBatchIo(
+        SingleUserGuard& guard,
+        IoFunc&& io_func,
+        std::size_t count,
+        TransferMode mode,
+        Deadline deadline,
+        const Context&... context
+    );
+
     engine::impl::ContextAccessor* TryGetContextAccessor() noexcept { return poller_.TryGetContextAccessor(); }
 
 private:
@@ -243,6 +255,31 @@ size_t Direction::PerformIoV(
     return processed_bytes;
 }
 
+template <typename IoFunc, typename... Context>
+size_t Direction::PerformBatchIo(
+    SingleUserGuard&,
+    IoFunc&& io_func,
+    std::size_t count,
+    TransferMode mode,
+    Deadline deadline,
+    const Context&... context
+) {
+    std::size_t processed = 0;
+    while (processed < count) {
+        const auto chunk_size = io_func(Fd(), processed, count - processed);
+
+        if (chunk_size > 0) {
+            processed += chunk_size;
+            if (mode == TransferMode::kOnce) {
+                break;
+            }
+        } else if (!chunk_size || TryHandleError(errno, processed, mode, deadline, context...) == ErrorMode::kFatal) {
+            break;
+        }
+    }
+    return processed;
+}
+
 template <typename IoFunc, typename... Context>
 size_t Direction::PerformIo(
     SingleUserGuard&,
@@ -2,9 +2,14 @@
 
 #include <unistd.h>
 
+#include <chrono>
+
 #include <userver/engine/run_standalone.hpp>
 #include <utils/check_syscall.hpp>
 
+#include <engine/ev/backend.hpp>
+#include <engine/impl/standalone.hpp>
+
 #include "fd_control.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -30,6 +35,18 @@ namespace io = engine::io;
 using Deadline = engine::Deadline;
 using FdControl = io::impl::FdControl;
 
+// Runs the payload with ev loops using the backend from state.range(0)
+void RunWithEvBackend(benchmark::State& state, utils::function_ref<void()> payload) {
+    const auto backend = static_cast<engine::ev::Backend>(state.range(0));
+    state.SetLabel(std::string{engine::ev::ToString(backend)});
+    engine::impl::RunStandalone(1, engine::TaskProcessorPoolsConfig{}, backend, payload);
+}
+
+void EvBackendArgs(benchmark::internal::Benchmark* b) {
+    b->Arg(static_cast<int>(engine::ev::Backend::kEpoll));
+    b->Arg(static_cast<int>(engine::ev::Backend::kIoUring));
+}
+
 }  // namespace
 
 void fd_control_destroy(benchmark::State& state) {
@@ -64,7 +81,7 @@ void fd_control_close_destroy(benchmark::State& state) {
 BENCHMARK(fd_control_close_destroy);
 
 void fd_control_wait_destroy(benchmark::State& state) {
-    engine::RunStandalone([&] {
+    RunWithEvBackend(state, [&] {
         for ([[maybe_unused]] auto _ : state) {
             state.PauseTiming();
             Pipe pipe;
@@ -77,10 +94,10 @@ void fd_control_wait_destroy(benchmark::State& state) {
         }
     });
 }
-BENCHMARK(fd_control_wait_destroy);
+BENCHMARK(fd_control_wait_destroy)->Apply(EvBackendArgs);
 
 void fd_control_construct_wait_destroy(benchmark::State& state) {
-    engine::RunStandalone([&] {
+    RunWithEvBackend(state, [&] {
         for ([[maybe_unused]] auto _ : state) {
             state.PauseTiming();
             Pipe pipe;
@@ -92,6 +109,21 @@ void fd_control_construct_wait_destroy(benchmark::State& state) {
         }
     });
 }
-BENCHMARK(fd_control_construct_wait_destroy);
+BENCHMARK(fd_control_construct_wait_destroy)->Apply(EvBackendArgs);
+
+void fd_control_wait_ready(benchmark::State& state) {
+    RunWithEvBackend(state, [&] {
+        Pipe pipe;
+        auto write_control = FdControl::Adopt(pipe.ExtractOut());
+        auto& write_dir = write_control->Write();
+
+        // pipe is always writable, so the watcher fires on each wait
+        for ([[maybe_unused]] auto _ : state) {
+            auto result = write_dir.Wait(Deadline::FromDuration(std::chrono::seconds{10}));
+            benchmark::DoNotOptimize(result);
+        }
+    });
+}
+BENCHMARK(fd_control_wait_ready)->Apply(EvBackendArgs);
 
 USERVER_NAMESPACE_END
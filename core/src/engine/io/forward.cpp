@@ -0,0 +1,274 @@
+#include <userver/engine/io/forward.hpp>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <memory>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/exception.hpp>
+#include <userver/engine/io/tls_wrapper.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/strerror.hpp>
+
+#include <utils/check_syscall.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io {
+namespace {
+
+constexpr std::size_t kCopyBufferSize = 64 * 1024;
+
+// Ends of the forwarding, fd is kInvalidFd if the stream can't be spliced
+struct ForwardSource {
+    ReadableBase& stream;
+    int fd;
+};
+
+struct ForwardSink {
+    WritableBase& stream;
+    int fd;
+};
+
+#ifdef __linux__
+constexpr int kPipeSize = 1024 * 1024;
+constexpr unsigned kSpliceFlags = SPLICE_F_MOVE | SPLICE_F_NONBLOCK;
+
+// e.g. a kernel without splice support for the socket protocol
+bool IsSpliceUnsupported(int error_code) noexcept {
+    return error_code == EINVAL || error_code == EOPNOTSUPP || error_code == ENOSYS;
+}
+
+class SplicePipe final {
+public:
+    SplicePipe() {
+        utils::CheckSyscallCustomException<IoSystemError>(
+            ::pipe2(fds_.data(), O_NONBLOCK | O_CLOEXEC), "creating a pipe for splice"
+        );
+        // Larger pipe means fewer syscalls, the size is limited by
+        // /proc/sys/fs/pipe-max-size, so failures are ignored
+        ::fcntl(WriteFd(), F_SETPIPE_SZ, kPipeSize);
+        const int size = ::fcntl(WriteFd(), F_GETPIPE_SZ);
+        capacity_ = size > 0 ? static_cast<std::size_t>(size) : 0;
+    }
+
+    ~SplicePipe() {
+        ::close(fds_[0]);
+        ::close(fds_[1]);
+    }
+
+    SplicePipe(const SplicePipe&) = delete;
+    SplicePipe& operator=(const SplicePipe&) = delete;
+
+    int ReadFd() const noexcept { return fds_[0]; }
+    int WriteFd() const noexcept { return fds_[1]; }
+
+    // Reading at most the capacity into an empty pipe never blocks on the pipe
+    std::size_t Capacity() const noexcept { return capacity_; }
+
+private:
+    std::array<int, 2> fds_{kInvalidFd, kInvalidFd};
+    std::size_t capacity_{0};
+};
+#endif
+
+class Forwarder final {
+public:
+    Forwarder(ForwardSource from, ForwardSink to, Deadline deadline) : from_(from), to_(to), deadline_(deadline) {}
+
+    std::size_t Run() {
+#ifdef __linux__
+        if (TrySplice()) return forwarded_;
+#endif
+        Copy();
+        return forwarded_;
+    }
+
+private:
+#ifdef __linux__
+    // Returns false if the streams do not support splicing
+    bool TrySplice() {
+        if (from_.fd == kInvalidFd || to_.fd == kInvalidFd) return false;
+
+        const SplicePipe pipe;
+        if (!pipe.Capacity()) return false;
+
+        std::size_t in_pipe = 0;
+        for (;;) {
+            if (in_pipe == 0) {
+                const auto received =
+                    ::splice(from_.fd, nullptr, pipe.WriteFd(), nullptr, pipe.Capacity(), kSpliceFlags);
+                if (received > 0) {
+                    in_pipe = received;
+                    continue;
+                }
+                if (received == 0) return true;
+
+                const int error_code = errno;
+                if (error_code == EINTR) continue;
+                if (error_code == EAGAIN || error_code == EWOULDBLOCK) {
+                    WaitOrThrow([this] { return from_.stream.WaitReadable(deadline_); });
+                    continue;
+                }
+                if (forwarded_ == 0 && IsSpliceUnsupported(error_code)) return false;
+                HandleSystemError(error_code);
+                return true;
+            }
+
+            const auto sent = ::splice(pipe.ReadFd(), nullptr, to_.fd, nullptr, in_pipe, kSpliceFlags);
+            if (sent > 0) {
+                in_pipe -= sent;
+                forwarded_ += sent;
+                continue;
+            }
+
+            const int error_code = errno;
+            if (error_code == EINTR) continue;
+            // the pipe is not empty, so it is the socket that is full
+            if (sent == 0 || error_code == EAGAIN || error_code == EWOULDBLOCK) {
+                WaitOrThrow([this] { return to_.stream.WaitWriteable(deadline_); });
+                continue;
+            }
+            if (IsSpliceUnsupported(error_code)) {
+                return !DrainPipe(pipe, in_pipe);
+            }
+            HandleSystemError(error_code);
+            return true;
+        }
+    }
+
+    // Sends the data stuck in the pipe after the sink has refused splicing,
+    // returns false if the forwarding has failed
+    bool DrainPipe(const SplicePipe& pipe, std::size_t in_pipe) {
+        while (in_pipe != 0) {
+            // the data is already in the pipe, reading it does not block
+            const auto len = utils::CheckSyscallCustomException<IoSystemError>(
+                ::read(pipe.ReadFd(), Buffer(), std::min(in_pipe, kCopyBufferSize)), "reading from a pipe for splice"
+            );
+            UASSERT(len > 0);
+            in_pipe -= len;
+            if (!Send(len)) return false;
+        }
+        return true;
+    }
+#endif
+
+    void Copy() {
+        for (;;) {
+            std::size_t received = 0;
+            if (!CallStream([&] { received = from_.stream.ReadSome(Buffer(), kCopyBufferSize, deadline_); })) return;
+            if (!received || !Send(received)) return;
+        }
+    }
+
+    bool Send(std::size_t len) {
+        std::size_t sent = 0;
+        if (!CallStream([&] { sent = to_.stream.WriteAll(Buffer(), len, deadline_); })) return false;
+        forwarded_ += sent;
+        return sent == len;
+    }
+
+    // Accounts the forwarded bytes in the interruptions of the stream
+    // operations, returns false if the operation has failed
+    template <typename Func>
+    bool CallStream(Func&& func) {
+        try {
+            func();
+            return true;
+        } catch (const IoTimeout& ex) {
+            throw IoTimeout(/*bytes_transferred =*/forwarded_ + ex.BytesTransferred()) << "Forward";
+        } catch (const IoCancelled& ex) {
+            throw IoCancelled(/*bytes_transferred =*/forwarded_ + ex.BytesTransferred()) << "Forward";
+        } catch (const IoSystemError&) {
+            // already logged by the stream
+            if (forwarded_ == 0) throw;
+            return false;
+        }
+    }
+
+    template <typename WaitFunc>
+    void WaitOrThrow(WaitFunc&& wait) {
+        if (!current_task::ShouldCancel() && wait()) return;
+
+        if (current_task::ShouldCancel()) {
+            throw IoCancelled(/*bytes_transferred =*/forwarded_) << "Forward";
+        }
+        throw IoTimeout(/*bytes_transferred =*/forwarded_) << "Forward";
+    }
+
+    // Same policy as for the other socket operations: an error is thrown only
+    // if nothing was transferred, otherwise the short count is returned.
+    void HandleSystemError(int error_code) {
+        IoSystemError ex(error_code, "Forward");
+        ex << "Error while forwarding from fd=" << from_.fd << " to fd=" << to_.fd;
+        auto log_level = logging::Level::kError;
+        if (error_code == ECONNRESET || error_code == EPIPE) {
+            log_level = logging::Level::kInfo;
+        }
+        LOG(log_level) << ex;
+        if (forwarded_ == 0) {
+            throw std::move(ex);
+        }
+    }
+
+    char* Buffer() {
+        if (!buffer_) buffer_ = std::make_unique<char[]>(kCopyBufferSize);
+        return buffer_.get();
+    }
+
+    ForwardSource from_;
+    ForwardSink to_;
+    const Deadline deadline_;
+    std::size_t forwarded_{0};
+    std::unique_ptr<char[]> buffer_;
+};
+
+void ShutdownWrite(Socket& socket) noexcept {
+    // the peer may have already closed the connection
+    if (::shutdown(socket.Fd(), SHUT_WR) == -1 && errno != ENOTCONN) {
+        LOG_INFO() << "Failed to shut down fd=" << socket.Fd() << " for writing: " << utils::strerror(errno);
+    }
+}
+
+}  // namespace
+
+std::size_t Forward(Socket& from, Socket& to, Deadline deadline) {
+    if (!from.IsValid() || !to.IsValid()) {
+        throw IoException("Attempt to Forward between closed sockets");
+    }
+    return Forwarder({from, from.Fd()}, {to, to.Fd()}, deadline).Run();
+}
+
+std::size_t Forward(Socket& from, TlsWrapper& to, Deadline deadline) {
+    if (!from.IsValid() || !to.IsValid()) {
+        throw IoException("Attempt to Forward between closed sockets");
+    }
+    // the kernel encrypts the data written to the socket
+    const int to_fd = to.IsKernelTlsSendEnabled() ? to.GetRawFd() : kInvalidFd;
+    return Forwarder({from, from.Fd()}, {to, to_fd}, deadline).Run();
+}
+
+ForwardResult ForwardBidirectional(Socket& first, Socket& second, Deadline deadline) {
+    auto second_to_first = engine::AsyncNoSpan([&first, &second, deadline] {
+        const auto forwarded = Forward(second, first, deadline);
+        ShutdownWrite(first);
+        return forwarded;
+    });
+
+    ForwardResult result;
+    result.first_to_second = Forward(first, second, deadline);
+    ShutdownWrite(second);
+    result.second_to_first = second_to_first.Get();
+    return result;
+}
+
+}  // namespace engine::io
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,156 @@
+#include <userver/utest/utest.hpp>
+
+#include <sys/socket.h>
+
+#include <string>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/forward.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/internal/net/net_listener.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace io = engine::io;
+using Deadline = engine::Deadline;
+using TcpListener = internal::net::TcpListener;
+
+std::string MakeData(std::size_t size) {
+    std::string data(size, '\0');
+    for (std::size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<char>('a' + i % 26);
+    }
+    return data;
+}
+
+std::string RecvUntilClosed(io::Socket& socket, Deadline deadline) {
+    std::string result;
+    char buf[4096];
+    while (const auto received = socket.RecvSome(buf, sizeof(buf), deadline)) {
+        result.append(buf, received);
+    }
+    return result;
+}
+
+}  // namespace
+
+UTEST(Forward, Simple) {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    TcpListener listener;
+    auto [client, proxy_in] = listener.MakeSocketPair(deadline);
+    auto [proxy_out, server] = listener.MakeSocketPair(deadline);
+
+    auto forward_task = engine::AsyncNoSpan([&, &proxy_in = proxy_in, &proxy_out = proxy_out] {
+        return io::Forward(proxy_in, proxy_out, deadline);
+    });
+
+    const std::string data = "hello, world";
+    ASSERT_EQ(client.SendAll(data.data(), data.size(), deadline), data.size());
+    std::string received(data.size(), '\0');
+    ASSERT_EQ(server.RecvAll(received.data(), received.size(), deadline), data.size());
+    EXPECT_EQ(received, data);
+
+    client.Close();
+    EXPECT_EQ(forward_task.Get(), data.size());
+}
+
+UTEST_MT(Forward, LargeData, 2) {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    TcpListener listener;
+    auto [client, proxy_in] = listener.MakeSocketPair(deadline);
+    auto [proxy_out, server] = listener.MakeSocketPair(deadline);
+
+    // larger than the pipe and the socket buffers
+    const auto data = MakeData(16 * 1024 * 1024);
+    auto send_task = engine::AsyncNoSpan([&, &client = client] {
+        ASSERT_EQ(client.SendAll(data.data(), data.size(), deadline), data.size());
+        client.Close();
+    });
+    auto forward_task = engine::AsyncNoSpan([&, &proxy_in = proxy_in, &proxy_out = proxy_out] {
+        const auto forwarded = io::Forward(proxy_in, proxy_out, deadline);
+        proxy_out.Close();
+        return forwarded;
+    });
+
+    EXPECT_EQ(RecvUntilClosed(server, deadline), data);
+    send_task.Get();
+    EXPECT_EQ(forward_task.Get(), data.size());
+}
+
+UTEST(Forward, Timeout) {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    TcpListener listener;
+    auto [client, proxy_in] = listener.MakeSocketPair(deadline);
+    auto [proxy_out, server] = listener.MakeSocketPair(deadline);
+
+    const std::string data = "data";
+    ASSERT_EQ(client.SendAll(data.data(), data.size(), deadline), data.size());
+
+    try {
+        [[maybe_unused]] const auto forwarded =
+            io::Forward(proxy_in, proxy_out, Deadline::FromDuration(std::chrono::milliseconds{50}));
+        FAIL() << "Forward has not timed out";
+    } catch (const io::IoTimeout& ex) {
+        EXPECT_EQ(ex.BytesTransferred(), data.size());
+    }
+}
+
+UTEST(Forward, Cancel) {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    TcpListener listener;
+    auto [client, proxy_in] = listener.MakeSocketPair(deadline);
+    auto [proxy_out, server] = listener.MakeSocketPair(deadline);
+
+    auto forward_task = engine::AsyncNoSpan([&, &proxy_in = proxy_in, &proxy_out = proxy_out] {
+        return io::Forward(proxy_in, proxy_out, deadline);
+    });
+
+    // the forwarding is in progress once the data reaches the server
+    const std::string data = "data";
+    ASSERT_EQ(client.SendAll(data.data(), data.size(), deadline), data.size());
+    std::string received(data.size(), '\0');
+    ASSERT_EQ(server.RecvAll(received.data(), received.size(), deadline), data.size());
+
+    forward_task.RequestCancel();
+    try {
+        [[maybe_unused]] const auto forwarded = forward_task.Get();
+        FAIL() << "Forward has not been cancelled";
+    } catch (const io::IoCancelled& ex) {
+        EXPECT_EQ(ex.BytesTransferred(), data.size());
+    }
+}
+
+UTEST_MT(Forward, Bidirectional, 3) {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    TcpListener listener;
+    auto [client, proxy_in] = listener.MakeSocketPair(deadline);
+    auto [proxy_out, server] = listener.MakeSocketPair(deadline);
+
+    auto proxy_task = engine::AsyncNoSpan([&, &proxy_in = proxy_in, &proxy_out = proxy_out] {
+        return io::ForwardBidirectional(proxy_in, proxy_out, deadline);
+    });
+
+    const auto request = MakeData(1024 * 1024);
+    auto send_task = engine::AsyncNoSpan([&, &client = client] {
+        ASSERT_EQ(client.SendAll(request.data(), request.size(), deadline), request.size());
+        ASSERT_EQ(::shutdown(client.Fd(), SHUT_WR), 0);
+    });
+
+    // the half-close is propagated to the server
+    EXPECT_EQ(RecvUntilClosed(server, deadline), request);
+    send_task.Get();
+
+    const std::string response = "response";
+    ASSERT_EQ(server.SendAll(response.data(), response.size(), deadline), response.size());
+    server.Close();
+
+    EXPECT_EQ(RecvUntilClosed(client, deadline), response);
+
+    const auto result = proxy_task.Get();
+    EXPECT_EQ(result.first_to_second, request.size());
+    EXPECT_EQ(result.second_to_first, response.size());
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,82 @@
+#include <userver/engine/io/happy_eyeballs.hpp>
+
+#include <algorithm>
+#include <exception>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/engine/wait_any.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io {
+
+std::vector<Sockaddr> InterleaveAddressFamilies(std::vector<Sockaddr> addrs) {
+    if (addrs.empty()) return addrs;
+
+    const auto first_domain = addrs.front().Domain();
+    std::vector<Sockaddr> first_family;
+    std::vector<Sockaddr> other_families;
+    for (auto& addr : addrs) {
+        (addr.Domain() == first_domain ? first_family : other_families).push_back(std::move(addr));
+    }
+
+    std::vector<Sockaddr> result;
+    result.reserve(addrs.size());
+    for (std::size_t i = 0; i < std::max(first_family.size(), other_families.size()); ++i) {
+        if (i < first_family.size()) result.push_back(std::move(first_family[i]));
+        if (i < other_families.size()) result.push_back(std::move(other_families[i]));
+    }
+    return result;
+}
+
+Socket ConnectHappyEyeballs(const std::vector<Sockaddr>& addrs, Deadline deadline, HappyEyeballsSettings settings) {
+    if (addrs.empty()) throw IoException("No addresses to connect to");
+    const auto ordered_addrs = InterleaveAddressFamilies(addrs);
+
+    std::vector<TaskWithResult<Socket>> attempts;
+    std::size_t next_addr = 0;
+    std::exception_ptr last_error;
+    while (true) {
+        // the next attempt is started either on the attempt delay expiration
+        // or right after a failure of an attempt
+        if (next_addr < ordered_addrs.size()) {
+            attempts.push_back(AsyncNoSpan([&addr = ordered_addrs[next_addr], deadline] {
+                Socket socket{addr.Domain(), SocketType::kStream};
+                socket.Connect(addr, deadline);
+                return socket;
+            }));
+            ++next_addr;
+        }
+
+        const auto wait_deadline = next_addr < ordered_addrs.size()
+                                       ? std::min(deadline, Deadline::FromDuration(settings.attempt_delay))
+                                       : deadline;
+        const auto finished = WaitAnyUntil(wait_deadline, attempts);
+        if (!finished) {
+            if (current_task::ShouldCancel()) throw IoCancelled() << "Connect to " << ordered_addrs.front();
+            if (deadline.IsReached()) throw IoTimeout() << "Connect to " << ordered_addrs.front();
+            continue;
+        }
+
+        try {
+            // the other attempts are cancelled on destruction
+            return attempts[*finished].Get();
+        } catch (const IoException&) {
+            last_error = std::current_exception();
+        }
+        attempts.erase(attempts.begin() + *finished);
+
+        if (attempts.empty() && next_addr == ordered_addrs.size()) {
+            UASSERT(last_error);
+            std::rethrow_exception(last_error);
+        }
+    }
+}
+
+}  // namespace engine::io
+
+USERVER_NAMESPACE_END
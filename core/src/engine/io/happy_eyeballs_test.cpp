@@ -0,0 +1,80 @@
+#include <userver/utest/utest.hpp>
+
+#include <arpa/inet.h>
+
+#include <userver/engine/io/exception.hpp>
+#include <userver/engine/io/happy_eyeballs.hpp>
+#include <userver/internal/net/net_listener.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace io = engine::io;
+using Deadline = engine::Deadline;
+using TcpListener = internal::net::TcpListener;
+
+io::Sockaddr MakeRefusedAddress() {
+    // the port is free once the listener is closed
+    const TcpListener listener;
+    return listener.addr;
+}
+
+io::Sockaddr MakeIPv4Address(const char* ip, std::uint16_t port) {
+    io::Sockaddr addr;
+    auto* sa = addr.As<sockaddr_in>();
+    sa->sin_family = AF_INET;
+    sa->sin_port = htons(port);
+    ::inet_pton(AF_INET, ip, &sa->sin_addr);
+    return addr;
+}
+
+}  // namespace
+
+TEST(HappyEyeballs, InterleaveAddressFamilies) {
+    const auto v4_1 = MakeIPv4Address("127.0.0.1", 1);
+    const auto v4_2 = MakeIPv4Address("127.0.0.2", 1);
+    const auto v4_3 = MakeIPv4Address("127.0.0.3", 1);
+    const auto v6_1 = io::Sockaddr::MakeLoopbackAddress();
+
+    const auto ordered = io::InterleaveAddressFamilies({v4_1, v4_2, v4_3, v6_1});
+    ASSERT_EQ(ordered.size(), 4);
+    EXPECT_EQ(ordered[0].PrimaryAddressString(), "127.0.0.1");
+    EXPECT_EQ(ordered[1].PrimaryAddressString(), "::1");
+    EXPECT_EQ(ordered[2].PrimaryAddressString(), "127.0.0.2");
+    EXPECT_EQ(ordered[3].PrimaryAddressString(), "127.0.0.3");
+
+    EXPECT_TRUE(io::InterleaveAddressFamilies({}).empty());
+}
+
+UTEST(HappyEyeballs, FallsBackOnFailure) {
+    const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    TcpListener listener;
+
+    // a failed attempt starts the next one without waiting for the delay
+    io::HappyEyeballsSettings settings;
+    settings.attempt_delay = utest::kMaxTestWaitTime;
+    auto socket = io::ConnectHappyEyeballs({MakeRefusedAddress(), listener.addr}, test_deadline, settings);
+    EXPECT_EQ(socket.Getpeername().Port(), listener.Port());
+}
+
+UTEST(HappyEyeballs, RacesUnresponsiveAddress) {
+    const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    TcpListener listener;
+
+    // TEST-NET-1 address, either unreachable or blackholed
+    const auto blackhole = MakeIPv4Address("192.0.2.1", listener.Port());
+    auto socket = io::ConnectHappyEyeballs({blackhole, listener.addr}, test_deadline);
+    EXPECT_EQ(socket.Getpeername().Port(), listener.Port());
+}
+
+UTEST(HappyEyeballs, AllAttemptsFail) {
+    const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    UEXPECT_THROW(
+        io::ConnectHappyEyeballs({MakeRefusedAddress(), MakeRefusedAddress()}, test_deadline), io::IoSystemError
+    );
+    UEXPECT_THROW(io::ConnectHappyEyeballs({}, test_deadline), io::IoException);
+}
+
+USERVER_NAMESPACE_END
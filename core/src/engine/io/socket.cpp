@@ -1,11 +1,16 @@
 #include <userver/engine/io/socket.hpp>
 
 #include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/udp.h>
 #include <sys/socket.h>
 #include <sys/uio.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <array>
 #include <cerrno>
+#include <cstring>
 #include <string>
 #include <vector>
 
@@ -117,6 +122,154 @@ private:
     const Sockaddr& dest_addr_;
 };
 
+#ifdef __linux__
+// Holds the int of UDP_GRO and the uint16_t of UDP_SEGMENT
+struct alignas(struct ::cmsghdr) SegmentControl {
+    char data[CMSG_SPACE(sizeof(int))];
+};
+
+class BatchBuffers {
+protected:
+    void Prepare(std::size_t i, void* data, std::size_t len, const Sockaddr* addr) {
+        iovecs_[i].iov_base = data;
+        iovecs_[i].iov_len = len;
+        auto& header = headers_[i].msg_hdr;
+        header = {};
+        if (addr) {
+            header.msg_name = const_cast<sockaddr*>(addr->Data());  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+            header.msg_namelen = addr->Domain() == AddrDomain::kUnspecified ? addr->Capacity() : addr->Size();
+        }
+        header.msg_iov = &iovecs_[i];
+        header.msg_iovlen = 1;
+        header.msg_control = controls_[i].data;
+        header.msg_controllen = sizeof(controls_[i].data);
+    }
+
+    std::array<struct ::mmsghdr, Socket::kMaxBatchSize> headers_;
+    std::array<struct ::iovec, Socket::kMaxBatchSize> iovecs_;
+    std::array<SegmentControl, Socket::kMaxBatchSize> controls_;
+};
+
+class RecvMMsgWrapper final : private BatchBuffers {
+public:
+    explicit RecvMMsgWrapper(Socket::Datagram* datagrams) : datagrams_(datagrams) {}
+
+    [[nodiscard]] ssize_t operator()(int fd, std::size_t offset, std::size_t count) {
+        auto* datagrams = datagrams_ + offset;
+        count = std::min(count, Socket::kMaxBatchSize);
+        for (std::size_t i = 0; i < count; ++i) {
+            datagrams[i].addr = Sockaddr{};
+            Prepare(i, datagrams[i].data, datagrams[i].len, &datagrams[i].addr);
+        }
+
+        const auto ret = ::recvmmsg(fd, headers_.data(), static_cast<unsigned>(count), 0, nullptr);
+        for (std::size_t i = 0; ret > 0 && i < static_cast<std::size_t>(ret); ++i) {
+            auto& header = headers_[i].msg_hdr;
+            if (header.msg_namelen > datagrams[i].addr.Capacity()) {
+                throw IoException() << "Peer address does not fit into AddrStorage, family="
+                                    << datagrams[i].addr.Data()->sa_family << ", addrlen=" << header.msg_namelen;
+            }
+            datagrams[i].bytes_received = headers_[i].msg_len;
+            datagrams[i].segment_size = GetGroSegmentSize(header);
+        }
+        return ret;
+    }
+
+private:
+    static std::uint16_t GetGroSegmentSize([[maybe_unused]] struct ::msghdr& header) {
+#ifdef UDP_GRO
+        for (auto* cmsg = CMSG_FIRSTHDR(&header); cmsg; cmsg = CMSG_NXTHDR(&header, cmsg)) {
+            if (cmsg->cmsg_level == SOL_UDP && cmsg->cmsg_type == UDP_GRO) {
+                int segment_size = 0;
+                std::memcpy(&segment_size, CMSG_DATA(cmsg), sizeof(segment_size));
+                return static_cast<std::uint16_t>(segment_size);
+            }
+        }
+#endif
+        return 0;
+    }
+
+    Socket::Datagram* const datagrams_;
+};
+
+class SendMMsgWrapper final : private BatchBuffers {
+public:
+    explicit SendMMsgWrapper(const Socket::Datagram* datagrams) : datagrams_(datagrams) {}
+
+    [[nodiscard]] ssize_t operator()(int fd, std::size_t offset, std::size_t count) {
+        const auto* datagrams = datagrams_ + offset;
+        count = std::min(count, Socket::kMaxBatchSize);
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto& datagram = datagrams[i];
+            const bool is_connected = datagram.addr.Domain() == AddrDomain::kUnspecified;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+            Prepare(i, const_cast<void*>(datagram.data), datagram.len, is_connected ? nullptr : &datagram.addr);
+            SetGsoSegmentSize(headers_[i].msg_hdr, datagram.segment_size);
+        }
+        return ::sendmmsg(fd, headers_.data(), static_cast<unsigned>(count), MSG_NOSIGNAL);
+    }
+
+private:
+    static void SetGsoSegmentSize(struct ::msghdr& header, std::uint16_t segment_size) {
+        if (!segment_size) {
+            header.msg_control = nullptr;
+            header.msg_controllen = 0;
+            return;
+        }
+#ifdef UDP_SEGMENT
+        header.msg_controllen = CMSG_SPACE(sizeof(segment_size));
+        auto* cmsg = CMSG_FIRSTHDR(&header);
+        cmsg->cmsg_level = SOL_UDP;
+        cmsg->cmsg_type = UDP_SEGMENT;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(segment_size));
+        std::memcpy(CMSG_DATA(cmsg), &segment_size, sizeof(segment_size));
+#else
+        throw IoException("UDP GSO is not supported by the platform");
+#endif
+    }
+
+    const Socket::Datagram* const datagrams_;
+};
+#else
+// MAC_COMPAT: no recvmmsg and sendmmsg, one datagram per syscall
+class RecvMMsgWrapper final {
+public:
+    explicit RecvMMsgWrapper(Socket::Datagram* datagrams) : datagrams_(datagrams) {}
+
+    [[nodiscard]] ssize_t operator()(int fd, std::size_t offset, std::size_t) {
+        auto& datagram = datagrams_[offset];
+        RecvFromWrapper recv_from_wrapper;
+        const auto ret = recv_from_wrapper(fd, datagram.data, datagram.len);
+        if (ret == -1) return -1;
+        datagram.bytes_received = ret;
+        datagram.addr = recv_from_wrapper.SourceAddress();
+        datagram.segment_size = 0;
+        return 1;
+    }
+
+private:
+    Socket::Datagram* const datagrams_;
+};
+
+class SendMMsgWrapper final {
+public:
+    explicit SendMMsgWrapper(const Socket::Datagram* datagrams) : datagrams_(datagrams) {}
+
+    [[nodiscard]] ssize_t operator()(int fd, std::size_t offset, std::size_t) const {
+        const auto& datagram = datagrams_[offset];
+        if (datagram.segment_size) throw IoException("UDP GSO is not supported by the platform");
+        const auto ret = datagram.addr.Domain() == AddrDomain::kUnspecified
+                             ? SendWrapper(fd, datagram.data, datagram.len)
+                             : SendToWrapper{datagram.addr}(fd, datagram.data, datagram.len);
+        // datagrams are sent whole or not at all
+        return ret == -1 ? -1 : 1;
+    }
+
+private:
+    const Socket::Datagram* const datagrams_;
+};
+#endif
+
 void FillIoSendData(const IoData* data, struct iovec* dst, std::size_t count) {
     UASSERT(data);
     UASSERT(count > 0);
@@ -382,6 +535,44 @@ size_t Socket::SendAllTo(const Sockaddr& dest_addr, const void* buf, size_t len,
     );
 }
 
+size_t Socket::RecvSomeBatchFrom(Datagram* datagrams, size_t count, Deadline deadline) {
+    if (!IsValid()) {
+        throw IoException("Attempt to RecvSomeBatchFrom via closed socket");
+    }
+    UASSERT(datagrams);
+    UASSERT(count > 0);
+    auto& dir = fd_control_->Read();
+    dir.ResetReady();
+    impl::Direction::SingleUserGuard guard(dir);
+    return dir.PerformBatchIo(
+        guard, RecvMMsgWrapper{datagrams}, count, impl::TransferMode::kOnce, deadline, "RecvSomeBatchFrom"
+    );
+}
+
+size_t Socket::SendAllBatchTo(const Datagram* datagrams, size_t count, Deadline deadline) {
+    if (!IsValid()) {
+        throw IoException("Attempt to SendAllBatchTo via closed socket");
+    }
+    UASSERT(datagrams);
+    for (size_t i = 0; i < count; ++i) {
+        const auto domain = datagrams[i].addr.Domain();
+        if (domain != AddrDomain::kUnspecified && domain != domain_) {
+            throw AddrException(fmt::format(
+                "Socket address domain ({}) does not match address domain ({})",
+                static_cast<int>(domain_),
+                static_cast<int>(domain)
+            ));
+        }
+    }
+
+    auto& dir = fd_control_->Write();
+    dir.ResetReady();
+    impl::Direction::SingleUserGuard guard(dir);
+    return dir.PerformBatchIo(
+        guard, SendMMsgWrapper{datagrams}, count, impl::TransferMode::kWhole, deadline, "SendAllBatchTo"
+    );
+}
+
 Socket Socket::Accept(Deadline deadline) {
     if (!IsValid()) {
         throw IoException("Attempt to Accept from closed socket");
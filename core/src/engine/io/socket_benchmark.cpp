@@ -15,6 +15,9 @@
 #include <userver/internal/net/net_listener.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <engine/ev/backend.hpp>
+#include <engine/impl/standalone.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 using Deadline = engine::Deadline;
@@ -23,10 +26,22 @@ namespace {
 
 constexpr auto kDeadlineMaxTime = std::chrono::seconds{60};
 
+// Runs the payload with ev loops using the backend from state.range(0)
+void RunWithEvBackend(benchmark::State& state, std::size_t worker_threads, utils::function_ref<void()> payload) {
+    const auto backend = static_cast<engine::ev::Backend>(state.range(0));
+    state.SetLabel(std::string{engine::ev::ToString(backend)});
+    engine::impl::RunStandalone(worker_threads, engine::TaskProcessorPoolsConfig{}, backend, payload);
+}
+
+void EvBackendArgs(benchmark::internal::Benchmark* b) {
+    b->Arg(static_cast<int>(engine::ev::Backend::kEpoll));
+    b->Arg(static_cast<int>(engine::ev::Backend::kIoUring));
+}
+
 }  // namespace
 
 void socket_send_all(benchmark::State& state) {
-    engine::RunStandalone([&]() {
+    RunWithEvBackend(state, 1, [&]() {
         const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
         internal::net::TcpListener listener;
         auto [server, client] = listener.MakeSocketPair(test_deadline);
@@ -49,10 +64,10 @@ void socket_send_all(benchmark::State& state) {
         task_reader.Get();
     });
 }
-BENCHMARK(socket_send_all);
+BENCHMARK(socket_send_all)->Apply(EvBackendArgs);
 
 void socket_send_all_v(benchmark::State& state) {
-    engine::RunStandalone([&]() {
+    RunWithEvBackend(state, 1, [&]() {
         const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
         internal::net::TcpListener listener;
         auto [server, client] = listener.MakeSocketPair(test_deadline);
@@ -73,7 +88,34 @@ void socket_send_all_v(benchmark::State& state) {
         task_reader.Get();
     });
 }
-BENCHMARK(socket_send_all_v);
+BENCHMARK(socket_send_all_v)->Apply(EvBackendArgs);
+
+// Every iteration waits for the socket readiness on both sides, so the cost
+// of ev watcher updates dominates here.
+void socket_ping_pong(benchmark::State& state) {
+    RunWithEvBackend(state, 2, [&]() {
+        const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
+        internal::net::TcpListener listener;
+        auto [server, client] = listener.MakeSocketPair(test_deadline);
+        auto task_echo = engine::AsyncNoSpan(
+            [test_deadline](auto&& server) {
+                char c = 0;
+                while (server.RecvAll(&c, 1, test_deadline) == 1 && server.SendAll(&c, 1, test_deadline) == 1) {
+                }
+            },
+            std::move(server)
+        );
+        for ([[maybe_unused]] auto _ : state) {
+            char c = 'x';
+            auto bytes = client.SendAll(&c, 1, test_deadline);
+            bytes += client.RecvAll(&c, 1, test_deadline);
+            benchmark::DoNotOptimize(bytes);
+        }
+        client.Close();
+        task_echo.Get();
+    });
+}
+BENCHMARK(socket_ping_pong)->Apply(EvBackendArgs);
 
 [[maybe_unused]] void socket_send_all_v_range(benchmark::State& state) {
     engine::RunStandalone(2, [&]() {
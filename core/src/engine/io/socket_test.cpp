@@ -8,7 +8,9 @@
 #include <array>
 #include <cerrno>
 #include <cstdlib>
+#include <string>
 #include <string_view>
+#include <vector>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/condition_variable.hpp>
@@ -463,6 +465,52 @@ UTEST_MT(Socket, ConcurrentReadWriteUdp, 2) {
     /// [send self concurrent]
 }
 
+UTEST(Socket, DgramBatch) {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    UdpListener listener;
+    engine::io::Socket& server = listener.socket;
+
+    engine::io::Socket client{listener.addr.Domain(), UdpListener::kType};
+
+    // more than fits into a single syscall
+    constexpr std::size_t kDatagramsCount = engine::io::Socket::kMaxBatchSize + 2;
+    std::vector<std::string> payloads;
+    std::vector<engine::io::Socket::Datagram> datagrams(kDatagramsCount);
+    for (std::size_t i = 0; i < kDatagramsCount; ++i) {
+        payloads.push_back(std::to_string(i));
+    }
+    for (std::size_t i = 0; i < kDatagramsCount; ++i) {
+        datagrams[i].data = payloads[i].data();
+        datagrams[i].len = payloads[i].size();
+        datagrams[i].addr = listener.addr;
+    }
+    EXPECT_EQ(kDatagramsCount, client.SendAllBatchTo(datagrams.data(), datagrams.size(), deadline));
+    const auto& client_addr = client.Getsockname();
+
+    std::vector<std::array<char, 16>> buffers(kDatagramsCount);
+    std::vector<engine::io::Socket::Datagram> received(kDatagramsCount);
+    for (std::size_t i = 0; i < kDatagramsCount; ++i) {
+        received[i].data = buffers[i].data();
+        received[i].len = buffers[i].size();
+    }
+    std::size_t received_count = 0;
+    while (received_count < kDatagramsCount) {
+        const auto count = server.RecvSomeBatchFrom(
+            received.data() + received_count, kDatagramsCount - received_count, deadline
+        );
+        EXPECT_GT(count, 0);
+        EXPECT_LE(count, engine::io::Socket::kMaxBatchSize);
+        received_count += count;
+    }
+
+    for (std::size_t i = 0; i < kDatagramsCount; ++i) {
+        EXPECT_EQ(payloads[i], std::string_view(buffers[i].data(), received[i].bytes_received));
+        EXPECT_EQ(client_addr.Port(), received[i].addr.Port());
+        EXPECT_EQ(0, received[i].segment_size);
+    }
+}
+
 UTEST(Socket, WriteALot) {
     const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
 
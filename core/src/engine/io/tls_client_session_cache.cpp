@@ -0,0 +1,118 @@
+#include <engine/io/tls_client_session_cache.hpp>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include <userver/cache/lru_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io::impl {
+
+namespace {
+
+constexpr std::size_t kMaxCachedSessions = 1000;
+
+struct SslSessionDeleter {
+    void operator()(SSL_SESSION* session) const noexcept { SSL_SESSION_free(session); }
+};
+using SslSession = std::unique_ptr<SSL_SESSION, SslSessionDeleter>;
+
+// TLS 1.3 tickets should not be reused, the server sends new ones after each
+// handshake
+bool IsSingleUse(const SSL_SESSION* session) noexcept {
+#if OPENSSL_VERSION_NUMBER >= 0x010100000L
+    return SSL_SESSION_get_protocol_version(session) >= TLS1_3_VERSION;
+#else
+    static_cast<void>(session);
+    return false;
+#endif
+}
+
+void UpRef(SSL_SESSION* session) noexcept {
+#if OPENSSL_VERSION_NUMBER >= 0x010100000L
+    SSL_SESSION_up_ref(session);
+#else
+    CRYPTO_add(&session->references, 1, CRYPTO_LOCK_SSL_SESSION);
+#endif
+}
+
+class SessionCache final {
+public:
+    void Put(std::string server_name, SslSession session) {
+        const std::lock_guard lock{mutex_};
+        sessions_.Put(std::move(server_name), std::move(session));
+    }
+
+    // Returns a new reference to the session, if any
+    SSL_SESSION* Get(const std::string& server_name) {
+        const std::lock_guard lock{mutex_};
+        auto* session = sessions_.Get(server_name);
+        if (!session) return nullptr;
+
+        if (IsSingleUse(session->get())) {
+            auto* result = session->release();
+            sessions_.Erase(server_name);
+            return result;
+        }
+
+        UpRef(session->get());
+        return session->get();
+    }
+
+    void AccountHandshake(bool is_resumed) noexcept {
+        handshakes_.fetch_add(1, std::memory_order_relaxed);
+        if (is_resumed) resumed_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    TlsClientHandshakeStats GetStats() const noexcept {
+        return {handshakes_.load(std::memory_order_relaxed), resumed_.load(std::memory_order_relaxed)};
+    }
+
+private:
+    std::mutex mutex_;
+    cache::LruMap<std::string, SslSession> sessions_{kMaxCachedSessions};
+
+    std::atomic<std::uint64_t> handshakes_{0};
+    std::atomic<std::uint64_t> resumed_{0};
+};
+
+SessionCache& GetSessionCache() {
+    static SessionCache cache;
+    return cache;
+}
+
+// Returning 1 takes the ownership of the `session` reference
+int OnNewSession(SSL* ssl, SSL_SESSION* session) {
+    const char* server_name = SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name);
+    if (!server_name) return 0;
+
+    SslSession owned{session};
+    try {
+        GetSessionCache().Put(server_name, std::move(owned));
+    } catch (const std::exception&) {
+        // not cached, the reference is released
+    }
+    return 1;
+}
+
+}  // namespace
+
+void EnableTlsClientSessionCache(SSL_CTX* ctx) {
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+    SSL_CTX_sess_set_new_cb(ctx, &OnNewSession);
+}
+
+void ResumeTlsClientSession(SSL* ssl, const std::string& server_name) {
+    const SslSession session{GetSessionCache().Get(server_name)};
+    if (session) SSL_set_session(ssl, session.get());
+}
+
+void AccountTlsClientHandshake(SSL* ssl) noexcept { GetSessionCache().AccountHandshake(SSL_session_reused(ssl) == 1); }
+
+TlsClientHandshakeStats GetTlsClientHandshakeStats() noexcept { return GetSessionCache().GetStats(); }
+
+}  // namespace engine::io::impl
+
+USERVER_NAMESPACE_END
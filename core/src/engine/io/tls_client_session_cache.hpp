@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <openssl/ssl.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io::impl {
+
+struct TlsClientHandshakeStats final {
+    std::uint64_t handshakes{0};
+    std::uint64_t resumed{0};
+};
+
+/// Makes the new client sessions of `ctx` stored in the process-wide cache,
+/// keyed by the server name (SNI)
+void EnableTlsClientSessionCache(SSL_CTX* ctx);
+
+/// Makes `ssl` resume the cached session of the `server_name`, if any
+void ResumeTlsClientSession(SSL* ssl, const std::string& server_name);
+
+/// Accounts a successful client handshake of `ssl`
+void AccountTlsClientHandshake(SSL* ssl) noexcept;
+
+/// Process-wide statistics of TlsWrapper client handshakes
+TlsClientHandshakeStats GetTlsClientHandshakeStats() noexcept;
+
+}  // namespace engine::io::impl
+
+USERVER_NAMESPACE_END
@@ -1,20 +1,32 @@
 #include <userver/engine/io/tls_wrapper.hpp>
 
+#include <algorithm>
 #include <boost/stacktrace/stacktrace.hpp>
 #include <exception>
 #include <memory>
+#include <optional>
 
 #include <fmt/format.h>
 #include <openssl/bio.h>
 #include <openssl/ssl.h>
 
+#if defined(__linux__) && OPENSSL_VERSION_NUMBER >= 0x30000000L && !defined(OPENSSL_NO_KTLS)
+#define USERVER_IMPL_TLS_WRAPPER_KTLS
+#include <linux/tls.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#endif
+
 #include <userver/crypto/openssl.hpp>
 #include <userver/engine/io/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
 #include <crypto/helpers.hpp>
 #include <engine/io/fd_control.hpp>
+#include <engine/io/tls_client_session_cache.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -60,15 +72,108 @@ struct SocketBioData {
     Socket socket;
     Deadline current_deadline;
     std::exception_ptr last_exception;
+    bool is_ktls_send_enabled{false};
+    // Set by OpenSSL for the non-application records, e.g. alerts
+    std::optional<unsigned char> ktls_record_type;
 };
 
+#ifdef USERVER_IMPL_TLS_WRAPPER_KTLS
+// OpenSSL passes kernel TLS controls to the BIO with internal codes,
+// see include/internal/bio.h in OpenSSL sources
+constexpr int kBioCtrlSetKtls = 72;
+constexpr int kBioCtrlSetKtlsTxSendCtrlMsg = 74;
+constexpr int kBioCtrlClearKtlsTxCtrlMsg = 75;
+
+#ifndef SOL_TLS
+constexpr int SOL_TLS = 282;
+#endif
+#ifndef TCP_ULP
+constexpr int TCP_ULP = 31;
+#endif
+
+// OpenSSL crypto info starts with the kernel crypto info for the cipher
+std::optional<socklen_t> GetKtlsCryptoInfoSize(const void* crypto_info) noexcept {
+    switch (static_cast<const tls_crypto_info*>(crypto_info)->cipher_type) {
+        case TLS_CIPHER_AES_GCM_128:
+            return sizeof(tls12_crypto_info_aes_gcm_128);
+#ifdef TLS_CIPHER_AES_GCM_256
+        case TLS_CIPHER_AES_GCM_256:
+            return sizeof(tls12_crypto_info_aes_gcm_256);
+#endif
+#ifdef TLS_CIPHER_CHACHA20_POLY1305
+        case TLS_CIPHER_CHACHA20_POLY1305:
+            return sizeof(tls12_crypto_info_chacha20_poly1305);
+#endif
+        default:
+            return std::nullopt;
+    }
+}
+
+// Only the transmit direction is offloaded: kTLS RX requires
+// reconstructing non-application records from the cmsg record types.
+long StartKtlsSend(SocketBioData& bio_data, const void* crypto_info) noexcept {
+    const auto crypto_info_size = GetKtlsCryptoInfoSize(crypto_info);
+    if (!crypto_info_size) return 0;
+
+    const auto fd = bio_data.socket.Fd();
+    // Fails if the tls kernel module is not loaded, OpenSSL falls back to
+    // the userspace encryption then
+    if (::setsockopt(fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) != 0) return 0;
+    if (::setsockopt(fd, SOL_TLS, TLS_TX, crypto_info, *crypto_info_size) != 0) return 0;
+
+    bio_data.is_ktls_send_enabled = true;
+    return 1;
+}
+
+std::size_t SendKtlsControlRecord(SocketBioData& bio_data, const char* data, std::size_t len) {
+    UASSERT(bio_data.ktls_record_type);
+
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(unsigned char))]{};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    iovec iov{const_cast<char*>(data), len};
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    auto* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_TLS;
+    cmsg->cmsg_type = TLS_SET_RECORD_TYPE;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(unsigned char));
+    *CMSG_DATA(cmsg) = *bio_data.ktls_record_type;
+
+    while (true) {
+        const auto ret = ::sendmsg(bio_data.socket.Fd(), &msg, MSG_NOSIGNAL);
+        if (ret >= 0) return ret;
+
+        const auto error_code = errno;
+        if (error_code == EINTR) continue;
+        if (error_code != EAGAIN && error_code != EWOULDBLOCK) {
+            throw IoSystemError(error_code, "SendKtlsControlRecord");
+        }
+        if (!bio_data.socket.WaitWriteable(bio_data.current_deadline)) {
+            if (current_task::ShouldCancel()) throw IoCancelled(0);
+            throw IoTimeout(0);
+        }
+    }
+}
+#endif
+
 int SocketBioWriteEx(BIO* bio, const char* data, size_t len, size_t* bytes_written) noexcept {
     auto* bio_data = static_cast<SocketBioData*>(BIO_get_data(bio));
     UASSERT(bio_data);
     UASSERT(bytes_written);
 
     try {
-        *bytes_written = bio_data->socket.SendAll(data, len, bio_data->current_deadline);
+#ifdef USERVER_IMPL_TLS_WRAPPER_KTLS
+        if (bio_data->ktls_record_type) {
+            *bytes_written = SendKtlsControlRecord(*bio_data, data, len);
+        } else
+#endif
+        {
+            *bytes_written = bio_data->socket.SendAll(data, len, bio_data->current_deadline);
+        }
         BIO_clear_retry_flags(bio);
         if (bio_data->last_exception) bio_data->last_exception = {};
         if (*bytes_written) return 1;  // success
@@ -101,11 +206,31 @@ int SocketBioReadEx(BIO* bio, char* data, size_t len, size_t* bytes_read) noexce
     return 0;
 }
 
-long SocketBioControl(BIO*, int cmd, long, void*) noexcept {
+long SocketBioControl([[maybe_unused]] BIO* bio, int cmd, [[maybe_unused]] long num, [[maybe_unused]] void* ptr) noexcept {
     if (cmd == BIO_CTRL_FLUSH) {
         // ignore for Socket
         return 1;
     }
+
+#ifdef USERVER_IMPL_TLS_WRAPPER_KTLS
+    auto* bio_data = static_cast<SocketBioData*>(BIO_get_data(bio));
+    UASSERT(bio_data);
+    switch (cmd) {
+        case kBioCtrlSetKtls:
+            // `num` is non-zero for the transmit direction
+            return num ? StartKtlsSend(*bio_data, ptr) : 0;
+        case BIO_CTRL_GET_KTLS_SEND:
+            return bio_data->is_ktls_send_enabled ? 1 : 0;
+        case kBioCtrlSetKtlsTxSendCtrlMsg:
+            bio_data->ktls_record_type = static_cast<unsigned char>(num);
+            return 0;
+        case kBioCtrlClearKtlsTxCtrlMsg:
+            bio_data->ktls_record_type.reset();
+            return 0;
+        default:
+            break;
+    }
+#endif
     return 0;
 }
 
@@ -304,7 +429,7 @@ public:
         [[maybe_unused]] const auto* disowned_bio = socket_bio.release();
     }
 
-    void ClientConnect(const std::string& server_name, Deadline deadline) {
+    void ClientConnect(const std::string& server_name, bool resume_session, Deadline deadline) {
         if (!server_name.empty()) {
             // cast in openssl1.0 macro expansion
             // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
@@ -313,6 +438,7 @@ public:
                     crypto::FormatSslError("Failed to set up client TLS wrapper: SSL_set_tlsext_host_name")
                 );
             }
+            if (resume_session) impl::ResumeTlsClientSession(ssl.get(), server_name);
         }
 
         bio_data.current_deadline = deadline;
@@ -327,6 +453,7 @@ public:
                 fmt::format("Failed to set up client TLS wrapper ({})", SSL_get_error(ssl.get(), ret))
             ));
         }
+        impl::AccountTlsClientHandshake(ssl.get());
     }
 
     template <typename SslIoFunc>
@@ -456,10 +583,14 @@ TlsWrapper::TlsWrapper(Socket&& socket) : impl_(std::move(socket)) { SetupContex
 TlsWrapper TlsWrapper::StartTlsClient(Socket&& socket, const std::string& server_name, Deadline deadline) {
     auto ssl_ctx = MakeSslCtx();
     SetServerName(ssl_ctx, server_name);
+    // Sessions are keyed by the server name only, so they are not cached for
+    // the clients with certificates or extra authorities
+    const bool resume_session = !server_name.empty();
+    if (resume_session) impl::EnableTlsClientSessionCache(ssl_ctx.get());
 
     TlsWrapper wrapper{std::move(socket)};
     wrapper.impl_->SetUp(std::move(ssl_ctx));
-    wrapper.impl_->ClientConnect(server_name, deadline);
+    wrapper.impl_->ClientConnect(server_name, resume_session, deadline);
     return wrapper;
 }
 
@@ -492,7 +623,7 @@ TlsWrapper TlsWrapper::StartTlsClient(
 
     TlsWrapper wrapper{std::move(socket)};
     wrapper.impl_->SetUp(std::move(ssl_ctx));
-    wrapper.impl_->ClientConnect(server_name, deadline);
+    wrapper.impl_->ClientConnect(server_name, /*resume_session=*/false, deadline);
     return wrapper;
 }
 
@@ -501,7 +632,8 @@ TlsWrapper TlsWrapper::StartTlsServer(
     const crypto::CertificatesChain& cert_chain,
     const crypto::PrivateKey& key,
     Deadline deadline,
-    const std::vector<crypto::Certificate>& extra_cert_authorities
+    const std::vector<crypto::Certificate>& extra_cert_authorities,
+    bool enable_kernel_tls
 ) {
     auto ssl_ctx = MakeSslCtx();
 
@@ -542,6 +674,12 @@ TlsWrapper TlsWrapper::StartTlsServer(
         throw TlsException(crypto::FormatSslError("Failed to set up server TLS wrapper: SSL_CTX_use_PrivateKey"));
     }
 
+    if (enable_kernel_tls) {
+#ifdef USERVER_IMPL_TLS_WRAPPER_KTLS
+        SSL_CTX_set_options(ssl_ctx.get(), SSL_OP_ENABLE_KTLS);
+#endif
+    }
+
     TlsWrapper wrapper{std::move(socket)};
     wrapper.impl_->SetUp(std::move(ssl_ctx));
     wrapper.impl_->bio_data.current_deadline = deadline;
@@ -582,6 +720,8 @@ void TlsWrapper::SetupContextAccessors() {
 
 bool TlsWrapper::IsValid() const { return impl_->ssl && !impl_->is_in_shutdown; }
 
+bool TlsWrapper::IsKernelTlsSendEnabled() const noexcept { return impl_->bio_data.is_ktls_send_enabled; }
+
 bool TlsWrapper::WaitReadable(Deadline deadline) {
     impl_->CheckAlive();
     char buf = 0;
@@ -622,50 +762,60 @@ size_t TlsWrapper::SendAll(const void* buf, size_t len, Deadline deadline) {
     );
 }
 
-[[nodiscard]] size_t TlsWrapper::WriteAll(std::initializer_list<IoData> list, Deadline deadline) {
+size_t TlsWrapper::SendAll(std::initializer_list<IoData> list, Deadline deadline) {
+    return SendAll(list.begin(), list.size(), deadline);
+}
+
+size_t TlsWrapper::SendAll(const IoData* list, std::size_t list_size, Deadline deadline) {
+    if (impl_->bio_data.is_ktls_send_enabled) {
+        impl_->CheckAlive();
+        // The kernel does the encryption, the buffers go straight to the socket
+        return impl_->bio_data.socket.SendAll(list, list_size, deadline);
+    }
+
+    // Every SSL_write produces at least one record and a socket write. Small
+    // buffers are coalesced together with the head of the following buffer,
+    // large ones are encrypted straight from the user memory.
     static constexpr std::size_t kBufSize = 4'096;
     std::byte buf[kBufSize];
+    std::size_t buffered = 0;
 
     std::size_t sent_bytes = 0;
-    std::size_t remaining_cap = kBufSize;
-    auto fits_in_buf_begin = list.begin();
-    for (auto it = fits_in_buf_begin; it != list.end(); ++it) {
-        if (it->len > remaining_cap) {
-            if (it - fits_in_buf_begin >= 2) {
-                for (auto* ins_pos = buf; fits_in_buf_begin != it; ++fits_in_buf_begin) {
-                    ins_pos = std::copy_n(
-                        static_cast<const std::byte*>(fits_in_buf_begin->data), fits_in_buf_begin->len, ins_pos
-                    );
-                }
-                sent_bytes += SendAll(buf, kBufSize - remaining_cap, deadline);
-            } else if (fits_in_buf_begin != it) {
-                sent_bytes += SendAll(fits_in_buf_begin->data, fits_in_buf_begin->len, deadline);
-                fits_in_buf_begin = it;
-            }
-
-            remaining_cap = kBufSize;
-            if (it->len < remaining_cap) {
-                remaining_cap -= it->len;
-            } else {
-                sent_bytes += SendAll(it->data, it->len, deadline);
-                ++fits_in_buf_begin;
+    for (std::size_t i = 0; i < list_size; ++i) {
+        const auto* data = static_cast<const std::byte*>(list[i].data);
+        auto len = list[i].len;
+
+        if (buffered != 0) {
+            const auto chunk = std::min(len, kBufSize - buffered);
+            std::copy_n(data, chunk, buf + buffered);
+            buffered += chunk;
+            data += chunk;
+            len -= chunk;
+            if (buffered == kBufSize) {
+                sent_bytes += SendAll(buf, buffered, deadline);
+                buffered = 0;
             }
+        }
 
-        } else {
-            remaining_cap -= it->len;
+        if (len >= kBufSize) {
+            sent_bytes += SendAll(data, len, deadline);
+        } else if (len != 0) {
+            std::copy_n(data, len, buf);
+            buffered = len;
         }
     }
 
-    auto ins_pos = buf;
-    for (auto ins_it = fits_in_buf_begin; ins_it != list.end(); ++ins_it) {
-        ins_pos = std::copy_n(static_cast<const std::byte*>(ins_it->data), ins_it->len, ins_pos);
+    if (buffered != 0) {
+        sent_bytes += SendAll(buf, buffered, deadline);
     }
-    sent_bytes += SendAll(buf, kBufSize - remaining_cap, deadline);
-
     return sent_bytes;
 }
 
 Socket TlsWrapper::StopTls(Deadline deadline) {
+    if (impl_->bio_data.is_ktls_send_enabled) {
+        // The kernel would keep encrypting the data sent to the socket
+        throw TlsException("Cannot stop TLS on a socket with kernel TLS offload");
+    }
     if (impl_->ssl) {
         impl_->is_in_shutdown = true;
         impl_->bio_data.current_deadline = deadline;
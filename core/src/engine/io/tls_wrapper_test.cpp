@@ -331,6 +331,82 @@ UTEST(TlsWrapper, InitListSmallThenLarge) {
     EXPECT_EQ(result, kStringSmall + kStringSmall + kStringSmall + kStringSmall + kStringLarge);
 }
 
+UTEST(TlsWrapper, IoDataHeaderThenBody) {
+    const std::string kHeader(300, 'h');
+    const std::string kBody(100'000, 'b');
+    const std::vector<engine::io::IoData> kData{
+        {kHeader.data(), kHeader.size()}, {kBody.data(), kBody.size()}, {kHeader.data(), kHeader.size()}};
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    TcpListener tcp_listener;
+    auto [server, client] = tcp_listener.MakeSocketPair(deadline);
+
+    auto server_task = utils::Async(
+        "tls-server",
+        [deadline, &kData, &kHeader, &kBody](auto&& server) {
+            auto tls_server = io::TlsWrapper::StartTlsServer(
+                std::forward<decltype(server)>(server),
+                crypto::LoadCertificatesChainFromString(cert),
+                crypto::PrivateKey::LoadFromString(key),
+                deadline
+            );
+            if (tls_server.SendAll(kData.data(), kData.size(), deadline) != kHeader.size() * 2 + kBody.size()) {
+                throw std::runtime_error("Couldn't send data");
+            }
+        },
+        std::move(server)
+    );
+
+    auto tls_client = io::TlsWrapper::StartTlsClient(std::move(client), {}, deadline);
+    std::vector<char> buffer(kHeader.size() * 2 + kBody.size());
+    auto bytes_rcvd = tls_client.RecvAll(buffer.data(), buffer.size(), deadline);
+
+    server_task.Get();
+    const std::string result(buffer.data(), bytes_rcvd);
+    EXPECT_EQ(result, kHeader + kBody + kHeader);
+}
+
+UTEST(TlsWrapper, KernelTlsOffload) {
+    const std::string kHeader(300, 'h');
+    const std::string kBody(100'000, 'b');
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    TcpListener tcp_listener;
+    auto [server, client] = tcp_listener.MakeSocketPair(deadline);
+
+    auto server_task = utils::Async(
+        "tls-server",
+        [deadline, &kHeader, &kBody](auto&& server) {
+            auto tls_server = io::TlsWrapper::StartTlsServer(
+                std::forward<decltype(server)>(server),
+                crypto::LoadCertificatesChainFromString(cert),
+                crypto::PrivateKey::LoadFromString(key),
+                deadline,
+                {},
+                /*enable_kernel_tls=*/true
+            );
+            // Falls back to the userspace encryption if kTLS is not available
+            LOG_INFO() << "Kernel TLS send enabled: " << tls_server.IsKernelTlsSendEnabled();
+            if (tls_server.WriteAll({{kHeader.data(), kHeader.size()}, {kBody.data(), kBody.size()}}, deadline) !=
+                kHeader.size() + kBody.size()) {
+                throw std::runtime_error("Couldn't send data");
+            }
+            if (tls_server.IsKernelTlsSendEnabled()) {
+                UEXPECT_THROW([[maybe_unused]] auto socket = tls_server.StopTls(deadline), io::TlsException);
+            }
+        },
+        std::move(server)
+    );
+
+    auto tls_client = io::TlsWrapper::StartTlsClient(std::move(client), {}, deadline);
+    std::vector<char> buffer(kHeader.size() + kBody.size());
+    auto bytes_rcvd = tls_client.RecvAll(buffer.data(), buffer.size(), deadline);
+
+    server_task.Get();
+    const std::string result(buffer.data(), bytes_rcvd);
+    EXPECT_EQ(result, kHeader + kBody);
+}
+
 UTEST_MT(TlsWrapper, Smoke, 2) {
     const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
 
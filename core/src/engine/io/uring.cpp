@@ -0,0 +1,307 @@
+#include <engine/io/uring.hpp>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <mutex>
+#include <shared_mutex>
+#include <system_error>
+
+#include <engine/ev/watcher.hpp>
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_pools.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/semaphore.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/current_task.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <utils/check_syscall.hpp>
+
+// IORING_FEAT_RW_CUR_POS came with the opcodes used below in Linux 5.6
+#if defined(IORING_FEAT_RW_CUR_POS) && defined(__NR_io_uring_setup)
+#define USERVER_IMPL_HAS_FILE_URING 1
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io::impl {
+
+#ifdef USERVER_IMPL_HAS_FILE_URING
+
+namespace {
+
+// keeps the result representable as int
+constexpr std::size_t kMaxIoSize = 1 << 30;
+
+}  // namespace
+
+class Uring::Impl final {
+public:
+    Impl(std::uint32_t entries, ev::ThreadControl& ev_thread);
+    ~Impl();
+
+    int Perform(io_uring_sqe& sqe);
+
+private:
+    struct Operation final {
+        int result{0};
+        engine::SingleConsumerEvent completed;
+    };
+
+    static void OnCompletions(struct ev_loop*, ev_io* io, int events) noexcept;
+    void ReapCompletions() noexcept;
+    void Release() noexcept;
+
+    ev::Watcher<ev_io> watcher_;
+    int ring_fd_{-1};
+    int event_fd_{-1};
+    void* ring_{nullptr};
+    std::size_t ring_size_{0};
+    io_uring_sqe* sqes_{nullptr};
+    std::size_t sqes_size_{0};
+
+    std::uint32_t* sq_head_{nullptr};
+    std::uint32_t* sq_tail_{nullptr};
+    std::uint32_t sq_mask_{0};
+    std::uint32_t* sq_array_{nullptr};
+    std::uint32_t* cq_head_{nullptr};
+    std::uint32_t* cq_tail_{nullptr};
+    std::uint32_t cq_mask_{0};
+    io_uring_cqe* cqes_{nullptr};
+
+    // The completion queue is twice as large, so it never overflows
+    engine::Semaphore in_flight_;
+    engine::Mutex submit_mutex_;
+};
+
+Uring::Impl::Impl(std::uint32_t entries, ev::ThreadControl& ev_thread)
+    : watcher_(ev_thread, this), in_flight_(entries) {
+    io_uring_params params{};
+    ring_fd_ = utils::CheckSyscall(
+        static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params)), "setting up io_uring"
+    );
+
+    try {
+        if (!(params.features & IORING_FEAT_SINGLE_MMAP) || !(params.features & IORING_FEAT_RW_CUR_POS)) {
+            throw std::system_error(ENOSYS, std::generic_category(), "io_uring of Linux 5.6+ is required");
+        }
+
+        ring_size_ = std::max<std::size_t>(
+            params.sq_off.array + params.sq_entries * sizeof(std::uint32_t),
+            params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe)
+        );
+        ring_ = utils::CheckSyscallNotEquals(
+            ::mmap(
+                nullptr, ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING
+            ),
+            MAP_FAILED,
+            "mapping the io_uring rings"
+        );
+        sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+        sqes_ = static_cast<io_uring_sqe*>(utils::CheckSyscallNotEquals(
+            ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES),
+            MAP_FAILED,
+            "mapping the io_uring submission entries"
+        ));
+
+        event_fd_ = utils::CheckSyscall(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC), "creating an eventfd");
+        utils::CheckSyscall(
+            ::syscall(__NR_io_uring_register, ring_fd_, IORING_REGISTER_EVENTFD, &event_fd_, 1),
+            "registering the io_uring eventfd"
+        );
+    } catch (const std::exception&) {
+        Release();
+        throw;
+    }
+
+    auto* ring = static_cast<char*>(ring_);
+    sq_head_ = reinterpret_cast<std::uint32_t*>(ring + params.sq_off.head);
+    sq_tail_ = reinterpret_cast<std::uint32_t*>(ring + params.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<std::uint32_t*>(ring + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<std::uint32_t*>(ring + params.sq_off.array);
+    cq_head_ = reinterpret_cast<std::uint32_t*>(ring + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<std::uint32_t*>(ring + params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<std::uint32_t*>(ring + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe*>(ring + params.cq_off.cqes);
+
+    watcher_.Init(&Impl::OnCompletions, event_fd_, EV_READ);
+    watcher_.StartAsync();
+}
+
+Uring::Impl::~Impl() {
+    watcher_.Stop();
+    UASSERT_MSG(in_flight_.UsedApprox() == 0, "io_uring is destroyed with operations in flight");
+    Release();
+}
+
+int Uring::Impl::Perform(io_uring_sqe& sqe) {
+    const std::shared_lock in_flight_lock{in_flight_};
+
+    Operation operation;
+    sqe.user_data = reinterpret_cast<std::uintptr_t>(&operation);
+    {
+        const std::lock_guard lock{submit_mutex_};
+        // the tail is only written under the mutex
+        const auto tail = *sq_tail_;
+        const auto index = tail & sq_mask_;
+        sqes_[index] = sqe;
+        sq_array_[index] = index;
+        __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+
+        long submitted = 0;
+        do {
+            submitted = ::syscall(__NR_io_uring_enter, ring_fd_, 1, 0, 0, nullptr, 0);
+        } while (submitted == -1 && errno == EINTR);
+
+        if (submitted == -1 && __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) == tail) {
+            const auto error = errno;
+            // the kernel has not consumed the entry, withdraw it
+            __atomic_store_n(sq_tail_, tail, __ATOMIC_RELEASE);
+            return -error;
+        }
+    }
+
+    // the kernel uses the buffers of the operation until its completion
+    const engine::TaskCancellationBlocker cancellation_blocker;
+    [[maybe_unused]] const bool is_completed = operation.completed.WaitForEvent();
+    UASSERT(is_completed);
+    return operation.result;
+}
+
+void Uring::Impl::OnCompletions(struct ev_loop*, ev_io* io, int) noexcept {
+    static_cast<Impl*>(io->data)->ReapCompletions();
+}
+
+void Uring::Impl::ReapCompletions() noexcept {
+    std::uint64_t counter = 0;
+    [[maybe_unused]] const auto read_res = ::read(event_fd_, &counter, sizeof(counter));
+
+    auto head = *cq_head_;
+    const auto tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+    for (; head != tail; ++head) {
+        const auto& cqe = cqes_[head & cq_mask_];
+        auto* operation = reinterpret_cast<Operation*>(static_cast<std::uintptr_t>(cqe.user_data));
+        operation->result = cqe.res;
+        // the operation may be destroyed right after that
+        operation->completed.Send();
+    }
+    __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+}
+
+void Uring::Impl::Release() noexcept {
+    if (event_fd_ != -1) ::close(event_fd_);
+    if (sqes_) ::munmap(sqes_, sqes_size_);
+    if (ring_) ::munmap(ring_, ring_size_);
+    ::close(ring_fd_);
+}
+
+std::unique_ptr<Uring> Uring::TryCreate(std::uint32_t entries, ev::ThreadControl& ev_thread) {
+    try {
+        return std::unique_ptr<Uring>(new Uring(std::make_unique<Impl>(entries, ev_thread)));
+    } catch (const std::system_error& e) {
+        LOG_WARNING() << "io_uring is not available, file operations are performed on the blocking task processors: "
+                      << e;
+        return nullptr;
+    }
+}
+
+int Uring::OpenAt(int dir_fd, const char* path, int flags, mode_t mode) {
+    io_uring_sqe sqe{};
+    sqe.opcode = IORING_OP_OPENAT;
+    sqe.fd = dir_fd;
+    sqe.addr = reinterpret_cast<std::uintptr_t>(path);
+    sqe.len = mode;
+    sqe.open_flags = static_cast<std::uint32_t>(flags);
+    return impl_->Perform(sqe);
+}
+
+int Uring::Close(int fd) {
+    io_uring_sqe sqe{};
+    sqe.opcode = IORING_OP_CLOSE;
+    sqe.fd = fd;
+    return impl_->Perform(sqe);
+}
+
+int Uring::Read(int fd, void* buf, std::size_t len, std::uint64_t offset) {
+    io_uring_sqe sqe{};
+    sqe.opcode = IORING_OP_READ;
+    sqe.fd = fd;
+    sqe.addr = reinterpret_cast<std::uintptr_t>(buf);
+    sqe.len = static_cast<std::uint32_t>(std::min<std::size_t>(len, kMaxIoSize));
+    sqe.off = offset;
+    return impl_->Perform(sqe);
+}
+
+int Uring::Write(int fd, const void* buf, std::size_t len, std::uint64_t offset) {
+    io_uring_sqe sqe{};
+    sqe.opcode = IORING_OP_WRITE;
+    sqe.fd = fd;
+    sqe.addr = reinterpret_cast<std::uintptr_t>(buf);
+    sqe.len = static_cast<std::uint32_t>(std::min<std::size_t>(len, kMaxIoSize));
+    sqe.off = offset;
+    return impl_->Perform(sqe);
+}
+
+int Uring::Fsync(int fd) {
+    io_uring_sqe sqe{};
+    sqe.opcode = IORING_OP_FSYNC;
+    sqe.fd = fd;
+    return impl_->Perform(sqe);
+}
+
+int Uring::Statx(int dir_fd, const char* path, int flags, unsigned mask, struct statx* buf) {
+    io_uring_sqe sqe{};
+    sqe.opcode = IORING_OP_STATX;
+    sqe.fd = dir_fd;
+    sqe.addr = reinterpret_cast<std::uintptr_t>(path);
+    sqe.len = mask;
+    sqe.off = reinterpret_cast<std::uintptr_t>(buf);
+    sqe.statx_flags = static_cast<std::uint32_t>(flags);
+    return impl_->Perform(sqe);
+}
+
+#else
+
+class Uring::Impl final {};
+
+std::unique_ptr<Uring> Uring::TryCreate(std::uint32_t, ev::ThreadControl&) {
+    LOG_WARNING() << "io_uring is not supported by the platform, file operations are performed on the blocking task "
+                     "processors";
+    return nullptr;
+}
+
+int Uring::OpenAt(int, const char*, int, mode_t) { return -ENOSYS; }
+
+int Uring::Close(int) { return -ENOSYS; }
+
+int Uring::Read(int, void*, std::size_t, std::uint64_t) { return -ENOSYS; }
+
+int Uring::Write(int, const void*, std::size_t, std::uint64_t) { return -ENOSYS; }
+
+int Uring::Fsync(int) { return -ENOSYS; }
+
+int Uring::Statx(int, const char*, int, unsigned, struct statx*) { return -ENOSYS; }
+
+#endif
+
+Uring::Uring(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+Uring::~Uring() = default;
+
+Uring* GetCurrentFileUring() noexcept {
+    if (!current_task::IsTaskProcessorThread()) return nullptr;
+    return current_task::GetTaskProcessor().GetTaskProcessorPools()->GetFileUring();
+}
+
+}  // namespace engine::io::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <sys/types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <engine/ev/thread_control.hpp>
+
+struct statx;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io::impl {
+
+/// @brief io_uring instance for the regular file operations of coroutines.
+///
+/// An operation suspends the coroutine until the kernel posts its completion,
+/// the completions are reaped by an ev thread that is woken up via an eventfd.
+/// No fs-task-processor thread is blocked meanwhile.
+///
+/// The methods return the result of the corresponding syscall on success or
+/// -errno on failure, like the kernel does. The operations are not cancellable:
+/// the buffers are used by the kernel until the completion.
+class Uring final {
+public:
+    /// @returns nullptr if io_uring is not supported by the platform or the
+    /// kernel (Linux 5.6+ is required)
+    static std::unique_ptr<Uring> TryCreate(std::uint32_t entries, ev::ThreadControl& ev_thread);
+
+    ~Uring();
+
+    Uring(const Uring&) = delete;
+    Uring& operator=(const Uring&) = delete;
+
+    int OpenAt(int dir_fd, const char* path, int flags, mode_t mode);
+    int Close(int fd);
+    int Read(int fd, void* buf, std::size_t len, std::uint64_t offset);
+    int Write(int fd, const void* buf, std::size_t len, std::uint64_t offset);
+    int Fsync(int fd);
+    int Statx(int dir_fd, const char* path, int flags, unsigned mask, struct statx* buf);
+
+private:
+    class Impl;
+
+    explicit Uring(std::unique_ptr<Impl> impl);
+
+    std::unique_ptr<Impl> impl_;
+};
+
+/// @returns the io_uring of the current task processor or nullptr if the file
+/// operations must be performed on a blocking task processor
+Uring* GetCurrentFileUring() noexcept;
+
+}  // namespace engine::io::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,87 @@
+#include <engine/io/uring.hpp>
+
+#include <fcntl.h>
+
+#include <cerrno>
+#include <string>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/current_task.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/read.hpp>
+#include <userver/fs/write.hpp>
+#include <userver/utest/utest.hpp>
+
+#include <engine/coro/pool_config.hpp>
+#include <engine/ev/thread_pool_config.hpp>
+#include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor_pools.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+engine::impl::TaskProcessorHolder MakeTaskProcessorWithUring() {
+    engine::ev::ThreadPoolConfig ev_config;
+    ev_config.threads = 1;
+    ev_config.file_io_uring_entries = 4;
+
+    auto pools = std::make_shared<engine::impl::TaskProcessorPools>(engine::coro::PoolConfig{}, std::move(ev_config));
+    return engine::impl::TaskProcessorHolder::Make(2, "uring-worker", std::move(pools));
+}
+
+}  // namespace
+
+TEST(FileUring, RewriteAndRead) {
+    auto task_processor = MakeTaskProcessorWithUring();
+
+    engine::impl::RunOnTaskProcessorSync(*task_processor, [] {
+        if (!engine::io::impl::GetCurrentFileUring()) GTEST_SKIP() << "io_uring is not available";
+
+        const auto dir = fs::blocking::TempDirectory::Create();
+        const auto path = dir.GetPath() + "/file";
+        auto& blocking_tp = engine::current_task::GetTaskProcessor();
+
+        // larger than the initial read size
+        const std::string contents(200 * 1024, 'a');
+        fs::RewriteFileContents(blocking_tp, path, contents);
+        EXPECT_EQ(fs::blocking::ReadFileContents(path), contents);
+        EXPECT_EQ(fs::ReadFileContents(blocking_tp, path), contents);
+
+        fs::RewriteFileContents(blocking_tp, path, "");
+        EXPECT_EQ(fs::ReadFileContents(blocking_tp, path), "");
+
+        UEXPECT_THROW(fs::ReadFileContents(blocking_tp, dir.GetPath() + "/missing"), std::runtime_error);
+    });
+}
+
+TEST(FileUring, MoreOperationsThanEntries) {
+    auto task_processor = MakeTaskProcessorWithUring();
+
+    engine::impl::RunOnTaskProcessorSync(*task_processor, [] {
+        auto* uring = engine::io::impl::GetCurrentFileUring();
+        if (!uring) GTEST_SKIP() << "io_uring is not available";
+
+        const auto dir = fs::blocking::TempDirectory::Create();
+        std::vector<engine::TaskWithResult<void>> tasks;
+        for (int i = 0; i < 32; ++i) {
+            tasks.push_back(engine::AsyncNoSpan([uring, &dir, i] {
+                const auto path = dir.GetPath() + "/file" + std::to_string(i);
+                const int fd = uring->OpenAt(AT_FDCWD, path.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, 0600);
+                ASSERT_GE(fd, 0);
+                EXPECT_EQ(uring->Write(fd, path.data(), path.size(), 0), static_cast<int>(path.size()));
+                EXPECT_EQ(uring->Fsync(fd), 0);
+                EXPECT_EQ(uring->Close(fd), 0);
+                EXPECT_EQ(fs::blocking::ReadFileContents(path), path);
+            }));
+        }
+        engine::WaitAllChecked(tasks);
+
+        EXPECT_EQ(uring->Close(-1), -EBADF);
+    });
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,104 @@
+#include <userver/engine/reader_biased_shared_mutex.hpp>
+
+#include <algorithm>
+#include <mutex>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+// Readers usually leave within a few context switches
+constexpr std::size_t kDrainYields = 16;
+constexpr std::chrono::microseconds kDrainMinSleep{10};
+constexpr std::chrono::microseconds kDrainMaxSleep{1000};
+
+}  // namespace
+
+ReaderBiasedSharedMutex::ReaderBiasedSharedMutex() = default;
+
+ReaderBiasedSharedMutex::~ReaderBiasedSharedMutex() = default;
+
+void ReaderBiasedSharedMutex::lock() {
+    writer_mutex_.lock();
+    is_writer_pending_.store(true);
+    // pairs with the fence in TryLockSharedFastPath: either the reader sees the
+    // pending writer, or we see the reader in WaitForReaders
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    [[maybe_unused]] const bool drained = WaitForReaders(Deadline{});
+    UASSERT(drained);
+}
+
+void ReaderBiasedSharedMutex::unlock() {
+    is_writer_pending_.store(false);
+    writer_mutex_.unlock();
+}
+
+bool ReaderBiasedSharedMutex::try_lock() { return try_lock_until(Deadline::Passed()); }
+
+bool ReaderBiasedSharedMutex::try_lock_until(Deadline deadline) {
+    if (!writer_mutex_.try_lock_until(deadline)) return false;
+    is_writer_pending_.store(true);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (WaitForReaders(deadline)) return true;
+    unlock();
+    return false;
+}
+
+void ReaderBiasedSharedMutex::lock_shared() {
+    if (TryLockSharedFastPath()) return;
+
+    // a writer holds writer_mutex_ until it unlocks, new writers can't set
+    // is_writer_pending_ while we hold it
+    const std::lock_guard lock{writer_mutex_};
+    readers_.DoLock();
+}
+
+void ReaderBiasedSharedMutex::unlock_shared() { readers_.DoUnlock(); }
+
+bool ReaderBiasedSharedMutex::try_lock_shared() { return TryLockSharedFastPath(); }
+
+bool ReaderBiasedSharedMutex::try_lock_shared_until(Deadline deadline) {
+    if (TryLockSharedFastPath()) return true;
+
+    if (!writer_mutex_.try_lock_until(deadline)) return false;
+    const std::lock_guard lock{writer_mutex_, std::adopt_lock};
+    readers_.DoLock();
+    return true;
+}
+
+bool ReaderBiasedSharedMutex::TryLockSharedFastPath() noexcept {
+    readers_.DoLock();
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!is_writer_pending_.load(std::memory_order_relaxed)) return true;
+
+    // let the writer drain the readers
+    readers_.DoUnlock();
+    return false;
+}
+
+bool ReaderBiasedSharedMutex::WaitForReaders(Deadline deadline) {
+    // StripedReadIndicator does not signal the free-ness, so it is polled
+    auto sleep_duration = kDrainMinSleep;
+    for (std::size_t attempt = 0; !readers_.IsFree(); ++attempt) {
+        if (deadline.IsReached()) return false;
+
+        if (attempt < kDrainYields) {
+            engine::Yield();
+        } else {
+            engine::SleepUntil(std::min(deadline, Deadline::FromDuration(sleep_duration)));
+            sleep_duration = std::min(sleep_duration * 2, kDrainMaxSleep);
+        }
+    }
+    return true;
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,147 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/reader_biased_shared_mutex.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(ReaderBiasedSharedMutex, SharedLockUnlockDouble) {
+    engine::ReaderBiasedSharedMutex mutex;
+    mutex.lock_shared();
+    mutex.unlock_shared();
+
+    mutex.lock_shared();
+    mutex.unlock_shared();
+}
+
+UTEST(ReaderBiasedSharedMutex, SharedAndUniqueLock) {
+    engine::ReaderBiasedSharedMutex mutex;
+
+    std::unique_lock lock(mutex);
+    EXPECT_FALSE(mutex.try_lock_shared());
+    auto reader = utils::Async("", [&mutex] { const std::shared_lock reader_lock(mutex); });
+
+    reader.WaitFor(std::chrono::milliseconds(50));
+    EXPECT_FALSE(reader.IsFinished());
+
+    lock.unlock();
+
+    reader.WaitFor(utest::kMaxTestWaitTime);
+    EXPECT_TRUE(reader.IsFinished());
+    UEXPECT_NO_THROW(reader.Get());
+}
+
+UTEST(ReaderBiasedSharedMutex, UniqueAndSharedLock) {
+    engine::ReaderBiasedSharedMutex mutex;
+
+    std::shared_lock lock(mutex);
+    EXPECT_FALSE(mutex.try_lock());
+    EXPECT_FALSE(mutex.try_lock_for(std::chrono::milliseconds(10)));
+    // the failed writer does not block the readers
+    EXPECT_TRUE(mutex.try_lock_shared());
+    mutex.unlock_shared();
+
+    auto writer = utils::Async("", [&mutex] { const std::unique_lock writer_lock(mutex); });
+
+    writer.WaitFor(std::chrono::milliseconds(50));
+    EXPECT_FALSE(writer.IsFinished());
+
+    lock.unlock();
+
+    writer.WaitFor(utest::kMaxTestWaitTime);
+    EXPECT_TRUE(writer.IsFinished());
+    UEXPECT_NO_THROW(writer.Get());
+}
+
+UTEST_MT(ReaderBiasedSharedMutex, WritersDontStarve, 2) {
+    engine::ReaderBiasedSharedMutex mutex;
+    std::atomic<int> counter{0};
+    std::atomic<int> loaded{-1};
+
+    std::shared_lock lock(mutex);
+    auto writer = utils::Async("", [&mutex, &counter, &loaded] {
+        const std::unique_lock writer_lock(mutex);
+        loaded = counter.load();
+    });
+
+    writer.WaitFor(std::chrono::milliseconds(50));
+    EXPECT_FALSE(writer.IsFinished());
+
+    std::vector<engine::TaskWithResult<void>> readers;
+    for (int i = 0; i < 10; i++) {
+        readers.push_back(utils::Async("", [&counter, &mutex] {
+            const std::shared_lock reader_lock(mutex);
+            counter++;
+        }));
+    }
+
+    writer.WaitFor(std::chrono::milliseconds(50));
+    EXPECT_FALSE(writer.IsFinished());
+
+    lock.unlock();
+
+    writer.WaitFor(utest::kMaxTestWaitTime);
+    EXPECT_TRUE(writer.IsFinished());
+    engine::WaitAllChecked(readers);
+
+    EXPECT_EQ(loaded.load(), 0);
+    EXPECT_EQ(counter.load(), 10);
+}
+
+UTEST_MT(ReaderBiasedSharedMutex, ReadersSeeWrites, 4) {
+    engine::ReaderBiasedSharedMutex mutex;
+    // a non-atomic pair, torn reads are caught by the checks
+    std::uint64_t first = 0;
+    std::uint64_t second = 0;
+    std::atomic<bool> keep_running{true};
+
+    std::vector<engine::TaskWithResult<void>> readers;
+    for (int i = 0; i < 3; ++i) {
+        readers.push_back(engine::AsyncNoSpan([&] {
+            while (keep_running) {
+                const std::shared_lock lock(mutex);
+                ASSERT_EQ(first, second);
+            }
+        }));
+    }
+
+    for (std::uint64_t i = 1; i <= 100; ++i) {
+        const std::unique_lock lock(mutex);
+        first = i;
+        engine::Yield();
+        second = i;
+    }
+    keep_running = false;
+    engine::WaitAllChecked(readers);
+}
+
+UTEST(ReaderBiasedSharedMutex, Sample) {
+    /// [Sample engine::ReaderBiasedSharedMutex usage]
+    constexpr auto kTestString = "123";
+
+    engine::ReaderBiasedSharedMutex mutex;
+    std::string data;
+    {
+        const std::lock_guard lock(mutex);
+        // rare writes drain all the readers
+        data = kTestString;
+    }
+
+    {
+        const std::shared_lock lock(mutex);
+        // frequent reads touch only a per-CPU counter
+        ASSERT_EQ(data, kTestString);
+    }
+    /// [Sample engine::ReaderBiasedSharedMutex usage]
+}
+
+USERVER_NAMESPACE_END
@@ -21,16 +21,7 @@ void RunStandalone(
     const TaskProcessorPoolsConfig& config,
     utils::function_ref<void()> payload
 ) {
-    UINVARIANT(
-        !engine::current_task::IsTaskProcessorThread(), "RunStandalone must not be used alongside a running engine"
-    );
-    UINVARIANT(worker_threads != 0, "Unable to run anything using 0 threads");
-
-    auto task_processor_holder = engine::impl::TaskProcessorHolder::Make(
-        worker_threads, "coro-runner", engine::impl::MakeTaskProcessorPools(config)
-    );
-
-    engine::impl::RunOnTaskProcessorSync(*task_processor_holder, std::move(payload));
+    engine::impl::RunStandalone(worker_threads, config, ev::Backend::kDefault, std::move(payload));
 }
 
 }  // namespace engine
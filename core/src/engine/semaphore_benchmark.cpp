@@ -4,6 +4,7 @@
 #include <thread>
 
 #include <userver/engine/async.hpp>
+#include <userver/engine/fair_semaphore.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/semaphore.hpp>
 #include <userver/engine/sleep.hpp>
@@ -139,4 +140,57 @@ void semaphore_lock_unlock_st_coro_contention(benchmark::State& state) {
 }
 BENCHMARK(semaphore_lock_unlock_st_coro_contention)->RangeMultiplier(2)->Range(1, 1024);
 
+void fair_semaphore_lock_unlock_contention(benchmark::State& state) {
+    engine::RunStandalone(state.range(0), [&] {
+        engine::FairSemaphore sem{1};
+
+        RunParallelBenchmark(state, [&](auto& range) {
+            for ([[maybe_unused]] auto _ : range) {
+                sem.lock_shared();
+                sem.unlock_shared();
+            }
+        });
+    });
+}
+BENCHMARK(fair_semaphore_lock_unlock_contention)->RangeMultiplier(2)->Range(1, 32);
+
+void fair_semaphore_lock_unlock_coro_contention(benchmark::State& state) {
+    engine::RunStandalone(4, [&] {
+        engine::FairSemaphore sem{1};
+
+        RunParallelBenchmark(state, [&](auto& range) {
+            for ([[maybe_unused]] auto _ : range) {
+                sem.lock_shared();
+                sem.unlock_shared();
+            }
+        });
+    });
+}
+BENCHMARK(fair_semaphore_lock_unlock_coro_contention)->RangeMultiplier(2)->Range(1, 1024);
+
+void fair_semaphore_lock_unlock_mixed_priority_coro_contention(benchmark::State& state) {
+    engine::RunStandalone(4, [&] {
+        engine::FairSemaphore sem{1};
+        std::atomic<std::size_t> coro_index{0};
+
+        RunParallelBenchmark(state, [&](auto& range) {
+            // a quarter of the coroutines are latency-critical, the rest are background
+            const auto priority = coro_index++ % 4 == 0 ? engine::TaskPriority::kLatencyCritical
+                                                        : engine::TaskPriority::kBackground;
+            const engine::TaskPriorityScope priority_scope{priority};
+            for ([[maybe_unused]] auto _ : range) {
+                sem.lock_shared();
+                engine::Yield();
+                sem.unlock_shared();
+            }
+        });
+
+        const auto critical_view = sem.GetWaitTimeHistogram(engine::TaskPriority::kLatencyCritical).GetView();
+        const auto background_view = sem.GetWaitTimeHistogram(engine::TaskPriority::kBackground).GetView();
+        state.counters["critical_waits"] = static_cast<double>(critical_view.GetTotalCount());
+        state.counters["background_waits"] = static_cast<double>(background_view.GetTotalCount());
+    });
+}
+BENCHMARK(fair_semaphore_lock_unlock_mixed_priority_coro_contention)->RangeMultiplier(2)->Range(4, 1024);
+
 USERVER_NAMESPACE_END
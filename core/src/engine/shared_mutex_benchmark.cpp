@@ -1,16 +1,24 @@
 #include <benchmark/benchmark.h>
 
+#include <atomic>
+#include <chrono>
+
 #include <userver/engine/async.hpp>
+#include <userver/engine/reader_biased_shared_mutex.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/shared_mutex.hpp>
+#include <userver/engine/sleep.hpp>
 #include <utils/impl/parallelize_benchmark.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
-void shared_mutex_benchmark(benchmark::State& state) {
+namespace {
+
+template <typename SharedMutex>
+void SharedLockBenchmark(benchmark::State& state, bool with_writer) {
     engine::RunStandalone(state.range(0), [&] {
         int variable = 0;
-        engine::SharedMutex mutex;
+        SharedMutex mutex;
 
         auto initial_lock_holder = engine::AsyncNoSpan([&] {
             // ensure the locks are actually needed
@@ -18,14 +26,46 @@ void shared_mutex_benchmark(benchmark::State& state) {
             variable = 1;
         });
 
+        std::atomic<bool> keep_writing{with_writer};
+        auto writer = engine::AsyncNoSpan([&] {
+            while (keep_writing) {
+                engine::SleepFor(std::chrono::milliseconds{1});
+                std::unique_lock lock(mutex);
+                ++variable;
+            }
+        });
+
         RunParallelBenchmark(state, [&](auto& range) {
             for ([[maybe_unused]] auto _ : range) {
                 std::shared_lock lock(mutex);
                 benchmark::DoNotOptimize(variable);
             }
         });
+
+        keep_writing = false;
+        writer.Get();
     });
 }
-BENCHMARK(shared_mutex_benchmark)->DenseRange(1, 6);
+
+}  // namespace
+
+void shared_mutex_benchmark(benchmark::State& state) { SharedLockBenchmark<engine::SharedMutex>(state, false); }
+BENCHMARK(shared_mutex_benchmark)->DenseRange(1, 6)->Arg(16)->Arg(32)->Arg(64);
+
+void reader_biased_shared_mutex_benchmark(benchmark::State& state) {
+    SharedLockBenchmark<engine::ReaderBiasedSharedMutex>(state, false);
+}
+BENCHMARK(reader_biased_shared_mutex_benchmark)->DenseRange(1, 6)->Arg(16)->Arg(32)->Arg(64);
+
+// a write every millisecond
+void shared_mutex_with_writer_benchmark(benchmark::State& state) {
+    SharedLockBenchmark<engine::SharedMutex>(state, true);
+}
+BENCHMARK(shared_mutex_with_writer_benchmark)->DenseRange(1, 6)->Arg(16)->Arg(32)->Arg(64);
+
+void reader_biased_shared_mutex_with_writer_benchmark(benchmark::State& state) {
+    SharedLockBenchmark<engine::ReaderBiasedSharedMutex>(state, true);
+}
+BENCHMARK(reader_biased_shared_mutex_with_writer_benchmark)->DenseRange(1, 6)->Arg(16)->Arg(32)->Arg(64);
 
 USERVER_NAMESPACE_END
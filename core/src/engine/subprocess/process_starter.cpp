@@ -1,13 +1,14 @@
 #include <userver/engine/subprocess/process_starter.hpp>
 
+#include <fcntl.h>
+#include <spawn.h>
 #include <sys/types.h>
-#include <sys/wait.h>
 #include <unistd.h>
 
+#include <cerrno>
 #include <csignal>
-#include <cstdio>
-#include <cstring>
-#include <iostream>
+#include <string_view>
+#include <system_error>
 
 #include <fmt/format.h>
 #include <fmt/ranges.h>
@@ -23,16 +24,60 @@
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/algo.hpp>
-#include <utils/check_syscall.hpp>
-
-extern char** environ;
+#include <userver/utils/text_light.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::subprocess {
 namespace {
 
-void DoExec(
+// Used by execvp() if there is no PATH in the environment
+constexpr std::string_view kDefaultPath = "/bin:/usr/bin";
+
+void CheckSpawnError(int error, std::string_view what) {
+    if (error) {
+        throw std::system_error(std::error_code(error, std::system_category()), fmt::format("Error while {}", what));
+    }
+}
+
+// posix_spawnp() searches the PATH of the parent, while the child's one is used
+// by execvp()
+std::string FindExecutable(const std::string& executable_path, const EnvironmentVariables& env) {
+    if (executable_path.find('/') != std::string::npos) return executable_path;
+
+    const auto path = env.GetValueOptional("PATH");
+    const std::string_view dirs = path ? std::string_view{*path} : kDefaultPath;
+    for (const auto dir : utils::text::SplitIntoStringViewVector(dirs, ":")) {
+        auto candidate = utils::StrCat(dir.empty() ? std::string_view{"."} : dir, "/", executable_path);
+        if (access(candidate.c_str(), X_OK) == 0) return candidate;
+    }
+    CheckSpawnError(ENOENT, fmt::format("searching for '{}' in PATH", executable_path));
+    return {};
+}
+
+class SpawnFileActions final {
+public:
+    SpawnFileActions() { CheckSpawnError(posix_spawn_file_actions_init(&actions_), "posix_spawn_file_actions_init"); }
+
+    SpawnFileActions(const SpawnFileActions&) = delete;
+    SpawnFileActions& operator=(const SpawnFileActions&) = delete;
+    ~SpawnFileActions() { posix_spawn_file_actions_destroy(&actions_); }
+
+    // Same flags as freopen(path, "a")
+    void AppendTo(int fd, const std::string& path) {
+        CheckSpawnError(
+            posix_spawn_file_actions_addopen(&actions_, fd, path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0666),
+            "posix_spawn_file_actions_addopen"
+        );
+    }
+
+    const posix_spawn_file_actions_t* Get() const { return &actions_; }
+
+private:
+    posix_spawn_file_actions_t actions_{};
+};
+
+pid_t Spawn(
     const std::string& executable_path,
     const std::vector<std::string>& args,
     const EnvironmentVariables& env,
@@ -40,16 +85,12 @@ void DoExec(
     const std::optional<std::string>& stderr_file,
     bool use_path
 ) {
-    if (stdout_file) {
-        if (!std::freopen(stdout_file->c_str(), "a", stdout)) {
-            utils::CheckSyscall(-1, "freopen stdout to {}", *stdout_file);
-        }
-    }
-    if (stderr_file) {
-        if (!std::freopen(stderr_file->c_str(), "a", stderr)) {
-            utils::CheckSyscall(-1, "freopen stderr to {}", *stdout_file);
-        }
-    }
+    const auto path = use_path ? FindExecutable(executable_path, env) : executable_path;
+
+    SpawnFileActions file_actions;
+    if (stdout_file) file_actions.AppendTo(STDOUT_FILENO, *stdout_file);
+    if (stderr_file) file_actions.AppendTo(STDERR_FILENO, *stderr_file);
+
     std::vector<char*> argv_ptrs;
     std::vector<std::string> envp_buf;
     std::vector<char*> envp_ptrs;
@@ -72,14 +113,15 @@ void DoExec(
     }
     envp_ptrs.push_back(nullptr);
 
-    environ = envp_ptrs.data();  // The variable is assigned to the environment to
-                                 // use the execv, execvp functions
-
-    if (!use_path) {
-        utils::CheckSyscall(execv(executable_path.c_str(), argv_ptrs.data()), "execv");
-    } else {
-        utils::CheckSyscall(execvp(executable_path.c_str(), argv_ptrs.data()), "execvp");
-    }
+    // Unlike fork(), posix_spawn() does not copy the page tables of the parent
+    // (glibc uses clone(CLONE_VM | CLONE_VFORK)), so the cost does not grow
+    // with the memory of the service. Exec errors are reported to the parent.
+    pid_t pid = 0;
+    CheckSpawnError(
+        posix_spawn(&pid, path.c_str(), file_actions.Get(), nullptr, argv_ptrs.data(), envp_ptrs.data()),
+        fmt::format("posix_spawn of '{}'", path)
+    );
+    return pid;
 }
 
 EnvironmentVariables ApplyEnvironmentUpdate(
@@ -127,41 +169,33 @@ ProcessStarter::Exec(const std::string& executable_path, const std::vector<std::
                               return key_value.first + '=' + key_value.second;
                           });
         LOG_DEBUG() << fmt::format(
-            "do fork() + {}(), executable_path={}, args=[\'{}\'], env=[]",
-            options.use_path ? "execv" : "execvp",
+            "do posix_spawn(), use_path={}, executable_path={}, args=[\'{}\'], env=[{}]",
+            options.use_path,
+            executable_path,
             fmt::join(args, "' '"),
             fmt::join(keys, ", ")
         );
 
-        const auto pid = utils::CheckSyscall(fork(), "fork");
-        if (pid) {
-            // in parent thread
-            span.AddTag("child-process-pid", pid);
-            LOG_DEBUG() << "Started child process with pid=" << pid;
-            Promise<ChildProcessStatus> exec_result_promise;
-            auto res = ChildProcessMapSet(pid, ev::ChildProcessMapValue(std::move(exec_result_promise)));
-            if (res.second) {
-                promise.set_value(ChildProcess{ChildProcessImpl{pid, res.first->status_promise.get_future()}});
-            } else {
-                const auto msg = fmt::format("process with pid={} already exists in child_process_map", pid);
-                LOG_ERROR() << msg << ", send SIGKILL";
-                ChildProcessImpl(pid, Future<ChildProcessStatus>{}).SendSignal(SIGKILL);
-                promise.set_exception(std::make_exception_ptr(std::runtime_error(msg)));
-            }
+        pid_t pid = 0;
+        try {
+            pid = Spawn(executable_path, args, env, options.stdout_file, options.stderr_file, options.use_path);
+        } catch (const std::exception& ex) {
+            LOG_WARNING() << "Cannot execute child: " << ex;
+            promise.set_exception(std::current_exception());
+            return;
+        }
+
+        span.AddTag("child-process-pid", pid);
+        LOG_DEBUG() << "Started child process with pid=" << pid;
+        Promise<ChildProcessStatus> exec_result_promise;
+        auto res = ChildProcessMapSet(pid, ev::ChildProcessMapValue(std::move(exec_result_promise)));
+        if (res.second) {
+            promise.set_value(ChildProcess{ChildProcessImpl{pid, res.first->status_promise.get_future()}});
         } else {
-            // in child thread
-            try {
-                try {
-                    DoExec(executable_path, args, env, options.stdout_file, options.stderr_file, options.use_path);
-                } catch (const std::exception& ex) {
-                    std::cerr << "Cannot execute child: " << ex.what();
-                }
-            } catch (...) {
-                // must not do anything in a child
-                std::abort();
-            }
-            // on success execve or execvp does not return
-            std::abort();
+            const auto msg = fmt::format("process with pid={} already exists in child_process_map", pid);
+            LOG_ERROR() << msg << ", send SIGKILL";
+            ChildProcessImpl(pid, Future<ChildProcessStatus>{}).SendSignal(SIGKILL);
+            promise.set_exception(std::make_exception_ptr(std::runtime_error(msg)));
         }
     });
 
@@ -0,0 +1,39 @@
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/subprocess/child_process.hpp>
+#include <userver/engine/subprocess/process_starter.hpp>
+#include <userver/engine/task/task.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+// Measures the latency of starting a process depending on the resident memory
+// of the parent, which fork() had to copy the page tables of
+void subprocess_spawn(benchmark::State& state) {
+    // touched to be resident
+    std::vector<char> memory(static_cast<std::size_t>(state.range(0)) << 20);
+    std::memset(memory.data(), 1, memory.size());
+
+    engine::RunStandalone([&] {
+        engine::subprocess::ProcessStarter starter(engine::current_task::GetTaskProcessor());
+        for ([[maybe_unused]] auto _ : state) {
+            engine::subprocess::ExecOptions options;
+            options.use_path = true;
+            auto process = starter.Exec("true", {}, std::move(options));
+
+            state.PauseTiming();
+            process.Get();
+            state.ResumeTiming();
+        }
+    });
+
+    benchmark::DoNotOptimize(memory.data());
+    state.counters["parent_rss_mb"] = static_cast<double>(state.range(0));
+}
+BENCHMARK(subprocess_spawn)->Arg(0)->Arg(256)->Arg(2048)->Unit(benchmark::kMicrosecond);
+
+USERVER_NAMESPACE_END
@@ -90,8 +90,37 @@ UTEST(Subprocess, ExecvExecvFailure) {
 
 UTEST(Subprocess, ExecvFileNotFound) {
     engine::subprocess::ProcessStarter starter(engine::current_task::GetTaskProcessor());
-    const auto status = starter.Exec("myawesomebinary", {}).Get();
-    ASSERT_FALSE(status.IsExited());
+    UEXPECT_THROW((void)starter.Exec("myawesomebinary", {}), std::system_error);
+}
+
+UTEST(Subprocess, ExecvpFileNotFound) {
+    engine::subprocess::ProcessStarter starter(engine::current_task::GetTaskProcessor());
+
+    engine::subprocess::EnvironmentVariablesScope scope{};
+    SetEnvironmentVariable("PATH", kPath, engine::subprocess::Overwrite::kAllowed);
+
+    engine::subprocess::ExecOptions options{};
+    options.use_path = true;
+    options.env_update = engine::subprocess::EnvironmentVariablesUpdate{{{"PATH", "/nonexistent"}}};
+
+    // the PATH of the child is searched, not the one of the service
+    UEXPECT_THROW((void)starter.Exec(kProgram, {"-n", "1"}, std::move(options)), std::system_error);
+}
+
+UTEST(Subprocess, RedirectsOutput) {
+    engine::subprocess::ProcessStarter starter(engine::current_task::GetTaskProcessor());
+    auto stdout_file = fs::TempFile::Create(engine::current_task::GetTaskProcessor());
+
+    engine::subprocess::ExecOptions options{};
+    options.stdout_file = stdout_file.GetPath();
+
+    for (int i = 0; i < 2; ++i) {
+        auto status = starter.Exec(kPath + "/echo", {"line"}, engine::subprocess::ExecOptions{options}).Get();
+        ASSERT_TRUE(status.IsExited());
+        EXPECT_EQ(0, status.GetExitCode());
+    }
+    // the file is appended to
+    EXPECT_EQ(fs::blocking::ReadFileContents(stdout_file.GetPath()), "line\nline\n");
 }
 
 UTEST(Subprocess, EnvironmentVariablesScope) {
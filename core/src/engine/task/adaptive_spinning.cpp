@@ -0,0 +1,75 @@
+#include <engine/task/adaptive_spinning.hpp>
+
+#include <algorithm>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+// Rough cost of a semaphore tryWait() until the first measurement
+constexpr double kInitialIterationTimeNs = 10;
+
+// Weight of a new sample in the moving averages
+constexpr double kSampleWeight = 1.0 / 8;
+
+// Spin for twice the average idle time to cover most of the gaps
+constexpr double kIdleTimeMargin = 2;
+
+double UpdateAverage(double average, double sample) noexcept { return average + (sample - average) * kSampleWeight; }
+
+double ToNs(std::chrono::nanoseconds duration) noexcept { return static_cast<double>(duration.count()); }
+
+}  // namespace
+
+AdaptiveSpinning::AdaptiveSpinning(std::size_t max_iterations) noexcept
+    : max_iterations_(std::max(max_iterations, kMinIterations)),
+      iteration_time_ns_(kInitialIterationTimeNs),
+      idle_time_ns_(0),
+      budget_(max_iterations_) {}
+
+void AdaptiveSpinning::AccountSpinWakeup(std::size_t iterations, std::chrono::nanoseconds spin_time) noexcept {
+    spin_wakeups_.fetch_add(1, std::memory_order_relaxed);
+    if (iterations != 0) {
+        iteration_time_ns_ = UpdateAverage(iteration_time_ns_, ToNs(spin_time) / iterations);
+    }
+    AccountIdleTime(spin_time);
+}
+
+void AdaptiveSpinning::AccountSleepWakeup(
+    std::chrono::nanoseconds spin_time,
+    std::chrono::nanoseconds sleep_time
+) noexcept {
+    sleep_wakeups_.fetch_add(1, std::memory_order_relaxed);
+    iteration_time_ns_ = UpdateAverage(iteration_time_ns_, ToNs(spin_time) / GetBudget());
+    AccountIdleTime(spin_time + sleep_time);
+}
+
+void AdaptiveSpinning::AppendStats(SpinningStats& stats) const noexcept {
+    stats.budget_iterations += GetBudget();
+    stats.spin_wakeups += spin_wakeups_.load(std::memory_order_relaxed);
+    stats.sleep_wakeups += sleep_wakeups_.load(std::memory_order_relaxed);
+}
+
+void AdaptiveSpinning::AccountIdleTime(std::chrono::nanoseconds idle_time) noexcept {
+    // Guard against the clock granularity
+    iteration_time_ns_ = std::max(iteration_time_ns_, 0.1);
+    const auto max_spin_time_ns = static_cast<double>(max_iterations_) * iteration_time_ns_;
+
+    // Long quiet periods should not keep the average high for long after the
+    // load returns, so the samples are capped.
+    const auto sample = std::min(ToNs(idle_time), kIdleTimeMargin * max_spin_time_ns);
+    idle_time_ns_ = UpdateAverage(idle_time_ns_, sample);
+
+    const auto wanted_spin_time_ns = kIdleTimeMargin * idle_time_ns_;
+    std::size_t budget = kMinIterations;
+    if (wanted_spin_time_ns <= max_spin_time_ns) {
+        budget = std::max(static_cast<std::size_t>(wanted_spin_time_ns / iteration_time_ns_), kMinIterations);
+    }
+    budget_.store(budget, std::memory_order_relaxed);
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+struct SpinningStats {
+    // Sum of the current spin budgets of the workers, in iterations
+    std::size_t budget_iterations{0};
+    // Tasks that were picked up while spinning
+    std::uint64_t spin_wakeups{0};
+    // Tasks that were picked up after sleeping on the semaphore
+    std::uint64_t sleep_wakeups{0};
+};
+
+/// Chooses the number of spin iterations a worker does on an empty queue
+/// before going to sleep. A single worker thread updates the state, stats may
+/// be read concurrently.
+///
+/// The budget follows the moving average of the idle time between tasks: idle
+/// gaps that fit into `max_iterations` are covered with spinning to avoid the
+/// futex wakeup latency, while longer idle periods make the worker go to sleep
+/// almost immediately, not to waste CPU.
+class AdaptiveSpinning final {
+public:
+    static constexpr std::size_t kMinIterations = 16;
+
+    explicit AdaptiveSpinning(std::size_t max_iterations) noexcept;
+
+    std::size_t GetBudget() const noexcept { return budget_.load(std::memory_order_relaxed); }
+
+    /// A task has been found after `iterations` spin iterations
+    /// that took `spin_time`
+    void AccountSpinWakeup(std::size_t iterations, std::chrono::nanoseconds spin_time) noexcept;
+
+    /// The whole budget has been spent in `spin_time`, then the worker has slept
+    /// for `sleep_time` until a task arrived
+    void AccountSleepWakeup(std::chrono::nanoseconds spin_time, std::chrono::nanoseconds sleep_time) noexcept;
+
+    void AppendStats(SpinningStats& stats) const noexcept;
+
+private:
+    void AccountIdleTime(std::chrono::nanoseconds idle_time) noexcept;
+
+    const std::size_t max_iterations_;
+    double iteration_time_ns_;
+    double idle_time_ns_;
+
+    std::atomic<std::size_t> budget_;
+    std::atomic<std::uint64_t> spin_wakeups_{0};
+    std::atomic<std::uint64_t> sleep_wakeups_{0};
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,74 @@
+#include <engine/task/adaptive_spinning.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kMaxIterations = 10'000;
+
+engine::SpinningStats GetStats(const engine::AdaptiveSpinning& spinning) {
+    engine::SpinningStats stats;
+    spinning.AppendStats(stats);
+    return stats;
+}
+
+}  // namespace
+
+TEST(AdaptiveSpinning, StartsWithMaxBudget) {
+    const engine::AdaptiveSpinning spinning{kMaxIterations};
+    EXPECT_EQ(spinning.GetBudget(), kMaxIterations);
+
+    const engine::AdaptiveSpinning small_spinning{1};
+    EXPECT_EQ(small_spinning.GetBudget(), engine::AdaptiveSpinning::kMinIterations);
+}
+
+TEST(AdaptiveSpinning, QuietPeriodsDisableSpinning) {
+    engine::AdaptiveSpinning spinning{kMaxIterations};
+    for (int i = 0; i < 20; ++i) {
+        spinning.AccountSleepWakeup(100us, 1s);
+    }
+    EXPECT_EQ(spinning.GetBudget(), engine::AdaptiveSpinning::kMinIterations);
+
+    const auto stats = GetStats(spinning);
+    EXPECT_EQ(stats.sleep_wakeups, 20);
+    EXPECT_EQ(stats.spin_wakeups, 0);
+}
+
+TEST(AdaptiveSpinning, ShortGapsAreCovered) {
+    engine::AdaptiveSpinning spinning{kMaxIterations};
+    for (int i = 0; i < 20; ++i) {
+        spinning.AccountSleepWakeup(100us, 1s);
+    }
+
+    // 10ns per iteration, 1us between tasks
+    for (int i = 0; i < 200; ++i) {
+        spinning.AccountSpinWakeup(100, 1us);
+    }
+    const auto budget = spinning.GetBudget();
+    EXPECT_GT(budget, engine::AdaptiveSpinning::kMinIterations);
+    EXPECT_LT(budget, kMaxIterations);
+    // Twice the average gap
+    EXPECT_NEAR(budget, 200, 50);
+
+    EXPECT_EQ(GetStats(spinning).spin_wakeups, 200);
+}
+
+TEST(AdaptiveSpinning, ShortSleepsIncreaseBudget) {
+    engine::AdaptiveSpinning spinning{kMaxIterations};
+    for (int i = 0; i < 20; ++i) {
+        spinning.AccountSleepWakeup(100us, 1s);
+    }
+    ASSERT_EQ(spinning.GetBudget(), engine::AdaptiveSpinning::kMinIterations);
+
+    // Futex wakeups after a few microseconds could have been avoided
+    for (int i = 0; i < 200; ++i) {
+        spinning.AccountSleepWakeup(std::chrono::nanoseconds{spinning.GetBudget() * 10}, 3us);
+    }
+    EXPECT_GT(spinning.GetBudget(), engine::AdaptiveSpinning::kMinIterations);
+}
+
+USERVER_NAMESPACE_END
@@ -1,11 +1,15 @@
 #include <benchmark/benchmark.h>
 
 #include <array>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/impl/task_local_storage.hpp>
 #include <userver/engine/run_standalone.hpp>
+#include <userver/engine/task/inherited_variable.hpp>
+#include <userver/engine/wait_all_checked.hpp>
 #include <userver/utils/async.hpp>
 #include <userver/utils/fixed_array.hpp>
 
@@ -15,6 +19,10 @@ namespace {
 
 using WrappedSpanCall = utils::impl::WrappedCallImplType<decltype(utils::impl::SpanLazyPrvalue("")), void (*)()>;
 
+engine::TaskInheritedVariable<std::string> kInheritedVariable1;
+engine::TaskInheritedVariable<std::string> kInheritedVariable2;
+engine::TaskInheritedVariable<std::string> kInheritedVariable3;
+
 }
 
 // Note: We intentionally do not run this benchmark from RunStandalone to avoid
@@ -42,6 +50,18 @@ void async_comparisons_coro(benchmark::State& state) {
 }
 BENCHMARK(async_comparisons_coro)->RangeMultiplier(2)->Range(1, 32);
 
+void async_comparisons_stackless(benchmark::State& state) {
+    engine::RunStandalone(state.range(0), [&] {
+        std::uint64_t constructed_joined_count = 0;
+        for ([[maybe_unused]] auto _ : state) {
+            engine::StacklessAsyncNoSpan([] {}).Wait();
+            ++constructed_joined_count;
+        }
+        benchmark::DoNotOptimize(constructed_joined_count);
+    });
+}
+BENCHMARK(async_comparisons_stackless)->RangeMultiplier(2)->Range(1, 32);
+
 void wrap_call_single(benchmark::State& state) {
     engine::RunStandalone([&] {
         for ([[maybe_unused]] auto _ : state) {
@@ -95,4 +115,24 @@ void async_comparisons_coro_spanned(benchmark::State& state) {
 }
 BENCHMARK(async_comparisons_coro_spanned)->RangeMultiplier(2)->Range(1, 32);
 
+// A fan-out of subtasks inheriting a few variables, like the request handlers do
+void async_fan_out_inherited(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        kInheritedVariable1.Set("request");
+        kInheritedVariable2.Set("baggage");
+        kInheritedVariable3.Set("headers");
+
+        std::vector<engine::TaskWithResult<void>> tasks;
+        tasks.reserve(static_cast<std::size_t>(state.range(0)));
+        for ([[maybe_unused]] auto _ : state) {
+            for (std::int64_t i = 0; i < state.range(0); ++i) {
+                tasks.push_back(utils::Async("", [] {}));
+            }
+            engine::WaitAllChecked(tasks);
+            tasks.clear();
+        }
+    });
+}
+BENCHMARK(async_fan_out_inherited)->Arg(1)->Arg(100);
+
 USERVER_NAMESPACE_END
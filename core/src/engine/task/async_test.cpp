@@ -3,6 +3,7 @@
 #include <atomic>
 
 #include <userver/engine/async.hpp>
+#include <userver/engine/exception.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/utils/lazy_prvalue.hpp>
@@ -313,4 +314,43 @@ UTEST_MT(Async, CancelNotifyRace, 4) {
     }
 }
 
+UTEST(Async, Stackless) {
+    auto task = engine::StacklessAsyncNoSpan([](int x) { return x * 2; }, 21);
+    EXPECT_EQ(task.Get(), 42);
+
+    auto runs_without_coroutine = engine::StacklessAsyncNoSpan([] {
+        auto& context = engine::current_task::GetCurrentTaskContext();
+        return context.IsStackless() && !context.GetCoroutinePtr();
+    });
+    EXPECT_TRUE(runs_without_coroutine.Get());
+
+    auto throwing = engine::StacklessAsyncNoSpan([] { throw std::runtime_error("stackless"); });
+    UEXPECT_THROW_MSG(throwing.Get(), std::runtime_error, "stackless");
+}
+
+UTEST(Async, StacklessSpawnsContinuation) {
+    auto task = engine::StacklessAsyncNoSpan([] {
+        // Spawning a task does not block
+        return engine::AsyncNoSpan([] {
+            engine::Yield();
+            return 42;
+        });
+    });
+    EXPECT_EQ(task.Get().Get(), 42);
+}
+
+UTEST(Async, StacklessCancelledBeforeStart) {
+    bool started = false;
+    auto task = engine::StacklessAsyncNoSpan([&started] { started = true; });
+    task.RequestCancel();
+    UEXPECT_THROW(task.Get(), engine::TaskCancelledException);
+    EXPECT_FALSE(started);
+}
+
+#ifndef NDEBUG
+UTEST_DEATH(AsyncDeathTest, StacklessBlocking) {
+    UEXPECT_DEATH(engine::StacklessAsyncNoSpan([] { engine::Yield(); }).Get(), "Stackless task attempted to block");
+}
+#endif
+
 USERVER_NAMESPACE_END
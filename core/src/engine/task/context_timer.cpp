@@ -7,6 +7,8 @@
 #include <userver/utils/assert.hpp>
 
 #include <engine/ev/data_pipe_to_ev.hpp>
+#include <engine/ev/thread.hpp>
+#include <engine/ev/timer_wheel.hpp>
 #include <engine/task/task_context.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -58,7 +60,10 @@ public:
 private:
     void StopTimerInEvThread() noexcept;
 
+    bool ShouldUseTimerWheel() const noexcept;
+
     static void OnTimer(struct ev_loop*, ev_timer* w, int) noexcept;
+    static void OnWheelTimer(ev::TimerWheel::Entry& entry) noexcept;
     static void InvokeTimerFunction(const Params& params, TaskContext& context);
     void DoOnTimer();
 
@@ -66,6 +71,7 @@ private:
     ev::TimerThreadControl* thread_control_ = nullptr;
     Params params_;
     ev_timer timer_{};
+    ev::TimerWheel::Entry wheel_entry_{&OnWheelTimer};
     ev::DataPipeToEv<Params> params_pipe_to_ev_;
 };
 
@@ -73,11 +79,13 @@ ContextTimer::Impl::Impl() {
     timer_.data = this;
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
     ev_init(&timer_, OnTimer);
+    wheel_entry_.data = this;
 }
 
 ContextTimer::Impl::~Impl() {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
     UASSERT(!ev_is_active(&timer_));
+    UASSERT(!wheel_entry_.IsScheduled());
 }
 
 bool ContextTimer::Impl::WasStarted() const noexcept { return context_ && thread_control_; }
@@ -139,11 +147,26 @@ void ContextTimer::Impl::DoArmTimerInEvThread() {
         return;
     }
 
-    timer_.repeat = time_left;
     UASSERT(thread_control_);
+    if (ShouldUseTimerWheel()) {
+        thread_control_->Stop(timer_);
+        thread_control_->Start(wheel_entry_, params_.deadline);
+        return;
+    }
+
+    if (thread_control_->HasTimerWheel()) thread_control_->Stop(wheel_entry_);
+    timer_.repeat = time_left;
     thread_control_->Again(timer_);
 }
 
+bool ContextTimer::Impl::ShouldUseTimerWheel() const noexcept {
+    if (!thread_control_->HasTimerWheel()) return false;
+
+    // Cancellation deadlines tolerate the coarse resolution, short sleeps
+    // keep the precise ev_timer
+    return params_.action == Action::kCancel || params_.deadline.TimeLeft() >= ev::kMinDurationToDefer;
+}
+
 void ContextTimer::Impl::InvokeTimerFunction(const Params& params, TaskContext& context) {
     UASSERT(params.action == Action::kCancel || params.action == Action::kWakeupByEpoch);
     switch (params.action) {
@@ -159,6 +182,7 @@ void ContextTimer::Impl::InvokeTimerFunction(const Params& params, TaskContext&
 void ContextTimer::Impl::StopTimerInEvThread() noexcept {
     UASSERT(!engine::current_task::IsTaskProcessorThread());
     thread_control_->Stop(timer_);
+    if (thread_control_->HasTimerWheel()) thread_control_->Stop(wheel_entry_);
 }
 
 void ContextTimer::Impl::DoFinalizeInEvThread() {
@@ -181,6 +205,14 @@ void ContextTimer::Impl::OnTimer(struct ev_loop*, ev_timer* w, int) noexcept {
     ev_timer->DoOnTimer();
 }
 
+void ContextTimer::Impl::OnWheelTimer(ev::TimerWheel::Entry& entry) noexcept {
+    UASSERT(!engine::current_task::IsTaskProcessorThread());
+
+    auto* timer = static_cast<Impl*>(entry.data);
+    UASSERT(timer != nullptr);
+    timer->DoOnTimer();
+}
+
 void ContextTimer::Impl::DoOnTimer() {
     UASSERT(!engine::current_task::IsTaskProcessorThread());
 
@@ -56,7 +56,7 @@ public:
 
 private:
     class Impl;
-    utils::FastPimpl<Impl, 160, 16> impl_;
+    utils::FastPimpl<Impl, 208, 16> impl_;
 };
 
 }  // namespace engine::impl
@@ -0,0 +1,48 @@
+#include <engine/task/context_timer.hpp>
+
+#include <chrono>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utest/utest.hpp>
+
+#include <engine/coro/pool_config.hpp>
+#include <engine/ev/thread_pool_config.hpp>
+#include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor_pools.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+using namespace std::chrono_literals;
+
+TEST(ContextTimer, TimerWheel) {
+    engine::ev::ThreadPoolConfig ev_config;
+    ev_config.threads = 1;
+    ev_config.ev_default_loop_disabled = true;
+    ev_config.timer_wheel_resolution = 1ms;
+
+    auto pools = std::make_shared<engine::impl::TaskProcessorPools>(engine::coro::PoolConfig{}, std::move(ev_config));
+    auto task_processor = engine::impl::TaskProcessorHolder::Make(1, "wheel-worker", std::move(pools));
+
+    engine::impl::RunOnTaskProcessorSync(*task_processor, [] {
+        // Long sleeps are served by the timer wheel
+        auto start = std::chrono::steady_clock::now();
+        engine::SleepFor(50ms);
+        EXPECT_GE(std::chrono::steady_clock::now() - start, 50ms);
+
+        // Short sleeps use the precise ev_timer
+        start = std::chrono::steady_clock::now();
+        engine::SleepFor(1ms);
+        EXPECT_GE(std::chrono::steady_clock::now() - start, 1ms);
+
+        // Cancellation deadlines are always coarse
+        auto task = engine::AsyncNoSpan(engine::Deadline::FromDuration(20ms), [] {
+            engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+            return engine::current_task::CancellationReason();
+        });
+        EXPECT_EQ(task.Get(), engine::TaskCancellationReason::kDeadline);
+    });
+}
+
+USERVER_NAMESPACE_END
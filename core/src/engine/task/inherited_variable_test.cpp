@@ -147,6 +147,35 @@ UTEST(TaskInheritedVariable, SameObjectIsInherited) {
     utils::Async("subtask", [&] { EXPECT_EQ(&kStringVariable.Get(), kParentVariablePtr); }).Get();
 }
 
+UTEST(TaskInheritedVariable, SharedBetweenSiblings) {
+    kStringVariable.Set("foo");
+    kStringVariable2.Set("bar");
+
+    auto first = utils::Async("first", [] {
+        kStringVariable.Set("first");
+        kStringVariable2.Erase();
+        EXPECT_EQ(kStringVariable.Get(), "first");
+        EXPECT_FALSE(kStringVariable2.GetOptional());
+    });
+    auto second = utils::Async("second", [] {
+        EXPECT_EQ(kStringVariable.Get(), "foo");
+        EXPECT_EQ(kStringVariable2.Get(), "bar");
+
+        // grandchildren see the variables of their parent
+        kStringVariable3.Set("baz");
+        utils::Async("grandchild", [] {
+            EXPECT_EQ(kStringVariable.Get(), "foo");
+            EXPECT_EQ(kStringVariable3.Get(), "baz");
+        }).Get();
+    });
+    first.Get();
+    second.Get();
+
+    EXPECT_EQ(kStringVariable.Get(), "foo");
+    EXPECT_EQ(kStringVariable2.Get(), "bar");
+    EXPECT_FALSE(kStringVariable3.GetOptional());
+}
+
 UTEST_MT(TaskInheritedVariable, VariablesAfterParentTaskDeath, 4) {
     using Event = engine::SingleConsumerEvent;
     Event assigned_a{Event::NoAutoReset{}};
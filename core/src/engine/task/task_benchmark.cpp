@@ -32,6 +32,14 @@ void engine_task_create(benchmark::State& state) {
 }
 BENCHMARK(engine_task_create);
 
+// The task context is freed on the same thread and its memory is reused
+void engine_task_create_and_get(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        for ([[maybe_unused]] auto _ : state) engine::AsyncNoSpan([]() {}).Get();
+    });
+}
+BENCHMARK(engine_task_create_and_get);
+
 void engine_task_yield_single_thread(benchmark::State& state) {
     engine::RunStandalone([&] {
         RunParallelBenchmark(state, [](auto& range) {
@@ -194,4 +202,36 @@ void engine_tasks_from_another_task_processor(benchmark::State& state) {
 }
 BENCHMARK(engine_tasks_from_another_task_processor)->RangeMultiplier(2)->Range(2, 32)->Arg(6)->Arg(12);
 
+// Round trips to an otherwise idle task processor, the workers have to wake up
+// for each task. range(1) enables the adaptive spinning.
+void engine_tasks_wakeup_spinning(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        engine::TaskProcessorConfig proc_config;
+        proc_config.name = "benchmark";
+        proc_config.thread_name = "benchmark";
+        proc_config.worker_threads = state.range(0);
+        proc_config.adaptive_spinning = state.range(1) != 0;
+        engine::TaskProcessor task_processor(
+            proc_config, engine::current_task::GetTaskProcessor().GetTaskProcessorPools()
+        );
+
+        for ([[maybe_unused]] auto _ : state) {
+            engine::AsyncNoSpan(task_processor, []() {}).Wait();
+        }
+
+        if (const auto stats = task_processor.GetSpinningStats()) {
+            state.counters["budget"] = static_cast<double>(stats->budget_iterations) / proc_config.worker_threads;
+            state.counters["spin_wakeups"] = benchmark::Counter(stats->spin_wakeups, benchmark::Counter::kIsRate);
+            state.counters["sleep_wakeups"] = benchmark::Counter(stats->sleep_wakeups, benchmark::Counter::kIsRate);
+        }
+    });
+}
+BENCHMARK(engine_tasks_wakeup_spinning)
+    ->Args({2, 0})
+    ->Args({2, 1})
+    ->Args({4, 0})
+    ->Args({4, 1})
+    ->Args({8, 0})
+    ->Args({8, 1});
+
 USERVER_NAMESPACE_END
@@ -18,6 +18,7 @@
 #include <userver/logging/log.hpp>
 #include <userver/logging/stacktrace_cache.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/impl/usdt.hpp>
 #include <userver/utils/underlying_value.hpp>
 
 #include <engine/ev/thread_pool.hpp>
@@ -26,6 +27,7 @@
 #include <engine/task/coro_unwinder.hpp>
 #include <engine/task/cxxabi_eh_globals.hpp>
 #include <engine/task/task_processor.hpp>
+#include <tracing/span_impl.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -36,6 +38,8 @@ namespace {
 
 compiler::ThreadLocal current_task_context_ptr = []() -> impl::TaskContext* { return nullptr; };
 
+compiler::ThreadLocal current_schedule_batch_ptr = []() -> impl::ScheduleBatchScope* { return nullptr; };
+
 void SetCurrentTaskContext(impl::TaskContext* context) {
     auto local_task_context_ptr = current_task_context_ptr.Use();
     UASSERT(!*local_task_context_ptr || !context);
@@ -98,18 +102,76 @@ constexpr SleepState MakeNextEpochSleepState(SleepState::Epoch current) {
 
 auto* const kFinishedDetachedToken = reinterpret_cast<DetachedTasksSyncBlock::Token*>(1);
 
+TaskPriority GetInheritedPriority() noexcept {
+    const auto* const parent = current_task::GetCurrentTaskContextUnchecked();
+    return parent ? parent->GetPriority() : TaskPriority::kNormal;
+}
+
+// Don't call clock_gettime() twice on each context switch, time only every
+// kExecutionSliceSampleInterval-th execution slice of a thread.
+constexpr std::size_t kExecutionSliceSampleInterval = 8;
+
+compiler::ThreadLocal execution_slice_count = [] { return std::size_t{0}; };
+
+bool ShouldSampleExecutionSlice() noexcept {
+    auto count = execution_slice_count.Use();
+    return ++*count % kExecutionSliceSampleInterval == 0;
+}
+
 }  // namespace
 
+ScheduleBatchScope::ScheduleBatchScope() noexcept : is_outermost_(GetCurrent() == nullptr) {
+    if (is_outermost_) {
+        auto current_batch = current_task::current_schedule_batch_ptr.Use();
+        *current_batch = this;
+    }
+}
+
+ScheduleBatchScope::~ScheduleBatchScope() {
+    if (!is_outermost_) {
+        UASSERT(contexts_.empty());
+        return;
+    }
+
+    auto current_batch = current_task::current_schedule_batch_ptr.Use();
+    UASSERT(*current_batch == this);
+    *current_batch = nullptr;
+
+    auto* const begin = contexts_.data();
+    auto* const end = begin + contexts_.size();
+    for (auto* run_begin = begin; run_begin != end;) {
+        auto& task_processor = (*run_begin)->GetTaskProcessor();
+        auto* run_end = run_begin + 1;
+        while (run_end != end && &(*run_end)->GetTaskProcessor() == &task_processor) ++run_end;
+
+        task_processor.ScheduleBatch({run_begin, run_end});
+        run_begin = run_end;
+    }
+}
+
+ScheduleBatchScope* ScheduleBatchScope::GetCurrent() noexcept {
+    auto current_batch = current_task::current_schedule_batch_ptr.Use();
+    return *current_batch;
+}
+
+void ScheduleBatchScope::Add(TaskContext& context) {
+    UASSERT(is_outermost_);
+    contexts_.emplace_back(&context);
+}
+
 TaskContext::TaskContext(
     TaskProcessor& task_processor,
     Task::Importance importance,
     Task::WaitMode wait_type,
     Deadline deadline,
-    utils::impl::WrappedCallBase& payload
+    utils::impl::WrappedCallBase& payload,
+    bool is_stackless
 )
     : task_processor_(task_processor),
       task_counter_token_(task_processor_.GetTaskCounter()),
       is_critical_(importance == Task::Importance::kCritical),
+      is_stackless_(is_stackless),
+      priority_(GetInheritedPriority()),
       payload_(&payload),
       finish_waiters_(wait_type),
       cancel_deadline_(deadline),
@@ -117,6 +179,7 @@ TaskContext::TaskContext(
     UASSERT(payload_);
     LOG_TRACE() << "task with task_id=" << ReadableTaskId(current_task::GetCurrentTaskContextUnchecked())
                 << " created task with task_id=" << ReadableTaskId(this) << logging::LogExtra::Stacktrace();
+    USERVER_IMPL_USDT(task_spawn, this, current_task::GetCurrentTaskContextUnchecked());
 
     TsanReleaseBarrier();
 }
@@ -192,8 +255,14 @@ FutureStatus TaskContext::WaitUntil(Deadline deadline) const noexcept {
 void TaskContext::DoStep() {
     if (IsFinished()) return;
 
+    if (is_stackless_) {
+        DoStepStackless();
+        return;
+    }
+
     SleepState::Flags clear_flags{SleepFlags::kSleeping};
-    if (!coro_) {
+    const bool is_first_step = !coro_;
+    if (is_first_step) {
         coro_ = task_processor_.GetCoroutine();
         clear_flags |= SleepFlags::kWakeupByBootstrap;
         ArmCancellationTimer();
@@ -206,6 +275,7 @@ void TaskContext::DoStep() {
         CurrentTaskScope current_task_scope(*this, eh_globals_);
         try {
             SetState(Task::State::kRunning);
+            USERVER_IMPL_USDT(task_start, this, is_first_step);
             auto& coro_ref = *coro_;
             TsanAcquireBarrier();
             coro_ref(this);
@@ -219,18 +289,10 @@ void TaskContext::DoStep() {
 
     switch (yield_reason_) {
         case YieldReason::kTaskCancelled:
-        case YieldReason::kTaskComplete: {
+        case YieldReason::kTaskComplete:
             std::move(coro_).ReturnToPool();
-            auto new_state =
-                (yield_reason_ == YieldReason::kTaskComplete) ? Task::State::kCompleted : Task::State::kCancelled;
-            if (cancellation_reason_.load(std::memory_order_relaxed) != TaskCancellationReason::kNone) {
-                GetTaskProcessor().GetTaskCounter().AccountTaskCancel();
-            }
-            SetState(new_state);
-            deadline_timer_.Finalize();
-            finish_waiters_->SetSignalAndWakeupAll();
-            TraceStateTransition(new_state);
-        } break;
+            FinishExecution();
+            break;
 
         case YieldReason::kTaskWaiting:
             SetState(Task::State::kSuspended);
@@ -257,6 +319,35 @@ void TaskContext::DoStep() {
     }
 }
 
+void TaskContext::DoStepStackless() {
+    UASSERT(!coro_);
+    // The task never sleeps, so any later wakeup is a no-op
+    sleep_state_.ClearFlags<std::memory_order_relaxed>({SleepFlags::kSleeping, SleepFlags::kWakeupByBootstrap});
+
+    {
+        CurrentTaskScope current_task_scope(*this, eh_globals_);
+        SetState(Task::State::kRunning);
+        USERVER_IMPL_USDT(task_start, this, true);
+        ExecutePayload();
+    }
+
+    UASSERT(yield_reason_ == YieldReason::kTaskComplete || yield_reason_ == YieldReason::kTaskCancelled);
+    FinishExecution();
+}
+
+void TaskContext::FinishExecution() {
+    const auto new_state =
+        (yield_reason_ == YieldReason::kTaskComplete) ? Task::State::kCompleted : Task::State::kCancelled;
+    if (cancellation_reason_.load(std::memory_order_relaxed) != TaskCancellationReason::kNone) {
+        GetTaskProcessor().GetTaskCounter().AccountTaskCancel();
+    }
+    SetState(new_state);
+    USERVER_IMPL_USDT(task_finish, this, new_state == Task::State::kCancelled);
+    deadline_timer_.Finalize();
+    finish_waiters_->SetSignalAndWakeupAll();
+    TraceStateTransition(new_state);
+}
+
 void TaskContext::RequestCancel(TaskCancellationReason reason) {
     auto expected = TaskCancellationReason::kNone;
     if (cancellation_reason_.compare_exchange_strong(expected, reason)) {
@@ -308,6 +399,11 @@ TaskContext::WakeupSource TaskContext::Sleep(WaitStrategy& wait_strategy, Deadli
         return wakeup_source_;
     }
 
+    UINVARIANT(
+        !is_stackless_,
+        "Stackless task attempted to block, use engine::AsyncNoSpan for the code that may wait or yield"
+    );
+
     const bool has_deadline = deadline.IsReachable() && (!IsCancellable() || deadline < cancel_deadline_);
     if (has_deadline) ArmDeadlineTimer(deadline, sleep_epoch);
 
@@ -458,49 +554,53 @@ void TaskContext::CoroFunc(TaskPipe& task_pipe) {
     for (TaskContext* context : task_pipe) {
         UASSERT(context);
         context->TsanReleaseBarrier();
-        context->yield_reason_ = YieldReason::kNone;
         context->task_pipe_ = &task_pipe;
 
-        context->ProfilerStartExecution();
+        context->ExecutePayload();
 
-        // We only let tasks ran with CriticalAsync enter function body, others
-        // get terminated ASAP.
-        if (context->IsCancelRequested() && !context->WasStartedAsCritical()) {
-            context->SetCancellable(false);
-            // It is important to destroy payload here as someone may want
-            // to synchronize in its dtor (e.g. lambda closure).
+        context->task_pipe_ = nullptr;
+        context->TsanAcquireBarrier();
+    }
+}
+
+void TaskContext::ExecutePayload() {
+    yield_reason_ = YieldReason::kNone;
+    ProfilerStartExecution();
+
+    // We only let tasks ran with CriticalAsync enter function body, others
+    // get terminated ASAP.
+    if (IsCancelRequested() && !WasStartedAsCritical()) {
+        SetCancellable(false);
+        // It is important to destroy payload here as someone may want
+        // to synchronize in its dtor (e.g. lambda closure).
+        {
+            LocalStorageGuard local_storage_guard(*this);
+            ResetPayload();
+        }
+        yield_reason_ = YieldReason::kTaskCancelled;
+    } else {
+        try {
             {
-                LocalStorageGuard local_storage_guard(*context);
-                context->ResetPayload();
-            }
-            context->yield_reason_ = YieldReason::kTaskCancelled;
-        } else {
-            try {
-                {
-                    // Destroy contents of LocalStorage in the coroutine
-                    // as dtors may want to schedule
-                    LocalStorageGuard local_storage_guard(*context);
-
-                    context->TraceStateTransition(Task::State::kRunning);
-                    context->payload_->Perform();
-                }
-                context->yield_reason_ = YieldReason::kTaskComplete;
-            } catch (const CoroUnwinder&) {
-                context->yield_reason_ = YieldReason::kTaskCancelled;
-            } catch (...) {
-                utils::impl::AbortWithStacktrace(
-                    "An exception that is not derived from std::exception has been "
-                    "thrown: " +
-                    boost::current_exception_diagnostic_information() + " Such exceptions are not supported by userver."
-                );
+                // Destroy contents of LocalStorage in the coroutine
+                // as dtors may want to schedule
+                LocalStorageGuard local_storage_guard(*this);
+
+                TraceStateTransition(Task::State::kRunning);
+                payload_->Perform();
             }
+            yield_reason_ = YieldReason::kTaskComplete;
+        } catch (const CoroUnwinder&) {
+            yield_reason_ = YieldReason::kTaskCancelled;
+        } catch (...) {
+            utils::impl::AbortWithStacktrace(
+                "An exception that is not derived from std::exception has been "
+                "thrown: " +
+                boost::current_exception_diagnostic_information() + " Such exceptions are not supported by userver."
+            );
         }
-
-        context->ProfilerStopExecution();
-
-        context->task_pipe_ = nullptr;
-        context->TsanAcquireBarrier();
     }
+
+    ProfilerStopExecution();
 }
 
 void TaskContext::SetCancelDeadline(Deadline deadline) {
@@ -573,13 +673,22 @@ void TaskContext::Schedule() {
     UASSERT(state_ != Task::State::kQueued);
     SetState(Task::State::kQueued);
     TraceStateTransition(Task::State::kQueued);
+    USERVER_IMPL_USDT(task_schedule, this);
+    if (auto* const batch = ScheduleBatchScope::GetCurrent()) {
+        batch->Add(*this);
+        return;
+    }
     task_processor_.Schedule(this);
     // NOTE: may be executed at this point
 }
 
 void TaskContext::ProfilerStartExecution() {
+    if (task_processor_.IsTaskAccountingEnabled()) {
+        StartAccountingSlice(accounting_slice_);
+    }
+
     auto threshold_us = task_processor_.GetProfilerThreshold();
-    if (threshold_us.count() > 0) {
+    if (threshold_us.count() > 0 || ShouldSampleExecutionSlice()) {
         execute_started_ = std::chrono::steady_clock::now();
     } else {
         execute_started_ = {};
@@ -587,19 +696,22 @@ void TaskContext::ProfilerStartExecution() {
 }
 
 void TaskContext::ProfilerStopExecution() {
-    auto threshold_us = task_processor_.GetProfilerThreshold();
-    if (threshold_us.count() <= 0) return;
+    if (accounting_slice_.is_active) {
+        StopAccountingSlice(accounting_slice_, tracing::GetCurrentTaskOutermostSpanNameUnchecked());
+    }
 
     if (execute_started_ == std::chrono::steady_clock::time_point{}) {
-        // the task was started w/o profiling, skip it
+        // the slice was neither profiled nor sampled, skip it
         return;
     }
 
     auto now = std::chrono::steady_clock::now();
     auto duration = now - execute_started_;
     auto duration_us = std::chrono::duration_cast<std::chrono::microseconds>(duration);
+    task_processor_.AccountExecutionSlice(duration_us);
 
-    if (duration_us >= threshold_us) {
+    auto threshold_us = task_processor_.GetProfilerThreshold();
+    if (threshold_us.count() > 0 && duration_us >= threshold_us) {
         logging::LogExtra extra_stacktrace;
         if (task_processor_.ShouldProfilerForceStacktrace()) {
             logging::impl::ExtendLogExtraWithStacktrace(extra_stacktrace);
@@ -610,6 +722,12 @@ void TaskContext::ProfilerStopExecution() {
     }
 }
 
+void TaskContext::AccountingCheckpoint(std::string_view span_name) noexcept {
+    if (!accounting_slice_.is_active) return;
+    StopAccountingSlice(accounting_slice_, span_name);
+    StartAccountingSlice(accounting_slice_);
+}
+
 void TaskContext::TraceStateTransition(Task::State state) {
     if (trace_csw_left_ == 0) return;
     --trace_csw_left_;
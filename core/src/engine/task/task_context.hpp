@@ -6,11 +6,13 @@
 #include <vector>
 
 #include <ev.h>
+#include <boost/container/small_vector.hpp>
 #include <boost/intrusive/list_hook.hpp>
 #include <boost/smart_ptr/intrusive_ref_counter.hpp>
 
 #include <engine/coro/pool.hpp>
 #include <engine/ev/thread_control.hpp>
+#include <engine/impl/task_accounting.hpp>
 #include <engine/task/context_timer.hpp>
 #include <engine/task/counted_coroutine_ptr.hpp>
 #include <engine/task/cxxabi_eh_globals.hpp>
@@ -24,6 +26,7 @@
 #include <userver/engine/impl/wait_list_fwd.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/task/task.hpp>
+#include <userver/engine/task/task_priority.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/utils/flags.hpp>
 #include <userver/utils/impl/wrapped_call_base.hpp>
@@ -34,6 +37,34 @@ namespace engine {
 namespace impl {
 
 class TaskContextHolder;
+class TaskContext;
+
+/// Defers TaskContext scheduling on the current thread until the end of the
+/// scope, then pushes all the woken up contexts into their task queues at once.
+/// This replaces a queue push and a worker notification per context with a
+/// single one per task processor. Nested scopes are merged into the outermost.
+///
+/// The scope must not span coroutine switches.
+class ScheduleBatchScope final {
+public:
+    ScheduleBatchScope() noexcept;
+    ~ScheduleBatchScope();
+
+    ScheduleBatchScope(const ScheduleBatchScope&) = delete;
+    ScheduleBatchScope& operator=(const ScheduleBatchScope&) = delete;
+
+private:
+    friend class TaskContext;
+
+    static ScheduleBatchScope* GetCurrent() noexcept;
+
+    void Add(TaskContext& context);
+
+    static constexpr std::size_t kInplaceContexts = 16;
+
+    const bool is_outermost_;
+    boost::container::small_vector<boost::intrusive_ptr<TaskContext>, kInplaceContexts> contexts_;
+};
 
 [[noreturn]] void ReportDeadlock();
 
@@ -80,7 +111,14 @@ public:
         kBootstrap = static_cast<uint32_t>(SleepFlags::kWakeupByBootstrap),
     };
 
-    TaskContext(TaskProcessor&, Task::Importance, Task::WaitMode, Deadline, utils::impl::WrappedCallBase& payload);
+    TaskContext(
+        TaskProcessor&,
+        Task::Importance,
+        Task::WaitMode,
+        Deadline,
+        utils::impl::WrappedCallBase& payload,
+        bool is_stackless
+    );
 
     ~TaskContext() noexcept;
 
@@ -131,9 +169,16 @@ public:
 
     bool ShouldCancel() const noexcept { return IsCancelRequested() && IsCancellable(); }
 
+    // whether the payload runs to completion on the worker thread stack,
+    // such tasks must not block
+    bool IsStackless() const noexcept { return is_stackless_; }
+
     void SetBackground(bool);
     bool IsBackground() const noexcept { return is_background_; };
 
+    TaskPriority GetPriority() const noexcept { return priority_; }
+    void SetPriority(TaskPriority priority) noexcept { priority_ = priority; }
+
     // causes this to yield and wait for wakeup
     // must only be called from this context
     // "spurious wakeups" may be caused by wakeup queueing
@@ -164,6 +209,11 @@ public:
     bool HasLocalStorage() const noexcept;
     task_local::Storage& GetLocalStorage() noexcept;
 
+    // Whether the resources used by the current execution slice are accounted
+    bool IsAccounted() const noexcept { return accounting_slice_.is_active; }
+    // Attributes the resources used by the current slice so far to `span_name`
+    void AccountingCheckpoint(std::string_view span_name) noexcept;
+
     // ContextAccessor implementation
     bool IsReady() const noexcept override;
     EarlyWakeup TryAppendWaiter(TaskContext& waiter) override;
@@ -184,6 +234,10 @@ private:
 
     static constexpr uint64_t kMagic = 0x6b73615453755459ULL;  // "YTuSTask"
 
+    void DoStepStackless();
+    void ExecutePayload();
+    void FinishExecution();
+
     void ArmDeadlineTimer(Deadline deadline, SleepState::Epoch sleep_epoch);
     void ArmCancellationTimer();
 
@@ -207,9 +261,11 @@ private:
     TaskProcessor& task_processor_;
     TaskCounter::Token task_counter_token_;
     const bool is_critical_;
+    const bool is_stackless_;
     bool is_cancellable_{true};
     bool is_background_{false};
     bool within_sleep_{false};
+    TaskPriority priority_;
     EhGlobals eh_globals_;
 
     utils::impl::WrappedCallBase* payload_;
@@ -225,6 +281,7 @@ private:
     // {} if not defined
     std::chrono::steady_clock::time_point task_queue_wait_timepoint_;
     std::chrono::steady_clock::time_point execute_started_;
+    TaskAccountingSlice accounting_slice_;
     std::chrono::steady_clock::time_point last_state_change_timepoint_;
 
     std::size_t trace_csw_left_;
@@ -2,7 +2,11 @@
 
 #include <engine/task/sleep_state.hpp>
 #include <engine/task/task_context.hpp>
+#include <engine/task/task_processor.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/wait_all_checked.hpp>
 #include <userver/engine/sleep.hpp>
 
 #include <userver/engine/task/task_base.hpp>
@@ -88,4 +92,35 @@ UTEST(TaskContext, WaitListWakeupRace) {
     EXPECT_EQ(context.Sleep(wait_manager, engine::Deadline{}), engine::impl::TaskContext::WakeupSource::kWaitList);
 }
 
+UTEST(ScheduleBatchScope, DefersScheduling) {
+    constexpr std::size_t kWaitersCount = 10;
+
+    engine::Mutex mutex;
+    engine::ConditionVariable cv;
+    bool ready = false;
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (std::size_t i = 0; i < kWaitersCount; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([&] {
+            std::unique_lock lock{mutex};
+            ASSERT_TRUE(cv.Wait(lock, [&] { return ready; }));
+        }));
+    }
+    engine::Yield();
+
+    auto& task_processor = engine::current_task::GetTaskProcessor();
+    {
+        const std::lock_guard lock{mutex};
+        ready = true;
+    }
+    {
+        const engine::impl::ScheduleBatchScope batch;
+        cv.NotifyAll();
+        EXPECT_EQ(task_processor.GetTaskQueueSize(), 0);
+    }
+    EXPECT_EQ(task_processor.GetTaskQueueSize(), kWaitersCount);
+
+    engine::WaitAllChecked(tasks);
+}
+
 USERVER_NAMESPACE_END
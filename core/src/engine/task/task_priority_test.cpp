@@ -0,0 +1,69 @@
+#include <userver/engine/task/task_priority.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(TaskPriority, Scope) {
+    EXPECT_EQ(engine::current_task::GetPriority(), engine::TaskPriority::kNormal);
+    {
+        const engine::TaskPriorityScope background_scope{engine::TaskPriority::kBackground};
+        EXPECT_EQ(engine::current_task::GetPriority(), engine::TaskPriority::kBackground);
+        {
+            const engine::TaskPriorityScope critical_scope{engine::TaskPriority::kLatencyCritical};
+            EXPECT_EQ(engine::current_task::GetPriority(), engine::TaskPriority::kLatencyCritical);
+        }
+        EXPECT_EQ(engine::current_task::GetPriority(), engine::TaskPriority::kBackground);
+    }
+    EXPECT_EQ(engine::current_task::GetPriority(), engine::TaskPriority::kNormal);
+}
+
+UTEST(TaskPriority, Inherited) {
+    const engine::TaskPriorityScope background_scope{engine::TaskPriority::kBackground};
+
+    auto task = engine::AsyncNoSpan([] {
+        EXPECT_EQ(engine::current_task::GetPriority(), engine::TaskPriority::kBackground);
+        return engine::AsyncNoSpan(&engine::current_task::GetPriority).Get();
+    });
+    EXPECT_EQ(task.Get(), engine::TaskPriority::kBackground);
+}
+
+UTEST(TaskPriority, LanesAreWeighted) {
+    constexpr std::size_t kTasksPerLane = 20;
+
+    std::vector<engine::TaskPriority> finish_order;
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(kTasksPerLane * 2);
+
+    // Background tasks are spawned first, but the lanes are served with weights
+    for (const auto priority : {engine::TaskPriority::kBackground, engine::TaskPriority::kLatencyCritical}) {
+        const engine::TaskPriorityScope priority_scope{priority};
+        for (std::size_t i = 0; i < kTasksPerLane; ++i) {
+            tasks.push_back(engine::AsyncNoSpan([&finish_order, priority] { finish_order.push_back(priority); }));
+        }
+    }
+    engine::WaitAllChecked(tasks);
+
+    ASSERT_EQ(finish_order.size(), kTasksPerLane * 2);
+    const auto last_critical = std::find(
+        finish_order.rbegin(), finish_order.rend(), engine::TaskPriority::kLatencyCritical
+    );
+    const auto last_background = std::find(
+        finish_order.rbegin(), finish_order.rend(), engine::TaskPriority::kBackground
+    );
+    EXPECT_LT(last_background, last_critical) << "Latency-critical tasks should finish before the background ones";
+}
+
+TEST(TaskPriority, ToString) {
+    EXPECT_EQ(engine::ToString(engine::TaskPriority::kLatencyCritical), "latency-critical");
+    EXPECT_EQ(engine::ToString(engine::TaskPriority::kNormal), "normal");
+    EXPECT_EQ(engine::ToString(engine::TaskPriority::kBackground), "background");
+}
+
+USERVER_NAMESPACE_END
@@ -13,6 +13,7 @@
 #include <userver/utils/rand.hpp>
 #include <userver/utils/thread_name.hpp>
 #include <userver/utils/threads.hpp>
+#include <utils/jemalloc.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
 #include <engine/task/counted_coroutine_ptr.hpp>
@@ -82,22 +83,69 @@ void TaskProcessorThreadStartedHook() {
     EmitMagicNanosleep();
 }
 
-auto MakeTaskQueue(TaskProcessorConfig config) {
+auto MakeTaskQueue(TaskProcessorConfig config, utils::span<const utils::cpu_topology::CpuInfo> worker_cpus) {
     using ResultType = std::variant<TaskQueue, WorkStealingTaskQueue>;
     switch (config.task_processor_queue) {
         case TaskQueueType::kGlobalTaskQueue:
             return ResultType{std::in_place_index<0>, std::move(config)};
         case TaskQueueType::kWorkStealingTaskQueue:
-            return ResultType{std::in_place_index<1>, std::move(config)};
+            return ResultType{std::in_place_index<1>, std::move(config), worker_cpus};
     }
     UINVARIANT(false, "Unexpected value of TaskQueueType enum");
 }
 
+// Upper bounds in microseconds
+constexpr std::array<double, 14> kQueueWaitTimeBoundsUs{
+    5, 10, 25, 50, 100, 250, 500, 1'000, 2'500, 5'000, 10'000, 25'000, 100'000, 1'000'000};
+
+auto MakeQueueWaitTimeHistograms() {
+    using utils::statistics::StripedHistogram;
+    static_assert(kTaskPrioritiesCount == 3);
+    return std::array<StripedHistogram, kTaskPrioritiesCount>{
+        StripedHistogram{kQueueWaitTimeBoundsUs},
+        StripedHistogram{kQueueWaitTimeBoundsUs},
+        StripedHistogram{kQueueWaitTimeBoundsUs},
+    };
+}
+
+// Upper bounds in microseconds
+constexpr std::array<double, 14> kExecutionSliceBoundsUs{
+    1, 2, 5, 10, 25, 50, 100, 250, 500, 1'000, 2'500, 10'000, 100'000, 1'000'000};
+
+std::vector<utils::cpu_topology::CpuInfo> MakeWorkerCpus(const TaskProcessorConfig& config) {
+    if (!config.pin_worker_threads) return {};
+
+    const auto topology = utils::cpu_topology::CpuTopology::FromSysfs();
+    auto worker_cpus =
+        topology.AssignWorkerCpus(utils::cpu_topology::GetCurrentThreadAllowedCpus(), config.worker_threads);
+    if (worker_cpus.empty()) {
+        LOG_WARNING() << "Failed to assign CPUs to worker threads of task processor " << config.name
+                      << ", worker threads would not be pinned";
+    }
+    return worker_cpus;
+}
+
+std::optional<unsigned> MakeJemallocArena(const TaskProcessorConfig& config) {
+    if (!config.dedicated_jemalloc_arena) return std::nullopt;
+
+    unsigned arena_index = 0;
+    if (const auto ec = utils::jemalloc::CreateArena(arena_index)) {
+        LOG_WARNING() << "Failed to create a jemalloc arena for task processor " << config.name
+                      << ", worker threads would use the default arenas: " << ec.message();
+        return std::nullopt;
+    }
+    return arena_index;
+}
+
 }  // namespace
 
 TaskProcessor::TaskProcessor(TaskProcessorConfig config, std::shared_ptr<impl::TaskProcessorPools> pools)
-    : task_queue_(MakeTaskQueue(config)),
+    : worker_cpus_(MakeWorkerCpus(config)),
+      jemalloc_arena_(MakeJemallocArena(config)),
+      task_queue_(MakeTaskQueue(config, worker_cpus_)),
       task_counter_(config.worker_threads),
+      queue_wait_time_histograms_(MakeQueueWaitTimeHistograms()),
+      execution_slice_histogram_(kExecutionSliceBoundsUs),
       config_(std::move(config)),
       pools_(std::move(pools)) {
     utils::impl::FinishStaticRegistration();
@@ -147,8 +195,23 @@ void TaskProcessor::InitiateShutdown() {
 
 void TaskProcessor::Schedule(impl::TaskContext* context) {
     UASSERT(context);
+    PrepareForQueue(*context);
+
+    std::visit([&context](auto&& arg) { return arg.Push(context); }, task_queue_);
+}
+
+void TaskProcessor::ScheduleBatch(utils::span<boost::intrusive_ptr<impl::TaskContext>> contexts) {
+    for (const auto& context : contexts) {
+        UASSERT(context);
+        PrepareForQueue(*context);
+    }
+
+    std::visit([contexts](auto&& arg) { return arg.PushBatch(contexts); }, task_queue_);
+}
+
+void TaskProcessor::PrepareForQueue(impl::TaskContext& context) {
     const auto [action, max_queue_length] = GetOverloadActionAndValue(action_bit_and_max_task_queue_wait_length_);
-    if (max_queue_length && !context->IsCritical()) {
+    if (max_queue_length && !context.IsCritical()) {
         UASSERT(max_queue_length > 0);
         if (const auto overload_size = GetOverloadByLength(max_queue_length)) {
             LOG_LIMITED_WARNING() << "failed to enqueue task: task_queue_size_approximate=" << overload_size << " >= "
@@ -158,14 +221,12 @@ void TaskProcessor::Schedule(impl::TaskContext* context) {
                                      "`default-service.default-task-processor.wait_queue_overload."
                                      "length_limit` parameter in USERVER_TASK_PROCESSOR_QOS dynamic "
                                      "config to increase the limit.";
-            HandleOverload(*context, action);
+            HandleOverload(context, action);
         }
     }
-    if (is_shutting_down_) context->RequestCancel(TaskCancellationReason::kShutdown);
-
-    SetTaskQueueWaitTimepoint(context);
+    if (is_shutting_down_) context.RequestCancel(TaskCancellationReason::kShutdown);
 
-    std::visit([&context](auto&& arg) { return arg.Push(context); }, task_queue_);
+    SetTaskQueueWaitTimepoint(&context);
 }
 
 void TaskProcessor::Adopt(impl::TaskContext& context) { detached_contexts_->Add(context); }
@@ -178,6 +239,23 @@ std::size_t TaskProcessor::GetTaskQueueSize() const {
     return std::visit([](auto&& arg) { return arg.GetSizeApproximate(); }, task_queue_);
 }
 
+std::optional<SpinningStats> TaskProcessor::GetSpinningStats() const {
+    if (const auto* const queue = std::get_if<TaskQueue>(&task_queue_)) {
+        return queue->GetSpinningStats();
+    }
+    return std::nullopt;
+}
+
+const utils::statistics::StripedHistogram& TaskProcessor::GetQueueWaitTimeHistogram(TaskPriority priority) const {
+    const auto index = static_cast<std::size_t>(priority);
+    UASSERT(index < queue_wait_time_histograms_.size());
+    return queue_wait_time_histograms_[index];
+}
+
+void TaskProcessor::AccountExecutionSlice(std::chrono::microseconds duration) noexcept {
+    execution_slice_histogram_.Account(static_cast<double>(duration.count()));
+}
+
 void TaskProcessor::SetSettings(const TaskProcessorSettings& settings) {
     sensor_task_queue_wait_time_ = settings.sensor_wait_queue_time_limit;
 
@@ -230,6 +308,7 @@ void TaskProcessor::SetSettings(const TaskProcessorSettings& settings) {
         }
     }
     profiler_force_stacktrace_.store(settings.profiler_force_stacktrace);
+    task_accounting_enabled_.store(settings.task_accounting, std::memory_order_relaxed);
 }
 
 std::chrono::microseconds TaskProcessor::GetProfilerThreshold() const { return task_profiler_threshold_.load(); }
@@ -284,6 +363,22 @@ void TaskProcessor::PrepareWorkerThread(std::size_t index) noexcept {
             break;
     }
 
+    if (!worker_cpus_.empty()) {
+        UASSERT(index < worker_cpus_.size());
+        try {
+            utils::cpu_topology::SetCurrentThreadAffinity(worker_cpus_[index].cpu);
+        } catch (const std::exception& ex) {
+            LOG_WARNING() << "Failed to pin worker thread #" << index << " of task processor " << Name() << ": " << ex;
+        }
+    }
+
+    if (jemalloc_arena_) {
+        if (const auto ec = utils::jemalloc::SetThreadArena(*jemalloc_arena_)) {
+            LOG_WARNING() << "Failed to bind worker thread #" << index << " of task processor " << Name()
+                          << " to jemalloc arena " << *jemalloc_arena_ << ": " << ec.message();
+        }
+    }
+
     std::visit([index](auto& obj) { obj.PrepareWorker(index); }, task_queue_);
 
     pools_->GetCoroPool().PrepareLocalCache();
@@ -327,17 +422,23 @@ void TaskProcessor::CheckWaitTime(impl::TaskContext& context) {
     const auto [action, max_wait_time] = GetOverloadActionAndValue(action_bit_and_max_task_queue_wait_time_);
     const auto sensor_wait_time = sensor_task_queue_wait_time_.load();
 
+    // Only some tasks have the timepoint set, see SetTaskQueueWaitTimepoint()
+    const auto wait_timepoint = context.GetQueueWaitTimepoint();
+    std::chrono::steady_clock::duration wait_time{};
+    if (wait_timepoint != std::chrono::steady_clock::time_point()) {
+        wait_time = std::chrono::steady_clock::now() - wait_timepoint;
+        const auto wait_time_us = std::chrono::duration_cast<std::chrono::microseconds>(wait_time);
+        LOG_TRACE() << "queue wait time = " << wait_time_us.count() << "us";
+
+        queue_wait_time_histograms_[static_cast<std::size_t>(context.GetPriority())].Account(wait_time_us.count());
+    }
+
     if (max_wait_time.count() == 0 && sensor_wait_time.count() == 0) {
         SetTaskQueueWaitTimeOverloaded(false);
         return;
     }
 
-    const auto wait_timepoint = context.GetQueueWaitTimepoint();
     if (wait_timepoint != std::chrono::steady_clock::time_point()) {
-        const auto wait_time = std::chrono::steady_clock::now() - wait_timepoint;
-        const auto wait_time_us = std::chrono::duration_cast<std::chrono::microseconds>(wait_time);
-        LOG_TRACE() << "queue wait time = " << wait_time_us.count() << "us";
-
         SetTaskQueueWaitTimeOverloaded(max_wait_time.count() && wait_time >= max_wait_time);
 
         if (sensor_wait_time.count() && wait_time >= sensor_wait_time) {
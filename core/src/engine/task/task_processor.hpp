@@ -1,9 +1,11 @@
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <thread>
 #include <variant>
 #include <vector>
@@ -16,7 +18,11 @@
 #include <engine/task/work_stealing_queue/task_queue.hpp>
 #include <userver/concurrent/impl/interference_shield.hpp>
 #include <userver/engine/impl/detached_tasks_sync_block.hpp>
+#include <userver/engine/task/task_priority.hpp>
 #include <userver/logging/logger.hpp>
+#include <userver/utils/span.hpp>
+#include <userver/utils/statistics/striped_histogram.hpp>
+#include <utils/cpu_topology.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -42,6 +48,10 @@ public:
 
     void Schedule(impl::TaskContext*);
 
+    // Pushes all the contexts into the task queue at once, waking up the
+    // workers with a single notification
+    void ScheduleBatch(utils::span<boost::intrusive_ptr<impl::TaskContext>> contexts);
+
     void Adopt(impl::TaskContext& context);
 
     impl::CountedCoroutinePtr GetCoroutine();
@@ -58,14 +68,32 @@ public:
 
     std::size_t GetTaskQueueSize() const;
 
+    // Sampled time in microseconds that tasks of the priority spend in queue
+    const utils::statistics::StripedHistogram& GetQueueWaitTimeHistogram(TaskPriority priority) const;
+
+    // Sampled time in microseconds that tasks run without a context switch
+    const utils::statistics::StripedHistogram& GetExecutionSliceHistogram() const noexcept {
+        return execution_slice_histogram_;
+    }
+
+    void AccountExecutionSlice(std::chrono::microseconds duration) noexcept;
+
     std::size_t GetWorkerCount() const { return workers_.size(); }
 
+    // std::nullopt if adaptive spinning is not used
+    std::optional<SpinningStats> GetSpinningStats() const;
+
+    // std::nullopt if the worker threads allocate from the default arenas
+    std::optional<unsigned> GetJemallocArena() const noexcept { return jemalloc_arena_; }
+
     void SetSettings(const TaskProcessorSettings& settings);
 
     std::chrono::microseconds GetProfilerThreshold() const;
 
     bool ShouldProfilerForceStacktrace() const;
 
+    bool IsTaskAccountingEnabled() const noexcept { return task_accounting_enabled_.load(std::memory_order_relaxed); }
+
     std::size_t GetTaskTraceMaxCswForNewTask() const;
 
     const std::string& GetTaskTraceLoggerName() const;
@@ -95,6 +123,8 @@ private:
 
     void CheckWaitTime(impl::TaskContext& context);
 
+    void PrepareForQueue(impl::TaskContext& context);
+
     void SetTaskQueueWaitTimeOverloaded(bool new_value) noexcept;
 
     void HandleOverload(impl::TaskContext& context, TaskProcessorSettings::OverloadAction);
@@ -107,8 +137,13 @@ private:
     concurrent::impl::InterferenceShield<impl::DetachedTasksSyncBlock> detached_contexts_{
         impl::DetachedTasksSyncBlock::StopMode::kCancel};
     concurrent::impl::InterferenceShield<OverloadedCache> overloaded_cache_;
+    // Empty if worker threads are not pinned
+    const std::vector<utils::cpu_topology::CpuInfo> worker_cpus_;
+    const std::optional<unsigned> jemalloc_arena_;
     std::variant<TaskQueue, WorkStealingTaskQueue> task_queue_;
     impl::TaskCounter task_counter_;
+    std::array<utils::statistics::StripedHistogram, kTaskPrioritiesCount> queue_wait_time_histograms_;
+    utils::statistics::StripedHistogram execution_slice_histogram_;
 
     const TaskProcessorConfig config_;
     const std::shared_ptr<impl::TaskProcessorPools> pools_;
@@ -122,6 +157,7 @@ private:
     std::atomic<std::int64_t> action_bit_and_max_task_queue_wait_length_{0};
 
     std::atomic<bool> profiler_force_stacktrace_{false};
+    std::atomic<bool> task_accounting_enabled_{false};
     std::atomic<bool> is_shutting_down_{false};
     std::atomic<bool> task_trace_logger_set_{false};
 
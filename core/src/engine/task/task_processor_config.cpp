@@ -62,7 +62,10 @@ TaskProcessorConfig Parse(const yaml_config::YamlConfig& value, formats::parse::
     config.thread_name = value["thread_name"].As<std::string>({});
     config.os_scheduling = value["os-scheduling"].As<OsScheduling>(config.os_scheduling);
     config.spinning_iterations = value["spinning-iterations"].As<int>(config.spinning_iterations);
+    config.adaptive_spinning = value["adaptive-spinning"].As<bool>(config.adaptive_spinning);
     config.task_processor_queue = value["task-processor-queue"].As<TaskQueueType>(config.task_processor_queue);
+    config.pin_worker_threads = value["pin-worker-threads"].As<bool>(config.pin_worker_threads);
+    config.dedicated_jemalloc_arena = value["dedicated-jemalloc-arena"].As<bool>(config.dedicated_jemalloc_arena);
 
     const auto task_trace = value["task-trace"];
     if (!task_trace.IsMissing()) {
@@ -32,7 +32,12 @@ struct TaskProcessorConfig {
     std::string thread_name;
     OsScheduling os_scheduling{OsScheduling::kNormal};
     int spinning_iterations{1000};
+    // spinning_iterations is the upper bound of the adaptive spin budget
+    bool adaptive_spinning{false};
     TaskQueueType task_processor_queue{TaskQueueType::kGlobalTaskQueue};
+    bool pin_worker_threads{false};
+    // worker threads allocate from a jemalloc arena of their own
+    bool dedicated_jemalloc_arena{false};
 
     std::size_t task_trace_every{1000};
     std::size_t task_trace_max_csw{0};
@@ -53,6 +58,9 @@ struct TaskProcessorSettings {
 
     std::chrono::microseconds profiler_execution_slice_threshold{0};
     bool profiler_force_stacktrace{false};
+
+    // Account CPU time and allocations of the tasks by their Span names
+    bool task_accounting{false};
 };
 
 TaskProcessorSettings::OverloadAction
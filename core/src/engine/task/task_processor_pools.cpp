@@ -2,6 +2,7 @@
 
 #include <utility>
 
+#include <engine/io/uring.hpp>
 #include <engine/task/task_context.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
@@ -12,7 +13,11 @@ namespace engine::impl {
 
 TaskProcessorPools::TaskProcessorPools(coro::PoolConfig coro_pool_config, ev::ThreadPoolConfig ev_pool_config)
     : coro_pool_(std::move(coro_pool_config), &TaskContext::CoroFunc),
-      event_thread_pool_(std::move(ev_pool_config), ev::ThreadPool::kUseDefaultEvLoop) {
+      event_thread_pool_(ev_pool_config, ev::ThreadPool::kUseDefaultEvLoop) {
+    if (ev_pool_config.file_io_uring_entries > 0) {
+        file_uring_ = io::impl::Uring::TryCreate(ev_pool_config.file_io_uring_entries, event_thread_pool_.NextThread());
+    }
+
     const bool old_value = std::exchange(logging::impl::has_background_threads_which_can_log, true);
     UASSERT_MSG(
         !old_value,
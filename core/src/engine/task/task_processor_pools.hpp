@@ -1,10 +1,16 @@
 #pragma once
 
+#include <memory>
+
 #include <engine/coro/pool.hpp>
 #include <engine/ev/thread_pool.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
+namespace engine::io::impl {
+class Uring;
+}  // namespace engine::io::impl
+
 namespace engine::impl {
 
 class TaskContext;
@@ -20,9 +26,14 @@ public:
     CoroPool& GetCoroPool() { return coro_pool_; }
     ev::ThreadPool& EventThreadPool() { return event_thread_pool_; }
 
+    // nullptr if the file operations are performed on blocking task processors
+    io::impl::Uring* GetFileUring() noexcept { return file_uring_.get(); }
+
 private:
     CoroPool coro_pool_;
     ev::ThreadPool event_thread_pool_;
+    // Reaps its completions on the event_thread_pool_, so is destroyed first
+    std::unique_ptr<io::impl::Uring> file_uring_;
 };
 
 }  // namespace engine::impl
@@ -7,6 +7,8 @@
 #include <userver/engine/task/task_base.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/utest/utest.hpp>
+#include <utils/cpu_topology.hpp>
+#include <utils/jemalloc.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -74,4 +76,92 @@ UTEST_MT(TaskProcessor, MetricsAliveAndRunning, 2) {
     EXPECT_EQ(task_counter.GetRunningTasks(), 1);
 }
 
+UTEST(TaskProcessor, ExecutionSliceHistogram) {
+    engine::TaskProcessorConfig config;
+    config.name = "slices";
+    config.thread_name = "slices-worker";
+    config.worker_threads = 1;
+
+    engine::TaskProcessor task_processor{config, engine::current_task::GetTaskProcessor().GetTaskProcessorPools()};
+
+    // Only a fraction of the execution slices is sampled
+    constexpr std::size_t kTasksCount = 100;
+    for (std::size_t i = 0; i < kTasksCount; ++i) {
+        engine::AsyncNoSpan(task_processor, [] {}).Get();
+    }
+
+    const auto slices = task_processor.GetExecutionSliceHistogram().Aggregate();
+    EXPECT_GT(slices.GetView().GetTotalCount(), 0);
+    EXPECT_LE(slices.GetView().GetTotalCount(), kTasksCount);
+}
+
+UTEST(TaskProcessor, PinnedWorkStealing) {
+    engine::TaskProcessorConfig config;
+    config.name = "pinned";
+    config.thread_name = "pinned-worker";
+    config.worker_threads = 4;
+    config.task_processor_queue = engine::TaskQueueType::kWorkStealingTaskQueue;
+    config.pin_worker_threads = true;
+
+    engine::TaskProcessor task_processor{config, engine::current_task::GetTaskProcessor().GetTaskProcessorPools()};
+
+    std::vector<engine::TaskWithResult<std::vector<int>>> tasks;
+    for (std::size_t i = 0; i < 100; ++i) {
+        tasks.push_back(engine::AsyncNoSpan(task_processor, [] {
+            return utils::cpu_topology::GetCurrentThreadAllowedCpus();
+        }));
+    }
+    for (auto& task : tasks) {
+#ifdef __linux__
+        EXPECT_EQ(task.Get().size(), 1);
+#else
+        EXPECT_FALSE(task.Get().empty());
+#endif
+    }
+}
+
+UTEST(TaskProcessor, DedicatedJemallocArena) {
+    engine::TaskProcessorConfig config;
+    config.name = "arena";
+    config.thread_name = "arena-worker";
+    config.worker_threads = 2;
+    config.dedicated_jemalloc_arena = true;
+
+    engine::TaskProcessor task_processor{config, engine::current_task::GetTaskProcessor().GetTaskProcessorPools()};
+    auto data = engine::AsyncNoSpan(task_processor, [] { return std::vector<int>(100'000, 42); }).Get();
+    EXPECT_EQ(data.size(), 100'000);
+
+    // without jemalloc the worker threads use the default allocator
+    const auto arena = task_processor.GetJemallocArena();
+    if (!arena) return;
+
+    utils::jemalloc::ArenaStats stats;
+    ASSERT_FALSE(utils::jemalloc::GetArenaStats(*arena, stats));
+    EXPECT_EQ(stats.threads, config.worker_threads);
+    EXPECT_GE(stats.allocated, data.size() * sizeof(int));
+    EXPECT_GE(stats.active, stats.allocated);
+}
+
+UTEST(TaskProcessor, AdaptiveSpinning) {
+    engine::TaskProcessorConfig config;
+    config.name = "adaptive";
+    config.thread_name = "adaptive-worker";
+    config.worker_threads = 2;
+    config.adaptive_spinning = true;
+
+    engine::TaskProcessor task_processor{config, engine::current_task::GetTaskProcessor().GetTaskProcessorPools()};
+    EXPECT_FALSE(engine::current_task::GetTaskProcessor().GetSpinningStats().has_value());
+
+    constexpr std::size_t kTasksCount = 100;
+    for (std::size_t i = 0; i < kTasksCount; ++i) {
+        engine::AsyncNoSpan(task_processor, [] {}).Get();
+    }
+
+    const auto stats = task_processor.GetSpinningStats();
+    ASSERT_TRUE(stats.has_value());
+    EXPECT_GE(stats->spin_wakeups + stats->sleep_wakeups, kTasksCount);
+    EXPECT_GE(stats->budget_iterations, engine::AdaptiveSpinning::kMinIterations * config.worker_threads);
+    EXPECT_LE(stats->budget_iterations, static_cast<std::size_t>(config.spinning_iterations) * config.worker_threads);
+}
+
 USERVER_NAMESPACE_END
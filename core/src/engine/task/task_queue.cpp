@@ -1,5 +1,8 @@
 #include <engine/task/task_queue.hpp>
 
+#include <atomic>
+#include <chrono>
+
 #include <engine/task/task_context.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -7,11 +10,48 @@ USERVER_NAMESPACE_BEGIN
 namespace engine {
 
 namespace {
+
 constexpr std::size_t kSemaphoreInitialCount = 0;
+
+// Out of every 13 pops 8 prefer the latency-critical lane, 4 prefer the normal
+// lane and 1 prefers the background lane. Empty lanes are skipped, so weights
+// matter only when there are tasks of different priorities in the queue.
+constexpr std::array<std::size_t, kTaskPrioritiesCount> kLaneWeights{8, 4, 1};
+constexpr std::size_t kLaneWeightsSum = kLaneWeights[0] + kLaneWeights[1] + kLaneWeights[2];
+
+std::size_t GetPreferredLane() noexcept {
+    thread_local std::size_t pop_count = 0;
+    auto step = pop_count;
+    pop_count = (pop_count + 1) % kLaneWeightsSum;
+
+    for (std::size_t lane = 0; lane < kLaneWeights.size(); ++lane) {
+        if (step < kLaneWeights[lane]) return lane;
+        step -= kLaneWeights[lane];
+    }
+    UASSERT_MSG(false, "Unreachable");
+    return 0;
+}
+
+std::size_t GetLane(const impl::TaskContext* context) noexcept {
+    static_assert(static_cast<std::size_t>(TaskPriority::kBackground) + 1 == kTaskPrioritiesCount);
+    // nullptr is a stop signal
+    return static_cast<std::size_t>(context ? context->GetPriority() : TaskPriority::kNormal);
 }
 
+// Current thread handles only a single TaskProcessor
+thread_local AdaptiveSpinning* local_adaptive_spinning = nullptr;
+
+}  // namespace
+
 TaskQueue::TaskQueue(const TaskProcessorConfig& config)
-    : queue_semaphore_(kSemaphoreInitialCount, config.spinning_iterations) {}
+    // Spinning is done by WaitForTask() in adaptive mode
+    : queue_semaphore_(kSemaphoreInitialCount, config.adaptive_spinning ? 0 : config.spinning_iterations) {
+    if (config.adaptive_spinning) {
+        adaptive_spinning_ = utils::FixedArray<concurrent::impl::InterferenceShield<AdaptiveSpinning>>(
+            config.worker_threads, static_cast<std::size_t>(std::max(config.spinning_iterations, 0))
+        );
+    }
+}
 
 void TaskQueue::Push(boost::intrusive_ptr<impl::TaskContext>&& context) {
     UASSERT(context);
@@ -19,13 +59,30 @@ void TaskQueue::Push(boost::intrusive_ptr<impl::TaskContext>&& context) {
     context.detach();
 }
 
+void TaskQueue::PushBatch(utils::span<boost::intrusive_ptr<impl::TaskContext>> contexts) {
+    if (contexts.empty()) return;
+
+    for (auto& context : contexts) {
+        UASSERT(context);
+        auto* const raw_context = context.get();
+        lanes_[GetLane(raw_context)].enqueue(raw_context);
+        context.detach();
+    }
+    // Wakes up to contexts.size() sleeping workers with a single atomic update
+    queue_semaphore_.signal(static_cast<moodycamel::LightweightSemaphore::ssize_t>(contexts.size()));
+}
+
 boost::intrusive_ptr<impl::TaskContext> TaskQueue::PopBlocking() {
     // Current thread handles only a single TaskProcessor, so it's safe to store
     // a token for the task processor in a thread-local variable.
-    thread_local moodycamel::ConsumerToken token(queue_);
+    thread_local ConsumerTokens tokens{
+        moodycamel::ConsumerToken{lanes_[0]},
+        moodycamel::ConsumerToken{lanes_[1]},
+        moodycamel::ConsumerToken{lanes_[2]},
+    };
 
     boost::intrusive_ptr<impl::TaskContext> context{
-        DoPopBlocking(token),
+        DoPopBlocking(tokens),
         /* add_ref= */ false};
 
     if (!context) {
@@ -38,29 +95,77 @@ boost::intrusive_ptr<impl::TaskContext> TaskQueue::PopBlocking() {
 
 void TaskQueue::StopProcessing() { DoPush(nullptr); }
 
-std::size_t TaskQueue::GetSizeApproximate() const noexcept { return queue_.size_approx(); }
+std::size_t TaskQueue::GetSizeApproximate() const noexcept {
+    std::size_t size{0};
+    for (const auto& lane : lanes_) {
+        size += lane.size_approx();
+    }
+    return size;
+}
+
+void TaskQueue::PrepareWorker(std::size_t index) {
+    if (index < adaptive_spinning_.size()) {
+        local_adaptive_spinning = &*adaptive_spinning_[index];
+    }
+}
+
+std::optional<SpinningStats> TaskQueue::GetSpinningStats() const noexcept {
+    if (adaptive_spinning_.empty()) return std::nullopt;
 
-void TaskQueue::PrepareWorker(std::size_t) {}
+    SpinningStats stats;
+    for (const auto& spinning : adaptive_spinning_) {
+        spinning->AppendStats(stats);
+    }
+    return stats;
+}
 
 void TaskQueue::DoPush(impl::TaskContext* context) {
     // This piece of code is copy-pasted from
     // moodycamel::BlockingConcurrentQueue::enqueue
-    queue_.enqueue(context);
+    lanes_[GetLane(context)].enqueue(context);
     queue_semaphore_.signal();
 }
 
-impl::TaskContext* TaskQueue::DoPopBlocking(moodycamel::ConsumerToken& token) {
+impl::TaskContext* TaskQueue::DoPopBlocking(ConsumerTokens& tokens) {
     impl::TaskContext* context{};
 
-    // This piece of code is copy-pasted from
+    // This piece of code is based on
     // moodycamel::BlockingConcurrentQueue::wait_dequeue
-    queue_semaphore_.wait();
-    while (!queue_.try_dequeue(token, context)) {
+    WaitForTask();
+    const auto preferred_lane = GetPreferredLane();
+    while (true) {
+        if (lanes_[preferred_lane].try_dequeue(tokens[preferred_lane], context)) return context;
+        for (std::size_t lane = 0; lane < lanes_.size(); ++lane) {
+            if (lane != preferred_lane && lanes_[lane].try_dequeue(tokens[lane], context)) return context;
+        }
         // Can happen when another consumer steals our item in exchange for another
         // item in a Moodycamel sub-queue that we have already passed.
     }
+}
 
-    return context;
+void TaskQueue::WaitForTask() {
+    auto* const spinning = local_adaptive_spinning;
+    if (!spinning) {
+        queue_semaphore_.wait();
+        return;
+    }
+    if (queue_semaphore_.tryWait()) return;
+
+    // Same as moodycamel::LightweightSemaphore::waitWithPartialSpinning, but
+    // with the number of iterations chosen by AdaptiveSpinning.
+    const auto budget = spinning->GetBudget();
+    const auto spin_start = std::chrono::steady_clock::now();
+    for (std::size_t iteration = 1; iteration <= budget; ++iteration) {
+        if (queue_semaphore_.tryWait()) {
+            spinning->AccountSpinWakeup(iteration, std::chrono::steady_clock::now() - spin_start);
+            return;
+        }
+        std::atomic_signal_fence(std::memory_order_acquire);  // Prevent the compiler from collapsing the loop
+    }
+
+    const auto sleep_start = std::chrono::steady_clock::now();
+    queue_semaphore_.wait();
+    spinning->AccountSleepWakeup(sleep_start - spin_start, std::chrono::steady_clock::now() - sleep_start);
 }
 
 }  // namespace engine
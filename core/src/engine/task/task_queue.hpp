@@ -1,10 +1,18 @@
 #pragma once
 
+#include <array>
+#include <optional>
+
 #include <moodycamel/blockingconcurrentqueue.h>
 #include <moodycamel/lightweightsemaphore.h>
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
+#include <engine/task/adaptive_spinning.hpp>
 #include <engine/task/task_processor_config.hpp>
+#include <userver/concurrent/impl/interference_shield.hpp>
+#include <userver/engine/task/task_priority.hpp>
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -14,12 +22,17 @@ namespace impl {
 class TaskContext;
 }  // namespace impl
 
+// Global queue with a separate lane for each TaskPriority. Lanes are served
+// with weighted round-robin, see kLaneWeights in task_queue.cpp.
 class TaskQueue final {
 public:
     explicit TaskQueue(const TaskProcessorConfig& config);
 
     void Push(boost::intrusive_ptr<impl::TaskContext>&& context);
 
+    // Takes ownership of all the contexts, signals the semaphore once
+    void PushBatch(utils::span<boost::intrusive_ptr<impl::TaskContext>> contexts);
+
     // Returns nullptr as a stop signal
     boost::intrusive_ptr<impl::TaskContext> PopBlocking();
 
@@ -29,13 +42,23 @@ public:
 
     void PrepareWorker(std::size_t index);
 
+    // std::nullopt if adaptive spinning is disabled
+    std::optional<SpinningStats> GetSpinningStats() const noexcept;
+
 private:
+    using Lane = moodycamel::ConcurrentQueue<impl::TaskContext*>;
+    using ConsumerTokens = std::array<moodycamel::ConsumerToken, kTaskPrioritiesCount>;
+
     void DoPush(impl::TaskContext* context);
 
-    impl::TaskContext* DoPopBlocking(moodycamel::ConsumerToken& token);
+    impl::TaskContext* DoPopBlocking(ConsumerTokens& tokens);
+
+    void WaitForTask();
 
-    moodycamel::ConcurrentQueue<impl::TaskContext*> queue_;
+    std::array<Lane, kTaskPrioritiesCount> lanes_;
     moodycamel::LightweightSemaphore queue_semaphore_;
+    // One per worker, empty if adaptive spinning is disabled
+    utils::FixedArray<concurrent::impl::InterferenceShield<AdaptiveSpinning>> adaptive_spinning_;
 };
 
 }  // namespace engine
@@ -53,7 +53,7 @@ Consumer::Consumer(WorkStealingTaskQueue& owner, ConsumersManager& consumers_man
       background_queue_token_(owner.background_queue_.CreateConsumerToken()) {}
 
 void Consumer::Push(impl::TaskContext* ctx) {
-    if (ctx && ctx->IsBackground()) {
+    if (ctx && WorkStealingTaskQueue::IsBackgroundTask(*ctx)) {
         owner_.background_queue_.Push(background_queue_token_, ctx);
         return;
     }
@@ -81,6 +81,12 @@ WorkStealingTaskQueue* Consumer::GetOwner() const noexcept { return &owner_; }
 
 void Consumer::SetIndex(std::size_t index) noexcept { inner_index_ = index; }
 
+void Consumer::SetStealOrder(std::vector<std::size_t> steal_order, std::vector<std::size_t> group_ends) {
+    UASSERT(group_ends.empty() || group_ends.back() == steal_order.size());
+    steal_order_ = std::move(steal_order);
+    steal_order_group_ends_ = std::move(group_ends);
+}
+
 bool Consumer::IsStopped() const noexcept { return consumers_manager_.IsStopped(); }
 
 void Consumer::EmptySurplusQueue(impl::TaskContext* extra) {
@@ -104,19 +110,10 @@ impl::TaskContext*
 Consumer::StealFromAnotherConsumerOrGlobalQueue(const std::size_t attempts, std::size_t to_steal_count) {
     std::size_t stealed_size = 0;
     for (std::size_t i = 0; i < attempts && to_steal_count > 0 && stealed_size == 0; ++i) {
-        std::size_t start_index = rnd_() % owner_.consumers_count_;
-        for (std::size_t shift = 0; shift < owner_.consumers_count_ && to_steal_count > 0 && stealed_size == 0;
-             ++shift) {
-            std::size_t index = (start_index + shift) % owner_.consumers_count_;
-            Consumer* victim = &owner_.consumers_[index];
-            if (victim == this) {
-                continue;
-            }
-            const std::size_t tasks_count =
-                victim->Steal(utils::span(steal_buffer_.data() + stealed_size, to_steal_count));
-            stealed_size += tasks_count;
-            to_steal_count -= tasks_count;
-        }
+        const std::size_t tasks_count =
+            StealFromAnotherConsumer(utils::span(steal_buffer_.data() + stealed_size, to_steal_count));
+        stealed_size += tasks_count;
+        to_steal_count -= tasks_count;
 
         if (stealed_size == 0) {
             impl::TaskContext* ctx = owner_.global_queue_.TryPop(global_queue_token_);
@@ -144,6 +141,39 @@ Consumer::StealFromAnotherConsumerOrGlobalQueue(const std::size_t attempts, std:
     return nullptr;
 }
 
+std::size_t Consumer::StealFromAnotherConsumer(utils::span<impl::TaskContext*> buffer) {
+    if (steal_order_.empty()) {
+        const std::size_t start_index = rnd_() % owner_.consumers_count_;
+        for (std::size_t shift = 0; shift < owner_.consumers_count_; ++shift) {
+            const std::size_t index = (start_index + shift) % owner_.consumers_count_;
+            Consumer* victim = &owner_.consumers_[index];
+            if (victim == this) {
+                continue;
+            }
+            if (const std::size_t tasks_count = victim->Steal(buffer)) {
+                return tasks_count;
+            }
+        }
+        return 0;
+    }
+
+    // Random start inside each group spreads the stealing load between
+    // the equally close victims.
+    std::size_t group_begin = 0;
+    for (const std::size_t group_end : steal_order_group_ends_) {
+        const std::size_t group_size = group_end - group_begin;
+        const std::size_t start_index = rnd_() % group_size;
+        for (std::size_t shift = 0; shift < group_size; ++shift) {
+            const std::size_t index = steal_order_[group_begin + (start_index + shift) % group_size];
+            if (const std::size_t tasks_count = owner_.consumers_[index].Steal(buffer)) {
+                return tasks_count;
+            }
+        }
+        group_begin = group_end;
+    }
+    return 0;
+}
+
 std::size_t Consumer::Steal(utils::span<impl::TaskContext*> buffer) {
     std::size_t can_be_stealed_count = local_queue_.GetSize();
     if (can_be_stealed_count) {
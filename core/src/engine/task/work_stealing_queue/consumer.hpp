@@ -4,6 +4,7 @@
 #include <condition_variable>
 #include <cstddef>
 #include <random>
+#include <vector>
 
 #include <engine/task/work_stealing_queue/global_queue.hpp>
 #include <engine/task/work_stealing_queue/local_queue.hpp>
@@ -37,12 +38,18 @@ private:
 
     void SetIndex(std::size_t index) noexcept;
 
+    // Victims are visited group by group, groups go from the closest consumers
+    // to the farthest ones. Empty steal_order means visiting in random order.
+    void SetStealOrder(std::vector<std::size_t> steal_order, std::vector<std::size_t> group_ends);
+
     bool IsStopped() const noexcept;
 
     void EmptySurplusQueue(impl::TaskContext* extra);
 
     impl::TaskContext* StealFromAnotherConsumerOrGlobalQueue(const std::size_t attempts, std::size_t to_steal);
 
+    std::size_t StealFromAnotherConsumer(utils::span<impl::TaskContext*> buffer);
+
     std::size_t Steal(utils::span<impl::TaskContext*> buffer);
 
     impl::TaskContext* TryPopFromOwnerQueue(const bool is_global);
@@ -77,6 +84,8 @@ private:
     std::array<impl::TaskContext*, kConsumerStealBufferSize + 1> steal_buffer_{};
     std::minstd_rand rnd_;
     std::size_t steps_count_{0};
+    std::vector<std::size_t> steal_order_;
+    std::vector<std::size_t> steal_order_group_ends_;
     std::atomic<std::int32_t> sleep_counter_{0};
     GlobalQueue::Token global_queue_token_;
     GlobalQueue::Token background_queue_token_;
@@ -1,5 +1,9 @@
 #include <engine/task/work_stealing_queue/task_queue.hpp>
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #include <userver/utils/assert.hpp>
 #include <userver/utils/rand.hpp>
 
@@ -16,6 +20,12 @@ thread_local Consumer* localConsumer = nullptr;
 }  // namespace
 
 WorkStealingTaskQueue::WorkStealingTaskQueue(const TaskProcessorConfig& config)
+    : WorkStealingTaskQueue(config, {}) {}
+
+WorkStealingTaskQueue::WorkStealingTaskQueue(
+    const TaskProcessorConfig& config,
+    utils::span<const utils::cpu_topology::CpuInfo> worker_cpus
+)
     : consumers_count_(config.worker_threads),
       global_queue_(consumers_count_),
       background_queue_(consumers_count_),
@@ -24,6 +34,9 @@ WorkStealingTaskQueue::WorkStealingTaskQueue(const TaskProcessorConfig& config)
     for (size_t i = 0; i < consumers_count_; ++i) {
         consumers_[i].SetIndex(i);
     }
+    if (!worker_cpus.empty()) {
+        SetupTopologyAwareStealing(worker_cpus);
+    }
 }
 
 void WorkStealingTaskQueue::Push(boost::intrusive_ptr<impl::TaskContext>&& context) {
@@ -31,6 +44,18 @@ void WorkStealingTaskQueue::Push(boost::intrusive_ptr<impl::TaskContext>&& conte
     context.detach();
 }
 
+void WorkStealingTaskQueue::PushBatch(utils::span<boost::intrusive_ptr<impl::TaskContext>> contexts) {
+    if (contexts.empty()) return;
+
+    for (auto& context : contexts) {
+        UASSERT(context);
+        PushWithoutNotify(context.get());
+        context.detach();
+    }
+    // A woken up consumer wakes up the next one if it finds more work
+    consumers_manager_.NotifyNewTask();
+}
+
 boost::intrusive_ptr<impl::TaskContext> WorkStealingTaskQueue::PopBlocking() {
     boost::intrusive_ptr<impl::TaskContext> context{
         DoPopBlocking(),
@@ -61,20 +86,22 @@ void WorkStealingTaskQueue::PrepareWorker(std::size_t index) {
 }
 
 void WorkStealingTaskQueue::DoPush(impl::TaskContext* context) {
-    {
-        Consumer* consumer = GetConsumer();
-
-        if (consumer != nullptr && consumer->GetOwner() == this) {
-            consumer->Push(context);
-        } else if (context && context->IsBackground()) {
-            background_queue_.Push(context);
-        } else {
-            global_queue_.Push(context);
-        }
-    }
+    PushWithoutNotify(context);
     consumers_manager_.NotifyNewTask();
 }
 
+void WorkStealingTaskQueue::PushWithoutNotify(impl::TaskContext* context) {
+    Consumer* consumer = GetConsumer();
+
+    if (consumer != nullptr && consumer->GetOwner() == this) {
+        consumer->Push(context);
+    } else if (context && IsBackgroundTask(*context)) {
+        background_queue_.Push(context);
+    } else {
+        global_queue_.Push(context);
+    }
+}
+
 impl::TaskContext* WorkStealingTaskQueue::DoPopBlocking() {
     Consumer* consumer = GetConsumer();
     UASSERT(consumer != nullptr);
@@ -83,6 +110,38 @@ impl::TaskContext* WorkStealingTaskQueue::DoPopBlocking() {
 
 Consumer* WorkStealingTaskQueue::GetConsumer() { return localConsumer; }
 
+bool WorkStealingTaskQueue::IsBackgroundTask(const impl::TaskContext& context) noexcept {
+    return context.IsBackground() || context.GetPriority() == TaskPriority::kBackground;
+}
+
+void WorkStealingTaskQueue::SetupTopologyAwareStealing(utils::span<const utils::cpu_topology::CpuInfo> worker_cpus) {
+    UINVARIANT(worker_cpus.size() == consumers_count_, "Each consumer should have a cpu assigned");
+
+    for (std::size_t i = 0; i < consumers_count_; ++i) {
+        std::vector<std::pair<utils::cpu_topology::Distance, std::size_t>> victims;
+        victims.reserve(consumers_count_ - 1);
+        for (std::size_t j = 0; j < consumers_count_; ++j) {
+            if (i == j) continue;
+            victims.emplace_back(utils::cpu_topology::GetDistance(worker_cpus[i], worker_cpus[j]), j);
+        }
+        std::sort(victims.begin(), victims.end());
+
+        std::vector<std::size_t> steal_order;
+        std::vector<std::size_t> group_ends;
+        steal_order.reserve(victims.size());
+        for (std::size_t k = 0; k < victims.size(); ++k) {
+            if (k != 0 && victims[k].first != victims[k - 1].first) {
+                group_ends.push_back(k);
+            }
+            steal_order.push_back(victims[k].second);
+        }
+        if (!steal_order.empty()) {
+            group_ends.push_back(steal_order.size());
+        }
+        consumers_[i].SetStealOrder(std::move(steal_order), std::move(group_ends));
+    }
+}
+
 }  // namespace engine
 
 USERVER_NAMESPACE_END
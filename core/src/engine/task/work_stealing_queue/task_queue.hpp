@@ -8,6 +8,8 @@
 #include <engine/task/work_stealing_queue/consumer.hpp>
 #include <engine/task/work_stealing_queue/consumers_manager.hpp>
 #include <engine/task/work_stealing_queue/global_queue.hpp>
+#include <userver/utils/span.hpp>
+#include <utils/cpu_topology.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -23,7 +25,18 @@ class WorkStealingTaskQueue final {
 public:
     explicit WorkStealingTaskQueue(const TaskProcessorConfig& config);
 
+    // If worker_cpus are provided, consumers steal from the topologically
+    // closest consumers first: SMT sibling, same LLC, same NUMA node, remote.
+    WorkStealingTaskQueue(
+        const TaskProcessorConfig& config,
+        utils::span<const utils::cpu_topology::CpuInfo> worker_cpus
+    );
+
     void Push(boost::intrusive_ptr<impl::TaskContext>&& context);
+
+    // Takes ownership of all the contexts, notifies the consumers once
+    void PushBatch(utils::span<boost::intrusive_ptr<impl::TaskContext>> contexts);
+
     // Returns nullptr as a stop signal
     boost::intrusive_ptr<impl::TaskContext> PopBlocking();
 
@@ -36,10 +49,17 @@ public:
 private:
     void DoPush(impl::TaskContext* context);
 
+    void PushWithoutNotify(impl::TaskContext* context);
+
     impl::TaskContext* DoPopBlocking();
 
     Consumer* GetConsumer();
 
+    // Yielded tasks and tasks with TaskPriority::kBackground
+    static bool IsBackgroundTask(const impl::TaskContext& context) noexcept;
+
+    void SetupTopologyAwareStealing(utils::span<const utils::cpu_topology::CpuInfo> worker_cpus);
+
     const std::size_t consumers_count_;
 
     GlobalQueue global_queue_;
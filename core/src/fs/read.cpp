@@ -1,10 +1,18 @@
 #include <userver/fs/read.hpp>
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <system_error>
+
 #include <boost/filesystem.hpp>
+#include <fmt/format.h>
 
+#include <engine/io/uring.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/utils/async.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -18,6 +26,26 @@ bool IsHiddenFile(const boost::filesystem::path& path) {
     return name != ".." && name != "." && name[0] == '.';
 }
 
+constexpr std::size_t kInitialReadSize = 64 * 1024;
+
+std::string ReadFileContents(engine::io::impl::Uring& uring, const std::string& path) {
+    const int fd = uring.OpenAt(AT_FDCWD, path.c_str(), O_RDONLY | O_CLOEXEC, 0);
+    if (fd < 0) throw std::system_error(-fd, std::generic_category(), fmt::format("Error opening '{}'", path));
+    const utils::FastScopeGuard close_guard([fd]() noexcept { ::close(fd); });
+
+    std::string contents(kInitialReadSize, '\0');
+    std::size_t size = 0;
+    while (true) {
+        if (size == contents.size()) contents.resize(contents.size() * 2);
+        const int res = uring.Read(fd, contents.data() + size, contents.size() - size, size);
+        if (res < 0) throw std::system_error(-res, std::generic_category(), fmt::format("Error reading '{}'", path));
+        if (res == 0) break;
+        size += static_cast<std::size_t>(res);
+    }
+    contents.resize(size);
+    return contents;
+}
+
 }  // namespace
 
 std::string GetLexicallyRelative(std::string_view path, std::string_view dir) {
@@ -28,6 +56,7 @@ std::string GetLexicallyRelative(std::string_view path, std::string_view dir) {
 }
 
 std::string ReadFileContents(engine::TaskProcessor& async_tp, const std::string& path) {
+    if (auto* uring = engine::io::impl::GetCurrentFileUring()) return ReadFileContents(*uring, path);
     return engine::AsyncNoSpan(async_tp, &fs::blocking::ReadFileContents, path).Get();
 }
 
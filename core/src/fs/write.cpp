@@ -1,16 +1,45 @@
 #include <userver/fs/write.hpp>
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <system_error>
+
 #include <fmt/format.h>
 
 #include <boost/filesystem/operations.hpp>
 
+#include <engine/io/uring.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/fs/blocking/write.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace fs {
 
+namespace {
+
+void RewriteFileContents(engine::io::impl::Uring& uring, const std::string& path, std::string_view contents) {
+    // the same flags and permissions as fs::blocking::RewriteFileContents uses
+    const int fd = uring.OpenAt(AT_FDCWD, path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    if (fd < 0) throw std::system_error(-fd, std::generic_category(), fmt::format("Error opening '{}'", path));
+    utils::FastScopeGuard close_guard([fd]() noexcept { ::close(fd); });
+
+    std::size_t written = 0;
+    while (written < contents.size()) {
+        const int res = uring.Write(fd, contents.data() + written, contents.size() - written, written);
+        if (res < 0) throw std::system_error(-res, std::generic_category(), fmt::format("Error writing '{}'", path));
+        written += static_cast<std::size_t>(res);
+    }
+
+    close_guard.Release();
+    const int res = uring.Close(fd);
+    if (res < 0) throw std::system_error(-res, std::generic_category(), fmt::format("Error closing '{}'", path));
+}
+
+}  // namespace
+
 void CreateDirectories(engine::TaskProcessor& async_tp, std::string_view path, boost::filesystem::perms perms) {
     engine::AsyncNoSpan(async_tp, [path, perms] { fs::blocking::CreateDirectories(path, perms); }).Get();
 }
@@ -20,6 +49,10 @@ void CreateDirectories(engine::TaskProcessor& async_tp, std::string_view path) {
 }
 
 void RewriteFileContents(engine::TaskProcessor& async_tp, const std::string& path, std::string_view contents) {
+    if (auto* uring = engine::io::impl::GetCurrentFileUring()) {
+        RewriteFileContents(*uring, path, contents);
+        return;
+    }
     engine::AsyncNoSpan(async_tp, &fs::blocking::RewriteFileContents, path, contents).Get();
 }
 
@@ -282,6 +282,7 @@ properties:
                       - raw
                       - json
                       - json_yadeploy
+                      - binary
                 flush_level:
                     type: string
                     description: messages of this and higher levels get flushed to the file immediately
@@ -297,6 +298,23 @@ properties:
                     enum:
                       - discard
                       - block
+                deferred_formatting:
+                    type: boolean
+                    description: capture log records unformatted and format them in the logger task
+                    defaultDescription: false
+                batched_file_sink:
+                    type: boolean
+                    description: write the log file in large batches from a dedicated thread and drop the written data from the page cache
+                    defaultDescription: false
+                zstd_compression:
+                    type: boolean
+                    description: write the log file as a sequence of independent zstd frames
+                    defaultDescription: false
+                zstd_frame_size:
+                    type: integer
+                    description: uncompressed size of the logs in a single zstd frame
+                    defaultDescription: 4194304
+                    minimum: 1
                 fs-task-processor:
                     type: string
                     description: task processor for disk I/O operations for this logger
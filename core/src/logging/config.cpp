@@ -44,6 +44,11 @@ LoggerConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<Logg
     config.queue_overflow_behavior =
         value["overflow_behavior"].As<QueueOverflowBehavior>(config.queue_overflow_behavior);
 
+    config.deferred_formatting = value["deferred_formatting"].As<bool>(config.deferred_formatting);
+    config.batched_file_sink = value["batched_file_sink"].As<bool>(config.batched_file_sink);
+    config.zstd_compression = value["zstd_compression"].As<bool>(config.zstd_compression);
+    config.zstd_frame_size = value["zstd_frame_size"].As<size_t>(config.zstd_frame_size);
+
     config.fs_task_processor = value["fs-task-processor"].As<std::optional<std::string>>();
 
     config.testsuite_capture = value["testsuite-capture"].As<std::optional<TestsuiteCaptureConfig>>();
@@ -24,6 +24,7 @@ QueueOverflowBehavior Parse(const yaml_config::YamlConfig& value, formats::parse
 
 struct LoggerConfig final {
     static constexpr size_t kDefaultMessageQueueSize = 1 << 16;
+    static constexpr size_t kDefaultZstdFrameSize = 4 << 20;
 
     void SetName(std::string name);
 
@@ -38,6 +39,17 @@ struct LoggerConfig final {
     size_t message_queue_size = kDefaultMessageQueueSize;
     QueueOverflowBehavior queue_overflow_behavior = QueueOverflowBehavior::kDiscard;
 
+    // capture records unformatted and format them in the logger task
+    bool deferred_formatting = false;
+
+    // write files in large batches from a dedicated thread
+    bool batched_file_sink = false;
+
+    // write the file as a sequence of zstd frames of `zstd_frame_size`
+    // uncompressed bytes each
+    bool zstd_compression = false;
+    size_t zstd_frame_size = kDefaultZstdFrameSize;
+
     std::optional<std::string> fs_task_processor;
 
     std::optional<TestsuiteCaptureConfig> testsuite_capture;
@@ -29,6 +29,25 @@ DynamicDebugConfig Parse(const formats::json::Value& value, formats::parse::To<D
     return result;
 }
 
+bool operator==(const LogSamplingSettings& a, const LogSamplingSettings& b) {
+    return a.sampling_rate == b.sampling_rate && a.bytes_per_second == b.bytes_per_second;
+}
+
+LogSamplingSettings Parse(const formats::json::Value& value, formats::parse::To<LogSamplingSettings>) {
+    LogSamplingSettings result;
+    result.sampling_rate = value["sampling-rate"].As<double>(result.sampling_rate);
+    result.bytes_per_second = value["bytes-per-second"].As<std::uint64_t>(result.bytes_per_second);
+    return result;
+}
+
+bool operator==(const LogSamplingConfig& a, const LogSamplingConfig& b) { return a.locations == b.locations; }
+
+LogSamplingConfig Parse(const formats::json::Value& value, formats::parse::To<LogSamplingConfig>) {
+    LogSamplingConfig result;
+    result.locations = value["locations"].As<std::unordered_map<std::string, LogSamplingSettings>>({});
+    return result;
+}
+
 }  // namespace logging
 
 USERVER_NAMESPACE_END
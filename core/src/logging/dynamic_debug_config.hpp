@@ -3,6 +3,7 @@
 #include <string>
 #include <unordered_map>
 
+#include <logging/dynamic_debug.hpp>
 #include <userver/formats/parse/to.hpp>
 #include <userver/logging/level.hpp>
 
@@ -23,6 +24,18 @@ bool operator==(const DynamicDebugConfig& a, const DynamicDebugConfig& b);
 
 DynamicDebugConfig Parse(const formats::json::Value&, formats::parse::To<DynamicDebugConfig>);
 
+bool operator==(const LogSamplingSettings& a, const LogSamplingSettings& b);
+
+LogSamplingSettings Parse(const formats::json::Value&, formats::parse::To<LogSamplingSettings>);
+
+struct LogSamplingConfig {
+    std::unordered_map<std::string, LogSamplingSettings> locations;
+};
+
+bool operator==(const LogSamplingConfig& a, const LogSamplingConfig& b);
+
+LogSamplingConfig Parse(const formats::json::Value&, formats::parse::To<LogSamplingConfig>);
+
 }  // namespace logging
 
 USERVER_NAMESPACE_END
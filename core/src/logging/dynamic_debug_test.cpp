@@ -292,4 +292,106 @@ TEST_F(LoggingTest, DynamicDebugDisableLevel) {
     EXPECT_THAT(GetStreamString(), testing::HasSubstr("unrelated"));
 }
 
+TEST_F(LoggingTest, LogSamplingRate) {
+    const std::string filename{USERVER_FILEPATH};
+    SetDefaultLoggerLevel(logging::Level::kInfo);
+
+    const auto do_log = [](std::string_view string) {
+#line 70001
+        LOG_INFO() << string;
+    };
+
+    logging::SetLogSampling(filename, 70001, {/*sampling_rate=*/0.1, /*bytes_per_second=*/0});
+
+    for (int i = 0; i < 100; ++i) {
+        do_log("sampled");
+    }
+    LOG_INFO() << "unrelated";
+
+    std::uint64_t suppressed = 0;
+    logging::ForEachLogSampling([&](const logging::LogEntryContent& location, const auto& sampling) {
+        if (location.line == 70001) suppressed = sampling.GetSuppressedCount();
+    });
+
+    logging::RemoveAllLogSampling();
+    ClearLog();
+    do_log("after");
+
+    EXPECT_EQ(suppressed, 90);
+    EXPECT_THAT(GetStreamString(), testing::HasSubstr("after"));
+}
+
+TEST_F(LoggingTest, LogSamplingRateCount) {
+    const std::string filename{USERVER_FILEPATH};
+    SetDefaultLoggerLevel(logging::Level::kInfo);
+
+    const auto do_log = [](std::string_view string) {
+#line 80001
+        LOG_INFO() << string;
+    };
+
+    logging::SetLogSampling(filename, 80001, {/*sampling_rate=*/0.25, /*bytes_per_second=*/0});
+    for (int i = 0; i < 20; ++i) {
+        do_log("sampled");
+    }
+    logging::RemoveAllLogSampling();
+
+    EXPECT_EQ(GetRecordsCount(), 5);
+}
+
+TEST_F(LoggingTest, LogSamplingBytesPerSecond) {
+    const std::string filename{USERVER_FILEPATH};
+    SetDefaultLoggerLevel(logging::Level::kInfo);
+
+    const auto do_log = [](std::string_view string) {
+#line 90001
+        LOG_INFO() << string;
+    };
+
+    logging::SetLogSampling(filename, 90001, {/*sampling_rate=*/1.0, /*bytes_per_second=*/100});
+
+    // Even if the second changes in the middle, at most 2 windows of 100 bytes
+    // are logged.
+    const std::string message(50, 'x');
+    for (int i = 0; i < 100; ++i) {
+        do_log(message);
+    }
+    logging::RemoveAllLogSampling();
+
+    EXPECT_GE(GetRecordsCount(), 2);
+    EXPECT_LE(GetRecordsCount(), 4);
+}
+
+TEST_F(LoggingTest, LogSamplingForceEnabled) {
+    const std::string filename{USERVER_FILEPATH};
+    SetDefaultLoggerLevel(logging::Level::kNone);
+
+    const auto do_log = [](std::string_view string) {
+#line 100001
+        LOG_INFO() << string;
+    };
+
+    logging::SetLogSampling(filename, 100001, {/*sampling_rate=*/0.01, /*bytes_per_second=*/0});
+    logging::AddDynamicDebugLog(filename, 100001);
+
+    for (int i = 0; i < 10; ++i) {
+        do_log("forced");
+    }
+
+    logging::RemoveDynamicDebugLog(filename, 100001);
+    logging::RemoveAllLogSampling();
+
+    EXPECT_EQ(GetRecordsCount(), 10);
+}
+
+TEST(LogSampling, InvalidRate) {
+    const std::string filename{USERVER_FILEPATH};
+    UEXPECT_THROW(
+        logging::SetLogSampling(filename, 1, {/*sampling_rate=*/0.0, /*bytes_per_second=*/0}), std::runtime_error
+    );
+    UEXPECT_THROW(
+        logging::SetLogSampling(filename, 1, {/*sampling_rate=*/1.5, /*bytes_per_second=*/0}), std::runtime_error
+    );
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,148 @@
+#include "batched_file_sink.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <utility>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/thread_name.hpp>
+
+#include "open_file_helper.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+namespace {
+constexpr std::string_view kWriterThreadName = "log-file-writer";
+}  // namespace
+
+BatchedFileSink::BatchedFileSink(const std::string& filename, std::size_t buffer_size)
+    : filename_{filename},
+      buffer_size_{buffer_size},
+      fd_(OpenFile<fs::blocking::FileDescriptor>(filename)),
+      writer_([this] {
+          utils::SetCurrentThreadName(kWriterThreadName);
+          WriterLoop();
+      }) {
+    UASSERT(buffer_size_ > 0);
+    active_buffer_.reserve(buffer_size_);
+    if (fd_.GetSize() > 0) {
+        active_buffer_.append("\n");
+    }
+}
+
+BatchedFileSink::~BatchedFileSink() {
+    try {
+        Flush();
+    } catch (const std::exception&) {
+        // The logs are lost, there is no one to report that to
+    }
+
+    {
+        const std::lock_guard lock{mutex_};
+        is_stopping_ = true;
+    }
+    cv_.notify_all();
+    writer_.join();
+}
+
+void BatchedFileSink::Flush() {
+    SubmitActiveBuffer();
+    WaitForWriter();
+}
+
+void BatchedFileSink::Reopen(ReopenMode mode) {
+    Flush();
+
+    // The writer thread is idle until the next SubmitActiveBuffer, so it is
+    // safe to replace the file
+    fd_.FSync();
+    std::move(fd_).Close();
+    fd_ = OpenFile<fs::blocking::FileDescriptor>(filename_, mode);
+    previous_batch_offset_ = 0;
+    previous_batch_size_ = 0;
+}
+
+void BatchedFileSink::Write(std::string_view log) {
+    if (!active_buffer_.empty() && active_buffer_.size() + log.size() > buffer_size_) {
+        SubmitActiveBuffer();
+    }
+    active_buffer_.append(log);
+}
+
+void BatchedFileSink::SubmitActiveBuffer() {
+    if (active_buffer_.empty()) return;
+
+    {
+        std::unique_lock lock{mutex_};
+        cv_.wait(lock, [this] { return !has_pending_; });
+        if (writer_error_) {
+            std::rethrow_exception(std::exchange(writer_error_, nullptr));
+        }
+        // Exchanging the buffers keeps the allocated memory of both
+        std::swap(active_buffer_, pending_buffer_);
+        has_pending_ = true;
+    }
+    cv_.notify_all();
+    active_buffer_.clear();
+}
+
+void BatchedFileSink::WaitForWriter() {
+    std::unique_lock lock{mutex_};
+    cv_.wait(lock, [this] { return !has_pending_; });
+    if (writer_error_) {
+        std::rethrow_exception(std::exchange(writer_error_, nullptr));
+    }
+}
+
+void BatchedFileSink::WriterLoop() {
+    std::unique_lock lock{mutex_};
+    while (true) {
+        cv_.wait(lock, [this] { return has_pending_ || is_stopping_; });
+        if (!has_pending_) {
+            UASSERT(is_stopping_);
+            return;
+        }
+
+        lock.unlock();
+        std::exception_ptr error;
+        try {
+            WriteBuffer(pending_buffer_);
+        } catch (const std::exception&) {
+            error = std::current_exception();
+        }
+        lock.lock();
+
+        pending_buffer_.clear();
+        has_pending_ = false;
+        if (error) writer_error_ = std::move(error);
+        cv_.notify_all();
+    }
+}
+
+void BatchedFileSink::WriteBuffer(const std::string& buffer) {
+    fd_.Write(buffer);
+
+#ifdef __linux__
+    const int fd = fd_.GetNative();
+    const auto end = ::lseek(fd, 0, SEEK_CUR);
+    if (end < 0) return;
+    const auto offset = end - static_cast<off_t>(buffer.size());
+
+    // Start the writeback of this batch without waiting for it. By the time
+    // the next batch is written the pages of this one are usually clean and
+    // could be dropped from the page cache.
+    ::sync_file_range(fd, offset, static_cast<off_t>(buffer.size()), SYNC_FILE_RANGE_WRITE);
+    if (previous_batch_size_ != 0) {
+        ::posix_fadvise(fd, previous_batch_offset_, static_cast<off_t>(previous_batch_size_), POSIX_FADV_DONTNEED);
+    }
+    previous_batch_offset_ = offset;
+    previous_batch_size_ = buffer.size();
+#endif
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include <userver/fs/blocking/file_descriptor.hpp>
+
+#include "base_sink.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+/// File sink that accumulates records into a large buffer and hands the full
+/// buffers to a dedicated writer thread. The writer issues one write per
+/// buffer and drops the written pages from the page cache with
+/// `posix_fadvise(POSIX_FADV_DONTNEED)`, so that logs do not evict the hot
+/// data of the service.
+///
+/// Write, Flush and Reopen must not be called concurrently, which is
+/// guaranteed by TpLogger.
+class BatchedFileSink final : public BaseSink {
+public:
+    static constexpr std::size_t kDefaultBufferSize = 1 << 20;
+
+    explicit BatchedFileSink(const std::string& filename, std::size_t buffer_size = kDefaultBufferSize);
+    ~BatchedFileSink() override;
+
+    /// Waits for the writer thread to write all the accumulated records
+    void Flush() override;
+
+    void Reopen(ReopenMode mode) override;
+
+protected:
+    void Write(std::string_view log) override;
+
+private:
+    void SubmitActiveBuffer();
+    void WaitForWriter();
+    void WriterLoop();
+    void WriteBuffer(const std::string& buffer);
+
+    const std::string filename_;
+    const std::size_t buffer_size_;
+    fs::blocking::FileDescriptor fd_;
+
+    // Filled by the logger task
+    std::string active_buffer_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    // Owned by the writer thread while `has_pending_` is set
+    std::string pending_buffer_;
+    bool has_pending_{false};
+    bool is_stopping_{false};
+    std::exception_ptr writer_error_;
+
+    // Used by the writer thread only
+    std::int64_t previous_batch_offset_{0};
+    std::size_t previous_batch_size_{0};
+
+    std::thread writer_;
+};
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -3,8 +3,10 @@
 #include <userver/fs/blocking/temp_directory.hpp>
 #include <userver/utils/rand.hpp>
 
+#include "batched_file_sink.hpp"
 #include "buffered_file_sink.hpp"
 #include "file_sink.hpp"
+#include "zstd_file_sink.hpp"
 
 USERVER_NAMESPACE_BEGIN
 
@@ -36,4 +38,30 @@ void check_buffered_file_sink(benchmark::State& state) {
 }
 BENCHMARK(check_buffered_file_sink);
 
+void check_batched_file_sink(benchmark::State& state) {
+    const auto temp_root = fs::blocking::TempDirectory::Create();
+    const std::string filename = temp_root.GetPath() + "/temp_file_" + std::to_string(utils::Rand());
+    logging::impl::BatchedFileSink sink{filename};
+    for ([[maybe_unused]] auto _ : state) {
+        for (auto i = 0; i < kCountLogs; ++i) {
+            sink.Log({"message\n", logging::Level::kWarning});
+        }
+    }
+    sink.Flush();
+}
+BENCHMARK(check_batched_file_sink);
+
+void check_zstd_file_sink(benchmark::State& state) {
+    const auto temp_root = fs::blocking::TempDirectory::Create();
+    const std::string filename = temp_root.GetPath() + "/temp_file_" + std::to_string(utils::Rand());
+    logging::impl::ZstdFileSink sink{filename};
+    for ([[maybe_unused]] auto _ : state) {
+        for (auto i = 0; i < kCountLogs; ++i) {
+            sink.Log({"message\n", logging::Level::kWarning});
+        }
+    }
+    sink.Flush();
+}
+BENCHMARK(check_zstd_file_sink);
+
 USERVER_NAMESPACE_END
@@ -10,6 +10,7 @@
 #include <userver/utest/parameter_names.hpp>
 #include <userver/utest/utest.hpp>
 
+#include "batched_file_sink.hpp"
 #include "buffered_file_sink.hpp"
 #include "sink_helper_test.hpp"
 
@@ -30,6 +31,15 @@ SinkPtr MakeBufferedFileSink(const std::string& filename) {
     return std::make_unique<logging::impl::BufferedFileSink>(filename);
 }
 
+SinkPtr MakeBatchedFileSink(const std::string& filename) {
+    return std::make_unique<logging::impl::BatchedFileSink>(filename);
+}
+
+// Submits almost every record to the writer thread separately
+SinkPtr MakeSmallBatchedFileSink(const std::string& filename) {
+    return std::make_unique<logging::impl::BatchedFileSink>(filename, 8);
+}
+
 class FileSinks : public testing::TestWithParam<SinkFactory> {
 protected:
     const std::string& GetTempRootPath() const { return temp_root_.GetPath(); }
@@ -184,7 +194,12 @@ UTEST_P(FileSinks, TestValidWriteMultiInFile) {
 INSTANTIATE_UTEST_SUITE_P(
     /* no prefix */,
     FileSinks,
-    testing::Values(SinkFactory{"FileSink", MakeFileSink}, SinkFactory{"BufferedFileSink", MakeBufferedFileSink}),
+    testing::Values(
+        SinkFactory{"FileSink", MakeFileSink},
+        SinkFactory{"BufferedFileSink", MakeBufferedFileSink},
+        SinkFactory{"BatchedFileSink", MakeBatchedFileSink},
+        SinkFactory{"SmallBatchedFileSink", MakeSmallBatchedFileSink}
+    ),
     utest::PrintTestName()
 );
 
@@ -8,6 +8,8 @@
 #include <sys/types.h>
 #include <cstring>
 
+#include <userver/engine/io/happy_eyeballs.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
@@ -16,16 +18,9 @@ TcpSocketClient::TcpSocketClient(std::vector<engine::io::Sockaddr> addrs) : addr
 
 void TcpSocketClient::Connect() {
     Close();
-    for (const auto& addr : addrs_) {
-        socket_ = engine::io::Socket{addr.Domain(), engine::io::SocketType::kStream};
-        try {
-            socket_.Connect(addr, {});
-            break;
-        } catch (std::exception&) {
-            continue;
-        }
-    }
-    if (socket_.Fd() == -1) {
+    try {
+        socket_ = engine::io::ConnectHappyEyeballs(addrs_, {});
+    } catch (const std::exception&) {
         std::string list{};
         for (const auto& addr : addrs_) {
             list += addr.PrimaryAddressString() + ", ";
@@ -0,0 +1,64 @@
+#include "zstd_file_sink.hpp"
+
+#include <userver/utils/assert.hpp>
+
+#include "open_file_helper.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+ZstdFileSink::ZstdFileSink(const std::string& filename, std::size_t frame_size, int compression_level)
+    : filename_{filename},
+      frame_size_{frame_size},
+      fd_(OpenFile<fs::blocking::FileDescriptor>(filename)),
+      compressor_(compression_level) {
+    UASSERT(frame_size_ > 0);
+}
+
+ZstdFileSink::~ZstdFileSink() {
+    try {
+        FinishFrame();
+    } catch (const std::exception&) {
+        // The tail of the logs is lost, there is no one to report that to
+    }
+}
+
+void ZstdFileSink::Flush() {
+    if (frame_uncompressed_size_ != 0) {
+        WriteCompressed(compressor_.Compress({}));
+    }
+}
+
+void ZstdFileSink::Reopen(ReopenMode mode) {
+    // The rotated file must end with a complete frame
+    FinishFrame();
+    fd_.FSync();
+    std::move(fd_).Close();
+    fd_ = OpenFile<fs::blocking::FileDescriptor>(filename_, mode);
+}
+
+void ZstdFileSink::Write(std::string_view log) {
+    WriteCompressed(compressor_.Append(log));
+    frame_uncompressed_size_ += log.size();
+    if (frame_uncompressed_size_ >= frame_size_) {
+        FinishFrame();
+    }
+}
+
+void ZstdFileSink::FinishFrame() {
+    if (frame_uncompressed_size_ == 0) return;
+    // The next Append starts a new frame
+    WriteCompressed(compressor_.Finish());
+    frame_uncompressed_size_ = 0;
+}
+
+void ZstdFileSink::WriteCompressed(const std::string& data) {
+    if (!data.empty()) {
+        fd_.Write(data);
+    }
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
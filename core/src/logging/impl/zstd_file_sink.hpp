@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include <userver/compression/zstd.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+
+#include "base_sink.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+/// File sink that writes the records as a sequence of independent zstd
+/// frames, each holding about `frame_size` bytes of the uncompressed logs.
+///
+/// The file is decompressible by the `zstd` utility as is and a reader may
+/// start from any frame boundary. Flush makes the written data decodable
+/// without ending the frame, Reopen and destruction end the current frame.
+class ZstdFileSink final : public BaseSink {
+public:
+    static constexpr std::size_t kDefaultFrameSize = 4 << 20;
+
+    explicit ZstdFileSink(
+        const std::string& filename,
+        std::size_t frame_size = kDefaultFrameSize,
+        int compression_level = compression::zstd::kDefaultCompressionLevel
+    );
+    ~ZstdFileSink() override;
+
+    void Flush() override;
+
+    void Reopen(ReopenMode mode) override;
+
+protected:
+    void Write(std::string_view log) override;
+
+private:
+    void FinishFrame();
+    void WriteCompressed(const std::string& data);
+
+    const std::string filename_;
+    const std::size_t frame_size_;
+    fs::blocking::FileDescriptor fd_;
+    compression::zstd::StreamCompressor compressor_;
+    std::size_t frame_uncompressed_size_{0};
+};
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
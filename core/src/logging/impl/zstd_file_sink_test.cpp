@@ -0,0 +1,115 @@
+#include "zstd_file_sink.hpp"
+
+#include <userver/compression/zstd.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/utest/utest.hpp>
+
+#include "sink_helper_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct DecompressedFile {
+    std::string data;
+    std::size_t frames{0};
+};
+
+// Decompresses the frames one by one, as a reader seeking to a frame would do
+DecompressedFile DecompressFile(const std::string& filename) {
+    const auto compressed = fs::blocking::ReadFileContents(filename);
+    std::string_view input = compressed;
+
+    DecompressedFile result;
+    while (!input.empty()) {
+        compression::zstd::StreamDecompressor decompressor;
+        EXPECT_TRUE(decompressor.Decompress(input, result.data)) << "Incomplete frame";
+        ++result.frames;
+    }
+    return result;
+}
+
+}  // namespace
+
+UTEST(ZstdFileSink, WriteAndFinish) {
+    const auto temp_root = fs::blocking::TempDirectory::Create();
+    const auto filename = temp_root.GetPath() + "/temp_file.zst";
+
+    {
+        logging::impl::ZstdFileSink sink{filename};
+        sink.Log({"message\n", logging::Level::kWarning});
+        sink.Log({"message 2\n", logging::Level::kInfo});
+    }
+
+    const auto result = DecompressFile(filename);
+    EXPECT_EQ(test::NormalizeLogs(result.data), test::Messages("message", "message 2"));
+    EXPECT_EQ(result.frames, 1);
+}
+
+UTEST(ZstdFileSink, Flush) {
+    const auto temp_root = fs::blocking::TempDirectory::Create();
+    const auto filename = temp_root.GetPath() + "/temp_file.zst";
+
+    logging::impl::ZstdFileSink sink{filename};
+    sink.Log({"message\n", logging::Level::kWarning});
+    sink.Flush();
+
+    // The frame is not finished, but the flushed data is decodable
+    const auto compressed = fs::blocking::ReadFileContents(filename);
+    std::string_view input = compressed;
+    std::string decompressed;
+    compression::zstd::StreamDecompressor decompressor;
+    EXPECT_FALSE(decompressor.Decompress(input, decompressed));
+    EXPECT_EQ(test::NormalizeLogs(decompressed), test::Messages("message"));
+}
+
+UTEST(ZstdFileSink, FramePerSize) {
+    const auto temp_root = fs::blocking::TempDirectory::Create();
+    const auto filename = temp_root.GetPath() + "/temp_file.zst";
+
+    {
+        logging::impl::ZstdFileSink sink{filename, /*frame_size=*/16};
+        for (int i = 0; i < 10; ++i) {
+            sink.Log({"message 1234\n", logging::Level::kInfo});
+        }
+    }
+
+    const auto result = DecompressFile(filename);
+    EXPECT_EQ(test::NormalizeLogs(result.data).size(), 10);
+    EXPECT_EQ(result.frames, 5);
+}
+
+UTEST(ZstdFileSink, ReopenFinishesFrame) {
+    const auto temp_root = fs::blocking::TempDirectory::Create();
+    const auto filename = temp_root.GetPath() + "/temp_file.zst";
+    const auto rotated_filename = temp_root.GetPath() + "/temp_file.zst.1";
+
+    logging::impl::ZstdFileSink sink{filename};
+    sink.Log({"message\n", logging::Level::kWarning});
+
+    fs::blocking::Rename(filename, rotated_filename);
+    sink.Reopen(logging::impl::ReopenMode::kAppend);
+    sink.Log({"message 2\n", logging::Level::kWarning});
+    sink.Reopen(logging::impl::ReopenMode::kAppend);
+
+    EXPECT_EQ(test::NormalizeLogs(DecompressFile(rotated_filename).data), test::Messages("message"));
+    EXPECT_EQ(test::NormalizeLogs(DecompressFile(filename).data), test::Messages("message 2"));
+}
+
+UTEST(ZstdFileSink, AppendsToExistingFile) {
+    const auto temp_root = fs::blocking::TempDirectory::Create();
+    const auto filename = temp_root.GetPath() + "/temp_file.zst";
+
+    for (const auto* message : {"message\n", "message 2\n"}) {
+        logging::impl::ZstdFileSink sink{filename};
+        sink.Log({message, logging::Level::kWarning});
+    }
+
+    const auto result = DecompressFile(filename);
+    EXPECT_EQ(test::NormalizeLogs(result.data), test::Messages("message", "message 2"));
+    EXPECT_EQ(result.frames, 2);
+}
+
+USERVER_NAMESPACE_END
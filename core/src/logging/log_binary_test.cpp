@@ -0,0 +1,77 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <logging/logging_test.hpp>
+
+#include <userver/logging/binary_log.hpp>
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+template <typename T>
+std::optional<T> FindTag(const logging::BinaryLogRecord& record, std::string_view key) {
+    for (const auto& [tag_key, value] : record.tags) {
+        if (tag_key == key) {
+            const auto* result = std::get_if<T>(&value);
+            return result ? std::optional<T>{*result} : std::nullopt;
+        }
+    }
+    return std::nullopt;
+}
+
+}  // namespace
+
+TEST_F(LoggingBinaryTest, Smoke) {
+    const auto before = std::chrono::system_clock::now();
+    LOG_CRITICAL() << "foo\nbar\tbaz" << logging::LogExtra{{"int", -42}, {"uint", 42U}, {"double", 1.5}};
+    LOG_INFO() << "second";
+    logging::LogFlush();
+
+    const auto str = GetStreamString();
+    logging::BinaryLogReader reader{str};
+    logging::BinaryLogRecord record;
+
+    ASSERT_TRUE(reader.Next(record));
+    EXPECT_EQ(record.level, logging::Level::kCritical);
+    EXPECT_GE(record.timestamp, before);
+    EXPECT_THAT(std::string{record.file}, testing::EndsWith("log_binary_test.cpp"));
+    EXPECT_GT(record.line, 0);
+    EXPECT_EQ(FindTag<std::string_view>(record, "text"), "foo\nbar\tbaz");
+    EXPECT_EQ(FindTag<std::int64_t>(record, "int"), -42);
+    EXPECT_EQ(FindTag<std::uint64_t>(record, "uint"), 42);
+    EXPECT_EQ(FindTag<double>(record, "double"), 1.5);
+    EXPECT_TRUE(FindTag<std::string_view>(record, "thread_id"));
+
+    ASSERT_TRUE(reader.Next(record));
+    EXPECT_EQ(record.level, logging::Level::kInfo);
+    EXPECT_EQ(FindTag<std::string_view>(record, "text"), "second");
+
+    EXPECT_FALSE(reader.Next(record));
+    EXPECT_EQ(reader.GetOffset(), str.size());
+}
+
+TEST_F(LoggingBinaryTest, IncompleteRecord) {
+    LOG_INFO() << "text";
+    logging::LogFlush();
+
+    const auto str = GetStreamString();
+    logging::BinaryLogReader reader{std::string_view{str}.substr(0, str.size() - 1)};
+    logging::BinaryLogRecord record;
+    EXPECT_FALSE(reader.Next(record));
+    EXPECT_EQ(reader.GetOffset(), 0);
+}
+
+TEST_F(LoggingBinaryTest, CorruptedRecord) {
+    LOG_INFO() << "text";
+    logging::LogFlush();
+
+    auto str = GetStreamString();
+    str[sizeof(std::uint32_t)] = '\x7f';  // version
+    logging::BinaryLogReader reader{str};
+    logging::BinaryLogRecord record;
+    EXPECT_THROW(reader.Next(record), std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
@@ -15,13 +15,17 @@ namespace {
 
 class NoopLogger : public logging::impl::TextLogger {
 public:
-    NoopLogger() noexcept : TextLogger(logging::Format::kRaw) { SetLevel(logging::Level::kInfo); }
+    explicit NoopLogger(logging::Format format = logging::Format::kRaw) noexcept : TextLogger(format) {
+        SetLevel(logging::Level::kInfo);
+    }
     void Log(logging::Level, logging::impl::formatters::LoggerItemRef) override {}
     void Flush() override {}
 };
 
 class PrependedTagLogger final : public NoopLogger {
 public:
+    using NoopLogger::NoopLogger;
+
     void PrependCommonTags(logging::impl::TagWriter writer) const override {
         writer.PutTag("aaaaaaaaaaaaaaaaaa", "value");
         writer.PutTag("bbbbbbbbbb", 42);
@@ -148,6 +152,19 @@ void LogPrependedTags(benchmark::State& state) {
 }
 BENCHMARK(LogPrependedTags);
 
+void LogPrependedTagsInFormat(benchmark::State& state) {
+    const auto format = static_cast<logging::Format>(state.range(0));
+    const logging::DefaultLoggerGuard guard{std::make_shared<PrependedTagLogger>(format)};
+
+    for ([[maybe_unused]] auto _ : state) {
+        LOG_INFO() << "Some text with a number " << 42;
+    }
+}
+BENCHMARK(LogPrependedTagsInFormat)
+    ->Arg(static_cast<int>(logging::Format::kTskv))
+    ->Arg(static_cast<int>(logging::Format::kJson))
+    ->Arg(static_cast<int>(logging::Format::kBinary));
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -30,9 +30,13 @@ private:
     std::ostringstream ostream_;
 };
 
-inline std::shared_ptr<logging::impl::TpLogger>
-MakeLoggerFromSink(const std::string& logger_name, logging::impl::SinkPtr sink_ptr, logging::Format format) {
-    auto logger = std::make_shared<logging::impl::TpLogger>(format, logger_name);
+inline std::shared_ptr<logging::impl::TpLogger> MakeLoggerFromSink(
+    const std::string& logger_name,
+    logging::impl::SinkPtr sink_ptr,
+    logging::Format format,
+    bool deferred_formatting = false
+) {
+    auto logger = std::make_shared<logging::impl::TpLogger>(format, logger_name, deferred_formatting);
     logger->AddSink(std::move(sink_ptr));
     return logger;
 }
@@ -42,10 +46,11 @@ struct StringStreamLogger final {
     std::ostringstream& stream;
 };
 
-inline StringStreamLogger MakeNamedStreamLogger(const std::string& logger_name, logging::Format format) {
+inline StringStreamLogger
+MakeNamedStreamLogger(const std::string& logger_name, logging::Format format, bool deferred_formatting = false) {
     auto sink = std::make_unique<StringSink>();
     auto& stream = sink->GetStream();
-    return {MakeLoggerFromSink(logger_name, std::move(sink), format), stream};
+    return {MakeLoggerFromSink(logger_name, std::move(sink), format, deferred_formatting), stream};
 }
 
 inline std::string_view GetTextKey(logging::Format format) {
@@ -126,6 +131,11 @@ protected:
     LoggingJsonTest() : LoggingTestBase(logging::Format::kJson) { SetDefaultLogger(GetStreamLogger()); }
 };
 
+class LoggingBinaryTest : public LoggingTestBase {
+protected:
+    LoggingBinaryTest() : LoggingTestBase(logging::Format::kBinary) { SetDefaultLogger(GetStreamLogger()); }
+};
+
 class LoggingRawTest : public LoggingTestBase {
 protected:
     LoggingRawTest() : LoggingTestBase(logging::Format::kRaw) { SetDefaultLogger(GetStreamLogger()); }
@@ -19,6 +19,11 @@ struct TpLogger::ActionVisitor final {
     TpLogger& logger;
 
     void operator()(impl::async::Log&& log) const {
+        logger.AccountLogConsumed();
+        logger.BackendLog(log.level, log.payload);
+    }
+
+    void operator()(impl::async::DeferredLog&& log) const {
         logger.AccountLogConsumed();
         logger.BackendLog(std::move(log));
     }
@@ -45,8 +50,8 @@ struct TpLogger::ActionVisitor final {
     }
 };
 
-TpLogger::TpLogger(Format format, std::string logger_name)
-    : impl::TextLogger(format), logger_name_(std::move(logger_name)) {
+TpLogger::TpLogger(Format format, std::string logger_name, bool deferred_formatting)
+    : impl::TextLogger(format), logger_name_(std::move(logger_name)), deferred_formatting_(deferred_formatting) {
     SetLevel(logging::Level::kInfo);
 }
 
@@ -127,9 +132,6 @@ void TpLogger::Flush() {
 impl::LogStatistics& TpLogger::GetStatistics() noexcept { return stats_; }
 
 void TpLogger::Log(Level level, impl::formatters::LoggerItemRef item) {
-    UASSERT(dynamic_cast<impl::TextLogItem*>(&item));
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
-    auto& msg = static_cast<impl::TextLogItem&>(item);
     ++stats_.by_level[static_cast<std::size_t>(level)];
 
     if (GetSinks().empty()) {
@@ -143,7 +145,7 @@ void TpLogger::Log(Level level, impl::formatters::LoggerItemRef item) {
         produced_->fetch_add(1);
 
         try {
-            Push(impl::async::Log{level, std::string{msg.log_line}});
+            Push(MakeLogAction(level, item));
         } catch (const std::exception&) {
             // failed to construct a Log action or a node in Push
             produced_->fetch_sub(1);
@@ -156,6 +158,14 @@ void TpLogger::Log(Level level, impl::formatters::LoggerItemRef item) {
 
 void TpLogger::PrependCommonTags(TagWriter writer) const { impl::default_::PrependCommonTags(writer); }
 
+impl::formatters::BasePtr
+TpLogger::MakeFormatter(Level level, LogClass log_class, const utils::impl::SourceLocation& location) {
+    if (deferred_formatting_) {
+        return std::make_unique<impl::formatters::Deferred>(level, log_class, location);
+    }
+    return TextLogger::MakeFormatter(level, log_class, location);
+}
+
 bool TpLogger::DoShouldLog(Level level) const noexcept { return impl::default_::DoShouldLog(level); }
 
 void TpLogger::AddSink(impl::SinkPtr&& sink) {
@@ -226,6 +236,20 @@ bool TpLogger::TryWaitFreeQueueCapacity() {
     return true;
 }
 
+impl::async::Action TpLogger::MakeLogAction(Level level, impl::formatters::LoggerItemRef item) const {
+    if (deferred_formatting_) {
+        UASSERT(dynamic_cast<impl::formatters::DeferredLogItem*>(&item));
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+        auto& deferred = static_cast<impl::formatters::DeferredLogItem&>(item);
+        return impl::async::DeferredLog{level, std::move(deferred)};
+    }
+
+    UASSERT(dynamic_cast<impl::TextLogItem*>(&item));
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+    auto& msg = static_cast<impl::TextLogItem&>(item);
+    return impl::async::Log{level, std::string{msg.log_line}};
+}
+
 void TpLogger::Push(impl::async::Action&& action) {
     auto node = std::make_unique<impl::async::ActionNode>();
     node->action = std::move(action);
@@ -273,10 +297,10 @@ void TpLogger::CleanUpQueue(Queue::Consumer&& consumer) noexcept {
     std::move(consumer).ConsumeAndStop([this](auto& node) noexcept { ConsumeNode(node); });
 }
 
-void TpLogger::BackendLog(impl::async::Log&& action) const {
+void TpLogger::BackendLog(Level level, std::string_view payload) const {
     LogMessage message;
-    message.payload = action.payload;
-    message.level = action.level;
+    message.payload = payload;
+    message.level = level;
 
     for (const auto& sink : GetSinks()) {
         try {
@@ -291,6 +315,17 @@ void TpLogger::BackendLog(impl::async::Log&& action) const {
     }
 }
 
+void TpLogger::BackendLog(impl::async::DeferredLog&& action) const {
+    const auto& item = action.item;
+    const auto formatter = MakeTextFormatter(item.level, item.log_class, item.location, item.timestamp);
+    item.Replay(*formatter);
+
+    auto& formatted = formatter->ExtractLoggerItem();
+    UASSERT(dynamic_cast<impl::TextLogItem*>(&formatted));
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+    BackendLog(action.level, static_cast<impl::TextLogItem&>(formatted).log_line);
+}
+
 void TpLogger::BackendFlush() const {
     for (const auto& sink : GetSinks()) {
         try {
@@ -19,6 +19,7 @@
 #include <engine/impl/async_flat_combining_queue.hpp>
 #include <logging/config.hpp>
 #include <logging/impl/base_sink.hpp>
+#include <logging/impl/formatters/deferred.hpp>
 #include <logging/impl/reopen_mode.hpp>
 #include <userver/concurrent/impl/interference_shield.hpp>
 #include <userver/concurrent/impl/intrusive_hooks.hpp>
@@ -38,6 +39,12 @@ struct Log {
     std::chrono::system_clock::time_point time{std::chrono::system_clock::now()};
 };
 
+// A record to be formatted by the consumer task
+struct DeferredLog {
+    Level level{};
+    formatters::DeferredLogItem item;
+};
+
 struct FlushCoro {
     engine::Promise<void> promise;
 };
@@ -53,7 +60,7 @@ struct ReopenCoro {
 
 struct Stop {};
 
-using Action = std::variant<Stop, Log, FlushCoro, FlushThreaded, ReopenCoro>;
+using Action = std::variant<Stop, Log, DeferredLog, FlushCoro, FlushThreaded, ReopenCoro>;
 
 struct ActionNode final : public concurrent::impl::SinglyLinkedBaseHook {
     Action action{Stop{}};
@@ -62,9 +69,12 @@ struct ActionNode final : public concurrent::impl::SinglyLinkedBaseHook {
 }  // namespace async
 
 /// @brief Asynchronous logger that logs into a specific TaskProcessor.
+///
+/// With `deferred_formatting` the records are captured unformatted and are
+/// formatted by the consumer task, see logging::LoggerConfig.
 class TpLogger final : public TextLogger {
 public:
-    TpLogger(Format format, std::string logger_name);
+    TpLogger(Format format, std::string logger_name, bool deferred_formatting = false);
     ~TpLogger() override;
 
     void StartConsumerTask(
@@ -79,6 +89,9 @@ public:
     void Flush() override;
     void PrependCommonTags(TagWriter writer) const override;
 
+    impl::formatters::BasePtr
+    MakeFormatter(Level level, LogClass log_class, const utils::impl::SourceLocation& location) override;
+
     void AddSink(impl::SinkPtr&& sink);
     const std::vector<impl::SinkPtr>& GetSinks() const;
     void Reopen(ReopenMode reopen_mode);
@@ -105,6 +118,7 @@ private:
     void ProcessingLoop();
     bool HasFreeQueueCapacity() noexcept;
     bool TryWaitFreeQueueCapacity();
+    impl::async::Action MakeLogAction(Level level, impl::formatters::LoggerItemRef item) const;
     void Push(impl::async::Action&& action);
     void DoPush(concurrent::impl::SinglyLinkedBaseHook& node) noexcept;
     void ConsumeNode(concurrent::impl::SinglyLinkedBaseHook& node) noexcept;
@@ -112,11 +126,13 @@ private:
     void CleanUpQueue(Queue::Consumer&& consumer) noexcept;
     void AccountLogConsumed() noexcept;
     void BackendPerform(impl::async::Action&& action) noexcept;
-    void BackendLog(impl::async::Log&& action) const;
+    void BackendLog(Level level, std::string_view payload) const;
+    void BackendLog(impl::async::DeferredLog&& action) const;
     void BackendFlush() const;
     void BackendReopen(ReopenMode reopen_mode) const;
 
     const std::string logger_name_;
+    const bool deferred_formatting_;
     std::vector<impl::SinkPtr> sinks_;
     mutable impl::LogStatistics stats_{};
 
@@ -14,9 +14,13 @@ USERVER_NAMESPACE_BEGIN
 
 namespace {
 
-std::shared_ptr<logging::impl::TpLogger>
-MakeLoggerFromSink(const std::string& logger_name, logging::impl::SinkPtr sink_ptr, logging::Format format) {
-    auto logger = std::make_unique<logging::impl::TpLogger>(format, logger_name);
+std::shared_ptr<logging::impl::TpLogger> MakeLoggerFromSink(
+    const std::string& logger_name,
+    logging::impl::SinkPtr sink_ptr,
+    logging::Format format,
+    bool deferred_formatting = false
+) {
+    auto logger = std::make_unique<logging::impl::TpLogger>(format, logger_name, deferred_formatting);
     logger->AddSink(std::move(sink_ptr));
     return logger;
 }
@@ -89,4 +93,29 @@ BENCHMARK_DEFINE_F(TpLoggerBenchmark, LogCheckSpan)
 }
 BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogCheckSpan);
 
+// Measures the latency of LOG_* calls on the caller side, with the formatting
+// done either in place or by the consumer task (range(0) != 0).
+void TpLoggerDeferredFormatting(benchmark::State& state) {
+    engine::RunStandalone(2, [&] {
+        auto logger = MakeLoggerFromSink(
+            "test", std::make_unique<logging::impl::NullSink>(), logging::Format::kTskv, state.range(0) != 0
+        );
+        logger->SetLevel(logging::Level::kInfo);
+        const logging::DefaultLoggerGuard guard{logger};
+
+        logger->StartConsumerTask(
+            engine::current_task::GetTaskProcessor(), 1 << 30, logging::QueueOverflowBehavior::kDiscard
+        );
+        const utils::FastScopeGuard stop_guard([&logger]() noexcept { logger->StopConsumerTask(); });
+
+        const logging::LogExtra extra{{"http_status", 200}, {"uri", "/v1/some/handler?arg=value"}, {"size", 4096.5}};
+        std::uint64_t i = 0;
+        for ([[maybe_unused]] auto _ : state) {
+            LOG_INFO() << "Request " << ++i << " finished in " << 12.5 << "ms, retries: " << 3 << ", ok: " << true
+                       << extra;
+        }
+    });
+}
+BENCHMARK(TpLoggerDeferredFormatting)->Arg(0)->Arg(1);
+
 USERVER_NAMESPACE_END
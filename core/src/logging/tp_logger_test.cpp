@@ -1,5 +1,7 @@
 #include <logging/tp_logger.hpp>
 
+#include <regex>
+
 #include <gmock/gmock.h>
 
 #include <userver/engine/async.hpp>
@@ -742,4 +744,26 @@ UTEST_F_MT(LoggingTestCoro, TpLoggerLogMultipleStdThreadFlushSyncCancelMT, 4) {
     EXPECT_EQ(GetRecordsCount(), message_count);
 }
 
+TEST(TpLogger, DeferredFormattingMatchesInPlace) {
+    const auto strip_timestamp = [](const std::string& record) {
+        static const std::regex kTimestamp{R"(timestamp"?[=:]"?[0-9T:.\-]+)"};
+        return std::regex_replace(record, kTimestamp, "timestamp");
+    };
+
+    for (const auto format : {logging::Format::kTskv, logging::Format::kLtsv, logging::Format::kJson}) {
+        const auto in_place = MakeNamedStreamLogger("in-place", format);
+        const auto deferred = MakeNamedStreamLogger("deferred", format, true);
+
+        for (const auto& logger : {in_place.logger, deferred.logger}) {
+            LOG_INFO_TO(logger) << "text\twith \"escaping\" " << 42 << ' ' << -1.5 << ' ' << true << ' '
+                                << logging::Hex{255U} << ' ' << logging::HexShort{255U} << ' ' << std::vector{1, 2}
+                                << logging::LogExtra{{"int", 1}, {"str", "a=b\tc"}, {"double", 0.25}};
+            logger->Flush();
+        }
+
+        EXPECT_EQ(strip_timestamp(in_place.stream.str()), strip_timestamp(deferred.stream.str()));
+        EXPECT_THAT(deferred.stream.str(), testing::HasSubstr("42 -1.5 true 0x00000000000000FF FF [1, 2]"));
+    }
+}
+
 USERVER_NAMESPACE_END
@@ -8,9 +8,11 @@
 #include <boost/filesystem/operations.hpp>
 #include <boost/range/algorithm/find_if.hpp>
 
+#include <logging/impl/batched_file_sink.hpp>
 #include <logging/impl/buffered_file_sink.hpp>
 #include <logging/impl/tcp_socket_sink.hpp>
 #include <logging/impl/unix_socket_sink.hpp>
+#include <logging/impl/zstd_file_sink.hpp>
 #include <userver/logging/format.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/net/blocking/get_addr_info.hpp>
@@ -36,10 +38,15 @@ void CreateLogDirectory(const std::string& logger_name, const std::string& file_
     }
 }
 
-SinkPtr GetSinkFromFilename(const std::string& file_path) {
+SinkPtr GetSinkFromFilename(const LoggerConfig& config) {
+    const auto& file_path = config.file_path;
     if (utils::text::StartsWith(file_path, kUnixSocketPrefix)) {
         // Use Unix-socket sink
         return std::make_unique<UnixSocketSink>(file_path.substr(kUnixSocketPrefix.size()));
+    } else if (config.zstd_compression) {
+        return std::make_unique<ZstdFileSink>(file_path, config.zstd_frame_size);
+    } else if (config.batched_file_sink) {
+        return std::make_unique<BatchedFileSink>(file_path);
     } else {
         return std::make_unique<BufferedFileSink>(file_path);
     }
@@ -54,7 +61,7 @@ SinkPtr MakeOptionalSink(const LoggerConfig& config) {
         return std::make_unique<logging::impl::BufferedUnownedFileSink>(stdout);
     } else {
         CreateLogDirectory(config.logger_name, config.file_path);
-        return GetSinkFromFilename(config.file_path);
+        return GetSinkFromFilename(config);
     }
 }
 
@@ -66,7 +73,7 @@ auto MakeTestsuiteSink(const TestsuiteCaptureConfig& config) {
 }  // namespace
 
 std::shared_ptr<TpLogger> MakeTpLogger(const LoggerConfig& config) {
-    auto logger = std::make_shared<TpLogger>(config.format, config.logger_name);
+    auto logger = std::make_shared<TpLogger>(config.format, config.logger_name, config.deferred_formatting);
     logger->SetLevel(config.level);
     logger->SetFlushOn(config.flush_level);
 
@@ -2,13 +2,17 @@
 
 #include <atomic>
 #include <cstdint>
+#include <memory>
 #include <queue>
+#include <utility>
 #include <vector>
 
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/rcu/rcu.hpp>
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/rcu/sharded_rcu_map.hpp>
 #include <userver/utils/async.hpp>
 #include <utils/impl/parallelize_benchmark.hpp>
 
@@ -133,4 +137,96 @@ void rcu_of_shared_ptr(benchmark::State& state) {
 }
 BENCHMARK(rcu_of_shared_ptr)->RangeMultiplier(2)->Range(1, 32);
 
+namespace {
+
+using MapItems = std::vector<std::pair<std::uint64_t, std::shared_ptr<std::uint64_t>>>;
+
+MapItems MakeItems(std::uint64_t size) {
+    MapItems items;
+    items.reserve(size);
+    for (std::uint64_t i = 0; i < size; ++i) items.emplace_back(i, std::make_shared<std::uint64_t>(i));
+    return items;
+}
+
+void FillMap(rcu::RcuMap<std::uint64_t, std::uint64_t>& map, std::uint64_t size) {
+    auto items = MakeItems(size);
+    map.Assign({items.begin(), items.end()});
+}
+
+template <std::size_t ShardsCount>
+void FillMap(rcu::ShardedRcuMap<std::uint64_t, std::uint64_t, ShardsCount>& map, std::uint64_t size) {
+    map.InsertOrAssignBatch(MakeItems(size));
+}
+
+}  // namespace
+
+// Each iteration inserts a new key into a map of state.range(0) elements
+template <typename Map>
+void rcu_map_insert(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        Map map;
+        const std::uint64_t size = state.range(0);
+        FillMap(map, size);
+
+        std::uint64_t key = size;
+        for ([[maybe_unused]] auto _ : state) {
+            map.InsertOrAssign(key, std::make_shared<std::uint64_t>(key));
+            ++key;
+        }
+        state.SetItemsProcessed(state.iterations());
+    });
+}
+BENCHMARK_TEMPLATE(rcu_map_insert, rcu::RcuMap<std::uint64_t, std::uint64_t>)->Arg(1000)->Arg(100'000);
+BENCHMARK_TEMPLATE(rcu_map_insert, rcu::ShardedRcuMap<std::uint64_t, std::uint64_t>)->Arg(1000)->Arg(100'000);
+BENCHMARK_TEMPLATE(rcu_map_insert, rcu::ShardedRcuMap<std::uint64_t, std::uint64_t, 256>)->Arg(1000)->Arg(100'000);
+
+// Each iteration inserts a batch of state.range(1) new keys into a map of
+// state.range(0) elements
+void sharded_rcu_map_insert_batch(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        rcu::ShardedRcuMap<std::uint64_t, std::uint64_t> map;
+        const std::uint64_t size = state.range(0);
+        const std::uint64_t batch_size = state.range(1);
+        FillMap(map, size);
+
+        std::uint64_t key = size;
+        for ([[maybe_unused]] auto _ : state) {
+            MapItems batch;
+            batch.reserve(batch_size);
+            for (std::uint64_t i = 0; i < batch_size; ++i, ++key) {
+                batch.emplace_back(key, std::make_shared<std::uint64_t>(key));
+            }
+            map.InsertOrAssignBatch(std::move(batch));
+        }
+        state.SetItemsProcessed(state.iterations() * batch_size);
+    });
+}
+BENCHMARK(sharded_rcu_map_insert_batch)->Args({100'000, 1})->Args({100'000, 100})->Args({100'000, 10'000});
+
+// Writers insert new keys concurrently, state.range(0) is the writers count
+template <typename Map>
+void rcu_map_concurrent_insert(benchmark::State& state) {
+    constexpr std::uint64_t kSize = 100'000;
+    const std::size_t writers_count = state.range(0);
+
+    engine::RunStandalone(writers_count, [&] {
+        Map map;
+        FillMap(map, kSize);
+        std::atomic<std::uint64_t> next_key{kSize};
+
+        RunParallelBenchmark(state, [&](auto& range) {
+            for ([[maybe_unused]] auto _ : range) {
+                const auto key = next_key++;
+                map.InsertOrAssign(key, std::make_shared<std::uint64_t>(key));
+            }
+        });
+    });
+}
+BENCHMARK_TEMPLATE(rcu_map_concurrent_insert, rcu::RcuMap<std::uint64_t, std::uint64_t>)
+    ->RangeMultiplier(2)
+    ->Range(1, 4);
+BENCHMARK_TEMPLATE(rcu_map_concurrent_insert, rcu::ShardedRcuMap<std::uint64_t, std::uint64_t>)
+    ->RangeMultiplier(2)
+    ->Range(1, 4);
+
 USERVER_NAMESPACE_END
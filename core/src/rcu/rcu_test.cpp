@@ -3,6 +3,7 @@
 #include <atomic>
 #include <future>
 #include <stdexcept>
+#include <string>
 #include <thread>
 
 #include <engine/task/task_context.hpp>
@@ -639,4 +640,76 @@ UTEST(Rcu, EmplaceExceptionInitial) {
     // Should not leak memory, detectable by Asan.
 }
 
+namespace {
+
+struct BoundedRcuTraits : rcu::DefaultRcuTraits {
+    using DeleterType = rcu::SyncDeleter;
+    static constexpr std::size_t kMaxRetiredSnapshots = 1;
+};
+
+struct SizedRcuTraits : rcu::DefaultRcuTraits {
+    using DeleterType = rcu::SyncDeleter;
+    static std::size_t EstimateSnapshotBytes(const std::string& value) { return value.size(); }
+};
+
+}  // namespace
+
+UTEST(Rcu, RetiredStatistics) {
+    rcu::Variable<std::string, SizedRcuTraits> var{std::string(100, 'a')};
+    EXPECT_EQ(var.GetRetiredStatistics().snapshots, 0);
+
+    {
+        auto reader1 = var.Read();
+        var.Assign(std::string(10, 'b'));
+        auto reader2 = var.Read();
+        var.Assign("c");
+
+        const auto stats = var.GetRetiredStatistics();
+        EXPECT_EQ(stats.snapshots, 2);
+        EXPECT_EQ(stats.bytes, 110);
+    }
+    EXPECT_EQ(var.GetRetiredStatistics().snapshots, 2);
+
+    var.Cleanup();
+    const auto stats = var.GetRetiredStatistics();
+    EXPECT_EQ(stats.snapshots, 0);
+    EXPECT_EQ(stats.bytes, 0);
+}
+
+UTEST_MT(Rcu, MaxRetiredSnapshots, 2) {
+    rcu::Variable<int, BoundedRcuTraits> var{0};
+    std::atomic<bool> released{false};
+
+    auto reader1 = var.Read();
+    var.Assign(1);
+    EXPECT_EQ(var.GetRetiredStatistics().snapshots, 1);
+
+    auto reader2 = var.Read();
+    auto releaser = engine::AsyncNoSpan([&] {
+        engine::SleepFor(std::chrono::milliseconds{50});
+        released = true;
+        [[maybe_unused]] const auto released_reader = std::move(reader1);
+    });
+
+    // Waits for reader1, otherwise there would be 2 retired snapshots
+    var.Assign(2);
+    EXPECT_TRUE(released);
+    EXPECT_EQ(var.GetRetiredStatistics().snapshots, 1);
+    EXPECT_EQ(*reader2, 1);
+
+    releaser.Get();
+}
+
+UTEST(Rcu, MaxRetiredSnapshotsCancelled) {
+    rcu::Variable<int, BoundedRcuTraits> var{0};
+    auto reader1 = var.Read();
+    var.Assign(1);
+    auto reader2 = var.Read();
+
+    engine::current_task::GetCancellationToken().RequestCancel();
+    // Gives up waiting for the readers
+    var.Assign(2);
+    EXPECT_EQ(var.GetRetiredStatistics().snapshots, 2);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,87 @@
+#include <userver/rcu/sharded_rcu_map.hpp>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(ShardedRcuMap, Basic) {
+    rcu::ShardedRcuMap<std::string, int> map;
+    const auto& cmap = map;
+
+    UEXPECT_THROW(cmap["any"], rcu::MissingKeyException);
+    EXPECT_FALSE(map.Get("any"));
+    EXPECT_FALSE(map.Erase("any"));
+
+    *map["a"] = 1;
+    EXPECT_TRUE(map.Insert("b", std::make_shared<int>(2)).inserted);
+    EXPECT_FALSE(map.Emplace("b", 3).inserted);
+    EXPECT_TRUE(map.TryEmplace("c", 3).inserted);
+    map.InsertOrAssign("c", std::make_shared<int>(4));
+
+    EXPECT_EQ(map.SizeApprox(), 3);
+    EXPECT_EQ(*cmap["a"], 1);
+    EXPECT_EQ(*map.Get("b"), 2);
+    EXPECT_EQ(*map.Get("c"), 4);
+
+    EXPECT_EQ(*map.Pop("a"), 1);
+    EXPECT_TRUE(map.Erase("b"));
+    EXPECT_EQ(map.SizeApprox(), 1);
+
+    map.Clear();
+    EXPECT_EQ(map.SizeApprox(), 0);
+}
+
+UTEST(ShardedRcuMap, Batch) {
+    rcu::ShardedRcuMap<int, int, 4> map;
+    map.InsertOrAssign(0, std::make_shared<int>(-1));
+
+    std::vector<std::pair<int, std::shared_ptr<int>>> items;
+    for (int i = 0; i < 1000; ++i) items.emplace_back(i, std::make_shared<int>(i));
+    map.InsertOrAssignBatch(std::move(items));
+
+    EXPECT_EQ(map.SizeApprox(), 1000);
+    const auto snapshot = map.GetSnapshot();
+    ASSERT_EQ(snapshot.size(), 1000);
+    for (const auto& [key, value] : snapshot) EXPECT_EQ(*value, key);
+}
+
+UTEST_MT(ShardedRcuMap, ConcurrentWriters, 4) {
+    constexpr int kWriters = 4;
+    constexpr int kKeysPerWriter = 1000;
+
+    rcu::ShardedRcuMap<int, std::atomic<int>> map;
+    std::atomic<bool> stop_flag{false};
+
+    auto reader = utils::Async("reader", [&] {
+        while (!stop_flag) {
+            for (int key = 0; key < kWriters * kKeysPerWriter; key += 97) {
+                if (const auto value = map.Get(key)) {
+                    EXPECT_EQ(value->load(), key);
+                }
+            }
+            engine::Yield();
+        }
+    });
+
+    std::vector<engine::TaskWithResult<void>> writers;
+    for (int i = 0; i < kWriters; ++i) {
+        writers.push_back(utils::Async("writer", [i, &map] {
+            for (int key = i * kKeysPerWriter; key < (i + 1) * kKeysPerWriter; ++key) {
+                map.Emplace(key, key);
+            }
+        }));
+    }
+    for (auto& writer : writers) writer.Get();
+    stop_flag = true;
+    reader.Get();
+
+    EXPECT_EQ(map.SizeApprox(), kWriters * kKeysPerWriter);
+}
+
+USERVER_NAMESPACE_END
@@ -132,6 +132,13 @@ properties:
                     private-key-passphrase-name:
                         type: string
                         description: passphrase name located in secdist
+                    kernel-offload:
+                        type: boolean
+                        description: |
+                            offload the encryption of the sent data to the
+                            kernel (Linux kTLS) if the negotiated cipher
+                            supports it, falls back to the userspace encryption
+                        defaultDescription: false
             ports:
                description: settings of listener ports
                type: array
@@ -196,10 +203,20 @@ properties:
                         type: integer
                         description: "size of the buffer to preallocate for request receive: bigger values use more RAM and less CPU"
                         defaultDescription: 32 * 1024
+                    read_buffer_pool_size:
+                        type: integer
+                        description: max number of idle read buffers shared by the connections of a listener; idle keep-alive connections release their buffers while waiting for data; 0 disables the pool
+                        defaultDescription: 0
+                        minimum: 0
                     requests_queue_size_threshold:
                         type: integer
                         description: drop requests from handlers that allow throttling if there's more pending requests than allowed by this value
                         defaultDescription: 100
+                    pipeline_in_flight_limit:
+                        type: integer
+                        description: max number of pipelined HTTP/1.1 requests of a connection that are handled concurrently, responses are sent in the order of requests
+                        defaultDescription: 1
+                        minimum: 1
                     keepalive_timeout:
                         type: integer
                         description: timeout in seconds to drop connection if there's not data received from it
@@ -231,9 +248,25 @@ properties:
                                 type: integer
                                 description: the initial window size of the server
                                 defaultDescription: 65536
+                            header_table_size:
+                                type: integer
+                                description: HPACK dynamic table size for the request headers, advertised to the clients
+                                defaultDescription: 4096
+                            max_deflate_dynamic_table_size:
+                                type: integer
+                                description: upper bound of the HPACK dynamic table size for the response headers
+                                defaultDescription: 4096
+                            index_set_cookie:
+                                type: boolean
+                                description: whether Set-Cookie response headers are added to the HPACK dynamic table
+                                defaultDescription: true
             shards:
                 type: integer
                 description: how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing
+            reuseport-cpu-steering:
+                type: boolean
+                description: on Linux, steer each new TCP connection to the shard socket chosen by the CPU that received it (SO_ATTACH_REUSEPORT_CBPF)
+                defaultDescription: false
     listener-monitor:
         type: object
         description: describes the special monitoring socket, used for getting statistics and processing utility requests that should succeed even is the main socket is under heavy pressure
@@ -0,0 +1,101 @@
+#include <userver/server/handlers/cpu_profiler.hpp>
+
+#include <algorithm>
+#include <optional>
+#include <thread>
+
+#include <fmt/format.h>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/yaml_config/schema.hpp>
+#include <utils/cpu_profiler.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+constexpr std::uint32_t kDefaultSeconds = 10;
+constexpr std::uint32_t kMaxSeconds = 300;
+constexpr std::uint32_t kDefaultFrequencyHz = 99;
+constexpr std::uint32_t kMaxFrequencyHz = 1000;
+
+std::optional<std::uint32_t> ParseArg(
+    const http::HttpRequest& request,
+    const std::string& name,
+    std::uint32_t default_value,
+    std::uint32_t max_value,
+    std::string& error
+) {
+    if (!request.HasArg(name)) return default_value;
+
+    try {
+        const auto value = utils::FromString<std::uint32_t>(request.GetArg(name));
+        if (value > 0 && value <= max_value) return value;
+    } catch (const std::exception&) {
+        // reported below
+    }
+    error = fmt::format("'{}' must be an integer in [1, {}]\n", name, max_value);
+    return std::nullopt;
+}
+
+}  // namespace
+
+CpuProfiler::CpuProfiler(const components::ComponentConfig& config, const components::ComponentContext& context)
+    : HttpHandlerBase(config, context, /*is_monitor = */ true) {}
+
+std::string CpuProfiler::HandleRequestThrow(const http::HttpRequest& request, request::RequestContext&) const {
+    std::string error;
+    const auto seconds = ParseArg(request, "seconds", kDefaultSeconds, kMaxSeconds, error);
+    const auto frequency = ParseArg(request, "frequency", kDefaultFrequencyHz, kMaxFrequencyHz, error);
+    const auto& format = request.GetArg("format");
+    if (!seconds || !frequency) {
+        request.SetResponseStatus(server::http::HttpStatus::kBadRequest);
+        return error;
+    }
+    if (!format.empty() && format != "pprof" && format != "folded") {
+        request.SetResponseStatus(server::http::HttpStatus::kBadRequest);
+        return "'format' must be one of: pprof, folded\n";
+    }
+
+    utils::cpu_profiler::Settings settings;
+    settings.frequency_hz = *frequency;
+    // Every busy thread produces `frequency` samples per second
+    const std::size_t expected_samples =
+        std::size_t{*seconds} * *frequency * std::max(std::thread::hardware_concurrency(), 1U);
+    settings.max_samples = std::min(settings.max_samples, expected_samples);
+
+    std::optional<utils::cpu_profiler::Session> session;
+    try {
+        session.emplace(settings);
+    } catch (const utils::cpu_profiler::ProfilerBusyError& e) {
+        request.SetResponseStatus(server::http::HttpStatus::kConflict);
+        return fmt::format("{}\n", e.what());
+    }
+
+    engine::InterruptibleSleepFor(std::chrono::seconds{*seconds});
+    const auto profile = session->Stop();
+    if (profile.lost_samples) {
+        LOG_WARNING() << "CPU profiler has lost " << profile.lost_samples << " samples due to the samples limit";
+    }
+
+    if (format == "folded") {
+        request.GetHttpResponse().SetContentType("text/plain; charset=utf-8");
+        return utils::cpu_profiler::ToFolded(profile);
+    }
+    request.GetHttpResponse().SetContentType("application/octet-stream");
+    return utils::cpu_profiler::ToPprof(profile);
+}
+
+yaml_config::Schema CpuProfiler::GetStaticConfigSchema() {
+    auto schema = HttpHandlerBase::GetStaticConfigSchema();
+    schema.UpdateDescription("handler-cpu-profiler config");
+    return schema;
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
@@ -95,6 +95,39 @@ properties:
         type: integer
         description: integer to limit RPS to this handler
         defaultDescription: <no limit>
+    adaptive-concurrency-limit:
+        type: object
+        description: limit pending requests to this handler by the gradient of their timings
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: set to false to not start the controller
+                defaultDescription: true
+            fake-mode:
+                type: boolean
+                description: compute the limit, but do not apply it
+                defaultDescription: false
+            min-limit:
+                type: integer
+                description: the limit is never less than this value
+                defaultDescription: 10
+            max-limit:
+                type: integer
+                description: the limit is not applied while it is not less than this value
+                defaultDescription: 1000
+            rtt-tolerance:
+                type: number
+                description: timings up to this times the minimal recent timings are considered normal
+                defaultDescription: 2.0
+            smoothing:
+                type: number
+                description: weight of the new limit in the exponential smoothing, (0, 1]
+                defaultDescription: 0.2
+            min-requests:
+                type: integer
+                description: seconds with fewer requests do not change the limit
+                defaultDescription: 10
     decompress_request:
         type: boolean
         description: allow decompression of the requests
@@ -119,6 +152,10 @@ properties:
         type: boolean
         description: whether to set http tracing headers (X-YaTraceId, X-YaSpanId, X-RequestId)
         defaultDescription: true
+    access-log-stage-timings:
+        type: boolean
+        description: add the time of each server::http::RequestStage in microseconds to the access_tskv log
+        defaultDescription: false
     deadline_propagation_enabled:
         type: boolean
         description: |
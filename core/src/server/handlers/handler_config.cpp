@@ -72,6 +72,9 @@ HandlerConfig ParseHandlerConfigsWithDefaults(
     config.response_data_size_log_limit =
         value["response_data_size_log_limit"].As<size_t>(handler_defaults.response_data_size_log_limit);
     config.max_requests_per_second = value["max_requests_per_second"].As<std::optional<size_t>>();
+    config.adaptive_concurrency_limit =
+        value["adaptive-concurrency-limit"]
+            .As<std::optional<USERVER_NAMESPACE::congestion_control::v2::GradientConfig>>();
     config.decompress_request = value["decompress_request"].As<bool>(true);
     config.throttling_enabled = value["throttling_enabled"].As<bool>(true);
     config.set_response_server_hostname = value["set-response-server-hostname"].As<std::optional<bool>>();
@@ -86,6 +89,7 @@ HandlerConfig ParseHandlerConfigsWithDefaults(
     }
 
     config.set_tracing_headers = value["set_tracing_headers"].As<bool>(handler_defaults.set_tracing_headers);
+    config.access_log_stage_timings = value["access-log-stage-timings"].As<bool>(false);
 
     config.deadline_propagation_enabled =
         value["deadline_propagation_enabled"].As<bool>(handler_defaults.deadline_propagation_enabled);
@@ -184,6 +184,7 @@ HttpHandlerBase::HttpHandlerBase(
         std::move(prefix),
         [this](utils::statistics::Writer& result) {
             FormatStatistics(result["handler"], *handler_statistics_);
+            result["stage-timings-us"] = *request_statistics_;
             if constexpr (kIncludeServerHttpMetrics) {
                 FormatStatistics(result["request"], *request_statistics_);
             }
@@ -248,6 +249,11 @@ void HttpHandlerBase::HandleHttpRequest(http::HttpRequest& http_request, request
     // Don't hold the config snapshot for too long, especially with streaming.
     context.GetInternalContext().ResetConfigSnapshot();
 
+    http_request.SetHandlerStartTime();
+    const utils::FastScopeGuard handler_finish_guard([&http_request]() noexcept {
+        http_request.SetHandlerFinishTime();
+    });
+
     const auto scope_time = tracing::ScopeTime::CreateOptionalScopeTime("http_handle_request");
     if (response.IsBodyStreamed()) {
         HandleRequestStream(http_request, context);
@@ -493,9 +499,15 @@ void HttpHandlerBase::BuildMiddlewarePipeline(
 
     auto* next_middleware_ptr_{&first_middleware_};
     const auto add_middleware = [this, &middlewares_config, &context, &next_middleware_ptr_](std::string_view name) {
-        *next_middleware_ptr_ = context.FindComponent<middlewares::HttpMiddlewareFactoryBase>(name).CreateChecked(
+        auto middleware = context.FindComponent<middlewares::HttpMiddlewareFactoryBase>(name).CreateChecked(
             *this, middlewares_config[name]
         );
+        if (middleware->IsPassThrough()) {
+            LOG_DEBUG() << "Middleware '" << name << "' does nothing for handler '" << HandlerName()
+                        << "', skipping it";
+            return;
+        }
+        *next_middleware_ptr_ = std::move(middleware);
         next_middleware_ptr_ = &(*next_middleware_ptr_)->next_;
     };
 
@@ -1,6 +1,7 @@
 #include <server/handlers/http_handler_base_statistics.hpp>
 
 #include <algorithm>
+#include <utility>
 
 #include <userver/server/request/task_inherited_data.hpp>
 
@@ -10,6 +11,16 @@ namespace server::handlers {
 
 namespace {
 
+// Upper bounds in microseconds
+constexpr std::array<double, 15> kStageTimingBoundsUs{
+    5, 10, 25, 50, 100, 250, 500, 1'000, 2'500, 5'000, 10'000, 25'000, 100'000, 1'000'000, 10'000'000};
+
+template <std::size_t... Indices>
+auto MakeStageTimingHistograms(std::index_sequence<Indices...>) {
+    return std::array<utils::statistics::Histogram, sizeof...(Indices)>{
+        (static_cast<void>(Indices), utils::statistics::Histogram{kStageTimingBoundsUs})...};
+}
+
 struct HttpHandlerStatisticsHelper {
     const HttpHandlerStatisticsSnapshot& snapshot;
 };
@@ -74,6 +85,27 @@ void HttpRequestMethodStatistics::Account(const HttpRequestStatisticsEntry& stat
     timings_.GetCurrentCounter().Account(stats.timing.count());
 }
 
+HttpRequestStatistics::HttpRequestStatistics()
+    : stage_timings_(MakeStageTimingHistograms(std::make_index_sequence<http::kRequestStagesCount>{})) {}
+
+void HttpRequestStatistics::AccountStages(const http::RequestStageTimings& timings) noexcept {
+    for (std::size_t i = 0; i < http::kRequestStagesCount; ++i) {
+        stage_timings_[i].Account(static_cast<double>(timings[i].count()));
+    }
+}
+
+const utils::statistics::Histogram& HttpRequestStatistics::GetStageTimings(http::RequestStage stage
+) const noexcept {
+    return stage_timings_[static_cast<std::size_t>(stage)];
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const HttpRequestStatistics& stats) {
+    for (std::size_t i = 0; i < http::kRequestStagesCount; ++i) {
+        const auto stage = static_cast<http::RequestStage>(i);
+        writer.ValueWithLabels(stats.GetStageTimings(stage), {{"http_request_stage", http::ToString(stage)}});
+    }
+}
+
 bool IsOkMethod(http::HttpMethod method) noexcept {
     return static_cast<std::size_t>(method) <= http::kHandlerMethodsMax;
 }
@@ -8,7 +8,9 @@
 #include <server/http/handler_methods.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/server/http/http_request.hpp>
 #include <userver/server/http/http_status.hpp>
+#include <userver/utils/statistics/histogram.hpp>
 #include <userver/utils/statistics/percentile.hpp>
 #include <userver/utils/statistics/rate.hpp>
 #include <userver/utils/statistics/rate_counter.hpp>
@@ -123,7 +125,21 @@ private:
 
 class HttpHandlerStatistics final : public ByMethodStatistics<HttpHandlerMethodStatistics> {};
 
-class HttpRequestStatistics final : public ByMethodStatistics<HttpRequestMethodStatistics> {};
+class HttpRequestStatistics final : public ByMethodStatistics<HttpRequestMethodStatistics> {
+public:
+    HttpRequestStatistics();
+
+    // Accounted for all the methods together, to keep the handler footprint low
+    void AccountStages(const http::RequestStageTimings& timings) noexcept;
+
+    const utils::statistics::Histogram& GetStageTimings(http::RequestStage stage) const noexcept;
+
+private:
+    std::array<utils::statistics::Histogram, http::kRequestStagesCount> stage_timings_;
+};
+
+// Writes the histograms of http::RequestStage timings, labeled by the stage
+void DumpMetric(utils::statistics::Writer& writer, const HttpRequestStatistics& stats);
 
 class HttpHandlerStatisticsScope final {
 public:
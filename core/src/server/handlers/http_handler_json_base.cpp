@@ -1,9 +1,14 @@
 #include <userver/server/handlers/http_handler_json_base.hpp>
 
+#include <algorithm>
+
 #include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/msgpack.hpp>
 #include <userver/formats/json/serialize.hpp>
+#include <userver/http/common_headers.hpp>
 #include <userver/http/content_type.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/utils/text_light.hpp>
 
 #include <userver/server/handlers/exceptions.hpp>
 #include <userver/server/handlers/json_error_builder.hpp>
@@ -24,6 +29,44 @@ const std::string kSerializeJson = "serialize_json";
 
 const formats::json::Value kEmptyJson{};
 
+bool IsMsgpackMediaType(const USERVER_NAMESPACE::http::ContentType& content_type) {
+    return content_type.TypeToken() == "application" &&
+           (content_type.SubtypeToken() == "msgpack" || content_type.SubtypeToken() == "x-msgpack");
+}
+
+bool IsMsgpackRequest(const http::HttpRequest& request) {
+    const auto& header = request.GetHeader(USERVER_NAMESPACE::http::headers::kContentType);
+    if (header.empty()) return false;
+    try {
+        return IsMsgpackMediaType(header);
+    } catch (const USERVER_NAMESPACE::http::MalformedContentType&) {
+        return false;
+    }
+}
+
+// MessagePack is sent only if the client explicitly asks for it with at least
+// the same quality as JSON, so that "*/*" and absent Accept still get JSON
+bool IsMsgpackAccepted(const http::HttpRequest& request) {
+    const auto& header = request.GetHeader(USERVER_NAMESPACE::http::headers::kAccept);
+    if (header.empty()) return false;
+
+    int msgpack_quality = 0;
+    int json_quality = 0;
+    for (const auto& media_range : utils::text::SplitIntoStringViewVector(header, ",")) {
+        try {
+            const USERVER_NAMESPACE::http::ContentType content_type{media_range};
+            if (IsMsgpackMediaType(content_type)) {
+                msgpack_quality = std::max(msgpack_quality, content_type.Quality());
+            } else if (content_type.DoesAccept(USERVER_NAMESPACE::http::content_type::kApplicationJson)) {
+                json_quality = std::max(json_quality, content_type.Quality());
+            }
+        } catch (const USERVER_NAMESPACE::http::MalformedContentType&) {
+            // skip the broken media range, others still count
+        }
+    }
+    return msgpack_quality > 0 && msgpack_quality >= json_quality;
+}
+
 }  // namespace
 
 HttpHandlerJsonBase::HttpHandlerJsonBase(
@@ -38,13 +81,18 @@ std::string HttpHandlerJsonBase::HandleRequestThrow(const http::HttpRequest& req
     const auto& request_json = context.GetData<const formats::json::Value&>(kRequestDataName);
 
     auto& response = request.GetHttpResponse();
-    response.SetContentType(USERVER_NAMESPACE::http::content_type::kApplicationJson);
+    const bool use_msgpack = IsMsgpackAccepted(request);
+    response.SetContentType(
+        use_msgpack ? USERVER_NAMESPACE::http::content_type::kApplicationMsgpack
+                    : USERVER_NAMESPACE::http::content_type::kApplicationJson
+    );
 
     const auto& response_json = context.SetData<formats::json::Value>(
         kResponseDataName, HandleRequestJsonThrow(request, request_json, context)
     );
 
     const auto scope_time = tracing::ScopeTime::CreateOptionalScopeTime(kSerializeJson);
+    if (use_msgpack) return formats::json::ToMsgpack(response_json);
     return formats::json::ToString(response_json);
 }
 
@@ -70,6 +118,18 @@ void HttpHandlerJsonBase::ParseRequestData(const http::HttpRequest& request, req
         return;
     }
 
+    if (IsMsgpackRequest(request)) {
+        try {
+            context.SetData<formats::json::Value>(kRequestDataName, formats::json::FromMsgpack(request.RequestBody()));
+        } catch (const formats::json::Exception& e) {
+            throw RequestParseError(
+                InternalMessage{"Invalid MessagePack body"},
+                ExternalBody{std::string("Invalid MessagePack body: ") + e.what()}
+            );
+        }
+        return;
+    }
+
     try {
         context.SetData<formats::json::Value>(kRequestDataName, formats::json::FromString(request.RequestBody()));
     } catch (const formats::json::Exception& e) {
@@ -1,11 +1,21 @@
 #include <userver/server/handlers/http_handler_static.hpp>
 
+#include <array>
+#include <optional>
+
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
+#include <userver/compression/zstd.hpp>
+#include <userver/crypto/hash.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
+#include <compression/gzip.hpp>
+#include <server/middlewares/compression.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::handlers {
@@ -32,8 +42,66 @@ const dynamic_config::Key<dynamic_config::ValueDict<std::string>> kContentTypeMa
 )"},
 };
 
+using middlewares::impl::ContentEncoding;
+
+struct EncodedVariant final {
+    std::string data;
+    std::string etag;
+};
+
+std::string MakeETag(std::string_view hash, std::string_view suffix = {}) {
+    std::string etag;
+    etag.reserve(hash.size() + suffix.size() + 3);
+    etag += '"';
+    etag += hash;
+    if (!suffix.empty()) {
+        etag += '-';
+        etag += suffix;
+    }
+    etag += '"';
+    return etag;
+}
+
+std::string Compress(ContentEncoding encoding, std::string_view data) {
+    switch (encoding) {
+        case ContentEncoding::kGzip:
+            return compression::gzip::Compress(data);
+        case ContentEncoding::kZstd:
+            return compression::zstd::Compress(data);
+    }
+    UINVARIANT(false, "Unknown content encoding");
+}
+
+// If-None-Match uses the weak comparison, RFC 9110 13.1.2
+bool IsETagMatched(std::string_view if_none_match, std::string_view etag) {
+    while (!if_none_match.empty()) {
+        const auto separator_pos = if_none_match.find(',');
+        auto candidate = if_none_match.substr(0, separator_pos);
+        if_none_match =
+            separator_pos == std::string_view::npos ? std::string_view{} : if_none_match.substr(separator_pos + 1);
+
+        while (!candidate.empty() && candidate.front() == ' ') candidate.remove_prefix(1);
+        while (!candidate.empty() && candidate.back() == ' ') candidate.remove_suffix(1);
+        if (candidate.substr(0, 2) == "W/") candidate.remove_prefix(2);
+
+        if (candidate == "*" || candidate == etag) return true;
+    }
+    return false;
+}
+
 }  // namespace
 
+struct HttpHandlerStatic::FileVariants final {
+    // Does not keep the outdated file contents alive
+    std::weak_ptr<const fs::FileInfoWithData> source;
+    std::string etag;
+    std::array<std::optional<EncodedVariant>, middlewares::impl::kContentEncodingsCount> encoded;
+
+    bool IsBuiltFrom(const fs::FileInfoWithDataConstPtr& file) const noexcept {
+        return !source.owner_before(file) && !file.owner_before(source);
+    }
+};
+
 HttpHandlerStatic::HttpHandlerStatic(
     const components::ComponentConfig& config,
     const components::ComponentContext& context
@@ -43,18 +111,75 @@ HttpHandlerStatic::HttpHandlerStatic(
       storage_(
           context.FindComponent<components::FsCache>(config["fs-cache-component"].As<std::string>("fs-cache-component"))
               .GetClient()
-      ) {}
+      ),
+      compress_(config["compress"].As<bool>(false)),
+      compress_min_size_(config["compress-min-size"].As<std::size_t>(1024)) {}
+
+HttpHandlerStatic::~HttpHandlerStatic() = default;
 
 std::string HttpHandlerStatic::HandleRequestThrow(const http::HttpRequest& request, request::RequestContext&) const {
     LOG_DEBUG() << "Handler: " << request.GetRequestPath();
-    const auto file = storage_.TryGetFile(request.GetRequestPath());
-    if (file) {
-        const auto config = config_.GetSnapshot();
-        request.GetHttpResponse().SetContentType(config[kContentTypeMap][file->extension]);
-        return file->data;
+    const auto& path = request.GetRequestPath();
+    const auto file = storage_.TryGetFile(path);
+    auto& response = request.GetHttpResponse();
+    if (!file) {
+        response.SetStatusNotFound();
+        return "File not found";
+    }
+
+    const auto config = config_.GetSnapshot();
+    response.SetContentType(config[kContentTypeMap][file->extension]);
+
+    const auto variants = GetFileVariants(path, file);
+    const std::string* data = &file->data;
+    const std::string* etag = &variants->etag;
+    if (compress_) {
+        response.SetHeader(USERVER_NAMESPACE::http::headers::kVary, std::string{"Accept-Encoding"});
+        const auto encoding = middlewares::impl::NegotiateContentEncoding(
+            request.GetHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding)
+        );
+        if (encoding) {
+            const auto& variant = variants->encoded[static_cast<std::size_t>(*encoding)];
+            if (variant) {
+                response.SetContentEncoding(std::string{middlewares::impl::ToString(*encoding)});
+                data = &variant->data;
+                etag = &variant->etag;
+            }
+        }
     }
-    request.GetHttpResponse().SetStatusNotFound();
-    return "File not found";
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kETag, *etag);
+
+    if (IsETagMatched(request.GetHeader(USERVER_NAMESPACE::http::headers::kIfNoneMatch), *etag)) {
+        response.SetStatus(http::HttpStatus::kNotModified);
+        return {};
+    }
+    return *data;
+}
+
+std::shared_ptr<const HttpHandlerStatic::FileVariants>
+HttpHandlerStatic::GetFileVariants(const std::string& path, const fs::FileInfoWithDataConstPtr& file) const {
+    auto variants = variants_.Get(path);
+    if (variants && variants->IsBuiltFrom(file)) return variants;
+
+    // Concurrent requests may build the same variants, the last one wins
+    FileVariants built;
+    built.source = file;
+    const auto hash = crypto::hash::Sha1(file->data);
+    built.etag = MakeETag(hash);
+    if (compress_ && file->data.size() >= compress_min_size_) {
+        for (const auto encoding : {ContentEncoding::kGzip, ContentEncoding::kZstd}) {
+            auto compressed = Compress(encoding, file->data);
+            // Not worth it for the already compressed formats
+            if (compressed.size() >= file->data.size()) continue;
+
+            const auto name = middlewares::impl::ToString(encoding);
+            built.encoded[static_cast<std::size_t>(encoding)] = EncodedVariant{std::move(compressed), MakeETag(hash, name)};
+        }
+    }
+
+    variants = std::make_shared<const FileVariants>(std::move(built));
+    variants_.InsertOrAssign(path, variants);
+    return variants;
 }
 
 yaml_config::Schema HttpHandlerStatic::GetStaticConfigSchema() {
@@ -69,6 +194,14 @@ properties:
         type: string
         description: Name of the FsCache component
         defaultDescription: fs-cache-component
+    compress:
+        type: boolean
+        description: serve the cached gzip and zstd variants of the files to the clients that accept them
+        defaultDescription: false
+    compress-min-size:
+        type: integer
+        description: do not compress the files that are smaller, in bytes
+        defaultDescription: 1024
 )");
 }
 
@@ -0,0 +1,150 @@
+#include <userver/server/handlers/perf_record.hpp>
+
+#include <unistd.h>
+#include <csignal>
+
+#include <optional>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/components/component.hpp>
+#include <userver/components/process_starter.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/read.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+constexpr std::uint32_t kDefaultSeconds = 10;
+constexpr std::uint32_t kMaxSeconds = 300;
+// perf post-processes the samples and collects the build ids on exit
+constexpr std::chrono::seconds kStopTimeout{60};
+
+std::optional<std::uint32_t> ParseSeconds(const http::HttpRequest& request) {
+    if (!request.HasArg("seconds")) return kDefaultSeconds;
+
+    try {
+        const auto value = utils::FromString<std::uint32_t>(request.GetArg("seconds"));
+        if (value > 0 && value <= kMaxSeconds) return value;
+    } catch (const std::exception&) {
+        // reported by the caller
+    }
+    return std::nullopt;
+}
+
+bool IsStoppedGracefully(const engine::subprocess::ChildProcessStatus& status) {
+    // perf record re-raises SIGINT after writing the data
+    return (status.IsExited() && status.GetExitCode() == 0) ||
+           (status.IsSignaled() && status.GetTermSignal() == SIGINT);
+}
+
+}  // namespace
+
+PerfRecord::PerfRecord(const components::ComponentConfig& config, const components::ComponentContext& context)
+    : HttpHandlerBase(config, context, /*is_monitor = */ true),
+      process_starter_(context.FindComponent<components::ProcessStarter>().Get()),
+      fs_task_processor_(context.GetTaskProcessor(config["fs-task-processor"].As<std::string>("fs-task-processor"))),
+      perf_path_(config["perf-path"].As<std::string>("perf")),
+      event_(config["event"].As<std::string>("cycles:u")) {}
+
+std::string PerfRecord::HandleRequestThrow(const http::HttpRequest& request, request::RequestContext&) const {
+    const auto seconds = ParseSeconds(request);
+    if (!seconds) {
+        request.SetResponseStatus(server::http::HttpStatus::kBadRequest);
+        return fmt::format("'seconds' must be an integer in [1, {}]\n", kMaxSeconds);
+    }
+    const auto& branches = request.GetArg("branches");
+    if (!branches.empty() && branches != "0" && branches != "1") {
+        request.SetResponseStatus(server::http::HttpStatus::kBadRequest);
+        return "'branches' must be 0 or 1\n";
+    }
+
+    if (is_recording_.exchange(true)) {
+        request.SetResponseStatus(server::http::HttpStatus::kConflict);
+        return "perf record is already running\n";
+    }
+    const utils::FastScopeGuard recording_guard{[this]() noexcept { is_recording_ = false; }};
+
+    auto dir = engine::AsyncNoSpan(fs_task_processor_, [] { return fs::blocking::TempDirectory::Create(); }).Get();
+    const utils::FastScopeGuard dir_guard{[this, &dir]() noexcept {
+        try {
+            engine::CriticalAsyncNoSpan(fs_task_processor_, [&dir] { std::move(dir).Remove(); }).Get();
+        } catch (const std::exception& e) {
+            LOG_WARNING() << "Failed to remove the perf record directory " << dir.GetPath() << ": " << e;
+        }
+    }};
+    const auto data_path = dir.GetPath() + "/perf.data";
+    const auto log_path = dir.GetPath() + "/perf.log";
+
+    std::vector<std::string> args{
+        "record", "--quiet", "-e", event_, "-p", std::to_string(::getpid()), "-o", data_path};
+    if (branches != "0") {
+        args.insert(args.end(), {"-j", "any,u"});
+    }
+
+    engine::subprocess::ExecOptions options;
+    options.stderr_file = log_path;
+    options.use_path = true;
+
+    std::optional<engine::subprocess::ChildProcess> perf;
+    try {
+        perf.emplace(process_starter_.Exec(perf_path_, args, std::move(options)));
+    } catch (const std::exception& e) {
+        request.SetResponseStatus(server::http::HttpStatus::kInternalServerError);
+        return fmt::format("Failed to start '{}': {}\n", perf_path_, e.what());
+    }
+
+    engine::InterruptibleSleepFor(std::chrono::seconds{*seconds});
+    perf->SendSignal(SIGINT);
+    if (!perf->WaitFor(kStopTimeout)) {
+        LOG_WARNING() << "perf record did not stop in time, killing it";
+        perf->SendSignal(SIGKILL);
+    }
+    const auto status = perf->Get();
+
+    if (!IsStoppedGracefully(status)) {
+        request.SetResponseStatus(server::http::HttpStatus::kInternalServerError);
+        const auto log = fs::FileExists(fs_task_processor_, log_path)
+                             ? fs::ReadFileContents(fs_task_processor_, log_path)
+                             : std::string{};
+        return fmt::format("perf record failed ({}):\n{}", ToString(status.GetExitReason()), log);
+    }
+
+    request.GetHttpResponse().SetContentType("application/octet-stream");
+    return fs::ReadFileContents(fs_task_processor_, data_path);
+}
+
+yaml_config::Schema PerfRecord::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<HttpHandlerBase>(R"(
+type: object
+description: handler-perf-record config
+additionalProperties: false
+properties:
+    perf-path:
+        type: string
+        description: path to the perf executable, searched in PATH if it has no '/'
+        defaultDescription: perf
+    event:
+        type: string
+        description: the sampled perf event
+        defaultDescription: cycles:u
+    fs-task-processor:
+        type: string
+        description: task processor for the blocking filesystem operations
+        defaultDescription: fs-task-processor
+)");
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
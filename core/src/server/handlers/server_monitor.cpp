@@ -14,6 +14,7 @@
 #include <userver/yaml_config/merge_schemas.hpp>
 #include <userver/yaml_config/schema.hpp>
 
+#include <utils/statistics/serialization_cache.hpp>
 #include <utils/statistics/value_builder_helpers.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -69,7 +70,12 @@ ServerMonitor::ServerMonitor(
     : HttpHandlerBase(config, component_context, /*is_monitor = */ true),
       statistics_storage_(component_context.FindComponent<components::StatisticsStorage>().GetStorage()),
       common_labels_{config["common-labels"].As<CommonLabels>({})},
-      default_format_{ParseFormat(config["format"].As<std::string>({}))} {}
+      default_format_{ParseFormat(config["format"].As<std::string>({}))},
+      cache_(std::make_unique<utils::statistics::impl::SerializationCache>(
+          config["cache-max-age"].As<std::chrono::milliseconds>(std::chrono::milliseconds{0})
+      )) {}
+
+ServerMonitor::~ServerMonitor() = default;
 
 std::string ServerMonitor::HandleRequestThrow(const http::HttpRequest& request, request::RequestContext&) const {
     const auto& prefix = request.GetArg("prefix");
@@ -101,7 +107,17 @@ std::string ServerMonitor::HandleRequestThrow(const http::HttpRequest& request,
         (path.empty() ? Request::MakeWithPrefix(prefix, std::move(common_labels), std::move(labels))
                       : Request::MakeWithPath(path, std::move(common_labels), std::move(labels)));
 
-    request.GetHttpResponse().SetContentType("text/plain; charset=utf-8");
+    const bool is_json_format =
+        format == StatsFormat::kJson || format == StatsFormat::kSolomon || format == StatsFormat::kInternal;
+    request.GetHttpResponse().SetContentType(is_json_format ? "application/json" : "text/plain; charset=utf-8");
+
+    if (!cache_->IsEnabled()) return Serialize(format, statistics_request);
+
+    auto cache_key = fmt::format("{}\n{}\n{}\n{}", static_cast<int>(format), prefix, path, labels_json);
+    return cache_->GetOrSerialize(cache_key, [&] { return Serialize(format, statistics_request); });
+}
+
+std::string ServerMonitor::Serialize(StatsFormat format, const utils::statistics::Request& statistics_request) const {
     switch (format) {
         case StatsFormat::kGraphite:
             return utils::statistics::ToGraphiteFormat(statistics_storage_, statistics_request);
@@ -113,18 +129,15 @@ std::string ServerMonitor::HandleRequestThrow(const http::HttpRequest& request,
             return utils::statistics::ToPrometheusFormatUntyped(statistics_storage_, statistics_request);
 
         case StatsFormat::kJson:
-            request.GetHttpResponse().SetContentType("application/json");
             return utils::statistics::ToJsonFormat(statistics_storage_, statistics_request);
 
         case StatsFormat::kPretty:
             return utils::statistics::ToPrettyFormat(statistics_storage_, statistics_request);
 
         case StatsFormat::kSolomon:
-            request.GetHttpResponse().SetContentType("application/json");
             return utils::statistics::ToSolomonFormat(statistics_storage_, common_labels_, statistics_request);
 
         case StatsFormat::kInternal:
-            request.GetHttpResponse().SetContentType("application/json");
             const auto json = statistics_storage_.GetAsJson();
             UASSERT(utils::statistics::AreAllMetricsNumbers(json));
             return formats::json::ToString(json);
@@ -163,6 +176,13 @@ properties:
           - pretty
           - solomon
           - internal
+    cache-max-age:
+        type: string
+        description: |
+            Reuse the serialized metrics for the same request arguments if they
+            were serialized less than this time ago. Useful when several
+            scrapers poll the handler. 0 disables the cache.
+        defaultDescription: 0ms
   )");
 }
 
@@ -72,15 +72,23 @@ Http2Session::Http2Session(
     nghttp2_session_callbacks_set_on_begin_headers_callback(callbacks, OnBeginHeaders);
     nghttp2_session_callbacks_set_on_data_chunk_recv_callback(callbacks, OnDataChunkRecv);
 
+    nghttp2_option* option{nullptr};
+    UINVARIANT(nghttp2_option_new(&option) == 0, "Failed to init options for HTTP/2.0");
+    utils::FastScopeGuard delete_option_guard{[&option]() noexcept { nghttp2_option_del(option); }};
+    nghttp2_option_set_max_deflate_dynamic_table_size(option, config.max_deflate_dynamic_table_size);
+
     nghttp2_session* session{nullptr};
-    UINVARIANT(nghttp2_session_server_new(&session, callbacks, this) == 0, "Failed to init session for HTTP/2.0");
+    UINVARIANT(
+        nghttp2_session_server_new2(&session, callbacks, this, option) == 0, "Failed to init session for HTTP/2.0"
+    );
     UASSERT(session);
     session_ = SessionPtr(session, nghttp2_session_del);
 
-    std::array<nghttp2_settings_entry, 3> settings{
+    std::array<nghttp2_settings_entry, 4> settings{
         nghttp2_settings_entry{NGHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS, config.max_concurrent_streams},
         nghttp2_settings_entry{NGHTTP2_SETTINGS_MAX_FRAME_SIZE, config.max_frame_size},
-        nghttp2_settings_entry{NGHTTP2_SETTINGS_INITIAL_WINDOW_SIZE, config.initial_window_size}};
+        nghttp2_settings_entry{NGHTTP2_SETTINGS_INITIAL_WINDOW_SIZE, config.initial_window_size},
+        nghttp2_settings_entry{NGHTTP2_SETTINGS_HEADER_TABLE_SIZE, config.header_table_size}};
 
     auto rv = nghttp2_submit_settings(session_.get(), NGHTTP2_FLAG_NONE, settings.data(), settings.size());
     ThrowIfErr(rv, "Error when submit settings");
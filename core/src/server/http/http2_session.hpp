@@ -56,6 +56,8 @@ public:
 
     nghttp2_session* GetNghttp2SessionPtr() { return session_.get(); }
 
+    const net::Http2SessionConfig& GetConfig() const { return config_; }
+
     void UpgradeToHttp2(std::string_view client_magic);
 
     engine::SingleConsumerEvent& GetStreamingEvent();
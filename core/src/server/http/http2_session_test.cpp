@@ -278,6 +278,28 @@ UTEST_F(Http2SessionTest, Body) {
     EXPECT_EQ(request->GetMethod(), HttpMethod::kPost);
 }
 
+UTEST_F(Http2SessionTest, BulkBodies) {
+    auto& client = GetClient();
+    const auto url = GetServer().GetBaseUrl();
+
+    auto consumer = GetConsumer();
+    ParsedRequestImplPtr request;
+
+    // Just below the initial window, many DATA frames per request
+    const std::string data(net::Http2SessionConfig{}.initial_window_size - 1, 'x');
+    constexpr std::size_t kRequests = 20;
+
+    for (std::size_t i = 0; i < kRequests; ++i) {
+        const auto response =
+            client.CreateRequest().http_version(USERVER_NAMESPACE::http::HttpVersion::k2).post(url, data).perform();
+        EXPECT_EQ(200, response->status_code());
+
+        ASSERT_TRUE(consumer.Pop(request));
+        EXPECT_EQ(request->RequestBody().size(), data.size());
+        EXPECT_EQ(request->RequestBody(), data);
+    }
+}
+
 UTEST_F(Http2SessionTest, QueryArgs) {
     auto& client = GetClient();
     auto consumer = GetConsumer();
@@ -5,6 +5,7 @@
 
 #include <server/http/http2_session.hpp>
 #include <server/http/http_cached_date.hpp>
+#include <server/net/connection_config.hpp>
 
 #include <userver/http/common_headers.hpp>
 #include <userver/http/predefined_header.hpp>
@@ -71,7 +72,7 @@ public:
         bytes_ += (key.size() + value.size());
     }
 
-    void AddCookie(const Cookie& cookie) {
+    void AddCookie(const Cookie& cookie, bool sensitive) {
         USERVER_NAMESPACE::http::headers::HeadersString val;
         cookie.AppendToString(val);
         const auto* ptr = values_.data();
@@ -79,7 +80,7 @@ public:
         values_.push_back(std::string{val.data(), val.size()});
         UASSERT(ptr == values_.data());
         ng_headers_.push_back(
-            UnsafeHeaderToNGHeader(USERVER_NAMESPACE::http::headers::kSetCookie, values_.back(), false)
+            UnsafeHeaderToNGHeader(USERVER_NAMESPACE::http::headers::kSetCookie, values_.back(), sensitive)
         );
         const std::string_view key = USERVER_NAMESPACE::http::headers::kSetCookie;
         bytes_ += (key.size() + val.size());
@@ -162,8 +163,9 @@ private:
             }
             header_writer.AddKeyValue(key, value);
         }
+        const bool index_set_cookie = http2_session_.GetConfig().index_set_cookie;
         for (const auto& value : USERVER_NAMESPACE::utils::impl::MakeValuesView(response_.cookies_)) {
-            header_writer.AddCookie(value);
+            header_writer.AddCookie(value, !index_set_cookie);
         }
         return header_writer;
     }
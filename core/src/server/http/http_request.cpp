@@ -1,5 +1,7 @@
 #include <userver/server/http/http_request.hpp>
 
+#include <iterator>
+
 #include <server/handlers/http_handler_base_statistics.hpp>
 #include <server/http/http_request_impl.hpp>
 #include <userver/engine/io/socket.hpp>
@@ -8,6 +10,7 @@
 #include <userver/http/parser/http_request_parse_args.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/logger.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/utils/datetime.hpp>
 #include <userver/utils/encoding/tskv.hpp>
 
@@ -63,10 +66,38 @@ std::string EscapeForAccessTskvLog(const std::string& str) {
 const std::string kEmptyString{};
 const std::vector<std::string> kEmptyVector{};
 
+// Zero for the stages that were skipped or have not finished yet
+std::chrono::microseconds
+Elapsed(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to) noexcept {
+    if (from == std::chrono::steady_clock::time_point{} || to <= from) return {};
+    return std::chrono::duration_cast<std::chrono::microseconds>(to - from);
+}
+
 }  // namespace
 
 namespace server::http {
 
+std::string_view ToString(RequestStage stage) noexcept {
+    switch (stage) {
+        case RequestStage::kParse:
+            return "parse";
+        case RequestStage::kQueue:
+            return "queue";
+        case RequestStage::kMiddlewares:
+            return "middlewares";
+        case RequestStage::kHandler:
+            return "handler";
+        case RequestStage::kResponseWait:
+            return "response_wait";
+        case RequestStage::kSerialize:
+            return "serialize";
+        case RequestStage::kSend:
+            return "send";
+    }
+    UASSERT_MSG(false, "Unexpected request stage");
+    return "unknown";
+}
+
 HttpRequest::HttpRequest(request::ResponseDataAccounter& data_accounter, utils::impl::InternalTag)
     : pimpl_(*this, data_accounter) {}
 
@@ -261,6 +292,33 @@ HttpResponse& HttpRequest::GetHttpResponse() const { return pimpl_->response_; }
 
 std::chrono::steady_clock::time_point HttpRequest::GetStartTime() const { return pimpl_->start_time_; }
 
+RequestStageTimings HttpRequest::GetStageTimings() const {
+    const auto& impl = *pimpl_;
+    const auto index = [](RequestStage stage) { return static_cast<std::size_t>(stage); };
+
+    RequestStageTimings timings{};
+    timings[index(RequestStage::kParse)] = Elapsed(impl.start_time_, impl.task_create_time_);
+    timings[index(RequestStage::kQueue)] = Elapsed(impl.task_create_time_, impl.task_start_time_);
+    if (impl.handler_start_time_ != std::chrono::steady_clock::time_point{}) {
+        timings[index(RequestStage::kMiddlewares)] = Elapsed(impl.task_start_time_, impl.handler_start_time_) +
+                                                     Elapsed(impl.handler_finish_time_, impl.response_notify_time_);
+        timings[index(RequestStage::kHandler)] = Elapsed(impl.handler_start_time_, impl.handler_finish_time_);
+    } else {
+        // The request was rejected before reaching the handler
+        timings[index(RequestStage::kMiddlewares)] = Elapsed(impl.task_start_time_, impl.response_notify_time_);
+    }
+    timings[index(RequestStage::kResponseWait)] =
+        Elapsed(impl.response_notify_time_, impl.start_send_response_time_);
+
+    // HTTP/2.0 responses are serialized while being sent
+    const auto send_start_time = impl.response_serialized_time_ != std::chrono::steady_clock::time_point{}
+                                     ? impl.response_serialized_time_
+                                     : impl.start_send_response_time_;
+    timings[index(RequestStage::kSerialize)] = Elapsed(impl.start_send_response_time_, impl.response_serialized_time_);
+    timings[index(RequestStage::kSend)] = Elapsed(send_start_time, impl.finish_send_response_time_);
+    return timings;
+}
+
 bool HttpRequest::IsUpgradeWebsocket() const { return static_cast<bool>(pimpl_->upgrade_websocket_cb_); }
 
 void HttpRequest::SetUpgradeWebsocket(UpgradeCallback cb) const { pimpl_->upgrade_websocket_cb_ = std::move(cb); }
@@ -288,6 +346,7 @@ void HttpRequest::AccountResponseTime() {
             pimpl_->finish_send_response_time_ - pimpl_->start_time_
         );
         pimpl_->request_statistics_->ForMethod(GetMethod()).Account(handlers::HttpRequestStatisticsEntry{timing});
+        pimpl_->request_statistics_->AccountStages(GetStageTimings());
     }
 }
 
@@ -326,6 +385,14 @@ void HttpRequest::SetResponseNotifyTime(std::chrono::steady_clock::time_point no
     pimpl_->response_notify_time_ = now;
 }
 
+void HttpRequest::SetHandlerStartTime() { pimpl_->handler_start_time_ = std::chrono::steady_clock::now(); }
+
+void HttpRequest::SetHandlerFinishTime() { pimpl_->handler_finish_time_ = std::chrono::steady_clock::now(); }
+
+void HttpRequest::SetResponseSerializedTime() const {
+    pimpl_->response_serialized_time_ = std::chrono::steady_clock::now();
+}
+
 void HttpRequest::SetStartSendResponseTime() { pimpl_->start_send_response_time_ = std::chrono::steady_clock::now(); }
 
 void HttpRequest::SetFinishSendResponseTime() {
@@ -421,6 +488,17 @@ void HttpRequest::WriteAccessTskvLog(
         GetResponseTime().count(),
         EscapeForAccessTskvLog(RequestBody())
     )};
+    if (pimpl_->handler_ && pimpl_->handler_->GetConfig().access_log_stage_timings) {
+        const auto timings = GetStageTimings();
+        for (std::size_t i = 0; i < kRequestStagesCount; ++i) {
+            fmt::format_to(
+                std::back_inserter(item.log_line),
+                "\tstage_{}_us={}",
+                ToString(static_cast<RequestStage>(i)),
+                timings[i].count()
+            );
+        }
+    }
     logger_access_tskv->Log(logging::Level::kInfo, item);
 }
 
@@ -161,6 +161,13 @@ void HttpRequestConstructor::AppendBody(const char* data, size_t size) {
     body_ += std::string_view{data, size};
 }
 
+void HttpRequestConstructor::ReserveBody(std::uint64_t content_length) {
+    // Oversized requests are rejected by AccountRequestSize, do not allocate
+    // for them
+    if (content_length > config_.max_request_size) return;
+    body_.reserve(content_length);
+}
+
 void HttpRequestConstructor::SetIsFinal(bool is_final) { builder_.SetIsFinal(is_final); }
 
 void HttpRequestConstructor::SetResponseStreamId(std::int32_t stream_id) { builder_.SetResponseStreamId(stream_id); }
@@ -54,6 +54,10 @@ public:
     void AppendHeaderValue(const char* data, size_t size);
     void AppendBody(const char* data, size_t size);
 
+    /// Preallocates the body for the declared Content-Length to avoid
+    /// reallocations while the body arrives in chunks
+    void ReserveBody(std::uint64_t content_length);
+
     void SetIsFinal(bool is_final);
 
     // HTTP/2.0 only:
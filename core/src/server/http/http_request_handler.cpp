@@ -49,19 +49,16 @@ HttpRequestHandler::HttpRequestHandler(
     }
 }
 
-engine::TaskWithResult<void> HttpRequestHandler::StartFailsafeTask(std::shared_ptr<http::HttpRequest> http_request
-) const {
-    const auto* handler = http_request->GetHttpHandler();
+void HttpRequestHandler::CompleteWithoutHandler(http::HttpRequest& http_request) const {
+    const auto* handler = http_request.GetHttpHandler();
     static handlers::HttpRequestStatistics dummy_statistics;
 
-    http_request->SetHttpHandlerStatistics(dummy_statistics);
+    http_request.SetHttpHandlerStatistics(dummy_statistics);
 
-    return engine::AsyncNoSpan([request = std::move(http_request), handler]() {
-        request->SetTaskStartTime();
-        if (handler) handler->ReportMalformedRequest(*request);
-        request->SetResponseNotifyTime();
-        request->GetHttpResponse().SetReady();
-    });
+    http_request.SetTaskStartTime();
+    if (handler) handler->ReportMalformedRequest(http_request);
+    http_request.SetResponseNotifyTime();
+    http_request.GetHttpResponse().SetReady();
 }
 
 namespace {
@@ -78,7 +75,8 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(std::shared_pt
     if (http_response.IsReady()) {
         // Request is broken somehow, user handler must not be called
         http_request->SetTaskCreateTime();
-        return StartFailsafeTask(std::move(http_request));
+        CompleteWithoutHandler(*http_request);
+        return {};
     }
 
     if (new_request_hook_) new_request_hook_(http_request);
@@ -90,7 +88,8 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(std::shared_pt
     if (!task_processor || !handler) {
         // No handler found, response status is already set
         // by HttpRequestConstructor::CheckStatus
-        return StartFailsafeTask(std::move(http_request));
+        CompleteWithoutHandler(*http_request);
+        return {};
     }
     auto throttling_enabled = handler->GetConfig().throttling_enabled;
 
@@ -106,7 +105,8 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(std::shared_pt
         http_request->SetTaskCreateTime();
         LOG_LIMITED_ERROR() << "Request throttled (too many pending responses, "
                                "limit via 'server.max_response_size_in_flight')";
-        return StartFailsafeTask(std::move(http_request));
+        CompleteWithoutHandler(*http_request);
+        return {};
     }
 
     if (throttling_enabled && !rate_limit_.Obtain()) {
@@ -135,7 +135,8 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(std::shared_pt
                             << "limit=" << rate_limit_.GetRatePs() << "/sec, "
                             << "url=" << http_request->GetUrl() << ", status_code=" << static_cast<size_t>(status);
 
-        return StartFailsafeTask(std::move(http_request));
+        CompleteWithoutHandler(*http_request);
+        return {};
     }
 
     // config::operator[] && is forbidden, so this
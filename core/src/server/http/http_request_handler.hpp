@@ -46,7 +46,9 @@ public:
     void SetRpsRatelimitStatusCode(HttpStatus status_code);
 
 private:
-    engine::TaskWithResult<void> StartFailsafeTask(std::shared_ptr<http::HttpRequest> http_request) const;
+    // Answers broken and throttled requests right in the connection coroutine,
+    // spawning a task for them is too costly exactly when the load is shed
+    void CompleteWithoutHandler(http::HttpRequest& http_request) const;
 
     logging::TextLoggerPtr logger_access_;
     logging::TextLoggerPtr logger_access_tskv_;
@@ -29,8 +29,11 @@ struct HttpRequest::Impl {
     std::chrono::steady_clock::time_point start_time_;
     std::chrono::steady_clock::time_point task_create_time_;
     std::chrono::steady_clock::time_point task_start_time_;
+    std::chrono::steady_clock::time_point handler_start_time_;
+    std::chrono::steady_clock::time_point handler_finish_time_;
     std::chrono::steady_clock::time_point response_notify_time_;
     std::chrono::steady_clock::time_point start_send_response_time_;
+    mutable std::chrono::steady_clock::time_point response_serialized_time_;
     std::chrono::steady_clock::time_point finish_send_response_time_;
 
     HttpMethod method_{HttpMethod::kUnknown};
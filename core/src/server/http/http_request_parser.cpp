@@ -208,6 +208,9 @@ int HttpRequestParser::OnHeadersCompleteImpl(llhttp_t* p) {
     if (!CheckUrlComplete(p)) return -1;
     try {
         request_constructor_->AppendHeaderField("", 0);
+        if (p->flags & F_CONTENT_LENGTH) {
+            request_constructor_->ReserveBody(p->content_length);
+        }
     } catch (const std::exception& ex) {
         LOG_WARNING() << "can't append header value: " << ex;
         return -1;
@@ -1,5 +1,7 @@
 #include <server/http/http_request_parser.hpp>
 
+#include <fmt/format.h>
+
 #include <server/http/create_parser_test.hpp>
 #include <userver/utest/utest.hpp>
 
@@ -201,6 +203,22 @@ UTEST(HttpRequestParserParser, BodySimple) {
     EXPECT_EQ(parsed, true);
 }
 
+UTEST(HttpRequestParserParser, BodyInChunks) {
+    const std::string body(10000, 'x');
+    const auto request = fmt::format("POST / HTTP/1.1\r\nContent-Length: {}\r\n\r\n{}", body.size(), body);
+
+    bool parsed = false;
+    auto parser = server::CreateTestParser([&](std::shared_ptr<server::http::HttpRequest>&& request) {
+        parsed = true;
+        EXPECT_EQ(request->RequestBody(), body);
+    });
+
+    for (std::size_t pos = 0; pos < request.size(); pos += 1000) {
+        parser->Parse(std::string_view{request}.substr(pos, 1000));
+    }
+    EXPECT_EQ(parsed, true);
+}
+
 // bad requests
 
 namespace {
@@ -19,6 +19,7 @@
 #include <userver/utils/small_string.hpp>
 
 #include <server/http/http_cached_date.hpp>
+#include <server/http/response_body_compressor.hpp>
 
 #include <userver/server/http/http_request.hpp>
 
@@ -286,6 +287,7 @@ void HttpResponse::SendResponse(engine::io::RwBase& socket) {
 
         header.append(kCrlf);
     }
+    request_.SetResponseSerializedTime();
 
     std::size_t sent_bytes{};
 
@@ -389,15 +391,20 @@ void HttpResponse::SetStreamBody() {
         body_stream_producer_.emplace<impl::Http2StreamEventProducer>(GetStreamProducer());
     } else {
         UASSERT(!body_stream_);
-        const auto body_queue = Queue::Create();
-        body_stream_.emplace(body_queue->GetConsumer());
-        body_stream_producer_.emplace<Queue::Producer>(body_queue->GetProducer());
+        body_queue_ = Queue::Create();
+        body_stream_.emplace(body_queue_->GetConsumer());
+        body_stream_producer_.emplace<Queue::Producer>(body_queue_->GetProducer());
     }
     is_stream_body_ = true;
 }
 
 bool HttpResponse::IsBodyStreamed() const { return is_stream_body_; }
 
+void HttpResponse::SetBodyStreamCompressor(std::unique_ptr<impl::ResponseBodyCompressor> compressor) {
+    UASSERT(IsBodyStreamed());
+    body_stream_compressor_ = std::move(compressor);
+}
+
 HttpResponse::Producer HttpResponse::GetBodyProducer() {
     Producer res{};
     std::visit(
@@ -415,6 +422,12 @@ HttpResponse::Producer HttpResponse::GetBodyProducer() {
     return res;
 }
 
+namespace impl {
+
+ResponseBodyCompressor::~ResponseBodyCompressor() = default;
+
+}  // namespace impl
+
 }  // namespace server::http
 
 USERVER_NAMESPACE_END
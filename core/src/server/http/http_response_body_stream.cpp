@@ -1,8 +1,12 @@
 #include <userver/server/http/http_response_body_stream.hpp>
 
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/overloaded.hpp>
 
+#include <server/http/response_body_compressor.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::http {
@@ -14,6 +18,8 @@ ResponseBodyStream::ResponseBodyStream(
     : queue_producer_(std::move(queue_producer)), http_response_(http_response) {}
 
 ResponseBodyStream::~ResponseBodyStream() {
+    FinishCompression();
+
     if (http_response_.GetStreamId().has_value()) {
         UASSERT(queue_producer_.index() == 2);
         std::get<impl::Http2StreamEventProducer>(queue_producer_).CloseStream(*http_response_.GetStreamId());
@@ -22,21 +28,62 @@ ResponseBodyStream::~ResponseBodyStream() {
 
 void ResponseBodyStream::PushBodyChunk(std::string&& chunk, engine::Deadline deadline) {
     UASSERT_MSG(headers_ended_, "SetEndOfHeaders() was not called before PushBodyChunk()");
-    std::visit(
+    if (auto& compressor = http_response_.body_stream_compressor_) {
+        chunk = compressor->Compress(chunk);
+        if (chunk.empty()) return;
+    }
+
+    if (max_buffered_size_ != 0 && chunk.size() > max_buffered_size_) {
+        // A chunk bigger than the queue capacity would never fit into it
+        for (std::size_t pos = 0; pos < chunk.size(); pos += max_buffered_size_) {
+            [[maybe_unused]] const bool success = PushChunk(chunk.substr(pos, max_buffered_size_), deadline);
+            UASSERT(success);
+        }
+        return;
+    }
+
+    [[maybe_unused]] const bool success = PushChunk(std::move(chunk), deadline);
+    UASSERT(success);
+}
+
+void ResponseBodyStream::SetMaxBufferedSize(std::size_t max_size) {
+    UASSERT(max_size != 0);
+    if (auto& queue = http_response_.body_queue_) {
+        queue->SetSoftMaxSize(max_size);
+        max_buffered_size_ = max_size;
+    }
+}
+
+bool ResponseBodyStream::PushChunk(std::string&& chunk, engine::Deadline deadline) {
+    return std::visit(
         utils::Overloaded{
             [&chunk, &deadline](HttpResponse::Queue::Producer& queue_producer) mutable {
-                const bool success = queue_producer.Push(std::move(chunk), deadline);
-                UASSERT(success);
+                return queue_producer.Push(std::move(chunk), deadline);
             },
             [this, &chunk, &deadline](impl::Http2StreamEventProducer& queue_producer) mutable {
                 UASSERT(http_response_.GetStreamId().has_value());
                 queue_producer.PushEvent({*http_response_.GetStreamId(), std::move(chunk)}, deadline);
+                return true;
             },
-            [](std::monostate) { UINVARIANT(false, "unreachable"); }},
+            [](std::monostate) -> bool { UINVARIANT(false, "unreachable"); }},
         queue_producer_
     );
 }
 
+void ResponseBodyStream::FinishCompression() noexcept {
+    auto& compressor = http_response_.body_stream_compressor_;
+    if (!compressor || !headers_ended_) return;
+
+    try {
+        auto tail = compressor->Finish();
+        // The consumer may be already gone if the connection was closed
+        if (!tail.empty()) PushChunk(std::move(tail), engine::Deadline{});
+    } catch (const std::exception& e) {
+        LOG_WARNING() << "Failed to finish the response body compression: " << e;
+    }
+    compressor.reset();
+}
+
 void ResponseBodyStream::SetHeader(const std::string& name, const std::string& value) {
     http_response_.SetHeader(name, value);
 }
@@ -46,6 +93,17 @@ void ResponseBodyStream::SetHeader(std::string_view name, const std::string& val
 }
 
 void ResponseBodyStream::SetEndOfHeaders() {
+    if (auto& compressor = http_response_.body_stream_compressor_) {
+        // The handler compresses the body itself
+        if (http_response_.HasHeader(USERVER_NAMESPACE::http::headers::kContentEncoding)) {
+            compressor.reset();
+        } else {
+            http_response_.SetHeader(
+                USERVER_NAMESPACE::http::headers::kContentEncoding, std::string{compressor->GetContentEncoding()}
+            );
+        }
+    }
+
     headers_ended_ = true;
     http_response_.SetHeadersEnd();
 }
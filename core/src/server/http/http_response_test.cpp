@@ -41,6 +41,17 @@ UTEST(HttpResponse, Smoke) {
     EXPECT_EQ(reply.substr(reply.size() - 4 - kBody.size()), fmt::format("\r\n\r\n{}", kBody));
 }
 
+UTEST(HttpResponse, StageTimingsOfUnprocessedRequest) {
+    server::request::ResponseDataAccounter accounter;
+    const auto request = server::http::HttpRequestBuilder{accounter}.Build();
+
+    for (const auto timing : request->GetStageTimings()) {
+        EXPECT_EQ(timing, std::chrono::microseconds::zero());
+    }
+    EXPECT_EQ(server::http::ToString(server::http::RequestStage::kParse), "parse");
+    EXPECT_EQ(server::http::ToString(server::http::RequestStage::kResponseWait), "response_wait");
+}
+
 UTEST(HttpResponse, AccounterLifetimeIfNotSent) {
     auto accounter = std::make_unique<server::request::ResponseDataAccounter>();
     const auto request = server::http::HttpRequestBuilder{*accounter}.Build();
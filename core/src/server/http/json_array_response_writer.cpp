@@ -0,0 +1,38 @@
+#include <userver/server/http/json_array_response_writer.hpp>
+
+#include <userver/server/http/http_response_body_stream.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+JsonArrayResponseWriter::JsonArrayResponseWriter(ResponseBodyStream& stream, engine::Deadline deadline)
+    : JsonArrayResponseWriter(stream, deadline, Settings{}) {}
+
+JsonArrayResponseWriter::JsonArrayResponseWriter(
+    ResponseBodyStream& stream,
+    engine::Deadline deadline,
+    Settings settings
+)
+    : stream_(stream), deadline_(deadline), settings_(settings) {
+    UASSERT(settings_.chunk_size != 0);
+    if (settings_.max_buffered_size != 0) stream_.SetMaxBufferedSize(settings_.max_buffered_size);
+    array_guard_.emplace(builder_);
+}
+
+JsonArrayResponseWriter::~JsonArrayResponseWriter() = default;
+
+void JsonArrayResponseWriter::Finish() {
+    UASSERT_MSG(array_guard_.has_value(), "Finish() is called twice");
+    array_guard_.reset();
+    Flush();
+}
+
+void JsonArrayResponseWriter::Flush() {
+    auto chunk = builder_.ExtractBufferedString();
+    if (!chunk.empty()) stream_.PushBodyChunk(std::move(chunk), deadline_);
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -16,6 +16,8 @@ class RequestHandlerBase {
 public:
     virtual ~RequestHandlerBase() noexcept;
 
+    /// Returns an invalid task if the response was completed in place, without
+    /// spawning a task, e.g. for a throttled request
     virtual engine::TaskWithResult<void> StartRequestTask(std::shared_ptr<http::HttpRequest> request) const = 0;
 
     virtual const HandlerInfoIndex& GetHandlerInfoIndex() const = 0;
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+/// Compresses the chunks of a streamed response body
+class ResponseBodyCompressor {
+public:
+    virtual ~ResponseBodyCompressor();
+
+    /// Value for the Content-Encoding header
+    virtual std::string_view GetContentEncoding() const noexcept = 0;
+
+    /// Returns the data to send for the chunk, it may be empty
+    virtual std::string Compress(std::string_view chunk) = 0;
+
+    /// Returns the end of the compressed stream
+    virtual std::string Finish() = 0;
+};
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
@@ -2,36 +2,41 @@
 
 #include <stdexcept>
 
-#include <boost/algorithm/string/split.hpp>
-
 USERVER_NAMESPACE_BEGIN
 
 namespace server::http::impl {
 namespace {
 
-const std::string kAnySuffixMark{"*"};
+constexpr std::string_view kAnySuffixMark{"*"};
 
 constexpr char kWildcardStart = '{';
 constexpr char kWildcardFinish = '}';
 
-std::vector<std::string> SplitBySlash(const std::string& path) {
-    std::vector<std::string> path_vec;
-    boost::split(path_vec, path, [](char c) { return c == '/'; });
-    return path_vec;
+// "/a/b/" is split into "", "a", "b", ""
+WildcardPathIndex::PathSegments SplitBySlash(std::string_view path) {
+    WildcardPathIndex::PathSegments segments;
+    std::size_t segment_begin = 0;
+    while (true) {
+        const auto slash_pos = path.find('/', segment_begin);
+        segments.push_back(path.substr(segment_begin, slash_pos - segment_begin));
+        if (slash_pos == std::string_view::npos) break;
+        segment_begin = slash_pos + 1;
+    }
+    return segments;
 }
 
-std::string ExtractWildcardName(const std::string& str) {
+std::string ExtractWildcardName(std::string_view str) {
     if (str.empty() || str.front() != kWildcardStart || str.back() != kWildcardFinish) {
-        throw std::runtime_error("Incorrect wildcard '" + str + '\'');
+        throw std::runtime_error("Incorrect wildcard '" + std::string{str} + '\'');
     }
 
-    return str.substr(1, str.size() - 2);
+    return std::string{str.substr(1, str.size() - 2)};
 }
 
 bool GetFromHandlerMethodIndex(
     const WildcardPathIndex::Node& node,
     HttpMethod method,
-    const std::vector<std::string>& path,
+    const WildcardPathIndex::PathSegments& path,
     MatchRequestResult& match_result,
     bool limit_path_length
 ) {
@@ -60,7 +65,9 @@ bool GetFromHandlerMethodIndex(
                 "matched path from handler has length greater than path from "
                 "request"
             );
-        match_result.args_from_path.emplace_back(arg.name, arg.index == path.size() ? std::string{} : path[arg.index]);
+        match_result.args_from_path.emplace_back(
+            arg.name, arg.index == path.size() ? std::string{} : std::string{path[arg.index]}
+        );
     }
     match_result.status = MatchRequestResult::Status::kOk;
     return true;
@@ -68,8 +75,8 @@ bool GetFromHandlerMethodIndex(
 
 }  // namespace
 
-bool HasWildcardSpecificSymbols(const std::string& path) {
-    return path.find(kWildcardStart) != std::string::npos || path.find(kWildcardFinish) != std::string::npos;
+bool HasWildcardSpecificSymbols(std::string_view path) {
+    return path.find(kWildcardStart) != std::string_view::npos || path.find(kWildcardFinish) != std::string_view::npos;
 }
 
 void WildcardPathIndex::AddHandler(const handlers::HttpHandlerBase& handler, engine::TaskProcessor& task_processor) {
@@ -112,14 +119,14 @@ void WildcardPathIndex::AddHandler(
     const handlers::HttpHandlerBase& handler,
     engine::TaskProcessor& task_processor
 ) {
-    auto path_vec = SplitBySlash(path);
+    const auto path_vec = SplitBySlash(path);
     std::vector<PathItem> path_fixed_items;
     std::vector<PathItem> path_wildcards;
     std::unordered_set<std::string> wildcard_names;
     try {
         for (size_t i = 0; i < path_vec.size(); i++) {
             if (!HasWildcardSpecificSymbols(path_vec[i])) {
-                path_fixed_items.emplace_back(ExtractFixedPathItem(i, std::move(path_vec[i])));
+                path_fixed_items.emplace_back(ExtractFixedPathItem(i, std::string{path_vec[i]}));
             } else {
                 path_wildcards.emplace_back(ExtractWildcardPathItem(i, path_vec[i], wildcard_names));
             }
@@ -147,7 +154,7 @@ void WildcardPathIndex::AddPath(
 bool WildcardPathIndex::MatchRequest(
     const Node& node,
     HttpMethod method,
-    const std::vector<std::string>& path,
+    const PathSegments& path,
     size_t path_string_length,
     MatchRequestResult& match_result
 ) const {
@@ -178,7 +185,7 @@ bool WildcardPathIndex::MatchRequest(
                     match_result.matched_path_length += path[i].size();
                 }
                 for (size_t i = asterisk_pos; i < path.size(); i++) {
-                    match_result.args_from_path.emplace_back(std::string{}, path[i]);
+                    match_result.args_from_path.emplace_back(std::string{}, std::string{path[i]});
                 }
                 return true;
             }
@@ -194,7 +201,7 @@ PathItem WildcardPathIndex::ExtractFixedPathItem(size_t index, std::string&& pat
 
 PathItem WildcardPathIndex::ExtractWildcardPathItem(
     size_t index,
-    const std::string& path_elem,
+    std::string_view path_elem,
     std::unordered_set<std::string>& wildcard_names
 ) {
     auto wildcard_name = ExtractWildcardName(path_elem);
@@ -1,10 +1,14 @@
 #pragma once
 
+#include <functional>
 #include <map>
 #include <string>
+#include <string_view>
 #include <unordered_set>
 #include <vector>
 
+#include <boost/container/small_vector.hpp>
+
 #include <userver/engine/task/task_processor_fwd.hpp>
 
 #include <server/http/handler_info_index.hpp>
@@ -16,13 +20,16 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::http::impl {
 
-bool HasWildcardSpecificSymbols(const std::string& path);
+bool HasWildcardSpecificSymbols(std::string_view path);
 
 class WildcardPathIndex final {
 public:
+    // Views into the request path, most of the paths fit without allocations
+    using PathSegments = boost::container::small_vector<std::string_view, 16>;
+
     struct Node {
         // ordered by position in path
-        std::map<size_t, std::map<std::string, Node>> next;
+        std::map<size_t, std::map<std::string, Node, std::less<>>> next;
 
         // by path length
         std::map<size_t, HandlerMethodIndex> handler_method_index_map;
@@ -49,7 +56,7 @@ private:
     bool MatchRequest(
         const Node& node,
         HttpMethod method,
-        const std::vector<std::string>& path,
+        const PathSegments& path,
         size_t path_string_length,
         MatchRequestResult& match_result
     ) const;
@@ -58,7 +65,7 @@ private:
 
     static PathItem ExtractWildcardPathItem(
         size_t index,
-        const std::string& path_elem,
+        std::string_view path_elem,
         std::unordered_set<std::string>& wildcard_names
     );
 
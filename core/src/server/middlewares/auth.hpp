@@ -21,6 +21,8 @@ public:
 private:
     void HandleRequest(http::HttpRequest& request, request::RequestContext& context) const override;
 
+    bool IsPassThrough() const noexcept override;
+
     bool CheckAuth(const http::HttpRequest& request, request::RequestContext& context) const;
 
     const handlers::HttpHandlerBase& handler_;
@@ -0,0 +1,365 @@
+#include <server/middlewares/compression.hpp>
+
+#include <chrono>
+
+#include <compression/gzip.hpp>
+#include <userver/compression/zstd.hpp>
+
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/utils/str_icase.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <server/http/response_body_compressor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+namespace impl {
+
+namespace {
+
+// Ordered by preference on equal weights
+constexpr std::array<ContentEncoding, kContentEncodingsCount> kContentEncodings{
+    ContentEncoding::kZstd,
+    ContentEncoding::kGzip,
+};
+
+std::string_view Trim(std::string_view str) noexcept {
+    while (!str.empty() && (str.front() == ' ' || str.front() == '\t')) str.remove_prefix(1);
+    while (!str.empty() && (str.back() == ' ' || str.back() == '\t')) str.remove_suffix(1);
+    return str;
+}
+
+// Returns the weight in thousandths, RFC 9110 12.4.2
+int ParseQuality(std::string_view params) noexcept {
+    while (!params.empty()) {
+        const auto separator_pos = params.find(';');
+        const auto param = Trim(params.substr(0, separator_pos));
+        params = separator_pos == std::string_view::npos ? std::string_view{} : params.substr(separator_pos + 1);
+
+        if (param.size() < 2 || (param[0] != 'q' && param[0] != 'Q') || param[1] != '=') continue;
+
+        const auto value = param.substr(2);
+        if (value.empty() || value[0] != '0') return 1000;  // "1", "1.0", malformed
+
+        int quality = 0;
+        int scale = 100;
+        for (std::size_t i = 2; i < value.size() && scale > 0; ++i, scale /= 10) {
+            if (value[i] < '0' || value[i] > '9') break;
+            quality += (value[i] - '0') * scale;
+        }
+        return quality;
+    }
+    return 1000;
+}
+
+}  // namespace
+
+std::string_view ToString(ContentEncoding encoding) noexcept {
+    switch (encoding) {
+        case ContentEncoding::kGzip:
+            return "gzip";
+        case ContentEncoding::kZstd:
+            return "zstd";
+    }
+    return "unknown";
+}
+
+std::optional<ContentEncoding> NegotiateContentEncoding(std::string_view accept_encoding) {
+    std::array<std::optional<int>, kContentEncodingsCount> qualities{};
+    std::optional<int> wildcard_quality;
+
+    while (!accept_encoding.empty()) {
+        const auto separator_pos = accept_encoding.find(',');
+        const auto item = Trim(accept_encoding.substr(0, separator_pos));
+        accept_encoding = separator_pos == std::string_view::npos ? std::string_view{}
+                                                                  : accept_encoding.substr(separator_pos + 1);
+
+        const auto params_pos = item.find(';');
+        const auto coding = Trim(item.substr(0, params_pos));
+        const auto quality =
+            params_pos == std::string_view::npos ? 1000 : ParseQuality(item.substr(params_pos + 1));
+
+        if (coding == "*") {
+            wildcard_quality = quality;
+            continue;
+        }
+        for (const auto encoding : kContentEncodings) {
+            if (utils::StrIcaseEqual{}(coding, ToString(encoding))) {
+                qualities[static_cast<std::size_t>(encoding)] = quality;
+            }
+        }
+    }
+
+    std::optional<ContentEncoding> result;
+    int best_quality = 0;
+    for (const auto encoding : kContentEncodings) {
+        const auto quality = qualities[static_cast<std::size_t>(encoding)].value_or(wildcard_quality.value_or(0));
+        if (quality > best_quality) {
+            best_quality = quality;
+            result = encoding;
+        }
+    }
+    return result;
+}
+
+}  // namespace impl
+
+namespace {
+
+utils::statistics::Rate ElapsedUs(std::chrono::steady_clock::time_point start) noexcept {
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return utils::statistics::Rate{
+        static_cast<utils::statistics::Rate::ValueType>(
+            std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()
+        )};
+}
+
+template <typename StreamCompressor>
+class StreamBodyCompressor final : public http::impl::ResponseBodyCompressor {
+public:
+    StreamBodyCompressor(impl::ContentEncoding encoding, int level, CompressionStatistics& statistics)
+        : encoding_(encoding), compressor_(level), statistics_(statistics) {
+        ++statistics_.responses;
+    }
+
+    std::string_view GetContentEncoding() const noexcept override { return impl::ToString(encoding_); }
+
+    std::string Compress(std::string_view chunk) override {
+        return Account(chunk.size(), [&] { return compressor_.Compress(chunk); });
+    }
+
+    std::string Finish() override {
+        return Account(0, [&] { return compressor_.Finish(); });
+    }
+
+private:
+    template <typename Func>
+    std::string Account(std::size_t original_size, Func func) {
+        const auto start = std::chrono::steady_clock::now();
+        auto compressed = func();
+        statistics_.cpu_time_us += ElapsedUs(start);
+        statistics_.original_bytes += utils::statistics::Rate{original_size};
+        statistics_.compressed_bytes += utils::statistics::Rate{compressed.size()};
+        return compressed;
+    }
+
+    const impl::ContentEncoding encoding_;
+    StreamCompressor compressor_;
+    CompressionStatistics& statistics_;
+};
+
+bool IsBodyCompressible(const http::HttpResponse& response) {
+    const auto status = static_cast<int>(response.GetStatus());
+    // No body, or the body is a part of the representation
+    if (status < 200 || status == 204 || status == 206 || status == 304) return false;
+    return !response.HasHeader(USERVER_NAMESPACE::http::headers::kContentEncoding);
+}
+
+bool ContainsAcceptEncoding(std::string_view vary) {
+    while (!vary.empty()) {
+        const auto separator_pos = vary.find(',');
+        if (utils::StrIcaseEqual{}(impl::Trim(vary.substr(0, separator_pos)), "Accept-Encoding")) return true;
+        vary = separator_pos == std::string_view::npos ? std::string_view{} : vary.substr(separator_pos + 1);
+    }
+    return false;
+}
+
+void AddVaryAcceptEncoding(http::HttpResponse& response) {
+    const auto& vary = response.GetHeader(USERVER_NAMESPACE::http::headers::kVary);
+    if (vary.empty()) {
+        response.SetHeader(USERVER_NAMESPACE::http::headers::kVary, std::string{"Accept-Encoding"});
+    } else if (vary != "*" && !ContainsAcceptEncoding(vary)) {
+        response.SetHeader(USERVER_NAMESPACE::http::headers::kVary, vary + ", Accept-Encoding");
+    }
+}
+
+CompressionSettings ParseSettings(const yaml_config::YamlConfig& value, const CompressionSettings& defaults) {
+    CompressionSettings settings = defaults;
+    settings.enabled = value["enabled"].As<bool>(settings.enabled);
+    settings.min_size = value["min-size"].As<std::size_t>(settings.min_size);
+    settings.gzip_level = value["gzip-level"].As<int>(settings.gzip_level);
+    settings.zstd_level = value["zstd-level"].As<int>(settings.zstd_level);
+    return settings;
+}
+
+}  // namespace
+
+Compression::Compression(
+    const handlers::HttpHandlerBase& handler,
+    const CompressionSettings& settings,
+    utils::statistics::Storage& statistics_storage
+)
+    : settings_(settings), statistics_(std::make_unique<Statistics>()) {
+    if (!settings_.enabled) return;
+
+    statistics_holder_ = statistics_storage.RegisterWriter(
+        "http.handler.response-compression",
+        [this](utils::statistics::Writer& writer) {
+            for (const auto encoding : impl::kContentEncodings) {
+                const auto& stats = (*statistics_)[static_cast<std::size_t>(encoding)];
+                const utils::statistics::LabelView label{"content_encoding", impl::ToString(encoding)};
+                writer["responses"].ValueWithLabels(stats.responses.Load(), label);
+                writer["original-bytes"].ValueWithLabels(stats.original_bytes.Load(), label);
+                writer["compressed-bytes"].ValueWithLabels(stats.compressed_bytes.Load(), label);
+                writer["cpu-time-us"].ValueWithLabels(stats.cpu_time_us.Load(), label);
+            }
+        },
+        {{"http_handler", handler.HandlerName()}}
+    );
+}
+
+Compression::~Compression() { statistics_holder_.Unregister(); }
+
+void Compression::HandleRequest(http::HttpRequest& request, request::RequestContext& context) const {
+    if (!settings_.enabled) {
+        Next(request, context);
+        return;
+    }
+
+    const auto encoding =
+        impl::NegotiateContentEncoding(request.GetHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding));
+    auto& response = request.GetHttpResponse();
+
+    if (encoding && response.IsBodyStreamed()) {
+        SetStreamCompressor(response, *encoding);
+    }
+
+    Next(request, context);
+
+    if (response.IsBodyStreamed() && response.GetData().empty()) {
+        // The headers are sent already
+        return;
+    }
+    if (!IsBodyCompressible(response) || response.GetData().size() < settings_.min_size) {
+        return;
+    }
+
+    AddVaryAcceptEncoding(response);
+    if (encoding) {
+        CompressResponseBody(response, *encoding);
+    }
+}
+
+bool Compression::IsPassThrough() const noexcept { return !settings_.enabled; }
+
+void Compression::CompressResponseBody(http::HttpResponse& response, impl::ContentEncoding encoding) const {
+    const auto& data = response.GetData();
+    auto& stats = (*statistics_)[static_cast<std::size_t>(encoding)];
+
+    const auto start = std::chrono::steady_clock::now();
+    auto compressed = encoding == impl::ContentEncoding::kZstd
+                          ? compression::zstd::Compress(data, settings_.zstd_level)
+                          : compression::gzip::Compress(data, settings_.gzip_level);
+    stats.cpu_time_us += ElapsedUs(start);
+
+    // Already compressed data, e.g. images
+    if (compressed.size() >= data.size()) return;
+
+    ++stats.responses;
+    stats.original_bytes += utils::statistics::Rate{data.size()};
+    stats.compressed_bytes += utils::statistics::Rate{compressed.size()};
+
+    response.SetData(std::move(compressed));
+    response.SetContentEncoding(std::string{impl::ToString(encoding)});
+}
+
+void Compression::SetStreamCompressor(http::HttpResponse& response, impl::ContentEncoding encoding) const {
+    auto& stats = (*statistics_)[static_cast<std::size_t>(encoding)];
+    if (encoding == impl::ContentEncoding::kZstd) {
+        response.SetBodyStreamCompressor(
+            std::make_unique<StreamBodyCompressor<compression::zstd::StreamCompressor>>(
+                encoding, settings_.zstd_level, stats
+            )
+        );
+    } else {
+        response.SetBodyStreamCompressor(
+            std::make_unique<StreamBodyCompressor<compression::gzip::StreamCompressor>>(
+                encoding, settings_.gzip_level, stats
+            )
+        );
+    }
+}
+
+CompressionFactory::CompressionFactory(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context
+)
+    : HttpMiddlewareFactoryBase(config, context),
+      defaults_(ParseSettings(
+          config,
+          CompressionSettings{
+              /*enabled=*/false,
+              /*min_size=*/1024,
+              compression::gzip::kDefaultCompressionLevel,
+              compression::zstd::kDefaultCompressionLevel,
+          }
+      )),
+      statistics_storage_(context.FindComponent<components::StatisticsStorage>().GetStorage()) {}
+
+std::unique_ptr<HttpMiddlewareBase>
+CompressionFactory::Create(const handlers::HttpHandlerBase& handler, yaml_config::YamlConfig middleware_config) const {
+    return std::make_unique<Compression>(handler, ParseSettings(middleware_config, defaults_), statistics_storage_);
+}
+
+yaml_config::Schema CompressionFactory::GetMiddlewareConfigSchema() const {
+    return yaml_config::impl::SchemaFromString(R"(
+type: object
+description: per-handler overrides of the response compression settings
+additionalProperties: false
+properties:
+    enabled:
+        type: boolean
+        description: compress the responses of the handler
+    min-size:
+        type: integer
+        description: do not compress the bodies that are smaller, in bytes
+    gzip-level:
+        type: integer
+        description: gzip compression level, 1 to 9
+    zstd-level:
+        type: integer
+        description: zstd compression level, 1 to 19
+)");
+}
+
+yaml_config::Schema CompressionFactory::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<HttpMiddlewareFactoryBase>(R"(
+type: object
+description: |
+    Compresses the response bodies with the coding negotiated via the
+    Accept-Encoding request header. Both the usual and the streamed
+    responses are supported.
+additionalProperties: false
+properties:
+    enabled:
+        type: boolean
+        description: compress the responses by default, may be overridden per handler
+        defaultDescription: false
+    min-size:
+        type: integer
+        description: do not compress the bodies that are smaller, in bytes; not applied to the streamed responses
+        defaultDescription: 1024
+    gzip-level:
+        type: integer
+        description: gzip compression level, 1 to 9
+        defaultDescription: 4
+    zstd-level:
+        type: integer
+        description: zstd compression level, 1 to 19
+        defaultDescription: 3
+)");
+}
+
+}  // namespace server::middlewares
+
+USERVER_NAMESPACE_END
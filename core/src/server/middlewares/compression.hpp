@@ -0,0 +1,110 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+#include <userver/server/middlewares/builtin.hpp>
+#include <userver/server/middlewares/http_middleware_base.hpp>
+#include <userver/utils/statistics/entry.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+class Storage;
+}
+
+namespace server::http {
+class HttpResponse;
+}
+
+namespace server::middlewares {
+
+namespace impl {
+
+enum class ContentEncoding {
+    kGzip,
+    kZstd,
+};
+
+inline constexpr std::size_t kContentEncodingsCount = 2;
+
+std::string_view ToString(ContentEncoding encoding) noexcept;
+
+/// Picks the preferred supported coding from an Accept-Encoding header value
+std::optional<ContentEncoding> NegotiateContentEncoding(std::string_view accept_encoding);
+
+}  // namespace impl
+
+struct CompressionSettings final {
+    bool enabled{false};
+    // Small bodies are not worth the CPU and usually do not shrink much
+    std::size_t min_size{1024};
+    int gzip_level;
+    int zstd_level;
+};
+
+struct CompressionStatistics final {
+    utils::statistics::RateCounter responses;
+    utils::statistics::RateCounter original_bytes;
+    utils::statistics::RateCounter compressed_bytes;
+    utils::statistics::RateCounter cpu_time_us;
+};
+
+class Compression final : public HttpMiddlewareBase {
+public:
+    static constexpr std::string_view kName = builtin::kCompression;
+
+    Compression(
+        const handlers::HttpHandlerBase& handler,
+        const CompressionSettings& settings,
+        utils::statistics::Storage& statistics_storage
+    );
+    ~Compression() override;
+
+private:
+    using Statistics = std::array<CompressionStatistics, impl::kContentEncodingsCount>;
+
+    void HandleRequest(http::HttpRequest& request, request::RequestContext& context) const override;
+
+    bool IsPassThrough() const noexcept override;
+
+    void CompressResponseBody(http::HttpResponse& response, impl::ContentEncoding encoding) const;
+
+    void SetStreamCompressor(http::HttpResponse& response, impl::ContentEncoding encoding) const;
+
+    const CompressionSettings settings_;
+    std::unique_ptr<Statistics> statistics_;
+    utils::statistics::Entry statistics_holder_;
+};
+
+class CompressionFactory final : public HttpMiddlewareFactoryBase {
+public:
+    static constexpr std::string_view kName = Compression::kName;
+
+    CompressionFactory(const components::ComponentConfig&, const components::ComponentContext&);
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    yaml_config::Schema GetMiddlewareConfigSchema() const override;
+
+    std::unique_ptr<HttpMiddlewareBase> Create(const handlers::HttpHandlerBase&, yaml_config::YamlConfig)
+        const override;
+
+    const CompressionSettings defaults_;
+    utils::statistics::Storage& statistics_storage_;
+};
+
+}  // namespace server::middlewares
+
+template <>
+inline constexpr bool components::kHasValidate<server::middlewares::CompressionFactory> = true;
+
+template <>
+inline constexpr auto components::kConfigFileMode<server::middlewares::CompressionFactory> =
+    ConfigFileMode::kNotRequired;
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,25 @@
+#include <server/middlewares/compression.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+using server::middlewares::impl::ContentEncoding;
+using server::middlewares::impl::NegotiateContentEncoding;
+
+TEST(CompressionMiddleware, NegotiateContentEncoding) {
+    EXPECT_EQ(NegotiateContentEncoding(""), std::nullopt);
+    EXPECT_EQ(NegotiateContentEncoding("identity"), std::nullopt);
+    EXPECT_EQ(NegotiateContentEncoding("gzip"), ContentEncoding::kGzip);
+    EXPECT_EQ(NegotiateContentEncoding("GZip"), ContentEncoding::kGzip);
+    EXPECT_EQ(NegotiateContentEncoding("zstd"), ContentEncoding::kZstd);
+    EXPECT_EQ(NegotiateContentEncoding("gzip, deflate, br, zstd"), ContentEncoding::kZstd);
+    EXPECT_EQ(NegotiateContentEncoding("gzip;q=1.0, zstd;q=0.5"), ContentEncoding::kGzip);
+    EXPECT_EQ(NegotiateContentEncoding("gzip; q=0.8 , zstd;q=0.85"), ContentEncoding::kZstd);
+    EXPECT_EQ(NegotiateContentEncoding("gzip;q=0"), std::nullopt);
+    EXPECT_EQ(NegotiateContentEncoding("*"), ContentEncoding::kZstd);
+    EXPECT_EQ(NegotiateContentEncoding("*, zstd;q=0"), ContentEncoding::kGzip);
+    EXPECT_EQ(NegotiateContentEncoding("*;q=0"), std::nullopt);
+}
+
+USERVER_NAMESPACE_END
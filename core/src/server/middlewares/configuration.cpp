@@ -8,6 +8,7 @@
 
 #include <server/middlewares/auth.hpp>
 #include <server/middlewares/baggage.hpp>
+#include <server/middlewares/compression.hpp>
 #include <server/middlewares/deadline_propagation.hpp>
 #include <server/middlewares/decompression.hpp>
 #include <server/middlewares/exceptions_handling.hpp>
@@ -30,6 +31,9 @@ MiddlewaresList DefaultPipeline() {
         std::string{builtin::kTracing},
         // Ditto
         std::string{builtin::kSetAcceptEncoding},
+        // Compresses the final response, including the ones produced by
+        // exception handling below
+        std::string{builtin::kCompression},
 
         // Every exception caught here is transformed into Http500 without
         // context.
@@ -68,6 +72,7 @@ components::ComponentList DefaultMiddlewareComponents() {
         .Append<DeadlinePropagationFactory>()
         .Append<DecompressionFactory>()
         .Append<SetAcceptEncodingFactory>()
+        .Append<CompressionFactory>()
         .Append<ExceptionsHandlingFactory>()
         .Append<UnknownExceptionsHandlingFactory>()
         .Append<testsuite::ExceptionsHandlingMiddlewareFactory>();
@@ -33,6 +33,8 @@ void Decompression::HandleRequest(http::HttpRequest& request, request::RequestCo
     }
 }
 
+bool Decompression::IsPassThrough() const noexcept { return !decompress_request_; }
+
 bool Decompression::DecompressRequestBody(http::HttpRequest& request) const {
     if (!decompress_request_ || !request.IsBodyCompressed()) {
         return true;
@@ -90,6 +92,8 @@ void SetAcceptEncoding::HandleRequest(http::HttpRequest& request, request::Reque
     Next(request, context);
 }
 
+bool SetAcceptEncoding::IsPassThrough() const noexcept { return !decompress_request_; }
+
 void SetAcceptEncoding::SetResponseAcceptEncoding(http::HttpResponse& response) const {
     if (!decompress_request_) return;
 
@@ -6,11 +6,55 @@
 #include <userver/server/handlers/exceptions.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/server/http/http_status.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace server::middlewares {
 
+namespace impl {
+
+USERVER_NAMESPACE::congestion_control::v2::Sensor::Data InFlightSensor::GetCurrent() {
+    Data result;
+    result.total = finished_.exchange(0);
+    const auto timings_sum_ms = timings_sum_ms_.exchange(0);
+    result.timings_avg_ms = result.total ? timings_sum_ms / result.total : 0;
+    result.current_load = GetInFlight();
+    return result;
+}
+
+void InFlightSensor::OnRequestStarted() noexcept { ++in_flight_; }
+
+void InFlightSensor::OnRequestFinished(std::chrono::steady_clock::duration timing) noexcept {
+    --in_flight_;
+    timings_sum_ms_ += static_cast<std::size_t>(std::chrono::duration_cast<std::chrono::milliseconds>(timing).count());
+    ++finished_;
+}
+
+std::size_t InFlightSensor::GetInFlight() const noexcept { return in_flight_.load(); }
+
+void InFlightLimiter::SetLimit(const USERVER_NAMESPACE::congestion_control::Limit& limit) {
+    limit_ = limit.load_limit.value_or(kNoLimit);
+}
+
+std::optional<std::size_t> InFlightLimiter::GetLimit() const noexcept {
+    const auto limit = limit_.load();
+    if (limit == kNoLimit) return std::nullopt;
+    return limit;
+}
+
+AdaptiveInFlightLimit::AdaptiveInFlightLimit(
+    const std::string& handler_name,
+    const USERVER_NAMESPACE::congestion_control::v2::GradientConfig& config
+)
+    : controller_(handler_name, sensor_, limiter_, stats_, config) {
+    controller_.Start();
+}
+
+AdaptiveInFlightLimit::~AdaptiveInFlightLimit() { controller_.Stop(); }
+
+}  // namespace impl
+
 RateLimit::RateLimit(const handlers::HttpHandlerBase& handler)
     : rate_limit_{utils::TokenBucket::MakeUnbounded()},
       statistics_{handler.GetHandlerStatistics()},
@@ -23,12 +67,34 @@ RateLimit::RateLimit(const handlers::HttpHandlerBase& handler)
         rate_limit_.SetMaxSize(max_rps);
         rate_limit_.SetRefillPolicy({1, utils::TokenBucket::Duration{std::chrono::seconds(1)} / max_rps});
     }
+
+    const auto& adaptive_config = handler.GetConfig().adaptive_concurrency_limit;
+    if (adaptive_config.has_value()) {
+        adaptive_limit_ = std::make_unique<impl::AdaptiveInFlightLimit>(
+            fmt::format("handler-{}", handler.HandlerName()), *adaptive_config
+        );
+    }
 }
 
 void RateLimit::HandleRequest(http::HttpRequest& request, request::RequestContext& context) const {
-    if (CheckRateLimit(request)) {
+    if (!CheckRateLimit(request)) return;
+
+    if (!adaptive_limit_) {
         Next(request, context);
+        return;
     }
+
+    auto& sensor = adaptive_limit_->GetSensor();
+    sensor.OnRequestStarted();
+    const auto start = std::chrono::steady_clock::now();
+    const utils::FastScopeGuard finish_guard{[&sensor, start]() noexcept {
+        sensor.OnRequestFinished(std::chrono::steady_clock::now() - start);
+    }};
+    Next(request, context);
+}
+
+bool RateLimit::IsPassThrough() const noexcept {
+    return !max_requests_per_second_ && !max_requests_in_flight_ && !adaptive_limit_;
 }
 
 bool RateLimit::CheckRateLimit(const http::HttpRequest& request) const {
@@ -66,6 +132,22 @@ bool RateLimit::CheckRateLimit(const http::HttpRequest& request) const {
         return false;
     }
 
+    const auto adaptive_limit = adaptive_limit_ ? adaptive_limit_->GetLimiter().GetLimit() : std::nullopt;
+    if (adaptive_limit && adaptive_limit_->GetSensor().GetInFlight() >= *adaptive_limit) {
+        auto& http_response = request.GetHttpResponse();
+        auto log_reason = fmt::format("reached adaptive max_requests_in_flight={}", *adaptive_limit);
+        SetThrottleReason(
+            http_response,
+            std::move(log_reason),
+            std::string{USERVER_NAMESPACE::http::headers::ratelimit_reason::kInFlight}
+        );
+
+        statistics.IncrementTooManyRequestsInFlight();
+
+        FailProcessingAndSetResponse(request);
+        return false;
+    }
+
     return true;
 }
 
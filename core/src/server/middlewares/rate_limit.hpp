@@ -1,7 +1,12 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <memory>
 #include <optional>
 
+#include <userver/congestion_control/controllers/gradient.hpp>
 #include <userver/server/middlewares/builtin.hpp>
 #include <userver/server/middlewares/http_middleware_base.hpp>
 #include <userver/utils/token_bucket.hpp>
@@ -14,6 +19,58 @@ class HttpHandlerStatistics;
 
 namespace server::middlewares {
 
+namespace impl {
+
+/// Requests in flight and timings of the handler for the adaptive limit
+class InFlightSensor final : public USERVER_NAMESPACE::congestion_control::v2::Sensor {
+public:
+    Data GetCurrent() override;
+
+    void OnRequestStarted() noexcept;
+    void OnRequestFinished(std::chrono::steady_clock::duration timing) noexcept;
+
+    std::size_t GetInFlight() const noexcept;
+
+private:
+    std::atomic<std::size_t> in_flight_{0};
+    std::atomic<std::size_t> finished_{0};
+    std::atomic<std::size_t> timings_sum_ms_{0};
+};
+
+class InFlightLimiter final : public USERVER_NAMESPACE::congestion_control::Limiter {
+public:
+    void SetLimit(const USERVER_NAMESPACE::congestion_control::Limit& limit) override;
+
+    std::optional<std::size_t> GetLimit() const noexcept;
+
+private:
+    static constexpr std::size_t kNoLimit = std::numeric_limits<std::size_t>::max();
+
+    std::atomic<std::size_t> limit_{kNoLimit};
+};
+
+/// Adjusts the in-flight requests limit of the handler by
+/// congestion_control::v2::GradientController
+class AdaptiveInFlightLimit final {
+public:
+    AdaptiveInFlightLimit(
+        const std::string& handler_name,
+        const USERVER_NAMESPACE::congestion_control::v2::GradientConfig& config
+    );
+    ~AdaptiveInFlightLimit();
+
+    InFlightSensor& GetSensor() noexcept { return sensor_; }
+    const InFlightLimiter& GetLimiter() const noexcept { return limiter_; }
+
+private:
+    InFlightSensor sensor_;
+    InFlightLimiter limiter_;
+    USERVER_NAMESPACE::congestion_control::v2::Stats stats_;
+    USERVER_NAMESPACE::congestion_control::v2::GradientController controller_;
+};
+
+}  // namespace impl
+
 class RateLimit final : public HttpMiddlewareBase {
 public:
     static constexpr std::string_view kName = builtin::kRateLimit;
@@ -23,6 +80,8 @@ public:
 private:
     void HandleRequest(http::HttpRequest& request, request::RequestContext& context) const override;
 
+    bool IsPassThrough() const noexcept override;
+
     bool CheckRateLimit(const http::HttpRequest& request) const;
 
     void FailProcessingAndSetResponse(const http::HttpRequest& request) const;
@@ -32,6 +91,7 @@ private:
 
     std::optional<std::size_t> max_requests_per_second_;
     std::optional<std::size_t> max_requests_in_flight_;
+    std::unique_ptr<impl::AdaptiveInFlightLimit> adaptive_limit_;
 
     const handlers::HttpHandlerBase& handler_;
 };
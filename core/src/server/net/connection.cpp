@@ -21,6 +21,7 @@
 #include <userver/server/request/request_config.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
+#include <userver/utils/impl/usdt.hpp>
 #include <userver/utils/text_light.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -30,6 +31,14 @@ namespace server::net {
 namespace {
 constexpr std::string_view kHttp2Preface = "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n";
 constexpr std::string_view kPrefaceBegin = kHttp2Preface.substr(0, 2);
+
+// Upgrades change the protocol of the rest of the connection, such requests
+// are processed alone
+bool CanBePipelinedConcurrently(const http::HttpRequest& request) {
+    return request.GetHttpMajor() == 1 && !request.IsUpgradeWebsocket() &&
+           request.GetHeader(USERVER_NAMESPACE::http::headers::k2::kHttp2SettingsHeader).empty();
+}
+
 }  // namespace
 
 Connection::Connection(
@@ -39,7 +48,8 @@ Connection::Connection(
     const engine::io::Sockaddr& remote_address,
     const http::RequestHandlerBase& request_handler,
     std::shared_ptr<Stats> stats,
-    request::ResponseDataAccounter& data_accounter
+    request::ResponseDataAccounter& data_accounter,
+    ReadBufferPool* read_buffer_pool
 )
     : config_(config),
       handler_defaults_config_(handler_defaults_config),
@@ -47,9 +57,11 @@ Connection::Connection(
       request_handler_(request_handler),
       stats_(std::move(stats)),
       data_accounter_(data_accounter),
+      read_buffer_pool_(read_buffer_pool),
       remote_address_(remote_address),
       peer_name_(remote_address_.PrimaryAddressString()) {
     LOG_DEBUG() << "Incoming connection from " << Getpeername() << ", fd " << Fd();
+    USERVER_IMPL_USDT(connection_accept, this, Fd(), peer_name_.c_str());
 
     ++stats_->active_connections;
     ++stats_->connections_created;
@@ -77,8 +89,11 @@ void Connection::Shutdown() noexcept {
     LOG_TRACE() << "Terminating requests processing (canceling in-flight "
                    "requests) for fd "
                 << Fd();
+    USERVER_IMPL_USDT(connection_close, this, Fd());
 
     peer_socket_.reset();
+    pending_data_size_ = 0;
+    ReleaseReadBuffer();
 
     --stats_->active_connections;
     ++stats_->connections_closed;
@@ -91,7 +106,8 @@ void Connection::ListenForRequests() noexcept {
             parser_ = MakeParser(HttpVersion::k11);
         }
 
-        pending_data_.resize(config_.in_buffer_size);
+        // With the pool the buffer is taken only when the data arrives
+        if (!read_buffer_pool_) pending_data_.resize(config_.in_buffer_size);
         std::string http_version_buffer;
         http_version_buffer.reserve(kPrefaceBegin.size());
         while (is_accepting_requests_) {
@@ -124,9 +140,7 @@ void Connection::ListenForRequests() noexcept {
             }
             pending_data_size_ = 0;
 
-            for (auto&& request : pending_requests_) {
-                ProcessRequest(std::move(request));
-            }
+            ProcessPendingRequests();
             pending_requests_.resize(0);
             if (should_stop_accepting_requests) is_accepting_requests_ = false;
         }
@@ -149,7 +163,8 @@ void Connection::ListenForRequests() noexcept {
 
 bool Connection::WaitOnSocket(engine::Deadline deadline) {
     bool is_readable = true;
-    if (pending_data_size_ != pending_data_.size()) {
+    if (pending_data_.empty() || pending_data_size_ != pending_data_.size()) {
+        ReleaseReadBuffer();
         if (is_http2_parser_) {
             UASSERT(dynamic_cast<http::Http2Session*>(parser_.get()));
             // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
@@ -185,6 +200,10 @@ bool Connection::WaitOnSocket(engine::Deadline deadline) {
             is_readable = peer_socket_->WaitReadable(deadline);
         }
     }
+    if (pending_data_.empty()) {
+        UASSERT(read_buffer_pool_);
+        pending_data_ = read_buffer_pool_->Acquire();
+    }
     pending_data_size_ = is_readable ? peer_socket_->ReadSome(pending_data_.data(), pending_data_.size(), deadline) : 0;
     if (!pending_data_size_) {
         LOG_TRACE() << "Peer " << Getpeername() << " on fd " << Fd()
@@ -203,6 +222,59 @@ bool Connection::WaitOnSocket(engine::Deadline deadline) {
     return true;
 }
 
+void Connection::ReleaseReadBuffer() noexcept {
+    if (!read_buffer_pool_ || pending_data_.empty()) return;
+
+    UASSERT(pending_data_size_ == 0);
+    read_buffer_pool_->Release(std::move(pending_data_));
+    pending_data_.clear();
+}
+
+void Connection::ProcessPendingRequests() {
+    const auto in_flight_limit = is_http2_parser_ ? 1 : config_.pipeline_in_flight_limit;
+
+    auto it = pending_requests_.begin();
+    while (it != pending_requests_.end()) {
+        auto batch_end = it;
+        while (batch_end != pending_requests_.end() && static_cast<std::size_t>(batch_end - it) < in_flight_limit &&
+               CanBePipelinedConcurrently(**batch_end)) {
+            ++batch_end;
+        }
+
+        if (batch_end - it > 1) {
+            ProcessPipelinedRequests(it, batch_end);
+            it = batch_end;
+        } else {
+            ProcessRequest(std::move(*it));
+            ++it;
+        }
+    }
+}
+
+void Connection::ProcessPipelinedRequests(
+    std::vector<HttpRequestPtr>::iterator begin,
+    std::vector<HttpRequestPtr>::iterator end
+) {
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(end - begin);
+    for (auto it = begin; it != end; ++it) {
+        if ((*it)->IsFinal()) {
+            is_accepting_requests_ = false;
+        }
+
+        stats_->active_request_count.Add(1);
+        tasks.push_back(request_handler_.StartRequestTask(*it));
+    }
+
+    // Handlers run concurrently, but the responses must go in the order of
+    // the requests
+    for (auto& task : tasks) {
+        WaitForRequestTask(*begin, task);
+        SendResponse(**begin);
+        ++begin;
+    }
+}
+
 void Connection::ProcessRequest(std::shared_ptr<http::HttpRequest>&& request_ptr) {
     if (request_ptr->IsFinal()) {
         is_accepting_requests_ = false;
@@ -241,6 +313,19 @@ bool Connection::ReadSome() {
 
 engine::TaskWithResult<void> Connection::HandleQueueItem(const std::shared_ptr<http::HttpRequest>& request) noexcept {
     auto request_task = request_handler_.StartRequestTask(request);
+    WaitForRequestTask(request, request_task);
+    return request_task;
+}
+
+void Connection::WaitForRequestTask(
+    const std::shared_ptr<http::HttpRequest>& request,
+    engine::TaskWithResult<void>& request_task
+) noexcept {
+    if (!request_task.IsValid()) {
+        // Rejected or broken request, the response is already complete
+        UASSERT(request->GetHttpResponse().IsReady());
+        return;
+    }
 
     if (engine::current_task::IsCancelRequested()) {
         // We could've packed all remaining requests into a vector and cancel them
@@ -248,7 +333,7 @@ engine::TaskWithResult<void> Connection::HandleQueueItem(const std::shared_ptr<h
         request_task.SyncCancel();
         LOG_DEBUG() << "Request processing interrupted";
         is_response_chain_valid_ = false;
-        return request_task;  // avoids throwing and catching exception down below
+        return;  // avoids throwing and catching exception down below
     }
 
     try {
@@ -303,7 +388,6 @@ engine::TaskWithResult<void> Connection::HandleQueueItem(const std::shared_ptr<h
         LOG_WARNING() << "Request failed with unhandled exception: " << e;
         request->MarkAsInternalServerError();
     }
-    return request_task;
 }
 
 void Connection::SendResponse(http::HttpRequest& request) {
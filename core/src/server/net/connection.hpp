@@ -2,9 +2,11 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <server/http/request_handler_base.hpp>
 #include <server/net/connection_config.hpp>
+#include <server/net/read_buffer_pool.hpp>
 #include <server/net/stats.hpp>
 
 // TODO: use fwd
@@ -32,7 +34,8 @@ public:
         const engine::io::Sockaddr& remote_address,
         const http::RequestHandlerBase& request_handler,
         std::shared_ptr<Stats> stats,
-        request::ResponseDataAccounter& data_accounter
+        request::ResponseDataAccounter& data_accounter,
+        ReadBufferPool* read_buffer_pool = nullptr
     );
 
     void Process();
@@ -40,15 +43,27 @@ public:
     int Fd() const;
 
 private:
+    using HttpRequestPtr = std::shared_ptr<http::HttpRequest>;
+
     void Shutdown() noexcept;
 
     bool IsRequestTasksEmpty() const noexcept;
 
     void ListenForRequests() noexcept;
+    void ProcessPendingRequests();
+    void ProcessPipelinedRequests(
+        std::vector<HttpRequestPtr>::iterator begin,
+        std::vector<HttpRequestPtr>::iterator end
+    );
     void ProcessRequest(std::shared_ptr<http::HttpRequest>&& request_ptr);
     bool WaitOnSocket(engine::Deadline deadline);
+    void ReleaseReadBuffer() noexcept;
 
     engine::TaskWithResult<void> HandleQueueItem(const std::shared_ptr<http::HttpRequest>& request) noexcept;
+    void WaitForRequestTask(
+        const std::shared_ptr<http::HttpRequest>& request,
+        engine::TaskWithResult<void>& request_task
+    ) noexcept;
     void SendResponse(http::HttpRequest& request);
 
     std::string Getpeername() const;
@@ -63,10 +78,10 @@ private:
     const http::RequestHandlerBase& request_handler_;
     const std::shared_ptr<Stats> stats_;
     request::ResponseDataAccounter& data_accounter_;
+    ReadBufferPool* const read_buffer_pool_;
     std::unique_ptr<request::RequestParser> parser_{nullptr};
     bool is_http2_parser_{false};
 
-    using HttpRequestPtr = std::shared_ptr<http::HttpRequest>;
     std::vector<HttpRequestPtr> pending_requests_;
 
     engine::io::Sockaddr remote_address_;
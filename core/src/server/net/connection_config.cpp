@@ -11,6 +11,10 @@ Http2SessionConfig Parse(const yaml_config::YamlConfig& value, formats::parse::T
     conf.max_concurrent_streams = value["max_concurrent_streams"].As<std::uint32_t>(conf.max_concurrent_streams);
     conf.max_frame_size = value["max_frame_size"].As<std::uint32_t>(conf.max_frame_size);
     conf.initial_window_size = value["initial_window_size"].As<std::uint32_t>(conf.initial_window_size);
+    conf.header_table_size = value["header_table_size"].As<std::uint32_t>(conf.header_table_size);
+    conf.max_deflate_dynamic_table_size =
+        value["max_deflate_dynamic_table_size"].As<std::size_t>(conf.max_deflate_dynamic_table_size);
+    conf.index_set_cookie = value["index_set_cookie"].As<bool>(conf.index_set_cookie);
     return conf;
 }
 
@@ -18,8 +22,11 @@ ConnectionConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<
     ConnectionConfig config;
 
     config.in_buffer_size = value["in_buffer_size"].As<size_t>(config.in_buffer_size);
+    config.read_buffer_pool_size = value["read_buffer_pool_size"].As<size_t>(config.read_buffer_pool_size);
     config.requests_queue_size_threshold =
         value["requests_queue_size_threshold"].As<size_t>(config.requests_queue_size_threshold);
+    config.pipeline_in_flight_limit =
+        value["pipeline_in_flight_limit"].As<size_t>(config.pipeline_in_flight_limit);
     config.keepalive_timeout = value["keepalive_timeout"].As<std::chrono::seconds>(config.keepalive_timeout);
 
     if (!value["stream_close_check_delay"].IsMissing()) {
@@ -22,11 +22,24 @@ struct Http2SessionConfig final {
     std::uint32_t max_concurrent_streams = 100;
     std::uint32_t max_frame_size = 1 << 14;
     std::uint32_t initial_window_size = 1 << 16;
+    // HPACK dynamic table for the request headers, advertised to the client
+    std::uint32_t header_table_size = 1 << 12;
+    // HPACK dynamic table for the response headers
+    std::size_t max_deflate_dynamic_table_size = 1 << 12;
+    // Set-Cookie values are mostly unique, indexing them only evicts the
+    // useful entries from the table
+    bool index_set_cookie = true;
 };
 
 struct ConnectionConfig {
     size_t in_buffer_size = 32 * 1024;
+    // Idle read buffers shared by the connections of a listener, zero makes
+    // each connection keep its buffer for the whole lifetime
+    size_t read_buffer_pool_size = 0;
     size_t requests_queue_size_threshold = 100;
+    // Pipelined HTTP/1.1 requests of a connection that run their handlers
+    // concurrently, the responses are still sent in the order of requests
+    size_t pipeline_in_flight_limit = 1;
     std::chrono::seconds keepalive_timeout{10 * 60};
     std::chrono::milliseconds abort_check_delay{kDefaultAbortCheckDelay};
     USERVER_NAMESPACE::http::HttpVersion http_version = USERVER_NAMESPACE::http::HttpVersion::k11;
@@ -1,5 +1,8 @@
 #include <server/net/connection.hpp>
 
+#include <algorithm>
+#include <array>
+
 #include <fmt/format.h>
 
 #include <server/handlers/http_handler_base_statistics.hpp>
@@ -7,6 +10,7 @@
 #include <server/net/create_socket.hpp>
 #include <userver/clients/http/client.hpp>
 #include <userver/engine/io/sockaddr.hpp>
+#include <userver/engine/io/socket.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/server/http/http_request.hpp>
 
@@ -23,7 +27,7 @@ constexpr auto kAcceptTimeout = utest::kMaxTestWaitTime;
 
 class TestHttprequestHandler : public server::http::RequestHandlerBase {
 public:
-    enum class Behaviors { kNoop, kHang };
+    enum class Behaviors { kNoop, kHang, kRejectInPlace, kSleep };
 
     explicit TestHttprequestHandler(Behaviors behavior = Behaviors::kNoop) : behavior_(behavior) {}
 
@@ -40,6 +44,18 @@ public:
                     ASSERT_TRUE(engine::current_task::IsCancelRequested());
                     ++asyncs_finished;
                 });
+            case Behaviors::kSleep:
+                return engine::AsyncNoSpan([this]() {
+                    const auto in_flight = ++asyncs_in_flight;
+                    max_asyncs_in_flight = std::max(max_asyncs_in_flight.load(), in_flight);
+                    engine::SleepFor(std::chrono::milliseconds{50});
+                    --asyncs_in_flight;
+                    ++asyncs_finished;
+                });
+            case Behaviors::kRejectInPlace:
+                http_request->SetResponseStatus(server::http::HttpStatus::kTooManyRequests);
+                http_request->GetHttpResponse().SetReady();
+                return {};
         }
 
         UINVARIANT(false, "Unexpected behavior");
@@ -52,6 +68,10 @@ public:
 
     // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
     mutable std::atomic<std::size_t> asyncs_finished{0};
+    // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+    mutable std::atomic<std::size_t> asyncs_in_flight{0};
+    // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+    mutable std::atomic<std::size_t> max_asyncs_in_flight{0};
 
 private:
     const Behaviors behavior_;
@@ -300,6 +320,108 @@ UTEST_P(ServerNetConnection, KeepAlive) {
     EXPECT_EQ(handler.asyncs_finished, 2);
 }
 
+UTEST_P(ServerNetConnection, RejectWithoutTask) {
+    const auto http_ver = GetParam();
+    net::ListenerConfig config = CreateConfig(http_ver);
+    auto request_socket = net::CreateSocket(config, config.ports[0]);
+
+    auto http_client_ptr = utest::CreateHttpClient();
+    http_client_ptr->SetMaxHostConnections(1);
+
+    auto request = CreateRequest(*http_client_ptr, request_socket, http_ver, ConnectionHeader::kKeepAlive);
+
+    auto peer = request_socket.Accept(Deadline::FromDuration(kAcceptTimeout));
+    ASSERT_TRUE(peer.IsValid());
+    auto stats = std::make_shared<net::Stats>();
+    server::request::ResponseDataAccounter data_accounter;
+    TestHttprequestHandler handler{TestHttprequestHandler::Behaviors::kRejectInPlace};
+
+    auto task = engine::AsyncNoSpan([&] {
+        net::Connection connection(
+            config.connection_config,
+            config.handler_defaults,
+            std::make_unique<engine::io::Socket>(std::move(peer)),
+            {},
+            handler,
+            stats,
+            data_accounter
+        );
+
+        connection.Process();
+    });
+    EXPECT_EQ(request.Get()->status_code(), 429);
+
+    // The connection keeps serving requests after an in-place rejection
+    request = CreateRequest(*http_client_ptr, request_socket, http_ver, ConnectionHeader::kKeepAlive);
+    EXPECT_EQ(request.Get()->status_code(), 429);
+    EXPECT_EQ(handler.asyncs_finished, 0);
+
+    task.RequestCancel();
+    task.WaitFor(utest::kMaxTestWaitTime);
+    EXPECT_TRUE(task.IsFinished());
+}
+
+UTEST(ServerNetConnection, PipelinedConcurrently) {
+    constexpr std::size_t kRequests = 4;
+    net::ListenerConfig config = CreateConfig();
+    config.connection_config.pipeline_in_flight_limit = kRequests;
+    auto request_socket = net::CreateSocket(config, config.ports[0]);
+
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    const auto addr = request_socket.Getsockname();
+    engine::io::Socket client{addr.Domain(), engine::io::SocketType::kStream};
+    client.Connect(addr, deadline);
+
+    auto peer = request_socket.Accept(deadline);
+    ASSERT_TRUE(peer.IsValid());
+    auto stats = std::make_shared<net::Stats>();
+    server::request::ResponseDataAccounter data_accounter;
+    TestHttprequestHandler handler{TestHttprequestHandler::Behaviors::kSleep};
+
+    auto task = engine::AsyncNoSpan([&] {
+        net::Connection connection(
+            config.connection_config,
+            config.handler_defaults,
+            std::make_unique<engine::io::Socket>(std::move(peer)),
+            {},
+            handler,
+            stats,
+            data_accounter
+        );
+
+        connection.Process();
+    });
+
+    std::string requests;
+    for (std::size_t i = 0; i < kRequests; ++i) {
+        requests += fmt::format("GET /{} HTTP/1.1\r\nHost: localhost\r\n\r\n", i);
+    }
+    ASSERT_EQ(client.SendAll(requests.data(), requests.size(), deadline), requests.size());
+
+    std::string responses;
+    std::array<char, 1024> buffer{};
+    const auto count_responses = [&responses] {
+        std::size_t count = 0;
+        auto pos = responses.find("HTTP/1.1 ");
+        while (pos != std::string::npos) {
+            ++count;
+            pos = responses.find("HTTP/1.1 ", pos + 1);
+        }
+        return count;
+    };
+    while (count_responses() < kRequests) {
+        const auto size = client.RecvSome(buffer.data(), buffer.size(), deadline);
+        ASSERT_NE(size, 0);
+        responses.append(buffer.data(), size);
+    }
+
+    EXPECT_EQ(handler.max_asyncs_in_flight, kRequests);
+
+    task.RequestCancel();
+    task.WaitFor(utest::kMaxTestWaitTime);
+    EXPECT_TRUE(task.IsFinished());
+}
+
 UTEST_P(ServerNetConnection, CancelMultipleInFlight) {
     constexpr std::size_t kInFlightRequests = 10;
     constexpr std::size_t kMaxAttempts = 10;
@@ -2,15 +2,24 @@
 
 #include <string>
 
+#ifdef __linux__
+#include <linux/filter.h>
+#include <sys/socket.h>
+#endif
+
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 #include <boost/filesystem/operations.hpp>
 
+#include <userver/engine/io/exception.hpp>
 #include <userver/engine/io/socket.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/fs/blocking/write.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/net/blocking/get_addr_info.hpp>
 
+#include <utils/check_syscall.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
@@ -62,13 +71,44 @@ engine::io::Socket CreateIpv6Socket(const std::string& address, uint16_t port, i
     return socket;
 }
 
+// The kernel picks the socket of the SO_REUSEPORT group with the index
+// `cpu % shards`, the sockets are indexed in the order of binding. Connections
+// go to hash based selection if the group is not complete yet.
+void AttachReuseportCpuSteering(engine::io::Socket& socket, std::size_t shards) {
+#if defined(__linux__) && defined(SO_ATTACH_REUSEPORT_CBPF)
+    sock_filter code[] = {
+        {BPF_LD | BPF_W | BPF_ABS, 0, 0, static_cast<std::uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+        {BPF_ALU | BPF_MOD | BPF_K, 0, 0, static_cast<std::uint32_t>(shards)},
+        {BPF_RET | BPF_A, 0, 0, 0},
+    };
+    sock_fprog program{};
+    program.len = std::size(code);
+    program.filter = code;
+
+    utils::CheckSyscallCustomException<engine::io::IoSystemError>(
+        ::setsockopt(socket.Fd(), SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &program, sizeof(program)),
+        "attaching reuseport CPU steering program, fd={}",
+        socket.Fd()
+    );
+#else
+    (void)socket;
+    (void)shards;
+    LOG_WARNING() << "SO_ATTACH_REUSEPORT_CBPF is not supported, reuseport-cpu-steering is ignored";
+#endif
+}
+
 }  // namespace
 
-engine::io::Socket CreateSocket(const ListenerConfig& config, const PortConfig& port_config) {
-    if (port_config.unix_socket_path.empty())
-        return CreateIpv6Socket(port_config.address, port_config.port, config.backlog);
-    else
+engine::io::Socket CreateSocket(const ListenerConfig& config, const PortConfig& port_config, std::size_t shards) {
+    if (!port_config.unix_socket_path.empty()) {
         return CreateUnixSocket(port_config.unix_socket_path, config.backlog);
+    }
+
+    auto socket = CreateIpv6Socket(port_config.address, port_config.port, config.backlog);
+    if (config.reuseport_cpu_steering && shards > 1) {
+        AttachReuseportCpuSteering(socket, shards);
+    }
+    return socket;
 }
 
 }  // namespace server::net
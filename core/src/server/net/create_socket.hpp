@@ -7,7 +7,9 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
-engine::io::Socket CreateSocket(const ListenerConfig& config, const PortConfig& port_config);
+/// @param shards the number of listener sockets bound to the same port
+engine::io::Socket
+CreateSocket(const ListenerConfig& config, const PortConfig& port_config, std::size_t shards = 1);
 
 }  // namespace server::net
 
@@ -44,6 +44,7 @@ PortConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<PortCo
     if (!pkey_pass_name.empty()) {
         config.tls_private_key_passphrase_name = pkey_pass_name;
     }
+    config.tls_kernel_offload = value["tls"]["kernel-offload"].As<bool>(config.tls_kernel_offload);
     auto ca_paths = value["tls"]["ca"].As<std::vector<std::string>>({});
     for (const auto& ca_path : ca_paths) {
         auto contents = fs::blocking::ReadFileContents(ca_path);
@@ -60,6 +61,7 @@ ListenerConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<Li
     config.handler_defaults = value["handler-defaults"].As<request::HttpRequestConfig>();
     config.max_connections = value["max_connections"].As<size_t>(config.max_connections);
     config.shards = value["shards"].As<std::optional<size_t>>(config.shards);
+    config.reuseport_cpu_steering = value["reuseport-cpu-steering"].As<bool>(config.reuseport_cpu_steering);
     config.task_processor = value["task_processor"].As<std::string>();
     config.backlog = value["backlog"].As<int>(config.backlog);
 
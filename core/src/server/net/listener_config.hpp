@@ -26,6 +26,7 @@ struct PortConfig {
     std::string tls_private_key_passphrase_name;
     crypto::PrivateKey tls_private_key;
     std::vector<crypto::Certificate> tls_certificate_authorities;
+    bool tls_kernel_offload{false};
 
     void ReadTlsSettings(const storages::secdist::SecdistConfig& secdist);
 };
@@ -36,6 +37,8 @@ struct ListenerConfig {
     int backlog = 1024;  // truncated to net.core.somaxconn
     size_t max_connections = 32768;
     std::optional<size_t> shards;
+    // Steer new connections to the shard sockets by the CPU that received them
+    bool reuseport_cpu_steering{false};
     std::string task_processor;
 
     std::vector<PortConfig> ports;
@@ -8,6 +8,8 @@
 #include <string>
 #include <system_error>
 
+#include <engine/ev/thread_pool.hpp>
+#include <engine/task/task_processor.hpp>
 #include <server/net/create_socket.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/io/exception.hpp>
@@ -33,13 +35,20 @@ ListenerImpl::ListenerImpl(
       endpoint_info_(std::move(endpoint_info)),
       stats_(std::make_shared<Stats>()),
       data_accounter_(data_accounter) {
-    for (const auto& port : endpoint_info_->listener_config.ports) {
+    const auto& listener_config = endpoint_info_->listener_config;
+    const auto& connection_config = listener_config.connection_config;
+    if (connection_config.read_buffer_pool_size > 0) {
+        read_buffer_pool_.emplace(connection_config.in_buffer_size, connection_config.read_buffer_pool_size, *stats_);
+    }
+
+    const auto shards = listener_config.shards.value_or(task_processor_.EventThreadPool().GetSize());
+    for (const auto& port : listener_config.ports) {
         socket_listener_tasks.push_back(engine::CriticalAsyncNoSpan(
             task_processor_,
-            [this](engine::io::Socket&& request_socket) {
+            [this, &port](engine::io::Socket&& request_socket) {
                 while (!engine::current_task::ShouldCancel()) {
                     try {
-                        AcceptConnection(request_socket, endpoint_info_->listener_config.ports[0]);
+                        AcceptConnection(request_socket, port);
                     } catch (const engine::io::IoCancelled&) {
                         break;
                     } catch (const std::exception& ex) {
@@ -51,7 +60,7 @@ ListenerImpl::ListenerImpl(
                     }
                 }
             },
-            CreateSocket(endpoint_info_->listener_config, port)
+            CreateSocket(listener_config, port, shards)
         ));
     }
 }
@@ -104,13 +113,17 @@ void ListenerImpl::ProcessConnection(engine::io::Socket peer_socket, const PortC
     std::unique_ptr<engine::io::RwBase> socket;
     auto remote_address = peer_socket.Getpeername();
     if (port_config.tls) {
-        socket = std::make_unique<engine::io::TlsWrapper>(engine::io::TlsWrapper::StartTlsServer(
+        auto tls_socket = std::make_unique<engine::io::TlsWrapper>(engine::io::TlsWrapper::StartTlsServer(
             std::move(peer_socket),
             port_config.tls_cert_chain,
             port_config.tls_private_key,
             {},
-            port_config.tls_certificate_authorities
+            port_config.tls_certificate_authorities,
+            port_config.tls_kernel_offload
         ));
+        ++stats_->tls_connections_created;
+        if (tls_socket->IsKernelTlsSendEnabled()) ++stats_->ktls_connections_created;
+        socket = std::move(tls_socket);
     } else {
         socket = std::make_unique<engine::io::Socket>(std::move(peer_socket));
     }
@@ -122,7 +135,8 @@ void ListenerImpl::ProcessConnection(engine::io::Socket peer_socket, const PortC
         std::move(remote_address),
         endpoint_info_->request_handler,
         stats_,
-        data_accounter_
+        data_accounter_,
+        read_buffer_pool_ ? &*read_buffer_pool_ : nullptr
     );
 
     LOG_TRACE() << "Start connection processing for fd " << fd;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
 #include <userver/concurrent/background_task_storage.hpp>
 #include <userver/engine/io/socket.hpp>
@@ -9,6 +10,7 @@
 
 #include "connection.hpp"
 #include "endpoint_info.hpp"
+#include "read_buffer_pool.hpp"
 #include "stats.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -35,6 +37,7 @@ private:
 
     std::shared_ptr<Stats> stats_;
     request::ResponseDataAccounter& data_accounter_;
+    std::optional<ReadBufferPool> read_buffer_pool_;
 
     concurrent::BackgroundTaskStorageCore connections_;
 
@@ -0,0 +1,54 @@
+#include <server/net/read_buffer_pool.hpp>
+
+#include <memory>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::net {
+
+ReadBufferPool::ReadBufferPool(std::size_t buffer_size, std::size_t max_pooled_buffers, Stats& stats)
+    : buffer_size_(buffer_size), max_pooled_buffers_(max_pooled_buffers), stats_(stats) {
+    UINVARIANT(buffer_size_ > 0, "Read buffers must not be empty");
+}
+
+ReadBufferPool::~ReadBufferPool() {
+    buffers_.DisposeUnsafe([this](PooledBuffer& buffer) {
+        --stats_.read_buffers_pooled;
+        delete &buffer;
+    });
+}
+
+std::vector<char> ReadBufferPool::Acquire() {
+    if (auto* pooled = buffers_.TryPop()) {
+        --stats_.read_buffers_pooled;
+        const std::unique_ptr<PooledBuffer> holder{pooled};
+        return std::move(holder->data);
+    }
+
+    ++stats_.read_buffer_pool_misses;
+    return std::vector<char>(buffer_size_);
+}
+
+void ReadBufferPool::Release(std::vector<char>&& buffer) noexcept {
+    UASSERT(buffer.size() == buffer_size_);
+    if (stats_.read_buffers_pooled.fetch_add(1) >= max_pooled_buffers_) {
+        // The buffer is freed, the pool keeps enough of them for the typical
+        // number of concurrently active connections
+        --stats_.read_buffers_pooled;
+        return;
+    }
+
+    try {
+        auto pooled = std::make_unique<PooledBuffer>();
+        pooled->data = std::move(buffer);
+        buffers_.Push(*pooled.release());
+    } catch (const std::bad_alloc&) {
+        --stats_.read_buffers_pooled;
+    }
+}
+
+}  // namespace server::net
+
+USERVER_NAMESPACE_END
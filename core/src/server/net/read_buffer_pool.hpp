@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <userver/concurrent/impl/intrusive_hooks.hpp>
+#include <userver/concurrent/impl/intrusive_stack.hpp>
+
+#include <server/net/stats.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::net {
+
+/// Read buffers shared by the connections of a listener. Idle keep-alive
+/// connections return their buffers here while waiting for the data, so
+/// the memory is proportional to the active connections rather than to all
+/// the open ones. Thread-safe.
+class ReadBufferPool final {
+public:
+    ReadBufferPool(std::size_t buffer_size, std::size_t max_pooled_buffers, Stats& stats);
+
+    ReadBufferPool(ReadBufferPool&&) = delete;
+    ReadBufferPool& operator=(ReadBufferPool&&) = delete;
+    ~ReadBufferPool();
+
+    /// Returns a pooled buffer of `buffer_size` or allocates a new one
+    std::vector<char> Acquire();
+
+    /// Keeps the buffer for reuse, frees it if the pool is full
+    void Release(std::vector<char>&& buffer) noexcept;
+
+private:
+    struct PooledBuffer final {
+        concurrent::impl::SinglyLinkedHook<PooledBuffer> hook;
+        std::vector<char> data;
+    };
+
+    using Stack = concurrent::impl::IntrusiveStack<PooledBuffer, concurrent::impl::MemberHook<&PooledBuffer::hook>>;
+
+    const std::size_t buffer_size_;
+    const std::size_t max_pooled_buffers_;
+    Stats& stats_;
+    Stack buffers_;
+};
+
+}  // namespace server::net
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,71 @@
+#include <server/net/read_buffer_pool.hpp>
+
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kBufferSize = 1024;
+
+}  // namespace
+
+TEST(ReadBufferPool, Reuse) {
+    server::net::Stats stats;
+    server::net::ReadBufferPool pool{kBufferSize, 2, stats};
+
+    auto buffer = pool.Acquire();
+    EXPECT_EQ(buffer.size(), kBufferSize);
+    EXPECT_EQ(stats.read_buffer_pool_misses, 1);
+
+    const auto* data = buffer.data();
+    pool.Release(std::move(buffer));
+    EXPECT_EQ(stats.read_buffers_pooled, 1);
+
+    buffer = pool.Acquire();
+    EXPECT_EQ(buffer.data(), data);
+    EXPECT_EQ(buffer.size(), kBufferSize);
+    EXPECT_EQ(stats.read_buffers_pooled, 0);
+    EXPECT_EQ(stats.read_buffer_pool_misses, 1);
+
+    pool.Release(std::move(buffer));
+}
+
+TEST(ReadBufferPool, Limit) {
+    server::net::Stats stats;
+    {
+        server::net::ReadBufferPool pool{kBufferSize, 2, stats};
+
+        std::vector<std::vector<char>> buffers;
+        for (int i = 0; i < 3; ++i) buffers.push_back(pool.Acquire());
+        EXPECT_EQ(stats.read_buffer_pool_misses, 3);
+
+        for (auto& buffer : buffers) pool.Release(std::move(buffer));
+        EXPECT_EQ(stats.read_buffers_pooled, 2);
+    }
+    EXPECT_EQ(stats.read_buffers_pooled, 0);
+}
+
+UTEST_MT(ReadBufferPool, Concurrent, 4) {
+    server::net::Stats stats;
+    server::net::ReadBufferPool pool{kBufferSize, 4, stats};
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (int i = 0; i < 4; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([&pool] {
+            for (int j = 0; j < 1000; ++j) {
+                auto buffer = pool.Acquire();
+                ASSERT_EQ(buffer.size(), kBufferSize);
+                pool.Release(std::move(buffer));
+            }
+        }));
+    }
+    for (auto& task : tasks) task.Get();
+
+    EXPECT_LE(stats.read_buffers_pooled, 4);
+}
+
+USERVER_NAMESPACE_END
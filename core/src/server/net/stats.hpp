@@ -61,6 +61,12 @@ struct Stats {
     std::atomic<size_t> active_connections{0};
     std::atomic<size_t> connections_created{0};
     std::atomic<size_t> connections_closed{0};
+    std::atomic<size_t> tls_connections_created{0};
+    std::atomic<size_t> ktls_connections_created{0};
+    // buffers kept by ReadBufferPool for the idle connections
+    std::atomic<size_t> read_buffers_pooled{0};
+    // buffers allocated because the pool was empty
+    std::atomic<size_t> read_buffer_pool_misses{0};
 
     // per connection
     ParserStats parser_stats;
@@ -75,6 +81,10 @@ struct StatsAggregation final {
         : active_connections{stats.active_connections.load()},
           connections_created{stats.connections_created.load()},
           connections_closed{stats.connections_closed.load()},
+          tls_connections_created{stats.tls_connections_created.load()},
+          ktls_connections_created{stats.ktls_connections_created.load()},
+          read_buffers_pooled{stats.read_buffers_pooled.load()},
+          read_buffer_pool_misses{stats.read_buffer_pool_misses.load()},
           parser_stats{stats.parser_stats},
           active_request_count{stats.active_request_count.NonNegativeRead()},
           requests_processed_count{stats.requests_processed_count.Read()} {}
@@ -83,6 +93,10 @@ struct StatsAggregation final {
         active_connections += other.active_connections;
         connections_created += other.connections_created;
         connections_closed += other.connections_closed;
+        tls_connections_created += other.tls_connections_created;
+        ktls_connections_created += other.ktls_connections_created;
+        read_buffers_pooled += other.read_buffers_pooled;
+        read_buffer_pool_misses += other.read_buffer_pool_misses;
 
         parser_stats += other.parser_stats;
         active_request_count += other.active_request_count;
@@ -94,6 +108,11 @@ struct StatsAggregation final {
     std::size_t active_connections{0};
     std::size_t connections_created{0};
     std::size_t connections_closed{0};
+    std::size_t tls_connections_created{0};
+    // TLS connections with the kernel encryption offload
+    std::size_t ktls_connections_created{0};
+    std::size_t read_buffers_pooled{0};
+    std::size_t read_buffer_pool_misses{0};
 
     // per connection
     ParserStatsAggregation parser_stats;
@@ -330,6 +330,12 @@ void Server::WriteMonitorData(utils::statistics::Writer& writer) const {
         conn_stats["active"] = server_stats.active_connections;
         conn_stats["opened"] = server_stats.connections_created;
         conn_stats["closed"] = server_stats.connections_closed;
+        conn_stats["tls-opened"] = server_stats.tls_connections_created;
+        conn_stats["ktls-opened"] = server_stats.ktls_connections_created;
+        if (auto buffer_pool_stats = conn_stats["read-buffer-pool"]) {
+            buffer_pool_stats["pooled"] = server_stats.read_buffers_pooled;
+            buffer_pool_stats["misses"] = server_stats.read_buffer_pool_misses;
+        }
     }
 
     if (auto request_stats = writer["requests"]) {
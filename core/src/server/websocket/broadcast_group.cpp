@@ -0,0 +1,187 @@
+#include <userver/server/websocket/broadcast_group.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket {
+
+namespace impl {
+
+class BroadcastSubscriber final {
+public:
+    BroadcastSubscriber(WebSocketConnection& connection, const BroadcastSettings& settings, BroadcastStatistics& stats)
+        : connection_(connection), settings_(settings), stats_(stats) {
+        writer_ = utils::Async("websocket_broadcast_writer", [this] { RunWriter(); });
+    }
+
+    // Never waits for the writer, publishing to a slow connection must not
+    // delay the others
+    void Enqueue(const std::shared_ptr<const PreparedMessage>& message) {
+        {
+            const std::lock_guard lock{mutex_};
+            if (is_closed_) return;
+
+            if (queue_.size() < settings_.max_queued_messages) {
+                queue_.push_back(message);
+                ++stats_.messages_queued;
+            } else if (settings_.slow_consumer_policy == SlowConsumerPolicy::kDropMessages) {
+                ++stats_.messages_dropped;
+                return;
+            } else {
+                stats_.messages_dropped += static_cast<std::int64_t>(queue_.size() + 1);
+                ++stats_.connections_dropped;
+                queue_.clear();
+                is_closed_ = true;
+                should_disconnect_ = true;
+            }
+        }
+        event_.Send();
+    }
+
+    void Stop() noexcept { writer_.SyncCancel(); }
+
+private:
+    void RunWriter() {
+        std::deque<std::shared_ptr<const PreparedMessage>> batch;
+        while (event_.WaitForEvent()) {
+            bool should_disconnect = false;
+            {
+                const std::lock_guard lock{mutex_};
+                batch.swap(queue_);
+                should_disconnect = should_disconnect_;
+            }
+
+            try {
+                if (should_disconnect) {
+                    LOG_WARNING() << "Closing the slow websocket connection to "
+                                  << connection_.RemoteAddr().PrimaryAddressString()
+                                  << ", its broadcast queue is full";
+                    connection_.Close(CloseStatus::kPolicyViolation);
+                    return;
+                }
+                for (const auto& message : batch) connection_.SendPrepared(*message);
+            } catch (const std::exception& e) {
+                LOG_INFO() << "Failed to send a broadcast message, no more messages are sent to the connection: " << e;
+                const std::lock_guard lock{mutex_};
+                queue_.clear();
+                is_closed_ = true;
+                return;
+            }
+            batch.clear();
+        }
+    }
+
+    WebSocketConnection& connection_;
+    const BroadcastSettings& settings_;
+    BroadcastStatistics& stats_;
+
+    engine::Mutex mutex_;
+    std::deque<std::shared_ptr<const PreparedMessage>> queue_;
+    // nothing is queued anymore, the connection is broken or being closed
+    bool is_closed_{false};
+    bool should_disconnect_{false};
+    engine::SingleConsumerEvent event_;
+
+    // Must be the last member, as it uses the ones above
+    engine::TaskWithResult<void> writer_;
+};
+
+}  // namespace impl
+
+BroadcastGroup::Subscription::Subscription(
+    BroadcastGroup& group,
+    std::shared_ptr<impl::BroadcastSubscriber> subscriber
+)
+    : group_(&group), subscriber_(std::move(subscriber)) {}
+
+BroadcastGroup::Subscription::Subscription(Subscription&& other) noexcept
+    : group_(other.group_), subscriber_(std::move(other.subscriber_)) {}
+
+BroadcastGroup::Subscription& BroadcastGroup::Subscription::operator=(Subscription&& other) noexcept {
+    if (this == &other) return *this;
+    Leave();
+    group_ = other.group_;
+    subscriber_ = std::move(other.subscriber_);
+    return *this;
+}
+
+BroadcastGroup::Subscription::~Subscription() { Leave(); }
+
+void BroadcastGroup::Subscription::Leave() noexcept {
+    if (!subscriber_) return;
+    group_->Leave(subscriber_);
+    subscriber_.reset();
+}
+
+BroadcastGroup::BroadcastGroup(BroadcastSettings settings) : settings_(std::move(settings)) {
+    UINVARIANT(settings_.max_queued_messages > 0, "max_queued_messages of BroadcastGroup must be positive");
+}
+
+BroadcastGroup::~BroadcastGroup() {
+    UASSERT_MSG(subscribers_.empty(), "BroadcastGroup is destroyed before its subscriptions");
+}
+
+BroadcastGroup::Subscription BroadcastGroup::Join(WebSocketConnection& connection) {
+    auto subscriber = std::make_shared<impl::BroadcastSubscriber>(connection, settings_, stats_);
+    {
+        const std::unique_lock lock{mutex_};
+        subscribers_.push_back(subscriber);
+    }
+    return Subscription{*this, std::move(subscriber)};
+}
+
+void BroadcastGroup::Publish(std::string_view data, bool is_text) {
+    Publish(std::make_shared<const PreparedMessage>(data, is_text, settings_.config));
+}
+
+void BroadcastGroup::Publish(std::shared_ptr<const PreparedMessage> message) {
+    UASSERT(message);
+    ++stats_.messages_published;
+
+    const std::shared_lock lock{mutex_};
+    for (const auto& subscriber : subscribers_) subscriber->Enqueue(message);
+}
+
+std::size_t BroadcastGroup::GetConnectionsCount() const {
+    const std::shared_lock lock{mutex_};
+    return subscribers_.size();
+}
+
+void BroadcastGroup::Leave(const std::shared_ptr<impl::BroadcastSubscriber>& subscriber) noexcept {
+    {
+        const std::unique_lock lock{mutex_};
+        const auto it = std::find(subscribers_.begin(), subscribers_.end(), subscriber);
+        UASSERT(it != subscribers_.end());
+        if (it != subscribers_.end()) {
+            // the order of the subscribers does not matter
+            std::swap(*it, subscribers_.back());
+            subscribers_.pop_back();
+        }
+    }
+    subscriber->Stop();
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const BroadcastGroup& group) {
+    const auto& stats = group.GetStatistics();
+    writer["connections"]["active"] = group.GetConnectionsCount();
+    writer["connections"]["dropped"] = stats.connections_dropped.load();
+    writer["messages"]["published"] = stats.messages_published.load();
+    writer["messages"]["queued"] = stats.messages_queued.load();
+    writer["messages"]["dropped"] = stats.messages_dropped.load();
+}
+
+}  // namespace server::websocket
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,248 @@
+#include <server/websocket/permessage_deflate.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+
+#include <fmt/format.h>
+#include <zlib.h>
+
+#include <userver/compiler/thread_local.hpp>
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket::impl {
+
+namespace {
+
+constexpr std::string_view kExtensionName = "permessage-deflate";
+
+// Negative window bits make zlib produce and accept raw deflate data
+// without the zlib header and trailer, as RFC 7692 requires
+constexpr int kRawWindowBits = -15;
+constexpr int kMemLevel = 8;
+
+// Room for the sync flush marker
+constexpr std::size_t kOutputReserve = 16;
+constexpr std::size_t kInflateChunkSize = 16 * 1024;
+
+// Every message compressed with Z_SYNC_FLUSH ends with an empty stored block,
+// which is not sent over the wire
+constexpr std::string_view kSyncFlushTail{"\x00\x00\xff\xff", 4};
+
+std::string_view TrimView(std::string_view str) {
+    constexpr std::string_view kSpaces = " \t";
+    const auto begin = str.find_first_not_of(kSpaces);
+    if (begin == std::string_view::npos) return {};
+    return str.substr(begin, str.find_last_not_of(kSpaces) - begin + 1);
+}
+
+std::optional<int> ParseWindowBits(std::string_view value) {
+    if (value.size() >= 2 && value.front() == '"' && value.back() == '"') value = value.substr(1, value.size() - 2);
+    int bits = 0;
+    const auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), bits);
+    if (ec != std::errc{} || ptr != value.data() + value.size() || bits < 8 || bits > 15) return std::nullopt;
+    return bits;
+}
+
+std::optional<DeflateParams> ParseOffer(std::string_view offer, const Config& config) {
+    const auto params = utils::text::SplitIntoStringViewVector(offer, ";");
+    if (params.empty() || TrimView(params.front()) != kExtensionName) return std::nullopt;
+
+    DeflateParams result;
+    result.server_no_context_takeover = config.server_no_context_takeover;
+    result.client_no_context_takeover = config.client_no_context_takeover;
+
+    for (std::size_t i = 1; i < params.size(); ++i) {
+        const auto param = TrimView(params[i]);
+        const auto eq_pos = param.find('=');
+        const bool has_value = eq_pos != std::string_view::npos;
+        const auto name = TrimView(param.substr(0, eq_pos));
+        const auto value = has_value ? TrimView(param.substr(eq_pos + 1)) : std::string_view{};
+
+        if (name == "server_no_context_takeover" && !has_value) {
+            result.server_no_context_takeover = true;
+        } else if (name == "client_no_context_takeover" && !has_value) {
+            // a hint that the client does not take over the context anyway
+            result.client_no_context_takeover = true;
+        } else if (name == "server_max_window_bits" && ParseWindowBits(value) == 15) {
+            // the deflate streams always use 15 bits windows, smaller ones are declined
+            result.server_max_window_bits = true;
+        } else if (name == "client_max_window_bits" && (!has_value || ParseWindowBits(value))) {
+            // the inflate streams accept windows of any size
+        } else {
+            return std::nullopt;
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+class DeflateStream final {
+public:
+    DeflateStream() {
+        if (deflateInit2(&stream_, level_, Z_DEFLATED, kRawWindowBits, kMemLevel, Z_DEFAULT_STRATEGY) != Z_OK) {
+            throw std::runtime_error("Couldn't create websocket compression stream");
+        }
+    }
+
+    DeflateStream(const DeflateStream&) = delete;
+    DeflateStream& operator=(const DeflateStream&) = delete;
+    ~DeflateStream() { deflateEnd(&stream_); }
+
+    void Reset() { deflateReset(&stream_); }
+
+    void Compress(utils::span<const std::byte> data, int level, std::string& out) {
+        if (level != level_) {
+            deflateParams(&stream_, level, Z_DEFAULT_STRATEGY);
+            level_ = level;
+        }
+
+        out.clear();
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        stream_.next_in = reinterpret_cast<Bytef*>(const_cast<std::byte*>(data.data()));
+        stream_.avail_in = static_cast<uInt>(data.size());
+        do {
+            const auto old_size = out.size();
+            out.resize(old_size + deflateBound(&stream_, stream_.avail_in) + kOutputReserve);
+            stream_.next_out = reinterpret_cast<Bytef*>(out.data() + old_size);
+            stream_.avail_out = static_cast<uInt>(out.size() - old_size);
+
+            const auto ret = deflate(&stream_, Z_SYNC_FLUSH);
+            out.resize(out.size() - stream_.avail_out);
+            if (ret != Z_OK && ret != Z_BUF_ERROR) {
+                throw std::runtime_error(
+                    fmt::format("Websocket compression failed: {}", stream_.msg ? stream_.msg : "unknown")
+                );
+            }
+        } while (stream_.avail_out == 0);
+
+        if (utils::text::EndsWith(out, kSyncFlushTail)) out.resize(out.size() - kSyncFlushTail.size());
+    }
+
+private:
+    z_stream stream_{};
+    int level_{Z_DEFAULT_COMPRESSION};
+};
+
+class InflateStream final {
+public:
+    InflateStream() {
+        if (inflateInit2(&stream_, kRawWindowBits) != Z_OK) {
+            throw std::runtime_error("Couldn't create websocket decompression stream");
+        }
+    }
+
+    InflateStream(const InflateStream&) = delete;
+    InflateStream& operator=(const InflateStream&) = delete;
+    ~InflateStream() { inflateEnd(&stream_); }
+
+    void Reset() { inflateReset(&stream_); }
+
+    CloseStatus Decompress(std::string_view data, unsigned max_size, std::string& out) {
+        out.clear();
+        const auto status = Feed(data, max_size, out);
+        if (status != CloseStatus::kNone) return status;
+        return Feed(kSyncFlushTail, max_size, out);
+    }
+
+private:
+    CloseStatus Feed(std::string_view chunk, unsigned max_size, std::string& out) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        stream_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(chunk.data()));
+        stream_.avail_in = static_cast<uInt>(chunk.size());
+        do {
+            // one byte over the limit tells a too big message from a message of
+            // exactly max_size bytes
+            const auto old_size = out.size();
+            const auto room = std::min<std::size_t>(kInflateChunkSize, std::size_t{max_size} + 1 - old_size);
+            out.resize(old_size + room);
+            stream_.next_out = reinterpret_cast<Bytef*>(out.data() + old_size);
+            stream_.avail_out = static_cast<uInt>(room);
+
+            const auto ret = inflate(&stream_, Z_SYNC_FLUSH);
+            out.resize(out.size() - stream_.avail_out);
+            if (out.size() > max_size) return CloseStatus::kTooBigData;
+
+            if (ret == Z_STREAM_END) {
+                // the client finished the deflate stream, the next data starts a new one
+                inflateReset(&stream_);
+            } else if (ret == Z_BUF_ERROR) {
+                break;
+            } else if (ret != Z_OK) {
+                return CloseStatus::kBadMessageData;
+            }
+        } while (stream_.avail_in > 0 || stream_.avail_out == 0);
+        return CloseStatus::kNone;
+    }
+
+    z_stream stream_{};
+};
+
+namespace {
+
+compiler::ThreadLocal local_deflate_stream = [] { return DeflateStream{}; };
+compiler::ThreadLocal local_inflate_stream = [] { return InflateStream{}; };
+
+}  // namespace
+
+std::optional<DeflateParams> NegotiatePermessageDeflate(std::string_view extensions, const Config& config) {
+    if (!config.permessage_deflate) return std::nullopt;
+
+    for (const auto offer : utils::text::SplitIntoStringViewVector(extensions, ",")) {
+        auto params = ParseOffer(offer, config);
+        if (params) return params;
+    }
+    return std::nullopt;
+}
+
+std::string MakePermessageDeflateResponse(const DeflateParams& params) {
+    std::string result{kExtensionName};
+    if (params.server_no_context_takeover) result += "; server_no_context_takeover";
+    if (params.client_no_context_takeover) result += "; client_no_context_takeover";
+    if (params.server_max_window_bits) result += "; server_max_window_bits=15";
+    return result;
+}
+
+void CompressNoContextTakeover(utils::span<const std::byte> message, int level, std::string& out) {
+    auto stream = local_deflate_stream.Use();
+    stream->Reset();
+    stream->Compress(message, level, out);
+}
+
+PermessageDeflate::PermessageDeflate(const DeflateParams& params, int level) : params_(params), level_(level) {}
+
+PermessageDeflate::~PermessageDeflate() = default;
+
+void PermessageDeflate::Compress(utils::span<const std::byte> message, std::string& out) {
+    if (params_.server_no_context_takeover) {
+        CompressNoContextTakeover(message, level_, out);
+        return;
+    }
+
+    // created on the first compressed message, many connections never send one
+    if (!deflate_) deflate_ = std::make_unique<DeflateStream>();
+    deflate_->Compress(message, level_, out);
+}
+
+CloseStatus PermessageDeflate::Decompress(std::string& message, unsigned max_size) {
+    CloseStatus status{};
+    if (params_.client_no_context_takeover) {
+        auto stream = local_inflate_stream.Use();
+        stream->Reset();
+        status = stream->Decompress(message, max_size, inflate_buffer_);
+    } else {
+        if (!inflate_) inflate_ = std::make_unique<InflateStream>();
+        status = inflate_->Decompress(message, max_size, inflate_buffer_);
+    }
+
+    // swapping keeps both allocations for the next messages
+    if (status == CloseStatus::kNone) message.swap(inflate_buffer_);
+    return status;
+}
+
+}  // namespace server::websocket::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <userver/server/websocket/server.hpp>
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket::impl {
+
+/// Parameters of the permessage-deflate extension agreed during the handshake,
+/// see https://datatracker.ietf.org/doc/html/rfc7692
+struct DeflateParams final {
+    bool server_no_context_takeover = false;
+    bool client_no_context_takeover = false;
+    // the client asked for server_max_window_bits=15, it is echoed back
+    bool server_max_window_bits = false;
+};
+
+/// Picks the first acceptable permessage-deflate offer of the
+/// Sec-WebSocket-Extensions request header. Offers that limit the server window
+/// to less than 15 bits are declined.
+std::optional<DeflateParams> NegotiatePermessageDeflate(std::string_view extensions, const Config& config);
+
+/// Value of the Sec-WebSocket-Extensions response header
+std::string MakePermessageDeflateResponse(const DeflateParams& params);
+
+/// Compresses the message payload into `out` without the context of other
+/// messages, using the thread-local zlib stream
+void CompressNoContextTakeover(utils::span<const std::byte> message, int level, std::string& out);
+
+class DeflateStream;
+class InflateStream;
+
+/// Per-connection compression state of the permessage-deflate extension.
+///
+/// If a side does not take over the context between the messages, the
+/// connection does not hold the zlib stream of that side: a thread-local one
+/// is reset and reused by all the connections of the thread, saving hundreds
+/// of KiB per idle connection.
+class PermessageDeflate final {
+public:
+    PermessageDeflate(const DeflateParams& params, int level);
+    ~PermessageDeflate();
+
+    /// Compresses the message payload into `out`
+    void Compress(utils::span<const std::byte> message, std::string& out);
+
+    /// Decompresses the message payload in place
+    CloseStatus Decompress(std::string& message, unsigned max_size);
+
+    const DeflateParams& GetParams() const { return params_; }
+
+private:
+    const DeflateParams params_;
+    const int level_;
+
+    std::unique_ptr<DeflateStream> deflate_;
+    std::unique_ptr<InflateStream> inflate_;
+    std::string inflate_buffer_;
+};
+
+/// Creates a connection that uses the permessage-deflate extension if it is
+/// agreed during the handshake
+std::shared_ptr<WebSocketConnection> MakeWebSocket(
+    std::unique_ptr<engine::io::RwBase>&& socket,
+    engine::io::Sockaddr&& peer_name,
+    const Config& config,
+    const std::optional<DeflateParams>& deflate_params
+);
+
+}  // namespace server::websocket::impl
+
+USERVER_NAMESPACE_END
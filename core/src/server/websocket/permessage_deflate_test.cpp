@@ -0,0 +1,109 @@
+#include <server/websocket/permessage_deflate.hpp>
+
+#include <string>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::websocket::CloseStatus;
+using server::websocket::Config;
+namespace impl = server::websocket::impl;
+
+Config MakeDeflateConfig() {
+    Config config;
+    config.permessage_deflate = true;
+    return config;
+}
+
+// Returns the size of the compressed message
+std::size_t RoundTrip(impl::PermessageDeflate& server, impl::PermessageDeflate& client, const std::string& message) {
+    std::string data;
+    server.Compress(utils::as_bytes(utils::span<const char>(message)), data);
+    const auto compressed_size = data.size();
+    EXPECT_EQ(client.Decompress(data, message.size()), CloseStatus::kNone);
+    EXPECT_EQ(data, message);
+    return compressed_size;
+}
+
+}  // namespace
+
+TEST(WebsocketPermessageDeflate, Negotiation) {
+    const auto config = MakeDeflateConfig();
+
+    EXPECT_FALSE(impl::NegotiatePermessageDeflate("permessage-deflate", Config{}));
+    EXPECT_FALSE(impl::NegotiatePermessageDeflate("", config));
+    EXPECT_FALSE(impl::NegotiatePermessageDeflate("x-webkit-deflate-frame", config));
+
+    auto params = impl::NegotiatePermessageDeflate("permessage-deflate; client_max_window_bits", config);
+    ASSERT_TRUE(params);
+    EXPECT_EQ(impl::MakePermessageDeflateResponse(*params), "permessage-deflate");
+
+    // the offer with a smaller server window is declined, the next one is accepted
+    params = impl::NegotiatePermessageDeflate(
+        "permessage-deflate; server_max_window_bits=10, "
+        "permessage-deflate; server_no_context_takeover; server_max_window_bits=15",
+        config
+    );
+    ASSERT_TRUE(params);
+    EXPECT_EQ(
+        impl::MakePermessageDeflateResponse(*params),
+        "permessage-deflate; server_no_context_takeover; server_max_window_bits=15"
+    );
+
+    EXPECT_FALSE(impl::NegotiatePermessageDeflate("permessage-deflate; unknown_param", config));
+    EXPECT_FALSE(impl::NegotiatePermessageDeflate("permessage-deflate; client_max_window_bits=16", config));
+}
+
+TEST(WebsocketPermessageDeflate, NegotiationConfigured) {
+    auto config = MakeDeflateConfig();
+    config.client_no_context_takeover = true;
+
+    const auto params = impl::NegotiatePermessageDeflate("permessage-deflate", config);
+    ASSERT_TRUE(params);
+    EXPECT_TRUE(params->client_no_context_takeover);
+    EXPECT_EQ(impl::MakePermessageDeflateResponse(*params), "permessage-deflate; client_no_context_takeover");
+}
+
+UTEST(WebsocketPermessageDeflate, ContextTakeover) {
+    impl::PermessageDeflate server{{}, 6};
+    impl::PermessageDeflate client{{}, 6};
+
+    const std::string message = "The quick brown fox jumps over the lazy dog";
+    const auto first_size = RoundTrip(server, client, message);
+
+    // the same message is compressed better with the context of the first one
+    const auto second_size = RoundTrip(server, client, message);
+    EXPECT_LT(second_size, first_size);
+}
+
+UTEST(WebsocketPermessageDeflate, NoContextTakeover) {
+    impl::DeflateParams params;
+    params.server_no_context_takeover = true;
+    params.client_no_context_takeover = true;
+    impl::PermessageDeflate server{params, 1};
+    impl::PermessageDeflate client{params, 9};
+
+    const std::string message = "The quick brown fox jumps over the lazy dog";
+    const auto first_size = RoundTrip(server, client, message);
+    EXPECT_EQ(RoundTrip(server, client, message), first_size);
+    RoundTrip(server, client, "");
+}
+
+UTEST(WebsocketPermessageDeflate, Errors) {
+    impl::PermessageDeflate server{{}, 6};
+    impl::PermessageDeflate client{{}, 6};
+
+    const std::string message(1000, 'a');
+    std::string compressed;
+    server.Compress(utils::as_bytes(utils::span<const char>(message)), compressed);
+    EXPECT_EQ(client.Decompress(compressed, message.size() - 1), CloseStatus::kTooBigData);
+
+    impl::PermessageDeflate other_client{{}, 6};
+    std::string garbage = "\xff\xff\xff\xff";
+    EXPECT_EQ(other_client.Decompress(garbage, 1000), CloseStatus::kBadMessageData);
+}
+
+USERVER_NAMESPACE_END
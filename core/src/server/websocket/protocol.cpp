@@ -55,14 +55,21 @@ union Mask32 {
     uint8_t mask8[4];
 };
 
-void XorMaskInplace(uint8_t* dest, size_t len, Mask32 mask) {
-    auto* dest32 = reinterpret_cast<uint32_t*>(dest);
-    while (len >= sizeof(uint32_t)) {
-        *(dest32++) ^= mask.mask32;
-        len -= sizeof(uint32_t);
+// The payload is processed in 64-bit words, the compiler vectorizes the loop.
+// memcpy keeps the unaligned accesses well-defined and compiles to plain loads.
+void XorMaskInplace(char* dest, size_t len, Mask32 mask) {
+    uint64_t mask64 = 0;
+    std::memcpy(&mask64, &mask.mask32, sizeof(mask.mask32));
+    std::memcpy(reinterpret_cast<char*>(&mask64) + sizeof(mask.mask32), &mask.mask32, sizeof(mask.mask32));
+
+    size_t i = 0;
+    for (; i + sizeof(mask64) <= len; i += sizeof(mask64)) {
+        uint64_t word = 0;
+        std::memcpy(&word, dest + i, sizeof(word));
+        word ^= mask64;
+        std::memcpy(dest + i, &word, sizeof(word));
     }
-    auto* dest8 = reinterpret_cast<uint8_t*>(dest32);
-    for (unsigned i = 0; i < len; ++i) *(dest8++) ^= mask.mask8[i];
+    for (; i < len; ++i) dest[i] ^= static_cast<char>(mask.mask8[i % sizeof(mask.mask32)]);
 }
 
 template <class T, class V>
@@ -75,8 +82,13 @@ void PushRaw(const T& value, V& data) {
 
 namespace frames {
 
-boost::container::small_vector<char, impl::kMaxFrameHeaderSize>
-DataFrameHeader(utils::span<const std::byte> data, bool is_text, Continuation is_continuation, Final is_final) {
+boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
+    utils::span<const std::byte> data,
+    bool is_text,
+    Continuation is_continuation,
+    Final is_final,
+    Compressed is_compressed
+) {
     boost::container::small_vector<char, impl::kMaxFrameHeaderSize> frame;
 
     frame.resize(sizeof(WSHeader));
@@ -87,6 +99,7 @@ DataFrameHeader(utils::span<const std::byte> data, bool is_text, Continuation is
     hdr->bits.fin = is_final == Final::kYes ? 1 : 0;
     hdr->bits.opcode = is_text ? kText : kBinary;
     if (is_continuation == Continuation::kYes) hdr->bits.opcode = kContinuation;
+    if (is_compressed == Compressed::kYes) hdr->bits.reserved = kReservedCompressed;
 
     if (data.size() <= 125) {
         hdr->bits.payloadLen = data.size();
@@ -165,6 +178,13 @@ CloseStatus ReadWSFrameImpl(
     if (engine::current_task::ShouldCancel()) return CloseStatus::kGoingAway;
 
     const bool isDataFrame = (hdr.bits.opcode & (kText | kBinary)) || hdr.bits.opcode == kContinuation;
+
+    if (hdr.bits.reserved & ~kReservedCompressed) return CloseStatus::kProtocolError;
+    if (hdr.bits.reserved & kReservedCompressed) {
+        // only the first frame of a data message may be marked as compressed
+        const bool isFirstDataFrame = hdr.bits.opcode == kText || hdr.bits.opcode == kBinary;
+        if (!frame.deflate_negotiated || !isFirstDataFrame) return CloseStatus::kProtocolError;
+    }
     if (hdr.bits.payloadLen <= 125) {
         payload_len = hdr.bits.payloadLen;
     } else if (hdr.bits.payloadLen == 126) {
@@ -203,7 +223,8 @@ CloseStatus ReadWSFrameImpl(
         RecvExactly(io, MakeSpan(frame.payload->data() + newPayloadOffset, payload_len), {});
         if (engine::current_task::ShouldCancel()) return CloseStatus::kGoingAway;
 
-        if (mask.mask32) XorMaskInplace(reinterpret_cast<uint8_t*>(frame.payload->data()), frame.payload->size(), mask);
+        // each frame has its own mask, the frames received before are already unmasked
+        if (mask.mask32) XorMaskInplace(frame.payload->data() + newPayloadOffset, payload_len, mask);
     }
     char opcode = hdr.bits.opcode;
     char fin = hdr.bits.fin;
@@ -222,9 +243,10 @@ CloseStatus ReadWSFrameImpl(
                     boost::endian::big_to_native(*(reinterpret_cast<CloseStatusInt const*>(frame.payload->data())));
             break;
         case kText:
-            frame.is_text = true;
-            [[fallthrough]];
         case kBinary:
+            frame.is_text = opcode == kText;
+            frame.is_compressed = (hdr.bits.reserved & kReservedCompressed) != 0;
+            [[fallthrough]];
         case kContinuation:
             frame.waiting_continuation = !fin;
             break;
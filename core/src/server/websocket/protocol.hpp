@@ -63,6 +63,9 @@ static_assert(sizeof(WSHeader) == 2);
 
 constexpr inline unsigned int kMaxFrameHeaderSize = sizeof(WSHeader) + sizeof(uint64_t);
 
+// RSV1 in WSHeader::bits::reserved
+constexpr inline unsigned char kReservedCompressed = 0b100;
+
 namespace frames {
 
 enum class Continuation {
@@ -75,8 +78,20 @@ enum class Final {
     kNo,
 };
 
-boost::container::small_vector<char, impl::kMaxFrameHeaderSize>
-DataFrameHeader(utils::span<const std::byte> data, bool is_text, Continuation is_continuation, Final is_final);
+/// The payload of the message is compressed by the permessage-deflate
+/// extension, only set on the first frame of a message
+enum class Compressed {
+    kYes,
+    kNo,
+};
+
+boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
+    utils::span<const std::byte> data,
+    bool is_text,
+    Continuation is_continuation,
+    Final is_final,
+    Compressed is_compressed = Compressed::kNo
+);
 std::array<char, sizeof(WSHeader)> MakeControlFrame(WSOpcodes opcode, utils::span<const std::byte> data = {});
 std::string CloseFrame(CloseStatusInt status_code);
 
@@ -92,6 +107,9 @@ struct FrameParserState {
     bool pong_received = false;
     bool waiting_continuation = false;
     bool is_text = false;
+    // RSV1 marks compressed messages if permessage-deflate is negotiated
+    bool deflate_negotiated = false;
+    bool is_compressed = false;
     CloseStatusInt remote_close_status = 0;
     size_t offset_when_noblock = 0;
 
@@ -7,6 +7,7 @@
 #include <userver/utils/fast_scope_guard.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
+#include "permessage_deflate.hpp"
 #include "protocol.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -25,15 +26,63 @@ Message CloseMessage(CloseStatus status) { return {{}, status, false}; }
 
 utils::span<const std::byte> MakeBinarySpan(utils::span<const char> span) { return utils::as_bytes(span); }
 
+void AppendDataFrames(
+    std::string& out,
+    utils::span<const std::byte> data,
+    bool is_text,
+    impl::frames::Compressed is_compressed,
+    unsigned fragment_size
+) {
+    auto continuation = impl::frames::Continuation::kNo;
+    while (data.size() > fragment_size && fragment_size > 0) {
+        const auto header = impl::frames::DataFrameHeader(
+            data.first(fragment_size), is_text, continuation, impl::frames::Final::kNo, is_compressed
+        );
+        out.append(header.begin(), header.end());
+        out.append(reinterpret_cast<const char*>(data.data()), fragment_size);
+        continuation = impl::frames::Continuation::kYes;
+        is_compressed = impl::frames::Compressed::kNo;
+        data = data.last(data.size() - fragment_size);
+    }
+    const auto header =
+        impl::frames::DataFrameHeader(data, is_text, continuation, impl::frames::Final::kYes, is_compressed);
+    out.append(header.begin(), header.end());
+    out.append(reinterpret_cast<const char*>(data.data()), data.size());
+}
+
 }  // namespace
 
 Config Parse(const yaml_config::YamlConfig& config, formats::parse::To<Config>) {
     return {
         config["max-remote-payload"].As<unsigned>(65536),
         config["fragment-size"].As<unsigned>(65536),
+        config["permessage-deflate"].As<bool>(false),
+        config["server-no-context-takeover"].As<bool>(false),
+        config["client-no-context-takeover"].As<bool>(false),
+        config["deflate-level"].As<int>(6),
+        config["deflate-min-size"].As<unsigned>(128),
     };
 }
 
+PreparedMessage::PreparedMessage(std::string_view data, bool is_text, const Config& config)
+    : payload_size_(data.size()) {
+    const auto payload = MakeBinarySpan(data);
+    frames_.reserve(data.size() + impl::kMaxFrameHeaderSize);
+    AppendDataFrames(frames_, payload, is_text, impl::frames::Compressed::kNo, config.fragment_size);
+
+    if (config.permessage_deflate && !data.empty() && data.size() >= config.deflate_min_size) {
+        std::string compressed;
+        impl::CompressNoContextTakeover(payload, config.deflate_level, compressed);
+        AppendDataFrames(
+            compressed_frames_,
+            MakeBinarySpan(compressed),
+            is_text,
+            impl::frames::Compressed::kYes,
+            config.fragment_size
+        );
+    }
+}
+
 class WebSocketConnectionImpl final : public WebSocketConnection {
 public:
 private:
@@ -59,13 +108,24 @@ private:
 
     Config config;
 
+    // Set if permessage-deflate is agreed during the handshake
+    std::optional<impl::PermessageDeflate> deflate_;
+    // Compressed payload of the message being sent, only used by Send()
+    std::string send_buffer_;
+
 public:
     WebSocketConnectionImpl(
         std::unique_ptr<engine::io::RwBase> io_,
         const engine::io::Sockaddr& remote_addr,
-        const Config& server_config
+        const Config& server_config,
+        const std::optional<impl::DeflateParams>& deflate_params
     )
-        : io(std::move(io_)), remote_addr_(remote_addr), config(server_config) {}
+        : io(std::move(io_)), remote_addr_(remote_addr), config(server_config) {
+        if (deflate_params) {
+            deflate_.emplace(*deflate_params, config.deflate_level);
+            frame_.deflate_negotiated = true;
+        }
+    }
 
     ~WebSocketConnectionImpl() override { LOG_TRACE() << "Websocket connection closed"; }
 
@@ -73,6 +133,17 @@ public:
         stats_.msg_sent++;
         stats_.bytes_sent += message.data.size();
 
+        // Compression is done before taking the mutex, so that it does not delay
+        // the "PONG" responses
+        auto compressed = impl::frames::Compressed::kNo;
+        const bool is_data = message.opcode == impl::WSOpcodes::kText || message.opcode == impl::WSOpcodes::kBinary;
+        if (deflate_ && is_data && !message.close_status && message.data.size() >= config.deflate_min_size) {
+            deflate_->Compress(message.data, send_buffer_);
+            message.data = MakeBinarySpan(send_buffer_);
+            compressed = impl::frames::Compressed::kYes;
+            stats_.msg_sent_compressed++;
+        }
+
         const std::unique_lock lock(write_mutex_);
 
         LOG_TRACE() << "Write message " << message.data.size() << " bytes";
@@ -92,14 +163,20 @@ public:
                     data_to_send.first(config.fragment_size),
                     message.opcode == impl::WSOpcodes::kText,
                     continuation,
-                    impl::frames::Final::kNo
+                    impl::frames::Final::kNo,
+                    compressed
                 );
                 SendExactly(*io, data_frame_header, data_to_send.first(config.fragment_size));
                 continuation = impl::frames::Continuation::kYes;
+                compressed = impl::frames::Compressed::kNo;
                 data_to_send = data_to_send.last(data_to_send.size() - config.fragment_size);
             }
             const auto data_frame_header = impl::frames::DataFrameHeader(
-                data_to_send, message.opcode == impl::WSOpcodes::kText, continuation, impl::frames::Final::kYes
+                data_to_send,
+                message.opcode == impl::WSOpcodes::kText,
+                continuation,
+                impl::frames::Final::kYes,
+                compressed
             );
             SendExactly(*io, data_frame_header, data_to_send);
         }
@@ -123,6 +200,23 @@ public:
         SendExtended(mext);
     }
 
+    void SendPrepared(const PreparedMessage& message) override {
+        // The shared compressed frames do not depend on the previous messages,
+        // so they are only valid for the connections that agreed to it
+        const bool use_compressed = deflate_ && deflate_->GetParams().server_no_context_takeover &&
+                                    !message.GetCompressedFrames().empty();
+        const auto& frames = use_compressed ? message.GetCompressedFrames() : message.GetFrames();
+
+        stats_.msg_sent++;
+        stats_.bytes_sent += message.GetPayloadSize();
+        if (use_compressed) stats_.msg_sent_compressed++;
+
+        const std::unique_lock lock(write_mutex_);
+        LOG_TRACE() << "Write prepared message " << frames.size() << " bytes";
+        if (io->WriteAll(frames.data(), frames.size(), {}) != frames.size())
+            throw(engine::io::IoException() << "Socket closed during transfer");
+    }
+
     bool RecvImpl(Message& msg, bool do_not_wait_for_message_header) {
         msg.data.resize(0);  // do not call .clear() to keep the allocated memory
         frame_.payload = &msg.data;
@@ -177,6 +271,20 @@ public:
             }
             if (frame_.waiting_continuation) continue;
 
+            if (frame_.is_compressed) {
+                // the frame parser only accepts compressed frames if the extension is agreed
+                UASSERT(deflate_);
+                frame_.is_compressed = false;
+                const auto inflate_status = deflate_->Decompress(msg.data, config.max_remote_payload);
+                if (inflate_status != CloseStatus::kNone) {
+                    MessageExtended close_msg{{}, impl::WSOpcodes::kClose, inflate_status};
+                    SendExtended(close_msg);
+                    msg = CloseMessage(inflate_status);
+                    return true;
+                }
+                stats_.msg_recv_compressed++;
+            }
+
             msg.is_text = frame_.is_text;
             stats_.msg_recv++;
             stats_.bytes_recv += msg.data.size();
@@ -203,6 +311,10 @@ public:
         span.AddTag("msg_recv", stats_.msg_recv.load());
         span.AddTag("bytes_sent", stats_.bytes_sent.load());
         span.AddTag("bytes_recv", stats_.bytes_recv.load());
+        if (deflate_) {
+            span.AddTag("msg_sent_compressed", stats_.msg_sent_compressed.load());
+            span.AddTag("msg_recv_compressed", stats_.msg_recv_compressed.load());
+        }
     }
 
     void AddStatistics(Statistics& stats) const override {
@@ -210,6 +322,8 @@ public:
         stats.msg_recv += stats_.msg_recv;
         stats.bytes_sent += stats_.bytes_sent;
         stats.bytes_recv += stats_.bytes_recv;
+        stats.msg_sent_compressed += stats_.msg_sent_compressed;
+        stats.msg_recv_compressed += stats_.msg_recv_compressed;
     }
 };
 
@@ -219,9 +333,22 @@ WebSocketConnection::~WebSocketConnection() = default;
 
 std::shared_ptr<WebSocketConnection>
 MakeWebSocket(std::unique_ptr<engine::io::RwBase>&& socket, engine::io::Sockaddr&& peer_name, const Config& config) {
-    return std::make_shared<WebSocketConnectionImpl>(std::move(socket), std::move(peer_name), config);
+    return impl::MakeWebSocket(std::move(socket), std::move(peer_name), config, std::nullopt);
+}
+
+namespace impl {
+
+std::shared_ptr<WebSocketConnection> MakeWebSocket(
+    std::unique_ptr<engine::io::RwBase>&& socket,
+    engine::io::Sockaddr&& peer_name,
+    const Config& config,
+    const std::optional<DeflateParams>& deflate_params
+) {
+    return std::make_shared<WebSocketConnectionImpl>(std::move(socket), std::move(peer_name), config, deflate_params);
 }
 
+}  // namespace impl
+
 }  // namespace server::websocket
 
 USERVER_NAMESPACE_END
@@ -11,6 +11,7 @@
 #include <userver/yaml_config/merge_schemas.hpp>
 
 #include <userver/server/websocket/server.hpp>
+#include "permessage_deflate.hpp"
 #include "protocol.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -61,6 +62,16 @@ std::string WebsocketHandlerBase::HandleRequestThrow(
 
     if (!HandleHandshake(request, response, context)) return "";
 
+    auto deflate_params = websocket::impl::NegotiatePermessageDeflate(
+        request.GetHeader(USERVER_NAMESPACE::http::headers::kWebsocketExtensions), config_
+    );
+    if (deflate_params) {
+        response.SetHeader(
+            USERVER_NAMESPACE::http::headers::kWebsocketExtensions,
+            websocket::impl::MakePermessageDeflateResponse(*deflate_params)
+        );
+    }
+
     response.SetStatus(server::http::HttpStatus::kSwitchingProtocols);
     response.SetHeader(USERVER_NAMESPACE::http::headers::kConnection, "Upgrade");
     response.SetHeader(USERVER_NAMESPACE::http::headers::kUpgrade, "websocket");
@@ -69,9 +80,10 @@ std::string WebsocketHandlerBase::HandleRequestThrow(
     );
 
     request.SetUpgradeWebsocket([context = std::make_shared<server::request::RequestContext>(std::move(context)),
+                                 deflate_params,
                                  this](std::unique_ptr<engine::io::RwBase> socket, engine::io::Sockaddr&& peer_name) {
         tracing::Span span("ws/" + HandlerName());
-        auto ws = websocket::MakeWebSocket(std::move(socket), std::move(peer_name), config_);
+        auto ws = websocket::impl::MakeWebSocket(std::move(socket), std::move(peer_name), config_, deflate_params);
         try {
             Handle(*ws, *context);
         } catch (const std::exception& e) {
@@ -90,6 +102,9 @@ void WebsocketHandlerBase::WriteMetrics(utils::statistics::Writer& writer) const
 
     writer["bytes"]["sent"] = stats_.bytes_sent.load();
     writer["bytes"]["recv"] = stats_.bytes_recv.load();
+
+    writer["msg"]["compressed"]["sent"] = stats_.msg_sent_compressed.load();
+    writer["msg"]["compressed"]["recv"] = stats_.msg_recv_compressed.load();
 }
 
 yaml_config::Schema WebsocketHandlerBase::GetStaticConfigSchema() {
@@ -106,6 +121,28 @@ properties:
         type: integer
         description: max output fragment size
         defaultDescription: 65536
+    permessage-deflate:
+        type: boolean
+        description: accept the permessage-deflate compression extension if the client offers it
+        defaultDescription: false
+    server-no-context-takeover:
+        type: boolean
+        description: do not keep the compression context between the sent messages
+        defaultDescription: false
+    client-no-context-takeover:
+        type: boolean
+        description: ask the client not to keep the compression context between its messages
+        defaultDescription: false
+    deflate-level:
+        type: integer
+        description: compression level of the sent messages
+        defaultDescription: 6
+        minimum: 1
+        maximum: 9
+    deflate-min-size:
+        type: integer
+        description: messages shorter than that are sent uncompressed
+        defaultDescription: 128
 )");
 }
 
@@ -5,8 +5,10 @@
 #include <fmt/compile.h>
 #include <fmt/format.h>
 
+#include <engine/impl/task_accounting.hpp>
 #include <engine/task/task_context.hpp>
 #include <logging/log_helper_impl.hpp>
+#include <tracing/tail_sampling.hpp>
 #include <userver/engine/task/local_variable.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
@@ -96,6 +98,7 @@ Span::Impl::Impl(
     : name_(std::move(name)),
       is_no_log_span_(tracing::Tracer::IsNoLogSpan(name_)),
       log_level_(is_no_log_span_ ? logging::Level::kNone : log_level),
+      is_local_root_(parent == nullptr),
       tracer_(std::move(tracer)),
       start_system_time_(std::chrono::system_clock::now()),
       start_steady_time_(std::chrono::steady_clock::now()),
@@ -111,20 +114,40 @@ Span::Impl::Impl(
 }
 
 Span::Impl::~Impl() {
-    if (!ShouldLog()) {
+    if (is_linked()) {
+        unlink();
+        // Attribute the resources used by the task so far to its outermost Span
+        if (engine::impl::IsCurrentTaskAccounted()) {
+            const auto* spans_ptr = task_local_spans.GetOptional();
+            if (!spans_ptr || spans_ptr->empty()) engine::impl::OnOutermostSpanFinished(name_);
+        }
+    }
+
+    if (!log_on_destruction_) {
         return;
     }
 
-    {
-        const impl::DetachLocalSpansScope ignore_local_span;
-        logging::LogHelper lh{logging::GetDefaultLogger(), log_level_, logging::LogClass::kTrace, source_location_};
-        std::move(*this).PutIntoLogger(lh.GetTagWriter());
+    finish_steady_time_ = std::chrono::steady_clock::now();
+    const bool should_log = ShouldLog();
+    if (impl::IsTailSamplingEnabled()) {
+        if (impl::TakeFinishedSpan(*this, should_log)) {
+            return;
+        }
+    } else if (!should_log) {
+        return;
     }
+
+    std::move(*this).LogFinished();
+}
+
+void Span::Impl::LogFinished() && {
+    const impl::DetachLocalSpansScope ignore_local_span;
+    logging::LogHelper lh{logging::GetDefaultLogger(), log_level_, logging::LogClass::kTrace, source_location_};
+    std::move(*this).PutIntoLogger(lh.GetTagWriter());
 }
 
 void Span::Impl::PutIntoLogger(logging::impl::TagWriter writer) && {
-    const auto steady_now = std::chrono::steady_clock::now();
-    const auto duration = steady_now - start_steady_time_;
+    const auto duration = GetDuration();
     const auto total_time_ms = std::chrono::duration_cast<RealMilliseconds>(duration).count();
     const auto timestamp_buffer = StartTsToString(start_system_time_);
     const auto ref_type = GetReferenceType() == ReferenceType::kChild ? kReferenceTypeChild : kReferenceTypeFollows;
@@ -156,6 +179,24 @@ void Span::Impl::LogTo(logging::impl::TagWriter writer) {
     tracer_->LogSpanContextTo(*this, writer);
 }
 
+bool Span::Impl::HasTag(std::string_view key) const {
+    static const logging::LogExtra::Value kEmpty{};
+    return log_extra_inheritable_.GetValue(key) != kEmpty ||
+           (log_extra_local_ && log_extra_local_->GetValue(key) != kEmpty);
+}
+
+bool Span::Impl::HasErrorTag() const {
+    static const logging::LogExtra::Value kError{true};
+    return log_extra_inheritable_.GetValue(kErrorFlag) == kError ||
+           (log_extra_local_ && log_extra_local_->GetValue(kErrorFlag) == kError);
+}
+
+std::chrono::steady_clock::duration Span::Impl::GetDuration() const {
+    const auto finish = finish_steady_time_ == std::chrono::steady_clock::time_point{} ? std::chrono::steady_clock::now()
+                                                                                        : finish_steady_time_;
+    return finish - start_steady_time_;
+}
+
 void Span::Impl::DetachFromCoroStack() { unlink(); }
 
 void Span::Impl::AttachToCoroStack() {
@@ -199,7 +240,7 @@ bool Span::Impl::ShouldLog() const {
 
 void Span::OptionalDeleter::operator()(Span::Impl* impl) const noexcept {
     if (do_delete) {
-        std::default_delete<Impl>{}(impl);
+        SpanImplPool::Push(std::unique_ptr<Impl>{impl});
     }
 }
 
@@ -288,6 +329,22 @@ Span* Span::CurrentSpanUnchecked() {
     return !spans_ptr || spans_ptr->empty() ? nullptr : spans_ptr->back().span_;
 }
 
+std::string_view GetCurrentSpanNameUnchecked() noexcept {
+    auto* current = engine::current_task::GetCurrentTaskContextUnchecked();
+    if (current == nullptr || !current->HasLocalStorage()) return {};
+
+    const auto* spans_ptr = task_local_spans.GetOptional();
+    return !spans_ptr || spans_ptr->empty() ? std::string_view{} : spans_ptr->back().GetName();
+}
+
+std::string_view GetCurrentTaskOutermostSpanNameUnchecked() noexcept {
+    auto* current = engine::current_task::GetCurrentTaskContextUnchecked();
+    if (current == nullptr || !current->HasLocalStorage()) return {};
+
+    const auto* spans_ptr = task_local_spans.GetOptional();
+    return !spans_ptr || spans_ptr->empty() ? std::string_view{} : spans_ptr->front().GetName();
+}
+
 Span Span::MakeSpan(std::string name, std::string_view trace_id, std::string_view parent_span_id) {
     Span span(std::move(name));
     if (!trace_id.empty()) span.pimpl_->SetTraceId(std::string{trace_id});
@@ -19,6 +19,7 @@
 #include <userver/utils/impl/source_location.hpp>
 
 #include <tracing/time_storage.hpp>
+#include <utils/impl/thread_local_mem_pool.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -55,9 +56,16 @@ public:
     // Log this Span specifically
     void PutIntoLogger(logging::impl::TagWriter writer) &&;
 
+    // Log the finished Span into the default logger
+    void LogFinished() &&;
+
+    // For the Spans that were buffered by the tail sampling
+    void DisableLogOnDestruction() noexcept { log_on_destruction_ = false; }
+
     // Add the context of this Span a non-Span-specific log record
     void LogTo(logging::impl::TagWriter writer);
 
+    const std::string& GetName() const noexcept { return name_; }
     const std::string& GetTraceId() const& noexcept { return trace_id_; }
     const std::string& GetSpanId() const& noexcept { return span_id_; }
     const std::string& GetParentId() const& noexcept { return parent_id_; }
@@ -72,6 +80,17 @@ public:
 
     ReferenceType GetReferenceType() const noexcept { return reference_type_; }
 
+    logging::Level GetLogLevel() const noexcept { return log_level_; }
+
+    // Whether the Span had no parent Span in this process
+    bool IsLocalRoot() const noexcept { return is_local_root_; }
+
+    bool HasTag(std::string_view key) const;
+    bool HasErrorTag() const;
+
+    // Duration till finish, or till now for the Spans that are not finished
+    std::chrono::steady_clock::duration GetDuration() const;
+
     void DetachFromCoroStack();
     void AttachToCoroStack();
 
@@ -87,6 +106,8 @@ private:
     const bool is_no_log_span_;
     logging::Level log_level_;
     std::optional<logging::Level> local_log_level_;
+    const bool is_local_root_;
+    bool log_on_destruction_{true};
 
     std::shared_ptr<Tracer> tracer_;
     logging::LogExtra log_extra_inheritable_;
@@ -98,6 +119,8 @@ private:
 
     const std::chrono::system_clock::time_point start_system_time_;
     const std::chrono::steady_clock::time_point start_steady_time_;
+    // Default constructed until the Span finishes
+    std::chrono::steady_clock::time_point finish_steady_time_;
 
     std::string trace_id_;
     std::string span_id_;
@@ -116,9 +139,20 @@ using SpanStack = boost::intrusive::list<Span::Impl, boost::intrusive::constant_
 
 const Span::Impl* GetParentSpanImpl();
 
+// Name of the innermost Span of the current task, empty if there is none.
+// Does not allocate or take locks, so it may be used by the sampling profiler
+// from a signal handler.
+std::string_view GetCurrentSpanNameUnchecked() noexcept;
+
+// Name of the outermost Span of the current task, empty if there is none
+std::string_view GetCurrentTaskOutermostSpanNameUnchecked() noexcept;
+
+// Spans are short-living and created often, their memory is reused
+using SpanImplPool = utils::impl::ThreadLocalMemPool<Span::Impl>;
+
 template <typename... Args>
 Span::Impl* AllocateImpl(Args&&... args) {
-    return new Span::Impl(std::forward<Args>(args)...);
+    return SpanImplPool::Pop(std::forward<Args>(args)...).release();
 }
 
 }  // namespace tracing
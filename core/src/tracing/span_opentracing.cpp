@@ -95,8 +95,7 @@ void Span::Impl::LogOpenTracing() const {
 }
 
 void Span::Impl::DoLogOpenTracing(logging::impl::TagWriter writer) const {
-    const auto steady_now = std::chrono::steady_clock::now();
-    const auto duration = steady_now - start_steady_time_;
+    const auto duration = GetDuration();
     const auto duration_microseconds = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
     auto start_time =
         std::chrono::duration_cast<std::chrono::microseconds>(start_system_time_.time_since_epoch()).count();
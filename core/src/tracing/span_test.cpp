@@ -4,10 +4,12 @@
 #include <logging/log_helper_impl.hpp>
 #include <logging/logging_test.hpp>
 #include <tracing/no_log_spans.hpp>
+#include <tracing/tail_sampling.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/tracing/opentelemetry.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/tags.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/regex.hpp>
@@ -555,6 +557,90 @@ UTEST_F(Span, NoLogWithSetLogLevel) {
     tracing::Tracer::SetNoLogSpans(tracing::NoLogSpans());
 }
 
+namespace {
+
+class TailSamplingScope final {
+public:
+    explicit TailSamplingScope(tracing::TailSamplingConfig config) {
+        config.enabled = true;
+        tracing::impl::SetTailSamplingConfig(std::move(config));
+    }
+
+    ~TailSamplingScope() { tracing::impl::SetTailSamplingConfig(tracing::TailSamplingConfig{}); }
+};
+
+}  // namespace
+
+UTEST_F(Span, TailSamplingDropsBoringTraces) {
+    const TailSamplingScope scope{tracing::TailSamplingConfig{}};
+
+    {
+        auto root = tracing::Span::MakeRootSpan("boring_root");
+        const tracing::Span child("boring_child");
+    }
+
+    logging::LogFlush();
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr("boring_root")));
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr("boring_child")));
+}
+
+UTEST_F(Span, TailSamplingKeepsErrorTraces) {
+    const TailSamplingScope scope{tracing::TailSamplingConfig{}};
+
+    {
+        auto root = tracing::Span::MakeRootSpan("error_root");
+        { const tracing::Span child("ok_child"); }
+        {
+            tracing::Span child("error_child");
+            child.AddTag(tracing::kErrorFlag, true);
+        }
+    }
+
+    logging::LogFlush();
+    EXPECT_THAT(GetStreamString(), HasSubstr("error_root"));
+    EXPECT_THAT(GetStreamString(), HasSubstr("ok_child"));
+    EXPECT_THAT(GetStreamString(), HasSubstr("error_child"));
+}
+
+UTEST_F(Span, TailSamplingKeepsSlowTraces) {
+    tracing::TailSamplingConfig config;
+    config.latency_threshold = std::chrono::milliseconds{10};
+    const TailSamplingScope scope{std::move(config)};
+
+    {
+        auto root = tracing::Span::MakeRootSpan("slow_root");
+        const tracing::Span child("slow_child");
+        engine::SleepFor(std::chrono::milliseconds{20});
+    }
+
+    logging::LogFlush();
+    EXPECT_THAT(GetStreamString(), HasSubstr("slow_root"));
+    EXPECT_THAT(GetStreamString(), HasSubstr("slow_child"));
+}
+
+UTEST_F(Span, TailSamplingKeepsTracesWithTags) {
+    tracing::TailSamplingConfig config;
+    config.tags = {"interesting_tag"};
+    const TailSamplingScope scope{std::move(config)};
+
+    {
+        auto root = tracing::Span::MakeRootSpan("tagged_root");
+        tracing::Span child("tagged_child");
+        child.AddNonInheritableTag("interesting_tag", 1);
+    }
+    {
+        auto root = tracing::Span::MakeRootSpan("plain_root");
+        tracing::Span child("plain_child");
+        child.AddNonInheritableTag("boring_tag", 1);
+    }
+
+    logging::LogFlush();
+    EXPECT_THAT(GetStreamString(), HasSubstr("tagged_root"));
+    EXPECT_THAT(GetStreamString(), HasSubstr("tagged_child"));
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr("plain_root")));
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr("plain_child")));
+}
+
 UTEST_F(Span, ForeignSpan) {
     auto tracer = tracing::MakeTracer("test_service", {});
 
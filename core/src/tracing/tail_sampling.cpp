@@ -0,0 +1,161 @@
+#include <tracing/tail_sampling.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/boost_flat_containers.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/tracing/tags.hpp>
+
+#include <tracing/span_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+namespace impl {
+
+namespace {
+
+// Spans of different traces finish concurrently, sharding reduces the
+// contention on the mutex
+constexpr std::size_t kShardsCount = 16;
+
+struct TraceBuffer final {
+    std::vector<Span::Impl> spans;
+    bool is_interesting{false};
+    // Set when the local root span finishes, spans that finish later follow it
+    std::optional<bool> should_log;
+};
+
+struct Shard final {
+    std::mutex mutex;
+    std::unordered_map<std::string, TraceBuffer> traces;
+    // Creation order of `traces` for eviction
+    std::deque<std::string> order;
+};
+
+std::atomic<bool> is_enabled{false};
+
+auto& GlobalConfig() {
+    static rcu::Variable<TailSamplingConfig> config{};
+    return config;
+}
+
+auto& GlobalShards() {
+    static std::array<Shard, kShardsCount> shards;
+    return shards;
+}
+
+Shard& GetShard(const std::string& trace_id) {
+    return GlobalShards()[std::hash<std::string>{}(trace_id) % kShardsCount];
+}
+
+bool IsInteresting(const Span::Impl& span, const TailSamplingConfig& config) {
+    if (span.GetLogLevel() >= logging::Level::kWarning || span.HasErrorTag() ||
+        span.GetDuration() >= config.latency_threshold) {
+        return true;
+    }
+    for (const auto& tag : config.tags) {
+        if (span.HasTag(tag)) return true;
+    }
+    return false;
+}
+
+TraceBuffer& FindOrCreateTrace(
+    Shard& shard,
+    const std::string& trace_id,
+    const TailSamplingConfig& config,
+    std::vector<Span::Impl>& evicted_spans
+) {
+    if (const auto it = shard.traces.find(trace_id); it != shard.traces.end()) {
+        return it->second;
+    }
+
+    const auto max_traces = std::max<std::size_t>(config.max_traces / kShardsCount, 1);
+    while (shard.traces.size() >= max_traces && !shard.order.empty()) {
+        const auto it = shard.traces.find(shard.order.front());
+        if (it != shard.traces.end()) {
+            // The traces that did not finish in time are dropped
+            std::move(it->second.spans.begin(), it->second.spans.end(), std::back_inserter(evicted_spans));
+            shard.traces.erase(it);
+        }
+        shard.order.pop_front();
+    }
+
+    shard.order.push_back(trace_id);
+    return shard.traces[trace_id];
+}
+
+}  // namespace
+
+void SetTailSamplingConfig(TailSamplingConfig&& config) {
+    const bool enabled = config.enabled;
+    GlobalConfig().Assign(std::move(config));
+    is_enabled = enabled;
+}
+
+bool IsTailSamplingEnabled() noexcept { return is_enabled.load(std::memory_order_relaxed); }
+
+bool TakeFinishedSpan(Span::Impl& span, bool is_loggable) {
+    if (!is_loggable && !span.IsLocalRoot()) return true;
+
+    const auto config = GlobalConfig().Read();
+    const bool is_interesting = IsInteresting(span, *config);
+    auto& shard = GetShard(span.GetTraceId());
+
+    // Logged and destroyed without holding the lock
+    std::vector<Span::Impl> spans_to_log;
+    std::vector<Span::Impl> spans_to_drop;
+    bool is_taken = true;
+
+    {
+        const std::lock_guard lock{shard.mutex};
+        auto& trace = FindOrCreateTrace(shard, span.GetTraceId(), *config, spans_to_drop);
+        trace.is_interesting = trace.is_interesting || is_interesting;
+
+        if (trace.should_log) {
+            is_taken = !is_loggable || !*trace.should_log;
+        } else if (span.IsLocalRoot()) {
+            trace.should_log = trace.is_interesting;
+            auto& destination = trace.is_interesting ? spans_to_log : spans_to_drop;
+            std::move(trace.spans.begin(), trace.spans.end(), std::back_inserter(destination));
+            trace.spans.clear();
+            is_taken = !is_loggable || !trace.is_interesting;
+        } else if (trace.spans.size() < config->max_spans_per_trace) {
+            trace.spans.push_back(std::move(span));
+            trace.spans.back().DisableLogOnDestruction();
+        }
+    }
+
+    for (auto& buffered_span : spans_to_log) {
+        std::move(buffered_span).LogFinished();
+    }
+    return is_taken;
+}
+
+}  // namespace impl
+
+TailSamplingConfig Parse(const formats::json::Value& value, formats::parse::To<TailSamplingConfig>) {
+    TailSamplingConfig result;
+    result.enabled = value["enabled"].As<bool>(result.enabled);
+    result.latency_threshold =
+        std::chrono::milliseconds{value["latency-threshold-ms"].As<std::int64_t>(result.latency_threshold.count())};
+    result.tags = value["tags"].As<boost::container::flat_set<std::string>>({});
+    result.max_traces = value["max-traces"].As<std::size_t>(result.max_traces);
+    result.max_spans_per_trace = value["max-spans-per-trace"].As<std::size_t>(result.max_spans_per_trace);
+    return result;
+}
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
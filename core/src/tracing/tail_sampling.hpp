@@ -0,0 +1,58 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+#include <boost/container/flat_set.hpp>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/tracing/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+class Value;
+}
+
+namespace tracing {
+
+/// Settings of the tail-based sampling of spans, see
+/// @ref USERVER_TRACING_TAIL_SAMPLING
+struct TailSamplingConfig {
+    bool enabled{false};
+
+    /// A trace with a span that took longer is logged
+    std::chrono::milliseconds latency_threshold{1000};
+
+    /// A trace with a span that has any of these tags is logged
+    boost::container::flat_set<std::string> tags;
+
+    /// Limits of the buffered traces and spans in each trace
+    std::size_t max_traces{10000};
+    std::size_t max_spans_per_trace{1000};
+};
+
+TailSamplingConfig Parse(const formats::json::Value&, formats::parse::To<TailSamplingConfig>);
+
+namespace impl {
+
+void SetTailSamplingConfig(TailSamplingConfig&& config);
+
+bool IsTailSamplingEnabled() noexcept;
+
+/// @brief Decides the fate of a finished span.
+///
+/// The loggable spans of a trace are buffered until its local root span
+/// finishes. If the trace turns out interesting, the buffered spans are logged,
+/// otherwise they are dropped.
+///
+/// @returns false if the span should be logged by the caller right away,
+/// true if the span was moved into the buffer or should not be logged.
+bool TakeFinishedSpan(Span::Impl& span, bool is_loggable);
+
+}  // namespace impl
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
@@ -32,6 +32,19 @@ void tracing_happy_log(benchmark::State& state) {
 }
 BENCHMARK(tracing_happy_log);
 
+// Spans around every DB call and cache lookup, their Impl memory is reused
+void tracing_child_span_ctr(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        auto tracer = tracing::MakeTracer("test_service", {});
+        const auto parent = tracer->CreateSpanWithoutParent("parent");
+
+        for ([[maybe_unused]] auto _ : state) {
+            benchmark::DoNotOptimize(parent.CreateChild("child"));
+        }
+    });
+}
+BENCHMARK(tracing_child_span_ctr);
+
 tracing::Span GetSpanWithOpentracingHttpTags(tracing::TracerPtr tracer) {
     auto span = tracer->CreateSpanWithoutParent("name");
     span.AddTag("meta_code", 200);
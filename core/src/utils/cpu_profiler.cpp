@@ -0,0 +1,462 @@
+#include <utils/cpu_profiler.hpp>
+
+#include <sys/time.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include <fmt/format.h>
+#include <boost/stacktrace/frame.hpp>
+#include <boost/stacktrace/safe_dump_to.hpp>
+
+#include <tracing/span_impl.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::cpu_profiler {
+
+namespace {
+
+constexpr std::size_t kMaxDepth = 48;
+constexpr std::size_t kMaxSpanNameSize = 64;
+// The signal handler itself and the signal trampoline of the kernel
+constexpr std::size_t kSkipFrames = 2;
+constexpr std::uint32_t kMaxFrequencyHz = 10'000;
+
+struct Sample final {
+    // +1 for the terminating nullptr written by boost::stacktrace::safe_dump_to
+    const void* frames[kMaxDepth + 1];
+    std::size_t depth;
+    char span_name[kMaxSpanNameSize];
+    std::size_t span_name_size;
+};
+
+// Owned by the active Session
+std::atomic<bool> is_session_active{false};
+std::unique_ptr<Sample[]> samples_storage;
+std::size_t samples_capacity{0};
+
+// Shared with the signal handler
+std::atomic<Sample*> active_samples{nullptr};
+std::atomic<std::size_t> next_sample{0};
+std::atomic<std::size_t> handlers_in_flight{0};
+
+void ProfSignalHandler(int /*signum*/) noexcept {
+    const auto saved_errno = errno;
+
+    handlers_in_flight.fetch_add(1);
+    if (auto* const samples = active_samples.load()) {
+        const auto index = next_sample.fetch_add(1, std::memory_order_relaxed);
+        if (index < samples_capacity) {
+            auto& sample = samples[index];
+            const auto size = boost::stacktrace::safe_dump_to(kSkipFrames, sample.frames, sizeof(sample.frames));
+            sample.depth = size ? size - 1 : 0;
+
+            // Best effort: a Span that is being constructed right now is not
+            // in the span stack yet
+            const auto span_name = tracing::GetCurrentSpanNameUnchecked();
+            sample.span_name_size = std::min(span_name.size(), kMaxSpanNameSize);
+            std::memcpy(sample.span_name, span_name.data(), sample.span_name_size);
+        }
+    }
+    handlers_in_flight.fetch_sub(1);
+
+    errno = saved_errno;
+}
+
+void InstallSignalHandler() {
+    static std::once_flag once;
+    std::call_once(once, [] {
+        // The first unwinding may allocate, do it outside of the signal handler
+        const void* frames[2]{};
+        boost::stacktrace::safe_dump_to(frames, sizeof(frames));
+
+        // The handler is never removed: SIGPROF terminates the process by
+        // default, and a late signal may arrive after the timer is stopped.
+        struct sigaction sa {};
+        sa.sa_handler = &ProfSignalHandler;
+        sa.sa_flags = SA_RESTART;
+        ::sigemptyset(&sa.sa_mask);
+        if (::sigaction(SIGPROF, &sa, nullptr) == -1) {
+            throw std::system_error(errno, std::generic_category(), "sigaction(SIGPROF)");
+        }
+    });
+}
+
+bool SetProfTimer(std::chrono::microseconds period) noexcept {
+    ::itimerval timer{};
+    timer.it_interval.tv_sec = period.count() / 1'000'000;
+    timer.it_interval.tv_usec = period.count() % 1'000'000;
+    timer.it_value = timer.it_interval;
+    return ::setitimer(ITIMER_PROF, &timer, nullptr) == 0;
+}
+
+void ReleaseSamples() noexcept {
+    samples_storage.reset();
+    samples_capacity = 0;
+    is_session_active = false;
+}
+
+std::string GetFrameName(const void* address, bool is_innermost) {
+    // Outer frames hold return addresses, that may point to the next line or
+    // even to the next function
+    const auto* lookup_address = is_innermost ? address : static_cast<const char*>(address) - 1;
+    auto name = boost::stacktrace::frame(lookup_address).name();
+    if (name.empty()) {
+        return fmt::format("{}", address);
+    }
+    return name;
+}
+
+class FrameNames final {
+public:
+    const std::string& Get(const void* address, bool is_innermost) {
+        auto [it, inserted] = names_.try_emplace(address);
+        if (inserted) {
+            it->second = GetFrameName(address, is_innermost);
+        }
+        return it->second;
+    }
+
+private:
+    std::unordered_map<const void*, std::string> names_;
+};
+
+class ProtoWriter final {
+public:
+    void UInt64(std::uint32_t field, std::uint64_t value) {
+        Tag(field, WireType::kVarint);
+        Varint(value);
+    }
+
+    void Bytes(std::uint32_t field, std::string_view value) {
+        Tag(field, WireType::kLengthDelimited);
+        Varint(value.size());
+        buffer_.append(value);
+    }
+
+    void Message(std::uint32_t field, const ProtoWriter& message) { Bytes(field, message.buffer_); }
+
+    void Packed(std::uint32_t field, const std::vector<std::uint64_t>& values) {
+        ProtoWriter packed;
+        for (const auto value : values) {
+            packed.Varint(value);
+        }
+        Message(field, packed);
+    }
+
+    std::string Extract() && { return std::move(buffer_); }
+
+private:
+    enum class WireType : std::uint8_t {
+        kVarint = 0,
+        kLengthDelimited = 2,
+    };
+
+    void Tag(std::uint32_t field, WireType type) {
+        Varint((std::uint64_t{field} << 3) | static_cast<std::uint64_t>(type));
+    }
+
+    void Varint(std::uint64_t value) {
+        while (value >= 0x80) {
+            buffer_.push_back(static_cast<char>((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        buffer_.push_back(static_cast<char>(value));
+    }
+
+    std::string buffer_;
+};
+
+class StringTable final {
+public:
+    StringTable() { Index({}); }
+
+    std::uint64_t Index(std::string_view value) {
+        const auto [it, inserted] = indices_.try_emplace(std::string{value}, strings_.size());
+        if (inserted) {
+            strings_.push_back(&it->first);
+        }
+        return it->second;
+    }
+
+    void WriteTo(ProtoWriter& profile) const {
+        for (const auto* string : strings_) {
+            profile.Bytes(6, *string);
+        }
+    }
+
+private:
+    std::unordered_map<std::string, std::uint64_t> indices_;
+    std::vector<const std::string*> strings_;
+};
+
+struct Mapping final {
+    std::uintptr_t start{0};
+    std::uintptr_t limit{0};
+    std::uint64_t offset{0};
+    std::string path;
+};
+
+// Executable mappings allow pprof to re-symbolize the profile with the binaries
+std::vector<Mapping> ReadExecutableMappings() {
+    std::vector<Mapping> result;
+#ifdef __linux__
+    std::ifstream maps{"/proc/self/maps"};
+    std::string line;
+    while (std::getline(maps, line)) {
+        // start-limit perms offset dev inode [path]
+        Mapping mapping;
+        char perms[5]{};
+        int path_offset = 0;
+        if (std::sscanf(
+                line.c_str(),
+                "%lx-%lx %4s %lx %*s %*s %n",
+                &mapping.start,
+                &mapping.limit,
+                perms,
+                &mapping.offset,
+                &path_offset
+            ) < 4 ||
+            perms[2] != 'x') {
+            continue;
+        }
+        mapping.path = line.substr(std::min<std::size_t>(path_offset, line.size()));
+        result.push_back(std::move(mapping));
+    }
+#endif
+    return result;
+}
+
+}  // namespace
+
+ProfilerBusyError::ProfilerBusyError() : std::runtime_error("Another CPU profiling session is in progress") {}
+
+Session::Session(const Settings& settings) {
+    UINVARIANT(
+        settings.frequency_hz > 0 && settings.frequency_hz <= kMaxFrequencyHz,
+        fmt::format("CPU profiler frequency must be in [1, {}] Hz", kMaxFrequencyHz)
+    );
+    UINVARIANT(settings.max_samples > 0, "CPU profiler requires a positive samples limit");
+
+    if (is_session_active.exchange(true)) {
+        throw ProfilerBusyError();
+    }
+    utils::FastScopeGuard release_guard{[]() noexcept { ReleaseSamples(); }};
+
+    InstallSignalHandler();
+
+    // Not value-initialized: the pages are touched only by the taken samples
+    samples_storage.reset(new Sample[settings.max_samples]);
+    samples_capacity = settings.max_samples;
+    next_sample = 0;
+    active_samples = samples_storage.get();
+
+    period_ = std::chrono::nanoseconds{std::chrono::seconds{1}} / settings.frequency_hz;
+    start_time_ = std::chrono::system_clock::now();
+    start_steady_time_ = std::chrono::steady_clock::now();
+    if (!SetProfTimer(std::chrono::duration_cast<std::chrono::microseconds>(period_))) {
+        const auto error = errno;
+        active_samples = nullptr;
+        throw std::system_error(error, std::generic_category(), "setitimer(ITIMER_PROF)");
+    }
+
+    release_guard.Release();
+}
+
+Session::~Session() {
+    if (!is_stopped_) {
+        DoStop();
+        ReleaseSamples();
+    }
+}
+
+Profile Session::Stop() {
+    UINVARIANT(!is_stopped_, "CPU profiling session is already stopped");
+    DoStop();
+    const utils::FastScopeGuard release_guard{[]() noexcept { ReleaseSamples(); }};
+
+    Profile profile;
+    profile.period = period_;
+    profile.start_time = start_time_;
+    profile.duration = std::chrono::steady_clock::now() - start_steady_time_;
+
+    const auto recorded = next_sample.load();
+    const auto taken = std::min(recorded, samples_capacity);
+    profile.lost_samples = recorded - taken;
+
+    std::map<std::pair<std::string_view, std::vector<const void*>>, std::uint64_t> counts;
+    for (std::size_t i = 0; i < taken; ++i) {
+        const auto& sample = samples_storage[i];
+        ++counts[{
+            std::string_view{sample.span_name, sample.span_name_size},
+            std::vector<const void*>(sample.frames, sample.frames + sample.depth),
+        }];
+    }
+
+    profile.stacks.reserve(counts.size());
+    for (auto& [key, count] : counts) {
+        profile.stacks.push_back(Profile::Stack{std::string{key.first}, key.second, count});
+    }
+    return profile;
+}
+
+void Session::DoStop() noexcept {
+    [[maybe_unused]] const bool timer_stopped = SetProfTimer(std::chrono::microseconds{0});
+    UASSERT(timer_stopped);
+
+    active_samples = nullptr;
+    // The handlers that already loaded the samples pointer may still write
+    while (handlers_in_flight.load() != 0) {
+        std::this_thread::yield();
+    }
+    is_stopped_ = true;
+}
+
+std::string ToPprof(const Profile& profile) {
+    // See https://github.com/google/pprof/blob/main/proto/profile.proto
+    StringTable strings;
+    FrameNames frame_names;
+    ProtoWriter result;
+
+    const auto write_value_type = [&](std::uint32_t field, std::string_view type, std::string_view unit) {
+        ProtoWriter value_type;
+        value_type.UInt64(1, strings.Index(type));
+        value_type.UInt64(2, strings.Index(unit));
+        result.Message(field, value_type);
+    };
+    write_value_type(1, "samples", "count");
+    write_value_type(1, "cpu", "nanoseconds");
+
+    const auto mappings = ReadExecutableMappings();
+    for (std::size_t i = 0; i < mappings.size(); ++i) {
+        ProtoWriter mapping;
+        mapping.UInt64(1, i + 1);
+        mapping.UInt64(2, mappings[i].start);
+        mapping.UInt64(3, mappings[i].limit);
+        mapping.UInt64(4, mappings[i].offset);
+        mapping.UInt64(5, strings.Index(mappings[i].path));
+        mapping.UInt64(7, 1);  // has_functions
+        result.Message(3, mapping);
+    }
+    const auto find_mapping_id = [&mappings](const void* address) -> std::uint64_t {
+        const auto value = reinterpret_cast<std::uintptr_t>(address);
+        for (std::size_t i = 0; i < mappings.size(); ++i) {
+            if (mappings[i].start <= value && value < mappings[i].limit) return i + 1;
+        }
+        return 0;
+    };
+
+    std::unordered_map<const void*, std::uint64_t> location_ids;
+    std::unordered_map<std::string_view, std::uint64_t> function_ids;
+    ProtoWriter locations;
+    ProtoWriter functions;
+
+    const auto get_location_id = [&](const void* address, bool is_innermost) {
+        const auto [location_it, inserted] = location_ids.try_emplace(address, location_ids.size() + 1);
+        if (!inserted) return location_it->second;
+
+        const auto& name = frame_names.Get(address, is_innermost);
+        const auto [function_it, function_inserted] = function_ids.try_emplace(name, function_ids.size() + 1);
+        if (function_inserted) {
+            ProtoWriter function;
+            function.UInt64(1, function_it->second);
+            function.UInt64(2, strings.Index(name));
+            function.UInt64(3, strings.Index(name));
+            functions.Message(5, function);
+        }
+
+        ProtoWriter line;
+        line.UInt64(1, function_it->second);
+
+        ProtoWriter location;
+        location.UInt64(1, location_it->second);
+        if (const auto mapping_id = find_mapping_id(address)) {
+            location.UInt64(2, mapping_id);
+        }
+        location.UInt64(3, reinterpret_cast<std::uintptr_t>(address));
+        location.Message(4, line);
+        locations.Message(4, location);
+        return location_it->second;
+    };
+
+    const auto span_key = strings.Index("span");
+    std::vector<std::uint64_t> ids;
+    for (const auto& stack : profile.stacks) {
+        ids.clear();
+        for (std::size_t i = 0; i < stack.frames.size(); ++i) {
+            ids.push_back(get_location_id(stack.frames[i], i == 0));
+        }
+
+        ProtoWriter sample;
+        sample.Packed(1, ids);
+        sample.Packed(2, {stack.count, stack.count * static_cast<std::uint64_t>(profile.period.count())});
+        if (!stack.span_name.empty()) {
+            ProtoWriter label;
+            label.UInt64(1, span_key);
+            label.UInt64(2, strings.Index(stack.span_name));
+            sample.Message(3, label);
+        }
+        result.Message(2, sample);
+    }
+
+    auto result_string = std::move(result).Extract();
+    result_string += std::move(locations).Extract();
+    result_string += std::move(functions).Extract();
+
+    ProtoWriter tail;
+    strings.WriteTo(tail);
+    tail.UInt64(
+        9,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(profile.start_time.time_since_epoch()).count()
+    );
+    tail.UInt64(10, profile.duration.count());
+    {
+        ProtoWriter period_type;
+        period_type.UInt64(1, strings.Index("cpu"));
+        period_type.UInt64(2, strings.Index("nanoseconds"));
+        tail.Message(11, period_type);
+    }
+    tail.UInt64(12, profile.period.count());
+
+    return result_string + std::move(tail).Extract();
+}
+
+std::string ToFolded(const Profile& profile) {
+    FrameNames frame_names;
+    std::map<std::string, std::uint64_t> lines;
+
+    std::string line;
+    for (const auto& stack : profile.stacks) {
+        line = stack.span_name.empty() ? "[no span]" : stack.span_name;
+        for (std::size_t i = stack.frames.size(); i > 0; --i) {
+            line += ';';
+            line += frame_names.Get(stack.frames[i - 1], i == 1);
+        }
+        lines[line] += stack.count;
+    }
+
+    std::string result;
+    for (const auto& [stack, count] : lines) {
+        fmt::format_to(std::back_inserter(result), "{} {}\n", stack, count);
+    }
+    return result;
+}
+
+}  // namespace utils::cpu_profiler
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+/// In-process sampling CPU profiler.
+///
+/// The process CPU time is sampled with `setitimer(ITIMER_PROF)`: the kernel
+/// delivers SIGPROF to the thread that consumes CPU, and the signal handler
+/// records the stacktrace of that thread along with the name of the current
+/// tracing::Span of the running task.
+namespace utils::cpu_profiler {
+
+/// Thrown if another profiling session is already in progress
+class ProfilerBusyError final : public std::runtime_error {
+public:
+    ProfilerBusyError();
+};
+
+struct Settings final {
+    /// Samples per second of the consumed process CPU time
+    std::uint32_t frequency_hz{99};
+    /// Samples above this count are dropped and counted as lost
+    std::size_t max_samples{1 << 16};
+};
+
+struct Profile final {
+    struct Stack final {
+        /// Empty for the samples taken outside of a Span
+        std::string span_name;
+        /// Innermost frame first
+        std::vector<const void*> frames;
+        std::uint64_t count{0};
+    };
+
+    std::vector<Stack> stacks;
+    std::uint64_t lost_samples{0};
+    std::chrono::nanoseconds period{};
+    std::chrono::system_clock::time_point start_time{};
+    std::chrono::nanoseconds duration{};
+};
+
+/// Profiling session, only one may exist at a time in a process
+class Session final {
+public:
+    /// @throws ProfilerBusyError if another session is in progress
+    explicit Session(const Settings& settings);
+    ~Session();
+
+    Session(Session&&) = delete;
+    Session& operator=(Session&&) = delete;
+
+    /// Stops sampling and returns the aggregated samples, may be called once
+    Profile Stop();
+
+private:
+    void DoStop() noexcept;
+
+    bool is_stopped_{false};
+    std::chrono::system_clock::time_point start_time_;
+    std::chrono::steady_clock::time_point start_steady_time_;
+    std::chrono::nanoseconds period_;
+};
+
+/// Serializes the profile into the `profile.proto` format understood by pprof,
+/// span names are attached to the samples as a `span` label
+std::string ToPprof(const Profile& profile);
+
+/// Serializes the profile into the folded stacks format of flamegraph.pl:
+/// `span;outermost_frame;...;innermost_frame count` per line
+std::string ToFolded(const Profile& profile);
+
+}  // namespace utils::cpu_profiler
+
+USERVER_NAMESPACE_END
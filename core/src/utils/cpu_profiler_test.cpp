@@ -0,0 +1,86 @@
+#include <utils/cpu_profiler.hpp>
+
+#include <chrono>
+
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace cp = utils::cpu_profiler;
+
+constexpr std::string_view kSpanName = "cpu_profiler_busy_span";
+
+__attribute__((noinline)) std::uint64_t BurnCpu(std::chrono::milliseconds duration) {
+    std::uint64_t result = 0;
+    const auto deadline = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < deadline) {
+        for (int i = 0; i < 1000; ++i) {
+            result = result * 6364136223846793005ULL + 1442695040888963407ULL;
+        }
+    }
+    return result;
+}
+
+cp::Profile ProfileBusySpan() {
+    cp::Settings settings;
+    settings.frequency_hz = 1000;
+    cp::Session session{settings};
+    {
+        tracing::Span span{std::string{kSpanName}};
+        [[maybe_unused]] volatile auto result = BurnCpu(std::chrono::milliseconds{300});
+    }
+    return session.Stop();
+}
+
+}  // namespace
+
+UTEST(CpuProfiler, AttributesSamplesToSpan) {
+    const auto profile = ProfileBusySpan();
+
+    std::uint64_t total = 0;
+    std::uint64_t in_span = 0;
+    for (const auto& stack : profile.stacks) {
+        total += stack.count;
+        if (stack.span_name == kSpanName) in_span += stack.count;
+        EXPECT_FALSE(stack.frames.empty());
+    }
+    EXPECT_GT(in_span, 0);
+    EXPECT_GE(total, in_span);
+    EXPECT_EQ(profile.lost_samples, 0);
+    EXPECT_EQ(profile.period, std::chrono::milliseconds{1});
+
+    const auto folded = cp::ToFolded(profile);
+    EXPECT_NE(folded.find(kSpanName), std::string::npos) << folded;
+
+    const auto pprof = cp::ToPprof(profile);
+    EXPECT_NE(pprof.find(kSpanName), std::string::npos);
+    EXPECT_NE(pprof.find("nanoseconds"), std::string::npos);
+}
+
+UTEST(CpuProfiler, SingleSession) {
+    cp::Session session{cp::Settings{}};
+    EXPECT_THROW(cp::Session{cp::Settings{}}, cp::ProfilerBusyError);
+    session.Stop();
+
+    // The next session may start once the previous one is stopped
+    EXPECT_NO_THROW(cp::Session{cp::Settings{}});
+}
+
+UTEST(CpuProfiler, SamplesLimit) {
+    cp::Settings settings;
+    settings.frequency_hz = 1000;
+    settings.max_samples = 1;
+    cp::Session session{settings};
+    [[maybe_unused]] volatile auto result = BurnCpu(std::chrono::milliseconds{100});
+    const auto profile = session.Stop();
+
+    std::uint64_t total = 0;
+    for (const auto& stack : profile.stacks) total += stack.count;
+    EXPECT_LE(total, 1);
+    EXPECT_GT(profile.lost_samples, 0);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,249 @@
+#include <utils/cpu_topology.hpp>
+
+#include <sched.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <tuple>
+
+#include <boost/filesystem/operations.hpp>
+#include <fmt/format.h>
+
+#include <userver/fs/blocking/read.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/utils/text_light.hpp>
+
+#include <utils/check_syscall.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::cpu_topology {
+
+namespace {
+
+std::optional<std::string> TryReadFile(const std::string& path) {
+    if (!fs::blocking::FileExists(path)) return std::nullopt;
+    try {
+        return utils::text::Trim(fs::blocking::ReadFileContents(path));
+    } catch (const std::exception&) {
+        return std::nullopt;
+    }
+}
+
+// The first CPU of the list is used as an id of the whole group
+std::optional<int> ReadGroupId(const std::string& path) {
+    const auto contents = TryReadFile(path);
+    if (!contents) return std::nullopt;
+
+    const auto cpus = ParseCpuList(*contents);
+    if (cpus.empty()) return std::nullopt;
+    return *std::min_element(cpus.begin(), cpus.end());
+}
+
+std::optional<int> ReadLlcId(const std::string& cpu_dir) {
+    const auto cache_dir = cpu_dir + "/cache";
+    if (!boost::filesystem::is_directory(cache_dir)) return std::nullopt;
+
+    int max_level = -1;
+    std::optional<int> llc;
+    for (const auto& entry : boost::filesystem::directory_iterator(cache_dir)) {
+        const auto index_dir = entry.path().string();
+        if (!utils::text::StartsWith(entry.path().filename().string(), "index")) continue;
+
+        const auto type = TryReadFile(index_dir + "/type");
+        if (type && *type == "Instruction") continue;
+
+        const auto level = TryReadFile(index_dir + "/level");
+        if (!level) continue;
+        const auto level_value = utils::FromString<int>(*level);
+        if (level_value <= max_level) continue;
+
+        if (const auto id = ReadGroupId(index_dir + "/shared_cpu_list")) {
+            max_level = level_value;
+            llc = id;
+        }
+    }
+    return llc;
+}
+
+std::optional<int> ReadNumaNode(const std::string& cpu_dir) {
+    constexpr std::string_view kNodePrefix = "node";
+    for (const auto& entry : boost::filesystem::directory_iterator(cpu_dir)) {
+        const auto name = entry.path().filename().string();
+        if (!utils::text::StartsWith(name, kNodePrefix)) continue;
+        try {
+            return utils::FromString<int>(name.substr(kNodePrefix.size()));
+        } catch (const std::exception&) {
+            continue;
+        }
+    }
+    return std::nullopt;
+}
+
+}  // namespace
+
+Distance GetDistance(const CpuInfo& lhs, const CpuInfo& rhs) noexcept {
+    if (lhs.cpu == rhs.cpu) return Distance::kSameCpu;
+    if (lhs.core == rhs.core) return Distance::kSmtSibling;
+    if (lhs.llc == rhs.llc) return Distance::kSameLlc;
+    if (lhs.numa_node == rhs.numa_node) return Distance::kSameNumaNode;
+    return Distance::kRemote;
+}
+
+CpuTopology CpuTopology::FromSysfs(const std::string& sysfs_cpu_dir) {
+    std::vector<int> cpu_ids;
+    if (const auto online = TryReadFile(sysfs_cpu_dir + "/online")) {
+        cpu_ids = ParseCpuList(*online);
+    }
+    if (cpu_ids.empty()) {
+        const auto cpus_count = ::sysconf(_SC_NPROCESSORS_ONLN);
+        for (int cpu = 0; cpu < cpus_count; ++cpu) cpu_ids.push_back(cpu);
+    }
+
+    std::vector<CpuInfo> cpus;
+    cpus.reserve(cpu_ids.size());
+    for (const int cpu : cpu_ids) {
+        const auto cpu_dir = fmt::format("{}/cpu{}", sysfs_cpu_dir, cpu);
+
+        CpuInfo info;
+        info.cpu = cpu;
+        info.core = ReadGroupId(cpu_dir + "/topology/thread_siblings_list").value_or(cpu);
+        if (boost::filesystem::is_directory(cpu_dir)) {
+            info.llc = ReadLlcId(cpu_dir).value_or(cpu);
+            info.numa_node = ReadNumaNode(cpu_dir).value_or(0);
+        } else {
+            info.llc = cpu;
+        }
+        cpus.push_back(info);
+    }
+
+    return CpuTopology{std::move(cpus)};
+}
+
+CpuTopology::CpuTopology(std::vector<CpuInfo> cpus) : cpus_(std::move(cpus)) {
+    std::sort(cpus_.begin(), cpus_.end(), [](const CpuInfo& lhs, const CpuInfo& rhs) { return lhs.cpu < rhs.cpu; });
+}
+
+std::optional<CpuInfo> CpuTopology::FindCpu(int cpu) const {
+    const auto it = std::lower_bound(cpus_.begin(), cpus_.end(), cpu, [](const CpuInfo& info, int value) {
+        return info.cpu < value;
+    });
+    if (it == cpus_.end() || it->cpu != cpu) return std::nullopt;
+    return *it;
+}
+
+std::size_t CpuTopology::GetNumaNodesCount() const noexcept {
+    std::vector<int> nodes;
+    for (const auto& info : cpus_) nodes.push_back(info.numa_node);
+    std::sort(nodes.begin(), nodes.end());
+    return std::max<std::size_t>(1, std::unique(nodes.begin(), nodes.end()) - nodes.begin());
+}
+
+std::vector<CpuInfo> CpuTopology::AssignWorkerCpus(const std::vector<int>& allowed_cpus, std::size_t count) const {
+    std::vector<CpuInfo> candidates;
+    for (const int cpu : allowed_cpus) {
+        if (auto info = FindCpu(cpu)) candidates.push_back(*info);
+    }
+    if (candidates.empty()) return {};
+
+    // Rank of the CPU among its SMT siblings: 0 for the first hardware thread
+    // of the core, 1 for the second one, etc.
+    std::map<int, int> core_threads;
+    std::vector<std::pair<int, CpuInfo>> ranked;
+    ranked.reserve(candidates.size());
+    for (const auto& info : candidates) {
+        ranked.emplace_back(core_threads[info.core]++, info);
+    }
+
+    std::sort(ranked.begin(), ranked.end(), [](const auto& lhs, const auto& rhs) {
+        const auto& [lhs_rank, lhs_info] = lhs;
+        const auto& [rhs_rank, rhs_info] = rhs;
+        return std::tie(lhs_info.numa_node, lhs_rank, lhs_info.llc, lhs_info.core, lhs_info.cpu) <
+               std::tie(rhs_info.numa_node, rhs_rank, rhs_info.llc, rhs_info.core, rhs_info.cpu);
+    });
+
+    std::vector<CpuInfo> result;
+    result.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        result.push_back(ranked[i % ranked.size()].second);
+    }
+    return result;
+}
+
+std::vector<int> ParseCpuList(std::string_view list) {
+    std::vector<int> result;
+    while (!list.empty()) {
+        const auto comma_pos = list.find(',');
+        const auto range = utils::text::Trim(std::string{list.substr(0, comma_pos)});
+        list = (comma_pos == std::string_view::npos) ? std::string_view{} : list.substr(comma_pos + 1);
+        if (range.empty()) continue;
+
+        const auto dash_pos = range.find('-');
+        const auto first = utils::FromString<int>(range.substr(0, dash_pos));
+        const auto last = (dash_pos == std::string::npos) ? first : utils::FromString<int>(range.substr(dash_pos + 1));
+        if (last < first) {
+            throw std::runtime_error(fmt::format("Invalid cpu range '{}'", range));
+        }
+        for (int cpu = first; cpu <= last; ++cpu) result.push_back(cpu);
+    }
+    return result;
+}
+
+std::vector<int> GetCurrentThreadAllowedCpus() {
+    std::vector<int> result;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    utils::CheckSyscall(::sched_getaffinity(0, sizeof(set), &set), "getting thread affinity");
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &set)) result.push_back(cpu);
+    }
+#else
+    const auto cpus_count = ::sysconf(_SC_NPROCESSORS_ONLN);
+    for (int cpu = 0; cpu < cpus_count; ++cpu) result.push_back(cpu);
+#endif
+    return result;
+}
+
+void SetCurrentThreadAffinity(int cpu) {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    utils::CheckSyscall(::sched_setaffinity(0, sizeof(set), &set), "setting thread affinity to cpu {}", cpu);
+#else
+    throw std::runtime_error(fmt::format("Setting thread affinity to cpu {} is not supported on this platform", cpu));
+#endif
+}
+
+int GetCurrentNumaNode() noexcept {
+#ifdef __linux__
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) return static_cast<int>(node);
+#endif
+    return 0;
+}
+
+std::size_t GetNumaNodesCount() {
+    static const auto kNodesCount = [] {
+        const auto online = TryReadFile("/sys/devices/system/node/online");
+        if (!online) return std::size_t{1};
+        try {
+            return std::max<std::size_t>(1, ParseCpuList(*online).size());
+        } catch (const std::exception&) {
+            return std::size_t{1};
+        }
+    }();
+    return kNodesCount;
+}
+
+}  // namespace utils::cpu_topology
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::cpu_topology {
+
+/// Location of a logical CPU in the cache and memory hierarchy
+struct CpuInfo {
+    int cpu{-1};
+    /// Physical core id, unique across all the packages
+    int core{-1};
+    /// Id of the last level cache domain
+    int llc{-1};
+    int numa_node{0};
+};
+
+/// How far two logical CPUs are from each other, the lower the closer
+enum class Distance {
+    kSameCpu,
+    kSmtSibling,
+    kSameLlc,
+    kSameNumaNode,
+    kRemote,
+};
+
+Distance GetDistance(const CpuInfo& lhs, const CpuInfo& rhs) noexcept;
+
+class CpuTopology final {
+public:
+    /// Discovers the topology from sysfs. CPUs without topology info are
+    /// treated as separate cores with separate LLCs on NUMA node 0.
+    static CpuTopology FromSysfs(const std::string& sysfs_cpu_dir = "/sys/devices/system/cpu");
+
+    explicit CpuTopology(std::vector<CpuInfo> cpus);
+
+    const std::vector<CpuInfo>& GetCpus() const noexcept { return cpus_; }
+
+    std::optional<CpuInfo> FindCpu(int cpu) const;
+
+    std::size_t GetNumaNodesCount() const noexcept;
+
+    /// @brief Returns CPUs for `count` worker threads out of `allowed_cpus`.
+    ///
+    /// CPUs are assigned compactly: NUMA node by NUMA node, LLC by LLC, so that
+    /// neighbouring workers share caches. Different physical cores are used
+    /// before the SMT siblings. If there are more workers than CPUs, CPUs are
+    /// reused in the same order.
+    std::vector<CpuInfo> AssignWorkerCpus(const std::vector<int>& allowed_cpus, std::size_t count) const;
+
+private:
+    std::vector<CpuInfo> cpus_;
+};
+
+/// Parses cpu lists in sysfs format, e.g. "0-3,8,10-11"
+std::vector<int> ParseCpuList(std::string_view list);
+
+/// CPUs the current thread is allowed to run on
+std::vector<int> GetCurrentThreadAllowedCpus();
+
+/// Binds the current thread to the CPU, throws on error
+void SetCurrentThreadAffinity(int cpu);
+
+/// NUMA node of the CPU the current thread is running on, 0 if unknown
+int GetCurrentNumaNode() noexcept;
+
+/// Number of NUMA nodes in the system, 1 if unknown
+std::size_t GetNumaNodesCount();
+
+}  // namespace utils::cpu_topology
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,102 @@
+#include <utils/cpu_topology.hpp>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace ct = utils::cpu_topology;
+
+void WriteFile(const std::string& path, std::string_view contents) {
+    const auto dir = path.substr(0, path.rfind('/'));
+    fs::blocking::CreateDirectories(dir);
+    fs::blocking::RewriteFileContents(path, contents);
+}
+
+// 2 NUMA nodes, 2 cores per node, 2 SMT threads per core, LLC per node:
+// cpu:  0 1 2 3 4 5 6 7
+// core: 0 1 2 3 0 1 2 3
+// node: 0 0 1 1 0 0 1 1
+void FillFakeSysfs(const std::string& root) {
+    WriteFile(root + "/online", "0-7\n");
+    for (int cpu = 0; cpu < 8; ++cpu) {
+        const auto cpu_dir = fmt::format("{}/cpu{}", root, cpu);
+        const int first_thread = cpu % 4;
+        const int node = (cpu % 4) / 2;
+        WriteFile(cpu_dir + "/topology/thread_siblings_list", fmt::format("{},{}\n", first_thread, first_thread + 4));
+        WriteFile(cpu_dir + "/cache/index0/level", "1\n");
+        WriteFile(cpu_dir + "/cache/index0/type", "Data\n");
+        WriteFile(cpu_dir + "/cache/index0/shared_cpu_list", fmt::format("{},{}\n", first_thread, first_thread + 4));
+        WriteFile(cpu_dir + "/cache/index3/level", "3\n");
+        WriteFile(cpu_dir + "/cache/index3/type", "Unified\n");
+        WriteFile(
+            cpu_dir + "/cache/index3/shared_cpu_list",
+            fmt::format("{}-{},{}-{}\n", node * 2, node * 2 + 1, node * 2 + 4, node * 2 + 5)
+        );
+        fs::blocking::CreateDirectories(fmt::format("{}/node{}", cpu_dir, node));
+    }
+}
+
+}  // namespace
+
+TEST(CpuTopology, ParseCpuList) {
+    EXPECT_EQ(ct::ParseCpuList(""), std::vector<int>{});
+    EXPECT_EQ(ct::ParseCpuList("3"), std::vector<int>{3});
+    EXPECT_EQ(ct::ParseCpuList("0-3"), (std::vector<int>{0, 1, 2, 3}));
+    EXPECT_EQ(ct::ParseCpuList("0-1,8,10-11\n"), (std::vector<int>{0, 1, 8, 10, 11}));
+    EXPECT_ANY_THROW(ct::ParseCpuList("3-1"));
+    EXPECT_ANY_THROW(ct::ParseCpuList("a-b"));
+}
+
+TEST(CpuTopology, FromSysfs) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    FillFakeSysfs(dir.GetPath());
+
+    const auto topology = ct::CpuTopology::FromSysfs(dir.GetPath());
+    ASSERT_EQ(topology.GetCpus().size(), 8);
+    EXPECT_EQ(topology.GetNumaNodesCount(), 2);
+
+    const auto cpu0 = topology.FindCpu(0).value();
+    const auto cpu1 = topology.FindCpu(1).value();
+    const auto cpu2 = topology.FindCpu(2).value();
+    const auto cpu4 = topology.FindCpu(4).value();
+    EXPECT_EQ(cpu0.numa_node, 0);
+    EXPECT_EQ(cpu2.numa_node, 1);
+    EXPECT_EQ(cpu4.core, 0);
+
+    EXPECT_EQ(ct::GetDistance(cpu0, cpu0), ct::Distance::kSameCpu);
+    EXPECT_EQ(ct::GetDistance(cpu0, cpu4), ct::Distance::kSmtSibling);
+    EXPECT_EQ(ct::GetDistance(cpu0, cpu1), ct::Distance::kSameLlc);
+    EXPECT_EQ(ct::GetDistance(cpu0, cpu2), ct::Distance::kRemote);
+    EXPECT_FALSE(topology.FindCpu(8).has_value());
+}
+
+TEST(CpuTopology, AssignWorkerCpus) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    FillFakeSysfs(dir.GetPath());
+    const auto topology = ct::CpuTopology::FromSysfs(dir.GetPath());
+
+    std::vector<int> assigned;
+    for (const auto& info : topology.AssignWorkerCpus({0, 1, 2, 3, 4, 5, 6, 7}, 10)) {
+        assigned.push_back(info.cpu);
+    }
+    // node 0 physical cores, node 0 SMT siblings, then node 1
+    EXPECT_EQ(assigned, (std::vector<int>{0, 1, 4, 5, 2, 3, 6, 7, 0, 1}));
+
+    EXPECT_TRUE(topology.AssignWorkerCpus({42}, 2).empty());
+}
+
+TEST(CpuTopology, Current) {
+    const auto topology = ct::CpuTopology::FromSysfs();
+    EXPECT_FALSE(topology.GetCpus().empty());
+    EXPECT_FALSE(ct::GetCurrentThreadAllowedCpus().empty());
+    EXPECT_GE(ct::GetCurrentNumaNode(), 0);
+    EXPECT_GE(ct::GetNumaNodesCount(), 1);
+}
+
+USERVER_NAMESPACE_END
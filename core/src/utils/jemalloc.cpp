@@ -6,6 +6,8 @@
 #include <cerrno>
 #endif
 
+#include <fmt/format.h>
+
 #include <userver/engine/subprocess/environment_variables.hpp>
 #include <userver/utils/thread_name.hpp>
 
@@ -31,6 +33,13 @@ std::error_code MallCtl(const char* name, T new_value) {
     return MakeErrorCode(rc);
 }
 
+template <typename T>
+std::error_code MallCtlRead(const std::string& name, T& value) {
+    std::size_t size = sizeof(value);
+    int rc = mallctl(name.c_str(), &value, &size, nullptr, 0);
+    return MakeErrorCode(rc);
+}
+
 std::error_code MallCtl(const char* name) {
     int rc = mallctl(name, nullptr, nullptr, nullptr, 0);
     return MakeErrorCode(rc);
@@ -72,6 +81,46 @@ std::error_code EnableBgThreads() {
 
 std::error_code StopBgThreads() { return MallCtl<bool>("background_thread", false); }
 
+std::error_code CreateArena(unsigned& arena_index) { return MallCtlRead("arenas.create", arena_index); }
+
+std::error_code SetThreadArena(unsigned arena_index) { return MallCtl<unsigned>("thread.arena", arena_index); }
+
+std::error_code GetArenaStats(unsigned arena_index, ArenaStats& stats) {
+    // the statistics are cached by jemalloc until the epoch is advanced
+    if (auto ec = MallCtl<std::uint64_t>("epoch", 1)) return ec;
+
+    const auto prefix = fmt::format("stats.arenas.{}.", arena_index);
+    unsigned threads = 0;
+    std::size_t active_pages = 0;
+    std::size_t small_allocated = 0;
+    std::size_t large_allocated = 0;
+    std::size_t page_size = 0;
+    for (auto ec : {
+             MallCtlRead(prefix + "nthreads", threads),
+             MallCtlRead(prefix + "pactive", active_pages),
+             MallCtlRead(prefix + "small.allocated", small_allocated),
+             MallCtlRead(prefix + "large.allocated", large_allocated),
+             MallCtlRead(prefix + "resident", stats.resident),
+             MallCtlRead(prefix + "mapped", stats.mapped),
+             MallCtlRead("arenas.page", page_size),
+         }) {
+        if (ec) return ec;
+    }
+    stats.threads = threads;
+    stats.allocated = small_allocated + large_allocated;
+    stats.active = active_pages * page_size;
+    return {};
+}
+
+const std::uint64_t* GetThreadAllocatedBytesCounter() noexcept {
+    std::uint64_t* counter = nullptr;
+    size_t size = sizeof(counter);
+    if (mallctl("thread.allocatedp", &counter, &size, nullptr, 0) != 0) {
+        return nullptr;
+    }
+    return counter;
+}
+
 }  // namespace utils::jemalloc
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <system_error>
 
@@ -24,6 +25,30 @@ std::error_code EnableBgThreads();
 // blocking
 std::error_code StopBgThreads();
 
+// Creates a new arena, the arenas are never destroyed
+std::error_code CreateArena(unsigned& arena_index);
+
+// Makes the current thread allocate from the arena
+std::error_code SetThreadArena(unsigned arena_index);
+
+struct ArenaStats {
+    std::size_t threads{0};
+    // bytes in the allocations of the arena
+    std::size_t allocated{0};
+    // bytes in the pages with the allocations
+    std::size_t active{0};
+    // bytes of the physically resident pages, including the dirty ones
+    std::size_t resident{0};
+    std::size_t mapped{0};
+};
+
+// Refreshes the jemalloc statistics and reads the ones of the arena
+std::error_code GetArenaStats(unsigned arena_index, ArenaStats& stats);
+
+// Counter of the bytes ever allocated by the current thread, nullptr if
+// jemalloc is not available. Must be read by the current thread only.
+const std::uint64_t* GetThreadAllocatedBytesCounter() noexcept;
+
 }  // namespace utils::jemalloc
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include <userver/utils/periodic_task.hpp>
 
+#include <algorithm>
 #include <random>
 #include <tuple>
 
@@ -13,6 +14,7 @@
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/rand.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -22,8 +24,20 @@ namespace {
 
 auto TieSettings(const PeriodicTask::Settings& settings) {
     // Can't use Boost.Pfr, because Settings has custom constructors.
-    const auto& [f1, f2, f3, f4, f5, f6] = settings;
-    return std::tie(f1, f2, f3, f4, f5, f6);
+    const auto& [f1, f2, f3, f4, f5, f6, f7] = settings;
+    return std::tie(f1, f2, f3, f4, f5, f6, f7);
+}
+
+std::chrono::steady_clock::time_point
+CoalesceWakeup(std::chrono::steady_clock::time_point wakeup, std::chrono::milliseconds slack) {
+    // The phase of a grid is the same for all the tasks with the same slack,
+    // and a tick of a grid is a tick of the grids with the divisors of its step
+    static const auto kPhaseSeed = utils::RandRange(std::chrono::milliseconds::rep{1} << 40);
+
+    const auto phase = std::chrono::milliseconds{kPhaseSeed % slack.count()};
+    const auto since_grid_start = wakeup.time_since_epoch() - phase;
+    const auto ticks = (since_grid_start + slack - std::chrono::steady_clock::duration{1}) / slack;
+    return std::chrono::steady_clock::time_point{ticks * slack + phase};
 }
 
 }  // namespace
@@ -106,7 +120,9 @@ void PeriodicTask::SetSettings(Settings settings) {
             return;
         }
         settings.flags = writer->flags;
-        should_notify_task = settings.period != writer->period || settings.exception_period != writer->exception_period;
+        should_notify_task = settings.period != writer->period ||
+                             settings.exception_period != writer->exception_period ||
+                             settings.coalescing_slack != writer->coalescing_slack;
         *writer = std::move(settings);
         writer.Commit();
     }
@@ -162,8 +178,11 @@ void PeriodicTask::Run() {
             start = std::chrono::steady_clock::now();
         }
 
-        while (changed_event_.WaitForEventUntil(start + MutatePeriod(period))) {
+        auto wakeup = PlanWakeup(start, period);
+        bool is_forced = false;
+        while (changed_event_.WaitForEventUntil(wakeup)) {
             if (should_force_step_.exchange(false)) {
+                is_forced = true;
                 break;
             }
             // The config variable value has been changed, reload
@@ -171,6 +190,15 @@ void PeriodicTask::Run() {
             period = settings->period;
             const auto exception_period = settings->exception_period.value_or(period);
             if (!no_exception) period = exception_period;
+            wakeup = PlanWakeup(start, period);
+        }
+
+        if (!is_forced && !engine::current_task::ShouldCancel()) {
+            const auto lateness = std::chrono::steady_clock::now() - wakeup;
+            ++statistics_.wakeups;
+            statistics_.lateness_us += utils::statistics::Rate{static_cast<utils::statistics::Rate::ValueType>(
+                std::max(std::chrono::duration_cast<std::chrono::microseconds>(lateness).count(), std::int64_t{0})
+            )};
         }
     }
 }
@@ -228,6 +256,14 @@ std::chrono::milliseconds PeriodicTask::MutatePeriod(std::chrono::milliseconds p
     return std::chrono::milliseconds(ms);
 }
 
+std::chrono::steady_clock::time_point
+PeriodicTask::PlanWakeup(std::chrono::steady_clock::time_point start, std::chrono::milliseconds period) {
+    const auto wakeup = start + MutatePeriod(period);
+    const auto slack = settings_.Read()->coalescing_slack;
+    if (slack <= std::chrono::milliseconds::zero()) return wakeup;
+    return CoalesceWakeup(wakeup, slack);
+}
+
 std::string_view PeriodicTask::GetName() const noexcept {
     return is_name_set_ ? std::string_view{name_} : "<name not set>";
 }
@@ -258,6 +294,11 @@ PeriodicTask::Settings PeriodicTask::GetCurrentSettings() const {
     return *settings_ptr;
 }
 
+void DumpMetric(utils::statistics::Writer& writer, const PeriodicTask::Statistics& stats) {
+    writer["wakeups"] = stats.wakeups;
+    writer["lateness_us"] = stats.lateness_us;
+}
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
@@ -120,6 +120,26 @@ UTEST(PeriodicTask, Period) {
     task.Stop();
 }
 
+UTEST(PeriodicTask, CoalescingSlack) {
+    SimpleTaskData simple;
+
+    constexpr auto period = 3ms;
+    constexpr Count n = 5;
+    utils::PeriodicTask::Settings settings(period);
+    settings.coalescing_slack = 5ms;
+
+    const auto start = std::chrono::steady_clock::now();
+    utils::PeriodicTask task("task", settings, simple.GetTaskFunction());
+    EXPECT_TRUE(simple.WaitFor(
+        (period + settings.coalescing_slack) * n * kSlowRatio, [&simple]() { return simple.GetCount() > n; }
+    ));
+    const auto finish = std::chrono::steady_clock::now();
+    task.Stop();
+
+    EXPECT_GE(finish - start, period * n);
+    EXPECT_GE(task.GetStatistics().wakeups.Load().value, n);
+}
+
 UTEST(PeriodicTask, Slow) {
     SimpleTaskData simple;
 
@@ -0,0 +1,171 @@
+#include <utils/statistics/cardinality_limiter.hpp>
+
+#include <algorithm>
+
+#include <userver/dynamic_config/value.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/utils/overloaded.hpp>
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+CardinalityLimits Parse(const formats::json::Value& value, formats::parse::To<CardinalityLimits>) {
+    return CardinalityLimits{value.As<std::unordered_map<std::string, std::size_t>>()};
+}
+
+namespace impl {
+
+namespace {
+
+bool HasSameBounds(const std::vector<double>& bounds, HistogramView histogram) {
+    if (bounds.size() != histogram.GetBucketCount()) return false;
+    for (std::size_t i = 0; i < bounds.size(); ++i) {
+        if (bounds[i] != histogram.GetUpperBoundAt(i)) return false;
+    }
+    return true;
+}
+
+bool ContainsAll(LabelsSpan labels, const std::vector<Label>& required) {
+    return std::all_of(required.begin(), required.end(), [&labels](const Label& label) {
+        return std::find(labels.begin(), labels.end(), LabelView{label}) != labels.end();
+    });
+}
+
+}  // namespace
+
+const dynamic_config::Key<CardinalityLimits> kCardinalityLimitsConfig{
+    "USERVER_METRICS_CARDINALITY_LIMITS",
+    dynamic_config::DefaultAsJsonString{"{}"},
+};
+
+CardinalityLimiter::CardinalityLimiter(const CardinalityLimits& limits, std::size_t fixed_labels_count)
+    : fixed_labels_count_(fixed_labels_count) {
+    for (const auto& [prefix, max_series] : limits.max_series_by_prefix) {
+        prefixes_.emplace(prefix, PrefixState{max_series, {}});
+    }
+}
+
+CardinalityLimiter::Prefixes::value_type* CardinalityLimiter::FindPrefix(std::string_view path) {
+    // The most specific prefix wins
+    Prefixes::value_type* result = nullptr;
+    for (auto& item : prefixes_) {
+        const auto& prefix = item.first;
+        if (!utils::text::StartsWith(path, prefix)) continue;
+        if (path.size() != prefix.size() && path[prefix.size()] != Writer::kDelimiter) continue;
+        if (!result || result->first.size() < prefix.size()) result = &item;
+    }
+    return result;
+}
+
+bool CardinalityLimiter::TryWrite(std::string_view path, LabelsSpan labels, MetricValue value) {
+    auto* prefix = FindPrefix(path);
+    if (!prefix) return true;
+    auto& prefix_state = prefix->second;
+
+    key_.assign(path);
+    for (const auto& label : labels) {
+        key_.push_back('\0');
+        key_.append(label.Name());
+        key_.push_back('\0');
+        key_.append(label.Value());
+    }
+
+    auto& series = prefix_state.series;
+    if (series.count(key_) || series.size() < prefix_state.max_series) {
+        series.insert(key_);
+        return true;
+    }
+
+    ++dropped_series_[prefix->first];
+    Aggregate(path, labels, value);
+    return false;
+}
+
+void CardinalityLimiter::Aggregate(std::string_view path, LabelsSpan labels, MetricValue value) {
+    key_.assign(path);
+    std::size_t index = 0;
+    for (const auto& label : labels) {
+        key_.push_back('\0');
+        key_.append(label.Name());
+        if (index++ < fixed_labels_count_) {
+            key_.push_back('\0');
+            key_.append(label.Value());
+        }
+    }
+
+    auto it = overflows_.find(key_);
+    if (it == overflows_.end()) {
+        Overflow overflow;
+        overflow.path = std::string{path};
+        index = 0;
+        for (const auto& label : labels) {
+            overflow.labels.emplace_back(
+                LabelView{label.Name(), index++ < fixed_labels_count_ ? label.Value() : kCardinalityOverflowLabelValue}
+            );
+        }
+        overflow.value = value.Visit(utils::Overloaded{
+            [](std::int64_t x) -> decltype(overflow.value) { return x; },
+            [](double x) -> decltype(overflow.value) { return x; },
+            [](Rate x) -> decltype(overflow.value) { return x; },
+            [&overflow](HistogramView x) -> decltype(overflow.value) {
+                for (std::size_t i = 0; i < x.GetBucketCount(); ++i) {
+                    overflow.histogram_bounds.push_back(x.GetUpperBoundAt(i));
+                }
+                HistogramAggregator aggregator{overflow.histogram_bounds};
+                aggregator.Add(x);
+                return aggregator;
+            },
+        });
+        overflows_.emplace(key_, std::move(overflow));
+        return;
+    }
+
+    // Values of a different type or histograms with different bounds are not
+    // aggregated, they are only counted as dropped.
+    auto& overflow = it->second;
+    value.Visit(utils::Overloaded{
+        [&overflow](std::int64_t x) {
+            if (auto* sum = std::get_if<std::int64_t>(&overflow.value)) *sum += x;
+        },
+        [&overflow](double x) {
+            if (auto* sum = std::get_if<double>(&overflow.value)) *sum += x;
+        },
+        [&overflow](Rate x) {
+            if (auto* sum = std::get_if<Rate>(&overflow.value)) *sum += x;
+        },
+        [&overflow](HistogramView x) {
+            auto* sum = std::get_if<HistogramAggregator>(&overflow.value);
+            if (sum && HasSameBounds(overflow.histogram_bounds, x)) sum->Add(x);
+        },
+    });
+}
+
+void CardinalityLimiter::Flush(BaseFormatBuilder& builder, const Request& request) {
+    std::vector<LabelView> labels;
+    for (const auto& [key, overflow] : overflows_) {
+        labels.clear();
+        for (const auto& label : overflow.labels) {
+            labels.emplace_back(label);
+        }
+        if (!ContainsAll(labels, request.require_labels)) continue;
+
+        const auto value = std::visit(
+            utils::Overloaded{
+                [](const HistogramAggregator& x) { return MetricValue{x.GetView()}; },
+                [](const auto& x) { return MetricValue{x}; },
+            },
+            overflow.value
+        );
+        builder.HandleMetric(overflow.path, labels, value);
+    }
+    overflows_.clear();
+}
+
+}  // namespace impl
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
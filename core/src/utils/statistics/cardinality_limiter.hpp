@@ -0,0 +1,67 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <variant>
+#include <vector>
+
+#include <userver/dynamic_config/snapshot.hpp>
+#include <userver/utils/statistics/cardinality_limits.hpp>
+#include <userver/utils/statistics/histogram_aggregator.hpp>
+#include <userver/utils/statistics/storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics::impl {
+
+extern const dynamic_config::Key<CardinalityLimits> kCardinalityLimitsConfig;
+
+/// Counts the series written during a single Storage::VisitMetrics call and
+/// aggregates the series that do not fit into the CardinalityLimits.
+class CardinalityLimiter final {
+public:
+    /// The first `fixed_labels_count` labels of each series are kept intact
+    /// in the aggregated series
+    CardinalityLimiter(const CardinalityLimits& limits, std::size_t fixed_labels_count);
+
+    /// Returns false if the series does not fit into the limit and was
+    /// aggregated into the overflow series
+    bool TryWrite(std::string_view path, LabelsSpan labels, MetricValue value);
+
+    /// Writes the aggregated overflow series into `builder`
+    void Flush(BaseFormatBuilder& builder, const Request& request);
+
+    /// Number of series that did not fit into the limits, by the prefix
+    const std::unordered_map<std::string, std::uint64_t>& GetDroppedSeries() const noexcept { return dropped_series_; }
+
+private:
+    struct PrefixState final {
+        std::size_t max_series;
+        std::unordered_set<std::string> series;
+    };
+
+    struct Overflow final {
+        std::string path;
+        std::vector<Label> labels;
+        std::variant<std::int64_t, double, Rate, HistogramAggregator> value;
+        // The bounds of the first histogram, the others must match them
+        std::vector<double> histogram_bounds;
+    };
+
+    using Prefixes = std::unordered_map<std::string, PrefixState>;
+
+    Prefixes::value_type* FindPrefix(std::string_view path);
+    void Aggregate(std::string_view path, LabelsSpan labels, MetricValue value);
+
+    const std::size_t fixed_labels_count_;
+    Prefixes prefixes_;
+    std::unordered_map<std::string, std::uint64_t> dropped_series_;
+    std::unordered_map<std::string, Overflow> overflows_;
+    std::string key_;
+};
+
+}  // namespace utils::statistics::impl
+
+USERVER_NAMESPACE_END
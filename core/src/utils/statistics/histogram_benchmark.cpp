@@ -1,10 +1,13 @@
 #include <userver/utils/statistics/histogram.hpp>
 
+#include <vector>
+
 #include <benchmark/benchmark.h>
 #include <boost/range/irange.hpp>
 
 #include <userver/utils/algo.hpp>
 #include <userver/utils/rand.hpp>
+#include <userver/utils/statistics/striped_histogram.hpp>
 #include <utils/gbench_auxilary.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -34,4 +37,58 @@ void HistogramAccount(benchmark::State& state) {
 // poorly (fixed).
 BENCHMARK(HistogramAccount)->DenseRange(10, 50, 10);
 
+namespace {
+
+constexpr std::size_t kContendedBucketCount = 20;
+
+std::vector<double> MakeContendedBounds() {
+    return utils::AsContainer<std::vector<double>>(boost::irange(std::size_t{1}, kContendedBucketCount + 1));
+}
+
+// Latencies are typically concentrated in a few buckets, so all the threads
+// hit the same cache lines
+std::vector<double> MakeContendedValues() {
+    auto values = std::vector<double>(1024);
+    for (auto& value : values) {
+        value = utils::RandRange(3.0, 5.0);
+    }
+    return values;
+}
+
+template <typename HistogramType>
+HistogramType& GetSharedHistogram() {
+    static HistogramType histogram{MakeContendedBounds()};
+    return histogram;
+}
+
+}  // namespace
+
+// All the threads account into a single histogram
+template <typename HistogramType>
+void HistogramAccountContended(benchmark::State& state) {
+    auto& histogram = GetSharedHistogram<HistogramType>();
+    const auto values = Launder(MakeContendedValues());
+
+    while (state.KeepRunningBatch(values.size())) {
+        for (const auto value : values) {
+            histogram.Account(value);
+        }
+    }
+}
+
+BENCHMARK_TEMPLATE(HistogramAccountContended, utils::statistics::Histogram)->ThreadRange(1, 64);
+BENCHMARK_TEMPLATE(HistogramAccountContended, utils::statistics::StripedHistogram)->ThreadRange(1, 64);
+
+void StripedHistogramAggregate(benchmark::State& state) {
+    utils::statistics::StripedHistogram histogram{MakeContendedBounds()};
+    for (const auto value : MakeContendedValues()) {
+        histogram.Account(value);
+    }
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(histogram.Aggregate());
+    }
+}
+BENCHMARK(StripedHistogramAggregate);
+
 USERVER_NAMESPACE_END
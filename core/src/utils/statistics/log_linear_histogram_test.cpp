@@ -0,0 +1,146 @@
+#include <userver/utils/statistics/log_linear_histogram.hpp>
+
+#include <cmath>
+#include <limits>
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/fmt.hpp>
+#include <userver/utils/statistics/recentperiod.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Histogram = utils::statistics::LogLinearHistogram<3, 16>;
+
+std::string ToString(const Histogram& histogram) {
+    const auto aggregated = histogram.ToHistogram();
+    return fmt::to_string(aggregated.GetView());
+}
+
+}  // namespace
+
+static_assert(utils::statistics::kHasWriterSupport<utils::statistics::LogLinearHistogram<>>);
+
+TEST(LogLinearHistogram, BucketIndex) {
+    EXPECT_EQ(Histogram::kBucketCount, 14 * 8);
+
+    // Small values are exact
+    for (std::uint64_t value = 0; value < 16; ++value) {
+        EXPECT_EQ(Histogram::GetBucketIndex(value), value);
+        EXPECT_EQ(Histogram::GetBucketHighestValue(value), value);
+    }
+
+    EXPECT_EQ(Histogram::GetBucketIndex(16), 16);
+    EXPECT_EQ(Histogram::GetBucketIndex(17), 16);
+    EXPECT_EQ(Histogram::GetBucketHighestValue(16), 17);
+    EXPECT_EQ(Histogram::GetBucketIndex(18), 17);
+
+    EXPECT_EQ(Histogram::GetBucketIndex(65535), Histogram::kBucketCount - 1);
+    EXPECT_EQ(Histogram::GetBucketIndex(65536), Histogram::kBucketCount - 1);
+    EXPECT_EQ(Histogram::GetBucketIndex(std::numeric_limits<std::uint64_t>::max()), Histogram::kBucketCount - 1);
+    EXPECT_EQ(Histogram::GetBucketHighestValue(Histogram::kBucketCount - 1), 65535);
+}
+
+TEST(LogLinearHistogram, BucketsAreContiguous) {
+    std::uint64_t expected_lowest = 0;
+    for (std::size_t index = 0; index < Histogram::kBucketCount; ++index) {
+        EXPECT_EQ(Histogram::GetBucketIndex(expected_lowest), index);
+        const auto highest = Histogram::GetBucketHighestValue(index);
+        EXPECT_EQ(Histogram::GetBucketIndex(highest), index);
+        expected_lowest = highest + 1;
+    }
+    EXPECT_EQ(expected_lowest, 65536);
+}
+
+TEST(LogLinearHistogram, RelativeError) {
+    utils::statistics::LogLinearHistogram<> histogram;
+    for (std::uint64_t value = 1; value < 1'000'000'000; value = value * 3 + 1) {
+        histogram.Reset();
+        histogram.Account(value);
+        const auto estimate = histogram.GetPercentile(50);
+        EXPECT_GE(estimate, value);
+        EXPECT_LT(static_cast<double>(estimate - value), static_cast<double>(value) / 16);
+    }
+}
+
+TEST(LogLinearHistogram, Percentiles) {
+    Histogram histogram;
+    EXPECT_EQ(histogram.GetPercentile(50), 0);
+
+    for (std::uint64_t value = 1; value <= 100; ++value) histogram.Account(value);
+    EXPECT_EQ(histogram.Count(), 100);
+
+    EXPECT_EQ(histogram.GetPercentile(0), 1);
+    const auto p50 = histogram.GetPercentile(50);
+    EXPECT_GE(p50, 50);
+    EXPECT_LE(p50, 55);
+    const auto p99 = histogram.GetPercentile(99);
+    EXPECT_GE(p99, 99);
+    EXPECT_LE(p99, 103);
+    EXPECT_EQ(histogram.GetPercentile(100), 103);
+}
+
+TEST(LogLinearHistogram, Add) {
+    Histogram first;
+    Histogram second;
+    first.Account(1, 10);
+    second.Account(1000, 10);
+
+    first.Add(second);
+    EXPECT_EQ(first.Count(), 20);
+    EXPECT_EQ(first.GetPercentile(25), 1);
+    EXPECT_GE(first.GetPercentile(75), 1000);
+
+    const Histogram copy{first};
+    EXPECT_EQ(copy.Count(), 20);
+    EXPECT_EQ(copy.GetPercentile(75), first.GetPercentile(75));
+}
+
+TEST(LogLinearHistogram, RecentPeriod) {
+    utils::statistics::RecentPeriod<Histogram, Histogram> timings;
+    timings.GetCurrentCounter().Account(5);
+    timings.GetCurrentCounter().Account(7);
+
+    const auto result = timings.GetStatsForPeriod(std::chrono::seconds{60}, true);
+    EXPECT_EQ(result.Count(), 2);
+    EXPECT_EQ(result.GetPercentile(100), 7);
+}
+
+UTEST(LogLinearHistogram, ToHistogram) {
+    Histogram histogram;
+    histogram.Account(0);
+    histogram.Account(1);
+    histogram.Account(2);
+    histogram.Account(7);
+    histogram.Account(8, 3);
+    histogram.Account(40000);
+    histogram.Account(100000);
+
+    EXPECT_EQ(
+        ToString(histogram),
+        "[1]=2,[3]=1,[7]=1,[15]=3,[31]=0,[63]=0,[127]=0,[255]=0,[511]=0,[1023]=0,[2047]=0,[4095]=0,[8191]=0,"
+        "[16383]=0,[32767]=0,[65535]=1,[inf]=1"
+    );
+}
+
+UTEST(LogLinearHistogram, DumpMetric) {
+    Histogram histogram;
+    utils::statistics::Storage storage;
+    auto statistics_holder =
+        storage.RegisterWriter("test", [&](utils::statistics::Writer& writer) { writer = histogram; });
+
+    histogram.Account(3, 5);
+    ResetMetric(histogram);
+    histogram.Account(10);
+
+    const utils::statistics::Snapshot snapshot{storage};
+    const auto view = snapshot.SingleMetric("test").AsHistogram();
+    EXPECT_EQ(view.GetBucketCount(), Histogram::kExportedBucketCount);
+    EXPECT_EQ(view.GetTotalCount(), 1);
+    EXPECT_EQ(view.GetValueAt(3), 1);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <userver/engine/run_standalone.hpp>
+#include <userver/utils/statistics/prometheus.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <utils/statistics/serialization_cache.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr int kSourcesCount = 100;
+constexpr int kLabelValuesCount = 10;
+
+// Each source writes `series_per_source` labeled series, as the typical
+// per-handler or per-host metrics do
+std::vector<utils::statistics::Entry>
+RegisterWriters(utils::statistics::Storage& storage, std::int64_t series_per_source) {
+    std::vector<utils::statistics::Entry> entries;
+    for (int source = 0; source < kSourcesCount; ++source) {
+        entries.push_back(storage.RegisterWriter(
+            "source" + std::to_string(source),
+            [series_per_source](utils::statistics::Writer& writer) {
+                for (std::int64_t i = 0; i < series_per_source; ++i) {
+                    writer["requests"].ValueWithLabels(
+                        utils::statistics::Rate{static_cast<std::uint64_t>(i)},
+                        {{"handler", std::to_string(i / kLabelValuesCount)},
+                         {"code", std::to_string(i % kLabelValuesCount)}}
+                    );
+                }
+            },
+            {{"component", "benchmark"}}
+        ));
+    }
+    return entries;
+}
+
+}  // namespace
+
+void statistics_prometheus_format(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        utils::statistics::Storage storage;
+        const auto entries = RegisterWriters(storage, state.range(0));
+
+        for ([[maybe_unused]] auto _ : state) {
+            benchmark::DoNotOptimize(utils::statistics::ToPrometheusFormat(storage));
+        }
+        state.SetItemsProcessed(state.iterations() * kSourcesCount * state.range(0));
+    });
+}
+BENCHMARK(statistics_prometheus_format)->RangeMultiplier(10)->Range(10, 1000);
+
+void statistics_prometheus_format_cached(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        utils::statistics::Storage storage;
+        const auto entries = RegisterWriters(storage, state.range(0));
+        utils::statistics::impl::SerializationCache cache{std::chrono::seconds{10}};
+
+        for ([[maybe_unused]] auto _ : state) {
+            benchmark::DoNotOptimize(
+                cache.GetOrSerialize("prometheus", [&] { return utils::statistics::ToPrometheusFormat(storage); })
+            );
+        }
+        state.SetItemsProcessed(state.iterations() * kSourcesCount * state.range(0));
+    });
+}
+BENCHMARK(statistics_prometheus_format_cached)->RangeMultiplier(10)->Range(10, 1000);
+
+USERVER_NAMESPACE_END
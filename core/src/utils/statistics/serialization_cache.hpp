@@ -0,0 +1,62 @@
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/utils/datetime.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics::impl {
+
+/// Keeps the recently serialized metrics, so that the repeated scrapes within
+/// `max_age` (e.g. from several Prometheus replicas) get the same bytes
+/// without visiting all the metrics again. Concurrent requests wait for a
+/// single serialization instead of doing the same work in parallel.
+class SerializationCache final {
+public:
+    /// Zero `max_age` disables the cache
+    explicit SerializationCache(std::chrono::milliseconds max_age) : max_age_(max_age) {}
+
+    bool IsEnabled() const noexcept { return max_age_.count() > 0; }
+
+    /// Returns the data serialized for the `key` less than `max_age` ago or
+    /// calls `serializer` to make it
+    template <typename Serializer>
+    std::string GetOrSerialize(const std::string& key, Serializer&& serializer) {
+        if (!IsEnabled()) return serializer();
+
+        std::lock_guard lock(mutex_);
+        const auto now = utils::datetime::SteadyNow();
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            if (now - it->second.updated >= max_age_) {
+                it = entries_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        if (const auto it = entries_.find(key); it != entries_.end()) return it->second.data;
+
+        auto data = serializer();
+        entries_.emplace(key, Entry{data, now});
+        return data;
+    }
+
+private:
+    struct Entry final {
+        std::string data;
+        std::chrono::steady_clock::time_point updated;
+    };
+
+    const std::chrono::milliseconds max_age_;
+    engine::Mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+};
+
+}  // namespace utils::statistics::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,79 @@
+#include <utils/statistics/serialization_cache.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/mock_now.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class SerializationCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override { utils::datetime::MockNowSet({}); }
+    void TearDown() override { utils::datetime::MockNowUnset(); }
+};
+
+}  // namespace
+
+UTEST_F(SerializationCacheTest, Disabled) {
+    utils::statistics::impl::SerializationCache cache{std::chrono::milliseconds{0}};
+    EXPECT_FALSE(cache.IsEnabled());
+
+    int calls = 0;
+    const auto serializer = [&] { return std::to_string(++calls); };
+    EXPECT_EQ(cache.GetOrSerialize("key", serializer), "1");
+    EXPECT_EQ(cache.GetOrSerialize("key", serializer), "2");
+}
+
+UTEST_F(SerializationCacheTest, ReusesUntilMaxAge) {
+    utils::statistics::impl::SerializationCache cache{std::chrono::seconds{1}};
+    EXPECT_TRUE(cache.IsEnabled());
+
+    int calls = 0;
+    const auto serializer = [&] { return std::to_string(++calls); };
+    EXPECT_EQ(cache.GetOrSerialize("key", serializer), "1");
+    EXPECT_EQ(cache.GetOrSerialize("key", serializer), "1");
+    EXPECT_EQ(cache.GetOrSerialize("other", serializer), "2");
+
+    utils::datetime::MockSleep(std::chrono::milliseconds{999});
+    EXPECT_EQ(cache.GetOrSerialize("key", serializer), "1");
+
+    utils::datetime::MockSleep(std::chrono::milliseconds{1});
+    EXPECT_EQ(cache.GetOrSerialize("key", serializer), "3");
+    EXPECT_EQ(cache.GetOrSerialize("other", serializer), "4");
+}
+
+UTEST_F(SerializationCacheTest, Exception) {
+    utils::statistics::impl::SerializationCache cache{std::chrono::seconds{1}};
+
+    EXPECT_THROW(
+        cache.GetOrSerialize("key", []() -> std::string { throw std::runtime_error("test"); }), std::runtime_error
+    );
+    EXPECT_EQ(cache.GetOrSerialize("key", [] { return std::string{"value"}; }), "value");
+}
+
+UTEST_F_MT(SerializationCacheTest, SingleSerialization, 4) {
+    utils::statistics::impl::SerializationCache cache{std::chrono::seconds{1}};
+
+    std::atomic<int> calls{0};
+    const auto serializer = [&] {
+        ++calls;
+        engine::SleepFor(std::chrono::milliseconds{10});
+        return std::string{"value"};
+    };
+
+    std::vector<engine::TaskWithResult<std::string>> tasks;
+    for (int i = 0; i < 8; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([&] { return cache.GetOrSerialize("key", serializer); }));
+    }
+    for (auto& task : tasks) EXPECT_EQ(task.Get(), "value");
+    EXPECT_EQ(calls, 1);
+}
+
+USERVER_NAMESPACE_END
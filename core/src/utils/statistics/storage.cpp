@@ -1,6 +1,7 @@
 #include <userver/utils/statistics/storage.hpp>
 
 #include <algorithm>
+#include <optional>
 #include <utility>
 
 #include <boost/container/small_vector.hpp>
@@ -11,6 +12,7 @@
 #include <userver/utils/text_light.hpp>
 #include <utils/statistics/value_builder_helpers.hpp>
 
+#include <utils/statistics/cardinality_limiter.hpp>
 #include <utils/statistics/entry_impl.hpp>
 #include <utils/statistics/visitation.hpp>
 #include <utils/statistics/writer_state.hpp>
@@ -125,6 +127,12 @@ void Storage::VisitMetrics(BaseFormatBuilder& out, const Request& request) const
             state.add_labels.emplace_back(name, value);
         }
 
+        std::optional<impl::CardinalityLimiter> cardinality_limiter;
+        if (const auto limits = cardinality_limits_.Read(); !limits->max_series_by_prefix.empty()) {
+            cardinality_limiter.emplace(*limits, state.add_labels.size());
+            state.cardinality_limiter = &*cardinality_limiter;
+        }
+
         boost::container::small_vector<LabelView, 16> labels_vector;
 
         std::shared_lock lock(mutex_);
@@ -154,11 +162,28 @@ void Storage::VisitMetrics(BaseFormatBuilder& out, const Request& request) const
                 LOG_ERROR() << "Failed to write metrics for prefix '" << entry.prefix_path << "': " << e;
             }
         }
+
+        if (cardinality_limiter) {
+            cardinality_limiter->Flush(out, request);
+            if (!cardinality_limiter->GetDroppedSeries().empty()) {
+                auto overflows = cardinality_overflows_.Lock();
+                for (const auto& [prefix, count] : cardinality_limiter->GetDroppedSeries()) {
+                    (*overflows)[prefix] += Rate{count};
+                }
+            }
+        }
     }
 
     statistics::VisitMetrics(out, GetAsJson(), request);
 }
 
+void Storage::SetCardinalityLimits(CardinalityLimits limits) { cardinality_limits_.Assign(std::move(limits)); }
+
+std::unordered_map<std::string, Rate> Storage::GetCardinalityOverflows() const {
+    const auto overflows = cardinality_overflows_.Lock();
+    return *overflows;
+}
+
 void Storage::StopRegisteringExtenders() { may_register_extenders_ = false; }
 
 Entry Storage::RegisterWriter(std::string prefix, WriterFunc func, std::vector<Label> add_labels) {
@@ -1,6 +1,7 @@
 #include <userver/utils/statistics/storage.hpp>
 
 #include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/prometheus.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -14,4 +15,57 @@ UTEST(StatisticsStorage, RegisterExtender) {
     EXPECT_EQ(json["foo"]["bar"]["baz"].As<int>(), 42);
 }
 
+UTEST(StatisticsStorage, CardinalityLimits) {
+    utils::statistics::Storage storage;
+    auto holder = storage.RegisterWriter("dest", [](utils::statistics::Writer& writer) {
+        for (int i = 0; i < 4; ++i) {
+            writer["requests"].ValueWithLabels(i + 1, {"host", "h" + std::to_string(i)});
+        }
+    });
+    auto other_holder = storage.RegisterWriter("unlimited", [](utils::statistics::Writer& writer) {
+        for (int i = 0; i < 3; ++i) {
+            writer.ValueWithLabels(i, {"host", "h" + std::to_string(i)});
+        }
+    });
+
+    storage.SetCardinalityLimits({{{"dest", 2}}});
+    EXPECT_EQ(
+        utils::statistics::ToPrometheusFormatUntyped(storage),
+        "dest_requests{host=\"h0\"} 1\n"
+        "dest_requests{host=\"h1\"} 2\n"
+        "unlimited{host=\"h0\"} 0\n"
+        "unlimited{host=\"h1\"} 1\n"
+        "unlimited{host=\"h2\"} 2\n"
+        "dest_requests{host=\"__other__\"} 7\n"
+    );
+    EXPECT_EQ(storage.GetCardinalityOverflows().at("dest").value, 2);
+
+    storage.SetCardinalityLimits({});
+    EXPECT_EQ(
+        utils::statistics::ToPrometheusFormatUntyped(storage, utils::statistics::Request::MakeWithPrefix("dest")),
+        "dest_requests{host=\"h0\"} 1\n"
+        "dest_requests{host=\"h1\"} 2\n"
+        "dest_requests{host=\"h2\"} 3\n"
+        "dest_requests{host=\"h3\"} 4\n"
+    );
+}
+
+UTEST(StatisticsStorage, CardinalityLimitsKeepRequestLabels) {
+    utils::statistics::Storage storage;
+    auto holder = storage.RegisterWriter("dest", [](utils::statistics::Writer& writer) {
+        for (int i = 0; i < 3; ++i) {
+            writer.ValueWithLabels(utils::statistics::Rate{10}, {"host", "h" + std::to_string(i)});
+        }
+    });
+
+    storage.SetCardinalityLimits({{{"dest", 1}}});
+    EXPECT_EQ(
+        utils::statistics::ToPrometheusFormatUntyped(
+            storage, utils::statistics::Request::MakeWithPrefix("dest", {{"app", "test"}})
+        ),
+        "dest{app=\"test\",host=\"h0\"} 10\n"
+        "dest{app=\"test\",host=\"__other__\"} 20\n"
+    );
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,60 @@
+#include <userver/utils/statistics/striped_histogram.hpp>
+
+#include <algorithm>
+#include <functional>
+
+#include <userver/concurrent/striped_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+StripedHistogram::StripedHistogram(utils::span<const double> upper_bounds)
+    : bounds_(std::make_unique<double[]>(upper_bounds.size())),
+      counters_(std::make_unique<concurrent::StripedCounter[]>(upper_bounds.size() + 1)),
+      bucket_count_(upper_bounds.size()) {
+    // Validates the bounds
+    [[maybe_unused]] const HistogramAggregator validation{upper_bounds};
+    std::copy(upper_bounds.begin(), upper_bounds.end(), bounds_.get());
+}
+
+StripedHistogram::StripedHistogram(StripedHistogram&&) noexcept = default;
+
+StripedHistogram& StripedHistogram::operator=(StripedHistogram&&) noexcept = default;
+
+StripedHistogram::~StripedHistogram() = default;
+
+void StripedHistogram::Account(double value, std::uint64_t count) noexcept {
+    // Values on the bucket borders fall into the lower bucket
+    const double* const bounds_begin = bounds_.get();
+    const double* const bounds_end = bounds_begin + bucket_count_;
+    const double* const iter = std::upper_bound(bounds_begin, bounds_end, value, std::less_equal<>{});
+    const auto counter_index = iter == bounds_end ? 0 : iter - bounds_begin + 1;
+    counters_[counter_index].Add(count);
+}
+
+HistogramAggregator StripedHistogram::Aggregate() const {
+    HistogramAggregator result{utils::span<const double>(bounds_.get(), bounds_.get() + bucket_count_)};
+    result.AccountInf(counters_[0].Read());
+    for (std::size_t i = 0; i < bucket_count_; ++i) {
+        result.AccountAt(i, counters_[i + 1].Read());
+    }
+    return result;
+}
+
+void ResetMetric(StripedHistogram& histogram) noexcept {
+    for (std::size_t i = 0; i <= histogram.bucket_count_; ++i) {
+        auto& counter = histogram.counters_[i];
+        counter.Subtract(counter.Read());
+    }
+}
+
+void DumpMetric(Writer& writer, const StripedHistogram& histogram) {
+    const auto aggregated = histogram.Aggregate();
+    writer = aggregated.GetView();
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
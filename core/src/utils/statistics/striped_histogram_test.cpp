@@ -0,0 +1,110 @@
+#include <userver/utils/statistics/striped_histogram.hpp>
+
+#include <string>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/fmt.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+#include <userver/utils/statistics/histogram_aggregator.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+auto Bounds() { return std::vector<double>{1.5, 5, 42, 60}; }
+
+template <typename AnyHistogram>
+void AccountSome(AnyHistogram& histogram) {
+    histogram.Account(10);
+    histogram.Account(1.2);
+    histogram.Account(1.8);
+    histogram.Account(100);
+    histogram.Account(30, 4);
+}
+
+std::string ToString(const utils::statistics::StripedHistogram& histogram) {
+    const auto aggregated = histogram.Aggregate();
+    return fmt::to_string(aggregated.GetView());
+}
+
+}  // namespace
+
+UTEST(StatisticsStripedHistogram, MatchesHistogram) {
+    utils::statistics::StripedHistogram striped{Bounds()};
+    utils::statistics::Histogram histogram{Bounds()};
+    AccountSome(striped);
+    AccountSome(histogram);
+
+    const auto aggregated = striped.Aggregate();
+    EXPECT_EQ(aggregated.GetView(), histogram.GetView());
+    EXPECT_EQ(fmt::to_string(aggregated.GetView()), "[1.5]=1,[5]=1,[42]=5,[60]=0,[inf]=1");
+}
+
+UTEST(StatisticsStripedHistogram, ValueOnBucketBorder) {
+    utils::statistics::StripedHistogram histogram{Bounds()};
+    histogram.Account(5);
+    histogram.Account(60);
+    EXPECT_EQ(ToString(histogram), "[1.5]=0,[5]=1,[42]=0,[60]=1,[inf]=0");
+}
+
+UTEST(StatisticsStripedHistogram, ZeroBuckets) {
+    utils::statistics::StripedHistogram histogram{std::vector<double>{}};
+    AccountSome(histogram);
+    EXPECT_EQ(ToString(histogram), "[inf]=8");
+}
+
+UTEST(StatisticsStripedHistogram, Reset) {
+    utils::statistics::StripedHistogram histogram{Bounds()};
+    AccountSome(histogram);
+    ResetMetric(histogram);
+    EXPECT_EQ(ToString(histogram), "[1.5]=0,[5]=0,[42]=0,[60]=0,[inf]=0");
+
+    histogram.Account(3);
+    EXPECT_EQ(ToString(histogram), "[1.5]=0,[5]=1,[42]=0,[60]=0,[inf]=0");
+}
+
+UTEST(StatisticsStripedHistogram, Dump) {
+    utils::statistics::StripedHistogram histogram{Bounds()};
+    AccountSome(histogram);
+
+    utils::statistics::Storage storage;
+    auto statistics_holder =
+        storage.RegisterWriter("test", [&](utils::statistics::Writer& writer) { writer = histogram; });
+
+    const utils::statistics::Snapshot snapshot{storage};
+    EXPECT_EQ(fmt::to_string(snapshot.SingleMetric("test")), "[1.5]=1,[5]=1,[42]=5,[60]=0,[inf]=1");
+}
+
+UTEST_MT(StatisticsStripedHistogram, ConcurrentAccount, 4) {
+    constexpr int kTasks = 4;
+    constexpr int kIterations = 10000;
+
+    utils::statistics::StripedHistogram histogram{Bounds()};
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (int i = 0; i < kTasks; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([&histogram] {
+            for (int j = 0; j < kIterations; ++j) {
+                histogram.Account(j % 2 == 0 ? 1 : 50);
+            }
+        }));
+    }
+    for (auto& task : tasks) task.Get();
+
+    const auto aggregated = histogram.Aggregate();
+    EXPECT_EQ(aggregated.GetView().GetValueAt(0), kTasks * kIterations / 2);
+    EXPECT_EQ(aggregated.GetView().GetValueAt(3), kTasks * kIterations / 2);
+    EXPECT_EQ(aggregated.GetView().GetTotalCount(), kTasks * kIterations);
+}
+
+UTEST_DEATH(StatisticsStripedHistogramDeathTest, InvalidBuckets) {
+    EXPECT_UINVARIANT_FAILURE_MSG(
+        (utils::statistics::StripedHistogram{std::vector<double>{10, 5, 3}}), "Histogram bounds must be sorted"
+    );
+}
+
+USERVER_NAMESPACE_END
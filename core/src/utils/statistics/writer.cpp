@@ -8,6 +8,7 @@
 #include <userver/utils/numeric_cast.hpp>
 #include <userver/utils/text_light.hpp>
 
+#include <utils/statistics/cardinality_limiter.hpp>
 #include <utils/statistics/writer_state.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -86,6 +87,10 @@ void CheckAndWrite(impl::WriterState& state, MetricValue value) {
         return;
     }
 
+    if (state.cardinality_limiter && !state.cardinality_limiter->TryWrite(state.path, labels, value)) {
+        return;
+    }
+
     state.builder.HandleMetric(state.path, labels, MetricValue{value});
 }
 
@@ -8,11 +8,14 @@ USERVER_NAMESPACE_BEGIN
 
 namespace utils::statistics::impl {
 
+class CardinalityLimiter;
+
 struct WriterState {
     BaseFormatBuilder& builder;
     const Request& request;
     std::string path;
     std::vector<LabelView> add_labels;
+    CardinalityLimiter* cardinality_limiter{nullptr};
 };
 
 }  // namespace utils::statistics::impl
@@ -2,16 +2,33 @@
 
 #include <unistd.h>
 
+#include <fstream>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace utils::sys_info {
 
+namespace {
+constexpr std::size_t kDefaultHugePageSize = 2 * 1024 * 1024;
+}  // namespace
+
 std::size_t GetPageSize() {
     static const std::size_t kPageSize = sysconf(_SC_PAGESIZE);
 
     return kPageSize;
 }
 
+std::size_t GetHugePageSize() {
+    static const std::size_t kHugePageSize = [] {
+        std::ifstream file("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size");
+        std::size_t size = 0;
+        if (file >> size && size > GetPageSize()) return size;
+        return kDefaultHugePageSize;
+    }();
+
+    return kHugePageSize;
+}
+
 }  // namespace utils::sys_info
 
 USERVER_NAMESPACE_END
@@ -8,6 +8,9 @@ namespace utils::sys_info {
 
 std::size_t GetPageSize();
 
+/// Size of a transparent huge page, 2MiB if unknown
+std::size_t GetHugePageSize();
+
 }
 
 USERVER_NAMESPACE_END
@@ -192,6 +192,30 @@ void UnaryRPCNewClient(benchmark::State& state) {
 
 BENCHMARK(UnaryRPCNewClient)->DenseRange(1, 4)->Unit(benchmark::kMicrosecond);
 
+void ServerStreamingRPC(benchmark::State& state) {
+    static constexpr int kMessages = 1000;
+
+    engine::RunStandalone(state.range(0), [&] {
+        GrpcClientTest client_factory;
+        auto client = client_factory.MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+        for (auto _ : state) {
+            sample::ugrpc::StreamGreetingRequest out;
+            out.set_name("userver");
+            out.set_number(kMessages);
+            auto stream = client.ReadMany(out, PrepareClientContext());
+
+            int count = 0;
+            sample::ugrpc::StreamGreetingResponse in;
+            while (stream.Read(in)) ++count;
+            UINVARIANT(count == kMessages, "Behavior broken");
+        }
+        state.SetItemsProcessed(state.iterations() * kMessages);
+    });
+}
+
+BENCHMARK(ServerStreamingRPC)->DenseRange(1, 4)->Unit(benchmark::kMillisecond);
+
 void BatchOfUnaryRPC(benchmark::State& state) {
     engine::RunStandalone(
         state.range(0),
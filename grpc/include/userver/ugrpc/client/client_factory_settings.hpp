@@ -28,7 +28,8 @@ struct ClientFactorySettings final {
     grpc::ChannelArguments channel_args{};
 
     /// Number of underlying channels that will be created for every client
-    /// in this factory.
+    /// in this factory. An RPC is started on the channel with the fewest RPCs
+    /// in flight.
     std::size_t channel_count{1};
 };
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <optional>
@@ -38,13 +39,25 @@ public:
         utils::FixedArray<StubPool> dedicated_stubs;
     };
 
+    /// Keeps the stub alive and counts the RPC as in flight on the channel of
+    /// the stub until the handle is destroyed
     class StubHandle {
     public:
-        StubHandle(rcu::ReadablePtr<StubState>&& state, StubAny& stub) : state_{std::move(state)}, stub_{stub} {}
+        StubHandle(rcu::ReadablePtr<StubState>&& state, const StubPool& stubs, std::size_t index)
+            : state_{std::move(state)}, stub_{stubs.GetStub(index)}, in_flight_{&stubs.GetInFlightCounter(index)} {
+            in_flight_->fetch_add(1, std::memory_order_relaxed);
+        }
 
-        StubHandle(StubHandle&&) noexcept = default;
+        StubHandle(StubHandle&& other) noexcept
+            : state_{std::move(other.state_)},
+              stub_{other.stub_},
+              in_flight_{std::exchange(other.in_flight_, nullptr)} {}
         StubHandle& operator=(StubHandle&&) = delete;
 
+        ~StubHandle() {
+            if (in_flight_) in_flight_->fetch_sub(1, std::memory_order_relaxed);
+        }
+
         StubHandle(const StubHandle&) = delete;
         StubHandle& operator=(const StubHandle&) = delete;
 
@@ -56,6 +69,7 @@ public:
     private:
         rcu::ReadablePtr<StubState> state_;
         StubAny& stub_;
+        std::atomic<std::size_t>* in_flight_;
     };
 
     ClientData() = delete;
@@ -93,15 +107,16 @@ public:
     StubHandle NextStubFromMethodId(std::size_t method_id) const {
         auto stub_state = stub_state_->Read();
         auto& dedicated_stubs = stub_state->dedicated_stubs[method_id];
-        auto& stubs = dedicated_stubs.Size() ? dedicated_stubs : stub_state->stubs;
-        auto& stub = stubs.NextStub();
-        return StubHandle{std::move(stub_state), stub};
+        const auto& stubs = dedicated_stubs.Size() ? dedicated_stubs : stub_state->stubs;
+        const auto index = stubs.NextStubIndex();
+        return StubHandle{std::move(stub_state), stubs, index};
     }
 
     StubHandle NextStub() const {
         auto stub_state = stub_state_->Read();
-        auto& stub = stub_state->stubs.NextStub();
-        return StubHandle{std::move(stub_state), stub};
+        const auto& stubs = stub_state->stubs;
+        const auto index = stubs.NextStubIndex();
+        return StubHandle{std::move(stub_state), stubs, index};
     }
 
     grpc::CompletionQueue& NextQueue() const;
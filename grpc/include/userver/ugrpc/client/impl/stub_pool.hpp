@@ -1,5 +1,8 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+
 #include <grpcpp/channel.h>
 
 #include <userver/utils/fixed_array.hpp>
@@ -28,7 +31,15 @@ public:
 
     std::size_t Size() const { return stubs_.size(); }
 
-    StubAny& NextStub() const;
+    /// @returns the index of the stub of the channel with the fewest RPCs in
+    /// flight, ties are broken randomly
+    std::size_t NextStubIndex() const;
+
+    StubAny& GetStub(std::size_t index) const { return stubs_[index]; }
+
+    /// The number of RPCs in flight on the channel, maintained by
+    /// ClientData::StubHandle
+    std::atomic<std::size_t>& GetInFlightCounter(std::size_t index) const { return in_flight_[index]; }
 
     const utils::FixedArray<std::shared_ptr<grpc::Channel>>& GetChannels() const { return channels_; }
 
@@ -36,11 +47,12 @@ public:
 
 private:
     StubPool(utils::FixedArray<std::shared_ptr<grpc::Channel>>&& channels, utils::FixedArray<StubAny>&& stubs)
-        : channels_{std::move(channels)}, stubs_{std::move(stubs)} {}
+        : channels_{std::move(channels)}, stubs_{std::move(stubs)}, in_flight_(stubs_.size(), 0) {}
 
     utils::FixedArray<std::shared_ptr<grpc::Channel>> channels_;
 
     mutable utils::FixedArray<StubAny> stubs_;
+    mutable utils::FixedArray<std::atomic<std::size_t>> in_flight_;
 };
 
 }  // namespace ugrpc::client::impl
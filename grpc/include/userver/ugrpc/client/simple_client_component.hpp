@@ -62,7 +62,7 @@ protected:
 /// ## Static config options:
 /// Name | Description | Default value
 /// ---- | ----------- | -------------
-/// endpoint | URL of the gRPC service | --
+/// endpoint | URL of the gRPC service, `unix:<absolute-path>` for a unix domain socket | --
 /// client-name | name of the gRPC server we talk to, for diagnostics | <uses the component name>
 /// dedicated-channel-counts | a map of rpc method names to channel counts. Used for high-load methods | -
 /// factory-component | ClientFactoryComponent name to use for client creation | --
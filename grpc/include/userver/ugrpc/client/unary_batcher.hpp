@@ -0,0 +1,263 @@
+#pragma once
+
+/// @file userver/ugrpc/client/unary_batcher.hpp
+/// @brief @copybrief ugrpc::client::UnaryBatcher
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <userver/ugrpc/client/exceptions.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client {
+
+/// @brief Settings of ugrpc::client::UnaryBatcher
+struct UnaryBatcherSettings final {
+    /// Time the first call of a batch waits for the calls of other coroutines
+    std::chrono::microseconds window{100};
+
+    /// The batch is sent without waiting for the rest of the window when it
+    /// has that many calls
+    std::size_t max_batch_size{100};
+};
+
+// clang-format off
+
+/// @brief Coalesces concurrent unary calls of the same method into calls of a
+/// batch method
+///
+/// Many tiny unary RPCs to the same method at a high rate spend most of the
+/// time on the per-call overhead: HTTP/2 headers, metadata, completion queue
+/// events and spans. If the service has a batch version of the method, e.g.
+///
+/// @code{.proto}
+/// rpc GetItems(GetItemsRequest) returns (GetItemsResponse) {}
+/// message GetItemsRequest { repeated GetItemRequest items = 1; }
+/// message GetItemsResponse { repeated GetItemResponse items = 1; }
+/// @endcode
+///
+/// then UnaryBatcher lets the callers keep calling a single item method, while
+/// only one batch RPC is sent for all the calls made within the batching
+/// window.
+///
+/// The first coroutine that finds no batch being collected becomes the leader
+/// of the next batch. The leader waits for the window (or until the batch is
+/// full), calls `batch_call` with the requests of the batch and hands the
+/// responses to their callers. `batch_call` must return exactly one response
+/// per request, in the order of the requests. If `batch_call` throws, every
+/// call of the batch rethrows the exception.
+///
+/// A caller cancelled before its request is taken into a batch leaves the batch
+/// and gets ugrpc::client::RpcCancelledError. The leader is not interrupted
+/// by the cancellation, as the other callers wait for the batch.
+///
+/// The class is thread-safe.
+///
+/// ## Example usage:
+///
+/// @code
+/// ugrpc::client::UnaryBatcher<GetItemRequest, GetItemResponse> batcher{
+///     "items.ItemsService/GetItem",
+///     {},
+///     [&client](std::vector<GetItemRequest>&& requests) {
+///         GetItemsRequest batch;
+///         for (auto& request : requests) *batch.add_items() = std::move(request);
+///         auto response = client.GetItems(batch);
+///         return std::vector<GetItemResponse>(
+///             std::make_move_iterator(response.mutable_items()->begin()),
+///             std::make_move_iterator(response.mutable_items()->end()));
+///     }};
+///
+/// GetItemResponse response = batcher.Call(std::move(request));
+/// @endcode
+
+// clang-format on
+
+template <typename Request, typename Response>
+class UnaryBatcher final {
+public:
+    using BatchCall = std::function<std::vector<Response>(std::vector<Request>&&)>;
+
+    /// @param call_name the name of the batched call for the error messages
+    UnaryBatcher(std::string call_name, UnaryBatcherSettings settings, BatchCall batch_call);
+
+    UnaryBatcher(const UnaryBatcher&) = delete;
+    UnaryBatcher& operator=(const UnaryBatcher&) = delete;
+
+    /// @brief Send the request in the next batch and wait for its response
+    /// @throws ugrpc::client::RpcCancelledError if the task is cancelled
+    /// before the request is taken into a batch
+    /// @throws ugrpc::client::RpcError and other exceptions of `batch_call`
+    Response Call(Request&& request);
+
+private:
+    struct PendingCall final {
+        Request request;
+
+        // Both fields are only changed under the mutex, or by the leader after
+        // the call is taken into a batch
+        bool is_leader{false};
+        bool is_done{false};
+
+        std::optional<Response> response{};
+        std::exception_ptr error{};
+
+        // Signalled when the call becomes the leader or is done
+        engine::SingleConsumerEvent event{};
+    };
+
+    using Batch = std::vector<PendingCall*>;
+
+    void WaitForTurn(PendingCall& call);
+    void Lead(PendingCall& own_call);
+    void ExecuteBatch(const Batch& batch);
+
+    const std::string call_name_;
+    const UnaryBatcherSettings settings_;
+    const BatchCall batch_call_;
+
+    engine::Mutex mutex_;
+    // calls that are not taken into a batch yet, in arrival order
+    std::vector<PendingCall*> pending_;
+    bool has_leader_{false};
+    engine::SingleConsumerEvent batch_full_;
+};
+
+template <typename Request, typename Response>
+UnaryBatcher<Request, Response>::UnaryBatcher(
+    std::string call_name,
+    UnaryBatcherSettings settings,
+    BatchCall batch_call
+)
+    : call_name_(std::move(call_name)), settings_(settings), batch_call_(std::move(batch_call)) {
+    UINVARIANT(settings_.max_batch_size > 0, "max_batch_size of UnaryBatcher must be positive");
+}
+
+template <typename Request, typename Response>
+Response UnaryBatcher<Request, Response>::Call(Request&& request) {
+    PendingCall call{std::move(request)};
+    {
+        const std::lock_guard lock{mutex_};
+        pending_.push_back(&call);
+        if (!has_leader_) {
+            has_leader_ = true;
+            call.is_leader = true;
+            batch_full_.Reset();
+        } else if (pending_.size() >= settings_.max_batch_size) {
+            batch_full_.Send();
+        }
+    }
+
+    if (!call.is_leader) WaitForTurn(call);
+    if (!call.is_done) Lead(call);
+
+    UASSERT(call.is_done);
+    if (call.error) std::rethrow_exception(call.error);
+    UASSERT(call.response);
+    return std::move(*call.response);
+}
+
+template <typename Request, typename Response>
+void UnaryBatcher<Request, Response>::WaitForTurn(PendingCall& call) {
+    if (call.event.WaitForEvent()) return;
+
+    // The task is cancelled. The call may only be withdrawn while it is not
+    // taken into a batch, as the leader moves the request out of it.
+    bool is_leader = false;
+    {
+        const std::lock_guard lock{mutex_};
+        is_leader = call.is_leader;
+        if (!is_leader) {
+            const auto it = std::find(pending_.begin(), pending_.end(), &call);
+            if (it != pending_.end()) {
+                pending_.erase(it);
+                throw RpcCancelledError(call_name_, "UnaryBatcher::Call");
+            }
+        }
+    }
+    if (is_leader) return;
+
+    const engine::TaskCancellationBlocker cancel_blocker;
+    [[maybe_unused]] const bool is_done = call.event.WaitForEvent();
+    UASSERT(is_done);
+}
+
+template <typename Request, typename Response>
+void UnaryBatcher<Request, Response>::Lead(PendingCall& own_call) {
+    // Other tasks wait for the responses of the batch, it must be sent anyway
+    const engine::TaskCancellationBlocker cancel_blocker;
+
+    bool should_wait = false;
+    {
+        const std::lock_guard lock{mutex_};
+        should_wait = pending_.size() < settings_.max_batch_size;
+    }
+    if (should_wait && settings_.window.count() > 0) {
+        [[maybe_unused]] const bool is_full = batch_full_.WaitForEventFor(settings_.window);
+    }
+
+    Batch batch;
+    {
+        const std::lock_guard lock{mutex_};
+        const auto size = std::min(pending_.size(), settings_.max_batch_size);
+        batch.assign(pending_.begin(), pending_.begin() + size);
+        pending_.erase(pending_.begin(), pending_.begin() + size);
+        if (pending_.empty()) {
+            has_leader_ = false;
+        } else {
+            // the rest of the calls make the next batch
+            auto& next_leader = *pending_.front();
+            next_leader.is_leader = true;
+            next_leader.event.Send();
+        }
+    }
+    UASSERT(!batch.empty() && batch.front() == &own_call);
+
+    ExecuteBatch(batch);
+
+    for (auto* call : batch) {
+        call->is_done = true;
+        // the call may be destroyed right after the event is sent
+        if (call != &own_call) call->event.Send();
+    }
+}
+
+template <typename Request, typename Response>
+void UnaryBatcher<Request, Response>::ExecuteBatch(const Batch& batch) {
+    try {
+        std::vector<Request> requests;
+        requests.reserve(batch.size());
+        for (auto* call : batch) requests.push_back(std::move(call->request));
+
+        auto responses = batch_call_(std::move(requests));
+        if (responses.size() != batch.size()) {
+            throw RpcError(
+                call_name_,
+                "the batch call returned " + std::to_string(responses.size()) + " responses for " +
+                    std::to_string(batch.size()) + " requests"
+            );
+        }
+        for (std::size_t i = 0; i < batch.size(); ++i) batch[i]->response.emplace(std::move(responses[i]));
+    } catch (const std::exception&) {
+        const auto error = std::current_exception();
+        for (auto* call : batch) call->error = error;
+    }
+}
+
+}  // namespace ugrpc::client
+
+USERVER_NAMESPACE_END
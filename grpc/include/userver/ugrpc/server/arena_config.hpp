@@ -0,0 +1,32 @@
+#pragma once
+
+/// @file userver/ugrpc/server/arena_config.hpp
+/// @brief @copybrief ugrpc::server::ArenaConfig
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server {
+
+/// @brief Per-call `google::protobuf::Arena` for the request messages
+///
+/// The request of a unary or a server-streaming RPC is parsed into the arena
+/// of the call, and the arena is freed at once after the call finishes. It
+/// pays off for the requests with many nested or repeated fields.
+///
+/// @warning Moving a message out of the arena into a message that is not on
+/// the same arena copies it.
+struct ArenaConfig final {
+    /// Initial block size of the arenas in bytes, 0 disables the arenas
+    std::size_t initial_block_size{0};
+
+    /// Overrides of `initial_block_size` by the method name, e.g. `SayHello`
+    std::unordered_map<std::string, std::size_t> method_initial_block_sizes{};
+};
+
+}  // namespace ugrpc::server
+
+USERVER_NAMESPACE_END
@@ -95,6 +95,11 @@ public:
     // For internal use only
     ugrpc::impl::RpcStatisticsScope& GetStatistics(ugrpc::impl::InternalTag);
 
+    // For internal use only
+    std::chrono::steady_clock::time_point GetPrepareTime(utils::impl::InternalTag) const {
+        return params_.prepare_time;
+    }
+
     // For internal use only
     void RunMiddlewarePipeline(utils::impl::InternalTag, MiddlewareCallContext& md_call_context);
     /// @endcond
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+
 #include <grpcpp/server_context.h>
 
 #include <userver/engine/single_use_event.hpp>
@@ -33,6 +35,20 @@ private:
     engine::SingleUseEvent event_;
 };
 
+/// Remembers when the completion queue delivered a new RPC, so that the time
+/// spent waiting for the handler task to start can be measured
+class RpcPreparedEvent final : public ugrpc::impl::AsyncMethodInvocation {
+public:
+    /// @see EventBase::Notify
+    void Notify(bool ok) noexcept override;
+
+    /// @brief For use from coroutines, after the event is waited for
+    std::chrono::steady_clock::time_point GetNotifyTime() const noexcept { return notify_time_; }
+
+private:
+    std::chrono::steady_clock::time_point notify_time_;
+};
+
 ugrpc::impl::AsyncMethodInvocation::WaitStatus Wait(ugrpc::impl::AsyncMethodInvocation& async);
 
 }  // namespace ugrpc::server::impl
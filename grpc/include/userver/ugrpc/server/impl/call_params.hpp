@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <string_view>
 
 #include <grpcpp/completion_queue.h>
@@ -33,6 +34,8 @@ struct CallParams {
     tracing::Span& call_span;
     utils::AnyStorage<StorageContext>& storage_context;
     const Middlewares& middlewares;
+    // when the completion queue delivered the RPC to the handler task
+    const std::chrono::steady_clock::time_point prepare_time;
 };
 
 }  // namespace ugrpc::server::impl
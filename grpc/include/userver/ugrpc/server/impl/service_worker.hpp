@@ -16,6 +16,7 @@
 
 #include <userver/ugrpc/impl/static_service_metadata.hpp>
 #include <userver/ugrpc/impl/statistics_storage.hpp>
+#include <userver/ugrpc/server/arena_config.hpp>
 #include <userver/ugrpc/server/impl/completion_queue_pool.hpp>
 #include <userver/ugrpc/server/middlewares/fwd.hpp>
 
@@ -31,6 +32,7 @@ struct ServiceSettings final {
     Middlewares middlewares;
     logging::TextLoggerPtr access_tskv_logger;
     const dynamic_config::Source config_source;
+    const ArenaConfig arena;
 };
 
 /// @brief Listens to requests for a gRPC service, forwarding them to a
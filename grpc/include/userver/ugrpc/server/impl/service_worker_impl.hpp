@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <exception>
 #include <functional>
 #include <optional>
@@ -7,6 +8,7 @@
 #include <type_traits>
 #include <utility>
 
+#include <google/protobuf/arena.h>
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/impl/service_type.h>
 #include <grpcpp/server_context.h>
@@ -74,6 +76,9 @@ void ParseGenericCallName(
     std::string_view& method_name
 );
 
+/// @returns 0 if the requests of the method are not allocated on arenas
+std::size_t GetArenaInitialBlockSize(const ArenaConfig& config, std::string_view method_name);
+
 /// Per-gRPC-service data
 template <typename GrpcppService>
 struct ServiceData final {
@@ -103,6 +108,7 @@ struct MethodData final {
     // Remove name of the service and slash
     std::string_view method_name{GetMethodName(service_data.metadata, method_id)};
     ugrpc::impl::MethodStatistics& statistics{service_data.service_statistics.GetMethodStatistics(method_id)};
+    std::size_t arena_initial_block_size{GetArenaInitialBlockSize(service_data.settings.arena, method_name)};
 };
 
 template <typename GrpcppService, typename CallTraits>
@@ -168,6 +174,19 @@ private:
     using RawCall = typename CallTraits::RawCall;
     using Call = typename CallTraits::Call;
 
+    InitialRequest& MakeInitialRequest() {
+        if constexpr (!std::is_same_v<InitialRequest, NoInitialRequest>) {
+            if (method_data_.arena_initial_block_size != 0) {
+                google::protobuf::ArenaOptions options;
+                options.initial_block_size = method_data_.arena_initial_block_size;
+                options.max_block_size = std::max(options.max_block_size, options.initial_block_size);
+                arena_.emplace(options);
+                return *google::protobuf::Arena::Create<InitialRequest>(&*arena_);
+            }
+        }
+        return initial_request_storage_;
+    }
+
     void HandleRpc() {
         auto call_name = method_data_.call_name;
         auto service_name = method_data_.service_data.metadata.service_full_name;
@@ -198,7 +217,8 @@ private:
                 *access_tskv_logger,
                 span_->Get(),
                 storage_context,
-                middlewares},
+                middlewares,
+                prepare_.GetNotifyTime()},
             raw_responder_
         );
 
@@ -264,9 +284,13 @@ private:
     MethodData<GrpcppService, CallTraits> method_data_;
 
     typename CallTraits::ContextType context_{};
-    InitialRequest initial_request_{};
+    // The request is parsed into the arena, if any, and the arena is freed
+    // with all the messages on it after the call finishes
+    std::optional<google::protobuf::Arena> arena_{};
+    InitialRequest initial_request_storage_{};
+    InitialRequest& initial_request_{MakeInitialRequest()};
     RawCall raw_responder_{&context_};
-    ugrpc::impl::AsyncMethodInvocation prepare_;
+    RpcPreparedEvent prepare_;
     std::optional<tracing::InPlaceSpan> span_{};
 };
 
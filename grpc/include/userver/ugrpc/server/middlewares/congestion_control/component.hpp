@@ -17,9 +17,22 @@ class Middleware;
 
 /// @ingroup userver_components userver_base_classes
 ///
-/// @brief Component for gRPC server logging
+/// @brief Component for gRPC server congestion control
 ///
-/// The component does **not** have any options for service config.
+/// Rejects the calls with `RESOURCE_EXHAUSTED` when the rate limit set by
+/// the congestion control (components::CongestionControl) is exceeded, or
+/// when the handler task of the call waited for too long in the task
+/// processor queue, so that an overloaded service does not spend time on the
+/// calls that are likely to time out anyway.
+///
+/// The options can be overridden per service in the `middlewares` section of
+/// the service config.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// exempt-methods | names of the methods that are never throttled, e.g. health checks | []
+/// max-queue-wait | reject the calls that waited longer for the handler task to start, 0 disables the check | 0
 ///
 /// ## Static configuration example:
 ///
@@ -39,6 +52,10 @@ public:
     std::shared_ptr<MiddlewareBase>
     CreateMiddleware(const ServiceInfo&, const yaml_config::YamlConfig& middleware_config) const override;
 
+    yaml_config::Schema GetMiddlewareConfigSchema() const override;
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
 private:
     std::shared_ptr<Middleware> middleware_;
 };
@@ -5,6 +5,7 @@
 
 #include <google/protobuf/message.h>
 
+#include <userver/engine/task/cancel.hpp>
 #include <userver/utils/assert.hpp>
 
 #include <userver/ugrpc/impl/deadline_timepoint.hpp>
@@ -29,16 +30,20 @@ public:
     ///
     /// `Finish` must not be called multiple times for the same RPC.
     ///
+    /// The response is sent without waiting for the completion, a network
+    /// error is accounted in the statistics when the call is destroyed.
+    ///
     /// @param response the single Response to send to the client
-    /// @throws ugrpc::server::RpcError on an RPC error
     void Finish(Response& response);
 
     /// @brief Complete the RPC successfully
     ///
     /// `Finish` must not be called multiple times for the same RPC.
     ///
+    /// The response is sent without waiting for the completion, a network
+    /// error is accounted in the statistics when the call is destroyed.
+    ///
     /// @param response the single Response to send to the client
-    /// @throws ugrpc::server::RpcError on an RPC error
     void Finish(Response&& response);
 
     /// @brief Complete the RPC with an error
@@ -61,6 +66,9 @@ public:
 private:
     impl::RawResponseWriter<Response>& stream_;
     bool is_finished_{false};
+    // The response is serialized by grpc::ServerAsyncResponseWriter::Finish,
+    // so the completion is awaited on destruction to save a context switch
+    impl::AsyncMethodInvocation finish_;
 };
 
 /// @brief Controls a request stream -> single response RPC
@@ -131,11 +139,21 @@ template <typename Response>
 class OutputStream final : public CallAnyBase, public Writer<Response> {
 public:
     /// @brief Write the next outgoing message
+    ///
+    /// The message is sent without waiting for the completion of the write,
+    /// so that the handler prepares the next message while the previous one is
+    /// being sent. An error of the write is reported by the next `Write`,
+    /// `Finish` or `WriteAndFinish`.
+    ///
     /// @param response the next message to write
     /// @throws ugrpc::server::RpcError on an RPC error
     void Write(Response& response) override;
 
     /// @brief Write the next outgoing message
+    ///
+    /// The message is sent without waiting for the completion of the write,
+    /// see the overload above.
+    ///
     /// @param response the next message to write
     /// @throws ugrpc::server::RpcError on an RPC error
     void Write(Response&& response) override;
@@ -187,8 +205,13 @@ public:
 private:
     enum class State { kNew, kOpen, kFinished };
 
+    void WaitForPendingWrite();
+
     impl::RawWriter<Response>& stream_;
     State state_{State::kNew};
+    // gRPC allows a single write in flight, the message is serialized by
+    // grpc::ServerAsyncWriter::Write
+    impl::AsyncMethodInvocation pending_write_;
 };
 
 /// @brief Controls a request stream -> response stream RPC
@@ -281,6 +304,17 @@ UnaryCall<Response>::~UnaryCall() {
     if (!is_finished_) {
         impl::CancelWithError(stream_, GetCallName());
         LogFinish(impl::kUnknownErrorStatus);
+    } else if (finish_.IsBusy()) {
+        const bool is_cancelled = engine::current_task::ShouldCancel();
+        const engine::TaskCancellationBlocker blocker;
+        if (finish_.Wait() != impl::AsyncMethodInvocation::WaitStatus::kOk) {
+            // the same accounting as for the RpcInterruptedError of a waited Finish
+            if (is_cancelled) {
+                GetStatistics().OnCancelled();
+            } else {
+                GetStatistics().OnNetworkError();
+            }
+        }
     }
 }
 
@@ -299,7 +333,7 @@ void UnaryCall<Response>::Finish(Response& response) {
     is_finished_ = true;
 
     LogFinish(grpc::Status::OK);
-    impl::Finish(stream_, response, grpc::Status::OK, GetCallName());
+    stream_.Finish(response, grpc::Status::OK, finish_.GetTag());
     GetStatistics().OnExplicitFinish(grpc::StatusCode::OK);
     ugrpc::impl::UpdateSpanWithStatus(GetSpan(), grpc::Status::OK);
 }
@@ -388,6 +422,10 @@ OutputStream<Response>::OutputStream(impl::CallParams&& call_params, impl::RawWr
 template <typename Response>
 OutputStream<Response>::~OutputStream() {
     if (state_ != State::kFinished) {
+        if (pending_write_.IsBusy()) {
+            // the write must complete before the cancelling Finish is started
+            [[maybe_unused]] const auto write_status = impl::Wait(pending_write_);
+        }
         impl::Cancel(stream_, GetCallName());
         LogFinish(impl::kUnknownErrorStatus);
     }
@@ -411,12 +449,14 @@ void OutputStream<Response>::Write(Response& response) {
     // may never actually be delivered
     grpc::WriteOptions write_options{};
 
-    impl::Write(stream_, response, write_options, GetCallName());
+    WaitForPendingWrite();
+    stream_.Write(response, write_options, pending_write_.GetTag());
 }
 
 template <typename Response>
 void OutputStream<Response>::Finish() {
     UINVARIANT(state_ != State::kFinished, "'Finish' called on a finished stream");
+    WaitForPendingWrite();
     state_ = State::kFinished;
 
     const auto& status = grpc::Status::OK;
@@ -430,6 +470,7 @@ template <typename Response>
 void OutputStream<Response>::FinishWithError(const grpc::Status& status) {
     UASSERT(!status.ok());
     if (IsFinished()) return;
+    WaitForPendingWrite();
     state_ = State::kFinished;
     LogFinish(status);
     impl::Finish(stream_, status, GetCallName());
@@ -447,6 +488,8 @@ void OutputStream<Response>::WriteAndFinish(Response& response) {
     UINVARIANT(state_ != State::kFinished, "'WriteAndFinish' called on a finished stream");
     ApplyResponseHook(&response);
 
+    WaitForPendingWrite();
+
     // It is important to set the state_ after ApplyResponseHook.
     // Otherwise, there would be no way to call FinishWithError there.
     state_ = State::kFinished;
@@ -468,6 +511,11 @@ bool OutputStream<Response>::IsFinished() const {
     return state_ == State::kFinished;
 }
 
+template <typename Response>
+void OutputStream<Response>::WaitForPendingWrite() {
+    if (pending_write_.IsBusy()) impl::ThrowOnError(impl::Wait(pending_write_), GetCallName(), "Write");
+}
+
 template <typename Request, typename Response>
 BidirectionalStream<Request, Response>::BidirectionalStream(
     impl::CallParams&& call_params,
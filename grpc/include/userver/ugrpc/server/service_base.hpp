@@ -5,6 +5,7 @@
 
 #include <userver/engine/task/task_processor_fwd.hpp>
 
+#include <userver/ugrpc/server/arena_config.hpp>
 #include <userver/ugrpc/server/call_context.hpp>
 #include <userver/ugrpc/server/impl/service_worker.hpp>
 #include <userver/ugrpc/server/middlewares/fwd.hpp>
@@ -20,6 +21,9 @@ struct ServiceConfig final {
 
     /// Server middlewares to use for the gRPC service.
     Middlewares middlewares;
+
+    /// Protobuf arenas for the request messages of the gRPC service.
+    ArenaConfig arena{};
 };
 
 /// @brief The type-erased base class for all gRPC service implementations
@@ -37,6 +37,8 @@ struct ServiceInfo final {
 /// task-processor | the task processor to use for responses | taken from grpc-server.service-defaults
 /// disable-user-pipeline-middlewares | flag to disable `groups::User` middlewares from pipeline | false
 /// disable-all-pipeline-middlewares | flag to disable all middlewares from pipline | false
+/// arena-initial-block-size | initial block size of the per-call protobuf arenas of the request messages, see ugrpc::server::ArenaConfig | 0 (no arenas)
+/// arena-method-initial-block-sizes | overrides of `arena-initial-block-size` per method name | `{}`
 /// middlewares | middlewares names to use | `{}` (use server defaults)
 
 // clang-format on
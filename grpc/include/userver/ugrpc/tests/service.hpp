@@ -63,6 +63,10 @@ public:
     /// Server middlewares can be modified before the first RegisterService call.
     void SetServerMiddlewares(server::Middlewares middlewares);
 
+    /// Protobuf arenas of the services can be modified before the first
+    /// RegisterService call.
+    void SetServerArenaConfig(server::ArenaConfig arena_config);
+
     /// Client middlewares can be modified before the first RegisterService call.
     void SetClientMiddlewareFactories(client::MiddlewareFactories middleware_factories);
 
@@ -93,6 +97,7 @@ private:
     std::optional<std::string> unix_socket_path_;
     server::Server server_;
     server::Middlewares server_middlewares_;
+    server::ArenaConfig server_arena_config_;
     client::MiddlewareFactories client_middleware_factories_;
     bool middlewares_change_allowed_{true};
     testsuite::GrpcControl testsuite_;
@@ -1,6 +1,10 @@
 #include <userver/ugrpc/byte_buffer_utils.hpp>
 
+#include <cstdint>
+#include <stdexcept>
+
 #include <fmt/format.h>
+#include <google/protobuf/io/coded_stream.h>
 #include <grpcpp/support/proto_buffer_reader.h>
 #include <grpcpp/support/proto_buffer_writer.h>
 
@@ -11,22 +15,51 @@ USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc {
 
+namespace {
+
+[[noreturn]] void ThrowSerializationError(const ::google::protobuf::Message& message) {
+    throw std::runtime_error(fmt::format("Failed to serialize Protobuf message of type {}", message.GetTypeName()));
+}
+
+}  // namespace
+
 grpc::ByteBuffer SerializeToByteBuffer(const ::google::protobuf::Message& message, std::size_t block_size) {
+    // Computes and caches the sizes of the submessages, so that they are not
+    // traversed again during serialization
+    const auto size = message.ByteSizeLong();
+
+    if (size <= block_size) {
+        // A single slice of the exact size, filled in place without the
+        // ZeroCopyOutputStream indirection
+        grpc::Slice slice{size};
+        auto* const end = message.SerializeWithCachedSizesToArray(const_cast<std::uint8_t*>(slice.begin()));
+        if (end != slice.end()) ThrowSerializationError(message);
+        return grpc::ByteBuffer{&slice, 1};
+    }
+
     grpc::ByteBuffer buffer;
-    // NOLINTNEXTLINE(clang-analyzer-optin.cplusplus.UninitializedObject)
-    grpc::ProtoBufferWriter writer{
-        &buffer,
-        /*block_size*/ utils::numeric_cast<int>(block_size),
-        /*total_size*/ utils::numeric_cast<int>(message.ByteSizeLong()),
-    };
-    const bool success = message.SerializeToZeroCopyStream(&writer);
-    if (!success) {
-        throw std::runtime_error(fmt::format("Failed to serialize Protobuf message of type {}", message.GetTypeName()));
+    {
+        // NOLINTNEXTLINE(clang-analyzer-optin.cplusplus.UninitializedObject)
+        grpc::ProtoBufferWriter writer{
+            &buffer,
+            /*block_size*/ utils::numeric_cast<int>(block_size),
+            /*total_size*/ utils::numeric_cast<int>(size),
+        };
+        ::google::protobuf::io::CodedOutputStream stream{&writer};
+        message.SerializeWithCachedSizes(&stream);
+        if (stream.HadError()) ThrowSerializationError(message);
     }
     return buffer;
 }
 
 bool ParseFromByteBuffer(grpc::ByteBuffer&& buffer, ::google::protobuf::Message& message) {
+    // Messages that arrive in a single slice are parsed right from it, the
+    // parser is the fastest on a flat buffer
+    grpc::Slice slice;
+    if (buffer.TrySingleSlice(&slice).ok()) {
+        return message.ParseFromArray(slice.begin(), utils::numeric_cast<int>(slice.size()));
+    }
+
     grpc::ProtoBufferReader reader{&buffer};
     return message.ParseFromZeroCopyStream(&reader);
 }
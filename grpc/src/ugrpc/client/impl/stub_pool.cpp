@@ -1,12 +1,30 @@
 #include <userver/ugrpc/client/impl/stub_pool.hpp>
 
+#include <userver/utils/assert.hpp>
 #include <userver/utils/rand.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::client::impl {
 
-StubAny& StubPool::NextStub() const { return stubs_[utils::RandRange(stubs_.size())]; }
+std::size_t StubPool::NextStubIndex() const {
+    UASSERT(!stubs_.empty());
+    const auto size = stubs_.size();
+
+    // The random start spreads the RPCs between the equally loaded channels
+    const auto start = utils::RandRange(size);
+    auto best_index = start;
+    auto best_in_flight = in_flight_[start].load(std::memory_order_relaxed);
+    for (std::size_t i = 1; i < size && best_in_flight != 0; ++i) {
+        const auto index = (start + i) % size;
+        const auto in_flight = in_flight_[index].load(std::memory_order_relaxed);
+        if (in_flight < best_in_flight) {
+            best_index = index;
+            best_in_flight = in_flight;
+        }
+    }
+    return best_index;
+}
 
 }  // namespace ugrpc::client::impl
 
@@ -18,7 +18,7 @@ additionalProperties: false
 properties:
     endpoint:
         type: string
-        description: URL of the gRPC service
+        description: URL of the gRPC service, `unix:<absolute-path>` for a unix domain socket
     client-name:
         type: string
         description: name of the gRPC server we talk to, for diagnostics
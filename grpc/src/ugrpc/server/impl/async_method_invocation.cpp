@@ -24,6 +24,11 @@ void RpcFinishedEvent::Notify(bool ok) noexcept {
     event_.Send();
 }
 
+void RpcPreparedEvent::Notify(bool ok) noexcept {
+    notify_time_ = std::chrono::steady_clock::now();
+    AsyncMethodInvocation::Notify(ok);
+}
+
 ugrpc::impl::AsyncMethodInvocation::WaitStatus Wait(ugrpc::impl::AsyncMethodInvocation& async) {
     using WaitStatus = ugrpc::impl::AsyncMethodInvocation::WaitStatus;
 
@@ -2,6 +2,7 @@
 
 #include <boost/range/adaptor/transformed.hpp>
 
+#include <userver/formats/parse/common_containers.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/logging/component.hpp>
 #include <userver/logging/impl/logger_base.hpp>
@@ -71,6 +72,11 @@ server::ServiceConfig ParseServiceConfig(
             value[kTaskProcessorKey], defaults.task_processor, context, ParseTaskProcessor
         ),
         /*middlewares=*/{},
+        /*arena=*/
+        server::ArenaConfig{
+            value["arena-initial-block-size"].As<std::size_t>(0),
+            value["arena-method-initial-block-sizes"].As<std::unordered_map<std::string, std::size_t>>({}),
+        },
     };
 }
 
@@ -146,6 +146,11 @@ void ParseGenericCallName(
     method_name = generic_call_name.substr(slash_pos + 1);
 }
 
+std::size_t GetArenaInitialBlockSize(const ArenaConfig& config, std::string_view method_name) {
+    const auto* method_size = utils::FindOrNullptr(config.method_initial_block_sizes, std::string{method_name});
+    return method_size ? *method_size : config.initial_block_size;
+}
+
 }  // namespace ugrpc::server::impl
 
 USERVER_NAMESPACE_END
@@ -27,8 +27,32 @@ Component::Component(const components::ComponentConfig& config, const components
     server_sensor.RegisterRequestsSource(server);
 }
 
-std::shared_ptr<MiddlewareBase> Component::CreateMiddleware(const ServiceInfo&, const yaml_config::YamlConfig&) const {
-    return middleware_;
+std::shared_ptr<MiddlewareBase>
+Component::CreateMiddleware(const ServiceInfo&, const yaml_config::YamlConfig& middleware_config) const {
+    return std::make_shared<Middleware>(*middleware_, middleware_config.As<Settings>());
+}
+
+yaml_config::Schema Component::GetMiddlewareConfigSchema() const { return GetStaticConfigSchema(); }
+
+yaml_config::Schema Component::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<MiddlewareFactoryComponentBase>(R"(
+type: object
+description: gRPC server congestion control middleware component
+additionalProperties: false
+properties:
+    exempt-methods:
+        type: array
+        description: names of the methods that are never throttled, e.g. health checks
+        items:
+            type: string
+            description: method name without the service name
+    max-queue-wait:
+        type: string
+        description: |
+            reject the calls that waited longer for the handler task to start
+            with RESOURCE_EXHAUSTED, 0 disables the check
+        defaultDescription: 0
+)");
 }
 
 }  // namespace ugrpc::server::middlewares::congestion_control
@@ -1,5 +1,9 @@
 #include <ugrpc/server/middlewares/congestion_control/middleware.hpp>
 
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/utils/impl/internal_tag.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
 #include <ugrpc/impl/rpc_metadata.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -21,28 +25,62 @@ bool CheckRatelimit(utils::TokenBucket& rate_limit, std::string_view call_name)
     return false;
 }
 
+bool CheckQueueWait(CallAnyBase& call, std::chrono::milliseconds max_queue_wait) {
+    if (max_queue_wait.count() == 0) return true;
+
+    const auto queue_wait = std::chrono::steady_clock::now() - call.GetPrepareTime(utils::impl::InternalTag{});
+    if (queue_wait <= max_queue_wait) return true;
+
+    LOG_LIMITED_ERROR() << "Request throttled (congestion control, the handler task waited for "
+                        << std::chrono::duration_cast<std::chrono::milliseconds>(queue_wait).count()
+                        << "ms to start, limit via 'max-queue-wait'), "
+                        << "limit=" << max_queue_wait.count() << "ms, "
+                        << "service/method=" << call.GetCallName();
+
+    return false;
+}
+
 }  // namespace
 
+Settings Parse(const yaml_config::YamlConfig& config, formats::parse::To<Settings>) {
+    Settings settings;
+    settings.exempt_methods = config["exempt-methods"].As<std::unordered_set<std::string>>({});
+    settings.max_queue_wait = config["max-queue-wait"].As<std::chrono::milliseconds>(settings.max_queue_wait);
+    return settings;
+}
+
+Middleware::Middleware(Settings settings)
+    : settings_(std::move(settings)),
+      rate_limit_(std::make_shared<utils::TokenBucket>(utils::TokenBucket::MakeUnbounded())) {}
+
+Middleware::Middleware(const Middleware& other, Settings settings)
+    : settings_(std::move(settings)), rate_limit_(other.rate_limit_) {}
+
 void Middleware::SetLimit(std::optional<size_t> new_limit) {
     if (new_limit) {
         const auto rps_val = *new_limit;
         if (rps_val > 0) {
-            rate_limit_.SetMaxSize(rps_val);
-            rate_limit_.SetRefillPolicy({1, utils::TokenBucket::Duration{std::chrono::seconds(1)} / rps_val});
+            rate_limit_->SetMaxSize(rps_val);
+            rate_limit_->SetRefillPolicy({1, utils::TokenBucket::Duration{std::chrono::seconds(1)} / rps_val});
         } else {
-            rate_limit_.SetMaxSize(0);
+            rate_limit_->SetMaxSize(0);
         }
     } else {
-        rate_limit_.SetMaxSize(1);  // in case it was zero
-        rate_limit_.SetInstantRefillPolicy();
+        rate_limit_->SetMaxSize(1);  // in case it was zero
+        rate_limit_->SetInstantRefillPolicy();
     }
 }
 
 void Middleware::Handle(MiddlewareCallContext& context) const {
     auto& call = context.GetCall();
 
-    if (!CheckRatelimit(rate_limit_, context.GetCall().GetCallName())) {
-        auto& server_context = context.GetCall().GetContext();
+    if (!settings_.exempt_methods.empty() && settings_.exempt_methods.count(std::string{call.GetMethodName()})) {
+        context.Next();
+        return;
+    }
+
+    if (!CheckQueueWait(call, settings_.max_queue_wait) || !CheckRatelimit(*rate_limit_, call.GetCallName())) {
+        auto& server_context = call.GetContext();
 
         server_context.AddInitialMetadata(ugrpc::impl::kXYaTaxiRatelimitedBy, ugrpc::impl::kHostname);
         server_context.AddInitialMetadata(
@@ -1,21 +1,45 @@
 #pragma once
 
+#include <chrono>
+#include <memory>
+#include <string>
+#include <unordered_set>
+
 #include <userver/server/congestion_control/limiter.hpp>
 #include <userver/ugrpc/server/middlewares/base.hpp>
 #include <userver/utils/token_bucket.hpp>
+#include <userver/yaml_config/fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::server::middlewares::congestion_control {
 
+struct Settings {
+    /// Names of the methods of the service that are never throttled,
+    /// e.g. health checks
+    std::unordered_set<std::string> exempt_methods;
+
+    /// The calls that waited longer for the handler task to start are
+    /// rejected, 0 disables the check
+    std::chrono::milliseconds max_queue_wait{0};
+};
+
+Settings Parse(const yaml_config::YamlConfig& config, formats::parse::To<Settings>);
+
 class Middleware final : public MiddlewareBase, public USERVER_NAMESPACE::server::congestion_control::Limitee {
 public:
+    explicit Middleware(Settings settings = {});
+
+    /// Shares the rate limit set by the congestion control with `other`
+    Middleware(const Middleware& other, Settings settings);
+
     void Handle(MiddlewareCallContext& context) const override;
 
     void SetLimit(std::optional<size_t> new_limit) override;
 
 private:
-    mutable utils::TokenBucket rate_limit_{utils::TokenBucket::MakeUnbounded()};
+    const Settings settings_;
+    const std::shared_ptr<utils::TokenBucket> rate_limit_;
 };
 
 }  // namespace ugrpc::server::middlewares::congestion_control
@@ -196,6 +196,7 @@ impl::ServiceSettings Server::Impl::MakeServiceSettings(ServiceConfig&& config)
         std::move(config.middlewares),
         access_tskv_logger_,
         config_source_,
+        std::move(config.arena),
     };
 }
 
@@ -83,6 +83,19 @@ properties:
         type: boolean
         description: flag to disable all middlewares from pipline
         defaultDescription: false
+    arena-initial-block-size:
+        type: integer
+        description: initial block size of the per-call protobuf arenas of the request messages, 0 disables the arenas
+        defaultDescription: 0
+        minimum: 0
+    arena-method-initial-block-sizes:
+        type: object
+        description: overrides of arena-initial-block-size per method name
+        additionalProperties:
+            type: integer
+            description: initial block size of the arenas of the method
+            minimum: 0
+        properties: {}
     middlewares:
         type: object
         description: overloads of configs of middlewares per service
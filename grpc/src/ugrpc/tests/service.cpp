@@ -34,6 +34,7 @@ server::ServiceConfig ServiceBase::MakeServiceConfig() {
     return server::ServiceConfig{
         engine::current_task::GetTaskProcessor(),
         server_middlewares_,
+        server_arena_config_,
     };
 }
 
@@ -81,6 +82,15 @@ void ServiceBase::SetServerMiddlewares(server::Middlewares middlewares) {
     server_middlewares_ = std::move(middlewares);
 }
 
+void ServiceBase::SetServerArenaConfig(server::ArenaConfig arena_config) {
+    UINVARIANT(
+        middlewares_change_allowed_,
+        "Set server arena config after RegisterService call "
+        "is not allowed"
+    );
+    server_arena_config_ = std::move(arena_config);
+}
+
 void ServiceBase::SetClientMiddlewareFactories(client::MiddlewareFactories middleware_factories) {
     UINVARIANT(
         middlewares_change_allowed_,
@@ -0,0 +1,70 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/ugrpc/tests/service.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class UnitTestServiceWithArena final : public sample::ugrpc::UnitTestServiceBase {
+public:
+    SayHelloResult SayHello(CallContext& /*context*/, sample::ugrpc::GreetingRequest&& request) override {
+        sample::ugrpc::GreetingResponse response;
+        response.set_name(request.GetArena() ? "arena " + request.name() : "heap " + request.name());
+        return response;
+    }
+
+    ReadManyResult ReadMany(
+        CallContext& /*context*/,
+        sample::ugrpc::StreamGreetingRequest&& request,
+        ReadManyWriter& writer
+    ) override {
+        sample::ugrpc::StreamGreetingResponse response;
+        response.set_name(request.GetArena() ? "arena " + request.name() : "heap " + request.name());
+        writer.Write(response);
+        return grpc::Status::OK;
+    }
+};
+
+// NOLINTNEXTLINE(fuchsia-multiple-inheritance)
+class GrpcArenaTest : public ugrpc::tests::ServiceBase, public ::testing::Test {
+public:
+    GrpcArenaTest() {
+        SetServerArenaConfig({/*initial_block_size=*/0, {{"SayHello", 4096}}});
+        RegisterService(service_);
+        StartServer();
+    }
+
+    ~GrpcArenaTest() override { StopServer(); }
+
+private:
+    UnitTestServiceWithArena service_;
+};
+
+}  // namespace
+
+UTEST_F(GrpcArenaTest, RequestOnArena) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    sample::ugrpc::GreetingRequest request;
+    request.set_name("userver");
+    EXPECT_EQ(client.SayHello(request).name(), "arena userver");
+    // the arena of every call is new
+    EXPECT_EQ(client.SayHello(request).name(), "arena userver");
+}
+
+UTEST_F(GrpcArenaTest, MethodWithoutArena) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    sample::ugrpc::StreamGreetingRequest request;
+    request.set_name("userver");
+    auto stream = client.ReadMany(request);
+
+    sample::ugrpc::StreamGreetingResponse response;
+    ASSERT_TRUE(stream.Read(response));
+    EXPECT_EQ(response.name(), "heap userver");
+    EXPECT_FALSE(stream.Read(response));
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,73 @@
+#include <userver/ugrpc/byte_buffer_utils.hpp>
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <tests/messages.pb.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+sample::ugrpc::GreetingResponse MakeMessage(std::size_t size) {
+    sample::ugrpc::GreetingResponse message;
+    message.set_name(std::string(size, 'a'));
+    message.set_greeting("hello");
+    return message;
+}
+
+std::size_t SliceCount(const grpc::ByteBuffer& buffer) {
+    std::vector<grpc::Slice> slices;
+    EXPECT_TRUE(buffer.Dump(&slices).ok());
+    return slices.size();
+}
+
+}  // namespace
+
+TEST(ByteBufferUtils, SmallMessageIsSingleSlice) {
+    const auto message = MakeMessage(100);
+    auto buffer = ugrpc::SerializeToByteBuffer(message);
+    EXPECT_EQ(buffer.Length(), message.ByteSizeLong());
+    EXPECT_EQ(SliceCount(buffer), 1);
+
+    sample::ugrpc::GreetingResponse parsed;
+    ASSERT_TRUE(ugrpc::ParseFromByteBuffer(std::move(buffer), parsed));
+    EXPECT_EQ(parsed.name(), message.name());
+    EXPECT_EQ(parsed.greeting(), message.greeting());
+}
+
+TEST(ByteBufferUtils, LargeMessageIsSplitIntoBlocks) {
+    const auto message = MakeMessage(10000);
+    auto buffer = ugrpc::SerializeToByteBuffer(message, 1024);
+    EXPECT_EQ(buffer.Length(), message.ByteSizeLong());
+    EXPECT_GT(SliceCount(buffer), 1);
+
+    sample::ugrpc::GreetingResponse parsed;
+    ASSERT_TRUE(ugrpc::ParseFromByteBuffer(std::move(buffer), parsed));
+    EXPECT_EQ(parsed.name(), message.name());
+    EXPECT_EQ(parsed.greeting(), message.greeting());
+}
+
+TEST(ByteBufferUtils, EmptyMessage) {
+    const sample::ugrpc::GreetingResponse message;
+    auto buffer = ugrpc::SerializeToByteBuffer(message);
+    EXPECT_EQ(buffer.Length(), 0);
+
+    sample::ugrpc::GreetingResponse parsed;
+    parsed.set_name("old");
+    ASSERT_TRUE(ugrpc::ParseFromByteBuffer(std::move(buffer), parsed));
+    EXPECT_TRUE(parsed.name().empty());
+}
+
+TEST(ByteBufferUtils, InvalidMessage) {
+    const std::string garbage = "\xff\xff\xff";
+    grpc::Slice slice{garbage};
+    grpc::ByteBuffer buffer{&slice, 1};
+
+    sample::ugrpc::GreetingResponse parsed;
+    EXPECT_FALSE(ugrpc::ParseFromByteBuffer(std::move(buffer), parsed));
+}
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include <userver/ugrpc/client/client_factory.hpp>
 
+#include <vector>
+
 #include <userver/ugrpc/client/impl/client_data.hpp>
 #include <userver/utest/utest.hpp>
 
@@ -18,6 +20,25 @@ UTEST_P(GrpcClientMultichannel, ChannelsCount) {
     ASSERT_EQ(stub_state->stubs.Size(), GetParam());
 }
 
+UTEST_P(GrpcClientMultichannel, LeastLoadedChannel) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    const auto& data = ugrpc::client::impl::GetClientData(client);
+
+    // every channel gets an RPC before any of them gets the second one
+    std::vector<ugrpc::client::impl::ClientData::StubHandle> handles;
+    for (std::size_t i = 0; i < GetParam(); ++i) handles.push_back(data.NextStub());
+
+    const auto stub_state = data.GetStubState();
+    for (std::size_t i = 0; i < stub_state->stubs.Size(); ++i) {
+        EXPECT_EQ(stub_state->stubs.GetInFlightCounter(i).load(), 1);
+    }
+
+    handles.clear();
+    for (std::size_t i = 0; i < stub_state->stubs.Size(); ++i) {
+        EXPECT_EQ(stub_state->stubs.GetInFlightCounter(i).load(), 0);
+    }
+}
+
 INSTANTIATE_UTEST_SUITE_P(/*no prefix*/, GrpcClientMultichannel, testing::Values(std::size_t{1}, std::size_t{4}));
 
 USERVER_NAMESPACE_END
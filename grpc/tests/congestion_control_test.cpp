@@ -38,6 +38,24 @@ private:
     UnitTestService service_;
 };
 
+class CongestionControlExemptTest : public ugrpc::tests::ServiceFixtureBase {
+protected:
+    CongestionControlExemptTest() {
+        ugrpc::server::middlewares::congestion_control::Settings settings;
+        settings.exempt_methods.insert("SayHello");
+        auto congestion_control_middleware =
+            std::make_shared<ugrpc::server::middlewares::congestion_control::Middleware>(std::move(settings));
+        congestion_control_middleware->SetLimit(0);
+        SetServerMiddlewares({congestion_control_middleware});
+
+        RegisterService(service_);
+        StartServer();
+    }
+
+private:
+    UnitTestService service_;
+};
+
 }  // namespace
 
 UTEST_F(CongestionControlTest, Basic) {
@@ -56,4 +74,12 @@ UTEST_F(CongestionControlTest, Basic) {
     );
 }
 
+UTEST_F(CongestionControlExemptTest, ExemptMethod) {
+    const auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+    sample::ugrpc::GreetingRequest out;
+    out.set_name("userver");
+    EXPECT_EQ(client.SayHello(out).name(), "Hello userver");
+}
+
 USERVER_NAMESPACE_END
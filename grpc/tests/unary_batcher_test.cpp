@@ -0,0 +1,95 @@
+#include <userver/ugrpc/client/unary_batcher.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Batcher = ugrpc::client::UnaryBatcher<int, int>;
+
+constexpr std::size_t kCalls = 10;
+
+}  // namespace
+
+UTEST_MT(UnaryBatcher, ConcurrentCallsAreBatched, 2) {
+    std::atomic<std::size_t> batches{0};
+    Batcher batcher{"test/Test", {std::chrono::milliseconds{50}, kCalls}, [&](std::vector<int>&& requests) {
+                        ++batches;
+                        for (auto& request : requests) request *= 2;
+                        return std::move(requests);
+                    }};
+
+    std::vector<engine::TaskWithResult<int>> tasks;
+    for (std::size_t i = 0; i < kCalls; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([&batcher, i] { return batcher.Call(static_cast<int>(i)); }));
+    }
+    for (std::size_t i = 0; i < kCalls; ++i) EXPECT_EQ(tasks[i].Get(), static_cast<int>(i) * 2);
+
+    // the batch is sent as soon as it is full, long before the window ends
+    EXPECT_EQ(batches.load(), 1);
+}
+
+UTEST(UnaryBatcher, MaxBatchSize) {
+    std::vector<std::size_t> batch_sizes;
+    Batcher batcher{"test/Test", {std::chrono::milliseconds{10}, 3}, [&](std::vector<int>&& requests) {
+                        batch_sizes.push_back(requests.size());
+                        return std::move(requests);
+                    }};
+
+    std::vector<engine::TaskWithResult<int>> tasks;
+    for (std::size_t i = 0; i < 7; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([&batcher, i] { return batcher.Call(static_cast<int>(i)); }));
+    }
+    for (std::size_t i = 0; i < tasks.size(); ++i) EXPECT_EQ(tasks[i].Get(), static_cast<int>(i));
+
+    EXPECT_EQ(batch_sizes, (std::vector<std::size_t>{3, 3, 1}));
+}
+
+UTEST(UnaryBatcher, ErrorIsPropagatedToAllCalls) {
+    Batcher batcher{"test/Test", {std::chrono::milliseconds{10}, 2}, [](std::vector<int>&&) -> std::vector<int> {
+                        throw std::runtime_error("batch failed");
+                    }};
+
+    auto first = engine::AsyncNoSpan([&batcher] { return batcher.Call(1); });
+    auto second = engine::AsyncNoSpan([&batcher] { return batcher.Call(2); });
+    UEXPECT_THROW(first.Get(), std::runtime_error);
+    UEXPECT_THROW(second.Get(), std::runtime_error);
+}
+
+UTEST(UnaryBatcher, ResponsesCountMismatch) {
+    Batcher batcher{"test/Test", {std::chrono::microseconds{0}, 1}, [](std::vector<int>&&) {
+                        return std::vector<int>{};
+                    }};
+    UEXPECT_THROW(batcher.Call(1), ugrpc::client::RpcError);
+}
+
+UTEST(UnaryBatcher, CancelledBeforeBatch) {
+    std::vector<int> batch;
+    // the leader waits until the batch is full
+    Batcher batcher{"test/Test", {utest::kMaxTestWaitTime, 3}, [&](std::vector<int>&& requests) {
+                        batch = requests;
+                        return std::move(requests);
+                    }};
+
+    auto leader = engine::AsyncNoSpan([&batcher] { return batcher.Call(1); });
+    auto cancelled = engine::AsyncNoSpan([&batcher] { return batcher.Call(2); });
+    engine::Yield();
+    cancelled.RequestCancel();
+    UEXPECT_THROW(cancelled.Get(), ugrpc::client::RpcCancelledError);
+
+    auto second = engine::AsyncNoSpan([&batcher] { return batcher.Call(3); });
+    auto third = engine::AsyncNoSpan([&batcher] { return batcher.Call(4); });
+    EXPECT_EQ(leader.Get(), 1);
+    EXPECT_EQ(second.Get(), 3);
+    EXPECT_EQ(third.Get(), 4);
+    EXPECT_EQ(batch, (std::vector<int>{1, 3, 4}));
+}
+
+USERVER_NAMESPACE_END
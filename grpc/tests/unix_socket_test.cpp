@@ -0,0 +1,80 @@
+#include <userver/utest/utest.hpp>
+
+#include <string>
+
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/ugrpc/server/server.hpp>
+#include <userver/ugrpc/tests/service.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class UnitTestService final : public sample::ugrpc::UnitTestServiceBase {
+public:
+    SayHelloResult SayHello(CallContext& /*context*/, sample::ugrpc::GreetingRequest&& request) override {
+        sample::ugrpc::GreetingResponse response;
+        response.set_name("Hello " + request.name());
+        return response;
+    }
+
+    ReadManyResult ReadMany(
+        CallContext& /*context*/,
+        sample::ugrpc::StreamGreetingRequest&& request,
+        ReadManyWriter& writer
+    ) override {
+        sample::ugrpc::StreamGreetingResponse response;
+        // large enough to be split into several HTTP/2 frames
+        response.set_name(std::string(100 * 1024, 'a'));
+        for (int i = 0; i < request.number(); ++i) {
+            response.set_number(i);
+            writer.Write(response);
+        }
+        return grpc::Status::OK;
+    }
+};
+
+ugrpc::server::ServerConfig MakeServerConfig(const fs::blocking::TempDirectory& dir) {
+    ugrpc::server::ServerConfig config;
+    config.port = std::nullopt;
+    config.unix_socket_path = dir.GetPath() + "/grpc.sock";
+    return config;
+}
+
+}  // namespace
+
+UTEST(GrpcUnixSocket, UnaryCall) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    ugrpc::tests::Service<UnitTestService> service{MakeServerConfig(dir)};
+    auto client = service.MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+    sample::ugrpc::GreetingRequest request;
+    request.set_name("userver");
+    EXPECT_EQ(client.SayHello(request).name(), "Hello userver");
+}
+
+UTEST(GrpcUnixSocket, LargeMessagesStream) {
+    constexpr int kMessages = 10;
+
+    const auto dir = fs::blocking::TempDirectory::Create();
+    ugrpc::tests::Service<UnitTestService> service{MakeServerConfig(dir)};
+    auto client = service.MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+    sample::ugrpc::StreamGreetingRequest request;
+    request.set_number(kMessages);
+    auto stream = client.ReadMany(request);
+
+    int count = 0;
+    sample::ugrpc::StreamGreetingResponse response;
+    while (stream.Read(response)) {
+        EXPECT_EQ(response.number(), count);
+        EXPECT_EQ(response.name().size(), 100 * 1024);
+        ++count;
+    }
+    EXPECT_EQ(count, kMessages);
+}
+
+USERVER_NAMESPACE_END
@@ -45,6 +45,8 @@ class Consumer;
 /// poll_timeout                       | maximum amount of time consumer waits for messages for new messages before calling a callback | 1s
 /// max_callback_duration              | duration user callback must fit not to be kicked from the consumer group | 5m
 /// restart_after_failure_delay        | time consumer suspends execution if user-callback fails | 10s
+/// max_parallel_partitions            | if not 0, the number of partitions of a batch processed concurrently, see kafka::ConsumerScope::Start | 0
+/// target_batch_processing_time       | if not 0, the size of polled batches adapts between 1 and `max_batch_size` to be processed in about that time | 0ms
 /// auto_offset_reset                  | action to take when there is no initial offset in offset store | smallest
 /// env_pod_name                       | environment variable to substitute `{pod_name}` substring in `group_id` | none
 /// security_protocol                  | protocol used to communicate with brokers | --
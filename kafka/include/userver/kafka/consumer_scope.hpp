@@ -86,6 +86,16 @@ public:
     /// @warning Each callback duration must not exceed the
     /// `max_callback_duration` time. Otherwise, consumer may stop consuming the
     /// message for unpredictable amount of time.
+    ///
+    /// If `max_parallel_partitions` static option is not 0, each polled batch
+    /// is split by partitions and the callback is invoked with the messages of
+    /// a single partition, concurrently for up to `max_parallel_partitions`
+    /// partitions. Messages of a partition come in order. The callback must be
+    /// thread-safe in this mode. Offsets of each successfully processed
+    /// partition are committed asynchronously, so do not call
+    /// ConsumerScope::AsyncCommit, as it commits the offsets of partitions
+    /// which are still being processed. If a callback throws, the consumer
+    /// restarts and the messages of the failed partitions come again.
     void Start(Callback callback);
 
     /// @brief Revokes all topic partition consumer was subscribed on. Also closes
@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <memory>
+#include <vector>
 
 #include <userver/engine/task/task.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
@@ -43,6 +44,20 @@ struct ConsumerExecutionParams final {
     /// @brief Time consumer suspends execution after user-callback exception.
     /// @note After consumer restart, all uncommitted messages come again.
     std::chrono::milliseconds restart_after_failure_delay{10000};
+
+    /// @brief Maximum number of partitions whose messages are processed
+    /// concurrently.
+    /// If not 0, each polled batch is split by partitions, the callback is
+    /// invoked with the messages of a single partition, and offsets of each
+    /// successfully processed partition are committed asynchronously.
+    /// 0 means that the whole batch is passed to a single callback invocation.
+    std::size_t max_parallel_partitions{0};
+
+    /// @brief Time the processing of a batch should take.
+    /// If not 0, the size of polled batches adapts between 1 and
+    /// `max_batch_size`: it grows while the batches are processed faster and
+    /// the consumer lags, and shrinks when the callbacks are slower.
+    std::chrono::milliseconds target_batch_processing_time{0};
 };
 
 class Consumer final {
@@ -118,6 +133,11 @@ private:
     /// @brief Subscribes for configured topics and starts polling loop.
     void RunConsuming(ConsumerScope::Callback callback);
 
+    /// @brief Processes the partitions of `polled_messages` concurrently,
+    /// commits the offsets of the successfully processed ones.
+    /// @throws the exception of the first failed partition callback
+    void ProcessPartitions(const ConsumerScope::Callback& callback, std::vector<Message>&& polled_messages);
+
 private:
     std::atomic<bool> processing_{false};
     Stats stats_;
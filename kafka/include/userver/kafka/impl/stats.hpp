@@ -21,11 +21,16 @@ struct MessagesCounts final {
 struct TopicStats final {
     MessagesCounts messages_counts;
     utils::statistics::RecentPeriod<MinMaxAvg, MinMaxAvg, utils::datetime::SteadyClock> avg_ms_spent_time;
+    /// Consumer only: lag of the most lagging partition in the last polled
+    /// batch, -1 if unknown
+    utils::statistics::RelaxedCounter<int64_t> messages_lag = -1;
 };
 
 struct Stats final {
     rcu::RcuMap<std::string, TopicStats> topics_stats;
     utils::statistics::RelaxedCounter<uint64_t> connections_error = 0;
+    /// Consumer only: maximum size of the next polled batch, 0 if unknown
+    utils::statistics::RelaxedCounter<uint64_t> batch_size = 0;
 };
 
 void DumpMetric(utils::statistics::Writer& writer, const Stats& stats);
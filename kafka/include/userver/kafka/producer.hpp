@@ -1,11 +1,18 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/kafka/exceptions.hpp>
 #include <userver/utils/fast_pimpl.hpp>
+#include <userver/utils/span.hpp>
 #include <userver/utils/statistics/writer.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -22,6 +29,27 @@ struct Secret;
 
 }  // namespace impl
 
+/// @brief A message of Producer::SendBatch and Producer::SendBatchNoWait
+struct ProducerMessage final {
+    using Headers = std::vector<std::pair<std::string, std::string>>;
+
+    std::string topic_name;
+    std::string key;
+    std::string payload;
+
+    /// If not set, partition is chosen by internal Kafka partitioner
+    std::optional<std::uint32_t> partition{};
+
+    /// Message headers, names may repeat
+    Headers headers{};
+
+    /// If set, it is sent instead of `payload`. Lets several messages, e.g. to
+    /// different topics, share a single payload buffer without copying it.
+    std::shared_ptr<const std::string> shared_payload{};
+
+    std::string_view GetPayload() const { return shared_payload ? std::string_view{*shared_payload} : payload; }
+};
+
 /// @ingroup userver_clients
 ///
 /// @brief Apache Kafka Producer Client.
@@ -114,6 +142,45 @@ public:
         std::optional<std::uint32_t> partition = std::nullopt
     ) const;
 
+    /// @brief Sends the `messages` within a single task and waits until all of
+    /// them are delivered or failed.
+    ///
+    /// Much cheaper than a Producer::SendAsync per message: no task and no
+    /// waiting loop is created per message, the delivery reports of the whole
+    /// batch are handled by a single task.
+    ///
+    /// No payload data is copied, the `messages` must be alive until the
+    /// method returns.
+    ///
+    /// @throws SendException and its descendants of the first not delivered
+    /// message. Other messages of the batch may be delivered anyway.
+    /// @snippet kafka/tests/producer_kafkatest.cpp Producer send batch
+    void SendBatch(utils::span<const ProducerMessage> messages) const;
+
+    /// @brief Same as Producer::SendBatch, but returns the task which can be
+    /// used to wait the delivery of the whole batch manually.
+    [[nodiscard]] engine::TaskWithResult<void> SendBatchAsync(std::vector<ProducerMessage> messages) const;
+
+    /// @brief Enqueues the `messages` for delivery and returns without waiting
+    /// for the delivery reports.
+    ///
+    /// The payloads are copied into the `librdkafka` queue, except for the
+    /// `shared_payload` ones which are held until the delivery. Delivery results are
+    /// only reported into the producer metrics and logs, so the method suits
+    /// high throughput use cases where a lost message is not a failure of the
+    /// caller. Pending delivery reports are handled by the following sends and
+    /// periodically in background.
+    ///
+    /// @throws SendException and its descendants if a message could not be
+    /// enqueued, e.g. QueueFullException. The messages before it are enqueued
+    /// and the rest are not.
+    void SendBatchNoWait(utils::span<const ProducerMessage> messages) const;
+
+    /// @brief Same as Producer::SendBatchNoWait, but takes the ownership of the
+    /// payloads instead of copying them. Each payload is released after the
+    /// delivery report of its message.
+    void SendBatchNoWait(std::vector<ProducerMessage>&& messages) const;
+
     /// @brief Dumps per topic messages produce statistics. No expected to be
     /// called manually.
     /// @see kafka/impl/stats.hpp
@@ -127,6 +194,10 @@ private:
         std::optional<std::uint32_t> partition
     ) const;
 
+    void SendBatchImpl(utils::span<const ProducerMessage> messages) const;
+
+    void SendBatchNoWaitImpl(utils::span<const ProducerMessage> messages) const;
+
 private:
     const std::string name_;
     engine::TaskProcessor& producer_task_processor_;
@@ -37,6 +37,11 @@ ConsumerComponent::ConsumerComponent(
               params.restart_after_failure_delay =
                   config["restart_after_failure_delay"].As<std::chrono::milliseconds>(params.restart_after_failure_delay
                   );
+              params.max_parallel_partitions =
+                  config["max_parallel_partitions"].As<std::size_t>(params.max_parallel_partitions);
+              params.target_batch_processing_time = config["target_batch_processing_time"].As<std::chrono::milliseconds>(
+                  params.target_batch_processing_time
+              );
 
               return params;
           }()
@@ -95,6 +100,18 @@ properties:
         type: string
         description: backoff consumer waits until restart after user-callback exception.
         defaultDescription: 10s
+    max_parallel_partitions:
+        type: integer
+        description: |
+            if not 0, polled batches are split by partitions and up to that many partitions
+            are processed concurrently, the offsets of processed partitions are committed
+        defaultDescription: 0
+    target_batch_processing_time:
+        type: string
+        description: |
+            if not 0, the size of polled batches adapts between 1 and `max_batch_size`,
+            so that a batch is processed in about that time
+        defaultDescription: 0ms
     auto_offset_reset:
         type: string
         description: |
@@ -0,0 +1,48 @@
+#include <kafka/impl/batch_size_controller.hpp>
+
+#include <algorithm>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace kafka::impl {
+
+BatchSizeController::BatchSizeController(
+    std::size_t max_batch_size,
+    std::chrono::milliseconds target_processing_time
+)
+    : max_batch_size_(max_batch_size),
+      target_processing_time_(target_processing_time),
+      batch_size_(target_processing_time.count() > 0 ? 1 : max_batch_size) {
+    UINVARIANT(max_batch_size_ > 0, "max_batch_size must be positive");
+}
+
+std::size_t BatchSizeController::GetBatchSize() const { return batch_size_; }
+
+void BatchSizeController::Account(std::size_t polled_count, std::chrono::steady_clock::duration processing_time) {
+    if (target_processing_time_.count() <= 0 || polled_count == 0) {
+        return;
+    }
+
+    const auto message_processing_time = processing_time / polled_count;
+    std::size_t desired_batch_size = max_batch_size_;
+    if (message_processing_time.count() > 0) {
+        desired_batch_size = static_cast<std::size_t>(target_processing_time_ / message_processing_time);
+    }
+
+    if (desired_batch_size > batch_size_) {
+        if (polled_count < batch_size_) {
+            /// the consumer does not lag, larger batches would not come anyway
+            desired_batch_size = batch_size_;
+        } else {
+            desired_batch_size = std::min(desired_batch_size, 2 * batch_size_);
+        }
+    }
+
+    batch_size_ = std::clamp<std::size_t>(desired_batch_size, 1, max_batch_size_);
+}
+
+}  // namespace kafka::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace kafka::impl {
+
+/// @brief Chooses the maximum size of the next polled message batch, so that
+/// batches are processed in about `target_processing_time`.
+///
+/// The batch size grows (at most twice per batch) while the batches are
+/// processed faster than the target and come full, i.e. the consumer lags.
+/// The size shrinks at once if the processing is slower than the target.
+/// Zero `target_processing_time` disables the adaptation, and the batch size
+/// is always `max_batch_size`.
+class BatchSizeController final {
+public:
+    BatchSizeController(std::size_t max_batch_size, std::chrono::milliseconds target_processing_time);
+
+    /// @returns the maximum size of the next batch
+    std::size_t GetBatchSize() const;
+
+    /// @brief Accounts the processing time of a batch of `polled_count`
+    /// messages, polled with GetBatchSize() limit.
+    void Account(std::size_t polled_count, std::chrono::steady_clock::duration processing_time);
+
+private:
+    const std::size_t max_batch_size_;
+    const std::chrono::steady_clock::duration target_processing_time_;
+
+    std::size_t batch_size_;
+};
+
+}  // namespace kafka::impl
+
+USERVER_NAMESPACE_END
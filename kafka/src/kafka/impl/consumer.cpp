@@ -1,6 +1,12 @@
 #include <userver/kafka/impl/consumer.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <map>
+#include <string>
 #include <string_view>
+#include <utility>
 
 #include <fmt/format.h>
 
@@ -13,6 +19,7 @@
 #include <userver/utils/async.hpp>
 #include <userver/utils/scope_guard.hpp>
 
+#include <kafka/impl/batch_size_controller.hpp>
 #include <kafka/impl/consumer_impl.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -98,9 +105,13 @@ void Consumer::RunConsuming(ConsumerScope::Callback callback) {
 
     LOG_INFO() << fmt::format("Started messages polling");
 
+    BatchSizeController batch_size_controller{
+        execution_params.max_batch_size, execution_params.target_batch_processing_time};
+
     while (!engine::current_task::ShouldCancel()) {
+        stats_.batch_size = batch_size_controller.GetBatchSize();
         auto polled_messages = consumer_->PollBatch(
-            execution_params.max_batch_size, engine::Deadline::FromDuration(execution_params.poll_timeout)
+            batch_size_controller.GetBatchSize(), engine::Deadline::FromDuration(execution_params.poll_timeout)
         );
 
         if (engine::current_task::ShouldCancel()) {
@@ -116,6 +127,18 @@ void Consumer::RunConsuming(ConsumerScope::Callback callback) {
 
         TESTPOINT(fmt::format("tp_{}_polled", name_), {});
 
+        const auto polled_count = polled_messages.size();
+        const auto processing_start = std::chrono::steady_clock::now();
+
+        if (execution_params.max_parallel_partitions > 0) {
+            const utils::ScopeGuard callback_duration_notifier{
+                CreateDurationNotifier(execution_params.max_callback_duration)};
+            ProcessPartitions(callback, std::move(polled_messages));
+            batch_size_controller.Account(polled_count, std::chrono::steady_clock::now() - processing_start);
+            TESTPOINT(fmt::format("tp_{}", name_), {});
+            continue;
+        }
+
         auto batch_processing_task =
             utils::Async(main_task_processor_, "messages_processing", callback, utils::span{polled_messages});
         const utils::ScopeGuard callback_duration_notifier{
@@ -123,6 +146,7 @@ void Consumer::RunConsuming(ConsumerScope::Callback callback) {
 
         try {
             batch_processing_task.Get();
+            batch_size_controller.Account(polled_count, std::chrono::steady_clock::now() - processing_start);
 
             consumer_->AccountMessageBatchProcessingSucceeded(polled_messages);
             TESTPOINT(fmt::format("tp_{}", name_), {});
@@ -133,6 +157,62 @@ void Consumer::RunConsuming(ConsumerScope::Callback callback) {
     }
 }
 
+void Consumer::ProcessPartitions(const ConsumerScope::Callback& callback, std::vector<Message>&& polled_messages) {
+    /// Messages of a partition keep their order
+    std::vector<std::vector<Message>> partitions;
+    std::map<std::pair<std::string, int>, std::size_t> partition_indices;
+    for (auto& message : polled_messages) {
+        const auto [it, inserted] =
+            partition_indices.try_emplace({message.GetTopic(), message.GetPartition()}, partitions.size());
+        if (inserted) {
+            partitions.emplace_back();
+        }
+        partitions[it->second].push_back(std::move(message));
+    }
+    polled_messages.clear();
+
+    /// Each worker takes the next unprocessed partition, so that no more than
+    /// `max_parallel_partitions` callbacks run concurrently
+    std::vector<std::exception_ptr> errors(partitions.size());
+    std::atomic<std::size_t> next_partition{0};
+    const auto process_partitions = [&callback, &partitions, &errors, &next_partition] {
+        for (auto i = next_partition++; i < partitions.size(); i = next_partition++) {
+            try {
+                callback(utils::span{partitions[i]});
+            } catch (const std::exception&) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+
+    const auto workers_count = std::min(execution_params.max_parallel_partitions, partitions.size());
+    std::vector<engine::TaskWithResult<void>> workers;
+    workers.reserve(workers_count);
+    for (std::size_t i{0}; i < workers_count; ++i) {
+        workers.push_back(utils::Async(main_task_processor_, "partition_messages_processing", process_partitions));
+    }
+    for (auto& worker : workers) {
+        worker.Get();
+    }
+
+    std::exception_ptr first_error;
+    for (std::size_t i{0}; i < partitions.size(); ++i) {
+        if (errors[i]) {
+            consumer_->AccountMessageBatchProcessingFailed(partitions[i]);
+            if (!first_error) {
+                first_error = errors[i];
+            }
+        } else {
+            consumer_->AccountMessageBatchProcessingSucceeded(partitions[i]);
+            consumer_->AsyncCommitOffsets(partitions[i]);
+        }
+    }
+
+    if (first_error) {
+        std::rethrow_exception(first_error);
+    }
+}
+
 void Consumer::StartMessageProcessing(ConsumerScope::Callback callback) {
     UINVARIANT(!processing_.exchange(true), "Message processing already started");
 
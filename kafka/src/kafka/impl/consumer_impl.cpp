@@ -3,6 +3,9 @@
 #include <algorithm>
 #include <chrono>
 #include <iostream>
+#include <map>
+#include <string_view>
+#include <utility>
 
 #include <fmt/format.h>
 #include <fmt/ranges.h>
@@ -298,6 +301,28 @@ void ConsumerImpl::Commit() { rd_kafka_commit(consumer_.GetHandle(), nullptr, /*
 
 void ConsumerImpl::AsyncCommit() { rd_kafka_commit(consumer_.GetHandle(), nullptr, /*async=*/1); }
 
+void ConsumerImpl::AsyncCommitOffsets(utils::span<const Message> messages) {
+    if (messages.empty()) {
+        return;
+    }
+
+    TopicPartitionsListHolder offsets{rd_kafka_topic_partition_list_new(/*size=*/1)};
+    for (const auto& message : messages) {
+        auto* topic_partition = rd_kafka_topic_partition_list_find(
+            offsets.GetHandle(), message.GetTopic().c_str(), message.GetPartition()
+        );
+        if (!topic_partition) {
+            topic_partition = rd_kafka_topic_partition_list_add(
+                offsets.GetHandle(), message.GetTopic().c_str(), message.GetPartition()
+            );
+        }
+        /// committed offset is the offset of the next message to consume
+        topic_partition->offset = message.GetOffset() + 1;
+    }
+
+    rd_kafka_commit(consumer_.GetHandle(), offsets.GetHandle(), /*async=*/1);
+}
+
 OffsetRange ConsumerImpl::GetOffsetRange(
     const std::string& topic,
     std::uint32_t partition,
@@ -486,11 +511,42 @@ ConsumerImpl::MessageBatch ConsumerImpl::PollBatch(std::size_t max_batch_size, e
 
     if (!batch.empty()) {
         LOG_INFO() << fmt::format("Polled batch of {} messages", batch.size());
+        AccountConsumerLag(batch);
     }
 
     return batch;
 }
 
+void ConsumerImpl::AccountConsumerLag(const MessageBatch& batch) {
+    /// the last polled offset of each partition
+    std::map<std::pair<std::string, std::int32_t>, std::int64_t> last_offsets;
+    for (const auto& message : batch) {
+        last_offsets[{message.GetTopic(), message.GetPartition()}] = message.GetOffset();
+    }
+
+    std::map<std::string_view, std::int64_t> topics_lag;
+    for (const auto& [topic_partition, offset] : last_offsets) {
+        const auto& [topic, partition] = topic_partition;
+
+        std::int64_t low_offset{0};
+        std::int64_t high_offset{0};
+        /// returns the offsets cached from the last fetch, does not block
+        const auto err = rd_kafka_get_watermark_offsets(
+            consumer_.GetHandle(), topic.c_str(), partition, &low_offset, &high_offset
+        );
+        if (err != RD_KAFKA_RESP_ERR_NO_ERROR || high_offset < 0) {
+            continue;
+        }
+
+        auto& topic_lag = topics_lag[topic];
+        topic_lag = std::max(topic_lag, std::max<std::int64_t>(high_offset - offset - 1, 0));
+    }
+
+    for (const auto& [topic, lag] : topics_lag) {
+        GetTopicStats(std::string{topic})->messages_lag = lag;
+    }
+}
+
 std::shared_ptr<TopicStats> ConsumerImpl::GetTopicStats(const std::string& topic) { return stats_.topics_stats[topic]; }
 
 void ConsumerImpl::AccountPolledMessageStat(const Message& polled_message) {
@@ -38,6 +38,11 @@ public:
     /// @brief Schedules the commitment task.
     void AsyncCommit();
 
+    /// @brief Schedules the commitment of the offsets that follow the
+    /// `messages` in their partitions.
+    /// @note `messages` must be ordered by offset within each partition.
+    void AsyncCommitOffsets(utils::span<const Message> messages);
+
     /// @brief Retrieves the low and high offsets for the specified topic and partition.
     OffsetRange GetOffsetRange(
         const std::string& topic,
@@ -113,6 +118,10 @@ private:
 
     void AccountPolledMessageStat(const Message& polled_message);
 
+    /// @brief Updates the lag statistics of the topics from the last polled
+    /// offsets of the partitions in `batch`.
+    void AccountConsumerLag(const MessageBatch& batch);
+
 private:
     const std::string& name_;
     Stats& stats_;
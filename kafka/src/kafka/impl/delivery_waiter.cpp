@@ -1,5 +1,9 @@
 #include <kafka/impl/delivery_waiter.hpp>
 
+#include <utility>
+
+#include <userver/utils/assert.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace kafka::impl {
@@ -14,10 +18,19 @@ bool DeliveryResult::IsSuccess() const {
 
 rd_kafka_resp_err_t DeliveryResult::GetMessageError() const { return message_error_; }
 
-engine::Future<DeliveryResult> DeliveryWaiter::GetFuture() { return wait_handle_.get_future(); }
+DeliveryWaiter::DeliveryWaiter() : wait_handle_(std::in_place) {}
+
+DeliveryWaiter::DeliveryWaiter(std::shared_ptr<const std::string> payload) : payload_(std::move(payload)) {}
+
+engine::Future<DeliveryResult> DeliveryWaiter::GetFuture() {
+    UASSERT(wait_handle_.has_value());
+    return wait_handle_->get_future();
+}
 
 void DeliveryWaiter::SetDeliveryResult(DeliveryResult delivery_result) {
-    wait_handle_.set_value(std::move(delivery_result));
+    if (wait_handle_.has_value()) {
+        wait_handle_->set_value(std::move(delivery_result));
+    }
 }
 
 }  // namespace kafka::impl
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <memory>
+#include <optional>
+#include <string>
+
 #include <librdkafka/rdkafka.h>
 
 #include <userver/engine/future.hpp>
@@ -30,14 +34,20 @@ private:
 /// called
 class DeliveryWaiter final {
 public:
-    DeliveryWaiter() = default;
+    DeliveryWaiter();
+
+    /// @brief State of a message whose delivery is not awaited. Holds the
+    /// message payload until the delivery callback is invoked.
+    explicit DeliveryWaiter(std::shared_ptr<const std::string> payload);
 
     engine::Future<DeliveryResult> GetFuture();
 
+    /// @brief Notifies the waiter, if any.
     void SetDeliveryResult(DeliveryResult delivery_result);
 
 private:
-    engine::Promise<DeliveryResult> wait_handle_;
+    std::optional<engine::Promise<DeliveryResult>> wait_handle_;
+    std::shared_ptr<const std::string> payload_;
 };
 
 }  // namespace kafka::impl
@@ -2,6 +2,7 @@
 
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
@@ -101,8 +102,11 @@ void ProducerImpl::DeliveryReportCallback(const rd_kafka_message_t* message) con
         ) << fmt::format("Failed to delivery message to topic '{}': {}", topic_name, rd_kafka_err2str(message->err));
     }
 
-    complete_handle->SetDeliveryResult(std::move(delivery_result));
-    delete complete_handle;
+    /// Messages with copied payloads sent without waiting have no waiter
+    if (complete_handle) {
+        complete_handle->SetDeliveryResult(std::move(delivery_result));
+        delete complete_handle;
+    }
 }
 
 ProducerImpl::ProducerImpl(Configuration&& configuration)
@@ -136,22 +140,86 @@ DeliveryResult ProducerImpl::Send(
     return delivery_result_future.get();
 }
 
+std::vector<DeliveryResult> ProducerImpl::SendBatch(utils::span<const ProducerMessage> messages) const {
+    LOG_INFO() << fmt::format("Batch of {} messages is requested to send", messages.size());
+
+    std::vector<engine::Future<DeliveryResult>> delivery_result_futures;
+    delivery_result_futures.reserve(messages.size());
+    for (const auto& message : messages) {
+        delivery_result_futures.push_back(ScheduleMessageDelivery(
+            message.topic_name, message.key, message.GetPayload(), message.partition, message.headers
+        ));
+    }
+
+    /// While waiting for the first messages, the delivery reports of the rest
+    /// are handled too, so the following waits mostly find ready futures
+    std::vector<DeliveryResult> delivery_results;
+    delivery_results.reserve(messages.size());
+    for (auto& delivery_result_future : delivery_result_futures) {
+        WaitUntilDeliveryReported(delivery_result_future);
+        delivery_results.push_back(delivery_result_future.get());
+    }
+
+    return delivery_results;
+}
+
+rd_kafka_resp_err_t ProducerImpl::SendBatchNoWait(utils::span<const ProducerMessage> messages) const {
+    LOG_INFO() << fmt::format("Batch of {} messages is requested to send without waiting", messages.size());
+
+    rd_kafka_resp_err_t enqueue_error{RD_KAFKA_RESP_ERR_NO_ERROR};
+    for (const auto& message : messages) {
+        if (message.shared_payload) {
+            /// The waiter holds the payload until the delivery report, no copy
+            auto waiter = std::make_unique<DeliveryWaiter>(message.shared_payload);
+            enqueue_error = EnqueueMessage(
+                message.topic_name,
+                message.key,
+                *message.shared_payload,
+                message.partition,
+                message.headers,
+                /*msgflags=*/0,
+                waiter.get()
+            );
+            if (enqueue_error == RD_KAFKA_RESP_ERR_NO_ERROR) {
+                [[maybe_unused]] auto _ = waiter.release();
+            }
+        } else {
+            /// `RD_KAFKA_MSG_F_COPY` makes `librdkafka` copy the payload, as nobody
+            /// holds the message data until its delivery
+            enqueue_error = EnqueueMessage(
+                message.topic_name,
+                message.key,
+                message.payload,
+                message.partition,
+                message.headers,
+                RD_KAFKA_MSG_F_COPY,
+                /*opaque=*/nullptr
+            );
+        }
+        if (enqueue_error != RD_KAFKA_RESP_ERR_NO_ERROR) {
+            LOG_WARNING(
+            ) << fmt::format("Failed to enqueue message to Kafka local queue: {}", rd_kafka_err2str(enqueue_error));
+            break;
+        }
+    }
+
+    /// Nobody waits for these messages delivery, so handle the reports that are
+    /// ready to keep the producer queue short
+    HandleEvents("after no wait send");
+
+    return enqueue_error;
+}
+
 engine::Future<DeliveryResult> ProducerImpl::ScheduleMessageDelivery(
     const std::string& topic_name,
     std::string_view key,
     std::string_view message,
-    std::optional<std::uint32_t> partition
+    std::optional<std::uint32_t> partition,
+    utils::span<const std::pair<std::string, std::string>> headers
 ) const {
     auto waiter = std::make_unique<DeliveryWaiter>();
     auto wait_handle = waiter->GetFuture();
 
-    /// `rd_kafka_producev` does not send given message. It only enqueues
-    /// the message to the local queue to be send in future by `librdkafka`
-    /// internal thread
-    ///
-    /// It uses pthread mutexes locks in its implementation, through must not be
-    /// executed in main-task-processor
-    ///
     /// 0 msgflags implies no message copying and freeing by
     /// `librdkafka` implementation. It is safe to pass actually a pointer
     /// to message data because it lives till the delivery callback is invoked
@@ -162,12 +230,51 @@ engine::Future<DeliveryResult> ProducerImpl::ScheduleMessageDelivery(
     /// It is safe to release the `waiter` because (i)
     /// `rd_kafka_producev` does not throws, therefore it owns the `waiter`,
     /// (ii) delivery report callback fries its memory
+    const rd_kafka_resp_err_t enqueue_error =
+        EnqueueMessage(topic_name, key, message, partition, headers, /*msgflags=*/0, waiter.get());
+
+    if (enqueue_error == RD_KAFKA_RESP_ERR_NO_ERROR) {
+        [[maybe_unused]] auto _ = waiter.release();
+    } else {
+        LOG_WARNING(
+        ) << fmt::format("Failed to enqueue message to Kafka local queue: {}", rd_kafka_err2str(enqueue_error));
+        waiter->SetDeliveryResult(DeliveryResult{enqueue_error});
+    }
+
+    return wait_handle;
+}
+
+rd_kafka_resp_err_t ProducerImpl::EnqueueMessage(
+    const std::string& topic_name,
+    std::string_view key,
+    std::string_view message,
+    std::optional<std::uint32_t> partition,
+    utils::span<const std::pair<std::string, std::string>> headers,
+    int msgflags,
+    void* opaque
+) const {
+    /// `rd_kafka_producev` does not send given message. It only enqueues
+    /// the message to the local queue to be send in future by `librdkafka`
+    /// internal thread
+    ///
+    /// It uses pthread mutexes locks in its implementation, through must not be
+    /// executed in main-task-processor
     ///
     /// const qualifier remove for `message` is required because of
     /// the `librdkafka` API requirements. If `msgflags` set to
     /// `RD_KAFKA_MSG_F_FREE`, produce implementation fries the message
     /// data, though not const pointer is required
 
+    /// `rd_kafka_header_add` copies the names and values. On success the
+    /// headers are owned by the message
+    rd_kafka_headers_t* message_headers{nullptr};
+    if (!headers.empty()) {
+        message_headers = rd_kafka_headers_new(headers.size());
+        for (const auto& [name, value] : headers) {
+            rd_kafka_header_add(message_headers, name.data(), name.size(), value.data(), value.size());
+        }
+    }
+
 #ifdef __clang__
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wgnu-statement-expression"
@@ -179,9 +286,10 @@ engine::Future<DeliveryResult> ProducerImpl::ScheduleMessageDelivery(
         RD_KAFKA_V_TOPIC(topic_name.c_str()),
         RD_KAFKA_V_KEY(key.data(), key.size()),
         RD_KAFKA_V_VALUE(const_cast<char*>(message.data()), message.size()),
-        RD_KAFKA_V_MSGFLAGS(0),
+        RD_KAFKA_V_MSGFLAGS(msgflags),
         RD_KAFKA_V_PARTITION(partition.value_or(RD_KAFKA_PARTITION_UA)),
-        RD_KAFKA_V_OPAQUE(waiter.get()),
+        RD_KAFKA_V_HEADERS(message_headers),
+        RD_KAFKA_V_OPAQUE(opaque),
         RD_KAFKA_V_END
     );
     // NOLINTEND(clang-analyzer-cplusplus.NewDeleteLeaks,cppcoreguidelines-pro-type-const-cast)
@@ -190,15 +298,11 @@ engine::Future<DeliveryResult> ProducerImpl::ScheduleMessageDelivery(
 #pragma clang diagnostic pop
 #endif
 
-    if (enqueue_error == RD_KAFKA_RESP_ERR_NO_ERROR) {
-        [[maybe_unused]] auto _ = waiter.release();
-    } else {
-        LOG_WARNING(
-        ) << fmt::format("Failed to enqueue message to Kafka local queue: {}", rd_kafka_err2str(enqueue_error));
-        waiter->SetDeliveryResult(DeliveryResult{enqueue_error});
+    if (enqueue_error != RD_KAFKA_RESP_ERR_NO_ERROR && message_headers) {
+        rd_kafka_headers_destroy(message_headers);
     }
 
-    return wait_handle;
+    return enqueue_error;
 }
 
 EventHolder ProducerImpl::PollEvent() const {
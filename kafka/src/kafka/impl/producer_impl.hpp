@@ -3,10 +3,14 @@
 #include <chrono>
 #include <cstdint>
 #include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 #include <librdkafka/rdkafka.h>
 
 #include <userver/kafka/impl/stats.hpp>
+#include <userver/kafka/producer.hpp>
 #include <userver/utils/periodic_task.hpp>
 
 #include <kafka/impl/concurrent_event_waiter.hpp>
@@ -34,6 +38,17 @@ public:
         std::optional<std::uint32_t> partition
     ) const;
 
+    /// @brief Sends the messages and waits for the delivery of all of them.
+    /// @returns delivery results in the order of `messages`.
+    [[nodiscard]] std::vector<DeliveryResult> SendBatch(utils::span<const ProducerMessage> messages) const;
+
+    /// @brief Enqueues the messages without waiting for the delivery. Payloads
+    /// are copied, `shared_payload` ones are held until the delivery report.
+    /// Delivery reports of such messages only update the statistics.
+    /// @returns the error of the first message that is not enqueued, the rest
+    /// of the messages are not enqueued either.
+    [[nodiscard]] rd_kafka_resp_err_t SendBatchNoWait(utils::span<const ProducerMessage> messages) const;
+
     /// @brief Waits until scheduled messages are delivered for
     /// at most 2 x `delivery_timeout`.
     ///
@@ -51,7 +66,21 @@ private:
         const std::string& topic_name,
         std::string_view key,
         std::string_view message,
-        std::optional<std::uint32_t> partition
+        std::optional<std::uint32_t> partition,
+        utils::span<const std::pair<std::string, std::string>> headers = {}
+    ) const;
+
+    /// @brief Enqueues the message to the `librdkafka` local queue.
+    /// @param opaque is passed to the delivery report callback, nullptr if the
+    /// delivery is not awaited
+    [[nodiscard]] rd_kafka_resp_err_t EnqueueMessage(
+        const std::string& topic_name,
+        std::string_view key,
+        std::string_view message,
+        std::optional<std::uint32_t> partition,
+        utils::span<const std::pair<std::string, std::string>> headers,
+        int msgflags,
+        void* opaque
     ) const;
 
     /// @brief Poll a delivery or error event from producer's queue.
@@ -80,7 +109,7 @@ private:
     /// @param message represents the delivered (or not) message. Its `_private`
     /// field contains and `opaque` argument, which was passed to
     /// `rd_kafka_producev`, i.e. the Promise which must be set to notify
-    /// waiter about the delivery.
+    /// waiter about the delivery, or nullptr if nobody waits for the delivery.
     void DeliveryReportCallback(const rd_kafka_message_s* message) const;
 
 private:
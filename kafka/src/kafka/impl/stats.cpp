@@ -24,8 +24,14 @@ void DumpMetric(utils::statistics::Writer& writer, const Stats& stats) {
         writer[topic]["messages_total"].ValueWithLabels(topic_stats->messages_counts.messages_total.Load(), label);
         writer[topic]["messages_success"].ValueWithLabels(topic_stats->messages_counts.messages_success.Load(), label);
         writer[topic]["messages_error"].ValueWithLabels(topic_stats->messages_counts.messages_error.Load(), label);
+        if (const auto messages_lag = topic_stats->messages_lag.Load(); messages_lag >= 0) {
+            writer[topic]["messages_lag"].ValueWithLabels(messages_lag, label);
+        }
     }
     writer["connections_error"].ValueWithLabels(stats.connections_error.Load(), {kSolomonLabel, "component_name"});
+    if (const auto batch_size = stats.batch_size.Load(); batch_size > 0) {
+        writer["batch_size"].ValueWithLabels(batch_size, {kSolomonLabel, "component_name"});
+    }
 }
 
 }  // namespace kafka::impl
@@ -108,6 +108,33 @@ engine::TaskWithResult<void> Producer::SendAsync(
     );
 }
 
+void Producer::SendBatch(utils::span<const ProducerMessage> messages) const {
+    utils::Async(producer_task_processor_, "producer_send_batch", [this, messages] { SendBatchImpl(messages); }).Get();
+}
+
+engine::TaskWithResult<void> Producer::SendBatchAsync(std::vector<ProducerMessage> messages) const {
+    return utils::Async(
+        producer_task_processor_,
+        "producer_send_batch_async",
+        [this, messages = std::move(messages)] { SendBatchImpl(messages); }
+    );
+}
+
+void Producer::SendBatchNoWait(utils::span<const ProducerMessage> messages) const {
+    utils::Async(producer_task_processor_, "producer_send_batch_no_wait", [this, messages] {
+        SendBatchNoWaitImpl(messages);
+    }).Get();
+}
+
+void Producer::SendBatchNoWait(std::vector<ProducerMessage>&& messages) const {
+    for (auto& message : messages) {
+        if (!message.shared_payload) {
+            message.shared_payload = std::make_shared<const std::string>(std::move(message.payload));
+        }
+    }
+    SendBatchNoWait(utils::span<const ProducerMessage>{messages});
+}
+
 void Producer::DumpMetric(utils::statistics::Writer& writer) const { impl::DumpMetric(writer, producer_->GetStats()); }
 
 void Producer::SendImpl(
@@ -126,6 +153,34 @@ void Producer::SendImpl(
     SendToTestPoint(name_, topic_name, key, message, partition);
 }
 
+void Producer::SendBatchImpl(utils::span<const ProducerMessage> messages) const {
+    tracing::Span::CurrentSpan().AddTag("kafka_producer", name_);
+
+    const std::vector<impl::DeliveryResult> delivery_results = producer_->SendBatch(messages);
+    for (const auto& delivery_result : delivery_results) {
+        if (!delivery_result.IsSuccess()) {
+            ThrowSendError(delivery_result);
+        }
+    }
+
+    for (const auto& message : messages) {
+        SendToTestPoint(name_, message.topic_name, message.key, message.GetPayload(), message.partition);
+    }
+}
+
+void Producer::SendBatchNoWaitImpl(utils::span<const ProducerMessage> messages) const {
+    tracing::Span::CurrentSpan().AddTag("kafka_producer", name_);
+
+    const rd_kafka_resp_err_t enqueue_error = producer_->SendBatchNoWait(messages);
+    if (enqueue_error != RD_KAFKA_RESP_ERR_NO_ERROR) {
+        ThrowSendError(impl::DeliveryResult{enqueue_error});
+    }
+
+    for (const auto& message : messages) {
+        SendToTestPoint(name_, message.topic_name, message.key, message.GetPayload(), message.partition);
+    }
+}
+
 }  // namespace kafka
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,58 @@
+#include <kafka/impl/batch_size_controller.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using namespace std::chrono_literals;
+
+using kafka::impl::BatchSizeController;
+
+}  // namespace
+
+TEST(BatchSizeController, Disabled) {
+    BatchSizeController controller{100, 0ms};
+    EXPECT_EQ(controller.GetBatchSize(), 100);
+
+    controller.Account(100, 10s);
+    EXPECT_EQ(controller.GetBatchSize(), 100);
+}
+
+TEST(BatchSizeController, GrowsWhileLagging) {
+    BatchSizeController controller{100, 100ms};
+    EXPECT_EQ(controller.GetBatchSize(), 1);
+
+    controller.Account(1, 1ms);
+    EXPECT_EQ(controller.GetBatchSize(), 2);
+    controller.Account(2, 2ms);
+    EXPECT_EQ(controller.GetBatchSize(), 4);
+
+    for (int i = 0; i < 10; ++i) controller.Account(controller.GetBatchSize(), 1ms);
+    EXPECT_EQ(controller.GetBatchSize(), 100);
+}
+
+TEST(BatchSizeController, DoesNotGrowWithoutLag) {
+    BatchSizeController controller{100, 100ms};
+    controller.Account(1, 1ms);
+    controller.Account(2, 2ms);
+    EXPECT_EQ(controller.GetBatchSize(), 4);
+
+    controller.Account(3, 3ms);
+    EXPECT_EQ(controller.GetBatchSize(), 4);
+}
+
+TEST(BatchSizeController, ShrinksOnSlowProcessing) {
+    BatchSizeController controller{100, 100ms};
+    for (int i = 0; i < 10; ++i) controller.Account(controller.GetBatchSize(), 1ms);
+    EXPECT_EQ(controller.GetBatchSize(), 100);
+
+    controller.Account(100, 1s);
+    EXPECT_EQ(controller.GetBatchSize(), 10);
+
+    controller.Account(10, 10s);
+    EXPECT_EQ(controller.GetBatchSize(), 1);
+}
+
+USERVER_NAMESPACE_END
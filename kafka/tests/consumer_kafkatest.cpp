@@ -1,7 +1,9 @@
 #include <userver/kafka/utest/kafka_fixture.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <string>
 #include <unordered_set>
 #include <vector>
 
@@ -20,9 +22,11 @@ class ConsumerTest : public kafka::utest::KafkaCluster {};
 const std::string kLargeTopic1{"lt-1"};
 const std::string kLargeTopic2{"lt-2"};
 const std::string kBlockingTopic{"bt"};  // Must be used only in OneConsumerPartitionOffsets test
+const std::string kParallelTopic{"pt"};  // Must be used only in ParallelPartitions test
 
 constexpr std::size_t kNumPartitionsLargeTopic{4};
 constexpr std::size_t kNumPartitionsBlockingTopic{4};
+constexpr std::size_t kNumPartitionsParallelTopic{4};
 
 }  // namespace
 
@@ -216,6 +220,46 @@ UTEST_F(ConsumerTest, LargeBatch) {
     EXPECT_LT(callback_calls.load(), kMessagesCount) << callback_calls.load();
 }
 
+UTEST_F_MT(ConsumerTest, ParallelPartitions, 4) {
+    constexpr std::size_t kMessagesCount{kNumPartitionsParallelTopic * 5};
+
+    const auto messages = utils::GenerateFixedArray(kMessagesCount, [](std::size_t i) {
+        return kafka::utest::Message{
+            kParallelTopic, fmt::format("key-{}", i), fmt::format("{}", i), i % kNumPartitionsParallelTopic};
+    });
+    SendMessages(messages);
+
+    kafka::impl::ConsumerExecutionParams params{};
+    params.max_batch_size = kMessagesCount;
+    params.poll_timeout = utest::kMaxTestWaitTime / 2;
+    params.max_parallel_partitions = kNumPartitionsParallelTopic;
+    auto consumer = MakeConsumer("kafka-consumer", {kParallelTopic}, kafka::impl::ConsumerConfiguration{}, params);
+
+    std::atomic<std::size_t> consumed{0};
+    std::atomic<bool> ordered{true};
+    std::atomic<bool> single_partition{true};
+    engine::SingleUseEvent consumed_event;
+
+    auto consumer_scope = consumer.MakeConsumerScope();
+    consumer_scope.Start([&](kafka::MessageBatchView batch) {
+        for (std::size_t i{1}; i < batch.size(); ++i) {
+            single_partition = single_partition && batch[i].GetPartition() == batch[0].GetPartition();
+            ordered = ordered && std::stoul(std::string{batch[i - 1].GetPayload()}) <
+                                     std::stoul(std::string{batch[i].GetPayload()});
+        }
+        if (consumed.fetch_add(batch.size()) + batch.size() == kMessagesCount) {
+            consumed_event.Send();
+        }
+    });
+
+    UEXPECT_NO_THROW(consumed_event.Wait());
+    consumer_scope.Stop();
+
+    EXPECT_TRUE(single_partition.load());
+    EXPECT_TRUE(ordered.load());
+    EXPECT_EQ(consumed.load(), kMessagesCount);
+}
+
 UTEST_F_MT(ConsumerTest, OneConsumerPartitionOffsets, 2) {
     constexpr std::size_t kMessagesCount{kNumPartitionsBlockingTopic + 1};
     constexpr std::uint32_t kFirstPartition{0};
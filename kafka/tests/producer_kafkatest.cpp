@@ -193,6 +193,84 @@ UTEST_F(ProducerTest, OneProducerManySendAsync) {
     /// [Producer batch send async]
 }
 
+UTEST_F(ProducerTest, OneProducerSendBatch) {
+    constexpr std::size_t kSendCount{1000};
+
+    auto producer = MakeProducer("kafka-producer");
+    const std::string topic = GenerateTopic();
+
+    /// [Producer send batch]
+    std::vector<kafka::ProducerMessage> messages;
+    messages.reserve(kSendCount);
+    for (std::size_t send{0}; send < kSendCount; ++send) {
+        messages.push_back(kafka::ProducerMessage{
+            topic, fmt::format("test-key-{}", send), fmt::format("test-msg-{}", send), {}, {{"header", "value"}}});
+    }
+
+    UEXPECT_NO_THROW(producer.SendBatch(messages));
+    /// [Producer send batch]
+
+    auto task = producer.SendBatchAsync(std::move(messages));
+    UEXPECT_NO_THROW(task.Get());
+}
+
+UTEST_F(ProducerTest, SendBatchUnknownPartition) {
+    auto producer = MakeProducer("kafka-producer");
+    const std::string topic = GenerateTopic();
+
+    const std::vector<kafka::ProducerMessage> messages{
+        {topic, "test-key-1", "test-msg-1"},
+        {topic, "test-key-2", "test-msg-2", /*partition=*/100500},
+    };
+    UEXPECT_THROW(producer.SendBatch(messages), kafka::UnknownPartitionException);
+}
+
+UTEST_F(ProducerTest, OneProducerSendBatchNoWait) {
+    constexpr std::size_t kSendCount{1000};
+
+    std::deque<kafka::Producer> producers = MakeProducers(1, [](std::size_t) { return "kafka-producer"; });
+    const std::string topic = GenerateTopic();
+
+    std::vector<kafka::ProducerMessage> messages;
+    messages.reserve(kSendCount);
+    for (std::size_t send{0}; send < kSendCount; ++send) {
+        messages.push_back(
+            kafka::ProducerMessage{topic, fmt::format("test-key-{}", send), fmt::format("test-msg-{}", send)}
+        );
+    }
+    UEXPECT_NO_THROW(producers.front().SendBatchNoWait(messages));
+    // payloads are copied, the messages may be destroyed right away
+    messages.clear();
+
+    // the destructor waits until the messages are delivered
+    producers.clear();
+}
+
+UTEST_F(ProducerTest, SendSharedPayloadToManyTopics) {
+    constexpr std::size_t kTopicCount{5};
+
+    std::deque<kafka::Producer> producers = MakeProducers(1, [](std::size_t) { return "kafka-producer"; });
+    const std::vector<std::string> topics = GenerateTopics(kTopicCount);
+
+    const auto payload = std::make_shared<const std::string>(4096, 'p');
+    std::vector<kafka::ProducerMessage> messages;
+    for (const auto& topic : topics) {
+        kafka::ProducerMessage message{topic, "test-key"};
+        message.shared_payload = payload;
+        messages.push_back(std::move(message));
+    }
+    UEXPECT_NO_THROW(producers.front().SendBatch(messages));
+    UEXPECT_NO_THROW(producers.front().SendBatchNoWait(std::move(messages)));
+    messages.clear();
+
+    std::vector<kafka::ProducerMessage> owned_messages{{topics.front(), "test-key", std::string(4096, 'o')}};
+    UEXPECT_NO_THROW(producers.front().SendBatchNoWait(std::move(owned_messages)));
+
+    // the destructor waits until the messages are delivered and releases the payloads
+    producers.clear();
+    EXPECT_EQ(payload.use_count(), 1);
+}
+
 UTEST_F(ProducerTest, ManyProducersManySendSync) {
     constexpr std::size_t kProducerCount{4};
     constexpr std::size_t kSendCount{100};
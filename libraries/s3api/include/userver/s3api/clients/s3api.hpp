@@ -4,12 +4,14 @@
 /// @brief Client for any S3 api service
 
 #include <chrono>
+#include <functional>
 #include <optional>
 #include <string>
 #include <unordered_set>
 #include <vector>
 
 #include <userver/http/header_map.hpp>
+#include <userver/utils/span.hpp>
 
 #include <userver/s3api/authenticators/access_key.hpp>
 #include <userver/s3api/authenticators/interface.hpp>
@@ -39,6 +41,14 @@ class ListBucketError : public std::runtime_error {
     using runtime_error::runtime_error;
 };
 
+class MultipartUploadError : public std::runtime_error {
+    using runtime_error::runtime_error;
+};
+
+class ParallelDownloadError : public std::runtime_error {
+    using runtime_error::runtime_error;
+};
+
 /// Connection settings - retries, timeouts, and so on
 struct ConnectionCfg {
     explicit ConnectionCfg(
@@ -53,6 +63,28 @@ struct ConnectionCfg {
     std::optional<std::string> proxy{};
 };
 
+/// Settings of the multipart uploads and parallel ranged downloads
+struct MultipartSettings {
+    /// Size of a part. S3 requires at least 5MiB for every part of a multipart
+    /// upload but the last one, and at most 10000 parts
+    std::size_t part_size{16 * 1024 * 1024};
+
+    /// Parts transferred concurrently, a transfer keeps up to
+    /// `part_size * (max_concurrent_parts + 1)` bytes in memory
+    std::size_t max_concurrent_parts{4};
+
+    /// Attempts to transfer a part, on top of the retries of the http client
+    std::size_t part_attempts{3};
+};
+
+/// Source of a multipart upload: returns up to `max_size` next bytes of the
+/// object, an empty string at the end of the object
+using UploadSource = std::function<std::string(std::size_t max_size)>;
+
+/// Sink of a parallel download: receives a part of the object that starts at
+/// the `offset`. Might be called concurrently for different parts
+using DownloadSink = std::function<void(std::size_t offset, std::string_view data)>;
+
 /// https://docs.aws.amazon.com/AmazonS3/latest/API/API_ListObjects.html
 /// may also include other fields like Owner, ETag, etc.
 struct ObjectMeta {
@@ -114,6 +146,20 @@ public:
         const std::optional<std::vector<Tag>>& tags = std::nullopt
     ) const = 0;
 
+    /// Uploads an object of any size by parts, with up to
+    /// `settings.max_concurrent_parts` parts being uploaded concurrently.
+    /// The data is read from the `source` part by part, so the object does not
+    /// have to fit in memory. The upload is aborted if any part fails after
+    /// `settings.part_attempts` attempts.
+    /// @throws MultipartUploadError
+    virtual void PutObjectMultipart(
+        std::string_view path,
+        const UploadSource& source,
+        const MultipartSettings& settings = MultipartSettings(),
+        const std::optional<Meta>& meta = std::nullopt,
+        std::string_view content_type = "application/octet-stream"
+    ) const = 0;
+
     virtual void DeleteObject(std::string_view path) const = 0;
 
     virtual std::optional<std::string> GetObject(
@@ -146,6 +192,28 @@ public:
         const HeaderDataRequest& headers_request = HeaderDataRequest()
     ) const = 0;
 
+    /// Downloads an object by ranges of `settings.part_size` bytes, with up to
+    /// `settings.max_concurrent_parts` ranges being downloaded concurrently,
+    /// and passes them to the `sink`, e.g. to write them to a file at their
+    /// offsets.
+    /// @returns the size of the object
+    /// @throws ParallelDownloadError
+    virtual std::size_t DownloadObject(
+        std::string_view path,
+        const DownloadSink& sink,
+        const MultipartSettings& settings = MultipartSettings()
+    ) const = 0;
+
+    /// Downloads an object into the `buffer` the same way as DownloadObject
+    /// does.
+    /// @returns the size of the object
+    /// @throws ParallelDownloadError if the object does not fit in the buffer
+    virtual std::size_t DownloadObjectToBuffer(
+        std::string_view path,
+        utils::span<char> buffer,
+        const MultipartSettings& settings = MultipartSettings()
+    ) const = 0;
+
     virtual std::string CopyObject(
         std::string_view key_from,
         std::string_view bucket_to,
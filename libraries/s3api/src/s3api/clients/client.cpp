@@ -1,5 +1,8 @@
 #include <s3api/clients/client.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <deque>
 #include <sstream>
 
 #include <fmt/format.h>
@@ -9,7 +12,11 @@
 #include <userver/http/common_headers.hpp>
 #include <userver/http/url.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/utils/algo.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/exception.hpp>
 
 #include <userver/s3api/authenticators/access_key.hpp>
@@ -147,6 +154,65 @@ std::vector<std::string> ParseS3DirectoriesListResponse(std::string_view s3_resp
     return result;
 }
 
+std::string ParseUploadId(std::string_view s3_response) {
+    pugi::xml_document xml;
+    pugi::xml_parse_result parse_result = xml.load_buffer(s3_response.data(), s3_response.size());
+    if (parse_result.status != pugi::status_ok) {
+        throw MultipartUploadError(fmt::format(
+            "Failed to parse S3 create multipart upload response as xml, error: {}, response: {}",
+            parse_result.description(),
+            s3_response
+        ));
+    }
+    std::string upload_id = xml.child("InitiateMultipartUploadResult").child("UploadId").child_value();
+    if (upload_id.empty()) {
+        throw MultipartUploadError(
+            fmt::format("No UploadId in S3 create multipart upload response, response: {}", s3_response)
+        );
+    }
+    return upload_id;
+}
+
+void ValidateSettings(const MultipartSettings& settings) {
+    UINVARIANT(settings.part_size > 0, "part_size of MultipartSettings must be positive");
+    UINVARIANT(settings.max_concurrent_parts > 0, "max_concurrent_parts of MultipartSettings must be positive");
+    UINVARIANT(settings.part_attempts > 0, "part_attempts of MultipartSettings must be positive");
+}
+
+// Reads a whole part: every part but the last one must be at least 5MiB,
+// while the source might return less than asked
+std::string ReadPart(const UploadSource& source, std::size_t part_size, bool& is_end) {
+    std::string part;
+    while (part.size() < part_size) {
+        auto chunk = source(part_size - part.size());
+        if (chunk.empty()) {
+            is_end = true;
+            break;
+        }
+        if (part.empty()) {
+            part = std::move(chunk);
+        } else {
+            part.append(chunk);
+        }
+    }
+    return part;
+}
+
+template <typename Func>
+auto WithAttempts(std::size_t attempts, std::string_view what, Func&& func) {
+    for (std::size_t attempt = 1;; ++attempt) {
+        try {
+            return func();
+        } catch (const std::exception& e) {
+            if (attempt >= attempts || engine::current_task::ShouldCancel()) {
+                throw;
+            }
+            LOG_WARNING() << "S3Api : " << what << " failed, attempt " << attempt << " of " << attempts << ": "
+                          << e.what();
+        }
+    }
+}
+
 }  // namespace
 
 void ClientImpl::UpdateConfig(ConnectionCfg&& config) { conn_->UpdateConfig(std::move(config)); }
@@ -196,6 +262,91 @@ std::string ClientImpl::PutObject(
     return RequestApi(req, "put_object");
 }
 
+void ClientImpl::PutObjectMultipart(
+    std::string_view path,
+    const UploadSource& source,
+    const MultipartSettings& settings,
+    const std::optional<Meta>& meta,
+    std::string_view content_type
+) const {
+    ValidateSettings(settings);
+
+    auto create_req = api_methods::CreateMultipartUpload(bucket_, path, content_type);
+    if (meta.has_value()) {
+        SaveMeta(create_req.headers, meta.value());
+    }
+    const auto upload_id = ParseUploadId(RequestApi(create_req, "create_multipart_upload"));
+
+    try {
+        std::vector<std::string> etags;
+        // Parts are read while the previous ones are being uploaded, at most
+        // max_concurrent_parts of them are in memory
+        std::deque<engine::TaskWithResult<std::string>> uploads;
+        bool is_end = false;
+        for (std::size_t part_number = 1; !is_end; ++part_number) {
+            auto data = ReadPart(source, settings.part_size, is_end);
+            // An empty object is uploaded as a single empty part
+            if (data.empty() && part_number > 1) {
+                break;
+            }
+
+            if (uploads.size() >= settings.max_concurrent_parts) {
+                etags.push_back(uploads.front().Get());
+                uploads.pop_front();
+            }
+            uploads.push_back(USERVER_NAMESPACE::utils::Async(
+                "s3api_upload_part",
+                [this, path, &upload_id, part_number, &settings, data = std::move(data)]() mutable {
+                    return UploadPart(path, upload_id, part_number, std::move(data), settings);
+                }
+            ));
+        }
+        for (auto& upload : uploads) {
+            etags.push_back(upload.Get());
+        }
+
+        auto complete_req = api_methods::CompleteMultipartUpload(bucket_, path, upload_id, etags);
+        const auto response = RequestApi(complete_req, "complete_multipart_upload");
+        // S3 may report a failure of the completion with 200 OK
+        if (response.find("<Error>") != std::string::npos) {
+            throw MultipartUploadError(fmt::format("Failed to complete multipart upload, response: {}", response));
+        }
+    } catch (const std::exception& e) {
+        LOG_ERROR() << "S3Api : Multipart upload of " << path << " failed, aborting it: " << e.what();
+        try {
+            auto abort_req = api_methods::AbortMultipartUpload(bucket_, path, upload_id);
+            RequestApi(abort_req, "abort_multipart_upload");
+        } catch (const std::exception& abort_error) {
+            LOG_WARNING() << "S3Api : Failed to abort multipart upload of " << path << ": " << abort_error.what();
+        }
+        throw MultipartUploadError(fmt::format("Multipart upload of {} failed: {}", path, e.what()));
+    }
+}
+
+std::string ClientImpl::UploadPart(
+    std::string_view path,
+    std::string_view upload_id,
+    std::size_t part_number,
+    std::string data,
+    const MultipartSettings& settings
+) const {
+    return WithAttempts(settings.part_attempts, "Uploading a part", [&] {
+        auto req = api_methods::UploadPart(bucket_, path, upload_id, part_number, data);
+        HeaderDataRequest headers_request;
+        headers_request.headers.emplace();
+        headers_request.headers->emplace(USERVER_NAMESPACE::http::headers::kETag);
+        headers_request.need_meta = false;
+        HeadersDataResponse headers_data;
+        RequestApi(req, "upload_part", &headers_data, headers_request);
+
+        const auto it = headers_data.headers->find(USERVER_NAMESPACE::http::headers::kETag);
+        if (it == headers_data.headers->end()) {
+            throw MultipartUploadError(fmt::format("No ETag in the response for part {}", part_number));
+        }
+        return it->second;
+    });
+}
+
 void ClientImpl::DeleteObject(std::string_view path) const {
     auto req = api_methods::DeleteObject(bucket_, path);
     RequestApi(req, "delete_object");
@@ -266,6 +417,104 @@ std::string ClientImpl::TryGetPartialObject(
     return RequestApi(req, "get_object", headers_data, headers_request);
 }
 
+std::size_t ClientImpl::DownloadObject(
+    std::string_view path,
+    const DownloadSink& sink,
+    const MultipartSettings& settings
+) const {
+    return DownloadObjectImpl(path, sink, settings, std::nullopt);
+}
+
+std::size_t ClientImpl::DownloadObjectToBuffer(
+    std::string_view path,
+    utils::span<char> buffer,
+    const MultipartSettings& settings
+) const {
+    return DownloadObjectImpl(
+        path,
+        [buffer](std::size_t offset, std::string_view data) {
+            std::memcpy(buffer.data() + offset, data.data(), data.size());
+        },
+        settings,
+        buffer.size()
+    );
+}
+
+std::size_t ClientImpl::DownloadObjectImpl(
+    std::string_view path,
+    const DownloadSink& sink,
+    const MultipartSettings& settings,
+    std::optional<std::size_t> max_size
+) const {
+    ValidateSettings(settings);
+
+    HeaderDataRequest head_request;
+    head_request.headers.emplace();
+    head_request.headers->emplace(USERVER_NAMESPACE::http::headers::kContentLength);
+    head_request.headers->emplace(USERVER_NAMESPACE::http::headers::kETag);
+    head_request.need_meta = false;
+    const auto object_head = GetObjectHead(path, head_request);
+    if (!object_head || !object_head->headers) {
+        throw ParallelDownloadError(fmt::format("Failed to get the head of {}", path));
+    }
+    const auto& head_headers = *object_head->headers;
+    const auto* content_length =
+        USERVER_NAMESPACE::utils::FindOrNullptr(head_headers, USERVER_NAMESPACE::http::headers::kContentLength);
+    if (!content_length) {
+        throw ParallelDownloadError(fmt::format("No Content-Length in the head of {}", path));
+    }
+    const std::size_t size = std::stoull(*content_length);
+    if (max_size && size > *max_size) {
+        throw ParallelDownloadError(
+            fmt::format("Object {} of {} bytes does not fit in the buffer of {} bytes", path, size, *max_size)
+        );
+    }
+    // The parts must belong to the same version of the object
+    const auto etag = USERVER_NAMESPACE::utils::FindOptional(head_headers, USERVER_NAMESPACE::http::headers::kETag);
+
+    try {
+        std::deque<engine::TaskWithResult<void>> downloads;
+        for (std::size_t offset = 0; offset < size; offset += settings.part_size) {
+            if (downloads.size() >= settings.max_concurrent_parts) {
+                downloads.front().Get();
+                downloads.pop_front();
+            }
+
+            const auto end = std::min(size, offset + settings.part_size);
+            downloads.push_back(USERVER_NAMESPACE::utils::Async(
+                "s3api_download_part",
+                [this, path, offset, end, &etag, &sink, &settings] {
+                    const auto data = WithAttempts(settings.part_attempts, "Downloading a part", [&] {
+                        auto req = api_methods::GetObject(bucket_, path);
+                        api_methods::SetRange(req, offset, end - 1);
+                        if (etag) {
+                            req.headers[USERVER_NAMESPACE::http::headers::kIfMatch] = *etag;
+                        }
+                        auto body = RequestApi(req, "get_object");
+                        if (body.size() != end - offset) {
+                            throw ParallelDownloadError(fmt::format(
+                                "Got {} bytes instead of {} for the range starting at {}",
+                                body.size(),
+                                end - offset,
+                                offset
+                            ));
+                        }
+                        return body;
+                    });
+                    sink(offset, data);
+                }
+            ));
+        }
+        for (auto& download : downloads) {
+            download.Get();
+        }
+    } catch (const std::exception& e) {
+        throw ParallelDownloadError(fmt::format("Parallel download of {} failed: {}", path, e.what()));
+    }
+
+    return size;
+}
+
 std::optional<ClientImpl::HeadersDataResponse>
 ClientImpl::GetObjectHead(std::string_view path, const HeaderDataRequest& headers_request) const {
     HeadersDataResponse headers_data;
@@ -56,6 +56,14 @@ public:
         const std::optional<std::vector<Tag>>& tags
     ) const final;
 
+    void PutObjectMultipart(
+        std::string_view path,
+        const UploadSource& source,
+        const MultipartSettings& settings,
+        const std::optional<Meta>& meta,
+        std::string_view content_type
+    ) const final;
+
     void DeleteObject(std::string_view path) const final;
 
     std::optional<std::string> GetObject(
@@ -88,6 +96,15 @@ public:
         const HeaderDataRequest& headers_request
     ) const final;
 
+    std::size_t DownloadObject(std::string_view path, const DownloadSink& sink, const MultipartSettings& settings)
+        const final;
+
+    std::size_t DownloadObjectToBuffer(
+        std::string_view path,
+        utils::span<char> buffer,
+        const MultipartSettings& settings
+    ) const final;
+
     std::string CopyObject(
         std::string_view key_from,
         std::string_view bucket_to,
@@ -136,6 +153,21 @@ private:
         const HeaderDataRequest& headers_request = HeaderDataRequest()
     ) const;
 
+    std::string UploadPart(
+        std::string_view path,
+        std::string_view upload_id,
+        std::size_t part_number,
+        std::string data,
+        const MultipartSettings& settings
+    ) const;
+
+    std::size_t DownloadObjectImpl(
+        std::string_view path,
+        const DownloadSink& sink,
+        const MultipartSettings& settings,
+        std::optional<std::size_t> max_size
+    ) const;
+
     std::shared_ptr<S3Connection> conn_;
     std::shared_ptr<authenticators::Authenticator> authenticator_;
     std::string bucket_;
@@ -2,6 +2,7 @@
 
 #include <optional>
 #include <string>
+#include <vector>
 
 #include <userver/http/predefined_header.hpp>
 
@@ -52,6 +53,27 @@ Request CopyObject(
     std::string_view content_type
 );
 
+Request CreateMultipartUpload(std::string_view bucket, std::string_view path, std::string_view content_type);
+
+Request UploadPart(
+    std::string_view bucket,
+    std::string_view path,
+    std::string_view upload_id,
+    std::size_t part_number,
+    std::string data
+);
+
+/// @param etags ETags of the uploaded parts, in the order of their part numbers
+/// starting from 1
+Request CompleteMultipartUpload(
+    std::string_view bucket,
+    std::string_view path,
+    std::string_view upload_id,
+    const std::vector<std::string>& etags
+);
+
+Request AbortMultipartUpload(std::string_view bucket, std::string_view path, std::string_view upload_id);
+
 }  // namespace s3api::api_methods
 
 USERVER_NAMESPACE_END
@@ -40,6 +40,43 @@ TEST(S3ApiMethods, GetObjectWithRange) {
     );
 }
 
+TEST(S3ApiMethods, UploadPart) {
+    const Request request = UploadPart("bucket", "path", "upload-id", 3, "data");
+    EXPECT_EQ(request.method, USERVER_NAMESPACE::clients::http::HttpMethod::kPut);
+    EXPECT_EQ(request.bucket, "bucket");
+    EXPECT_EQ(request.req.substr(0, 5), "path?");
+    EXPECT_NE(request.req.find("partNumber=3"), std::string::npos);
+    EXPECT_NE(request.req.find("uploadId=upload-id"), std::string::npos);
+    EXPECT_EQ(request.body, "data");
+    const std::string* content_length =
+        USERVER_NAMESPACE::utils::FindOrNullptr(request.headers, USERVER_NAMESPACE::http::headers::kContentLength);
+    ASSERT_NE(content_length, nullptr);
+    EXPECT_EQ(*content_length, "4");
+}
+
+TEST(S3ApiMethods, CompleteMultipartUpload) {
+    const Request request = CompleteMultipartUpload("bucket", "path", "upload-id", {"\"etag1\"", "\"etag2\""});
+    EXPECT_EQ(request.method, USERVER_NAMESPACE::clients::http::HttpMethod::kPost);
+    EXPECT_EQ(request.req, "path?uploadId=upload-id");
+    EXPECT_EQ(
+        request.body,
+        "<CompleteMultipartUpload>"
+        "<Part><PartNumber>1</PartNumber><ETag>\"etag1\"</ETag></Part>"
+        "<Part><PartNumber>2</PartNumber><ETag>\"etag2\"</ETag></Part>"
+        "</CompleteMultipartUpload>"
+    );
+}
+
+TEST(S3ApiMethods, CreateAndAbortMultipartUpload) {
+    const Request create = CreateMultipartUpload("bucket", "path", "application/octet-stream");
+    EXPECT_EQ(create.method, USERVER_NAMESPACE::clients::http::HttpMethod::kPost);
+    EXPECT_EQ(create.req, "path?uploads");
+
+    const Request abort = AbortMultipartUpload("bucket", "path", "upload-id");
+    EXPECT_EQ(abort.method, USERVER_NAMESPACE::clients::http::HttpMethod::kDelete);
+    EXPECT_EQ(abort.req, "path?uploadId=upload-id");
+}
+
 }  // namespace s3api::api_methods
 
 USERVER_NAMESPACE_END
@@ -23,6 +23,17 @@ public:
         (const, override)
     );
 
+    MOCK_METHOD(
+        void,
+        PutObjectMultipart,
+        (std::string_view path,
+         const UploadSource& source,
+         const MultipartSettings& settings,
+         const std::optional<Meta>& meta,
+         std::string_view content_type),
+        (const, override)
+    );
+
     MOCK_METHOD(void, DeleteObject, (std::string_view path), (const, override));
 
     MOCK_METHOD(
@@ -67,6 +78,20 @@ public:
         (const, override)
     );
 
+    MOCK_METHOD(
+        std::size_t,
+        DownloadObject,
+        (std::string_view path, const DownloadSink& sink, const MultipartSettings& settings),
+        (const, override)
+    );
+
+    MOCK_METHOD(
+        std::size_t,
+        DownloadObjectToBuffer,
+        (std::string_view path, utils::span<char> buffer, const MultipartSettings& settings),
+        (const, override)
+    );
+
     MOCK_METHOD(
         std::string,
         CopyObject,
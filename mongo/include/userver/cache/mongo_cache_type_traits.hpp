@@ -89,6 +89,11 @@ using HasInvalidDocumentsSkipped = decltype(T::kAreInvalidDocumentsSkipped);
 template <typename T>
 inline constexpr bool kHasInvalidDocumentsSkipped = meta::kIsDetected<HasInvalidDocumentsSkipped, T>;
 
+template <typename T>
+using HasKeyById = decltype(T::GetKeyById);
+template <typename T>
+inline constexpr bool kHasKeyById = meta::kIsDetected<HasKeyById, T>;
+
 template <typename>
 struct ClassByMemberPointer {};
 template <typename T, typename C>
@@ -160,6 +165,37 @@ struct CheckTraits {
     );
 };
 
+template <typename MongoCacheTraits>
+struct CheckChangeStreamTraits {
+    static_assert(kHasCollectionsField<MongoCacheTraits>, "Mongo cache traits must specify collections field");
+    static_assert(kHasKeyField<MongoCacheTraits>, "Mongo cache traits must specify key field");
+    static_assert(kHasValidDataType<MongoCacheTraits>, "Mongo cache traits must specify mapping data type");
+
+    static_assert(kHasSecondaryPreferred<MongoCacheTraits>, "Mongo cache traits must specify read preference");
+    static_assert(
+        std::is_same_v<std::decay_t<decltype(MongoCacheTraits::kIsSecondaryPreferred)>, bool>,
+        "Mongo cache traits must specify read preference of a bool type"
+    );
+
+    static_assert(kHasInvalidDocumentsSkipped<MongoCacheTraits>, "Mongo cache traits must specify validation policy");
+    static_assert(
+        std::is_same_v<std::decay_t<decltype(MongoCacheTraits::kAreInvalidDocumentsSkipped)>, bool>,
+        "Mongo cache traits must specify validation policy of a bool type"
+    );
+
+    static_assert(
+        kHasDeserializeObject<MongoCacheTraits> || kHasDefaultDeserializeObject<MongoCacheTraits>,
+        "Mongo cache traits must specify deserialize object"
+    );
+    static_assert(
+        !kHasDeserializeObject<MongoCacheTraits> || kHasCorrectDeserializeObject<MongoCacheTraits>,
+        "Mongo cache traits must specify deserialize object with correct "
+        "signature and return value type: "
+        "static ObjectType DeserializeObject(const formats::bson::Document& "
+        "doc)"
+    );
+};
+
 }  // namespace mongo_cache::impl
 
 USERVER_NAMESPACE_END
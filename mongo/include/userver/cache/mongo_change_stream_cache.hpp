@@ -0,0 +1,481 @@
+#pragma once
+
+/// @file userver/cache/mongo_change_stream_cache.hpp
+/// @brief @copybrief components::MongoChangeStreamCache
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <userver/cache/base_mongo_cache.hpp>
+#include <userver/cache/cache_statistics.hpp>
+#include <userver/cache/caching_component_base.hpp>
+#include <userver/cache/mongo_cache_type_traits.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/formats/bson/binary.hpp>
+#include <userver/formats/bson/document.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/mongo/change_stream.hpp>
+#include <userver/storages/mongo/collection.hpp>
+#include <userver/storages/mongo/exception.hpp>
+#include <userver/storages/mongo/operations.hpp>
+#include <userver/storages/mongo/options.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components {
+
+namespace impl {
+
+struct MongoChangeStreamCacheSettings {
+    std::chrono::milliseconds max_await_time{0};
+    std::size_t max_events_per_update{0};
+};
+
+MongoChangeStreamCacheSettings ParseMongoChangeStreamCacheSettings(const ComponentConfig& config);
+
+std::string GetMongoChangeStreamCacheSchema();
+
+/// @returns whether the change stream cannot be resumed from its resume token
+/// anymore, e.g. the oplog no longer has the events after it
+bool IsChangeStreamHistoryLost(const storages::mongo::ServerException& exception);
+
+}  // namespace impl
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief %Base class for the caches that mirror a mongo collection by
+/// following its change stream
+///
+/// A full update reads the whole collection and opens a change stream of it.
+/// Incremental updates apply the change events that came since the previous
+/// update instead of querying the collection, so a small `update-interval`
+/// keeps the cache fresh at the cost of the changed documents only. Change
+/// streams require a replica set or a sharded cluster.
+///
+/// The resume token of the stream is stored in the cache dump along with the
+/// data, so after a restart the cache resumes the stream from the dumped
+/// data. If the stream cannot be resumed (the oplog no longer has the events
+/// after the token), or is invalidated by a drop or a rename of the
+/// collection, the cache falls back to a full update.
+///
+/// The keys of the cache must be derived from the `_id` of the documents, as
+/// delete events only carry the `_id` of the deleted document.
+///
+/// Use `kIsSecondaryPreferred = false` unless stale data is acceptable until
+/// the next full update: the stream is opened on the primary, and a secondary
+/// may miss the latest changes at the time of the full update.
+///
+/// Incremental updates must be enabled with `update-types: full-and-incremental`,
+/// otherwise the cache does full updates only.
+///
+/// ### Avoiding memory leaks
+/// See components::CachingComponentBase
+///
+/// ## Static options:
+/// All options of CachingComponentBase and
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// max-await-time | time an incremental update waits for new change events | 100ms
+/// max-events-per-update | change events applied by an incremental update at most, the rest are applied by the next one | 100000
+///
+/// ## Traits example:
+/// All fields below (except for function overrides) are mandatory.
+///
+/// ```
+/// struct MongoChangeStreamCacheTraitsExample {
+///   // Component name for component
+///   static constexpr std::string_view kName = "mongo-items-cache";
+///
+///   // Collection to read from
+///   static constexpr auto kMongoCollectionsField =
+///       &storages::mongo::Collections::items;
+///
+///   // Cache element type
+///   using ObjectType = CachedObject;
+///   // Cache element field name that is used as an index in the cache map
+///   static constexpr auto kKeyField = &CachedObject::id;
+///   // Type of kKeyField
+///   using KeyType = std::string;
+///   // Type of cache map, e.g. unordered_map, map, bimap
+///   using DataType = std::unordered_map<KeyType, ObjectType>;
+///
+///   // Whether the full updates prefer to read from replica
+///   static constexpr bool kIsSecondaryPreferred = false;
+///
+///   // Optional function that overrides BSON to ObjectType conversion
+///   static ObjectType DeserializeObject(const formats::bson::Document& doc) {
+///     return doc.As<ObjectType>();
+///   }
+///   // (default implementation calls doc.As<ObjectType>())
+///   // For using default implementation
+///   static constexpr bool kUseDefaultDeserializeObject = true;
+///
+///   // Optional function that returns the key of the document by its `_id`
+///   static KeyType GetKeyById(const formats::bson::Value& id) {
+///     return id.ConvertTo<std::string>();
+///   }
+///   // (default implementation calls id.As<KeyType>())
+///
+///   // Whether update part of the cache even if failed to parse some documents
+///   static constexpr bool kAreInvalidDocumentsSkipped = false;
+///
+///   // Component to get the collections
+///   using MongoCollectionsComponent = components::MongoCollections;
+/// };
+/// ```
+
+// clang-format on
+
+template <class MongoCacheTraits>
+class MongoChangeStreamCache : public CachingComponentBase<typename MongoCacheTraits::DataType> {
+    using DataType = typename MongoCacheTraits::DataType;
+    using CollectionsType = mongo_cache::impl::CollectionsType<decltype(MongoCacheTraits::kMongoCollectionsField)>;
+
+public:
+    static constexpr std::string_view kName = MongoCacheTraits::kName;
+
+    MongoChangeStreamCache(const ComponentConfig&, const ComponentContext&);
+
+    ~MongoChangeStreamCache();
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    // The resume token of the stream at the moment `data` was read
+    struct ResumePoint {
+        const DataType* data{nullptr};
+        std::optional<formats::bson::Document> token;
+    };
+
+    void Update(
+        cache::UpdateType type,
+        const std::chrono::system_clock::time_point& last_update,
+        const std::chrono::system_clock::time_point& now,
+        cache::UpdateStatisticsScope& stats_scope
+    ) override;
+
+    void WriteContents(dump::Writer& writer, const DataType& contents) const override;
+
+    std::unique_ptr<const DataType> ReadContents(dump::Reader& reader) const override;
+
+    void FullUpdate(cache::UpdateStatisticsScope& stats_scope);
+
+    void IncrementalUpdate(cache::UpdateStatisticsScope& stats_scope);
+
+    // Returns false if the stream is invalidated and a full update is required
+    bool ApplyEvent(const formats::bson::Document& event, DataType& cache, cache::UpdateStatisticsScope& stats_scope)
+        const;
+
+    void SetWithResumePoint(std::unique_ptr<DataType> new_cache, std::optional<formats::bson::Document> token);
+
+    std::optional<formats::bson::Document> GetResumeTokenOfCurrentData() const;
+
+    storages::mongo::ChangeStream OpenStream(std::optional<formats::bson::Document> resume_token) const;
+
+    typename MongoCacheTraits::ObjectType DeserializeObject(const formats::bson::Document& doc) const;
+
+    typename MongoCacheTraits::KeyType GetKeyById(const formats::bson::Value& id) const;
+
+    const std::shared_ptr<CollectionsType> mongo_collections_;
+    const storages::mongo::Collection* const mongo_collection_;
+    const impl::MongoChangeStreamCacheSettings settings_;
+
+    // Only accessed by the updates
+    std::optional<storages::mongo::ChangeStream> stream_;
+
+    // Read by the dumps concurrently with the updates
+    mutable concurrent::Variable<ResumePoint> resume_point_;
+};
+
+template <class MongoCacheTraits>
+inline constexpr bool kHasValidate<MongoChangeStreamCache<MongoCacheTraits>> = true;
+
+template <class MongoCacheTraits>
+MongoChangeStreamCache<MongoCacheTraits>::MongoChangeStreamCache(
+    const ComponentConfig& config,
+    const ComponentContext& context
+)
+    : CachingComponentBase<DataType>(config, context),
+      mongo_collections_(context.FindComponent<typename MongoCacheTraits::MongoCollectionsComponent>()
+                             .template GetCollectionForLibrary<CollectionsType>()),
+      mongo_collection_(std::addressof(mongo_collections_.get()->*MongoCacheTraits::kMongoCollectionsField)),
+      settings_(impl::ParseMongoChangeStreamCacheSettings(config)) {
+    [[maybe_unused]] mongo_cache::impl::CheckChangeStreamTraits<MongoCacheTraits> check_traits;
+
+    this->StartPeriodicUpdates();
+}
+
+template <class MongoCacheTraits>
+MongoChangeStreamCache<MongoCacheTraits>::~MongoChangeStreamCache() {
+    this->StopPeriodicUpdates();
+}
+
+template <class MongoCacheTraits>
+void MongoChangeStreamCache<MongoCacheTraits>::Update(
+    cache::UpdateType type,
+    const std::chrono::system_clock::time_point& /*last_update*/,
+    const std::chrono::system_clock::time_point& /*now*/,
+    cache::UpdateStatisticsScope& stats_scope
+) {
+    if (type == cache::UpdateType::kFull) {
+        FullUpdate(stats_scope);
+        return;
+    }
+
+    try {
+        IncrementalUpdate(stats_scope);
+    } catch (const storages::mongo::ServerException& e) {
+        stream_.reset();
+        if (!impl::IsChangeStreamHistoryLost(e)) throw;
+
+        LOG_WARNING() << "Change stream of cache " << kName << " cannot be resumed, falling back to a full update: " << e;
+        FullUpdate(stats_scope);
+    } catch (const std::exception&) {
+        // The stream has passed the events that were not applied, the next
+        // update reopens it from the resume token of the current data
+        stream_.reset();
+        throw;
+    }
+}
+
+template <class MongoCacheTraits>
+void MongoChangeStreamCache<MongoCacheTraits>::FullUpdate(cache::UpdateStatisticsScope& stats_scope) {
+    namespace sm = storages::mongo;
+
+    auto scope = tracing::Span::CurrentSpan().CreateScopeTime("watch");
+    // Open the stream before the scan, so that the changes made during it are
+    // applied by the next incremental update
+    std::optional<sm::ChangeStream> stream;
+    std::optional<formats::bson::Document> token;
+    if (this->GetAllowedUpdateTypes() != cache::AllowedUpdateTypes::kOnlyFull) {
+        stream.emplace(OpenStream(std::nullopt));
+        token = stream->GetResumeToken();
+    }
+
+    scope.Reset(kFetchAndParseStage);
+    sm::operations::Find find_op({});
+    if (MongoCacheTraits::kIsSecondaryPreferred) {
+        find_op.SetOption(sm::options::ReadPreference::kSecondaryPreferred);
+    }
+
+    auto new_cache = std::make_unique<DataType>();
+    for (const auto& doc : mongo_collection_->Execute(find_op)) {
+        stats_scope.IncreaseDocumentsReadCount(1);
+
+        try {
+            auto object = DeserializeObject(doc);
+            auto key = (object.*MongoCacheTraits::kKeyField);
+            (*new_cache)[key] = std::move(object);
+        } catch (const std::exception& e) {
+            LOG_LIMITED_ERROR() << "Failed to deserialize cache item of cache " << kName
+                                << ", _id=" << doc["_id"].template ConvertTo<std::string>() << ", what(): " << e;
+            stats_scope.IncreaseDocumentsParseFailures(1);
+
+            if (!MongoCacheTraits::kAreInvalidDocumentsSkipped) throw;
+        }
+    }
+
+    scope.Reset();
+    const auto size = new_cache->size();
+    SetWithResumePoint(std::move(new_cache), std::move(token));
+    stream_ = std::move(stream);
+    stats_scope.Finish(size);
+}
+
+template <class MongoCacheTraits>
+void MongoChangeStreamCache<MongoCacheTraits>::IncrementalUpdate(cache::UpdateStatisticsScope& stats_scope) {
+    if (!stream_) {
+        auto token = GetResumeTokenOfCurrentData();
+        if (!token) {
+            LOG_INFO() << "No resume token for the data of cache " << kName << ", falling back to a full update";
+            FullUpdate(stats_scope);
+            return;
+        }
+        stream_.emplace(OpenStream(std::move(token)));
+    }
+
+    auto scope = tracing::Span::CurrentSpan().CreateScopeTime(kFetchAndParseStage);
+    std::unique_ptr<DataType> new_cache;
+    for (std::size_t events = 0; events < settings_.max_events_per_update; ++events) {
+        auto event = stream_->Next();
+        if (!event) break;
+        stats_scope.IncreaseDocumentsReadCount(1);
+
+        if (!new_cache) {
+            scope.Reset("copy_data");
+            new_cache = std::make_unique<DataType>(*this->Get());
+            scope.Reset(kFetchAndParseStage);
+        }
+        if (!ApplyEvent(*event, *new_cache, stats_scope)) {
+            LOG_WARNING() << "Change stream of cache " << kName << " is invalidated, falling back to a full update";
+            stream_.reset();
+            scope.Reset();
+            FullUpdate(stats_scope);
+            return;
+        }
+    }
+    scope.Reset();
+
+    auto token = stream_->GetResumeToken();
+    if (!new_cache) {
+        // The token may advance without events, keep it for the dumps
+        {
+            const auto data = this->Get();
+            auto resume_point = resume_point_.Lock();
+            if (resume_point->data == data.Get() && token) resume_point->token = std::move(token);
+        }
+        stats_scope.FinishNoChanges();
+        return;
+    }
+
+    const auto size = new_cache->size();
+    SetWithResumePoint(std::move(new_cache), std::move(token));
+    stats_scope.Finish(size);
+}
+
+template <class MongoCacheTraits>
+bool MongoChangeStreamCache<MongoCacheTraits>::ApplyEvent(
+    const formats::bson::Document& event,
+    DataType& cache,
+    cache::UpdateStatisticsScope& stats_scope
+) const {
+    const auto operation_type = event["operationType"].As<std::string>();
+    if (operation_type == "insert" || operation_type == "update" || operation_type == "replace") {
+        const auto full_document = event["fullDocument"];
+        // The document was deleted before the lookup, the delete event follows
+        if (full_document.IsMissing() || full_document.IsNull()) return true;
+
+        try {
+            auto object = DeserializeObject(full_document);
+            auto key = (object.*MongoCacheTraits::kKeyField);
+            cache[key] = std::move(object);
+        } catch (const std::exception& e) {
+            LOG_LIMITED_ERROR() << "Failed to deserialize cache item of cache " << kName
+                                << ", _id=" << event["documentKey"]["_id"].template ConvertTo<std::string>()
+                                << ", what(): " << e;
+            stats_scope.IncreaseDocumentsParseFailures(1);
+
+            if (!MongoCacheTraits::kAreInvalidDocumentsSkipped) throw;
+        }
+    } else if (operation_type == "delete") {
+        cache.erase(GetKeyById(event["documentKey"]["_id"]));
+    } else if (operation_type == "invalidate" || operation_type == "drop" || operation_type == "rename" ||
+               operation_type == "dropDatabase") {
+        return false;
+    }
+    // The rest of the events do not change the documents
+    return true;
+}
+
+template <class MongoCacheTraits>
+void MongoChangeStreamCache<MongoCacheTraits>::SetWithResumePoint(
+    std::unique_ptr<DataType> new_cache,
+    std::optional<formats::bson::Document> token
+) {
+    const auto* data = new_cache.get();
+    this->Set(std::move(new_cache));
+
+    // A dump made in between finds no resume point for its data and is
+    // restored with a full update
+    auto resume_point = resume_point_.Lock();
+    resume_point->data = data;
+    resume_point->token = std::move(token);
+}
+
+template <class MongoCacheTraits>
+std::optional<formats::bson::Document> MongoChangeStreamCache<MongoCacheTraits>::GetResumeTokenOfCurrentData() const {
+    const auto data = this->Get();
+    const auto resume_point = resume_point_.Lock();
+    if (resume_point->data != data.Get()) return std::nullopt;
+    return resume_point->token;
+}
+
+template <class MongoCacheTraits>
+storages::mongo::ChangeStream MongoChangeStreamCache<MongoCacheTraits>::OpenStream(
+    std::optional<formats::bson::Document> resume_token
+) const {
+    namespace sm = storages::mongo;
+
+    sm::operations::Watch watch_op;
+    watch_op.SetOption(sm::options::FullDocumentLookup{});
+    watch_op.SetOption(sm::options::MaxAwaitTime{settings_.max_await_time});
+    if (resume_token) watch_op.SetOption(sm::options::ResumeAfter{std::move(*resume_token)});
+    return mongo_collection_->Execute(watch_op);
+}
+
+template <class MongoCacheTraits>
+void MongoChangeStreamCache<MongoCacheTraits>::WriteContents(dump::Writer& writer, const DataType& contents) const {
+    if constexpr (dump::kIsDumpable<DataType>) {
+        std::string token;
+        {
+            const auto resume_point = resume_point_.Lock();
+            if (resume_point->data == &contents && resume_point->token) {
+                token = formats::bson::ToBinaryString(*resume_point->token).ToString();
+            }
+        }
+        writer.Write(token);
+        writer.Write(contents);
+    } else {
+        dump::ThrowDumpUnimplemented(this->Name());
+    }
+}
+
+template <class MongoCacheTraits>
+std::unique_ptr<const typename MongoCacheTraits::DataType> MongoChangeStreamCache<MongoCacheTraits>::ReadContents(
+    dump::Reader& reader
+) const {
+    if constexpr (dump::kIsDumpable<DataType>) {
+        const auto token = reader.Read<std::string>();
+        std::unique_ptr<const DataType> data{new DataType(reader.Read<DataType>())};
+
+        auto resume_point = resume_point_.Lock();
+        resume_point->data = data.get();
+        resume_point->token.reset();
+        if (!token.empty()) resume_point->token = formats::bson::FromBinaryString(token);
+        return data;
+    } else {
+        dump::ThrowDumpUnimplemented(this->Name());
+    }
+}
+
+template <class MongoCacheTraits>
+typename MongoCacheTraits::ObjectType MongoChangeStreamCache<MongoCacheTraits>::DeserializeObject(
+    const formats::bson::Document& doc
+) const {
+    if constexpr (mongo_cache::impl::kHasDeserializeObject<MongoCacheTraits>) {
+        return MongoCacheTraits::DeserializeObject(doc);
+    }
+    if constexpr (mongo_cache::impl::kHasDefaultDeserializeObject<MongoCacheTraits>) {
+        return doc.As<typename MongoCacheTraits::ObjectType>();
+    }
+    UASSERT_MSG(false, "No deserialize operation defined but DeserializeObject invoked");
+}
+
+template <class MongoCacheTraits>
+typename MongoCacheTraits::KeyType MongoChangeStreamCache<MongoCacheTraits>::GetKeyById(const formats::bson::Value& id
+) const {
+    if constexpr (mongo_cache::impl::kHasKeyById<MongoCacheTraits>) {
+        return MongoCacheTraits::GetKeyById(id);
+    } else {
+        return id.As<typename MongoCacheTraits::KeyType>();
+    }
+}
+
+template <class MongoCacheTraits>
+yaml_config::Schema MongoChangeStreamCache<MongoCacheTraits>::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<CachingComponentBase<DataType>>(impl::GetMongoChangeStreamCacheSchema());
+}
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
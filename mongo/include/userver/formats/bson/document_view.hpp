@@ -0,0 +1,107 @@
+#pragma once
+
+/// @file userver/formats/bson/document_view.hpp
+/// @brief @copybrief formats::bson::DocumentView
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include <userver/formats/bson/types.hpp>
+#include <userver/utils/function_ref.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::bson {
+
+class Document;
+class ElementView;
+
+/// @brief Non-owning read-only view of a BSON document, that is read element
+/// by element right from the underlying buffer
+///
+/// Unlike formats::bson::Value, the view neither parses the document into a
+/// tree nor copies it: the keys and the strings are views into the buffer.
+/// This suits decoding of big result sets directly into user types, see
+/// storages::mongo::Cursor::ForEachView.
+///
+/// The view is only valid while the underlying document lives.
+///
+/// ## Example usage:
+///
+/// @snippet formats/bson/document_view_test.cpp  Sample DocumentView usage
+class DocumentView final {
+public:
+    /// Creates a view of the document
+    explicit DocumentView(const Document& document);
+
+    /// @cond
+    /// Creates a view of a native document, internal use only
+    explicit DocumentView(const bson_t& bson);
+
+    /// Creates a view of a raw document, internal use only
+    DocumentView(const uint8_t* data, size_t length) : data_(data), length_(length) {}
+    /// @endcond
+
+    /// @brief Calls `func` for each element of the document in order; the
+    /// elements of an array have their indices as keys
+    /// @throws ParseException if the document is corrupted
+    void ForEach(utils::function_ref<void(const ElementView&)> func) const;
+
+private:
+    const uint8_t* data_;
+    size_t length_;
+};
+
+/// @brief Non-owning view of an element of a DocumentView, only valid during
+/// the DocumentView::ForEach call
+///
+/// The `As*` methods throw TypeMismatchException if the element is of another
+/// type. The numeric ones accept any numeric element that fits the result.
+class ElementView final {
+public:
+    /// @cond
+    /// Wraps an iterator pointing at the element, internal use only
+    explicit ElementView(const bson_iter_t& iter) : iter_(&iter) {}
+    /// @endcond
+
+    std::string_view Key() const;
+
+    /// @name Type checking
+    /// @{
+    bool IsNull() const;
+    bool IsBool() const;
+    bool IsInt32() const;
+    bool IsInt64() const;
+    bool IsDouble() const;
+    bool IsString() const;
+    bool IsDateTime() const;
+    bool IsOid() const;
+    bool IsDocument() const;
+    bool IsArray() const;
+    /// @}
+
+    /// @name Value access
+    /// @{
+    bool AsBool() const;
+    int32_t AsInt32() const;
+    int64_t AsInt64() const;
+    double AsDouble() const;
+    std::string_view AsString() const;
+    std::chrono::system_clock::time_point AsDateTime() const;
+    Oid AsOid() const;
+
+    /// Returns a view of a document or an array element
+    DocumentView AsDocument() const;
+    /// @}
+
+private:
+    [[noreturn]] void ThrowTypeMismatch(bson_type_t expected) const;
+
+    const bson_iter_t* iter_;
+};
+
+}  // namespace formats::bson
+
+USERVER_NAMESPACE_END
@@ -33,6 +33,7 @@ public:
     void SetOption(options::WriteConcern::Level);
     void SetOption(const options::WriteConcern&);
     void SetOption(options::SuppressServerExceptions);
+    void SetOption(const options::BulkChunks&);
 
     /// Inserts a single document
     template <typename... Options>
@@ -73,7 +74,7 @@ private:
     friend class storages::mongo::impl::cdriver::CDriverCollectionImpl;
 
     class Impl;
-    static constexpr size_t kSize = 56;
+    static constexpr size_t kSize = 112;
     static constexpr size_t kAlignment = 8;
     // MAC_COMPAT: std::string size differs
     utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
@@ -0,0 +1,45 @@
+#pragma once
+
+/// @file userver/storages/mongo/change_stream.hpp
+/// @brief @copybrief storages::mongo::ChangeStream
+
+#include <memory>
+#include <optional>
+
+#include <userver/formats/bson/document.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+namespace impl {
+class ChangeStreamImpl;
+}  // namespace impl
+
+/// @brief Change stream of a MongoDB collection
+///
+/// The stream holds a connection of the pool while alive. Resumable errors
+/// (e.g. a primary step down) are retried once by the driver.
+class ChangeStream {
+public:
+    explicit ChangeStream(std::unique_ptr<impl::ChangeStreamImpl>&&);
+    ~ChangeStream();
+
+    ChangeStream(ChangeStream&&) noexcept;
+    ChangeStream& operator=(ChangeStream&&) noexcept;
+
+    /// @brief Returns the next change event, or std::nullopt if no new events
+    /// came within the await time, see options::MaxAwaitTime
+    std::optional<formats::bson::Document> Next();
+
+    /// @brief Returns the token to open a stream from the current position
+    /// with options::ResumeAfter, or std::nullopt if the server did not
+    /// provide it yet
+    std::optional<formats::bson::Document> GetResumeToken() const;
+
+private:
+    std::unique_ptr<impl::ChangeStreamImpl> impl_;
+};
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
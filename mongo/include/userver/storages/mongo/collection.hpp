@@ -12,6 +12,7 @@
 #include <userver/formats/bson/document.hpp>
 #include <userver/formats/bson/value.hpp>
 #include <userver/storages/mongo/bulk.hpp>
+#include <userver/storages/mongo/change_stream.hpp>
 #include <userver/storages/mongo/cursor.hpp>
 #include <userver/storages/mongo/operations.hpp>
 #include <userver/storages/mongo/write_result.hpp>
@@ -116,6 +117,11 @@ public:
     template <typename... Options>
     Cursor Aggregate(formats::bson::Value pipeline, Options&&... options);
 
+    /// @brief Opens a change stream of all the changes of the collection
+    /// @note Requires a replica set or a sharded cluster
+    template <typename... Options>
+    ChangeStream Watch(Options&&... options) const;
+
     /// Get collection name
     const std::string& GetCollectionName() const;
 
@@ -133,6 +139,7 @@ public:
     WriteResult Execute(const operations::FindAndRemove&);
     WriteResult Execute(operations::Bulk&&);
     Cursor Execute(const operations::Aggregate&);
+    ChangeStream Execute(const operations::Watch&) const;
     void Execute(const operations::Drop&);
     /// @}
 private:
@@ -275,6 +282,13 @@ Cursor Collection::Aggregate(formats::bson::Value pipeline, Options&&... options
     return Execute(aggregate);
 }
 
+template <typename... Options>
+ChangeStream Collection::Watch(Options&&... options) const {
+    operations::Watch watch_op;
+    (watch_op.SetOption(std::forward<Options>(options)), ...);
+    return Execute(watch_op);
+}
+
 }  // namespace storages::mongo
 
 USERVER_NAMESPACE_END
@@ -7,6 +7,8 @@
 #include <memory>
 
 #include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/document_view.hpp>
+#include <userver/utils/function_ref.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -61,6 +63,13 @@ public:
     Iterator begin();
     Iterator end();
 
+    /// @brief Calls `func` for each of the remaining documents without copying
+    /// them out of the server replies.
+    ///
+    /// The views are only valid during the `func` call, the documents must be
+    /// decoded inside of it. The cursor is exhausted afterwards.
+    void ForEachView(utils::function_ref<void(const formats::bson::DocumentView&)> func);
+
 private:
     std::unique_ptr<impl::CursorImpl> impl_;
 };
@@ -337,6 +337,37 @@ private:
     utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
 };
 
+/// @brief Opens a change stream of the collection
+/// @see https://www.mongodb.com/docs/manual/changeStreams/
+class Watch {
+public:
+    /// Watches all the changes of the collection
+    Watch();
+
+    /// Watches the changes passed through the aggregation pipeline
+    explicit Watch(formats::bson::Value pipeline);
+
+    ~Watch();
+
+    Watch(const Watch&);
+    Watch(Watch&&) noexcept;
+    Watch& operator=(const Watch&);
+    Watch& operator=(Watch&&) noexcept;
+
+    void SetOption(options::ReadConcern);
+    void SetOption(const options::ResumeAfter&);
+    void SetOption(options::FullDocumentLookup);
+    void SetOption(const options::MaxAwaitTime&);
+
+private:
+    friend class storages::mongo::impl::cdriver::CDriverCollectionImpl;
+
+    class Impl;
+    static constexpr size_t kSize = 96;
+    static constexpr size_t kAlignment = 8;
+    utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
+};
+
 class Drop {
 public:
     Drop();
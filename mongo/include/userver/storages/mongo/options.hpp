@@ -121,6 +121,33 @@ private:
 /// Disables ordering on bulk operations causing them to continue after an error
 class Unordered {};
 
+/// @brief Splits a bulk operation into chunks of at most `size`
+/// sub-operations executed as separate bulk writes
+///
+/// Chunks of an unordered bulk are executed concurrently over up to
+/// `max_parallel` pool connections, chunks of an ordered bulk are executed one
+/// by one and the execution stops at the first failed chunk. A chunk failed
+/// with a non-server error, e.g. a network error or a timeout, is re-executed
+/// up to `max_attempts` times in total. The results of the chunks are merged
+/// into a single WriteResult with the operation indices of the whole bulk.
+/// @warning A retry may repeat the writes of a chunk that actually reached the
+/// server, e.g. insert the documents without `_id` twice.
+/// @note Must be set before the sub-operations are appended.
+class BulkChunks {
+public:
+    explicit BulkChunks(size_t size, size_t max_parallel = 4, size_t max_attempts = 1)
+        : size_(size), max_parallel_(max_parallel), max_attempts_(max_attempts) {}
+
+    size_t Size() const { return size_; }
+    size_t MaxParallel() const { return max_parallel_; }
+    size_t MaxAttempts() const { return max_attempts_; }
+
+private:
+    size_t size_;
+    size_t max_parallel_;
+    size_t max_attempts_;
+};
+
 /// Enables insertion of a new document when update selector matches nothing
 class Upsert {};
 
@@ -299,6 +326,34 @@ private:
     std::chrono::milliseconds value_;
 };
 
+/// @brief Resumes a change stream after the event with the resume token
+/// @see storages::mongo::ChangeStream::GetResumeToken
+class ResumeAfter {
+public:
+    explicit ResumeAfter(formats::bson::Document resume_token) : value_(std::move(resume_token)) {}
+
+    const formats::bson::Document& Value() const { return value_; }
+
+private:
+    formats::bson::Document value_;
+};
+
+/// @brief Makes the update events of a change stream contain the current
+/// version of the whole changed document in `fullDocument`
+class FullDocumentLookup {};
+
+/// @brief Specifies the time a change stream waits for new events on the
+/// server before reporting that there are none
+class MaxAwaitTime {
+public:
+    explicit MaxAwaitTime(const std::chrono::milliseconds& value) : value_(value) {}
+
+    const std::chrono::milliseconds& Value() const { return value_; }
+
+private:
+    std::chrono::milliseconds value_;
+};
+
 }  // namespace storages::mongo::options
 
 USERVER_NAMESPACE_END
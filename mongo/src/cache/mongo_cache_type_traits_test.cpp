@@ -42,6 +42,18 @@ struct CorrectMongoCacheTraits {
     );
 };
 
+struct CorrectMongoChangeStreamCacheTraits {
+    static constexpr int kMongoCollectionsField = 0;
+    static constexpr int kKeyField = 0;
+    using DataType = std::unordered_map<int, int>;
+
+    static constexpr bool kIsSecondaryPreferred = false;
+    static constexpr bool kAreInvalidDocumentsSkipped = true;
+    static constexpr bool kUseDefaultDeserializeObject = true;
+
+    static int GetKeyById(const formats::bson::Value& id);
+};
+
 struct IncorrectReturnTypeOfFindOperation {
     static int GetFindOperation(
         cache::UpdateType type,
@@ -69,4 +81,10 @@ TEST(CheckTraits, FindOperation) {
 
 TEST(CheckTraits, CorrectTraits) { mongo_cache::impl::CheckTraits<CorrectMongoCacheTraits>{}; }
 
+TEST(CheckTraits, ChangeStreamTraits) {
+    mongo_cache::impl::CheckChangeStreamTraits<CorrectMongoChangeStreamCacheTraits>{};
+    EXPECT_TRUE(mongo_cache::impl::kHasKeyById<CorrectMongoChangeStreamCacheTraits>);
+    EXPECT_FALSE(mongo_cache::impl::kHasKeyById<CorrectMongoCacheTraits>);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,60 @@
+#include <userver/cache/mongo_change_stream_cache.hpp>
+
+#include <userver/components/component_config.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components::impl {
+
+namespace {
+
+// https://github.com/mongodb/mongo/blob/master/src/mongo/base/error_codes.yml
+constexpr int kCappedPositionLost = 136;
+constexpr int kInvalidResumeToken = 260;
+constexpr int kChangeStreamFatalError = 280;
+constexpr int kChangeStreamHistoryLost = 286;
+
+}  // namespace
+
+MongoChangeStreamCacheSettings ParseMongoChangeStreamCacheSettings(const ComponentConfig& config) {
+    MongoChangeStreamCacheSettings settings;
+    settings.max_await_time = config["max-await-time"].As<std::chrono::milliseconds>(100);
+    settings.max_events_per_update = config["max-events-per-update"].As<std::size_t>(100000);
+    UINVARIANT(settings.max_events_per_update > 0, "max-events-per-update must be positive");
+    return settings;
+}
+
+bool IsChangeStreamHistoryLost(const storages::mongo::ServerException& exception) {
+    switch (exception.Code()) {
+        case kCappedPositionLost:
+        case kInvalidResumeToken:
+        case kChangeStreamFatalError:
+        case kChangeStreamHistoryLost:
+            return true;
+        default:
+            return false;
+    }
+}
+
+std::string GetMongoChangeStreamCacheSchema() {
+    return R"(
+type: object
+description: Base class for the caches following a mongo change stream
+additionalProperties: false
+properties:
+    max-await-time:
+        type: string
+        description: time an incremental update waits for new change events
+        defaultDescription: 100ms
+    max-events-per-update:
+        type: integer
+        description: change events applied by an incremental update at most, the rest are applied by the next one
+        defaultDescription: 100000
+        minimum: 1
+)";
+}
+
+}  // namespace components::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,116 @@
+#include <userver/formats/bson/document_view.hpp>
+
+#include <limits>
+
+#include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/exception.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::bson {
+
+DocumentView::DocumentView(const Document& document) : DocumentView(*document.GetBson()) {}
+
+DocumentView::DocumentView(const bson_t& bson) : data_(bson_get_data(&bson)), length_(bson.len) {}
+
+void DocumentView::ForEach(utils::function_ref<void(const ElementView&)> func) const {
+    bson_iter_t iter;
+    if (!bson_iter_init_from_data(&iter, data_, length_)) {
+        throw ParseException("Malformed BSON document");
+    }
+
+    const ElementView element(iter);
+    while (bson_iter_next(&iter)) func(element);
+
+    // bson_iter_next stops at a corrupted element as well as at the end
+    if (iter.err_off) throw ParseException("Malformed BSON document");
+}
+
+std::string_view ElementView::Key() const { return {bson_iter_key(iter_), bson_iter_key_len(iter_)}; }
+
+bool ElementView::IsNull() const { return BSON_ITER_HOLDS_NULL(iter_); }
+
+bool ElementView::IsBool() const { return BSON_ITER_HOLDS_BOOL(iter_); }
+
+bool ElementView::IsInt32() const { return BSON_ITER_HOLDS_INT32(iter_); }
+
+bool ElementView::IsInt64() const { return BSON_ITER_HOLDS_INT64(iter_); }
+
+bool ElementView::IsDouble() const { return BSON_ITER_HOLDS_DOUBLE(iter_); }
+
+bool ElementView::IsString() const { return BSON_ITER_HOLDS_UTF8(iter_); }
+
+bool ElementView::IsDateTime() const { return BSON_ITER_HOLDS_DATE_TIME(iter_); }
+
+bool ElementView::IsOid() const { return BSON_ITER_HOLDS_OID(iter_); }
+
+bool ElementView::IsDocument() const { return BSON_ITER_HOLDS_DOCUMENT(iter_); }
+
+bool ElementView::IsArray() const { return BSON_ITER_HOLDS_ARRAY(iter_); }
+
+bool ElementView::AsBool() const {
+    if (!IsBool()) ThrowTypeMismatch(BSON_TYPE_BOOL);
+    return bson_iter_bool(iter_);
+}
+
+int32_t ElementView::AsInt32() const {
+    if (IsInt32()) return bson_iter_int32(iter_);
+    if (IsInt64()) {
+        const auto value = bson_iter_int64(iter_);
+        if (value >= std::numeric_limits<int32_t>::min() && value <= std::numeric_limits<int32_t>::max()) {
+            return static_cast<int32_t>(value);
+        }
+    }
+    ThrowTypeMismatch(BSON_TYPE_INT32);
+}
+
+int64_t ElementView::AsInt64() const {
+    if (IsInt64()) return bson_iter_int64(iter_);
+    if (IsInt32()) return bson_iter_int32(iter_);
+    ThrowTypeMismatch(BSON_TYPE_INT64);
+}
+
+double ElementView::AsDouble() const {
+    if (IsDouble()) return bson_iter_double(iter_);
+    if (IsInt32()) return bson_iter_int32(iter_);
+    if (IsInt64()) return static_cast<double>(bson_iter_int64(iter_));
+    ThrowTypeMismatch(BSON_TYPE_DOUBLE);
+}
+
+std::string_view ElementView::AsString() const {
+    if (!IsString()) ThrowTypeMismatch(BSON_TYPE_UTF8);
+    uint32_t length = 0;
+    const char* data = bson_iter_utf8(iter_, &length);
+    return {data, length};
+}
+
+std::chrono::system_clock::time_point ElementView::AsDateTime() const {
+    if (!IsDateTime()) ThrowTypeMismatch(BSON_TYPE_DATE_TIME);
+    return std::chrono::system_clock::time_point{std::chrono::milliseconds{bson_iter_date_time(iter_)}};
+}
+
+Oid ElementView::AsOid() const {
+    if (!IsOid()) ThrowTypeMismatch(BSON_TYPE_OID);
+    return Oid{*bson_iter_oid(iter_)};
+}
+
+DocumentView ElementView::AsDocument() const {
+    uint32_t length = 0;
+    const uint8_t* data = nullptr;
+    if (IsDocument()) {
+        bson_iter_document(iter_, &length, &data);
+    } else if (IsArray()) {
+        bson_iter_array(iter_, &length, &data);
+    } else {
+        ThrowTypeMismatch(BSON_TYPE_DOCUMENT);
+    }
+    return DocumentView{data, length};
+}
+
+void ElementView::ThrowTypeMismatch(bson_type_t expected) const {
+    throw TypeMismatchException(bson_iter_type(iter_), expected, Key());
+}
+
+}  // namespace formats::bson
+
+USERVER_NAMESPACE_END
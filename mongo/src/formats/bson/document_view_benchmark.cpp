@@ -0,0 +1,102 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <userver/formats/bson.hpp>
+#include <userver/formats/bson/document_view.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace fb = formats::bson;
+
+constexpr std::size_t kDocuments = 1000;
+
+struct Row {
+    std::string id;
+    std::string name;
+    int64_t count{0};
+    double price{0};
+    bool enabled{false};
+};
+
+Row Parse(const fb::Value& value, formats::parse::To<Row>) {
+    return Row{
+        value["_id"].As<std::string>(),
+        value["name"].As<std::string>(),
+        value["count"].As<int64_t>(),
+        value["price"].As<double>(),
+        value["enabled"].As<bool>(),
+    };
+}
+
+Row ParseView(const fb::DocumentView& view) {
+    Row row;
+    view.ForEach([&row](const fb::ElementView& element) {
+        const auto key = element.Key();
+        if (key == "_id") {
+            row.id = element.AsString();
+        } else if (key == "name") {
+            row.name = element.AsString();
+        } else if (key == "count") {
+            row.count = element.AsInt64();
+        } else if (key == "price") {
+            row.price = element.AsDouble();
+        } else if (key == "enabled") {
+            row.enabled = element.AsBool();
+        }
+    });
+    return row;
+}
+
+std::vector<fb::Document> MakeDocuments() {
+    std::vector<fb::Document> documents;
+    documents.reserve(kDocuments);
+    for (std::size_t i = 0; i < kDocuments; ++i) {
+        documents.push_back(fb::MakeDoc(
+            "_id",
+            "row_" + std::to_string(i),
+            "name",
+            "some reasonably long name of the row",
+            "count",
+            static_cast<int64_t>(i),
+            "price",
+            i * 0.5,
+            "enabled",
+            i % 2 == 0,
+            "unused",
+            fb::MakeArray(1, 2, 3)
+        ));
+    }
+    return documents;
+}
+
+}  // namespace
+
+void bson_decode_value(benchmark::State& state) {
+    const auto documents = MakeDocuments();
+    for (auto _ : state) {
+        std::vector<Row> rows;
+        rows.reserve(documents.size());
+        for (const auto& document : documents) rows.push_back(document.As<Row>());
+        benchmark::DoNotOptimize(rows);
+    }
+    state.SetItemsProcessed(state.iterations() * kDocuments);
+}
+BENCHMARK(bson_decode_value);
+
+void bson_decode_view(benchmark::State& state) {
+    const auto documents = MakeDocuments();
+    for (auto _ : state) {
+        std::vector<Row> rows;
+        rows.reserve(documents.size());
+        for (const auto& document : documents) rows.push_back(ParseView(fb::DocumentView{document}));
+        benchmark::DoNotOptimize(rows);
+    }
+    state.SetItemsProcessed(state.iterations() * kDocuments);
+}
+BENCHMARK(bson_decode_view);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <userver/formats/bson.hpp>
+#include <userver/formats/bson/document_view.hpp>
+#include <userver/utest/assert_macros.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace fb = formats::bson;
+
+namespace {
+
+/// [Sample DocumentView usage]
+struct Item {
+    std::string name;
+    int64_t count{0};
+    double price{0};
+    std::vector<std::string> tags;
+};
+
+Item ParseItem(const formats::bson::DocumentView& view) {
+    Item item;
+    view.ForEach([&item](const formats::bson::ElementView& element) {
+        const auto key = element.Key();
+        if (key == "name") {
+            item.name = element.AsString();
+        } else if (key == "count") {
+            item.count = element.AsInt64();
+        } else if (key == "price") {
+            item.price = element.AsDouble();
+        } else if (key == "tags") {
+            element.AsDocument().ForEach([&item](const formats::bson::ElementView& tag) {
+                item.tags.emplace_back(tag.AsString());
+            });
+        }
+    });
+    return item;
+}
+/// [Sample DocumentView usage]
+
+}  // namespace
+
+TEST(DocumentView, DecodeStruct) {
+    const auto doc = fb::MakeDoc(
+        "_id",
+        fb::Oid{},
+        "name",
+        "item",
+        "count",
+        42,
+        "price",
+        1.5,
+        "tags",
+        fb::MakeArray("a", "b"),
+        "extra",
+        true
+    );
+
+    const auto item = ParseItem(fb::DocumentView{doc});
+    EXPECT_EQ(item.name, "item");
+    EXPECT_EQ(item.count, 42);
+    EXPECT_DOUBLE_EQ(item.price, 1.5);
+    EXPECT_EQ(item.tags, (std::vector<std::string>{"a", "b"}));
+}
+
+TEST(DocumentView, Types) {
+    const auto time_point = std::chrono::system_clock::from_time_t(0) + std::chrono::milliseconds{1};
+    const fb::Oid oid;
+    const auto doc = fb::MakeDoc(
+        "null",
+        nullptr,
+        "bool",
+        true,
+        "date",
+        time_point,
+        "oid",
+        oid,
+        "doc",
+        fb::MakeDoc("int", 1),
+        "big",
+        int64_t{1} << 40
+    );
+
+    std::vector<std::string> keys;
+    fb::DocumentView{doc}.ForEach([&](const fb::ElementView& element) {
+        keys.emplace_back(element.Key());
+        const auto key = element.Key();
+        if (key == "null") {
+            EXPECT_TRUE(element.IsNull());
+        } else if (key == "bool") {
+            EXPECT_TRUE(element.AsBool());
+        } else if (key == "date") {
+            EXPECT_EQ(element.AsDateTime(), time_point);
+        } else if (key == "oid") {
+            EXPECT_EQ(element.AsOid(), oid);
+        } else if (key == "doc") {
+            EXPECT_TRUE(element.IsDocument());
+            element.AsDocument().ForEach([](const fb::ElementView& nested) {
+                EXPECT_EQ(nested.Key(), "int");
+                EXPECT_EQ(nested.AsInt32(), 1);
+                EXPECT_EQ(nested.AsInt64(), 1);
+                EXPECT_DOUBLE_EQ(nested.AsDouble(), 1.0);
+            });
+        } else if (key == "big") {
+            EXPECT_EQ(element.AsInt64(), int64_t{1} << 40);
+            UEXPECT_THROW(element.AsInt32(), fb::TypeMismatchException);
+        }
+    });
+    EXPECT_EQ(keys, (std::vector<std::string>{"null", "bool", "date", "oid", "doc", "big"}));
+}
+
+TEST(DocumentView, TypeMismatch) {
+    const auto doc = fb::MakeDoc("name", 1);
+    UEXPECT_THROW(ParseItem(fb::DocumentView{doc}), fb::TypeMismatchException);
+}
+
+TEST(DocumentView, Malformed) {
+    const uint8_t data[] = {16, 0, 0, 0, 0x02, 'a', 0, 100, 0, 0, 0, 'b', 0, 0, 0, 0};
+    const fb::DocumentView view{data, sizeof(data)};
+    UEXPECT_THROW(view.ForEach([](const fb::ElementView&) {}), fb::ParseException);
+}
+
+USERVER_NAMESPACE_END
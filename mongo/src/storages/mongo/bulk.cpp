@@ -2,6 +2,7 @@
 
 #include <mongoc/mongoc.h>
 
+#include <userver/storages/mongo/exception.hpp>
 #include <userver/storages/mongo/mongo_error.hpp>
 
 #include <storages/mongo/bulk_ops_impl.hpp>
@@ -21,6 +22,21 @@ auto EnsureBulk(impl::cdriver::BulkOperationPtr& bulk_ptr, Bulk::Mode mode) {
     return bulk_ptr.get();
 }
 
+template <typename SubOperation>
+bool AppendToChunk(
+    const std::optional<options::BulkChunks>& chunks_options,
+    std::vector<std::vector<BulkSubOperation>>& chunks,
+    const SubOperation& sub_operation
+) {
+    if (!chunks_options) return false;
+
+    if (chunks.empty() || chunks.back().size() >= chunks_options->Size()) {
+        chunks.emplace_back().reserve(chunks_options->Size());
+    }
+    chunks.back().emplace_back(sub_operation);
+    return true;
+}
+
 }  // namespace
 
 Bulk::Bulk(Mode mode) : impl_(mode) {}
@@ -29,23 +45,38 @@ Bulk::~Bulk() = default;
 Bulk::Bulk(Bulk&&) noexcept = default;
 Bulk& Bulk::operator=(Bulk&&) noexcept = default;
 
-bool Bulk::IsEmpty() const { return !impl_->bulk; }
+bool Bulk::IsEmpty() const { return !impl_->bulk && impl_->chunks.empty(); }
 
 void Bulk::SetOption(options::WriteConcern::Level level) {
-    mongoc_bulk_operation_set_write_concern(
-        EnsureBulk(impl_->bulk, impl_->mode), impl::MakeCDriverWriteConcern(level).get()
-    );
+    impl_->write_concern = impl::MakeCDriverWriteConcern(level);
+    if (impl_->chunks_options) return;
+    mongoc_bulk_operation_set_write_concern(EnsureBulk(impl_->bulk, impl_->mode), impl_->write_concern.get());
 }
 
 void Bulk::SetOption(const options::WriteConcern& write_concern) {
-    mongoc_bulk_operation_set_write_concern(
-        EnsureBulk(impl_->bulk, impl_->mode), impl::MakeCDriverWriteConcern(write_concern).get()
-    );
+    impl_->write_concern = impl::MakeCDriverWriteConcern(write_concern);
+    if (impl_->chunks_options) return;
+    mongoc_bulk_operation_set_write_concern(EnsureBulk(impl_->bulk, impl_->mode), impl_->write_concern.get());
 }
 
 void Bulk::SetOption(options::SuppressServerExceptions) { impl_->should_throw = false; }
 
+void Bulk::SetOption(const options::BulkChunks& chunks_options) {
+    if (impl_->has_sub_operations) {
+        throw InvalidQueryArgumentException("Bulk chunks must be set before appending the sub-operations");
+    }
+    if (chunks_options.Size() == 0 || chunks_options.MaxParallel() == 0 || chunks_options.MaxAttempts() == 0) {
+        throw InvalidQueryArgumentException("Bulk chunks options must be positive");
+    }
+    impl_->chunks_options = chunks_options;
+    // may only hold the write concern, which is applied to the chunks on execution
+    impl_->bulk.reset();
+}
+
 void Bulk::Append(const bulk_ops::InsertOne& insert_subop) {
+    impl_->has_sub_operations = true;
+    if (AppendToChunk(impl_->chunks_options, impl_->chunks, insert_subop)) return;
+
     MongoError error;
     const bson_t* native_bson_ptr = insert_subop.impl_->document.GetBson().get();
     if (!mongoc_bulk_operation_insert_with_opts(
@@ -56,6 +87,9 @@ void Bulk::Append(const bulk_ops::InsertOne& insert_subop) {
 }
 
 void Bulk::Append(const bulk_ops::ReplaceOne& replace_subop) {
+    impl_->has_sub_operations = true;
+    if (AppendToChunk(impl_->chunks_options, impl_->chunks, replace_subop)) return;
+
     MongoError error;
     const bson_t* native_selector_bson_ptr = replace_subop.impl_->selector.GetBson().get();
     const bson_t* native_replacement_bson_ptr = replace_subop.impl_->replacement.GetBson().get();
@@ -71,6 +105,9 @@ void Bulk::Append(const bulk_ops::ReplaceOne& replace_subop) {
 }
 
 void Bulk::Append(const bulk_ops::Update& update_subop) {
+    impl_->has_sub_operations = true;
+    if (AppendToChunk(impl_->chunks_options, impl_->chunks, update_subop)) return;
+
     MongoError error;
     const bson_t* native_selector_bson_ptr = update_subop.impl_->selector.GetBson().get();
     const bson_t* native_update_bson_ptr = update_subop.impl_->update.GetBson().get();
@@ -100,6 +137,9 @@ void Bulk::Append(const bulk_ops::Update& update_subop) {
 }
 
 void Bulk::Append(const bulk_ops::Delete& delete_subop) {
+    impl_->has_sub_operations = true;
+    if (AppendToChunk(impl_->chunks_options, impl_->chunks, delete_subop)) return;
+
     MongoError error;
     const bson_t* native_selector_bson_ptr = delete_subop.impl_->selector.GetBson().get();
     bool has_succeeded = false;
@@ -265,4 +265,60 @@ UTEST_F(Bulk, Mixed) {
     EXPECT_TRUE(upserted_ids[5].IsOid());
 }
 
+UTEST_F(Bulk, UnorderedChunks) {
+    auto coll = GetDefaultPool().GetCollection("unordered_chunks");
+
+    auto bulk = coll.MakeUnorderedBulk(mongo::options::BulkChunks{3}, mongo::options::SuppressServerExceptions{});
+    for (int i = 0; i < 10; ++i) bulk.InsertOne(bson::MakeDoc("_id", i));
+    bulk.InsertOne(bson::MakeDoc("_id", 4));
+    bulk.UpdateOne(bson::MakeDoc("_id", 100), bson::MakeDoc("$set", bson::MakeDoc("x", 1)), mongo::options::Upsert{});
+    EXPECT_FALSE(bulk.IsEmpty());
+    auto result = coll.Execute(std::move(bulk));
+
+    EXPECT_EQ(10, result.InsertedCount());
+    EXPECT_EQ(1, result.UpsertedCount());
+    EXPECT_EQ(11, coll.Count({}));
+
+    // the indices are of the whole bulk
+    auto upserted_ids = result.UpsertedIds();
+    EXPECT_EQ(1, upserted_ids.size());
+    EXPECT_EQ(100, upserted_ids[11].As<int>());
+
+    auto errors = result.ServerErrors();
+    ASSERT_EQ(1, errors.size());
+    EXPECT_TRUE(errors[10].IsServerError());
+}
+
+UTEST_F(Bulk, OrderedChunks) {
+    auto coll = GetDefaultPool().GetCollection("ordered_chunks");
+
+    {
+        auto bulk = coll.MakeOrderedBulk(mongo::options::BulkChunks{2}, mongo::options::SuppressServerExceptions{});
+        bulk.InsertOne(bson::MakeDoc("_id", 1));
+        bulk.InsertOne(bson::MakeDoc("_id", 2));
+        bulk.InsertOne(bson::MakeDoc("_id", 1));
+        bulk.InsertOne(bson::MakeDoc("_id", 3));
+        bulk.InsertOne(bson::MakeDoc("_id", 4));
+        auto result = coll.Execute(std::move(bulk));
+
+        // the chunks after the failed one are not executed
+        EXPECT_EQ(2, result.InsertedCount());
+        auto errors = result.ServerErrors();
+        ASSERT_EQ(1, errors.size());
+        EXPECT_EQ(1, errors.count(2));
+        EXPECT_EQ(2, coll.Count({}));
+    }
+    {
+        auto bulk = coll.MakeOrderedBulk(mongo::options::BulkChunks{2});
+        bulk.InsertOne(bson::MakeDoc("_id", 5));
+        bulk.InsertOne(bson::MakeDoc("_id", 1));
+        UEXPECT_THROW(coll.Execute(std::move(bulk)), mongo::DuplicateKeyException);
+    }
+    {
+        auto bulk = coll.MakeOrderedBulk();
+        bulk.InsertOne(bson::MakeDoc("_id", 6));
+        UEXPECT_THROW(bulk.SetOption(mongo::options::BulkChunks{2}), mongo::InvalidQueryArgumentException);
+    }
+}
+
 USERVER_NAMESPACE_END
@@ -21,6 +21,7 @@
 #include <userver/engine/async.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/io/exception.hpp>
+#include <userver/engine/io/happy_eyeballs.hpp>
 #include <userver/engine/io/poller.hpp>
 #include <userver/engine/io/sockaddr.hpp>
 #include <userver/engine/io/socket.hpp>
@@ -184,22 +185,19 @@ engine::io::Socket DoConnectTcpByName(
     const auto deadline = DeadlineFromTimeoutMs(timeout_ms);
     try {
         auto addrs = dns_resolver ? dns_resolver->Resolve(host.host, deadline) : GetaddrInfo(host, error);
-        for (auto&& current_addr : addrs) {
-            try {
-                engine::TaskCancellationBlocker block_cancel;
-                current_addr.SetPort(host.port);
-                engine::io::Socket socket{current_addr.Domain(), engine::io::SocketType::kStream};
-                socket.SetOption(IPPROTO_TCP, TCP_NODELAY, 1);
-                socket.Connect(current_addr, deadline);
-                ReportTcpConnectSuccess(host.host_and_port);
-                return socket;
-            } catch (const engine::io::IoCancelled& ex) {
-                ReportTcpConnectError(host.host_and_port);
-                bson_set_error(error, MONGOC_ERROR_STREAM, MONGOC_ERROR_STREAM_CONNECT, "%s", ex.what());
-                return {};
-            } catch (const engine::io::IoException& ex) {
-                LOG_DEBUG() << "Cannot connect to " << host.host << " at " << current_addr << ": " << ex;
-            }
+        for (auto& addr : addrs) addr.SetPort(host.port);
+        try {
+            engine::TaskCancellationBlocker block_cancel;
+            auto socket = engine::io::ConnectHappyEyeballs(addrs, deadline);
+            socket.SetOption(IPPROTO_TCP, TCP_NODELAY, 1);
+            ReportTcpConnectSuccess(host.host_and_port);
+            return socket;
+        } catch (const engine::io::IoCancelled& ex) {
+            ReportTcpConnectError(host.host_and_port);
+            bson_set_error(error, MONGOC_ERROR_STREAM, MONGOC_ERROR_STREAM_CONNECT, "%s", ex.what());
+            return {};
+        } catch (const engine::io::IoException& ex) {
+            LOG_DEBUG() << "Cannot connect to " << host.host << ": " << ex;
         }
     } catch (const clients::dns::ResolverException& ex) {
         LOG_LIMITED_ERROR() << "Cannot resolve " << host.host << ": " << ex;
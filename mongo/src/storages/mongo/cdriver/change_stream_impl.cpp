@@ -0,0 +1,60 @@
+#include <storages/mongo/cdriver/change_stream_impl.hpp>
+
+#include <bson/bson.h>
+#include <mongoc/mongoc.h>
+
+#include <userver/storages/mongo/mongo_error.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <formats/bson/wrappers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo::impl::cdriver {
+
+CDriverChangeStreamImpl::CDriverChangeStreamImpl(
+    cdriver::CDriverPoolImpl::BoundClientPtr client,
+    cdriver::ChangeStreamPtr stream,
+    std::shared_ptr<stats::OperationStatisticsItem> watch_stats
+)
+    : client_(std::move(client)), stream_(std::move(stream)), watch_stats_(std::move(watch_stats)) {
+    UASSERT(client_ && stream_);
+
+    // The initial aggregate is run on creation
+    MongoError error;
+    if (mongoc_change_stream_error_document(stream_.get(), error.GetNative(), nullptr)) {
+        error.Throw("Error opening change stream");
+    }
+}
+
+std::optional<formats::bson::Document> CDriverChangeStreamImpl::Next() {
+    const auto before_stats = client_.GetEventStatsSnapshot();
+    stats::OperationStopwatch next_sw(watch_stats_, "watch");
+
+    const bson_t* event_bson = nullptr;
+    const bool has_event = mongoc_change_stream_next(stream_.get(), &event_bson);
+
+    MongoError error;
+    if (!has_event && mongoc_change_stream_error_document(stream_.get(), error.GetNative(), nullptr)) {
+        next_sw.AccountError(error.GetKind());
+        error.Throw("Error reading change stream");
+    }
+    if (before_stats == client_.GetEventStatsSnapshot()) {
+        next_sw.Discard();
+    } else {
+        next_sw.AccountSuccess();
+    }
+
+    if (!has_event) return std::nullopt;
+    return formats::bson::Document(formats::bson::impl::MutableBson::CopyNative(event_bson).Extract());
+}
+
+std::optional<formats::bson::Document> CDriverChangeStreamImpl::GetResumeToken() const {
+    const bson_t* token_bson = mongoc_change_stream_get_resume_token(stream_.get());
+    if (!token_bson) return std::nullopt;
+    return formats::bson::Document(formats::bson::impl::MutableBson::CopyNative(token_bson).Extract());
+}
+
+}  // namespace storages::mongo::impl::cdriver
+
+USERVER_NAMESPACE_END
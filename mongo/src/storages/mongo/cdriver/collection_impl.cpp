@@ -1,20 +1,30 @@
 #include <storages/mongo/cdriver/collection_impl.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <variant>
+#include <vector>
+
 #include <bson/bson.h>
 #include <mongoc/mongoc.h>
 
 #include <userver/formats/bson/document.hpp>
 #include <userver/formats/bson/inline.hpp>
+#include <userver/formats/bson/value_builder.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/server/request/task_inherited_data.hpp>
 #include <userver/storages/mongo/exception.hpp>
 #include <userver/storages/mongo/mongo_error.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tags.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/impl/userver_experiments.hpp>
 #include <userver/utils/text.hpp>
 
 #include <formats/bson/wrappers.hpp>
+#include <storages/mongo/cdriver/change_stream_impl.hpp>
 #include <storages/mongo/cdriver/cursor_impl.hpp>
 #include <storages/mongo/cdriver/pool_impl.hpp>
 #include <storages/mongo/cdriver/wrappers.hpp>
@@ -34,12 +44,64 @@ class WriteResultHelper {
 public:
     bson_t* GetNative() { return bson_.Get(); }
 
-    WriteResult Extract() { return WriteResult(formats::bson::Document(bson_.Extract())); }
+    WriteResult Extract() { return WriteResult(ExtractDocument()); }
+
+    formats::bson::Document ExtractDocument() { return formats::bson::Document(bson_.Extract()); }
 
 private:
     formats::bson::impl::UninitializedBson bson_;
 };
 
+// Merges the bulk write results of the chunks, `offsets` are the indices of
+// the first sub-operations of the chunks in the whole bulk
+formats::bson::Document MergeChunkResults(
+    const std::vector<std::optional<formats::bson::Document>>& results,
+    const std::vector<size_t>& offsets
+) {
+    static const std::vector<std::string> kCounters{"nInserted", "nMatched", "nModified", "nRemoved", "nUpserted"};
+
+    formats::bson::ValueBuilder merged{formats::common::Type::kObject};
+    for (const auto& counter : kCounters) {
+        int64_t sum = 0;
+        for (const auto& result : results) {
+            if (result) sum += (*result)[counter].As<int64_t>(0);
+        }
+        merged[counter] = sum;
+    }
+
+    formats::bson::ValueBuilder upserted{formats::common::Type::kArray};
+    formats::bson::ValueBuilder write_errors{formats::common::Type::kArray};
+    formats::bson::ValueBuilder write_concern_errors{formats::common::Type::kArray};
+    for (size_t i = 0; i < results.size(); ++i) {
+        if (!results[i]) continue;
+        const auto& result = *results[i];
+        const auto for_each_item = [&result](const std::string& field, const auto& func) {
+            const auto items = result[field];
+            if (items.IsMissing()) return;
+            for (const auto& item : items) func(item);
+        };
+
+        const auto shift_index = [offset = offsets[i]](const formats::bson::Value& item) {
+            formats::bson::ValueBuilder shifted{item};
+            shifted["index"] = static_cast<int64_t>(offset + item["index"].As<size_t>());
+            return shifted;
+        };
+        for_each_item("upserted", [&](const auto& item) { upserted.PushBack(shift_index(item)); });
+        for_each_item("writeErrors", [&](const auto& item) { write_errors.PushBack(shift_index(item)); });
+        for_each_item("writeConcernErrors", [&](const auto& item) { write_concern_errors.PushBack(item); });
+    }
+    merged["upserted"] = std::move(upserted);
+    merged["writeErrors"] = std::move(write_errors);
+    merged["writeConcernErrors"] = std::move(write_concern_errors);
+
+    return merged.ExtractValue();
+}
+
+bool HasWriteErrors(const formats::bson::Document& result) {
+    const auto write_errors = result["writeErrors"];
+    return !write_errors.IsMissing() && !write_errors.IsEmpty();
+}
+
 std::optional<std::string> GetCurrentSpanLink() {
     auto* span = tracing::Span::CurrentSpanUnchecked();
     if (span) return span->GetLink();
@@ -502,6 +564,7 @@ WriteResult CDriverCollectionImpl::Execute(const operations::FindAndRemove& oper
 
 WriteResult CDriverCollectionImpl::Execute(operations::Bulk&& operation) {
     if (operation.IsEmpty()) return {};
+    if (operation.impl_->chunks_options) return ExecuteChunks(operation);
 
     auto context = MakeRequestContext("mongo_bulk", operation);
 
@@ -525,6 +588,91 @@ WriteResult CDriverCollectionImpl::Execute(operations::Bulk&& operation) {
     return write_result.Extract();
 }
 
+WriteResult CDriverCollectionImpl::ExecuteChunks(const operations::Bulk& operation) {
+    const auto& chunks = operation.impl_->chunks;
+    const auto& chunks_options = *operation.impl_->chunks_options;
+
+    std::vector<size_t> offsets;
+    offsets.reserve(chunks.size());
+    size_t offset = 0;
+    for (const auto& chunk : chunks) {
+        offsets.push_back(offset);
+        offset += chunk.size();
+    }
+
+    std::vector<std::optional<formats::bson::Document>> results(chunks.size());
+    if (operation.impl_->mode == operations::Bulk::Mode::kOrdered) {
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            results[i] = ExecuteChunk(operation, i);
+            // an ordered bulk stops at the first error
+            if (HasWriteErrors(*results[i])) break;
+        }
+        return WriteResult(MergeChunkResults(results, offsets));
+    }
+
+    std::atomic<size_t> next_chunk{0};
+    std::vector<std::exception_ptr> errors(chunks.size());
+    std::vector<engine::TaskWithResult<void>> workers;
+    const auto workers_count = std::min(chunks_options.MaxParallel(), chunks.size());
+    workers.reserve(workers_count);
+    for (size_t i = 0; i < workers_count; ++i) {
+        workers.push_back(utils::Async("mongo_bulk_chunks", [&] {
+            for (auto chunk_ind = next_chunk++; chunk_ind < chunks.size(); chunk_ind = next_chunk++) {
+                try {
+                    results[chunk_ind] = ExecuteChunk(operation, chunk_ind);
+                } catch (const std::exception&) {
+                    errors[chunk_ind] = std::current_exception();
+                }
+            }
+        }));
+    }
+    for (auto& worker : workers) worker.Get();
+
+    // an unordered bulk reports the errors after all the chunks are executed
+    for (const auto& error : errors) {
+        if (error) std::rethrow_exception(error);
+    }
+    return WriteResult(MergeChunkResults(results, offsets));
+}
+
+formats::bson::Document CDriverCollectionImpl::ExecuteChunk(const operations::Bulk& operation, size_t chunk_ind) {
+    const auto& bulk_impl = *operation.impl_;
+    for (size_t attempt = 1;; ++attempt) {
+        operations::Bulk chunk(bulk_impl.mode);
+        for (const auto& sub_operation : bulk_impl.chunks[chunk_ind]) {
+            std::visit([&chunk](const auto& op) { chunk.Append(op); }, sub_operation);
+        }
+        UASSERT(chunk.impl_->bulk);
+        if (bulk_impl.write_concern) {
+            mongoc_bulk_operation_set_write_concern(chunk.impl_->bulk.get(), bulk_impl.write_concern.get());
+        }
+
+        auto context = MakeRequestContext("mongo_bulk", operation);
+        mongoc_bulk_operation_set_database(chunk.impl_->bulk.get(), GetDatabaseName().c_str());
+        mongoc_bulk_operation_set_collection(chunk.impl_->bulk.get(), GetCollectionName().c_str());
+        mongoc_bulk_operation_set_client(chunk.impl_->bulk.get(), context.client.get());
+
+        MongoError error;
+        WriteResultHelper write_result;
+        stats::OperationStopwatch stopwatch(std::move(context.stats));
+        if (mongoc_bulk_operation_execute(chunk.impl_->bulk.get(), write_result.GetNative(), error.GetNative())) {
+            stopwatch.AccountSuccess();
+            return write_result.ExtractDocument();
+        }
+
+        stopwatch.AccountError(error.GetKind());
+        if (!error.IsServerError() && attempt < bulk_impl.chunks_options->MaxAttempts()) {
+            LOG_WARNING() << "Retrying bulk chunk " << chunk_ind << " of collection " << GetCollectionName()
+                          << " after error: " << error.Message();
+            continue;
+        }
+        if (bulk_impl.should_throw || !error.IsServerError()) {
+            error.Throw("Error running bulk operation");
+        }
+        return write_result.ExtractDocument();
+    }
+}
+
 Cursor CDriverCollectionImpl::Execute(const operations::Aggregate& operation) {
     auto context = MakeRequestContext("mongo_aggregate", operation);
 
@@ -547,6 +695,18 @@ Cursor CDriverCollectionImpl::Execute(const operations::Aggregate& operation) {
     ));
 }
 
+ChangeStream CDriverCollectionImpl::Execute(const operations::Watch& operation) const {
+    auto context = MakeRequestContext("mongo_watch", operation);
+
+    auto pipeline_doc = operation.impl_->pipeline.GetInternalArrayDocument();
+    impl::cdriver::ChangeStreamPtr cdriver_stream(mongoc_collection_watch(
+        context.collection.get(), pipeline_doc.GetBson().get(), impl::GetNative(operation.impl_->options)
+    ));
+    return ChangeStream(std::make_unique<impl::cdriver::CDriverChangeStreamImpl>(
+        std::move(context.client), std::move(cdriver_stream), std::move(context.stats)
+    ));
+}
+
 void CDriverCollectionImpl::Execute(const operations::Drop& operation) {
     auto context = MakeRequestContext("mongo_drop", operation);
 
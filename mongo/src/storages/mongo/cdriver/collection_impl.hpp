@@ -8,6 +8,7 @@
 #include <storages/mongo/collection_impl.hpp>
 #include <storages/mongo/stats.hpp>
 #include <userver/dynamic_config/snapshot.hpp>
+#include <userver/formats/bson/document.hpp>
 #include <userver/tracing/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -39,6 +40,7 @@ public:
     WriteResult Execute(const operations::FindAndRemove&) override;
     WriteResult Execute(operations::Bulk&&) override;
     Cursor Execute(const operations::Aggregate&) override;
+    ChangeStream Execute(const operations::Watch&) const override;
     void Execute(const operations::Drop&) override;
 
 private:
@@ -49,6 +51,9 @@ private:
     template <typename Operation>
     RequestContext MakeRequestContext(std::string&& span_name, const Operation& operation) const;
 
+    WriteResult ExecuteChunks(const operations::Bulk&);
+    formats::bson::Document ExecuteChunk(const operations::Bulk&, size_t chunk_ind);
+
     PoolImplPtr pool_impl_;
     std::shared_ptr<stats::CollectionStatistics> statistics_;
 };
@@ -51,15 +51,43 @@ void CDriverCursorImpl::Next() {
         return;
     }
 
+    const auto* current_bson = FetchNext();
+    if (current_bson) {
+        current_ = formats::bson::Document(formats::bson::impl::MutableBson::CopyNative(current_bson).Extract());
+    }
+    ReleaseIfExhausted();
+}
+
+void CDriverCursorImpl::ForEachView(utils::function_ref<void(const formats::bson::DocumentView&)> func) {
+    if (!IsValid()) return;
+
+    // the primed document is already copied
+    if (current_) {
+        const auto current = *std::move(current_);
+        current_ = std::nullopt;
+        func(formats::bson::DocumentView{current});
+    }
+
+    // the documents are read straight from the reply buffer of the cursor,
+    // each of them is only valid until the next mongoc_cursor_next
+    while (HasMore()) {
+        const auto* current_bson = FetchNext();
+        if (current_bson) func(formats::bson::DocumentView{*current_bson});
+        ReleaseIfExhausted();
+    }
+}
+
+const bson_t* CDriverCursorImpl::FetchNext() {
     UASSERT(client_ && cursor_);
     const auto before_stats = client_.GetEventStatsSnapshot();
     stats::OperationStopwatch cursor_next_sw(find_stats_, "find");
 
     const bson_t* current_bson = nullptr;
+    bool has_document = false;
     MongoError error;
     while (!mongoc_cursor_error(cursor_.get(), error.GetNative()) && HasMore()) {
         if (mongoc_cursor_next(cursor_.get(), &current_bson)) {
-            current_ = formats::bson::Document(formats::bson::impl::MutableBson::CopyNative(current_bson).Extract());
+            has_document = true;
             break;
         }
     }
@@ -70,13 +98,18 @@ void CDriverCursorImpl::Next() {
     } else {
         cursor_next_sw.AccountError(error.GetKind());
     }
+    if (error) {
+        ReleaseIfExhausted();
+        error.Throw("Error iterating over query results");
+    }
+    return has_document ? current_bson : nullptr;
+}
+
+void CDriverCursorImpl::ReleaseIfExhausted() {
     if (!HasMore()) {
         cursor_.reset();
         client_.reset();
     }
-    if (error) {
-        error.Throw("Error iterating over query results");
-    }
 }
 
 }  // namespace storages::mongo::impl::cdriver
@@ -29,7 +29,13 @@ public:
     const formats::bson::Document& Current() const override;
     void Next() override;
 
+    void ForEachView(utils::function_ref<void(const formats::bson::DocumentView&)> func) override;
+
 private:
+    // Returns the next document owned by the cursor, or nullptr if there is none
+    const bson_t* FetchNext();
+    void ReleaseIfExhausted();
+
     std::optional<formats::bson::Document> current_;
     cdriver::CDriverPoolImpl::BoundClientPtr client_;
     cdriver::CursorPtr cursor_;
@@ -35,6 +35,8 @@ WriteResult Collection::Execute(operations::Bulk&& bulk_op) { return impl_->Exec
 
 Cursor Collection::Execute(const operations::Aggregate& aggregate_op) { return impl_->Execute(aggregate_op); }
 
+ChangeStream Collection::Execute(const operations::Watch& watch_op) const { return impl_->Execute(watch_op); }
+
 void Collection::Execute(const operations::Drop& drop_op) { return impl_->Execute(drop_op); }
 
 }  // namespace storages::mongo
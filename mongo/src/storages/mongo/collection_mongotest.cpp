@@ -554,6 +554,25 @@ UTEST_F(Collection, LargeDocRoundtrip) {
     EXPECT_EQ(large_string, (*result)["s"].As<std::string>());
 }
 
+UTEST_F(Collection, ForEachView) {
+    auto coll = GetDefaultPool().GetCollection("for_each_view");
+
+    constexpr int kDocuments = 10;
+    for (int i = 0; i < kDocuments; ++i) coll.InsertOne(bson::MakeDoc("x", i));
+
+    auto cursor = coll.Find({}, mongo::options::Sort{{"x", mongo::options::Sort::kAscending}});
+    std::vector<int> values;
+    cursor.ForEachView([&values](const bson::DocumentView& view) {
+        view.ForEach([&values](const bson::ElementView& element) {
+            if (element.Key() == "x") values.push_back(element.AsInt32());
+        });
+    });
+    EXPECT_FALSE(cursor.HasMore());
+
+    ASSERT_EQ(values.size(), static_cast<std::size_t>(kDocuments));
+    for (int i = 0; i < kDocuments; ++i) EXPECT_EQ(values[i], i);
+}
+
 UTEST_F(Collection, ExecuteOps) {
     auto mongo_coll = GetDefaultPool().GetCollection("execute_ops");
 
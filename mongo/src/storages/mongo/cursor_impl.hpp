@@ -1,6 +1,8 @@
 #pragma once
 
 #include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/document_view.hpp>
+#include <userver/utils/function_ref.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -15,6 +17,8 @@ public:
 
     virtual const formats::bson::Document& Current() const = 0;
     virtual void Next() = 0;
+
+    virtual void ForEachView(utils::function_ref<void(const formats::bson::DocumentView&)> func) = 0;
 };
 
 }  // namespace storages::mongo::impl
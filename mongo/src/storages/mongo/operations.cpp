@@ -3,6 +3,7 @@
 #include <mongoc/mongoc.h>
 
 #include <userver/formats/bson/bson_builder.hpp>
+#include <userver/formats/bson/inline.hpp>
 #include <userver/formats/bson/value_builder.hpp>
 #include <userver/storages/mongo/exception.hpp>
 #include <userver/utils/assert.hpp>
@@ -553,6 +554,35 @@ void Aggregate::SetOption(const options::MaxServerTime& max_server_time) {
     AppendMaxServerTime(impl_->max_server_time, max_server_time);
 }
 
+Watch::Watch() : impl_(formats::bson::MakeArray()) {}
+
+Watch::Watch(formats::bson::Value pipeline) : impl_(std::move(pipeline)) {
+    if (!impl_->pipeline.IsArray()) {
+        throw InvalidQueryArgumentException("Change stream pipeline is not an array");
+    }
+}
+
+Watch::~Watch() = default;
+
+Watch::Watch(const Watch& other) = default;
+Watch::Watch(Watch&&) noexcept = default;
+Watch& Watch::operator=(const Watch& rhs) = default;
+Watch& Watch::operator=(Watch&&) noexcept = default;
+
+void Watch::SetOption(options::ReadConcern level) { AppendReadConcern(impl::EnsureBuilder(impl_->options), level); }
+
+void Watch::SetOption(const options::ResumeAfter& resume_after) {
+    impl::EnsureBuilder(impl_->options).Append("resumeAfter", resume_after.Value());
+}
+
+void Watch::SetOption(options::FullDocumentLookup) {
+    impl::EnsureBuilder(impl_->options).Append("fullDocument", "updateLookup");
+}
+
+void Watch::SetOption(const options::MaxAwaitTime& max_await_time) {
+    impl::EnsureBuilder(impl_->options).Append("maxAwaitTimeMS", max_await_time.Value().count());
+}
+
 Drop::Drop() = default;
 Drop::~Drop() = default;
 
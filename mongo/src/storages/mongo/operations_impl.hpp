@@ -2,6 +2,7 @@
 
 #include <optional>
 #include <string>
+#include <variant>
 #include <vector>
 
 #include <userver/formats/bson/bson_builder.hpp>
@@ -136,11 +137,18 @@ public:
     std::chrono::milliseconds max_server_time{kNoMaxServerTime};
 };
 
+using BulkSubOperation = std::variant<bulk_ops::InsertOne, bulk_ops::ReplaceOne, bulk_ops::Update, bulk_ops::Delete>;
+
 class Bulk::Impl {
 public:
     explicit Impl(Mode mode_) : mode(mode_) {}
 
     impl::cdriver::BulkOperationPtr bulk;
+    // the bulks of the chunks are only created on execution
+    impl::cdriver::WriteConcernPtr write_concern;
+    std::optional<options::BulkChunks> chunks_options;
+    std::vector<std::vector<BulkSubOperation>> chunks;
+    bool has_sub_operations{false};
     stats::OperationKey op_key{stats::OpType::kBulk};
     Mode mode;
     bool should_throw{true};
@@ -158,6 +166,17 @@ public:
     std::chrono::milliseconds max_server_time{kNoMaxServerTime};
 };
 
+class Watch::Impl {
+public:
+    Impl() = default;
+
+    explicit Impl(formats::bson::Value pipeline_) : pipeline(std::move(pipeline_)) {}
+
+    formats::bson::Value pipeline;
+    stats::OperationKey op_key{stats::OpType::kWatch};
+    std::optional<formats::bson::impl::BsonBuilder> options;
+};
+
 class Drop::Impl {
 public:
     Impl() = default;
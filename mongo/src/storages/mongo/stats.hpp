@@ -73,6 +73,7 @@ enum class OpType {
     kCountApprox,
     kFind,
     kAggregate,
+    kWatch,
 
     kWriteMin,
     kInsertOne = kWriteMin,
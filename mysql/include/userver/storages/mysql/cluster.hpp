@@ -16,6 +16,7 @@
 #include <userver/storages/mysql/command_result_set.hpp>
 #include <userver/storages/mysql/cursor_result_set.hpp>
 #include <userver/storages/mysql/impl/bind_helper.hpp>
+#include <userver/storages/mysql/impl/io/bulk_chunks.hpp>
 #include <userver/storages/mysql/options.hpp>
 #include <userver/storages/mysql/query.hpp>
 #include <userver/storages/mysql/statement_result_set.hpp>
@@ -150,6 +151,32 @@ public:
         const Container& params
     ) const;
 
+    /// @brief Executes a statement on a host of host_type for the chunks of
+    /// params, each one in a bulk-manner, see ExecuteBulk.
+    ///
+    /// A single bulk execution of too many rows exceeds `max_allowed_packet`
+    /// of the server and fails. This method splits the rows into chunks of at
+    /// most `settings.max_chunk_rows` rows and `settings.max_chunk_bytes`
+    /// estimated bytes, and executes them one after another with the same
+    /// prepared statement. Each chunk is executed within the command_control
+    /// timeout.
+    ///
+    /// The chunks executed before a failure stay applied, use a transaction
+    /// if the rows must be inserted atomically.
+    ///
+    /// @note Requires MariaDB 10.2.6+ as a server
+    ///
+    /// @returns the sum of the affected rows of the chunks and the last insert
+    /// id of the first chunk
+    template <typename Container>
+    ExecutionResult ExecuteBulkChunked(
+        OptionalCommandControl command_control,
+        ClusterHostType host_type,
+        const Query& query,
+        const Container& params,
+        const BulkChunkSettings& settings = {}
+    ) const;
+
     // TODO : don't require Container to be const, so Convert can move
     // clang-format off
   /// @brief Executes a statement on a host of host_type with default deadline,
@@ -339,6 +366,50 @@ StatementResultSet Cluster::ExecuteBulk(
     return DoExecute(command_control, host_type, query.GetStatement(), params_binder, std::nullopt);
 }
 
+template <typename Container>
+ExecutionResult Cluster::ExecuteBulkChunked(
+    OptionalCommandControl command_control,
+    ClusterHostType host_type,
+    const Query& query,
+    const Container& params,
+    const BulkChunkSettings& settings
+) const {
+    UINVARIANT(settings.max_chunk_rows > 0, "max_chunk_rows of BulkChunkSettings must be positive");
+
+    ExecutionResult result{};
+    bool is_first_chunk = true;
+
+    auto chunk_begin = params.begin();
+    while (chunk_begin != params.end()) {
+        auto chunk_end = chunk_begin;
+        std::size_t chunk_rows = 0;
+        std::size_t chunk_bytes = 0;
+        while (chunk_end != params.end() && chunk_rows < settings.max_chunk_rows) {
+            const auto row_bytes = impl::io::EstimateRowSize(*chunk_end);
+            if (chunk_rows > 0 && chunk_bytes + row_bytes > settings.max_chunk_bytes) break;
+
+            chunk_bytes += row_bytes;
+            ++chunk_rows;
+            ++chunk_end;
+        }
+
+        const impl::io::ContainerChunk<Container> chunk{chunk_begin, chunk_end, chunk_rows};
+        auto params_binder = impl::BindHelper::BindContainerAsParams(chunk);
+        const auto chunk_result =
+            DoExecute(command_control, host_type, query.GetStatement(), params_binder, std::nullopt)
+                .AsExecutionResult();
+
+        result.rows_affected += chunk_result.rows_affected;
+        if (is_first_chunk) {
+            result.last_insert_id = chunk_result.last_insert_id;
+            is_first_chunk = false;
+        }
+        chunk_begin = chunk_end;
+    }
+
+    return result;
+}
+
 template <typename MapTo, typename Container>
 StatementResultSet Cluster::ExecuteBulkMapped(ClusterHostType host_type, const Query& query, const Container& params)
     const {
@@ -49,6 +49,8 @@ namespace storages::mysql {
 /// -------------------------|---------------------------------------------|---------------
 /// initial_pool_size        | initial connection pool size (per host)     | 5
 /// max_pool_size            | maximum connection pool size (per host)     | 10
+/// statements_cache_size    | maximum number of prepared statements kept per connection | 20
+/// warmup_statements_count  | number of the statements recently prepared by the connections of a host that the new connections prepare in advance, 0 to disable | 0
 ///
 // clang-format on
 class Component final : public components::ComponentBase {
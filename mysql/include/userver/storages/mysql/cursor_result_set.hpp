@@ -2,6 +2,8 @@
 
 /// @file userver/storages/mysql/cursor_result_set.hpp
 
+#include <vector>
+
 #include <userver/storages/mysql/statement_result_set.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -30,6 +32,15 @@ public:
     template <typename RowCallback>
     void ForEach(RowCallback&& row_callback, engine::Deadline deadline) &&;
 
+    /// @brief Fetches all the rows from cursor and executes batch_callback for
+    /// each fetched batch of rows, as `std::vector<T>&&`.
+    ///
+    /// Unlike ForEach, lets the callback process the rows of a batch at once,
+    /// e.g. insert them into a container in bulk. A batch has at most
+    /// `batch_size` rows that were passed to `storages::mysql::Cluster`.
+    template <typename BatchCallback>
+    void ForEachBatch(BatchCallback&& batch_callback, engine::Deadline deadline) &&;
+
 private:
     StatementResultSet result_set_;
 };
@@ -45,8 +56,22 @@ CursorResultSet<T>::CursorResultSet(CursorResultSet<T>&& other) noexcept = defau
 
 template <typename T>
 template <typename RowCallback>
-void CursorResultSet<T>::ForEach(
-    RowCallback&& row_callback,
+void CursorResultSet<T>::ForEach(RowCallback&& row_callback, engine::Deadline deadline) && {
+    std::move(*this).ForEachBatch(
+        [&row_callback](std::vector<T>&& rows) {
+            tracing::ScopeTime for_each{impl::tracing::kForEachScope};
+            for (auto&& row : rows) {
+                row_callback(std::move(row));
+            }
+        },
+        deadline
+    );
+}
+
+template <typename T>
+template <typename BatchCallback>
+void CursorResultSet<T>::ForEachBatch(
+    BatchCallback&& batch_callback,
     // TODO : think about separate deadline here
     [[maybe_unused]] engine::Deadline deadline
 ) && {
@@ -56,13 +81,14 @@ void CursorResultSet<T>::ForEach(
     auto extractor = impl::io::TypedExtractor<IntermediateStorage, T, RowTag>{};
 
     while (keep_going) {
-        tracing::ScopeTime fetch{impl::tracing::kFetchScope};
-        keep_going = result_set_.FetchResult(extractor);
+        {
+            tracing::ScopeTime fetch{impl::tracing::kFetchScope};
+            keep_going = result_set_.FetchResult(extractor);
+        }
 
-        fetch.Reset(impl::tracing::kForEachScope);
         IntermediateStorage data{extractor.ExtractData()};
-        for (auto&& row : data) {
-            row_callback(std::move(row));
+        if (!data.empty()) {
+            batch_callback(std::move(data));
         }
     }
 }
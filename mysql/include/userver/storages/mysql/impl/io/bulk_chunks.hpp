@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+#include <boost/pfr/core.hpp>
+
+#include <userver/utils/meta.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mysql::impl::io {
+
+// A part of a container, with the interface InsertBinder requires
+template <typename Container>
+class ContainerChunk final {
+public:
+    using value_type = typename Container::value_type;
+    using const_iterator = typename Container::const_iterator;
+
+    ContainerChunk(const_iterator begin, const_iterator end, std::size_t size)
+        : begin_{begin}, end_{end}, size_{size} {}
+
+    const_iterator begin() const { return begin_; }
+    const_iterator end() const { return end_; }
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+private:
+    const_iterator begin_;
+    const_iterator end_;
+    std::size_t size_;
+};
+
+// Bytes of the length prefix and of the indicator of a field in the bulk
+// execution packet
+inline constexpr std::size_t kBulkFieldOverhead = 10;
+
+template <typename T>
+std::size_t EstimateFieldSize(const T& field) {
+    if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+        return std::string_view{field}.size();
+    } else if constexpr (meta::kIsOptional<T>) {
+        return field.has_value() ? EstimateFieldSize(*field) : 0;
+    } else {
+        return sizeof(T);
+    }
+}
+
+template <typename Row>
+std::size_t EstimateRowSize(const Row& row) {
+    std::size_t size = 0;
+    boost::pfr::for_each_field(row, [&size](const auto& field) {
+        size += EstimateFieldSize(field) + kBulkFieldOverhead;
+    });
+    return size;
+}
+
+}  // namespace storages::mysql::impl::io
+
+USERVER_NAMESPACE_END
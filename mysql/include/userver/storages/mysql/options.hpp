@@ -3,6 +3,7 @@
 /// @file userver/storages/mysql/options.hpp
 
 #include <chrono>
+#include <cstddef>
 #include <optional>
 
 USERVER_NAMESPACE_BEGIN
@@ -34,6 +35,16 @@ struct CommandControl final {
 /// @brief storages::mysql::CommandControl that may not be set.
 using OptionalCommandControl = std::optional<CommandControl>;
 
+/// @brief Settings of storages::mysql::Cluster::ExecuteBulkChunked
+struct BulkChunkSettings final {
+    /// Maximum estimated size of the rows of a chunk. It should stay below the
+    /// `max_allowed_packet` of the server, which is 16MiB by default.
+    std::size_t max_chunk_bytes{8 * 1024 * 1024};
+
+    /// Maximum number of the rows of a chunk
+    std::size_t max_chunk_rows{10000};
+};
+
 }  // namespace storages::mysql
 
 USERVER_NAMESPACE_END
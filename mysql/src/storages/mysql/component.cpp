@@ -58,6 +58,16 @@ properties:
         type: integer
         description: maximum number of created connections
         defaultDescription: 10
+    statements_cache_size:
+        type: integer
+        description: maximum number of prepared statements kept per connection
+        defaultDescription: 20
+    warmup_statements_count:
+        type: integer
+        description: |
+            number of the statements recently prepared by the connections of a host
+            that the new connections prepare in advance, 0 to disable
+        defaultDescription: 0
 )");
 }
 
@@ -106,9 +106,10 @@ Connection::Connection(
     const settings::EndpointInfo& endpoint_info,
     const settings::AuthSettings& auth_settings,
     const settings::ConnectionSettings& connection_settings,
-    engine::Deadline deadline
+    engine::Deadline deadline,
+    HotStatements* hot_statements
 )
-    : socket_{-1, 0}, statements_cache_{*this, connection_settings.statements_cache_size} {
+    : socket_{-1, 0}, statements_cache_{*this, connection_settings.statements_cache_size, hot_statements} {
     { auto _ = mysql_local_scope.Use(); }
 
     InitSocket(resolver, endpoint_info, auth_settings, connection_settings, deadline);
@@ -117,6 +118,10 @@ Connection::Connection(
     const auto server_info = metadata::ServerInfo::Get(mysql_);
     LOG_INFO() << "MySQL connection initialized."
                << " Server type: " << server_info.server_type_str << " " << server_info.server_version.ToString();
+
+    if (hot_statements) {
+        WarmUpStatements(deadline);
+    }
 }
 
 Connection::~Connection() {
@@ -314,6 +319,17 @@ void Connection::Close(engine::Deadline deadline) noexcept {
     NativeInterface{socket_, deadline}.Close(&mysql_);
 }
 
+void Connection::WarmUpStatements(engine::Deadline deadline) {
+    // A statement that fails to prepare, e.g. for a dropped table, must not
+    // prevent the connection from being used
+    try {
+        auto guard = GetBrokenGuard();
+        guard.Execute([this, deadline] { statements_cache_.WarmUp(deadline); });
+    } catch (const std::exception& ex) {
+        LOG_WARNING() << "Failed to prepare the hot statements of the pool: " << ex;
+    }
+}
+
 Statement& Connection::PrepareStatement(
     const std::string& statement,
     engine::Deadline deadline,
@@ -32,14 +32,19 @@ namespace io {
 class ParamsBinderBase;
 }  // namespace io
 
+class HotStatements;
+
 class Connection final {
 public:
+    // If hot_statements are given, the connection prepares them on creation
+    // and adds the statements it prepares to them.
     Connection(
         clients::dns::Resolver& resolver,
         const settings::EndpointInfo& endpoint_info,
         const settings::AuthSettings& auth_settings,
         const settings::ConnectionSettings& connection_settings,
-        engine::Deadline deadline
+        engine::Deadline deadline,
+        HotStatements* hot_statements = nullptr
     );
     ~Connection();
 
@@ -92,6 +97,8 @@ private:
     );
     void Close(engine::Deadline deadline) noexcept;
 
+    void WarmUpStatements(engine::Deadline deadline);
+
     Statement&
     PrepareStatement(const std::string& statement, engine::Deadline deadline, std::optional<std::size_t> batch_size);
 
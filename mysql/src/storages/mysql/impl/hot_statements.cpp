@@ -0,0 +1,32 @@
+#include <storages/mysql/impl/hot_statements.hpp>
+
+#include <mutex>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mysql::impl {
+
+HotStatements::HotStatements(std::size_t capacity) : statements_{capacity} { UASSERT(capacity > 0); }
+
+HotStatements::~HotStatements() = default;
+
+void HotStatements::Add(const std::string& statement) {
+    const std::lock_guard lock{mutex_};
+    statements_.Put(statement);
+}
+
+std::vector<std::string> HotStatements::Get() const {
+    std::vector<std::string> result;
+
+    const std::lock_guard lock{mutex_};
+    result.reserve(statements_.GetSize());
+    statements_.VisitAll([&result](const std::string& statement) { result.push_back(statement); });
+
+    return result;
+}
+
+}  // namespace storages::mysql::impl
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,9 @@
 #include <storages/mysql/impl/statements_cache.hpp>
 
+#include <algorithm>
+
+#include <storages/mysql/impl/hot_statements.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::mysql::impl {
@@ -10,8 +14,8 @@ constexpr std::chrono::milliseconds kDefaultStatementDeleteTimeout{200};
 
 }
 
-StatementsCache::StatementsCache(Connection& connection, std::size_t capacity)
-    : connection_{connection}, cache_{capacity} {
+StatementsCache::StatementsCache(Connection& connection, std::size_t capacity, HotStatements* hot_statements)
+    : connection_{connection}, hot_statements_{hot_statements}, cache_{capacity} {
     UASSERT(capacity > 0);
 }
 
@@ -30,6 +34,26 @@ Statement& StatementsCache::PrepareStatement(const std::string& statement, engin
         return *statement_ptr;
     }
 
+    auto& prepared_statement = DoPrepareStatement(statement, deadline);
+    if (hot_statements_) {
+        hot_statements_->Add(statement);
+    }
+    return prepared_statement;
+}
+
+void StatementsCache::WarmUp(engine::Deadline deadline) {
+    if (!hot_statements_) {
+        return;
+    }
+
+    auto statements = hot_statements_->Get();
+    statements.resize(std::min(statements.size(), cache_.GetCapacity()));
+    for (const auto& statement : statements) {
+        DoPrepareStatement(statement, deadline);
+    }
+}
+
+Statement& StatementsCache::DoPrepareStatement(const std::string& statement, engine::Deadline deadline) {
     // key is not in cache, check if insertion will overflow and set destruction
     // deadline if it's the case
     if (cache_.GetSize() == cache_.GetCapacity()) {
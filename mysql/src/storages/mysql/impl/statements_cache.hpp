@@ -10,16 +10,23 @@ USERVER_NAMESPACE_BEGIN
 namespace storages::mysql::impl {
 
 class Connection;
+class HotStatements;
 
 class StatementsCache final {
 public:
-    StatementsCache(Connection& connection, std::size_t capacity);
+    StatementsCache(Connection& connection, std::size_t capacity, HotStatements* hot_statements);
     ~StatementsCache();
 
     Statement& PrepareStatement(const std::string& statement, engine::Deadline deadline);
 
+    // Prepares the hot statements of the pool, up to the cache capacity
+    void WarmUp(engine::Deadline deadline);
+
 private:
+    Statement& DoPrepareStatement(const std::string& statement, engine::Deadline deadline);
+
     Connection& connection_;
+    HotStatements* hot_statements_;
 
     cache::LruMap<std::string, Statement, utils::StrIcaseHash, utils::StrIcaseEqual> cache_;
 };
@@ -6,6 +6,7 @@
 #include <userver/utils/statistics/writer.hpp>
 
 #include <storages/mysql/impl/connection.hpp>
+#include <storages/mysql/impl/hot_statements.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -51,6 +52,10 @@ Pool::Pool(clients::dns::Resolver& resolver, const settings::PoolSettings& pool_
           ConnectionPoolBase<impl::Connection, Pool>{pool_settings.max_pool_size, kMaxSimultaneouslyConnectingClients},
       resolver_{resolver},
       settings_{pool_settings},
+      hot_statements_{
+          settings_.warmup_statements_count > 0
+              ? std::make_unique<impl::HotStatements>(settings_.warmup_statements_count)
+              : nullptr},
       monitor_{*this} {
     try {
         Init(settings_.initial_pool_size, kConnectionSetupTimeout);
@@ -63,7 +68,12 @@ Pool::Pool(clients::dns::Resolver& resolver, const settings::PoolSettings& pool_
 Pool::ConnectionUniquePtr Pool::DoCreateConnection(engine::Deadline deadline) {
     try {
         auto connection_ptr = std::make_unique<impl::Connection>(
-            resolver_, settings_.endpoint_info, settings_.auth_settings, settings_.connection_settings, deadline
+            resolver_,
+            settings_.endpoint_info,
+            settings_.auth_settings,
+            settings_.connection_settings,
+            deadline,
+            hot_statements_.get()
         );
         monitor_.AccountSuccess();
 
@@ -20,7 +20,8 @@ namespace storages::mysql {
 
 namespace impl {
 class Connection;
-}
+class HotStatements;
+}  // namespace impl
 
 namespace infra {
 
@@ -81,6 +82,9 @@ private:
 
     PoolConnectionStatistics stats_{};
 
+    // nullptr if the statements warm-up is disabled
+    const std::unique_ptr<impl::HotStatements> hot_statements_;
+
     PoolMonitor monitor_;
 };
 
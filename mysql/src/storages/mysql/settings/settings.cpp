@@ -67,6 +67,8 @@ PoolSettings PoolSettings::Create(
     PoolSettings settings{};
     settings.initial_pool_size = config["initial_pool_size"].As<std::size_t>(settings.initial_pool_size);
     settings.max_pool_size = config["max_pool_size"].As<std::size_t>(settings.max_pool_size);
+    settings.warmup_statements_count =
+        config["warmup_statements_count"].As<std::size_t>(settings.warmup_statements_count);
     settings.endpoint_info = endpoint_info;
     settings.auth_settings = auth_settings;
     settings.connection_settings = config.As<ConnectionSettings>();
@@ -44,6 +44,9 @@ struct EndpointInfo final {
 struct PoolSettings final {
     std::size_t initial_pool_size{5};
     std::size_t max_pool_size{10};
+    // number of the statements recently prepared by the connections of the
+    // pool that the new connections prepare in advance, 0 to disable
+    std::size_t warmup_statements_count{0};
 
     EndpointInfo endpoint_info;
     AuthSettings auth_settings;
@@ -54,6 +54,39 @@ UTEST(StreamedResult, Works) {
     ASSERT_EQ(select_as_vector.size(), rows_to_insert.size());
 }
 
+UTEST(StreamedResult, Batches) {
+    ClusterWrapper cluster{};
+
+    TmpTable table{cluster, "Id INT NOT NULL, Value TEXT NOT NULL"};
+
+    constexpr std::size_t kRowsCount = 10;
+    std::vector<Row> rows_to_insert;
+    rows_to_insert.reserve(kRowsCount);
+    for (std::size_t i = 0; i < kRowsCount; ++i) {
+        rows_to_insert.push_back({static_cast<std::int32_t>(i), utils::generators::GenerateUuid()});
+    }
+    cluster->ExecuteBulk(
+        ClusterHostType::kPrimary, table.FormatWithTableName("INSERT INTO {}(Id, Value) VALUES(?, ?)"), rows_to_insert
+    );
+
+    std::vector<Row> db_rows;
+    std::vector<std::size_t> batch_sizes;
+    cluster->GetCursor<Row>(kPrimaryHost, 3, table.FormatWithTableName("SELECT Id, Value FROM {} ORDER BY Id"))
+        .ForEachBatch(
+            [&](std::vector<Row>&& rows) {
+                batch_sizes.push_back(rows.size());
+                db_rows.insert(db_rows.end(), rows.begin(), rows.end());
+            },
+            cluster.GetDeadline()
+        );
+
+    EXPECT_EQ(db_rows, rows_to_insert);
+    EXPECT_GT(batch_sizes.size(), 1);
+    for (const auto batch_size : batch_sizes) {
+        EXPECT_LE(batch_size, 3);
+    }
+}
+
 UTEST(Cluster, InsertMany) {
     ClusterWrapper cluster{};
     TmpTable table{cluster, "Id INT NOT NULL, Value TEXT NOT NULL"};
@@ -76,6 +109,34 @@ UTEST(Cluster, InsertMany) {
     EXPECT_EQ(db_rows, rows_to_insert);
 }
 
+UTEST(Cluster, InsertManyChunked) {
+    ClusterWrapper cluster{};
+    TmpTable table{cluster, "Id INT NOT NULL, Value TEXT NOT NULL"};
+
+    constexpr int kRowsCount = 100;
+
+    std::vector<Row> rows_to_insert;
+    rows_to_insert.reserve(kRowsCount);
+    for (int i = 0; i < kRowsCount; ++i) {
+        rows_to_insert.push_back({i, utils::generators::GenerateUuid()});
+    }
+
+    BulkChunkSettings settings;
+    settings.max_chunk_rows = 30;
+    settings.max_chunk_bytes = 1000;
+    const auto result = cluster->ExecuteBulkChunked(
+        std::nullopt,
+        ClusterHostType::kPrimary,
+        table.FormatWithTableName("INSERT INTO {}(Id, Value) VALUES(?, ?)"),
+        rows_to_insert,
+        settings
+    );
+    EXPECT_EQ(result.rows_affected, kRowsCount);
+
+    const auto db_rows = table.DefaultExecute("SELECT Id, Value FROM {} ORDER BY Id").AsVector<Row>();
+    EXPECT_EQ(db_rows, rows_to_insert);
+}
+
 UTEST(Cluster, UpdateMany) {
     ClusterWrapper cluster{};
     TmpTable table{cluster, "Id INT PRIMARY KEY, Value TEXT NOT NULL"};
@@ -29,6 +29,9 @@ class Logger;
 /// endpoint | URI of otel collector (e.g. 127.0.0.1:4317) | -
 /// max-queue-size | Maximum async queue size | 65535
 /// max-batch-delay | Maximum batch delay | 100ms
+/// max-batch-size | Maximum count of logs and spans in a single batch | 512
+/// senders-count | Count of tasks that concurrently send the batches | 1
+/// overflow-behavior | What to do with a new record if the queue is full (discard\|discard-oldest\|block) | discard
 /// service-name | Service name | unknown_service
 /// attributes | Extra attributes for OTLP, object of key/value strings | -
 /// sinks | List of sinks | -
@@ -0,0 +1,68 @@
+#pragma once
+
+/// @file userver/otlp/metrics/component.hpp
+/// @brief @copybrief otlp::MetricsExporterComponent
+
+#include <memory>
+#include <string_view>
+
+#include <userver/components/component_base.hpp>
+#include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+class MetricsExporter;
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief Component that periodically pushes the metrics of
+/// components::StatisticsStorage to the OTLP collector.
+///
+/// Rate metrics are sent with delta temporality, so the collector receives
+/// only the increase since the previous export. Integer and floating-point
+/// metrics are sent as gauges, histograms are sent with cumulative temporality.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// endpoint | URI of otel collector (e.g. 127.0.0.1:4317) | -
+/// period | Period of metrics export | 10s
+/// max-batch-size | Maximum number of data points in a single export request | 1000
+/// service-name | Service name | unknown_service
+/// extra-attributes | Extra attributes for OTLP, object of key/value strings | -
+/// task-processor | Task processor to serialize and send the metrics on | the main task processor
+
+// clang-format on
+class MetricsExporterComponent final : public components::ComponentBase {
+public:
+    /// @ingroup userver_component_names
+    /// @brief The default name of otlp::MetricsExporterComponent
+    static constexpr std::string_view kName = "otlp-metrics-exporter";
+
+    MetricsExporterComponent(const components::ComponentConfig&, const components::ComponentContext&);
+
+    ~MetricsExporterComponent() override;
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    std::unique_ptr<MetricsExporter> exporter_;
+    utils::statistics::Entry statistics_holder_;
+    utils::PeriodicTask export_task_;
+};
+
+}  // namespace otlp
+
+namespace components {
+
+template <>
+inline constexpr bool kHasValidate<otlp::MetricsExporterComponent> = true;
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
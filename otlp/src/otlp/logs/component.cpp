@@ -39,6 +39,9 @@ LoggerComponent::LoggerComponent(const components::ComponentConfig& config, cons
     LoggerConfig logger_config;
     logger_config.max_queue_size = config["max-queue-size"].As<size_t>(65535);
     logger_config.max_batch_delay = config["max-batch-delay"].As<std::chrono::milliseconds>(100);
+    logger_config.max_batch_size = config["max-batch-size"].As<size_t>(logger_config.max_batch_size);
+    logger_config.senders_count = config["senders-count"].As<size_t>(logger_config.senders_count);
+    logger_config.overflow_behavior = config["overflow-behavior"].As<OverflowBehavior>(OverflowBehavior::kDiscard);
     logger_config.service_name = config["service-name"].As<std::string>("unknown_service");
     logger_config.log_level = config["log-level"].As<USERVER_NAMESPACE::logging::Level>();
     logger_config.extra_attributes = config["extra-attributes"].As<std::unordered_map<std::string, std::string>>({});
@@ -85,6 +88,7 @@ LoggerComponent::LoggerComponent(const components::ComponentConfig& config, cons
         statistics_holder_ =
             statistics_storage->GetStorage().RegisterWriter("logger", [this](utils::statistics::Writer& writer) {
                 writer.ValueWithLabels(logger_->GetStatistics(), {"logger", "default"});
+                writer["otlp"].ValueWithLabels(logger_->GetExportStatistics(), {"logger", "default"});
             });
     }
 }
@@ -119,6 +123,28 @@ properties:
     max-batch-delay:
         type: string
         description: max delay between send batches (e.g. 100ms or 1s)
+    max-batch-size:
+        type: integer
+        description: max count of logs and spans sent in a single batch
+        defaultDescription: 512
+        minimum: 1
+    senders-count:
+        type: integer
+        description: count of tasks that concurrently send the batches
+        defaultDescription: 1
+        minimum: 1
+    overflow-behavior:
+        type: string
+        description: >
+            what to do with a new record if the queue is full: 'discard' drops
+            the new record, 'discard-oldest' drops a queued record to make
+            room for the new one, 'block' waits for the free space in the
+            queue (records from non-coroutine threads are discarded instead)
+        defaultDescription: discard
+        enum:
+          - discard
+          - discard-oldest
+          - block
     service-name:
         type: string
         description: service name
@@ -3,6 +3,7 @@
 #include <chrono>
 
 #include <userver/engine/async.hpp>
+#include <userver/engine/task/current_task.hpp>
 #include <userver/formats/parse/common_containers.hpp>
 #include <userver/formats/parse/to.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
@@ -147,6 +148,27 @@ SinkType Parse(const yaml_config::YamlConfig& value, formats::parse::To<SinkType
     throw std::runtime_error("OTLP logger: unknown sink type:" + destination);
 }
 
+OverflowBehavior Parse(const yaml_config::YamlConfig& value, formats::parse::To<OverflowBehavior>) {
+    auto behavior = value.As<std::string>("discard");
+    if (behavior == "discard") {
+        return OverflowBehavior::kDiscard;
+    }
+    if (behavior == "discard-oldest") {
+        return OverflowBehavior::kDiscardOldest;
+    }
+    if (behavior == "block") {
+        return OverflowBehavior::kBlock;
+    }
+    throw std::runtime_error("OTLP logger: unknown overflow behavior:" + behavior);
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const ExportStatistics& stats) {
+    writer["exported"].ValueWithLabels(stats.exported_logs, {"kind", "logs"});
+    writer["exported"].ValueWithLabels(stats.exported_spans, {"kind", "spans"});
+    writer["export_errors"] = stats.export_errors;
+    writer["dropped_oldest"] = stats.dropped_oldest;
+}
+
 Logger::Logger(
     opentelemetry::proto::collector::logs::v1::LogsServiceClient client,
     opentelemetry::proto::collector::trace::v1::TraceServiceClient trace_client,
@@ -155,27 +177,39 @@ Logger::Logger(
     : config_(std::move(config)),
       queue_(Queue::Create(config_.max_queue_size)),
       queue_producer_(queue_->GetMultiProducer()) {
+    UINVARIANT(config_.senders_count > 0, "OTLP logger: 'senders-count' must be positive");
+    UINVARIANT(config_.max_batch_size > 0, "OTLP logger: 'max-batch-size' must be positive");
     SetLevel(config_.log_level);
     std::cerr << "OTLP logger has started\n";
 
-    sender_task_ = engine::CriticalAsyncNoSpan([this,
-                                                consumer = queue_->GetConsumer(),
-                                                log_client = std::move(client),
-                                                trace_client = std::move(trace_client)]() mutable {
-        SendingLoop(consumer, log_client, trace_client);
-    });
-    ;
+    if (config_.overflow_behavior == OverflowBehavior::kDiscardOldest) {
+        overflow_consumer_.emplace(queue_->GetMultiConsumer());
+    }
+
+    // The generated clients are cheap to copy and share the channels of the factory
+    sender_tasks_.reserve(config_.senders_count);
+    for (std::size_t i = 0; i < config_.senders_count; ++i) {
+        sender_tasks_.push_back(engine::CriticalAsyncNoSpan(
+            [this, consumer = queue_->GetMultiConsumer(), log_client = client, trace_client]() mutable {
+                SendingLoop(consumer, log_client, trace_client);
+            }
+        ));
+    }
 }
 
 Logger::~Logger() { Stop(); }
 
 void Logger::Stop() noexcept {
-    sender_task_.SyncCancel();
-    sender_task_ = {};
+    for (auto& task : sender_tasks_) {
+        task.SyncCancel();
+    }
+    sender_tasks_.clear();
 }
 
 const logging::impl::LogStatistics& Logger::GetStatistics() const { return stats_; }
 
+const ExportStatistics& Logger::GetExportStatistics() const { return export_stats_; }
+
 void Logger::PrependCommonTags(logging::impl::TagWriter writer) const {
     logging::impl::default_::PrependCommonTags(writer);
 }
@@ -188,11 +222,7 @@ void Logger::Log(logging::Level level, logging::impl::formatters::LoggerItemRef
     auto& log = static_cast<Item&>(item);
 
     if (!log.otlp.valueless_by_exception()) {
-        bool ok = queue_producer_.PushNoblock(std::move(log.otlp));
-        if (!ok) {
-            // Drop a log/trace if overflown
-            ++stats_.dropped;
-        }
+        Push(std::move(log.otlp));
     }
 
     if (default_logger_ && log.forwarded_formatter) {
@@ -201,6 +231,37 @@ void Logger::Log(logging::Level level, logging::impl::formatters::LoggerItemRef
     }
 }
 
+void Logger::Push(Action&& action) {
+    switch (config_.overflow_behavior) {
+        case OverflowBehavior::kDiscard:
+            break;
+        case OverflowBehavior::kDiscardOldest:
+            if (queue_producer_.PushNoblock(std::move(action))) {
+                return;
+            }
+            // Make room for the fresh record, it is more valuable than the stale one
+            if (Action oldest{}; overflow_consumer_->PopNoblock(oldest)) {
+                ++stats_.dropped;
+                ++export_stats_.dropped_oldest;
+            }
+            break;
+        case OverflowBehavior::kBlock:
+            // Threads outside of the coroutine engine can not wait on the queue
+            if (engine::current_task::IsTaskProcessorThread()) {
+                if (!queue_producer_.Push(std::move(action))) {
+                    ++stats_.dropped;
+                }
+                return;
+            }
+            break;
+    }
+
+    if (!queue_producer_.PushNoblock(std::move(action))) {
+        // Drop a log/trace if overflown
+        ++stats_.dropped;
+    }
+}
+
 logging::impl::formatters::BasePtr
 Logger::MakeFormatter(logging::Level level, logging::LogClass log_class, const utils::impl::SourceLocation& location) {
     auto sink = log_class == logging::LogClass::kLog ? config_.logs_sink : config_.tracing_sink;
@@ -226,7 +287,7 @@ void Logger::SetAttributeValue(
     );
 }
 
-void Logger::SendingLoop(Queue::Consumer& consumer, LogClient& log_client, TraceClient& trace_client) {
+void Logger::SendingLoop(Queue::MultiConsumer& consumer, LogClient& log_client, TraceClient& trace_client) {
     // Create dummy span to completely disable logging in current coroutine
     tracing::Span span("");
     span.SetLocalLogLevel(logging::Level::kNone);
@@ -247,27 +308,34 @@ void Logger::SendingLoop(Queue::Consumer& consumer, LogClient& log_client, Trace
         scope_spans->clear_spans();
 
         auto deadline = engine::Deadline::FromDuration(config_.max_batch_delay);
+        std::size_t batch_size = 0;
 
+        // Records are moved into the request: the messages share the default arena,
+        // so the move just swaps the internals without copying the strings.
         do {
             std::visit(
                 utils::Overloaded{
-                    [&scope_spans](const opentelemetry::proto::trace::v1::Span& action) {
-                        auto span = scope_spans->add_spans();
-                        *span = action;
+                    [&scope_spans](opentelemetry::proto::trace::v1::Span& action) {
+                        *scope_spans->add_spans() = std::move(action);
                     },
-                    [&scope_logs](const opentelemetry::proto::logs::v1::LogRecord& action) {
-                        auto log_records = scope_logs->add_log_records();
-                        *log_records = action;
+                    [&scope_logs](opentelemetry::proto::logs::v1::LogRecord& action) {
+                        *scope_logs->add_log_records() = std::move(action);
                     }},
                 action
             );
-        } while (consumer.Pop(action, deadline));
+        } while (++batch_size < config_.max_batch_size && consumer.Pop(action, deadline));
 
-        if (utils::UnderlyingValue(config_.logs_sink) & utils::UnderlyingValue(SinkType::kOtlp)) {
-            DoLog(log_request, log_client);
+        const auto logs_count = scope_logs->log_records_size();
+        if (logs_count && utils::UnderlyingValue(config_.logs_sink) & utils::UnderlyingValue(SinkType::kOtlp)) {
+            if (DoLog(log_request, log_client)) {
+                export_stats_.exported_logs.Add(utils::statistics::Rate{static_cast<std::uint64_t>(logs_count)});
+            }
         }
-        if (utils::UnderlyingValue(config_.tracing_sink) & utils::UnderlyingValue(SinkType::kOtlp)) {
-            DoTrace(trace_request, trace_client);
+        const auto spans_count = scope_spans->spans_size();
+        if (spans_count && utils::UnderlyingValue(config_.tracing_sink) & utils::UnderlyingValue(SinkType::kOtlp)) {
+            if (DoTrace(trace_request, trace_client)) {
+                export_stats_.exported_spans.Add(utils::statistics::Rate{static_cast<std::uint64_t>(spans_count)});
+            }
         }
     }
 }
@@ -298,34 +366,38 @@ void Logger::FillAttributes(::opentelemetry::proto::resource::v1::Resource& reso
     }
 }
 
-void Logger::DoLog(
+bool Logger::DoLog(
     const opentelemetry::proto::collector::logs::v1::ExportLogsServiceRequest& request,
     LogClient& client
 ) {
     try {
         auto response = client.Export(request);
+        return true;
     } catch (const ugrpc::client::RpcCancelledError&) {
         std::cerr << "Stopping OTLP sender task\n";
         throw;
     } catch (const std::exception& e) {
         std::cerr << "Failed to write down OTLP log(s): " << e.what() << typeid(e).name() << "\n";
     }
-    // TODO: count exceptions
+    ++export_stats_.export_errors;
+    return false;
 }
 
-void Logger::DoTrace(
+bool Logger::DoTrace(
     const opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest& request,
     TraceClient& trace_client
 ) {
     try {
         auto response = trace_client.Export(request);
+        return true;
     } catch (const ugrpc::client::RpcCancelledError&) {
         std::cerr << "Stopping OTLP sender task\n";
         throw;
     } catch (const std::exception& e) {
         std::cerr << "Failed to write down OTLP trace(s): " << e.what() << typeid(e).name() << "\n";
     }
-    // TODO: count exceptions
+    ++export_stats_.export_errors;
+    return false;
 }
 
 std::string_view Logger::MapAttribute(std::string_view attr) const {
@@ -2,7 +2,9 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <variant>
+#include <vector>
 
 #include <opentelemetry/proto/collector/logs/v1/logs_service_client.usrv.pb.hpp>
 #include <opentelemetry/proto/collector/trace/v1/trace_service_client.usrv.pb.hpp>
@@ -13,6 +15,8 @@
 #include <userver/logging/impl/log_stats.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/log_extra.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -27,9 +31,21 @@ enum class SinkType : std::uint8_t {
 
 SinkType Parse(const yaml_config::YamlConfig& value, formats::parse::To<SinkType>);
 
+/// What to do with a record when the queue is full
+enum class OverflowBehavior {
+    kDiscard,        ///< drop the new record
+    kDiscardOldest,  ///< drop a queued record to make room for the new one
+    kBlock,          ///< wait for the free space in the queue
+};
+
+OverflowBehavior Parse(const yaml_config::YamlConfig& value, formats::parse::To<OverflowBehavior>);
+
 struct LoggerConfig {
     size_t max_queue_size{10000};
     std::chrono::milliseconds max_batch_delay{};
+    size_t max_batch_size{512};
+    size_t senders_count{1};
+    OverflowBehavior overflow_behavior{OverflowBehavior::kDiscard};
     SinkType logs_sink{SinkType::kOtlp};
     SinkType tracing_sink{SinkType::kOtlp};
     std::string service_name;
@@ -46,6 +62,15 @@ struct Item final : logging::impl::formatters::LoggerItemBase {
     logging::impl::formatters::BasePtr forwarded_formatter;  // can be null
 };
 
+struct ExportStatistics final {
+    utils::statistics::RateCounter exported_logs;
+    utils::statistics::RateCounter exported_spans;
+    utils::statistics::RateCounter export_errors;
+    utils::statistics::RateCounter dropped_oldest;
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const ExportStatistics& stats);
+
 class Logger;
 
 class Formatter final : public logging::impl::formatters::Base {
@@ -85,6 +110,8 @@ public:
 
     const logging::impl::LogStatistics& GetStatistics() const;
 
+    const ExportStatistics& GetExportStatistics() const;
+
     void SetDefaultLogger(logging::LoggerPtr default_logger) { default_logger_ = default_logger; }
 
     std::string_view MapAttribute(std::string_view attr) const;
@@ -97,25 +124,30 @@ protected:
 
 private:
     using Action = std::variant<::opentelemetry::proto::logs::v1::LogRecord, ::opentelemetry::proto::trace::v1::Span>;
-    using Queue = concurrent::NonFifoMpscQueue<Action>;
+    using Queue = concurrent::NonFifoMpmcQueue<Action>;
+
+    void Push(Action&& action);
 
-    void SendingLoop(Queue::Consumer& consumer, LogClient& log_client, TraceClient& trace_client);
+    void SendingLoop(Queue::MultiConsumer& consumer, LogClient& log_client, TraceClient& trace_client);
 
     void FillAttributes(::opentelemetry::proto::resource::v1::Resource& resource);
 
-    void DoLog(const opentelemetry::proto::collector::logs::v1::ExportLogsServiceRequest& request, LogClient& client);
+    bool DoLog(const opentelemetry::proto::collector::logs::v1::ExportLogsServiceRequest& request, LogClient& client);
 
-    void DoTrace(
+    bool DoTrace(
         const opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest& request,
         TraceClient& trace_client
     );
 
     logging::impl::LogStatistics stats_;
+    ExportStatistics export_stats_;
     const LoggerConfig config_;
     std::shared_ptr<Queue> queue_;
     Queue::MultiProducer queue_producer_;
+    // Used by producers to drop the queued records with OverflowBehavior::kDiscardOldest
+    std::optional<Queue::MultiConsumer> overflow_consumer_;
     logging::LoggerPtr default_logger_{};
-    engine::Task sender_task_;  // Must be the last member
+    std::vector<engine::Task> sender_tasks_;  // Must be the last member
 };
 
 }  // namespace otlp
@@ -0,0 +1,97 @@
+#include <userver/otlp/metrics/component.hpp>
+
+#include <optional>
+#include <string>
+
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/ugrpc/client/client_factory_component.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include "exporter.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+MetricsExporterComponent::MetricsExporterComponent(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context
+)
+    : components::ComponentBase(config, context) {
+    auto& client_factory = context.FindComponent<ugrpc::client::ClientFactoryComponent>().GetFactory();
+    auto& storage = context.FindComponent<components::StatisticsStorage>().GetStorage();
+
+    auto client = client_factory.MakeClient<MetricsExporter::Client>(
+        "otlp-metrics-exporter", config["endpoint"].As<std::string>()
+    );
+
+    MetricsExporterConfig exporter_config;
+    exporter_config.max_batch_size = config["max-batch-size"].As<std::size_t>(1000);
+    exporter_config.service_name = config["service-name"].As<std::string>("unknown_service");
+    exporter_config.extra_attributes =
+        config["extra-attributes"].As<std::unordered_map<std::string, std::string>>({});
+
+    exporter_ = std::make_unique<MetricsExporter>(std::move(client), storage, std::move(exporter_config));
+
+    statistics_holder_ =
+        storage.RegisterWriter("otlp.metrics-exporter", [this](utils::statistics::Writer& writer) {
+            writer = exporter_->GetStatistics();
+        });
+
+    utils::PeriodicTask::Settings settings{config["period"].As<std::chrono::milliseconds>(std::chrono::seconds{10})};
+    const auto task_processor_name = config["task-processor"].As<std::optional<std::string>>();
+    if (task_processor_name) {
+        settings.task_processor = &context.GetTaskProcessor(*task_processor_name);
+    }
+    export_task_.Start("otlp-metrics-exporter", settings, [this] { exporter_->Export(); });
+}
+
+MetricsExporterComponent::~MetricsExporterComponent() {
+    export_task_.Stop();
+    statistics_holder_.Unregister();
+}
+
+yaml_config::Schema MetricsExporterComponent::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<components::ComponentBase>(R"(
+type: object
+description: >
+    OpenTelemetry metrics exporter component
+additionalProperties: false
+properties:
+    endpoint:
+        type: string
+        description: >
+            Hostname:port of otel collector (gRPC).
+    period:
+        type: string
+        description: period of metrics export (e.g. 10s)
+        defaultDescription: 10s
+    max-batch-size:
+        type: integer
+        description: max number of data points in a single export request
+        defaultDescription: 1000
+        minimum: 1
+    service-name:
+        type: string
+        description: service name
+        defaultDescription: unknown_service
+    task-processor:
+        type: string
+        description: task processor to serialize and send the metrics on
+        defaultDescription: the main task processor
+    extra-attributes:
+        type: object
+        description: extra OTLP attributes
+        properties: {}
+        additionalProperties:
+            type: string
+            description: attribute value
+)");
+}
+
+}  // namespace otlp
+
+USERVER_NAMESPACE_END
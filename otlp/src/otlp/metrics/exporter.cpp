@@ -0,0 +1,253 @@
+#include "exporter.hpp"
+
+#include <userver/logging/log.hpp>
+#include <userver/ugrpc/client/exceptions.hpp>
+#include <userver/utils/overloaded.hpp>
+#include <userver/utils/statistics/metric_value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+namespace {
+
+namespace metrics_v1 = ::opentelemetry::proto::metrics::v1;
+
+constexpr std::string_view kTelemetrySdkLanguage = "telemetry.sdk.language";
+constexpr std::string_view kTelemetrySdkName = "telemetry.sdk.name";
+constexpr std::string_view kServiceName = "service.name";
+
+std::uint64_t ToUnixNano(std::chrono::system_clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+}
+
+void AddAttribute(
+    google::protobuf::RepeatedPtrField<::opentelemetry::proto::common::v1::KeyValue>& attributes,
+    std::string_view key,
+    std::string_view value
+) {
+    auto* attr = attributes.Add();
+    attr->set_key(std::string{key});
+    attr->mutable_value()->set_string_value(std::string{value});
+}
+
+template <typename DataPoint>
+void FillLabels(DataPoint& data_point, utils::statistics::LabelsSpan labels) {
+    for (const auto& label : labels) {
+        AddAttribute(*data_point.mutable_attributes(), label.Name(), label.Value());
+    }
+}
+
+std::size_t GetDataPointsCount(const metrics_v1::Metric& metric) {
+    switch (metric.data_case()) {
+        case metrics_v1::Metric::kGauge:
+            return metric.gauge().data_points_size();
+        case metrics_v1::Metric::kSum:
+            return metric.sum().data_points_size();
+        case metrics_v1::Metric::kHistogram:
+            return metric.histogram().data_points_size();
+        default:
+            return 0;
+    }
+}
+
+}  // namespace
+
+class MetricsConverter::Builder final : public utils::statistics::BaseFormatBuilder {
+public:
+    Builder(MetricsConverter& converter, metrics_v1::ScopeMetrics& scope, std::uint64_t now)
+        : converter_(converter), scope_(scope), now_(now) {}
+
+    void HandleMetric(
+        std::string_view path,
+        utils::statistics::LabelsSpan labels,
+        const utils::statistics::MetricValue& value
+    ) override {
+        value.Visit(utils::Overloaded{
+            [&](std::int64_t x) { AddGaugePoint(path, labels).set_as_int(x); },
+            [&](double x) { AddGaugePoint(path, labels).set_as_double(x); },
+            [&](utils::statistics::Rate x) { HandleRate(path, labels, x); },
+            [&](utils::statistics::HistogramView x) { HandleHistogram(path, labels, x); },
+        });
+    }
+
+private:
+    enum class Kind { kGauge, kSum, kHistogram };
+
+    metrics_v1::Metric& GetMetric(std::string_view path, Kind kind) {
+        key_.assign(path);
+        key_.push_back(static_cast<char>('0' + static_cast<int>(kind)));
+
+        auto [it, inserted] = metrics_.try_emplace(key_, nullptr);
+        if (inserted) {
+            it->second = scope_.add_metrics();
+            it->second->set_name(std::string{path});
+        }
+        return *it->second;
+    }
+
+    metrics_v1::NumberDataPoint& AddGaugePoint(std::string_view path, utils::statistics::LabelsSpan labels) {
+        auto& point = *GetMetric(path, Kind::kGauge).mutable_gauge()->add_data_points();
+        point.set_time_unix_nano(now_);
+        FillLabels(point, labels);
+        return point;
+    }
+
+    void HandleRate(std::string_view path, utils::statistics::LabelsSpan labels, utils::statistics::Rate value) {
+        key_.assign(path);
+        for (const auto& label : labels) {
+            key_.push_back('\0');
+            key_.append(label.Name());
+            key_.push_back('\0');
+            key_.append(label.Value());
+        }
+
+        // A series seen for the first time counts from the process start
+        auto [it, inserted] = converter_.rates_.try_emplace(key_);
+        auto& state = it->second;
+        const auto start_time = inserted ? converter_.start_time_unix_nano_ : converter_.last_convert_unix_nano_;
+        // A decreased value means the counter was reset
+        const auto delta = value.value >= state.value ? value.value - state.value : value.value;
+        state.value = value.value;
+        state.generation = converter_.generation_;
+
+        auto& sum = *GetMetric(path, Kind::kSum).mutable_sum();
+        sum.set_aggregation_temporality(metrics_v1::AGGREGATION_TEMPORALITY_DELTA);
+        sum.set_is_monotonic(true);
+
+        auto& point = *sum.add_data_points();
+        point.set_start_time_unix_nano(start_time);
+        point.set_time_unix_nano(now_);
+        point.set_as_int(static_cast<std::int64_t>(delta));
+        FillLabels(point, labels);
+    }
+
+    void HandleHistogram(
+        std::string_view path,
+        utils::statistics::LabelsSpan labels,
+        utils::statistics::HistogramView value
+    ) {
+        auto& histogram = *GetMetric(path, Kind::kHistogram).mutable_histogram();
+        histogram.set_aggregation_temporality(metrics_v1::AGGREGATION_TEMPORALITY_CUMULATIVE);
+
+        auto& point = *histogram.add_data_points();
+        point.set_start_time_unix_nano(converter_.start_time_unix_nano_);
+        point.set_time_unix_nano(now_);
+        point.set_count(value.GetTotalCount());
+        const auto bucket_count = value.GetBucketCount();
+        for (std::size_t i = 0; i < bucket_count; ++i) {
+            point.add_explicit_bounds(value.GetUpperBoundAt(i));
+            point.add_bucket_counts(value.GetValueAt(i));
+        }
+        point.add_bucket_counts(value.GetValueAtInf());
+        FillLabels(point, labels);
+    }
+
+    MetricsConverter& converter_;
+    metrics_v1::ScopeMetrics& scope_;
+    const std::uint64_t now_;
+    std::string key_;
+    std::unordered_map<std::string, metrics_v1::Metric*> metrics_;
+};
+
+MetricsConverter::MetricsConverter(
+    const MetricsExporterConfig& config,
+    std::chrono::system_clock::time_point start_time
+)
+    : config_(config), start_time_unix_nano_(ToUnixNano(start_time)), last_convert_unix_nano_(start_time_unix_nano_) {}
+
+std::vector<MetricsConverter::Request> MetricsConverter::Convert(
+    const utils::statistics::Storage& storage,
+    std::chrono::system_clock::time_point now
+) {
+    const auto now_unix_nano = ToUnixNano(now);
+    ++generation_;
+
+    metrics_v1::ScopeMetrics scope;
+    Builder builder{*this, scope, now_unix_nano};
+    storage.VisitMetrics(builder);
+    last_convert_unix_nano_ = now_unix_nano;
+
+    // Forget the series of the unregistered sources
+    for (auto it = rates_.begin(); it != rates_.end();) {
+        if (it->second.generation != generation_) {
+            it = rates_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    std::vector<Request> result;
+    std::size_t batch_size = 0;
+    for (auto& metric : *scope.mutable_metrics()) {
+        const auto data_points = GetDataPointsCount(metric);
+        if (result.empty() || (batch_size > 0 && batch_size + data_points > config_.max_batch_size)) {
+            result.push_back(MakeRequest());
+            batch_size = 0;
+        }
+        batch_size += data_points;
+        *result.back().mutable_resource_metrics(0)->mutable_scope_metrics(0)->add_metrics() = std::move(metric);
+    }
+    return result;
+}
+
+MetricsConverter::Request MetricsConverter::MakeRequest() const {
+    Request request;
+    auto* resource_metrics = request.add_resource_metrics();
+    resource_metrics->add_scope_metrics();
+
+    auto& attributes = *resource_metrics->mutable_resource()->mutable_attributes();
+    AddAttribute(attributes, kTelemetrySdkLanguage, "cpp");
+    AddAttribute(attributes, kTelemetrySdkName, "userver");
+    AddAttribute(attributes, kServiceName, config_.service_name);
+    for (const auto& [key, value] : config_.extra_attributes) {
+        AddAttribute(attributes, key, value);
+    }
+    return request;
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const MetricsExporterStatistics& stats) {
+    writer["exports"] = stats.exports;
+    writer["sent_batches"] = stats.sent_batches;
+    writer["failed_batches"] = stats.failed_batches;
+    writer["sent_data_points"] = stats.sent_data_points;
+}
+
+MetricsExporter::MetricsExporter(
+    Client client,
+    const utils::statistics::Storage& storage,
+    MetricsExporterConfig&& config
+)
+    : client_(std::move(client)),
+      storage_(storage),
+      config_(std::move(config)),
+      converter_(config_, std::chrono::system_clock::now()) {}
+
+void MetricsExporter::Export() {
+    auto requests = converter_.Convert(storage_, std::chrono::system_clock::now());
+    ++stats_.exports;
+
+    for (const auto& request : requests) {
+        std::size_t data_points = 0;
+        for (const auto& metric : request.resource_metrics(0).scope_metrics(0).metrics()) {
+            data_points += GetDataPointsCount(metric);
+        }
+
+        try {
+            client_.Export(request);
+            ++stats_.sent_batches;
+            stats_.sent_data_points += utils::statistics::Rate{static_cast<std::uint64_t>(data_points)};
+        } catch (const ugrpc::client::RpcCancelledError&) {
+            throw;
+        } catch (const std::exception& e) {
+            ++stats_.failed_batches;
+            LOG_WARNING() << "Failed to send OTLP metrics: " << e;
+        }
+    }
+}
+
+const MetricsExporterStatistics& MetricsExporter::GetStatistics() const { return stats_; }
+
+}  // namespace otlp
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <opentelemetry/proto/collector/metrics/v1/metrics_service_client.usrv.pb.hpp>
+
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+struct MetricsExporterConfig {
+    // Maximum number of data points in a single export request
+    std::size_t max_batch_size{1000};
+    std::string service_name;
+    std::unordered_map<std::string, std::string> extra_attributes;
+};
+
+/// Converts the metrics of utils::statistics::Storage into OTLP requests.
+///
+/// Rate metrics are sent as monotonic sums with delta temporality: the
+/// converter remembers the previous value of each series and sends only the
+/// increase since the previous conversion. Integer and floating-point metrics
+/// are sent as gauges, histograms are sent with cumulative temporality.
+class MetricsConverter final {
+public:
+    using Request = opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest;
+
+    MetricsConverter(const MetricsExporterConfig& config, std::chrono::system_clock::time_point start_time);
+
+    /// Returns the requests with at most `max_batch_size` data points each,
+    /// except for the single metrics that have more data points
+    std::vector<Request> Convert(const utils::statistics::Storage& storage, std::chrono::system_clock::time_point now);
+
+private:
+    class Builder;
+
+    struct RateState final {
+        std::uint64_t value{0};
+        std::uint64_t generation{0};
+    };
+
+    Request MakeRequest() const;
+
+    const MetricsExporterConfig& config_;
+    const std::uint64_t start_time_unix_nano_;
+    std::uint64_t last_convert_unix_nano_;
+    std::uint64_t generation_{0};
+    std::unordered_map<std::string, RateState> rates_;
+};
+
+struct MetricsExporterStatistics final {
+    utils::statistics::RateCounter exports;
+    utils::statistics::RateCounter sent_batches;
+    utils::statistics::RateCounter failed_batches;
+    utils::statistics::RateCounter sent_data_points;
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const MetricsExporterStatistics& stats);
+
+class MetricsExporter final {
+public:
+    using Client = opentelemetry::proto::collector::metrics::v1::MetricsServiceClient;
+
+    MetricsExporter(Client client, const utils::statistics::Storage& storage, MetricsExporterConfig&& config);
+
+    /// Walks the storage and sends all the metrics to the collector. Failed
+    /// batches are dropped, the deltas of their rates are lost.
+    void Export();
+
+    const MetricsExporterStatistics& GetStatistics() const;
+
+private:
+    Client client_;
+    const utils::statistics::Storage& storage_;
+    const MetricsExporterConfig config_;
+    MetricsConverter converter_;
+    MetricsExporterStatistics stats_;
+};
+
+}  // namespace otlp
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,148 @@
+#include <userver/utest/utest.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <otlp/metrics/exporter.hpp>
+
+#include <userver/utils/statistics/histogram.hpp>
+#include <userver/utils/statistics/storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace metrics_v1 = ::opentelemetry::proto::metrics::v1;
+
+const auto kStartTime = std::chrono::system_clock::time_point{std::chrono::seconds{1000}};
+
+const metrics_v1::Metric& FindMetric(const otlp::MetricsConverter::Request& request, std::string_view name) {
+    for (const auto& metric : request.resource_metrics(0).scope_metrics(0).metrics()) {
+        if (metric.name() == name) return metric;
+    }
+    throw std::runtime_error("No metric " + std::string{name});
+}
+
+}  // namespace
+
+UTEST(OtlpMetrics, Gauges) {
+    utils::statistics::Storage storage;
+    const auto holder = storage.RegisterWriter("test", [](utils::statistics::Writer& writer) {
+        writer["int"] = 42;
+        writer["float"].ValueWithLabels(1.5, {"label", "value"});
+    });
+
+    otlp::MetricsExporterConfig config;
+    config.service_name = "test-service";
+    otlp::MetricsConverter converter{config, kStartTime};
+    const auto requests = converter.Convert(storage, kStartTime + std::chrono::seconds{1});
+    ASSERT_EQ(requests.size(), 1);
+
+    const auto& int_metric = FindMetric(requests[0], "test.int");
+    ASSERT_TRUE(int_metric.has_gauge());
+    ASSERT_EQ(int_metric.gauge().data_points_size(), 1);
+    EXPECT_EQ(int_metric.gauge().data_points(0).as_int(), 42);
+
+    const auto& float_metric = FindMetric(requests[0], "test.float");
+    ASSERT_TRUE(float_metric.has_gauge());
+    const auto& point = float_metric.gauge().data_points(0);
+    EXPECT_DOUBLE_EQ(point.as_double(), 1.5);
+    ASSERT_EQ(point.attributes_size(), 1);
+    EXPECT_EQ(point.attributes(0).key(), "label");
+    EXPECT_EQ(point.attributes(0).value().string_value(), "value");
+
+    const auto& resource = requests[0].resource_metrics(0).resource();
+    bool has_service_name = false;
+    for (const auto& attr : resource.attributes()) {
+        if (attr.key() == "service.name") {
+            EXPECT_EQ(attr.value().string_value(), "test-service");
+            has_service_name = true;
+        }
+    }
+    EXPECT_TRUE(has_service_name);
+}
+
+UTEST(OtlpMetrics, RateDeltas) {
+    utils::statistics::Storage storage;
+    utils::statistics::Rate rate{10};
+    const auto holder = storage.RegisterWriter("test", [&rate](utils::statistics::Writer& writer) {
+        writer["rate"] = rate;
+    });
+
+    otlp::MetricsExporterConfig config;
+    otlp::MetricsConverter converter{config, kStartTime};
+
+    const auto get_point = [](const otlp::MetricsConverter::Request& request) {
+        const auto& metric = FindMetric(request, "test.rate");
+        EXPECT_TRUE(metric.has_sum());
+        EXPECT_TRUE(metric.sum().is_monotonic());
+        EXPECT_EQ(metric.sum().aggregation_temporality(), metrics_v1::AGGREGATION_TEMPORALITY_DELTA);
+        return metric.sum().data_points(0);
+    };
+
+    auto point = get_point(converter.Convert(storage, kStartTime + std::chrono::seconds{1}).at(0));
+    EXPECT_EQ(point.as_int(), 10);
+    EXPECT_EQ(point.start_time_unix_nano(), 1000'000'000'000);
+    EXPECT_EQ(point.time_unix_nano(), 1001'000'000'000);
+
+    rate = utils::statistics::Rate{25};
+    point = get_point(converter.Convert(storage, kStartTime + std::chrono::seconds{2}).at(0));
+    EXPECT_EQ(point.as_int(), 15);
+    EXPECT_EQ(point.start_time_unix_nano(), 1001'000'000'000);
+    EXPECT_EQ(point.time_unix_nano(), 1002'000'000'000);
+
+    // counter reset
+    rate = utils::statistics::Rate{5};
+    point = get_point(converter.Convert(storage, kStartTime + std::chrono::seconds{3}).at(0));
+    EXPECT_EQ(point.as_int(), 5);
+}
+
+UTEST(OtlpMetrics, Histogram) {
+    utils::statistics::Storage storage;
+    const std::vector<double> bounds{1, 10};
+    utils::statistics::Histogram histogram{bounds};
+    histogram.Account(0.5);
+    histogram.Account(5, 2);
+    histogram.Account(100);
+    const auto holder = storage.RegisterWriter("test", [&histogram](utils::statistics::Writer& writer) {
+        writer["histogram"] = histogram;
+    });
+
+    otlp::MetricsExporterConfig config;
+    otlp::MetricsConverter converter{config, kStartTime};
+    const auto requests = converter.Convert(storage, kStartTime + std::chrono::seconds{1});
+    ASSERT_EQ(requests.size(), 1);
+
+    const auto& metric = FindMetric(requests[0], "test.histogram");
+    ASSERT_TRUE(metric.has_histogram());
+    const auto& point = metric.histogram().data_points(0);
+    EXPECT_EQ(point.count(), 4);
+    EXPECT_EQ(std::vector<double>(point.explicit_bounds().begin(), point.explicit_bounds().end()), bounds);
+    EXPECT_EQ(
+        std::vector<std::uint64_t>(point.bucket_counts().begin(), point.bucket_counts().end()),
+        (std::vector<std::uint64_t>{1, 2, 1})
+    );
+}
+
+UTEST(OtlpMetrics, Batches) {
+    utils::statistics::Storage storage;
+    const auto holder = storage.RegisterWriter("test", [](utils::statistics::Writer& writer) {
+        for (int i = 0; i < 5; ++i) {
+            writer["metric" + std::to_string(i)].ValueWithLabels(i, {"a", "1"});
+            writer["metric" + std::to_string(i)].ValueWithLabels(i, {"a", "2"});
+        }
+    });
+
+    otlp::MetricsExporterConfig config;
+    config.max_batch_size = 5;
+    otlp::MetricsConverter converter{config, kStartTime};
+    const auto requests = converter.Convert(storage, kStartTime + std::chrono::seconds{1});
+
+    ASSERT_EQ(requests.size(), 3);
+    for (const auto& request : requests) {
+        EXPECT_LE(request.resource_metrics(0).scope_metrics(0).metrics_size(), 2);
+    }
+}
+
+USERVER_NAMESPACE_END
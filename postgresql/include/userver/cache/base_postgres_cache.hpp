@@ -5,11 +5,15 @@
 
 #include <userver/cache/base_postgres_cache_fwd.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <map>
 #include <string_view>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -23,9 +27,11 @@
 #include <userver/storages/postgres/io/chrono.hpp>
 
 #include <userver/compiler/demangle.hpp>
+#include <userver/engine/wait_all_checked.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/cpu_relax.hpp>
 #include <userver/utils/meta.hpp>
 #include <userver/utils/void_t.hpp>
@@ -66,6 +72,9 @@ namespace components {
 /// incremental-update-op-timeout | timeout for an incremental update | 1s
 /// update-correction | incremental update window adjustment | - (0 for caches with defined GetLastKnownUpdated)
 /// chunk-size | number of rows to request from PostgreSQL via portals, 0 to fetch all rows in one request without portals | 1000
+/// full-update-partitions | number of partitions of each shard to fetch and parse concurrently during a full update, requires `kPartitionField` in the policy | 1
+/// full-update-parallelism | max number of partitions fetched at the same time | full-update-partitions
+/// full-update-streaming | receive the rows of a non-partitioned full update as a storages::postgres::ResultStream in chunks of `chunk-size` rows and parse each chunk while the next one is in transit, without portals and an explicit transaction | false
 ///
 /// @section pg_cc_cache_policy Cache policy
 ///
@@ -97,6 +106,17 @@ namespace components {
 ///
 /// @snippet cache/postgres_cache_test.cpp Pg Cache Policy Custom Container With Write Notification Example
 ///
+/// @section pg_cc_partitioned_updates Partitioned full updates
+///
+/// Full updates of large caches may be dominated by fetching and parsing the
+/// rows on a single coroutine. If the policy defines `kPartitionField`, an
+/// integer column, and `full-update-partitions` is greater than 1, the full
+/// update query of each shard is split into the queries with the additional
+/// condition 'abs(mod(kPartitionField, partitions)) = partition'. Partitions are
+/// fetched and parsed concurrently, at most `full-update-parallelism` at a
+/// time, and then merged into the cache container. Incremental updates are not
+/// affected.
+///
 /// @section pg_cc_forward_declaration Forward Declaration
 ///
 /// To forward declare a cache you can forward declare a trait and
@@ -160,6 +180,12 @@ using HasWhere = decltype(T::kWhere);
 template <typename T>
 inline constexpr bool kHasWhere = meta::kIsDetected<HasWhere, T>;
 
+// Component kPartitionField in policy
+template <typename T>
+using HasPartitionField = decltype(T::kPartitionField);
+template <typename T>
+inline constexpr bool kHasPartitionField = meta::kIsDetected<HasPartitionField, T>;
+
 // Update field
 template <typename T>
 using HasUpdatedField = decltype(T::kUpdatedField);
@@ -414,6 +440,20 @@ private:
     bool MayReturnNull() const override;
 
     CachedData GetDataSnapshot(cache::UpdateType type, tracing::ScopeTime& scope);
+
+    struct PartitionData {
+        std::vector<ValueType> values;
+        std::size_t read_count{0};
+        std::size_t parse_failures{0};
+    };
+
+    std::size_t UpdatePartitioned(
+        CachedData& data_cache,
+        cache::UpdateStatisticsScope& stats_scope,
+        tracing::ScopeTime& scope
+    );
+    PartitionData FetchPartition(storages::postgres::Cluster& cluster, std::size_t partition);
+    void ParsePartition(storages::postgres::ResultSet res, PartitionData& data);
     void CacheResults(
         storages::postgres::ResultSet res,
         CachedData& data_cache,
@@ -423,6 +463,7 @@ private:
 
     static storages::postgres::Query GetAllQuery();
     static storages::postgres::Query GetDeltaQuery();
+    static storages::postgres::Query GetPartitionQuery();
 
     std::chrono::milliseconds ParseCorrection(const ComponentConfig& config);
 
@@ -432,6 +473,9 @@ private:
     const std::chrono::milliseconds full_update_timeout_;
     const std::chrono::milliseconds incremental_update_timeout_;
     const std::size_t chunk_size_;
+    const std::size_t full_update_partitions_;
+    const std::size_t full_update_parallelism_;
+    const bool full_update_streaming_;
     std::size_t cpu_relax_iterations_parse_{0};
     std::size_t cpu_relax_iterations_copy_{0};
 };
@@ -448,7 +492,10 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config, co
       incremental_update_timeout_{config["incremental-update-op-timeout"].As<std::chrono::milliseconds>(
           pg_cache::detail::kDefaultIncrementalUpdateTimeout
       )},
-      chunk_size_{config["chunk-size"].As<size_t>(pg_cache::detail::kDefaultChunkSize)} {
+      chunk_size_{config["chunk-size"].As<size_t>(pg_cache::detail::kDefaultChunkSize)},
+      full_update_partitions_{config["full-update-partitions"].As<size_t>(1)},
+      full_update_parallelism_{config["full-update-parallelism"].As<size_t>(full_update_partitions_)},
+      full_update_streaming_{config["full-update-streaming"].As<bool>(false)} {
     UINVARIANT(
         !chunk_size_ || storages::postgres::Portal::IsSupportedByDriver(),
         "Either set 'chunk-size' to 0, or enable PostgreSQL portals by building "
@@ -462,6 +509,18 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config, co
             config.Name() + "' cache"
         );
     }
+    if (full_update_partitions_ == 0 || full_update_parallelism_ == 0) {
+        throw std::logic_error(
+            "'full-update-partitions' and 'full-update-parallelism' must be positive for '" + config.Name() + "' cache"
+        );
+    }
+    if (full_update_partitions_ > 1 && !pg_cache::detail::kHasPartitionField<PostgreCachePolicy>) {
+        throw std::logic_error(
+            "Partitioned full updates are requested in config but no partition "
+            "field name is specified in traits of '" +
+            config.Name() + "' cache"
+        );
+    }
     if (correction_.count() < 0) {
         throw std::logic_error(
             "Refusing to set forward (negative) update correction requested in "
@@ -524,6 +583,30 @@ storages::postgres::Query PostgreCache<PostgreCachePolicy>::GetDeltaQuery() {
     }
 }
 
+template <typename PostgreCachePolicy>
+storages::postgres::Query PostgreCache<PostgreCachePolicy>::GetPartitionQuery() {
+    if constexpr (pg_cache::detail::kHasPartitionField<PostgreCachePolicy>) {
+        storages::postgres::Query query = PolicyCheckerType::GetQuery();
+
+        if constexpr (pg_cache::detail::kHasWhere<PostgreCachePolicy>) {
+            return {
+                fmt::format(
+                    "{} where ({}) and abs(mod({}, $1)) = $2",
+                    query.Statement(),
+                    PostgreCachePolicy::kWhere,
+                    PolicyType::kPartitionField
+                ),
+                query.GetName()};
+        } else {
+            return {
+                fmt::format("{} where abs(mod({}, $1)) = $2", query.Statement(), PolicyType::kPartitionField),
+                query.GetName()};
+        }
+    } else {
+        return GetAllQuery();
+    }
+}
+
 template <typename PostgreCachePolicy>
 std::chrono::milliseconds PostgreCache<PostgreCachePolicy>::ParseCorrection(const ComponentConfig& config) {
     static constexpr std::string_view kUpdateCorrection = "update-correction";
@@ -570,43 +653,68 @@ void PostgreCache<PostgreCachePolicy>::Update(
     scope.Reset(std::string{pg_cache::detail::kFetchStage});
 
     size_t changes = 0;
-    // Iterate clusters
-    for (auto& cluster : clusters_) {
-        if (chunk_size_ > 0) {
-            auto trx = cluster->Begin(
-                kClusterHostTypeFlags,
-                pg::Transaction::RO,
-                pg::CommandControl{timeout, pg_cache::detail::kStatementTimeoutOff}
-            );
-            auto portal = trx.MakePortal(query, GetLastUpdated(last_update, *data_cache));
-            while (portal) {
-                scope.Reset(std::string{pg_cache::detail::kFetchStage});
-                auto res = portal.Fetch(chunk_size_);
+    if (type == cache::UpdateType::kFull && full_update_partitions_ > 1) {
+        changes = UpdatePartitioned(data_cache, stats_scope, scope);
+    } else {
+        // Iterate clusters
+        for (auto& cluster : clusters_) {
+            if (type == cache::UpdateType::kFull && full_update_streaming_) {
+                pg::ParameterStore params;
+                if (query.Statement().find('$') != std::string::npos) {
+                    params.PushBack(GetLastUpdated(last_update, *data_cache));
+                }
+                auto stream = cluster->MakeResultStream(
+                    kClusterHostTypeFlags,
+                    pg::CommandControl{timeout, pg_cache::detail::kStatementTimeoutOff},
+                    chunk_size_ > 0 ? chunk_size_ : pg::kDefaultResultStreamChunkSize,
+                    query,
+                    params
+                );
+                while (auto res = stream.FetchChunk()) {
+                    const auto size = res->Size();
+                    stats_scope.IncreaseDocumentsReadCount(size);
+
+                    scope.Reset(std::string{pg_cache::detail::kParseStage});
+                    CacheResults(std::move(*res), data_cache, stats_scope, scope);
+                    changes += size;
+                    scope.Reset(std::string{pg_cache::detail::kFetchStage});
+                }
+            } else if (chunk_size_ > 0) {
+                auto trx = cluster->Begin(
+                    kClusterHostTypeFlags,
+                    pg::Transaction::RO,
+                    pg::CommandControl{timeout, pg_cache::detail::kStatementTimeoutOff}
+                );
+                auto portal = trx.MakePortal(query, GetLastUpdated(last_update, *data_cache));
+                while (portal) {
+                    scope.Reset(std::string{pg_cache::detail::kFetchStage});
+                    auto res = portal.Fetch(chunk_size_);
+                    stats_scope.IncreaseDocumentsReadCount(res.Size());
+
+                    scope.Reset(std::string{pg_cache::detail::kParseStage});
+                    CacheResults(res, data_cache, stats_scope, scope);
+                    changes += res.Size();
+                }
+                trx.Commit();
+            } else {
+                bool has_parameter = query.Statement().find('$') != std::string::npos;
+                auto res = has_parameter ? cluster->Execute(
+                                               kClusterHostTypeFlags,
+                                               pg::CommandControl{timeout, pg_cache::detail::kStatementTimeoutOff},
+                                               query,
+                                               GetLastUpdated(last_update, *data_cache)
+                                           )
+                                         : cluster->Execute(
+                                               kClusterHostTypeFlags,
+                                               pg::CommandControl{timeout, pg_cache::detail::kStatementTimeoutOff},
+                                               query
+                                           );
                 stats_scope.IncreaseDocumentsReadCount(res.Size());
 
                 scope.Reset(std::string{pg_cache::detail::kParseStage});
                 CacheResults(res, data_cache, stats_scope, scope);
                 changes += res.Size();
             }
-            trx.Commit();
-        } else {
-            bool has_parameter = query.Statement().find('$') != std::string::npos;
-            auto res = has_parameter ? cluster->Execute(
-                                           kClusterHostTypeFlags,
-                                           pg::CommandControl{timeout, pg_cache::detail::kStatementTimeoutOff},
-                                           query,
-                                           GetLastUpdated(last_update, *data_cache)
-                                       )
-                                     : cluster->Execute(
-                                           kClusterHostTypeFlags,
-                                           pg::CommandControl{timeout, pg_cache::detail::kStatementTimeoutOff},
-                                           query
-                                       );
-            stats_scope.IncreaseDocumentsReadCount(res.Size());
-
-            scope.Reset(std::string{pg_cache::detail::kParseStage});
-            CacheResults(res, data_cache, stats_scope, scope);
-            changes += res.Size();
         }
     }
 
@@ -676,6 +784,90 @@ void PostgreCache<PostgreCachePolicy>::CacheResults(
     }
 }
 
+template <typename PostgreCachePolicy>
+std::size_t PostgreCache<PostgreCachePolicy>::UpdatePartitioned(
+    CachedData& data_cache,
+    cache::UpdateStatisticsScope& stats_scope,
+    tracing::ScopeTime& scope
+) {
+    // Every shard is split into the same partitions
+    std::vector<PartitionData> partitions(clusters_.size() * full_update_partitions_);
+    std::atomic<std::size_t> next_partition{0};
+
+    std::vector<engine::TaskWithResult<void>> workers;
+    const auto workers_count = std::min(full_update_parallelism_, partitions.size());
+    workers.reserve(workers_count);
+    for (std::size_t i = 0; i < workers_count; ++i) {
+        workers.push_back(utils::Async("pg_cache_partition", [this, &partitions, &next_partition] {
+            for (auto index = next_partition++; index < partitions.size(); index = next_partition++) {
+                partitions[index] =
+                    FetchPartition(*clusters_[index / full_update_partitions_], index % full_update_partitions_);
+            }
+        }));
+    }
+    // Cancellation of the update cancels the workers in ~TaskWithResult
+    engine::WaitAllChecked(workers);
+
+    scope.Reset(std::string{pg_cache::detail::kParseStage});
+    std::size_t changes = 0;
+    utils::CpuRelax relax{cpu_relax_iterations_parse_, nullptr};
+    for (auto& partition : partitions) {
+        stats_scope.IncreaseDocumentsReadCount(partition.read_count);
+        stats_scope.IncreaseDocumentsParseFailures(partition.parse_failures);
+        changes += partition.read_count;
+
+        for (auto& value : partition.values) {
+            relax.Relax();
+            using pg_cache::detail::CacheInsertOrAssign;
+            CacheInsertOrAssign(*data_cache, std::move(value), PostgreCachePolicy::kKeyMember);
+        }
+        partition.values = {};
+    }
+    return changes;
+}
+
+template <typename PostgreCachePolicy>
+typename PostgreCache<PostgreCachePolicy>::PartitionData
+PostgreCache<PostgreCachePolicy>::FetchPartition(storages::postgres::Cluster& cluster, std::size_t partition) {
+    namespace pg = storages::postgres;
+    const auto query = GetPartitionQuery();
+    const pg::CommandControl cc{full_update_timeout_, pg_cache::detail::kStatementTimeoutOff};
+    const auto partitions_count = static_cast<std::int64_t>(full_update_partitions_);
+    const auto partition_index = static_cast<std::int64_t>(partition);
+
+    PartitionData data;
+    if (chunk_size_ > 0) {
+        auto trx = cluster.Begin(kClusterHostTypeFlags, pg::Transaction::RO, cc);
+        auto portal = trx.MakePortal(query, partitions_count, partition_index);
+        while (portal) {
+            ParsePartition(portal.Fetch(chunk_size_), data);
+        }
+        trx.Commit();
+    } else {
+        ParsePartition(cluster.Execute(kClusterHostTypeFlags, cc, query, partitions_count, partition_index), data);
+    }
+    return data;
+}
+
+template <typename PostgreCachePolicy>
+void PostgreCache<PostgreCachePolicy>::ParsePartition(storages::postgres::ResultSet res, PartitionData& data) {
+    data.read_count += res.Size();
+    data.values.reserve(data.values.size() + res.Size());
+
+    auto values = res.AsSetOf<RawValueType>(storages::postgres::kRowTag);
+    utils::CpuRelax relax{cpu_relax_iterations_parse_, nullptr};
+    for (auto p = values.begin(); p != values.end(); ++p) {
+        relax.Relax();
+        try {
+            data.values.push_back(pg_cache::detail::ExtractValue<PostgreCachePolicy>(*p));
+        } catch (const std::exception& e) {
+            ++data.parse_failures;
+            LOG_ERROR() << "Error parsing data row in cache '" << kName << "' to '"
+                        << compiler::GetTypeName<ValueType>() << "': " << e.what();
+        }
+    }
+}
+
 template <typename PostgreCachePolicy>
 typename PostgreCache<PostgreCachePolicy>::CachedData
 PostgreCache<PostgreCachePolicy>::GetDataSnapshot(cache::UpdateType type, tracing::ScopeTime& scope) {
@@ -12,14 +12,17 @@
 #include <userver/error_injection/settings_fwd.hpp>
 #include <userver/testsuite/postgres_control.hpp>
 #include <userver/testsuite/tasks.hpp>
+#include <userver/utils/function_ref.hpp>
 
 #include <userver/storages/postgres/cluster_types.hpp>
 #include <userver/storages/postgres/database.hpp>
 #include <userver/storages/postgres/detail/non_transaction.hpp>
 #include <userver/storages/postgres/notify.hpp>
 #include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/parameter_store.hpp>
 #include <userver/storages/postgres/query.hpp>
 #include <userver/storages/postgres/query_queue.hpp>
+#include <userver/storages/postgres/result_stream.hpp>
 #include <userver/storages/postgres/statistics.hpp>
 #include <userver/storages/postgres/transaction.hpp>
 
@@ -170,6 +173,13 @@ public:
     [[nodiscard]] QueryQueue CreateQueryQueue(ClusterHostTypeFlags flags, TimeoutDuration acquire_timeout);
 
     /// @name Single-statement query in an auto-commit transaction
+    ///
+    /// If `query_batching_window_us` of the pool settings is not zero,
+    /// single statements of different coroutines are collected for that time
+    /// and sent over a single connection in pipeline mode, each as its own
+    /// auto-commit transaction. This reduces the number of connections and
+    /// network round-trips under high concurrency, results and errors are still
+    /// delivered to each caller separately.
     /// @{
 
     /// @brief Execute a statement at host of specified type.
@@ -215,6 +225,88 @@ public:
     );
     /// @}
 
+    /// @name Single-statement query with the result cached on the client
+    ///
+    /// The result of a read-only statement is cached by the statement text and
+    /// the values of its arguments and is served without a round-trip to the
+    /// database for `result_cache_ttl`. Cached results are dropped earlier on
+    /// any notification on `result_cache_invalidation_channel`, e.g. sent by
+    /// a trigger of the cached tables. Hits and misses of the named statements
+    /// are reported in the `result-cache` metrics.
+    ///
+    /// Results are cached only if `result_cache_size_bytes` is set in the
+    /// static config of the component, otherwise these functions behave
+    /// exactly as Execute.
+    ///
+    /// @note Only built-in types can be used as arguments, see ParameterStore
+    /// @{
+
+    /// @brief Execute a read-only statement at host of specified type or take
+    /// its result from the cache.
+    /// @note You must specify at least one role from ClusterHostType here
+    template <typename... Args>
+    ResultSet ExecuteCached(ClusterHostTypeFlags flags, const Query& query, const Args&... args);
+
+    /// @brief Execute a read-only statement with specified host selection
+    /// rules and command control settings or take its result from the cache.
+    /// @note You must specify at least one role from ClusterHostType here
+    template <typename... Args>
+    ResultSet ExecuteCached(
+        ClusterHostTypeFlags flags,
+        OptionalCommandControl statement_cmd_ctl,
+        const Query& query,
+        const Args&... args
+    );
+
+    /// @brief Execute a read-only statement with stored arguments, specified
+    /// host selection rules and command control settings or take its result
+    /// from the cache.
+    /// @note You must specify at least one role from ClusterHostType here
+    ResultSet ExecuteCached(
+        ClusterHostTypeFlags flags,
+        OptionalCommandControl statement_cmd_ctl,
+        const Query& query,
+        const ParameterStore& store
+    );
+    /// @}
+
+    /// @name Single-statement query with the result received as a stream
+    ///
+    /// The rows are received and can be parsed in chunks as they arrive
+    /// instead of being buffered as a whole, see ResultStream. The stream owns
+    /// a connection taken from the pool until all the rows are fetched.
+    /// @{
+
+    /// @brief Execute a statement at host of specified type and return the
+    /// stream of its rows.
+    /// @note You must specify at least one role from ClusterHostType here
+    template <typename... Args>
+    ResultStream MakeResultStream(ClusterHostTypeFlags flags, const Query& query, const Args&... args);
+
+    /// @brief Execute a statement with specified host selection rules and
+    /// command control settings and return the stream of its rows.
+    /// @note You must specify at least one role from ClusterHostType here
+    template <typename... Args>
+    ResultStream MakeResultStream(
+        ClusterHostTypeFlags flags,
+        OptionalCommandControl statement_cmd_ctl,
+        const Query& query,
+        const Args&... args
+    );
+
+    /// @brief Execute a statement with stored arguments, specified host
+    /// selection rules and command control settings and return the stream of
+    /// its rows in chunks of up to `chunk_size` rows.
+    /// @note You must specify at least one role from ClusterHostType here
+    ResultStream MakeResultStream(
+        ClusterHostTypeFlags flags,
+        OptionalCommandControl statement_cmd_ctl,
+        std::size_t chunk_size,
+        const Query& query,
+        const ParameterStore& store
+    );
+    /// @}
+
     /// @brief Listen for notifications on channel
     /// @warning Each NotifyScope owns a single connection taken from the pool,
     /// which effectively decreases the number of usable connections
@@ -249,8 +341,14 @@ public:
     void SetDsnList(const DsnList&);
 
 private:
+    using ParamsWriter = USERVER_NAMESPACE::utils::function_ref<detail::QueryParameters(const UserTypes&)>;
+
     detail::NonTransaction Start(ClusterHostTypeFlags, OptionalCommandControl);
 
+    bool IsQueryBatchingEnabled() const;
+    ResultSet ExecuteBatched(ClusterHostTypeFlags, OptionalCommandControl, const Query&, ParamsWriter);
+    ResultStream DoMakeResultStream(ClusterHostTypeFlags, OptionalCommandControl, std::size_t, const Query&, ParamsWriter);
+
     OptionalCommandControl GetQueryCmdCtl(const std::string& query_name) const;
     OptionalCommandControl GetHandlersCmdCtl(OptionalCommandControl cmd_ctl) const;
 
@@ -273,10 +371,59 @@ ResultSet Cluster::Execute(
         statement_cmd_ctl = GetQueryCmdCtl(query.GetName()->GetUnderlying());
     }
     statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
+    if (IsQueryBatchingEnabled()) {
+        detail::StaticQueryParameters<sizeof...(args)> params;
+        return ExecuteBatched(flags, statement_cmd_ctl, query, [&](const UserTypes& types) {
+            params.Write(types, args...);
+            return detail::QueryParameters{params};
+        });
+    }
     auto ntrx = Start(flags, statement_cmd_ctl);
     return ntrx.Execute(statement_cmd_ctl, query, args...);
 }
 
+template <typename... Args>
+ResultSet Cluster::ExecuteCached(ClusterHostTypeFlags flags, const Query& query, const Args&... args) {
+    return ExecuteCached(flags, OptionalCommandControl{}, query, args...);
+}
+
+template <typename... Args>
+ResultSet Cluster::ExecuteCached(
+    ClusterHostTypeFlags flags,
+    OptionalCommandControl statement_cmd_ctl,
+    const Query& query,
+    const Args&... args
+) {
+    ParameterStore store;
+    (store.PushBack(args), ...);
+    return ExecuteCached(flags, statement_cmd_ctl, query, store);
+}
+
+template <typename... Args>
+ResultStream Cluster::MakeResultStream(ClusterHostTypeFlags flags, const Query& query, const Args&... args) {
+    return MakeResultStream(flags, OptionalCommandControl{}, query, args...);
+}
+
+template <typename... Args>
+ResultStream Cluster::MakeResultStream(
+    ClusterHostTypeFlags flags,
+    OptionalCommandControl statement_cmd_ctl,
+    const Query& query,
+    const Args&... args
+) {
+    detail::StaticQueryParameters<sizeof...(args)> params;
+    return DoMakeResultStream(
+        flags,
+        statement_cmd_ctl,
+        kDefaultResultStreamChunkSize,
+        query,
+        [&](const UserTypes& types) {
+            params.Write(types, args...);
+            return detail::QueryParameters{params};
+        }
+    );
+}
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
@@ -44,6 +44,11 @@ enum class ClusterHostType {
 
     /// Chooses a host with the lowest RTT
     kNearest = 0x10,
+
+    /// Chooses a host with the lowest RTT multiplied by the number of
+    /// statements running on or waiting for its connections, preferring less
+    /// lagging replicas on ties
+    kLeastLoaded = 0x20,
     /// @}
 };
 
@@ -54,7 +59,10 @@ constexpr ClusterHostTypeFlags kClusterHostRolesMask{
     ClusterHostType::kSyncSlave,
     ClusterHostType::kSlave};
 
-constexpr ClusterHostTypeFlags kClusterHostStrategyMask{ClusterHostType::kRoundRobin, ClusterHostType::kNearest};
+constexpr ClusterHostTypeFlags kClusterHostStrategyMask{
+    ClusterHostType::kRoundRobin,
+    ClusterHostType::kNearest,
+    ClusterHostType::kLeastLoaded};
 
 std::string ToString(ClusterHostType);
 std::string ToString(ClusterHostTypeFlags);
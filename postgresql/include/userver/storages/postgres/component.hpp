@@ -129,11 +129,19 @@ namespace components {
 /// ignore_unused_query_params| disable check for not-NULL query params that are not used in query          | false
 /// monitoring-dbalias      | name of the database for monitorings                                          | calculated from dbalias or dbconnection options
 /// max_prepared_cache_size | prepared statements cache size limit                                          | 200
+/// warm-up-prepared-statements | number of the most executed statements of the pool to prepare on new connections | 0
+/// pooler-mode             | pooling mode of a connection pooler in front of the database, `transaction` for PgBouncer 1.21+ in transaction mode with `max_prepared_statements` enabled | session
 /// max_statement_metrics   | limit of exported metrics for named statements                                | 0
 /// min_pool_size           | number of connections created initially                                       | 4
 /// max_pool_size           | maximum number of created connections for "connlimit_mode: manual"            | 15
 /// max_queue_size          | maximum number of clients waiting for a connection                            | 200
 /// connecting_limit        | limit for concurrent establishing connections number per pool (0 - unlimited) | 0
+/// query_batching_window_us | time to wait for single-statement executions of other coroutines to send them in a single pipeline (0 - disabled), requires pipeline mode | 0
+/// max_query_batch_size    | maximum number of single-statement executions in one batch                    | 32
+/// adaptive_sizing_target_wait_ms | target average time to wait for a connection, the pool grows up to max_pool_size while the waits are longer and shrinks back when idle (0 - disabled) | 0
+/// result_cache_size_bytes | total size of the results cached by storages::postgres::Cluster::ExecuteCached (0 - disabled) | 0
+/// result_cache_ttl        | time to serve a cached result for                                             | 1s
+/// result_cache_invalidation_channel | channel to LISTEN to, any notification on it drops all the cached results | --
 /// connlimit_mode          | max_connections setup mode (manual or auto), also see @ref scripts/docs/en/userver/pg_connlimit_mode_auto.md | auto
 /// error-injection         | artificial error injection settings, error_injection::Settings                | --
 
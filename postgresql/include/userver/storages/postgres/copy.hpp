@@ -0,0 +1,198 @@
+#pragma once
+
+/// @file userver/storages/postgres/copy.hpp
+/// @brief Bulk data transfer with `COPY ... FROM STDIN` and
+/// `COPY ... TO STDOUT`
+
+#include <cstdint>
+#include <string>
+#include <tuple>
+
+#include <boost/pfr/core.hpp>
+
+#include <userver/storages/postgres/detail/connection_ptr.hpp>
+#include <userver/storages/postgres/io/field_buffer.hpp>
+#include <userver/storages/postgres/io/row_types.hpp>
+#include <userver/storages/postgres/io/supported_types.hpp>
+#include <userver/storages/postgres/io/user_types.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/query.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @brief Writer of rows for a `COPY ... FROM STDIN WITH (FORMAT binary)`
+/// statement.
+///
+/// Rows are encoded with the same io formatters as query parameters and are
+/// sent in big chunks, without the limits on the number of query parameters.
+/// Each field of a row must have exactly the type of the corresponding table
+/// column, as the binary COPY format has no type information.
+///
+/// The connection can not be used for other statements until Finish() is
+/// called. If the writer is destroyed without Finish(), the COPY is aborted
+/// and the transaction fails.
+///
+/// @snippet storages/postgres/tests/copy_pgtest.cpp CopyIn
+class CopyIn final {
+public:
+    CopyIn(CopyIn&&) noexcept;
+    CopyIn& operator=(CopyIn&&) = delete;
+    CopyIn(const CopyIn&) = delete;
+    CopyIn& operator=(const CopyIn&) = delete;
+    ~CopyIn();
+
+    /// Write a row: a tuple, an aggregate or a type with `Introspect()`, the
+    /// same kinds of rows as for ResultSet::AsContainer
+    template <typename Row>
+    void WriteRow(const Row& row);
+
+    /// Write a row with the fields passed separately
+    template <typename... Fields>
+    void WriteFields(const Fields&... fields);
+
+    /// Write all the rows of a container
+    template <typename Container>
+    void WriteRows(const Container& rows);
+
+    /// Send the rest of the data and finish the COPY.
+    /// @returns the number of rows copied
+    std::size_t Finish();
+
+private:
+    friend class Transaction;
+
+    CopyIn(detail::Connection* conn, const Query& query, OptionalCommandControl cmd_ctl);
+
+    template <typename T>
+    void WriteField(const T& value);
+
+    void StartRow(std::size_t field_count);
+    void EndRow();
+    void Flush();
+
+    detail::Connection* conn_{nullptr};
+    const UserTypes* types_{nullptr};
+    std::string buffer_;
+};
+
+/// @brief Reader of rows of a `COPY ... TO STDOUT WITH (FORMAT binary)`
+/// statement.
+///
+/// Rows are parsed with the same io parsers as query results. Each field of a
+/// row must have exactly the type of the corresponding column of the COPY
+/// output, as the binary COPY format has no type information.
+///
+/// The connection can not be used for other statements until all the rows are
+/// read. If the reader is destroyed before that, the connection is closed.
+///
+/// @snippet storages/postgres/tests/copy_pgtest.cpp CopyOut
+class CopyOut final {
+public:
+    CopyOut(CopyOut&&) noexcept;
+    CopyOut& operator=(CopyOut&&) = delete;
+    CopyOut(const CopyOut&) = delete;
+    CopyOut& operator=(const CopyOut&) = delete;
+    ~CopyOut();
+
+    /// Read the next row into `row`: a tuple, an aggregate or a type with
+    /// `Introspect()`.
+    /// @returns false if there are no more rows
+    template <typename Row>
+    bool ReadRow(Row& row);
+
+    /// Read the next row into separate fields.
+    /// @returns false if there are no more rows
+    template <typename... Fields>
+    bool ReadFields(Fields&... fields);
+
+    /// Number of rows read so far
+    std::size_t RowsRead() const noexcept { return rows_read_; }
+
+private:
+    friend class Transaction;
+
+    CopyOut(detail::Connection* conn, const Query& query, OptionalCommandControl cmd_ctl);
+
+    template <typename T>
+    void ReadField(T& value);
+
+    /// Makes a whole row available in the buffer, returns false at the end of
+    /// data
+    bool NextRow(std::size_t field_count);
+    void CheckRowEnd();
+
+    void ReadHeader();
+    void Require(std::size_t size);
+
+    detail::Connection* conn_{nullptr};
+    const UserTypes* types_{nullptr};
+    std::string buffer_;
+    std::size_t pos_{0};
+    std::size_t row_end_{0};
+    std::size_t rows_read_{0};
+    bool is_done_{false};
+};
+
+template <typename Row>
+void CopyIn::WriteRow(const Row& row) {
+    static_assert(io::traits::kIsRowType<Row>, "This type cannot be used as a row type");
+    StartRow(io::RowType<Row>::size);
+    if constexpr (io::traits::kRowCategory<Row> == io::traits::RowCategoryType::kAggregate) {
+        boost::pfr::for_each_field(row, [this](const auto& field) { WriteField(field); });
+    } else {
+        std::apply([this](const auto&... fields) { (WriteField(fields), ...); }, io::RowType<Row>::GetTuple(row));
+    }
+    EndRow();
+}
+
+template <typename... Fields>
+void CopyIn::WriteFields(const Fields&... fields) {
+    StartRow(sizeof...(Fields));
+    (WriteField(fields), ...);
+    EndRow();
+}
+
+template <typename Container>
+void CopyIn::WriteRows(const Container& rows) {
+    for (const auto& row : rows) WriteRow(row);
+}
+
+template <typename T>
+void CopyIn::WriteField(const T& value) {
+    io::WriteRawBinary(*types_, buffer_, value);
+}
+
+template <typename Row>
+bool CopyOut::ReadRow(Row& row) {
+    static_assert(io::traits::kIsRowType<Row>, "This type cannot be used as a row type");
+    if (!NextRow(io::RowType<Row>::size)) return false;
+    if constexpr (io::traits::kRowCategory<Row> == io::traits::RowCategoryType::kAggregate) {
+        boost::pfr::for_each_field(row, [this](auto& field) { ReadField(field); });
+    } else {
+        std::apply([this](auto&... fields) { (ReadField(fields), ...); }, io::RowType<Row>::GetTuple(row));
+    }
+    CheckRowEnd();
+    return true;
+}
+
+template <typename... Fields>
+bool CopyOut::ReadFields(Fields&... fields) {
+    if (!NextRow(sizeof...(Fields))) return false;
+    (ReadField(fields), ...);
+    CheckRowEnd();
+    return true;
+}
+
+template <typename T>
+void CopyOut::ReadField(T& value) {
+    static constexpr auto kCategory = io::traits::kTypeBufferCategory<T>;
+    io::FieldBuffer buffer{
+        false, kCategory, row_end_ - pos_, reinterpret_cast<const std::uint8_t*>(buffer_.data() + pos_)};
+    pos_ += buffer.ReadRaw(value, types_->GetTypeBufferCategories(), kCategory);
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
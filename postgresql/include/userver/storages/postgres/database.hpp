@@ -21,6 +21,9 @@ class Postgres;
 namespace storages::postgres {
 
 /// Object for accessing PostgreSQL database instance (sharded or not)
+///
+/// @see storages::postgres::GetClusterForKey and
+/// storages::postgres::ExecuteOnAllShards for the sharded databases
 class Database {
 public:
     /// Cluster accessor for default shard number
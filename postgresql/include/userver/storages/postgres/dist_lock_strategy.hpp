@@ -3,6 +3,7 @@
 /// @file userver/storages/postgres/dist_lock_strategy.hpp
 /// @brief @copybrief storages::postgres::DistLockStrategy
 
+#include <userver/dist_lock/dist_lock_batcher.hpp>
 #include <userver/dist_lock/dist_lock_settings.hpp>
 #include <userver/dist_lock/dist_lock_strategy.hpp>
 #include <userver/engine/deadline.hpp>
@@ -38,6 +39,26 @@ private:
     const std::string owner_prefix_;
 };
 
+/// Postgres distributed locking strategy that acquires many locks of the same
+/// table in one query, see dist_lock::DistLockBatcher
+class DistLockBatchStrategy final : public dist_lock::DistLockBatchStrategyBase {
+public:
+    DistLockBatchStrategy(ClusterPtr cluster, const std::string& table, const dist_lock::DistLockSettings& settings);
+
+    std::vector<AcquireResult> AcquireBatch(const std::vector<AcquireRequest>& requests) override;
+
+    void Release(const std::string& lock_name, const std::string& locker_id) override;
+
+    void UpdateCommandControl(CommandControl cc);
+
+private:
+    ClusterPtr cluster_;
+    rcu::Variable<CommandControl> cc_;
+    const std::string acquire_batch_query_;
+    const std::string release_query_;
+    const std::string owner_prefix_;
+};
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
@@ -6,11 +6,15 @@
 /// @ingroup userver_postgres_parse_and_format
 
 #include <array>
+#include <cstring>
 #include <iterator>
 #include <set>
+#include <string>
+#include <string_view>
 #include <unordered_set>
 #include <vector>
 
+#include <boost/endian/conversion.hpp>
 #include <boost/pfr/core.hpp>
 
 #include <userver/utils/impl/projecting_view.hpp>
@@ -18,6 +22,7 @@
 #include <userver/storages/postgres/exceptions.hpp>
 #include <userver/storages/postgres/io/buffer_io_base.hpp>
 #include <userver/storages/postgres/io/field_buffer.hpp>
+#include <userver/storages/postgres/io/integral_types.hpp>
 #include <userver/storages/postgres/io/row_types.hpp>
 #include <userver/storages/postgres/io/traits.hpp>
 #include <userver/storages/postgres/io/type_mapping.hpp>
@@ -113,6 +118,27 @@ inline bool ForceInitElementMapping() {
     }
 }
 
+/// Elements of fixed width decoded without per-element parsers
+template <typename T>
+inline constexpr bool kIsFixedWidthArrayElement = std::is_same_v<T, Smallint> || std::is_same_v<T, Integer> ||
+                                                  std::is_same_v<T, Bigint> || std::is_same_v<T, float> ||
+                                                  std::is_same_v<T, double>;
+
+/// Elements of variable width decoded without per-element parsers
+template <typename T>
+inline constexpr bool kIsTextArrayElement = std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>;
+
+template <typename T>
+T ReadBigEndian(const std::uint8_t* data) {
+    using Bits = typename IntegralType<sizeof(T)>::type;
+    Bits bits{};
+    std::memcpy(&bits, data, sizeof(bits));
+    bits = boost::endian::big_to_native(bits);
+    T value{};
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
 template <typename Container>
 struct ArrayBinaryParser : BufferParserBase<Container> {
     using BaseType = BufferParserBase<Container>;
@@ -239,6 +265,44 @@ private:
         }
     }
 
+    // Fast path for the last dimension of fixed width or text elements: the
+    // elements are decoded in place with a single allocation for the vector.
+    // NULLs and values of unexpected width go through the generic parsers to
+    // get the same results and errors.
+    template <typename T>
+    std::enable_if_t<kIsFixedWidthArrayElement<T> || kIsTextArrayElement<T>> ReadDimension(
+        FieldBuffer& buffer,
+        DimensionConstIterator dim,
+        BufferCategory elem_category,
+        const TypeBufferCategory& categories,
+        std::vector<T>& elem
+    ) {
+        constexpr auto kLengthSize = sizeof(Integer);
+        elem.resize(*dim);
+        for (auto& value : elem) {
+            if (buffer.length >= kLengthSize) {
+                const auto length = ReadBigEndian<Integer>(buffer.buffer);
+                const auto* data = buffer.buffer + kLengthSize;
+                if constexpr (kIsFixedWidthArrayElement<T>) {
+                    if (length == static_cast<Integer>(sizeof(T)) && buffer.length >= kLengthSize + sizeof(T)) {
+                        value = ReadBigEndian<T>(data);
+                        buffer.buffer += kLengthSize + sizeof(T);
+                        buffer.length -= kLengthSize + sizeof(T);
+                        continue;
+                    }
+                } else {
+                    if (length >= 0 && buffer.length - kLengthSize >= static_cast<std::size_t>(length)) {
+                        value = T(reinterpret_cast<const char*>(data), length);
+                        buffer.buffer += kLengthSize + length;
+                        buffer.length -= kLengthSize + length;
+                        continue;
+                    }
+                }
+            }
+            buffer.ReadRaw(value, categories, elem_category);
+        }
+    }
+
     void ReadDimension(
         FieldBuffer& buffer,
         DimensionConstIterator dim,
@@ -109,15 +109,35 @@ struct CommandControl {
     TimeoutDuration execute{};
     /// PostgreSQL server-side timeout
     TimeoutDuration statement{};
+    /// Maximum replication lag of a replica to be selected for the command.
+    /// Replicas lagging more are skipped, falling back to master if none is
+    /// left. Unlimited (up to TopologySettings::max_replication_lag) if not set.
+    std::optional<std::chrono::milliseconds> max_replication_lag{};
 
     constexpr CommandControl(TimeoutDuration execute, TimeoutDuration statement)
         : execute(execute), statement(statement) {}
 
-    constexpr CommandControl WithExecuteTimeout(TimeoutDuration n) const noexcept { return {n, statement}; }
+    constexpr CommandControl WithExecuteTimeout(TimeoutDuration n) const noexcept {
+        auto result = *this;
+        result.execute = n;
+        return result;
+    }
 
-    constexpr CommandControl WithStatementTimeout(TimeoutDuration s) const noexcept { return {execute, s}; }
+    constexpr CommandControl WithStatementTimeout(TimeoutDuration s) const noexcept {
+        auto result = *this;
+        result.statement = s;
+        return result;
+    }
 
-    bool operator==(const CommandControl& rhs) const { return execute == rhs.execute && statement == rhs.statement; }
+    CommandControl WithMaxReplicationLag(std::chrono::milliseconds lag) const noexcept {
+        auto result = *this;
+        result.max_replication_lag = lag;
+        return result;
+    }
+
+    bool operator==(const CommandControl& rhs) const {
+        return execute == rhs.execute && statement == rhs.statement && max_replication_lag == rhs.max_replication_lag;
+    }
 
     bool operator!=(const CommandControl& rhs) const { return !(*this == rhs); }
 };
@@ -151,6 +171,9 @@ inline constexpr std::size_t kDefaultPoolMaxQueueSize = 200;
 /// Default limit for concurrent establishing connections number
 inline constexpr std::size_t kDefaultConnectingLimit = 0;
 
+/// Default maximum number of single statements executed in one batch
+inline constexpr std::size_t kDefaultMaxQueryBatchSize = 32;
+
 /// @brief PostgreSQL topology options
 ///
 /// Dynamic option @ref POSTGRES_TOPOLOGY_SETTINGS
@@ -179,9 +202,26 @@ struct PoolSettings {
     /// Limits number of concurrent establishing connections (0 - unlimited)
     std::size_t connecting_limit{kDefaultConnectingLimit};
 
+    /// Time to wait for single-statement executions of other coroutines to
+    /// send them to the server together in a single pipeline (0 - no query
+    /// batching). Requires pipeline mode and prepared statements to be enabled,
+    /// see storages::postgres::Cluster::Execute.
+    std::chrono::microseconds query_batching_window{0};
+
+    /// Maximum number of single-statement executions in one batch
+    std::size_t max_query_batch_size{kDefaultMaxQueryBatchSize};
+
+    /// Target average time to wait for a connection (0 - no adaptive sizing).
+    /// With adaptive sizing the pool grows from `min_size` up to `max_size`
+    /// while the requests wait for connections longer than the target and
+    /// shrinks back when the connections are not needed anymore.
+    std::chrono::milliseconds adaptive_sizing_target_wait{0};
+
     bool operator==(const PoolSettings& rhs) const {
         return min_size == rhs.min_size && max_size == rhs.max_size && max_queue_size == rhs.max_queue_size &&
-               connecting_limit == rhs.connecting_limit;
+               connecting_limit == rhs.connecting_limit && query_batching_window == rhs.query_batching_window &&
+               max_query_batch_size == rhs.max_query_batch_size &&
+               adaptive_sizing_target_wait == rhs.adaptive_sizing_target_wait;
     }
 };
 
@@ -199,6 +239,18 @@ enum class PipelineMode { kDisabled, kEnabled };
 /// Dynamic option @ref POSTGRES_OMIT_DESCRIBE_IN_EXECUTE
 enum class OmitDescribeInExecuteMode { kDisabled, kEnabled };
 
+/// Pooling mode of a connection pooler between the service and PostgreSQL
+///
+/// Dynamic option @ref POSTGRES_CONNECTION_SETTINGS
+enum class ConnectionPoolerMode {
+    /// Direct connections or a pooler in session mode
+    kSession,
+    /// PgBouncer 1.21+ in transaction mode with `max_prepared_statements`
+    /// enabled. Prepared statements are managed by protocol messages only, as
+    /// the pooler renames them on the server side.
+    kTransaction,
+};
+
 /// PostgreSQL connection options
 ///
 /// Dynamic option @ref POSTGRES_CONNECTION_SETTINGS
@@ -249,11 +301,19 @@ struct ConnectionSettings {
     /// Execute discard all after establishing a new connection
     DiscardOnConnectOptions discard_on_connect = kDiscardAll;
 
+    /// Number of the most executed statements of the pool to prepare on a new
+    /// connection right after connecting, 0 to prepare statements on first use
+    std::size_t warm_up_prepared_statements = 0;
+
+    /// Pooling mode of a connection pooler between the service and PostgreSQL
+    ConnectionPoolerMode pooler_mode = ConnectionPoolerMode::kSession;
+
     /// Helps keep track of the changes in settings
     SettingsVersion version{0U};
 
     bool operator==(const ConnectionSettings& rhs) const {
-        return !RequiresConnectionReset(rhs) && recent_errors_threshold == rhs.recent_errors_threshold;
+        return !RequiresConnectionReset(rhs) && recent_errors_threshold == rhs.recent_errors_threshold &&
+               warm_up_prepared_statements == rhs.warm_up_prepared_statements;
     }
 
     bool operator!=(const ConnectionSettings& rhs) const { return !(*this == rhs); }
@@ -264,7 +324,7 @@ struct ConnectionSettings {
                ignore_unused_query_params != rhs.ignore_unused_query_params ||
                max_prepared_cache_size != rhs.max_prepared_cache_size || pipeline_mode != rhs.pipeline_mode ||
                max_ttl != rhs.max_ttl || discard_on_connect != rhs.discard_on_connect ||
-               omit_describe_mode != rhs.omit_describe_mode;
+               omit_describe_mode != rhs.omit_describe_mode || pooler_mode != rhs.pooler_mode;
     }
 };
 
@@ -278,6 +338,20 @@ struct StatementMetricsSettings final {
     bool operator==(const StatementMetricsSettings& other) const { return max_statements == other.max_statements; }
 };
 
+/// @brief Client-side cache of the results of read-only statements, see
+/// storages::postgres::Cluster::ExecuteCached
+struct ResultCacheSettings final {
+    /// Total size of the cached results in bytes, 0 disables the cache
+    std::size_t max_size_bytes{0};
+
+    /// Time a cached result is served for
+    std::chrono::milliseconds ttl{std::chrono::seconds{1}};
+
+    /// Channel to LISTEN to, any notification on it drops all the cached
+    /// results. Empty to rely on `ttl` only.
+    std::string invalidation_channel;
+};
+
 /// Initialization modes
 enum class InitMode {
     kSync = 0,
@@ -314,6 +388,9 @@ struct ClusterSettings {
 
     /// congestion control settings
     congestion_control::v2::LinearController::StaticConfig cc_config;
+
+    /// settings for the client-side result cache
+    ResultCacheSettings result_cache_settings;
 };
 
 }  // namespace storages::postgres
@@ -3,6 +3,7 @@
 /// @file userver/storages/postgres/result_set.hpp
 /// @brief Result accessors
 
+#include <algorithm>
 #include <initializer_list>
 #include <limits>
 #include <memory>
@@ -11,6 +12,7 @@
 #include <type_traits>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -237,7 +239,14 @@ public:
     size_type To(T&& val) const {
         using ValueType = typename std::decay<T>::type;
         auto fb = GetBuffer();
-        return ReadNullable(fb, std::forward<T>(val), io::traits::IsNullable<ValueType>{});
+        return ReadNullable(fb, GetTypeBufferCategories(), std::forward<T>(val), io::traits::IsNullable<ValueType>{});
+    }
+
+    /// Read the field from its buffer that was fetched in advance
+    template <typename T>
+    size_type To(const io::FieldBuffer& buffer, const io::TypeBufferCategory& categories, T&& val) const {
+        using ValueType = typename std::decay<T>::type;
+        return ReadNullable(buffer, categories, std::forward<T>(val), io::traits::IsNullable<ValueType>{});
     }
 
 private:
@@ -247,33 +256,43 @@ private:
     const io::TypeBufferCategory& GetTypeBufferCategories() const;
 
     template <typename T>
-    size_type ReadNullable(const io::FieldBuffer& fb, T&& val, std::true_type) const {
+    size_type ReadNullable(
+        const io::FieldBuffer& fb,
+        const io::TypeBufferCategory& categories,
+        T&& val,
+        std::true_type
+    ) const {
         using ValueType = typename std::decay<T>::type;
         using NullSetter = io::traits::GetSetNull<ValueType>;
         if (fb.is_null) {
             NullSetter::SetNull(val);
         } else {
-            Read(fb, std::forward<T>(val));
+            Read(fb, categories, std::forward<T>(val));
         }
         return fb.length;
     }
 
     template <typename T>
-    size_type ReadNullable(const io::FieldBuffer& buffer, T&& val, std::false_type) const {
+    size_type ReadNullable(
+        const io::FieldBuffer& buffer,
+        const io::TypeBufferCategory& categories,
+        T&& val,
+        std::false_type
+    ) const {
         if (buffer.is_null) {
             throw FieldValueIsNull{field_index_, Name(), val};
         } else {
-            Read(buffer, std::forward<T>(val));
+            Read(buffer, categories, std::forward<T>(val));
         }
         return buffer.length;
     }
 
     template <typename T>
-    void Read(const io::FieldBuffer& buffer, T&& val) const {
+    void Read(const io::FieldBuffer& buffer, const io::TypeBufferCategory& categories, T&& val) const {
         using ValueType = typename std::decay<T>::type;
         io::traits::CheckParser<ValueType>();
         try {
-            io::ReadBuffer(buffer, std::forward<T>(val), GetTypeBufferCategories());
+            io::ReadBuffer(buffer, std::forward<T>(val), categories);
         } catch (InvalidInputBufferSize& ex) {
             // InvalidInputBufferSize is not descriptive. Enriching with OID information and C++ types info
             ex.AddMsgPrefix(fmt::format(
@@ -718,6 +737,17 @@ private:
     void FillBufferCategories(const UserTypes& types);
     void SetBufferCategoriesFrom(const ResultSet&);
 
+    /// Fetch the buffers of the first `field_count` fields of `row_count` rows
+    /// starting from `first_row`, row by row
+    void FillFieldBuffers(size_type first_row, size_type row_count, size_type field_count, io::FieldBuffer* buffers)
+        const;
+    const io::TypeBufferCategory& GetTypeBufferCategories() const;
+
+    /// Decode all the rows into the container with the field buffers fetched
+    /// in batches, `decode_row` reads a single row from its buffers
+    template <typename T, size_type kFieldCount, typename Container, typename RowDecoder>
+    void DecodeRows(Container& container, RowDecoder decode_row) const;
+
     template <typename T, typename Tag>
     friend class TypedResultSet;
     friend class ConnectionImpl;
@@ -809,6 +839,29 @@ template <typename... T>
 struct TupleDataExtractor<std::tuple<T...>> : RowDataExtractorBase<std::index_sequence_for<T...>, T...> {};
 //@}
 
+/// Number of rows whose field buffers are fetched from the result at once by
+/// ResultSet::AsContainer
+inline constexpr std::size_t kDecodeRowsBatchSize = 256;
+
+/// Reads the fields of a row from the buffers fetched in advance, without
+/// looking up each field in the result
+template <typename IndexTuple>
+struct RowBuffersDecoder;
+
+template <std::size_t... Indexes>
+struct RowBuffersDecoder<std::index_sequence<Indexes...>> {
+    template <typename Tuple>
+    static void Decode(
+        const ResultWrapper& res,
+        std::size_t row_index,
+        const io::FieldBuffer* buffers,
+        const io::TypeBufferCategory& categories,
+        Tuple&& tuple
+    ) {
+        (FieldView{res, row_index, Indexes}.To(buffers[Indexes], categories, std::get<Indexes>(tuple)), ...);
+    }
+};
+
 template <typename RowType>
 constexpr void AssertRowTypeIsMappedToPgOrIsCompositeType() {
     // composite types can be parsed without an explicit mapping
@@ -949,22 +1002,51 @@ auto ResultSet::AsSetOf(FieldTag) const {
     return TypedResultSet<T, FieldTag>{*this};
 }
 
+template <typename T, ResultSet::size_type kFieldCount, typename Container, typename RowDecoder>
+void ResultSet::DecodeRows(Container& container, RowDecoder decode_row) const {
+    const auto size = Size();
+    if (size == 0) return;
+    if constexpr (io::traits::kCanReserve<Container>) {
+        container.reserve(size);
+    }
+
+    const auto& categories = GetTypeBufferCategories();
+    std::vector<io::FieldBuffer> buffers(std::min(size, detail::kDecodeRowsBatchSize) * kFieldCount);
+    auto inserter = io::traits::Inserter(container);
+    for (size_type first_row = 0; first_row < size; first_row += detail::kDecodeRowsBatchSize) {
+        const auto row_count = std::min(size - first_row, detail::kDecodeRowsBatchSize);
+        FillFieldBuffers(first_row, row_count, kFieldCount, buffers.data());
+        for (size_type i = 0; i < row_count; ++i, ++inserter) {
+            T value{};
+            decode_row(first_row + i, buffers.data() + i * kFieldCount, categories, value);
+            *inserter = std::move(value);
+        }
+    }
+}
+
 template <typename Container>
 Container ResultSet::AsContainer() const {
     detail::AssertSaneTypeToDeserialize<Container>();
     using ValueType = typename Container::value_type;
-    Container c;
-    if constexpr (io::traits::kCanReserve<Container>) {
-        c.reserve(Size());
+    detail::AssertRowTypeIsMappedToPgOrIsCompositeType<ValueType>();
+    if (FieldCount() > 1) {
+        throw NonSingleColumnResultSet{FieldCount(), compiler::GetTypeName<ValueType>(), "AsContainer"};
     }
-    auto res = AsSetOf<ValueType>();
 
-    auto inserter = io::traits::Inserter(c);
-    auto row_it = res.begin();
-    for (std::size_t i = 0; i < res.Size(); ++i, ++row_it, ++inserter) {
-        *inserter = *row_it;
+    Container c;
+    if (IsEmpty()) return c;
+    if (FieldCount() < 1) {
+        throw InvalidTupleSizeRequested{FieldCount(), 1};
     }
-
+    DecodeRows<ValueType, 1>(
+        c,
+        [&res = *pimpl_](
+            size_type row_index,
+            const io::FieldBuffer* buffers,
+            const io::TypeBufferCategory& categories,
+            ValueType& value
+        ) { FieldView{res, row_index, 0}.To(buffers[0], categories, value); }
+    );
     return c;
 }
 
@@ -972,18 +1054,33 @@ template <typename Container>
 Container ResultSet::AsContainer(RowTag) const {
     detail::AssertSaneTypeToDeserialize<Container>();
     using ValueType = typename Container::value_type;
-    Container c;
-    if constexpr (io::traits::kCanReserve<Container>) {
-        c.reserve(Size());
-    }
-    auto res = AsSetOf<ValueType>(kRowTag);
+    io::traits::AssertIsValidRowType<ValueType>();
+    using RowType = io::RowType<ValueType>;
+    constexpr auto tuple_size = RowType::size;
 
-    auto inserter = io::traits::Inserter(c);
-    auto row_it = res.begin();
-    for (std::size_t i = 0; i < res.Size(); ++i, ++row_it, ++inserter) {
-        *inserter = *row_it;
+    Container c;
+    if (IsEmpty()) return c;
+    // the row size is checked once for the whole result
+    if (tuple_size > FieldCount()) {
+        throw InvalidTupleSizeRequested(FieldCount(), tuple_size);
+    } else if (tuple_size < FieldCount()) {
+        LOG_LIMITED_WARNING() << "Row size is greater that the number of data members in "
+                                 "C++ user datatype "
+                              << compiler::GetTypeName<ValueType>();
     }
-
+    DecodeRows<ValueType, tuple_size>(
+        c,
+        [&res = *pimpl_](
+            size_type row_index,
+            const io::FieldBuffer* buffers,
+            const io::TypeBufferCategory& categories,
+            ValueType& value
+        ) {
+            detail::RowBuffersDecoder<std::make_index_sequence<tuple_size>>::Decode(
+                res, row_index, buffers, categories, RowType::GetTuple(value)
+            );
+        }
+    );
     return c;
 }
 
@@ -0,0 +1,115 @@
+#pragma once
+
+/// @file userver/storages/postgres/result_stream.hpp
+/// @brief Consumption of query results as the rows arrive
+
+#include <cstddef>
+#include <optional>
+
+#include <userver/storages/postgres/detail/connection_ptr.hpp>
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/detail/time_types.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace detail {
+class ConnectionPool;
+}  // namespace detail
+
+/// Default number of rows in a chunk of a ResultStream
+inline constexpr std::size_t kDefaultResultStreamChunkSize = 1000;
+
+/// @brief Reader of the rows of a query as they are received from the server.
+///
+/// Unlike Execute(), the result is not buffered as a whole: the rows are
+/// received in chunks of up to the requested size (libpq chunked rows mode,
+/// or a single row per chunk with libpq older than 17) and each chunk can be
+/// parsed while the next one is in transit. Unlike a Portal, the stream does
+/// not need an explicit transaction and makes a single round-trip.
+///
+/// The connection can not be used for other statements until all the chunks
+/// are fetched. If the stream is destroyed before that, the connection is
+/// closed.
+///
+/// @snippet storages/postgres/tests/result_stream_pgtest.cpp ResultStream
+class ResultStream final {
+public:
+    ResultStream(ResultStream&&) noexcept;
+    ResultStream& operator=(ResultStream&&) = delete;
+    ResultStream(const ResultStream&) = delete;
+    ResultStream& operator=(const ResultStream&) = delete;
+    ~ResultStream();
+
+    /// Fetch the next chunk of rows.
+    /// @returns std::nullopt if there are no more rows
+    std::optional<ResultSet> FetchChunk();
+
+    /// Fetch the next chunk of rows as a set of rows of type T.
+    /// @returns std::nullopt if there are no more rows
+    template <typename T>
+    std::optional<TypedResultSet<T, RowTag>> FetchChunkAs(RowTag);
+
+    /// Fetch the next chunk of a single-column result as a set of values of
+    /// type T.
+    /// @returns std::nullopt if there are no more rows
+    template <typename T>
+    std::optional<TypedResultSet<T, FieldTag>> FetchChunkAs();
+
+    bool Done() const noexcept { return is_done_; }
+    std::size_t FetchedSoFar() const noexcept { return fetched_so_far_; }
+
+    explicit operator bool() const noexcept { return !Done(); }
+
+private:
+    friend class Transaction;
+    friend class detail::ConnectionPool;
+
+    ResultStream(
+        detail::Connection* conn,
+        const Query& query,
+        const detail::QueryParameters& params,
+        OptionalCommandControl cmd_ctl,
+        std::size_t chunk_size
+    );
+    ResultStream(
+        detail::ConnectionPtr&& conn,
+        detail::SteadyClock::time_point start_time,
+        const Query& query,
+        const detail::QueryParameters& params,
+        OptionalCommandControl cmd_ctl,
+        std::size_t chunk_size
+    );
+
+    void Start(const Query& query, const detail::QueryParameters& params, OptionalCommandControl cmd_ctl);
+    void ReleaseConnection() noexcept;
+
+    // set for streams of single statements that own the connection
+    std::optional<detail::ConnectionPtr> owned_conn_;
+    detail::Connection* conn_{nullptr};
+    std::size_t chunk_size_{kDefaultResultStreamChunkSize};
+    std::size_t fetched_so_far_{0};
+    bool is_done_{false};
+};
+
+template <typename T>
+std::optional<TypedResultSet<T, RowTag>> ResultStream::FetchChunkAs(RowTag) {
+    auto chunk = FetchChunk();
+    if (!chunk) return std::nullopt;
+    return chunk->AsSetOf<T>(kRowTag);
+}
+
+template <typename T>
+std::optional<TypedResultSet<T, FieldTag>> ResultStream::FetchChunkAs() {
+    auto chunk = FetchChunk();
+    if (!chunk) return std::nullopt;
+    return chunk->AsSetOf<T>(kFieldTag);
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
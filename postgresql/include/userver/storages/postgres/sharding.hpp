@@ -0,0 +1,121 @@
+#pragma once
+
+/// @file userver/storages/postgres/sharding.hpp
+/// @brief Routing of the keys to the shards and execution on all the shards
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/storages/postgres/database.hpp>
+#include <userver/storages/postgres/postgres_fwd.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/result_store.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @brief Returns the shard of the key among `shard_count` shards.
+///
+/// Uses rendezvous (highest random weight) hashing: when a shard is added,
+/// only the keys that move to the new shard change their shard, about
+/// `1 / shard_count` of them. The mapping does not depend on the process, the
+/// platform or the standard library and may be used for persistent data.
+///
+/// @throws std::invalid_argument if `shard_count` is zero
+std::size_t GetShardForKey(std::string_view key, std::size_t shard_count);
+
+/// @brief Cluster accessor for the shard of the key
+/// @see storages::postgres::GetShardForKey
+ClusterPtr GetClusterForKey(const Database& database, std::string_view key);
+
+namespace detail {
+
+template <typename Func>
+auto RunOnShards(std::size_t shard_count, engine::Deadline deadline, Func& func) {
+    using Result = std::invoke_result_t<Func&, std::size_t>;
+
+    std::vector<engine::TaskWithResult<Result>> tasks;
+    tasks.reserve(shard_count);
+    for (std::size_t shard = 0; shard < shard_count; ++shard) {
+        tasks.push_back(USERVER_NAMESPACE::utils::Async("pg_execute_on_shard", std::ref(func), shard));
+    }
+
+    for (auto& task : tasks) {
+        task.WaitUntil(deadline);
+    }
+    for (auto& task : tasks) {
+        if (!task.IsFinished()) task.RequestCancel();
+    }
+
+    std::vector<USERVER_NAMESPACE::utils::ResultStore<Result>> results(shard_count);
+    for (std::size_t shard = 0; shard < shard_count; ++shard) {
+        // throws only if the current task is cancelled
+        tasks[shard].Wait();
+        try {
+            if constexpr (std::is_void_v<Result>) {
+                tasks[shard].Get();
+                results[shard].SetValue();
+            } else {
+                results[shard].SetValue(tasks[shard].Get());
+            }
+        } catch (const std::exception&) {
+            results[shard].SetException(std::current_exception());
+        }
+    }
+    return results;
+}
+
+}  // namespace detail
+
+/// @brief Runs `func(shard, cluster)` for all the shards of the database
+/// concurrently and waits for the results.
+///
+/// Each shard is processed in a separate task. The tasks that have not
+/// finished by the deadline are cancelled, which interrupts their queries.
+/// The deadline does not limit the individual queries, pass the
+/// storages::postgres::CommandControl to them as usual.
+///
+/// @returns the results in the order of the shards. A failed or cancelled
+/// shard does not affect the other ones, its utils::ResultStore rethrows the
+/// exception.
+/// @throws engine::WaitInterruptedException if the current task is cancelled,
+/// the tasks are cancelled and awaited in this case
+///
+/// Example usage:
+/// @code
+/// auto results = pg::ExecuteOnAllShards(
+///     database, engine::Deadline::FromDuration(std::chrono::milliseconds{300}),
+///     [](std::size_t, pg::Cluster& cluster) {
+///         return cluster.Execute(pg::ClusterHostType::kSlave, kCountQuery).AsSingleRow<std::int64_t>();
+///     });
+/// std::int64_t total = 0;
+/// for (auto& result : results) {
+///     try {
+///         total += result.Retrieve();
+///     } catch (const std::exception& ex) {
+///         LOG_WARNING() << "Shard is unavailable: " << ex;
+///     }
+/// }
+/// @endcode
+template <typename Func>
+auto ExecuteOnAllShards(const Database& database, engine::Deadline deadline, Func&& func) {
+    std::vector<ClusterPtr> clusters;
+    clusters.reserve(database.GetShardCount());
+    for (std::size_t shard = 0; shard < database.GetShardCount(); ++shard) {
+        clusters.push_back(database.GetClusterForShard(shard));
+    }
+
+    auto shard_func = [&func, &clusters](std::size_t shard) { return func(shard, *clusters[shard]); };
+    return detail::RunOnShards(clusters.size(), deadline, shard_func);
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
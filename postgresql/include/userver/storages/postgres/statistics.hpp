@@ -3,6 +3,8 @@
 /// @file userver/storages/postgres/statistics.hpp
 /// @brief Statistics helpers
 
+#include <cstdint>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -93,6 +95,38 @@ struct ConnectionStatistics {
 };
 
 /// @brief Template instance topology statistics storage
+template <typename Counter, typename MmaAccumulator>
+struct QueryBatchingStatistics {
+    /// Number of batches of single statements sent
+    Counter batches_total = 0;
+    /// Number of single statements sent in batches
+    Counter queries_total = 0;
+    /// Batch size min-max-avg
+    MmaAccumulator batch_size;
+};
+
+/// @brief Template host selection statistics storage
+template <typename Counter>
+struct HostSelectionStatistics {
+    /// Number of times the host was selected for a transaction or a statement
+    Counter selected_total = 0;
+    /// Number of times the host was skipped due to
+    /// CommandControl::max_replication_lag
+    Counter lagging_skipped_total = 0;
+};
+
+/// @brief Template adaptive pool sizing statistics storage
+template <typename Counter>
+struct AdaptiveSizingStatistics {
+    /// Current limit of the pool size, see
+    /// PoolSettings::adaptive_sizing_target_wait
+    Counter size = 0;
+    /// Number of times the pool size limit was increased
+    Counter grow_total = 0;
+    /// Number of times the pool size limit was decreased
+    Counter shrink_total = 0;
+};
+
 template <typename MmaAccumulator>
 struct InstanceTopologyStatistics {
     /// Roundtrip time min-max-avg
@@ -110,6 +144,12 @@ struct InstanceStatisticsTemplate {
     TransactionStatistics<Counter, PercentileAccumulator> transaction;
     /// Topology statistics
     InstanceTopologyStatistics<MmaAccumulator> topology;
+    /// Single statements batching statistics
+    QueryBatchingStatistics<Counter, MmaAccumulator> batching;
+    /// Host selection statistics
+    HostSelectionStatistics<Counter> host_selection;
+    /// Adaptive pool sizing statistics
+    AdaptiveSizingStatistics<Counter> adaptive_sizing;
     /// Error caused by pool exhaustion
     Counter pool_exhaust_errors = 0;
     /// Error caused by queue size overflow
@@ -185,6 +225,17 @@ struct InstanceStatisticsNonatomic : InstanceStatisticsNonatomicBase {
         transaction.wait_end_percentile = stats.transaction.wait_end_percentile.GetStatsForPeriod();
         transaction.return_to_pool_percentile = stats.transaction.return_to_pool_percentile.GetStatsForPeriod();
 
+        batching.batches_total = stats.batching.batches_total;
+        batching.queries_total = stats.batching.queries_total;
+        batching.batch_size = stats.batching.batch_size.GetStatsForPeriod();
+
+        host_selection.selected_total = stats.host_selection.selected_total;
+        host_selection.lagging_skipped_total = stats.host_selection.lagging_skipped_total;
+
+        adaptive_sizing.size = stats.adaptive_sizing.size;
+        adaptive_sizing.grow_total = stats.adaptive_sizing.grow_total;
+        adaptive_sizing.shrink_total = stats.adaptive_sizing.shrink_total;
+
         topology.roundtrip_time = topology_stats.roundtrip_time.GetStatsForPeriod();
         topology.replication_lag = topology_stats.replication_lag.GetStatsForPeriod();
 
@@ -218,6 +269,33 @@ struct InstanceStatsDescriptor {
     InstanceStatisticsNonatomic stats;
 };
 
+/// @brief Client-side result cache statistics of a named statement
+struct ResultCacheStatementStatistics final {
+    /// Number of executions served from the cache
+    std::uint64_t hits{0};
+    /// Number of executions sent to the database
+    std::uint64_t misses{0};
+};
+
+/// @brief Client-side result cache statistics, see
+/// storages::postgres::Cluster::ExecuteCached
+struct ResultCacheStatistics final {
+    /// The cache is enabled in the static config
+    bool enabled{false};
+    /// Total size of the cached results in bytes
+    std::size_t size_bytes{0};
+    /// Number of the cached results
+    std::size_t entries{0};
+    /// Number of executions served from the cache
+    std::uint64_t hits{0};
+    /// Number of executions sent to the database
+    std::uint64_t misses{0};
+    /// Number of times all the cached results were dropped by a notification
+    std::uint64_t invalidations{0};
+    /// Hits and misses of the named statements
+    std::unordered_map<std::string, ResultCacheStatementStatistics> per_statement;
+};
+
 /// @brief Cluster statistics storage
 struct ClusterStatistics {
     /// Connlimit mode auto is on
@@ -230,6 +308,8 @@ struct ClusterStatistics {
     std::vector<InstanceStatsDescriptor> slaves;
     /// Unknown/unreachable instances statistics
     std::vector<InstanceStatsDescriptor> unknown;
+    /// Client-side result cache statistics
+    ResultCacheStatistics result_cache;
 };
 
 // InstanceStatisticsNonatomic values support for utils::statistics::Writer
@@ -238,6 +318,9 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const Inst
 /// @brief InstanceStatsDescriptor values support for utils::statistics::Writer
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const InstanceStatsDescriptor& value);
 
+/// @brief ResultCacheStatistics values support for utils::statistics::Writer
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const ResultCacheStatistics& value);
+
 /// @brief ClusterStatistics values support for utils::statistics::Writer
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const ClusterStatistics& value);
 
@@ -6,6 +6,7 @@
 #include <memory>
 #include <string>
 
+#include <userver/storages/postgres/copy.hpp>
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
@@ -15,6 +16,7 @@
 #include <userver/storages/postgres/postgres_fwd.hpp>
 #include <userver/storages/postgres/query.hpp>
 #include <userver/storages/postgres/result_set.hpp>
+#include <userver/storages/postgres/result_stream.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -293,6 +295,81 @@ public:
     /// and per-statement command control.
     Portal MakePortal(OptionalCommandControl statement_cmd_ctl, const Query& query, const ParameterStore& store);
 
+    /// Start a `COPY ... FROM STDIN WITH (FORMAT binary)` statement and return
+    /// the writer of its rows.
+    ///
+    /// COPY is much faster than INSERT for bulk loads and has no limit on the
+    /// amount of data.
+    ///
+    /// @snippet storages/postgres/tests/copy_pgtest.cpp CopyIn
+    CopyIn MakeCopyIn(const Query& query) { return MakeCopyIn(OptionalCommandControl{}, query); }
+
+    /// Start a `COPY ... FROM STDIN WITH (FORMAT binary)` statement with
+    /// per-statement command control. The network timeout applies to every
+    /// chunk of data sent, the statement timeout applies to the whole COPY.
+    CopyIn MakeCopyIn(OptionalCommandControl statement_cmd_ctl, const Query& query);
+
+    /// Copy all the rows of a container with a
+    /// `COPY ... FROM STDIN WITH (FORMAT binary)` statement.
+    /// @returns the number of rows copied
+    template <typename Container>
+    std::size_t CopyFrom(const Query& query, const Container& rows) {
+        return CopyFrom(OptionalCommandControl{}, query, rows);
+    }
+
+    /// Copy all the rows of a container with a
+    /// `COPY ... FROM STDIN WITH (FORMAT binary)` statement with per-statement
+    /// command control.
+    /// @returns the number of rows copied
+    template <typename Container>
+    std::size_t CopyFrom(OptionalCommandControl statement_cmd_ctl, const Query& query, const Container& rows) {
+        auto copy = MakeCopyIn(std::move(statement_cmd_ctl), query);
+        copy.WriteRows(rows);
+        return copy.Finish();
+    }
+
+    /// Start a `COPY ... TO STDOUT WITH (FORMAT binary)` statement and return
+    /// the reader of its rows.
+    ///
+    /// @snippet storages/postgres/tests/copy_pgtest.cpp CopyOut
+    CopyOut MakeCopyOut(const Query& query) { return MakeCopyOut(OptionalCommandControl{}, query); }
+
+    /// Start a `COPY ... TO STDOUT WITH (FORMAT binary)` statement with
+    /// per-statement command control. The network timeout applies to every
+    /// chunk of data received, the statement timeout applies to the whole COPY.
+    CopyOut MakeCopyOut(OptionalCommandControl statement_cmd_ctl, const Query& query);
+
+    /// Execute a statement with arbitrary parameters and return the stream of
+    /// its rows, that are received and can be parsed in chunks as they arrive
+    /// instead of being buffered as a whole.
+    ///
+    /// @snippet storages/postgres/tests/result_stream_pgtest.cpp ResultStream
+    template <typename... Args>
+    ResultStream MakeResultStream(const Query& query, const Args&... args) {
+        return MakeResultStream(OptionalCommandControl{}, query, args...);
+    }
+
+    /// Execute a statement with arbitrary parameters and per-statement command
+    /// control and return the stream of its rows. The network timeout applies
+    /// to every chunk of rows received.
+    template <typename... Args>
+    ResultStream MakeResultStream(OptionalCommandControl statement_cmd_ctl, const Query& query, const Args&... args) {
+        detail::StaticQueryParameters<sizeof...(args)> params;
+        params.Write(GetConnectionUserTypes(), args...);
+        return DoMakeResultStream(
+            query, detail::QueryParameters{params}, std::move(statement_cmd_ctl), kDefaultResultStreamChunkSize
+        );
+    }
+
+    /// Execute a statement with stored parameters and return the stream of its
+    /// rows in chunks of up to `chunk_size` rows.
+    ResultStream MakeResultStream(
+        OptionalCommandControl statement_cmd_ctl,
+        std::size_t chunk_size,
+        const Query& query,
+        const ParameterStore& store
+    );
+
     /// Set a connection parameter
     /// https://www.postgresql.org/docs/current/sql-set.html
     /// The parameter is set for this transaction only
@@ -324,6 +401,13 @@ private:
         OptionalCommandControl statement_cmd_ctl
     );
 
+    ResultStream DoMakeResultStream(
+        const Query& query,
+        const detail::QueryParameters& params,
+        OptionalCommandControl statement_cmd_ctl,
+        std::size_t chunk_size
+    );
+
     const UserTypes& GetConnectionUserTypes() const;
 
     std::string name_;
@@ -28,6 +28,18 @@ properties:
         type: integer
         description: number of rows to request from PostgreSQL, 0 to fetch all rows in one request
         defaultDescription: 1000
+    full-update-partitions:
+        type: integer
+        description: number of partitions of each shard to fetch and parse concurrently during a full update, requires kPartitionField in the policy
+        defaultDescription: 1
+    full-update-parallelism:
+        type: integer
+        description: max number of partitions fetched at the same time
+        defaultDescription: full-update-partitions
+    full-update-streaming:
+        type: boolean
+        description: receive the rows of a non-partitioned full update in chunks of chunk-size rows and parse each chunk while the next one is in transit
+        defaultDescription: false
     pgcomponent:
         type: string
         description: PostgreSQL component name
@@ -71,6 +71,12 @@ struct PostgresExamplePolicy {
     // Required: no
     static constexpr const char* kWhere = "id > 10";
 
+    // Name of an integer field to split the full update query by, see
+    // `full-update-partitions` static config option.
+    //
+    // Required: no
+    static constexpr const char* kPartitionField = "id";
+
     // Cache container type.
     //
     // It can be of any map type. The default is `unordered_map`, it is not
@@ -118,6 +124,8 @@ struct PostgresExamplePolicy2 {
 static_assert(pg_cache::detail::kHasName<PostgresExamplePolicy>);
 static_assert(pg_cache::detail::kHasQuery<PostgresExamplePolicy>);
 static_assert(pg_cache::detail::kHasKeyMember<PostgresExamplePolicy>);
+static_assert(pg_cache::detail::kHasPartitionField<PostgresExamplePolicy>);
+static_assert(!pg_cache::detail::kHasPartitionField<PostgresExamplePolicy2>);
 
 static_assert((std::is_same<pg_cache::detail::KeyMemberType<PostgresExamplePolicy>, int>{}));
 static_assert((std::is_same<pg_cache::detail::KeyMemberType<PostgresExamplePolicy2>, int>{}));
@@ -102,6 +102,17 @@ detail::NonTransaction Cluster::Start(ClusterHostTypeFlags flags, OptionalComman
     return pimpl_->Start(flags, cmd_ctl);
 }
 
+bool Cluster::IsQueryBatchingEnabled() const { return pimpl_->IsQueryBatchingEnabled(); }
+
+ResultSet Cluster::ExecuteBatched(
+    ClusterHostTypeFlags flags,
+    OptionalCommandControl statement_cmd_ctl,
+    const Query& query,
+    ParamsWriter params
+) {
+    return pimpl_->ExecuteBatched(flags, statement_cmd_ctl, query, params);
+}
+
 OptionalCommandControl Cluster::GetQueryCmdCtl(const std::string& query_name) const {
     return pimpl_->GetQueryCmdCtl(query_name);
 }
@@ -124,10 +135,58 @@ ResultSet Cluster::Execute(
         statement_cmd_ctl = GetQueryCmdCtl(query.GetName()->GetUnderlying());
     }
     statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
+    if (IsQueryBatchingEnabled()) {
+        return ExecuteBatched(flags, statement_cmd_ctl, query, [&store](const UserTypes&) {
+            return detail::QueryParameters{store.GetInternalData()};
+        });
+    }
     auto ntrx = Start(flags, statement_cmd_ctl);
     return ntrx.Execute(statement_cmd_ctl, query.Statement(), store);
 }
 
+ResultSet Cluster::ExecuteCached(
+    ClusterHostTypeFlags flags,
+    OptionalCommandControl statement_cmd_ctl,
+    const Query& query,
+    const ParameterStore& store
+) {
+    auto& cache = pimpl_->GetResultCache();
+    if (!cache.IsEnabled()) return Execute(flags, statement_cmd_ctl, query, store);
+
+    const detail::QueryParameters params{store.GetInternalData()};
+    if (auto cached = cache.Get(query, params)) return *std::move(cached);
+
+    auto result = Execute(flags, statement_cmd_ctl, query, store);
+    cache.Put(query, params, result);
+    return result;
+}
+
+ResultStream Cluster::MakeResultStream(
+    ClusterHostTypeFlags flags,
+    OptionalCommandControl statement_cmd_ctl,
+    std::size_t chunk_size,
+    const Query& query,
+    const ParameterStore& store
+) {
+    return DoMakeResultStream(flags, statement_cmd_ctl, chunk_size, query, [&store](const UserTypes&) {
+        return detail::QueryParameters{store.GetInternalData()};
+    });
+}
+
+ResultStream Cluster::DoMakeResultStream(
+    ClusterHostTypeFlags flags,
+    OptionalCommandControl statement_cmd_ctl,
+    std::size_t chunk_size,
+    const Query& query,
+    ParamsWriter params
+) {
+    if (!statement_cmd_ctl && query.GetName()) {
+        statement_cmd_ctl = GetQueryCmdCtl(query.GetName()->GetUnderlying());
+    }
+    statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
+    return pimpl_->MakeResultStream(flags, statement_cmd_ctl, chunk_size, query, params);
+}
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
@@ -87,6 +87,11 @@ Postgres::Postgres(const ComponentConfig& config, const ComponentContext& contex
     initial_settings_.topology_settings.max_replication_lag =
         config["max_replication_lag"].As<std::chrono::milliseconds>(storages::postgres::kDefaultMaxReplicationLag);
 
+    auto& result_cache_settings = initial_settings_.result_cache_settings;
+    result_cache_settings.max_size_bytes = config["result_cache_size_bytes"].As<std::size_t>(0);
+    result_cache_settings.ttl = config["result_cache_ttl"].As<std::chrono::milliseconds>(result_cache_settings.ttl);
+    result_cache_settings.invalidation_channel = config["result_cache_invalidation_channel"].As<std::string>("");
+
     initial_settings_.pool_settings =
         pg_config.pool_settings.GetOptional(name_).value_or(config.As<storages::postgres::PoolSettings>());
     initial_settings_.conn_settings =
@@ -276,6 +281,21 @@ properties:
         type: integer
         description: prepared statements cache size limit
         defaultDescription: 5000
+    warm-up-prepared-statements:
+        type: integer
+        minimum: 0
+        description: number of the most executed statements of the pool to prepare on new connections
+        defaultDescription: 0
+    pooler-mode:
+        type: string
+        enum:
+          - session
+          - transaction
+        description: |
+            pooling mode of a connection pooler between the service and
+            the database, use 'transaction' for PgBouncer 1.21+ in transaction
+            mode with max_prepared_statements enabled
+        defaultDescription: session
     max_statement_metrics:
         type: integer
         description: limit of exported metrics for named statements
@@ -317,6 +337,41 @@ properties:
         type: integer
         description: limit for concurrent establishing connections number per pool (0 - unlimited)
         defaultDescription: 0
+    query_batching_window_us:
+        type: integer
+        minimum: 0
+        description: |
+            time in microseconds to wait for single-statement executions of
+            other coroutines to send them in a single pipeline (0 - disabled),
+            requires pipeline mode
+        defaultDescription: 0
+    max_query_batch_size:
+        type: integer
+        minimum: 1
+        description: maximum number of single-statement executions in one batch
+        defaultDescription: 32
+    adaptive_sizing_target_wait_ms:
+        type: integer
+        minimum: 0
+        description: |
+            target average time in milliseconds to wait for a connection, the
+            pool grows from min_pool_size up to max_pool_size while the waits
+            are longer and shrinks back when idle (0 - disabled)
+        defaultDescription: 0
+    result_cache_size_bytes:
+        type: integer
+        minimum: 0
+        description: |
+            total size of the results cached by
+            storages::postgres::Cluster::ExecuteCached (0 - disabled)
+        defaultDescription: 0
+    result_cache_ttl:
+        type: string
+        description: time to serve a cached result for
+        defaultDescription: 1s
+    result_cache_invalidation_channel:
+        type: string
+        description: channel to LISTEN to, any notification on it drops all the cached results
     connlimit_mode:
         type: string
         enum:
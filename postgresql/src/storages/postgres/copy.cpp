@@ -0,0 +1,194 @@
+#include <userver/storages/postgres/copy.hpp>
+
+#include <string_view>
+#include <utility>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace {
+
+// https://www.postgresql.org/docs/current/sql-copy.html#id-1.9.3.55.9.4
+constexpr std::string_view kBinarySignature{"PGCOPY\n\377\r\n\0", 11};
+// signature, flags field and header extension area length
+constexpr std::size_t kHeaderSize = kBinarySignature.size() + 4 + 4;
+constexpr Smallint kTrailer = -1;
+
+// Data is sent to the server in chunks of this size
+constexpr std::size_t kCopyInChunkSize = 64 * 1024;
+
+template <typename T>
+T ReadBigEndian(const std::string& buffer, std::size_t pos) {
+    T value{};
+    io::ReadBuffer(
+        io::FieldBuffer{
+            false,
+            io::BufferCategory::kPlainBuffer,
+            sizeof(T),
+            reinterpret_cast<const std::uint8_t*>(buffer.data() + pos)},
+        value
+    );
+    return value;
+}
+
+}  // namespace
+
+CopyIn::CopyIn(detail::Connection* conn, const Query& query, OptionalCommandControl cmd_ctl)
+    : conn_{conn}, types_{&conn->GetUserTypes()} {
+    if (!cmd_ctl) cmd_ctl = conn_->GetQueryCmdCtl(query.GetName());
+    conn_->StartCopyIn(query, std::move(cmd_ctl));
+
+    buffer_.reserve(kCopyInChunkSize + kCopyInChunkSize / 4);
+    buffer_.append(kBinarySignature);
+    io::WriteBuffer(*types_, buffer_, Integer{0});  // flags
+    io::WriteBuffer(*types_, buffer_, Integer{0});  // header extension length
+}
+
+CopyIn::CopyIn(CopyIn&& other) noexcept
+    : conn_{std::exchange(other.conn_, nullptr)}, types_{other.types_}, buffer_{std::move(other.buffer_)} {}
+
+CopyIn::~CopyIn() {
+    if (!conn_) return;
+    LOG_WARNING() << "COPY FROM STDIN was not finished, aborting it";
+    try {
+        conn_->FinishCopyIn("COPY FROM STDIN was not finished by the client");
+    } catch (const std::exception& e) {
+        // the server replies with an error on abort
+        LOG_DEBUG() << "COPY FROM STDIN aborted: " << e;
+    }
+}
+
+std::size_t CopyIn::Finish() {
+    if (!conn_) throw RuntimeError{"COPY FROM STDIN is already finished"};
+    io::WriteBuffer(*types_, buffer_, kTrailer);
+    Flush();
+    auto* conn = std::exchange(conn_, nullptr);
+    return conn->FinishCopyIn().RowsAffected();
+}
+
+void CopyIn::StartRow(std::size_t field_count) {
+    if (!conn_) throw RuntimeError{"COPY FROM STDIN is already finished"};
+    io::WriteBuffer(*types_, buffer_, static_cast<Smallint>(field_count));
+}
+
+void CopyIn::EndRow() {
+    if (buffer_.size() >= kCopyInChunkSize) Flush();
+}
+
+void CopyIn::Flush() {
+    std::string_view data{buffer_};
+    // keep the chunks small enough for libpq
+    while (!data.empty()) {
+        const auto chunk = data.substr(0, kCopyInChunkSize);
+        conn_->PutCopyData(chunk);
+        data.remove_prefix(chunk.size());
+    }
+    buffer_.clear();
+}
+
+CopyOut::CopyOut(detail::Connection* conn, const Query& query, OptionalCommandControl cmd_ctl)
+    : conn_{conn}, types_{&conn->GetUserTypes()} {
+    if (!cmd_ctl) cmd_ctl = conn_->GetQueryCmdCtl(query.GetName());
+    conn_->StartCopyOut(query, std::move(cmd_ctl));
+    try {
+        ReadHeader();
+    } catch (const std::exception&) {
+        // the destructor is not called, and the COPY could not be finished
+        if (!is_done_) conn_->MarkAsBroken();
+        throw;
+    }
+}
+
+CopyOut::CopyOut(CopyOut&& other) noexcept
+    : conn_{std::exchange(other.conn_, nullptr)},
+      types_{other.types_},
+      buffer_{std::move(other.buffer_)},
+      pos_{other.pos_},
+      row_end_{other.row_end_},
+      rows_read_{other.rows_read_},
+      is_done_{std::exchange(other.is_done_, true)} {}
+
+CopyOut::~CopyOut() {
+    if (!conn_ || is_done_) return;
+    // There is no way to stop COPY TO STDOUT other than to read all of its
+    // data, so the connection is dropped instead
+    LOG_WARNING() << "COPY TO STDOUT was not read till the end, the connection will be closed";
+    conn_->MarkAsBroken();
+}
+
+void CopyOut::ReadHeader() {
+    Require(kHeaderSize);
+    if (std::string_view{buffer_}.substr(0, kBinarySignature.size()) != kBinarySignature) {
+        throw InvalidBinaryBuffer("Invalid binary COPY signature");
+    }
+    pos_ = kBinarySignature.size() + 4;  // flags are not used
+    const auto extension_size = ReadBigEndian<Integer>(buffer_, pos_);
+    if (extension_size < 0) throw InvalidBinaryBuffer("Invalid binary COPY header extension size");
+    pos_ += 4;
+    Require(pos_ + extension_size);
+    pos_ += extension_size;
+}
+
+bool CopyOut::NextRow(std::size_t field_count) {
+    if (is_done_) return false;
+
+    // drop the data that was already parsed
+    buffer_.erase(0, pos_);
+    pos_ = 0;
+
+    Require(sizeof(Smallint));
+    const auto row_field_count = ReadBigEndian<Smallint>(buffer_, 0);
+    if (row_field_count == kTrailer) {
+        is_done_ = true;
+        while (conn_->GetCopyData(buffer_)) {
+            // no data is expected after the trailer
+        }
+        conn_->FinishCopyOut();
+        return false;
+    }
+    if (row_field_count < 0 || static_cast<std::size_t>(row_field_count) != field_count) {
+        throw InvalidTupleSizeRequested(row_field_count < 0 ? 0 : row_field_count, field_count);
+    }
+
+    // make sure the whole row is available
+    std::size_t end = sizeof(Smallint);
+    for (Smallint i = 0; i < row_field_count; ++i) {
+        Require(end + sizeof(Integer));
+        const auto length = ReadBigEndian<Integer>(buffer_, end);
+        end += sizeof(Integer);
+        if (length > 0) {
+            end += length;
+            Require(end);
+        } else if (length != io::kPgNullBufferSize && length != 0) {
+            throw InvalidBinaryBuffer("Negative field length in binary COPY data");
+        }
+    }
+
+    pos_ = sizeof(Smallint);
+    row_end_ = end;
+    return true;
+}
+
+void CopyOut::CheckRowEnd() {
+    if (pos_ != row_end_) throw InvalidBinaryBuffer("Unconsumed bytes in a binary COPY row");
+    ++rows_read_;
+}
+
+void CopyOut::Require(std::size_t size) {
+    while (buffer_.size() < size) {
+        if (!conn_->GetCopyData(buffer_)) {
+            is_done_ = true;
+            conn_->FinishCopyOut();
+            throw InvalidBinaryBuffer("Unexpected end of binary COPY data");
+        }
+    }
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -1,12 +1,18 @@
 #include <storages/postgres/detail/cluster_impl.hpp>
 
+#include <iterator>
+#include <limits>
+
 #include <fmt/format.h>
 
 #include <userver/dynamic_config/value.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/server/request/task_inherited_data.hpp>
 #include <userver/utils/algo.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 
 #include <storages/postgres/detail/topology/hot_standby.hpp>
 #include <storages/postgres/detail/topology/standalone.hpp>
@@ -22,6 +28,9 @@ namespace storages::postgres::detail {
 
 namespace {
 
+constexpr std::chrono::seconds kResultCacheWaitNotifyInterval{1};
+constexpr std::chrono::seconds kResultCacheListenRetryInterval{1};
+
 ClusterHostType Fallback(ClusterHostType ht) {
     switch (ht) {
         case ClusterHostType::kMaster:
@@ -33,15 +42,51 @@ ClusterHostType Fallback(ClusterHostType ht) {
         case ClusterHostType::kNone:
         case ClusterHostType::kRoundRobin:
         case ClusterHostType::kNearest:
+        case ClusterHostType::kLeastLoaded:
             throw ClusterError("Invalid ClusterHostType value for fallback " + ToString(ht));
     }
     UINVARIANT(false, "Unexpected cluster host type");
 }
 
+using DsnIndices = topology::TopologyBase::DsnIndices;
+using HostsMetrics = topology::TopologyBase::HostsMetrics;
+using HostPools = std::vector<std::shared_ptr<ConnectionPool>>;
+
+// Load estimate of a host: the time to complete a statement if it is queued
+// after the ones already running on or waiting for the host connections
+double GetHostLoadScore(const HostsMetrics& hosts_metrics, const HostPools& host_pools, size_t dsn_index) {
+    if (dsn_index >= hosts_metrics.size()) return std::numeric_limits<double>::infinity();
+    const auto rtt = hosts_metrics[dsn_index].roundtrip_time;
+    if (rtt == topology::TopologyBase::kUnknownRoundtripTime) return std::numeric_limits<double>::infinity();
+    return static_cast<double>(rtt.count()) * static_cast<double>(host_pools[dsn_index]->GetInFlightCount() + 1);
+}
+
+std::chrono::milliseconds GetReplicationLag(const HostsMetrics& hosts_metrics, size_t dsn_index) {
+    return dsn_index < hosts_metrics.size() ? hosts_metrics[dsn_index].replication_lag : std::chrono::milliseconds{0};
+}
+
+size_t
+SelectLeastLoadedDsnIndex(const DsnIndices& indices, const HostsMetrics& hosts_metrics, const HostPools& host_pools) {
+    size_t best_index = indices.front();
+    auto best_score = GetHostLoadScore(hosts_metrics, host_pools, best_index);
+    for (auto it = std::next(indices.begin()); it != indices.end(); ++it) {
+        const auto score = GetHostLoadScore(hosts_metrics, host_pools, *it);
+        if (score < best_score ||
+            (score == best_score &&
+             GetReplicationLag(hosts_metrics, *it) < GetReplicationLag(hosts_metrics, best_index))) {
+            best_index = *it;
+            best_score = score;
+        }
+    }
+    return best_index;
+}
+
 size_t SelectDsnIndex(
-    const topology::TopologyBase::DsnIndices& indices,
+    const DsnIndices& indices,
     ClusterHostTypeFlags flags,
-    std::atomic<uint32_t>& rr_host_idx
+    std::atomic<uint32_t>& rr_host_idx,
+    const HostsMetrics& hosts_metrics,
+    const HostPools& host_pools
 ) {
     UASSERT(!indices.empty());
     if (indices.empty()) {
@@ -56,6 +101,8 @@ size_t SelectDsnIndex(
         if (indices.size() != 1) {
             idx_pos = rr_host_idx.fetch_add(1, std::memory_order_relaxed) % indices.size();
         }
+    } else if (strategy_flags == ClusterHostType::kLeastLoaded) {
+        return SelectLeastLoadedDsnIndex(indices, hosts_metrics, host_pools);
     } else if (strategy_flags != ClusterHostType::kNearest) {
         throw LogicError(
             fmt::format("Invalid strategy requested: {}, ensure only one is used", ToString(strategy_flags))
@@ -64,6 +111,29 @@ size_t SelectDsnIndex(
     return indices[idx_pos];
 }
 
+// Returns either `indices` or `filtered` filled with the hosts not lagging more
+// than the limit of the command
+const DsnIndices& FilterLaggingHosts(
+    const DsnIndices& indices,
+    const OptionalCommandControl& cmd_ctl,
+    const HostsMetrics& hosts_metrics,
+    const HostPools& host_pools,
+    DsnIndices& filtered
+) {
+    if (!cmd_ctl || !cmd_ctl->max_replication_lag) return indices;
+
+    const auto max_lag = *cmd_ctl->max_replication_lag;
+    filtered.clear();
+    for (const auto dsn_index : indices) {
+        if (GetReplicationLag(hosts_metrics, dsn_index) > max_lag) {
+            host_pools[dsn_index]->AccountLaggingHostSkipped();
+            continue;
+        }
+        filtered.push_back(dsn_index);
+    }
+    return filtered;
+}
+
 }  // namespace
 
 ClusterImpl::ClusterImpl(
@@ -86,9 +156,19 @@ ClusterImpl::ClusterImpl(
       testsuite_pg_ctl_(testsuite_pg_ctl),
       ei_settings_(ei_settings),
       rr_host_idx_(0),
-      connlimit_watchdog_(*this, testsuite_tasks, shard_number, [this]() { OnConnlimitChanged(); }) {
+      query_batching_enabled_(cluster_settings.pool_settings.query_batching_window.count() > 0),
+      connlimit_watchdog_(*this, testsuite_tasks, shard_number, [this]() { OnConnlimitChanged(); }),
+      result_cache_(cluster_settings.result_cache_settings) {
     CreateTopology(dsns);
 
+    const auto& cache_settings = cluster_settings.result_cache_settings;
+    if (result_cache_.IsEnabled() && !cache_settings.invalidation_channel.empty()) {
+        result_cache_invalidation_task_ = USERVER_NAMESPACE::utils::Async(
+            "pg_result_cache_invalidation",
+            [this, channel = cache_settings.invalidation_channel] { ListenForResultCacheInvalidation(channel); }
+        );
+    }
+
     // Do not use IsConnlimitModeAuto() here because we don't care about
     // the current dynamic config value
     if (cluster_settings.connlimit_mode == ConnlimitMode::kAuto) {
@@ -169,7 +249,37 @@ void ClusterImpl::CreateTopology(const DsnList& dsns) {
     *existing_td = std::move(data);
 }
 
-ClusterImpl::~ClusterImpl() { connlimit_watchdog_.Stop(); }
+ClusterImpl::~ClusterImpl() {
+    if (result_cache_invalidation_task_.IsValid()) {
+        result_cache_invalidation_task_.SyncCancel();
+    }
+    connlimit_watchdog_.Stop();
+}
+
+void ClusterImpl::ListenForResultCacheInvalidation(const std::string& channel) {
+    while (!engine::current_task::ShouldCancel()) {
+        try {
+            auto scope = Listen(channel, {});
+            // notifications sent before LISTEN are lost, results cached by then
+            // may be stale
+            result_cache_.Invalidate();
+            while (!engine::current_task::ShouldCancel()) {
+                try {
+                    scope.WaitNotify(engine::Deadline::FromDuration(kResultCacheWaitNotifyInterval));
+                    LOG_DEBUG() << "Dropping cached results on a notification on channel '" << channel << "'";
+                    result_cache_.Invalidate();
+                } catch (const ConnectionTimeoutError&) {
+                    // no notifications for a while
+                }
+            }
+        } catch (const std::exception& e) {
+            if (engine::current_task::ShouldCancel()) break;
+            LOG_LIMITED_WARNING() << "Failed to listen for result cache invalidation on channel '" << channel
+                                  << "': " << e;
+            engine::InterruptibleSleepFor(kResultCacheListenRetryInterval);
+        }
+    }
+}
 
 ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
     auto cluster_stats = std::make_unique<ClusterStatistics>();
@@ -241,10 +351,13 @@ ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
         cluster_stats->unknown.push_back(std::move(desc));
     }
 
+    cluster_stats->result_cache = result_cache_.GetStatistics();
+
     return cluster_stats;
 }
 
-ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(ClusterHostTypeFlags flags) {
+ClusterImpl::ConnectionPoolPtr
+ClusterImpl::FindPool(ClusterHostTypeFlags flags, const OptionalCommandControl& cmd_ctl) {
     LOG_TRACE() << "Looking for pool: " << flags;
 
     size_t dsn_index = -1;
@@ -259,37 +372,48 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(ClusterHostTypeFlags flags)
     auto td = topology_data_.SharedLock();
     auto& topology = td->topology;
     auto& host_pools = td->host_pools;
+    auto hosts_metrics = topology->GetHostsMetrics();
+    DsnIndices filtered_dsn_indices;
 
     if ((role_flags & ClusterHostType::kMaster) && (role_flags & ClusterHostType::kSlave)) {
         LOG_TRACE() << "Starting transaction on " << role_flags;
         auto alive_dsn_indices = topology->GetAliveDsnIndices();
-        if (alive_dsn_indices->empty()) {
+        const auto& dsn_indices =
+            FilterLaggingHosts(*alive_dsn_indices, cmd_ctl, *hosts_metrics, host_pools, filtered_dsn_indices);
+        if (dsn_indices.empty()) {
             throw ClusterUnavailable("None of cluster hosts are available");
         }
-        dsn_index = SelectDsnIndex(*alive_dsn_indices, flags, rr_host_idx_);
+        dsn_index = SelectDsnIndex(dsn_indices, flags, rr_host_idx_, *hosts_metrics, host_pools);
     } else {
         auto host_role = static_cast<ClusterHostType>(role_flags.GetValue());
         auto dsn_indices_by_type = topology->GetDsnIndicesByType();
-        auto dsn_indices_it = dsn_indices_by_type->find(host_role);
-        while (host_role != ClusterHostType::kMaster &&
-               (dsn_indices_it == dsn_indices_by_type->end() || dsn_indices_it->second.empty())) {
+        const auto find_dsn_indices = [&](ClusterHostType role) -> const DsnIndices& {
+            static const DsnIndices kNoDsnIndices;
+            const auto it = dsn_indices_by_type->find(role);
+            if (it == dsn_indices_by_type->end()) return kNoDsnIndices;
+            return FilterLaggingHosts(it->second, cmd_ctl, *hosts_metrics, host_pools, filtered_dsn_indices);
+        };
+        const auto* dsn_indices = &find_dsn_indices(host_role);
+        while (host_role != ClusterHostType::kMaster && dsn_indices->empty()) {
             auto fb = Fallback(host_role);
             LOG_WARNING() << "There is no pool for " << host_role << ", falling back to " << fb;
             host_role = fb;
-            dsn_indices_it = dsn_indices_by_type->find(host_role);
+            dsn_indices = &find_dsn_indices(host_role);
         }
 
-        if (dsn_indices_it == dsn_indices_by_type->end() || dsn_indices_it->second.empty()) {
+        if (dsn_indices->empty()) {
             throw ClusterUnavailable(
                 fmt::format("Pool for {} (requested: {}) is not available", ToString(host_role), ToString(role_flags))
             );
         }
         LOG_TRACE() << "Starting transaction on " << host_role;
-        dsn_index = SelectDsnIndex(dsn_indices_it->second, flags, rr_host_idx_);
+        dsn_index = SelectDsnIndex(*dsn_indices, flags, rr_host_idx_, *hosts_metrics, host_pools);
     }
 
     UASSERT(dsn_index < host_pools.size());
-    return host_pools.at(dsn_index);
+    auto& pool = host_pools.at(dsn_index);
+    pool->AccountHostSelected();
+    return pool;
 }
 
 Transaction
@@ -306,7 +430,7 @@ ClusterImpl::Begin(ClusterHostTypeFlags flags, const TransactionOptions& options
         }
         flags = ClusterHostType::kMaster | flags.Clear(kClusterHostRolesMask);
     }
-    return FindPool(flags)->Begin(options, cmd_ctl);
+    return FindPool(flags, cmd_ctl)->Begin(options, cmd_ctl);
 }
 
 NonTransaction ClusterImpl::Start(ClusterHostTypeFlags flags, OptionalCommandControl cmd_ctl) {
@@ -314,7 +438,38 @@ NonTransaction ClusterImpl::Start(ClusterHostTypeFlags flags, OptionalCommandCon
         throw LogicError("Host role must be specified for execution of a single statement");
     }
     LOG_TRACE() << "Requested single statement on " << flags;
-    return FindPool(flags)->Start(cmd_ctl);
+    return FindPool(flags, cmd_ctl)->Start(cmd_ctl);
+}
+
+bool ClusterImpl::IsQueryBatchingEnabled() const {
+    return query_batching_enabled_.load(std::memory_order_relaxed);
+}
+
+ResultSet ClusterImpl::ExecuteBatched(
+    ClusterHostTypeFlags flags,
+    OptionalCommandControl cmd_ctl,
+    const Query& query,
+    QueryBatcher::ParamsWriter params
+) {
+    if (!(flags & kClusterHostRolesMask)) {
+        throw LogicError("Host role must be specified for execution of a single statement");
+    }
+    LOG_TRACE() << "Requested batched single statement on " << flags;
+    return FindPool(flags, cmd_ctl)->ExecuteBatched(cmd_ctl, query, params);
+}
+
+ResultStream ClusterImpl::MakeResultStream(
+    ClusterHostTypeFlags flags,
+    OptionalCommandControl cmd_ctl,
+    std::size_t chunk_size,
+    const Query& query,
+    QueryBatcher::ParamsWriter params
+) {
+    if (!(flags & kClusterHostRolesMask)) {
+        throw LogicError("Host role must be specified for execution of a single statement");
+    }
+    LOG_TRACE() << "Requested result stream on " << flags;
+    return FindPool(flags, cmd_ctl)->MakeResultStream(cmd_ctl, chunk_size, query, params);
 }
 
 NotifyScope ClusterImpl::Listen(std::string_view channel, OptionalCommandControl cmd_ctl) {
@@ -370,6 +525,7 @@ void ClusterImpl::SetPoolSettings(const PoolSettings& new_settings) {
     for (const auto& pool : td->host_pools) {
         pool->SetSettings(cluster_settings->pool_settings);
     }
+    query_batching_enabled_ = cluster_settings->pool_settings.query_batching_window.count() > 0;
 }
 
 void ClusterImpl::SetTopologySettings(const TopologySettings& settings) {
@@ -7,6 +7,7 @@
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/dynamic_config/source.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/error_injection/settings.hpp>
 #include <userver/testsuite/postgres_control.hpp>
 #include <userver/testsuite/tasks.hpp>
@@ -14,6 +15,7 @@
 #include <storages/postgres/connlimit_watchdog.hpp>
 #include <storages/postgres/detail/pg_impl_types.hpp>
 #include <storages/postgres/detail/pool.hpp>
+#include <storages/postgres/detail/result_cache.hpp>
 #include <storages/postgres/detail/statement_stats_storage.hpp>
 #include <storages/postgres/detail/topology/base.hpp>
 #include <userver/storages/postgres/cluster_types.hpp>
@@ -51,8 +53,21 @@ public:
 
     NonTransaction Start(ClusterHostTypeFlags, OptionalCommandControl);
 
+    bool IsQueryBatchingEnabled() const;
+
+    ResultSet ExecuteBatched(ClusterHostTypeFlags, OptionalCommandControl, const Query&, QueryBatcher::ParamsWriter);
+    ResultStream MakeResultStream(
+        ClusterHostTypeFlags,
+        OptionalCommandControl,
+        std::size_t chunk_size,
+        const Query&,
+        QueryBatcher::ParamsWriter
+    );
+
     NotifyScope Listen(std::string_view channel, OptionalCommandControl);
 
+    ResultCache& GetResultCache() { return result_cache_; }
+
     QueryQueue CreateQueryQueue(ClusterHostTypeFlags flags, TimeoutDuration acquire_timeout);
 
     void SetDefaultCommandControl(CommandControl, DefaultCommandControlSource);
@@ -85,7 +100,7 @@ private:
 
     using ConnectionPoolPtr = std::shared_ptr<ConnectionPool>;
 
-    ConnectionPoolPtr FindPool(ClusterHostTypeFlags);
+    ConnectionPoolPtr FindPool(ClusterHostTypeFlags, const OptionalCommandControl& cmd_ctl = {});
 
     struct TopologyData {
         std::unique_ptr<topology::TopologyBase> topology;
@@ -94,6 +109,8 @@ private:
 
     void CreateTopology(const DsnList& dsns);
 
+    void ListenForResultCacheInvalidation(const std::string& channel);
+
     rcu::Variable<ClusterSettings> cluster_settings_;
     concurrent::Variable<TopologyData, engine::SharedMutex> topology_data_;
     clients::dns::Resolver* resolver_{};
@@ -105,7 +122,10 @@ private:
 
     std::atomic<uint32_t> rr_host_idx_;
     std::atomic<bool> connlimit_mode_auto_enabled_;
+    std::atomic<bool> query_batching_enabled_;
     ConnlimitWatchdog connlimit_watchdog_;
+    ResultCache result_cache_;
+    engine::TaskWithResult<void> result_cache_invalidation_task_;
 };
 
 }  // namespace storages::postgres::detail
@@ -26,7 +26,8 @@ std::unique_ptr<Connection> Connection::Connect(
     const DefaultCommandControls& default_cmd_ctls,
     const testsuite::PostgresControl& testsuite_pg_ctl,
     const error_injection::Settings& ei_settings,
-    engine::SemaphoreLock&& size_lock
+    engine::SemaphoreLock&& size_lock,
+    std::shared_ptr<PreparedStatementsRegistry> shared_statements
 ) {
     std::unique_ptr<Connection> conn(new Connection());
 
@@ -40,7 +41,8 @@ std::unique_ptr<Connection> Connection::Connect(
         default_cmd_ctls,
         testsuite_pg_ctl,
         ei_settings,
-        std::move(size_lock)
+        std::move(size_lock),
+        std::move(shared_statements)
     );
     if (resolver) {
         try {
@@ -133,7 +135,15 @@ void Connection::AddIntoPipeline(
 }
 
 std::vector<ResultSet> Connection::GatherPipeline(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions) {
-    return pimpl_->GatherPipeline(timeout, descriptions);
+    return pimpl_->GatherPipeline(timeout, descriptions, nullptr);
+}
+
+std::vector<ResultSet> Connection::GatherPipeline(
+    TimeoutDuration timeout,
+    const std::vector<ResultSet>& descriptions,
+    std::vector<std::exception_ptr>& errors
+) {
+    return pimpl_->GatherPipeline(timeout, descriptions, &errors);
 }
 
 ResultSet Connection::Execute(const Query& query, const ParameterStore& store) {
@@ -162,6 +172,33 @@ ResultSet Connection::PortalExecute(
     return pimpl_->PortalExecute(statement_id, portal_name, n_rows, std::move(statement_cmd_ctl));
 }
 
+void Connection::StartCopyIn(const Query& query, OptionalCommandControl statement_cmd_ctl) {
+    pimpl_->StartCopyIn(query, std::move(statement_cmd_ctl));
+}
+
+void Connection::PutCopyData(std::string_view data) { pimpl_->PutCopyData(data); }
+
+ResultSet Connection::FinishCopyIn(const char* error_message) { return pimpl_->FinishCopyIn(error_message); }
+
+void Connection::StartCopyOut(const Query& query, OptionalCommandControl statement_cmd_ctl) {
+    pimpl_->StartCopyOut(query, std::move(statement_cmd_ctl));
+}
+
+bool Connection::GetCopyData(std::string& data) { return pimpl_->GetCopyData(data); }
+
+ResultSet Connection::FinishCopyOut() { return pimpl_->FinishCopyOut(); }
+
+void Connection::StartRowsStream(
+    const Query& query,
+    const QueryParameters& params,
+    OptionalCommandControl statement_cmd_ctl,
+    std::size_t chunk_size
+) {
+    pimpl_->StartRowsStream(query, params, std::move(statement_cmd_ctl), chunk_size);
+}
+
+std::optional<ResultSet> Connection::FetchRowsChunk() { return pimpl_->FetchRowsChunk(); }
+
 void Connection::CancelAndCleanup(TimeoutDuration timeout) { pimpl_->CancelAndCleanup(timeout); }
 
 bool Connection::Cleanup(TimeoutDuration timeout) { return pimpl_->Cleanup(timeout); }
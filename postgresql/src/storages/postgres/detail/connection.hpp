@@ -2,6 +2,9 @@
 
 #include <atomic>
 #include <chrono>
+#include <exception>
+#include <memory>
+#include <optional>
 #include <string>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
@@ -39,6 +42,7 @@ enum class ConnectionState {
 namespace detail {
 
 class ConnectionImpl;
+class PreparedStatementsRegistry;
 
 /// @brief PostreSQL connection class
 /// Handles connecting to Postgres, sending commands, processing command results
@@ -139,7 +143,8 @@ public:
         const DefaultCommandControls& default_cmd_ctls,
         const testsuite::PostgresControl& testsuite_pg_ctl,
         const error_injection::Settings& ei_settings,
-        engine::SemaphoreLock&& size_lock = engine::SemaphoreLock{}
+        engine::SemaphoreLock&& size_lock = engine::SemaphoreLock{},
+        std::shared_ptr<PreparedStatementsRegistry> shared_statements = {}
     );
 
     /// Close the connection
@@ -230,6 +235,14 @@ public:
 
     std::vector<ResultSet> GatherPipeline(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
 
+    /// Gather the pipeline results without throwing on query errors: the
+    /// errors are stored into `errors`, one element per result
+    std::vector<ResultSet> GatherPipeline(
+        TimeoutDuration timeout,
+        const std::vector<ResultSet>& descriptions,
+        std::vector<std::exception_ptr>& errors
+    );
+
     template <typename... T>
     ResultSet Execute(const Query& query, const T&... args) {
         detail::StaticQueryParameters<sizeof...(args)> params;
@@ -285,6 +298,34 @@ public:
     void Unlisten(std::string_view channel, OptionalCommandControl);
 
     Notification WaitNotify(engine::Deadline deadline);
+
+    /// Start `COPY ... FROM STDIN`, the statement must use the binary format
+    void StartCopyIn(const Query& query, OptionalCommandControl statement_cmd_ctl);
+    /// Send a chunk of COPY data
+    void PutCopyData(std::string_view data);
+    /// Finish `COPY ... FROM STDIN`, a non-null `error_message` makes the COPY
+    /// fail
+    ResultSet FinishCopyIn(const char* error_message = nullptr);
+
+    /// Start `COPY ... TO STDOUT`, the statement must use the binary format
+    void StartCopyOut(const Query& query, OptionalCommandControl statement_cmd_ctl);
+    /// Append the next chunk of COPY data to `data`, false if there is no more
+    /// data and FinishCopyOut should be called
+    bool GetCopyData(std::string& data);
+    /// Finish `COPY ... TO STDOUT` after all the data was received
+    ResultSet FinishCopyOut();
+
+    /// Send a query and switch it into rows streaming mode, the rows are
+    /// received with FetchRowsChunk
+    void StartRowsStream(
+        const Query& query,
+        const QueryParameters& params,
+        OptionalCommandControl statement_cmd_ctl,
+        std::size_t chunk_size
+    );
+    /// Next chunk of rows of the streamed query, std::nullopt when the query is
+    /// complete
+    std::optional<ResultSet> FetchRowsChunk();
     //@}
 
     /// Get duration since last network operation
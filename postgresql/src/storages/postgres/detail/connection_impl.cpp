@@ -12,6 +12,8 @@
 #include <userver/tracing/tags.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/datetime.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+#include <userver/utils/impl/usdt.hpp>
 #include <userver/utils/rand.hpp>
 #include <userver/utils/scope_guard.hpp>
 #include <userver/utils/text_light.hpp>
@@ -26,6 +28,7 @@
 
 USERVER_NAMESPACE_BEGIN
 
+using USERVER_NAMESPACE::utils::FastScopeGuard;
 using USERVER_NAMESPACE::utils::RandRange;
 using USERVER_NAMESPACE::utils::ScopeGuard;
 using USERVER_NAMESPACE::utils::datetime::SteadyNow;
@@ -74,6 +77,8 @@ public:
         completed_ = true;
     }
 
+    void AccountCompleted() { completed_ = true; }
+
 private:
     Connection::Statistics& stats_;
     bool completed_{false};
@@ -218,11 +223,13 @@ ConnectionImpl::ConnectionImpl(
     const DefaultCommandControls& default_cmd_ctls,
     const testsuite::PostgresControl& testsuite_pg_ctl,
     const error_injection::Settings& ei_settings,
-    engine::SemaphoreLock&& size_lock
+    engine::SemaphoreLock&& size_lock,
+    std::shared_ptr<PreparedStatementsRegistry> shared_statements
 )
     : uuid_{USERVER_NAMESPACE::utils::generators::GenerateUuid()},
       conn_wrapper_{bg_task_processor, bg_task_storage, id, std::move(size_lock)},
       prepared_{settings.max_prepared_cache_size},
+      shared_statements_{std::move(shared_statements)},
       settings_{settings},
       default_cmd_ctls_(default_cmd_ctls),
       testsuite_pg_ctl_{testsuite_pg_ctl},
@@ -270,6 +277,7 @@ void ConnectionImpl::AsyncConnect(const Dsn& dsn, engine::Deadline deadline) {
     if (settings_.user_types != ConnectionSettings::kPredefinedTypesOnly) {
         LoadUserTypes(deadline);
     }
+    WarmUpPreparedStatements(deadline);
     if (settings_.pipeline_mode == PipelineMode::kEnabled) {
         conn_wrapper_.EnterPipelineMode();
     }
@@ -470,8 +478,10 @@ Connection::StatementId ConnectionImpl::PortalBind(
     CountPortalBind count_bind(stats_);
 
     const auto& prepared_info = DoPrepareStatement(statement, params, deadline, span, scope);
+    if (prepared_info.shared_statement) prepared_info.shared_statement->AccountExecution();
 
     scope.Reset(scopes::kBind);
+    USERVER_IMPL_USDT(pg_query_begin, this, statement.c_str());
     conn_wrapper_.SendPortalBind(prepared_info.statement_name, portal_name, params, scope);
 
     WaitResult(statement, deadline, network_timeout, count_bind, span, scope, nullptr);
@@ -506,6 +516,7 @@ ResultSet ConnectionImpl::PortalExecute(
     }
     auto scope = span.CreateScopeTime(scopes::kExec);
     CountExecute count_execute(stats_);
+    USERVER_IMPL_USDT(pg_query_begin, this, prepared_info->statement.c_str());
     conn_wrapper_.SendPortalExecute(portal_name, n_rows, scope);
 
     return WaitResult(
@@ -532,6 +543,138 @@ Notification ConnectionImpl::WaitNotify(engine::Deadline deadline) {
     return conn_wrapper_.WaitNotify(deadline);
 }
 
+void ConnectionImpl::StartCopyIn(const Query& query, OptionalCommandControl statement_cmd_ctl) {
+    StartCopy(query, std::move(statement_cmd_ctl), PGRES_COPY_IN);
+}
+
+void ConnectionImpl::PutCopyData(std::string_view data) {
+    conn_wrapper_.PutCopyData(data, testsuite_pg_ctl_.MakeExecuteDeadline(streaming_network_timeout_));
+}
+
+ResultSet ConnectionImpl::FinishCopyIn(const char* error_message) {
+    return FinishCopy(error_message, /*is_copy_in=*/true);
+}
+
+void ConnectionImpl::StartCopyOut(const Query& query, OptionalCommandControl statement_cmd_ctl) {
+    StartCopy(query, std::move(statement_cmd_ctl), PGRES_COPY_OUT);
+}
+
+bool ConnectionImpl::GetCopyData(std::string& data) {
+    return conn_wrapper_.GetCopyData(data, testsuite_pg_ctl_.MakeExecuteDeadline(streaming_network_timeout_));
+}
+
+ResultSet ConnectionImpl::FinishCopyOut() { return FinishCopy(nullptr, /*is_copy_in=*/false); }
+
+void ConnectionImpl::StartCopy(
+    const Query& query,
+    OptionalCommandControl statement_cmd_ctl,
+    ExecStatusType expected_status
+) {
+    CheckBusy();
+    streaming_network_timeout_ = ExecuteTimeout(statement_cmd_ctl);
+    const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(streaming_network_timeout_);
+    SetStatementTimeout(std::move(statement_cmd_ctl));
+
+    auto span = MakeQuerySpan(query, {streaming_network_timeout_, GetStatementTimeout()});
+    auto scope = span.CreateScopeTime();
+    ExitPipelineForStreaming(deadline, scope);
+
+    CountExecute count_execute(stats_);
+    try {
+        CheckDeadlineReached(deadline);
+        conn_wrapper_.SendQuery(query.Statement(), scope);
+        conn_wrapper_.WaitCopyStart(deadline, scope, expected_status);
+        count_execute.AccountCompleted();
+    } catch (const std::exception&) {
+        span.AddTag(tracing::kErrorFlag, true);
+        RestorePipelineAfterStreaming();
+        throw;
+    }
+}
+
+ResultSet ConnectionImpl::FinishCopy(const char* error_message, bool is_copy_in) {
+    const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(streaming_network_timeout_);
+    tracing::Span span{scopes::kCopyFinish};
+    auto scope = span.CreateScopeTime();
+    try {
+        if (is_copy_in) conn_wrapper_.PutCopyEnd(deadline, error_message);
+        auto res = conn_wrapper_.WaitResult(deadline, scope, nullptr);
+        RestorePipelineAfterStreaming();
+        return res;
+    } catch (const std::exception&) {
+        span.AddTag(tracing::kErrorFlag, true);
+        RestorePipelineAfterStreaming();
+        throw;
+    }
+}
+
+void ConnectionImpl::StartRowsStream(
+    const Query& query,
+    const QueryParameters& params,
+    OptionalCommandControl statement_cmd_ctl,
+    std::size_t chunk_size
+) {
+    CheckBusy();
+    streaming_network_timeout_ = ExecuteTimeout(statement_cmd_ctl);
+    const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(streaming_network_timeout_);
+    SetStatementTimeout(std::move(statement_cmd_ctl));
+
+    auto span = MakeQuerySpan(query, {streaming_network_timeout_, GetStatementTimeout()});
+    auto scope = span.CreateScopeTime();
+    ExitPipelineForStreaming(deadline, scope);
+
+    CountExecute count_execute(stats_);
+    try {
+        CheckDeadlineReached(deadline);
+        conn_wrapper_.SendQuery(query.Statement(), params, scope);
+        conn_wrapper_.SetRowsStreamingMode(chunk_size);
+        count_execute.AccountCompleted();
+    } catch (const std::exception&) {
+        span.AddTag(tracing::kErrorFlag, true);
+        RestorePipelineAfterStreaming();
+        throw;
+    }
+}
+
+std::optional<ResultSet> ConnectionImpl::FetchRowsChunk() {
+    const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(streaming_network_timeout_);
+    tracing::Span span{scopes::kFetchRowsChunk};
+    auto scope = span.CreateScopeTime();
+    try {
+        auto chunk = conn_wrapper_.WaitRowsChunk(deadline, scope);
+        if (!chunk) {
+            RestorePipelineAfterStreaming();
+            return std::nullopt;
+        }
+        FillBufferCategories(*chunk);
+        return chunk;
+    } catch (const std::exception&) {
+        span.AddTag(tracing::kErrorFlag, true);
+        RestorePipelineAfterStreaming();
+        throw;
+    }
+}
+
+void ConnectionImpl::ExitPipelineForStreaming(engine::Deadline deadline, tracing::ScopeTime& scope) {
+    if (!IsPipelineActive()) return;
+    if (GetConnectionState() == ConnectionState::kTranActive && !conn_wrapper_.IsSyncingPipeline()) {
+        // gather the results of the commands queued into the pipeline
+        conn_wrapper_.WaitResult(deadline, scope, nullptr);
+    }
+    conn_wrapper_.ExitPipelineMode();
+    is_pipeline_exited_for_streaming_ = true;
+}
+
+void ConnectionImpl::RestorePipelineAfterStreaming() noexcept {
+    if (!std::exchange(is_pipeline_exited_for_streaming_, false)) return;
+    try {
+        conn_wrapper_.EnterPipelineMode();
+    } catch (const std::exception& e) {
+        LOG_LIMITED_WARNING() << "Failed to restore pipeline mode after COPY or rows streaming: " << e;
+        conn_wrapper_.MarkAsBroken();
+    }
+}
+
 void ConnectionImpl::CancelAndCleanup(TimeoutDuration timeout) {
     auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(timeout);
 
@@ -743,7 +886,11 @@ const ConnectionImpl::PreparedStatementInfo& ConnectionImpl::DoPrepareStatement(
     scope.Reset(scopes::kPrepare);
     LOG_TRACE() << "Query " << statement << " is not yet prepared";
 
-    const std::string statement_name = "q" + std::to_string(query_hash) + "_" + uuid_;
+    std::string statement_name = "q" + std::to_string(query_hash) + "_" + uuid_;
+    if (unclosed_statements_) {
+        // a statement with the same name may still exist on the server
+        statement_name += "_" + std::to_string(unclosed_statements_);
+    }
     bool should_prepare = !statement_info;
     if (should_prepare) {
         conn_wrapper_.SendPrepare(statement_name, statement, params, scope);
@@ -775,20 +922,32 @@ const ConnectionImpl::PreparedStatementInfo& ConnectionImpl::DoPrepareStatement(
         LOG_DEBUG() << "Don't send prepare, already sent";
     }
 
-    conn_wrapper_.SendDescribePrepared(statement_name, scope);
-    auto res = conn_wrapper_.WaitResult(deadline, scope, nullptr);
-    if (!res.pimpl_) {
-        throw CommandError("WaitResult() returned nullptr");
+    // Other connections of the pool may have already described the statement
+    auto shared_statement = shared_statements_ ? shared_statements_->Find(query_hash) : nullptr;
+    ResultSet res{nullptr};
+    if (shared_statement) {
+        LOG_TRACE() << "Using the description of statement " << statement << " from another connection";
+        res = shared_statement->GetDescription();
+    } else {
+        conn_wrapper_.SendDescribePrepared(statement_name, scope);
+        res = conn_wrapper_.WaitResult(deadline, scope, nullptr);
+        if (!res.pimpl_) {
+            throw CommandError("WaitResult() returned nullptr");
+        }
+        FillBufferCategories(res);
     }
-    FillBufferCategories(res);
     // Ensure we've got binary format established
     res.GetRowDescription().CheckBinaryFormat(db_types_);
+    if (!shared_statement && shared_statements_) {
+        shared_statement = shared_statements_->Add(query_hash, statement, params, res);
+    }
 
     if (!statement_info) {
-        prepared_.Put(query_id, {query_id, statement, statement_name, std::move(res)});
+        prepared_.Put(query_id, {query_id, statement, statement_name, std::move(res), std::move(shared_statement)});
         statement_info = prepared_.Get(query_id);
     } else {
         statement_info->description = std::move(res);
+        statement_info->shared_statement = std::move(shared_statement);
     }
 
     ++stats_.parse_total;
@@ -796,6 +955,34 @@ const ConnectionImpl::PreparedStatementInfo& ConnectionImpl::DoPrepareStatement(
     return *statement_info;
 }
 
+void ConnectionImpl::WarmUpPreparedStatements(engine::Deadline deadline) {
+    if (!shared_statements_ || settings_.prepared_statements == ConnectionSettings::kNoPreparedStatements ||
+        settings_.warm_up_prepared_statements == 0) {
+        return;
+    }
+    const auto statements = shared_statements_->GetMostExecuted(
+        std::min(settings_.warm_up_prepared_statements, settings_.max_prepared_cache_size)
+    );
+    if (statements.empty()) return;
+
+    tracing::Span span{scopes::kWarmUpPreparedStatements};
+    span.AddTag("statements_count", statements.size());
+    auto scope = span.CreateScopeTime();
+    for (const auto& shared_statement : statements) {
+        try {
+            DoPrepareStatement(
+                shared_statement->GetStatement(), shared_statement->GetParameterTypes(), deadline, span, scope
+            );
+        } catch (const ConnectionError&) {
+            throw;
+        } catch (const Error& e) {
+            // e.g. a table was dropped, the statement will fail on execution
+            LOG_LIMITED_WARNING() << "Failed to prepare statement `" << shared_statement->GetStatement()
+                                  << "` on connect: " << e;
+        }
+    }
+}
+
 void ConnectionImpl::DiscardOldPreparedStatements(engine::Deadline deadline) {
     // do not try to do anything in transaction as it may already be broken
     if (is_discard_prepared_pending_ && !IsInTransaction()) {
@@ -808,6 +995,21 @@ void ConnectionImpl::DiscardOldPreparedStatements(engine::Deadline deadline) {
 
 void ConnectionImpl::DiscardPreparedStatement(const PreparedStatementInfo& info, engine::Deadline deadline) {
     LOG_DEBUG() << "Discarding prepared statement " << info.statement_name;
+    if (settings_.pooler_mode == ConnectionPoolerMode::kTransaction) {
+        // The pooler renames prepared statements on the server side, so
+        // DEALLOCATE would not find them
+        CheckBusy();
+        CheckDeadlineReached(deadline);
+        tracing::Span span{scopes::kClosePrepared};
+        auto scope = span.CreateScopeTime();
+        if (conn_wrapper_.SendClosePrepared(info.statement_name, scope)) {
+            conn_wrapper_.WaitResult(deadline, scope, nullptr);
+        } else {
+            LOG_DEBUG() << "Leaving prepared statement " << info.statement_name << " to the pooler";
+            ++unclosed_statements_;
+        }
+        return;
+    }
     ExecuteCommandNoPrepare("DEALLOCATE " + info.statement_name, deadline);
 }
 
@@ -838,6 +1040,7 @@ ResultSet ConnectionImpl::ExecuteCommand(const Query& query, const QueryParamete
     CountExecute count_execute(stats_);
 
     auto const& prepared_info = DoPrepareStatement(statement, params, deadline, span, scope);
+    if (prepared_info.shared_statement) prepared_info.shared_statement->AccountExecution();
 
     const ResultSet* description_ptr_to_read = nullptr;
     PGresult* description_ptr_to_send = nullptr;
@@ -847,6 +1050,7 @@ ResultSet ConnectionImpl::ExecuteCommand(const Query& query, const QueryParamete
     }
 
     scope.Reset(scopes::kExec);
+    USERVER_IMPL_USDT(pg_query_begin, this, statement.c_str());
     conn_wrapper_.SendPreparedQuery(prepared_info.statement_name, params, scope, description_ptr_to_send);
     return WaitResult(statement, deadline, network_timeout, count_execute, span, scope, description_ptr_to_read);
 }
@@ -863,7 +1067,9 @@ ConnectionImpl::PrepareStatement(const Query& query, const detail::QueryParamete
     span.AddTag(tracing::kDatabaseStatement, statement);
 
     auto scope = span.CreateScopeTime();
-    return DoPrepareStatement(statement, params, deadline, span, scope);
+    const auto& prepared_info = DoPrepareStatement(statement, params, deadline, span, scope);
+    if (prepared_info.shared_statement) prepared_info.shared_statement->AccountExecution();
+    return prepared_info;
 }
 
 void ConnectionImpl::AddIntoPipeline(
@@ -888,8 +1094,11 @@ void ConnectionImpl::AddIntoPipeline(
     conn_wrapper_.PutPipelineSync();
 }
 
-std::vector<ResultSet>
-ConnectionImpl::GatherPipeline(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions) {
+std::vector<ResultSet> ConnectionImpl::GatherPipeline(
+    TimeoutDuration timeout,
+    const std::vector<ResultSet>& descriptions,
+    std::vector<std::exception_ptr>* errors
+) {
     const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(timeout);
     CheckDeadlineReached(deadline);
 
@@ -900,10 +1109,11 @@ ConnectionImpl::GatherPipeline(TimeoutDuration timeout, const std::vector<Result
         }
     }
 
-    auto result = conn_wrapper_.GatherPipeline(deadline, native_descriptions);
+    auto result = conn_wrapper_.GatherPipeline(deadline, native_descriptions, errors);
 
-    for (auto& single_result : result) {
-        FillBufferCategories(single_result);
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        if (errors && (*errors)[i]) continue;
+        FillBufferCategories(result[i]);
     }
 
     return result;
@@ -923,6 +1133,7 @@ ConnectionImpl::ExecuteCommandNoPrepare(const Query& query, const QueryParameter
     auto span = MakeQuerySpan(query, {network_timeout, GetStatementTimeout()});
     auto scope = span.CreateScopeTime();
     CountExecute count_execute(stats_);
+    USERVER_IMPL_USDT(pg_query_begin, this, statement.c_str());
     conn_wrapper_.SendQuery(statement, params, scope);
     return WaitResult(statement, deadline, network_timeout, count_execute, span, scope, nullptr);
 }
@@ -1028,6 +1239,10 @@ ResultSet ConnectionImpl::WaitResult(
     const ResultSet* description_ptr
 ) {
     const PGresult* description = description_ptr ? description_ptr->pimpl_->handle_.get() : nullptr;
+    bool is_succeeded = false;
+    const FastScopeGuard query_end_probe{[&]() noexcept {
+        USERVER_IMPL_USDT(pg_query_end, this, statement.c_str(), is_succeeded);
+    }};
 
     try {
         auto res = conn_wrapper_.WaitResult(deadline, scope, description);
@@ -1037,10 +1252,17 @@ ResultSet ConnectionImpl::WaitResult(
             FillBufferCategories(res);
         }
         counter.AccountResult(res);
+        is_succeeded = true;
         return res;
     } catch (const InvalidSqlStatementName& e) {
-        LOG_LIMITED_ERROR() << "Looks like your pg_bouncer is not in 'session' mode. "
-                               "Please switch pg_bouncers's pooling mode to 'session'.";
+        if (settings_.pooler_mode == ConnectionPoolerMode::kTransaction) {
+            LOG_LIMITED_ERROR() << "Prepared statement was not found. Please make sure pg_bouncer is 1.21+ "
+                                   "and its max_prepared_statements is not 0.";
+        } else {
+            LOG_LIMITED_ERROR() << "Looks like your pg_bouncer is not in 'session' mode. "
+                                   "Please switch pg_bouncers's pooling mode to 'session' "
+                                   "or set 'pooler-mode: transaction' for pg_bouncer 1.21+.";
+        }
         // reset prepared cache in case they just magically vanished
         is_discard_prepared_pending_ = true;
         span.AddTag(tracing::kErrorFlag, true);
@@ -1063,6 +1285,8 @@ ResultSet ConnectionImpl::WaitResult(
             LOG_LIMITED_WARNING() << "Scheduling prepared statements invalidation due to "
                                      "cached plan change";
             is_discard_prepared_pending_ = true;
+            // the descriptions of other statements may be outdated as well
+            if (shared_statements_) shared_statements_->Clear();
         }
         span.AddTag(tracing::kErrorFlag, true);
         throw;
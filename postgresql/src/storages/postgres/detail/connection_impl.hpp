@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cstdint>
+#include <exception>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -20,6 +22,7 @@
 #include <storages/postgres/default_command_controls.hpp>
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/detail/pg_connection_wrapper.hpp>
+#include <storages/postgres/detail/prepared_statements_registry.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
 #include <userver/storages/postgres/options.hpp>
@@ -37,6 +40,7 @@ public:
         std::string statement;
         std::string statement_name;
         ResultSet description{nullptr};
+        PreparedStatementsRegistry::StatementPtr shared_statement{};
     };
 
     ConnectionImpl(
@@ -47,7 +51,8 @@ public:
         const DefaultCommandControls& default_cmd_ctls,
         const testsuite::PostgresControl& testsuite_pg_ctl,
         const error_injection::Settings& ei_settings,
-        engine::SemaphoreLock&& size_lock
+        engine::SemaphoreLock&& size_lock,
+        std::shared_ptr<PreparedStatementsRegistry> shared_statements
     );
 
     void AsyncConnect(const Dsn& dsn, engine::Deadline deadline);
@@ -89,7 +94,11 @@ public:
         const ResultSet& description,
         tracing::ScopeTime& scope
     );
-    std::vector<ResultSet> GatherPipeline(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
+    std::vector<ResultSet> GatherPipeline(
+        TimeoutDuration timeout,
+        const std::vector<ResultSet>& descriptions,
+        std::vector<std::exception_ptr>* errors
+    );
 
     void Begin(
         const TransactionOptions& options,
@@ -120,6 +129,22 @@ public:
     void Unlisten(std::string_view channel, OptionalCommandControl);
     Notification WaitNotify(engine::Deadline deadline);
 
+    void StartCopyIn(const Query& query, OptionalCommandControl statement_cmd_ctl);
+    void PutCopyData(std::string_view data);
+    ResultSet FinishCopyIn(const char* error_message);
+
+    void StartCopyOut(const Query& query, OptionalCommandControl statement_cmd_ctl);
+    bool GetCopyData(std::string& data);
+    ResultSet FinishCopyOut();
+
+    void StartRowsStream(
+        const Query& query,
+        const QueryParameters& params,
+        OptionalCommandControl statement_cmd_ctl,
+        std::size_t chunk_size
+    );
+    std::optional<ResultSet> FetchRowsChunk();
+
     void CancelAndCleanup(TimeoutDuration timeout);
     bool Cleanup(TimeoutDuration timeout);
 
@@ -162,6 +187,7 @@ private:
         tracing::Span& span,
         tracing::ScopeTime& scope
     );
+    void WarmUpPreparedStatements(engine::Deadline deadline);
     void DiscardOldPreparedStatements(engine::Deadline deadline);
     void DiscardPreparedStatement(const PreparedStatementInfo& info, engine::Deadline deadline);
 
@@ -198,6 +224,12 @@ private:
         const ResultSet* description_ptr
     );
 
+    void StartCopy(const Query& query, OptionalCommandControl statement_cmd_ctl, ExecStatusType expected_status);
+    ResultSet FinishCopy(const char* error_message, bool is_copy_in);
+
+    void ExitPipelineForStreaming(engine::Deadline deadline, tracing::ScopeTime& scope);
+    void RestorePipelineAfterStreaming() noexcept;
+
     void Cancel();
 
     void ReportStatement(const std::string& name);
@@ -208,10 +240,14 @@ private:
     Connection::Statistics stats_;
     PGConnectionWrapper conn_wrapper_;
     PreparedStatements prepared_;
+    std::shared_ptr<PreparedStatementsRegistry> shared_statements_;
     UserTypes db_types_;
     bool is_in_recovery_ = true;
     bool is_read_only_ = true;
     bool is_discard_prepared_pending_ = false;
+    // Statements discarded from the cache but left on the server, see
+    // ConnectionPoolerMode::kTransaction
+    std::size_t unclosed_statements_ = 0;
     ConnectionSettings settings_;
     std::optional<std::chrono::steady_clock::time_point> expires_at_;
 
@@ -222,6 +258,12 @@ private:
     TimeoutDuration current_statement_timeout_{};
     const error_injection::Settings ei_settings_;
 
+    // network timeout for each operation of the current COPY or rows stream
+    TimeoutDuration streaming_network_timeout_{};
+    // COPY and rows streaming are not allowed in pipeline mode, the mode is
+    // restored after them
+    bool is_pipeline_exited_for_streaming_{false};
+
     std::unordered_set<std::string> statements_reported_;
     engine::Mutex statements_mutex_;
 };
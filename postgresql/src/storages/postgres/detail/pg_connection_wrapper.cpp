@@ -1,5 +1,9 @@
 #include <storages/postgres/detail/pg_connection_wrapper.hpp>
 
+#include <algorithm>
+#include <limits>
+#include <memory>
+
 #include <pg_config.h>
 
 #ifndef USERVER_NO_LIBPQ_PATCHES
@@ -560,6 +564,151 @@ ResultSet PGConnectionWrapper::WaitResult(Deadline deadline, tracing::ScopeTime&
     return MakeResult(std::move(handle));
 }
 
+void PGConnectionWrapper::WaitCopyStart(Deadline deadline, tracing::ScopeTime& scope, ExecStatusType expected_status) {
+    scope.Reset(scopes::kLibpqWaitResult);
+    Flush(deadline);
+
+    // In COPY state libpq returns a COPY result on every PQgetResult call, so
+    // exactly one result is read here
+    auto handle = MakeResultHandle(ReadResult(deadline, nullptr));
+    if (!handle) throw RuntimeError{"Empty result"};
+
+    const auto status = PQresultStatus(handle.get());
+    switch (status) {
+        case PGRES_COPY_IN:
+        case PGRES_COPY_OUT:
+        case PGRES_COPY_BOTH:
+            if (status != expected_status) {
+                PGCW_LOG_LIMITED_ERROR() << "COPY statement has unexpected direction";
+                CloseWithError(LogicError{"COPY statement has unexpected direction"});
+            }
+            if (!PQbinaryTuples(handle.get())) {
+                PGCW_LOG_LIMITED_ERROR() << "COPY statement must use the binary format";
+                CloseWithError(LogicError{"COPY statement must use the binary format: WITH (FORMAT binary)"});
+            }
+            UpdateLastUse();
+            return;
+        default:
+            break;
+    }
+
+    // Not a COPY: read the rest of the results to leave the connection usable,
+    // MakeResult throws on errors
+    while (auto* pg_res = ReadResult(deadline, nullptr)) {
+        handle = MakeResultHandle(pg_res);
+    }
+    MakeResult(std::move(handle));
+    throw LogicError{"Statement is not a COPY FROM STDIN / COPY TO STDOUT"};
+}
+
+void PGConnectionWrapper::PutCopyData(std::string_view data, Deadline deadline) {
+    UASSERT(data.size() <= static_cast<std::size_t>(std::numeric_limits<int>::max()));
+    while (true) {
+        const int put_res = PQputCopyData(conn_, data.data(), static_cast<int>(data.size()));
+        if (put_res > 0) break;
+        if (put_res < 0) {
+            HandleSocketPostClose();
+            throw CommandError(PQerrorMessage(conn_));
+        }
+        // Send buffer is full
+        if (!WaitSocketWriteable(deadline)) {
+            if (engine::current_task::ShouldCancel()) {
+                throw ConnectionInterrupted("Task cancelled while sending COPY data");
+            }
+            PGCW_LOG_LIMITED_WARNING() << "Timeout while sending COPY data";
+            throw ConnectionTimeoutError("Timed out while sending COPY data");
+        }
+    }
+    UpdateLastUse();
+}
+
+void PGConnectionWrapper::PutCopyEnd(Deadline deadline, const char* error_message) {
+    while (true) {
+        const int put_res = PQputCopyEnd(conn_, error_message);
+        if (put_res > 0) break;
+        if (put_res < 0) {
+            HandleSocketPostClose();
+            throw CommandError(PQerrorMessage(conn_));
+        }
+        if (!WaitSocketWriteable(deadline)) {
+            if (engine::current_task::ShouldCancel()) {
+                throw ConnectionInterrupted("Task cancelled while finishing COPY");
+            }
+            PGCW_LOG_LIMITED_WARNING() << "Timeout while finishing COPY";
+            throw ConnectionTimeoutError("Timed out while finishing COPY");
+        }
+    }
+    Flush(deadline);
+}
+
+bool PGConnectionWrapper::GetCopyData(std::string& data, Deadline deadline) {
+    while (true) {
+        char* buffer = nullptr;
+        const int get_res = PQgetCopyData(conn_, &buffer, /*async=*/1);
+        if (get_res > 0) {
+            const std::unique_ptr<char, decltype(&PQfreemem)> holder{buffer, &PQfreemem};
+            data.append(buffer, get_res);
+            UpdateLastUse();
+            return true;
+        }
+        if (get_res == -1) return false;
+        if (get_res < -1) {
+            HandleSocketPostClose();
+            throw CommandError(PQerrorMessage(conn_));
+        }
+
+        // No complete row yet
+        if (!WaitSocketReadable(deadline)) {
+            if (engine::current_task::ShouldCancel()) {
+                throw ConnectionInterrupted("Task cancelled while receiving COPY data");
+            }
+            PGCW_LOG_LIMITED_WARNING() << "Timeout while receiving COPY data";
+            throw ConnectionTimeoutError("Timed out while receiving COPY data");
+        }
+        CheckError<CommandError>("PQconsumeInput", PQconsumeInput(conn_));
+    }
+}
+
+void PGConnectionWrapper::SetRowsStreamingMode([[maybe_unused]] std::size_t chunk_size) {
+#if USERVER_LIBPQ_VERSION >= 170000
+    if (chunk_size > 1) {
+        const auto max_chunk_size = static_cast<std::size_t>(std::numeric_limits<int>::max());
+        CheckError<CommandError>(
+            "PQsetChunkedRowsMode", PQsetChunkedRowsMode(conn_, static_cast<int>(std::min(chunk_size, max_chunk_size)))
+        );
+        return;
+    }
+#endif
+    CheckError<CommandError>("PQsetSingleRowMode", PQsetSingleRowMode(conn_));
+}
+
+std::optional<ResultSet> PGConnectionWrapper::WaitRowsChunk(Deadline deadline, tracing::ScopeTime& scope) {
+    scope.Reset(scopes::kLibpqWaitResult);
+    Flush(deadline);
+
+    auto handle = MakeResultHandle(ReadResult(deadline, nullptr));
+    if (!handle) throw RuntimeError{"Empty result"};
+
+    switch (PQresultStatus(handle.get())) {
+        case PGRES_SINGLE_TUPLE:
+#if USERVER_LIBPQ_VERSION >= 170000
+        case PGRES_TUPLES_CHUNK:
+#endif
+            UpdateLastUse();
+            return ResultSet{std::make_shared<detail::ResultWrapper>(std::move(handle))};
+        default:
+            break;
+    }
+
+    // The final result of the query, it has no rows. Read the rest of the
+    // results to leave the connection usable, MakeResult throws on errors
+    while (auto* pg_res = ReadResult(deadline, nullptr)) {
+        [[maybe_unused]] const auto extra_handle = MakeResultHandle(pg_res);
+    }
+    MakeResult(std::move(handle));
+    return std::nullopt;
+}
+
 Notification PGConnectionWrapper::WaitNotify(Deadline deadline) {
     auto notify = std::unique_ptr<PGnotify, decltype(&PQfreemem)>(PQnotifies(conn_), &PQfreemem);
     while (!notify) {
@@ -579,7 +728,8 @@ Notification PGConnectionWrapper::WaitNotify(Deadline deadline) {
 
 std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
     [[maybe_unused]] Deadline deadline,
-    const std::vector<const PGresult*>& descriptions
+    const std::vector<const PGresult*>& descriptions,
+    [[maybe_unused]] std::vector<std::exception_ptr>* errors
 ) {
     UASSERT(!descriptions.empty());
 
@@ -623,7 +773,19 @@ std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
                 return first_field_name != nullptr && std::string_view{first_field_name} == kSetConfigQueryResultName;
             }();
             if (!is_set_config_response) {
-                result.push_back(MakeResult(std::move(handle)));
+                if (!errors) {
+                    result.push_back(MakeResult(std::move(handle)));
+                } else {
+                    // every query is followed by its own sync, so an error does
+                    // not affect the rest of the pipeline
+                    try {
+                        result.push_back(MakeResult(std::move(handle)));
+                        errors->emplace_back();
+                    } catch (const std::exception&) {
+                        result.emplace_back(nullptr);
+                        errors->push_back(std::current_exception());
+                    }
+                }
             }
         }
 
@@ -820,6 +982,20 @@ void PGConnectionWrapper::SendDescribePrepared(const std::string& name, tracing:
     UpdateLastUse();
 }
 
+bool PGConnectionWrapper::SendClosePrepared(
+    [[maybe_unused]] const std::string& name,
+    [[maybe_unused]] tracing::ScopeTime& scope
+) {
+#if USERVER_LIBPQ_VERSION >= 170000
+    scope.Reset(scopes::kLibpqSendClosePrepared);
+    CheckError<CommandError>("PQsendClosePrepared", PQsendClosePrepared(conn_, name.c_str()));
+    UpdateLastUse();
+    return true;
+#else
+    return false;
+#endif
+}
+
 void PGConnectionWrapper::SendPreparedQuery(
     const std::string& name,
     const QueryParameters& params,
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <chrono>
+#include <exception>
+#include <optional>
 #include <string_view>
 
 #include <libpq-fe.h>
@@ -92,6 +94,10 @@ public:
     SendPrepare(const std::string& name, const std::string& statement, const QueryParameters& params, tracing::ScopeTime&);
 
     /// @brief Wrapper for PQsendDescribePrepared
+    /// @brief Send a protocol-level Close message for a prepared statement
+    /// @returns false if libpq is older than 17 and cannot send it
+    bool SendClosePrepared(const std::string& name, tracing::ScopeTime&);
+
     void SendDescribePrepared(const std::string& name, tracing::ScopeTime&);
 
     /// @brief Wrapper for PQsendQueryPrepared
@@ -113,10 +119,48 @@ public:
     /// Will return result or throw an exception
     ResultSet WaitResult(Deadline deadline, tracing::ScopeTime&, const PGresult* description);
 
+    /// @brief Wait for a COPY statement to switch the connection into
+    /// `expected_status` (PGRES_COPY_IN or PGRES_COPY_OUT).
+    ///
+    /// Only the binary COPY format is accepted.
+    void WaitCopyStart(Deadline deadline, tracing::ScopeTime&, ExecStatusType expected_status);
+
+    /// @brief Wrapper for PQputCopyData
+    void PutCopyData(std::string_view data, Deadline deadline);
+
+    /// @brief Wrapper for PQputCopyEnd, a non-null `error_message` makes the
+    /// COPY fail on the server side
+    void PutCopyEnd(Deadline deadline, const char* error_message = nullptr);
+
+    /// @brief Wrapper for PQgetCopyData, appends a chunk of COPY OUT data to
+    /// `data`
+    /// @returns false if there is no more data, the result of the COPY should
+    /// be read with WaitResult then
+    bool GetCopyData(std::string& data, Deadline deadline);
+
+    /// @brief Switch the query that was just sent into chunked rows mode
+    /// (PQsetChunkedRowsMode, libpq 17+) or into single-row mode
+    /// (PQsetSingleRowMode), so that its rows are received as they arrive
+    void SetRowsStreamingMode(std::size_t chunk_size);
+
+    /// @brief Read the next chunk of rows of the query that was switched into
+    /// rows streaming mode
+    /// @returns std::nullopt when the query is complete, throws on errors
+    std::optional<ResultSet> WaitRowsChunk(Deadline deadline, tracing::ScopeTime&);
+
     /// @brief Wait for notification
     Notification WaitNotify(Deadline deadline);
 
-    std::vector<ResultSet> GatherPipeline(Deadline deadline, const std::vector<const PGresult*>& descriptions);
+    /// @brief Read the results of all the queries in the pipeline.
+    ///
+    /// If `errors` is null, the first error is rethrown. Otherwise errors are
+    /// stored into `errors` (one element per result, nullptr for successful
+    /// ones) and the corresponding results are empty.
+    std::vector<ResultSet> GatherPipeline(
+        Deadline deadline,
+        const std::vector<const PGresult*>& descriptions,
+        std::vector<std::exception_ptr>* errors = nullptr
+    );
 
     /// Consume input from connection
     void ConsumeInput(Deadline deadline, const PGresult* description);
@@ -14,6 +14,7 @@
 #include <userver/testsuite/testpoint.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/async.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 #include <userver/utils/impl/userver_experiments.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -34,6 +35,9 @@ constexpr std::chrono::seconds kMaintainInterval{30};
 constexpr std::chrono::seconds kMaxIdleDuration{15};
 constexpr const char* kMaintainTaskName = "pg_maintain";
 
+constexpr std::chrono::seconds kAdaptiveSizingInterval{1};
+constexpr const char* kAdaptiveSizingTaskName = "pg_adaptive_sizing";
+
 constexpr std::chrono::seconds kConnectingTimeout{2};
 constexpr auto kPendingConnectsMax{1};
 
@@ -102,6 +106,8 @@ ConnectionPool::ConnectionPool(
       ei_settings_(std::move(ei_settings)),
       cancel_limit_{std::max(std::size_t{1}, settings.max_size / kCancelRatio), {1, kCancelPeriod}},
       sts_{statement_metrics_settings},
+      shared_statements_{std::make_shared<PreparedStatementsRegistry>(conn_settings.max_prepared_cache_size)},
+      query_batcher_{stats_},
       config_source_(config_source),
       cc_sensor_(*this),
       cc_limiter_(*this),
@@ -117,6 +123,7 @@ ConnectionPool::ConnectionPool(
     if (USERVER_NAMESPACE::utils::impl::kPgCcExperiment.IsEnabled()) {
         cc_controller_.Start();
     }
+    size_semaphore_.SetCapacity(UpdateAdaptiveSize(settings, settings.max_size));
 }
 
 ConnectionPool::~ConnectionPool() {
@@ -231,6 +238,13 @@ ConnectionPtr ConnectionPool::Acquire(engine::Deadline deadline) {
     CheckDeadlineIsExpired(config);
     ConnectionPtr connection{Pop(deadline), std::move(shared_this)};
     ++stats_.connection.used;
+    if (adaptive_size_.load(std::memory_order_relaxed)) {
+        const std::size_t used = stats_.connection.used.Load();
+        auto peak_used = peak_used_since_adjust_.load(std::memory_order_relaxed);
+        while (peak_used < used &&
+               !peak_used_since_adjust_.compare_exchange_weak(peak_used, used, std::memory_order_relaxed)) {
+        }
+    }
     CheckDeadlineIsExpired(config);
 
     connection->UpdateDefaultCommandControl();
@@ -316,9 +330,18 @@ const InstanceStatistics& ConnectionPool::GetStatistics() const {
     stats_.connection.waiting = wait_count_.load(std::memory_order_relaxed);
     stats_.connection.maximum = settings->max_size;
     stats_.connection.max_queue_size = settings->max_queue_size;
+    stats_.adaptive_sizing.size = size_semaphore_.GetCapacity();
     return stats_;
 }
 
+std::size_t ConnectionPool::GetInFlightCount() const noexcept {
+    return stats_.connection.used.Load() + wait_count_.load(std::memory_order_relaxed);
+}
+
+void ConnectionPool::AccountHostSelected() noexcept { ++stats_.host_selection.selected_total; }
+
+void ConnectionPool::AccountLaggingHostSkipped() noexcept { ++stats_.host_selection.lagging_skipped_total; }
+
 Transaction ConnectionPool::Begin(const TransactionOptions& options, OptionalCommandControl trx_cmd_ctl) {
     const auto trx_start_time = detail::SteadyClock::now();
     const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(GetExecuteTimeout(trx_cmd_ctl));
@@ -335,6 +358,39 @@ NonTransaction ConnectionPool::Start(OptionalCommandControl cmd_ctl) {
     return NonTransaction{std::move(conn), start_time};
 }
 
+ResultSet ConnectionPool::ExecuteBatched(
+    OptionalCommandControl cmd_ctl,
+    const Query& query,
+    QueryBatcher::ParamsWriter params
+) {
+    const auto settings = settings_.Read();
+    const auto cc = cmd_ctl.value_or(GetDefaultCommandControl());
+    const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(cc.execute);
+    return query_batcher_.Execute(
+        settings->query_batching_window,
+        settings->max_query_batch_size,
+        [this](engine::Deadline acquire_deadline) { return Acquire(acquire_deadline); },
+        cc,
+        deadline,
+        query,
+        params
+    );
+}
+
+ResultStream ConnectionPool::MakeResultStream(
+    OptionalCommandControl cmd_ctl,
+    std::size_t chunk_size,
+    const Query& query,
+    QueryBatcher::ParamsWriter params
+) {
+    const auto start_time = detail::SteadyClock::now();
+    const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(GetExecuteTimeout(cmd_ctl));
+    auto conn = Acquire(deadline);
+    UASSERT(conn);
+    const auto query_params = params(conn->GetUserTypes());
+    return ResultStream{std::move(conn), start_time, query, query_params, cmd_ctl, chunk_size};
+}
+
 NotifyScope ConnectionPool::Listen(std::string_view channel, OptionalCommandControl cmd_ctl) {
     const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(GetExecuteTimeout(cmd_ctl));
     auto conn = Acquire(deadline);
@@ -357,8 +413,12 @@ void ConnectionPool::SetSettings(const PoolSettings& settings) {
 
     auto reader = settings_.Read();
     if (*reader == settings) return;
-    if (reader->max_size != max_connections) {
-        size_semaphore_.SetCapacity(max_connections);
+    {
+        std::lock_guard lock{capacity_mutex_};
+        const auto capacity = UpdateAdaptiveSize(settings, max_connections);
+        if (size_semaphore_.GetCapacity() != capacity) {
+            size_semaphore_.SetCapacity(capacity);
+        }
     }
     if (reader->connecting_limit != settings.connecting_limit)
         connecting_semaphore_.SetCapacity(settings.connecting_limit ? settings.connecting_limit : kUnlimitedConnecting);
@@ -377,6 +437,8 @@ void ConnectionPool::SetConnectionSettings(const ConnectionSettings& settings) {
         *writer = settings;
         if (old_settings.RequiresConnectionReset(settings)) {
             writer->version = old_version + 1;
+            // descriptions may depend on the changed settings
+            shared_statements_->Reset(settings.max_prepared_cache_size);
         }
         writer.Commit();
     }
@@ -388,6 +450,45 @@ void ConnectionPool::SetStatementMetricsSettings(const StatementMetricsSettings&
 
 void ConnectionPool::SetMaxConnectionsCc(std::size_t max_connections) { cc_max_connections_ = max_connections; }
 
+void ConnectionPool::AdjustSize() {
+    const auto acquires = acquires_since_adjust_.exchange(0, std::memory_order_relaxed);
+    const std::chrono::microseconds wait{acquire_wait_us_since_adjust_.exchange(0, std::memory_order_relaxed)};
+    const auto peak_used = std::max<std::size_t>(
+        peak_used_since_adjust_.exchange(0, std::memory_order_relaxed), stats_.connection.used.Load()
+    );
+
+    std::unique_lock lock{capacity_mutex_};
+    const auto settings = settings_.Read();
+    const auto size = adaptive_size_.load();
+    if (!size) return;
+
+    const auto average_wait = acquires ? wait / static_cast<std::int64_t>(acquires) : std::chrono::microseconds{0};
+    const auto min_size = std::min(std::max(settings->min_size, std::size_t{1}), settings->max_size);
+    auto new_size = size;
+    if (average_wait > settings->adaptive_sizing_target_wait) {
+        // grow fast to handle a peak
+        new_size = std::min(settings->max_size, size + std::max(size / 2, std::size_t{1}));
+    } else if (average_wait * 2 <= settings->adaptive_sizing_target_wait && peak_used + 1 < size) {
+        // shrink slowly, a part of the unused connections at a time
+        new_size = std::max(min_size, size - std::max((size - peak_used) / 4, std::size_t{1}));
+    }
+    if (new_size == size) return;
+
+    adaptive_size_ = new_size;
+    size_semaphore_.SetCapacity(new_size);
+    lock.unlock();
+
+    LOG_INFO() << (new_size > size ? "Growing" : "Shrinking") << " connection pool to `" << DsnCutPassword(dsn_)
+               << "` from " << size << " to " << new_size << " connections, average wait for a connection is "
+               << average_wait.count() << "us, peak busy connections " << peak_used;
+    if (new_size > size) {
+        ++stats_.adaptive_sizing.grow_total;
+    } else {
+        ++stats_.adaptive_sizing.shrink_total;
+        DropExcessIdleConnections();
+    }
+}
+
 dynamic_config::Source ConnectionPool::GetConfigSource() const { return config_source_; }
 
 const Dsn& ConnectionPool::GetDsn() const { return dsn_; }
@@ -423,7 +524,8 @@ bool ConnectionPool::DoConnect(engine::SemaphoreLock size_lock, ConnectionSettin
             default_cmd_ctls_,
             testsuite_pg_ctl_,
             ei_settings_,
-            std::move(size_lock)
+            std::move(size_lock),
+            shared_statements_
         );
     } catch (const ConnectionTimeoutError&) {
         // No problem if it's connection error
@@ -467,6 +569,42 @@ void ConnectionPool::TryCreateConnectionAsync() {
     }
 }
 
+std::size_t ConnectionPool::UpdateAdaptiveSize(const PoolSettings& settings, std::size_t max_connections) {
+    if (settings.adaptive_sizing_target_wait.count() <= 0) {
+        adaptive_size_ = 0;
+        return max_connections;
+    }
+
+    // the pool starts small and grows on demand, the upper limit comes from
+    // the settings, the connlimit watchdog and the congestion control
+    const auto min_size = std::min(std::max(settings.min_size, std::size_t{1}), max_connections);
+    auto size = adaptive_size_.load();
+    if (!size) size = min_size;
+    size = std::clamp(size, min_size, max_connections);
+    adaptive_size_ = size;
+    return size;
+}
+
+void ConnectionPool::AccountAcquireWait(std::chrono::steady_clock::duration wait) {
+    acquire_wait_us_since_adjust_.fetch_add(
+        std::chrono::duration_cast<std::chrono::microseconds>(wait).count(), std::memory_order_relaxed
+    );
+}
+
+void ConnectionPool::DropExcessIdleConnections() {
+    // Connections release their size locks asynchronously on close, so the
+    // excess is computed once
+    const auto used = size_semaphore_.UsedApprox();
+    const auto capacity = size_semaphore_.GetCapacity();
+    auto excess = used > capacity ? used - capacity : 0;
+    Connection* connection = nullptr;
+    while (excess > 0 && conn_consumer_.PopNoblock(connection)) {
+        LOG_DEBUG() << "Drop idle connection to `" << DsnCutPassword(dsn_) << "` to shrink the pool";
+        DeleteConnection(connection);
+        --excess;
+    }
+}
+
 void ConnectionPool::CheckMinPoolSizeUnderflow() {
     auto settings = settings_.Read();
     auto count = size_semaphore_.UsedApprox();
@@ -514,6 +652,7 @@ Connection* ConnectionPool::Pop(engine::Deadline deadline) {
         throw PoolError("Deadline reached before trying to get a connection");
     }
     Stopwatch st{stats_.acquire_percentile};
+    acquires_since_adjust_.fetch_add(1, std::memory_order_relaxed);
     Connection* connection = nullptr;
     auto conn_settings = conn_settings_.Read();
     while (conn_consumer_.PopNoblock(connection)) {
@@ -528,6 +667,11 @@ Connection* ConnectionPool::Pop(engine::Deadline deadline) {
         return connection;
     }
 
+    const auto wait_start = std::chrono::steady_clock::now();
+    USERVER_NAMESPACE::utils::FastScopeGuard account_wait{[this, wait_start]() noexcept {
+        AccountAcquireWait(std::chrono::steady_clock::now() - wait_start);
+    }};
+
     auto settings = settings_.Read();
     SizeGuard wg(wait_count_);
     if (wg.GetValue() > settings->max_queue_size) {
@@ -694,9 +838,15 @@ void ConnectionPool::StartMaintainTask() {
     using Flags = USERVER_NAMESPACE::utils::PeriodicTask::Flags;
 
     ping_task_.Start(kMaintainTaskName, {kMaintainInterval, Flags::kStrong}, [this] { MaintainConnections(); });
+    adaptive_sizing_task_.Start(kAdaptiveSizingTaskName, {kAdaptiveSizingInterval, Flags::kStrong}, [this] {
+        AdjustSize();
+    });
 }
 
-void ConnectionPool::StopMaintainTask() { ping_task_.Stop(); }
+void ConnectionPool::StopMaintainTask() {
+    adaptive_sizing_task_.Stop();
+    ping_task_.Stop();
+}
 
 void ConnectionPool::StopConnectTasks() {
     const auto task_count = connect_task_storage_.ActiveTasksApprox();
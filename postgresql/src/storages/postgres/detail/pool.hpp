@@ -1,6 +1,8 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -9,6 +11,7 @@
 #include <userver/concurrent/queue.hpp>
 #include <userver/dynamic_config/source.hpp>
 #include <userver/engine/condition_variable.hpp>
+#include <userver/engine/mutex.hpp>
 #include <userver/engine/semaphore.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/engine/task/task_with_result.hpp>
@@ -31,6 +34,8 @@
 
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/detail/pg_impl_types.hpp>
+#include <storages/postgres/detail/prepared_statements_registry.hpp>
+#include <storages/postgres/detail/query_batcher.hpp>
 #include <storages/postgres/detail/size_guard.hpp>
 #include <storages/postgres/detail/statement_stats_storage.hpp>
 
@@ -80,10 +85,29 @@ public:
     void Release(Connection* connection);
 
     const InstanceStatistics& GetStatistics() const;
+
+    /// Number of connections in use plus the number of requests waiting for
+    /// a connection
+    std::size_t GetInFlightCount() const noexcept;
+
+    void AccountHostSelected() noexcept;
+    void AccountLaggingHostSkipped() noexcept;
+
     [[nodiscard]] Transaction Begin(const TransactionOptions& options, OptionalCommandControl trx_cmd_ctl = {});
 
     [[nodiscard]] NonTransaction Start(OptionalCommandControl cmd_ctl = {});
 
+    /// Execute a single statement in a batch with the statements of other
+    /// coroutines, see QueryBatcher
+    ResultSet ExecuteBatched(OptionalCommandControl cmd_ctl, const Query& query, QueryBatcher::ParamsWriter params);
+
+    ResultStream MakeResultStream(
+        OptionalCommandControl cmd_ctl,
+        std::size_t chunk_size,
+        const Query& query,
+        QueryBatcher::ParamsWriter params
+    );
+
     NotifyScope Listen(std::string_view channel, OptionalCommandControl cmd_ctl = {});
 
     CommandControl GetDefaultCommandControl() const;
@@ -98,6 +122,11 @@ public:
 
     void SetMaxConnectionsCc(std::size_t max_connections);
 
+    /// Grows or shrinks the pool size limit depending on the time the requests
+    /// waited for connections since the previous call, see
+    /// PoolSettings::adaptive_sizing_target_wait. Called periodically.
+    void AdjustSize();
+
     dynamic_config::Source GetConfigSource() const;
 
     const Dsn& GetDsn() const;
@@ -115,6 +144,10 @@ private:
     void TryCreateConnectionAsync();
     void CheckMinPoolSizeUnderflow();
 
+    std::size_t UpdateAdaptiveSize(const PoolSettings& settings, std::size_t max_connections);
+    void AccountAcquireWait(std::chrono::steady_clock::duration wait);
+    void DropExcessIdleConnections();
+
     void Push(Connection* connection);
     Connection* Pop(engine::Deadline);
 
@@ -163,6 +196,8 @@ private:
     RecentCounter recent_conn_errors_;
     USERVER_NAMESPACE::utils::TokenBucket cancel_limit_;
     detail::StatementStatsStorage sts_;
+    std::shared_ptr<PreparedStatementsRegistry> shared_statements_;
+    QueryBatcher query_batcher_;
     dynamic_config::Source config_source_;
 
     // Congestion control stuff
@@ -170,6 +205,15 @@ private:
     cc::Limiter cc_limiter_;
     congestion_control::v2::LinearController cc_controller_;
     std::atomic<std::size_t> cc_max_connections_{0};
+
+    // Adaptive sizing stuff
+    USERVER_NAMESPACE::utils::PeriodicTask adaptive_sizing_task_;
+    engine::Mutex capacity_mutex_;
+    // 0 if adaptive sizing is disabled
+    std::atomic<std::size_t> adaptive_size_{0};
+    std::atomic<std::uint64_t> acquires_since_adjust_{0};
+    std::atomic<std::uint64_t> acquire_wait_us_since_adjust_{0};
+    std::atomic<std::size_t> peak_used_since_adjust_{0};
 };
 
 }  // namespace storages::postgres::detail
@@ -0,0 +1,82 @@
+#include <storages/postgres/detail/prepared_statements_registry.hpp>
+
+#include <algorithm>
+#include <utility>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+PreparedStatementsRegistry::Statement::Statement(
+    std::string statement,
+    const QueryParameters& params,
+    ResultSet description
+)
+    : statement_{std::move(statement)},
+      param_types_(params.ParamTypesBuffer(), params.ParamTypesBuffer() + params.Size()),
+      description_{std::move(description)} {}
+
+QueryParameters PreparedStatementsRegistry::Statement::GetParameterTypes() const { return QueryParameters{*this}; }
+
+PreparedStatementsRegistry::PreparedStatementsRegistry(std::size_t max_size) : statements_{max_size} {}
+
+PreparedStatementsRegistry::StatementPtr PreparedStatementsRegistry::Find(std::size_t query_id) {
+    auto statements = statements_.Lock();
+    auto* statement = statements->Get(query_id);
+    return statement ? *statement : nullptr;
+}
+
+PreparedStatementsRegistry::StatementPtr PreparedStatementsRegistry::Add(
+    std::size_t query_id,
+    const std::string& statement,
+    const QueryParameters& params,
+    ResultSet description
+) {
+    auto new_statement = std::make_shared<Statement>(statement, params, std::move(description));
+
+    auto statements = statements_.Lock();
+    if (auto* existing = statements->Get(query_id)) return *existing;
+    statements->Put(query_id, new_statement);
+    return new_statement;
+}
+
+std::vector<PreparedStatementsRegistry::StatementPtr> PreparedStatementsRegistry::GetMostExecuted(std::size_t count
+) const {
+    // execution counts are changed concurrently, so they are sorted as of now
+    std::vector<std::pair<std::uint64_t, StatementPtr>> statements_by_count;
+    {
+        auto statements = statements_.Lock();
+        statements_by_count.reserve(statements->GetSize());
+        statements->VisitAll([&statements_by_count](const std::size_t&, const StatementPtr& statement) {
+            statements_by_count.emplace_back(statement->GetExecutedCount(), statement);
+        });
+    }
+
+    const auto size = std::min(count, statements_by_count.size());
+    std::partial_sort(
+        statements_by_count.begin(),
+        statements_by_count.begin() + size,
+        statements_by_count.end(),
+        [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; }
+    );
+
+    std::vector<StatementPtr> result;
+    result.reserve(size);
+    for (std::size_t i = 0; i < size; ++i) result.push_back(std::move(statements_by_count[i].second));
+    return result;
+}
+
+void PreparedStatementsRegistry::Clear() {
+    auto statements = statements_.Lock();
+    statements->Clear();
+}
+
+void PreparedStatementsRegistry::Reset(std::size_t max_size) {
+    auto statements = statements_.Lock();
+    statements->Clear();
+    statements->SetMaxSize(max_size);
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// Statements prepared by the connections of a pool. The connections reuse
+/// the descriptions of the statements instead of describing them once again,
+/// and prepare the most executed statements right after connecting.
+class PreparedStatementsRegistry final {
+public:
+    class Statement final {
+    public:
+        Statement(std::string statement, const QueryParameters& params, ResultSet description);
+
+        const std::string& GetStatement() const noexcept { return statement_; }
+
+        /// Parameters with types only, suitable for preparing the statement
+        QueryParameters GetParameterTypes() const;
+
+        /// Description with the buffer categories filled, must not be changed
+        const ResultSet& GetDescription() const noexcept { return description_; }
+
+        void AccountExecution() noexcept { executed_.fetch_add(1, std::memory_order_relaxed); }
+        std::uint64_t GetExecutedCount() const noexcept { return executed_.load(std::memory_order_relaxed); }
+
+        /// @name ParamsHolder interface for QueryParameters
+        /// @{
+        std::size_t Size() const noexcept { return param_types_.size(); }
+        const Oid* ParamTypesBuffer() const noexcept { return param_types_.data(); }
+        const char* const* ParamBuffers() const noexcept { return nullptr; }
+        const int* ParamLengthsBuffer() const noexcept { return nullptr; }
+        const int* ParamFormatsBuffer() const noexcept { return nullptr; }
+        /// @}
+
+    private:
+        const std::string statement_;
+        const std::vector<Oid> param_types_;
+        const ResultSet description_;
+        std::atomic<std::uint64_t> executed_{0};
+    };
+    using StatementPtr = std::shared_ptr<Statement>;
+
+    explicit PreparedStatementsRegistry(std::size_t max_size);
+
+    /// @returns nullptr if the statement was not described by any connection
+    StatementPtr Find(std::size_t query_id);
+
+    /// Stores the described statement, returns the already stored one if
+    /// another connection was faster
+    StatementPtr
+    Add(std::size_t query_id, const std::string& statement, const QueryParameters& params, ResultSet description);
+
+    /// @returns up to `count` statements ordered by execution count, descending
+    std::vector<StatementPtr> GetMostExecuted(std::size_t count) const;
+
+    /// Forgets all the statements, e.g. after a schema change
+    void Clear();
+
+    /// Forgets all the statements and changes the size limit
+    void Reset(std::size_t max_size);
+
+private:
+    using Statements = cache::LruMap<std::size_t, StatementPtr>;
+
+    mutable concurrent::Variable<Statements> statements_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
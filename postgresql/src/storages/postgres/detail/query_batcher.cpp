@@ -0,0 +1,249 @@
+#include <storages/postgres/detail/query_batcher.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#include <fmt/format.h>
+
+#include <userver/engine/task/cancel.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/scope_guard.hpp>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/detail/statement_stats.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+struct QueryBatcher::Request final {
+    CommandControl cmd_ctl;
+    engine::Deadline deadline;
+    const Query& query;
+    ParamsWriter params;
+
+    // Both fields are only changed under the mutex, or by the leader after the
+    // request is taken into a batch
+    bool is_leader{false};
+    bool is_done{false};
+
+    std::optional<ResultSet> result{};
+    std::exception_ptr error{};
+
+    // Signalled when the request becomes the leader or is done
+    engine::SingleConsumerEvent event{};
+};
+
+QueryBatcher::QueryBatcher(InstanceStatistics& stats) : stats_{stats} {}
+
+ResultSet QueryBatcher::Execute(
+    std::chrono::microseconds window,
+    std::size_t max_batch_size,
+    ConnectionAcquirer acquire,
+    CommandControl cmd_ctl,
+    engine::Deadline deadline,
+    const Query& query,
+    ParamsWriter params
+) {
+    UASSERT(max_batch_size > 0);
+
+    Request request{cmd_ctl, deadline, query, params};
+    {
+        const std::lock_guard lock{mutex_};
+        pending_.push_back(&request);
+        if (!has_leader_) {
+            has_leader_ = true;
+            request.is_leader = true;
+            batch_full_.Reset();
+        } else if (pending_.size() >= max_batch_size) {
+            batch_full_.Send();
+        }
+    }
+
+    if (!request.is_leader) WaitForTurn(request);
+    if (!request.is_done) Lead(request, window, max_batch_size, acquire);
+
+    UASSERT(request.is_done);
+    if (request.error) std::rethrow_exception(request.error);
+    UASSERT(request.result);
+    return std::move(*request.result);
+}
+
+void QueryBatcher::WaitForTurn(Request& request) {
+    if (request.event.WaitForEvent()) return;
+
+    // The task is cancelled. The request may only be withdrawn while it is not
+    // taken into a batch, as the leader uses the parameters owned by this task.
+    bool is_leader = false;
+    {
+        const std::lock_guard lock{mutex_};
+        is_leader = request.is_leader;
+        if (!is_leader) {
+            const auto it = std::find(pending_.begin(), pending_.end(), &request);
+            if (it != pending_.end()) {
+                pending_.erase(it);
+                throw ConnectionInterrupted{"Waiting for a query batch was cancelled"};
+            }
+        }
+    }
+    if (is_leader) return;
+
+    const engine::TaskCancellationBlocker cancel_blocker;
+    [[maybe_unused]] const bool is_done = request.event.WaitForEvent();
+    UASSERT(is_done);
+}
+
+void QueryBatcher::Lead(
+    Request& own_request,
+    std::chrono::microseconds window,
+    std::size_t max_batch_size,
+    ConnectionAcquirer acquire
+) {
+    // Other tasks wait for the results of the batch, it must be executed anyway
+    const engine::TaskCancellationBlocker cancel_blocker;
+
+    bool should_wait = false;
+    {
+        const std::lock_guard lock{mutex_};
+        should_wait = pending_.size() < max_batch_size;
+    }
+    if (should_wait && window.count() > 0) {
+        [[maybe_unused]] const bool is_full = batch_full_.WaitForEventFor(window);
+    }
+
+    Batch batch;
+    {
+        const std::lock_guard lock{mutex_};
+        const auto size = std::min(pending_.size(), max_batch_size);
+        batch.assign(pending_.begin(), pending_.begin() + size);
+        pending_.erase(pending_.begin(), pending_.begin() + size);
+        if (pending_.empty()) {
+            has_leader_ = false;
+        } else {
+            // the rest of the requests make the next batch
+            auto& next_leader = *pending_.front();
+            next_leader.is_leader = true;
+            next_leader.event.Send();
+        }
+    }
+    UASSERT(!batch.empty() && batch.front() == &own_request);
+
+    ExecuteBatch(batch, acquire);
+
+    for (auto* request : batch) {
+        request->is_done = true;
+        // the request may be destroyed right after the event is sent
+        if (request != &own_request) request->event.Send();
+    }
+}
+
+void QueryBatcher::ExecuteBatch(const Batch& batch, ConnectionAcquirer acquire) {
+    const auto start_time = SteadyClock::now();
+    auto deadline = batch.front()->deadline;
+    for (const auto* request : batch) deadline = std::min(deadline, request->deadline);
+
+    try {
+        auto conn = acquire(deadline);
+
+        const auto batch_size = static_cast<std::uint32_t>(batch.size());
+        ++stats_.batching.batches_total;
+        stats_.batching.queries_total += batch_size;
+        stats_.batching.batch_size.GetCurrentCounter().Account(batch_size);
+
+        conn->Start(start_time);
+        const USERVER_NAMESPACE::utils::ScopeGuard finish_guard{[&conn] { conn->Finish(); }};
+
+        if (batch.size() > 1 && conn->IsPipelineActive() && conn->ArePreparedStatementsEnabled()) {
+            ExecutePipelined(conn, batch);
+        } else {
+            ExecuteSequentially(conn, batch);
+        }
+    } catch (const std::exception&) {
+        for (auto* request : batch) {
+            if (!request->result && !request->error) request->error = std::current_exception();
+        }
+    }
+}
+
+void QueryBatcher::ExecuteSequentially(ConnectionPtr& conn, const Batch& batch) {
+    for (auto* request : batch) {
+        StatementStats stats{request->query, conn};
+        try {
+            request->result = conn->Execute(
+                request->query, request->params(conn->GetUserTypes()), OptionalCommandControl{request->cmd_ctl}
+            );
+            stats.AccountStatementExecution();
+        } catch (const std::exception&) {
+            stats.AccountStatementError();
+            request->error = std::current_exception();
+        }
+    }
+}
+
+void QueryBatcher::ExecutePipelined(ConnectionPtr& conn, const Batch& batch) {
+    struct PipelinedQuery final {
+        Request* request;
+        QueryParameters params;
+        std::string statement_name;
+        StatementStats stats;
+    };
+
+    tracing::Span batch_span{"pg_query_batch"};
+    batch_span.AddTag("batch_size", batch.size());
+    auto scope = batch_span.CreateScopeTime();
+
+    std::vector<PipelinedQuery> queries;
+    std::vector<ResultSet> descriptions;
+    queries.reserve(batch.size());
+    descriptions.reserve(batch.size());
+
+    // Statements must be prepared before the pipeline is filled, as preparing
+    // waits for its own result
+    TimeoutDuration timeout{0};
+    for (auto* request : batch) {
+        StatementStats stats{request->query, conn};
+        try {
+            auto params = request->params(conn->GetUserTypes());
+            auto meta = conn->PrepareStatement(request->query, params, request->cmd_ctl.execute);
+            queries.push_back({request, params, std::move(meta.statement_name), stats});
+            descriptions.push_back(std::move(meta.description));
+            timeout = std::max(timeout, request->cmd_ctl.execute);
+        } catch (const std::exception&) {
+            stats.AccountStatementError();
+            request->error = std::current_exception();
+        }
+    }
+    if (queries.empty()) return;
+
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+        const auto& query = queries[i];
+        conn->AddIntoPipeline(query.request->cmd_ctl, query.statement_name, query.params, descriptions[i], scope);
+    }
+
+    std::vector<std::exception_ptr> errors;
+    errors.reserve(queries.size());
+    auto results = conn->GatherPipeline(timeout, descriptions, errors);
+    if (results.size() != queries.size() || errors.size() != queries.size()) {
+        throw RuntimeError{
+            fmt::format("Query batch results count mismatch: expected {}, got {}", queries.size(), results.size())};
+    }
+
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+        auto& query = queries[i];
+        if (errors[i]) {
+            query.stats.AccountStatementError();
+            query.request->error = errors[i];
+        } else {
+            query.stats.AccountStatementExecution();
+            query.request->result = std::move(results[i]);
+        }
+    }
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
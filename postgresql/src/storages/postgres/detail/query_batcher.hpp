@@ -0,0 +1,86 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <vector>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/utils/function_ref.hpp>
+
+#include <userver/storages/postgres/detail/connection_ptr.hpp>
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+#include <userver/storages/postgres/statistics.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// Coalesces single-statement executions of different coroutines into batches
+/// that are sent to the server over a single connection in pipeline mode.
+///
+/// The first coroutine that finds no batch being collected becomes the leader
+/// of the next batch. The leader waits for the batching window (or until the
+/// batch is full), acquires a connection and executes the whole batch, then
+/// hands the results and errors to their callers. The other coroutines only
+/// wait for their results. Each statement is followed by its own pipeline
+/// sync, so the statements are still independent auto-commit transactions.
+///
+/// If pipeline mode or prepared statements are disabled on the connection,
+/// the batch is executed statement by statement on that single connection.
+class QueryBatcher final {
+public:
+    /// Writes the query parameters with the user types of the connection, the
+    /// result must stay valid until the statement is executed
+    using ParamsWriter = USERVER_NAMESPACE::utils::function_ref<QueryParameters(const UserTypes&)>;
+    using ConnectionAcquirer = USERVER_NAMESPACE::utils::function_ref<ConnectionPtr(engine::Deadline)>;
+
+    explicit QueryBatcher(InstanceStatistics& stats);
+
+    QueryBatcher(const QueryBatcher&) = delete;
+    QueryBatcher& operator=(const QueryBatcher&) = delete;
+
+    ResultSet Execute(
+        std::chrono::microseconds window,
+        std::size_t max_batch_size,
+        ConnectionAcquirer acquire,
+        CommandControl cmd_ctl,
+        engine::Deadline deadline,
+        const Query& query,
+        ParamsWriter params
+    );
+
+private:
+    struct Request;
+    using Batch = std::vector<Request*>;
+
+    void WaitForTurn(Request& request);
+    void Lead(
+        Request& own_request,
+        std::chrono::microseconds window,
+        std::size_t max_batch_size,
+        ConnectionAcquirer acquire
+    );
+
+    void ExecuteBatch(const Batch& batch, ConnectionAcquirer acquire);
+    void ExecuteSequentially(ConnectionPtr& conn, const Batch& batch);
+    void ExecutePipelined(ConnectionPtr& conn, const Batch& batch);
+
+    InstanceStatistics& stats_;
+
+    engine::Mutex mutex_;
+    // requests that are not taken into a batch yet, in arrival order
+    std::vector<Request*> pending_;
+    bool has_leader_{false};
+    engine::SingleConsumerEvent batch_full_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
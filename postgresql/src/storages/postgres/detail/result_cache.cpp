@@ -0,0 +1,118 @@
+#include <storages/postgres/detail/result_cache.hpp>
+
+#include <algorithm>
+#include <utility>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+// Limits the number of the cached results, the buckets of the LRU are
+// allocated for all of them upfront
+constexpr std::size_t kExpectedEntrySizeBytes = 256;
+constexpr std::size_t kMaxEntries = 1 << 20;
+
+std::size_t GetMaxEntries(std::size_t max_size_bytes) {
+    return std::clamp<std::size_t>(max_size_bytes / kExpectedEntrySizeBytes, 1, kMaxEntries);
+}
+
+std::size_t GetDataSize(const ResultSet& result) {
+    std::size_t size = 0;
+    for (const auto row : result) {
+        for (const auto field : row) {
+            size += field.Length();
+        }
+    }
+    return size;
+}
+
+template <typename T>
+void AppendBytes(std::string& key, const T& value) {
+    key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+}  // namespace
+
+ResultCache::ResultCache(const ResultCacheSettings& settings)
+    : max_size_bytes_{settings.max_size_bytes}, ttl_{settings.ttl}, data_{GetMaxEntries(settings.max_size_bytes)} {}
+
+std::optional<ResultSet> ResultCache::Get(const Query& query, const QueryParameters& params) {
+    const auto key = MakeKey(query, params);
+    const auto now = Clock::now();
+
+    auto data = data_.Lock();
+    auto* stmt_stats = query.GetName() ? &data->stats.per_statement[query.GetName()->GetUnderlying()] : nullptr;
+    if (auto* entry = data->entries.Get(key)) {
+        if (entry->expires_at > now) {
+            ++data->stats.hits;
+            if (stmt_stats) ++stmt_stats->hits;
+            return entry->result;
+        }
+        Erase(*data, key);
+    }
+    ++data->stats.misses;
+    if (stmt_stats) ++stmt_stats->misses;
+    return std::nullopt;
+}
+
+void ResultCache::Put(const Query& query, const QueryParameters& params, ResultSet result) {
+    auto key = MakeKey(query, params);
+    const auto size_bytes = key.size() + GetDataSize(result);
+    if (size_bytes > max_size_bytes_) return;
+    const auto expires_at = Clock::now() + ttl_;
+
+    auto data = data_.Lock();
+    Erase(*data, key);
+    while (data->size_bytes + size_bytes > max_size_bytes_ ||
+           data->entries.GetSize() >= data->entries.GetCapacity()) {
+        const auto* least_used = data->entries.GetLeastUsedKey();
+        if (!least_used) break;
+        Erase(*data, std::string{*least_used});
+    }
+    data->entries.Put(key, Entry{std::move(result), expires_at, size_bytes});
+    data->size_bytes += size_bytes;
+}
+
+void ResultCache::Invalidate() {
+    auto data = data_.Lock();
+    data->entries.Clear();
+    data->size_bytes = 0;
+    ++data->stats.invalidations;
+}
+
+ResultCacheStatistics ResultCache::GetStatistics() const {
+    auto data = data_.Lock();
+    auto stats = data->stats;
+    stats.enabled = IsEnabled();
+    stats.size_bytes = data->size_bytes;
+    stats.entries = data->entries.GetSize();
+    return stats;
+}
+
+std::string ResultCache::MakeKey(const Query& query, const QueryParameters& params) {
+    const auto& statement = query.Statement();
+    std::string key;
+    key.reserve(statement.size() + 1 + params.Size() * (sizeof(Oid) + sizeof(int)));
+    key.append(statement);
+    key.push_back('\0');
+    for (std::size_t i = 0; i < params.Size(); ++i) {
+        AppendBytes(key, params.ParamTypesBuffer()[i]);
+        const auto length = params.ParamLengthsBuffer()[i];
+        AppendBytes(key, length);
+        if (length > 0) key.append(params.ParamBuffers()[i], length);
+    }
+    return key;
+}
+
+void ResultCache::Erase(Data& data, const std::string& key) {
+    auto* entry = data.entries.Get(key);
+    if (!entry) return;
+    data.size_bytes -= entry->size_bytes;
+    data.entries.Erase(key);
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+#include <userver/storages/postgres/statistics.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// Results of read-only statements of a cluster, keyed by the statement text
+/// and the binary values of its parameters. The total size of the results is
+/// limited, the least recently used ones are dropped first.
+class ResultCache final {
+public:
+    explicit ResultCache(const ResultCacheSettings& settings);
+
+    bool IsEnabled() const noexcept { return max_size_bytes_ != 0; }
+
+    /// @returns the cached result if it has not expired yet, accounts a hit
+    /// or a miss of the statement
+    std::optional<ResultSet> Get(const Query& query, const QueryParameters& params);
+
+    /// Caches the result of the statement for the configured time, results
+    /// larger than the whole cache are not cached
+    void Put(const Query& query, const QueryParameters& params, ResultSet result);
+
+    /// Drops all the cached results, e.g. on a notification
+    void Invalidate();
+
+    ResultCacheStatistics GetStatistics() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry {
+        ResultSet result;
+        Clock::time_point expires_at;
+        std::size_t size_bytes;
+    };
+
+    struct Data {
+        explicit Data(std::size_t max_entries) : entries{max_entries} {}
+
+        cache::LruMap<std::string, Entry> entries;
+        std::size_t size_bytes{0};
+        ResultCacheStatistics stats;
+    };
+
+    static std::string MakeKey(const Query& query, const QueryParameters& params);
+
+    static void Erase(Data& data, const std::string& key);
+
+    const std::size_t max_size_bytes_;
+    const std::chrono::milliseconds ttl_;
+    mutable concurrent::Variable<Data> data_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
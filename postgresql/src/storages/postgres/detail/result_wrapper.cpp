@@ -138,6 +138,14 @@ bool AddTypeBufferCategories(
     return true;
 }
 
+void CheckBinaryFormat(const PGresult* res, std::size_t col) {
+    if (PQfformat(res, col) != io::kPgBinaryDataFormat) {
+        throw ResultSetError{
+            fmt::format("Column with index {} has text format\n", col) +
+            logging::stacktrace_cache::to_string(boost::stacktrace::stacktrace{})};
+    }
+}
+
 }  // namespace
 
 struct ResultWrapper::CachedFieldBufferCategories final {
@@ -254,11 +262,7 @@ std::size_t ResultWrapper::GetFieldLength(std::size_t row, std::size_t col) cons
 }
 
 io::FieldBuffer ResultWrapper::GetFieldBuffer(std::size_t row, std::size_t col) const {
-    if (PQfformat(handle_.get(), col) != io::kPgBinaryDataFormat) {
-        throw ResultSetError{
-            fmt::format("Column with index {} has text format\n", col) +
-            logging::stacktrace_cache::to_string(boost::stacktrace::stacktrace{})};
-    }
+    CheckBinaryFormat(handle_.get(), col);
     return io::FieldBuffer{
         IsFieldNull(row, col),
         GetFieldBufferCategory(col),
@@ -266,6 +270,31 @@ io::FieldBuffer ResultWrapper::GetFieldBuffer(std::size_t row, std::size_t col)
         reinterpret_cast<const std::uint8_t*>(PQgetvalue(handle_.get(), row, col))};
 }
 
+void ResultWrapper::FillFieldBuffers(
+    std::size_t first_row,
+    std::size_t row_count,
+    std::size_t field_count,
+    io::FieldBuffer* buffers
+) const {
+    UASSERT(first_row + row_count <= RowCount());
+    UASSERT(field_count <= FieldCount());
+    auto* res = handle_.get();
+    for (std::size_t col = 0; col < field_count; ++col) {
+        CheckBinaryFormat(res, col);
+    }
+
+    const auto& categories = cached_buffer_categories_->data;
+    for (std::size_t row = first_row; row < first_row + row_count; ++row) {
+        for (std::size_t col = 0; col < field_count; ++col, ++buffers) {
+            *buffers = io::FieldBuffer{
+                static_cast<bool>(PQgetisnull(res, row, col)),
+                categories[col],
+                static_cast<std::size_t>(PQgetlength(res, row, col)),
+                reinterpret_cast<const std::uint8_t*>(PQgetvalue(res, row, col))};
+        }
+    }
+}
+
 std::string ResultWrapper::GetErrorMessage() const {
     auto* msg = PQresultErrorMessage(handle_.get());
     return {msg ? msg : "no error message"};
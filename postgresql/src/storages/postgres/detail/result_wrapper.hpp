@@ -46,6 +46,11 @@ public:
     bool IsFieldNull(std::size_t row, std::size_t col) const;
     std::size_t GetFieldLength(std::size_t row, std::size_t col) const;
     io::FieldBuffer GetFieldBuffer(std::size_t row, std::size_t col) const;
+    /// Fill the buffers of the first `field_count` fields of `row_count` rows
+    /// starting from `first_row`, row by row. The column formats are checked
+    /// once for all the rows.
+    void FillFieldBuffers(std::size_t first_row, std::size_t row_count, std::size_t field_count, io::FieldBuffer* buffers)
+        const;
     //@}
 
     //@{
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -26,6 +27,17 @@ public:
     using DsnIndices = std::vector<DsnIndex>;
     using DsnIndicesByType = std::unordered_map<ClusterHostType, DsnIndices, ClusterHostTypeHash>;
 
+    /// Last measured properties of a host
+    struct HostMetrics {
+        /// Roundtrip time of the last check, kUnknownRoundtripTime if unavailable
+        std::chrono::microseconds roundtrip_time{kUnknownRoundtripTime};
+        /// Replication lag of the last check, zero for master
+        std::chrono::milliseconds replication_lag{0};
+    };
+    using HostsMetrics = std::vector<HostMetrics>;
+
+    static constexpr std::chrono::microseconds kUnknownRoundtripTime{-1};
+
     TopologyBase(
         engine::TaskProcessor& bg_task_processor,
         DsnList dsns,
@@ -50,6 +62,9 @@ public:
     /// Currently accessible hosts
     virtual rcu::ReadablePtr<DsnIndices> GetAliveDsnIndices() const = 0;
 
+    /// Last measured metrics of hosts, indexed by DSN index
+    virtual rcu::ReadablePtr<HostsMetrics> GetHostsMetrics() const = 0;
+
     // Returns statistics for each DSN in DsnList
     virtual const std::vector<decltype(InstanceStatistics::topology)>& GetDsnStatistics() const = 0;
 
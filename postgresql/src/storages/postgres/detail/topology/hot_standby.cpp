@@ -32,7 +32,7 @@ constexpr auto kCheckTimeout = std::chrono::seconds{1};
 constexpr auto kDiscoveryInterval = std::chrono::seconds{1};
 
 using Rtt = std::chrono::microseconds;
-constexpr Rtt kUnknownRtt{-1};
+constexpr Rtt kUnknownRtt = TopologyBase::kUnknownRoundtripTime;
 
 using ReplicationLag = std::chrono::milliseconds;
 
@@ -171,6 +171,8 @@ rcu::ReadablePtr<TopologyBase::DsnIndicesByType> HotStandby::GetDsnIndicesByType
 
 rcu::ReadablePtr<TopologyBase::DsnIndices> HotStandby::GetAliveDsnIndices() const { return alive_dsn_indices_.Read(); }
 
+rcu::ReadablePtr<TopologyBase::HostsMetrics> HotStandby::GetHostsMetrics() const { return hosts_metrics_.Read(); }
+
 const std::vector<decltype(InstanceStatistics::topology)>& HotStandby::GetDsnStatistics() const { return dsn_stats_; }
 
 void HotStandby::RunDiscovery() {
@@ -182,12 +184,14 @@ void HotStandby::RunDiscovery() {
     for (auto& task : tasks) task.Get();
 
     // Report states and find the master
+    HostsMetrics hosts_metrics(host_states_.size());
     HostState* master = nullptr;
     std::chrono::system_clock::time_point max_slave_xact_timestamp;
     for (DsnIndex i = 0; i < host_states_.size(); ++i) {
         auto& state = host_states_[i];
         LOG_DEBUG() << state.app_name << " is " << state.role << ": rtt " << state.roundtrip_time.count() << "us, LSN "
                     << state.wal_lsn << ", last xact time " << state.current_xact_timestamp;
+        hosts_metrics[i].roundtrip_time = state.roundtrip_time;
         if (state.roundtrip_time != kUnknownRtt) {
             dsn_stats_[i].roundtrip_time.GetCurrentCounter().Account(
                 std::chrono::duration_cast<std::chrono::milliseconds>(state.roundtrip_time).count()
@@ -226,6 +230,7 @@ void HotStandby::RunDiscovery() {
         dsn_stats_[i].replication_lag.GetCurrentCounter().Account(
             std::chrono::duration_cast<std::chrono::milliseconds>(slave_lag).count()
         );
+        hosts_metrics[i].replication_lag = slave_lag;
 
         const auto& topology_settings = GetTopologySettings();
         if (topology_settings.max_replication_lag > std::chrono::milliseconds{0} &&
@@ -280,6 +285,7 @@ void HotStandby::RunDiscovery() {
             dsn_indices_by_type[ClusterHostType::kSlave].push_back(idx);
         }
     }
+    hosts_metrics_.Assign(std::move(hosts_metrics));
     dsn_indices_by_type_.Assign(std::move(dsn_indices_by_type));
     alive_dsn_indices_.Assign(std::move(alive_dsn_indices));
 }
@@ -31,6 +31,8 @@ public:
 
     rcu::ReadablePtr<DsnIndicesByType> GetDsnIndicesByType() const override;
     rcu::ReadablePtr<DsnIndices> GetAliveDsnIndices() const override;
+
+    rcu::ReadablePtr<HostsMetrics> GetHostsMetrics() const override;
     const std::vector<decltype(InstanceStatistics::topology)>& GetDsnStatistics() const override;
 
 private:
@@ -42,6 +44,7 @@ private:
     std::vector<HostState> host_states_;
     rcu::Variable<DsnIndicesByType> dsn_indices_by_type_;
     rcu::Variable<DsnIndices> alive_dsn_indices_;
+    rcu::Variable<HostsMetrics> hosts_metrics_;
     std::vector<decltype(InstanceStatistics::topology)> dsn_stats_;
     USERVER_NAMESPACE::utils::PeriodicTask discovery_task_;
 };
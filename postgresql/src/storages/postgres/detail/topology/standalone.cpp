@@ -28,6 +28,7 @@ Standalone::Standalone(
       ),
       dsn_indices_by_type_(DsnIndicesByType{{ClusterHostType::kMaster, {0}}}),
       alive_dsn_indices_(DsnIndices{0}),
+      hosts_metrics_(HostsMetrics(1)),
       dsn_stats_(GetDsnList().size()) {
     UASSERT(GetDsnList().size() == 1);
 }
@@ -38,6 +39,8 @@ rcu::ReadablePtr<TopologyBase::DsnIndicesByType> Standalone::GetDsnIndicesByType
 
 rcu::ReadablePtr<TopologyBase::DsnIndices> Standalone::GetAliveDsnIndices() const { return alive_dsn_indices_.Read(); }
 
+rcu::ReadablePtr<TopologyBase::HostsMetrics> Standalone::GetHostsMetrics() const { return hosts_metrics_.Read(); }
+
 const std::vector<decltype(InstanceStatistics::topology)>& Standalone::GetDsnStatistics() const { return dsn_stats_; }
 
 }  // namespace storages::postgres::detail::topology
@@ -26,11 +26,14 @@ public:
 
     rcu::ReadablePtr<DsnIndicesByType> GetDsnIndicesByType() const override;
     rcu::ReadablePtr<DsnIndices> GetAliveDsnIndices() const override;
+
+    rcu::ReadablePtr<HostsMetrics> GetHostsMetrics() const override;
     const std::vector<decltype(InstanceStatistics::topology)>& GetDsnStatistics() const override;
 
 private:
     const rcu::Variable<DsnIndicesByType> dsn_indices_by_type_;
     const rcu::Variable<DsnIndices> alive_dsn_indices_;
+    const rcu::Variable<HostsMetrics> hosts_metrics_;
     const std::vector<decltype(InstanceStatistics::topology)> dsn_stats_;
 };
 
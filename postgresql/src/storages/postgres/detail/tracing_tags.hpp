@@ -12,6 +12,8 @@ namespace storages::postgres::scopes {
 const std::string kConnect = "pg_connect";
 /// Running misc queries after connecting
 const std::string kGetConnectData = "pg_get_conn_data";
+/// Preparing the most executed statements of the pool after connecting
+const std::string kWarmUpPreparedStatements = "pg_warm_up_prepared_statements";
 /// Execute query, top driver level
 const std::string kQuery = "pg_query";
 /// Prepare query, driver level
@@ -20,6 +22,12 @@ const std::string kPrepare = "pg_prepare";
 const std::string kBind = "pg_bind";
 /// Execute query, driver level
 const std::string kExec = "pg_exec";
+/// Finish COPY FROM STDIN / COPY TO STDOUT, driver level
+const std::string kCopyFinish = "pg_copy_finish";
+/// Fetch a chunk of rows of a streamed query, driver level
+const std::string kFetchRowsChunk = "pg_fetch_rows_chunk";
+/// Close a prepared statement with a protocol message, driver level
+const std::string kClosePrepared = "pg_close_prepared";
 
 // libpq stages
 /// libpq async connect stage
@@ -36,6 +44,8 @@ const std::string kLibpqSendPrepare = "libpq_send_prepare";
 const std::string kLibpqSendDescribePrepared = "libpq_send_describe_prepared";
 /// libpq send query prepared stage
 const std::string kLibpqSendQueryPrepared = "libpq_send_query_prepared";
+/// libpq send close prepared stage
+const std::string kLibpqSendClosePrepared = "libpq_send_close_prepared";
 /// libpq-missing send bind portal
 const std::string kPqSendPortalBind = "pq_send_portal_bind";
 /// libpq-missing send execute portal
@@ -1,6 +1,7 @@
 #include <userver/storages/postgres/dist_lock_strategy.hpp>
 
 #include <string_view>
+#include <unordered_set>
 
 #include <fmt/compile.h>
 #include <fmt/format.h>
@@ -29,6 +30,22 @@ std::string MakeAcquireQuery(const std::string& table) {
     return fmt::format(FMT_COMPILE(kAcquireQueryFmt), table);
 }
 
+// keys - $1
+// owners - $2
+// timeouts in seconds - $3
+std::string MakeAcquireBatchQuery(const std::string& table) {
+    static constexpr std::string_view kAcquireBatchQueryFmt = R"(
+    INSERT INTO {} AS t (key, owner, expiration_time)
+    SELECT r.key, r.owner, current_timestamp + make_interval(secs => r.timeout)
+    FROM unnest($1::text[], $2::text[], $3::double precision[]) AS r(key, owner, timeout)
+    ON CONFLICT (key) DO UPDATE
+    SET owner = excluded.owner, expiration_time = excluded.expiration_time
+    WHERE (t.owner = excluded.owner) OR
+    (t.expiration_time <= current_timestamp) RETURNING t.key;
+)";
+    return fmt::format(FMT_COMPILE(kAcquireBatchQueryFmt), table);
+}
+
 // key - $1
 // owner - $2
 std::string MakeReleaseQuery(const std::string& table) {
@@ -88,6 +105,58 @@ void DistLockStrategy::Release(const std::string& locker_id) {
     );
 }
 
+DistLockBatchStrategy::DistLockBatchStrategy(
+    ClusterPtr cluster,
+    const std::string& table,
+    const dist_lock::DistLockSettings& settings
+)
+    : cluster_(std::move(cluster)),
+      cc_(settings.forced_stop_margin, settings.forced_stop_margin),
+      acquire_batch_query_(MakeAcquireBatchQuery(table)),
+      release_query_(MakeReleaseQuery(table)),
+      owner_prefix_(hostinfo::blocking::GetRealHostName()) {}
+
+void DistLockBatchStrategy::UpdateCommandControl(CommandControl cc) {
+    auto cc_ptr = cc_.StartWrite();
+    *cc_ptr = cc;
+    cc_ptr.Commit();
+}
+
+std::vector<DistLockBatchStrategy::AcquireResult>
+DistLockBatchStrategy::AcquireBatch(const std::vector<AcquireRequest>& requests) {
+    std::vector<std::string> keys;
+    std::vector<std::string> owners;
+    std::vector<double> timeouts_seconds;
+    keys.reserve(requests.size());
+    owners.reserve(requests.size());
+    timeouts_seconds.reserve(requests.size());
+    for (const auto& request : requests) {
+        keys.push_back(request.lock_name);
+        owners.push_back(MakeOwnerId(owner_prefix_, request.locker_id));
+        timeouts_seconds.push_back(request.lock_ttl.count() / 1000.0);
+    }
+
+    auto cc_ptr = cc_.Read();
+    const auto result =
+        cluster_->Execute(ClusterHostType::kMaster, *cc_ptr, acquire_batch_query_, keys, owners, timeouts_seconds);
+
+    std::unordered_set<std::string> acquired_keys;
+    for (auto key : result.AsSetOf<std::string>()) acquired_keys.insert(std::move(key));
+
+    std::vector<AcquireResult> results(requests.size());
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+        results[i].acquired = acquired_keys.count(requests[i].lock_name) > 0;
+    }
+    return results;
+}
+
+void DistLockBatchStrategy::Release(const std::string& lock_name, const std::string& locker_id) {
+    auto cc_ptr = cc_.Read();
+    cluster_->Execute(
+        ClusterHostType::kMaster, *cc_ptr, release_query_, lock_name, MakeOwnerId(owner_prefix_, locker_id)
+    );
+}
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
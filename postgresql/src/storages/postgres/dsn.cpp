@@ -13,6 +13,7 @@
 #include <boost/regex.hpp>
 
 #include <userver/clients/dns/resolver.hpp>
+#include <userver/engine/io/happy_eyeballs.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
 #include <userver/utils/regex.hpp>
@@ -294,7 +295,9 @@ Dsn ResolveDsnHostaddrs(const Dsn& dsn, clients::dns::Resolver& resolver, engine
 
     for (size_t i = 0; i < hap.hosts.size(); ++i) {
         try {
-            for (const auto& addr : resolver.Resolve(hap.hosts[i], deadline)) {
+            // libpq tries the addresses one by one, alternate the families in
+            // case one of them is not routable
+            for (const auto& addr : engine::io::InterleaveAddressFamilies(resolver.Resolve(hap.hosts[i], deadline))) {
                 names.push_back(hap.hosts[i]);
                 addrs.push_back(addr.PrimaryAddressString());
                 if (!hap.ports.empty()) ports.push_back(hap.ports[i]);
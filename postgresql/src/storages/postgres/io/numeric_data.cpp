@@ -5,6 +5,7 @@
 #include <string_view>
 
 #include <boost/algorithm/string/trim.hpp>
+#include <boost/container/small_vector.hpp>
 
 #include <storages/postgres/io/pg_type_parsers.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
@@ -51,6 +52,13 @@ const std::uint16_t kDscaleMask = 0x3fff;
 // Number of decimal digits in
 const int kDigitWidth = 4;
 
+// Enough binary digits for any int64 representation of a Decimal, so that
+// the decimal64 I/O does not allocate
+constexpr std::size_t kInplaceDigits = 12;
+
+// ndigits, weight, sign and dscale
+constexpr std::size_t kHeaderSize = 4 * sizeof(std::uint16_t);
+
 void WriteDigit(std::string& res, std::uint16_t bin_dgt, bool truncate_leading_zeros) {
     std::array<char, 8> buffer{'0', '0', '0', '0', '0', '0', '0', '0'};
 
@@ -89,7 +97,9 @@ std::int16_t GetPaddedDigit(std::string_view str, int idx) {
     return val;
 }
 
-void ConvertDecimalToBinary(std::string_view dec_digits, int left_padding, std::vector<std::int16_t>& target) {
+using BinaryDigits = boost::container::small_vector<std::int16_t, kInplaceDigits>;
+
+void ConvertDecimalToBinary(std::string_view dec_digits, int left_padding, BinaryDigits& target) {
     for (auto dec_pos = left_padding; dec_pos < static_cast<std::int32_t>(dec_digits.size()); dec_pos += kDigitWidth) {
         target.push_back(GetPaddedDigit(dec_digits, dec_pos));
     }
@@ -105,7 +115,7 @@ int Log10(std::int64_t number) {
     return kMaxPowerOfTen;
 }
 
-void IntegralToBinary(std::int64_t integral_part, Smallint digits, std::vector<std::int16_t>& target) {
+void IntegralToBinary(std::int64_t integral_part, Smallint digits, BinaryDigits& target) {
     // Left pad
     if (digits % kDigitWidth) {
         digits += kDigitWidth - digits % kDigitWidth;
@@ -152,7 +162,7 @@ void IntegralToBinary(std::int64_t integral_part, Smallint digits, std::vector<s
 ///            decimal positions
 struct NumericData {
     using Digit = std::int16_t;
-    using Digits = std::vector<Digit>;
+    using Digits = BinaryDigits;
 
     std::uint16_t ndigits = 0;
     Smallint weight = 0;
@@ -202,6 +212,7 @@ void NumericData::ReadBuffer(FieldBuffer fb) {
 std::string NumericData::GetBuffer() const {
     static const UserTypes types;
     std::string buff;
+    buff.reserve(kHeaderSize + digits.size() * sizeof(Digit));
     io::WriteBuffer(types, buff, ndigits);
     io::WriteBuffer(types, buff, weight);
     io::WriteBuffer(types, buff, sign);
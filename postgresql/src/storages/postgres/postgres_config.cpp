@@ -30,6 +30,14 @@ CommandControl Parse(const formats::json::Value& elem, formats::parse::To<Comman
                     "` in postgres CommandControl. The timeout must be "
                     "greater than 0."};
             }
+        } else if (name == "max_replication_lag_ms") {
+            result.max_replication_lag = std::chrono::milliseconds{it->As<int64_t>()};
+            if (result.max_replication_lag->count() < 0) {
+                throw InvalidConfig{
+                    "Invalid max_replication_lag_ms `" + std::to_string(result.max_replication_lag->count()) +
+                    "` in postgres CommandControl. The lag must not be "
+                    "less than 0."};
+            }
         } else {
             LOG_WARNING() << "Unknown parameter " << name << " in PostgreSQL config";
         }
@@ -63,12 +71,22 @@ ConnectionSettings ParseConnectionSettings(const ConfigType& config) {
     settings.recent_errors_threshold =
         config["recent-errors-threshold"].template As<size_t>(settings.recent_errors_threshold);
 
+    settings.warm_up_prepared_statements =
+        config["warm-up-prepared-statements"].template As<size_t>(settings.warm_up_prepared_statements);
+
     settings.max_ttl = config["max-ttl-sec"].template As<std::optional<std::chrono::seconds>>();
 
     settings.discard_on_connect = config["discard-all-on-connect"].template As<bool>(true)
                                       ? ConnectionSettings::kDiscardAll
                                       : ConnectionSettings::kDiscardNone;
 
+    const auto pooler_mode = config["pooler-mode"].template As<std::string>("session");
+    if (pooler_mode == "transaction") {
+        settings.pooler_mode = ConnectionPoolerMode::kTransaction;
+    } else if (pooler_mode != "session") {
+        throw InvalidConfig{"Unknown pooler-mode: " + pooler_mode};
+    }
+
     return settings;
 }
 
@@ -101,8 +119,18 @@ PoolSettings ParsePoolSettings(const ConfigType& config) {
     result.max_size = config["max_pool_size"].template As<size_t>(result.max_size);
     result.max_queue_size = config["max_queue_size"].template As<size_t>(result.max_queue_size);
     result.connecting_limit = config["connecting_limit"].template As<size_t>(result.connecting_limit);
+    result.query_batching_window = std::chrono::microseconds{
+        config["query_batching_window_us"].template As<std::int64_t>(result.query_batching_window.count())};
+    result.max_query_batch_size = config["max_query_batch_size"].template As<size_t>(result.max_query_batch_size);
+    result.adaptive_sizing_target_wait = std::chrono::milliseconds{
+        config["adaptive_sizing_target_wait_ms"].template As<std::int64_t>(result.adaptive_sizing_target_wait.count())};
 
     if (result.max_size == 0) throw InvalidConfig{"max_pool_size must be greater than 0"};
+    if (result.query_batching_window.count() < 0) throw InvalidConfig{"query_batching_window_us cannot be negative"};
+    if (result.max_query_batch_size == 0) throw InvalidConfig{"max_query_batch_size must be greater than 0"};
+    if (result.adaptive_sizing_target_wait.count() < 0) {
+        throw InvalidConfig{"adaptive_sizing_target_wait_ms cannot be negative"};
+    }
     if (result.max_size < result.min_size) throw InvalidConfig{"max_pool_size cannot be less than min_pool_size"};
 
     return result;
@@ -220,6 +220,17 @@ void ResultSet::FillBufferCategories(const UserTypes& types) { pimpl_->FillBuffe
 
 void ResultSet::SetBufferCategoriesFrom(const ResultSet& dsc) { pimpl_->SetTypeBufferCategories(*dsc.pimpl_); }
 
+void ResultSet::FillFieldBuffers(
+    size_type first_row,
+    size_type row_count,
+    size_type field_count,
+    io::FieldBuffer* buffers
+) const {
+    pimpl_->FillFieldBuffers(first_row, row_count, field_count, buffers);
+}
+
+const io::TypeBufferCategory& ResultSet::GetTypeBufferCategories() const { return pimpl_->GetTypeBufferCategories(); }
+
 Row::size_type Row::IndexOfName(const std::string& name) const { return res_->IndexOfName(name); }
 
 FieldView Row::GetFieldView(size_type index) const { return FieldView{*res_, row_index_, index}; }
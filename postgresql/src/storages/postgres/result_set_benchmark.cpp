@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/io/chrono.hpp>
+
+#include <storages/postgres/util_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace pg = storages::postgres;
+using namespace pg::bench;
+
+struct WideRow {
+    pg::Bigint id{};
+    pg::Integer i1{};
+    pg::Integer i2{};
+    pg::Integer i3{};
+    pg::Integer i4{};
+    double d1{};
+    double d2{};
+    std::optional<double> d3;
+    bool flag{};
+    std::string s1;
+    std::string s2;
+    std::optional<std::string> s3;
+    pg::TimePointTz updated;
+    std::vector<pg::Integer> tags;
+};
+
+const std::string kWideRowsQuery = R"~(
+select  i::bigint,
+        i,
+        i * 2,
+        i * 3,
+        i * 4,
+        i / 2.0::double precision,
+        i / 3.0::double precision,
+        case when i % 2 = 0 then null else i / 5.0::double precision end,
+        i % 3 = 0,
+        'name ' || i::text,
+        md5(i::text),
+        case when i % 2 = 0 then null else 'description ' || i::text end,
+        now(),
+        array[i, i + 1, i + 2]
+from generate_series(1, $1) as i)~";
+
+pg::ResultSet SelectWideRows(pg::detail::Connection& conn, benchmark::State& state) {
+    return conn.Execute(kWideRowsQuery, static_cast<pg::Integer>(state.range(0)));
+}
+
+BENCHMARK_DEFINE_F(PgConnection, WideRowsAsContainer)(benchmark::State& state) {
+    RunStandalone(state, [this, &state] {
+        const auto res = SelectWideRows(GetConnection(), state);
+        for (auto _ : state) {
+            auto rows = res.AsContainer<std::vector<WideRow>>(pg::kRowTag);
+            benchmark::DoNotOptimize(rows);
+        }
+        state.SetItemsProcessed(state.iterations() * res.Size());
+    });
+}
+BENCHMARK_REGISTER_F(PgConnection, WideRowsAsContainer)->Arg(1'000)->Arg(10'000);
+
+BENCHMARK_DEFINE_F(PgConnection, WideRowsIterateTypedSet)(benchmark::State& state) {
+    RunStandalone(state, [this, &state] {
+        const auto res = SelectWideRows(GetConnection(), state);
+        for (auto _ : state) {
+            std::vector<WideRow> rows;
+            rows.reserve(res.Size());
+            for (auto row : res.AsSetOf<WideRow>(pg::kRowTag)) {
+                rows.push_back(std::move(row));
+            }
+            benchmark::DoNotOptimize(rows);
+        }
+        state.SetItemsProcessed(state.iterations() * res.Size());
+    });
+}
+BENCHMARK_REGISTER_F(PgConnection, WideRowsIterateTypedSet)->Arg(1'000)->Arg(10'000);
+
+BENCHMARK_DEFINE_F(PgConnection, ArraysAsVectors)(benchmark::State& state) {
+    RunStandalone(state, [this, &state] {
+        const auto res = GetConnection().Execute(
+            "select array(select i::bigint from generate_series(1, $1) as i), "
+            "array(select 'value ' || i::text from generate_series(1, $1) as i)",
+            static_cast<pg::Integer>(state.range(0))
+        );
+        const auto row = res.Front();
+        for (auto _ : state) {
+            std::vector<pg::Bigint> ids;
+            std::vector<std::string_view> values;
+            row.To(ids, values);
+            benchmark::DoNotOptimize(ids);
+            benchmark::DoNotOptimize(values);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    });
+}
+BENCHMARK_REGISTER_F(PgConnection, ArraysAsVectors)->Arg(100)->Arg(10'000);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,97 @@
+#include <userver/storages/postgres/result_stream.hpp>
+
+#include <utility>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+ResultStream::ResultStream(
+    detail::Connection* conn,
+    const Query& query,
+    const detail::QueryParameters& params,
+    OptionalCommandControl cmd_ctl,
+    std::size_t chunk_size
+)
+    : conn_{conn}, chunk_size_{chunk_size} {
+    Start(query, params, std::move(cmd_ctl));
+}
+
+ResultStream::ResultStream(
+    detail::ConnectionPtr&& conn,
+    detail::SteadyClock::time_point start_time,
+    const Query& query,
+    const detail::QueryParameters& params,
+    OptionalCommandControl cmd_ctl,
+    std::size_t chunk_size
+)
+    : owned_conn_{std::move(conn)}, conn_{owned_conn_->get()}, chunk_size_{chunk_size} {
+    conn_->Start(start_time);
+    try {
+        Start(query, params, std::move(cmd_ctl));
+    } catch (const std::exception&) {
+        // the destructor is not called
+        ReleaseConnection();
+        throw;
+    }
+}
+
+ResultStream::ResultStream(ResultStream&& other) noexcept
+    : owned_conn_{std::exchange(other.owned_conn_, std::nullopt)},
+      conn_{std::exchange(other.conn_, nullptr)},
+      chunk_size_{other.chunk_size_},
+      fetched_so_far_{other.fetched_so_far_},
+      is_done_{std::exchange(other.is_done_, true)} {}
+
+ResultStream::~ResultStream() {
+    if (conn_ && !is_done_) {
+        // There is no way to stop receiving the rows other than to read all of
+        // them, so the connection is dropped instead
+        LOG_WARNING() << "Result stream was not read till the end, the connection will be closed";
+        conn_->MarkAsBroken();
+    }
+    ReleaseConnection();
+}
+
+std::optional<ResultSet> ResultStream::FetchChunk() {
+    if (is_done_) return std::nullopt;
+    try {
+        auto chunk = conn_->FetchRowsChunk();
+        if (!chunk) {
+            is_done_ = true;
+            ReleaseConnection();
+            return std::nullopt;
+        }
+        fetched_so_far_ += chunk->Size();
+        return chunk;
+    } catch (const ConnectionError&) {
+        // the rest of the rows may still be in transit
+        throw;
+    } catch (const std::exception&) {
+        // the server reported an error, the query is complete
+        is_done_ = true;
+        ReleaseConnection();
+        throw;
+    }
+}
+
+void ResultStream::Start(const Query& query, const detail::QueryParameters& params, OptionalCommandControl cmd_ctl) {
+    if (chunk_size_ == 0) throw LogicError{"Result stream chunk size must be positive"};
+    if (!cmd_ctl) cmd_ctl = conn_->GetQueryCmdCtl(query.GetName());
+    conn_->StartRowsStream(query, params, std::move(cmd_ctl), chunk_size_);
+}
+
+void ResultStream::ReleaseConnection() noexcept {
+    if (!owned_conn_) return;
+    conn_->Finish();
+    conn_ = nullptr;
+    owned_conn_.reset();
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,58 @@
+#include <userver/storages/postgres/sharding.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace {
+
+// FNV-1a, fixed here rather than std::hash to keep the mapping stable
+std::uint64_t HashKey(std::string_view key) noexcept {
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (const char c : key) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// splitmix64 finalizer
+std::uint64_t Mix(std::uint64_t value) noexcept {
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ULL;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebULL;
+    value ^= value >> 31;
+    return value;
+}
+
+}  // namespace
+
+std::size_t GetShardForKey(std::string_view key, std::size_t shard_count) {
+    if (shard_count == 0) {
+        throw std::invalid_argument("Cannot route a key to zero shards");
+    }
+
+    const auto key_hash = HashKey(key);
+    std::size_t best_shard = 0;
+    std::uint64_t best_weight = 0;
+    for (std::size_t shard = 0; shard < shard_count; ++shard) {
+        const auto weight = Mix(key_hash ^ Mix(shard + 1));
+        if (shard == 0 || weight > best_weight) {
+            best_shard = shard;
+            best_weight = weight;
+        }
+    }
+    return best_shard;
+}
+
+ClusterPtr GetClusterForKey(const Database& database, std::string_view key) {
+    return database.GetClusterForShard(GetShardForKey(key, database.GetShardCount()));
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -35,6 +35,20 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const Inst
         query["executed"] = stats.transaction.execute_total;
         query["replies"] = stats.transaction.reply_total;
     }
+    if (auto batching = writer["query-batching"]) {
+        batching["batches"] = stats.batching.batches_total;
+        batching["queries"] = stats.batching.queries_total;
+        batching["batch-size"] = stats.batching.batch_size;
+    }
+    if (auto selection = writer["host-selection"]) {
+        selection["selected"] = stats.host_selection.selected_total;
+        selection["skipped-lagging"] = stats.host_selection.lagging_skipped_total;
+    }
+    if (auto sizing = writer["adaptive-sizing"]) {
+        sizing["size"] = stats.adaptive_sizing.size;
+        sizing["grown"] = stats.adaptive_sizing.grow_total;
+        sizing["shrunk"] = stats.adaptive_sizing.shrink_total;
+    }
 
     if (auto errors = writer["errors"]) {
         constexpr std::string_view kPostgresqlError = "postgresql_error";
@@ -66,6 +80,18 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const Inst
     }
 }
 
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const ResultCacheStatistics& value) {
+    writer["size-bytes"] = value.size_bytes;
+    writer["entries"] = value.entries;
+    writer["hits"] = value.hits;
+    writer["misses"] = value.misses;
+    writer["invalidations"] = value.invalidations;
+    for (const auto& [stmt, stmt_stats] : value.per_statement) {
+        writer["statement_hits"].ValueWithLabels(stmt_stats.hits, {"postgresql_query", stmt});
+        writer["statement_misses"].ValueWithLabels(stmt_stats.misses, {"postgresql_query", stmt});
+    }
+}
+
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const ClusterStatistics& value) {
     constexpr std::string_view kPostgresqlClusterHostType = "postgresql_cluster_host_type";
     writer["connlimit-mode-auto-enabled"] = value.connlimit_mode_auto_on;
@@ -77,6 +103,9 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer, const Clus
     for (const auto& item : value.unknown) {
         writer.ValueWithLabels(item, {kPostgresqlClusterHostType, "unknown"});
     }
+    if (value.result_cache.enabled) {
+        writer["result-cache"] = value.result_cache;
+    }
 }
 
 }  // namespace storages::postgres
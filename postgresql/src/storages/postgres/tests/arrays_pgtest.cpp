@@ -856,6 +856,42 @@ UTEST_P(PostgreConnection, ArrayOfBool) {
     EXPECT_EQ(src, tgt);
 }
 
+UTEST_P(PostgreConnection, ArrayOfFixedWidthValues) {
+    CheckConnection(GetConn());
+    pg::ResultSet res{nullptr};
+    UEXPECT_NO_THROW(
+        res = GetConn()->Execute(
+            "select $1::bigint[], $2::double precision[], array[1, 2, 3]::integer[], array[1, null]::integer[]",
+            std::vector<pg::Bigint>{1, -2, std::numeric_limits<pg::Bigint>::max()},
+            std::vector<double>{0.5, -1.25}
+        )
+    );
+    std::vector<pg::Bigint> bigints;
+    UEXPECT_NO_THROW(res[0][0].To(bigints));
+    EXPECT_EQ((std::vector<pg::Bigint>{1, -2, std::numeric_limits<pg::Bigint>::max()}), bigints);
+    std::vector<double> doubles;
+    UEXPECT_NO_THROW(res[0][1].To(doubles));
+    EXPECT_EQ((std::vector<double>{0.5, -1.25}), doubles);
+    // integers of another width are parsed as usual
+    UEXPECT_NO_THROW(res[0][2].To(bigints));
+    EXPECT_EQ((std::vector<pg::Bigint>{1, 2, 3}), bigints);
+    std::vector<pg::Integer> integers;
+    UEXPECT_THROW(res[0][3].To(integers), pg::TypeCannotBeNull);
+}
+
+UTEST_P(PostgreConnection, ArrayOfText) {
+    CheckConnection(GetConn());
+    pg::ResultSet res{nullptr};
+    UEXPECT_NO_THROW(res = GetConn()->Execute("select array['foo', '', 'bar baz']::text[]"));
+    std::vector<std::string> strings;
+    UEXPECT_NO_THROW(res[0][0].To(strings));
+    EXPECT_EQ((std::vector<std::string>{"foo", "", "bar baz"}), strings);
+    // views reference the result memory
+    std::vector<std::string_view> views;
+    UEXPECT_NO_THROW(res[0][0].To(views));
+    EXPECT_EQ((std::vector<std::string_view>{"foo", "", "bar baz"}), views);
+}
+
 void CheckSplit(const io::detail::ContainerSplitter<std::vector<int>>& split) {
     const auto& data = split.GetContainer();
 
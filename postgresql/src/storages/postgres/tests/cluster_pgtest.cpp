@@ -7,6 +7,8 @@
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/postgres_config.hpp>
 #include <userver/dynamic_config/test_helpers.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/storages/postgres/cluster.hpp>
 #include <userver/storages/postgres/dsn.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
@@ -41,21 +43,26 @@ pg::Cluster CreateCluster(
     engine::TaskProcessor& bg_task_processor,
     size_t max_size,
     testsuite::TestsuiteTasks& testsuite_tasks,
-    pg::ConnectionSettings conn_settings = kCachePreparedStatements
+    pg::ConnectionSettings conn_settings = kCachePreparedStatements,
+    std::chrono::microseconds query_batching_window = {},
+    pg::ResultCacheSettings result_cache_settings = {}
 ) {
     auto source = dynamic_config::GetDefaultSource();
+    pg::PoolSettings pool_settings{0, max_size, max_size};
+    pool_settings.query_batching_window = query_batching_window;
     return pg::Cluster(
         dsns,
         nullptr,
         bg_task_processor,
         {{},
          {utest::kMaxTestWaitTime},
-         {0, max_size, max_size},
+         pool_settings,
          conn_settings,
          storages::postgres::InitMode::kAsync,
          "",
          {},
-         {}},
+         {},
+         std::move(result_cache_settings)},
         {kTestCmdCtl, {}, {}},
         {},
         {},
@@ -294,6 +301,58 @@ UTEST_F(PostgreCluster, HostSelectionSingleQuery) {
     );
 }
 
+UTEST_F(PostgreCluster, HostSelectionLeastLoaded) {
+    testsuite::TestsuiteTasks testsuite_tasks{true};
+    auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 1, testsuite_tasks);
+
+    pg::ResultSet res{nullptr};
+    UEXPECT_NO_THROW(
+        res = cluster.Execute({pg::ClusterHostType::kSlave, pg::ClusterHostType::kLeastLoaded}, "select 1")
+    );
+    EXPECT_EQ(1, res.Size());
+    UEXPECT_NO_THROW(
+        res = cluster.Execute(
+            {pg::ClusterHostType::kSlave, pg::ClusterHostType::kMaster, pg::ClusterHostType::kLeastLoaded}, "select 1"
+        )
+    );
+    EXPECT_EQ(1, res.Size());
+    CheckRoTransaction(
+        cluster.Begin({pg::ClusterHostType::kSlave, pg::ClusterHostType::kLeastLoaded}, pg::Transaction::RO)
+    );
+
+    UEXPECT_THROW(
+        cluster.Execute(
+            {pg::ClusterHostType::kSlave, pg::ClusterHostType::kNearest, pg::ClusterHostType::kLeastLoaded}, "select 1"
+        ),
+        pg::LogicError
+    );
+}
+
+UTEST_F(PostgreCluster, MaxReplicationLag) {
+    testsuite::TestsuiteTasks testsuite_tasks{true};
+    auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 1, testsuite_tasks);
+
+    const auto cmd_ctl = cluster.GetDefaultCommandControl().WithMaxReplicationLag(std::chrono::milliseconds{0});
+    pg::ResultSet res{nullptr};
+    // lagging replicas are skipped, falling back to master
+    UEXPECT_NO_THROW(res = cluster.Execute(pg::ClusterHostType::kSlave, cmd_ctl, "select 1"));
+    EXPECT_EQ(1, res.Size());
+    UEXPECT_NO_THROW(
+        res = cluster.Execute(
+            {pg::ClusterHostType::kSlave, pg::ClusterHostType::kMaster, pg::ClusterHostType::kLeastLoaded},
+            cmd_ctl,
+            "select 1"
+        )
+    );
+    EXPECT_EQ(1, res.Size());
+
+    const auto stats = cluster.GetStatistics();
+    auto selected_total = stats->master.stats.host_selection.selected_total;
+    for (const auto& slave : stats->slaves) selected_total += slave.stats.host_selection.selected_total;
+    selected_total += stats->sync_slave.stats.host_selection.selected_total;
+    EXPECT_LE(2, selected_total);
+}
+
 UTEST_F(PostgreCluster, TransactionTimeouts) {
     testsuite::TestsuiteTasks testsuite_tasks{true};
     auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 1, testsuite_tasks);
@@ -334,6 +393,24 @@ UTEST_F(PostgreCluster, TransactionTimeouts) {
     }
 }
 
+UTEST_F(PostgreCluster, ResultStream) {
+    testsuite::TestsuiteTasks testsuite_tasks{true};
+    auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 1, testsuite_tasks);
+
+    UEXPECT_THROW(cluster.MakeResultStream({}, "select 1"), pg::LogicError);
+
+    auto stream =
+        cluster.MakeResultStream(pg::ClusterHostType::kMaster, "select i from generate_series(1, $1) as i", 100);
+    pg::Integer expected = 1;
+    while (auto chunk = stream.FetchChunkAs<pg::Integer>()) {
+        for (auto value : *chunk) EXPECT_EQ(expected++, value);
+    }
+    EXPECT_EQ(101, expected);
+
+    // the connection is returned to the pool after the last chunk
+    UEXPECT_NO_THROW(cluster.Execute(pg::ClusterHostType::kMaster, "select 1"));
+}
+
 UTEST_F(PostgreCluster, NonTransactionExecuteWithParameterStore) {
     testsuite::TestsuiteTasks testsuite_tasks{true};
     auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 1, testsuite_tasks);
@@ -398,4 +475,82 @@ UTEST_F(PostgreCluster, ListenNotify) {
     );
 }
 
+UTEST_F_MT(PostgreCluster, QueryBatching, 2) {
+    testsuite::TestsuiteTasks testsuite_tasks{true};
+    auto cluster = CreateCluster(
+        GetDsnListFromEnv(), GetTaskProcessor(), 2, testsuite_tasks, kPipelineEnabled, std::chrono::milliseconds{10}
+    );
+
+    constexpr int kTasksCount = 50;
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(kTasksCount);
+    for (int i = 0; i < kTasksCount; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([&cluster, i] {
+            if (i % 10 == 0) {
+                // errors are delivered to their callers only
+                UEXPECT_THROW(
+                    cluster.Execute(pg::ClusterHostType::kMaster, "select 1 / $1", 0), pg::DataException
+                );
+            } else if (i % 2 == 0) {
+                EXPECT_EQ(i, cluster.Execute(pg::ClusterHostType::kMaster, "select $1", i).AsSingleRow<int>());
+            } else {
+                const auto res =
+                    cluster.Execute(pg::ClusterHostType::kMaster, "select $1::text", pg::ParameterStore{}.PushBack(i));
+                EXPECT_EQ(std::to_string(i), res.AsSingleRow<std::string>());
+            }
+        }));
+    }
+    for (auto& task : tasks) UEXPECT_NO_THROW(task.Get());
+
+    const auto stats = cluster.GetStatistics();
+    const auto& batching = stats->master.stats.batching;
+    EXPECT_EQ(kTasksCount, batching.queries_total);
+    EXPECT_LT(batching.batches_total, kTasksCount);
+    EXPECT_LE(stats->master.stats.connection.open_total, 2);
+}
+
+UTEST_F(PostgreCluster, ResultCache) {
+    constexpr auto kInvalidationChannel = std::string_view{"result_cache"};
+    const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+    const pg::Query query{"select $1::integer, random()", pg::Query::Name{"cached_random"}};
+
+    testsuite::TestsuiteTasks testsuite_tasks{true};
+    auto cluster = CreateCluster(
+        GetDsnListFromEnv(),
+        GetTaskProcessor(),
+        2,
+        testsuite_tasks,
+        kCachePreparedStatements,
+        {},
+        {1024 * 1024, utest::kMaxTestWaitTime, std::string{kInvalidationChannel}}
+    );
+    const auto get_stats = [&cluster] { return cluster.GetStatistics()->result_cache; };
+    const auto get_random = [&cluster, &query](int arg) {
+        return cluster.ExecuteCached(pg::ClusterHostType::kMaster, query, arg).AsSingleRow<std::tuple<int, double>>();
+    };
+
+    // results cached before the listener starts are dropped
+    while (get_stats().invalidations == 0 && !deadline.IsReached()) engine::SleepFor(std::chrono::milliseconds{10});
+    ASSERT_EQ(get_stats().invalidations, 1);
+
+    const auto first = get_random(1);
+    EXPECT_EQ(first, get_random(1));
+    EXPECT_NE(first, get_random(2));
+
+    auto stats = get_stats();
+    EXPECT_TRUE(stats.enabled);
+    EXPECT_EQ(stats.entries, 2);
+    EXPECT_GT(stats.size_bytes, 0);
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.misses, 2);
+    EXPECT_EQ(stats.per_statement["cached_random"].hits, 1);
+    EXPECT_EQ(stats.per_statement["cached_random"].misses, 2);
+
+    UEXPECT_NO_THROW(cluster.Execute(pg::ClusterHostType::kMaster, "select pg_notify($1, NULL)", kInvalidationChannel));
+    while (get_stats().invalidations == 1 && !deadline.IsReached()) engine::SleepFor(std::chrono::milliseconds{10});
+    ASSERT_EQ(get_stats().invalidations, 2);
+    EXPECT_EQ(get_stats().entries, 0);
+    EXPECT_NE(first, get_random(1));
+}
+
 USERVER_NAMESPACE_END
@@ -4,6 +4,7 @@
 #include <userver/engine/single_consumer_event.hpp>
 
 #include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/detail/prepared_statements_registry.hpp>
 #include <userver/storages/postgres/dsn.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
 #include <userver/storages/postgres/io/chrono.hpp>
@@ -415,6 +416,77 @@ UTEST_F(PostgreCustomConnection, NoPreparedStatements) {
     ));
 }
 
+UTEST_F(PostgreCustomConnection, TransactionPoolerMode) {
+    auto settings = kCachePreparedStatements;
+    settings.max_prepared_cache_size = 1;
+    settings.pooler_mode = pg::ConnectionPoolerMode::kTransaction;
+    std::unique_ptr<pg::detail::Connection> conn;
+    UASSERT_NO_THROW(
+        conn = pg::detail::Connection::Connect(
+            GetDsnFromEnv(),
+            nullptr,
+            GetTaskProcessor(),
+            GetTaskStorage(),
+            kConnectionId,
+            settings,
+            GetTestCmdCtls(),
+            {},
+            {}
+        )
+    );
+
+    // the statements evict each other from the cache
+    for (int i = 0; i < 3; ++i) {
+        UEXPECT_NO_THROW(conn->Execute("select 1"));
+        UEXPECT_NO_THROW(conn->Execute("select 2"));
+    }
+
+    UEXPECT_NO_THROW(conn->Begin({}, {}));
+    UEXPECT_NO_THROW(conn->Execute("select 1"));
+    UEXPECT_NO_THROW(conn->Execute("select 2"));
+    UEXPECT_NO_THROW(conn->Execute("select 1"));
+    UEXPECT_NO_THROW(conn->Commit());
+}
+
+UTEST_F(PostgreCustomConnection, SharedPreparedStatements) {
+    const std::string kStatement = "select $1::integer + 1";
+    const auto shared_statements =
+        std::make_shared<pg::detail::PreparedStatementsRegistry>(pg::kDefaultMaxPreparedCacheSize);
+    auto settings = kCachePreparedStatements;
+    settings.warm_up_prepared_statements = 1;
+    const auto connect = [&] {
+        return pg::detail::Connection::Connect(
+            GetDsnFromEnv(),
+            nullptr,
+            GetTaskProcessor(),
+            GetTaskStorage(),
+            kConnectionId,
+            settings,
+            GetTestCmdCtls(),
+            {},
+            {},
+            engine::SemaphoreLock{},
+            shared_statements
+        );
+    };
+
+    auto conn = connect();
+    for (int i = 0; i < 3; ++i) UEXPECT_NO_THROW(conn->Execute(kStatement, i));
+    const auto most_executed = shared_statements->GetMostExecuted(1);
+    ASSERT_EQ(1, most_executed.size());
+    EXPECT_EQ(kStatement, most_executed.front()->GetStatement());
+    EXPECT_EQ(3, most_executed.front()->GetExecutedCount());
+
+    // the statement is prepared right after connecting
+    auto warm_conn = connect();
+    [[maybe_unused]] const auto connect_stats = warm_conn->GetStatsAndReset();
+    pg::ResultSet res{nullptr};
+    UEXPECT_NO_THROW(res = warm_conn->Execute(kStatement, 41));
+    EXPECT_EQ(42, res.AsSingleRow<int>());
+    EXPECT_EQ(0, warm_conn->GetStatsAndReset().parse_total);
+    EXPECT_EQ(4, most_executed.front()->GetExecutedCount());
+}
+
 UTEST_F(PostgreCustomConnection, NoUserTypes) {
     std::unique_ptr<pg::detail::Connection> conn;
     UASSERT_NO_THROW(
@@ -0,0 +1,136 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <userver/storages/postgres/copy.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/transaction.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+struct CopyRow final {
+    pg::Integer id{};
+    std::string value;
+    std::optional<double> weight;
+};
+
+constexpr std::size_t kRowCount = 10'000;
+
+std::vector<CopyRow> MakeRows() {
+    std::vector<CopyRow> rows;
+    rows.reserve(kRowCount);
+    for (std::size_t i = 0; i < kRowCount; ++i) {
+        const auto id = static_cast<pg::Integer>(i);
+        rows.push_back(
+            CopyRow{id, "value " + std::to_string(i), i % 3 == 0 ? std::nullopt : std::optional<double>{i * 0.5}}
+        );
+    }
+    return rows;
+}
+
+void CreateTable(pg::detail::ConnectionPtr& conn) {
+    conn->Execute("create temporary table copy_test(id integer, value text, weight double precision)");
+}
+
+UTEST_P(PostgreConnection, CopyInOut) {
+    CheckConnection(GetConn());
+    CreateTable(GetConn());
+
+    const auto rows = MakeRows();
+    pg::Transaction trx{std::move(GetConn())};
+
+    /// [CopyIn]
+    EXPECT_EQ(rows.size(), trx.CopyFrom("copy copy_test from stdin with (format binary)", rows));
+
+    auto copy_in = trx.MakeCopyIn("copy copy_test(id, value) from stdin with (format binary)");
+    copy_in.WriteFields(pg::Integer{-1}, std::string{"first"});
+    copy_in.WriteRow(std::make_tuple(pg::Integer{-2}, std::string{"second"}));
+    EXPECT_EQ(2, copy_in.Finish());
+    /// [CopyIn]
+
+    auto res = trx.Execute("select count(*), count(weight) from copy_test");
+    EXPECT_EQ(rows.size() + 2, res.Front()[0].As<pg::Bigint>());
+    const auto with_weight = std::count_if(rows.begin(), rows.end(), [](const auto& row) { return !!row.weight; });
+    EXPECT_EQ(with_weight, res.Front()[1].As<pg::Bigint>());
+
+    /// [CopyOut]
+    auto copy_out = trx.MakeCopyOut(
+        "copy (select * from copy_test where id >= 0 order by id) "
+        "to stdout with (format binary)"
+    );
+    CopyRow row;
+    std::size_t index = 0;
+    while (copy_out.ReadRow(row)) {
+        ASSERT_LT(index, rows.size());
+        EXPECT_EQ(rows[index].id, row.id);
+        EXPECT_EQ(rows[index].value, row.value);
+        EXPECT_EQ(rows[index].weight, row.weight);
+        ++index;
+    }
+    /// [CopyOut]
+    EXPECT_EQ(rows.size(), copy_out.RowsRead());
+
+    auto tail = trx.MakeCopyOut(
+        "copy (select id, value from copy_test where id < 0 order by id) "
+        "to stdout with (format binary)"
+    );
+    pg::Integer id{};
+    std::string value;
+    ASSERT_TRUE(tail.ReadFields(id, value));
+    EXPECT_EQ(-2, id);
+    EXPECT_EQ("second", value);
+    ASSERT_TRUE(tail.ReadFields(id, value));
+    EXPECT_EQ(-1, id);
+    EXPECT_FALSE(tail.ReadFields(id, value));
+
+    // the connection is usable after COPY
+    res = trx.Execute("select count(*) from copy_test");
+    EXPECT_EQ(rows.size() + 2, res.Front().As<pg::Bigint>());
+
+    UEXPECT_NO_THROW(trx.Commit());
+}
+
+UTEST_P(PostgreConnection, CopyInAbort) {
+    CheckConnection(GetConn());
+    CreateTable(GetConn());
+
+    pg::Transaction trx{std::move(GetConn())};
+    {
+        auto copy_in = trx.MakeCopyIn("copy copy_test from stdin with (format binary)");
+        copy_in.WriteRows(MakeRows());
+    }
+    // the aborted COPY fails the transaction
+    UEXPECT_THROW(trx.Execute("select 1"), pg::Error);
+    UEXPECT_NO_THROW(trx.Rollback());
+}
+
+UTEST_P(PostgreConnection, CopyTextFormat) {
+    CheckConnection(GetConn());
+    CreateTable(GetConn());
+
+    pg::Transaction trx{std::move(GetConn())};
+    // only the binary format is supported
+    UEXPECT_THROW(trx.MakeCopyIn("copy copy_test from stdin"), pg::LogicError);
+}
+
+UTEST_P(PostgreConnection, CopyNotACopy) {
+    CheckConnection(GetConn());
+
+    pg::Transaction trx{std::move(GetConn())};
+    UEXPECT_THROW(trx.MakeCopyOut("select 1"), pg::LogicError);
+    // the connection is still usable
+    UEXPECT_NO_THROW(trx.Execute("select 1"));
+    UEXPECT_NO_THROW(trx.Commit());
+}
+
+}  // namespace
+
+USERVER_NAMESPACE_END
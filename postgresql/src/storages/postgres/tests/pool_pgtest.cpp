@@ -615,6 +615,52 @@ UTEST_P(PostgrePool, ForQueryQueueBeingNonTransactional) {
     EXPECT_EQ(inserted_values.front(), 1);
 }
 
+UTEST_P(PostgrePool, AdaptiveSizing) {
+    pg::PoolSettings settings{1, 10, 10};
+    settings.adaptive_sizing_target_wait = std::chrono::milliseconds{1};
+    auto pool = pg::detail::ConnectionPool::Create(
+        GetDsnFromEnv(),
+        nullptr,
+        GetTaskProcessor(),
+        "",
+        GetParam(),
+        settings,
+        kCachePreparedStatements,
+        {},
+        GetTestCmdCtls(),
+        {},
+        {},
+        {},
+        dynamic_config::GetDefaultSource()
+    );
+    EXPECT_EQ(1, pool->GetStatistics().adaptive_sizing.size);
+
+    {
+        pg::detail::ConnectionPtr conn(nullptr);
+        UASSERT_NO_THROW(conn = pool->Acquire(MakeDeadline()));
+        // the only connection is busy, so the request waits longer than the target
+        const auto deadline = engine::Deadline::FromDuration(std::chrono::milliseconds{10});
+        UEXPECT_THROW(pg::detail::ConnectionPtr conn2 = pool->Acquire(deadline), pg::PoolError);
+        pool->AdjustSize();
+        EXPECT_EQ(2, pool->GetStatistics().adaptive_sizing.size);
+        EXPECT_EQ(1, pool->GetStatistics().adaptive_sizing.grow_total);
+
+        pg::detail::ConnectionPtr conn2(nullptr);
+        UASSERT_NO_THROW(conn2 = pool->Acquire(MakeDeadline())) << "Pool has grown";
+        CheckConnection(std::move(conn2));
+    }
+
+    // the second connection was busy since the previous adjustment
+    pool->AdjustSize();
+    EXPECT_EQ(2, pool->GetStatistics().adaptive_sizing.size);
+    // no connections are needed anymore
+    pool->AdjustSize();
+    const auto& stats = pool->GetStatistics();
+    EXPECT_EQ(1, stats.adaptive_sizing.size);
+    EXPECT_EQ(1, stats.adaptive_sizing.shrink_total);
+    EXPECT_EQ(1, stats.connection.drop_total);
+}
+
 INSTANTIATE_UTEST_SUITE_P(
     PoolTests,
     PostgrePool,
@@ -0,0 +1,103 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <string>
+
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/parameter_store.hpp>
+#include <userver/storages/postgres/result_stream.hpp>
+#include <userver/storages/postgres/transaction.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+struct StreamRow final {
+    pg::Integer id{};
+    std::string value;
+};
+
+constexpr pg::Integer kRowCount = 10'000;
+
+UTEST_P(PostgreConnection, ResultStream) {
+    CheckConnection(GetConn());
+
+    pg::Transaction trx{std::move(GetConn())};
+
+    /// [ResultStream]
+    auto stream = trx.MakeResultStream(
+        "select i, 'value ' || i::text from generate_series(1, $1) as i order by i", kRowCount
+    );
+    pg::Integer expected_id = 1;
+    while (auto chunk = stream.FetchChunkAs<StreamRow>(pg::kRowTag)) {
+        for (const auto& row : *chunk) {
+            EXPECT_EQ(expected_id, row.id);
+            EXPECT_EQ("value " + std::to_string(expected_id), row.value);
+            ++expected_id;
+        }
+    }
+    /// [ResultStream]
+    EXPECT_EQ(kRowCount + 1, expected_id);
+    EXPECT_EQ(static_cast<std::size_t>(kRowCount), stream.FetchedSoFar());
+    EXPECT_TRUE(stream.Done());
+    EXPECT_FALSE(stream.FetchChunk());
+
+    // the connection is usable after the stream is read
+    auto res = trx.Execute("select 1");
+    EXPECT_EQ(1, res.Front().As<pg::Integer>());
+    UEXPECT_NO_THROW(trx.Commit());
+}
+
+UTEST_P(PostgreConnection, ResultStreamChunkSize) {
+    CheckConnection(GetConn());
+
+    pg::Transaction trx{std::move(GetConn())};
+    auto stream = trx.MakeResultStream(
+        pg::OptionalCommandControl{},
+        100,
+        "select i from generate_series(1, $1) as i",
+        pg::ParameterStore{}.PushBack(kRowCount)
+    );
+    std::size_t chunks = 0;
+    pg::Bigint sum = 0;
+    while (auto chunk = stream.FetchChunkAs<pg::Integer>()) {
+        EXPECT_LE(chunk->Size(), std::size_t{100});
+        for (auto value : *chunk) sum += value;
+        ++chunks;
+    }
+    EXPECT_EQ(pg::Bigint{kRowCount} * (kRowCount + 1) / 2, sum);
+    // single-row mode is used with libpq older than 17
+    EXPECT_GE(chunks, static_cast<std::size_t>(kRowCount / 100));
+    UEXPECT_NO_THROW(trx.Commit());
+}
+
+UTEST_P(PostgreConnection, ResultStreamEmpty) {
+    CheckConnection(GetConn());
+
+    pg::Transaction trx{std::move(GetConn())};
+    auto stream = trx.MakeResultStream("select 1 where false");
+    EXPECT_FALSE(stream.FetchChunk());
+    EXPECT_EQ(0, stream.FetchedSoFar());
+    UEXPECT_NO_THROW(trx.Commit());
+}
+
+UTEST_P(PostgreConnection, ResultStreamError) {
+    CheckConnection(GetConn());
+
+    pg::Transaction trx{std::move(GetConn())};
+    // the error happens after some rows are sent
+    auto stream = trx.MakeResultStream("select 1 / (10 - i) from generate_series(1, 20) as i");
+    UEXPECT_THROW(
+        while (stream.FetchChunk()) {
+            // the rows before the error are received
+        },
+        pg::DataException
+    );
+    EXPECT_TRUE(stream.Done());
+    UEXPECT_NO_THROW(trx.Rollback());
+}
+
+}  // namespace
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,100 @@
+#include <userver/utest/utest.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/storages/postgres/sharding.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace pg = storages::postgres;
+
+std::string MakeKey(std::size_t i) { return "key-" + std::to_string(i); }
+
+}  // namespace
+
+TEST(PostgreSharding, StableMapping) {
+    // the mapping is used for persistent data and must never change
+    EXPECT_EQ(pg::GetShardForKey("", 64), 54);
+    EXPECT_EQ(pg::GetShardForKey("user-1", 64), 34);
+    EXPECT_EQ(pg::GetShardForKey("user-2", 64), 42);
+    EXPECT_EQ(pg::GetShardForKey("user-2", 10), 5);
+    EXPECT_EQ(pg::GetShardForKey("order:42", 10), 0);
+
+    EXPECT_EQ(pg::GetShardForKey("user-1", 1), 0);
+    UEXPECT_THROW([[maybe_unused]] auto shard = pg::GetShardForKey("user-1", 0), std::invalid_argument);
+}
+
+TEST(PostgreSharding, Distribution) {
+    constexpr std::size_t kShards = 64;
+    constexpr std::size_t kKeysPerShard = 1000;
+
+    std::vector<std::size_t> counts(kShards);
+    for (std::size_t i = 0; i < kShards * kKeysPerShard; ++i) {
+        ++counts[pg::GetShardForKey(MakeKey(i), kShards)];
+    }
+    for (const auto count : counts) {
+        EXPECT_GT(count, kKeysPerShard * 8 / 10);
+        EXPECT_LT(count, kKeysPerShard * 12 / 10);
+    }
+}
+
+TEST(PostgreSharding, AddShard) {
+    constexpr std::size_t kShards = 10;
+    constexpr std::size_t kKeys = 10000;
+
+    std::size_t moved = 0;
+    for (std::size_t i = 0; i < kKeys; ++i) {
+        const auto key = MakeKey(i);
+        const auto new_shard = pg::GetShardForKey(key, kShards + 1);
+        if (pg::GetShardForKey(key, kShards) != new_shard) {
+            // keys move only to the added shard
+            EXPECT_EQ(new_shard, kShards);
+            ++moved;
+        }
+    }
+    EXPECT_GT(moved, kKeys / (kShards + 1) * 8 / 10);
+    EXPECT_LT(moved, kKeys / (kShards + 1) * 12 / 10);
+}
+
+UTEST_MT(PostgreSharding, RunOnShardsPartialResults, 4) {
+    auto func = [](std::size_t shard) {
+        switch (shard) {
+            case 1:
+                throw std::runtime_error("shard failure");
+            case 2:
+                engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+                if (engine::current_task::ShouldCancel()) throw std::runtime_error("cancelled");
+                break;
+            default:
+                break;
+        }
+        return shard * 10;
+    };
+
+    auto results =
+        pg::detail::RunOnShards(4, engine::Deadline::FromDuration(std::chrono::milliseconds{100}), func);
+    ASSERT_EQ(results.size(), 4);
+    EXPECT_EQ(results[0].Retrieve(), 0);
+    UEXPECT_THROW_MSG(results[1].Retrieve(), std::runtime_error, "shard failure");
+    UEXPECT_THROW_MSG(results[2].Retrieve(), std::runtime_error, "cancelled");
+    EXPECT_EQ(results[3].Retrieve(), 30);
+}
+
+UTEST(PostgreSharding, RunOnShardsVoid) {
+    std::vector<int> visited(3);
+    auto func = [&visited](std::size_t shard) { ++visited[shard]; };
+
+    auto results = pg::detail::RunOnShards(3, engine::Deadline{}, func);
+    ASSERT_EQ(results.size(), 3);
+    for (auto& result : results) {
+        UEXPECT_NO_THROW(result.Retrieve());
+    }
+    EXPECT_EQ(visited, std::vector<int>(3, 1));
+}
+
+USERVER_NAMESPACE_END
@@ -34,6 +34,12 @@ UTEST_F(HotStandby, Smoke) {
     } else {
         EXPECT_EQ(0, hosts->count(pg::ClusterHostType::kSlave));
     }
+
+    auto hosts_metrics = qcc.GetHostsMetrics();
+    ASSERT_EQ(dsns.size(), hosts_metrics->size());
+    const auto master_index = hosts->at(pg::ClusterHostType::kMaster).front();
+    EXPECT_EQ(std::chrono::milliseconds{0}, (*hosts_metrics)[master_index].replication_lag);
+    EXPECT_LE(std::chrono::microseconds{0}, (*hosts_metrics)[master_index].roundtrip_time);
 }
 
 UTEST_F(HotStandby, ReplicationLag) {
@@ -162,6 +162,38 @@ UTEST_P(PostgreConnection, OptionalFields) {
     UEXPECT_NO_THROW(res.AsSingleRow<MyStruct>(pg::kRowTag));
 }
 
+UTEST_P(PostgreConnection, TypedResultAsContainerManyRows) {
+    using MyStruct = static_test::MyStructWithOptional;
+
+    CheckConnection(GetConn());
+    pg::ResultSet res{nullptr};
+    // more rows than are decoded in a single batch
+    UEXPECT_NO_THROW(
+        res = GetConn()->Execute(
+            "select i, case when i % 2 = 0 then null else i::text end, i / 2.0::double precision "
+            "from generate_series(1, 1000) as i"
+        )
+    );
+
+    auto structs = res.AsContainer<std::vector<MyStruct>>(pg::kRowTag);
+    ASSERT_EQ(res.Size(), structs.size());
+    for (std::size_t i = 0; i < structs.size(); ++i) {
+        const int value = i + 1;
+        EXPECT_EQ(value, structs[i].int_member);
+        EXPECT_EQ(value % 2 == 0 ? std::nullopt : std::optional{std::to_string(value)}, structs[i].string_member);
+        EXPECT_EQ(value / 2.0, structs[i].double_member);
+    }
+
+    UEXPECT_THROW(res.AsContainer<std::vector<static_test::MyAggregateStruct>>(pg::kRowTag), pg::FieldValueIsNull);
+    UEXPECT_THROW(res.AsContainer<std::vector<int>>(), pg::NonSingleColumnResultSet);
+
+    UEXPECT_NO_THROW(res = GetConn()->Execute("select i from generate_series(1, 1000) as i"));
+    const auto ints = res.AsContainer<std::vector<int>>();
+    ASSERT_EQ(res.Size(), ints.size());
+    EXPECT_EQ(1, ints.front());
+    EXPECT_EQ(1000, ints.back());
+}
+
 UTEST_P(PostgreConnection, EmptyTypedResult) {
     using MyTuple = static_test::MyTupleType;
     using MyStruct = static_test::MyAggregateStruct;
@@ -104,6 +104,47 @@ Portal Transaction::MakePortal(
     return Portal{conn_.get(), portal_name, query, params, std::move(statement_cmd_ctl)};
 }
 
+CopyIn Transaction::MakeCopyIn(OptionalCommandControl statement_cmd_ctl, const Query& query) {
+    if (!conn_) {
+        LOG_LIMITED_ERROR() << "COPY called after transaction finished" << logging::LogExtra::Stacktrace();
+        throw NotInTransaction("Transaction handle is not valid");
+    }
+    return CopyIn{conn_.get(), query, std::move(statement_cmd_ctl)};
+}
+
+CopyOut Transaction::MakeCopyOut(OptionalCommandControl statement_cmd_ctl, const Query& query) {
+    if (!conn_) {
+        LOG_LIMITED_ERROR() << "COPY called after transaction finished" << logging::LogExtra::Stacktrace();
+        throw NotInTransaction("Transaction handle is not valid");
+    }
+    return CopyOut{conn_.get(), query, std::move(statement_cmd_ctl)};
+}
+
+ResultStream Transaction::MakeResultStream(
+    OptionalCommandControl statement_cmd_ctl,
+    std::size_t chunk_size,
+    const Query& query,
+    const ParameterStore& store
+) {
+    return DoMakeResultStream(
+        query, detail::QueryParameters{store.GetInternalData()}, std::move(statement_cmd_ctl), chunk_size
+    );
+}
+
+ResultStream Transaction::DoMakeResultStream(
+    const Query& query,
+    const detail::QueryParameters& params,
+    OptionalCommandControl statement_cmd_ctl,
+    std::size_t chunk_size
+) {
+    if (!conn_) {
+        LOG_LIMITED_ERROR() << "Result stream requested after transaction finished"
+                            << logging::LogExtra::Stacktrace();
+        throw NotInTransaction("Transaction handle is not valid");
+    }
+    return ResultStream{conn_.get(), query, params, std::move(statement_cmd_ctl), chunk_size};
+}
+
 void Transaction::SetParameter(const std::string& param_name, const std::string& value) {
     if (!conn_) {
         LOG_LIMITED_ERROR() << "Set parameter called after transaction finished" << logging::LogExtra::Stacktrace();
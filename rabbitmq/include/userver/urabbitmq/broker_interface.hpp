@@ -4,6 +4,7 @@
 /// @brief A bunch of interface classes
 
 #include <string>
+#include <vector>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/utils/flags.hpp>
@@ -166,6 +167,31 @@ public:
         engine::Deadline deadline
     ) = 0;
 
+    /// @brief Publish messages to an exchange and await confirmation of all
+    /// of them from the broker
+    ///
+    /// Unlike a PublishReliable per message, which waits for the broker
+    /// confirmation of every message before the next one is sent, this keeps
+    /// up to `max_unconfirmed_publishes` messages unconfirmed on a single
+    /// channel, so the throughput is not bound by the round-trip time to the
+    /// broker. A single confirmation of many messages (`multiple=true`) is
+    /// resolved for all of them at once.
+    ///
+    /// If the broker rejects any of the messages an exception is thrown,
+    /// some of the messages might have been published anyway.
+    ///
+    /// @param exchange the exchange to publish to
+    /// @param routing_key the routing key
+    /// @param messages the messages to send, in order
+    /// @param deadline execution deadline
+    virtual void PublishReliableBatch(
+        const Exchange& exchange,
+        const std::string& routing_key,
+        const std::vector<std::string>& messages,
+        MessageType type,
+        engine::Deadline deadline
+    ) = 0;
+
 protected:
     ~IReliableChannelInterface();
 };
@@ -113,6 +113,14 @@ public:
         PublishReliable(exchange, routing_key, message, MessageType::kTransient, deadline);
     }
 
+    void PublishReliableBatch(
+        const Exchange& exchange,
+        const std::string& routing_key,
+        const std::vector<std::string>& messages,
+        MessageType type,
+        engine::Deadline deadline
+    ) override;
+
     /// @brief Get a reliable publisher interface for the broker
     /// (publisher-confirms)
     ///
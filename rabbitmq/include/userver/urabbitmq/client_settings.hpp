@@ -74,6 +74,13 @@ struct PoolSettings final {
     /// (tcp error/protocol error/write timeout) leads to a errors burst:
     /// all outstanding request will fails at once
     size_t max_in_flight_requests = 5;
+
+    /// A per-connection limit for messages of a batched reliable publish
+    /// (see urabbitmq::Client::PublishReliableBatch) awaiting confirmation
+    /// from the broker.
+    /// Note: a whole batch counts as a single request against
+    /// max_in_flight_requests
+    size_t max_unconfirmed_publishes = 100;
 };
 
 class TestsHelper;
@@ -6,6 +6,7 @@
 #include <memory>
 
 #include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 #include <userver/urabbitmq/consumer_settings.hpp>
 
@@ -16,6 +17,10 @@ namespace urabbitmq {
 class Client;
 class ConsumerBaseImpl;
 
+namespace statistics {
+class ConsumerStatistics;
+}
+
 /// @ingroup userver_base_classes
 ///
 /// @brief Base class for your consumers.
@@ -55,6 +60,11 @@ public:
     /// otherwise it's UB.
     void Stop();
 
+    /// @brief Write consumer statistics: processed and failed messages, the
+    /// messages waiting for processing, average wait and processing times
+    /// and the prefetch count.
+    void WriteStatistics(utils::statistics::Writer& writer) const;
+
 protected:
     /// @brief You may override this method in derived class and implement
     /// message handling logic. By default it does nothing.
@@ -80,6 +90,9 @@ private:
     std::shared_ptr<Client> client_;
     const ConsumerSettings settings_;
 
+    // Outlives the restarts of the consumer
+    std::unique_ptr<statistics::ConsumerStatistics> stats_;
+
     std::unique_ptr<ConsumerBaseImpl> impl_;
     utils::PeriodicTask monitor_{};
 };
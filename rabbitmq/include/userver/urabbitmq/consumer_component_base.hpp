@@ -6,6 +6,7 @@
 #include <memory>
 #include <userver/components/component_base.hpp>
 #include <userver/urabbitmq/typedefs.hpp>
+#include <userver/utils/statistics/entry.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -38,6 +39,11 @@ namespace urabbitmq {
 /// rabbit_name      | Name of the RabbitMQ component to use for consumption
 /// queue            | Name of the queue to consume from
 /// prefetch_count   | prefetch_count for the consumer, limits the amount of in-flight messages
+/// max_concurrent_messages | limit for concurrently processed messages, 0 means prefetch_count
+/// max_prefetch_count | upper bound of the prefetch count tuned by the processing time, see urabbitmq::ConsumerSettings
+/// ack_mode         | `unordered` or `ordered`, see urabbitmq::AckMode
+///
+/// The consumer statistics are written as `rabbitmq_consumer.<component name>`.
 ///
 // clang-format on
 class ConsumerComponentBase : public components::ComponentBase {
@@ -76,6 +82,8 @@ private:
     // This is actually just a subclass of `ConsumerBase`
     class Impl;
     std::unique_ptr<Impl> impl_;
+
+    utils::statistics::Entry statistics_holder_;
 };
 
 }  // namespace urabbitmq
@@ -11,6 +11,18 @@ USERVER_NAMESPACE_BEGIN
 
 namespace urabbitmq {
 
+/// @brief How the processed messages are acknowledged to the broker
+enum class AckMode {
+    /// Every message is acked as soon as it is processed
+    kUnordered,
+
+    /// Messages are acked in the delivery order: a processed message waits for
+    /// the ones delivered before it, and all of them are acked at once
+    /// (`multiple=true`). Saves the acks of fast consumers, but a slow message
+    /// holds the acks of the messages delivered after it
+    kOrdered,
+};
+
 /// @brief Consumer settings struct
 struct ConsumerSettings final {
     /// A queue to consume from
@@ -24,6 +36,23 @@ struct ConsumerSettings final {
     /// Settings this value to 1 basically makes a consumer synchronous, which
     /// could be of use for some workloads
     std::uint16_t prefetch_count;
+
+    /// Limit for concurrently processed messages, 0 means `prefetch_count`.
+    /// If less than the prefetch count, the rest of the delivered messages wait
+    /// for their turn, so a few slow messages do not stop the processing of
+    /// the rest
+    std::uint16_t max_concurrent_messages{0};
+
+    /// If greater than `prefetch_count`, the prefetch count is tuned between
+    /// `prefetch_count` and this value by the processing time of the messages:
+    /// the faster the messages are processed, the more of them are prefetched.
+    ///
+    /// @note The tuned prefetch count is set channel-wide (`global=true`),
+    /// which is not supported by quorum queues
+    std::uint16_t max_prefetch_count{0};
+
+    /// How the processed messages are acknowledged
+    AckMode ack_mode{AckMode::kUnordered};
 };
 
 }  // namespace urabbitmq
@@ -45,6 +45,16 @@ void ReliableChannel::PublishReliable(
     ConnectionHelper::PublishReliable(*impl_, exchange, routing_key, message, type, deadline).Wait(deadline);
 }
 
+void ReliableChannel::PublishReliableBatch(
+    const Exchange& exchange,
+    const std::string& routing_key,
+    const std::vector<std::string>& messages,
+    MessageType type,
+    engine::Deadline deadline
+) {
+    ConnectionHelper::PublishReliableBatch(*impl_, exchange, routing_key, messages, type, deadline);
+}
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
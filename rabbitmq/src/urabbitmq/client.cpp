@@ -88,6 +88,18 @@ void Client::PublishReliable(
     awaiter.Wait(deadline);
 }
 
+void Client::PublishReliableBatch(
+    const Exchange& exchange,
+    const std::string& routing_key,
+    const std::vector<std::string>& messages,
+    MessageType type,
+    engine::Deadline deadline
+) {
+    ConnectionHelper::PublishReliableBatch(
+        impl_->GetConnection(deadline), exchange, routing_key, messages, type, deadline
+    );
+}
+
 AdminChannel Client::GetAdminChannel(engine::Deadline deadline) { return {impl_->GetConnection(deadline)}; }
 
 Channel Client::GetChannel(engine::Deadline deadline) { return {impl_->GetConnection(deadline)}; }
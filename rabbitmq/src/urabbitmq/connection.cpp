@@ -9,6 +9,7 @@ Connection::Connection(
     const EndpointInfo& endpoint,
     const AuthSettings& auth_settings,
     size_t max_in_flight_requests,
+    size_t max_unconfirmed_publishes,
     bool secure,
     statistics::ConnectionStatistics& stats,
     engine::Deadline deadline
@@ -16,7 +17,7 @@ Connection::Connection(
     : handler_{resolver, endpoint, auth_settings, secure, stats, deadline},
       connection_{handler_, max_in_flight_requests, deadline},
       channel_{connection_},
-      reliable_channel_{connection_} {}
+      reliable_channel_{connection_, max_unconfirmed_publishes} {}
 
 Connection::~Connection() = default;
 
@@ -29,6 +29,7 @@ public:
         const EndpointInfo& endpoint,
         const AuthSettings& auth_settings,
         size_t max_in_flight_requests,
+        size_t max_unconfirmed_publishes,
         bool secure,
         statistics::ConnectionStatistics& stats,
         engine::Deadline deadline
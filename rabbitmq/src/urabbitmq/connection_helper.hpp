@@ -1,5 +1,8 @@
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include <userver/engine/deadline.hpp>
 #include <userver/urabbitmq/typedefs.hpp>
 #include <userver/utils/flags.hpp>
@@ -75,6 +78,15 @@ public:
         engine::Deadline deadline
     );
 
+    static void PublishReliableBatch(
+        const ConnectionPtr& connection,
+        const Exchange& exchange,
+        const std::string& routing_key,
+        const std::vector<std::string>& messages,
+        MessageType type,
+        engine::Deadline deadline
+    );
+
 private:
     template <typename Func>
     static impl::ResponseAwaiter WithSpan(const char* name, Func&& fn) {
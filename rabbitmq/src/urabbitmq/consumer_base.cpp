@@ -6,6 +6,7 @@
 
 #include <urabbitmq/client_impl.hpp>
 #include <urabbitmq/consumer_base_impl.hpp>
+#include <urabbitmq/statistics/consumer_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -17,10 +18,14 @@ constexpr std::chrono::milliseconds kConnectionAcquisitionTimeout{1000};
 constexpr std::chrono::seconds kMonitorInterval{1};
 
 template <typename OnMessage>
-std::unique_ptr<ConsumerBaseImpl>
-CreateAndStartConsumerImpl(ClientImpl& client_impl, const ConsumerSettings& settings, OnMessage&& on_message) {
+std::unique_ptr<ConsumerBaseImpl> CreateAndStartConsumerImpl(
+    ClientImpl& client_impl,
+    const ConsumerSettings& settings,
+    statistics::ConsumerStatistics& stats,
+    OnMessage&& on_message
+) {
     auto impl = std::make_unique<ConsumerBaseImpl>(
-        client_impl.GetConnection(engine::Deadline::FromDuration(kConnectionAcquisitionTimeout)), settings
+        client_impl.GetConnection(engine::Deadline::FromDuration(kConnectionAcquisitionTimeout)), settings, stats
     );
     impl->Start(std::forward<OnMessage>(on_message));
 
@@ -30,7 +35,10 @@ CreateAndStartConsumerImpl(ClientImpl& client_impl, const ConsumerSettings& sett
 }  // namespace
 
 ConsumerBase::ConsumerBase(std::shared_ptr<Client> client, const ConsumerSettings& settings)
-    : client_{std::move(client)}, settings_{settings}, impl_{nullptr} {
+    : client_{std::move(client)},
+      settings_{settings},
+      stats_{std::make_unique<statistics::ConsumerStatistics>()},
+      impl_{nullptr} {
     UASSERT(client_);
 }
 
@@ -45,7 +53,7 @@ void ConsumerBase::Start() {
     }
 
     try {
-        impl_ = CreateAndStartConsumerImpl(*client_->impl_, settings_, [this](ConsumedMessage message) {
+        impl_ = CreateAndStartConsumerImpl(*client_->impl_, settings_, *stats_, [this](ConsumedMessage message) {
             Process(std::move(message));
         });
     } catch (const std::exception& ex) {
@@ -62,9 +70,12 @@ void ConsumerBase::Start() {
                 // nodes fail or we are just unlucky. Not sure how much of a problem
                 // that is, but still
                 impl_.reset();
-                impl_ = CreateAndStartConsumerImpl(*client_->impl_, settings_, [this](ConsumedMessage message) {
-                    Process(std::move(message));
-                });
+                impl_ = CreateAndStartConsumerImpl(
+                    *client_->impl_,
+                    settings_,
+                    *stats_,
+                    [this](ConsumedMessage message) { Process(std::move(message)); }
+                );
                 LOG_INFO() << "Restarted successfully";
             } catch (const std::exception& ex) {
                 LOG_WARNING() << "Failed to restart a consumer: '" << ex.what() << "'; will try to restart again";
@@ -78,6 +89,8 @@ void ConsumerBase::Stop() {
     impl_.reset();
 }
 
+void ConsumerBase::WriteStatistics(utils::statistics::Writer& writer) const { writer = stats_->Get(); }
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
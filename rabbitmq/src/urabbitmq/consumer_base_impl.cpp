@@ -1,5 +1,9 @@
 #include "consumer_base_impl.hpp"
 
+#include <algorithm>
+#include <cstdlib>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 
 #include <fmt/format.h>
@@ -12,6 +16,7 @@
 #include <urabbitmq/connection.hpp>
 #include <urabbitmq/impl/amqp_channel.hpp>
 #include <urabbitmq/impl/deferred_wrapper.hpp>
+#include <urabbitmq/statistics/consumer_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -21,12 +26,31 @@ namespace {
 
 constexpr std::chrono::milliseconds kStartTimeout{2000};
 
+constexpr std::chrono::seconds kPrefetchTuneInterval{1};
+// The prefetched messages should keep the processing busy for that long,
+// which covers the round-trip of the acks and deliveries
+constexpr std::chrono::milliseconds kPrefetchBufferTime{100};
+
+std::chrono::microseconds ElapsedSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+}
+
 }  // namespace
 
-ConsumerBaseImpl::ConsumerBaseImpl(ConnectionPtr&& connection, const ConsumerSettings& settings)
+ConsumerBaseImpl::ConsumerBaseImpl(
+    ConnectionPtr&& connection,
+    const ConsumerSettings& settings,
+    statistics::ConsumerStatistics& stats
+)
     : dispatcher_{engine::current_task::GetTaskProcessor()},
       queue_name_{settings.queue.GetUnderlying()},
       prefetch_count_{settings.prefetch_count},
+      min_prefetch_count_{settings.prefetch_count},
+      max_prefetch_count_{std::max(settings.prefetch_count, settings.max_prefetch_count)},
+      ack_mode_{settings.ack_mode},
+      stats_{stats},
+      processing_sema_{
+          settings.max_concurrent_messages != 0 ? settings.max_concurrent_messages : settings.prefetch_count},
       connection_ptr_{std::move(connection)},
       channel_{connection_ptr_->GetChannel()} {
     // We take ownership of the connection, because if it remains pooled
@@ -38,7 +62,11 @@ ConsumerBaseImpl::~ConsumerBaseImpl() { Stop(); }
 
 void ConsumerBaseImpl::Start(DispatchCallback cb) {
     const auto start_deadline = engine::Deadline::FromDuration(kStartTimeout);
-    channel_.SetQos(prefetch_count_, start_deadline);
+    // A per-consumer prefetch count can't be changed after the consumer is set
+    // up, so the tuned one is channel-wide
+    const bool tune_prefetch = max_prefetch_count_ > min_prefetch_count_;
+    channel_.SetQos(prefetch_count_, tune_prefetch, start_deadline);
+    stats_.SetPrefetchCount(prefetch_count_);
 
     dispatch_callback_ = std::move(cb);
 
@@ -66,10 +94,17 @@ void ConsumerBaseImpl::Start(DispatchCallback cb) {
     );
 
     LOG_INFO() << "Started a consumer for '" << queue_name_ << "' queue";
+
+    if (tune_prefetch) {
+        prefetch_tuner_.Start(
+            fmt::format("{}_consumer_prefetch_tuner", queue_name_), {kPrefetchTuneInterval}, [this] { TunePrefetch(); }
+        );
+    }
 }
 
 void ConsumerBaseImpl::Stop() {
     stopped_ = true;
+    prefetch_tuner_.Stop();
     try {
         channel_.CancelConsumer(consumer_tag_);
     } catch (const std::exception&) {
@@ -78,6 +113,7 @@ void ConsumerBaseImpl::Stop() {
 
     // Cancel all the active dispatched tasks
     bts_.CancelAndWait();
+    stats_.AccountMessagesAbandoned(messages_waiting_.exchange(0));
 
     // Destroy the connection: at this point all the remaining tasks are stopped,
     // consumer is either stopped or in unknown state - that could happen if we
@@ -98,6 +134,13 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message, uint64_t delivery
     consumed.metadata.exchange = message.exchange();
     consumed.metadata.routingKey = message.routingkey();
 
+    uint64_t no_tag = 0;
+    first_delivery_tag_.compare_exchange_strong(no_tag, delivery_tag);
+
+    ++messages_waiting_;
+    stats_.AccountMessageDelivered();
+    const auto delivered_at = std::chrono::steady_clock::now();
+
     bts_.Detach(engine::AsyncNoSpan(
         dispatcher_,
         [this,
@@ -105,7 +148,19 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message, uint64_t delivery
          span_name = std::move(span_name),
          trace_id = std::move(trace_id),
          parent_span_id = std::move(parent_span_id),
-         delivery_tag]() mutable {
+         delivery_tag,
+         delivered_at]() mutable {
+            // A slow message takes a single processing slot, the rest of the
+            // delivered messages keep being processed
+            if (!processing_sema_.try_lock_shared_until(engine::Deadline{})) {
+                // The consumer is stopping, the message would be requeued
+                return;
+            }
+            const std::shared_lock processing_lock{processing_sema_, std::adopt_lock};
+            --messages_waiting_;
+            stats_.AccountProcessingStarted(ElapsedSince(delivered_at));
+
+            const auto processing_start = std::chrono::steady_clock::now();
             auto span = tracing::Span::MakeSpan(std::move(span_name), trace_id, {parent_span_id});
             bool success = false;
             try {
@@ -114,14 +169,10 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message, uint64_t delivery
             } catch (const std::exception& ex) {
                 LOG_ERROR() << "Failed to process the consumed message, " << ex.what() << "; would requeue";
             }
+            stats_.AccountProcessingFinished(ElapsedSince(processing_start), success);
 
             try {
-                if (success) {
-                    channel_.Ack(delivery_tag, {});
-                    channel_.AccountMessageConsumed();
-                } else {
-                    channel_.Reject(delivery_tag, true, {});
-                }
+                Settle(delivery_tag, success);
             } catch (const std::exception& ex) {
                 LOG_WARNING() << "Failed to " << (success ? "ack" : "requeue")
                               << " the message, it will be requeued by RabbitMQ at some point";
@@ -130,6 +181,83 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message, uint64_t delivery
     ));
 }
 
+void ConsumerBaseImpl::Settle(uint64_t delivery_tag, bool success) {
+    if (ack_mode_ == AckMode::kOrdered) {
+        SettleOrdered(delivery_tag, success);
+        return;
+    }
+
+    if (success) {
+        channel_.Ack(delivery_tag, {});
+        channel_.AccountMessageConsumed();
+    } else {
+        channel_.Reject(delivery_tag, true, {});
+    }
+}
+
+void ConsumerBaseImpl::SettleOrdered(uint64_t delivery_tag, bool success) {
+    if (!success) {
+        // Requeue right away, a rejected message is not covered by the
+        // following multiple acks
+        channel_.Reject(delivery_tag, true, {});
+    }
+
+    // Acks must be sent in the order of the delivery tags, as an ack of an
+    // already acked tag is a channel error
+    const std::lock_guard lock{ordered_acks_mutex_};
+    if (last_settled_tag_ == 0) {
+        last_settled_tag_ = first_delivery_tag_.load() - 1;
+    }
+    processed_out_of_order_.emplace(delivery_tag, success);
+
+    uint64_t ack_tag = 0;
+    size_t acked_count = 0;
+    for (auto it = processed_out_of_order_.begin();
+         it != processed_out_of_order_.end() && it->first == last_settled_tag_ + 1;
+         it = processed_out_of_order_.erase(it)) {
+        last_settled_tag_ = it->first;
+        if (it->second) {
+            ack_tag = it->first;
+            ++acked_count;
+        }
+    }
+
+    if (ack_tag != 0) {
+        channel_.AckMultiple(ack_tag, {});
+        for (size_t i = 0; i < acked_count; ++i) {
+            channel_.AccountMessageConsumed();
+        }
+    }
+}
+
+void ConsumerBaseImpl::TunePrefetch() {
+    const auto processing_time = stats_.GetAverageProcessingTime();
+    if (processing_time.count() <= 0) return;
+
+    // Every processing slot should have the messages for the buffer time
+    // prefetched, on top of the one being processed
+    const size_t concurrency = processing_sema_.GetCapacity();
+    const auto buffer_time = std::chrono::duration_cast<std::chrono::microseconds>(kPrefetchBufferTime);
+    const auto messages_per_slot = (buffer_time + processing_time - std::chrono::microseconds{1}) / processing_time;
+    const auto buffered = concurrency * static_cast<size_t>(messages_per_slot);
+    const auto desired =
+        static_cast<uint16_t>(std::clamp<size_t>(concurrency + buffered, min_prefetch_count_, max_prefetch_count_));
+
+    // Do not bother the broker with small changes
+    if (std::abs(desired - prefetch_count_) * 10 < prefetch_count_) return;
+
+    try {
+        channel_.SetQos(desired, true, engine::Deadline::FromDuration(kStartTimeout));
+        LOG_INFO() << "Tuned the prefetch count of the consumer for '" << queue_name_ << "' queue from "
+                   << prefetch_count_ << " to " << desired;
+        prefetch_count_ = desired;
+        stats_.SetPrefetchCount(prefetch_count_);
+    } catch (const std::exception& ex) {
+        LOG_WARNING() << "Failed to tune the prefetch count of the consumer for '" << queue_name_
+                      << "' queue: " << ex.what();
+    }
+}
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
@@ -1,9 +1,15 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
 
 #include <userver/concurrent/background_task_storage.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/semaphore.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/utils/periodic_task.hpp>
 
 #include <urabbitmq/connection_ptr.hpp>
 
@@ -19,9 +25,17 @@ namespace impl {
 class AmqpChannel;
 }
 
+namespace statistics {
+class ConsumerStatistics;
+}
+
 class ConsumerBaseImpl final {
 public:
-    ConsumerBaseImpl(ConnectionPtr&& connection, const ConsumerSettings& settings);
+    ConsumerBaseImpl(
+        ConnectionPtr&& connection,
+        const ConsumerSettings& settings,
+        statistics::ConsumerStatistics& stats
+    );
     ~ConsumerBaseImpl();
 
     using DispatchCallback = std::function<void(ConsumedMessage)>;
@@ -32,11 +46,32 @@ public:
 
 private:
     void OnMessage(const AMQP::Message& message, uint64_t delivery_tag);
+    void Settle(uint64_t delivery_tag, bool success);
+    void SettleOrdered(uint64_t delivery_tag, bool success);
+    void TunePrefetch();
     void Stop();
 
     engine::TaskProcessor& dispatcher_;
     const std::string queue_name_;
     uint16_t prefetch_count_;
+    const uint16_t min_prefetch_count_;
+    const uint16_t max_prefetch_count_;
+    const AckMode ack_mode_;
+
+    statistics::ConsumerStatistics& stats_;
+    engine::CancellableSemaphore processing_sema_;
+    // Delivered messages that are not being processed yet
+    std::atomic<size_t> messages_waiting_{0};
+
+    // The first delivery tag of the consumer, the channel might have been used
+    // for a basic.get before
+    std::atomic<uint64_t> first_delivery_tag_{0};
+
+    // For AckMode::kOrdered: the messages processed out of order, by delivery
+    // tag, and the last delivery tag with all the preceding ones settled
+    engine::Mutex ordered_acks_mutex_;
+    std::map<uint64_t, bool> processed_out_of_order_;
+    uint64_t last_settled_tag_{0};
 
     ConnectionPtr connection_ptr_;
     impl::AmqpChannel& channel_;
@@ -51,6 +86,8 @@ private:
     // (consumer_base polls this and destructs+constructs us if we broke)
     std::atomic<bool> broken_{false};
 
+    utils::PeriodicTask prefetch_tuner_;
+
     // This should be the last member
     concurrent::BackgroundTaskStorageCore bts_;
 };
@@ -4,6 +4,7 @@
 
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 #include <userver/urabbitmq/component.hpp>
@@ -13,12 +14,30 @@ USERVER_NAMESPACE_BEGIN
 
 namespace urabbitmq {
 
+namespace {
+
+AckMode ParseAckMode(const std::string& ack_mode) {
+    if (ack_mode == "unordered") return AckMode::kUnordered;
+    if (ack_mode == "ordered") return AckMode::kOrdered;
+
+    UINVARIANT(false, "Unknown ack_mode '" + ack_mode + "'");
+}
+
+}  // namespace
+
 ConsumerSettings Parse(const yaml_config::YamlConfig& config, formats::parse::To<ConsumerSettings>) {
     ConsumerSettings settings;
     settings.queue = Queue{config["queue"].As<std::string>()};
     settings.prefetch_count = config["prefetch_count"].As<uint16_t>();
+    settings.max_concurrent_messages = config["max_concurrent_messages"].As<uint16_t>(0);
+    settings.max_prefetch_count = config["max_prefetch_count"].As<uint16_t>(0);
+    settings.ack_mode = ParseAckMode(config["ack_mode"].As<std::string>("unordered"));
 
     UINVARIANT(settings.prefetch_count > 0, "prefetch_count is set to zero");
+    UINVARIANT(
+        settings.max_prefetch_count == 0 || settings.max_prefetch_count >= settings.prefetch_count,
+        "max_prefetch_count is less than prefetch_count"
+    );
 
     return settings;
 }
@@ -58,9 +77,15 @@ ConsumerComponentBase::ConsumerComponentBase(
       impl_{std::make_unique<Impl>(
           context.FindComponent<components::RabbitMQ>(config["rabbit_name"].As<std::string>()).GetClient(),
           config.As<ConsumerSettings>()
-      )} {}
+      )} {
+    auto& statistics_storage = context.FindComponent<components::StatisticsStorage>();
+    statistics_holder_ = statistics_storage.GetStorage().RegisterWriter(
+        "rabbitmq_consumer." + config.Name(),
+        [this](utils::statistics::Writer& writer) { impl_->WriteStatistics(writer); }
+    );
+}
 
-ConsumerComponentBase::~ConsumerComponentBase() = default;
+ConsumerComponentBase::~ConsumerComponentBase() { statistics_holder_.Unregister(); }
 
 void ConsumerComponentBase::OnAllComponentsLoaded() { impl_->Start(this); }
 
@@ -81,6 +106,22 @@ properties:
     prefetch_count:
         type: integer
         description: prefetch_count for the consumer
+    max_concurrent_messages:
+        type: integer
+        description: limit for concurrently processed messages, 0 means prefetch_count
+        defaultDescription: 0
+    max_prefetch_count:
+        type: integer
+        description: |
+          if greater than prefetch_count, the prefetch count is tuned up to this value by the processing time
+        defaultDescription: 0
+    ack_mode:
+        type: string
+        description: whether the messages are acked as soon as processed or in the delivery order
+        enum:
+          - unordered
+          - ordered
+        defaultDescription: unordered
 )");
 }
 
@@ -1,5 +1,6 @@
 #include "amqp_channel.hpp"
 
+#include <deque>
 #include <optional>
 
 #include <userver/engine/task/task.hpp>
@@ -191,18 +192,24 @@ void AmqpChannel::Ack(uint64_t delivery_tag, engine::Deadline deadline) {
     channel->ack(delivery_tag);
 }
 
+void AmqpChannel::AckMultiple(uint64_t delivery_tag, engine::Deadline deadline) {
+    // No way to acknowledge success, no way to handle synchronous errors
+    auto channel = conn_.GetChannel(deadline);
+    channel->ack(delivery_tag, AMQP::multiple);
+}
+
 void AmqpChannel::Reject(uint64_t delivery_tag, bool requeue, engine::Deadline deadline) {
     // No way to acknowledge success, no way to handle synchronous errors
     auto channel = conn_.GetChannel(deadline);
     channel->reject(delivery_tag, requeue ? AMQP::requeue : 0);
 }
 
-void AmqpChannel::SetQos(uint16_t prefetch_count, engine::Deadline deadline) {
+void AmqpChannel::SetQos(uint16_t prefetch_count, bool global, engine::Deadline deadline) {
     auto deferred = DeferredWrapper::Create();
 
     {
         auto channel = conn_.GetChannel(deadline);
-        deferred->Wrap(channel->setQos(prefetch_count));
+        deferred->Wrap(channel->setQos(prefetch_count, global));
     }
 
     deferred->Wait(deadline);
@@ -231,7 +238,10 @@ void AmqpChannel::CancelConsumer(const std::optional<std::string>& consumer_tag)
 
 void AmqpChannel::AccountMessageConsumed() { conn_.GetStatistics().AccountMessageConsumed(); }
 
-AmqpReliableChannel::AmqpReliableChannel(AmqpConnection& conn) : conn_{conn} {}
+AmqpReliableChannel::AmqpReliableChannel(AmqpConnection& conn, size_t max_unconfirmed_publishes)
+    : conn_{conn}, max_unconfirmed_publishes_{max_unconfirmed_publishes} {
+    UINVARIANT(max_unconfirmed_publishes_ > 0, "max_unconfirmed_publishes is set to zero");
+}
 
 AmqpReliableChannel::~AmqpReliableChannel() = default;
 
@@ -262,6 +272,62 @@ ResponseAwaiter AmqpReliableChannel::Publish(
     return awaiter;
 }
 
+void AmqpReliableChannel::PublishBatch(
+    const Exchange& exchange,
+    const std::string& routing_key,
+    const std::vector<std::string>& messages,
+    MessageType type,
+    engine::Deadline deadline
+) {
+    // The whole batch is a single request in terms of max_in_flight_requests
+    const auto waiter_slot = conn_.AcquireWaiterSlot(deadline);
+    const auto headers = CreateHeaders();
+
+    // Confirms come in the publishing order, and a single ack with
+    // multiple=true confirms many messages at once: the Tagger resolves all of
+    // their deferreds
+    std::deque<std::shared_ptr<DeferredWrapper>> unconfirmed;
+    const auto pop_confirmed = [&unconfirmed, deadline] {
+        while (!unconfirmed.empty() && unconfirmed.front()->IsSignaled()) {
+            unconfirmed.front()->Wait(deadline);
+            unconfirmed.pop_front();
+        }
+    };
+
+    auto it = messages.begin();
+    while (it != messages.end()) {
+        pop_confirmed();
+        if (unconfirmed.size() >= max_unconfirmed_publishes_) {
+            conn_.GetStatistics().AccountPublishWindowFull();
+            unconfirmed.front()->Wait(deadline);
+            unconfirmed.pop_front();
+            pop_confirmed();
+        }
+
+        // Publish as much as the window allows under a single connection lock
+        auto reliable = conn_.GetReliableChannel(deadline);
+        for (; it != messages.end() && unconfirmed.size() < max_unconfirmed_publishes_; ++it) {
+            AMQP::Envelope envelope{it->data(), it->size()};
+            envelope.setPersistent(type == MessageType::kPersistent);
+            envelope.setHeaders(headers);
+
+            auto deferred = DeferredWrapper::Create();
+            reliable->publish(exchange.GetUnderlying(), routing_key, envelope)
+                .onAck([this, deferred] {
+                    AccountMessagePublished();
+                    deferred->Ok();
+                })
+                .onError([deferred](const char* error) { deferred->Fail(error); });
+            unconfirmed.push_back(std::move(deferred));
+        }
+    }
+
+    for (const auto& deferred : unconfirmed) {
+        deferred->Wait(deadline);
+    }
+    conn_.GetStatistics().AccountBatchPublished();
+}
+
 void AmqpReliableChannel::AccountMessagePublished() { conn_.GetStatistics().AccountMessagePublished(); }
 
 }  // namespace urabbitmq::impl
@@ -2,6 +2,8 @@
 
 #include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/utils/assert.hpp>
@@ -62,9 +64,12 @@ public:
 
     void Ack(uint64_t delivery_tag, engine::Deadline deadline);
 
+    // Acks all the unacked messages up to and including the delivery_tag
+    void AckMultiple(uint64_t delivery_tag, engine::Deadline deadline);
+
     void Reject(uint64_t delivery_tag, bool requeue, engine::Deadline deadline);
 
-    void SetQos(uint16_t prefetch_count, engine::Deadline deadline);
+    void SetQos(uint16_t prefetch_count, bool global, engine::Deadline deadline);
 
     using ErrorCb = std::function<void(const char*)>;
     using SuccessCb = std::function<void(const std::string&)>;
@@ -89,7 +94,7 @@ private:
 
 class AmqpReliableChannel final {
 public:
-    AmqpReliableChannel(AmqpConnection& conn);
+    AmqpReliableChannel(AmqpConnection& conn, size_t max_unconfirmed_publishes);
     ~AmqpReliableChannel();
 
     ResponseAwaiter Publish(
@@ -100,10 +105,21 @@ public:
         engine::Deadline deadline
     );
 
+    // Publishes the messages keeping up to max_unconfirmed_publishes of them
+    // unconfirmed, returns when all of them are confirmed
+    void PublishBatch(
+        const Exchange& exchange,
+        const std::string& routing_key,
+        const std::vector<std::string>& messages,
+        MessageType type,
+        engine::Deadline deadline
+    );
+
 private:
     void AccountMessagePublished();
 
     AmqpConnection& conn_;
+    const size_t max_unconfirmed_publishes_;
 };
 
 }  // namespace urabbitmq::impl
@@ -74,12 +74,16 @@ LockedChannelProxy<AmqpConnection::ReliableChannel> AmqpConnection::GetReliableC
 }
 
 ResponseAwaiter AmqpConnection::GetAwaiter(engine::Deadline deadline) {
+    return ResponseAwaiter{AcquireWaiterSlot(deadline)};
+}
+
+engine::SemaphoreLock AmqpConnection::AcquireWaiterSlot(engine::Deadline deadline) {
     engine::SemaphoreLock lock{waiters_sema_, deadline};
     if (!lock.OwnsLock()) {
         throw std::runtime_error{"Failed to acquire a connection within specified deadline"};
     }
 
-    return ResponseAwaiter{std::move(lock)};
+    return lock;
 }
 
 ConnectionLock AmqpConnection::Lock(engine::Deadline deadline) { return {mutex_, deadline}; }
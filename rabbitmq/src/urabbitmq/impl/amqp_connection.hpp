@@ -64,6 +64,10 @@ public:
 
     ResponseAwaiter GetAwaiter(engine::Deadline deadline);
 
+    // Takes a slot of max_in_flight_requests for a request that waits for
+    // the broker responses on its own
+    engine::SemaphoreLock AcquireWaiterSlot(engine::Deadline deadline);
+
 private:
     friend class AmqpConnectionLocker;
     [[nodiscard]] ConnectionLock Lock(engine::Deadline deadline);
@@ -34,6 +34,8 @@ void DeferredWrapper::Wait(engine::Deadline deadline) {
     }
 }
 
+bool DeferredWrapper::IsSignaled() const { return is_signaled_.load(); }
+
 DeferredWrapper::DeferredWrapper() = default;
 
 std::shared_ptr<DeferredWrapper> DeferredWrapper::Create() {
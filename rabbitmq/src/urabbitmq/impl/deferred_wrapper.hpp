@@ -27,6 +27,8 @@ public:
 
     void Wait(engine::Deadline deadline);
 
+    bool IsSignaled() const;
+
     void Wrap(AMQP::Deferred& deferred);
 
     void WrapGet(AMQP::DeferredGet& deferred, std::string& message);
@@ -18,6 +18,10 @@ void ConnectionStatistics::AccountMessagePublished() { ++messages_published_; }
 
 void ConnectionStatistics::AccountMessageConsumed() { ++messages_consumed_; }
 
+void ConnectionStatistics::AccountBatchPublished() { ++batches_published_; }
+
+void ConnectionStatistics::AccountPublishWindowFull() { ++publish_window_full_; }
+
 ConnectionStatistics::Frozen ConnectionStatistics::Get() const {
     Frozen result{};
     result.connections_created = connections_created_.Load();
@@ -26,6 +30,8 @@ ConnectionStatistics::Frozen ConnectionStatistics::Get() const {
     result.bytes_read = bytes_read_.Load();
     result.messages_published = messages_published_.Load();
     result.messages_consumed = messages_consumed_.Load();
+    result.batches_published = batches_published_.Load();
+    result.publish_window_full = publish_window_full_.Load();
 
     return result;
 }
@@ -37,6 +43,8 @@ ConnectionStatistics::Frozen& ConnectionStatistics::Frozen::operator+=(const Fro
     bytes_read += other.bytes_read;
     messages_published += other.messages_published;
     messages_consumed += other.messages_consumed;
+    batches_published += other.batches_published;
+    publish_window_full += other.publish_window_full;
 
     return *this;
 }
@@ -48,6 +56,8 @@ void DumpMetric(utils::statistics::Writer& writer, const ConnectionStatistics::F
     writer["bytes_read"] = value.bytes_read;
     writer["messages_published"] = value.messages_published;
     writer["messages_consumed"] = value.messages_consumed;
+    writer["batches_published"] = value.batches_published;
+    writer["publish_window_full"] = value.publish_window_full;
 }
 
 }  // namespace urabbitmq::statistics
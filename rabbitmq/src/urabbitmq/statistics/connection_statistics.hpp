@@ -20,6 +20,9 @@ public:
     void AccountMessagePublished();
     void AccountMessageConsumed();
 
+    void AccountBatchPublished();
+    void AccountPublishWindowFull();
+
     struct Frozen final {
         Frozen& operator+=(const Frozen& other);
 
@@ -31,6 +34,9 @@ public:
 
         size_t messages_published{0};
         size_t messages_consumed{0};
+
+        size_t batches_published{0};
+        size_t publish_window_full{0};
     };
     Frozen Get() const;
 
@@ -43,6 +49,9 @@ private:
 
     utils::statistics::RelaxedCounter<size_t> messages_published_{0};
     utils::statistics::RelaxedCounter<size_t> messages_consumed_{0};
+
+    utils::statistics::RelaxedCounter<size_t> batches_published_{0};
+    utils::statistics::RelaxedCounter<size_t> publish_window_full_{0};
 };
 
 void DumpMetric(utils::statistics::Writer& writer, const ConnectionStatistics::Frozen& value);
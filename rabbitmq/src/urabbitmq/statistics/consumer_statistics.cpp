@@ -0,0 +1,73 @@
+#include "consumer_statistics.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace urabbitmq::statistics {
+
+namespace {
+
+// Weight of a new sample in the moving averages
+constexpr std::int64_t kAverageWeightDivisor = 16;
+
+void AccountSample(std::atomic<std::int64_t>& average, std::chrono::microseconds sample) {
+    // Concurrent updates might lose a sample, that's fine for an average
+    const auto old_value = average.load(std::memory_order_relaxed);
+    const auto new_value = old_value == 0 ? sample.count()
+                                          : old_value + (sample.count() - old_value) / kAverageWeightDivisor;
+    average.store(new_value, std::memory_order_relaxed);
+}
+
+}  // namespace
+
+void ConsumerStatistics::AccountMessageDelivered() { ++messages_waiting_; }
+
+void ConsumerStatistics::AccountProcessingStarted(std::chrono::microseconds wait_time) {
+    --messages_waiting_;
+    ++messages_processing_;
+    AccountSample(avg_wait_time_us_, wait_time);
+}
+
+void ConsumerStatistics::AccountMessagesAbandoned(size_t count) { messages_waiting_ -= count; }
+
+void ConsumerStatistics::AccountProcessingFinished(std::chrono::microseconds processing_time, bool success) {
+    --messages_processing_;
+    if (success) {
+        ++messages_processed_;
+    } else {
+        ++messages_failed_;
+    }
+    AccountSample(avg_processing_time_us_, processing_time);
+}
+
+void ConsumerStatistics::SetPrefetchCount(std::uint16_t prefetch_count) { prefetch_count_ = prefetch_count; }
+
+std::chrono::microseconds ConsumerStatistics::GetAverageProcessingTime() const {
+    return std::chrono::microseconds{avg_processing_time_us_.load(std::memory_order_relaxed)};
+}
+
+ConsumerStatistics::Frozen ConsumerStatistics::Get() const {
+    Frozen result{};
+    result.messages_processed = messages_processed_.Load();
+    result.messages_failed = messages_failed_.Load();
+    result.messages_waiting = messages_waiting_.load();
+    result.messages_processing = messages_processing_.load();
+    result.avg_wait_time_us = avg_wait_time_us_.load();
+    result.avg_processing_time_us = avg_processing_time_us_.load();
+    result.prefetch_count = prefetch_count_.load();
+
+    return result;
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const ConsumerStatistics::Frozen& value) {
+    writer["messages_processed"] = value.messages_processed;
+    writer["messages_failed"] = value.messages_failed;
+    writer["messages_waiting"] = value.messages_waiting;
+    writer["messages_processing"] = value.messages_processing;
+    writer["avg_wait_time_us"] = value.avg_wait_time_us;
+    writer["avg_processing_time_us"] = value.avg_processing_time_us;
+    writer["prefetch_count"] = value.prefetch_count;
+}
+
+}  // namespace urabbitmq::statistics
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <userver/utils/statistics/relaxed_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace urabbitmq::statistics {
+
+class ConsumerStatistics final {
+public:
+    void AccountMessageDelivered();
+    void AccountProcessingStarted(std::chrono::microseconds wait_time);
+    // Messages that were delivered, but won't be processed by a stopped consumer
+    void AccountMessagesAbandoned(size_t count);
+    void AccountProcessingFinished(std::chrono::microseconds processing_time, bool success);
+
+    void SetPrefetchCount(std::uint16_t prefetch_count);
+
+    // Exponential moving average of the processing time of the messages
+    std::chrono::microseconds GetAverageProcessingTime() const;
+
+    struct Frozen final {
+        size_t messages_processed{0};
+        size_t messages_failed{0};
+
+        size_t messages_waiting{0};
+        size_t messages_processing{0};
+
+        std::int64_t avg_wait_time_us{0};
+        std::int64_t avg_processing_time_us{0};
+
+        size_t prefetch_count{0};
+    };
+    Frozen Get() const;
+
+private:
+    utils::statistics::RelaxedCounter<size_t> messages_processed_{0};
+    utils::statistics::RelaxedCounter<size_t> messages_failed_{0};
+
+    std::atomic<size_t> messages_waiting_{0};
+    std::atomic<size_t> messages_processing_{0};
+
+    std::atomic<std::int64_t> avg_wait_time_us_{0};
+    std::atomic<std::int64_t> avg_processing_time_us_{0};
+
+    std::atomic<size_t> prefetch_count_{0};
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const ConsumerStatistics::Frozen& value);
+
+}  // namespace urabbitmq::statistics
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,59 @@
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <hiredis/hiredis.h>
+
+#include <storages/redis/impl/reply_reader.hpp>
+#include <userver/storages/redis/reply.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::bench {
+
+namespace {
+
+// HGETALL like reply: an array of state.range(0) strings of state.range(1) bytes
+std::string MakeArrayReply(const benchmark::State& state) {
+    const auto elements = state.range(0);
+    const std::string value(state.range(1), 'x');
+    std::string result = "*" + std::to_string(elements) + "\r\n";
+    for (int64_t i = 0; i < elements; ++i) {
+        result += "$" + std::to_string(value.size()) + "\r\n" + value + "\r\n";
+    }
+    return result;
+}
+
+template <typename ToReplyData>
+void ReadReply(benchmark::State& state, bool reply_data_functions, ToReplyData to_reply_data) {
+    const auto input = MakeArrayReply(state);
+    std::unique_ptr<redisReader, decltype(&redisReaderFree)> reader(redisReaderCreate(), &redisReaderFree);
+    if (reply_data_functions) impl::SetReplyDataFunctions(*reader);
+
+    for ([[maybe_unused]] auto _ : state) {
+        redisReaderFeed(reader.get(), input.data(), input.size());
+        void* reply = nullptr;
+        redisReaderGetReply(reader.get(), &reply);
+        auto data = to_reply_data(static_cast<redisReply*>(reply));
+        benchmark::DoNotOptimize(data);
+        reader->fn->freeObject(reply);
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+}  // namespace
+
+void ReplyReaderHiredis(benchmark::State& state) {
+    ReadReply(state, false, [](const redisReply* reply) { return ReplyData{reply}; });
+}
+
+void ReplyReaderReplyData(benchmark::State& state) {
+    ReadReply(state, true, [](redisReply* reply) { return impl::TakeReplyData(reply); });
+}
+
+BENCHMARK(ReplyReaderHiredis)->Args({1000, 16})->Args({1000, 1024})->Args({100000, 64});
+BENCHMARK(ReplyReaderReplyData)->Args({1000, 16})->Args({1000, 1024})->Args({100000, 64});
+
+}  // namespace storages::redis::bench
+
+USERVER_NAMESPACE_END
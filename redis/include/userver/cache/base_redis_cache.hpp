@@ -0,0 +1,330 @@
+#pragma once
+
+/// @file userver/cache/base_redis_cache.hpp
+/// @brief @copybrief components::RedisCache
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <userver/cache/cache_statistics.hpp>
+#include <userver/cache/caching_component_base.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/redis/client.hpp>
+#include <userver/storages/redis/component.hpp>
+#include <userver/storages/redis/subscribe_client.hpp>
+#include <userver/storages/redis/subscription_token.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/meta.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components {
+
+namespace impl {
+
+struct RedisCacheSettings {
+    std::string redis_component;
+    std::string db;
+    std::string subscribe_db;
+    std::size_t max_pending_keys{0};
+    std::size_t scan_count{0};
+    std::size_t scan_parallel_shards{0};
+    std::size_t fetch_batch_size{0};
+};
+
+RedisCacheSettings ParseRedisCacheSettings(const ComponentConfig& config);
+
+std::string GetRedisCacheSchema();
+
+/// @returns the key of a keyspace notification channel
+/// `__keyspace@<db>__:<key>`, or std::nullopt for other channels
+std::optional<std::string> KeyFromKeyspaceChannel(std::string_view channel);
+
+/// The keys changed since the previous update of a RedisCache, collected from
+/// the keyspace notifications
+class RedisCacheKeyspaceEvents final {
+public:
+    struct Changes {
+        std::unordered_set<std::string> keys;
+        /// The keys were dropped, a full update is required
+        bool overflow{false};
+    };
+
+    explicit RedisCacheKeyspaceEvents(std::size_t max_pending_keys);
+
+    /// Subscribes to the keyspace notifications of the keys that match the
+    /// `key_pattern` in all the databases
+    void Subscribe(storages::redis::SubscribeClient& subscribe_client, std::string_view key_pattern);
+
+    void Unsubscribe();
+
+    void OnMessage(std::string_view channel);
+
+    Changes TakeChanges();
+
+private:
+    const std::size_t max_pending_keys_;
+    concurrent::Variable<Changes> changes_;
+    storages::redis::SubscriptionToken token_;
+};
+
+}  // namespace impl
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief %Base class for the caches that mirror Redis hashes
+///
+/// The cache loads the hashes with the keys that match a pattern with SCAN and
+/// HGETALL on full updates. Between the full updates it listens to the
+/// keyspace notifications of these keys and an incremental update re-reads
+/// only the changed keys, so a small `update-interval` keeps the cache fresh
+/// at the cost of the changed keys only. If the notifications come faster than
+/// the updates consume them (more than `max-pending-keys` changed keys), the
+/// next update is a full one.
+///
+/// The server must have the notifications enabled, e.g.
+/// `CONFIG SET notify-keyspace-events Khgx$`. Keyspace notifications are
+/// delivered with a delay and may be lost on reconnects, and in Redis Cluster
+/// every node publishes the events of its own keys only, so
+/// `full-update-interval` bounds the staleness of the cache in these cases.
+/// SCAN with TYPE requires Redis 6.0 or later.
+///
+/// ### Avoiding memory leaks
+/// See components::CachingComponentBase
+///
+/// ## Static options:
+/// All options of CachingComponentBase and
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// redis-component | name of the components::Redis component | redis
+/// db | name of the Redis group to read the hashes from | -
+/// subscribe-db | name of the Redis subscribe group to listen to the keyspace notifications | -
+/// max-pending-keys | changed keys kept between the updates, a full update is done on overflow | 100000
+/// scan-count | COUNT of the SCAN commands of a full update | 1000
+/// scan-parallel-shards | shards scanned in parallel on a full update | 1
+/// fetch-batch-size | HGETALL commands sent at once | 100
+///
+/// ## Traits example:
+///
+/// ```
+/// struct RedisCacheTraitsExample {
+///   // Component name for component
+///   static constexpr std::string_view kName = "redis-example-cache";
+///
+///   // Pattern of the keys of the hashes to mirror
+///   static constexpr std::string_view kKeyPattern = "example:*";
+///
+///   // Cache element type
+///   using ObjectType = CachedObject;
+///   // Type of cache map, the keys are the Redis keys
+///   using DataType = std::unordered_map<std::string, ObjectType>;
+///
+///   // Builds a cache element from the fields of the hash stored at `key`
+///   static ObjectType DeserializeObject(
+///       const std::string& key, std::unordered_map<std::string, std::string>&& fields);
+///
+///   // Whether update part of the cache even if failed to parse some hashes
+///   static constexpr bool kAreInvalidDocumentsSkipped = false;
+/// };
+/// ```
+
+// clang-format on
+
+template <class RedisCacheTraits>
+class RedisCache : public CachingComponentBase<typename RedisCacheTraits::DataType> {
+    using DataType = typename RedisCacheTraits::DataType;
+
+    static_assert(meta::kIsMap<DataType>, "Redis cache traits must specify mapping data type");
+    static_assert(
+        std::is_same_v<std::decay_t<decltype(RedisCacheTraits::kAreInvalidDocumentsSkipped)>, bool>,
+        "Redis cache traits must specify validation policy of a bool type"
+    );
+
+public:
+    static constexpr std::string_view kName = RedisCacheTraits::kName;
+
+    RedisCache(const ComponentConfig&, const ComponentContext&);
+
+    ~RedisCache();
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    void Update(
+        cache::UpdateType type,
+        const std::chrono::system_clock::time_point& last_update,
+        const std::chrono::system_clock::time_point& now,
+        cache::UpdateStatisticsScope& stats_scope
+    ) override;
+
+    void FullUpdate(cache::UpdateStatisticsScope& stats_scope);
+
+    void IncrementalUpdate(std::unordered_set<std::string>&& keys, cache::UpdateStatisticsScope& stats_scope);
+
+    // Calls `apply(key, object)` for each of the `keys`, std::nullopt object
+    // means that the key does not exist
+    template <typename Keys, typename Apply>
+    void FetchHashes(const Keys& keys, cache::UpdateStatisticsScope& stats_scope, Apply apply);
+
+    const impl::RedisCacheSettings settings_;
+    const std::shared_ptr<storages::redis::Client> client_;
+    const std::shared_ptr<storages::redis::SubscribeClient> subscribe_client_;
+    impl::RedisCacheKeyspaceEvents keyspace_events_;
+};
+
+template <class RedisCacheTraits>
+inline constexpr bool kHasValidate<RedisCache<RedisCacheTraits>> = true;
+
+template <class RedisCacheTraits>
+RedisCache<RedisCacheTraits>::RedisCache(const ComponentConfig& config, const ComponentContext& context)
+    : CachingComponentBase<DataType>(config, context),
+      settings_(impl::ParseRedisCacheSettings(config)),
+      client_(context.FindComponent<components::Redis>(settings_.redis_component).GetClient(settings_.db)),
+      subscribe_client_(
+          context.FindComponent<components::Redis>(settings_.redis_component).GetSubscribeClient(settings_.subscribe_db)
+      ),
+      keyspace_events_(settings_.max_pending_keys) {
+    // Subscribe before the first full update, so that the changes made during
+    // it are re-read by the next incremental update
+    keyspace_events_.Subscribe(*subscribe_client_, RedisCacheTraits::kKeyPattern);
+
+    this->StartPeriodicUpdates();
+}
+
+template <class RedisCacheTraits>
+RedisCache<RedisCacheTraits>::~RedisCache() {
+    this->StopPeriodicUpdates();
+    keyspace_events_.Unsubscribe();
+}
+
+template <class RedisCacheTraits>
+void RedisCache<RedisCacheTraits>::Update(
+    cache::UpdateType type,
+    const std::chrono::system_clock::time_point& /*last_update*/,
+    const std::chrono::system_clock::time_point& /*now*/,
+    cache::UpdateStatisticsScope& stats_scope
+) {
+    auto changes = keyspace_events_.TakeChanges();
+    if (type == cache::UpdateType::kFull || changes.overflow) {
+        if (changes.overflow) {
+            LOG_WARNING() << "Too many changed keys in cache " << kName << ", falling back to a full update";
+        }
+        FullUpdate(stats_scope);
+    } else {
+        IncrementalUpdate(std::move(changes.keys), stats_scope);
+    }
+}
+
+template <class RedisCacheTraits>
+void RedisCache<RedisCacheTraits>::FullUpdate(cache::UpdateStatisticsScope& stats_scope) {
+    auto scope = tracing::Span::CurrentSpan().CreateScopeTime("scan");
+    storages::redis::ScanOptions options{
+        storages::redis::ScanOptions::Match{std::string{RedisCacheTraits::kKeyPattern}},
+        storages::redis::ScanOptions::Count{settings_.scan_count},
+        storages::redis::ScanOptions::Type{"hash"}};
+    const auto keys = client_->ScanAllShards(std::move(options), settings_.scan_parallel_shards, {}).GetAll();
+
+    scope.Reset("fetch_and_parse");
+    auto new_cache = std::make_unique<DataType>();
+    FetchHashes(keys, stats_scope, [&new_cache](const std::string& key, auto&& object) {
+        if (object) (*new_cache)[key] = std::move(*object);
+    });
+
+    scope.Reset();
+    const auto size = new_cache->size();
+    this->Set(std::move(new_cache));
+    stats_scope.Finish(size);
+}
+
+template <class RedisCacheTraits>
+void RedisCache<RedisCacheTraits>::IncrementalUpdate(
+    std::unordered_set<std::string>&& keys,
+    cache::UpdateStatisticsScope& stats_scope
+) {
+    if (keys.empty()) {
+        stats_scope.FinishNoChanges();
+        return;
+    }
+
+    auto scope = tracing::Span::CurrentSpan().CreateScopeTime("copy_data");
+    const auto old_cache = this->Get();
+    auto new_cache = std::make_unique<DataType>(*old_cache);
+
+    scope.Reset("fetch_and_parse");
+    FetchHashes(keys, stats_scope, [&new_cache](const std::string& key, auto&& object) {
+        if (object) {
+            (*new_cache)[key] = std::move(*object);
+        } else {
+            new_cache->erase(key);
+        }
+    });
+
+    scope.Reset();
+    const auto size = new_cache->size();
+    this->Set(std::move(new_cache));
+    stats_scope.Finish(size);
+}
+
+template <class RedisCacheTraits>
+template <typename Keys, typename Apply>
+void RedisCache<RedisCacheTraits>::FetchHashes(
+    const Keys& keys,
+    cache::UpdateStatisticsScope& stats_scope,
+    Apply apply
+) {
+    std::vector<std::pair<const std::string*, storages::redis::RequestHgetall>> requests;
+    requests.reserve(settings_.fetch_batch_size);
+
+    const auto flush = [&] {
+        for (auto& [key, request] : requests) {
+            auto fields = request.Get();
+            stats_scope.IncreaseDocumentsReadCount(1);
+
+            std::optional<typename RedisCacheTraits::ObjectType> object;
+            // HGETALL of a missing key returns an empty hash
+            if (!fields.empty()) {
+                try {
+                    object.emplace(RedisCacheTraits::DeserializeObject(*key, std::move(fields)));
+                } catch (const std::exception& e) {
+                    LOG_LIMITED_ERROR() << "Failed to deserialize cache item of cache " << kName << ", key=" << *key
+                                        << ", what(): " << e;
+                    stats_scope.IncreaseDocumentsParseFailures(1);
+
+                    if (!RedisCacheTraits::kAreInvalidDocumentsSkipped) throw;
+                    continue;
+                }
+            }
+            apply(*key, std::move(object));
+        }
+        requests.clear();
+    };
+
+    for (const auto& key : keys) {
+        requests.emplace_back(&key, client_->Hgetall(key, {}));
+        if (requests.size() >= settings_.fetch_batch_size) flush();
+    }
+    flush();
+}
+
+template <class RedisCacheTraits>
+yaml_config::Schema RedisCache<RedisCacheTraits>::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<CachingComponentBase<DataType>>(impl::GetRedisCacheSchema());
+}
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
@@ -56,11 +56,15 @@ struct CommandsBufferingSettings {
     bool buffering_enabled{false};
     size_t commands_buffering_threshold{0};
     std::chrono::microseconds watch_command_timer_interval{0};
+    /// Limit of the commands sent to an instance and waiting for the replies,
+    /// the rest wait in the client queue. 0 means unlimited.
+    size_t max_in_flight_commands{0};
 
     constexpr bool operator==(const CommandsBufferingSettings& o) const {
         return buffering_enabled == o.buffering_enabled &&
                commands_buffering_threshold == o.commands_buffering_threshold &&
-               watch_command_timer_interval == o.watch_command_timer_interval;
+               watch_command_timer_interval == o.watch_command_timer_interval &&
+               max_in_flight_commands == o.max_in_flight_commands;
     }
 };
 
@@ -139,6 +143,18 @@ struct PublishSettings {
     storages::redis::CommandControl::Strategy strategy{storages::redis::CommandControl::Strategy::kDefault};
 };
 
+/// Client-side caching of GET and HGET replies, the servers invalidate the
+/// cached keys via RESP3 CLIENT TRACKING
+struct NearCacheSettings {
+    /// Limit of the cached keys and values size, 0 disables the cache
+    size_t max_size_bytes{0};
+    /// Track the keys by prefixes (BCAST mode) instead of the keys read by
+    /// the connection, saves memory of the servers
+    bool broadcast{false};
+    /// Prefixes of the keys to track in broadcast mode, all the keys if empty
+    std::vector<std::string> broadcast_prefixes;
+};
+
 }  // namespace storages::redis
 
 USERVER_NAMESPACE_END
@@ -36,6 +36,12 @@ enum class PubShard {
 /// ## Example usage:
 ///
 /// @snippet storages/redis/client_redistest.cpp  Sample Redis Client usage
+///
+/// In cluster mode the keys of Del, Unlink, Mget and Mset may belong to
+/// different hash slots: the command is split by slots, the parts are sent
+/// to their shards concurrently and the results are merged in the order of the
+/// keys. Mset is not atomic in that case. If some of the parts fail, the
+/// exception message tells how many of them.
 class Client {
 public:
     virtual ~Client() = default;
@@ -76,6 +82,9 @@ public:
 
     virtual RequestUnlink Unlink(std::vector<std::string> keys, const CommandControl& command_control) = 0;
 
+    /// @brief Runs the Lua script. Once the script is loaded on the shard, it
+    /// is sent as EVALSHA with the SHA1 digest instead of the script text. The
+    /// script text is resent automatically if the server replies NOSCRIPT.
     template <typename ScriptResult, typename ReplyType = ScriptResult>
     RequestEval<ScriptResult, ReplyType> Eval(
         std::string script,
@@ -280,6 +289,15 @@ public:
 
     virtual RequestScan Scan(size_t shard, ScanOptions options, const CommandControl& command_control) = 0;
 
+    /// @brief Scans the keys of all the shards, up to `parallel_shards` of
+    /// them at a time. Each scanned shard has at most one page of the keys
+    /// buffered and one more page requested, the next page is requested only
+    /// after the keys of the previous one are taken, so a slow consumer does
+    /// not make the client buffer the whole keyspace. The keys are returned
+    /// shard by shard.
+    virtual RequestScan
+    ScanAllShards(ScanOptions options, size_t parallel_shards, const CommandControl& command_control) = 0;
+
     virtual RequestScard Scard(std::string key, const CommandControl& command_control) = 0;
 
     virtual RequestSet Set(std::string key, std::string value, const CommandControl& command_control) = 0;
@@ -81,6 +81,12 @@ struct CommandControl {
 
         /// Send requests to 'best_dc_count' Redis instances with the min ping
         kNearestServerPing,
+
+        /// Send requests to the instance with the least expected latency: the
+        /// moving average of its reply time multiplied by the number of the
+        /// requests in flight. Slow instances are avoided right away, without
+        /// waiting for the next ping.
+        kLeastLoaded,
     };
 
     /// Timeout for a single attempt to execute command
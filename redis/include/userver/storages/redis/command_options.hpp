@@ -139,8 +139,24 @@ public:
 
     std::optional<Match> ExtractMatch() { return std::move(pattern_); }
 
+    /// Server-side filter by the value type, e.g. "string" or "hash".
+    /// Only SCAN supports it.
+    class Type {
+    public:
+        explicit Type(std::string value) : value_(std::move(value)) {}
+
+        const std::string& Get() const& { return value_; }
+
+        std::string Get() && { return std::move(value_); }
+
+    private:
+        std::string value_;
+    };
+
     std::optional<Count> ExtractCount() { return std::move(count_); }
 
+    std::optional<Type> ExtractType() { return std::move(type_); }
+
 private:
     void Apply(Match pattern) {
         if (pattern_) throw InvalidArgumentException("duplicate Match parameter");
@@ -152,8 +168,14 @@ private:
         count_ = count;
     }
 
+    void Apply(Type type) {
+        if (type_) throw InvalidArgumentException("duplicate Type parameter");
+        type_ = std::move(type);
+    }
+
     std::optional<Match> pattern_;
     std::optional<Count> count_;
+    std::optional<Type> type_;
 };
 
 // strong typedef
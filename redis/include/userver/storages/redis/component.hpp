@@ -65,6 +65,9 @@ namespace components {
 /// groups.[].db | name to refer to the cluster in components::Redis::GetClient() | -
 /// groups.[].sharding_strategy | one of RedisCluster, KeyShardCrc32, KeyShardTaximeterCrc32 or KeyShardGpsStorageDriver | "KeyShardTaximeterCrc32"
 /// groups.[].allow_reads_from_master | allows read requests from master instance | false
+/// groups.[].near_cache.max_size_bytes | size of the client-side cache of GET and HGET replies, needs hiredis 1.0+ | 0
+/// groups.[].near_cache.broadcast | track the keys by prefixes (CLIENT TRACKING BCAST) instead of the keys read | false
+/// groups.[].near_cache.broadcast_prefixes | prefixes of the keys to track in broadcast mode, all if empty | -
 /// subscribe_groups | array of redis clusters to work with in subscribe mode | -
 /// subscribe_groups.[].config_name | key name in secdist with options for this cluster | -
 /// subscribe_groups.[].db | name to refer to the cluster in components::Redis::GetSubscribeClient() | -
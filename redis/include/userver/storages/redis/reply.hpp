@@ -120,6 +120,7 @@ public:
     ReplyData(int value);
     static ReplyData CreateError(std::string&& error_msg);
     static ReplyData CreateStatus(std::string&& status_msg);
+    static ReplyData CreateInteger(int64_t value);
     static ReplyData CreateNil();
 
     explicit operator bool() const { return type_ != Type::kNoReply; }
@@ -26,6 +26,12 @@ namespace storages::redis {
 /// after the execution of callback for previous message has finished. For
 /// parallel message processing use the utils::Async().
 ///
+/// All the subscriptions to the same channel or pattern made through one
+/// client share a single server subscription, and each received message is
+/// copied once for all of them. `Ssubscribe()` uses Redis 7 sharded pub/sub:
+/// the channel is subscribed on the shard that owns its hash slot, and the
+/// messages are published there by Client::Spublish().
+///
 /// @warning Messages can be received in any order due to Redis sharding.
 /// Sometimes messages can be duplicated due to subscriptions rebalancing.
 /// Some messages may be lost (it's a Redis limitation).
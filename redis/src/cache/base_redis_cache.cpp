@@ -0,0 +1,127 @@
+#include <userver/cache/base_redis_cache.hpp>
+
+#include <userver/components/component_config.hpp>
+#include <userver/storages/redis/exception.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components::impl {
+
+namespace {
+
+constexpr std::string_view kKeyspaceChannelPrefix = "__keyspace@";
+constexpr std::string_view kKeyspaceChannelDbSuffix = "__:";
+
+}  // namespace
+
+RedisCacheSettings ParseRedisCacheSettings(const ComponentConfig& config) {
+    RedisCacheSettings settings;
+    settings.redis_component = config["redis-component"].As<std::string>(components::Redis::kName);
+    settings.db = config["db"].As<std::string>();
+    settings.subscribe_db = config["subscribe-db"].As<std::string>();
+    settings.max_pending_keys = config["max-pending-keys"].As<std::size_t>(100000);
+    settings.scan_count = config["scan-count"].As<std::size_t>(1000);
+    settings.scan_parallel_shards = config["scan-parallel-shards"].As<std::size_t>(1);
+    settings.fetch_batch_size = config["fetch-batch-size"].As<std::size_t>(100);
+
+    if (!settings.scan_parallel_shards || !settings.fetch_batch_size) {
+        throw storages::redis::InvalidArgumentException(
+            "scan-parallel-shards and fetch-batch-size of a Redis cache must be positive"
+        );
+    }
+    return settings;
+}
+
+std::string GetRedisCacheSchema() {
+    return R"(
+type: object
+description: Base class for the caches that mirror Redis hashes
+additionalProperties: false
+properties:
+    redis-component:
+        type: string
+        description: name of the components::Redis component
+        defaultDescription: redis
+    db:
+        type: string
+        description: name of the Redis group to read the hashes from
+    subscribe-db:
+        type: string
+        description: name of the Redis subscribe group to listen to the keyspace notifications
+    max-pending-keys:
+        type: integer
+        description: changed keys kept between the updates, a full update is done on overflow
+        defaultDescription: 100000
+        minimum: 1
+    scan-count:
+        type: integer
+        description: COUNT of the SCAN commands of a full update
+        defaultDescription: 1000
+        minimum: 1
+    scan-parallel-shards:
+        type: integer
+        description: shards scanned in parallel on a full update
+        defaultDescription: 1
+        minimum: 1
+    fetch-batch-size:
+        type: integer
+        description: HGETALL commands sent at once
+        defaultDescription: 100
+        minimum: 1
+)";
+}
+
+std::optional<std::string> KeyFromKeyspaceChannel(std::string_view channel) {
+    if (channel.substr(0, kKeyspaceChannelPrefix.size()) != kKeyspaceChannelPrefix) return std::nullopt;
+    channel.remove_prefix(kKeyspaceChannelPrefix.size());
+
+    // the database index contains no '_'
+    const auto pos = channel.find(kKeyspaceChannelDbSuffix);
+    if (pos == std::string_view::npos) return std::nullopt;
+    return std::string{channel.substr(pos + kKeyspaceChannelDbSuffix.size())};
+}
+
+RedisCacheKeyspaceEvents::RedisCacheKeyspaceEvents(std::size_t max_pending_keys)
+    : max_pending_keys_(max_pending_keys) {}
+
+void RedisCacheKeyspaceEvents::Subscribe(
+    storages::redis::SubscribeClient& subscribe_client,
+    std::string_view key_pattern
+) {
+    std::string pattern{kKeyspaceChannelPrefix};
+    pattern += '*';
+    pattern += kKeyspaceChannelDbSuffix;
+    pattern += key_pattern;
+
+    token_ = subscribe_client.Psubscribe(
+        std::move(pattern),
+        [this](const std::string& /*pattern*/, const std::string& channel, const std::string& /*message*/) {
+            OnMessage(channel);
+        }
+    );
+}
+
+void RedisCacheKeyspaceEvents::Unsubscribe() { token_.Unsubscribe(); }
+
+void RedisCacheKeyspaceEvents::OnMessage(std::string_view channel) {
+    auto key = KeyFromKeyspaceChannel(channel);
+    if (!key) return;
+
+    auto changes = changes_.Lock();
+    if (changes->overflow) return;
+    if (changes->keys.size() >= max_pending_keys_) {
+        changes->keys.clear();
+        changes->overflow = true;
+        return;
+    }
+    changes->keys.insert(std::move(*key));
+}
+
+RedisCacheKeyspaceEvents::Changes RedisCacheKeyspaceEvents::TakeChanges() {
+    auto changes = changes_.Lock();
+    return std::exchange(*changes, Changes{});
+}
+
+}  // namespace components::impl
+
+USERVER_NAMESPACE_END
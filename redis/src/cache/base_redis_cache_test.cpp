@@ -0,0 +1,51 @@
+#include <userver/cache/base_redis_cache.hpp>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+using components::impl::KeyFromKeyspaceChannel;
+using components::impl::RedisCacheKeyspaceEvents;
+
+TEST(RedisCache, KeyFromKeyspaceChannel) {
+    EXPECT_EQ(KeyFromKeyspaceChannel("__keyspace@0__:example:1"), "example:1");
+    EXPECT_EQ(KeyFromKeyspaceChannel("__keyspace@15__:a__:b"), "a__:b");
+    EXPECT_EQ(KeyFromKeyspaceChannel("__keyspace@0__:"), "");
+    EXPECT_EQ(KeyFromKeyspaceChannel("__keyevent@0__:hset"), std::nullopt);
+    EXPECT_EQ(KeyFromKeyspaceChannel("example:1"), std::nullopt);
+}
+
+UTEST(RedisCache, KeyspaceEvents) {
+    RedisCacheKeyspaceEvents events{3};
+    events.OnMessage("__keyspace@0__:a");
+    events.OnMessage("__keyspace@0__:b");
+    events.OnMessage("__keyspace@0__:a");
+    events.OnMessage("__keyevent@0__:hset");
+
+    auto changes = events.TakeChanges();
+    EXPECT_FALSE(changes.overflow);
+    EXPECT_EQ(changes.keys, (std::unordered_set<std::string>{"a", "b"}));
+
+    changes = events.TakeChanges();
+    EXPECT_FALSE(changes.overflow);
+    EXPECT_TRUE(changes.keys.empty());
+}
+
+UTEST(RedisCache, KeyspaceEventsOverflow) {
+    RedisCacheKeyspaceEvents events{2};
+    events.OnMessage("__keyspace@0__:a");
+    events.OnMessage("__keyspace@0__:b");
+    events.OnMessage("__keyspace@0__:c");
+    events.OnMessage("__keyspace@0__:d");
+
+    auto changes = events.TakeChanges();
+    EXPECT_TRUE(changes.overflow);
+    EXPECT_TRUE(changes.keys.empty());
+
+    events.OnMessage("__keyspace@0__:e");
+    changes = events.TakeChanges();
+    EXPECT_FALSE(changes.overflow);
+    EXPECT_EQ(changes.keys, (std::unordered_set<std::string>{"e"}));
+}
+
+USERVER_NAMESPACE_END
@@ -101,14 +101,34 @@ UTEST_F(RedisClusterClientTest, DISABLED_MgetCrossSlot) {
     }
 
     {
-        auto req = client->Mget({MakeKey(idx[0]), MakeKey(idx[1])}, kDefaultCc);
-        UASSERT_THROW(req.Get(), storages::redis::ParseReplyException);
+        auto req = client->Mget({MakeKey(idx[1]), "non_existing_key", MakeKey(idx[0])}, kDefaultCc);
+        const auto values = req.Get();
+        ASSERT_EQ(values.size(), 3);
+        EXPECT_EQ(values[0], std::to_string(add + idx[1]));
+        EXPECT_FALSE(values[1]);
+        EXPECT_EQ(values[2], std::to_string(add + idx[0]));
     }
 
-    for (unsigned long i : idx) {
-        auto req = client->Del(MakeKey(i), kDefaultCc);
-        EXPECT_EQ(req.Get(), 1);
+    auto req = client->Del({MakeKey(idx[0]), MakeKey(idx[1])}, kDefaultCc);
+    EXPECT_EQ(req.Get(), 2);
+}
+
+UTEST_F(RedisClusterClientTest, DISABLED_MsetCrossShard) {
+    auto client = GetClient();
+
+    size_t idx[2] = {0, 1};
+    auto shard = client->ShardByKey(MakeKey(idx[0]));
+    while (client->ShardByKey(MakeKey(idx[1])) == shard) ++idx[1];
+
+    UASSERT_NO_THROW(client->Mset({{MakeKey(idx[0]), "value0"}, {MakeKey(idx[1]), "value1"}}, kDefaultCc).Get());
+
+    for (size_t i = 0; i < 2; ++i) {
+        auto req = client->Get(MakeKey(idx[i]), kDefaultCc);
+        EXPECT_EQ(req.Get(), "value" + std::to_string(i));
     }
+
+    auto req = client->Unlink({MakeKey(idx[0]), MakeKey(idx[1]), "non_existing_key"}, kDefaultCc);
+    EXPECT_EQ(req.Get(), 2);
 }
 
 UTEST_F(RedisClusterClientTest, DISABLED_Transaction) {
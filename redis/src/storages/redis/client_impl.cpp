@@ -1,7 +1,13 @@
 #include "client_impl.hpp"
 
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+
 #include <userver/utils/assert.hpp>
 
+#include <storages/redis/impl/keyshard_impl.hpp>
+#include <storages/redis/impl/script_cache.hpp>
 #include <storages/redis/impl/sentinel.hpp>
 
 #include "impl/command_control_impl.hpp"
@@ -37,6 +43,27 @@ void DoCheckShard(size_t shard, std::optional<size_t> force_shard_idx) {
         );
 }
 
+// Positions of the arguments grouped by the cluster hash slot of their keys.
+// Groups are limited by max_chunk_size, 0 means no limit.
+template <typename T, typename GetKey>
+std::vector<std::vector<size_t>> GroupBySlots(const std::vector<T>& args, size_t max_chunk_size, GetKey get_key) {
+    if (max_chunk_size == 0) max_chunk_size = std::numeric_limits<size_t>::max();
+
+    std::unordered_map<size_t, size_t> slot_to_group;
+    std::vector<std::vector<size_t>> groups;
+    for (size_t i = 0; i < args.size(); ++i) {
+        auto [it, inserted] = slot_to_group.try_emplace(impl::HashSlot(get_key(args[i])), groups.size());
+        if (!inserted && groups[it->second].size() >= max_chunk_size) it->second = groups.size();
+        if (it->second == groups.size()) groups.emplace_back();
+        groups[it->second].push_back(i);
+    }
+    return groups;
+}
+
+const std::string& GetKey(const std::string& key) { return key; }
+
+const std::string& GetPairKey(const std::pair<std::string, std::string>& key_value) { return key_value.first; }
+
 }  // namespace
 
 ClientImpl::ClientImpl(std::shared_ptr<impl::Sentinel> sentinel, std::optional<size_t> force_shard_idx)
@@ -68,7 +95,11 @@ Request<ScanReplyTmpl<ScanTag::kScan>> ClientImpl::MakeScanRequestNoKey(
     const CommandControl& command_control
 ) {
     CmdArgs cmd_args{
-        kScanCommandName<ScanTag::kScan>, cursor.GetValue(), options.ExtractMatch(), options.ExtractCount()};
+        kScanCommandName<ScanTag::kScan>,
+        cursor.GetValue(),
+        options.ExtractMatch(),
+        options.ExtractCount(),
+        options.ExtractType()};
     return CreateRequest<Request<ScanReplyTmpl<ScanTag::kScan>>>(
         MakeRequest(std::move(cmd_args), shard, false, GetCommandControl(command_control))
     );
@@ -82,6 +113,7 @@ Request<ScanReplyTmpl<scan_tag>> ClientImpl::MakeScanRequestWithKey(
     ScanOptionsTmpl<scan_tag> options,
     const CommandControl& command_control
 ) {
+    if (options.ExtractType()) throw InvalidArgumentException("Type parameter is supported only by SCAN");
     CmdArgs cmd_args{
         kScanCommandName<scan_tag>, std::move(key), cursor.GetValue(), options.ExtractMatch(), options.ExtractCount()};
     return CreateRequest<Request<ScanReplyTmpl<scan_tag>>>(
@@ -137,6 +169,16 @@ RequestDel ClientImpl::Del(std::string key, const CommandControl& command_contro
 
 RequestDel ClientImpl::Del(std::vector<std::string> keys, const CommandControl& command_control) {
     if (keys.empty()) return CreateDummyRequest<RequestDel>(std::make_shared<Reply>("del", 0));
+    if (IsSlotSplitNeeded(command_control)) {
+        auto groups = GroupBySlots(keys, 0, GetKey);
+        if (groups.size() > 1) {
+            const auto keys_count = keys.size();
+            auto requests = MakeSlotSplitRequests(
+                "del", std::move(keys), groups, GetKey, true, GetCommandControl(command_control)
+            );
+            return CreateSlotSplitRequest<RequestDel>(std::move(requests), std::move(groups), keys_count);
+        }
+    }
     auto shard = ShardByKey(keys.at(0), command_control);
     return CreateRequest<RequestDel>(
         MakeRequest(CmdArgs{"del", std::move(keys)}, shard, true, GetCommandControl(command_control))
@@ -152,6 +194,16 @@ RequestUnlink ClientImpl::Unlink(std::string key, const CommandControl& command_
 
 RequestUnlink ClientImpl::Unlink(std::vector<std::string> keys, const CommandControl& command_control) {
     if (keys.empty()) return CreateDummyRequest<RequestUnlink>(std::make_shared<Reply>("unlink", 0));
+    if (IsSlotSplitNeeded(command_control)) {
+        auto groups = GroupBySlots(keys, 0, GetKey);
+        if (groups.size() > 1) {
+            const auto keys_count = keys.size();
+            auto requests = MakeSlotSplitRequests(
+                "unlink", std::move(keys), groups, GetKey, true, GetCommandControl(command_control)
+            );
+            return CreateSlotSplitRequest<RequestUnlink>(std::move(requests), std::move(groups), keys_count);
+        }
+    }
     auto shard = ShardByKey(keys.at(0), command_control);
     return CreateRequest<RequestUnlink>(
         MakeRequest(CmdArgs{"unlink", std::move(keys)}, shard, true, GetCommandControl(command_control))
@@ -167,12 +219,43 @@ RequestEvalCommon ClientImpl::EvalCommon(
     UASSERT(!keys.empty());
     auto shard = ShardByKey(keys.at(0), command_control);
     size_t keys_size = keys.size();
-    return CreateRequest<RequestEvalCommon>(MakeRequest(
-        CmdArgs{"eval", std::move(script), keys_size, std::move(keys), std::move(args)},
-        shard,
-        true,
-        GetCommandControl(command_control)
-    ));
+    const auto& script_cache = redis_client_->GetScriptCache();
+    auto script_info = script_cache->Get(script);
+    if (!script_info) {
+        script_cache->AccountEval();
+        return CreateRequest<RequestEvalCommon>(MakeRequest(
+            CmdArgs{"eval", std::move(script), keys_size, std::move(keys), std::move(args)},
+            shard,
+            true,
+            GetCommandControl(command_control)
+        ));
+    }
+
+    auto cc = GetCommandControl(command_control);
+    if (!script_info->IsLoaded(shard)) {
+        script_cache->AccountEval();
+        return CreateEvalRequest<RequestEvalCommon>(
+            MakeRequest(
+                CmdArgs{"eval", std::move(script), keys_size, std::move(keys), std::move(args)}, shard, true, cc
+            ),
+            script_cache,
+            std::move(script_info),
+            shard
+        );
+    }
+
+    script_cache->AccountEvalSha();
+    auto request = MakeRequest(CmdArgs{"evalsha", script_info->GetSha(), keys_size, keys, args}, shard, true, cc);
+    // keys and args are kept to resend the script text on NOSCRIPT
+    auto fallback =
+        [self = shared_from_this(), script_info, keys = std::move(keys), args = std::move(args), shard, cc] {
+            self->redis_client_->GetScriptCache()->AccountEval();
+            const size_t keys_size = keys.size();
+            return self->MakeRequest(CmdArgs{"eval", script_info->GetText(), keys_size, keys, args}, shard, true, cc);
+        };
+    return CreateEvalRequest<RequestEvalCommon>(
+        std::move(request), script_cache, std::move(script_info), shard, std::move(fallback)
+    );
 }
 
 RequestEvalShaCommon ClientImpl::EvalShaCommon(
@@ -347,6 +430,16 @@ RequestGeosearch ClientImpl::Geosearch(
 
 RequestGet ClientImpl::Get(std::string key, const CommandControl& command_control) {
     auto shard = ShardByKey(key, command_control);
+    if (const auto& near_cache = redis_client_->GetNearCache()) {
+        if (auto cached = near_cache->Get(key, std::nullopt)) {
+            return CreateDummyRequest<RequestGet>(std::make_shared<Reply>("get", *std::move(cached)));
+        }
+        auto fetch = near_cache->StartFetch(key, std::nullopt);
+        return CreateNearCacheRequest<RequestGet>(
+            MakeRequest(CmdArgs{"get", std::move(key)}, shard, false, GetCommandControl(command_control)),
+            std::move(fetch)
+        );
+    }
     return CreateRequest<RequestGet>(
         MakeRequest(CmdArgs{"get", std::move(key)}, shard, false, GetCommandControl(command_control))
     );
@@ -383,6 +476,18 @@ RequestHexists ClientImpl::Hexists(std::string key, std::string field, const Com
 
 RequestHget ClientImpl::Hget(std::string key, std::string field, const CommandControl& command_control) {
     auto shard = ShardByKey(key, command_control);
+    if (const auto& near_cache = redis_client_->GetNearCache()) {
+        if (auto cached = near_cache->Get(key, field)) {
+            return CreateDummyRequest<RequestHget>(std::make_shared<Reply>("hget", *std::move(cached)));
+        }
+        auto fetch = near_cache->StartFetch(key, field);
+        return CreateNearCacheRequest<RequestHget>(
+            MakeRequest(
+                CmdArgs{"hget", std::move(key), std::move(field)}, shard, false, GetCommandControl(command_control)
+            ),
+            std::move(fetch)
+        );
+    }
     return CreateRequest<RequestHget>(
         MakeRequest(CmdArgs{"hget", std::move(key), std::move(field)}, shard, false, GetCommandControl(command_control))
     );
@@ -566,8 +671,18 @@ RequestLtrim ClientImpl::Ltrim(std::string key, int64_t start, int64_t stop, con
 
 RequestMget ClientImpl::Mget(std::vector<std::string> keys, const CommandControl& command_control) {
     if (keys.empty()) return CreateDummyRequest<RequestMget>(std::make_shared<Reply>("mget", ReplyData::Array{}));
-    const auto shard = ShardByKey(keys.at(0), command_control);
     auto max_chunk_size = CommandControlImpl{command_control}.chunk_size;
+    if (IsSlotSplitNeeded(command_control)) {
+        auto groups = GroupBySlots(keys, max_chunk_size, GetKey);
+        if (groups.size() > 1) {
+            const auto keys_count = keys.size();
+            auto requests = MakeSlotSplitRequests(
+                "mget", std::move(keys), groups, GetKey, false, GetCommandControl(command_control)
+            );
+            return CreateSlotSplitRequest<RequestMget>(std::move(requests), std::move(groups), keys_count);
+        }
+    }
+    const auto shard = ShardByKey(keys.at(0), command_control);
     if (max_chunk_size == 0) {
         max_chunk_size = keys.size();
     }
@@ -586,6 +701,16 @@ RequestMset
 ClientImpl::Mset(std::vector<std::pair<std::string, std::string>> key_values, const CommandControl& command_control) {
     if (key_values.empty())
         return CreateDummyRequest<RequestMset>(std::make_shared<Reply>("mset", ReplyData::CreateStatus("OK")));
+    if (IsSlotSplitNeeded(command_control)) {
+        auto groups = GroupBySlots(key_values, 0, GetPairKey);
+        if (groups.size() > 1) {
+            const auto keys_count = key_values.size();
+            auto requests = MakeSlotSplitRequests(
+                "mset", std::move(key_values), groups, GetPairKey, true, GetCommandControl(command_control)
+            );
+            return CreateSlotSplitRequest<RequestMset>(std::move(requests), std::move(groups), keys_count);
+        }
+    }
     auto shard = ShardByKey(key_values.at(0).first, command_control);
     return CreateRequest<RequestMset>(
         MakeRequest(CmdArgs{"mset", std::move(key_values)}, shard, true, GetCommandControl(command_control))
@@ -714,6 +839,27 @@ ClientImpl::Scan(size_t shard, ScanOptionsTmpl<ScanTag::kScan> options, const Co
     ));
 }
 
+ScanRequest<ScanTag::kScan> ClientImpl::ScanAllShards(
+    ScanOptionsTmpl<ScanTag::kScan> options,
+    size_t parallel_shards,
+    const CommandControl& command_control
+) {
+    if (!parallel_shards) throw InvalidArgumentException("parallel_shards must be positive");
+
+    std::vector<size_t> shards;
+    if (force_shard_idx_ || command_control.force_shard_idx) {
+        const auto shard = force_shard_idx_ ? *force_shard_idx_ : *command_control.force_shard_idx;
+        CheckShard(shard, command_control);
+        shards.push_back(shard);
+    } else {
+        shards.resize(ShardsCount());
+        std::iota(shards.begin(), shards.end(), 0);
+    }
+    return ScanRequest<ScanTag::kScan>(std::make_unique<RequestScanAllShardsData>(
+        shared_from_this(), std::move(shards), parallel_shards, std::move(options), command_control
+    ));
+}
+
 template <ScanTag scan_tag>
 ScanRequest<scan_tag>
 ClientImpl::ScanTmpl(std::string key, ScanOptionsTmpl<scan_tag> options, const CommandControl& command_control) {
@@ -1170,6 +1316,31 @@ impl::Request ClientImpl::MakeRequest(
     return redis_client_->MakeRequest(std::move(args), shard, master, command_control, replies_to_skip);
 }
 
+template <typename T, typename GetKey>
+std::vector<impl::Request> ClientImpl::MakeSlotSplitRequests(
+    const char* command,
+    std::vector<T>&& args,
+    const std::vector<std::vector<size_t>>& groups,
+    GetKey get_key,
+    bool master,
+    const CommandControl& command_control
+) {
+    std::vector<impl::Request> requests;
+    requests.reserve(groups.size());
+    for (const auto& group : groups) {
+        std::vector<T> group_args;
+        group_args.reserve(group.size());
+        for (const auto pos : group) group_args.push_back(std::move(args[pos]));
+        const auto shard = ShardByKey(get_key(group_args.front()));
+        requests.push_back(MakeRequest(CmdArgs{command, std::move(group_args)}, shard, master, command_control));
+    }
+    return requests;
+}
+
+bool ClientImpl::IsSlotSplitNeeded(const CommandControl& cc) const {
+    return IsInClusterMode() && !force_shard_idx_ && !GetCommandControl(cc).force_shard_idx;
+}
+
 CommandControl ClientImpl::GetCommandControl(const CommandControl& cc) const {
     return redis_client_->GetCommandControl(cc);
 }
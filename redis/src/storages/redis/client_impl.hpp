@@ -261,6 +261,9 @@ public:
 
     ScanRequest<ScanTag::kScan> Scan(size_t shard, ScanOptions options, const CommandControl& command_control) override;
 
+    ScanRequest<ScanTag::kScan>
+    ScanAllShards(ScanOptions options, size_t parallel_shards, const CommandControl& command_control) override;
+
     template <ScanTag scan_tag>
     ScanRequest<scan_tag>
     ScanTmpl(std::string key, ScanOptionsTmpl<scan_tag> options, const CommandControl& command_control);
@@ -456,6 +459,20 @@ private:
         return requests;
     }
 
+    /// Makes a request for each group of the argument positions, the groups are
+    /// expected to contain the keys of a single cluster hash slot
+    template <typename T, typename GetKey>
+    std::vector<impl::Request> MakeSlotSplitRequests(
+        const char* command,
+        std::vector<T>&& args,
+        const std::vector<std::vector<size_t>>& groups,
+        GetKey get_key,
+        bool master,
+        const CommandControl& command_control
+    );
+
+    bool IsSlotSplitNeeded(const CommandControl& cc) const;
+
     CommandControl GetCommandControl(const CommandControl& cc) const;
 
     size_t GetPublishShard(PubShard policy, const PublishSettings& settings);
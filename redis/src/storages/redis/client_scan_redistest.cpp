@@ -137,4 +137,26 @@ TYPED_UTEST(RedisClientScanTest, Scan) {
     EXPECT_EQ(actual, expected);
 }
 
+UTEST_F(RedisClientTest, ScanAllShardsType) {
+    auto client = GetClient();
+    for (int i = 0; i < 100; i++) {
+        client->Set("string:" + std::to_string(i), "value", {}).Get();
+        client->Hset("hash:" + std::to_string(i), "field", "value", {}).Get();
+    }
+
+    using Options = storages::redis::ScanOptions;
+    auto actual = client->ScanAllShards(Options{Options::Type{"hash"}, Options::Count{10}}, 2, {}).GetAll();
+    std::sort(actual.begin(), actual.end());
+
+    std::vector<std::string> expected;
+    for (int i = 0; i < 100; i++) expected.push_back("hash:" + std::to_string(i));
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(actual, expected);
+
+    UEXPECT_THROW(
+        client->Hscan("hash:0", storages::redis::HscanOptions{Options::Type{"hash"}}, {}),
+        storages::redis::InvalidArgumentException
+    );
+}
+
 USERVER_NAMESPACE_END
@@ -62,7 +62,8 @@ constexpr utils::TrivialBiMap kToStrategy = [](auto selector) {
         .Case("every_dc", CommandControl::Strategy::kEveryDc)
         .Case("default", CommandControl::Strategy::kDefault)
         .Case("local_dc_conductor", CommandControl::Strategy::kLocalDcConductor)
-        .Case("nearest_server_ping", CommandControl::Strategy::kNearestServerPing);
+        .Case("nearest_server_ping", CommandControl::Strategy::kNearestServerPing)
+        .Case("least_loaded", CommandControl::Strategy::kLeastLoaded);
 };
 
 }  // namespace
@@ -27,6 +27,7 @@
 #include <userver/storages/redis/subscribe_client.hpp>
 
 #include <storages/redis/impl/keyshard_impl.hpp>
+#include <storages/redis/impl/near_cache.hpp>
 #include <storages/redis/impl/sentinel.hpp>
 #include <storages/redis/impl/subscribe_sentinel.hpp>
 
@@ -65,6 +66,7 @@ struct RedisGroup {
     std::string config_name;
     std::string sharding_strategy;
     bool allow_reads_from_master{false};
+    storages::redis::NearCacheSettings near_cache;
 };
 
 RedisGroup Parse(const yaml_config::YamlConfig& value, formats::parse::To<RedisGroup>) {
@@ -73,6 +75,10 @@ RedisGroup Parse(const yaml_config::YamlConfig& value, formats::parse::To<RedisG
     config.config_name = value["config_name"].As<std::string>();
     config.sharding_strategy = value["sharding_strategy"].As<std::string>("");
     config.allow_reads_from_master = value["allow_reads_from_master"].As<bool>(false);
+    const auto near_cache = value["near_cache"];
+    config.near_cache.max_size_bytes = near_cache["max_size_bytes"].As<size_t>(0);
+    config.near_cache.broadcast = near_cache["broadcast"].As<bool>(false);
+    config.near_cache.broadcast_prefixes = near_cache["broadcast_prefixes"].As<std::vector<std::string>>({});
     return config;
 }
 
@@ -205,6 +211,16 @@ void Redis::Connect(
         storages::redis::CommandControl cc{};
         cc.allow_reads_from_master = redis_group.allow_reads_from_master;
 
+        std::shared_ptr<storages::redis::impl::NearCache> near_cache;
+        if (redis_group.near_cache.max_size_bytes != 0) {
+            if (storages::redis::impl::NearCache::IsSupported()) {
+                near_cache = std::make_shared<storages::redis::impl::NearCache>(redis_group.near_cache);
+            } else {
+                LOG_ERROR() << "near_cache of redis group " << redis_group.db
+                            << " requires hiredis 1.0+ with RESP3 support, the cache is disabled";
+            }
+        }
+
         auto sentinel = storages::redis::impl::Sentinel::CreateSentinel(
             thread_pools_,
             settings,
@@ -213,7 +229,8 @@ void Redis::Connect(
             redis_group.db,
             storages::redis::impl::KeyShardFactory{redis_group.sharding_strategy},
             cc,
-            testsuite_redis_control
+            testsuite_redis_control,
+            std::move(near_cache)
         );
         if (sentinel) {
             sentinels_.emplace(redis_group.db, sentinel);
@@ -386,6 +403,25 @@ properties:
                     type: boolean
                     description: allows read requests from master instance
                     defaultDescription: false
+                near_cache:
+                    type: object
+                    description: client-side caching of GET and HGET replies invalidated via RESP3 CLIENT TRACKING
+                    additionalProperties: false
+                    properties:
+                        max_size_bytes:
+                            type: integer
+                            description: limit of the cached keys and values size, 0 disables the cache
+                            defaultDescription: 0
+                        broadcast:
+                            type: boolean
+                            description: track the keys by prefixes (BCAST mode) instead of the keys read
+                            defaultDescription: false
+                        broadcast_prefixes:
+                            type: array
+                            description: prefixes of the keys to track in broadcast mode, all the keys if empty
+                            items:
+                                type: string
+                                description: key prefix
     metrics_level:
         type: string
         description: set metrics detail level
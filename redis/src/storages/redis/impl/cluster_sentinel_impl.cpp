@@ -4,7 +4,6 @@
 
 #include <fmt/format.h>
 #include <boost/container_hash/hash.hpp>
-#include <boost/crc.hpp>
 
 #include <userver/concurrent/variable.hpp>
 #include <userver/logging/log.hpp>
@@ -21,6 +20,7 @@
 #include <engine/ev/watcher/async_watcher.hpp>
 #include <engine/ev/watcher/periodic_watcher.hpp>
 #include <storages/redis/impl/cluster_topology.hpp>
+#include <storages/redis/impl/keyshard_impl.hpp>
 #include <storages/redis/impl/redis_connection_holder.hpp>
 #include <storages/redis/impl/sentinel.hpp>
 
@@ -63,13 +63,6 @@ struct NodeAddressesHasher {
 using NodesAddressesSet = std::unordered_set<NodeAddresses, NodeAddressesHasher>;
 using HostPort = std::string;
 
-size_t HashSlot(const std::string& key) {
-    size_t start = 0;
-    size_t len = 0;
-    GetRedisKey(key, &start, &len);
-    return std::for_each(key.data() + start, key.data() + start + len, boost::crc_optimal<16, 0x1021>())() & 0x3fff;
-}
-
 std::string ParseMovedShard(const std::string& err_string) {
     static const auto kUnknownShard = std::string("");
     size_t pos = err_string.find(' ');  // skip "MOVED" or "ASK"
@@ -348,6 +341,12 @@ public:
         }
     }
 
+    /// Must be called before the nodes are created
+    void SetNearCache(std::shared_ptr<NearCache> near_cache) {
+        auto near_cache_ptr = near_cache_.Lock();
+        *near_cache_ptr = std::move(near_cache);
+    }
+
     void SetConnectionInfo(const std::vector<ConnectionInfoInt>& info_array) {
         sentinels_->SetConnectionInfo(info_array);
     }
@@ -428,6 +427,7 @@ private:
     concurrent::Variable<std::optional<CommandsBufferingSettings>, std::mutex> commands_buffering_settings_;
     concurrent::Variable<ReplicationMonitoringSettings, std::mutex> monitoring_settings_;
     concurrent::Variable<utils::RetryBudgetSettings, std::mutex> retry_budget_settings_;
+    concurrent::Variable<std::shared_ptr<NearCache>, std::mutex> near_cache_;
     concurrent::Variable<std::unordered_set<HostPort>, std::mutex> nodes_to_create_;
     concurrent::Variable<std::unordered_set<HostPort>, std::mutex> actual_nodes_;
     // work only from sentinel thread so no need to synchronize it
@@ -659,6 +659,7 @@ std::shared_ptr<RedisConnectionHolder> ClusterTopologyHolder::CreateRedisInstanc
     const auto buffering_settings_ptr = commands_buffering_settings_.Lock();
     const auto replication_monitoring_settings_ptr = monitoring_settings_.Lock();
     const auto retry_budget_settings_ptr = retry_budget_settings_.Lock();
+    const auto near_cache_ptr = near_cache_.Lock();
     LOG_DEBUG() << "Create new redis instance " << host_port;
     return std::make_shared<RedisConnectionHolder>(
         ev_thread_,
@@ -668,7 +669,8 @@ std::shared_ptr<RedisConnectionHolder> ClusterTopologyHolder::CreateRedisInstanc
         GetPassword(),
         buffering_settings_ptr->value_or(CommandsBufferingSettings{}),
         *replication_monitoring_settings_ptr,
-        *retry_budget_settings_ptr
+        *retry_budget_settings_ptr,
+        *near_cache_ptr
     );
 }
 
@@ -1043,6 +1045,12 @@ void ClusterSentinelImpl::SetRetryBudgetSettings(const utils::RetryBudgetSetting
     }
 }
 
+void ClusterSentinelImpl::SetNearCache(std::shared_ptr<NearCache> near_cache) {
+    if (topology_holder_) {
+        topology_holder_->SetNearCache(std::move(near_cache));
+    }
+}
+
 SentinelStatistics ClusterSentinelImpl::GetStatistics(const MetricsSettings& settings) const {
     if (!topology_holder_) {
         return {settings, {}};
@@ -65,6 +65,7 @@ public:
     void SetReplicationMonitoringSettings(const ReplicationMonitoringSettings& replication_monitoring_settings
     ) override;
     void SetRetryBudgetSettings(const utils::RetryBudgetSettings& settings) override;
+    void SetNearCache(std::shared_ptr<NearCache> near_cache) override;
     PublishSettings GetPublishSettings() override;
 
     static size_t GetClusterSlotsCalledCounter();
@@ -19,6 +19,7 @@ bool IsNearestServerPing(const CommandControlImpl& control) {
     switch (control.strategy) {
         case CommandControl::Strategy::kEveryDc:
         case CommandControl::Strategy::kDefault:
+        case CommandControl::Strategy::kLeastLoaded:
             return false;
         case CommandControl::Strategy::kLocalDcConductor:
         case CommandControl::Strategy::kNearestServerPing:
@@ -81,11 +82,18 @@ bool ClusterShard::AsyncCommand(CommandPtr command) const {
         return false;
     }
 
+    const auto is_retry = command->counter != 0;
+    if (cc.strategy == CommandControl::Strategy::kLeastLoaded && !is_retry) {
+        /// the other instances are tried in the usual order below
+        if (const auto instance = GetLeastLoadedServer(cc.allow_reads_from_master); instance) {
+            if (instance->AsyncCommand(command)) return true;
+        }
+    }
+
     const auto current = current_++;
     const auto& available_servers = GetAvailableServers(command->control);
     const auto servers_count = available_servers.size();
     const auto is_nearest_ping_server = IsNearestServerPing(cc);
-    const auto is_retry = command->counter != 0;
 
     const auto masters_count = 1;
     const auto max_attempts = replicas_.size() + masters_count + 1;
@@ -246,6 +254,20 @@ ClusterShard::RedisPtr ClusterShard::GetInstance(
     return ret;
 }
 
+ClusterShard::RedisPtr ClusterShard::GetLeastLoadedServer(bool with_master) const {
+    RedisPtr ret;
+    auto try_instance = [&ret](const RedisConnectionPtr& connection) {
+        if (!connection) return;
+        auto instance = connection->Get();
+        if (!instance || !instance->IsAvailable()) return;
+        if (!ret || instance->GetExpectedLatency() < ret->GetExpectedLatency()) ret = std::move(instance);
+    };
+
+    for (const auto& replica : replicas_) try_instance(replica);
+    if (with_master) try_instance(master_);
+    return ret;
+}
+
 bool ClusterShard::IsMasterReady() const { return master_ && master_->GetState() == Redis::State::kConnected; }
 
 bool ClusterShard::IsReplicaReady() const {
@@ -50,6 +50,8 @@ private:
     /// nullptr
     RedisPtr GetAvailableServer(const CommandControl& command_control, bool read_only) const;
     std::vector<RedisConnectionPtr> GetAvailableServers(const CommandControl& command_control) const;
+    /// Available instance with the least expected latency
+    RedisPtr GetLeastLoadedServer(bool with_master) const;
     static RedisPtr GetInstance(
         const std::vector<RedisConnectionPtr>& instances,
         bool is_retry,
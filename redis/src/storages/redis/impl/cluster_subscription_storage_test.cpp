@@ -12,6 +12,8 @@
 USERVER_NAMESPACE_BEGIN
 
 namespace {
+using SharedMessage = storages::redis::impl::Sentinel::SharedMessage;
+
 storages::redis::ServerId MakeServerId(std::string description) {
     auto ret = storages::redis::ServerId::Generate();
     ret.SetDescription(std::move(description));
@@ -58,19 +60,40 @@ public:
     }
 
     void Subscribe(const std::string& channel_name) {
-        auto message_callback = [](const std::string& /*channel*/, const std::string& /*message*/) {
+        auto message_callback = [](const std::string& /*channel*/, const SharedMessage& /*message*/) {
             return storages::redis::impl::Sentinel::Outcome::kOk;
         };
         auto token = storage_->Subscribe(channel_name, message_callback, {});
         tokens_.push_back(std::move(token));
     }
     void Ssubscribe(const std::string& channel_name) {
-        auto message_callback = [](const std::string& /*channel*/, const std::string& /*message*/) {
+        auto message_callback = [](const std::string& /*channel*/, const SharedMessage& /*message*/) {
             return storages::redis::impl::Sentinel::Outcome::kOk;
         };
         auto token = storage_->Ssubscribe(channel_name, message_callback, {});
         tokens_.push_back(std::move(token));
     }
+    void Ssubscribe(const std::string& channel_name, std::vector<SharedMessage>& messages) {
+        auto message_callback = [&messages](const std::string& /*channel*/, const SharedMessage& message) {
+            messages.push_back(message);
+            return storages::redis::impl::Sentinel::Outcome::kOk;
+        };
+        auto token = storage_->Ssubscribe(channel_name, message_callback, {});
+        tokens_.push_back(std::move(token));
+    }
+    /// Delivers the message to the channels of the not yet processed commands
+    void SendMessage(const std::string& message_type, const std::string& message) {
+        for (auto& cmd : cmds_) {
+            const auto& [command, channel] = cmd->args.GetCommandAndChannel();
+            storages::redis::ReplyData reply_data(storages::redis::ReplyData::Array{
+                storages::redis::ReplyData(message_type),
+                storages::redis::ReplyData(channel),
+                storages::redis::ReplyData(message)});
+            storages::redis::ReplyPtr reply = std::make_shared<storages::redis::Reply>(command, std::move(reply_data));
+            reply->server_id = server_ids[0];
+            cmd->callback({}, reply);
+        }
+    }
     void ProcessCommands() {
         for (auto& cmd : cmds_) {
             const auto& [command, channel] = cmd->args.GetCommandAndChannel();
@@ -86,6 +109,8 @@ public:
 
     void Rebalance(size_t shard) { storage_->DoRebalance(shard, weights); }
 
+    size_t PendingCommandsCount() const { return cmds_.size(); }
+
     const auto& GetSubscriptionsByHost() const { return subscriptions_by_host_; }
     const auto& GetShardedSubscriptionsByHost() const { return ssubscriptions_by_host_; }
 
@@ -180,4 +205,19 @@ TEST_F(SubscriptionTest, Sharded) {
     EXPECT_EQ(expected, subscriptions_by_host);
 }
 
+/// Test local subscribers of a channel share the server subscription and the message
+TEST_F(SubscriptionTest, ShardedSharedMessage) {
+    std::vector<SharedMessage> messages1;
+    std::vector<SharedMessage> messages2;
+    Ssubscribe("channel0", messages1);
+    Ssubscribe("channel0", messages2);
+    EXPECT_EQ(PendingCommandsCount(), 1);
+
+    SendMessage("smessage", "data");
+    ASSERT_EQ(messages1.size(), 1);
+    ASSERT_EQ(messages2.size(), 1);
+    EXPECT_EQ(*messages1[0], "data");
+    EXPECT_EQ(messages1[0], messages2[0]);
+}
+
 USERVER_NAMESPACE_END
@@ -55,6 +55,13 @@ void CmdWithArgs::PutArg(std::optional<ScanOptionsBase::Count> arg) {
     }
 }
 
+void CmdWithArgs::PutArg(std::optional<ScanOptionsBase::Type> arg) {
+    if (arg) {
+        args_.emplace_back("TYPE");
+        args_.emplace_back(std::move(arg)->Get());
+    }
+}
+
 void CmdWithArgs::PutArg(GeoaddArg arg) {
     args_.emplace_back(std::to_string(arg.lon));
     args_.emplace_back(std::to_string(arg.lat));
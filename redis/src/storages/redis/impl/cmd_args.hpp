@@ -135,6 +135,7 @@ private:
 
     void PutArg(std::optional<ScanOptionsBase::Match> arg);
     void PutArg(std::optional<ScanOptionsBase::Count> arg);
+    void PutArg(std::optional<ScanOptionsBase::Type> arg);
     void PutArg(GeoaddArg arg);
     void PutArg(std::vector<GeoaddArg> arg);
     void PutArg(const GeoradiusOptions& arg);
@@ -21,6 +21,13 @@ const std::string kTaximeterCrcKeyEncoding = "WINDOWS-1252//TRANSLIT";
 
 }  // namespace
 
+size_t HashSlot(const std::string& key) {
+    size_t start = 0;
+    size_t len = 0;
+    GetRedisKey(key, &start, &len);
+    return std::for_each(key.data() + start, key.data() + start + len, boost::crc_optimal<16, 0x1021>())() & 0x3fff;
+}
+
 void GetRedisKey(const std::string& key, size_t* key_start, size_t* key_len) {
     // see https://redis.io/topics/cluster-spec
 
@@ -57,6 +57,9 @@ private:
 
 inline constexpr char kRedisCluster[] = "RedisCluster";
 
+/// Redis cluster hash slot of the key, honours the {hash tags}
+size_t HashSlot(const std::string& key);
+
 bool IsClusterStrategy(const std::string& type);
 
 }  // namespace storages::redis::impl
@@ -56,6 +56,18 @@ const std::string kKey =
     "КАЗАХСТАН:Index.КАЗАХСТАН:Index.КАЗАХСТАН:Index.КАЗАХСТАН:Index.КАЗАХСТАН:"
     "Index.КАЗАХСТАН:Index.КАЗАХСТАН:Index.КАЗАХСТАН:";
 
+TEST(KeyShard, HashSlot) {
+    using storages::redis::impl::HashSlot;
+
+    // values from the redis cluster specification and CLUSTER KEYSLOT
+    EXPECT_EQ(HashSlot("123456789"), 12739);
+    EXPECT_EQ(HashSlot("foo"), 12182);
+    EXPECT_EQ(HashSlot("{user1000}.following"), HashSlot("user1000"));
+    EXPECT_EQ(HashSlot("{user1000}.followers"), HashSlot("user1000"));
+    EXPECT_EQ(HashSlot("foo{{bar}}zap"), HashSlot("{bar"));
+    EXPECT_EQ(HashSlot("foo{bar}{zap}"), HashSlot("bar"));
+}
+
 TEST(KeyShardTaximeterCrc32, Multithreads) {
     storages::redis::impl::KeyShardTaximeterCrc32 key_shard(kShards);
 
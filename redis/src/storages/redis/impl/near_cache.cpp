@@ -0,0 +1,167 @@
+#include <storages/redis/impl/near_cache.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#include <hiredis/hiredis.h>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::impl {
+
+namespace {
+
+// Accounts the memory of the LRU node and the hash maps, so that the number
+// of the cached keys is limited even for the empty values
+constexpr size_t kEntryOverheadBytes = 64;
+constexpr size_t kMaxEntries = 1 << 20;
+
+size_t GetMaxEntries(size_t max_size_bytes) {
+    return std::clamp<size_t>(max_size_bytes / kEntryOverheadBytes, 1, kMaxEntries);
+}
+
+size_t GetSize(const ReplyData& data) { return data.IsString() ? data.GetString().size() : 0; }
+
+}  // namespace
+
+NearCache::Fetch::Fetch(std::shared_ptr<NearCache> cache, std::string key, std::optional<std::string> field)
+    : cache_(std::move(cache)), key_(std::move(key)), field_(std::move(field)) {}
+
+NearCache::Fetch::~Fetch() {
+    if (cache_) cache_->FinishFetch(key_, field_, nullptr);
+}
+
+void NearCache::Fetch::Finish(const ReplyPtr& reply) {
+    if (!cache_) return;
+    const auto cache = std::move(cache_);
+    cache->FinishFetch(key_, field_, reply);
+}
+
+NearCache::NearCache(NearCacheSettings settings)
+    : settings_(std::move(settings)), entries_(GetMaxEntries(settings_.max_size_bytes)) {}
+
+bool NearCache::IsSupported() noexcept {
+#ifdef REDIS_REPLY_PUSH
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::optional<ReplyData> NearCache::Get(const std::string& key, const std::optional<std::string>& field) {
+    const std::lock_guard lock(mutex_);
+    if (const auto* entry = entries_.Get(key)) {
+        if (!field && entry->value) {
+            ++stats_.hits;
+            return entry->value;
+        }
+        if (field) {
+            const auto it = entry->fields.find(*field);
+            if (it != entry->fields.end()) {
+                ++stats_.hits;
+                return it->second;
+            }
+        }
+    }
+    ++stats_.misses;
+    return std::nullopt;
+}
+
+NearCache::Fetch NearCache::StartFetch(std::string key, std::optional<std::string> field) {
+    {
+        const std::lock_guard lock(mutex_);
+        ++pending_[key].count;
+    }
+    return Fetch{shared_from_this(), std::move(key), std::move(field)};
+}
+
+void NearCache::Invalidate(const std::vector<std::string>& keys) {
+    const std::lock_guard lock(mutex_);
+    for (const auto& key : keys) {
+        EraseLocked(key);
+        const auto it = pending_.find(key);
+        if (it != pending_.end()) it->second.invalidated = true;
+    }
+    stats_.invalidations += keys.size();
+}
+
+void NearCache::Clear() {
+    const std::lock_guard lock(mutex_);
+    entries_.Clear();
+    size_bytes_ = 0;
+    for (auto& [key, pending] : pending_) pending.invalidated = true;
+    ++stats_.clears;
+}
+
+NearCacheStatistics NearCache::GetStatistics() const {
+    const std::lock_guard lock(mutex_);
+    auto stats = stats_;
+    stats.size_bytes = size_bytes_;
+    stats.keys = entries_.GetSize();
+    return stats;
+}
+
+void NearCache::FinishFetch(const std::string& key, const std::optional<std::string>& field, const ReplyPtr& reply) {
+    const std::lock_guard lock(mutex_);
+    const auto pending_it = pending_.find(key);
+    UASSERT(pending_it != pending_.end());
+    if (pending_it == pending_.end()) return;
+    const bool invalidated = pending_it->second.invalidated;
+    if (--pending_it->second.count == 0) pending_.erase(pending_it);
+
+    if (invalidated || !reply || !reply->IsOk()) return;
+    if (!reply->data.IsString() && !reply->data.IsNil()) return;
+    // values larger than the whole cache would only evict all the other keys
+    const auto value_size = (field ? field->size() : 0) + GetSize(reply->data);
+    if (key.size() + kEntryOverheadBytes + value_size > settings_.max_size_bytes) return;
+
+    auto* entry = entries_.Get(key);
+    if (!entry) {
+        if (entries_.GetSize() >= entries_.GetCapacity()) {
+            EraseLocked(std::string{*entries_.GetLeastUsedKey()});
+        }
+        entries_.Put(key, Entry{std::nullopt, {}, key.size() + kEntryOverheadBytes});
+        entry = entries_.Get(key);
+        size_bytes_ += entry->size_bytes;
+    }
+    if (field) {
+        const auto it = entry->fields.find(*field);
+        if (it != entry->fields.end()) {
+            entry->size_bytes -= it->first.size() + GetSize(it->second);
+            size_bytes_ -= it->first.size() + GetSize(it->second);
+            entry->fields.erase(it);
+        }
+        const auto added = field->size() + GetSize(reply->data);
+        entry->fields.emplace(*field, reply->data);
+        entry->size_bytes += added;
+        size_bytes_ += added;
+    } else {
+        if (entry->value) {
+            entry->size_bytes -= GetSize(*entry->value);
+            size_bytes_ -= GetSize(*entry->value);
+        }
+        entry->value = reply->data;
+        entry->size_bytes += GetSize(reply->data);
+        size_bytes_ += GetSize(reply->data);
+    }
+
+    // the updated key is the most recently used one, so it is dropped last
+    while (size_bytes_ > settings_.max_size_bytes) {
+        const auto* least_used = entries_.GetLeastUsedKey();
+        if (!least_used) break;
+        EraseLocked(std::string{*least_used});
+    }
+}
+
+void NearCache::EraseLocked(const std::string& key) {
+    const auto* entry = entries_.Get(key);
+    if (!entry) return;
+    size_bytes_ -= entry->size_bytes;
+    entries_.Erase(key);
+}
+
+}  // namespace storages::redis::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/storages/redis/base.hpp>
+#include <userver/storages/redis/reply.hpp>
+
+#include <storages/redis/impl/redis_stats.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::impl {
+
+/// Replies to GET and HGET of a shard group, cached on the client. The servers
+/// report the changes of the cached keys with the CLIENT TRACKING invalidation
+/// messages that arrive on the ev threads of the connections, so the data is
+/// guarded by a std::mutex. The total size of the keys and values is limited,
+/// the least recently used keys are dropped first.
+class NearCache final : public std::enable_shared_from_this<NearCache> {
+public:
+    /// Read of a key in flight. The reply is cached only if the key was not
+    /// invalidated after the read was started, otherwise a stale value could
+    /// outlive the invalidation message that overtook the reply.
+    class Fetch final {
+    public:
+        Fetch(std::shared_ptr<NearCache> cache, std::string key, std::optional<std::string> field);
+        Fetch(Fetch&&) noexcept = default;
+        Fetch& operator=(Fetch&&) = delete;
+        ~Fetch();
+
+        /// Caches the reply if it is a string or a nil
+        void Finish(const ReplyPtr& reply);
+
+    private:
+        std::shared_ptr<NearCache> cache_;
+        std::string key_;
+        std::optional<std::string> field_;
+    };
+
+    explicit NearCache(NearCacheSettings settings);
+
+    /// Invalidation messages are delivered with RESP3 push replies, that are
+    /// supported starting from hiredis 1.0
+    static bool IsSupported() noexcept;
+
+    const NearCacheSettings& GetSettings() const noexcept { return settings_; }
+
+    /// @returns the cached reply to GET of the `key` or to HGET of the `field`
+    /// of the `key`, accounts a hit or a miss
+    std::optional<ReplyData> Get(const std::string& key, const std::optional<std::string>& field);
+
+    /// Must be called before the read of the `key` is sent to a server
+    Fetch StartFetch(std::string key, std::optional<std::string> field);
+
+    /// Drops the keys changed on a server
+    void Invalidate(const std::vector<std::string>& keys);
+
+    /// Drops all the keys, e.g. when the invalidation messages could be lost
+    /// on a reconnect or a topology change
+    void Clear();
+
+    NearCacheStatistics GetStatistics() const;
+
+private:
+    struct Entry {
+        std::optional<ReplyData> value;
+        std::unordered_map<std::string, ReplyData> fields;
+        size_t size_bytes{0};
+    };
+
+    struct PendingFetches {
+        size_t count{0};
+        bool invalidated{false};
+    };
+
+    void FinishFetch(const std::string& key, const std::optional<std::string>& field, const ReplyPtr& reply);
+
+    void EraseLocked(const std::string& key);
+
+    const NearCacheSettings settings_;
+
+    mutable std::mutex mutex_;
+    cache::LruMap<std::string, Entry> entries_;
+    std::unordered_map<std::string, PendingFetches> pending_;
+    size_t size_bytes_{0};
+    NearCacheStatistics stats_;
+};
+
+}  // namespace storages::redis::impl
+
+USERVER_NAMESPACE_END
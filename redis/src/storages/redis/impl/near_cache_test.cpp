@@ -0,0 +1,128 @@
+#include <storages/redis/impl/near_cache.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using storages::redis::Reply;
+using storages::redis::ReplyData;
+using storages::redis::impl::NearCache;
+
+std::shared_ptr<NearCache> MakeCache(size_t max_size_bytes) {
+    storages::redis::NearCacheSettings settings;
+    settings.max_size_bytes = max_size_bytes;
+    return std::make_shared<NearCache>(settings);
+}
+
+void Fetch(NearCache& cache, const std::string& key, std::optional<std::string> field, std::string value) {
+    auto fetch = cache.StartFetch(key, std::move(field));
+    fetch.Finish(std::make_shared<Reply>("get", ReplyData{std::move(value)}));
+}
+
+}  // namespace
+
+TEST(NearCache, GetAndHget) {
+    auto cache = MakeCache(1024);
+    EXPECT_FALSE(cache->Get("key", std::nullopt));
+
+    Fetch(*cache, "key", std::nullopt, "value");
+    Fetch(*cache, "hash", "field", "field_value");
+
+    const auto value = cache->Get("key", std::nullopt);
+    ASSERT_TRUE(value);
+    EXPECT_EQ(value->GetString(), "value");
+    const auto field_value = cache->Get("hash", std::string{"field"});
+    ASSERT_TRUE(field_value);
+    EXPECT_EQ(field_value->GetString(), "field_value");
+    EXPECT_FALSE(cache->Get("hash", std::string{"other"}));
+    EXPECT_FALSE(cache->Get("hash", std::nullopt));
+
+    const auto stats = cache->GetStatistics();
+    EXPECT_EQ(stats.keys, 2);
+    EXPECT_EQ(stats.hits, 2);
+    EXPECT_EQ(stats.misses, 3);
+}
+
+TEST(NearCache, NilAndErrors) {
+    auto cache = MakeCache(1024);
+
+    auto nil_fetch = cache->StartFetch("nil", std::nullopt);
+    nil_fetch.Finish(std::make_shared<Reply>("get", ReplyData::CreateNil()));
+    const auto nil = cache->Get("nil", std::nullopt);
+    ASSERT_TRUE(nil);
+    EXPECT_TRUE(nil->IsNil());
+
+    auto error_fetch = cache->StartFetch("error", std::nullopt);
+    error_fetch.Finish(std::make_shared<Reply>("get", ReplyData::CreateError("ERR")));
+    EXPECT_FALSE(cache->Get("error", std::nullopt));
+
+    { auto abandoned_fetch = cache->StartFetch("abandoned", std::nullopt); }
+    EXPECT_FALSE(cache->Get("abandoned", std::nullopt));
+}
+
+TEST(NearCache, LeastRecentlyUsedAreDropped) {
+    // each key takes 64 bytes of overhead plus the key and the value
+    auto cache = MakeCache(3 * 80);
+    Fetch(*cache, "key1", std::nullopt, std::string(10, 'a'));
+    Fetch(*cache, "key2", std::nullopt, std::string(10, 'b'));
+    Fetch(*cache, "key3", std::nullopt, std::string(10, 'c'));
+    EXPECT_TRUE(cache->Get("key1", std::nullopt));
+
+    Fetch(*cache, "key4", std::nullopt, std::string(10, 'd'));
+    EXPECT_TRUE(cache->Get("key1", std::nullopt));
+    EXPECT_FALSE(cache->Get("key2", std::nullopt));
+    EXPECT_TRUE(cache->Get("key4", std::nullopt));
+
+    const auto stats = cache->GetStatistics();
+    EXPECT_EQ(stats.keys, 3);
+    EXPECT_LE(stats.size_bytes, 3 * 80);
+
+    Fetch(*cache, "huge", std::nullopt, std::string(1024, 'e'));
+    EXPECT_FALSE(cache->Get("huge", std::nullopt));
+    EXPECT_TRUE(cache->Get("key4", std::nullopt));
+    EXPECT_LE(cache->GetStatistics().size_bytes, 3 * 80);
+}
+
+TEST(NearCache, Invalidate) {
+    auto cache = MakeCache(1024);
+    Fetch(*cache, "key", std::nullopt, "value");
+    Fetch(*cache, "hash", "field", "value");
+    Fetch(*cache, "other", std::nullopt, "value");
+
+    cache->Invalidate({"key", "hash"});
+    EXPECT_FALSE(cache->Get("key", std::nullopt));
+    EXPECT_FALSE(cache->Get("hash", std::string{"field"}));
+    EXPECT_TRUE(cache->Get("other", std::nullopt));
+
+    cache->Clear();
+    EXPECT_FALSE(cache->Get("other", std::nullopt));
+
+    const auto stats = cache->GetStatistics();
+    EXPECT_EQ(stats.keys, 0);
+    EXPECT_EQ(stats.size_bytes, 0);
+    EXPECT_EQ(stats.invalidations, 2);
+    EXPECT_EQ(stats.clears, 1);
+}
+
+TEST(NearCache, InvalidationOvertakesReply) {
+    auto cache = MakeCache(1024);
+
+    auto fetch = cache->StartFetch("key", std::nullopt);
+    cache->Invalidate({"key"});
+    fetch.Finish(std::make_shared<Reply>("get", ReplyData{"stale"}));
+    EXPECT_FALSE(cache->Get("key", std::nullopt));
+
+    auto cleared_fetch = cache->StartFetch("key", std::nullopt);
+    cache->Clear();
+    cleared_fetch.Finish(std::make_shared<Reply>("get", ReplyData{"stale"}));
+    EXPECT_FALSE(cache->Get("key", std::nullopt));
+
+    Fetch(*cache, "key", std::nullopt, "fresh");
+    const auto value = cache->Get("key", std::nullopt);
+    ASSERT_TRUE(value);
+    EXPECT_EQ(value->GetString(), "fresh");
+}
+
+USERVER_NAMESPACE_END
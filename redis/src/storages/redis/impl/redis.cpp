@@ -20,14 +20,17 @@
 #include <userver/logging/level.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/impl/usdt.hpp>
 #include <userver/utils/impl/userver_experiments.hpp>
 #include <userver/utils/retry_budget.hpp>
 #include <userver/utils/swappingsmart.hpp>
 
 #include <storages/redis/impl/command.hpp>
 #include <storages/redis/impl/ev_wrapper.hpp>
+#include <storages/redis/impl/near_cache.hpp>
 #include <storages/redis/impl/redis_info.hpp>
 #include <storages/redis/impl/redis_stats.hpp>
+#include <storages/redis/impl/reply_reader.hpp>
 #include <storages/redis/impl/tcp_socket.hpp>
 #include <userver/storages/redis/reply.hpp>
 
@@ -40,6 +43,7 @@ namespace {
 
 const auto kPingLatencyExp = 0.7;
 const auto kInitialPingLatencyMs = 1000;
+const auto kReplyLatencyExp = 0.9;
 const size_t kMissedPingStreakThresholdDefault = 3;
 
 // required for libhiredis < 1.0.0
@@ -120,6 +124,7 @@ public:
     bool IsAvailable() const { return GetState() == Redis::State::kConnected && !IsDestroying() && !IsSyncing(); }
     bool CanRetry() const;
     std::chrono::milliseconds GetPingLatency() const { return std::chrono::milliseconds(ping_latency_ms_); }
+    std::chrono::microseconds GetExpectedLatency() const;
     void SetCommandsBufferingSettings(CommandsBufferingSettings commands_buffering_settings);
     void SetReplicationMonitoringSettings(const ReplicationMonitoringSettings& replication_monitoring_settings);
     void SetRetryBudgetSettings(const utils::RetryBudgetSettings& settings);
@@ -144,6 +149,9 @@ private:
     static void OnRedisReply(redisAsyncContext* c, void* r, void* privdata) noexcept;
     static void OnConnect(const redisAsyncContext* c, int status) noexcept;
     static void OnDisconnect(const redisAsyncContext* c, int status) noexcept;
+#ifdef REDIS_REPLY_PUSH
+    static void OnPush(redisAsyncContext* c, void* r) noexcept;
+#endif
     static void OnTimerPing(struct ev_loop* loop, ev_timer* w, int revents) noexcept;
     static void OnTimerInfo(struct ev_loop* loop, ev_timer* w, int revents) noexcept;
     static void OnConnectTimeout(struct ev_loop* loop, ev_timer* w, int revents) noexcept;
@@ -163,7 +171,9 @@ private:
     void OnNewCommandImpl();
     void CommandLoopImpl();
     void OnRedisReplyImpl(redisReply* redis_reply, void* privdata, int status, const char* errstr);
+    void OnPushImpl(redisReply* redis_reply);
     void AccountPingLatency(std::chrono::milliseconds latency);
+    void AccountReplyLatency(std::chrono::steady_clock::duration latency);
     void AccountRtt();
     void OnTimerPingImpl();
     void OnTimerInfoImpl();
@@ -178,6 +188,8 @@ private:
 
     void Authenticate();
     void SendReadOnly();
+    void EnableClientTracking();
+    void SendClientTracking();
     void FreeCommands();
 
     static void LogSocketErrorReply(const CommandPtr& command, const ReplyPtr& reply);
@@ -232,11 +244,13 @@ private:
     std::atomic_bool enable_replication_monitoring_ = false;
     std::atomic_bool forbid_requests_to_syncing_replicas_ = false;
     const bool send_readonly_;
+    const std::shared_ptr<NearCache> near_cache_;
     const ConnectionSecurity connection_security_;
     std::chrono::milliseconds ping_interval_{2000};
     std::chrono::milliseconds ping_timeout_{4000};
     std::chrono::milliseconds info_replication_interval_{2000};
     std::atomic<double> ping_latency_ms_{kInitialPingLatencyMs};
+    std::atomic<double> reply_latency_us_{0};
     logging::LogExtra log_extra_;
     bool watch_command_timer_started_ = false;
     Statistics statistics_;
@@ -290,6 +304,8 @@ size_t Redis::GetRunningCommands() const { return impl_->GetRunningCommands(); }
 
 std::chrono::milliseconds Redis::GetPingLatency() const { return impl_->GetPingLatency(); }
 
+std::chrono::microseconds Redis::GetExpectedLatency() const { return impl_->GetExpectedLatency(); }
+
 bool Redis::IsDestroying() const { return impl_->IsDestroying(); }
 
 bool Redis::IsSyncing() const { return impl_->IsSyncing(); }
@@ -324,6 +340,7 @@ Redis::RedisImpl::RedisImpl(
       ev_thread_control_(thread_control),
       thread_pool_(thread_pool),
       send_readonly_(redis_settings.send_readonly),
+      near_cache_(redis_settings.near_cache),
       connection_security_(redis_settings.connection_security),
       server_id_(ServerId::Generate()),
       retry_budget_(utils::RetryBudgetSettings{100, 0.1, false}) {
@@ -407,6 +424,7 @@ bool Redis::RedisImpl::Connect(const std::string& host, int port, const Password
         context_ = nullptr;
         return false;
     }
+    SetReplyDataFunctions(*context_->c.reader);
 
     ev_thread_control_.RunInEvLoopBlocking([this, &host]() {
         bool err = false;
@@ -421,6 +439,9 @@ bool Redis::RedisImpl::Connect(const std::string& host, int port, const Password
         if (!err) CheckError(redisAsyncSetConnectCallback(context_, OnConnect), "redisAsyncSetConnectCallback");
         if (!err)
             CheckError(redisAsyncSetDisconnectCallback(context_, OnDisconnect), "redisAsyncSetDisconnectCallback");
+#ifdef REDIS_REPLY_PUSH
+        if (!err && near_cache_) redisAsyncSetPushCallback(context_, OnPush);
+#endif
         SetState(err ? State::kInitError : State::kInit);
     });
     return true;
@@ -465,6 +486,9 @@ void Redis::RedisImpl::InvokeCommand(const CommandPtr& command, ReplyPtr&& reply
     if (reply->status == ReplyStatus::kOk) {
         retry_budget_.AccountOk();
     }
+    if (reply->status == ReplyStatus::kOk || reply->status == ReplyStatus::kTimeoutError) {
+        AccountReplyLatency(std::chrono::steady_clock::now() - command->GetStartHandlingTime());
+    }
 
     reply->server_id = server_id_;
     reply->log_extra.Extend("redis_server", server_);
@@ -519,6 +543,8 @@ bool Redis::RedisImpl::AsyncCommand(const CommandPtr& command) {
         std::lock_guard<std::mutex> lock(command_mutex_);
         if (destroying_) return false;
         ++commands_size_;
+        // the time in the queue is accounted when the command is sent
+        command->ResetStartHandlingTime();
         commands_.push_back(command);
     }
     ev_thread_control_.Send(watch_command_);
@@ -578,6 +604,12 @@ void Redis::RedisImpl::AccountPingLatency(std::chrono::milliseconds latency) {
                 << ping_latency_ms_.load() << "ms" << log_extra;
 }
 
+void Redis::RedisImpl::AccountReplyLatency(std::chrono::steady_clock::duration latency) {
+    // replies are handled on the ev thread only, so there are no concurrent updates
+    const auto latency_us = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+    reply_latency_us_ = reply_latency_us_.load() * kReplyLatencyExp + latency_us * (1 - kReplyLatencyExp);
+}
+
 void Redis::RedisImpl::AccountRtt() {
     auto rtt = GetSocketPeerRtt(context_->c.fd);
     if (rtt) {
@@ -714,6 +746,15 @@ Redis::State Redis::RedisImpl::GetState() const { return state_; }
 
 size_t Redis::RedisImpl::GetRunningCommands() const { return sent_count_; }
 
+std::chrono::microseconds Redis::RedisImpl::GetExpectedLatency() const {
+    // +1 microsecond keeps the number of the running commands significant for
+    // the instances without replies yet. The commands held in the queue by
+    // the in-flight limit wait for the running ones.
+    return std::chrono::microseconds(
+        static_cast<int64_t>((reply_latency_us_.load() + 1) * (GetRunningCommands() + commands_size_.load() + 1))
+    );
+}
+
 logging::Level Redis::RedisImpl::StateChangeToLogLevel(State /*old_state*/, State new_state) {
     switch (new_state) {
         case State::kConnected:
@@ -740,6 +781,8 @@ void Redis::RedisImpl::SetState(State state) {
         << log_extra_ << "Redis server connection state for server=" << GetServer()
         << " (server_id=" << GetServerId().GetId() << ") changed from " << StateToString(state_) << " to "
         << StateToString(state);
+    // invalidation messages are lost with the connection
+    if (near_cache_ && state_ == State::kConnected) near_cache_->Clear();
     state_ = state;
     statistics_.AccountStateChanged(state);
 
@@ -824,21 +867,40 @@ void Redis::RedisImpl::CommandLoopOnTimer(struct ev_loop*, ev_timer* w, int) noe
 }
 
 void Redis::RedisImpl::CommandLoopImpl() {
-    if (WatchCommandTimerEnabled(*commands_buffering_settings_.Get())) {
+    const auto commands_buffering_settings = commands_buffering_settings_.Get();
+    if (WatchCommandTimerEnabled(*commands_buffering_settings)) {
         if (std::exchange(watch_command_timer_started_, false)) {
             ev_thread_control_.Stop(watch_command_timer_);
         }
     }
+    const auto max_in_flight_commands = commands_buffering_settings->max_in_flight_commands;
     std::deque<CommandPtr> commands;
     {
         std::lock_guard<std::mutex> lock(command_mutex_);
-        commands_size_ -= commands_.size();
-        std::swap(commands_, commands);
+        if (!max_in_flight_commands || subscriber_) {
+            std::swap(commands_, commands);
+        } else {
+            // The commands over the limit stay in the queue until the replies
+            // to the running ones arrive, see OnRedisReplyImpl()
+            size_t in_flight = sent_count_;
+            while (!commands_.empty() && in_flight < max_in_flight_commands) {
+                in_flight += commands_.front()->args.GetCommandCount();
+                commands.push_back(std::move(commands_.front()));
+                commands_.pop_front();
+            }
+        }
+        commands_size_ -= commands.size();
     }
     LOG_TRACE() << "commands size=" << commands.size();
+    // The commands of all the callers queued since the previous iteration are
+    // appended to the output buffer of hiredis, that is written with a single
+    // syscall once the socket becomes writable.
+    size_t batch_size = 0;
     for (auto& command : commands) {
+        batch_size += command->args.GetCommandCount();
         ProcessCommand(command);
     }
+    if (batch_size) statistics_.AccountBatchSent(batch_size);
 }
 
 void Redis::RedisImpl::OnConnect(const redisAsyncContext* c, int status) noexcept {
@@ -931,7 +993,7 @@ void Redis::RedisImpl::Authenticate() {
         if (send_readonly_)
             SendReadOnly();
         else
-            SetState(State::kConnected);
+            EnableClientTracking();
     } else {
         ProcessCommand(PrepareCommand(
             CmdArgs{"AUTH", password_.GetUnderlying()},
@@ -940,7 +1002,7 @@ void Redis::RedisImpl::Authenticate() {
                     if (send_readonly_)
                         SendReadOnly();
                     else
-                        SetState(State::kConnected);
+                        EnableClientTracking();
                 } else {
                     if (*reply) {
                         if (reply->IsUnknownCommandError()) {
@@ -970,7 +1032,7 @@ void Redis::RedisImpl::SendReadOnly() {
     LOG_DEBUG() << "Send READONLY command to slave " << GetServerId().GetDescription() << " in cluster mode";
     ProcessCommand(PrepareCommand(CmdArgs{"READONLY"}, [this](const CommandPtr&, ReplyPtr reply) {
         if (*reply && reply->data.IsStatus()) {
-            SetState(State::kConnected);
+            EnableClientTracking();
         } else {
             if (*reply) {
                 LOG_LIMITED_ERROR() << log_extra_ << "READONLY failed: response type=" << reply->data.GetTypeString()
@@ -984,6 +1046,91 @@ void Redis::RedisImpl::SendReadOnly() {
     }));
 }
 
+void Redis::RedisImpl::EnableClientTracking() {
+    if (!near_cache_) {
+        SetState(State::kConnected);
+        return;
+    }
+    LOG_DEBUG() << "Send HELLO 3 command to " << GetServerId().GetDescription() << " for client-side caching";
+    ProcessCommand(PrepareCommand(CmdArgs{"HELLO", "3"}, [this](const CommandPtr&, ReplyPtr reply) {
+        if (*reply && reply->data.IsArray()) {
+            SendClientTracking();
+        } else {
+            if (*reply) {
+                LOG_LIMITED_ERROR() << log_extra_ << "HELLO 3 failed: response type=" << reply->data.GetTypeString()
+                                    << " msg=" << reply->data.ToDebugString();
+            } else {
+                LOG_LIMITED_ERROR() << "HELLO 3 failed with status=" << reply->status << " (" << reply->status_string
+                                    << ") " << log_extra_;
+            }
+            Disconnect();
+        }
+    }));
+}
+
+void Redis::RedisImpl::SendClientTracking() {
+    const auto& settings = near_cache_->GetSettings();
+    std::vector<std::string> args{"TRACKING", "ON"};
+    if (settings.broadcast) {
+        args.emplace_back("BCAST");
+        for (const auto& prefix : settings.broadcast_prefixes) {
+            args.emplace_back("PREFIX");
+            args.push_back(prefix);
+        }
+    }
+    ProcessCommand(PrepareCommand(CmdArgs{"CLIENT", std::move(args)}, [this](const CommandPtr&, ReplyPtr reply) {
+        if (*reply && reply->data.IsStatus()) {
+            SetState(State::kConnected);
+        } else {
+            if (*reply) {
+                LOG_LIMITED_ERROR() << log_extra_
+                                    << "CLIENT TRACKING failed: response type=" << reply->data.GetTypeString()
+                                    << " msg=" << reply->data.ToDebugString();
+            } else {
+                LOG_LIMITED_ERROR() << "CLIENT TRACKING failed with status=" << reply->status << " ("
+                                    << reply->status_string << ") " << log_extra_;
+            }
+            Disconnect();
+        }
+    }));
+}
+
+#ifdef REDIS_REPLY_PUSH
+void Redis::RedisImpl::OnPush(redisAsyncContext* c, void* r) noexcept {
+    auto* impl = static_cast<Redis::RedisImpl*>(c->data);
+    UASSERT(impl != nullptr);
+    try {
+        impl->OnPushImpl(static_cast<redisReply*>(r));
+    } catch (const std::exception& ex) {
+        LOG_ERROR() << "OnPushImpl() failed: " << ex;
+    }
+}
+#endif
+
+void Redis::RedisImpl::OnPushImpl(redisReply* redis_reply) {
+    if (!near_cache_ || !redis_reply) return;
+
+    // ["invalidate", [key, ...]], the keys are nil if the server flushed all of them
+    const ReplyData data = TakeReplyData(redis_reply);
+    if (!data.IsArray() || data.GetArray().size() != 2) return;
+    const auto& kind = data.GetArray()[0];
+    if (!kind.IsString() || kind.GetString() != "invalidate") return;
+
+    const auto& keys = data.GetArray()[1];
+    if (keys.IsNil()) {
+        near_cache_->Clear();
+        return;
+    }
+    if (!keys.IsArray()) return;
+
+    std::vector<std::string> invalidated;
+    invalidated.reserve(keys.GetArray().size());
+    for (const auto& key : keys.GetArray()) {
+        if (key.IsString()) invalidated.push_back(key.GetString());
+    }
+    near_cache_->Invalidate(invalidated);
+}
+
 void Redis::RedisImpl::OnRedisReply(redisAsyncContext* c, void* r, void* privdata) noexcept {
     auto* impl = static_cast<Redis::RedisImpl*>(c->data);
     UASSERT(impl != nullptr);
@@ -1010,7 +1157,10 @@ void Redis::RedisImpl::OnRedisReplyImpl(redisReply* redis_reply, void* privdata,
     ev_thread_control_.Stop(data->second->timer);
     pcommand = data->second.get();
 
-    auto reply = std::make_shared<Reply>(pcommand->cmd, redis_reply, NativeToReplyStatus(status), errstr ? errstr : "");
+    auto reply = std::make_shared<Reply>(pcommand->cmd, TakeReplyData(redis_reply));
+    reply->status = NativeToReplyStatus(status);
+    reply->status_string = errstr ? errstr : "";
+    USERVER_IMPL_USDT(redis_command_reply, this, data->first, static_cast<int>(reply->status));
 
     // After 'subscribe x' + 'unsubscribe x' + 'subscribe x' requests
     // 'unsubscribe' reply can be received as a reply to the second subscribe
@@ -1041,9 +1191,16 @@ void Redis::RedisImpl::OnRedisReplyImpl(redisReply* redis_reply, void* privdata,
         if (subscriber_ && (!reply->IsOk() || !reply->data || !reply->data.IsArray())) pcommand->invoke_disabled = true;
         InvokeCommand(pcommand->meta, std::move(reply));
     }
+
+    // sends the commands held in the queue by the in-flight limit
+    if (!subscriber_ && redis_reply && commands_size_.load() > 0) {
+        const auto max_in_flight_commands = commands_buffering_settings_.Get()->max_in_flight_commands;
+        if (max_in_flight_commands && sent_count_ < max_in_flight_commands) CommandLoopImpl();
+    }
 }
 
 void Redis::RedisImpl::ProcessCommand(const CommandPtr& command) {
+    statistics_.AccountCommandQueued(std::chrono::steady_clock::now() - command->GetStartHandlingTime());
     command->ResetStartHandlingTime();
     statistics_.AccountCommandSent(command);
 
@@ -1094,6 +1251,7 @@ void Redis::RedisImpl::ProcessCommand(const CommandPtr& command) {
                 InvokeCommandError(command, args.GetCommandName(), ReplyStatus::kOtherError);
                 continue;
             }
+            USERVER_IMPL_USDT(redis_command_send, this, cmd_counter_, argv[0], argv_len[0]);
         }
 
         if (args.IsExecCommand()) multi = false;
@@ -36,6 +36,9 @@ public:
     bool AsyncCommand(const CommandPtr& command);
     size_t GetRunningCommands() const;
     std::chrono::milliseconds GetPingLatency() const;
+    /// Moving average of the reply time multiplied by the number of the
+    /// commands in flight, i.e. the expected latency of a new command
+    std::chrono::microseconds GetExpectedLatency() const;
     bool IsDestroying() const;
     std::string GetServerHost() const;
     uint16_t GetServerPort() const;
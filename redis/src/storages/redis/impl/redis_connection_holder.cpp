@@ -12,7 +12,8 @@ RedisConnectionHolder::RedisConnectionHolder(
     Password password,
     CommandsBufferingSettings buffering_settings,
     ReplicationMonitoringSettings replication_monitoring_settings,
-    utils::RetryBudgetSettings retry_budget_settings
+    utils::RetryBudgetSettings retry_budget_settings,
+    std::shared_ptr<NearCache> near_cache
 )
     : commands_buffering_settings_(std::move(buffering_settings)),
       replication_monitoring_settings_(std::move(replication_monitoring_settings)),
@@ -22,6 +23,7 @@ RedisConnectionHolder::RedisConnectionHolder(
       host_(host),
       port_(port),
       password_(std::move(password)),
+      near_cache_(std::move(near_cache)),
       connection_check_timer_(
           ev_thread_,
           [this] { EnsureConnected(); },
@@ -54,6 +56,7 @@ void RedisConnectionHolder::CreateConnection() {
     /// Here we allow read from replicas possibly stale data.
     /// This does not affect connections to masters
     settings.send_readonly = true;
+    settings.near_cache = near_cache_;
     auto instance = std::make_shared<Redis>(redis_thread_pool_, settings);
     instance->signal_state_change.connect([weak_ptr{weak_from_this()}](Redis::State state) {
         const auto ptr = weak_ptr.lock();
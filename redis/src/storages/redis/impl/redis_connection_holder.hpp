@@ -24,7 +24,8 @@ public:
         Password password,
         CommandsBufferingSettings buffering_settings,
         ReplicationMonitoringSettings replication_monitoring_settings,
-        utils::RetryBudgetSettings retry_budget_settings
+        utils::RetryBudgetSettings retry_budget_settings,
+        std::shared_ptr<NearCache> near_cache
     );
     ~RedisConnectionHolder();
     RedisConnectionHolder(const RedisConnectionHolder&) = delete;
@@ -54,6 +55,7 @@ private:
     const std::string host_;
     const uint16_t port_;
     const Password password_;
+    const std::shared_ptr<NearCache> near_cache_;
     rcu::Variable<std::shared_ptr<Redis>, rcu::BlockingRcuTraits> redis_;
     engine::ev::PeriodicWatcher connection_check_timer_;
 };
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <unordered_map>
 
 #include <userver/storages/redis/base.hpp>
@@ -8,9 +9,14 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::redis {
 
+namespace impl {
+class NearCache;
+}  // namespace impl
+
 struct RedisCreationSettings {
     ConnectionSecurity connection_security = ConnectionSecurity::kNone;
     bool send_readonly{false};
+    std::shared_ptr<impl::NearCache> near_cache;
 };
 
 }  // namespace storages::redis
@@ -159,6 +159,16 @@ void Statistics::AccountCommandSent(const CommandPtr& cmd) {
     }
 }
 
+void Statistics::AccountBatchSent(size_t commands_count) {
+    batch_size_percentile.GetCurrentCounter().Account(commands_count);
+}
+
+void Statistics::AccountCommandQueued(std::chrono::steady_clock::duration queue_time) {
+    queue_time_percentile.GetCurrentCounter().Account(
+        std::chrono::duration_cast<std::chrono::milliseconds>(queue_time).count()
+    );
+}
+
 void Statistics::AccountReplyReceived(const ReplyPtr& reply, const CommandPtr& cmd) {
     reply_size_percentile.GetCurrentCounter().Account(reply->data.GetSize());
     auto start = cmd->GetStartHandlingTime();
@@ -193,12 +203,14 @@ void DumpMetric(utils::statistics::Writer& writer, const InstanceStatistics& sta
 
     if (stats.settings.IsRequestSizesEnabled()) {
         writer["request_sizes"] = stats.request_size_percentile;
+        writer["batch_sizes"] = stats.batch_size_percentile;
     }
     if (stats.settings.IsReplySizesEnabled()) {
         writer["reply_sizes"] = stats.reply_size_percentile;
     }
     if (stats.settings.IsTimingsEnabled()) {
         writer["timings"] = stats.timings_percentile;
+        writer["queue_times"] = stats.queue_time_percentile;
     }
 
     if (stats.settings.IsCommandTimingsEnabled() && !stats.command_timings_percentile.empty()) {
@@ -291,6 +303,25 @@ void DumpMetric(utils::statistics::Writer& writer, const SentinelStatistics& sta
         conn_stat.Add(stats.sentinel.value());
         writer.ValueWithLabels(conn_stat, {{"redis_instance_type", "sentinels"}});
     }
+
+    if (stats.near_cache) writer["near_cache"] = *stats.near_cache;
+    if (stats.script_cache) writer["script_cache"] = *stats.script_cache;
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const NearCacheStatistics& stats) {
+    writer["size_bytes"] = stats.size_bytes;
+    writer["keys"] = stats.keys;
+    writer["hits"] = stats.hits;
+    writer["misses"] = stats.misses;
+    writer["invalidations"] = stats.invalidations;
+    writer["clears"] = stats.clears;
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const ScriptCacheStatistics& stats) {
+    writer["scripts"] = stats.scripts;
+    writer["evals"] = stats.evals;
+    writer["evalshas"] = stats.evalshas;
+    writer["noscript_errors"] = stats.noscript_errors;
 }
 
 }  // namespace storages::redis::impl
@@ -32,6 +32,8 @@ public:
 
     void AccountStateChanged(RedisState new_state);
     void AccountCommandSent(const CommandPtr& cmd);
+    void AccountBatchSent(size_t commands_count);
+    void AccountCommandQueued(std::chrono::steady_clock::duration queue_time);
     void AccountReplyReceived(const ReplyPtr& reply, const CommandPtr& cmd);
     void AccountPing(std::chrono::milliseconds ping);
     void AccountError(ReplyStatus code);
@@ -43,8 +45,10 @@ public:
     utils::statistics::RateCounter reconnects{0};
     std::atomic<std::chrono::milliseconds> session_start_time{};
     RecentPeriod request_size_percentile;
+    RecentPeriod batch_size_percentile;
     RecentPeriod reply_size_percentile;
     RecentPeriod timings_percentile;
+    RecentPeriod queue_time_percentile;
     std::unordered_map<std::string_view, RecentPeriod> command_timings_percentile;
     std::atomic_llong last_ping_ms{};
     std::atomic_bool is_syncing = false;
@@ -61,8 +65,10 @@ struct InstanceStatistics {
         reconnects = other.reconnects;
         session_start_time = other.session_start_time.load(std::memory_order_relaxed);
         request_size_percentile = other.request_size_percentile.GetStatsForPeriod();
+        batch_size_percentile = other.batch_size_percentile.GetStatsForPeriod();
         reply_size_percentile = other.reply_size_percentile.GetStatsForPeriod();
         timings_percentile = other.timings_percentile.GetStatsForPeriod();
+        queue_time_percentile = other.queue_time_percentile.GetStatsForPeriod();
         last_ping_ms = other.last_ping_ms.load(std::memory_order_relaxed);
         is_syncing = other.is_syncing.load(std::memory_order_relaxed);
         offset_from_master = other.offset_from_master_bytes.load(std::memory_order_relaxed);
@@ -77,8 +83,10 @@ struct InstanceStatistics {
     void Add(const InstanceStatistics& other) {
         reconnects += other.reconnects;
         request_size_percentile.Add(other.request_size_percentile);
+        batch_size_percentile.Add(other.batch_size_percentile);
         reply_size_percentile.Add(other.reply_size_percentile);
         timings_percentile.Add(other.timings_percentile);
+        queue_time_percentile.Add(other.queue_time_percentile);
 
         for (size_t i = 0; i < error_count.size(); i++) error_count[i] += other.error_count[i];
 
@@ -91,8 +99,10 @@ struct InstanceStatistics {
     utils::statistics::RateCounter reconnects{};
     std::chrono::milliseconds session_start_time{};
     Statistics::Percentile request_size_percentile;
+    Statistics::Percentile batch_size_percentile;
     Statistics::Percentile reply_size_percentile;
     Statistics::Percentile timings_percentile;
+    Statistics::Percentile queue_time_percentile;
     std::unordered_map<std::string, Statistics::Percentile> command_timings_percentile;
     long long last_ping_ms{};
     bool is_syncing{};
@@ -123,6 +133,22 @@ struct SentinelStatisticsInternal {
     utils::statistics::RateCounter cluster_topology_updates{0};
 };
 
+struct NearCacheStatistics {
+    size_t size_bytes{0};
+    size_t keys{0};
+    uint64_t hits{0};
+    uint64_t misses{0};
+    uint64_t invalidations{0};
+    uint64_t clears{0};
+};
+
+struct ScriptCacheStatistics {
+    size_t scripts{0};
+    uint64_t evals{0};
+    uint64_t evalshas{0};
+    uint64_t noscript_errors{0};
+};
+
 struct SentinelStatistics {
     SentinelStatistics(const MetricsSettings& settings, const SentinelStatisticsInternal& internal)
         : shard_group_total(settings), internal(internal) {}
@@ -134,12 +160,18 @@ struct SentinelStatistics {
     std::unordered_map<std::string, ShardStatistics> slaves;
     InstanceStatistics shard_group_total;
     SentinelStatisticsInternal internal;
+    std::optional<NearCacheStatistics> near_cache;
+    std::optional<ScriptCacheStatistics> script_cache;
 };
 
 void DumpMetric(utils::statistics::Writer& writer, const InstanceStatistics& stats, bool real_instance = true);
 
 void DumpMetric(utils::statistics::Writer& writer, const ShardStatistics& stats);
 
+void DumpMetric(utils::statistics::Writer& writer, const NearCacheStatistics& stats);
+
+void DumpMetric(utils::statistics::Writer& writer, const ScriptCacheStatistics& stats);
+
 void DumpMetric(utils::statistics::Writer& writer, const SentinelStatistics& stats);
 
 }  // namespace storages::redis::impl
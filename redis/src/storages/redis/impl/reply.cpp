@@ -42,6 +42,26 @@ ReplyData::ReplyData(const redisReply* reply) {
             type_ = Type::kError;
             string_ = std::string(reply->str, reply->len);
             break;
+#ifdef REDIS_REPLY_PUSH
+        // RESP3 types, received on the connections with client-side caching
+        case REDIS_REPLY_MAP:
+        case REDIS_REPLY_SET:
+        case REDIS_REPLY_PUSH:
+            type_ = Type::kArray;
+            array_.reserve(reply->elements);
+            for (size_t i = 0; i < reply->elements; i++) array_.emplace_back(reply->element[i]);
+            break;
+        case REDIS_REPLY_DOUBLE:
+        case REDIS_REPLY_VERB:
+        case REDIS_REPLY_BIGNUM:
+            type_ = Type::kString;
+            string_ = std::string(reply->str, reply->len);
+            break;
+        case REDIS_REPLY_BOOL:
+            type_ = Type::kInteger;
+            integer_ = reply->integer;
+            break;
+#endif
         default:
             type_ = Type::kNoReply;
             break;
@@ -66,6 +86,13 @@ ReplyData ReplyData::CreateStatus(std::string&& status_msg) {
     return data;
 }
 
+ReplyData ReplyData::CreateInteger(int64_t value) {
+    ReplyData data;
+    data.type_ = Type::kInteger;
+    data.integer_ = value;
+    return data;
+}
+
 ReplyData ReplyData::CreateNil() {
     ReplyData data;
     data.type_ = Type::kNil;
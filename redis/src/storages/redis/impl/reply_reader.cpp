@@ -0,0 +1,176 @@
+#include <storages/redis/impl/reply_reader.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+
+#include <hiredis/hiredis.h>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::impl {
+
+namespace {
+
+// Replies are seen by hiredis as redisReply, so it must be the first member.
+// The data of the root node is owned by it, the data of the other nodes lives
+// in the array of the parent, which is allocated before the elements are read.
+struct ReplyNode {
+    redisReply reply;
+    ReplyData* data;
+};
+
+static_assert(std::is_standard_layout_v<ReplyNode>);
+
+ReplyData MakeNoReply() { return ReplyData{static_cast<const redisReply*>(nullptr)}; }
+
+ReplyNode* CreateNode(const redisReadTask* task, ReplyData&& data) {
+    auto node = std::make_unique<ReplyNode>();
+    node->reply.type = task->type;
+    if (task->parent) {
+        auto* parent = static_cast<ReplyNode*>(task->parent->obj);
+        UASSERT(parent && parent->data->IsArray());
+        auto& slot = parent->data->GetArray().at(task->idx);
+        slot = std::move(data);
+        node->data = &slot;
+        parent->reply.element[task->idx] = &node->reply;
+    } else {
+        node->data = std::make_unique<ReplyData>(std::move(data)).release();
+    }
+    return node.release();
+}
+
+void SetString(ReplyNode& node, std::string& str) {
+    node.reply.str = str.data();
+    node.reply.len = str.size();
+}
+
+void* CreateString(const redisReadTask* task, char* str, size_t len) noexcept {
+    try {
+        ReplyNode* node = nullptr;
+        switch (task->type) {
+            case REDIS_REPLY_ERROR:
+                node = CreateNode(task, ReplyData::CreateError(std::string(str, len)));
+                SetString(*node, node->data->GetError());
+                break;
+            case REDIS_REPLY_STATUS:
+                node = CreateNode(task, ReplyData::CreateStatus(std::string(str, len)));
+                SetString(*node, node->data->GetStatus());
+                break;
+#ifdef REDIS_REPLY_PUSH
+            case REDIS_REPLY_VERB:
+                // the string starts with a "txt:" like prefix of the format
+                if (len < 4) return nullptr;
+                node = CreateNode(task, ReplyData{std::string(str + 4, len - 4)});
+                std::copy(str, str + 3, node->reply.vtype);
+                SetString(*node, node->data->GetString());
+                break;
+#endif
+            default:
+                node = CreateNode(task, ReplyData{std::string(str, len)});
+                SetString(*node, node->data->GetString());
+                break;
+        }
+        return node;
+    } catch (const std::exception&) {
+        return nullptr;
+    }
+}
+
+void* CreateArray(const redisReadTask* task, size_t elements) noexcept {
+    try {
+        auto element = std::make_unique<redisReply*[]>(elements);
+        auto* node = CreateNode(task, ReplyData{ReplyData::Array(elements, MakeNoReply())});
+        node->reply.elements = elements;
+        node->reply.element = element.release();
+        return node;
+    } catch (const std::exception&) {
+        return nullptr;
+    }
+}
+
+void* CreateInteger(const redisReadTask* task, long long value) noexcept {
+    try {
+        auto* node = CreateNode(task, ReplyData::CreateInteger(value));
+        node->reply.integer = value;
+        return node;
+    } catch (const std::exception&) {
+        return nullptr;
+    }
+}
+
+void* CreateNil(const redisReadTask* task) noexcept {
+    try {
+        return CreateNode(task, ReplyData::CreateNil());
+    } catch (const std::exception&) {
+        return nullptr;
+    }
+}
+
+#ifdef REDIS_REPLY_PUSH
+void* CreateDouble(const redisReadTask* task, double value, char* str, size_t len) noexcept {
+    try {
+        auto* node = CreateNode(task, ReplyData{std::string(str, len)});
+        node->reply.dval = value;
+        SetString(*node, node->data->GetString());
+        return node;
+    } catch (const std::exception&) {
+        return nullptr;
+    }
+}
+
+void* CreateBool(const redisReadTask* task, int value) noexcept {
+    try {
+        auto* node = CreateNode(task, ReplyData::CreateInteger(value));
+        node->reply.integer = value;
+        return node;
+    } catch (const std::exception&) {
+        return nullptr;
+    }
+}
+#endif
+
+void FreeNode(ReplyNode* node, bool is_root) noexcept {
+    for (size_t i = 0; i < node->reply.elements; ++i) {
+        if (node->reply.element[i]) FreeNode(reinterpret_cast<ReplyNode*>(node->reply.element[i]), false);
+    }
+    delete[] node->reply.element;
+    if (is_root) delete node->data;
+    delete node;
+}
+
+void FreeObject(void* obj) noexcept {
+    if (obj) FreeNode(static_cast<ReplyNode*>(obj), true);
+}
+
+redisReplyObjectFunctions MakeReplyDataFunctions() {
+    redisReplyObjectFunctions functions{};
+    functions.createString = &CreateString;
+    functions.createArray = &CreateArray;
+    functions.createInteger = &CreateInteger;
+    functions.createNil = &CreateNil;
+#ifdef REDIS_REPLY_PUSH
+    functions.createDouble = &CreateDouble;
+    functions.createBool = &CreateBool;
+#endif
+    functions.freeObject = &FreeObject;
+    return functions;
+}
+
+redisReplyObjectFunctions kReplyDataFunctions = MakeReplyDataFunctions();
+
+}  // namespace
+
+void SetReplyDataFunctions(redisReader& reader) { reader.fn = &kReplyDataFunctions; }
+
+ReplyData TakeReplyData(redisReply* reply) {
+    if (!reply) return MakeNoReply();
+    auto* node = reinterpret_cast<ReplyNode*>(reply);
+    return std::move(*node->data);
+}
+
+}  // namespace storages::redis::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <userver/storages/redis/reply.hpp>
+
+struct redisReader;
+struct redisReply;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::impl {
+
+/// Makes the hiredis reader build ReplyData right from its input buffer,
+/// without the intermediate copies of the strings in redisReply. The replies
+/// are still laid out as redisReply, with the strings pointing into ReplyData,
+/// because hiredis peeks into them for the pub/sub, push and error replies.
+void SetReplyDataFunctions(redisReader& reader);
+
+/// Moves the data out of a reply built by the reader with the functions from
+/// SetReplyDataFunctions(). Afterwards the reply may only be freed.
+ReplyData TakeReplyData(redisReply* reply);
+
+}  // namespace storages::redis::impl
+
+USERVER_NAMESPACE_END
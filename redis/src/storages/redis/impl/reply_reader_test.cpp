@@ -0,0 +1,93 @@
+#include <storages/redis/impl/reply_reader.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <hiredis/hiredis.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using namespace std::string_literals;
+using storages::redis::ReplyData;
+
+class ReplyReader {
+public:
+    ReplyReader() : reader_(redisReaderCreate(), &redisReaderFree) {
+        storages::redis::impl::SetReplyDataFunctions(*reader_);
+    }
+
+    redisReply* Read(const std::string& data) {
+        EXPECT_EQ(redisReaderFeed(reader_.get(), data.data(), data.size()), REDIS_OK);
+        void* reply = nullptr;
+        EXPECT_EQ(redisReaderGetReply(reader_.get(), &reply), REDIS_OK);
+        replies_.emplace_back(reply, reader_->fn->freeObject);
+        return static_cast<redisReply*>(reply);
+    }
+
+private:
+    std::unique_ptr<redisReader, decltype(&redisReaderFree)> reader_;
+    std::vector<std::unique_ptr<void, void (*)(void*)>> replies_;
+};
+
+}  // namespace
+
+TEST(ReplyReader, Scalars) {
+    ReplyReader reader;
+
+    auto data = storages::redis::impl::TakeReplyData(reader.Read("$5\r\nva\0ue\r\n"s));
+    ASSERT_TRUE(data.IsString());
+    EXPECT_EQ(data.GetString(), std::string("va\0ue", 5));
+
+    data = storages::redis::impl::TakeReplyData(reader.Read(":-42\r\n"));
+    ASSERT_TRUE(data.IsInt());
+    EXPECT_EQ(data.GetInt(), -42);
+
+    data = storages::redis::impl::TakeReplyData(reader.Read(":9000000000\r\n"));
+    ASSERT_TRUE(data.IsInt());
+    EXPECT_EQ(data.GetInt(), 9000000000);
+
+    data = storages::redis::impl::TakeReplyData(reader.Read("$-1\r\n"));
+    EXPECT_TRUE(data.IsNil());
+
+    data = storages::redis::impl::TakeReplyData(reader.Read("+OK\r\n"));
+    ASSERT_TRUE(data.IsStatus());
+    EXPECT_EQ(data.GetStatus(), "OK");
+
+    data = storages::redis::impl::TakeReplyData(reader.Read("-ERR unknown\r\n"));
+    ASSERT_TRUE(data.IsError());
+    EXPECT_EQ(data.GetError(), "ERR unknown");
+}
+
+TEST(ReplyReader, NestedArrays) {
+    ReplyReader reader;
+
+    auto* reply = reader.Read("*3\r\n$7\r\nmessage\r\n*2\r\n$1\r\na\r\n$-1\r\n:1\r\n");
+    ASSERT_NE(reply, nullptr);
+
+    // hiredis reads the pub/sub replies as redisReply
+    ASSERT_EQ(reply->type, REDIS_REPLY_ARRAY);
+    ASSERT_EQ(reply->elements, 3);
+    EXPECT_EQ(reply->element[0]->type, REDIS_REPLY_STRING);
+    EXPECT_EQ(std::string(reply->element[0]->str, reply->element[0]->len), "message");
+    ASSERT_EQ(reply->element[1]->elements, 2);
+    EXPECT_EQ(reply->element[1]->element[1]->type, REDIS_REPLY_NIL);
+    EXPECT_EQ(reply->element[2]->integer, 1);
+
+    const auto data = storages::redis::impl::TakeReplyData(reply);
+    EXPECT_EQ(data.ToDebugString(), "[message, [a, (nil)], 1]");
+}
+
+TEST(ReplyReader, PartialInput) {
+    ReplyReader reader;
+
+    EXPECT_EQ(reader.Read("*2\r\n$3\r\nfoo\r\n"), nullptr);
+    auto* reply = reader.Read("$3\r\nbar\r\n");
+    ASSERT_NE(reply, nullptr);
+    EXPECT_EQ(storages::redis::impl::TakeReplyData(reply).ToDebugString(), "[foo, bar]");
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,62 @@
+#include <storages/redis/impl/script_cache.hpp>
+
+#include <userver/crypto/hash.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::impl {
+
+namespace {
+
+// Scripts built at runtime are not worth tracking, they are sent with EVAL
+constexpr size_t kMaxScripts = 1024;
+
+}  // namespace
+
+ScriptCache::Script::Script(std::string text) : text_(std::move(text)), sha_(crypto::hash::Sha1(text_)) {}
+
+bool ScriptCache::Script::IsLoaded(size_t shard) const {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return shard < loaded_shards_.size() && loaded_shards_[shard];
+}
+
+void ScriptCache::Script::SetLoaded(size_t shard, bool loaded) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    if (shard >= loaded_shards_.size()) {
+        if (!loaded) return;
+        loaded_shards_.resize(shard + 1);
+    }
+    loaded_shards_[shard] = loaded;
+}
+
+ScriptCache::ScriptPtr ScriptCache::Get(const std::string& text) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = scripts_.find(text);
+    if (it != scripts_.end()) return it->second;
+    if (scripts_.size() >= kMaxScripts) return nullptr;
+
+    auto script = std::make_shared<Script>(text);
+    scripts_.emplace(script->GetText(), script);
+    return script;
+}
+
+void ScriptCache::Clear() {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    scripts_.clear();
+}
+
+ScriptCacheStatistics ScriptCache::GetStatistics() const {
+    ScriptCacheStatistics stats;
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        stats.scripts = scripts_.size();
+    }
+    stats.evals = evals_.load(std::memory_order_relaxed);
+    stats.evalshas = evalshas_.load(std::memory_order_relaxed);
+    stats.noscript_errors = noscript_errors_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+}  // namespace storages::redis::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <storages/redis/impl/redis_stats.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::impl {
+
+/// Lua scripts of a shard group that are known to be in the script caches of
+/// the shards. Eval() of such a script sends EVALSHA with the SHA1 digest
+/// instead of the script text. A script gets into the server cache with the
+/// first EVAL on the shard, and the shard is forgotten on a NOSCRIPT error,
+/// e.g. after a failover or SCRIPT FLUSH.
+class ScriptCache final {
+public:
+    class Script final {
+    public:
+        explicit Script(std::string text);
+
+        const std::string& GetText() const noexcept { return text_; }
+        const std::string& GetSha() const noexcept { return sha_; }
+
+        bool IsLoaded(size_t shard) const;
+        void SetLoaded(size_t shard, bool loaded);
+
+    private:
+        const std::string text_;
+        const std::string sha_;
+
+        mutable std::mutex mutex_;
+        std::vector<bool> loaded_shards_;
+    };
+
+    using ScriptPtr = std::shared_ptr<Script>;
+
+    /// @returns the script with the `text`, or nullptr if too many distinct
+    /// scripts are tracked already
+    ScriptPtr Get(const std::string& text);
+
+    /// Forgets the shards of all the scripts, the shards are renumbered on
+    /// cluster topology changes
+    void Clear();
+
+    void AccountEval() noexcept { evals_.fetch_add(1, std::memory_order_relaxed); }
+    void AccountEvalSha() noexcept { evalshas_.fetch_add(1, std::memory_order_relaxed); }
+    void AccountNoScript() noexcept { noscript_errors_.fetch_add(1, std::memory_order_relaxed); }
+
+    ScriptCacheStatistics GetStatistics() const;
+
+private:
+    mutable std::mutex mutex_;
+    // keys point into the texts of the scripts
+    std::unordered_map<std::string_view, ScriptPtr> scripts_;
+
+    std::atomic<uint64_t> evals_{0};
+    std::atomic<uint64_t> evalshas_{0};
+    std::atomic<uint64_t> noscript_errors_{0};
+};
+
+}  // namespace storages::redis::impl
+
+USERVER_NAMESPACE_END
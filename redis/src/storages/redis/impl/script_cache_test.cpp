@@ -0,0 +1,63 @@
+#include <storages/redis/impl/script_cache.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+using storages::redis::impl::ScriptCache;
+
+TEST(ScriptCache, Sha) {
+    ScriptCache cache;
+    auto script = cache.Get("return 1");
+    ASSERT_TRUE(script);
+    EXPECT_EQ(script->GetText(), "return 1");
+    // SCRIPT LOAD "return 1"
+    EXPECT_EQ(script->GetSha(), "e0e1f9fabfc9d4800c877a703b823ac0578ff8db");
+    EXPECT_EQ(cache.Get("return 1"), script);
+    EXPECT_NE(cache.Get("return 2"), script);
+}
+
+TEST(ScriptCache, LoadedShards) {
+    ScriptCache cache;
+    auto script = cache.Get("return 1");
+    ASSERT_TRUE(script);
+    EXPECT_FALSE(script->IsLoaded(0));
+
+    script->SetLoaded(3, true);
+    EXPECT_TRUE(script->IsLoaded(3));
+    EXPECT_FALSE(script->IsLoaded(0));
+    EXPECT_FALSE(script->IsLoaded(4));
+
+    script->SetLoaded(3, false);
+    script->SetLoaded(10, false);
+    EXPECT_FALSE(script->IsLoaded(3));
+    EXPECT_FALSE(script->IsLoaded(10));
+}
+
+TEST(ScriptCache, Clear) {
+    ScriptCache cache;
+    auto script = cache.Get("return 1");
+    ASSERT_TRUE(script);
+    script->SetLoaded(0, true);
+
+    cache.Clear();
+    auto new_script = cache.Get("return 1");
+    ASSERT_TRUE(new_script);
+    EXPECT_FALSE(new_script->IsLoaded(0));
+    EXPECT_EQ(cache.GetStatistics().scripts, 1);
+}
+
+TEST(ScriptCache, Statistics) {
+    ScriptCache cache;
+    cache.AccountEval();
+    cache.AccountEvalSha();
+    cache.AccountEvalSha();
+    cache.AccountNoScript();
+
+    const auto stats = cache.GetStatistics();
+    EXPECT_EQ(stats.evals, 1);
+    EXPECT_EQ(stats.evalshas, 2);
+    EXPECT_EQ(stats.noscript_errors, 1);
+}
+
+USERVER_NAMESPACE_END
@@ -18,7 +18,9 @@
 #include <storages/redis/dynamic_config.hpp>
 #include <storages/redis/impl/cluster_sentinel_impl.hpp>
 #include <storages/redis/impl/command.hpp>
+#include <storages/redis/impl/near_cache.hpp>
 #include <storages/redis/impl/redis.hpp>
+#include <storages/redis/impl/script_cache.hpp>
 #include <storages/redis/impl/sentinel_impl.hpp>
 #include <storages/redis/impl/subscribe_sentinel.hpp>
 
@@ -76,8 +78,10 @@ Sentinel::Sentinel(
     : shard_group_name_(shard_group_name),
       thread_pools_(thread_pools),
       secdist_default_command_control_(command_control),
+      script_cache_(std::make_shared<ScriptCache>()),
       testsuite_redis_control_(testsuite_redis_control) {
     config_default_command_control_.Set(std::make_shared<CommandControl>(secdist_default_command_control_));
+    signal_topology_changed.connect([script_cache = script_cache_](size_t) { script_cache->Clear(); });
 
     if (!thread_pools_) {
         throw std::runtime_error("can't create Sentinel with empty thread_pools");
@@ -147,7 +151,8 @@ std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
     const std::string& client_name,
     KeyShardFactory key_shard_factory,
     const CommandControl& command_control,
-    const testsuite::RedisControl& testsuite_redis_control
+    const testsuite::RedisControl& testsuite_redis_control,
+    std::shared_ptr<NearCache> near_cache
 ) {
     auto ready_callback = [](size_t shard, const std::string& shard_name, bool ready) {
         LOG_INFO() << "redis: ready_callback:"
@@ -163,7 +168,8 @@ std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
         std::move(ready_callback),
         std::move(key_shard_factory),
         command_control,
-        testsuite_redis_control
+        testsuite_redis_control,
+        std::move(near_cache)
     );
 }
 
@@ -176,7 +182,8 @@ std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
     Sentinel::ReadyChangeCallback ready_callback,
     KeyShardFactory key_shard_factory,
     const CommandControl& command_control,
-    const testsuite::RedisControl& testsuite_redis_control
+    const testsuite::RedisControl& testsuite_redis_control,
+    std::shared_ptr<NearCache> near_cache
 ) {
     const auto& password = settings.password;
 
@@ -215,6 +222,7 @@ std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
             command_control,
             testsuite_redis_control
         );
+        if (near_cache) client->SetNearCache(std::move(near_cache));
         client->Start();
     }
 
@@ -332,7 +340,12 @@ void Sentinel::CheckShardIdx(size_t shard_idx, size_t shard_count) {
 const std::string& Sentinel::GetAnyKeyForShard(size_t shard_idx) const { return impl_->GetAnyKeyForShard(shard_idx); }
 
 SentinelStatistics Sentinel::GetStatistics(const MetricsSettings& settings) const {
-    return impl_->GetStatistics(settings);
+    auto stats = impl_->GetStatistics(settings);
+    if (near_cache_) stats.near_cache = near_cache_->GetStatistics();
+    if (auto script_cache = script_cache_->GetStatistics(); script_cache.evals || script_cache.evalshas) {
+        stats.script_cache = script_cache;
+    }
+    return stats;
 }
 
 void Sentinel::SetCommandsBufferingSettings(CommandsBufferingSettings commands_buffering_settings) {
@@ -347,6 +360,14 @@ void Sentinel::SetRetryBudgetSettings(const utils::RetryBudgetSettings& settings
     impl_->SetRetryBudgetSettings(settings);
 }
 
+void Sentinel::SetNearCache(std::shared_ptr<NearCache> near_cache) {
+    near_cache_ = std::move(near_cache);
+    if (!near_cache_) return;
+    // keys move to the servers that have not been tracking them for us
+    signal_topology_changed.connect([near_cache = near_cache_](size_t) { near_cache->Clear(); });
+    impl_->SetNearCache(near_cache_);
+}
+
 std::vector<Request>
 Sentinel::MakeRequests(CmdArgs&& args, bool master, const CommandControl& command_control, size_t replies_to_skip) {
     std::vector<Request> rslt;
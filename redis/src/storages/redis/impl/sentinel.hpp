@@ -40,6 +40,8 @@ const auto kProcessWaitingCommandsInterval = std::chrono::seconds(3);
 const auto kCheckRedisConnectedInterval = std::chrono::seconds(3);
 
 // Forward declarations
+class NearCache;
+class ScriptCache;
 class SentinelImplBase;
 class SentinelImpl;
 class Shard;
@@ -103,7 +105,8 @@ public:
         const std::string& client_name,
         KeyShardFactory key_shard_factory,
         const CommandControl& command_control = {},
-        const testsuite::RedisControl& testsuite_redis_control = {}
+        const testsuite::RedisControl& testsuite_redis_control = {},
+        std::shared_ptr<NearCache> near_cache = {}
     );
     static std::shared_ptr<Sentinel> CreateSentinel(
         const std::shared_ptr<ThreadPools>& thread_pools,
@@ -114,7 +117,8 @@ public:
         ReadyChangeCallback ready_callback,
         KeyShardFactory key_shard_factory,
         const CommandControl& command_control = {},
-        const testsuite::RedisControl& testsuite_redis_control = {}
+        const testsuite::RedisControl& testsuite_redis_control = {},
+        std::shared_ptr<NearCache> near_cache = {}
     );
 
     void Restart();
@@ -145,6 +149,14 @@ public:
     void SetReplicationMonitoringSettings(const ReplicationMonitoringSettings& replication_monitoring_settings);
     void SetRetryBudgetSettings(const utils::RetryBudgetSettings& settings);
 
+    /// Enables client-side caching for the connections, must be called before
+    /// Start()
+    void SetNearCache(std::shared_ptr<NearCache> near_cache);
+    const std::shared_ptr<NearCache>& GetNearCache() const noexcept { return near_cache_; }
+
+    /// Lua scripts loaded on the shards, for Eval() over EVALSHA
+    const std::shared_ptr<ScriptCache>& GetScriptCache() const noexcept { return script_cache_; }
+
     // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
     boost::signals2::signal<void(size_t shard)> signal_instances_changed;
     // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
@@ -189,9 +201,12 @@ public:
 
     void UpdatePassword(const Password& password);
 
-    using UserMessageCallback = std::function<Outcome(const std::string& channel, const std::string& message)>;
+    // A message is copied out of the reply once and shared by all the local
+    // subscribers of the channel
+    using SharedMessage = std::shared_ptr<const std::string>;
+    using UserMessageCallback = std::function<Outcome(const std::string& channel, const SharedMessage& message)>;
     using UserPmessageCallback =
-        std::function<Outcome(const std::string& pattern, const std::string& channel, const std::string& message)>;
+        std::function<Outcome(const std::string& pattern, const std::string& channel, const SharedMessage& message)>;
 
     using MessageCallback =
         std::function<void(ServerId server_id, const std::string& channel, const std::string& message)>;
@@ -238,6 +253,8 @@ private:
     std::unique_ptr<engine::ev::ThreadControl> sentinel_thread_control_;
     CommandControl secdist_default_command_control_;
     utils::SwappingSmart<CommandControl> config_default_command_control_;
+    std::shared_ptr<NearCache> near_cache_;
+    std::shared_ptr<ScriptCache> script_cache_;
     std::atomic_int publish_shard_{0};
     testsuite::RedisControl testsuite_redis_control_;
 };
@@ -4,7 +4,6 @@
 #include <sstream>
 #include <thread>
 
-#include <boost/crc.hpp>
 
 #include <fmt/format.h>
 #include <fmt/ranges.h>
@@ -198,6 +197,7 @@ void SentinelImpl::InitShards(
             if (ready_callback) ready_callback(i, shard, ready);
         };
         auto object = std::make_shared<Shard>(std::move(shard_options));
+        object->SetNearCache(near_cache_);
         object->SignalInstanceStateChange().connect([this](ServerId, Redis::State state) {
             if (state != Redis::State::kInit) ev_thread_.Send(watch_state_);
         });
@@ -539,6 +539,11 @@ void SentinelImpl::SetRetryBudgetSettings(const utils::RetryBudgetSettings& retr
     for (auto& shard : master_shards_) shard->SetRetryBudgetSettings(retry_budget_settings);
 }
 
+void SentinelImpl::SetNearCache(std::shared_ptr<NearCache> near_cache) {
+    near_cache_ = std::move(near_cache);
+    for (auto& shard : master_shards_) shard->SetNearCache(near_cache_);
+}
+
 PublishSettings SentinelImpl::GetPublishSettings() {
     /// Why do we always publish to master? We can actually publish to any host in
     /// shard to distribute load evenly
@@ -907,13 +912,6 @@ size_t SentinelImpl::ParseMovedShard(const std::string& err_string) {
     return shard_info_.GetShard(host, port);
 }
 
-size_t SentinelImpl::HashSlot(const std::string& key) {
-    size_t start = 0;
-    size_t len = 0;
-    GetRedisKey(key, &start, &len);
-    return std::for_each(key.data() + start, key.data() + start + len, boost::crc_optimal<16, 0x1021>())() & 0x3fff;
-}
-
 SentinelImpl::SlotInfo::SlotInfo() {
     for (size_t i = 0; i < kClusterHashSlots; ++i) {
         slot_to_shard_[i] = kUnknownShard;
@@ -84,6 +84,7 @@ public:
     virtual void SetReplicationMonitoringSettings(const ReplicationMonitoringSettings& replication_monitoring_settings
     ) = 0;
     virtual void SetRetryBudgetSettings(const utils::RetryBudgetSettings& retry_budget_settings) = 0;
+    virtual void SetNearCache(std::shared_ptr<NearCache> near_cache) = 0;
 
     virtual PublishSettings GetPublishSettings() = 0;
     virtual void SetConnectionInfo(const std::vector<ConnectionInfoInt>& info_array) = 0;
@@ -143,6 +144,7 @@ public:
     void SetReplicationMonitoringSettings(const ReplicationMonitoringSettings& replication_monitoring_settings
     ) override;
     void SetRetryBudgetSettings(const utils::RetryBudgetSettings& retry_budget_settings) override;
+    void SetNearCache(std::shared_ptr<NearCache> near_cache) override;
     PublishSettings GetPublishSettings() override;
 
     void SetConnectionInfo(const std::vector<ConnectionInfoInt>& info_array) override;
@@ -238,8 +240,6 @@ private:
         const ReadyChangeCallback& ready_callback
     );
 
-    static size_t HashSlot(const std::string& key);
-
     void ProcessWaitingCommands();
 
     Password GetPassword();
@@ -281,6 +281,7 @@ private:
     SentinelStatisticsInternal statistics_internal_;
     utils::SwappingSmart<KeysForShards> keys_for_shards_;
     std::optional<CommandsBufferingSettings> commands_buffering_settings_;
+    std::shared_ptr<NearCache> near_cache_;
     dynamic_config::Source dynamic_config_source_;
     std::atomic<int> publish_shard_{0};
 };
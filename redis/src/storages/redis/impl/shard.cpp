@@ -113,6 +113,9 @@ Shard::GetAvailableServers(const CommandControl& command_control, bool with_mast
         case CommandControl::Strategy::kLocalDcConductor:
         case CommandControl::Strategy::kNearestServerPing:
             return GetNearestServersPing(command_control, with_masters, with_slaves);
+
+        case CommandControl::Strategy::kLeastLoaded:
+            return GetLeastLoadedServers(with_masters, with_slaves);
     }
 
     /* never reachable */
@@ -152,6 +155,28 @@ Shard::GetNearestServersPing(const CommandControl& command_control, bool with_ma
     return result;
 }
 
+/// Prioritize the available instance with the least expected latency, others
+/// are left for the fallback
+std::vector<unsigned char> Shard::GetLeastLoadedServers(bool with_masters, bool with_slaves) const {
+    auto result = std::vector<unsigned char>(instances_.size(), 0);
+    std::optional<size_t> best;
+    std::chrono::microseconds best_latency{};
+    for (size_t i = 0; i < instances_.size(); i++) {
+        const auto& info = instances_[i].info;
+        if (!(with_slaves && info.IsReadOnly()) && !(with_masters && !info.IsReadOnly())) continue;
+        const auto& cur_inst = instances_[i].instance;
+        if (!cur_inst || !cur_inst->IsAvailable()) continue;
+
+        const auto latency = cur_inst->GetExpectedLatency();
+        if (!best || latency < best_latency) {
+            best = i;
+            best_latency = latency;
+        }
+    }
+    if (best) result[*best] = 1;
+    return result;
+}
+
 std::shared_ptr<Redis> Shard::GetInstance(
     const std::vector<unsigned char>& available_servers,
     bool is_retry,
@@ -263,7 +288,8 @@ bool Shard::ProcessCreation(const std::shared_ptr<engine::ev::ThreadPool>& redis
     // https://github.com/boostorg/signals2/issues/59
     // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDelete)
     for (const auto& id : need_to_create) {
-        const auto redis_settings = RedisCreationSettings{id.GetConnectionSecurity(), cluster_mode_ && id.IsReadOnly()};
+        const auto redis_settings =
+            RedisCreationSettings{id.GetConnectionSecurity(), cluster_mode_ && id.IsReadOnly(), near_cache_};
         ConnectionStatus entry{
             id,
             std::make_shared<Redis>(
@@ -434,6 +460,8 @@ void Shard::SetRetryBudgetSettings(const utils::RetryBudgetSettings& retry_budge
     retry_budget_settings_.Set(std::make_shared<utils::RetryBudgetSettings>(retry_budget_settings));
 }
 
+void Shard::SetNearCache(std::shared_ptr<NearCache> near_cache) { near_cache_ = std::move(near_cache); }
+
 std::vector<ConnectionInfoInt> Shard::GetConnectionInfosToCreate() const {
     std::shared_lock lock(mutex_);
 
@@ -98,12 +98,15 @@ public:
     void SetCommandsBufferingSettings(CommandsBufferingSettings commands_buffering_settings);
     void SetReplicationMonitoringSettings(const ReplicationMonitoringSettings& replication_monitoring_settings);
     void SetRetryBudgetSettings(const utils::RetryBudgetSettings& replication_monitoring_settings);
+    /// Must be called before the instances are created
+    void SetNearCache(std::shared_ptr<NearCache> near_cache);
 
 private:
     std::vector<unsigned char>
     GetAvailableServers(const CommandControl& command_control, bool with_masters, bool with_slaves) const;
     std::vector<unsigned char>
     GetNearestServersPing(const CommandControl& command_control, bool with_masters, bool with_slaves) const;
+    std::vector<unsigned char> GetLeastLoadedServers(bool with_masters, bool with_slaves) const;
 
     std::vector<ConnectionInfoInt> GetConnectionInfosToCreate() const;
     bool UpdateCleanWaitQueue(std::vector<ConnectionStatus>&& add_clean_wait);
@@ -128,6 +131,7 @@ private:
 
     utils::SwappingSmart<CommandsBufferingSettings> commands_buffering_settings_;
     utils::SwappingSmart<utils::RetryBudgetSettings> retry_budget_settings_;
+    std::shared_ptr<NearCache> near_cache_;
 
     bool prev_connected_ = false;
     const bool cluster_mode_ = false;
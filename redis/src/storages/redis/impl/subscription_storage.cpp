@@ -444,9 +444,10 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<CallbackMap, PcallbackMap>
     try {
         const std::lock_guard<std::mutex> lock(mutex_);
         auto& m = callback_map_.at(channel);
+        const auto shared_message = std::make_shared<const std::string>(message);
         for (const auto& it : m.callbacks) {
             try {
-                const auto result = it.second(channel, message);
+                const auto result = it.second(channel, shared_message);
                 switch (result) {
                     case SubscribedCallbackOutcome::kOk:
                         break;  // do nothing
@@ -479,9 +480,10 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<CallbackMap, PcallbackMap>
     try {
         const std::lock_guard<std::mutex> lock(mutex_);
         auto& m = pattern_callback_map_.at(pattern);
+        const auto shared_message = std::make_shared<const std::string>(message);
         for (const auto& it : m.callbacks) {
             try {
-                const auto result = it.second(pattern, channel, message);
+                const auto result = it.second(pattern, channel, shared_message);
                 switch (result) {
                     case SubscribedCallbackOutcome::kOk:
                         break;  // do nothing
@@ -513,9 +515,10 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<CallbackMap, PcallbackMap>
     try {
         const std::lock_guard<std::mutex> lock(mutex_);
         auto& m = sharded_callback_map_.at(channel);
+        const auto shared_message = std::make_shared<const std::string>(message);
         for (const auto& it : m.callbacks) {
             try {
-                const auto result = it.second(channel, message);
+                const auto result = it.second(channel, shared_message);
                 switch (result) {
                     case SubscribedCallbackOutcome::kOk:
                         break;  // do nothing
@@ -78,6 +78,7 @@ CommandsBufferingSettings Parse(const formats::json::Value& elem, formats::parse
     result.commands_buffering_threshold = elem["commands_buffering_threshold"].As<size_t>(0);
     result.watch_command_timer_interval =
         std::chrono::microseconds(elem["watch_command_timer_interval_us"].As<size_t>());
+    result.max_in_flight_commands = elem["max_in_flight_commands"].As<size_t>(0);
     return result;
 }
 
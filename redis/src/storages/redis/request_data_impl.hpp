@@ -1,13 +1,23 @@
 #pragma once
 
+#include <deque>
+#include <functional>
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
+#include <fmt/format.h>
+
+#include <storages/redis/impl/near_cache.hpp>
 #include <storages/redis/impl/request.hpp>
+#include <storages/redis/impl/script_cache.hpp>
 #include <userver/storages/redis/base.hpp>
 #include <userver/utils/assert.hpp>
 
 #include <userver/storages/redis/client.hpp>
+#include <userver/storages/redis/exception.hpp>
 #include <userver/storages/redis/parse_reply.hpp>
 #include <userver/storages/redis/request_data_base.hpp>
 
@@ -66,6 +76,93 @@ private:
     impl::Request request_;
 };
 
+template <typename Result, typename ReplyType>
+class NearCacheRequestDataImpl final : public RequestDataBase<ReplyType> {
+public:
+    NearCacheRequestDataImpl(impl::Request&& request, impl::NearCache::Fetch&& fetch)
+        : request_(std::move(request)), fetch_(std::move(fetch)) {}
+
+    void Wait() override { impl::Wait(request_); }
+
+    ReplyType Get(const std::string& request_description) override {
+        auto reply = GetReply();
+        return ParseReply<Result, ReplyType>(std::move(reply), request_description);
+    }
+
+    ReplyPtr GetRaw() override { return GetReply(); }
+
+    engine::impl::ContextAccessor* TryGetContextAccessor() noexcept override {
+        return request_.TryGetContextAccessor();
+    }
+
+private:
+    ReplyPtr GetReply() {
+        auto reply = request_.Get();
+        fetch_.Finish(reply);
+        return reply;
+    }
+
+    impl::Request request_;
+    impl::NearCache::Fetch fetch_;
+};
+
+/// EVAL or EVALSHA of a tracked script. EVALSHA that failed with NOSCRIPT is
+/// resent as EVAL with the script text, which loads the script again.
+template <typename Result, typename ReplyType>
+class EvalRequestDataImpl final : public RequestDataBase<ReplyType> {
+public:
+    using Fallback = std::function<impl::Request()>;
+
+    EvalRequestDataImpl(
+        impl::Request&& request,
+        std::shared_ptr<impl::ScriptCache> script_cache,
+        impl::ScriptCache::ScriptPtr script,
+        size_t shard,
+        Fallback fallback
+    )
+        : request_(std::move(request)),
+          script_cache_(std::move(script_cache)),
+          script_(std::move(script)),
+          shard_(shard),
+          fallback_(std::move(fallback)) {}
+
+    void Wait() override { impl::Wait(request_); }
+
+    ReplyType Get(const std::string& request_description) override {
+        auto reply = GetReply();
+        return ParseReply<Result, ReplyType>(std::move(reply), request_description);
+    }
+
+    ReplyPtr GetRaw() override { return GetReply(); }
+
+    engine::impl::ContextAccessor* TryGetContextAccessor() noexcept override {
+        return request_.TryGetContextAccessor();
+    }
+
+private:
+    static bool IsNoScriptError(const ReplyPtr& reply) {
+        return reply->data.IsError() && reply->data.GetError().rfind("NOSCRIPT", 0) == 0;
+    }
+
+    ReplyPtr GetReply() {
+        auto reply = request_.Get();
+        if (fallback_ && IsNoScriptError(reply)) {
+            script_cache_->AccountNoScript();
+            script_->SetLoaded(shard_, false);
+            request_ = std::exchange(fallback_, {})();
+            reply = request_.Get();
+        }
+        if (reply->IsOk() && !reply->data.IsError()) script_->SetLoaded(shard_, true);
+        return reply;
+    }
+
+    impl::Request request_;
+    std::shared_ptr<impl::ScriptCache> script_cache_;
+    impl::ScriptCache::ScriptPtr script_;
+    size_t shard_;
+    Fallback fallback_;
+};
+
 template <typename Result, typename ReplyType>
 class AggregateRequestDataImpl final : public RequestDataBase<ReplyType> {
     using RequestDataPtr = std::unique_ptr<RequestDataBase<ReplyType>>;
@@ -102,6 +199,84 @@ private:
     std::vector<RequestDataPtr> requests_;
 };
 
+/// Multi-key command split by the cluster hash slots. Sub-requests are sent
+/// concurrently, the replies are merged back in the order of the keys.
+template <typename Result, typename ReplyType>
+class SlotSplitRequestDataImpl final : public RequestDataBase<ReplyType> {
+public:
+    SlotSplitRequestDataImpl(
+        std::vector<impl::Request>&& requests,
+        std::vector<std::vector<size_t>>&& positions,
+        size_t keys_count
+    )
+        : requests_(std::move(requests)), positions_(std::move(positions)), keys_count_(keys_count) {
+        UASSERT(requests_.size() == positions_.size());
+    }
+
+    void Wait() override {
+        for (auto& request : requests_) impl::Wait(request);
+    }
+
+    ReplyType Get(const std::string& request_description) override {
+        std::vector<ReplyPtr> replies;
+        replies.reserve(requests_.size());
+        size_t failed = 0;
+        for (auto& request : requests_) {
+            replies.push_back(request.Get());
+            if (!replies.back()->IsOk() || replies.back()->data.IsError()) ++failed;
+        }
+
+        auto description = request_description;
+        if (failed) {
+            description = fmt::format(
+                "{} ({} of {} sub-requests failed)",
+                request_description.empty() ? replies.front()->cmd : request_description,
+                failed,
+                replies.size()
+            );
+        }
+
+        if constexpr (std::is_void_v<ReplyType>) {
+            for (auto& reply : replies) ParseReply<Result, ReplyType>(std::move(reply), description);
+        } else if constexpr (std::is_integral_v<ReplyType>) {
+            ReplyType result{};
+            for (auto& reply : replies) result += ParseReply<Result, ReplyType>(std::move(reply), description);
+            return result;
+        } else {
+            ReplyType result(keys_count_);
+            for (size_t i = 0; i < replies.size(); ++i) {
+                auto data = ParseReply<Result, ReplyType>(std::move(replies[i]), description);
+                const auto& positions = positions_[i];
+                if (data.size() != positions.size()) {
+                    throw ParseReplyException(fmt::format(
+                        "Unexpected redis reply to '{}' request: expected {} elements, got {}",
+                        description,
+                        positions.size(),
+                        data.size()
+                    ));
+                }
+                for (size_t j = 0; j < positions.size(); ++j) result[positions[j]] = std::move(data[j]);
+            }
+            return result;
+        }
+    }
+
+    ReplyPtr GetRaw() override {
+        UASSERT_MSG(false, "Unsupported");
+        return {};
+    }
+
+    engine::impl::ContextAccessor* TryGetContextAccessor() noexcept override {
+        UASSERT_MSG(false, "Not implemented");
+        return nullptr;
+    }
+
+private:
+    std::vector<impl::Request> requests_;
+    std::vector<std::vector<size_t>> positions_;
+    size_t keys_count_;
+};
+
 template <typename Result, typename ReplyType>
 class DummyRequestDataImpl final : public RequestDataBase<ReplyType> {
 public:
@@ -248,6 +423,72 @@ void RequestScanData<scan_tag>::CheckReply() {
     }
 }
 
+/// Scans the shards one after another while keeping up to `parallel_shards`
+/// of them in progress, so the first pages of the next shards are already
+/// received by the time the keys of the current one are taken.
+class RequestScanAllShardsData final : public RequestScanDataBase<ScanTag::kScan> {
+public:
+    RequestScanAllShardsData(
+        std::shared_ptr<ClientImpl> client,
+        std::vector<size_t> shards,
+        size_t parallel_shards,
+        ScanOptions options,
+        const CommandControl& command_control
+    )
+        : client_(std::move(client)),
+          shards_(std::move(shards)),
+          parallel_shards_(parallel_shards),
+          options_(std::move(options)),
+          command_control_(command_control) {
+        UASSERT(parallel_shards_ > 0);
+        StartShards();
+    }
+
+    ReplyElem Get() override {
+        if (Eof()) throw RequestScan::GetAfterEofException("Trying to Get() after eof");
+        return active_.front()->Get();
+    }
+
+    ReplyElem& Current() override {
+        if (Eof()) throw RequestScan::GetAfterEofException("Trying to call Current() after eof");
+        return active_.front()->Current();
+    }
+
+    bool Eof() override {
+        while (!active_.empty()) {
+            auto& front = *active_.front();
+            if (!front_described_) {
+                front.SetRequestDescription(request_description_);
+                front_described_ = true;
+            }
+            if (!front.Eof()) return false;
+            active_.pop_front();
+            front_described_ = false;
+            StartShards();
+        }
+        return true;
+    }
+
+private:
+    void StartShards() {
+        while (active_.size() < parallel_shards_ && next_shard_ < shards_.size()) {
+            active_.push_back(std::make_unique<RequestScanData<ScanTag::kScan>>(
+                client_, shards_[next_shard_++], options_, command_control_
+            ));
+        }
+    }
+
+    std::shared_ptr<ClientImpl> client_;
+    std::vector<size_t> shards_;
+    size_t parallel_shards_;
+    ScanOptions options_;
+    CommandControl command_control_;
+
+    size_t next_shard_{0};
+    std::deque<std::unique_ptr<RequestScanData<ScanTag::kScan>>> active_;
+    bool front_described_{false};
+};
+
 }  // namespace storages::redis
 
 USERVER_NAMESPACE_END
@@ -30,6 +30,37 @@ Request CreateAggregateRequest(std::vector<impl::Request>&& requests) {
     return Request(std::make_unique<ThisAggregateRequestDataImpl>(std::move(req_data)));
 }
 
+template <typename Request>
+Request CreateSlotSplitRequest(
+    std::vector<impl::Request>&& requests,
+    std::vector<std::vector<size_t>>&& positions,
+    size_t keys_count
+) {
+    return Request(std::make_unique<SlotSplitRequestDataImpl<typename Request::Result, typename Request::Reply>>(
+        std::move(requests), std::move(positions), keys_count
+    ));
+}
+
+template <typename Request>
+Request CreateNearCacheRequest(impl::Request&& request, impl::NearCache::Fetch&& fetch) {
+    return Request(std::make_unique<NearCacheRequestDataImpl<typename Request::Result, typename Request::Reply>>(
+        std::move(request), std::move(fetch)
+    ));
+}
+
+template <typename Request>
+Request CreateEvalRequest(
+    impl::Request&& request,
+    std::shared_ptr<impl::ScriptCache> script_cache,
+    impl::ScriptCache::ScriptPtr script,
+    size_t shard,
+    typename EvalRequestDataImpl<typename Request::Result, typename Request::Reply>::Fallback fallback = {}
+) {
+    return Request(std::make_unique<EvalRequestDataImpl<typename Request::Result, typename Request::Reply>>(
+        std::move(request), std::move(script_cache), std::move(script), shard, std::move(fallback)
+    ));
+}
+
 template <typename Request>
 Request CreateDummyRequest(ReplyPtr reply) {
     return Request(
@@ -49,12 +49,12 @@ SubscriptionQueue<Item>::GetSubscriptionToken(
 ) {
     return subscribe_sentinel.Subscribe(
         channel,
-        [this](const std::string& channel, const std::string& message) {
+        [this](const std::string& channel, const SharedMessage& message) {
             Outcome result{Outcome::kOk};
             if (!producer_.PushNoblock(Item(message))) {
                 // Use SubscriptionQueue::SetMaxLength() or
                 // SubscriptionToken::SetMaxQueueLength() if limit is too low
-                LOG_ERROR() << "failed to push message '" << message << "' from channel '" << channel
+                LOG_ERROR() << "failed to push message '" << *message << "' from channel '" << channel
                             << "' into subscription queue due to overflow (max length=" << queue_->GetSoftMaxSize()
                             << ')';
                 // either this line
@@ -77,12 +77,12 @@ SubscriptionQueue<Item>::GetSubscriptionToken(
 ) {
     return subscribe_sentinel.Psubscribe(
         pattern,
-        [this](const std::string& pattern, const std::string& channel, const std::string& message) {
+        [this](const std::string& pattern, const std::string& channel, const SharedMessage& message) {
             Outcome result{Outcome::kOk};
             if (!producer_.PushNoblock(Item(channel, message))) {
                 // Use SubscriptionQueue::SetMaxLength() or
                 // SubscriptionToken::SetMaxQueueLength() if limit is too low
-                LOG_ERROR() << "failed to push pmessage '" << message << "' from channel '" << channel
+                LOG_ERROR() << "failed to push pmessage '" << *message << "' from channel '" << channel
                             << "' from pattern '" << pattern
                             << "' into subscription queue due to overflow (max length=" << queue_->GetSoftMaxSize()
                             << ')';
@@ -106,12 +106,12 @@ SubscriptionQueue<Item>::GetSubscriptionToken(
 ) {
     return subscribe_sentinel.Ssubscribe(
         channel,
-        [this](const std::string& channel, const std::string& message) {
+        [this](const std::string& channel, const SharedMessage& message) {
             Outcome result{Outcome::kOk};
             if (!producer_.PushNoblock(Item(message))) {
                 // Use SubscriptionQueue::SetMaxLength() or
                 // SubscriptionToken::SetMaxQueueLength() if limit is too low
-                LOG_ERROR() << "failed to push message '" << message << "' from channel '" << channel
+                LOG_ERROR() << "failed to push message '" << *message << "' from channel '" << channel
                             << "' into subscription queue due to overflow (max length=" << queue_->GetSoftMaxSize()
                             << ')';
                 // either this line
@@ -10,27 +10,30 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::redis {
 
+// The message is shared by the queues of all the local subscribers of the channel
+using SharedMessage = impl::Sentinel::SharedMessage;
+
 struct ChannelSubscriptionQueueItem {
-    std::string message;
+    SharedMessage message;
 
     ChannelSubscriptionQueueItem() = default;
-    explicit ChannelSubscriptionQueueItem(std::string message) : message(std::move(message)) {}
+    explicit ChannelSubscriptionQueueItem(SharedMessage message) : message(std::move(message)) {}
 };
 
 struct PatternSubscriptionQueueItem {
     std::string channel;
-    std::string message;
+    SharedMessage message;
 
     PatternSubscriptionQueueItem() = default;
-    PatternSubscriptionQueueItem(std::string channel, std::string message)
+    PatternSubscriptionQueueItem(std::string channel, SharedMessage message)
         : channel(std::move(channel)), message(std::move(message)) {}
 };
 
 struct ShardedSubscriptionQueueItem {
-    std::string message;
+    SharedMessage message;
 
     ShardedSubscriptionQueueItem() = default;
-    explicit ShardedSubscriptionQueueItem(std::string message) : message(std::move(message)) {}
+    explicit ShardedSubscriptionQueueItem(SharedMessage message) : message(std::move(message)) {}
 };
 
 template <typename Item>
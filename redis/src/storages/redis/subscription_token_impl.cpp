@@ -39,7 +39,7 @@ void SubscriptionTokenImpl::ProcessMessages() {
     ChannelSubscriptionQueueItem msg;
     while (queue_.PopMessage(msg)) {
         tracing::Span span(std::string{kProcessRedisSubscriptionMessage});
-        if (on_message_cb_) on_message_cb_(channel_, msg.message);
+        if (on_message_cb_) on_message_cb_(channel_, *msg.message);
     }
 }
 
@@ -67,7 +67,7 @@ void PsubscriptionTokenImpl::ProcessMessages() {
     PatternSubscriptionQueueItem msg;
     while (queue_.PopMessage(msg)) {
         tracing::Span span(std::string{kProcessRedisSubscriptionMessage});
-        if (on_pmessage_cb_) on_pmessage_cb_(pattern_, msg.channel, msg.message);
+        if (on_pmessage_cb_) on_pmessage_cb_(pattern_, msg.channel, *msg.message);
     }
 }
 
@@ -95,7 +95,7 @@ void SsubscriptionTokenImpl::ProcessMessages() {
     ShardedSubscriptionQueueItem msg;
     while (queue_.PopMessage(msg)) {
         tracing::Span span(std::string{kProcessRedisSubscriptionMessage});
-        if (on_message_cb_) on_message_cb_(channel_, msg.message);
+        if (on_message_cb_) on_message_cb_(channel_, *msg.message);
     }
 }
 
@@ -253,6 +253,9 @@ public:
 
     ScanRequest<ScanTag::kScan> Scan(size_t shard, ScanOptions options, const CommandControl& command_control) override;
 
+    ScanRequest<ScanTag::kScan>
+    ScanAllShards(ScanOptions options, size_t parallel_shards, const CommandControl& command_control) override;
+
     RequestScard Scard(std::string key, const CommandControl& command_control) override;
 
     RequestSet Set(std::string key, std::string value, const CommandControl& command_control) override;
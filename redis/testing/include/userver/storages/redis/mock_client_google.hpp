@@ -301,6 +301,13 @@ public:
         (override)
     );
 
+    MOCK_METHOD(
+        RequestScan,
+        ScanAllShards,
+        (ScanOptions options, size_t parallel_shards, const CommandControl& command_control),
+        (override)
+    );
+
     MOCK_METHOD(RequestScard, Scard, (std::string key, const CommandControl& command_control), (override));
 
     MOCK_METHOD(
@@ -471,6 +471,15 @@ ScanRequest<ScanTag::kScan> MockClientBase::
     return ScanRequest<ScanTag::kScan>{nullptr};
 }
 
+ScanRequest<ScanTag::kScan> MockClientBase::ScanAllShards(
+    ScanOptionsTmpl<ScanTag::kScan> /*options*/,
+    size_t /*parallel_shards*/,
+    const CommandControl& /*command_control*/
+) {
+    UASSERT_MSG(false, "redis method not mocked");
+    return ScanRequest<ScanTag::kScan>{nullptr};
+}
+
 RequestScard MockClientBase::Scard(std::string /*key*/, const CommandControl& /*command_control*/) {
     UASSERT_MSG(false, "redis method not mocked");
     return RequestScard{nullptr};
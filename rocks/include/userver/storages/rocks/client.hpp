@@ -3,23 +3,38 @@
 /// @file userver/storages/rocks/client.hpp
 /// @brief @copybrief storages::rocks::Client
 
+#include <cstddef>
+#include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include <rocksdb/db.h>
 
 #include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/storages/rocks/settings.hpp>
+#include <userver/storages/rocks/write_batch.hpp>
+#include <userver/utils/function_ref.hpp>
+#include <userver/utils/statistics/fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::rocks {
 
+namespace impl {
+class Database;
+}  // namespace impl
+
 /**
  * @brief Client for working with RocksDB storage.
  *
  * This class provides an interface for interacting with the RocksDB database.
  * To use the class, you need to specify the database path when creating an
  * object.
+ *
+ * A client works with a single column family of the database, the clients of
+ * the other column families are made with Client::ForColumnFamily.
  */
 class Client final {
 public:
@@ -30,7 +45,26 @@ public:
      * @param blocking_task_processor - task processor to execute blocking FS
      * operations
      */
-    Client(const std::string& db_path, engine::TaskProcessor& blocking_task_processor);
+    Client(
+        const std::string& db_path,
+        engine::TaskProcessor& blocking_task_processor,
+        const ClientSettings& settings = {}
+    );
+
+    /**
+     * @brief Returns a client of another column family of the same database.
+     *
+     * @param column_family The name of the column family, it must be listed
+     * in ClientSettings::column_families.
+     * @throws storages::rocks::Exception if there is no such column family
+     */
+    Client ForColumnFamily(std::string_view column_family) const;
+
+    /**
+     * @brief Returns an empty batch of updates of the column family of the
+     * client.
+     */
+    WriteBatch MakeWriteBatch() const;
 
     /**
      * @brief Puts a record into the database.
@@ -54,6 +88,58 @@ public:
      */
     void Delete(std::string_view key);
 
+    /**
+     * @brief Retrieves the values of several records from the database in a
+     * single blocking operation.
+     *
+     * @param keys The keys of the records.
+     * @return The values in the order of the keys, std::nullopt for the keys
+     * that are not found.
+     */
+    std::vector<std::optional<std::string>> MultiGet(const std::vector<std::string_view>& keys);
+
+    /**
+     * @brief Applies all the updates of the batch atomically.
+     *
+     * The batch may contain the updates of several column families of the
+     * database.
+     *
+     * @param batch The updates to apply.
+     */
+    void Write(WriteBatch&& batch);
+
+    /// Callback of the iteration, the key and the value are only valid
+    /// during the call
+    using IterationCallback = utils::function_ref<void(std::string_view key, std::string_view value)>;
+
+    /**
+     * @brief Calls `func` for each record with the key in [begin, end) in
+     * the order of the keys.
+     *
+     * The records are read from a consistent snapshot of the database on the
+     * blocking task processor by chunks of at most `prefetch_size` records,
+     * `func` is called in the current task.
+     *
+     * @param begin The first key of the range.
+     * @param end The key after the range, std::nullopt to iterate to the end.
+     * @param prefetch_size The maximum number of records read at once.
+     * @param func The callback to call for each record.
+     */
+    void ForEachInRange(
+        std::string_view begin,
+        std::optional<std::string_view> end,
+        std::size_t prefetch_size,
+        IterationCallback func
+    );
+
+    /**
+     * @brief Calls `func` for each record with the key that starts with
+     * `prefix` in the order of the keys.
+     *
+     * @see ForEachInRange
+     */
+    void ForEachWithPrefix(std::string_view prefix, std::size_t prefetch_size, IterationCallback func);
+
     /**
      * Checks the status of an operation and handles any errors based on the given
      * method name.
@@ -63,8 +149,19 @@ public:
      */
     void CheckStatus(rocksdb::Status status, std::string_view method_name);
 
+    /// Writes the RocksDB statistics of the whole database
+    friend void DumpMetric(utils::statistics::Writer& writer, const Client& client);
+
 private:
-    std::unique_ptr<rocksdb::DB> db_;
+    Client(
+        std::shared_ptr<impl::Database> database,
+        rocksdb::ColumnFamilyHandle* column_family,
+        engine::TaskProcessor& blocking_task_processor
+    );
+
+    std::shared_ptr<impl::Database> database_;
+    rocksdb::DB* db_;
+    rocksdb::ColumnFamilyHandle* column_family_;
     engine::TaskProcessor& blocking_task_processor_;
 };
 }  // namespace storages::rocks
@@ -3,11 +3,14 @@
 /// @file userver/storages/rocks/component.hpp
 /// @brief @copybrief rocks::Rocks
 
+#include <string_view>
+
 #include <userver/components/component_base.hpp>
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/storages/rocks/client_fwd.hpp>
+#include <userver/utils/statistics/entry.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -18,11 +21,23 @@ namespace storages::rocks {
 /// @ingroup userver_components
 ///
 /// @brief RocksDB client component.
+///
+/// The component opens a database with the default column family and the
+/// column families listed in `column-families`. Its statistics are written
+/// with the `rocks` prefix.
+///
 /// ## Static options:
 /// Name                               | Description                                      | Default value
 /// ---------------------------------- | ------------------------------------------------ | ---------------
 /// task-processor                     | name of the task processor to run the blocking file operations | -
 /// db-path                            | path to database file                            | -
+/// column-families                    | column families besides the default one, created if missing | []
+/// column-families.[].name            | name of the column family                        | -
+/// column-families.[].bloom-filter-bits-per-key | bits per key of the bloom filters, 0 disables them | 0
+/// bloom-filter-bits-per-key          | bits per key of the bloom filters of the default column family | 0
+/// block-cache-size                   | size of the LRU block cache in bytes, 0 means the RocksDB default | 0
+/// shared-block-cache                 | share the block cache with the other rocks components, with the largest of their sizes | false
+/// collect-statistics                 | collect the RocksDB tickers, such as block cache hits and write stall time | false
 
 // clang-format on
 
@@ -30,14 +45,20 @@ class Component : public components::ComponentBase {
 public:
     Component(const components::ComponentConfig&, const components::ComponentContext&);
 
-    ~Component() = default;
+    ~Component() override;
 
+    /// Returns the client of the default column family
     storages::rocks::ClientPtr MakeClient();
 
+    /// @brief Returns the client of the column family
+    /// @throws storages::rocks::Exception if there is no such column family
+    storages::rocks::ClientPtr MakeClient(std::string_view column_family);
+
     static yaml_config::Schema GetStaticConfigSchema();
 
 private:
     storages::rocks::ClientPtr client_ptr_;
+    utils::statistics::Entry statistics_holder_;
 };
 
 }  // namespace storages::rocks
@@ -0,0 +1,45 @@
+#pragma once
+
+/// @file userver/storages/rocks/settings.hpp
+/// @brief Settings of storages::rocks::Client
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <rocksdb/cache.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks {
+
+/// @brief Settings of a column family of storages::rocks::Client
+struct ColumnFamilySettings final {
+    /// Name of the column family
+    std::string name;
+
+    /// Bits per key of the bloom filters of the SST files, 0 disables the
+    /// filters. 10 bits per key give ~1% of false positives.
+    double bloom_filter_bits_per_key{0};
+};
+
+/// @brief Settings of the database of storages::rocks::Client
+struct ClientSettings final {
+    /// Column families besides the default one, they are created if missing
+    std::vector<ColumnFamilySettings> column_families;
+
+    /// Bits per key of the bloom filters of the default column family
+    double bloom_filter_bits_per_key{0};
+
+    /// Block cache of all the column families, may be shared by several
+    /// databases. nullptr means a RocksDB default cache per column family.
+    std::shared_ptr<rocksdb::Cache> block_cache;
+
+    /// Collect the RocksDB tickers (cache hits, stalls, etc.), which costs a
+    /// few percent of throughput
+    bool collect_statistics{false};
+};
+
+}  // namespace storages::rocks
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,61 @@
+#pragma once
+
+/// @file userver/storages/rocks/write_batch.hpp
+/// @brief @copybrief storages::rocks::WriteBatch
+
+#include <cstddef>
+#include <string_view>
+
+#include <rocksdb/write_batch.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks {
+
+class Client;
+
+/**
+ * @brief A set of updates that storages::rocks::Client::Write applies
+ * atomically.
+ *
+ * The keys and the values are copied into the batch. A default constructed
+ * batch updates the default column family, see Client::MakeWriteBatch.
+ */
+class WriteBatch final {
+public:
+    WriteBatch() = default;
+
+    /**
+     * @brief Adds a record to put into the database.
+     *
+     * @param key The key of the record.
+     * @param value The value of the record.
+     */
+    void Put(std::string_view key, std::string_view value);
+
+    /**
+     * @brief Adds a key to delete from the database.
+     *
+     * @param key The key of the record to be deleted.
+     */
+    void Delete(std::string_view key);
+
+    /// @brief Returns the number of the updates in the batch.
+    std::size_t Size() const;
+
+    /// @brief Removes all the updates from the batch.
+    void Clear();
+
+private:
+    friend class Client;
+
+    explicit WriteBatch(rocksdb::ColumnFamilyHandle* column_family) : column_family_(column_family) {}
+
+    // nullptr means the default column family
+    rocksdb::ColumnFamilyHandle* column_family_{nullptr};
+    rocksdb::WriteBatch batch_;
+};
+
+}  // namespace storages::rocks
+
+USERVER_NAMESPACE_END
@@ -1,28 +1,54 @@
 #include <userver/storages/rocks/client.hpp>
 
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <utility>
+
 #include <fmt/format.h>
 
+#include <rocksdb/statistics.h>
+
 #include <userver/storages/rocks/exception.hpp>
 #include <userver/utils/async.hpp>
+#include <userver/utils/statistics/rate.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+#include <storages/rocks/database.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::rocks {
 
-Client::Client(const std::string& db_path, engine::TaskProcessor& blocking_task_processor)
-    : blocking_task_processor_(blocking_task_processor) {
-    rocksdb::Options options;
-    options.create_if_missing = true;
+Client::Client(
+    const std::string& db_path,
+    engine::TaskProcessor& blocking_task_processor,
+    const ClientSettings& settings
+)
+    : database_(std::make_shared<impl::Database>(db_path, settings)),
+      db_(&database_->Get()),
+      column_family_(db_->DefaultColumnFamily()),
+      blocking_task_processor_(blocking_task_processor) {}
 
-    rocksdb::DB* db{};
-    rocksdb::Status status = rocksdb::DB::Open(options, db_path, &db);
-    db_.reset(db);
-    CheckStatus(status, "Create client");
+Client::Client(
+    std::shared_ptr<impl::Database> database,
+    rocksdb::ColumnFamilyHandle* column_family,
+    engine::TaskProcessor& blocking_task_processor
+)
+    : database_(std::move(database)),
+      db_(&database_->Get()),
+      column_family_(column_family),
+      blocking_task_processor_(blocking_task_processor) {}
+
+Client Client::ForColumnFamily(std::string_view column_family) const {
+    return Client{database_, database_->GetColumnFamily(column_family), blocking_task_processor_};
 }
 
+WriteBatch Client::MakeWriteBatch() const { return WriteBatch{column_family_}; }
+
 void Client::Put(std::string_view key, std::string_view value) {
     engine::AsyncNoSpan(blocking_task_processor_, [this, key, value] {
-        rocksdb::Status status = db_->Put(rocksdb::WriteOptions(), key, value);
+        rocksdb::Status status = db_->Put(rocksdb::WriteOptions(), column_family_, key, value);
         CheckStatus(status, "Put");
     }).Get();
 }
@@ -32,7 +58,7 @@ std::string Client::Get(std::string_view key) {
                blocking_task_processor_,
                [this, key] {
                    std::string res;
-                   rocksdb::Status status = db_->Get(rocksdb::ReadOptions(), key, &res);
+                   rocksdb::Status status = db_->Get(rocksdb::ReadOptions(), column_family_, key, &res);
                    CheckStatus(status, "Get");
                    return res;
                }
@@ -43,12 +69,144 @@ void Client::Delete(std::string_view key) {
     return engine::AsyncNoSpan(
                blocking_task_processor_,
                [this, key] {
-                   rocksdb::Status status = db_->Delete(rocksdb::WriteOptions(), key);
+                   rocksdb::Status status = db_->Delete(rocksdb::WriteOptions(), column_family_, key);
                    CheckStatus(status, "Delete");
                }
     ).Get();
 }
 
+std::vector<std::optional<std::string>> Client::MultiGet(const std::vector<std::string_view>& keys) {
+    return engine::AsyncNoSpan(
+               blocking_task_processor_,
+               [this, &keys] {
+                   // RocksDB looks sorted keys up faster
+                   std::vector<std::size_t> order(keys.size());
+                   std::iota(order.begin(), order.end(), std::size_t{0});
+                   std::sort(order.begin(), order.end(), [&keys](std::size_t lhs, std::size_t rhs) {
+                       return keys[lhs] < keys[rhs];
+                   });
+
+                   std::vector<rocksdb::Slice> sorted_keys;
+                   sorted_keys.reserve(keys.size());
+                   for (const auto index : order) sorted_keys.emplace_back(keys[index]);
+
+                   std::vector<rocksdb::PinnableSlice> values(keys.size());
+                   std::vector<rocksdb::Status> statuses(keys.size());
+                   db_->MultiGet(
+                       rocksdb::ReadOptions(),
+                       column_family_,
+                       keys.size(),
+                       sorted_keys.data(),
+                       values.data(),
+                       statuses.data(),
+                       /*sorted_input=*/true
+                   );
+
+                   std::vector<std::optional<std::string>> result(keys.size());
+                   for (std::size_t i = 0; i < order.size(); ++i) {
+                       CheckStatus(statuses[i], "MultiGet");
+                       if (statuses[i].ok()) result[order[i]].emplace(values[i].ToString());
+                   }
+                   return result;
+               }
+    ).Get();
+}
+
+void Client::Write(WriteBatch&& batch) {
+    engine::AsyncNoSpan(blocking_task_processor_, [this, &batch] {
+        rocksdb::Status status = db_->Write(rocksdb::WriteOptions(), &batch.batch_);
+        CheckStatus(status, "Write");
+    }).Get();
+}
+
+void Client::ForEachInRange(
+    std::string_view begin,
+    std::optional<std::string_view> end,
+    std::size_t prefetch_size,
+    IterationCallback func
+) {
+    prefetch_size = std::max(prefetch_size, std::size_t{1});
+
+    // Must outlive the iterator
+    const std::string upper_bound{end.value_or(std::string_view{})};
+    const rocksdb::Slice upper_bound_slice{upper_bound};
+    rocksdb::ReadOptions read_options;
+    if (end) read_options.iterate_upper_bound = &upper_bound_slice;
+
+    std::unique_ptr<rocksdb::Iterator> iterator;
+    std::vector<std::pair<std::string, std::string>> chunk;
+    chunk.reserve(prefetch_size);
+
+    bool is_exhausted = false;
+    while (!is_exhausted) {
+        chunk.clear();
+        engine::AsyncNoSpan(blocking_task_processor_, [&] {
+            if (!iterator) {
+                iterator.reset(db_->NewIterator(read_options, column_family_));
+                iterator->Seek(begin);
+            }
+            for (; iterator->Valid() && chunk.size() < prefetch_size; iterator->Next()) {
+                chunk.emplace_back(iterator->key().ToString(), iterator->value().ToString());
+            }
+            is_exhausted = !iterator->Valid();
+            CheckStatus(iterator->status(), "Iterate");
+            if (is_exhausted) iterator.reset();
+        }).Get();
+
+        for (const auto& [key, value] : chunk) func(key, value);
+    }
+}
+
+void Client::ForEachWithPrefix(std::string_view prefix, std::size_t prefetch_size, IterationCallback func) {
+    // The smallest key greater than all the keys with the prefix
+    std::string end{prefix};
+    while (!end.empty() && static_cast<unsigned char>(end.back()) == 0xff) end.pop_back();
+    if (end.empty()) {
+        ForEachInRange(prefix, std::nullopt, prefetch_size, func);
+        return;
+    }
+    end.back() = static_cast<char>(static_cast<unsigned char>(end.back()) + 1);
+    ForEachInRange(prefix, end, prefetch_size, func);
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const Client& client) {
+    auto& db = *client.db_;
+    const auto write_property = [&db](utils::statistics::Writer&& writer, const std::string& property) {
+        uint64_t value = 0;
+        if (db.GetIntProperty(property, &value)) writer = value;
+    };
+
+    write_property(writer["block_cache"]["usage_bytes"], rocksdb::DB::Properties::kBlockCacheUsage);
+    write_property(writer["block_cache"]["capacity_bytes"], rocksdb::DB::Properties::kBlockCacheCapacity);
+    write_property(writer["memtables_bytes"], rocksdb::DB::Properties::kCurSizeAllMemTables);
+    write_property(writer["compaction"]["running"], rocksdb::DB::Properties::kNumRunningCompactions);
+    write_property(writer["compaction"]["pending_bytes"], rocksdb::DB::Properties::kEstimatePendingCompactionBytes);
+    write_property(writer["write_stall"]["is_stopped"], rocksdb::DB::Properties::kIsWriteStopped);
+    write_property(writer["write_stall"]["delayed_rate"], rocksdb::DB::Properties::kActualDelayedWriteRate);
+
+    for (auto* column_family : client.database_->GetColumnFamilies()) {
+        uint64_t keys = 0;
+        if (db.GetIntProperty(column_family, rocksdb::DB::Properties::kEstimateNumKeys, &keys)) {
+            writer["keys"].ValueWithLabels(keys, {"rocks_column_family", column_family->GetName()});
+        }
+    }
+
+    const auto* statistics = client.database_->GetStatistics();
+    if (!statistics) return;
+    const auto write_ticker = [statistics](utils::statistics::Writer&& writer, rocksdb::Tickers ticker) {
+        writer = utils::statistics::Rate{statistics->getTickerCount(ticker)};
+    };
+
+    write_ticker(writer["block_cache"]["hits"], rocksdb::BLOCK_CACHE_HIT);
+    write_ticker(writer["block_cache"]["misses"], rocksdb::BLOCK_CACHE_MISS);
+    write_ticker(writer["bloom_filter"]["useful"], rocksdb::BLOOM_FILTER_USEFUL);
+    write_ticker(writer["write_stall"]["micros"], rocksdb::STALL_MICROS);
+    write_ticker(writer["compaction"]["read_bytes"], rocksdb::COMPACT_READ_BYTES);
+    write_ticker(writer["compaction"]["write_bytes"], rocksdb::COMPACT_WRITE_BYTES);
+    write_ticker(writer["keys_read"], rocksdb::NUMBER_KEYS_READ);
+    write_ticker(writer["keys_written"], rocksdb::NUMBER_KEYS_WRITTEN);
+}
+
 void Client::CheckStatus(rocksdb::Status status, std::string_view method_name) {
     if (!status.ok() && !status.IsNotFound()) {
         throw USERVER_NAMESPACE::storages::rocks::RequestFailedException(method_name, status.ToString());
@@ -1,4 +1,5 @@
 #include <userver/storages/rocks/client.hpp>
+#include <userver/storages/rocks/exception.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/async.hpp>
 
@@ -24,6 +25,83 @@ UTEST(Rocks, CheckCRUD) {
     EXPECT_EQ("", res);
 }
 
+UTEST(Rocks, MultiGet) {
+    storages::rocks::Client client{"/tmp/rocksdb_multi_get", engine::current_task::GetTaskProcessor()};
+    client.Put("b", "2");
+    client.Put("a", "1");
+    client.Delete("c");
+
+    const auto values = client.MultiGet({"b", "c", "a"});
+    ASSERT_EQ(values.size(), 3);
+    EXPECT_EQ(values[0], "2");
+    EXPECT_EQ(values[1], std::nullopt);
+    EXPECT_EQ(values[2], "1");
+}
+
+UTEST(Rocks, WriteBatch) {
+    storages::rocks::Client client{"/tmp/rocksdb_write_batch", engine::current_task::GetTaskProcessor()};
+    client.Put("deleted", "value");
+
+    storages::rocks::WriteBatch batch;
+    batch.Put("first", "1");
+    batch.Put("second", "2");
+    batch.Delete("deleted");
+    EXPECT_EQ(batch.Size(), 3);
+    client.Write(std::move(batch));
+
+    EXPECT_EQ(client.Get("first"), "1");
+    EXPECT_EQ(client.Get("second"), "2");
+    EXPECT_EQ(client.Get("deleted"), "");
+}
+
+UTEST(Rocks, Iteration) {
+    storages::rocks::Client client{"/tmp/rocksdb_iteration", engine::current_task::GetTaskProcessor()};
+    storages::rocks::WriteBatch batch;
+    for (const auto* key : {"a", "p:1", "p:2", "p:3", "q"}) batch.Put(key, key);
+    client.Write(std::move(batch));
+
+    std::vector<std::string> keys;
+    const auto collect = [&keys](std::string_view key, std::string_view value) {
+        EXPECT_EQ(key, value);
+        keys.emplace_back(key);
+    };
+
+    client.ForEachWithPrefix("p:", 2, collect);
+    EXPECT_EQ(keys, (std::vector<std::string>{"p:1", "p:2", "p:3"}));
+
+    keys.clear();
+    client.ForEachInRange("p:2", "q", 1, collect);
+    EXPECT_EQ(keys, (std::vector<std::string>{"p:2", "p:3"}));
+
+    keys.clear();
+    client.ForEachInRange("p:3", std::nullopt, 10, collect);
+    EXPECT_EQ(keys, (std::vector<std::string>{"p:3", "q"}));
+}
+
+UTEST(Rocks, ColumnFamilies) {
+    storages::rocks::ClientSettings settings;
+    settings.column_families.push_back({"bloom", 10});
+    settings.collect_statistics = true;
+    storages::rocks::Client client{
+        "/tmp/rocksdb_column_families", engine::current_task::GetTaskProcessor(), settings};
+    const auto bloom_client = client.ForColumnFamily("bloom");
+
+    client.Delete("key");
+    bloom_client.Put("key", "value");
+    EXPECT_EQ(bloom_client.Get("key"), "value");
+    EXPECT_EQ(client.Get("key"), "");
+
+    auto batch = bloom_client.MakeWriteBatch();
+    batch.Delete("key");
+    batch.Put("other", "value");
+    client.Write(std::move(batch));
+    EXPECT_EQ(bloom_client.Get("key"), "");
+    EXPECT_EQ(bloom_client.Get("other"), "value");
+    EXPECT_EQ(client.Get("other"), "");
+
+    UEXPECT_THROW(client.ForColumnFamily("missing"), storages::rocks::Exception);
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
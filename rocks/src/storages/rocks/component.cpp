@@ -1,7 +1,12 @@
 #include <userver/storages/rocks/component.hpp>
 
 #include <memory>
+#include <mutex>
+#include <string_view>
 
+#include <rocksdb/cache.h>
+
+#include <userver/components/statistics_storage.hpp>
 #include <userver/storages/rocks/client.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
@@ -9,15 +14,70 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::rocks {
 
+namespace {
+
+// The block cache shared by all the components with `shared-block-cache`, its
+// capacity is the largest of their `block-cache-size`
+std::shared_ptr<rocksdb::Cache> GetSharedBlockCache(std::size_t capacity) {
+    static std::mutex mutex;
+    static std::weak_ptr<rocksdb::Cache> shared_cache;
+
+    const std::lock_guard lock{mutex};
+    auto cache = shared_cache.lock();
+    if (!cache) {
+        cache = rocksdb::NewLRUCache(capacity);
+        shared_cache = cache;
+    } else if (cache->GetCapacity() < capacity) {
+        cache->SetCapacity(capacity);
+    }
+    return cache;
+}
+
+ClientSettings ParseClientSettings(const components::ComponentConfig& config) {
+    ClientSettings settings;
+    settings.bloom_filter_bits_per_key = config["bloom-filter-bits-per-key"].As<double>(0);
+    settings.collect_statistics = config["collect-statistics"].As<bool>(false);
+
+    for (const auto& column_family : config["column-families"]) {
+        settings.column_families.push_back(ColumnFamilySettings{
+            column_family["name"].As<std::string>(),
+            column_family["bloom-filter-bits-per-key"].As<double>(0),
+        });
+    }
+
+    const auto block_cache_size = config["block-cache-size"].As<std::size_t>(0);
+    if (block_cache_size > 0) {
+        settings.block_cache = config["shared-block-cache"].As<bool>(false) ? GetSharedBlockCache(block_cache_size)
+                                                                            : rocksdb::NewLRUCache(block_cache_size);
+    }
+    return settings;
+}
+
+}  // namespace
+
 Component::Component(const components::ComponentConfig& config, const components::ComponentContext& context)
     : ComponentBase(config, context),
       client_ptr_(std::make_shared<storages::rocks::Client>(
           config["db-path"].As<std::string>(),
-          context.GetTaskProcessor(config["task-processor"].As<std::string>())
-      )) {}
+          context.GetTaskProcessor(config["task-processor"].As<std::string>()),
+          ParseClientSettings(config)
+      )) {
+    auto& statistics_storage = context.FindComponent<components::StatisticsStorage>().GetStorage();
+    statistics_holder_ = statistics_storage.RegisterWriter(
+        "rocks",
+        [this](utils::statistics::Writer& writer) { writer = *client_ptr_; },
+        {{"rocks_database", config.Name()}}
+    );
+}
+
+Component::~Component() { statistics_holder_.Unregister(); }
 
 storages::rocks::ClientPtr Component::MakeClient() { return client_ptr_; }
 
+storages::rocks::ClientPtr Component::MakeClient(std::string_view column_family) {
+    return std::make_shared<storages::rocks::Client>(client_ptr_->ForColumnFamily(column_family));
+}
+
 yaml_config::Schema Component::GetStaticConfigSchema() {
     return yaml_config::MergeSchemas<ComponentBase>(R"(
 type: object
@@ -30,6 +90,38 @@ properties:
     db-path:
         type: string
         description: path to database file
+    column-families:
+        type: array
+        description: column families besides the default one, created if missing
+        defaultDescription: '[]'
+        items:
+            type: object
+            description: column family settings
+            additionalProperties: false
+            properties:
+                name:
+                    type: string
+                    description: name of the column family
+                bloom-filter-bits-per-key:
+                    type: number
+                    description: bits per key of the bloom filters, 0 disables them
+                    defaultDescription: 0
+    bloom-filter-bits-per-key:
+        type: number
+        description: bits per key of the bloom filters of the default column family, 0 disables them
+        defaultDescription: 0
+    block-cache-size:
+        type: integer
+        description: size of the LRU block cache in bytes, 0 means the RocksDB default
+        defaultDescription: 0
+    shared-block-cache:
+        type: boolean
+        description: share the block cache with the other rocks components, with the largest of their sizes
+        defaultDescription: false
+    collect-statistics:
+        type: boolean
+        description: collect the RocksDB tickers, such as block cache hits and write stall time
+        defaultDescription: false
 )");
 }
 }  // namespace storages::rocks
@@ -0,0 +1,90 @@
+#include <storages/rocks/database.hpp>
+
+#include <algorithm>
+
+#include <fmt/format.h>
+#include <rocksdb/filter_policy.h>
+#include <rocksdb/table.h>
+
+#include <userver/storages/rocks/exception.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks::impl {
+
+namespace {
+
+rocksdb::ColumnFamilyOptions MakeColumnFamilyOptions(
+    double bloom_filter_bits_per_key,
+    const std::shared_ptr<rocksdb::Cache>& block_cache
+) {
+    rocksdb::BlockBasedTableOptions table_options;
+    if (block_cache) table_options.block_cache = block_cache;
+    if (bloom_filter_bits_per_key > 0) {
+        table_options.filter_policy.reset(rocksdb::NewBloomFilterPolicy(bloom_filter_bits_per_key));
+    }
+
+    rocksdb::ColumnFamilyOptions options;
+    options.table_factory.reset(rocksdb::NewBlockBasedTableFactory(table_options));
+    return options;
+}
+
+void CheckStatus(const rocksdb::Status& status, std::string_view method_name) {
+    if (!status.ok()) throw RequestFailedException(method_name, status.ToString());
+}
+
+}  // namespace
+
+Database::Database(const std::string& db_path, const ClientSettings& settings) {
+    rocksdb::DBOptions db_options;
+    db_options.create_if_missing = true;
+    db_options.create_missing_column_families = true;
+    if (settings.collect_statistics) {
+        statistics_ = rocksdb::CreateDBStatistics();
+        db_options.statistics = statistics_;
+    }
+
+    std::vector<rocksdb::ColumnFamilyDescriptor> descriptors;
+    descriptors.emplace_back(
+        rocksdb::kDefaultColumnFamilyName,
+        MakeColumnFamilyOptions(settings.bloom_filter_bits_per_key, settings.block_cache)
+    );
+    for (const auto& column_family : settings.column_families) {
+        descriptors.emplace_back(
+            column_family.name, MakeColumnFamilyOptions(column_family.bloom_filter_bits_per_key, settings.block_cache)
+        );
+    }
+
+    // RocksDB requires all the existing column families to be opened
+    std::vector<std::string> existing_names;
+    if (rocksdb::DB::ListColumnFamilies(db_options, db_path, &existing_names).ok()) {
+        for (const auto& name : existing_names) {
+            const auto is_configured = std::any_of(descriptors.begin(), descriptors.end(), [&name](const auto& d) {
+                return d.name == name;
+            });
+            if (!is_configured) descriptors.emplace_back(name, MakeColumnFamilyOptions(0, settings.block_cache));
+        }
+    }
+
+    rocksdb::DB* db{};
+    const auto status = rocksdb::DB::Open(db_options, db_path, descriptors, &column_families_, &db);
+    db_.reset(db);
+    CheckStatus(status, "Create client");
+}
+
+Database::~Database() {
+    for (auto* column_family : column_families_) {
+        [[maybe_unused]] const auto status = db_->DestroyColumnFamilyHandle(column_family);
+    }
+}
+
+rocksdb::ColumnFamilyHandle* Database::GetColumnFamily(std::string_view name) const {
+    for (auto* column_family : column_families_) {
+        if (column_family->GetName() == name) return column_family;
+    }
+    throw Exception(fmt::format("No column family '{}' in the RocksDB database", name));
+}
+
+}  // namespace storages::rocks::impl
+
+USERVER_NAMESPACE_END
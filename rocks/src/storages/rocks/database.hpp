@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <rocksdb/db.h>
+#include <rocksdb/statistics.h>
+
+#include <userver/storages/rocks/settings.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks::impl {
+
+/// RocksDB database with its column families, shared by the clients of the
+/// column families
+class Database final {
+public:
+    Database(const std::string& db_path, const ClientSettings& settings);
+    ~Database();
+
+    Database(const Database&) = delete;
+    Database& operator=(const Database&) = delete;
+
+    rocksdb::DB& Get() const { return *db_; }
+
+    /// @throws storages::rocks::Exception if there is no such column family
+    rocksdb::ColumnFamilyHandle* GetColumnFamily(std::string_view name) const;
+
+    const std::vector<rocksdb::ColumnFamilyHandle*>& GetColumnFamilies() const { return column_families_; }
+
+    /// nullptr if the statistics are not collected
+    const rocksdb::Statistics* GetStatistics() const { return statistics_.get(); }
+
+private:
+    std::unique_ptr<rocksdb::DB> db_;
+    // Owned, must be destroyed before the database is closed
+    std::vector<rocksdb::ColumnFamilyHandle*> column_families_;
+    std::shared_ptr<rocksdb::Statistics> statistics_;
+};
+
+}  // namespace storages::rocks::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,25 @@
+#include <userver/storages/rocks/write_batch.hpp>
+
+#include <userver/storages/rocks/exception.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks {
+
+void WriteBatch::Put(std::string_view key, std::string_view value) {
+    const auto status = batch_.Put(column_family_, key, value);
+    if (!status.ok()) throw RequestFailedException("WriteBatch::Put", status.ToString());
+}
+
+void WriteBatch::Delete(std::string_view key) {
+    const auto status = batch_.Delete(column_family_, key);
+    if (!status.ok()) throw RequestFailedException("WriteBatch::Delete", status.ToString());
+}
+
+std::size_t WriteBatch::Size() const { return static_cast<std::size_t>(batch_.Count()); }
+
+void WriteBatch::Clear() { batch_.Clear(); }
+
+}  // namespace storages::rocks
+
+USERVER_NAMESPACE_END
@@ -2,6 +2,7 @@
 
 #include "hello_service.hpp"
 
+#include <userver/formats/json/string_builder.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
 
 #include "say_hello.hpp"
@@ -30,9 +31,10 @@ public:
         // request_dom and response_dom have generated types
         auto response_dom = SayHelloTo(request_dom);
 
-        // Use generated serializer for ValueBuilder()
-        auto response_json = formats::json::ValueBuilder{response_dom}.ExtractValue();
-        return formats::json::ToString(response_json);
+        // Use generated serializer for StringBuilder
+        formats::json::StringBuilder sw;
+        WriteToStream(response_dom, sw);
+        return sw.GetString();
     }
     /// [Handler]
 };
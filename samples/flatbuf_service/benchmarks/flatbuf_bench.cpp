@@ -0,0 +1,88 @@
+#include <userver/utest/using_namespace_userver.hpp>
+
+#include <cstdint>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/server/handlers/impl/flatbuf.hpp>
+
+#include "flatbuffer_schema.fbs.h"
+
+// Compares the request body processing of the handlers derived from
+// HttpHandlerJsonBase, HttpHandlerFlatbufBase and HttpHandlerFlatbufViewBase
+// for the same sum-and-echo logic as in the sample.
+
+namespace {
+
+std::string MakeJsonRequest(std::size_t data_size) {
+    formats::json::ValueBuilder request;
+    request["arg1"] = 20;
+    request["arg2"] = 22;
+    request["data"] = std::string(data_size, 'a');
+    return formats::json::ToString(request.ExtractValue());
+}
+
+std::string MakeFlatbufRequest(std::size_t data_size) {
+    fbs::SampleRequest::NativeTableType request;
+    request.arg1 = 20;
+    request.arg2 = 22;
+    request.data = std::string(data_size, 'a');
+
+    flatbuffers::FlatBufferBuilder fbb;
+    fbb.Finish(fbs::SampleRequest::Pack(fbb, &request));
+    return {reinterpret_cast<const char*>(fbb.GetBufferPointer()), fbb.GetSize()};
+}
+
+}  // namespace
+
+void FlatbufHandlerJson(benchmark::State& state) {
+    const auto body = MakeJsonRequest(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        const auto request = formats::json::FromString(body);
+
+        formats::json::ValueBuilder response;
+        response["sum"] = request["arg1"].As<std::int64_t>() + request["arg2"].As<std::int64_t>();
+        response["echo"] = request["data"];
+
+        auto result = formats::json::ToString(response.ExtractValue());
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(FlatbufHandlerJson)->RangeMultiplier(16)->Range(16, 64 * 1024);
+
+void FlatbufHandlerObjectApi(benchmark::State& state) {
+    const auto body = MakeFlatbufRequest(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        const auto* request_fbb = server::handlers::impl::GetVerifiedFlatbufRoot<fbs::SampleRequest>(body);
+        fbs::SampleRequest::NativeTableType request;
+        request_fbb->UnPackTo(&request);
+
+        fbs::SampleResponse::NativeTableType response;
+        response.sum = request.arg1 + request.arg2;
+        response.echo = request.data;
+
+        server::handlers::impl::FlatbufResponseBuilder builder;
+        const auto response_fbb = fbs::SampleResponse::Pack(builder.GetBuilder(), &response);
+        auto result = std::move(builder).Finish(response_fbb);
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(FlatbufHandlerObjectApi)->RangeMultiplier(16)->Range(16, 64 * 1024);
+
+void FlatbufHandlerView(benchmark::State& state) {
+    const auto body = MakeFlatbufRequest(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        const auto* request = server::handlers::impl::GetVerifiedFlatbufRoot<fbs::SampleRequest>(body);
+
+        server::handlers::impl::FlatbufResponseBuilder builder;
+        auto& fbb = builder.GetBuilder();
+        const auto echo = fbb.CreateString(request->data());
+        const auto response_fbb = fbs::CreateSampleResponse(fbb, request->arg1() + request->arg2(), echo);
+        auto result = std::move(builder).Finish(response_fbb);
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(FlatbufHandlerView)->RangeMultiplier(16)->Range(16, 64 * 1024);
@@ -8,3 +8,22 @@ async def test_flatbuf(service_client):
     assert response.status == 200
     assert 'application/octet-stream' == response.headers['Content-Type']
     # /// [Functional test]
+
+
+async def test_flatbuf_view(service_client):
+    body = bytearray.fromhex(
+        '100000000c00180000000800100004000c000000140000001400000000000000'
+        '16000000000000000a00000048656c6c6f20776f72640000',
+    )
+    response = await service_client.post('/fbs-view', data=body)
+    assert response.status == 200
+    assert 'application/octet-stream' == response.headers['Content-Type']
+
+    # both handlers build the same buffer
+    reference = await service_client.post('/fbs', data=body)
+    assert response.content == reference.content
+
+
+async def test_flatbuf_view_invalid(service_client):
+    response = await service_client.post('/fbs-view', data=b'\x01\x02')
+    assert response.status == 400
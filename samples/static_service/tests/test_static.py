@@ -25,3 +25,27 @@ async def test_hidden_file(service_client, service_source_dir):
     response = await service_client.get('/dir1/.hidden_file.txt')
     assert response.status == 404
     assert response.content.decode() == 'File not found'
+
+
+async def test_etag(service_client):
+    response = await service_client.get('/index.html')
+    assert response.status == 200
+    etag = response.headers['ETag']
+    assert etag.startswith('"') and etag.endswith('"')
+
+    response = await service_client.get(
+        '/index.html', headers={'If-None-Match': etag},
+    )
+    assert response.status == 304
+    assert response.headers['ETag'] == etag
+    assert response.content == b''
+
+    response = await service_client.get(
+        '/index.html', headers={'If-None-Match': '"other", W/' + etag},
+    )
+    assert response.status == 304
+
+    response = await service_client.get(
+        '/index.html', headers={'If-None-Match': '"other"'},
+    )
+    assert response.status == 200
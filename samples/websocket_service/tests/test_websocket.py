@@ -5,3 +5,13 @@ async def test_echo(websocket_client):
         response = await chat.recv()
         assert response == 'hello'
         # /// [Functional test]
+
+
+async def test_echo_compressed(websocket_client):
+    # the message is long enough to be compressed by permessage-deflate
+    message = 'hello ' * 1000
+    async with websocket_client.get('chat') as chat:
+        for _ in range(3):
+            await chat.send(message)
+            response = await chat.recv()
+            assert response == message
@@ -0,0 +1,205 @@
+#!/usr/bin/env python3
+
+"""
+Runs a curated set of userver google-benchmark binaries and compares the
+results with a stored baseline.
+
+    # run the suite and store the results as a baseline
+    run_benchmarks.py run --binary userver-core-benchmark=./core/userver-core-benchmark \
+        --cpus 2-5 --output baseline.json
+
+    # ... checkout another commit, rebuild, run again
+    run_benchmarks.py run ... --output current.json
+
+    # flag statistically significant differences
+    run_benchmarks.py compare baseline.json current.json
+"""
+
+import argparse
+import json
+import math
+import os
+import shutil
+import statistics
+import subprocess
+import sys
+import tempfile
+
+SUITE_PATH = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'suite.json')
+
+TIME_UNIT_TO_NS = {'ns': 1.0, 'us': 1e3, 'ms': 1e6, 's': 1e9}
+
+
+def _git_revision(source_dir):
+    try:
+        return subprocess.check_output(
+            ['git', 'rev-parse', 'HEAD'],
+            cwd=source_dir,
+            stderr=subprocess.DEVNULL,
+            text=True,
+        ).strip()
+    except (OSError, subprocess.CalledProcessError):
+        return None
+
+
+def _run_binary(binary, benchmark_filter, repetitions, cpus):
+    """Runs a benchmark binary, returns {name: [real time in ns per repetition]}"""
+    with tempfile.NamedTemporaryFile(suffix='.json') as out:
+        command = [
+            binary,
+            '--benchmark_filter=' + benchmark_filter,
+            '--benchmark_repetitions={}'.format(repetitions),
+            '--benchmark_out=' + out.name,
+            '--benchmark_out_format=json',
+            '--benchmark_color=no',
+        ]
+        if cpus:
+            if not shutil.which('taskset'):
+                raise RuntimeError('taskset is required to pin the benchmarks to CPUs')
+            command = ['taskset', '--cpu-list', cpus] + command
+
+        print('Running:', ' '.join(command), file=sys.stderr, flush=True)
+        subprocess.run(command, check=True, stdout=subprocess.DEVNULL)
+        report = json.load(out)
+
+    results = {}
+    for run in report['benchmarks']:
+        if run.get('run_type', 'iteration') != 'iteration' or 'error_occurred' in run:
+            continue
+        scale = TIME_UNIT_TO_NS[run.get('time_unit', 'ns')]
+        name = run.get('run_name', run['name'])
+        results.setdefault(name, []).append(run['real_time'] * scale)
+    return report.get('context', {}), results
+
+
+def run_suite(args):
+    with open(args.suite) as suite_file:
+        suite = json.load(suite_file)
+
+    binaries = dict(binary.split('=', 1) for binary in args.binary)
+
+    result = {
+        'revision': _git_revision(os.path.dirname(args.suite)),
+        'cpus': args.cpus,
+        'repetitions': args.repetitions,
+        'subsystems': {},
+    }
+    for subsystem, entry in suite['subsystems'].items():
+        binary = binaries.get(entry['binary'])
+        if binary is None:
+            print('Skipping {}: {} was not built'.format(subsystem, entry['binary']), file=sys.stderr)
+            continue
+
+        context, benchmarks = _run_binary(binary, entry['filter'], args.repetitions, args.cpus)
+        result.setdefault('context', context)
+        result['subsystems'][subsystem] = benchmarks
+
+    with open(args.output, 'w') as output:
+        json.dump(result, output, indent=2, sort_keys=True)
+    print('Results are written to', args.output, file=sys.stderr)
+    return 0
+
+
+def _mann_whitney_p_value(first, second):
+    """Two-sided p-value of the Mann-Whitney U test, normal approximation with tie correction"""
+    values = sorted([(value, 0) for value in first] + [(value, 1) for value in second])
+    ranks = [0.0] * len(values)
+    ties_correction = 0.0
+    i = 0
+    while i < len(values):
+        j = i
+        while j + 1 < len(values) and values[j + 1][0] == values[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2.0 + 1
+        ties = j - i + 1
+        ties_correction += ties ** 3 - ties
+        i = j + 1
+
+    n1 = len(first)
+    n2 = len(second)
+    rank_sum = sum(rank for rank, (_, group) in zip(ranks, values) if group == 0)
+    u = rank_sum - n1 * (n1 + 1) / 2.0
+    mean = n1 * n2 / 2.0
+    n = n1 + n2
+    variance = n1 * n2 / 12.0 * ((n + 1) - ties_correction / (n * (n - 1)))
+    if variance <= 0:
+        return 1.0
+    z = (abs(u - mean) - 0.5) / math.sqrt(variance)
+    return math.erfc(max(z, 0.0) / math.sqrt(2))
+
+
+def compare(args):
+    with open(args.baseline) as baseline_file:
+        baseline = json.load(baseline_file)
+    with open(args.current) as current_file:
+        current = json.load(current_file)
+
+    print('Baseline: {}, current: {}'.format(baseline.get('revision'), current.get('revision')))
+    print('{:<60} {:>12} {:>12} {:>8} {:>8}  {}'.format('benchmark', 'base, ns', 'current, ns', 'change', 'p-value', ''))
+
+    regressions = 0
+    for subsystem in sorted(current['subsystems']):
+        base_benchmarks = baseline['subsystems'].get(subsystem, {})
+        print('[{}]'.format(subsystem))
+        for name, times in sorted(current['subsystems'][subsystem].items()):
+            base_times = base_benchmarks.get(name)
+            if not base_times:
+                print('  {:<58} {:>12} {:>12.1f}'.format(name, '-', statistics.median(times)))
+                continue
+
+            base_median = statistics.median(base_times)
+            median = statistics.median(times)
+            change = median / base_median - 1 if base_median else 0.0
+            p_value = _mann_whitney_p_value(base_times, times)
+
+            verdict = ''
+            if p_value < args.alpha and abs(change) > args.threshold:
+                verdict = 'SLOWER' if change > 0 else 'faster'
+                regressions += change > 0
+            print(
+                '  {:<58} {:>12.1f} {:>12.1f} {:>+7.1f}% {:>8.4f}  {}'.format(
+                    name, base_median, median, change * 100, p_value, verdict
+                )
+            )
+
+    print('{} significant regression(s)'.format(regressions))
+    return 1 if regressions and args.fail_on_regression else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    subparsers = parser.add_subparsers(dest='command', required=True)
+
+    run_parser = subparsers.add_parser('run', help='run the benchmark suite')
+    run_parser.add_argument('--suite', default=SUITE_PATH, help='suite description, default: %(default)s')
+    run_parser.add_argument(
+        '--binary',
+        action='append',
+        default=[],
+        metavar='TARGET=PATH',
+        help='path to a benchmark binary of the suite, may be repeated',
+    )
+    run_parser.add_argument('--cpus', default='', help='CPU list to pin the benchmarks to, e.g. 2-5')
+    run_parser.add_argument('--repetitions', type=int, default=10, help='default: %(default)s')
+    run_parser.add_argument('--output', required=True, help='JSON file to write the results to')
+    run_parser.set_defaults(func=run_suite)
+
+    compare_parser = subparsers.add_parser('compare', help='compare results with a baseline')
+    compare_parser.add_argument('baseline')
+    compare_parser.add_argument('current')
+    compare_parser.add_argument(
+        '--alpha', type=float, default=0.01, help='significance level of the U test, default: %(default)s'
+    )
+    compare_parser.add_argument(
+        '--threshold', type=float, default=0.05, help='ignored relative change, default: %(default)s'
+    )
+    compare_parser.add_argument('--fail-on-regression', action='store_true', help='exit with 1 on regressions')
+    compare_parser.set_defaults(func=compare)
+
+    args = parser.parse_args()
+    return args.func(args)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
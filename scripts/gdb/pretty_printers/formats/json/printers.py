@@ -8,8 +8,8 @@ class Constants:
     # @see RAPIDJSON_UINT64_C2 at rapidjson/rapidjson.h
     RJ_UINT64_C2 = (0x0000FFFF << 32) | 0xFFFFFFFF
 
-    # @see `info types` at rapidjson/document.h
-    RJ_TALLOC = 'rapidjson::CrtAllocator'
+    # @see `info types` at rapidjson/document.h and formats/json/impl/types.hpp
+    RJ_TALLOC = 'userver::formats::json::impl::DocumentAllocator'
     RJ_TENCODING = 'rapidjson::UTF8<char>'
 
     RJ_GENERIC_VALUE = f'rapidjson::GenericValue<{RJ_TENCODING}, {RJ_TALLOC}>'
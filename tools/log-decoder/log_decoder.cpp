@@ -0,0 +1,161 @@
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+#include <boost/program_options.hpp>
+#include <fmt/chrono.h>
+#include <fmt/format.h>
+
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/logging/binary_log.hpp>
+#include <userver/utils/encoding/tskv.hpp>
+#include <userver/utils/overloaded.hpp>
+
+#include <userver/utest/using_namespace_userver.hpp>
+
+namespace {
+
+struct Config {
+    std::string input;
+    std::string format = "tskv";
+};
+
+Config ParseConfig(int argc, char** argv) {
+    namespace po = boost::program_options;
+
+    Config config;
+    po::options_description desc("Converts logs written in 'binary' format into text.\nAllowed options");
+    desc.add_options()("help,h", "produce help message")(
+        "input,i", po::value(&config.input), "binary log filename (stdin by default)"
+    )("format,f", po::value(&config.format)->default_value(config.format), "output format (tskv, json)");
+
+    po::variables_map vm;
+    try {
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        po::notify(vm);
+    } catch (const std::exception& ex) {
+        std::cerr << "Cannot parse command line: " << ex.what() << '\n';
+        exit(1);
+    }
+
+    if (vm.count("help")) {
+        std::cout << desc << '\n';
+        exit(0);
+    }
+
+    if (config.format != "tskv" && config.format != "json") {
+        std::cerr << "Unknown output format '" << config.format << "'\n";
+        exit(1);
+    }
+
+    return config;
+}
+
+std::string ReadAll(std::istream& in) { return {std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}}; }
+
+std::string FormatTimestamp(std::chrono::system_clock::time_point timestamp) {
+    const auto seconds = std::chrono::time_point_cast<std::chrono::seconds>(timestamp);
+    const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(timestamp - seconds).count();
+    return fmt::format(
+        "{:%Y-%m-%dT%H:%M:%S}.{:06}", fmt::localtime(std::chrono::system_clock::to_time_t(seconds)), micros
+    );
+}
+
+std::string FormatModule(const logging::BinaryLogRecord& record) {
+    return fmt::format("{} ( {}:{} )", record.function, record.file, record.line);
+}
+
+std::string ValueToString(const logging::BinaryLogRecord::Value& value) {
+    return std::visit(
+        utils::Overloaded{
+            [](std::string_view x) { return std::string{x}; },
+            [](auto x) { return fmt::to_string(x); },
+        },
+        value
+    );
+}
+
+void WriteTskv(const logging::BinaryLogRecord& record, std::string& out) {
+    out += "tskv\ttimestamp=";
+    out += FormatTimestamp(record.timestamp);
+    out += "\tlevel=";
+    out += logging::ToUpperCaseString(record.level);
+    out += "\tmodule=";
+    utils::encoding::EncodeTskv(out, FormatModule(record), utils::encoding::EncodeTskvMode::kValue);
+    for (const auto& [key, value] : record.tags) {
+        out += '\t';
+        utils::encoding::EncodeTskv(out, key, utils::encoding::EncodeTskvMode::kKey);
+        out += '=';
+        utils::encoding::EncodeTskv(out, ValueToString(value), utils::encoding::EncodeTskvMode::kValue);
+    }
+    out += '\n';
+}
+
+void WriteJson(const logging::BinaryLogRecord& record, std::string& out) {
+    formats::json::StringBuilder sb;
+    {
+        const formats::json::StringBuilder::ObjectGuard guard{sb};
+        sb.Key("timestamp");
+        sb.WriteString(FormatTimestamp(record.timestamp));
+        sb.Key("level");
+        sb.WriteString(logging::ToUpperCaseString(record.level));
+        sb.Key("module");
+        sb.WriteString(FormatModule(record));
+        for (const auto& [key, value] : record.tags) {
+            sb.Key(key);
+            std::visit(
+                utils::Overloaded{
+                    [&](std::string_view x) { sb.WriteString(x); },
+                    [&](std::int64_t x) { sb.WriteInt64(x); },
+                    [&](std::uint64_t x) { sb.WriteUInt64(x); },
+                    [&](double x) { sb.WriteDouble(x); },
+                },
+                value
+            );
+        }
+    }
+    out += sb.GetStringView();
+    out += '\n';
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const auto config = ParseConfig(argc, argv);
+
+    std::string data;
+    if (config.input.empty()) {
+        data = ReadAll(std::cin);
+    } else {
+        std::ifstream file{config.input, std::ios::binary};
+        if (!file) {
+            std::cerr << "Cannot open '" << config.input << "'\n";
+            return 1;
+        }
+        data = ReadAll(file);
+    }
+
+    const auto write = (config.format == "json" ? &WriteJson : &WriteTskv);
+    logging::BinaryLogReader reader{data};
+    logging::BinaryLogRecord record;
+    std::string out;
+    try {
+        while (reader.Next(record)) {
+            out.clear();
+            write(record, out);
+            std::cout << out;
+        }
+    } catch (const std::exception& ex) {
+        std::cerr << "Failed to decode the log: " << ex.what() << '\n';
+        return 1;
+    }
+
+    if (reader.GetOffset() != data.size()) {
+        std::cerr << "Trailing " << data.size() - reader.GetOffset() << " bytes of an incomplete record\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,164 @@
+#pragma once
+
+/// @file userver/cache/clock_map.hpp
+/// @brief @copybrief cache::ClockMap
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief Key value storage with the CLOCK eviction policy, an approximation
+/// of LRU
+///
+/// Unlike cache::LruMap, a hit does not reorder the elements, it only sets
+/// the "referenced" bit of the element. That makes Get() a const operation
+/// that may be called concurrently from multiple threads, e.g. under a shared
+/// lock. Put() of a new key into a full map evicts the first element without
+/// the bit, clearing the bits of the skipped ones; the cost of the sweep is
+/// amortized over the insertions.
+///
+/// Thread safety matches Standard Library thread safety, Get() counts as
+/// a const operation.
+template <typename T, typename U, typename Hash = std::hash<T>, typename Equal = std::equal_to<T>>
+class ClockMap final {
+public:
+    explicit ClockMap(std::size_t max_size, const Hash& hash = Hash(), const Equal& equal = Equal())
+        : map_(max_size, hash, equal), max_size_(max_size) {
+        UASSERT(max_size_ > 0);
+        ring_.reserve(max_size_);
+    }
+
+    ClockMap(ClockMap&& other) noexcept = default;
+    ClockMap(const ClockMap&) = delete;
+    ClockMap& operator=(ClockMap&& other) noexcept = default;
+    ClockMap& operator=(const ClockMap&) = delete;
+
+    /// Adds or rewrites key/value, marks it as referenced if it existed
+    /// @returns true if key is a new one
+    bool Put(const T& key, U value) {
+        if (const auto it = map_.find(key); it != map_.end()) {
+            it->second.value = std::move(value);
+            it->second.Touch();
+            return false;
+        }
+
+        if (ring_.size() >= max_size_) EvictOne();
+        auto& node = *map_.emplace(
+                              std::piecewise_construct,
+                              std::forward_as_tuple(key),
+                              std::forward_as_tuple(std::move(value), ring_.size())
+        )
+                          .first;
+        ring_.push_back(&node);
+        return true;
+    }
+
+    /// Removes key from the map
+    void Erase(const T& key) {
+        const auto it = map_.find(key);
+        if (it != map_.end()) Remove(it->second.ring_index);
+    }
+
+    /// Returns pointer to value if the key is in the map and marks it as
+    /// referenced; returns nullptr otherwise.
+    /// @warning Returned pointer may be freed on the next non-const map access!
+    const U* Get(const T& key) const {
+        const auto it = map_.find(key);
+        if (it == map_.end()) return nullptr;
+        it->second.Touch();
+        return &it->second.value;
+    }
+
+    /// Returns value by key and marks it as referenced; returns default_value
+    /// otherwise without modifying the cache.
+    U GetOr(const T& key, const U& default_value) const {
+        const auto* ptr = Get(key);
+        if (ptr) return *ptr;
+        return default_value;
+    }
+
+    /// Sets the max size of the map, evicts values if new_max_size < GetSize()
+    void SetMaxSize(std::size_t new_max_size) {
+        UASSERT(new_max_size > 0);
+        max_size_ = new_max_size;
+        while (ring_.size() > max_size_) EvictOne();
+    }
+
+    /// Removes all the elements
+    void Clear() {
+        ring_.clear();
+        map_.clear();
+        hand_ = 0;
+    }
+
+    /// Call Function(const T&, const U&) for all items
+    template <typename Function>
+    void VisitAll(Function&& func) const {
+        for (const auto& [key, entry] : map_) func(key, entry.value);
+    }
+
+    std::size_t GetSize() const { return ring_.size(); }
+
+    std::size_t GetCapacity() const { return max_size_; }
+
+private:
+    struct Entry final {
+        Entry(U&& value, std::size_t ring_index) : value(std::move(value)), ring_index(ring_index) {}
+
+        // Avoids writing the cache line of the hot elements on each hit
+        void Touch() const noexcept {
+            if (!referenced.load(std::memory_order_relaxed)) referenced.store(true, std::memory_order_relaxed);
+        }
+
+        U value;
+        std::size_t ring_index;
+        mutable std::atomic<bool> referenced{false};
+    };
+
+    using Map = std::unordered_map<T, Entry, Hash, Equal>;
+    using Node = typename Map::value_type;
+
+    void EvictOne() {
+        UASSERT(!ring_.empty());
+        while (true) {
+            if (hand_ >= ring_.size()) hand_ = 0;
+            auto& entry = ring_[hand_]->second;
+            if (!entry.referenced.exchange(false, std::memory_order_relaxed)) break;
+            ++hand_;
+        }
+        // The last element takes the place of the evicted one, the hand stays
+        Remove(hand_);
+    }
+
+    void Remove(std::size_t ring_index) {
+        UASSERT(ring_index < ring_.size());
+        Node* node = ring_[ring_index];
+        Node* last = ring_.back();
+        ring_[ring_index] = last;
+        last->second.ring_index = ring_index;
+        ring_.pop_back();
+        map_.erase(map_.find(node->first));
+    }
+
+    // Nodes of std::unordered_map are not moved on rehash
+    Map map_;
+    std::vector<Node*> ring_;
+    std::size_t hand_{0};
+    std::size_t max_size_;
+};
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,200 @@
+#pragma once
+
+/// @file userver/cache/tiny_lfu_map.hpp
+/// @brief @copybrief cache::TinyLfuMap
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include <userver/cache/impl/lru.hpp>
+#include <userver/cache/impl/slru.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/filter_bloom.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief Key value storage with the W-TinyLFU eviction policy
+///
+/// New elements get into a small LRU window (1% of the capacity). An element
+/// evicted from the window is admitted into the main SLRU part only if it was
+/// accessed more often than the element it would evict from there. Access
+/// frequencies are approximated by a utils::FilterBloom sketch that is halved
+/// periodically, so the old popularity fades away.
+///
+/// As a result, a sequential scan over many cold keys does not wash the hot
+/// working set out of the map, unlike with cache::LruMap.
+///
+/// Capacities less than 3 are rounded up to 3.
+///
+/// Thread safety matches Standard Library thread safety, Get() is a non-const
+/// operation.
+template <typename T, typename U, typename Hash = std::hash<T>, typename Equal = std::equal_to<T>>
+class TinyLfuMap final {
+public:
+    explicit TinyLfuMap(std::size_t max_size, const Hash& hash = Hash(), const Equal& equal = Equal())
+        : window_(1, hash, equal), main_(1, 1, hash, equal), hash_(hash) {
+        SetMaxSize(max_size);
+    }
+
+    TinyLfuMap(TinyLfuMap&& other) noexcept = default;
+    TinyLfuMap(const TinyLfuMap&) = delete;
+    TinyLfuMap& operator=(TinyLfuMap&& other) noexcept = default;
+    TinyLfuMap& operator=(const TinyLfuMap&) = delete;
+
+    /// Adds or rewrites key/value, updates its usage
+    /// @returns true if key is a new one
+    bool Put(const T& key, U value) {
+        if (auto* existing = Get(key)) {
+            *existing = std::move(value);
+            return false;
+        }
+
+        if (window_.GetSize() < window_.GetCapacity()) {
+            window_.Put(key, std::move(value));
+            return true;
+        }
+
+        auto candidate = window_.ExtractLeastUsedNode();
+        window_.Put(key, std::move(value));
+        Admit(std::move(candidate));
+        return true;
+    }
+
+    /// Removes key from the map
+    void Erase(const T& key) {
+        window_.Erase(key);
+        main_.Erase(key);
+    }
+
+    /// Returns pointer to value if the key is in the map and updates its usage;
+    /// returns nullptr otherwise. Misses are accounted in the frequencies too.
+    /// @warning Returned pointer may be freed on the next map access!
+    U* Get(const T& key) {
+        RecordAccess(key);
+        if (auto* value = window_.Get(key)) return value;
+        return main_.Get(key);
+    }
+
+    /// Returns value by key and updates its usage; returns default_value
+    /// otherwise without modifying the cache.
+    U GetOr(const T& key, const U& default_value) {
+        auto* ptr = Get(key);
+        if (ptr) return *ptr;
+        return default_value;
+    }
+
+    /// Sets the max size of the map, evicts values if new_max_size < GetSize()
+    /// and resets the frequencies
+    void SetMaxSize(std::size_t new_max_size) {
+        UASSERT(new_max_size > 0);
+        const auto window_size = std::max<std::size_t>(1, new_max_size / 100);
+        main_size_ = std::max<std::size_t>(2, new_max_size - std::min(window_size, new_max_size));
+
+        // Probation may take all the main part, while the protected segment holds
+        // at most 80% of it, so there is always a victim in the probation.
+        window_.SetMaxSize(window_size);
+        main_.SetMaxSize(main_size_, main_size_ * 4 / 5);
+        while (main_.GetSize() > main_size_) main_.ExtractLeastUsedNode();
+
+        sketch_ = std::make_unique<Sketch>(
+            std::max<std::size_t>(kMinCounters, GetCapacity() * kCountersPerElement),
+            SketchHash1{hash_},
+            SketchHash2{hash_}
+        );
+        samples_ = 0;
+    }
+
+    /// Removes all the elements and resets the frequencies
+    void Clear() {
+        window_.Clear();
+        main_.Clear();
+        sketch_->Clear();
+        samples_ = 0;
+    }
+
+    /// Call Function(const T&, const U&) for all items
+    template <typename Function>
+    void VisitAll(Function&& func) const {
+        window_.VisitAll(func);
+        main_.VisitAll(func);
+    }
+
+    std::size_t GetSize() const { return window_.GetSize() + main_.GetSize(); }
+
+    std::size_t GetCapacity() const { return window_.GetCapacity() + main_size_; }
+
+    /// Returns the number of new elements that were not admitted into the main
+    /// part because they were accessed less often than its victim
+    std::size_t GetAdmissionRejects() const noexcept { return admission_rejects_; }
+
+private:
+    using NodeType = typename impl::LruBase<T, U, Hash, Equal>::NodeType;
+
+    // utils::FilterBloom derives all the counter positions from two hashes
+    // linearly, so the identity std::hash of integers has to be mixed. Seed
+    // makes the two hashers differ.
+    template <std::uint64_t Seed>
+    struct MixedHash final {
+        std::uint64_t operator()(const T& key) const {
+            // SplitMix64 finalizer
+            std::uint64_t x = static_cast<std::uint64_t>(hash(key)) + Seed;
+            x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+            return x ^ (x >> 31);
+        }
+
+        Hash hash;
+    };
+
+    using SketchHash1 = MixedHash<0>;
+    using SketchHash2 = MixedHash<0x9e3779b97f4a7c15ULL>;
+    using Sketch = utils::FilterBloom<T, std::uint8_t, SketchHash1, SketchHash2>;
+
+    static constexpr std::size_t kCountersPerElement = 16;
+    static constexpr std::size_t kMinCounters = 64;
+    static constexpr std::size_t kSamplesPerElement = 10;
+
+    void RecordAccess(const T& key) {
+        sketch_->Increment(key);
+        if (++samples_ >= GetCapacity() * kSamplesPerElement) {
+            sketch_->Halve();
+            samples_ = 0;
+        }
+    }
+
+    void Admit(NodeType candidate) {
+        if (main_.GetSize() < main_size_) {
+            main_.InsertNode(std::move(candidate));
+            return;
+        }
+
+        const T* victim = main_.GetLeastUsedKey();
+        UASSERT(victim);
+        if (sketch_->Estimate(candidate->GetKey()) > sketch_->Estimate(*victim)) {
+            main_.ExtractLeastUsedNode();
+            main_.InsertNode(std::move(candidate));
+        } else {
+            ++admission_rejects_;
+        }
+    }
+
+    impl::LruBase<T, U, Hash, Equal> window_;
+    impl::SlruBase<T, U, Hash, Equal> main_;
+    Hash hash_;
+    std::unique_ptr<Sketch> sketch_;
+    std::size_t main_size_{0};
+    std::size_t samples_{0};
+    std::size_t admission_rejects_{0};
+};
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+#include <string>
 #include <string_view>
 
 #include <userver/compression/error.hpp>
@@ -8,10 +10,82 @@ USERVER_NAMESPACE_BEGIN
 
 namespace compression::zstd {
 
+/// The zstd default, a good speed to ratio balance for the text data
+inline constexpr int kDefaultCompressionLevel = 3;
+
 /// Decompresses the string.
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
 
+/// Compresses the string into a single zstd frame.
+/// @throws CompressionError
+std::string Compress(std::string_view data, int level = kDefaultCompressionLevel);
+
+/// @brief Compresses a stream of chunks into a single zstd frame.
+///
+/// The output of each Compress() call is flushed, so that the peer is able to
+/// decompress a chunk without waiting for the next ones.
+class StreamCompressor final {
+public:
+    explicit StreamCompressor(int level = kDefaultCompressionLevel);
+
+    /// Compresses using a dictionary, e.g. trained by `zstd --train`
+    /// @throws CompressionError
+    StreamCompressor(int level, std::string_view dictionary);
+
+    StreamCompressor(StreamCompressor&&) noexcept;
+    StreamCompressor& operator=(StreamCompressor&&) noexcept;
+    ~StreamCompressor();
+
+    /// @throws CompressionError
+    std::string Compress(std::string_view chunk);
+
+    /// @brief Compresses the chunk without flushing, which gives a better
+    /// compression ratio. The output may be delayed till the following calls.
+    /// @throws CompressionError
+    std::string Append(std::string_view chunk);
+
+    /// Ends the frame, must be called once after the last chunk
+    /// @throws CompressionError
+    std::string Finish();
+
+    /// @brief Starts a new frame, reusing the allocated compression context.
+    /// The level and the dictionary are kept.
+    void Reset();
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+/// @brief Decompresses a single zstd frame that arrives in chunks
+class StreamDecompressor final {
+public:
+    /// @param dictionary the dictionary the frame was compressed with, if any
+    /// @throws DecompressionError
+    explicit StreamDecompressor(std::string_view dictionary = {});
+    StreamDecompressor(StreamDecompressor&&) noexcept;
+    StreamDecompressor& operator=(StreamDecompressor&&) noexcept;
+    ~StreamDecompressor();
+
+    /// @brief Decompresses a chunk of the frame and appends the result to
+    /// `output`.
+    ///
+    /// The consumed bytes are removed from `input`. The input that follows the
+    /// end of the frame is left untouched.
+    /// @returns whether the frame has ended
+    /// @throws DecompressionError
+    bool Decompress(std::string_view& input, std::string& output);
+
+    /// @brief Prepares to decompress a new frame, reusing the allocated
+    /// decompression context. The dictionary is kept.
+    void Reset();
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace compression::zstd
 
 USERVER_NAMESPACE_END
@@ -4,6 +4,7 @@
 /// @brief @copybrief crypto::base64
 /// @ingroup userver_universal
 
+#include <string>
 #include <string_view>
 
 USERVER_NAMESPACE_BEGIN
@@ -15,22 +16,22 @@ enum class Pad { kWith, kWithout };
 
 /// @brief Encodes data to Base64, add padding by default
 /// @param pad controls if pad should be added or not
-/// @throws CryptoException internal library exception
 std::string Base64Encode(std::string_view data, Pad pad = Pad::kWith);
 
 /// @brief Decodes data from Base64
-/// @throws CryptoException internal library exception
+///
+/// Characters outside of the alphabet, including the padding, are skipped.
+/// Trailing bits that do not form a whole byte are dropped.
 std::string Base64Decode(std::string_view data);
 
 #ifndef USERVER_NO_CRYPTOPP_BASE64_URL
 
 /// @brief Encodes data to Base64 (using URL alphabet), add padding by default
 /// @param pad controls if pad should be added or not
-/// @throws CryptoException internal library exception
 std::string Base64UrlEncode(std::string_view data, Pad pad = Pad::kWith);
 
 /// @brief Decodes data from Base64 (using URL alphabet)
-/// @throws CryptoException internal library exception
+/// @see Base64Decode
 std::string Base64UrlDecode(std::string_view data);
 
 #endif
@@ -79,6 +79,11 @@ public:
 
 private:
     PrivateKey pkey_;
+
+    // Key contexts are initialized once and copied for each signature,
+    // copying is much cheaper than the initialization.
+    std::shared_ptr<EVP_MD_CTX> sign_ctx_;
+    std::shared_ptr<EVP_PKEY_CTX> sign_digest_ctx_;
 };
 
 /// @name Outputs RSASSA signature using SHA-2 and PKCS1 padding.
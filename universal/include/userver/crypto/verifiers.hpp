@@ -82,6 +82,11 @@ public:
 
 private:
     PublicKey pkey_;
+
+    // Key contexts are initialized once and copied for each verification,
+    // copying is much cheaper than the initialization.
+    std::shared_ptr<EVP_MD_CTX> verify_ctx_;
+    std::shared_ptr<EVP_PKEY_CTX> verify_digest_ctx_;
 };
 
 /// @name Verifies RSASSA signature using SHA-2 and PKCS1 padding.
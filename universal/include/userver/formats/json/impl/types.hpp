@@ -25,10 +25,12 @@ using formats::common::Type;
 class Value;
 
 namespace impl {
+class DocumentAllocator;
+
 // rapidjson integration
 using UTF8 = ::rapidjson::UTF8<char>;
-using Value = ::rapidjson::GenericValue<UTF8, ::rapidjson::CrtAllocator>;
-using Document = ::rapidjson::GenericDocument<UTF8, ::rapidjson::CrtAllocator, ::rapidjson::CrtAllocator>;
+using Value = ::rapidjson::GenericValue<UTF8, DocumentAllocator>;
+using Document = ::rapidjson::GenericDocument<UTF8, DocumentAllocator, ::rapidjson::CrtAllocator>;
 
 class VersionedValuePtr final {
 public:
@@ -49,6 +51,10 @@ public:
     explicit operator bool() const;
     bool IsUnique() const;
 
+    /// Returns true if the value memory is owned by the arena of a parsed
+    /// document, such values must not be moved out of the holder
+    bool HasArena() const;
+
     const impl::Value* Get() const;
     impl::Value* Get();
 
@@ -0,0 +1,32 @@
+#pragma once
+
+/// @file userver/formats/json/msgpack.hpp
+/// @brief MessagePack encoding of formats::json::Value
+
+#include <string>
+#include <string_view>
+
+#include <userver/formats/json/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+/// @brief Parse a MessagePack document into formats::json::Value.
+///
+/// MessagePack is a binary encoding of the JSON data model: the result
+/// could be used with all the Parse() overloads for formats::json::Value.
+/// `bin` values are parsed as strings; map keys must be strings, `ext` values
+/// and non-finite floats are not supported.
+/// @throws formats::json::ParseException
+formats::json::Value FromMsgpack(std::string_view doc);
+
+/// @brief Serialize formats::json::Value into MessagePack.
+///
+/// Integers and strings use the shortest MessagePack representation, floating
+/// point numbers are written as float 64.
+std::string ToMsgpack(const formats::json::Value& doc);
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,241 @@
+#pragma once
+
+/// @file userver/formats/json/on_demand.hpp
+/// @brief @copybrief formats::json::on_demand::Value
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <userver/formats/common/meta.hpp>
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/parse/common.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+class Value;
+
+/// @brief Lazy parsing of JSON documents, for reading a few fields out of a
+/// large document without building the DOM.
+namespace on_demand {
+
+/// @ingroup userver_universal userver_formats
+///
+/// @brief Non-owning read-only view over a JSON value of a document that is
+/// parsed lazily, on access.
+///
+/// Unlike formats::json::FromString, no DOM is built: member lookup and
+/// iteration scan the source text, skipping the values that are not requested
+/// without decoding them, and only the requested scalars are decoded. This
+/// makes reading a handful of fields of a multi-megabyte document much cheaper
+/// both in CPU and in allocations.
+///
+/// The value is a format value, so the generic `Parse` overloads
+/// (containers, std::optional, integers, ...) and the user-provided templated
+/// `Parse(const Value&, formats::parse::To<T>)` functions work with it:
+///
+/// @snippet formats/json/on_demand_test.cpp  Sample on_demand usage
+///
+/// Costs and limitations:
+/// * the source document must outlive all the Value instances created from it;
+/// * each operator[] call rescans the object from its beginning, and each
+///   iteration step skips the element, so accessing the same data repeatedly is
+///   slower than with a DOM — use ToDom() for such subtrees;
+/// * parts of the document that are skipped are only checked for the
+///   structure, malformed scalars in them are not reported.
+class Value final {
+public:
+    class Iterator;
+
+    using const_iterator = Iterator;
+    using Exception = formats::json::Exception;
+    using ParseException = formats::json::ParseException;
+    using ExceptionWithPath = formats::json::ExceptionWithPath;
+
+    struct DefaultConstructed {};
+
+    /// @brief Access member by key for read. Returns a missing value if there
+    /// is no such member or *this is missing or null.
+    /// @throw TypeMismatchException if not a missing value, an object or null.
+    /// @throw ParseException if the document is malformed.
+    Value operator[](std::string_view key) const;
+
+    /// @brief Returns an iterator to the beginning of the held array or object.
+    /// @throw TypeMismatchException if not an array, object, or null.
+    const_iterator begin() const;
+
+    /// @brief Returns an iterator to the end of the held array or object.
+    const_iterator end() const;
+
+    /// @brief Returns true if *this holds nothing.
+    bool IsMissing() const noexcept { return value_ == nullptr; }
+
+    /// @brief Returns true if *this holds a null (Type::kNull).
+    bool IsNull() const noexcept;
+    bool IsBool() const noexcept;
+    bool IsInt64() const;
+    bool IsUInt64() const;
+    bool IsDouble() const;
+    bool IsString() const noexcept;
+    bool IsArray() const noexcept;
+    bool IsObject() const noexcept;
+
+    /// @brief Returns true if *this holds a `key`.
+    /// @throw TypeMismatchException if not a missing value, an object or null.
+    bool HasMember(std::string_view key) const;
+
+    /// @brief Returns value of *this converted to the result type of
+    /// Parse(const Value&, parse::To<T>).
+    template <typename T>
+    auto As() const;
+
+    /// @brief Returns value of *this converted to T or T(args...) if
+    /// this->IsMissing() or this->IsNull().
+    template <typename T, typename First, typename... Rest>
+    auto As(First&& default_arg, Rest&&... more_default_args) const;
+
+    /// @brief Returns value of *this converted to T or T() if
+    /// this->IsMissing() or this->IsNull().
+    template <typename T>
+    auto As(DefaultConstructed) const;
+
+    /// @brief Returns the source text of the value
+    /// @throw MemberMissingException if `this->IsMissing()`.
+    std::string_view GetRawJson() const;
+
+    /// @brief Parses the value into a DOM, for the subtrees that are accessed
+    /// repeatedly.
+    /// @throw MemberMissingException if `this->IsMissing()`.
+    formats::json::Value ToDom() const;
+
+    /// @brief Returns full path to this value. Computed by rescanning the
+    /// document, so it is meant for error messages.
+    std::string GetPath() const;
+
+    /// @throw MemberMissingException if `this->IsMissing()`.
+    void CheckNotMissing() const;
+
+    /// @throw TypeMismatchException if not an array or null.
+    void CheckArrayOrNull() const;
+
+    /// @throw TypeMismatchException if not an object or null.
+    void CheckObjectOrNull() const;
+
+private:
+    Value(std::string_view document, const char* value) noexcept;
+    Value(std::string_view document, const char* missing_parent, std::string missing_path_suffix) noexcept;
+
+    int GetExtendedType() const;
+
+    std::string_view document_;
+    // Points to the first character of the value, nullptr if missing
+    const char* value_{nullptr};
+    // Nearest existing ancestor and the path from it, for missing values only
+    const char* missing_parent_{nullptr};
+    std::string missing_path_suffix_;
+
+    friend Value FromString(std::string_view document);
+    friend bool Parse(const Value& value, parse::To<bool>);
+    friend std::int64_t Parse(const Value& value, parse::To<std::int64_t>);
+    friend std::uint64_t Parse(const Value& value, parse::To<std::uint64_t>);
+    friend double Parse(const Value& value, parse::To<double>);
+    friend std::string Parse(const Value& value, parse::To<std::string>);
+};
+
+/// @brief Forward iterator over the elements of an array or the members of an
+/// object of an on_demand::Value.
+class Value::Iterator final {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = Value;
+    using reference = Value;
+    using pointer = void;
+
+    Iterator() noexcept = default;
+
+    Value operator*() const;
+    Iterator& operator++();
+    Iterator operator++(int);
+
+    bool operator==(const Iterator& other) const noexcept { return position_ == other.position_; }
+    bool operator!=(const Iterator& other) const noexcept { return position_ != other.position_; }
+
+    /// @brief Returns the name of the current object member.
+    /// @throw TypeMismatchException if iterating over an array.
+    std::string GetName() const;
+
+    /// @brief Returns the index of the current element.
+    std::size_t GetIndex() const noexcept { return index_; }
+
+private:
+    friend class Value;
+
+    Iterator(std::string_view document, const char* container, const char* position, bool is_object) noexcept;
+
+    std::string_view document_;
+    const char* container_{nullptr};
+    // Points to the current element (member name for objects), nullptr at end
+    const char* position_{nullptr};
+    std::size_t index_{0};
+    bool is_object_{false};
+};
+
+/// @brief Creates a lazy view over the JSON document. Only the beginning of
+/// the document is checked, the rest is parsed on access.
+/// @throw ParseException if the document is empty.
+Value FromString(std::string_view document);
+
+bool Parse(const Value& value, parse::To<bool>);
+
+std::int64_t Parse(const Value& value, parse::To<std::int64_t>);
+
+std::uint64_t Parse(const Value& value, parse::To<std::uint64_t>);
+
+double Parse(const Value& value, parse::To<double>);
+
+std::string Parse(const Value& value, parse::To<std::string>);
+
+formats::json::Value Parse(const Value& value, parse::To<formats::json::Value>);
+
+inline Value Parse(const Value& value, parse::To<Value>) { return value; }
+
+template <typename T>
+auto Value::As() const {
+    static_assert(
+        formats::common::impl::kHasParse<Value, T>,
+        "There is no `Parse(const Value&, formats::parse::To<T>)` "
+        "in namespace of `T` or `formats::parse`. "
+        "Probably you forgot to include the "
+        "<userver/formats/parse/common_containers.hpp> or you "
+        "have not provided a `Parse` function overload."
+    );
+
+    return Parse(*this, formats::parse::To<T>{});
+}
+
+template <typename T, typename First, typename... Rest>
+auto Value::As(First&& default_arg, Rest&&... more_default_args) const {
+    if (IsMissing() || IsNull()) {
+        // intended raw ctor call, sometimes casts
+        // NOLINTNEXTLINE(google-readability-casting)
+        return decltype(As<T>())(std::forward<First>(default_arg), std::forward<Rest>(more_default_args)...);
+    }
+    return As<T>();
+}
+
+template <typename T>
+auto Value::As(Value::DefaultConstructed) const {
+    return (IsMissing() || IsNull()) ? decltype(As<T>())() : As<T>();
+}
+
+}  // namespace on_demand
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
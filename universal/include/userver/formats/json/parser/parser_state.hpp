@@ -28,11 +28,13 @@ public:
 
     [[noreturn]] void ThrowError(const std::string& err_msg);
 
+    /// Returns the parser that receives the next event, for the parsers that
+    /// replay the events they have already consumed
+    BaseParser& GetTopParser() const;
+
 private:
     std::string GetCurrentPath() const;
 
-    BaseParser& GetTopParser() const;
-
     struct Impl;
     utils::FastPimpl<Impl, 792, 8> impl_;
 
@@ -0,0 +1,80 @@
+#pragma once
+
+/// @file userver/formats/json/shared_string_view.hpp
+/// @brief @copybrief formats::json::SharedStringView
+
+#include <string>
+#include <string_view>
+
+#include <userver/formats/json/string_builder_fwd.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/to.hpp>
+#include <userver/formats/serialize/to.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+/// @ingroup userver_universal userver_containers userver_formats
+///
+/// @brief Non-copying view of a string from a JSON document that keeps the
+/// document alive.
+///
+/// `json.As<std::string>()` copies the string. For big text fields that are
+/// only forwarded further (to another service, database or response) use
+/// `json.As<formats::json::SharedStringView>()` instead: it references the
+/// characters stored in the parsed document and shares ownership of the
+/// document, so the view stays valid after the original formats::json::Value
+/// and all its copies are gone.
+///
+/// Writing the view into formats::json::StringBuilder does not copy the
+/// string either.
+///
+/// The referenced document is immutable: formats::json::ValueBuilder copies
+/// a document that is still referenced by someone, so the view is never
+/// invalidated by modifications of the document.
+///
+/// @snippet formats/json/shared_string_view_test.cpp  Sample SharedStringView usage
+class SharedStringView final {
+public:
+    /// Empty string
+    SharedStringView() = default;
+
+    std::string_view GetView() const noexcept { return view_; }
+
+    const char* data() const noexcept { return view_.data(); }
+    std::size_t size() const noexcept { return view_.size(); }
+    bool empty() const noexcept { return view_.empty(); }
+
+    /* implicit */ operator std::string_view() const noexcept { return view_; }
+
+    /// Copies the string
+    std::string ToString() const { return std::string{view_}; }
+
+private:
+    SharedStringView(formats::json::Value value, std::string_view view) noexcept;
+
+    friend SharedStringView Parse(const Value& value, parse::To<SharedStringView>);
+    friend Value Serialize(const SharedStringView& value, serialize::To<Value>);
+
+    // holds a reference to the document and the string node inside it
+    formats::json::Value value_;
+    std::string_view view_;
+};
+
+inline bool operator==(const SharedStringView& lhs, std::string_view rhs) noexcept { return lhs.GetView() == rhs; }
+inline bool operator==(std::string_view lhs, const SharedStringView& rhs) noexcept { return lhs == rhs.GetView(); }
+inline bool operator!=(const SharedStringView& lhs, std::string_view rhs) noexcept { return lhs.GetView() != rhs; }
+inline bool operator!=(std::string_view lhs, const SharedStringView& rhs) noexcept { return lhs != rhs.GetView(); }
+
+/// @throws formats::json::TypeMismatchException if the value is not a string
+SharedStringView Parse(const Value& value, parse::To<SharedStringView>);
+
+/// Returns the original string node of the document, without copying
+Value Serialize(const SharedStringView& value, serialize::To<Value>);
+
+void WriteToStream(const SharedStringView& value, StringBuilder& sw);
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
@@ -67,6 +67,12 @@ public:
     std::string GetString() const;
     std::string_view GetStringView() const;
 
+    /// @brief Returns the JSON written so far and clears the internal buffer.
+    ///
+    /// Open objects and arrays stay open, so a big JSON could be sent in parts
+    /// while it is being written.
+    std::string ExtractBufferedString();
+
     void WriteNull();
     void WriteString(std::string_view value);
     void WriteBool(bool value);
@@ -39,6 +39,7 @@ impl::Value MakeJsonStringViewValue(std::string_view view);
 class ValueBuilder;
 struct PrettyFormat;
 class Schema;
+class SharedStringView;
 
 namespace parser {
 class JsonValueParser;
@@ -331,6 +332,7 @@ private:
     friend std::uint64_t Parse(const Value& value, parse::To<std::uint64_t>);
     friend double Parse(const Value& value, parse::To<double>);
     friend std::string Parse(const Value& value, parse::To<std::string>);
+    friend SharedStringView Parse(const Value& value, parse::To<SharedStringView>);
 
     friend formats::json::Value FromString(std::string_view);
     friend formats::json::Value FromStream(std::istream&);
@@ -340,6 +342,8 @@ private:
     friend std::string ToStableString(formats::json::Value&&);
     friend std::string ToPrettyString(const formats::json::Value& doc, PrettyFormat format);
     friend logging::LogHelper& operator<<(logging::LogHelper&, const Value&);
+    friend formats::json::Value FromMsgpack(std::string_view);
+    friend std::string ToMsgpack(const formats::json::Value&);
 };
 
 template <typename T>
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <string>
 #include <string_view>
 
@@ -147,6 +149,18 @@ inline std::int8_t GetHeaderIndexForInsertion(std::string_view key) {
     return opt.value_or(kNoHeaderIndexInsertion);
 }
 
+// Unsafe hashes of the known headers by their index, so that inserting a known
+// header by a runtime name does not need hashing it.
+inline constexpr auto kKnownHeadersHashes = [] {
+    constexpr auto kSize = kKnownHeadersLowercaseMap.size() + 1;
+    std::array<std::size_t, kSize> hashes{};
+    for (std::size_t i = 1; i < kSize; ++i) {
+        // Fails to compile if the indexes are not contiguous
+        hashes[i] = UnsafeConstexprHasher{}(*kKnownHeadersLowercaseMap.TryFindBySecond(static_cast<std::int8_t>(i)));
+    }
+    return hashes;
+}();
+
 }  // namespace impl
 
 namespace header_map {
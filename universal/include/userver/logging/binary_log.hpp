@@ -0,0 +1,78 @@
+#pragma once
+
+/// @file userver/logging/binary_log.hpp
+/// @brief Reader of the logging::Format::kBinary logs
+
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <userver/logging/level.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging {
+
+/// @brief Layout of the logging::Format::kBinary records.
+///
+/// All the numbers are little-endian. A record is:
+/// * `u32` size of the rest of the record in bytes;
+/// * `u8` version of the format, currently kBinaryLogVersion;
+/// * `u64` timestamp in nanoseconds since the Unix epoch;
+/// * `u8` logging::Level;
+/// * `str` function name, `str` file name, `u32` line of the log statement;
+/// * tags up to the end of the record, each is a `u8` BinaryLogTagType,
+///   a `str` key and a value of that type. The message text is a string tag
+///   with the "text" key.
+///
+/// `str` is a `u32` size followed by the bytes. Text and tags are not escaped.
+inline constexpr std::uint8_t kBinaryLogVersion = 1;
+
+/// @brief Types of the tag values in logging::Format::kBinary records.
+enum class BinaryLogTagType : std::uint8_t {
+    kString = 0,  ///< `str`
+    kInt = 1,     ///< `i64`
+    kUInt = 2,    ///< `u64`
+    kDouble = 3,  ///< IEEE 754 `f64`
+};
+
+/// @brief A record of the logging::Format::kBinary log. Views point into the
+/// buffer passed to logging::BinaryLogReader.
+struct BinaryLogRecord final {
+    using Value = std::variant<std::string_view, std::int64_t, std::uint64_t, double>;
+
+    std::chrono::system_clock::time_point timestamp;
+    Level level{Level::kInfo};
+    std::string_view function;
+    std::string_view file;
+    std::uint32_t line{0};
+    std::vector<std::pair<std::string_view, Value>> tags;
+};
+
+/// @brief Decodes logging::Format::kBinary records from a buffer, e.g. from
+/// a memory-mapped log file.
+class BinaryLogReader final {
+public:
+    explicit BinaryLogReader(std::string_view data) noexcept;
+
+    /// @brief Reads the next record into `record`.
+    /// @returns false if there are no complete records left.
+    /// @throws std::runtime_error if the record is corrupted or has an
+    /// unsupported version.
+    bool Next(BinaryLogRecord& record);
+
+    /// @returns the number of bytes consumed by the complete records, the
+    /// position to continue from once more data is available.
+    std::size_t GetOffset() const noexcept;
+
+private:
+    std::string_view data_;
+    std::size_t offset_{0};
+};
+
+}  // namespace logging
+
+USERVER_NAMESPACE_END
@@ -17,6 +17,7 @@ enum class Format {
     kStruct,
     kJson,
     kJsonYaDeploy,
+    kBinary,  ///< Length-prefixed binary records, see userver/logging/binary_log.hpp
 };
 
 /// Parse Format enum from string
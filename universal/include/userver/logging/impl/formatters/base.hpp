@@ -20,6 +20,8 @@ protected:
 
 using LoggerItemRef = LoggerItemBase&;
 
+class Deferred;
+
 class Base {
 public:
     Base() = default;
@@ -35,6 +37,10 @@ public:
     virtual void SetText(std::string_view text) = 0;
 
     virtual LoggerItemRef ExtractLoggerItem() = 0;
+
+    /// Returns non-null for formatters that store the message text arguments
+    /// as is, leaving their formatting to the logger thread
+    virtual Deferred* AsDeferred() noexcept { return nullptr; }
 };
 
 using BasePtr = std::unique_ptr<Base>;
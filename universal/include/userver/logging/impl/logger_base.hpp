@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 
 #include <boost/container/small_vector.hpp>
 
@@ -79,6 +80,14 @@ public:
     formatters::BasePtr MakeFormatter(Level level, LogClass log_class, const utils::impl::SourceLocation& location)
         override;
 
+    /// Makes a formatter for a record that was created at `timestamp`
+    formatters::BasePtr MakeTextFormatter(
+        Level level,
+        LogClass log_class,
+        const utils::impl::SourceLocation& location,
+        std::chrono::system_clock::time_point timestamp
+    ) const;
+
 private:
     const Format format_;
 };
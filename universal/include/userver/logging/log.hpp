@@ -134,7 +134,7 @@ public:
     bool ShouldNotLog(const LoggerPtr& logger, Level level) const noexcept;
 
 private:
-    static constexpr std::size_t kContentSize = compiler::SelectSize().For64Bit(40).For32Bit(24);
+    static constexpr std::size_t kContentSize = compiler::SelectSize().For64Bit(48).For32Bit(28);
 
     alignas(void*) std::byte content_[kContentSize];
 };
@@ -0,0 +1,34 @@
+#pragma once
+
+/// @file userver/utils/datetime/rfc3339.hpp
+/// @brief Fast RFC 3339 formatting and parsing of time points in UTC.
+/// @ingroup userver_universal
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::datetime {
+
+/// @brief Formats the time point like "2012-12-12T00:00:00.123+00:00".
+///
+/// The result is the same as of
+/// `Timestring(tp, "UTC", kRfc3339Format)`, but the format is fixed at
+/// compile time and no time zone lookup is done.
+std::string ToRfc3339StringUtc(std::chrono::system_clock::time_point tp);
+
+/// @brief Parses strings like "2012-12-12T00:00:00.123+03:00" and
+/// "2012-12-12T00:00:00Z".
+///
+/// Only the strict "YYYY-MM-DDTHH:MM:SS[.fraction](Z|+HH:MM|+HHMM)" form that
+/// fits into std::chrono::system_clock::time_point is accepted. Returns
+/// std::nullopt for anything else, use FromRfc3339StringSaturating() for
+/// those strings.
+std::optional<std::chrono::system_clock::time_point> TryParseRfc3339(std::string_view timestring) noexcept;
+
+}  // namespace utils::datetime
+
+USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <functional>
+#include <limits>
 #include <optional>
 #include <type_traits>
 #include <utility>
@@ -45,7 +46,8 @@ public:
         UASSERT((std::is_same_v<std::invoke_result_t<Hash1, const T&>, std::invoke_result_t<Hash2, const T&>>));
     }
 
-    /// @brief Increments the smallest item counters
+    /// @brief Increments the smallest item counters, saturates at the max value
+    /// of Counter
     void Increment(const T& item);
 
     /// @brief Returns the value of the smallest item counter
@@ -57,6 +59,9 @@ public:
     /// @brief Resets all counters
     void Clear();
 
+    /// @brief Divides all counters by two, so that the old increments fade away
+    void Halve();
+
 private:
     using HashedType = std::invoke_result_t<Hash1, const T&>;
 
@@ -110,7 +115,7 @@ void FilterBloom<T, Counter, Hash1, Hash2>::Increment(const T& item) {
 
     for (std::size_t step = 0; step < kHashFunctionsCount; ++step) {
         auto& current_count = counters_[GetHash(hash_value_1, hash_value_2, Coefficient(step)) % counters_.size()];
-        if (current_count == min_frequency) {
+        if (current_count == min_frequency && current_count != std::numeric_limits<Counter>::max()) {
             current_count++;
         }
     }
@@ -135,6 +140,13 @@ void FilterBloom<T, Counter, Hash1, Hash2>::Clear() {
     }
 }
 
+template <typename T, typename Counter, typename Hash1, typename Hash2>
+void FilterBloom<T, Counter, Hash1, Hash2>::Halve() {
+    for (auto& counter : counters_) {
+        counter /= 2;
+    }
+}
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
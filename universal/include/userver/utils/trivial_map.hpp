@@ -4,7 +4,11 @@
 /// @brief Bidirectional map|sets over string literals or other trivial types.
 
 #include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
 #include <optional>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -561,6 +565,141 @@ private:
     std::size_t index_ = 0;
 };
 
+constexpr std::uint64_t PerfectHashMix(std::uint64_t value) noexcept {
+    // splitmix64 finalizer
+    value ^= value >> 30;
+    value *= 0xBF58476D1CE4E5B9ULL;
+    value ^= value >> 27;
+    value *= 0x94D049BB133111EBULL;
+    value ^= value >> 31;
+    return value;
+}
+
+constexpr std::uint64_t PerfectHashString(std::string_view value) noexcept {
+    // FNV-1a
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (const char c : value) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+constexpr std::size_t PerfectHashTableSize(std::size_t keys_count) noexcept {
+    std::size_t result = 1;
+    while (result < keys_count) result *= 2;
+    return result;
+}
+
+/// Compile-time minimal perfect hash (hash-and-displace) over a global
+/// `constexpr` array of std::string_view. Lookup hashes the input once and
+/// does a single string comparison.
+template <const auto& Keys>
+class StringPerfectHash final {
+public:
+    static constexpr std::optional<std::size_t> GetIndex(std::string_view value) noexcept {
+        const auto hash = PerfectHashString(value);
+        const auto seed = kTable.seeds[PerfectHashMix(hash) & kMask];
+        const auto index = kTable.indices[PerfectHashMix(hash ^ seed) & kMask];
+        if (index != kInvalidSize && std::data(Keys)[index] == value) return index;
+        return std::nullopt;
+    }
+
+private:
+    static constexpr std::size_t kKeysSize = std::size(Keys);
+    static constexpr std::size_t kTableSize = PerfectHashTableSize(kKeysSize);
+    static constexpr std::uint64_t kMask = kTableSize - 1;
+    static constexpr std::uint64_t kMaxSeedAttempts = 1 << 16;
+
+    struct Table {
+        std::uint64_t seeds[kTableSize]{};
+        std::size_t indices[kTableSize]{};
+    };
+
+    static constexpr std::uint64_t SlotSeed(std::uint64_t attempt) noexcept { return attempt * 0x9E3779B97F4A7C15ULL; }
+
+    static constexpr Table Build() {
+        Table table{};
+        for (auto& index : table.indices) index = kInvalidSize;
+
+        std::uint64_t hashes[kKeysSize]{};
+        std::size_t buckets[kKeysSize]{};
+        std::size_t bucket_sizes[kTableSize]{};
+        for (std::size_t i = 0; i < kKeysSize; ++i) {
+            hashes[i] = PerfectHashString(std::data(Keys)[i]);
+            buckets[i] = PerfectHashMix(hashes[i]) & kMask;
+            ++bucket_sizes[buckets[i]];
+        }
+
+        // Largest buckets are placed first, while the table is mostly empty
+        for (std::size_t size = kKeysSize; size > 0; --size) {
+            for (std::size_t bucket = 0; bucket < kTableSize; ++bucket) {
+                if (bucket_sizes[bucket] != size) continue;
+
+                for (std::uint64_t attempt = 1;; ++attempt) {
+                    if (attempt == kMaxSeedAttempts) {
+                        throw std::logic_error("Failed to build a perfect hash, are there duplicate keys?");
+                    }
+
+                    const auto seed = SlotSeed(attempt);
+                    bool placed = true;
+                    for (std::size_t i = 0; i < kKeysSize && placed; ++i) {
+                        if (buckets[i] != bucket) continue;
+                        auto& slot = table.indices[PerfectHashMix(hashes[i] ^ seed) & kMask];
+                        if (slot == kInvalidSize) {
+                            slot = i;
+                        } else {
+                            placed = false;
+                        }
+                    }
+
+                    if (placed) {
+                        table.seeds[bucket] = seed;
+                        break;
+                    }
+
+                    for (std::size_t i = 0; i < kKeysSize; ++i) {
+                        if (buckets[i] != bucket) continue;
+                        auto& slot = table.indices[PerfectHashMix(hashes[i] ^ seed) & kMask];
+                        if (slot == i) slot = kInvalidSize;
+                    }
+                }
+            }
+        }
+
+        return table;
+    }
+
+    static constexpr Table kTable = Build();
+};
+
+template <const auto& Keys, const auto& Values>
+struct TrivialBiMapMultiCaseDispatch;
+
+template <const auto& Values>
+struct TrivialSetMultiCaseDispatch;
+
+// Maps the builder of utils::MakeTrivialBiMap and utils::MakeTrivialSet to
+// the perfect hash over its std::string_view keys
+template <typename BuilderFunc>
+struct StringPerfectHashFor {
+    static constexpr bool kEnabled = false;
+};
+
+template <const auto& Keys, const auto& Values>
+struct StringPerfectHashFor<TrivialBiMapMultiCaseDispatch<Keys, Values>> {
+    static constexpr bool kEnabled =
+        std::is_same_v<std::decay_t<decltype(*std::data(Keys))>, std::string_view> && std::size(Keys) != 0;
+    using Hash = StringPerfectHash<Keys>;
+};
+
+template <const auto& Values>
+struct StringPerfectHashFor<TrivialSetMultiCaseDispatch<Values>> {
+    static constexpr bool kEnabled =
+        std::is_same_v<std::decay_t<decltype(*std::data(Values))>, std::string_view> && std::size(Values) != 0;
+    using Hash = StringPerfectHash<Values>;
+};
+
 }  // namespace impl
 
 /// @ingroup userver_universal userver_containers
@@ -583,6 +722,11 @@ private:
 /// The same story with integral or enum mappings - compiler optimizes them
 /// into a switch and it usually takes O(1) to find the match.
 ///
+/// Maps and sets over std::string_view created by utils::MakeTrivialBiMap and
+/// utils::MakeTrivialSet use a compile-time perfect hash for the search by
+/// the first parameter, so that the lookup cost does not grow with the number
+/// of elements.
+///
 /// @snippet universal/src/utils/trivial_map_test.cpp  sample bidir bimap
 ///
 /// Empty map:
@@ -620,7 +764,13 @@ public:
     }
 
     constexpr std::optional<Second> TryFindByFirst(First value) const noexcept {
-        return func_([value]() { return impl::SwitchByFirst<First, Second>{value}; }).Extract();
+        if constexpr (impl::StringPerfectHashFor<BuilderFunc>::kEnabled) {
+            const auto index = impl::StringPerfectHashFor<BuilderFunc>::Hash::GetIndex(value);
+            if (!index) return std::nullopt;
+            return BuilderFunc::GetSecond(*index);
+        } else {
+            return func_([value]() { return impl::SwitchByFirst<First, Second>{value}; }).Extract();
+        }
     }
 
     constexpr std::optional<First> TryFindBySecond(Second value) const noexcept {
@@ -789,7 +939,11 @@ public:
     }
 
     constexpr bool Contains(First value) const noexcept {
-        return func_([value]() { return impl::SwitchByFirst<First, Second>{value}; }).Extract();
+        if constexpr (impl::StringPerfectHashFor<BuilderFunc>::kEnabled) {
+            return impl::StringPerfectHashFor<BuilderFunc>::Hash::GetIndex(value).has_value();
+        } else {
+            return func_([value]() { return impl::SwitchByFirst<First, Second>{value}; }).Extract();
+        }
     }
 
     constexpr bool ContainsICase(std::string_view value) const noexcept {
@@ -814,7 +968,11 @@ public:
     /// Returns index of the value in Case parameters or std::nullopt if no such
     /// value.
     constexpr std::optional<std::size_t> GetIndex(First value) const {
-        return func_([value]() { return impl::CaseFirstIndexer{value}; }).Extract();
+        if constexpr (impl::StringPerfectHashFor<BuilderFunc>::kEnabled) {
+            return impl::StringPerfectHashFor<BuilderFunc>::Hash::GetIndex(value);
+        } else {
+            return func_([value]() { return impl::CaseFirstIndexer{value}; }).Extract();
+        }
     }
 
     /// Returns index of the case insensitive value in Case parameters or
@@ -893,6 +1051,8 @@ struct TrivialBiMapMultiCaseDispatch {
         constexpr auto kKeysSize = std::size(Keys);
         return impl::TrivialBiMapMultiCase(selector(), Keys, Values, std::make_index_sequence<kKeysSize>{});
     }
+
+    static constexpr auto GetSecond(std::size_t index) noexcept { return std::data(Values)[index]; }
 };
 
 template <typename Selector, class Values, std::size_t... Indices>
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include <userver/cache/clock_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+using Clock = cache::ClockMap<int, int>;
+
+TEST(ClockMap, SetGet) {
+    Clock cache(10);
+    EXPECT_EQ(nullptr, cache.Get(1));
+    EXPECT_TRUE(cache.Put(1, 2));
+    EXPECT_EQ(2, cache.GetOr(1, -1));
+    EXPECT_FALSE(cache.Put(1, 3));
+    EXPECT_EQ(3, cache.GetOr(1, -1));
+    EXPECT_EQ(1, cache.GetSize());
+}
+
+TEST(ClockMap, Erase) {
+    Clock cache(10);
+    cache.Put(1, 2);
+    cache.Put(2, 3);
+    cache.Erase(1);
+    cache.Erase(42);
+    EXPECT_EQ(nullptr, cache.Get(1));
+    EXPECT_EQ(3, cache.GetOr(2, -1));
+    EXPECT_EQ(1, cache.GetSize());
+}
+
+TEST(ClockMap, ReferencedSurvive) {
+    Clock cache(3);
+    cache.Put(1, 1);
+    cache.Put(2, 2);
+    cache.Put(3, 3);
+
+    EXPECT_NE(nullptr, cache.Get(1));
+    EXPECT_NE(nullptr, cache.Get(3));
+    cache.Put(4, 4);
+
+    // The only non-referenced element is evicted
+    EXPECT_EQ(nullptr, cache.Get(2));
+    EXPECT_EQ(1, cache.GetOr(1, -1));
+    EXPECT_EQ(3, cache.GetOr(3, -1));
+    EXPECT_EQ(4, cache.GetOr(4, -1));
+    EXPECT_EQ(3, cache.GetSize());
+}
+
+TEST(ClockMap, AllReferenced) {
+    Clock cache(2);
+    cache.Put(1, 1);
+    cache.Put(2, 2);
+    cache.Get(1);
+    cache.Get(2);
+
+    // The hand clears all the bits and evicts the first element
+    cache.Put(3, 3);
+    EXPECT_EQ(2, cache.GetSize());
+    EXPECT_EQ(nullptr, cache.Get(1));
+    EXPECT_EQ(3, cache.GetOr(3, -1));
+}
+
+TEST(ClockMap, SetMaxSize) {
+    Clock cache(10);
+    for (int i = 0; i < 10; ++i) cache.Put(i, i);
+
+    cache.SetMaxSize(3);
+    EXPECT_EQ(3, cache.GetSize());
+    EXPECT_EQ(3, cache.GetCapacity());
+
+    int visited = 0;
+    cache.VisitAll([&visited](int key, int value) {
+        EXPECT_EQ(key, value);
+        ++visited;
+    });
+    EXPECT_EQ(3, visited);
+
+    cache.Clear();
+    EXPECT_EQ(0, cache.GetSize());
+    cache.Put(1, 1);
+    EXPECT_EQ(1, cache.GetOr(1, -1));
+}
+
+TEST(ClockMap, ManyEvictions) {
+    cache::ClockMap<int, std::string> cache(100);
+    for (int i = 0; i < 10'000; ++i) {
+        cache.Put(i, std::to_string(i));
+        // A hot key is never evicted
+        ASSERT_NE(nullptr, cache.Get(0)) << i;
+        ASSERT_LE(cache.GetSize(), 100);
+    }
+    cache.VisitAll([](int key, const std::string& value) { EXPECT_EQ(std::to_string(key), value); });
+}
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,9 @@
 #include <benchmark/benchmark.h>
 
+#include <userver/cache/clock_map.hpp>
+#include <userver/cache/lru_map.hpp>
 #include <userver/cache/lru_set.hpp>
+#include <userver/cache/tiny_lfu_map.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -51,4 +54,36 @@ void LruPutOverflow(benchmark::State& state) {
 }
 BENCHMARK(LruPutOverflow);
 
+template <typename Map>
+void MapGetPutOverflow(benchmark::State& state) {
+    Map map(kElementsCount);
+    for (unsigned i = 0; i < kElementsCount; ++i) map.Put(i, i);
+
+    unsigned i = kElementsCount;
+    for ([[maybe_unused]] auto _ : state) {
+        for (unsigned j = 0; j < kElementsCount; ++j) {
+            // Every tenth query is a miss that evicts an element
+            if (j % 10 == 0) {
+                ++i;
+                map.Put(i, i);
+            } else {
+                benchmark::DoNotOptimize(map.Get(i - j));
+            }
+        }
+    }
+}
+
+void LruMapGetPutOverflow(benchmark::State& state) { MapGetPutOverflow<cache::LruMap<unsigned, unsigned>>(state); }
+BENCHMARK(LruMapGetPutOverflow);
+
+void ClockMapGetPutOverflow(benchmark::State& state) {
+    MapGetPutOverflow<cache::ClockMap<unsigned, unsigned>>(state);
+}
+BENCHMARK(ClockMapGetPutOverflow);
+
+void TinyLfuMapGetPutOverflow(benchmark::State& state) {
+    MapGetPutOverflow<cache::TinyLfuMap<unsigned, unsigned>>(state);
+}
+BENCHMARK(TinyLfuMapGetPutOverflow);
+
 USERVER_NAMESPACE_END
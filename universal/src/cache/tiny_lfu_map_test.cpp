@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/cache/tiny_lfu_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+using TinyLfu = cache::TinyLfuMap<int, int>;
+
+namespace {
+
+// Hot keys are queried 10 times each and are interleaved with a scan over
+// the cold keys that are never queried again
+template <typename Map>
+int CountHotHits(Map& map) {
+    constexpr int kHotKeys = 50;
+
+    int hits = 0;
+    int cold_key = 1000;
+    for (int round = 0; round < 10; ++round) {
+        for (int key = 0; key < kHotKeys; ++key) {
+            if (map.Get(key)) {
+                ++hits;
+            } else {
+                map.Put(key, key);
+            }
+        }
+        for (int i = 0; i < 200; ++i, ++cold_key) {
+            if (!map.Get(cold_key)) map.Put(cold_key, cold_key);
+        }
+    }
+    return hits;
+}
+
+}  // namespace
+
+TEST(TinyLfuMap, SetGet) {
+    TinyLfu cache(10);
+    EXPECT_EQ(nullptr, cache.Get(1));
+    EXPECT_TRUE(cache.Put(1, 2));
+    EXPECT_EQ(2, cache.GetOr(1, -1));
+    EXPECT_FALSE(cache.Put(1, 3));
+    EXPECT_EQ(3, cache.GetOr(1, -1));
+    EXPECT_EQ(1, cache.GetSize());
+}
+
+TEST(TinyLfuMap, Erase) {
+    TinyLfu cache(10);
+    cache.Put(1, 2);
+    cache.Put(2, 3);
+    cache.Erase(1);
+    cache.Erase(42);
+    EXPECT_EQ(nullptr, cache.Get(1));
+    EXPECT_EQ(3, cache.GetOr(2, -1));
+    EXPECT_EQ(1, cache.GetSize());
+}
+
+TEST(TinyLfuMap, SizeIsBounded) {
+    TinyLfu cache(100);
+    EXPECT_EQ(100, cache.GetCapacity());
+    for (int i = 0; i < 1000; ++i) {
+        cache.Put(i, i);
+        EXPECT_LE(cache.GetSize(), cache.GetCapacity());
+    }
+    EXPECT_EQ(100, cache.GetSize());
+
+    cache.SetMaxSize(10);
+    EXPECT_EQ(10, cache.GetCapacity());
+    EXPECT_EQ(10, cache.GetSize());
+
+    cache.Clear();
+    EXPECT_EQ(0, cache.GetSize());
+}
+
+TEST(TinyLfuMap, SmallCapacity) {
+    TinyLfu cache(1);
+    EXPECT_EQ(3, cache.GetCapacity());
+    for (int i = 0; i < 10; ++i) cache.Put(i, i);
+    EXPECT_EQ(3, cache.GetSize());
+}
+
+TEST(TinyLfuMap, FrequentSurviveScan) {
+    TinyLfu cache(100);
+    for (int i = 0; i < 50; ++i) cache.Put(i, i);
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 50; ++i) cache.Get(i);
+    }
+
+    for (int i = 1000; i < 2000; ++i) cache.Put(i, i);
+    EXPECT_GT(cache.GetAdmissionRejects(), 0);
+
+    int hot_left = 0;
+    for (int i = 0; i < 50; ++i) {
+        if (cache.Get(i)) ++hot_left;
+    }
+    EXPECT_EQ(50, hot_left);
+}
+
+TEST(TinyLfuMap, ScanResistance) {
+    cache::LruMap<int, int> lru(100);
+    TinyLfu tiny_lfu(100);
+
+    const auto lru_hits = CountHotHits(lru);
+    const auto tiny_lfu_hits = CountHotHits(tiny_lfu);
+    EXPECT_EQ(0, lru_hits);
+    EXPECT_GT(tiny_lfu_hits, 250);
+}
+
+USERVER_NAMESPACE_END
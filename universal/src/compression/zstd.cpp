@@ -2,6 +2,8 @@
 
 #include <memory>
 
+#include <fmt/format.h>
+
 #include <zstd.h>
 #include <zstd_errors.h>
 
@@ -12,6 +14,37 @@ namespace compression::zstd {
 namespace {
 // The same size as in ZSTD_DStreamOutSize();
 const size_t kDecompressBufferSize = ZSTD_DStreamOutSize();
+
+struct CCtxDeleter {
+    void operator()(ZSTD_CCtx* ctx) const noexcept { ZSTD_freeCCtx(ctx); }
+};
+using CCtx = std::unique_ptr<ZSTD_CCtx, CCtxDeleter>;
+
+struct DCtxDeleter {
+    void operator()(ZSTD_DCtx* ctx) const noexcept { ZSTD_freeDCtx(ctx); }
+};
+using DCtx = std::unique_ptr<ZSTD_DCtx, DCtxDeleter>;
+
+void CheckCompressionResult(std::size_t ret) {
+    if (ZSTD_isError(ret)) {
+        throw CompressionError(fmt::format("Compression failed: {}", ZSTD_getErrorName(ret)));
+    }
+}
+
+void CheckDecompressionResult(std::size_t ret) {
+    if (ZSTD_isError(ret)) {
+        throw ErrWithCode(ZSTD_getErrorName(ret));
+    }
+}
+
+CCtx MakeCCtx(int level) {
+    CCtx ctx{ZSTD_createCCtx()};
+    if (!ctx) {
+        throw CompressionError("Couldn't create ZSTD compression context");
+    }
+    CheckCompressionResult(ZSTD_CCtx_setParameter(ctx.get(), ZSTD_c_compressionLevel, level));
+    return ctx;
+}
 }  // namespace
 
 std::string DecompressStream(std::string_view compressed, size_t max_size) {
@@ -80,5 +113,93 @@ std::string Decompress(std::string_view compressed, size_t max_size) {
     return decompressed;
 }
 
+std::string Compress(std::string_view data, int level) {
+    std::string compressed(ZSTD_compressBound(data.size()), '\0');
+    const auto ret = ZSTD_compress(compressed.data(), compressed.size(), data.data(), data.size(), level);
+    CheckCompressionResult(ret);
+    compressed.resize(ret);
+    return compressed;
+}
+
+struct StreamCompressor::Impl final {
+    std::string Process(std::string_view chunk, ZSTD_EndDirective directive) {
+        std::string result;
+        ZSTD_inBuffer input{chunk.data(), chunk.size(), 0};
+        std::size_t remaining = 0;
+        do {
+            const auto old_size = result.size();
+            result.resize(old_size + ZSTD_compressBound(input.size - input.pos) + ZSTD_CStreamOutSize());
+            ZSTD_outBuffer output{result.data() + old_size, result.size() - old_size, 0};
+            remaining = ZSTD_compressStream2(ctx.get(), &output, &input, directive);
+            CheckCompressionResult(remaining);
+            result.resize(old_size + output.pos);
+        } while (remaining != 0 || input.pos != input.size);
+        return result;
+    }
+
+    CCtx ctx;
+};
+
+StreamCompressor::StreamCompressor(int level) : impl_(std::make_unique<Impl>(Impl{MakeCCtx(level)})) {}
+
+StreamCompressor::StreamCompressor(int level, std::string_view dictionary) : StreamCompressor(level) {
+    CheckCompressionResult(ZSTD_CCtx_loadDictionary(impl_->ctx.get(), dictionary.data(), dictionary.size()));
+}
+
+StreamCompressor::StreamCompressor(StreamCompressor&&) noexcept = default;
+
+StreamCompressor& StreamCompressor::operator=(StreamCompressor&&) noexcept = default;
+
+StreamCompressor::~StreamCompressor() = default;
+
+std::string StreamCompressor::Compress(std::string_view chunk) { return impl_->Process(chunk, ZSTD_e_flush); }
+
+std::string StreamCompressor::Append(std::string_view chunk) { return impl_->Process(chunk, ZSTD_e_continue); }
+
+std::string StreamCompressor::Finish() { return impl_->Process({}, ZSTD_e_end); }
+
+void StreamCompressor::Reset() { ZSTD_CCtx_reset(impl_->ctx.get(), ZSTD_reset_session_only); }
+
+struct StreamDecompressor::Impl final {
+    DCtx ctx;
+    std::string buffer = std::string(kDecompressBufferSize, '\0');
+};
+
+StreamDecompressor::StreamDecompressor(std::string_view dictionary) : impl_(std::make_unique<Impl>()) {
+    impl_->ctx.reset(ZSTD_createDCtx());
+    if (!impl_->ctx) {
+        throw ErrWithCode("Couldn't create ZSTD decompression context");
+    }
+    if (!dictionary.empty()) {
+        CheckDecompressionResult(ZSTD_DCtx_loadDictionary(impl_->ctx.get(), dictionary.data(), dictionary.size()));
+    }
+}
+
+StreamDecompressor::StreamDecompressor(StreamDecompressor&&) noexcept = default;
+
+StreamDecompressor& StreamDecompressor::operator=(StreamDecompressor&&) noexcept = default;
+
+StreamDecompressor::~StreamDecompressor() = default;
+
+bool StreamDecompressor::Decompress(std::string_view& input, std::string& output) {
+    ZSTD_inBuffer in{input.data(), input.size(), 0};
+    std::size_t ret = 0;
+    while (true) {
+        ZSTD_outBuffer out{impl_->buffer.data(), impl_->buffer.size(), 0};
+        ret = ZSTD_decompressStream(impl_->ctx.get(), &out, &in);
+        CheckDecompressionResult(ret);
+        output.append(impl_->buffer.data(), out.pos);
+
+        if (ret == 0) break;
+        // A full output buffer means that there may be more data to flush
+        if (in.pos == in.size && out.pos < out.size) break;
+    }
+
+    input.remove_prefix(in.pos);
+    return ret == 0;
+}
+
+void StreamDecompressor::Reset() { ZSTD_DCtx_reset(impl_->ctx.get(), ZSTD_reset_session_only); }
+
 }  // namespace compression::zstd
 USERVER_NAMESPACE_END
@@ -44,4 +44,39 @@ static void ZstdDecompress(benchmark::State& state) {
 }
 BENCHMARK(ZstdDecompress)->RangeMultiplier(2)->Range(1 << 10, 1 << 15);
 
+// Chunks of a request body decompressed with a reused context
+static void ZstdStreamDecompress(benchmark::State& state) {
+    constexpr std::size_t kChunkSize = 4096;
+    const auto compressed = compression::zstd::Compress(GenerateRandomData(state.range(0)), 1);
+
+    compression::zstd::StreamDecompressor decompressor;
+    std::string decompressed;
+    for ([[maybe_unused]] auto _ : state) {
+        decompressed.clear();
+        std::string_view input = compressed;
+        while (!input.empty()) {
+            auto chunk = input.substr(0, kChunkSize);
+            const auto chunk_size = chunk.size();
+            decompressor.Decompress(chunk, decompressed);
+            input.remove_prefix(chunk_size - chunk.size());
+        }
+        decompressor.Reset();
+        benchmark::DoNotOptimize(decompressed);
+    }
+}
+BENCHMARK(ZstdStreamDecompress)->RangeMultiplier(2)->Range(1 << 10, 1 << 15);
+
+static void ZstdStreamCompressReused(benchmark::State& state) {
+    const auto data = GenerateRandomData(state.range(0));
+
+    compression::zstd::StreamCompressor compressor{1};
+    for ([[maybe_unused]] auto _ : state) {
+        auto compressed = compressor.Append(data);
+        compressed += compressor.Finish();
+        benchmark::DoNotOptimize(compressed);
+        compressor.Reset();
+    }
+}
+BENCHMARK(ZstdStreamCompressReused)->RangeMultiplier(2)->Range(1 << 10, 1 << 15);
+
 USERVER_NAMESPACE_END
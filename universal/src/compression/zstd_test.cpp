@@ -60,4 +60,86 @@ TEST(Zstd, TestOverflow) {
     );
 }
 
+TEST(Zstd, CompressRoundTrip) {
+    std::string data;
+    for (int i = 0; i < 10'000; ++i) data += "{\"key\":" + std::to_string(i) + "},";
+
+    const auto compressed = compression::zstd::Compress(data);
+    EXPECT_LT(compressed.size(), data.size() / 4);
+    EXPECT_EQ(compression::zstd::Decompress(compressed, data.size()), data);
+}
+
+TEST(Zstd, StreamCompressor) {
+    const std::string chunk(5'000, 'a');
+    compression::zstd::StreamCompressor compressor;
+
+    std::string compressed;
+    for (int i = 0; i < 10; ++i) {
+        const auto compressed_chunk = compressor.Compress(chunk);
+        // Flushed chunks are decodable right away
+        EXPECT_FALSE(compressed_chunk.empty());
+        compressed += compressed_chunk;
+    }
+    compressed += compressor.Finish();
+
+    std::string expected;
+    for (int i = 0; i < 10; ++i) expected += chunk;
+    EXPECT_EQ(compression::zstd::Decompress(compressed, expected.size()), expected);
+}
+
+TEST(Zstd, StreamDecompressor) {
+    std::string data;
+    for (int i = 0; i < 100'000; ++i) data += std::to_string(i);
+
+    compression::zstd::StreamCompressor compressor;
+    const auto compressed = compressor.Append(data) + compressor.Finish();
+    const auto trailing = std::string{"trailing"};
+    const auto input_data = compressed + trailing;
+
+    compression::zstd::StreamDecompressor decompressor;
+    std::string decompressed;
+    bool frame_ended = false;
+    std::string_view input = input_data;
+    while (!frame_ended) {
+        auto chunk = input.substr(0, 100);
+        frame_ended = decompressor.Decompress(chunk, decompressed);
+        input.remove_prefix(std::min<std::size_t>(input.size(), 100) - chunk.size());
+    }
+
+    EXPECT_EQ(decompressed, data);
+    EXPECT_EQ(input, trailing);
+}
+
+TEST(Zstd, StreamReset) {
+    compression::zstd::StreamCompressor compressor;
+    compression::zstd::StreamDecompressor decompressor;
+
+    for (const std::string data : {"first frame", "second frame"}) {
+        auto compressed = compressor.Append(data);
+        compressed += compressor.Finish();
+        compressor.Reset();
+
+        std::string decompressed;
+        std::string_view input = compressed;
+        EXPECT_TRUE(decompressor.Decompress(input, decompressed));
+        EXPECT_EQ(decompressed, data);
+        decompressor.Reset();
+    }
+}
+
+TEST(Zstd, Dictionary) {
+    const std::string dictionary = "{\"name\":\"value\",\"another-name\":\"another-value\"}";
+    const std::string data = "{\"name\":\"value\"}";
+
+    compression::zstd::StreamCompressor compressor{compression::zstd::kDefaultCompressionLevel, dictionary};
+    const auto compressed = compressor.Append(data) + compressor.Finish();
+
+    compression::zstd::StreamDecompressor decompressor{dictionary};
+    std::string decompressed;
+    std::string_view input = compressed;
+    EXPECT_TRUE(decompressor.Decompress(input, decompressed));
+    EXPECT_EQ(decompressed, data);
+    EXPECT_TRUE(input.empty());
+}
+
 USERVER_NAMESPACE_END
@@ -1,11 +1,17 @@
 #include <userver/crypto/base64.hpp>
 
-#include <cryptopp/base64.h>
+#include <array>
+#include <cstdint>
+#include <string>
 
-#include <userver/crypto/exception.hpp>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
 
-#ifdef CRYPTOPP_NO_GLOBAL_BYTE
-using CryptoPP::byte;
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
 #endif
 
 USERVER_NAMESPACE_BEGIN
@@ -14,46 +20,284 @@ namespace crypto::base64 {
 
 namespace {
 
-template <typename Base64Encoder>
-std::string Base64Encode(std::string_view data, Pad pad) {
-    std::string response;
-    try {
-        Base64Encoder encoder(new CryptoPP::StringSink(response));
-        CryptoPP::AlgorithmParameters params = CryptoPP::MakeParameters(CryptoPP::Name::Pad(), Pad::kWith == pad)(
-            CryptoPP::Name::InsertLineBreaks(), false
+// The encoding is implemented here instead of CryptoPP filters, which are an
+// order of magnitude slower. The decoding follows CryptoPP: characters outside
+// of the alphabet (including padding) are skipped, trailing bits are dropped.
+
+constexpr std::string_view kStandardChars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+constexpr std::string_view kUrlChars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+static_assert(kStandardChars.size() == 64 && kUrlChars.size() == 64);
+
+constexpr std::int8_t kInvalid = -1;
+
+struct Alphabet final {
+    constexpr explicit Alphabet(std::string_view chars) : chars(chars), values() {
+        for (auto& value : values) value = kInvalid;
+        for (std::size_t i = 0; i < chars.size(); ++i) {
+            values[static_cast<unsigned char>(chars[i])] = static_cast<std::int8_t>(i);
+        }
+    }
+
+    std::string_view chars;
+    std::array<std::int8_t, 256> values;
+};
+
+constexpr Alphabet kStandardAlphabet{kStandardChars};
+constexpr Alphabet kUrlAlphabet{kUrlChars};
+
+constexpr char kPadChar = '=';
+
+#if defined(__SSSE3__)
+
+// Encoding and decoding of 12 bytes in 16-byte registers, see
+// http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html
+
+// Spreads each 3 bytes into 4 bytes with 6 bits in each
+__m128i ReshuffleForEncoding(__m128i in) noexcept {
+    in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    const auto t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+    const auto t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const auto t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+    const auto t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    return _mm_or_si128(t1, t3);
+}
+
+// Maps 6-bit values to the alphabet characters by adding the offset of the
+// alphabet range that the value belongs to
+__m128i LookupCharacters(__m128i values, const Alphabet& alphabet) noexcept {
+    const auto offsets = _mm_setr_epi8(
+        'a' - 26,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        static_cast<char>(alphabet.chars[62] - 62),
+        static_cast<char>(alphabet.chars[63] - 63),
+        'A',
+        0,
+        0
+    );
+    // 0..25 -> 13, 26..51 -> 0, 52..63 -> 1..12
+    auto offset_index = _mm_subs_epu8(values, _mm_set1_epi8(51));
+    const auto is_upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), values);
+    offset_index = _mm_or_si128(offset_index, _mm_and_si128(is_upper, _mm_set1_epi8(13)));
+    return _mm_add_epi8(values, _mm_shuffle_epi8(offsets, offset_index));
+}
+
+__m128i InRange(__m128i chars, char first, char last) noexcept {
+    return _mm_and_si128(
+        _mm_cmpgt_epi8(chars, _mm_set1_epi8(static_cast<char>(first - 1))),
+        _mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(last + 1)), chars)
+    );
+}
+
+// Decodes 16 characters into 12 bytes, writes 16 bytes to `dst`. Returns false
+// if there are characters outside of the alphabet.
+bool DecodeBlock(const unsigned char* src, unsigned char* dst, const Alphabet& alphabet) noexcept {
+    const auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+
+    // bytes >= 0x80 are negative and are outside of all the ranges
+    const auto is_upper = InRange(chars, 'A', 'Z');
+    const auto is_lower = InRange(chars, 'a', 'z');
+    const auto is_digit = InRange(chars, '0', '9');
+    const auto is_62 = _mm_cmpeq_epi8(chars, _mm_set1_epi8(alphabet.chars[62]));
+    const auto is_63 = _mm_cmpeq_epi8(chars, _mm_set1_epi8(alphabet.chars[63]));
+
+    const auto is_valid =
+        _mm_or_si128(_mm_or_si128(_mm_or_si128(is_upper, is_lower), _mm_or_si128(is_digit, is_62)), is_63);
+    if (_mm_movemask_epi8(is_valid) != 0xffff) return false;
+
+    auto offsets = _mm_and_si128(is_upper, _mm_set1_epi8(-'A'));
+    offsets = _mm_or_si128(offsets, _mm_and_si128(is_lower, _mm_set1_epi8(26 - 'a')));
+    offsets = _mm_or_si128(offsets, _mm_and_si128(is_digit, _mm_set1_epi8(52 - '0')));
+    offsets = _mm_or_si128(offsets, _mm_and_si128(is_62, _mm_set1_epi8(static_cast<char>(62 - alphabet.chars[62]))));
+    offsets = _mm_or_si128(offsets, _mm_and_si128(is_63, _mm_set1_epi8(static_cast<char>(63 - alphabet.chars[63]))));
+    const auto values = _mm_add_epi8(chars, offsets);
+
+    // packs 4 6-bit values into 3 bytes of each 32-bit lane, then the lanes
+    const auto merged_pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    const auto merged_quads = _mm_madd_epi16(merged_pairs, _mm_set1_epi32(0x00011000));
+    const auto packed =
+        _mm_shuffle_epi8(merged_quads, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), packed);
+    return true;
+}
+
+#endif
+
+#if defined(__AVX2__)
+
+// Same as the SSSE3 functions above, but for two 12-byte blocks at once
+__m256i ReshuffleForEncoding(__m256i in) noexcept {
+    in = _mm256_shuffle_epi8(
+        in,
+        _mm256_broadcastsi128_si256(_mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1))
+    );
+    const auto t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+    const auto t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    const auto t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+    const auto t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    return _mm256_or_si256(t1, t3);
+}
+
+__m256i LookupCharacters(__m256i values, const Alphabet& alphabet) noexcept {
+    const auto offsets = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+        'a' - 26,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        '0' - 52,
+        static_cast<char>(alphabet.chars[62] - 62),
+        static_cast<char>(alphabet.chars[63] - 63),
+        'A',
+        0,
+        0
+    ));
+    auto offset_index = _mm256_subs_epu8(values, _mm256_set1_epi8(51));
+    const auto is_upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), values);
+    offset_index = _mm256_or_si256(offset_index, _mm256_and_si256(is_upper, _mm256_set1_epi8(13)));
+    return _mm256_add_epi8(values, _mm256_shuffle_epi8(offsets, offset_index));
+}
+
+#endif
+
+std::string Encode(std::string_view data, Pad pad, const Alphabet& alphabet) {
+    const auto tail_size = data.size() % 3;
+    const std::size_t tail_chars = tail_size == 0 ? 0 : (pad == Pad::kWith ? 4 : tail_size + 1);
+    std::string result(data.size() / 3 * 4 + tail_chars, '\0');
+
+    const auto* src = reinterpret_cast<const unsigned char*>(data.data());
+    const auto* const src_end = src + (data.size() - tail_size);
+    auto* dst = result.data();
+
+#if defined(__AVX2__)
+    // the second half is loaded from src + 12 and reads 16 bytes
+    while (src_end - src >= 28) {
+        const auto in = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src))),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 12)),
+            1
+        );
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(dst), LookupCharacters(ReshuffleForEncoding(in), alphabet)
+        );
+        src += 24;
+        dst += 32;
+    }
+#endif
+
+#if defined(__SSSE3__)
+    // 16 bytes are loaded, 12 of them are encoded
+    while (src_end - src >= 16) {
+        const auto in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), LookupCharacters(ReshuffleForEncoding(in), alphabet));
+        src += 12;
+        dst += 16;
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    const uint8x16x4_t table{{
+        vld1q_u8(reinterpret_cast<const std::uint8_t*>(alphabet.chars.data())),
+        vld1q_u8(reinterpret_cast<const std::uint8_t*>(alphabet.chars.data() + 16)),
+        vld1q_u8(reinterpret_cast<const std::uint8_t*>(alphabet.chars.data() + 32)),
+        vld1q_u8(reinterpret_cast<const std::uint8_t*>(alphabet.chars.data() + 48)),
+    }};
+    while (src_end - src >= 48) {
+        // deinterleaves the first, the second and the third bytes of the triples
+        const auto in = vld3q_u8(src);
+        uint8x16x4_t out;
+        out.val[0] = vqtbl4q_u8(table, vshrq_n_u8(in.val[0], 2));
+        out.val[1] = vqtbl4q_u8(
+            table, vorrq_u8(vshlq_n_u8(vandq_u8(in.val[0], vdupq_n_u8(0x03)), 4), vshrq_n_u8(in.val[1], 4))
+        );
+        out.val[2] = vqtbl4q_u8(
+            table, vorrq_u8(vshlq_n_u8(vandq_u8(in.val[1], vdupq_n_u8(0x0f)), 2), vshrq_n_u8(in.val[2], 6))
         );
-        encoder.IsolatedInitialize(params);
-        encoder.PutMessageEnd(reinterpret_cast<const byte*>(data.data()), data.size());
-    } catch (const CryptoPP::Exception& exc) {
-        throw crypto::CryptoException(exc.what());
+        out.val[3] = vqtbl4q_u8(table, vandq_u8(in.val[2], vdupq_n_u8(0x3f)));
+        vst4q_u8(reinterpret_cast<std::uint8_t*>(dst), out);
+        src += 48;
+        dst += 64;
     }
-    return response;
+#endif
+
+    const auto* chars = alphabet.chars.data();
+    for (; src != src_end; src += 3, dst += 4) {
+        const std::uint32_t triple = (src[0] << 16) | (src[1] << 8) | src[2];
+        dst[0] = chars[triple >> 18];
+        dst[1] = chars[(triple >> 12) & 0x3f];
+        dst[2] = chars[(triple >> 6) & 0x3f];
+        dst[3] = chars[triple & 0x3f];
+    }
+
+    if (tail_size != 0) {
+        const std::uint32_t triple = (src[0] << 16) | (tail_size == 2 ? src[1] << 8 : 0);
+        dst[0] = chars[triple >> 18];
+        dst[1] = chars[(triple >> 12) & 0x3f];
+        if (tail_size == 2) dst[2] = chars[(triple >> 6) & 0x3f];
+        if (pad == Pad::kWith) {
+            if (tail_size == 1) dst[2] = kPadChar;
+            dst[3] = kPadChar;
+        }
+    }
+    return result;
 }
 
-template <typename Base64Decoder>
-std::string Base64Decode(std::string_view data) {
-    std::string response;
-    try {
-        Base64Decoder decoder(new CryptoPP::StringSink(response));
-        decoder.PutMessageEnd(reinterpret_cast<const byte*>(data.data()), data.size());
-    } catch (const CryptoPP::Exception& exc) {
-        throw crypto::CryptoException(exc.what());
+std::string Decode(std::string_view data, const Alphabet& alphabet) {
+    // the vectorized decoding writes 16 bytes for each 12 bytes of the result
+    std::string result(data.size() / 4 * 3 + 16, '\0');
+
+    const auto* src = reinterpret_cast<const unsigned char*>(data.data());
+    const auto* const src_end = src + data.size();
+    auto* dst = reinterpret_cast<unsigned char*>(result.data());
+
+#if defined(__SSSE3__)
+    // stops at the first block with padding or garbage, the rest is decoded
+    // by the scalar loop
+    while (src_end - src >= 16 && DecodeBlock(src, dst, alphabet)) {
+        src += 16;
+        dst += 12;
     }
-    return response;
+#endif
+
+    std::uint32_t accumulator = 0;
+    int accumulated_bits = 0;
+    for (; src != src_end; ++src) {
+        const auto value = alphabet.values[*src];
+        if (value == kInvalid) continue;
+
+        accumulator = (accumulator << 6) | static_cast<std::uint32_t>(value);
+        accumulated_bits += 6;
+        if (accumulated_bits >= 8) {
+            accumulated_bits -= 8;
+            *dst++ = static_cast<unsigned char>(accumulator >> accumulated_bits);
+        }
+    }
+
+    result.resize(dst - reinterpret_cast<unsigned char*>(result.data()));
+    return result;
 }
 
 }  // namespace
 
-std::string Base64Encode(std::string_view data, Pad pad) { return Base64Encode<CryptoPP::Base64Encoder>(data, pad); }
+std::string Base64Encode(std::string_view data, Pad pad) { return Encode(data, pad, kStandardAlphabet); }
 
-std::string Base64Decode(std::string_view data) { return Base64Decode<CryptoPP::Base64Decoder>(data); }
+std::string Base64Decode(std::string_view data) { return Decode(data, kStandardAlphabet); }
 
 #ifndef USERVER_NO_CRYPTOPP_BASE64_URL
-std::string Base64UrlEncode(std::string_view data, Pad pad) {
-    return Base64Encode<CryptoPP::Base64URLEncoder>(data, pad);
-}
+std::string Base64UrlEncode(std::string_view data, Pad pad) { return Encode(data, pad, kUrlAlphabet); }
 
-std::string Base64UrlDecode(std::string_view data) { return Base64Decode<CryptoPP::Base64URLDecoder>(data); }
+std::string Base64UrlDecode(std::string_view data) { return Decode(data, kUrlAlphabet); }
 #endif
 
 }  // namespace crypto::base64
@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <userver/crypto/base64.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string GenerateSource(std::size_t size) {
+    std::string source;
+    source.reserve(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        source.push_back(static_cast<char>(i * 7 + i / 256));
+    }
+    return source;
+}
+
+}  // namespace
+
+void base64_encode(benchmark::State& state) {
+    const auto source = GenerateSource(state.range(0));
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(crypto::base64::Base64Encode(source));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(base64_encode)->RangeMultiplier(8)->Range(16, 1 << 20);
+
+void base64_decode(benchmark::State& state) {
+    const auto encoded = crypto::base64::Base64Encode(GenerateSource(state.range(0)));
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(crypto::base64::Base64Decode(encoded));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(base64_decode)->RangeMultiplier(8)->Range(16, 1 << 20);
+
+#ifndef USERVER_NO_CRYPTOPP_BASE64_URL
+void base64_url_encode(benchmark::State& state) {
+    const auto source = GenerateSource(state.range(0));
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(crypto::base64::Base64UrlEncode(source, crypto::base64::Pad::kWithout));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(base64_url_encode)->RangeMultiplier(8)->Range(16, 1 << 20);
+#endif
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <string>
+
 #include <userver/crypto/base64.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -15,6 +17,28 @@ TEST(Crypto, Base64) {
     EXPECT_EQ("U/8=", crypto::base64::Base64Encode("S\xff"));
 }
 
+TEST(Crypto, Base64Roundtrip) {
+    // long enough inputs to go through the vectorized loops and their tails
+    for (std::size_t size = 0; size < 200; ++size) {
+        std::string source;
+        for (std::size_t i = 0; i < size; ++i) source.push_back(static_cast<char>(i * 37 + size));
+
+        const auto encoded = crypto::base64::Base64Encode(source);
+        EXPECT_EQ(encoded.size(), (size + 2) / 3 * 4);
+        EXPECT_EQ(source, crypto::base64::Base64Decode(encoded)) << "size=" << size;
+        const auto unpadded = crypto::base64::Base64Encode(source, crypto::base64::Pad::kWithout);
+        EXPECT_EQ(source, crypto::base64::Base64Decode(unpadded)) << "size=" << size;
+    }
+}
+
+TEST(Crypto, Base64DecodeSkipsGarbage) {
+    const std::string source(100, 'x');
+    auto encoded = crypto::base64::Base64Encode(source);
+    encoded.insert(50, "\n\t$");
+    encoded.insert(10, " ");
+    EXPECT_EQ(source, crypto::base64::Base64Decode(encoded));
+}
+
 #ifndef USERVER_NO_CRYPTOPP_BASE64_URL
 TEST(Crypto, Base64Url) {
     EXPECT_EQ("U_8=", crypto::base64::Base64UrlEncode("S\xff"));
@@ -2,16 +2,15 @@
 
 #include <array>
 
-#include <cryptopp/base64.h>
 #ifndef USERVER_NO_CRYPTOPP_BLAKE2
 #include <cryptopp/blake2.h>
 #endif
-#include <cryptopp/filters.h>
-#include <cryptopp/hex.h>
 #include <cryptopp/hmac.h>
 #include <cryptopp/sha.h>
 
+#include <userver/crypto/base64.hpp>
 #include <userver/crypto/exception.hpp>
+#include <userver/utils/encoding/hex.hpp>
 
 #include <cryptopp/md5.h>
 
@@ -33,47 +32,30 @@ public:
 #endif
 
 std::string EncodeArray(const byte* ptr, size_t length, crypto::hash::OutputEncoding encoding) {
-    std::string response;
+    const std::string_view digest{reinterpret_cast<const char*>(ptr), length};
     switch (encoding) {
-        case crypto::hash::OutputEncoding::kBinary: {
-            response = std::string(reinterpret_cast<const char*>(ptr), length);
-            break;
-        }
-        case crypto::hash::OutputEncoding::kBase16: {
-            CryptoPP::HexEncoder encoder(new CryptoPP::StringSink(response), false);
-            encoder.PutMessageEnd(ptr, length);
-            break;
-        }
-        case crypto::hash::OutputEncoding::kBase64: {
-            CryptoPP::Base64Encoder encoder(new CryptoPP::StringSink(response), false);
-            encoder.PutMessageEnd(ptr, length);
-            break;
-        }
+        case crypto::hash::OutputEncoding::kBinary:
+            return std::string{digest};
+        case crypto::hash::OutputEncoding::kBase16:
+            return utils::encoding::ToHex(digest);
+        case crypto::hash::OutputEncoding::kBase64:
+            return crypto::base64::Base64Encode(digest);
     }
-    return response;
-}
-
-std::string EncodeString(std::string_view data, crypto::hash::OutputEncoding encoding) {
-    return EncodeArray(reinterpret_cast<const byte*>(data.data()), data.size(), encoding);
+    return {};
 }
 
 template <typename HashAlgorithm>
 std::string CalculateHmac(std::string_view key, std::string_view data, crypto::hash::OutputEncoding encoding) {
-    std::string mac;
-
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init): performance
+    std::array<byte, HashAlgorithm::DIGESTSIZE> mac;
     try {
         CryptoPP::HMAC<HashAlgorithm> hmac(reinterpret_cast<const byte*>(key.data()), key.size());
-        CryptoPP::StringSource ss_key(
-            reinterpret_cast<const byte*>(data.data()),
-            data.size(),
-            true,
-            new CryptoPP::HashFilter(hmac, new CryptoPP::StringSink(mac))
-        );
+        hmac.CalculateDigest(mac.data(), reinterpret_cast<const byte*>(data.data()), data.size());
     } catch (const CryptoPP::Exception& exc) {
         throw crypto::CryptoException(exc.what());
     }
 
-    return EncodeString(mac, encoding);
+    return EncodeArray(mac.data(), mac.size(), encoding);
 }
 
 template <typename HashAlgorithm>
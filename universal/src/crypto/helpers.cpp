@@ -92,6 +92,30 @@ EvpMdCtx::~EvpMdCtx() {
 
 EvpMdCtx::EvpMdCtx(EvpMdCtx&& other) noexcept : ctx_(std::exchange(other.ctx_, nullptr)) {}
 
+EvpMdCtx EvpMdCtx::CopyOf(const EVP_MD_CTX& prototype) {
+    EvpMdCtx ctx;
+    if (1 != EVP_MD_CTX_copy_ex(ctx.Get(), &prototype)) {
+        throw CryptoException(FormatSslError("Failed to copy EVP_MD_CTX"));
+    }
+    return ctx;
+}
+
+std::shared_ptr<EVP_MD_CTX> EvpMdCtx::ToShared() && {
+#if OPENSSL_VERSION_NUMBER >= 0x010100000L
+    return {std::exchange(ctx_, nullptr), &EVP_MD_CTX_free};
+#else
+    return {std::exchange(ctx_, nullptr), &EVP_MD_CTX_destroy};
+#endif
+}
+
+std::shared_ptr<EVP_PKEY_CTX> MakeEvpPkeyCtx(EVP_PKEY* pkey) {
+    return {EVP_PKEY_CTX_new(pkey, nullptr), &EVP_PKEY_CTX_free};
+}
+
+std::unique_ptr<EVP_PKEY_CTX, decltype(&EVP_PKEY_CTX_free)> DupEvpPkeyCtx(EVP_PKEY_CTX& prototype) {
+    return {EVP_PKEY_CTX_dup(&prototype), &EVP_PKEY_CTX_free};
+}
+
 decltype(&crypto::hash::HmacSha256) GetHmacFuncByEnum(DigestSize bits) {
     switch (bits) {
         case DigestSize::k160:
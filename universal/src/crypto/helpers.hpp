@@ -24,8 +24,14 @@ public:
     EvpMdCtx(const EvpMdCtx&) = delete;
     EvpMdCtx(EvpMdCtx&&) noexcept;
 
+    /// Copies an initialized context along with its key context
+    static EvpMdCtx CopyOf(const EVP_MD_CTX& prototype);
+
     EVP_MD_CTX* Get() { return ctx_; }
 
+    /// Passes the ownership of the context to a shared pointer
+    std::shared_ptr<EVP_MD_CTX> ToShared() &&;
+
 private:
     EVP_MD_CTX* ctx_;
 };
@@ -49,6 +55,11 @@ constexpr size_t GetDigestLength(DigestSize digest_size) {
     return (bits + CHAR_BIT - 1) / CHAR_BIT;
 }
 
+std::shared_ptr<EVP_PKEY_CTX> MakeEvpPkeyCtx(EVP_PKEY* pkey);
+
+/// Copies an initialized key context, returns nullptr on failure
+std::unique_ptr<EVP_PKEY_CTX, decltype(&EVP_PKEY_CTX_free)> DupEvpPkeyCtx(EVP_PKEY_CTX& prototype);
+
 decltype(&crypto::hash::HmacSha256) GetHmacFuncByEnum(DigestSize bits);
 const EVP_MD* GetShaMdByEnum(DigestSize bits);
 
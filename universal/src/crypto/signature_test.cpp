@@ -13,6 +13,9 @@
 #include <userver/fs/blocking/write.hpp>
 
 #include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -397,4 +400,23 @@ TEST(Crypto, SignaturePs512) {
     );
 }
 
+TEST(Crypto, SignatureConcurrentUse) {
+    // signers and verifiers share the prepared key contexts between threads
+    const crypto::SignerEs256 signer{ecdsa256v1_priv_key};
+    const crypto::VerifierEs256 verifier{ecdsa256v1_pub_key};
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&signer, &verifier, i] {
+            for (int j = 0; j < 100; ++j) {
+                const auto message = std::to_string(i * 1000 + j);
+                const auto sig = signer.Sign({message});
+                EXPECT_NO_THROW(verifier.Verify({message}, sig));
+                EXPECT_THROW(verifier.Verify({"not ", message}, sig), crypto::VerificationError);
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+}
+
 USERVER_NAMESPACE_END
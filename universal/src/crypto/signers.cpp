@@ -163,19 +163,34 @@ DsaSigner<type, bits>::DsaSigner(const std::string& key, const std::string& pass
             throw SignError("Non-RSA key supplied for " + Name() + " signer");
         }
     }
-}
 
-template <DsaType type, DigestSize bits>
-std::string DsaSigner<type, bits>::Sign(std::initializer_list<std::string_view> data) const {
     EvpMdCtx ctx;
     EVP_PKEY_CTX* pkey_ctx = nullptr;  // non-owning
     if (1 != EVP_DigestSignInit(ctx.Get(), &pkey_ctx, GetShaMdByEnum(bits), nullptr, pkey_.GetNative())) {
-        throw SignError(FormatSslError("Failed to sign: EVP_DigestSignInit"));
+        throw SignError(FormatSslError("Failed to init signer: EVP_DigestSignInit"));
     }
-
     if constexpr (type == DsaType::kRsaPss) {
         SetupJwaRsaPssPadding(pkey_ctx, bits);
     }
+    sign_ctx_ = std::move(ctx).ToShared();
+
+    if constexpr (type != DsaType::kRsaPss) {
+        sign_digest_ctx_ = MakeEvpPkeyCtx(pkey_.GetNative());
+        if (!sign_digest_ctx_) {
+            throw SignError(FormatSslError("Failed to init signer: EVP_PKEY_CTX_new"));
+        }
+        if (1 != EVP_PKEY_sign_init(sign_digest_ctx_.get())) {
+            throw SignError(FormatSslError("Failed to init signer: EVP_PKEY_sign_init"));
+        }
+        if (EVP_PKEY_CTX_set_signature_md(sign_digest_ctx_.get(), GetShaMdByEnum(bits)) <= 0) {
+            throw SignError(FormatSslError("Failed to init signer: EVP_PKEY_CTX_set_signature_md"));
+        }
+    }
+}
+
+template <DsaType type, DigestSize bits>
+std::string DsaSigner<type, bits>::Sign(std::initializer_list<std::string_view> data) const {
+    auto ctx = EvpMdCtx::CopyOf(*sign_ctx_);
 
     for (const auto& part : data) {
         if (1 != EVP_DigestSignUpdate(ctx.Get(), part.data(), part.size())) {
@@ -211,17 +226,10 @@ std::string DsaSigner<type, bits>::SignDigest(std::string_view digest) const {
         throw SignError("Invalid digest size for " + Name() + " signer");
     }
 
-    const std::unique_ptr<EVP_PKEY_CTX, decltype(&EVP_PKEY_CTX_free)> pkey_ctx(
-        EVP_PKEY_CTX_new(pkey_.GetNative(), nullptr), EVP_PKEY_CTX_free
-    );
+    UASSERT(sign_digest_ctx_);
+    const auto pkey_ctx = DupEvpPkeyCtx(*sign_digest_ctx_);
     if (!pkey_ctx) {
-        throw SignError(FormatSslError("Failed to sign digest: EVP_PKEY_CTX_new"));
-    }
-    if (1 != EVP_PKEY_sign_init(pkey_ctx.get())) {
-        throw SignError(FormatSslError("Failed to sign digest: EVP_PKEY_sign_init"));
-    }
-    if (EVP_PKEY_CTX_set_signature_md(pkey_ctx.get(), GetShaMdByEnum(bits)) <= 0) {
-        throw SignError(FormatSslError("Failed to sign digest: EVP_PKEY_CTX_set_signature_md"));
+        throw SignError(FormatSslError("Failed to sign digest: EVP_PKEY_CTX_dup"));
     }
 
     size_t siglen = 0;
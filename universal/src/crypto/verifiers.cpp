@@ -162,6 +162,29 @@ DsaVerifier<type, bits>::DsaVerifier(PublicKey pubkey)
             throw VerificationError("Non-RSA key supplied for " + Name() + " verifier");
         }
     }
+
+    EvpMdCtx ctx;
+    EVP_PKEY_CTX* pkey_ctx = nullptr;  // non-owning
+    if (1 != EVP_DigestVerifyInit(ctx.Get(), &pkey_ctx, GetShaMdByEnum(bits), nullptr, pkey_.GetNative())) {
+        throw VerificationError(FormatSslError("Failed to init verifier: EVP_DigestVerifyInit"));
+    }
+    if constexpr (type == DsaType::kRsaPss) {
+        SetupJwaRsaPssPadding(pkey_ctx, bits);
+    }
+    verify_ctx_ = std::move(ctx).ToShared();
+
+    if constexpr (type != DsaType::kRsaPss) {
+        verify_digest_ctx_ = MakeEvpPkeyCtx(pkey_.GetNative());
+        if (!verify_digest_ctx_) {
+            throw VerificationError(FormatSslError("Failed to init verifier: EVP_PKEY_CTX_new"));
+        }
+        if (1 != EVP_PKEY_verify_init(verify_digest_ctx_.get())) {
+            throw VerificationError(FormatSslError("Failed to init verifier: EVP_PKEY_verify_init"));
+        }
+        if (EVP_PKEY_CTX_set_signature_md(verify_digest_ctx_.get(), GetShaMdByEnum(bits)) <= 0) {
+            throw VerificationError(FormatSslError("Failed to init verifier: EVP_PKEY_CTX_set_signature_md"));
+        }
+    }
 }
 
 template <DsaType type, DigestSize bits>
@@ -170,15 +193,7 @@ DsaVerifier<type, bits>::DsaVerifier(std::string_view key) : DsaVerifier{PublicK
 template <DsaType type, DigestSize bits>
 void DsaVerifier<type, bits>::Verify(std::initializer_list<std::string_view> data, std::string_view raw_signature)
     const {
-    EvpMdCtx ctx;
-    EVP_PKEY_CTX* pkey_ctx = nullptr;
-    if (1 != EVP_DigestVerifyInit(ctx.Get(), &pkey_ctx, GetShaMdByEnum(bits), nullptr, pkey_.GetNative())) {
-        throw VerificationError(FormatSslError("Failed to verify: EVP_DigestVerifyInit"));
-    }
-
-    if constexpr (type == DsaType::kRsaPss) {
-        SetupJwaRsaPssPadding(pkey_ctx, bits);
-    }
+    auto ctx = EvpMdCtx::CopyOf(*verify_ctx_);
 
     for (const auto& part : data) {
         if (1 != EVP_DigestVerifyUpdate(ctx.Get(), part.data(), part.size())) {
@@ -212,17 +227,10 @@ void DsaVerifier<type, bits>::VerifyDigest(std::string_view digest, std::string_
         throw VerificationError("Invalid digest size for " + Name() + " verifier");
     }
 
-    std::unique_ptr<EVP_PKEY_CTX, decltype(&EVP_PKEY_CTX_free)> pkey_ctx(
-        EVP_PKEY_CTX_new(pkey_.GetNative(), nullptr), EVP_PKEY_CTX_free
-    );
+    UASSERT(verify_digest_ctx_);
+    const auto pkey_ctx = DupEvpPkeyCtx(*verify_digest_ctx_);
     if (!pkey_ctx) {
-        throw VerificationError(FormatSslError("Failed to verify digest: EVP_PKEY_CTX_new"));
-    }
-    if (1 != EVP_PKEY_verify_init(pkey_ctx.get())) {
-        throw VerificationError(FormatSslError("Failed to verify digest: EVP_PKEY_verify_init"));
-    }
-    if (EVP_PKEY_CTX_set_signature_md(pkey_ctx.get(), GetShaMdByEnum(bits)) <= 0) {
-        throw VerificationError(FormatSslError("Failed to sign digest: EVP_PKEY_CTX_set_signature_md"));
+        throw VerificationError(FormatSslError("Failed to verify digest: EVP_PKEY_CTX_dup"));
     }
 
     int verification_result = -1;
@@ -0,0 +1,38 @@
+#include <userver/decimal64/decimal64.hpp>
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+template <int Prec>
+void DoParse(benchmark::State& state, const std::vector<std::string>& inputs) {
+    std::size_t i = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(decimal64::Decimal<Prec>{inputs[i++ % inputs.size()]});
+    }
+}
+
+}  // namespace
+
+void decimal64_parse_short(benchmark::State& state) { DoParse<4>(state, {"12.34", "-0.5", "100", "99.9999"}); }
+BENCHMARK(decimal64_parse_short);
+
+void decimal64_parse_long(benchmark::State& state) {
+    DoParse<8>(state, {"1234567890.12345678", "-98765432.1", "0.00000001", "55555555555.5"});
+}
+BENCHMARK(decimal64_parse_long);
+
+void decimal64_to_string(benchmark::State& state) {
+    const decimal64::Decimal<8> value{"1234567890.12345678"};
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(decimal64::ToString(value));
+    }
+}
+BENCHMARK(decimal64_to_string);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,79 @@
+#include <formats/json/impl/document_allocator.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+namespace {
+
+enum class BlockOrigin : std::uint64_t {
+    kHeap = 0x68656170,
+    kArena = 0x6172656e,
+};
+
+// Keeps the 8-byte alignment that rapidjson relies on
+constexpr std::size_t kHeaderSize = sizeof(std::uint64_t);
+
+void* ToUser(void* block, BlockOrigin origin) noexcept {
+    if (!block) return nullptr;
+    std::memcpy(block, &origin, kHeaderSize);
+    return static_cast<char*>(block) + kHeaderSize;
+}
+
+void* ToBlock(void* ptr) noexcept { return static_cast<char*>(ptr) - kHeaderSize; }
+
+BlockOrigin GetOrigin(void* ptr) noexcept {
+    BlockOrigin origin{};
+    std::memcpy(&origin, ToBlock(ptr), kHeaderSize);
+    return origin;
+}
+
+}  // namespace
+
+void* DocumentAllocator::Malloc(std::size_t size) {
+    if (size == 0) return nullptr;
+    if (arena_) return ToUser(arena_->Malloc(size + kHeaderSize), BlockOrigin::kArena);
+    return ToUser(std::malloc(size + kHeaderSize), BlockOrigin::kHeap);
+}
+
+void* DocumentAllocator::Realloc(void* original_ptr, std::size_t original_size, std::size_t new_size) {
+    if (!original_ptr) return Malloc(new_size);
+    if (new_size == 0) {
+        Free(original_ptr);
+        return nullptr;
+    }
+
+    const auto origin = GetOrigin(original_ptr);
+    if (origin == BlockOrigin::kHeap && !arena_) {
+        return ToUser(std::realloc(ToBlock(original_ptr), new_size + kHeaderSize), BlockOrigin::kHeap);
+    }
+    if (origin == BlockOrigin::kArena && arena_) {
+        // MemoryPoolAllocator grows the last block in place, and copies blocks
+        // of other arenas
+        return ToUser(
+            arena_->Realloc(ToBlock(original_ptr), original_size + kHeaderSize, new_size + kHeaderSize),
+            BlockOrigin::kArena
+        );
+    }
+
+    void* result = Malloc(new_size);
+    if (!result) return nullptr;
+    std::memcpy(result, original_ptr, std::min(original_size, new_size));
+    Free(original_ptr);
+    return result;
+}
+
+void DocumentAllocator::Free(void* ptr) noexcept {
+    if (!ptr) return;
+    // Arena blocks are released with the arena
+    if (GetOrigin(ptr) == BlockOrigin::kHeap) std::free(ToBlock(ptr));
+}
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+
+#include <rapidjson/allocators.h>
+
+#include <userver/formats/json/impl/types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+/// Memory of a parsed document, released all at once
+using DocumentArena = ::rapidjson::MemoryPoolAllocator<::rapidjson::CrtAllocator>;
+
+/// @brief rapidjson allocator of impl::Value.
+///
+/// By default works as rapidjson::CrtAllocator. When bound to a DocumentArena,
+/// the memory is taken from the arena chunks: parsing a large document does a
+/// few large allocations instead of one per container and long string.
+///
+/// Each block is prefixed with a tag of its origin, so that Free() (which is
+/// static in rapidjson) is a no-op for the arena blocks, and Realloc() of an
+/// arena block by an unbound allocator copies the data to the heap.
+class DocumentAllocator final {
+public:
+    static constexpr bool kNeedFree = true;
+
+    DocumentAllocator() noexcept = default;
+    explicit DocumentAllocator(DocumentArena& arena) noexcept : arena_(&arena) {}
+
+    void* Malloc(std::size_t size);
+    void* Realloc(void* original_ptr, std::size_t original_size, std::size_t new_size);
+    static void Free(void* ptr) noexcept;
+
+    bool operator==(const DocumentAllocator& other) const noexcept { return arena_ == other.arena_; }
+    bool operator!=(const DocumentAllocator& other) const noexcept { return arena_ != other.arena_; }
+
+private:
+    DocumentArena* arena_{nullptr};
+};
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <userver/formats/json/impl/types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+/// Allocator for the documents that are not parsed into an arena
+DocumentAllocator& GetDefaultDocumentAllocator() noexcept;
+
+/// Validates a document built from SAX events (e.g. checks for the duplicate
+/// keys) and takes ownership of it
+VersionedValuePtr EnsureValidDocument(Document&& json);
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 #include <rapidjson/document.h>
 #include <rapidjson/rapidjson.h>
 
+#include <formats/json/impl/document_allocator.hpp>
 #include <userver/formats/json/impl/types.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -3,6 +3,7 @@
 #include <rapidjson/document.h>
 #include <boost/container/small_vector.hpp>
 
+#include <formats/json/impl/document_allocator.hpp>
 #include <userver/formats/json/impl/types.hpp>
 #include <userver/utils/assert.hpp>
 
@@ -0,0 +1,110 @@
+#include <formats/json/impl/string_writer.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+namespace {
+
+constexpr char kHexDigits[] = "0123456789ABCDEF";
+
+// Same as in rapidjson::Writer: the character after the backslash, 'u' for
+// \u00XX, 0 if the character is written as is
+constexpr std::array<char, 256> kEscape = [] {
+    std::array<char, 256> escape{};
+    for (std::size_t c = 0; c < 0x20; ++c) escape[c] = 'u';
+    escape['\b'] = 'b';
+    escape['\t'] = 't';
+    escape['\n'] = 'n';
+    escape['\f'] = 'f';
+    escape['\r'] = 'r';
+    escape['"'] = '"';
+    escape['\\'] = '\\';
+    return escape;
+}();
+
+}  // namespace
+
+const char* FindCharToEscape(const char* first, const char* last) noexcept {
+#ifdef __AVX2__
+    {
+        const __m256i quote = _mm256_set1_epi8('"');
+        const __m256i backslash = _mm256_set1_epi8('\\');
+        const __m256i control_max = _mm256_set1_epi8(0x1F);
+        for (; last - first >= 32; first += 32) {
+            const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            // c < 0x20 <=> max(c, 0x1F) == 0x1F
+            const __m256i control = _mm256_cmpeq_epi8(_mm256_max_epu8(chunk, control_max), control_max);
+            const __m256i to_escape = _mm256_or_si256(
+                _mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote), _mm256_cmpeq_epi8(chunk, backslash)), control
+            );
+            const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(to_escape));
+            if (mask != 0) return first + __builtin_ctz(mask);
+        }
+    }
+#endif
+
+#ifdef __SSE2__
+    {
+        const __m128i quote = _mm_set1_epi8('"');
+        const __m128i backslash = _mm_set1_epi8('\\');
+        const __m128i control_max = _mm_set1_epi8(0x1F);
+        for (; last - first >= 16; first += 16) {
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            const __m128i control = _mm_cmpeq_epi8(_mm_max_epu8(chunk, control_max), control_max);
+            const __m128i to_escape =
+                _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)), control);
+            const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(to_escape));
+            if (mask != 0) return first + __builtin_ctz(mask);
+        }
+    }
+#endif
+
+    for (; first != last; ++first) {
+        if (kEscape[static_cast<unsigned char>(*first)]) return first;
+    }
+    return last;
+}
+
+bool StringWriter::WriteEscapedString(const Ch* str, rapidjson::SizeType length) {
+    auto& os = *os_;
+    rapidjson::PutReserve(os, 2 + length * 6);  // "\uxxxx..."
+    rapidjson::PutUnsafe(os, '"');
+
+    const char* first = str;
+    const char* const last = str + length;
+    while (true) {
+        const char* const special = FindCharToEscape(first, last);
+        const auto run_length = static_cast<std::size_t>(special - first);
+        if (run_length != 0) std::memcpy(os.PushUnsafe(run_length), first, run_length);
+        if (special == last) break;
+
+        const auto c = static_cast<unsigned char>(*special);
+        rapidjson::PutUnsafe(os, '\\');
+        rapidjson::PutUnsafe(os, kEscape[c]);
+        if (kEscape[c] == 'u') {
+            rapidjson::PutUnsafe(os, '0');
+            rapidjson::PutUnsafe(os, '0');
+            rapidjson::PutUnsafe(os, kHexDigits[c >> 4]);
+            rapidjson::PutUnsafe(os, kHexDigits[c & 0xF]);
+        }
+        first = special + 1;
+    }
+
+    rapidjson::PutUnsafe(os, '"');
+    return true;
+}
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
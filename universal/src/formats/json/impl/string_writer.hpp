@@ -0,0 +1,42 @@
+#pragma once
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+/// Returns the first character of [first, last) that has to be escaped in a
+/// JSON string, or `last` if there is none
+const char* FindCharToEscape(const char* first, const char* last) noexcept;
+
+/// @brief rapidjson::Writer into a rapidjson::StringBuffer that escapes
+/// strings with a vectorized scan.
+///
+/// rapidjson escapes strings byte by byte. Here the runs of characters that
+/// need no escaping are found 16/32 bytes at a time and copied in bulk. The
+/// output is the same as of rapidjson::Writer.
+class StringWriter final : public rapidjson::Writer<rapidjson::StringBuffer> {
+public:
+    using Base = rapidjson::Writer<rapidjson::StringBuffer>;
+
+    using Base::Base;
+
+    using Base::Key;
+    using Base::String;
+
+    bool String(const Ch* str, rapidjson::SizeType length, bool /*copy*/ = false) {
+        Prefix(rapidjson::kStringType);
+        return EndValue(WriteEscapedString(str, length));
+    }
+
+    bool Key(const Ch* str, rapidjson::SizeType length, bool copy = false) { return String(str, length, copy); }
+
+private:
+    bool WriteEscapedString(const Ch* str, rapidjson::SizeType length);
+};
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include <formats/json/impl/types_impl.hpp>
 
+#include <new>
+
 #include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -9,12 +11,23 @@ namespace formats::json::impl {
 VersionedValuePtr::Data::Data(Document&& doc) : Data(static_cast<Value&&>(doc)) {
     static_assert(
         // NOLINTNEXTLINE(misc-redundant-expression)
-        std::is_same_v<::rapidjson::CrtAllocator, Value::AllocatorType> &&
-            std::is_same_v<::rapidjson::CrtAllocator, Document::AllocatorType>,
-        "Both Document and Value must use CrtAllocator for the fast move"
+        std::is_same_v<DocumentAllocator, Value::AllocatorType> &&
+            std::is_same_v<DocumentAllocator, Document::AllocatorType>,
+        "Both Document and Value must use DocumentAllocator for the fast move"
     );
 }
 
+VersionedValuePtr::Data::Data(Document&& doc, DocumentArena&& arena)
+    : arena(std::move(arena)), native(static_cast<Value&&>(doc)) {}
+
+VersionedValuePtr::Data::~Data() {
+    if (arena) {
+        // All the nodes live in the arena: instead of a recursive destruction
+        // of the tree, the arena chunks are released at once
+        new (&native) Value{};
+    }
+}
+
 VersionedValuePtr::VersionedValuePtr() noexcept = default;
 
 VersionedValuePtr::VersionedValuePtr(std::shared_ptr<Data>&& data) noexcept : data_(std::move(data)) {}
@@ -25,6 +38,8 @@ VersionedValuePtr::operator bool() const { return !!data_; }
 
 bool VersionedValuePtr::IsUnique() const { return data_.use_count() == 1; }
 
+bool VersionedValuePtr::HasArena() const { return data_ && data_->arena.has_value(); }
+
 const Value* VersionedValuePtr::Get() const { return data_ ? &data_->native : nullptr; }
 
 Value* VersionedValuePtr::Get() { return data_ ? &data_->native : nullptr; }
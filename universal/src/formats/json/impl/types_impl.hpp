@@ -1,9 +1,11 @@
 #pragma once
 
 #include <atomic>
+#include <optional>
 
 #include <rapidjson/document.h>
 
+#include <formats/json/impl/document_allocator.hpp>
 #include <userver/formats/json/impl/types.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -18,7 +20,13 @@ struct VersionedValuePtr::Data {
     // https://github.com/Tencent/rapidjson/issues/387
     explicit Data(Document&&);
 
-    ~Data() = default;
+    // `doc` must have been parsed with a DocumentAllocator bound to `arena`
+    Data(Document&& doc, DocumentArena&& arena);
+
+    ~Data();
+
+    // owns the memory of `native` if set, must outlive it
+    std::optional<DocumentArena> arena;
 
     // native rapidjson value
     Value native;
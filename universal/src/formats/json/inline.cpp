@@ -9,7 +9,7 @@
 #include <userver/formats/common/validations.hpp>
 #include <userver/formats/json/exception.hpp>
 #include <userver/utils/assert.hpp>
-#include <userver/utils/datetime.hpp>
+#include <userver/utils/datetime/rfc3339.hpp>
 
 #include <formats/json/impl/types_impl.hpp>
 
@@ -18,9 +18,7 @@ USERVER_NAMESPACE_BEGIN
 namespace formats::json::impl {
 namespace {
 
-::rapidjson::CrtAllocator g_allocator;
-
-static_assert(std::is_empty_v<::rapidjson::CrtAllocator>, "allocator has no state");
+impl::DocumentAllocator g_allocator;
 
 impl::Value WrapStringView(std::string_view key) {
     // GenericValue ctor has an invalid type for size
@@ -30,7 +28,7 @@ impl::Value WrapStringView(std::string_view key) {
 }
 
 std::string FormatTimePoint(std::chrono::system_clock::time_point value) {
-    return utils::datetime::Timestring(value, "UTC", utils::datetime::kRfc3339Format);
+    return utils::datetime::ToRfc3339StringUtc(value);
 }
 
 }  // namespace
@@ -184,4 +184,25 @@ void json_object_wide_object_operator_equals(benchmark::State& state) {
 }
 BENCHMARK(json_object_wide_object_operator_equals)->DenseRange(4, 16, 4)->Range(32, 8192)->RangeMultiplier(2);
 
+void json_large_document_release(benchmark::State& state) {
+    std::string input = R"({"items": [)";
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        if (i != 0) input += ',';
+        input += R"({"id": 1, "name": "some long enough string", "tags": ["a", "b"], "attrs": {"x": 1.5}})";
+    }
+    input += "]}";
+
+    for ([[maybe_unused]] auto _ : state) {
+        state.PauseTiming();
+        auto json = formats::json::FromString(input);
+        benchmark::DoNotOptimize(json["items"][0]["id"].As<int>());
+        state.ResumeTiming();
+
+        // the document is freed on leaving a handler
+        json = {};
+        benchmark::DoNotOptimize(json);
+    }
+}
+BENCHMARK(json_large_document_release)->RangeMultiplier(8)->Range(8, 32 << 10);
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,448 @@
+#include <userver/formats/json/msgpack.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+
+#include <boost/container/small_vector.hpp>
+#include <fmt/format.h>
+#include <rapidjson/document.h>
+
+#include <formats/json/impl/document_value.hpp>
+#include <formats/json/impl/json_tree.hpp>
+#include <formats/json/impl/types_impl.hpp>
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/serialize.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+namespace {
+
+// https://github.com/msgpack/msgpack/blob/master/spec.md#formats
+namespace format {
+
+constexpr std::uint8_t kPositiveFixintMax = 0x7f;
+constexpr std::uint8_t kFixmap = 0x80;
+constexpr std::uint8_t kFixarray = 0x90;
+constexpr std::uint8_t kFixstr = 0xa0;
+constexpr std::uint8_t kNil = 0xc0;
+constexpr std::uint8_t kFalse = 0xc2;
+constexpr std::uint8_t kTrue = 0xc3;
+constexpr std::uint8_t kBin8 = 0xc4;
+constexpr std::uint8_t kBin16 = 0xc5;
+constexpr std::uint8_t kBin32 = 0xc6;
+constexpr std::uint8_t kFloat32 = 0xca;
+constexpr std::uint8_t kFloat64 = 0xcb;
+constexpr std::uint8_t kUint8 = 0xcc;
+constexpr std::uint8_t kUint16 = 0xcd;
+constexpr std::uint8_t kUint32 = 0xce;
+constexpr std::uint8_t kUint64 = 0xcf;
+constexpr std::uint8_t kInt8 = 0xd0;
+constexpr std::uint8_t kInt16 = 0xd1;
+constexpr std::uint8_t kInt32 = 0xd2;
+constexpr std::uint8_t kInt64 = 0xd3;
+constexpr std::uint8_t kStr8 = 0xd9;
+constexpr std::uint8_t kStr16 = 0xda;
+constexpr std::uint8_t kStr32 = 0xdb;
+constexpr std::uint8_t kArray16 = 0xdc;
+constexpr std::uint8_t kArray32 = 0xdd;
+constexpr std::uint8_t kMap16 = 0xde;
+constexpr std::uint8_t kMap32 = 0xdf;
+constexpr std::uint8_t kNegativeFixintMin = 0xe0;
+
+}  // namespace format
+
+// --------------------------- serialization ---------------------------------
+
+class Encoder final {
+public:
+    explicit Encoder(std::string& out) : out_(out) {}
+
+    void WriteValue(const impl::Value& value) {
+        switch (value.GetType()) {
+            case rapidjson::kNullType:
+                Put(format::kNil);
+                break;
+            case rapidjson::kFalseType:
+                Put(format::kFalse);
+                break;
+            case rapidjson::kTrueType:
+                Put(format::kTrue);
+                break;
+            case rapidjson::kStringType:
+                WriteString({value.GetString(), value.GetStringLength()});
+                break;
+            case rapidjson::kNumberType:
+                if (value.IsUint64()) {
+                    WriteUint(value.GetUint64());
+                } else if (value.IsInt64()) {
+                    WriteNegativeInt(value.GetInt64());
+                } else {
+                    WriteDouble(value.GetDouble());
+                }
+                break;
+            case rapidjson::kObjectType:
+                WriteContainerHeader(value.MemberCount(), format::kFixmap, format::kMap16, format::kMap32);
+                break;
+            case rapidjson::kArrayType:
+                WriteContainerHeader(value.Size(), format::kFixarray, format::kArray16, format::kArray32);
+                break;
+        }
+    }
+
+    void WriteString(std::string_view value) {
+        const auto size = value.size();
+        if (size < 32) {
+            Put(static_cast<std::uint8_t>(format::kFixstr | size));
+        } else if (size <= UINT8_MAX) {
+            Put(format::kStr8);
+            Put(static_cast<std::uint8_t>(size));
+        } else if (size <= UINT16_MAX) {
+            Put(format::kStr16);
+            PutBigEndian(static_cast<std::uint16_t>(size));
+        } else {
+            Put(format::kStr32);
+            PutBigEndian(static_cast<std::uint32_t>(size));
+        }
+        out_.append(value);
+    }
+
+private:
+    void WriteUint(std::uint64_t value) {
+        if (value <= format::kPositiveFixintMax) {
+            Put(static_cast<std::uint8_t>(value));
+        } else if (value <= UINT8_MAX) {
+            Put(format::kUint8);
+            Put(static_cast<std::uint8_t>(value));
+        } else if (value <= UINT16_MAX) {
+            Put(format::kUint16);
+            PutBigEndian(static_cast<std::uint16_t>(value));
+        } else if (value <= UINT32_MAX) {
+            Put(format::kUint32);
+            PutBigEndian(static_cast<std::uint32_t>(value));
+        } else {
+            Put(format::kUint64);
+            PutBigEndian(value);
+        }
+    }
+
+    void WriteNegativeInt(std::int64_t value) {
+        if (value >= -32) {
+            Put(static_cast<std::uint8_t>(value));
+        } else if (value >= INT8_MIN) {
+            Put(format::kInt8);
+            Put(static_cast<std::uint8_t>(value));
+        } else if (value >= INT16_MIN) {
+            Put(format::kInt16);
+            PutBigEndian(static_cast<std::uint16_t>(value));
+        } else if (value >= INT32_MIN) {
+            Put(format::kInt32);
+            PutBigEndian(static_cast<std::uint32_t>(value));
+        } else {
+            Put(format::kInt64);
+            PutBigEndian(static_cast<std::uint64_t>(value));
+        }
+    }
+
+    void WriteDouble(double value) {
+        std::uint64_t bits{};
+        std::memcpy(&bits, &value, sizeof(bits));
+        Put(format::kFloat64);
+        PutBigEndian(bits);
+    }
+
+    void WriteContainerHeader(std::size_t size, std::uint8_t fix, std::uint8_t marker16, std::uint8_t marker32) {
+        if (size < 16) {
+            Put(static_cast<std::uint8_t>(fix | size));
+        } else if (size <= UINT16_MAX) {
+            Put(marker16);
+            PutBigEndian(static_cast<std::uint16_t>(size));
+        } else {
+            Put(marker32);
+            PutBigEndian(static_cast<std::uint32_t>(size));
+        }
+    }
+
+    void Put(std::uint8_t byte) { out_.push_back(static_cast<char>(byte)); }
+
+    template <typename T>
+    void PutBigEndian(T value) {
+        char bytes[sizeof(T)];
+        for (std::size_t i = 0; i < sizeof(T); ++i) {
+            bytes[sizeof(T) - 1 - i] = static_cast<char>(value & 0xff);
+            value >>= 8;
+        }
+        out_.append(bytes, sizeof(T));
+    }
+
+    std::string& out_;
+};
+
+struct EncoderFrame {
+    const impl::Value* container;
+    rapidjson::SizeType index;
+};
+
+// ----------------------------- parsing -------------------------------------
+
+[[noreturn]] void ThrowParseError(std::size_t offset, std::string_view message) {
+    throw ParseException(fmt::format("MessagePack parse error at offset {}: {}", offset, message));
+}
+
+struct DecoderFrame {
+    bool is_map;
+    std::uint32_t size;
+    std::uint32_t read;
+};
+
+// Generator for rapidjson::GenericDocument::Populate that sends the SAX events
+// of a MessagePack document
+class Decoder final {
+public:
+    explicit Decoder(std::string_view doc) : doc_(doc) {}
+
+    bool operator()(impl::Document& handler) {
+        boost::container::small_vector<DecoderFrame, impl::kInitialStackDepth> stack;
+
+        do {
+            // A container that has no more elements is ended
+            while (!stack.empty() && stack.back().read == stack.back().size) {
+                const auto frame = stack.back();
+                stack.pop_back();
+                if (frame.is_map) {
+                    handler.EndObject(frame.size);
+                } else {
+                    handler.EndArray(frame.size);
+                }
+            }
+            if (stack.empty() && pos_ != 0) break;
+
+            if (!stack.empty()) {
+                auto& frame = stack.back();
+                if (frame.is_map) ReadKey(handler);
+                ++frame.read;
+            }
+
+            const auto container = ReadValue(handler);
+            if (container) {
+                if (stack.size() >= kDepthParseLimit) {
+                    ThrowParseError(pos_, fmt::format("exceeded maximum allowed depth of {}", kDepthParseLimit));
+                }
+                stack.push_back(*container);
+            }
+        } while (!stack.empty());
+
+        if (pos_ != doc_.size()) ThrowParseError(pos_, "extra data after the document");
+        return true;
+    }
+
+private:
+    std::optional<DecoderFrame> ReadValue(impl::Document& handler) {
+        const auto offset = pos_;
+        const auto marker = ReadByte();
+
+        if (marker <= format::kPositiveFixintMax) {
+            handler.Uint64(marker);
+        } else if (marker >= format::kNegativeFixintMin) {
+            handler.Int64(static_cast<std::int8_t>(marker));
+        } else if ((marker & 0xf0) == format::kFixmap) {
+            return StartContainer(handler, true, marker & 0x0f);
+        } else if ((marker & 0xf0) == format::kFixarray) {
+            return StartContainer(handler, false, marker & 0x0f);
+        } else if ((marker & 0xe0) == format::kFixstr) {
+            ReadString(handler, marker & 0x1f);
+        } else {
+            switch (marker) {
+                case format::kNil:
+                    handler.Null();
+                    break;
+                case format::kFalse:
+                    handler.Bool(false);
+                    break;
+                case format::kTrue:
+                    handler.Bool(true);
+                    break;
+                case format::kBin8:
+                case format::kStr8:
+                    ReadString(handler, ReadBigEndian<std::uint8_t>());
+                    break;
+                case format::kBin16:
+                case format::kStr16:
+                    ReadString(handler, ReadBigEndian<std::uint16_t>());
+                    break;
+                case format::kBin32:
+                case format::kStr32:
+                    ReadString(handler, ReadBigEndian<std::uint32_t>());
+                    break;
+                case format::kFloat32: {
+                    const auto bits = ReadBigEndian<std::uint32_t>();
+                    float value{};
+                    std::memcpy(&value, &bits, sizeof(value));
+                    WriteDouble(handler, value, offset);
+                    break;
+                }
+                case format::kFloat64: {
+                    const auto bits = ReadBigEndian<std::uint64_t>();
+                    double value{};
+                    std::memcpy(&value, &bits, sizeof(value));
+                    WriteDouble(handler, value, offset);
+                    break;
+                }
+                case format::kUint8:
+                    handler.Uint64(ReadBigEndian<std::uint8_t>());
+                    break;
+                case format::kUint16:
+                    handler.Uint64(ReadBigEndian<std::uint16_t>());
+                    break;
+                case format::kUint32:
+                    handler.Uint64(ReadBigEndian<std::uint32_t>());
+                    break;
+                case format::kUint64:
+                    handler.Uint64(ReadBigEndian<std::uint64_t>());
+                    break;
+                case format::kInt8:
+                    handler.Int64(static_cast<std::int8_t>(ReadBigEndian<std::uint8_t>()));
+                    break;
+                case format::kInt16:
+                    handler.Int64(static_cast<std::int16_t>(ReadBigEndian<std::uint16_t>()));
+                    break;
+                case format::kInt32:
+                    handler.Int64(static_cast<std::int32_t>(ReadBigEndian<std::uint32_t>()));
+                    break;
+                case format::kInt64:
+                    handler.Int64(static_cast<std::int64_t>(ReadBigEndian<std::uint64_t>()));
+                    break;
+                case format::kArray16:
+                    return StartContainer(handler, false, ReadBigEndian<std::uint16_t>());
+                case format::kArray32:
+                    return StartContainer(handler, false, ReadBigEndian<std::uint32_t>());
+                case format::kMap16:
+                    return StartContainer(handler, true, ReadBigEndian<std::uint16_t>());
+                case format::kMap32:
+                    return StartContainer(handler, true, ReadBigEndian<std::uint32_t>());
+                default:
+                    ThrowParseError(offset, fmt::format("unsupported type 0x{:02x}", marker));
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    void ReadKey(impl::Document& handler) {
+        const auto offset = pos_;
+        const auto marker = ReadByte();
+
+        std::uint32_t size = 0;
+        if ((marker & 0xe0) == format::kFixstr) {
+            size = marker & 0x1f;
+        } else if (marker == format::kStr8 || marker == format::kBin8) {
+            size = ReadBigEndian<std::uint8_t>();
+        } else if (marker == format::kStr16 || marker == format::kBin16) {
+            size = ReadBigEndian<std::uint16_t>();
+        } else if (marker == format::kStr32 || marker == format::kBin32) {
+            size = ReadBigEndian<std::uint32_t>();
+        } else {
+            ThrowParseError(offset, "map keys must be strings");
+        }
+
+        const auto key = ReadBytes(size);
+        handler.Key(key.data(), static_cast<rapidjson::SizeType>(key.size()), true);
+    }
+
+    static DecoderFrame StartContainer(impl::Document& handler, bool is_map, std::uint32_t size) {
+        if (is_map) {
+            handler.StartObject();
+        } else {
+            handler.StartArray();
+        }
+        return {is_map, size, 0};
+    }
+
+    void ReadString(impl::Document& handler, std::uint32_t size) {
+        const auto value = ReadBytes(size);
+        handler.String(value.data(), static_cast<rapidjson::SizeType>(value.size()), true);
+    }
+
+    static void WriteDouble(impl::Document& handler, double value, std::size_t offset) {
+        if (!std::isfinite(value)) ThrowParseError(offset, "NaN and infinity are not supported");
+        handler.Double(value);
+    }
+
+    std::uint8_t ReadByte() { return static_cast<std::uint8_t>(ReadBytes(1)[0]); }
+
+    template <typename T>
+    T ReadBigEndian() {
+        const auto bytes = ReadBytes(sizeof(T));
+        T value = 0;
+        for (const char byte : bytes) {
+            value = static_cast<T>(value << 8) | static_cast<std::uint8_t>(byte);
+        }
+        return value;
+    }
+
+    std::string_view ReadBytes(std::size_t count) {
+        if (doc_.size() - pos_ < count) ThrowParseError(pos_, "unexpected end of data");
+        const auto result = doc_.substr(pos_, count);
+        pos_ += count;
+        return result;
+    }
+
+    const std::string_view doc_;
+    std::size_t pos_{0};
+};
+
+}  // namespace
+
+formats::json::Value FromMsgpack(std::string_view doc) {
+    if (doc.empty()) {
+        throw ParseException("MessagePack document is empty");
+    }
+
+    impl::Document json{&impl::GetDefaultDocumentAllocator()};
+    Decoder decoder{doc};
+    json.Populate(decoder);
+    return Value{impl::EnsureValidDocument(std::move(json))};
+}
+
+std::string ToMsgpack(const formats::json::Value& doc) {
+    std::string result;
+    Encoder encoder{result};
+
+    boost::container::small_vector<EncoderFrame, impl::kInitialStackDepth> stack;
+    const auto enter = [&](const impl::Value& value) {
+        encoder.WriteValue(value);
+        if ((value.IsObject() && !value.ObjectEmpty()) || (value.IsArray() && !value.Empty())) {
+            stack.push_back({&value, 0});
+        }
+    };
+
+    enter(doc.GetNative());
+    while (!stack.empty()) {
+        auto& frame = stack.back();
+        const auto& container = *frame.container;
+        if (container.IsObject()) {
+            if (frame.index == container.MemberCount()) {
+                stack.pop_back();
+                continue;
+            }
+            const auto& member = container.MemberBegin()[frame.index++];
+            encoder.WriteString({member.name.GetString(), member.name.GetStringLength()});
+            enter(member.value);
+        } else {
+            if (frame.index == container.Size()) {
+                stack.pop_back();
+                continue;
+            }
+            enter(container[frame.index++]);
+        }
+    }
+
+    return result;
+}
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
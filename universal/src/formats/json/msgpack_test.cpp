@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <limits>
+
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/msgpack.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+using formats::json::FromMsgpack;
+using formats::json::FromString;
+using formats::json::ToMsgpack;
+
+namespace {
+
+formats::json::Value RoundTrip(const formats::json::Value& value) { return FromMsgpack(ToMsgpack(value)); }
+
+}  // namespace
+
+TEST(FormatsJsonMsgpack, Scalars) {
+    EXPECT_EQ(ToMsgpack(FromString("null")), "\xc0");
+    EXPECT_EQ(ToMsgpack(FromString("true")), "\xc3");
+    EXPECT_EQ(ToMsgpack(FromString("false")), "\xc2");
+    EXPECT_EQ(ToMsgpack(FromString("1")), "\x01");
+    EXPECT_EQ(ToMsgpack(FromString("-1")), "\xff");
+    EXPECT_EQ(ToMsgpack(FromString(R"("ab")")), "\xa2" "ab");
+}
+
+TEST(FormatsJsonMsgpack, Spec) {
+    // the example from https://msgpack.org
+    EXPECT_EQ(
+        ToMsgpack(FromString(R"({"compact":true,"schema":0})")),
+        "\x82\xa7" "compact\xc3\xa6" "schema" + std::string(1, '\0')
+    );
+}
+
+TEST(FormatsJsonMsgpack, IntegerBoundaries) {
+    for (const std::int64_t value : std::initializer_list<std::int64_t>{
+             0,
+             127,
+             128,
+             255,
+             256,
+             65535,
+             65536,
+             4294967295LL,
+             4294967296LL,
+             std::numeric_limits<std::int64_t>::max(),
+             -32,
+             -33,
+             -128,
+             -129,
+             -32768,
+             -32769,
+             -2147483648LL,
+             -2147483649LL,
+             std::numeric_limits<std::int64_t>::min(),
+         }) {
+        const auto value_json = formats::json::ValueBuilder{value}.ExtractValue();
+        const auto result = RoundTrip(value_json);
+        EXPECT_EQ(result.As<std::int64_t>(), value);
+        EXPECT_EQ(result, value_json) << value;
+    }
+
+    const auto max = std::numeric_limits<std::uint64_t>::max();
+    EXPECT_EQ(RoundTrip(formats::json::ValueBuilder{max}.ExtractValue()).As<std::uint64_t>(), max);
+}
+
+TEST(FormatsJsonMsgpack, Doubles) {
+    for (const double value : {0.5, -1.25, 1e300, std::numeric_limits<double>::min()}) {
+        EXPECT_EQ(RoundTrip(formats::json::ValueBuilder{value}.ExtractValue()).As<double>(), value);
+    }
+}
+
+TEST(FormatsJsonMsgpack, LongStringsAndContainers) {
+    formats::json::ValueBuilder builder;
+    for (const std::size_t size : {31, 32, 255, 256, 65535, 65536}) {
+        builder["strings"].PushBack(std::string(size, 'x'));
+    }
+    for (int i = 0; i < 70000; ++i) {
+        builder["array"].PushBack(i);
+        if (i < 20) builder["object"]["key" + std::to_string(i)] = i;
+    }
+    const auto value = builder.ExtractValue();
+
+    EXPECT_EQ(RoundTrip(value), value);
+}
+
+TEST(FormatsJsonMsgpack, SameAsJson) {
+    const auto value = FromString(R"({"a": [1, -2, 3.5, "x", null, true, {"b": {}}], "c": [], "": ""})");
+    EXPECT_EQ(RoundTrip(value), value);
+    EXPECT_EQ(formats::json::ToString(RoundTrip(value)), formats::json::ToString(value));
+}
+
+TEST(FormatsJsonMsgpack, BinAsString) {
+    EXPECT_EQ(FromMsgpack(std::string_view{"\xc4\x02" "ab", 4}).As<std::string>(), "ab");
+}
+
+TEST(FormatsJsonMsgpack, Errors) {
+    using formats::json::ParseException;
+
+    EXPECT_THROW(FromMsgpack({}), ParseException);
+    // truncated array
+    EXPECT_THROW(FromMsgpack(std::string_view{"\x92\x01", 2}), ParseException);
+    // truncated string
+    EXPECT_THROW(FromMsgpack(std::string_view{"\xa3" "ab", 3}), ParseException);
+    // non-string key
+    EXPECT_THROW(FromMsgpack(std::string_view{"\x81\x01\x01", 3}), ParseException);
+    // never used marker
+    EXPECT_THROW(FromMsgpack(std::string_view{"\xc1", 1}), ParseException);
+    // ext types
+    EXPECT_THROW(FromMsgpack(std::string_view{"\xd4\x01\x01", 3}), ParseException);
+    // extra data
+    EXPECT_THROW(FromMsgpack(std::string_view{"\x01\x02", 2}), ParseException);
+    // NaN
+    EXPECT_THROW(FromMsgpack(std::string_view{"\xcb\x7f\xf8\0\0\0\0\0\0", 9}), ParseException);
+    // too deep
+    EXPECT_THROW(FromMsgpack(std::string(1000, '\x91') + '\x01'), ParseException);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,534 @@
+#include <userver/formats/json/on_demand.hpp>
+
+#include <cstring>
+#include <limits>
+
+#include <fmt/format.h>
+#include <rapidjson/error/en.h>
+#include <rapidjson/memorystream.h>
+#include <rapidjson/reader.h>
+
+#include <formats/json/impl/exttypes.hpp>
+#include <userver/formats/common/path.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::on_demand {
+
+namespace {
+
+namespace ext = formats::json::impl;
+
+[[noreturn]] void ThrowParseError(std::string_view document, const char* position, std::string_view what) {
+    throw ParseException(fmt::format("JSON parse error at offset {}: {}", position - document.data(), what));
+}
+
+bool IsWhitespace(char c) noexcept { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+
+bool IsNumberChar(char c) noexcept {
+    return (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+}
+
+/// Scans the document text. Values are skipped with memchr over strings and
+/// bracket counting over containers, without decoding anything.
+class Scanner final {
+public:
+    explicit Scanner(std::string_view document) noexcept
+        : begin_(document.data()), end_(document.data() + document.size()) {}
+
+    std::string_view Document() const noexcept { return {begin_, static_cast<std::size_t>(end_ - begin_)}; }
+
+    const char* SkipWhitespace(const char* p) const noexcept {
+        while (p != end_ && IsWhitespace(*p)) ++p;
+        return p;
+    }
+
+    const char* Expect(const char* p, char c, std::string_view what) const {
+        if (p == end_ || *p != c) Fail(p, what);
+        return p + 1;
+    }
+
+    // `p` points to the opening quote, returns the position after the closing one
+    const char* SkipString(const char* p) const {
+        ++p;
+        while (true) {
+            const auto* quote = static_cast<const char*>(std::memchr(p, '"', end_ - p));
+            if (!quote) Fail(end_, "missing a closing quotation mark in string");
+
+            const char* escapes = quote;
+            while (escapes != p && escapes[-1] == '\\') --escapes;
+            if ((quote - escapes) % 2 == 0) return quote + 1;
+            p = quote + 1;
+        }
+    }
+
+    // Returns the position after the value that starts at `p`
+    const char* SkipValue(const char* p) const {
+        if (p == end_) Fail(p, "the document ends unexpectedly");
+        switch (*p) {
+            case '"':
+                return SkipString(p);
+            case '{':
+            case '[':
+                return SkipContainer(p);
+            case 't':
+                return SkipLiteral(p, "true");
+            case 'f':
+                return SkipLiteral(p, "false");
+            case 'n':
+                return SkipLiteral(p, "null");
+            default:
+                if (!IsNumberChar(*p)) Fail(p, "invalid value");
+                while (p != end_ && IsNumberChar(*p)) ++p;
+                return p;
+        }
+    }
+
+    // After a container element: returns the next element or nullptr if the
+    // container ends with `close`
+    const char* NextElement(const char* after_element, char close) const {
+        const char* p = SkipWhitespace(after_element);
+        if (p != end_ && *p == ',') return SkipWhitespace(p + 1);
+        Expect(p, close, "missing a comma or a closing bracket");
+        return nullptr;
+    }
+
+    // `container` points to '{' or '[', returns the first element or nullptr
+    const char* FirstElement(const char* container) const {
+        const char close = (*container == '{') ? '}' : ']';
+        const char* p = SkipWhitespace(container + 1);
+        if (p != end_ && *p == close) return nullptr;
+        return p;
+    }
+
+    // `member` points to the name of an object member, returns its value
+    const char* MemberValue(const char* member) const {
+        Expect(member, '"', "missing a name for object member");
+        const char* p = SkipWhitespace(SkipString(member));
+        p = Expect(p, ':', "missing a colon after a name of object member");
+        return SkipWhitespace(p);
+    }
+
+    [[noreturn]] void Fail(const char* p, std::string_view what) const { ThrowParseError(Document(), p, what); }
+
+private:
+    const char* SkipContainer(const char* p) const {
+        std::size_t depth = 0;
+        for (; p != end_; ++p) {
+            switch (*p) {
+                case '"':
+                    p = SkipString(p) - 1;
+                    break;
+                case '{':
+                case '[':
+                    ++depth;
+                    break;
+                case '}':
+                case ']':
+                    if (--depth == 0) return p + 1;
+                    break;
+                default:
+                    break;
+            }
+        }
+        Fail(end_, "missing a closing bracket");
+    }
+
+    const char* SkipLiteral(const char* p, std::string_view literal) const {
+        if (static_cast<std::size_t>(end_ - p) < literal.size() || std::memcmp(p, literal.data(), literal.size()) != 0) {
+            Fail(p, "invalid value");
+        }
+        return p + literal.size();
+    }
+
+    const char* begin_;
+    const char* end_;
+};
+
+/// Decodes a single scalar token with rapidjson, to get exactly the same
+/// number and string semantics as formats::json::FromString
+class ScalarHandler final : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, ScalarHandler> {
+public:
+    enum class Kind { kNone, kInt64, kUint64, kDouble, kString };
+
+    bool Default() { return false; }
+    bool Int(int i) { return Int64(i); }
+    bool Uint(unsigned u) { return Uint64(u); }
+    bool Int64(std::int64_t i) {
+        kind = Kind::kInt64;
+        int64 = i;
+        return true;
+    }
+    bool Uint64(std::uint64_t u) {
+        kind = Kind::kUint64;
+        uint64 = u;
+        return true;
+    }
+    bool Double(double d) {
+        kind = Kind::kDouble;
+        real = d;
+        return true;
+    }
+    bool String(const char* str, rapidjson::SizeType length, bool /*copy*/) {
+        kind = Kind::kString;
+        string.assign(str, length);
+        return true;
+    }
+
+    Kind kind{Kind::kNone};
+    std::int64_t int64{0};
+    std::uint64_t uint64{0};
+    double real{0};
+    std::string string;
+};
+
+ScalarHandler DecodeScalar(std::string_view document, const char* begin, const char* end) {
+    ScalarHandler handler;
+    rapidjson::MemoryStream stream{begin, static_cast<std::size_t>(end - begin)};
+    rapidjson::Reader reader;
+    const auto result =
+        reader.Parse<rapidjson::kParseFullPrecisionFlag | rapidjson::kParseStopWhenDoneFlag>(stream, handler);
+    if (!result) {
+        ThrowParseError(document, begin + result.Offset(), rapidjson::GetParseError_En(result.Code()));
+    }
+    if (stream.Tell() != static_cast<std::size_t>(end - begin)) {
+        ThrowParseError(document, begin + stream.Tell(), "invalid value");
+    }
+    return handler;
+}
+
+ScalarHandler DecodeScalar(std::string_view document, const char* value) {
+    return DecodeScalar(document, value, Scanner{document}.SkipValue(value));
+}
+
+// `name` points to the opening quote
+bool NameEquals(std::string_view document, const char* name, const char* name_end, std::string_view key) {
+    const char* raw_begin = name + 1;
+    const auto raw_size = static_cast<std::size_t>(name_end - 1 - raw_begin);
+    if (!std::memchr(raw_begin, '\\', raw_size)) {
+        return std::string_view{raw_begin, raw_size} == key;
+    }
+    return DecodeScalar(document, name, name_end).string == key;
+}
+
+const char* FindMember(const Scanner& scanner, const char* object, std::string_view key) {
+    const char* member = scanner.FirstElement(object);
+    while (member) {
+        scanner.Expect(member, '"', "missing a name for object member");
+        const char* name_end = scanner.SkipString(member);
+        const char* value = scanner.MemberValue(member);
+        if (NameEquals(scanner.Document(), member, name_end, key)) return value;
+        member = scanner.NextElement(scanner.SkipValue(value), '}');
+    }
+    return nullptr;
+}
+
+// Descends from the document root towards `target`
+std::string BuildPath(std::string_view document, const char* target) {
+    const Scanner scanner{document};
+    std::string path;
+    const char* p = scanner.SkipWhitespace(document.data());
+    while (p != target) {
+        if (*p != '{' && *p != '[') break;
+        const bool is_object = (*p == '{');
+        const char close = is_object ? '}' : ']';
+        const char* element = scanner.FirstElement(p);
+        std::size_t index = 0;
+        while (element) {
+            const char* value = is_object ? scanner.MemberValue(element) : element;
+            const char* value_end = scanner.SkipValue(value);
+            if (target >= value && target < value_end) {
+                if (is_object) {
+                    common::AppendPath(path, DecodeScalar(document, element).string);
+                } else {
+                    common::AppendPath(path, index);
+                }
+                break;
+            }
+            element = scanner.NextElement(value_end, close);
+            ++index;
+        }
+        if (!element) break;
+        p = is_object ? scanner.MemberValue(element) : element;
+    }
+    return path.empty() ? common::kPathRoot : path;
+}
+
+}  // namespace
+
+Value::Value(std::string_view document, const char* value) noexcept : document_(document), value_(value) {}
+
+Value::Value(std::string_view document, const char* missing_parent, std::string missing_path_suffix) noexcept
+    : document_(document), missing_parent_(missing_parent), missing_path_suffix_(std::move(missing_path_suffix)) {}
+
+Value FromString(std::string_view document) {
+    const Scanner scanner{document};
+    const char* root = scanner.SkipWhitespace(document.data());
+    if (root == document.data() + document.size()) {
+        throw ParseException("JSON document is empty");
+    }
+    return Value{document, root};
+}
+
+Value Value::operator[](std::string_view key) const {
+    if (IsMissing()) {
+        auto suffix = missing_path_suffix_;
+        common::AppendPath(suffix, key);
+        return Value{document_, missing_parent_, std::move(suffix)};
+    }
+
+    std::string suffix;
+    common::AppendPath(suffix, key);
+    if (IsNull()) return Value{document_, value_, std::move(suffix)};
+    if (!IsObject()) throw TypeMismatchException(GetExtendedType(), ext::objectValue, GetPath());
+
+    const char* member = FindMember(Scanner{document_}, value_, key);
+    if (!member) return Value{document_, value_, std::move(suffix)};
+    return Value{document_, member};
+}
+
+Value::const_iterator Value::begin() const {
+    CheckNotMissing();
+    if (IsNull()) return end();
+    if (!IsArray() && !IsObject()) {
+        throw TypeMismatchException(GetExtendedType(), ext::arrayValue, GetPath());
+    }
+    return Iterator{document_, value_, Scanner{document_}.FirstElement(value_), IsObject()};
+}
+
+Value::const_iterator Value::end() const { return Iterator{document_, value_, nullptr, IsObject()}; }
+
+bool Value::IsNull() const noexcept { return value_ && *value_ == 'n'; }
+
+bool Value::IsBool() const noexcept { return value_ && (*value_ == 't' || *value_ == 'f'); }
+
+bool Value::IsInt64() const {
+    if (!value_ || !IsNumberChar(*value_)) return false;
+    const auto number = DecodeScalar(document_, value_);
+    return number.kind == ScalarHandler::Kind::kInt64 ||
+           (number.kind == ScalarHandler::Kind::kUint64 &&
+            number.uint64 <= static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()));
+}
+
+bool Value::IsUInt64() const {
+    if (!value_ || !IsNumberChar(*value_)) return false;
+    const auto number = DecodeScalar(document_, value_);
+    return number.kind == ScalarHandler::Kind::kUint64 ||
+           (number.kind == ScalarHandler::Kind::kInt64 && number.int64 >= 0);
+}
+
+bool Value::IsDouble() const {
+    if (!value_ || !IsNumberChar(*value_)) return false;
+    return DecodeScalar(document_, value_).kind == ScalarHandler::Kind::kDouble;
+}
+
+bool Value::IsString() const noexcept { return value_ && *value_ == '"'; }
+
+bool Value::IsArray() const noexcept { return value_ && *value_ == '['; }
+
+bool Value::IsObject() const noexcept { return value_ && *value_ == '{'; }
+
+bool Value::HasMember(std::string_view key) const { return !(*this)[key].IsMissing(); }
+
+std::string_view Value::GetRawJson() const {
+    CheckNotMissing();
+    const char* value_end = Scanner{document_}.SkipValue(value_);
+    return {value_, static_cast<std::size_t>(value_end - value_)};
+}
+
+formats::json::Value Value::ToDom() const { return formats::json::FromString(GetRawJson()); }
+
+std::string Value::GetPath() const {
+    if (!IsMissing()) return BuildPath(document_, value_);
+
+    auto path = BuildPath(document_, missing_parent_);
+    if (path == common::kPathRoot) return missing_path_suffix_;
+    path += common::kPathSeparator;
+    path += missing_path_suffix_;
+    return path;
+}
+
+void Value::CheckNotMissing() const {
+    if (IsMissing()) {
+        throw MemberMissingException(GetPath());
+    }
+}
+
+void Value::CheckArrayOrNull() const {
+    if (!IsNull() && !IsArray()) {
+        CheckNotMissing();
+        throw TypeMismatchException(GetExtendedType(), ext::arrayValue, GetPath());
+    }
+}
+
+void Value::CheckObjectOrNull() const {
+    if (!IsNull() && !IsObject()) {
+        CheckNotMissing();
+        throw TypeMismatchException(GetExtendedType(), ext::objectValue, GetPath());
+    }
+}
+
+int Value::GetExtendedType() const {
+    UASSERT(value_);
+    switch (*value_) {
+        case 'n':
+            return ext::nullValue;
+        case 't':
+        case 'f':
+            return ext::booleanValue;
+        case '"':
+            return ext::stringValue;
+        case '[':
+            return ext::arrayValue;
+        case '{':
+            return ext::objectValue;
+        default:
+            break;
+    }
+    const auto number = DecodeScalar(document_, value_);
+    switch (number.kind) {
+        case ScalarHandler::Kind::kInt64:
+            return ext::intValue;
+        case ScalarHandler::Kind::kUint64:
+            // same as for the DOM, that prefers signed integers
+            return number.uint64 <= static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max())
+                       ? ext::intValue
+                       : ext::uintValue;
+        case ScalarHandler::Kind::kDouble:
+            return ext::realValue;
+        default:
+            return ext::errorValue;
+    }
+}
+
+Value::Iterator::Iterator(
+    std::string_view document,
+    const char* container,
+    const char* position,
+    bool is_object
+) noexcept
+    : document_(document), container_(container), position_(position), is_object_(is_object) {}
+
+Value Value::Iterator::operator*() const {
+    UASSERT(position_);
+    return Value{document_, is_object_ ? Scanner{document_}.MemberValue(position_) : position_};
+}
+
+Value::Iterator& Value::Iterator::operator++() {
+    UASSERT(position_);
+    const Scanner scanner{document_};
+    const char* value = is_object_ ? scanner.MemberValue(position_) : position_;
+    position_ = scanner.NextElement(scanner.SkipValue(value), is_object_ ? '}' : ']');
+    ++index_;
+    return *this;
+}
+
+Value::Iterator Value::Iterator::operator++(int) {
+    auto copy = *this;
+    ++*this;
+    return copy;
+}
+
+std::string Value::Iterator::GetName() const {
+    UASSERT(position_);
+    if (!is_object_) {
+        throw TypeMismatchException(ext::arrayValue, ext::objectValue, BuildPath(document_, container_));
+    }
+    return DecodeScalar(document_, position_).string;
+}
+
+bool Parse(const Value& value, parse::To<bool>) {
+    value.CheckNotMissing();
+    if (value.IsBool()) return *value.value_ == 't';
+    throw TypeMismatchException(value.GetExtendedType(), ext::booleanValue, value.GetPath());
+}
+
+std::int64_t Parse(const Value& value, parse::To<std::int64_t>) {
+    value.CheckNotMissing();
+    if (IsNumberChar(*value.value_)) {
+        const auto number = DecodeScalar(value.document_, value.value_);
+        switch (number.kind) {
+            case ScalarHandler::Kind::kInt64:
+                return number.int64;
+            case ScalarHandler::Kind::kUint64:
+                if (number.uint64 <= static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max())) {
+                    return static_cast<std::int64_t>(number.uint64);
+                }
+                break;
+            case ScalarHandler::Kind::kDouble:
+                if (number.real >= -9223372036854775808.0 && number.real < 9223372036854775808.0 &&
+                    static_cast<double>(static_cast<std::int64_t>(number.real)) == number.real) {
+                    return static_cast<std::int64_t>(number.real);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    throw TypeMismatchException(value.GetExtendedType(), ext::intValue, value.GetPath());
+}
+
+std::uint64_t Parse(const Value& value, parse::To<std::uint64_t>) {
+    value.CheckNotMissing();
+    if (IsNumberChar(*value.value_)) {
+        const auto number = DecodeScalar(value.document_, value.value_);
+        switch (number.kind) {
+            case ScalarHandler::Kind::kUint64:
+                return number.uint64;
+            case ScalarHandler::Kind::kInt64:
+                if (number.int64 >= 0) return static_cast<std::uint64_t>(number.int64);
+                break;
+            case ScalarHandler::Kind::kDouble:
+                if (number.real >= 0 && number.real < 18446744073709551616.0 &&
+                    static_cast<double>(static_cast<std::uint64_t>(number.real)) == number.real) {
+                    return static_cast<std::uint64_t>(number.real);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    throw TypeMismatchException(value.GetExtendedType(), ext::uintValue, value.GetPath());
+}
+
+double Parse(const Value& value, parse::To<double>) {
+    value.CheckNotMissing();
+    if (IsNumberChar(*value.value_)) {
+        const auto number = DecodeScalar(value.document_, value.value_);
+        switch (number.kind) {
+            case ScalarHandler::Kind::kDouble:
+                return number.real;
+            case ScalarHandler::Kind::kInt64:
+                return static_cast<double>(number.int64);
+            case ScalarHandler::Kind::kUint64:
+                return static_cast<double>(number.uint64);
+            default:
+                break;
+        }
+    }
+    throw TypeMismatchException(value.GetExtendedType(), ext::realValue, value.GetPath());
+}
+
+std::string Parse(const Value& value, parse::To<std::string>) {
+    value.CheckNotMissing();
+    if (!value.IsString()) {
+        throw TypeMismatchException(value.GetExtendedType(), ext::stringValue, value.GetPath());
+    }
+
+    const char* string_end = Scanner{value.document_}.SkipString(value.value_);
+    const char* raw_begin = value.value_ + 1;
+    const auto raw_size = static_cast<std::size_t>(string_end - 1 - raw_begin);
+    if (!std::memchr(raw_begin, '\\', raw_size)) {
+        return std::string{raw_begin, raw_size};
+    }
+    return DecodeScalar(value.document_, value.value_, string_end).string;
+}
+
+formats::json::Value Parse(const Value& value, parse::To<formats::json::Value>) { return value.ToDom(); }
+
+}  // namespace formats::json::on_demand
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,158 @@
+#include <userver/formats/json/on_demand.hpp>
+
+#include <map>
+#include <optional>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+/// [Sample on_demand usage]
+struct Point final {
+    int x{0};
+    int y{0};
+};
+
+// The same templated Parse works for both formats::json::Value and
+// formats::json::on_demand::Value
+template <typename Value>
+Point Parse(const Value& value, formats::parse::To<Point>) {
+    return Point{value["x"].template As<int>(), value["y"].template As<int>(0)};
+}
+
+/// [Sample on_demand usage]
+
+constexpr std::string_view kDoc = R"({
+  "skipped": {"nested": [1, 2, {"a": "}]\"{["}], "str": "\\\"]"},
+  "name": "naAme",
+  "plain": "text",
+  "count": 42,
+  "big": 18446744073709551615,
+  "negative": -7,
+  "real": 1.5,
+  "integral_real": 3.0,
+  "flag": true,
+  "nothing": null,
+  "points": [{"x": 1, "y": 2}, {"x": 3}],
+  "map": {"a": 1, "b": 2},
+  "esc\"aped": 1
+})";
+
+}  // namespace
+
+TEST(FormatsJsonOnDemand, Scalars) {
+    const auto doc = formats::json::on_demand::FromString(kDoc);
+
+    EXPECT_EQ(doc["name"].As<std::string>(), "naAme");
+    EXPECT_EQ(doc["plain"].As<std::string>(), "text");
+    EXPECT_EQ(doc["count"].As<int>(), 42);
+    EXPECT_EQ(doc["big"].As<std::uint64_t>(), 18446744073709551615ULL);
+    EXPECT_EQ(doc["negative"].As<std::int64_t>(), -7);
+    EXPECT_DOUBLE_EQ(doc["real"].As<double>(), 1.5);
+    EXPECT_EQ(doc["integral_real"].As<int>(), 3);
+    EXPECT_DOUBLE_EQ(doc["count"].As<double>(), 42);
+    EXPECT_TRUE(doc["flag"].As<bool>());
+    EXPECT_TRUE(doc["nothing"].IsNull());
+    EXPECT_EQ(doc["esc\"aped"].As<int>(), 1);
+
+    EXPECT_TRUE(doc["count"].IsInt64());
+    EXPECT_TRUE(doc["count"].IsUInt64());
+    EXPECT_FALSE(doc["big"].IsInt64());
+    EXPECT_TRUE(doc["real"].IsDouble());
+    EXPECT_TRUE(doc["skipped"].IsObject());
+    EXPECT_TRUE(doc["points"].IsArray());
+}
+
+TEST(FormatsJsonOnDemand, MissingAndDefaults) {
+    const auto doc = formats::json::on_demand::FromString(kDoc);
+
+    EXPECT_TRUE(doc["unknown"].IsMissing());
+    EXPECT_TRUE(doc["unknown"]["deeper"].IsMissing());
+    EXPECT_TRUE(doc["nothing"]["deeper"].IsMissing());
+    EXPECT_FALSE(doc.HasMember("unknown"));
+    EXPECT_TRUE(doc.HasMember("count"));
+
+    EXPECT_EQ(doc["unknown"].As<int>(5), 5);
+    EXPECT_EQ(doc["nothing"].As<std::string>("default"), "default");
+    EXPECT_EQ(doc["unknown"].As<std::optional<int>>(), std::nullopt);
+    EXPECT_EQ(doc["count"].As<std::optional<int>>(), 42);
+}
+
+TEST(FormatsJsonOnDemand, Containers) {
+    const auto doc = formats::json::on_demand::FromString(kDoc);
+
+    const auto points = doc["points"].As<std::vector<Point>>();
+    ASSERT_EQ(points.size(), 2);
+    EXPECT_EQ(points[0].x, 1);
+    EXPECT_EQ(points[0].y, 2);
+    EXPECT_EQ(points[1].x, 3);
+    EXPECT_EQ(points[1].y, 0);
+
+    const auto map = doc["map"].As<std::map<std::string, int>>();
+    EXPECT_EQ(map, (std::map<std::string, int>{{"a", 1}, {"b", 2}}));
+
+    const auto nested = doc["skipped"]["nested"];
+    std::size_t count = 0;
+    for (auto it = nested.begin(); it != nested.end(); ++it) {
+        EXPECT_EQ(it.GetIndex(), count);
+        ++count;
+    }
+    EXPECT_EQ(count, 3);
+
+    EXPECT_TRUE(formats::json::on_demand::FromString("[]").As<std::vector<int>>().empty());
+    EXPECT_TRUE((formats::json::on_demand::FromString("{}").As<std::map<std::string, int>>().empty()));
+    EXPECT_TRUE(formats::json::on_demand::FromString("null").As<std::vector<int>>().empty());
+}
+
+TEST(FormatsJsonOnDemand, SameAsDom) {
+    const auto doc = formats::json::on_demand::FromString(kDoc);
+    const auto dom = formats::json::FromString(kDoc);
+
+    EXPECT_EQ(doc["skipped"].ToDom(), dom["skipped"]);
+    EXPECT_EQ(doc["skipped"]["str"].As<std::string>(), dom["skipped"]["str"].As<std::string>());
+    EXPECT_EQ(doc.As<formats::json::Value>(), dom);
+    EXPECT_EQ(doc["map"].GetRawJson(), R"({"a": 1, "b": 2})");
+}
+
+TEST(FormatsJsonOnDemand, Errors) {
+    const auto doc = formats::json::on_demand::FromString(kDoc);
+
+    EXPECT_THROW(doc["count"].As<std::string>(), formats::json::TypeMismatchException);
+    EXPECT_THROW(doc["real"].As<int>(), formats::json::TypeMismatchException);
+    EXPECT_THROW(doc["negative"].As<unsigned>(), formats::json::TypeMismatchException);
+    EXPECT_THROW(doc["count"]["x"], formats::json::TypeMismatchException);
+    EXPECT_THROW(doc["unknown"].As<int>(), formats::json::MemberMissingException);
+    EXPECT_THROW(doc["big"].As<int>(), formats::json::TypeMismatchException);
+
+    EXPECT_THROW(formats::json::on_demand::FromString(""), formats::json::ParseException);
+    EXPECT_THROW(formats::json::on_demand::FromString("  "), formats::json::ParseException);
+    EXPECT_THROW(
+        formats::json::on_demand::FromString(R"({"a": [1, 2)")["b"].IsMissing(), formats::json::ParseException
+    );
+    EXPECT_THROW(formats::json::on_demand::FromString(R"({"a": 1.2.3})")["a"].As<int>(), formats::json::ParseException);
+}
+
+TEST(FormatsJsonOnDemand, Path) {
+    const auto doc = formats::json::on_demand::FromString(kDoc);
+
+    EXPECT_EQ(doc.GetPath(), "/");
+    EXPECT_EQ(doc["points"].GetPath(), "points");
+    EXPECT_EQ((*++doc["points"].begin())["x"].GetPath(), "points[1].x");
+    EXPECT_EQ(doc["map"]["c"]["d"].GetPath(), "map.c.d");
+    EXPECT_EQ(doc["unknown"].GetPath(), "unknown");
+
+    try {
+        doc["points"].As<std::vector<std::map<std::string, std::string>>>();
+        FAIL() << "Expected an exception";
+    } catch (const formats::json::TypeMismatchException& e) {
+        EXPECT_EQ(e.GetPath(), "points[0].x");
+    }
+}
+
+USERVER_NAMESPACE_END
@@ -3,6 +3,7 @@
 #include <fmt/format.h>
 
 #include <userver/formats/json/inline.hpp>
+#include <userver/formats/json/on_demand.hpp>
 #include <userver/formats/json/parser/parser.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/value_builder.hpp>
@@ -240,4 +241,83 @@ void JsonParseNumbersSax(benchmark::State& state) {
 }
 BENCHMARK(JsonParseNumbersSax)->RangeMultiplier(2)->Range(1, 16);
 
+namespace {
+
+// A large upstream response of which only a few fields are needed: the
+// `header` is in front, the `summary` is after the bulk of the `items`
+std::string BuildLargeResponse(std::size_t items_count) {
+    std::string result = R"({"header": {"id": "abc", "version": 42}, "items": [)";
+    for (std::size_t i = 0; i < items_count; ++i) {
+        if (i != 0) result += ',';
+        result += fmt::format(
+            R"({{"id": {}, "name": "item name {}", "price": {}.25, "tags": ["one", "two", "three"], )"
+            R"("attributes": {{"color": "red", "weight": 1.5, "available": true}}}})",
+            i,
+            i,
+            i
+        );
+    }
+    result += R"(], "summary": {"total": 12345, "currency": "RUB"}})";
+    return result;
+}
+
+struct ResponseSummary final {
+    std::string id;
+    std::int64_t version{0};
+    std::int64_t total{0};
+    std::string currency;
+};
+
+template <typename Value>
+ResponseSummary Parse(const Value& value, formats::parse::To<ResponseSummary>) {
+    return ResponseSummary{
+        value["header"]["id"].template As<std::string>(),
+        value["header"]["version"].template As<std::int64_t>(),
+        value["summary"]["total"].template As<std::int64_t>(),
+        value["summary"]["currency"].template As<std::string>(),
+    };
+}
+
+}  // namespace
+
+void JsonParseLargeDocumentDom(benchmark::State& state) {
+    const auto input = BuildLargeResponse(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        // parse and release, as a handler does with a request body
+        auto json = formats::json::FromString(input);
+        benchmark::DoNotOptimize(json);
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(JsonParseLargeDocumentDom)->RangeMultiplier(8)->Range(8, 32 << 10);
+
+void JsonParseFewFieldsDom(benchmark::State& state) {
+    const auto input = BuildLargeResponse(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        const auto res = formats::json::FromString(input).As<ResponseSummary>();
+        benchmark::DoNotOptimize(res);
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(JsonParseFewFieldsDom)->RangeMultiplier(8)->Range(8, 32 << 10);
+
+void JsonParseFewFieldsOnDemand(benchmark::State& state) {
+    const auto input = BuildLargeResponse(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        const auto res = formats::json::on_demand::FromString(input).As<ResponseSummary>();
+        benchmark::DoNotOptimize(res);
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(JsonParseFewFieldsOnDemand)->RangeMultiplier(8)->Range(8, 32 << 10);
+
+void JsonParseNumbersOnDemand(benchmark::State& state) {
+    const auto input = BuildArrayOfNumbers(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        const auto res = formats::json::on_demand::FromString(input).As<std::vector<double>>();
+        benchmark::DoNotOptimize(res);
+    }
+}
+BENCHMARK(JsonParseNumbersOnDemand)->RangeMultiplier(2)->Range(1, 16);
+
 USERVER_NAMESPACE_END
@@ -16,7 +16,9 @@
 #include <rapidjson/writer.h>
 
 #include <formats/json/impl/accept.hpp>
+#include <formats/json/impl/document_value.hpp>
 #include <formats/json/impl/json_tree.hpp>
+#include <formats/json/impl/string_writer.hpp>
 #include <formats/json/impl/types_impl.hpp>
 #include <userver/formats/json/exception.hpp>
 #include <userver/formats/json/value.hpp>
@@ -29,7 +31,10 @@ namespace formats::json {
 
 namespace {
 
-::rapidjson::CrtAllocator g_allocator;
+impl::DocumentAllocator g_allocator;
+
+// stateless, used for the arena chunks
+::rapidjson::CrtAllocator g_arena_chunks_allocator;
 
 std::string_view AsStringView(const impl::Value& jval) { return {jval.GetString(), jval.GetStringLength()}; }
 
@@ -89,20 +94,25 @@ void CheckKeyUniqueness(const impl::Value* root) {
     }
 }
 
+// Smaller documents are parsed into the heap: an arena chunk would cost more
+// than the few allocations of their nodes
+constexpr std::size_t kArenaMinDocumentSize = 512;
+constexpr std::size_t kArenaMinChunkSize = 4 * 1024;
+constexpr std::size_t kArenaMaxChunkSize = 4 * 1024 * 1024;
+
 impl::VersionedValuePtr EnsureValid(impl::Document&& json) {
     CheckKeyUniqueness(&json);
 
     return impl::VersionedValuePtr::Create(std::move(json));
 }
 
-}  // namespace
+impl::VersionedValuePtr EnsureValid(impl::Document&& json, impl::DocumentArena&& arena) {
+    CheckKeyUniqueness(&json);
 
-Value FromString(std::string_view doc) {
-    if (doc.empty()) {
-        throw ParseException("JSON document is empty");
-    }
+    return impl::VersionedValuePtr::Create(std::move(json), std::move(arena));
+}
 
-    impl::Document json{&g_allocator};
+void ParseDocument(impl::Document& json, std::string_view doc) {
     rapidjson::ParseResult ok =
         json.Parse<rapidjson::kParseDefaultFlags | rapidjson::kParseIterativeFlag | rapidjson::kParseFullPrecisionFlag>(
             doc.data(), doc.size()
@@ -119,8 +129,37 @@ Value FromString(std::string_view doc) {
             "JSON parse error at line {} column {}: {}", line, column, rapidjson::GetParseError_En(ok.Code())
         ));
     }
+}
 
-    return Value{EnsureValid(std::move(json))};
+}  // namespace
+
+namespace impl {
+
+DocumentAllocator& GetDefaultDocumentAllocator() noexcept { return g_allocator; }
+
+VersionedValuePtr EnsureValidDocument(Document&& json) { return EnsureValid(std::move(json)); }
+
+}  // namespace impl
+
+Value FromString(std::string_view doc) {
+    if (doc.empty()) {
+        throw ParseException("JSON document is empty");
+    }
+
+    if (doc.size() < kArenaMinDocumentSize) {
+        impl::Document json{&g_allocator};
+        ParseDocument(json, doc);
+        return Value{EnsureValid(std::move(json))};
+    }
+
+    // The nodes of a large document are allocated from a few arena chunks
+    // that are released together with the root
+    impl::DocumentArena arena{
+        std::clamp(doc.size(), kArenaMinChunkSize, kArenaMaxChunkSize), &g_arena_chunks_allocator};
+    impl::DocumentAllocator allocator{arena};
+    impl::Document json{&allocator};
+    ParseDocument(json, doc);
+    return Value{EnsureValid(std::move(json), std::move(arena))};
 }
 
 Value FromStream(std::istream& is) {
@@ -152,7 +191,7 @@ void Serialize(const Value& doc, std::ostream& os) {
 
 std::string ToString(const Value& doc) {
     rapidjson::StringBuffer buffer;
-    rapidjson::Writer writer(buffer);
+    impl::StringWriter writer(buffer);
     AcceptNoRecursion(doc.GetNative(), writer);
     return std::string{buffer.GetString(), buffer.GetLength()};
 }
@@ -164,7 +203,7 @@ std::string ToStableString(Value&& doc) {
         Value value = std::move(doc);
 
         rapidjson::StringBuffer buffer;
-        rapidjson::Writer writer(buffer);
+        impl::StringWriter writer(buffer);
         AcceptNoRecursion<ObjectProcessing::kInplaceSorting>(value.GetNative(), writer);
         return std::string{buffer.GetString(), buffer.GetLength()};
     }
@@ -182,7 +221,7 @@ std::string ToPrettyString(const formats::json::Value& doc, PrettyFormat format)
 
 logging::LogHelper& operator<<(logging::LogHelper& lh, const Value& doc) {
     rapidjson::StringBuffer buffer;
-    rapidjson::Writer writer(buffer);
+    impl::StringWriter writer(buffer);
     AcceptNoRecursion(doc.GetNative(), writer);
     return lh << std::string_view{buffer.GetString(), buffer.GetLength()};
 }
@@ -207,7 +246,7 @@ struct StringBuffer::Impl final {
 };
 
 StringBuffer::StringBuffer(const formats::json::Value& value) {
-    rapidjson::Writer writer(pimpl_->buffer);
+    impl::StringWriter writer(pimpl_->buffer);
     AcceptNoRecursion(value.GetNative(), writer);
 }
 
@@ -0,0 +1,35 @@
+#include <userver/formats/json/shared_string_view.hpp>
+
+#include <utility>
+
+#include <formats/json/impl/exttypes.hpp>
+#include <formats/json/impl/types_impl.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/formats/json/value_builder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+SharedStringView::SharedStringView(formats::json::Value value, std::string_view view) noexcept
+    : value_(std::move(value)), view_(view) {}
+
+SharedStringView Parse(const Value& value, parse::To<SharedStringView>) {
+    value.CheckNotMissing();
+    const auto& native = value.GetNative();
+    if (!native.IsString()) {
+        throw TypeMismatchException(value.GetExtendedType(), impl::stringValue, value.GetPath());
+    }
+    return SharedStringView{value, std::string_view{native.GetString(), native.GetStringLength()}};
+}
+
+Value Serialize(const SharedStringView& value, serialize::To<Value>) {
+    if (!value.value_.IsString()) return ValueBuilder{std::string_view{}}.ExtractValue();
+    return value.value_;
+}
+
+void WriteToStream(const SharedStringView& value, StringBuilder& sw) { sw.WriteString(value.GetView()); }
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/shared_string_view.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/formats/json/value_builder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+using formats::json::SharedStringView;
+
+TEST(FormatsJsonSharedStringView, Basic) {
+    /// [Sample SharedStringView usage]
+    SharedStringView payload;
+    {
+        const auto json = formats::json::FromString(R"({"payload": "some big text", "other": 1})");
+        payload = json["payload"].As<SharedStringView>();
+        EXPECT_EQ(payload.data(), json["payload"].As<SharedStringView>().data());
+    }
+    // the document is still alive
+    EXPECT_EQ(payload, "some big text");
+    /// [Sample SharedStringView usage]
+}
+
+TEST(FormatsJsonSharedStringView, Default) {
+    const SharedStringView view;
+    EXPECT_TRUE(view.empty());
+    EXPECT_EQ(formats::json::ValueBuilder{view}.ExtractValue().As<std::string>(), "");
+}
+
+TEST(FormatsJsonSharedStringView, TypeMismatch) {
+    const auto json = formats::json::FromString(R"({"a": 1})");
+    EXPECT_THROW(json["a"].As<SharedStringView>(), formats::json::TypeMismatchException);
+    EXPECT_THROW(json["b"].As<SharedStringView>(), formats::json::MemberMissingException);
+}
+
+TEST(FormatsJsonSharedStringView, SurvivesModification) {
+    auto json = formats::json::FromString(R"({"a": "text"})");
+    const auto view = json["a"].As<SharedStringView>();
+    const auto* data = view.data();
+
+    formats::json::ValueBuilder builder{std::move(json)};
+    builder["a"] = "other text";
+    json = builder.ExtractValue();
+
+    EXPECT_EQ(view, "text");
+    EXPECT_EQ(view.data(), data);
+    EXPECT_EQ(json["a"].As<std::string>(), "other text");
+}
+
+TEST(FormatsJsonSharedStringView, Serialize) {
+    const auto json = formats::json::FromString(R"({"a": "x\"y"})");
+    const auto view = json["a"].As<SharedStringView>();
+
+    formats::json::StringBuilder sw;
+    WriteToStream(view, sw);
+    EXPECT_EQ(sw.GetString(), R"("x\"y")");
+
+    formats::json::ValueBuilder builder;
+    builder["b"] = view;
+    EXPECT_EQ(builder.ExtractValue()["b"], json["a"]);
+}
+
+USERVER_NAMESPACE_END
@@ -8,10 +8,11 @@
 #include <rapidjson/writer.h>
 
 #include <formats/json/impl/accept.hpp>
+#include <formats/json/impl/string_writer.hpp>
 #include <userver/formats/common/validations.hpp>
 #include <userver/formats/json/impl/types.hpp>
 #include <userver/formats/json/value.hpp>
-#include <userver/utils/datetime.hpp>
+#include <userver/utils/datetime/rfc3339.hpp>
 #include <userver/utils/fast_pimpl.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -20,7 +21,7 @@ namespace formats::json {
 
 struct StringBuilder::Impl {
     rapidjson::StringBuffer buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> writer{buffer};
+    impl::StringWriter writer{buffer};
 
     Impl() = default;
 };
@@ -36,6 +37,12 @@ std::string_view StringBuilder::GetStringView() const {
 
 std::string StringBuilder::GetString() const { return std::string{GetStringView()}; }
 
+std::string StringBuilder::ExtractBufferedString() {
+    auto result = GetString();
+    impl_->buffer.Clear();
+    return result;
+}
+
 void StringBuilder::WriteNull() { impl_->writer.Null(); }
 
 void StringBuilder::WriteString(std::string_view value) { impl_->writer.String(value.data(), value.size()); }
@@ -84,7 +91,7 @@ void WriteToStream(const formats::json::Value& value, StringBuilder& sw) { sw.Wr
 void WriteToStream(const std::string& value, StringBuilder& sw) { WriteToStream(std::string_view{value}, sw); }
 
 void WriteToStream(std::chrono::system_clock::time_point tp, StringBuilder& sw) {
-    WriteToStream(utils::datetime::Timestring(tp, "UTC", utils::datetime::kRfc3339Format), sw);
+    WriteToStream(utils::datetime::ToRfc3339StringUtc(tp), sw);
 }
 
 StringBuilder::ObjectGuard::ObjectGuard(StringBuilder& sw) : sw_(sw) { sw_.impl_->writer.StartObject(); }
@@ -1,5 +1,7 @@
 #include <benchmark/benchmark.h>
 
+#include <string>
+
 #include <userver/formats/json/string_builder.hpp>
 #include <userver/formats/json/value_builder.hpp>
 
@@ -74,4 +76,40 @@ void JsonStringBuilder(benchmark::State& state) {
 }
 BENCHMARK(JsonStringBuilder)->RangeMultiplier(4)->Range(1, 1024);
 
+std::string MakeLongString(std::size_t size, std::size_t escape_every) {
+    std::string result(size, 'a');
+    for (std::size_t i = escape_every; i < size; i += escape_every) result[i] = '"';
+    return result;
+}
+
+void JsonSerializeLongStrings(benchmark::State& state) {
+    const auto str = MakeLongString(state.range(0), state.range(1));
+    ValueBuilder builder{formats::common::Type::kArray};
+    for (int i = 0; i < 16; ++i) builder.PushBack(str);
+    const auto json = builder.ExtractValue();
+
+    for ([[maybe_unused]] auto _ : state) {
+        auto res = ToString(json);
+        benchmark::DoNotOptimize(res);
+    }
+    state.SetBytesProcessed(state.iterations() * 16 * str.size());
+}
+BENCHMARK(JsonSerializeLongStrings)->ArgsProduct({{16, 256, 4096}, {8, 64, 1 << 20}});
+
+void JsonStringBuilderLongStrings(benchmark::State& state) {
+    const auto str = MakeLongString(state.range(0), state.range(1));
+
+    for ([[maybe_unused]] auto _ : state) {
+        StringBuilder sw;
+        {
+            StringBuilder::ArrayGuard guard(sw);
+            for (int i = 0; i < 16; ++i) sw.WriteString(str);
+        }
+        auto res = sw.GetString();
+        benchmark::DoNotOptimize(res);
+    }
+    state.SetBytesProcessed(state.iterations() * 16 * str.size());
+}
+BENCHMARK(JsonStringBuilderLongStrings)->ArgsProduct({{16, 256, 4096}, {8, 64, 1 << 20}});
+
 USERVER_NAMESPACE_END
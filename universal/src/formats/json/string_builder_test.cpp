@@ -187,6 +187,54 @@ TEST(JsonStringBuilder, String) {
     EXPECT_EQ(sw.GetString(), "\"some string\"");
 }
 
+TEST(JsonStringBuilder, StringEscaping) {
+    StringBuilder sw;
+    WriteToStream(std::string_view{"a\"b\\c\nd\x01\x1f/\x7f"}, sw);
+    EXPECT_EQ(sw.GetString(), R"("a\"b\\c\nd\u0001\u001F/)" "\x7f\"");
+}
+
+TEST(JsonStringBuilder, LongStringEscaping) {
+    // special characters at every offset within the 16/32 byte scan blocks
+    for (std::size_t size = 0; size < 100; ++size) {
+        for (std::size_t pos = 0; pos < size; ++pos) {
+            std::string str(size, 'x');
+            str[pos] = "\"\\\n\x01"[pos % 4];
+
+            StringBuilder sw;
+            {
+                StringBuilder::ObjectGuard guard{sw};
+                sw.Key(str);
+                WriteToStream(str, sw);
+            }
+            const auto value = FromString(sw.GetString());
+            ASSERT_TRUE(value.HasMember(str)) << sw.GetString();
+            ASSERT_EQ(value[str].As<std::string>(), str) << sw.GetString();
+        }
+    }
+}
+
+TEST(JsonStringBuilder, ExtractBufferedString) {
+    StringBuilder sw;
+    std::string result;
+    {
+        StringBuilder::ArrayGuard guard(sw);
+        WriteToStream(1, sw);
+        result += sw.ExtractBufferedString();
+        EXPECT_TRUE(sw.GetStringView().empty());
+
+        WriteToStream("two", sw);
+        {
+            StringBuilder::ObjectGuard object_guard(sw);
+            sw.Key("three");
+            result += sw.ExtractBufferedString();
+            WriteToStream(3, sw);
+        }
+    }
+    result += sw.ExtractBufferedString();
+
+    EXPECT_EQ(result, R"([1,"two",{"three":3}])");
+}
+
 TEST(JsonStringBuilder, VectorBool) {
     std::vector<bool> v = {true, false};
     StringBuilder sw;
@@ -40,7 +40,7 @@ static_assert(
     "userver support chat"
 );
 
-::rapidjson::CrtAllocator g_allocator;
+impl::DocumentAllocator g_allocator;
 
 template <typename T>
 auto CheckedNotTooNegative(T x, const Value& value) {
@@ -9,7 +9,7 @@
 #include <userver/formats/json/exception.hpp>
 #include <userver/formats/json/value.hpp>
 #include <userver/utils/assert.hpp>
-#include <userver/utils/datetime.hpp>
+#include <userver/utils/datetime/rfc3339.hpp>
 
 #include <formats/json/impl/types_impl.hpp>
 
@@ -32,7 +32,7 @@ rapidjson::Type ToNativeType(Type type) {
     }
 }
 
-::rapidjson::CrtAllocator g_allocator;
+impl::DocumentAllocator g_allocator;
 
 }  // namespace
 
@@ -99,7 +99,8 @@ ValueBuilder::ValueBuilder(const formats::json::Value& other) {
 ValueBuilder::ValueBuilder(formats::json::Value&& other) {
     // As we have new native object created,
     // we fill it with the other's native object.
-    if (other.IsUniqueReference())
+    // The nodes of an arena-backed document die with its holder
+    if (other.IsUniqueReference() && !other.holder_.HasArena())
         value_->GetNative() = std::move(other.GetNative());
     else
         // rapidjson uses move semantics in assignment
@@ -260,7 +261,7 @@ impl::Value& ValueBuilder::AddMember(std::string_view key, CheckMemberExists che
 }
 
 Value Serialize(std::chrono::system_clock::time_point tp, formats::serialize::To<Value>) {
-    json::ValueBuilder builder = utils::datetime::Timestring(tp, "UTC", utils::datetime::kRfc3339Format);
+    json::ValueBuilder builder = utils::datetime::ToRfc3339StringUtc(tp);
     return builder.ExtractValue();
 }
 
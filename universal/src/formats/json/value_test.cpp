@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/inline.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/serialize_container.hpp>
 #include <userver/formats/json/value.hpp>
@@ -236,4 +237,45 @@ TEST(FormatsJson, ExceptionMessages) {
     }
 }
 
+namespace {
+
+// Large enough to be parsed into an arena
+std::string MakeLargeDocument() {
+    std::string result = R"({"items": [)";
+    for (int i = 0; i < 100; ++i) {
+        if (i != 0) result += ',';
+        result += R"({"id": )" + std::to_string(i) + R"(, "name": "a string that does not fit inline"})";
+    }
+    result += "]}";
+    return result;
+}
+
+}  // namespace
+
+TEST(FormatsJson, LargeDocumentOutlivesRoot) {
+    auto json = formats::json::FromString(MakeLargeDocument());
+    const auto item = json["items"][42];
+    const auto clone = json["items"].Clone();
+    json = formats::json::Value{};
+
+    EXPECT_EQ(item["id"].As<int>(), 42);
+    EXPECT_EQ(clone[99]["name"].As<std::string>(), "a string that does not fit inline");
+}
+
+TEST(FormatsJson, LargeDocumentToBuilder) {
+    auto json = formats::json::FromString(MakeLargeDocument());
+    const auto expected_size = json["items"].GetSize();
+
+    formats::json::ValueBuilder builder{std::move(json)};
+    builder["items"][0]["name"] = "changed";
+    builder["items"].PushBack(formats::json::MakeObject("id", 100));
+    builder["extra"] = std::string(100, 'x');
+    const auto result = builder.ExtractValue();
+
+    EXPECT_EQ(result["items"][0]["name"].As<std::string>(), "changed");
+    EXPECT_EQ(result["items"].GetSize(), expected_size + 1);
+    EXPECT_EQ(result["items"][1]["id"].As<int>(), 1);
+    EXPECT_EQ(result["extra"].As<std::string>(), std::string(100, 'x'));
+}
+
 USERVER_NAMESPACE_END
@@ -328,19 +328,7 @@ Traits::HashValue Map::HashKey(const PredefinedHeader& header) const noexcept {
     return MaskHash(danger_.HashKey(header));
 }
 
-Traits::HeaderIndex Map::InsertEntry(std::string&& key, std::string&& value) {
-    // we could potentially restructure the code a bit, so instead of hashing
-    // and then at some point looking for index here,
-    // we look for index first, and if it's found - that means we already know the
-    // hash (the header name is known upfront, thus the hash is known as well).
-    // Clobbers interface/implementation a bit, and
-    // we're not sure if its worth it, since default hash is decently fast anyway.
-    const auto header_index = impl::GetHeaderIndexForInsertion(key);
-
-    entries_.emplace_back(std::move(key), std::move(value));
-
-    return header_index;
-}
+void Map::InsertEntry(std::string&& key, std::string&& value) { entries_.emplace_back(std::move(key), std::move(value)); }
 
 Map::ConstIterator Map::Find(std::string_view key) const noexcept {
     const auto pos = DoFind(key, HashKey(key), 0);
@@ -405,17 +393,26 @@ inline Map::FindResult Map::DoFind(std::string_view key, Traits::HashValue hash,
 
 Map::Iterator
 Map::InsertOrModify(MaybeOwnedKey key, std::string&& value, InsertOrModifyOccupiedAction occupied_action) {
-    return DoInsertOrModify(key, HashKey(key.GetValue()), std::move(value), occupied_action);
+    // Most of the incoming headers are the known ones: a single
+    // case-insensitive match finds both the header index and its hash
+    const auto header_index = impl::GetHeaderIndexForInsertion(key.GetValue());
+    const auto hash = header_index != impl::kNoHeaderIndexInsertion && !danger_.IsRed()
+                          ? MaskHash(impl::kKnownHeadersHashes[header_index])
+                          : HashKey(key.GetValue());
+    return DoInsertOrModify(key, hash, header_index, std::move(value), occupied_action);
 }
 
 Map::Iterator
 Map::InsertOrModify(const PredefinedHeader& header, std::string&& value, InsertOrModifyOccupiedAction occupied_action) {
-    return DoInsertOrModify(MaybeOwnedKey{header}, HashKey(header), std::move(value), occupied_action);
+    const auto header_index =
+        header.header_index == impl::kNoHeaderIndexLookup ? impl::kNoHeaderIndexInsertion : header.header_index;
+    return DoInsertOrModify(MaybeOwnedKey{header}, HashKey(header), header_index, std::move(value), occupied_action);
 }
 
 Map::Iterator Map::DoInsertOrModify(
     MaybeOwnedKey key,
     Traits::HashValue hash,
+    Traits::HeaderIndex header_index,
     std::string&& value,
     InsertOrModifyOccupiedAction occupied_action
 ) {
@@ -452,9 +449,9 @@ Map::Iterator Map::DoInsertOrModify(
     };
 
     const auto perform_robinhood =
-        [this, hash](std::size_t dist, std::size_t positions_idx, std::string&& key, std::string&& value) {
+        [this, hash, header_index](std::size_t dist, std::size_t positions_idx, std::string&& key, std::string&& value) {
             const auto entries_index = entries_.size();
-            const auto header_index = InsertEntry(std::move(key), std::move(value));
+            InsertEntry(std::move(key), std::move(value));
 
             const auto num_displaced = DoRobinhoodAtPosition(positions_idx, Pos{entries_index, hash, header_index});
 
@@ -464,9 +461,9 @@ Map::Iterator Map::DoInsertOrModify(
         };
 
     const auto perform_vacant =
-        [this, hash](std::size_t dist, std::size_t positions_idx, std::string&& key, std::string&& value) {
+        [this, hash, header_index](std::size_t dist, std::size_t positions_idx, std::string&& key, std::string&& value) {
             const auto index = entries_.size();
-            const auto header_index = InsertEntry(std::move(key), std::move(value));
+            InsertEntry(std::move(key), std::move(value));
             positions_[positions_idx] = Pos{index, hash, header_index};
 
             if (dist >= kForwardShiftThreshold) {
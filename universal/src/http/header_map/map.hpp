@@ -113,7 +113,7 @@ private:
     Traits::HashValue HashKey(std::string_view key) const noexcept;
     Traits::HashValue HashKey(const PredefinedHeader& header) const noexcept;
 
-    Traits::HeaderIndex InsertEntry(std::string&& key, std::string&& value);
+    void InsertEntry(std::string&& key, std::string&& value);
     std::size_t DoRobinhoodAtPosition(std::size_t idx, Pos old_pos);
 
     struct FindResult final {
@@ -128,6 +128,7 @@ private:
     Iterator DoInsertOrModify(
         MaybeOwnedKey key,
         Traits::HashValue hash,
+        Traits::HeaderIndex header_index,
         std::string&& value,
         InsertOrModifyOccupiedAction occupied_action
     );
@@ -29,6 +29,15 @@ TEST(HeaderMapHasher, SameAtCompileTimeAndRuntime) {
     EXPECT_EQ(compile_time_hash, runtime_hash);
 }
 
+TEST(HeaderMapHasher, KnownHeadersHashes) {
+    const header_map::Danger danger{};
+
+    EXPECT_EQ(impl::kKnownHeadersHashes[impl::GetHeaderIndexForInsertion("Content-Type")], danger.HashKey(kContentType));
+    EXPECT_EQ(impl::kKnownHeadersHashes[impl::GetHeaderIndexForInsertion("Accept-Encoding")], danger.HashKey(kAcceptEncoding));
+    EXPECT_EQ(impl::kKnownHeadersHashes[impl::GetHeaderIndexForInsertion("X-YaTraceId")], danger.HashKey(kXYaTraceId));
+    EXPECT_EQ(impl::kKnownHeadersHashes[impl::GetHeaderIndexForInsertion("HOST")], danger.HashKey("host"));
+}
+
 TEST(PredefinedHeader, IsFormattable) {
     constexpr auto header = kXRequestApplication;
 
@@ -1,6 +1,17 @@
 #include <userver/http/url.hpp>
 
 #include <array>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 #include <utils/impl/internal_tag.hpp>
 
@@ -12,33 +23,122 @@ namespace {
 
 const std::string_view kSchemaSeparator = "://";
 
+// Alphanumeric characters and -_.!~*()' are not escaped
+constexpr auto kIsNotEscaped = [] {
+    std::array<bool, 256> table{};
+    for (unsigned char c = '0'; c <= '9'; ++c) table[c] = true;
+    for (unsigned char c = 'A'; c <= 'Z'; ++c) table[c] = true;
+    for (unsigned char c = 'a'; c <= 'z'; ++c) table[c] = true;
+    for (const unsigned char c : std::string_view{"-_.!~*()'"}) table[c] = true;
+    return table;
+}();
+
+#if defined(__SSE2__)
+__m128i InRange(__m128i chars, char first, char last) noexcept {
+    // bytes >= 0x80 are negative and are outside of all the ranges
+    return _mm_and_si128(
+        _mm_cmpgt_epi8(chars, _mm_set1_epi8(static_cast<char>(first - 1))),
+        _mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(last + 1)), chars)
+    );
+}
+
+// Same as kIsNotEscaped for 16 characters, '\'' ( ) * and - . are adjacent
+__m128i IsNotEscaped(__m128i chars) noexcept {
+    const auto alnum =
+        _mm_or_si128(_mm_or_si128(InRange(chars, '0', '9'), InRange(chars, 'A', 'Z')), InRange(chars, 'a', 'z'));
+    const auto punct = _mm_or_si128(InRange(chars, '\'', '*'), InRange(chars, '-', '.'));
+    const auto singles = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('!')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('_'))),
+        _mm_cmpeq_epi8(chars, _mm_set1_epi8('~'))
+    );
+    return _mm_or_si128(alnum, _mm_or_si128(punct, singles));
+}
+#endif
+
+#if defined(__AVX2__)
+__m256i InRange(__m256i chars, char first, char last) noexcept {
+    return _mm256_and_si256(
+        _mm256_cmpgt_epi8(chars, _mm256_set1_epi8(static_cast<char>(first - 1))),
+        _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(last + 1)), chars)
+    );
+}
+
+__m256i IsNotEscaped(__m256i chars) noexcept {
+    const auto alnum = _mm256_or_si256(
+        _mm256_or_si256(InRange(chars, '0', '9'), InRange(chars, 'A', 'Z')), InRange(chars, 'a', 'z')
+    );
+    const auto punct = _mm256_or_si256(InRange(chars, '\'', '*'), InRange(chars, '-', '.'));
+    const auto exclamation = _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('!'));
+    const auto underscore = _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('_'));
+    const auto tilde = _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('~'));
+    const auto singles = _mm256_or_si256(_mm256_or_si256(exclamation, underscore), tilde);
+    return _mm256_or_si256(alnum, _mm256_or_si256(punct, singles));
+}
+#endif
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+uint8x16_t InRange(uint8x16_t chars, char first, char last) noexcept {
+    return vandq_u8(
+        vcgeq_u8(chars, vdupq_n_u8(static_cast<std::uint8_t>(first))),
+        vcleq_u8(chars, vdupq_n_u8(static_cast<std::uint8_t>(last)))
+    );
+}
+
+uint8x16_t IsNotEscaped(uint8x16_t chars) noexcept {
+    const auto alnum = vorrq_u8(vorrq_u8(InRange(chars, '0', '9'), InRange(chars, 'A', 'Z')), InRange(chars, 'a', 'z'));
+    const auto punct = vorrq_u8(InRange(chars, '\'', '*'), InRange(chars, '-', '.'));
+    const auto singles = vorrq_u8(
+        vorrq_u8(vceqq_u8(chars, vdupq_n_u8('!')), vceqq_u8(chars, vdupq_n_u8('_'))), vceqq_u8(chars, vdupq_n_u8('~'))
+    );
+    return vorrq_u8(alnum, vorrq_u8(punct, singles));
+}
+#endif
+
+const char* FindCharToEscape(const char* first, const char* last) noexcept {
+#if defined(__AVX2__)
+    while (last - first >= 32) {
+        const auto chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+        const auto to_escape = ~static_cast<std::uint32_t>(_mm256_movemask_epi8(IsNotEscaped(chars)));
+        if (to_escape != 0) return first + __builtin_ctz(to_escape);
+        first += 32;
+    }
+#endif
+
+#if defined(__SSE2__)
+    while (last - first >= 16) {
+        const auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        const auto to_escape = ~static_cast<std::uint32_t>(_mm_movemask_epi8(IsNotEscaped(chars))) & 0xffff;
+        if (to_escape != 0) return first + __builtin_ctz(to_escape);
+        first += 16;
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    while (last - first >= 16) {
+        const auto chars = vld1q_u8(reinterpret_cast<const std::uint8_t*>(first));
+        // narrows the mask to 4 bits per character
+        const auto not_escaped = vreinterpretq_u16_u8(IsNotEscaped(chars));
+        const auto to_escape = ~vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(not_escaped, 4)), 0);
+        if (to_escape != 0) return first + __builtin_ctzll(to_escape) / 4;
+        first += 16;
+    }
+#endif
+
+    while (first != last && kIsNotEscaped[static_cast<unsigned char>(*first)]) ++first;
+    return first;
+}
+
 void UrlEncodeTo(std::string_view input_string, std::string& result) {
-    for (char symbol : input_string) {
-        if (isalnum(symbol)) {
-            result.append(1, symbol);
-            continue;
-        }
-        switch (symbol) {
-            case '-':
-            case '_':
-            case '.':
-            case '!':
-            case '~':
-            case '*':
-            case '(':
-            case ')':
-            case '\'':
-                result.append(1, symbol);
-                break;
-            default:
-                std::array<char, 3> bytes = {'%', 0, 0};
-                bytes[1] = (symbol & 0xF0) / 16;
-                bytes[1] += (bytes[1] > 9) ? 'A' - 10 : '0';
-                bytes[2] = symbol & 0x0F;
-                bytes[2] += (bytes[2] > 9) ? 'A' - 10 : '0';
-                result.append(bytes.data(), bytes.size());
-                break;
-        }
+    const char* first = input_string.data();
+    const char* const last = first + input_string.size();
+    while (first != last) {
+        // the characters that are not escaped are appended in runs
+        const char* const run_end = FindCharToEscape(first, last);
+        result.append(first, run_end);
+        if (run_end == last) break;
+
+        const auto symbol = static_cast<unsigned char>(*run_end);
+        const std::array<char, 3> bytes = {'%', "0123456789ABCDEF"[symbol >> 4], "0123456789ABCDEF"[symbol & 0xF]};
+        result.append(bytes.data(), bytes.size());
+        first = run_end + 1;
     }
 }
 
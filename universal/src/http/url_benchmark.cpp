@@ -38,4 +38,17 @@ void make_query(benchmark::State& state) {
 }
 BENCHMARK(make_query)->RangeMultiplier(2)->Range(1, 256);
 
+void url_encode(benchmark::State& state) {
+    // a typical query value: mostly alphanumeric with a few escaped characters
+    std::string value;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        value.push_back(i % 23 == 22 ? ' ' : static_cast<char>('a' + i % 26));
+    }
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(http::UrlEncode(value));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(url_encode)->RangeMultiplier(8)->Range(8, 4096);
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,113 @@
+#include <userver/logging/binary_log.hpp>
+
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging {
+
+namespace {
+
+class RecordParser final {
+public:
+    explicit RecordParser(std::string_view data) noexcept : data_(data) {}
+
+    bool IsEmpty() const noexcept { return data_.empty(); }
+
+    template <typename T>
+    T ReadInteger() {
+        static_assert(std::is_unsigned_v<T>);
+        const auto bytes = ReadBytes(sizeof(T));
+        T result = 0;
+        for (std::size_t i = 0; i < sizeof(T); ++i) {
+            result |= static_cast<T>(static_cast<unsigned char>(bytes[i])) << (8 * i);
+        }
+        return result;
+    }
+
+    std::string_view ReadString() { return ReadBytes(ReadInteger<std::uint32_t>()); }
+
+    double ReadDouble() {
+        const auto bits = ReadInteger<std::uint64_t>();
+        double result{};
+        std::memcpy(&result, &bits, sizeof(result));
+        return result;
+    }
+
+private:
+    std::string_view ReadBytes(std::size_t size) {
+        if (data_.size() < size) {
+            throw std::runtime_error("Truncated binary log record");
+        }
+        const auto result = data_.substr(0, size);
+        data_.remove_prefix(size);
+        return result;
+    }
+
+    std::string_view data_;
+};
+
+}  // namespace
+
+BinaryLogReader::BinaryLogReader(std::string_view data) noexcept : data_(data) {}
+
+bool BinaryLogReader::Next(BinaryLogRecord& record) {
+    if (data_.size() - offset_ < sizeof(std::uint32_t)) return false;
+    const auto size = RecordParser{data_.substr(offset_)}.ReadInteger<std::uint32_t>();
+    if (data_.size() - offset_ - sizeof(std::uint32_t) < size) return false;
+
+    RecordParser parser{data_.substr(offset_ + sizeof(std::uint32_t), size)};
+    const auto version = parser.ReadInteger<std::uint8_t>();
+    if (version != kBinaryLogVersion) {
+        throw std::runtime_error(fmt::format("Unsupported binary log version {} at offset {}", version, offset_));
+    }
+
+    const std::chrono::nanoseconds timestamp{parser.ReadInteger<std::uint64_t>()};
+    record.timestamp = std::chrono::system_clock::time_point{
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(timestamp)};
+    const auto level = parser.ReadInteger<std::uint8_t>();
+    if (level > static_cast<std::uint8_t>(Level::kNone)) {
+        throw std::runtime_error(fmt::format("Invalid log level {} at offset {}", level, offset_));
+    }
+    record.level = static_cast<Level>(level);
+    record.function = parser.ReadString();
+    record.file = parser.ReadString();
+    record.line = parser.ReadInteger<std::uint32_t>();
+
+    record.tags.clear();
+    while (!parser.IsEmpty()) {
+        const auto type = static_cast<BinaryLogTagType>(parser.ReadInteger<std::uint8_t>());
+        const auto key = parser.ReadString();
+        switch (type) {
+            case BinaryLogTagType::kString:
+                record.tags.emplace_back(key, parser.ReadString());
+                break;
+            case BinaryLogTagType::kInt:
+                record.tags.emplace_back(key, static_cast<std::int64_t>(parser.ReadInteger<std::uint64_t>()));
+                break;
+            case BinaryLogTagType::kUInt:
+                record.tags.emplace_back(key, parser.ReadInteger<std::uint64_t>());
+                break;
+            case BinaryLogTagType::kDouble:
+                record.tags.emplace_back(key, parser.ReadDouble());
+                break;
+            default:
+                throw std::runtime_error(
+                    fmt::format("Invalid tag type {} at offset {}", static_cast<int>(type), offset_)
+                );
+        }
+    }
+
+    offset_ += sizeof(std::uint32_t) + size;
+    return true;
+}
+
+std::size_t BinaryLogReader::GetOffset() const noexcept { return offset_; }
+
+}  // namespace logging
+
+USERVER_NAMESPACE_END
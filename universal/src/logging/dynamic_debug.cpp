@@ -1,9 +1,14 @@
 #include "dynamic_debug.hpp"
 
+#include <chrono>
+#include <cmath>
 #include <cstring>
+#include <memory>
+#include <utility>
 
 #include <fmt/format.h>
 
+#include <userver/compiler/thread_local.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/impl/static_registration.hpp>
 #include <userver/utils/underlying_value.hpp>
@@ -27,27 +32,8 @@ LogEntryContentSet& GetAllLocations() noexcept {
     throw std::runtime_error(fmt::format("dynamic-debug-log: no logging in '{}'", location));
 }
 
-}  // namespace
-
-Level GetForceDisabledLevelPlusOne(Level level) {
-    if (level == Level::kNone) {
-        return Level::kTrace;
-    }
-    return static_cast<Level>(utils::UnderlyingValue(level) + 1);
-}
-
-bool operator<(const LogEntryContent& x, const LogEntryContent& y) noexcept {
-    const auto cmp = std::strcmp(x.path, y.path);
-    return cmp < 0 || (cmp == 0 && x.line < y.line);
-}
-
-bool operator==(const LogEntryContent& x, const LogEntryContent& y) noexcept {
-    return x.line == y.line && std::strcmp(x.path, y.path) == 0;
-}
-
-void AddDynamicDebugLog(const std::string& location_relative, int line, EntryState state) {
-    utils::impl::AssertStaticRegistrationFinished();
-
+template <typename Func>
+void ForEachMatchingLocation(const std::string& location_relative, int line, Func func) {
     auto& all_locations = GetAllLocations();
 
     auto it_lower = all_locations.lower_bound({location_relative.c_str(), line});
@@ -64,17 +50,45 @@ void AddDynamicDebugLog(const std::string& location_relative, int line, EntrySta
         }
 
         // Full match
-        it_lower->state.store(state);
-        return;
+        func(*it_lower);
     } else {
         // Any line
         for (; it_lower != all_locations.end(); ++it_lower) {
             if (std::strncmp(it_lower->path, location_relative.c_str(), location_relative.size()) != 0) break;
-            it_lower->state.store(state);
+            func(*it_lower);
         }
     }
 }
 
+std::atomic<bool> has_bytes_limits{false};
+
+compiler::ThreadLocal local_pending_sampling = []() -> LogEntrySampling* { return nullptr; };
+
+}  // namespace
+
+Level GetForceDisabledLevelPlusOne(Level level) {
+    if (level == Level::kNone) {
+        return Level::kTrace;
+    }
+    return static_cast<Level>(utils::UnderlyingValue(level) + 1);
+}
+
+bool operator<(const LogEntryContent& x, const LogEntryContent& y) noexcept {
+    const auto cmp = std::strcmp(x.path, y.path);
+    return cmp < 0 || (cmp == 0 && x.line < y.line);
+}
+
+bool operator==(const LogEntryContent& x, const LogEntryContent& y) noexcept {
+    return x.line == y.line && std::strcmp(x.path, y.path) == 0;
+}
+
+void AddDynamicDebugLog(const std::string& location_relative, int line, EntryState state) {
+    utils::impl::AssertStaticRegistrationFinished();
+    ForEachMatchingLocation(location_relative, line, [state](LogEntryContent& location) {
+        location.state.store(state);
+    });
+}
+
 void RemoveDynamicDebugLog(const std::string& location_relative, int line) {
     utils::impl::AssertStaticRegistrationFinished();
     auto& all_locations = GetAllLocations();
@@ -109,6 +123,95 @@ void RegisterLogLocation(LogEntryContent& location) {
     GetAllLocations().insert(location);
 }
 
+bool LogEntrySampling::ShouldSuppress() noexcept {
+    const auto period = sampling_period.load(std::memory_order_relaxed);
+    if (period > 1 && counter.fetch_add(1, std::memory_order_relaxed) % period != 0) {
+        suppressed.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    const auto bytes_limit = bytes_per_second.load(std::memory_order_relaxed);
+    if (bytes_limit != 0) {
+        const std::int64_t now =
+            std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+        auto window = window_second.load(std::memory_order_relaxed);
+        if (window != now && window_second.compare_exchange_strong(window, now)) {
+            // Racy, some bytes of the concurrent messages may be charged to the
+            // previous window. That's fine for a rough per second limit.
+            window_bytes.store(0, std::memory_order_relaxed);
+        }
+        if (window_bytes.load(std::memory_order_relaxed) >= bytes_limit) {
+            suppressed.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void LogEntrySampling::Account(std::size_t bytes) noexcept {
+    window_bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void LogEntrySampling::Set(LogSamplingSettings settings) noexcept {
+    UASSERT(settings.sampling_rate > 0 && settings.sampling_rate <= 1);
+    sampling_period.store(
+        static_cast<std::uint64_t>(std::llround(1.0 / settings.sampling_rate)), std::memory_order_relaxed
+    );
+    bytes_per_second.store(settings.bytes_per_second, std::memory_order_relaxed);
+}
+
+void SetLogSampling(const std::string& location_relative, int line, LogSamplingSettings settings) {
+    utils::impl::AssertStaticRegistrationFinished();
+    if (!(settings.sampling_rate > 0 && settings.sampling_rate <= 1)) {
+        throw std::runtime_error(
+            fmt::format("log-sampling: sampling rate must be in (0, 1], got {}", settings.sampling_rate)
+        );
+    }
+
+    ForEachMatchingLocation(location_relative, line, [settings](LogEntryContent& location) {
+        auto* sampling = location.sampling.load();
+        if (!sampling) {
+            // Never freed, see LogEntrySampling
+            auto new_sampling = std::make_unique<LogEntrySampling>();
+            if (location.sampling.compare_exchange_strong(sampling, new_sampling.get())) {
+                sampling = new_sampling.release();
+            }
+        }
+        sampling->Set(settings);
+    });
+
+    if (settings.bytes_per_second != 0) {
+        has_bytes_limits = true;
+    }
+}
+
+void RemoveAllLogSampling() {
+    utils::impl::AssertStaticRegistrationFinished();
+    for (auto& location : GetAllLocations()) {
+        if (auto* sampling = location.sampling.load()) {
+            sampling->Set(LogSamplingSettings{});
+        }
+    }
+    has_bytes_limits = false;
+}
+
+namespace impl {
+
+void SetPendingLogSampling(LogEntrySampling& sampling) noexcept {
+    auto pending = local_pending_sampling.Use();
+    *pending = &sampling;
+}
+
+LogEntrySampling* TakePendingLogSampling() noexcept {
+    if (!has_bytes_limits.load(std::memory_order_relaxed)) return nullptr;
+    auto pending = local_pending_sampling.Use();
+    return std::exchange(*pending, nullptr);
+}
+
+}  // namespace impl
+
 }  // namespace logging
 
 USERVER_NAMESPACE_END
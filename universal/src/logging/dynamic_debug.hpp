@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <string_view>
 
 #include <boost/intrusive/set.hpp>
@@ -25,6 +26,40 @@ Level GetForceDisabledLevelPlusOne(Level level);
 
 static_assert(std::atomic<EntryState>::is_always_lock_free);
 
+struct LogSamplingSettings final {
+    /// Share of the messages to log, in (0, 1]
+    double sampling_rate{1.0};
+    /// Limit of the message text bytes logged per second, 0 for unlimited
+    std::uint64_t bytes_per_second{0};
+};
+
+/// Sampling state of a log location. Allocated on the first configuration
+/// of the location and never freed, so that log statements could use it
+/// without synchronization.
+struct LogEntrySampling final {
+    /// Returns true if the message should be dropped, counting it as suppressed
+    bool ShouldSuppress() noexcept;
+
+    /// Charges the logged message text size to the bytes budget
+    void Account(std::size_t bytes) noexcept;
+
+    void Set(LogSamplingSettings settings) noexcept;
+
+    bool HasBytesLimit() const noexcept { return bytes_per_second.load(std::memory_order_relaxed) != 0; }
+
+    std::uint64_t GetSuppressedCount() const noexcept { return suppressed.load(std::memory_order_relaxed); }
+
+private:
+    // log 1 of each `sampling_period` messages
+    std::atomic<std::uint64_t> sampling_period{1};
+    std::atomic<std::uint64_t> bytes_per_second{0};
+
+    std::atomic<std::uint64_t> counter{0};
+    std::atomic<std::int64_t> window_second{0};
+    std::atomic<std::uint64_t> window_bytes{0};
+    std::atomic<std::uint64_t> suppressed{0};
+};
+
 using LogEntryContentHook = bi::set_base_hook<bi::optimize_size<true>, bi::link_mode<bi::normal_link>>;
 
 struct LogEntryContent {
@@ -34,6 +69,7 @@ struct LogEntryContent {
     const int line;
     const char* const path;
     LogEntryContentHook hook;
+    std::atomic<LogEntrySampling*> sampling{nullptr};
 };
 
 bool operator<(const LogEntryContent& x, const LogEntryContent& y) noexcept;
@@ -63,6 +99,31 @@ const LogEntryContentSet& GetDynamicDebugLocations();
 
 void RegisterLogLocation(LogEntryContent& location);
 
+void SetLogSampling(const std::string& location_relative, int line, LogSamplingSettings settings);
+
+void RemoveAllLogSampling();
+
+/// Calls `func(const LogEntryContent&, const LogEntrySampling&)` for the
+/// locations that were ever configured for sampling
+template <typename Func>
+void ForEachLogSampling(Func&& func) {
+    for (const auto& location : GetDynamicDebugLocations()) {
+        if (const auto* sampling = location.sampling.load()) {
+            func(location, *sampling);
+        }
+    }
+}
+
+namespace impl {
+
+/// Remembers the bytes budget of the location that allowed logging, the
+/// LogHelper that is constructed right after that takes it.
+void SetPendingLogSampling(LogEntrySampling& sampling) noexcept;
+
+LogEntrySampling* TakePendingLogSampling() noexcept;
+
+}  // namespace impl
+
 }  // namespace logging
 
 USERVER_NAMESPACE_END
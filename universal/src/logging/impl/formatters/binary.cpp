@@ -0,0 +1,110 @@
+#include <logging/impl/formatters/binary.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include <userver/logging/binary_log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/overloaded.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl::formatters {
+
+namespace {
+
+constexpr std::size_t kSizeBytes = sizeof(std::uint32_t);
+
+template <typename T>
+void AppendInteger(TextLogItem& item, T value) {
+    static_assert(std::is_unsigned_v<T>);
+    char buffer[sizeof(T)];
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        buffer[i] = static_cast<char>(value >> (8 * i));
+    }
+    item.log_line.append(std::string_view{buffer, sizeof(T)});
+}
+
+std::uint64_t ToBits(double value) noexcept {
+    static_assert(sizeof(double) == sizeof(std::uint64_t));
+    std::uint64_t result{};
+    std::memcpy(&result, &value, sizeof(result));
+    return result;
+}
+
+void AppendString(TextLogItem& item, std::string_view value) {
+    UINVARIANT(value.size() <= std::numeric_limits<std::uint32_t>::max(), "Too long log string");
+    AppendInteger(item, static_cast<std::uint32_t>(value.size()));
+    item.log_line.append(value);
+}
+
+void AppendTagHeader(TextLogItem& item, BinaryLogTagType type, std::string_view key) {
+    item.log_line.push_back(static_cast<char>(type));
+    AppendString(item, key);
+}
+
+}  // namespace
+
+Binary::Binary(Level level, const utils::impl::SourceLocation& location, std::chrono::system_clock::time_point now) {
+    // The size is filled in ExtractLoggerItem
+    item_.log_line.resize(kSizeBytes, '\0');
+    item_.log_line.push_back(static_cast<char>(kBinaryLogVersion));
+    AppendInteger(
+        item_,
+        static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count()
+        )
+    );
+    item_.log_line.push_back(static_cast<char>(level));
+    AppendString(item_, location.GetFunctionName());
+    AppendString(item_, location.GetFileName());
+    AppendInteger(item_, static_cast<std::uint32_t>(location.GetLine()));
+}
+
+void Binary::AddTag(std::string_view key, const LogExtra::Value& value) {
+    std::visit(
+        utils::Overloaded{
+            [&](const std::string& x) { AddTag(key, std::string_view{x}); },
+            [&](float x) {
+                AppendTagHeader(item_, BinaryLogTagType::kDouble, key);
+                AppendInteger(item_, ToBits(x));
+            },
+            [&](double x) {
+                AppendTagHeader(item_, BinaryLogTagType::kDouble, key);
+                AppendInteger(item_, ToBits(x));
+            },
+            [&](auto x) {
+                if constexpr (std::is_signed_v<decltype(x)>) {
+                    AppendTagHeader(item_, BinaryLogTagType::kInt, key);
+                    AppendInteger(item_, static_cast<std::uint64_t>(static_cast<std::int64_t>(x)));
+                } else {
+                    AppendTagHeader(item_, BinaryLogTagType::kUInt, key);
+                    AppendInteger(item_, static_cast<std::uint64_t>(x));
+                }
+            },
+        },
+        value
+    );
+}
+
+void Binary::AddTag(std::string_view key, std::string_view value) {
+    AppendTagHeader(item_, BinaryLogTagType::kString, key);
+    AppendString(item_, value);
+}
+
+void Binary::SetText(std::string_view text) { AddTag("text", text); }
+
+LoggerItemBase& Binary::ExtractLoggerItem() {
+    const auto size = item_.log_line.size() - kSizeBytes;
+    UINVARIANT(size <= std::numeric_limits<std::uint32_t>::max(), "Too long log record");
+    for (std::size_t i = 0; i < kSizeBytes; ++i) {
+        item_.log_line[i] = static_cast<char>(size >> (8 * i));
+    }
+    return item_;
+}
+
+}  // namespace logging::impl::formatters
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <chrono>
+
+#include <userver/logging/impl/formatters/base.hpp>
+
+#include <userver/logging/impl/logger_base.hpp>
+#include <userver/logging/level.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl::formatters {
+
+/// Writes records of logging::Format::kBinary, see
+/// userver/logging/binary_log.hpp for the layout
+class Binary final : public Base {
+public:
+    Binary(Level level, const utils::impl::SourceLocation& source_location, std::chrono::system_clock::time_point now);
+
+    void AddTag(std::string_view key, const LogExtra::Value& value) override;
+
+    void AddTag(std::string_view key, std::string_view value) override;
+
+    void SetText(std::string_view text) override;
+
+    LoggerItemBase& ExtractLoggerItem() override;
+
+private:
+    TextLogItem item_;
+};
+
+}  // namespace logging::impl::formatters
+
+USERVER_NAMESPACE_END
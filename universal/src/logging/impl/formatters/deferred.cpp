@@ -0,0 +1,254 @@
+#include <logging/impl/formatters/deferred.hpp>
+
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include <fmt/compile.h>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl::formatters {
+
+namespace {
+
+// Upper estimate of the formatted arithmetic value size, used only to limit
+// the message text size
+constexpr std::size_t kMaxFormattedValueSize = 32;
+
+enum class EntryType : char {
+    kText,
+    kStringTag,
+    kValueTag,
+    kSigned,
+    kUnsigned,
+    kFloat,
+    kDouble,
+    kLongDouble,
+    kBool,
+    kHex,
+    kHexShort,
+};
+
+template <typename T>
+void AppendTrivial(std::string& arena, const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    arena.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+void AppendTextValue(std::string& arena, EntryType type, T value) {
+    AppendTrivial(arena, type);
+    AppendTrivial(arena, value);
+}
+
+void AppendString(std::string& arena, std::string_view value) {
+    AppendTrivial(arena, value.size());
+    arena.append(value);
+}
+
+class ArenaReader final {
+public:
+    explicit ArenaReader(std::string_view arena) noexcept : arena_(arena) {}
+
+    bool IsEmpty() const noexcept { return arena_.empty(); }
+
+    template <typename T>
+    T ReadTrivial() noexcept {
+        static_assert(std::is_trivially_copyable_v<T>);
+        UASSERT(arena_.size() >= sizeof(T));
+        T result;
+        std::memcpy(&result, arena_.data(), sizeof(T));
+        arena_.remove_prefix(sizeof(T));
+        return result;
+    }
+
+    std::string_view ReadString() noexcept {
+        const auto size = ReadTrivial<std::size_t>();
+        UASSERT(arena_.size() >= size);
+        const auto result = arena_.substr(0, size);
+        arena_.remove_prefix(size);
+        return result;
+    }
+
+    template <std::size_t... Indices>
+    LogExtra::Value ReadValue(std::size_t index, std::index_sequence<Indices...>) noexcept {
+        LogExtra::Value result;
+        [[maybe_unused]] const bool found = (TryReadValue<Indices>(index, result) || ...);
+        UASSERT(found);
+        return result;
+    }
+
+private:
+    template <std::size_t Index>
+    bool TryReadValue(std::size_t index, LogExtra::Value& result) noexcept {
+        using T = std::variant_alternative_t<Index, LogExtra::Value>;
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (index == Index) {
+                result.emplace<Index>(ReadTrivial<T>());
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::string_view arena_;
+};
+
+}  // namespace
+
+void DeferredLogItem::Replay(Base& formatter) const {
+    fmt::memory_buffer text;
+    ArenaReader reader{arena};
+
+    while (!reader.IsEmpty()) {
+        switch (reader.ReadTrivial<EntryType>()) {
+            case EntryType::kText:
+                text.append(reader.ReadString());
+                break;
+            case EntryType::kStringTag: {
+                const auto key = reader.ReadString();
+                formatter.AddTag(key, reader.ReadString());
+                break;
+            }
+            case EntryType::kValueTag: {
+                const auto key = reader.ReadString();
+                const auto index = reader.ReadTrivial<std::size_t>();
+                formatter.AddTag(
+                    key, reader.ReadValue(index, std::make_index_sequence<std::variant_size_v<LogExtra::Value>>{})
+                );
+                break;
+            }
+            case EntryType::kSigned:
+                FormatTextValue(fmt::appender(text), reader.ReadTrivial<long long>());
+                break;
+            case EntryType::kUnsigned:
+                FormatTextValue(fmt::appender(text), reader.ReadTrivial<unsigned long long>());
+                break;
+            case EntryType::kFloat:
+                FormatTextValue(fmt::appender(text), reader.ReadTrivial<float>());
+                break;
+            case EntryType::kDouble:
+                FormatTextValue(fmt::appender(text), reader.ReadTrivial<double>());
+                break;
+            case EntryType::kLongDouble:
+                FormatTextValue(fmt::appender(text), reader.ReadTrivial<long double>());
+                break;
+            case EntryType::kBool:
+                FormatTextValue(fmt::appender(text), reader.ReadTrivial<bool>());
+                break;
+            case EntryType::kHex:
+                FormatTextValue(fmt::appender(text), Hex{reader.ReadTrivial<std::uint64_t>()});
+                break;
+            case EntryType::kHexShort:
+                FormatTextValue(fmt::appender(text), HexShort{reader.ReadTrivial<std::uint64_t>()});
+                break;
+        }
+    }
+
+    formatter.SetText(std::string_view{text.data(), text.size()});
+}
+
+Deferred::Deferred(Level level, LogClass log_class, const utils::impl::SourceLocation& location) {
+    item_.level = level;
+    item_.log_class = log_class;
+    item_.location = location;
+    item_.timestamp = std::chrono::system_clock::now();
+}
+
+void Deferred::AddTag(std::string_view key, const LogExtra::Value& value) {
+    if (const auto* string = std::get_if<std::string>(&value)) {
+        AddTag(key, std::string_view{*string});
+        return;
+    }
+
+    AppendTrivial(item_.arena, EntryType::kValueTag);
+    AppendString(item_.arena, key);
+    AppendTrivial(item_.arena, value.index());
+    std::visit(
+        [this](const auto& x) {
+            if constexpr (std::is_trivially_copyable_v<std::decay_t<decltype(x)>>) {
+                AppendTrivial(item_.arena, x);
+            }
+        },
+        value
+    );
+}
+
+void Deferred::AddTag(std::string_view key, std::string_view value) {
+    AppendTrivial(item_.arena, EntryType::kStringTag);
+    AppendString(item_.arena, key);
+    AppendString(item_.arena, value);
+}
+
+void Deferred::SetText(std::string_view text) { AddText(text); }
+
+void Deferred::AddText(std::string_view text) {
+    AppendTrivial(item_.arena, EntryType::kText);
+    AppendString(item_.arena, text);
+    text_size_ += text.size();
+}
+
+LoggerItemRef Deferred::ExtractLoggerItem() { return item_; }
+
+void Deferred::AddTextValue(long long value) {
+    AppendTextValue(item_.arena, EntryType::kSigned, value);
+    text_size_ += kMaxFormattedValueSize;
+}
+
+void Deferred::AddTextValue(unsigned long long value) {
+    AppendTextValue(item_.arena, EntryType::kUnsigned, value);
+    text_size_ += kMaxFormattedValueSize;
+}
+
+void Deferred::AddTextValue(float value) {
+    AppendTextValue(item_.arena, EntryType::kFloat, value);
+    text_size_ += kMaxFormattedValueSize;
+}
+
+void Deferred::AddTextValue(double value) {
+    AppendTextValue(item_.arena, EntryType::kDouble, value);
+    text_size_ += kMaxFormattedValueSize;
+}
+
+void Deferred::AddTextValue(long double value) {
+    AppendTextValue(item_.arena, EntryType::kLongDouble, value);
+    text_size_ += kMaxFormattedValueSize;
+}
+
+void Deferred::AddTextValue(bool value) {
+    AppendTextValue(item_.arena, EntryType::kBool, value);
+    text_size_ += kMaxFormattedValueSize;
+}
+
+void Deferred::AddTextValue(Hex value) {
+    AppendTextValue(item_.arena, EntryType::kHex, value.value);
+    text_size_ += kMaxFormattedValueSize;
+}
+
+void Deferred::AddTextValue(HexShort value) {
+    AppendTextValue(item_.arena, EntryType::kHexShort, value.value);
+    text_size_ += kMaxFormattedValueSize;
+}
+
+void FormatTextValue(fmt::appender out, long long value) { fmt::format_to(out, FMT_COMPILE("{}"), value); }
+
+void FormatTextValue(fmt::appender out, unsigned long long value) { fmt::format_to(out, FMT_COMPILE("{}"), value); }
+
+void FormatTextValue(fmt::appender out, float value) { fmt::format_to(out, FMT_COMPILE("{}"), value); }
+
+void FormatTextValue(fmt::appender out, double value) { fmt::format_to(out, FMT_COMPILE("{}"), value); }
+
+void FormatTextValue(fmt::appender out, long double value) { fmt::format_to(out, FMT_COMPILE("{}"), value); }
+
+void FormatTextValue(fmt::appender out, bool value) { fmt::format_to(out, FMT_COMPILE("{}"), value); }
+
+void FormatTextValue(fmt::appender out, Hex value) { fmt::format_to(out, FMT_COMPILE("0x{:016X}"), value.value); }
+
+void FormatTextValue(fmt::appender out, HexShort value) { fmt::format_to(out, FMT_COMPILE("{:X}"), value.value); }
+
+}  // namespace logging::impl::formatters
+
+USERVER_NAMESPACE_END
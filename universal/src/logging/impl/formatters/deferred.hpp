@@ -0,0 +1,86 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+
+#include <fmt/format.h>
+
+#include <userver/logging/impl/formatters/base.hpp>
+#include <userver/logging/impl/logger_base.hpp>
+#include <userver/logging/level.hpp>
+#include <userver/logging/log_helper.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl::formatters {
+
+/// A log record captured by the Deferred formatter. Tags and the message text
+/// arguments are stored as is in a per-record arena.
+struct DeferredLogItem final : LoggerItemBase {
+    Level level{Level::kNone};
+    LogClass log_class{LogClass::kLog};
+    utils::impl::SourceLocation location{utils::impl::SourceLocation::Custom(0, {}, {})};
+    std::chrono::system_clock::time_point timestamp;
+    std::string arena;
+
+    DeferredLogItem() = default;
+    DeferredLogItem(DeferredLogItem&&) = default;
+    DeferredLogItem& operator=(DeferredLogItem&&) = default;
+
+    /// Formats the record with a formatter made for its level, class, location
+    /// and timestamp.
+    void Replay(Base& formatter) const;
+};
+
+/// Captures the record without formatting it, see logging::LoggerConfig
+/// `deferred_formatting`. LogHelper passes the arithmetic text arguments to
+/// AddTextValue instead of formatting them in place.
+class Deferred final : public Base {
+public:
+    Deferred(Level level, LogClass log_class, const utils::impl::SourceLocation& location);
+
+    void AddTag(std::string_view key, const LogExtra::Value& value) override;
+
+    void AddTag(std::string_view key, std::string_view value) override;
+
+    void SetText(std::string_view text) override;
+
+    LoggerItemRef ExtractLoggerItem() override;
+
+    Deferred* AsDeferred() noexcept override { return this; }
+
+    void AddText(std::string_view text);
+
+    void AddTextValue(long long value);
+    void AddTextValue(unsigned long long value);
+    void AddTextValue(float value);
+    void AddTextValue(double value);
+    void AddTextValue(long double value);
+    void AddTextValue(bool value);
+    void AddTextValue(Hex value);
+    void AddTextValue(HexShort value);
+
+    /// Upper estimate of the formatted text size
+    std::size_t GetTextSize() const noexcept { return text_size_; }
+
+private:
+    DeferredLogItem item_;
+    std::size_t text_size_{0};
+};
+
+/// @{
+/// Formats the message text arguments, used both by LogHelper and for
+/// replaying the Deferred records.
+void FormatTextValue(fmt::appender out, long long value);
+void FormatTextValue(fmt::appender out, unsigned long long value);
+void FormatTextValue(fmt::appender out, float value);
+void FormatTextValue(fmt::appender out, double value);
+void FormatTextValue(fmt::appender out, long double value);
+void FormatTextValue(fmt::appender out, bool value);
+void FormatTextValue(fmt::appender out, Hex value);
+void FormatTextValue(fmt::appender out, HexShort value);
+/// @}
+
+}  // namespace logging::impl::formatters
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+
 #include <userver/formats/json/string_builder.hpp>
 #include <userver/logging/format.hpp>
 #include <userver/logging/impl/formatters/base.hpp>
@@ -12,7 +14,12 @@ namespace logging::impl::formatters {
 
 class Json final : public Base {
 public:
-    explicit Json(Level level, Format format, const utils::impl::SourceLocation& source_location) noexcept(false);
+    Json(
+        Level level,
+        Format format,
+        const utils::impl::SourceLocation& source_location,
+        std::chrono::system_clock::time_point now
+    ) noexcept(false);
 
     Json(const Json&) = delete;
 
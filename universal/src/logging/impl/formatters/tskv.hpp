@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+
 #include <userver/logging/impl/formatters/base.hpp>
 
 #include <userver/logging/format.hpp>
@@ -12,7 +14,12 @@ namespace logging::impl::formatters {
 
 class Tskv final : public Base {
 public:
-    Tskv(Level level, Format format, const utils::impl::SourceLocation& source_location);
+    Tskv(
+        Level level,
+        Format format,
+        const utils::impl::SourceLocation& source_location,
+        std::chrono::system_clock::time_point now
+    );
 
     void AddTag(std::string_view key, const LogExtra::Value& value) override;
 
@@ -1,5 +1,6 @@
 #include <userver/logging/impl/logger_base.hpp>
 
+#include <logging/impl/formatters/binary.hpp>
 #include <logging/impl/formatters/json.hpp>
 #include <logging/impl/formatters/tskv.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
@@ -26,17 +27,30 @@ void LoggerBase::ForwardTo(LoggerBase*) {}
 
 bool LoggerBase::DoShouldLog(Level /*level*/) const noexcept { return true; }
 
-formatters::BasePtr TextLogger::MakeFormatter(Level level, LogClass, const utils::impl::SourceLocation& location) {
+formatters::BasePtr
+TextLogger::MakeFormatter(Level level, LogClass log_class, const utils::impl::SourceLocation& location) {
+    return MakeTextFormatter(level, log_class, location, std::chrono::system_clock::now());
+}
+
+formatters::BasePtr TextLogger::MakeTextFormatter(
+    Level level,
+    LogClass,
+    const utils::impl::SourceLocation& location,
+    std::chrono::system_clock::time_point timestamp
+) const {
     auto format = GetFormat();
     switch (format) {
         case Format::kLtsv:
         case Format::kTskv:
         case Format::kRaw:
-            return std::make_unique<formatters::Tskv>(level, format, location);
+            return std::make_unique<formatters::Tskv>(level, format, location, timestamp);
 
         case Format::kJson:
         case Format::kJsonYaDeploy:
-            return std::make_unique<formatters::Json>(level, format, location);
+            return std::make_unique<formatters::Json>(level, format, location, timestamp);
+
+        case Format::kBinary:
+            return std::make_unique<formatters::Binary>(level, location, timestamp);
 
         case Format::kStruct:
             UINVARIANT(false, "Invalid logger type");
@@ -146,7 +146,21 @@ bool StaticLogEntry::ShouldNotLog(logging::LoggerRef logger, logging::Level leve
     const auto state = content.state.load();
     const bool force_disabled = level < state.force_disabled_level_plus_one;
     const bool force_enabled = level >= state.force_enabled_level && level != logging::Level::kNone;
-    return (!LoggerShouldLog(logger, level) || force_disabled) && !force_enabled;
+    if ((!LoggerShouldLog(logger, level) || force_disabled) && !force_enabled) {
+        return true;
+    }
+
+    auto* const sampling = content.sampling.load(std::memory_order_acquire);
+    if (sampling && !force_enabled) {
+        if (sampling->ShouldSuppress()) {
+            return true;
+        }
+        if (sampling->HasBytesLimit()) {
+            // LogHelper is constructed right after, it accounts the message size
+            SetPendingLogSampling(*sampling);
+        }
+    }
+    return false;
 }
 
 bool StaticLogEntry::ShouldNotLog(const logging::LoggerPtr& logger, logging::Level level) const noexcept {
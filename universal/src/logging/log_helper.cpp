@@ -4,14 +4,13 @@
 #include <memory>
 #include <typeinfo>
 
-#include <fmt/compile.h>
 #include <boost/container/small_vector.hpp>
 #include <boost/exception/diagnostic_information.hpp>
 
 #include <logging/log_extra_stacktrace.hpp>
 #include <logging/log_helper_impl.hpp>
+#include <utils/impl/thread_local_mem_pool.hpp>
 #include <userver/compiler/demangle.hpp>
-#include <userver/compiler/thread_local.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/logging/level.hpp>
@@ -27,82 +26,6 @@ namespace logging {
 
 namespace {
 
-// Not boost::static_vector, because it's not constexpr-constructible.
-template <typename T, std::size_t Capacity>
-class StaticVector final {
-public:
-    bool IsFull() const noexcept { return size_ == Capacity; }
-
-    void PushBack(T&& value) noexcept {
-        UASSERT(!IsFull());
-        data_[size_++] = std::move(value);
-    }
-
-    bool IsEmpty() const noexcept { return size_ == 0; }
-
-    T& GetBack() noexcept {
-        UASSERT(!IsEmpty());
-        return data_[size_ - 1];
-    }
-
-    void PopBack() noexcept {
-        UASSERT(!IsEmpty());
-        --size_;
-    }
-
-private:
-    std::size_t size_{0};
-    T data_[Capacity]{};
-};
-
-template <typename T>
-class ThreadLocalMemPool {
-public:
-    template <typename... Args>
-    static std::unique_ptr<T> Pop(Args&&... args) {
-        auto pool = local_storage_pool.Use();
-        if (pool->IsEmpty()) {
-            return std::make_unique<T>(std::forward<Args>(args)...);
-        }
-
-        auto& raw = pool->GetBack();
-        // if ctor throws, memory remains in pool
-        new (raw.get()) T(std::forward<Args>(args)...);
-        // arm dtor, transfer ownership (noexcept)
-        std::unique_ptr<T> obj(reinterpret_cast<T*>(raw.release()));
-        // prune pool
-        pool->PopBack();
-        return obj;
-    }
-
-    // NOTE: Push might be called from a different thread than the one we got
-    // the object from (where the Pop() has been called). Because of this
-    // the object state must be completely torn down.
-    static void Push(std::unique_ptr<T> obj) noexcept {
-        auto pool = local_storage_pool.Use();
-        if (pool->IsFull()) return;
-
-        // disarm dtor, transfer ownership (noexcept)
-        std::unique_ptr<Storage> raw(reinterpret_cast<Storage*>(obj.release()));
-        // call dtor
-        reinterpret_cast<T*>(raw.get())->~T();
-        // store into pool
-        pool->PushBack(std::move(raw));
-    }
-
-private:
-    // If there is no logging and context switches within the lifetime of a
-    // LogHelper (the usual case), then kMaxSize = 1 is enough.
-    // Having more cache entries instead allows to retain performance
-    // in some edge cases.
-    static constexpr std::size_t kMaxSize = 16;
-
-    using Storage = std::aligned_storage_t<sizeof(T), alignof(T)>;
-    using StoragePool = StaticVector<std::unique_ptr<Storage>, kMaxSize>;
-
-    static inline compiler::ThreadLocal local_storage_pool = [] { return StoragePool{}; };
-};
-
 constexpr bool NeedsQuoteEscaping(char c) { return c == '\"' || c == '\\'; }
 
 }  // namespace
@@ -113,7 +36,7 @@ LogHelper::LogHelper(
     LogClass log_class,
     const utils::impl::SourceLocation& location
 ) noexcept
-    : pimpl_(ThreadLocalMemPool<Impl>::Pop(logger, level, log_class, location)) {
+    : pimpl_(utils::impl::ThreadLocalMemPool<Impl>::Pop(logger, level, log_class, location)) {
     try {
         logger.PrependCommonTags(GetTagWriter());
     } catch (...) {
@@ -131,7 +54,7 @@ LogHelper::LogHelper(
 
 LogHelper::~LogHelper() {
     DoLog();
-    ThreadLocalMemPool<Impl>::Push(std::move(pimpl_));
+    utils::impl::ThreadLocalMemPool<Impl>::Push(std::move(pimpl_));
 }
 
 constexpr size_t kSizeLimit = 10000;
@@ -284,28 +207,16 @@ LogHelper& LogHelper::operator<<(const LogExtra::Value& value) noexcept {
     return *this;
 }
 
-void LogHelper::PutFloatingPoint(float value) {
-    fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()), FMT_COMPILE("{}"), value);
-}
-void LogHelper::PutFloatingPoint(double value) {
-    fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()), FMT_COMPILE("{}"), value);
-}
-void LogHelper::PutFloatingPoint(long double value) {
-    fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()), FMT_COMPILE("{}"), value);
-}
-void LogHelper::PutUnsigned(unsigned long long value) {
-    fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()), FMT_COMPILE("{}"), value);
-}
-void LogHelper::PutSigned(long long value) {
-    fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()), FMT_COMPILE("{}"), value);
-}
-void LogHelper::PutBoolean(bool value) {
-    fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()), FMT_COMPILE("{}"), value);
-}
+void LogHelper::PutFloatingPoint(float value) { pimpl_->AddTextValue(value); }
+void LogHelper::PutFloatingPoint(double value) { pimpl_->AddTextValue(value); }
+void LogHelper::PutFloatingPoint(long double value) { pimpl_->AddTextValue(value); }
+void LogHelper::PutUnsigned(unsigned long long value) { pimpl_->AddTextValue(value); }
+void LogHelper::PutSigned(long long value) { pimpl_->AddTextValue(value); }
+void LogHelper::PutBoolean(bool value) { pimpl_->AddTextValue(value); }
 
 LogHelper& LogHelper::operator<<(Hex hex) noexcept {
     try {
-        fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()), FMT_COMPILE("0x{:016X}"), hex.value);
+        pimpl_->AddTextValue(hex);
     } catch (...) {
         InternalLoggingError("Failed to extend log Hex");
     }
@@ -314,7 +225,7 @@ LogHelper& LogHelper::operator<<(Hex hex) noexcept {
 
 LogHelper& LogHelper::operator<<(HexShort hex) noexcept {
     try {
-        fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()), FMT_COMPILE("{:X}"), hex.value);
+        pimpl_->AddTextValue(hex);
     } catch (...) {
         InternalLoggingError("Failed to extend log HexShort");
     }
@@ -334,9 +245,7 @@ void LogHelper::Put(std::string_view value) { pimpl_->AddText(value); }
 
 void LogHelper::Put(char value) { pimpl_->AddText(std::string_view(&value, 1)); }
 
-void LogHelper::PutRaw(std::string_view value_needs_no_escaping) {
-    pimpl_->GetBufferForRawValuePart().append(value_needs_no_escaping);
-}
+void LogHelper::PutRaw(std::string_view value_needs_no_escaping) { pimpl_->AddText(value_needs_no_escaping); }
 
 void LogHelper::PutException(const std::exception& ex) {
     if (!impl::ShouldLogStacktrace()) {
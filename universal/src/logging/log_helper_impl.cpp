@@ -4,6 +4,7 @@
 #include <fmt/compile.h>
 #include <fmt/format.h>
 
+#include <logging/dynamic_debug.hpp>
 #include <userver/compiler/impl/constexpr.hpp>
 #include <userver/compiler/thread_local.hpp>
 #include <userver/logging/impl/logger_base.hpp>
@@ -22,18 +23,32 @@ LogHelper::Impl::Impl(
 ) noexcept
     : level_(std::max(level, logger.GetLevel())),
       logger_(logger),
-      formatter_(logger.MakeFormatter(level, log_class, location)) {}
+      formatter_(logger.MakeFormatter(level, log_class, location)),
+      deferred_(formatter_->AsDeferred()),
+      sampling_(impl::TakePendingLogSampling()) {}
 
-void LogHelper::Impl::AddText(std::string_view text) { msg_.append(text); }
+void LogHelper::Impl::AddText(std::string_view text) {
+    if (deferred_) {
+        deferred_->AddText(text);
+    } else {
+        msg_.append(text);
+    }
+}
 
-size_t LogHelper::Impl::GetTextSize() const { return msg_.size(); }
+size_t LogHelper::Impl::GetTextSize() const { return deferred_ ? deferred_->GetTextSize() : msg_.size(); }
 
 void LogHelper::Impl::AddTag(std::string_view key, const LogExtra::Value& value) { formatter_->AddTag(key, value); }
 
 void LogHelper::Impl::AddTag(std::string_view key, std::string_view value) { formatter_->AddTag(key, value); }
 
 void LogHelper::Impl::Finish() {
-    formatter_->SetText(to_string(msg_));
+    if (!deferred_) {
+        formatter_->SetText(to_string(msg_));
+    }
+
+    if (sampling_) {
+        sampling_->Account(GetTextSize());
+    }
 
     auto& log_item = formatter_->ExtractLoggerItem();
     logger_.Log(level_, log_item);
@@ -41,12 +56,13 @@ void LogHelper::Impl::Finish() {
 
 auto LogHelper::Impl::BufferStd::overflow(int_type c) -> int_type {
     if (c == std::streambuf::traits_type::eof()) return c;
-    impl_.msg_.push_back(c);
+    const char ch = c;
+    impl_.AddText(std::string_view{&ch, 1});
     return c;
 }
 
 std::streamsize LogHelper::Impl::BufferStd::xsputn(const char_type* s, std::streamsize n) {
-    impl_.msg_.append(std::string_view(s, n));
+    impl_.AddText(std::string_view(s, n));
     return n;
 }
 
@@ -6,19 +6,17 @@
 
 #include <fmt/format.h>
 
+#include <logging/impl/formatters/deferred.hpp>
 #include <userver/logging/level.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/logging/log_extra.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
-namespace logging::impl::formatters {
-class Base;
-using BasePtr = std::unique_ptr<Base>;
-}  // namespace logging::impl::formatters
-
 namespace logging {
 
+struct LogEntrySampling;
+
 inline constexpr std::size_t kInitialLogBufferSize = 1500;
 using LogBuffer = fmt::basic_memory_buffer<char, kInitialLogBufferSize>;
 
@@ -35,6 +33,16 @@ public:
 
     void AddText(std::string_view text);
 
+    // Formats the value in place or, for deferred formatters, stores it as is
+    template <typename T>
+    void AddTextValue(T value) {
+        if (deferred_) {
+            deferred_->AddTextValue(value);
+        } else {
+            impl::formatters::FormatTextValue(fmt::appender(msg_), value);
+        }
+    }
+
     size_t GetTextSize() const;
 
     void AddTag(std::string_view key, const LogExtra::Value& value);
@@ -46,8 +54,6 @@ public:
     void MarkAsBroken() {  // TODO
     }
 
-    LogBuffer& GetBufferForRawValuePart() noexcept { return msg_; }
-
     bool IsStreamInitialized() const noexcept { return !!lazy_stream_; }
 
     std::ostream& Stream() { return GetLazyInitedStream().ostr; }
@@ -85,6 +91,8 @@ private:
     std::optional<std::unordered_set<std::string>> debug_tag_keys_;
     LoggerRef logger_;
     impl::formatters::BasePtr formatter_;
+    impl::formatters::Deferred* deferred_;
+    LogEntrySampling* sampling_;
 };
 
 }  // namespace logging
@@ -3,6 +3,7 @@
 #include <cctz/time_zone.h>
 
 #include <userver/utils/datetime.hpp>
+#include <userver/utils/datetime/rfc3339.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -23,6 +24,7 @@ constexpr auto DaysBetweenYears(int64_t from, int64_t to) {
 }  // namespace
 
 std::chrono::system_clock::time_point FromRfc3339StringSaturating(const std::string& timestring) {
+    if (const auto tp = TryParseRfc3339(timestring)) return *tp;
     return FromStringSaturating(timestring, kRfc3339Format);
 }
 
@@ -0,0 +1,200 @@
+#include <userver/utils/datetime/rfc3339.hpp>
+
+#include <array>
+#include <cstdint>
+
+#include <userver/utils/datetime.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::datetime {
+
+namespace {
+
+using SystemClock = std::chrono::system_clock;
+
+constexpr std::int64_t kSecondsPerDay = 24 * 60 * 60;
+
+// "YYYY-MM-DDTHH:MM:SS.nnnnnnnnn+00:00"
+constexpr std::size_t kMaxStringSize = 35;
+
+struct CivilDay final {
+    std::int64_t year;
+    int month;
+    int day;
+};
+
+std::int64_t FloorDiv(std::int64_t value, std::int64_t divisor) noexcept {
+    const auto quotient = value / divisor;
+    return (value % divisor < 0) ? quotient - 1 : quotient;
+}
+
+// http://howardhinnant.github.io/date_algorithms.html#civil_from_days
+CivilDay CivilFromDays(std::int64_t days) noexcept {
+    days += 719468;
+    const auto era = FloorDiv(days, 146097);
+    const auto day_of_era = days - era * 146097;
+    const auto year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+    const auto day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+    const auto shifted_month = (5 * day_of_year + 2) / 153;
+    const auto day = static_cast<int>(day_of_year - (153 * shifted_month + 2) / 5 + 1);
+    const auto month = static_cast<int>(shifted_month < 10 ? shifted_month + 3 : shifted_month - 9);
+    return {year_of_era + era * 400 + (month <= 2), month, day};
+}
+
+// http://howardhinnant.github.io/date_algorithms.html#days_from_civil
+std::int64_t DaysFromCivil(std::int64_t year, int month, int day) noexcept {
+    year -= month <= 2;
+    const auto era = FloorDiv(year, 400);
+    const auto year_of_era = year - era * 400;
+    const auto day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const auto day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    return era * 146097 + day_of_era - 719468;
+}
+
+bool IsLeapYear(std::int64_t year) noexcept { return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0; }
+
+int DaysInMonth(std::int64_t year, int month) noexcept {
+    constexpr std::array<int, 12> kDays{31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    return (month == 2 && IsLeapYear(year)) ? 29 : kDays[month - 1];
+}
+
+char* WriteDigits(char* out, std::int64_t value, int width) noexcept {
+    for (int i = width - 1; i >= 0; --i) {
+        out[i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+    return out + width;
+}
+
+bool IsDigit(char c) noexcept { return c >= '0' && c <= '9'; }
+
+// Reads exactly `width` digits
+bool ReadDigits(std::string_view& input, int width, int& value) noexcept {
+    if (input.size() < static_cast<std::size_t>(width)) return false;
+    value = 0;
+    for (int i = 0; i < width; ++i) {
+        if (!IsDigit(input[i])) return false;
+        value = value * 10 + (input[i] - '0');
+    }
+    input.remove_prefix(width);
+    return true;
+}
+
+bool ReadChar(std::string_view& input, char expected) noexcept {
+    if (input.empty() || input.front() != expected) return false;
+    input.remove_prefix(1);
+    return true;
+}
+
+// Returns the offset in seconds
+std::optional<int> ReadOffset(std::string_view& input) noexcept {
+    if (ReadChar(input, 'Z')) return 0;
+
+    if (input.empty() || (input.front() != '+' && input.front() != '-')) return std::nullopt;
+    const int sign = (input.front() == '-') ? -1 : 1;
+    input.remove_prefix(1);
+
+    int hours = 0;
+    int minutes = 0;
+    if (!ReadDigits(input, 2, hours)) return std::nullopt;
+    ReadChar(input, ':');
+    if (!ReadDigits(input, 2, minutes)) return std::nullopt;
+    if (hours > 23 || minutes > 59) return std::nullopt;
+
+    return sign * (hours * 60 + minutes) * 60;
+}
+
+}  // namespace
+
+std::string ToRfc3339StringUtc(SystemClock::time_point tp) {
+    const auto seconds = std::chrono::floor<std::chrono::seconds>(tp);
+    const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(tp - seconds).count();
+
+    const auto seconds_count = seconds.time_since_epoch().count();
+    const auto days = FloorDiv(seconds_count, kSecondsPerDay);
+    const auto second_of_day = seconds_count - days * kSecondsPerDay;
+    const auto civil = CivilFromDays(days);
+    if (civil.year < 0 || civil.year > 9999) {
+        return Timestring(tp, "UTC", kRfc3339Format);
+    }
+
+    std::array<char, kMaxStringSize> buffer{};
+    char* out = buffer.data();
+    out = WriteDigits(out, civil.year, 4);
+    *out++ = '-';
+    out = WriteDigits(out, civil.month, 2);
+    *out++ = '-';
+    out = WriteDigits(out, civil.day, 2);
+    *out++ = 'T';
+    out = WriteDigits(out, second_of_day / 3600, 2);
+    *out++ = ':';
+    out = WriteDigits(out, second_of_day / 60 % 60, 2);
+    *out++ = ':';
+    out = WriteDigits(out, second_of_day % 60, 2);
+
+    if (nanoseconds != 0) {
+        *out++ = '.';
+        out = WriteDigits(out, nanoseconds, 9);
+        // %E*S drops the trailing zeros
+        while (out[-1] == '0') --out;
+    }
+
+    for (const char c : std::string_view{"+00:00"}) *out++ = c;
+    return std::string(buffer.data(), out);
+}
+
+std::optional<SystemClock::time_point> TryParseRfc3339(std::string_view timestring) noexcept {
+    int year = 0;
+    int month = 0;
+    int day = 0;
+    int hour = 0;
+    int minute = 0;
+    int second = 0;
+    if (!ReadDigits(timestring, 4, year) || !ReadChar(timestring, '-') || !ReadDigits(timestring, 2, month) ||
+        !ReadChar(timestring, '-') || !ReadDigits(timestring, 2, day) || !ReadChar(timestring, 'T') ||
+        !ReadDigits(timestring, 2, hour) || !ReadChar(timestring, ':') || !ReadDigits(timestring, 2, minute) ||
+        !ReadChar(timestring, ':') || !ReadDigits(timestring, 2, second)) {
+        return std::nullopt;
+    }
+    // Leap seconds are left to the generic parser
+    if (month < 1 || month > 12 || day < 1 || day > DaysInMonth(year, month) || hour > 23 || minute > 59 ||
+        second > 59) {
+        return std::nullopt;
+    }
+
+    std::int64_t nanoseconds = 0;
+    if (ReadChar(timestring, '.')) {
+        // The digits beyond nanoseconds are truncated, like cctz does
+        std::size_t digits = 0;
+        for (; digits < timestring.size() && IsDigit(timestring[digits]); ++digits) {
+            if (digits < 9) nanoseconds = nanoseconds * 10 + (timestring[digits] - '0');
+        }
+        if (digits == 0) return std::nullopt;
+        for (auto i = digits; i < 9; ++i) nanoseconds *= 10;
+        timestring.remove_prefix(digits);
+    }
+
+    const auto offset = ReadOffset(timestring);
+    if (!offset || !timestring.empty()) return std::nullopt;
+
+    const auto seconds =
+        DaysFromCivil(year, month, day) * kSecondsPerDay + hour * 3600 + minute * 60 + second - *offset;
+
+    // The overflowing time points are saturated by the generic parser
+    constexpr auto kMaxSeconds =
+        std::chrono::duration_cast<std::chrono::seconds>(SystemClock::time_point::max().time_since_epoch()).count() -
+        1;
+    constexpr auto kMinSeconds =
+        std::chrono::duration_cast<std::chrono::seconds>(SystemClock::time_point::min().time_since_epoch()).count() +
+        1;
+    if (seconds > kMaxSeconds || seconds < kMinSeconds) return std::nullopt;
+
+    return SystemClock::time_point{std::chrono::duration_cast<SystemClock::duration>(
+        std::chrono::seconds{seconds} + std::chrono::nanoseconds{nanoseconds}
+    )};
+}
+
+}  // namespace utils::datetime
+
+USERVER_NAMESPACE_END
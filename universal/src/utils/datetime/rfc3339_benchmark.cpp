@@ -0,0 +1,49 @@
+#include <userver/utils/datetime/rfc3339.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/datetime/from_string_saturating.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+const auto kTimePoint =
+    std::chrono::system_clock::time_point{std::chrono::duration_cast<std::chrono::system_clock::duration>(
+        std::chrono::microseconds{1'700'000'000'123'456}
+    )};
+
+const std::string kTimestring = "2023-11-14T22:13:20.123456+00:00";
+
+}  // namespace
+
+void rfc3339_format_timestring(benchmark::State& state) {
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(utils::datetime::Timestring(kTimePoint, "UTC", utils::datetime::kRfc3339Format));
+    }
+}
+BENCHMARK(rfc3339_format_timestring);
+
+void rfc3339_format_fast(benchmark::State& state) {
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(utils::datetime::ToRfc3339StringUtc(kTimePoint));
+    }
+}
+BENCHMARK(rfc3339_format_fast);
+
+void rfc3339_parse_stringtime(benchmark::State& state) {
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(utils::datetime::Stringtime(kTimestring, "UTC", utils::datetime::kRfc3339Format));
+    }
+}
+BENCHMARK(rfc3339_parse_stringtime);
+
+void rfc3339_parse_saturating(benchmark::State& state) {
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(utils::datetime::FromRfc3339StringSaturating(kTimestring));
+    }
+}
+BENCHMARK(rfc3339_parse_saturating);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,69 @@
+#include <userver/utils/datetime/rfc3339.hpp>
+
+#include <array>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/datetime/from_string_saturating.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::chrono::system_clock::time_point FromNanoseconds(std::int64_t nanoseconds) {
+    return std::chrono::system_clock::time_point{
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds{nanoseconds})};
+}
+
+}  // namespace
+
+TEST(Rfc3339, FormatSameAsTimestring) {
+    constexpr std::array<std::int64_t, 8> kNanoseconds{
+        0, 1, 1'000, 123'456'000, 1'500'000'000'000'000'000, -1, -86'400'000'000'001, 951'782'400'000'000'000};
+    for (const auto nanoseconds : kNanoseconds) {
+        const auto tp = FromNanoseconds(nanoseconds);
+        EXPECT_EQ(
+            utils::datetime::ToRfc3339StringUtc(tp),
+            utils::datetime::Timestring(tp, "UTC", utils::datetime::kRfc3339Format)
+        );
+    }
+
+    EXPECT_EQ(utils::datetime::ToRfc3339StringUtc(FromNanoseconds(123'000'000)), "1970-01-01T00:00:00.123+00:00");
+}
+
+TEST(Rfc3339, ParseSameAsStringtime) {
+    for (const std::string timestring : {
+             "2020-02-29T23:59:59.123456789-03:30",
+             "2020-01-01T00:00:00Z",
+             "2019-12-31T21:00:00.5+0300",
+             "1969-12-31T23:59:59.999999999Z",
+         }) {
+        const auto tp = utils::datetime::TryParseRfc3339(timestring);
+        ASSERT_TRUE(tp) << timestring;
+        EXPECT_EQ(*tp, utils::datetime::Stringtime(timestring, "UTC", utils::datetime::kRfc3339Format));
+        EXPECT_EQ(*tp, utils::datetime::FromRfc3339StringSaturating(timestring));
+    }
+}
+
+TEST(Rfc3339, RoundTrip) {
+    const auto tp = FromNanoseconds(1'700'000'000'123'456'000L);
+    EXPECT_EQ(utils::datetime::TryParseRfc3339(utils::datetime::ToRfc3339StringUtc(tp)), tp);
+}
+
+TEST(Rfc3339, ParseRejected) {
+    for (const std::string_view timestring : {
+             "2019-02-29T00:00:00Z",
+             "2020-01-01T00:00:00",
+             "2020-01-01T00:00:00.Z",
+             "2020-01-01 00:00:00Z",
+             "2020-01-01T00:00:00+03",
+             "2020-01-01T00:00:00+03:00 ",
+             "9999-12-31T00:00:00+0000",
+         }) {
+        EXPECT_FALSE(utils::datetime::TryParseRfc3339(timestring)) << timestring;
+    }
+}
+
+USERVER_NAMESPACE_END
@@ -1,12 +1,19 @@
 #include <userver/utils/encoding/hex.hpp>
 
+#include <cstdint>
 #include <stdexcept>
 #include <string_view>
 
-#ifdef __SSSE3__
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
 #include <tmmintrin.h>
 #endif
 
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 USERVER_NAMESPACE_BEGIN
 
 namespace utils::encoding {
@@ -136,6 +143,30 @@ void ToHex(std::string_view input, std::string& out) noexcept {
     const auto* last = input.data() + input.size();
     auto* dst = out.data();
 
+#ifdef __AVX2__
+    while (last - first >= 16) {
+        const auto sixteen_bytes_of_data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+
+        // same as below, but the interleaved nibbles of 16 bytes are looked up
+        // in both lanes of a 256-bit register at once
+        const auto high_nibbles = _mm_and_si128(_mm_srli_epi64(sixteen_bytes_of_data, 4), detail::kLow4BitsMask);
+        const auto low_nibbles = _mm_and_si128(sixteen_bytes_of_data, detail::kLow4BitsMask);
+        const auto interleaving_hi_lo = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_unpacklo_epi8(high_nibbles, low_nibbles)),
+            _mm_unpackhi_epi8(high_nibbles, low_nibbles),
+            1
+        );
+
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(dst),
+            _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(detail::kDigitsMask), interleaving_hi_lo)
+        );
+
+        first += 16;
+        dst += 32;
+    }
+#endif
+
 #ifdef __SSSE3__
     while (last - first >= 8) {
         // we only take 8 bytes because each byte transforms into 2 bytes
@@ -160,6 +191,22 @@ void ToHex(std::string_view input, std::string& out) noexcept {
         first += 8;
         dst += 16;
     }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    const auto digits = vld1q_u8(reinterpret_cast<const std::uint8_t*>(detail::kXdigits.data()));
+    while (last - first >= 16) {
+        const auto sixteen_bytes_of_data = vld1q_u8(reinterpret_cast<const std::uint8_t*>(first));
+
+        // looks up the digits of the high and the low nibbles, the store
+        // interleaves them
+        const uint8x16x2_t hex_digits{{
+            vqtbl1q_u8(digits, vshrq_n_u8(sixteen_bytes_of_data, 4)),
+            vqtbl1q_u8(digits, vandq_u8(sixteen_bytes_of_data, vdupq_n_u8(0xf))),
+        }};
+        vst2q_u8(reinterpret_cast<std::uint8_t*>(dst), hex_digits);
+
+        first += 16;
+        dst += 32;
+    }
 #endif
 
     while (first != last) {
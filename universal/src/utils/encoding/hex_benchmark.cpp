@@ -27,7 +27,7 @@ void to_hex_benchmark(benchmark::State& state) {
         benchmark::DoNotOptimize(utils::encoding::ToHex(source));
     }
 }
-BENCHMARK(to_hex_benchmark)->RangeMultiplier(2)->Range(8, 512);
+BENCHMARK(to_hex_benchmark)->RangeMultiplier(2)->Range(8, 4096);
 
 void to_hex_benchmark_no_alloc(benchmark::State& state) {
     const auto source = GenerateSource(state.range(0));
@@ -40,6 +40,6 @@ void to_hex_benchmark_no_alloc(benchmark::State& state) {
         utils::encoding::ToHex(source, out);
     }
 }
-BENCHMARK(to_hex_benchmark_no_alloc)->RangeMultiplier(2)->Range(8, 512);
+BENCHMARK(to_hex_benchmark_no_alloc)->RangeMultiplier(2)->Range(8, 4096);
 
 USERVER_NAMESPACE_END
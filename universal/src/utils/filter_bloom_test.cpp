@@ -1,5 +1,6 @@
 #include <userver/utils/filter_bloom.hpp>
 
+#include <limits>
 #include <string>
 
 #include <gtest/gtest.h>
@@ -92,4 +93,24 @@ TEST(FilterBloom, Clear) {
     EXPECT_EQ(false, filter.Has(2));
 }
 
+TEST(FilterBloom, Saturation) {
+    utils::FilterBloom<int, uint8_t> filter(32);
+    for (std::size_t i = 0; i < 1000; ++i) {
+        filter.Increment(1);
+    }
+    EXPECT_EQ(std::numeric_limits<uint8_t>::max(), filter.Estimate(1));
+}
+
+TEST(FilterBloom, Halve) {
+    utils::FilterBloom<int> filter(1024);
+    for (std::size_t i = 0; i < 10; ++i) {
+        filter.Increment(1);
+    }
+    filter.Increment(2);
+
+    filter.Halve();
+    EXPECT_EQ(5, filter.Estimate(1));
+    EXPECT_EQ(false, filter.Has(2));
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <userver/compiler/thread_local.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::impl {
+
+// Not boost::static_vector, because it's not constexpr-constructible.
+template <typename T, std::size_t Capacity>
+class StaticVector final {
+public:
+    bool IsFull() const noexcept { return size_ == Capacity; }
+
+    void PushBack(T&& value) noexcept {
+        UASSERT(!IsFull());
+        data_[size_++] = std::move(value);
+    }
+
+    bool IsEmpty() const noexcept { return size_ == 0; }
+
+    T& GetBack() noexcept {
+        UASSERT(!IsEmpty());
+        return data_[size_ - 1];
+    }
+
+    void PopBack() noexcept {
+        UASSERT(!IsEmpty());
+        --size_;
+    }
+
+private:
+    std::size_t size_{0};
+    T data_[Capacity]{};
+};
+
+/// Caches the memory of up to `MaxSize` destroyed objects of type T per
+/// thread, to avoid the allocation for the short-living objects.
+template <typename T, std::size_t MaxSize = 16>
+class ThreadLocalMemPool {
+public:
+    template <typename... Args>
+    static std::unique_ptr<T> Pop(Args&&... args) {
+        auto pool = local_storage_pool.Use();
+        if (pool->IsEmpty()) {
+            return std::make_unique<T>(std::forward<Args>(args)...);
+        }
+
+        auto& raw = pool->GetBack();
+        // if ctor throws, memory remains in pool
+        new (raw.get()) T(std::forward<Args>(args)...);
+        // arm dtor, transfer ownership (noexcept)
+        std::unique_ptr<T> obj(reinterpret_cast<T*>(raw.release()));
+        // prune pool
+        pool->PopBack();
+        return obj;
+    }
+
+    // NOTE: Push might be called from a different thread than the one we got
+    // the object from (where the Pop() has been called). Because of this
+    // the object state must be completely torn down.
+    static void Push(std::unique_ptr<T> obj) noexcept {
+        // call dtor before using the pool, as it may use the pool of T itself
+        // or switch the thread
+        obj->~T();
+        // disarm dtor, transfer ownership (noexcept)
+        std::unique_ptr<Storage> raw(reinterpret_cast<Storage*>(obj.release()));
+
+        auto pool = local_storage_pool.Use();
+        if (pool->IsFull()) return;
+
+        // store into pool
+        pool->PushBack(std::move(raw));
+    }
+
+private:
+    using Storage = std::aligned_storage_t<sizeof(T), alignof(T)>;
+    using StoragePool = StaticVector<std::unique_ptr<Storage>, MaxSize>;
+
+    static inline compiler::ThreadLocal local_storage_pool = [] { return StoragePool{}; };
+};
+
+}  // namespace utils::impl
+
+USERVER_NAMESPACE_END
@@ -158,6 +158,48 @@ TEST(TrivialBiMap, MakeTrivialSet) {
     EXPECT_EQ(kSet.GetIndex("ten"), std::nullopt);
 }
 
+constexpr std::string_view kManyFieldNames[] = {
+    "id",          "name",        "description", "created_at", "updated_at", "deleted_at", "owner_id",
+    "owner_name",  "status",      "state",       "type",       "kind",       "tags",       "labels",
+    "annotations", "version",     "revision",    "parent_id",  "children",   "priority",   "weight",
+    "score",       "rating",      "comment",     "comments",   "url",        "uri",        "path",
+    "field_1",     "field_2",     "field_3",     "field_10",   "field_11",   "field_12",   "a",
+    "b",           "ab",          "ba",          "",
+};
+constexpr std::size_t kManyFieldIndices[] = {
+    0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+    20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38,
+};
+
+TEST(TrivialBiMap, MakeTrivialSetPerfectHash) {
+    static constexpr auto kSet = utils::MakeTrivialSet<kManyFieldNames>();
+    static_assert(kSet.GetIndex("field_12") == 33);
+    static_assert(!kSet.Contains("field_13"));
+
+    for (std::size_t i = 0; i < std::size(kManyFieldNames); ++i) {
+        EXPECT_EQ(kSet.GetIndex(kManyFieldNames[i]), i) << kManyFieldNames[i];
+        EXPECT_TRUE(kSet.Contains(std::string{kManyFieldNames[i]}));
+    }
+
+    EXPECT_EQ(kSet.GetIndex("field_4"), std::nullopt);
+    EXPECT_EQ(kSet.GetIndex("Name"), std::nullopt);
+    EXPECT_EQ(kSet.GetIndex("names"), std::nullopt);
+    EXPECT_EQ(kSet.GetIndex("aa"), std::nullopt);
+    EXPECT_FALSE(kSet.Contains("nam"));
+    EXPECT_EQ(kSet.GetIndexICase("NAME"), 1);
+}
+
+TEST(TrivialBiMap, MakeTrivialBiMapPerfectHash) {
+    static constexpr auto kMap = utils::MakeTrivialBiMap<kManyFieldNames, kManyFieldIndices>();
+
+    for (std::size_t i = 0; i < std::size(kManyFieldNames); ++i) {
+        EXPECT_EQ(kMap.TryFindByFirst(kManyFieldNames[i]), i);
+        EXPECT_EQ(kMap.TryFindBySecond(i), kManyFieldNames[i]);
+    }
+    EXPECT_EQ(kMap.TryFind("field_4"), std::nullopt);
+    EXPECT_EQ(kMap.TryFindICase("URL"), 25);
+}
+
 TEST(TrivialBiMap, FindICaseBySecond) {
     static constexpr utils::TrivialBiMap kNumToGerman = [](auto selector) {
         return selector().Case(0, "null").Case(1, "eins").Case(2, "zwei").Case(3, "drei");
@@ -1,5 +1,8 @@
 #include <userver/yaml_config/schema.hpp>
 
+#include <mutex>
+#include <unordered_map>
+
 #include <boost/range/adaptor/transformed.hpp>
 #include <boost/range/algorithm/count.hpp>
 
@@ -250,7 +253,23 @@ Schema Schema::EmptyObject() {
 bool Schema::operator==(const Schema& other) const { return TieSchema(*this) == TieSchema(other); }
 
 Schema impl::SchemaFromString(const std::string& yaml_string) {
-    return formats::yaml::FromString(yaml_string).As<Schema>();
+    // Schemas are string literals of the components. The same base schemas are
+    // parsed over and over again via MergeSchemas() for every derived component
+    // (and every time its schema is requested), so parsed schemas are cached.
+    static std::mutex mutex;
+    static std::unordered_map<std::string, Schema> cache;
+
+    {
+        const std::lock_guard lock{mutex};
+        const auto it = cache.find(yaml_string);
+        if (it != cache.end()) return it->second;
+    }
+
+    auto schema = formats::yaml::FromString(yaml_string).As<Schema>();
+
+    const std::lock_guard lock{mutex};
+    cache.try_emplace(yaml_string, schema);
+    return schema;
 }
 
 }  //  namespace yaml_config
@@ -49,6 +49,9 @@ class Driver;
 /// databases.<dbname>.max_pool_size | maximum pool size for database with name <dbname> | 50
 /// databases.<dbname>.get_session_retry_limit | retries count to get session, every attempt with a get-session-timeout | 5
 /// databases.<dbname>.keep-in-query-cache | whether to use query cache | true
+/// databases.<dbname>.client-query-cache | whether to prepare the data queries and keep them in a client side cache per session | false
+/// databases.<dbname>.client-query-cache-size | maximum number of prepared data queries kept per session | 1000
+/// databases.<dbname>.warmup-sessions | number of table sessions created on start, raises min_pool_size to it | 0
 /// databases.<dbname>.prefer_local_dc | prefer making requests to local DataCenter | false
 /// databases.<dbname>.aliases | list of alias names for this database | []
 /// databases.<dbname>.sync_start | fail on boot time if YDB is not accessible | true
@@ -9,6 +9,7 @@
 #include <memory>
 #include <optional>
 #include <typeinfo>
+#include <vector>
 
 #include <userver/utils/not_null.hpp>
 #include <userver/ydb/impl/cast.hpp>
@@ -189,13 +190,35 @@ public:
 
     std::optional<Cursor> GetNextResult();
 
+    /// @brief Parses the rows of the next result part to `T`, which must be a
+    /// struct type, see Row::As.
+    ///
+    /// The part after it is requested before the rows are parsed, so that
+    /// the parsing overlaps with the network. Useful for loading whole tables,
+    /// e.g. in the full updates of caches:
+    ///
+    /// @code
+    /// auto results = table_client.ReadTable("table");
+    /// while (auto rows = results.GetNextChunk<Row>()) {
+    ///     for (auto& row : *rows) data.Insert(std::move(row));
+    /// }
+    /// @endcode
+    ///
+    /// @returns std::nullopt if there are no more parts
+    template <typename T>
+    std::optional<std::vector<T>> GetNextChunk();
+
     ReadTableResults(const ReadTableResults&) = delete;
     ReadTableResults(ReadTableResults&&) noexcept = default;
     ReadTableResults& operator=(const ReadTableResults&) = delete;
     ReadTableResults& operator=(ReadTableResults&&) = delete;
 
 private:
+    std::optional<Cursor> GetNextResultImpl(bool prefetch);
+
     NYdb::NTable::TTablePartIterator iterator_;
+    // the part requested in advance by GetNextChunk
+    std::optional<NYdb::NTable::TAsyncReadTableResult> next_part_;
 };
 
 class ScanQueryResults final {
@@ -212,15 +235,56 @@ public:
 
     std::optional<Cursor> GetNextCursor();
 
+    /// @brief Parses the rows of the next result set to `T`, which must be a
+    /// struct type, see Row::As.
+    ///
+    /// The part after it is requested before the rows are parsed, so that
+    /// the parsing overlaps with the network.
+    ///
+    /// @returns std::nullopt if there are no more result sets
+    template <typename T>
+    std::optional<std::vector<T>> GetNextChunk();
+
     ScanQueryResults(const ScanQueryResults&) = delete;
     ScanQueryResults(ScanQueryResults&&) noexcept = default;
     ScanQueryResults& operator=(const ScanQueryResults&) = delete;
     ScanQueryResults& operator=(ScanQueryResults&&) = delete;
 
 private:
+    std::optional<TScanQueryPart> GetNextResultImpl(bool prefetch);
+    std::optional<Cursor> GetNextCursorImpl(bool prefetch);
+
     TScanQueryPartIterator iterator_;
+    // the part requested in advance by GetNextChunk
+    std::optional<NYdb::NTable::TAsyncScanQueryPart> next_part_;
 };
 
+namespace impl {
+
+template <typename T>
+std::vector<T> ParseRows(Cursor& cursor) {
+    std::vector<T> result;
+    result.reserve(cursor.size());
+    for (auto row : cursor) result.push_back(std::move(row).As<T>());
+    return result;
+}
+
+}  // namespace impl
+
+template <typename T>
+std::optional<std::vector<T>> ReadTableResults::GetNextChunk() {
+    auto cursor = GetNextResultImpl(/*prefetch=*/true);
+    if (!cursor) return std::nullopt;
+    return impl::ParseRows<T>(*cursor);
+}
+
+template <typename T>
+std::optional<std::vector<T>> ScanQueryResults::GetNextChunk() {
+    auto cursor = GetNextCursorImpl(/*prefetch=*/true);
+    if (!cursor) return std::nullopt;
+    return impl::ParseRows<T>(*cursor);
+}
+
 template <typename T>
 T Row::As() && {
     if (&typeid(T) != parse_state_.row_type_id) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <optional>
 #include <string_view>
@@ -33,6 +34,24 @@ struct QuerySettings final {
     std::optional<NYdb::NTable::ECollectQueryStatsMode> collect_query_stats{std::nullopt};
 };
 
+/// Settings of ydb::TableClient::ParallelBulkUpsert
+struct BulkUpsertSettings final {
+    /// Rows are split into chunks of at most that many serialized bytes, a
+    /// single row larger than that makes a chunk on its own
+    std::size_t max_chunk_bytes{8 * 1024 * 1024};
+
+    /// Maximum number of chunks being upserted concurrently
+    std::size_t max_parallel_chunks{4};
+};
+
+/// Statistics of a chunk upserted by ydb::TableClient::ParallelBulkUpsert
+struct BulkUpsertChunkStatistics final {
+    std::size_t rows{0};
+    std::size_t bytes{0};
+    /// Time of the chunk upsert, including the retries
+    std::chrono::microseconds duration{0};
+};
+
 }  // namespace ydb
 
 namespace formats::parse {
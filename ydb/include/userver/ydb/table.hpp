@@ -4,7 +4,12 @@
 #include <ydb-cpp-sdk/v2/client/query/query.h>
 #include <ydb-cpp-sdk/v2/client/table/table.h>
 
+#include <iterator>
+#include <optional>
+#include <vector>
+
 #include <userver/dynamic_config/source.hpp>
+#include <userver/utils/function_ref.hpp>
 #include <userver/utils/statistics/fwd.hpp>
 
 #include <userver/ydb/builder.hpp>
@@ -35,6 +40,7 @@ struct TableSettings;
 class Driver;
 struct RequestContext;
 enum class IsStreaming : bool {};
+std::size_t GetSerializedSize(const NYdb::TValue& value);
 }  // namespace impl
 
 using ScanQuerySettings = NYdb::NTable::TStreamExecScanQuerySettings;
@@ -116,6 +122,25 @@ public:
     template <typename RangeOfStructs>
     void BulkUpsert(std::string_view table, const RangeOfStructs& rows, OperationSettings settings = {});
 
+    /// @brief Write a range of table data of any size, in concurrent chunks.
+    ///
+    /// The passed range of structs is split into chunks of at most
+    /// `bulk_settings.max_chunk_bytes` serialized bytes, up to
+    /// `bulk_settings.max_parallel_chunks` chunks are upserted concurrently.
+    /// Each chunk is retried according to `settings`, as a BulkUpsert.
+    ///
+    /// If a chunk fails, the upserts of the other chunks are cancelled and the
+    /// error is rethrown. The chunks upserted before that remain in the table.
+    ///
+    /// @returns statistics of the chunks in the order of the rows
+    template <typename RangeOfStructs>
+    std::vector<BulkUpsertChunkStatistics> ParallelBulkUpsert(
+        std::string_view table,
+        const RangeOfStructs& rows,
+        BulkUpsertSettings bulk_settings,
+        OperationSettings settings = {}
+    );
+
     /// Efficiently read large ranges of table data.
     ReadTableResults ReadTable(
         std::string_view table,
@@ -196,8 +221,23 @@ private:
 
     std::string JoinDbPath(std::string_view path) const;
 
+    struct BulkUpsertChunk final {
+        NYdb::TValue rows;
+        std::size_t rows_count;
+        std::size_t bytes;
+    };
+
+    std::vector<BulkUpsertChunkStatistics> ParallelBulkUpsertImpl(
+        std::string_view table,
+        utils::function_ref<std::optional<BulkUpsertChunk>()> next_chunk,
+        const BulkUpsertSettings& bulk_settings,
+        OperationSettings&& settings
+    );
+
     void Select1();
 
+    void WarmUpSessions(std::uint32_t count);
+
     NYdb::NTable::TExecDataQuerySettings ToExecQuerySettings(QuerySettings query_settings) const;
 
     template <typename... Args>
@@ -251,6 +291,48 @@ void TableClient::BulkUpsert(std::string_view table, const RangeOfStructs& rows,
     BulkUpsert(table, builder.Build(), std::move(settings));
 }
 
+template <typename RangeOfStructs>
+std::vector<BulkUpsertChunkStatistics> TableClient::ParallelBulkUpsert(
+    std::string_view table,
+    const RangeOfStructs& rows,
+    BulkUpsertSettings bulk_settings,
+    OperationSettings settings
+) {
+    auto it = std::begin(rows);
+    const auto end = std::end(rows);
+    // the row that did not fit into the previous chunk
+    std::optional<NYdb::TValue> next_row;
+
+    const auto next_chunk = [&]() -> std::optional<BulkUpsertChunk> {
+        NYdb::TValueBuilder builder;
+        std::size_t rows_count = 0;
+        std::size_t bytes = 0;
+        while (next_row || it != end) {
+            if (!next_row) {
+                NYdb::TValueBuilder row_builder;
+                ydb::Write(row_builder, *it);
+                ++it;
+                next_row.emplace(row_builder.Build());
+            }
+
+            const auto row_bytes = impl::GetSerializedSize(*next_row);
+            if (rows_count > 0 && bytes + row_bytes > bulk_settings.max_chunk_bytes) break;
+
+            if (rows_count == 0) builder.BeginList();
+            builder.AddListItem(*next_row);
+            next_row.reset();
+            ++rows_count;
+            bytes += row_bytes;
+        }
+
+        if (rows_count == 0) return std::nullopt;
+        builder.EndList();
+        return BulkUpsertChunk{builder.Build(), rows_count, bytes};
+    };
+
+    return ParallelBulkUpsertImpl(table, next_chunk, bulk_settings, std::move(settings));
+}
+
 template <typename... Args>
 ScanQueryResults TableClient::ExecuteScanQuery(const Query& query, Args&&... args) {
     return ExecuteScanQuery(ScanQuerySettings{}, OperationSettings{}, query, MakeBuilder(std::forward<Args>(args)...));
@@ -243,6 +243,20 @@ properties:
                     type: boolean
                     defaultDescription: true
                     description: whether to use query cache
+                client-query-cache:
+                    type: boolean
+                    defaultDescription: false
+                    description: whether to prepare the data queries and keep them in a client side cache per session
+                client-query-cache-size:
+                    type: integer
+                    minimum: 1
+                    defaultDescription: 1000
+                    description: maximum number of prepared data queries kept per session
+                warmup-sessions:
+                    type: integer
+                    minimum: 0
+                    defaultDescription: 0
+                    description: number of table sessions created on start, raises min_pool_size to it
                 prefer_local_dc:
                     type: boolean
                     defaultDescription: true
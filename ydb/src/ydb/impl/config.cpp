@@ -1,5 +1,7 @@
 #include "config.hpp"
 
+#include <algorithm>
+
 #include <userver/formats/json/value.hpp>
 #include <userver/formats/parse/common_containers.hpp>
 #include <userver/utils/retry_budget.hpp>
@@ -41,6 +43,21 @@ TableSettings ParseTableSettings(const yaml_config::YamlConfig& dbconfig, const
     result.get_session_retry_limit =
         dbconfig["get_session_retry_limit"].As<std::uint32_t>(result.get_session_retry_limit);
     result.keep_in_query_cache = dbconfig["keep-in-query-cache"].As<bool>(result.keep_in_query_cache);
+    result.use_client_query_cache = dbconfig["client-query-cache"].As<bool>(result.use_client_query_cache);
+    result.client_query_cache_size =
+        dbconfig["client-query-cache-size"].As<std::uint32_t>(result.client_query_cache_size);
+
+    result.warmup_sessions = dbconfig["warmup-sessions"].As<std::uint32_t>(result.warmup_sessions);
+    if (result.warmup_sessions > result.max_pool_size) {
+        throw yaml_config::Exception(fmt::format(
+            "'{}.warmup-sessions' ({}) must not exceed max_pool_size ({})",
+            dbconfig.GetPath(),
+            result.warmup_sessions,
+            result.max_pool_size
+        ));
+    }
+    // the pool closes the idle sessions above its minimum size
+    result.min_pool_size = std::max(result.min_pool_size, result.warmup_sessions);
 
     result.sync_start = dbconfig["sync_start"].As<bool>(result.sync_start);
 
@@ -31,7 +31,10 @@ struct TableSettings {
     std::uint32_t min_pool_size{10};
     std::uint32_t max_pool_size{50};
     std::uint32_t get_session_retry_limit{5};
+    std::uint32_t warmup_sessions{0};
     bool keep_in_query_cache{true};
+    bool use_client_query_cache{false};
+    std::uint32_t client_query_cache_size{1000};
     bool sync_start{true};
     std::optional<std::vector<double>> by_database_timings_buckets{};
     std::optional<std::vector<double>> by_query_timings_buckets{};
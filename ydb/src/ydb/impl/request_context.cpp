@@ -146,6 +146,7 @@ RequestContext::RequestContext(
       settings(settings),
       initial_uncaught_exceptions(std::uncaught_exceptions()),
       stats_scope(*table_client.stats_, query),
+      get_session_timings(table_client.stats_->get_session_timings),
       config_snapshot(table_client.config_source_.GetSnapshot()),
       // Note: comma operator is used to insert code between initializations.
       span(
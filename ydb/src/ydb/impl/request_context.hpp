@@ -36,6 +36,7 @@ struct RequestContext final {
     OperationSettings& settings;
     const int initial_uncaught_exceptions;
     StatsScope stats_scope;
+    utils::statistics::Histogram& get_session_timings;
     dynamic_config::Snapshot config_snapshot;
     tracing::Span span;
     engine::Deadline deadline;
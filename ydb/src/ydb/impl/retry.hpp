@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 
 #include <fmt/format.h>
@@ -8,6 +9,7 @@
 #include <ydb-cpp-sdk/v2/client/table/table.h>
 
 #include <userver/utils/retry_budget.hpp>
+#include <userver/utils/statistics/histogram.hpp>
 #include <userver/ydb/exceptions.hpp>
 
 #include <ydb/impl/request_context.hpp>
@@ -48,10 +50,15 @@ public:
     RetryHandler(
         TClient& client,
         utils::RetryBudget& retry_budget,
+        utils::statistics::Histogram& get_session_timings,
         const NYdb::NRetry::TRetryOperationSettings& retry_settings,
         Fn&& fn
     )
-        : client_{client}, retry_budget_{retry_budget}, retry_settings_{retry_settings}, fn_{std::move(fn)} {}
+        : client_{client},
+          retry_budget_{retry_budget},
+          get_session_timings_{get_session_timings},
+          retry_settings_{retry_settings},
+          fn_{std::move(fn)} {}
 
     AsyncResultType Execute() {
         auto internal_retry_status = RetryOperation(
@@ -69,6 +76,15 @@ public:
 
 private:
     NYdb::TAsyncStatus InternalRetryIteration(ArgType arg) {
+        if constexpr (std::is_same_v<ArgType, TSession>) {
+            if (!result_.has_value()) {
+                const auto get_session_time = std::chrono::steady_clock::now() - start_time_;
+                get_session_timings_.Account(
+                    std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(get_session_time).count()
+                );
+            }
+        }
+
         const auto async_result = fn_(std::forward<ArgType>(arg));
 
         return async_result.Apply([handler = this->shared_from_this()](const auto& async_result) {
@@ -114,8 +130,10 @@ private:
 
     TClient& client_;
     utils::RetryBudget& retry_budget_;
+    utils::statistics::Histogram& get_session_timings_;
     NYdb::NRetry::TRetryOperationSettings retry_settings_;
     Fn fn_;
+    const std::chrono::steady_clock::time_point start_time_{std::chrono::steady_clock::now()};
 
     std::optional<ResultType> result_;
 };
@@ -133,6 +151,7 @@ auto RetryOperation(impl::RequestContext& request_context, Fn&& fn) {
     auto retry_handler = std::make_shared<RetryHandler<NYdb::NTable::TTableClient, Fn>>(
         client,
         retry_budget,
+        request_context.get_session_timings,
         PrepareRetrySettings(request_context.settings, retry_budget, request_context.deadline),
         std::forward<Fn>(fn)
     );
@@ -152,6 +171,7 @@ auto RetryQuery(impl::RequestContext& request_context, Fn&& fn) {
     auto retry_handler = std::make_shared<RetryHandler<NYdb::NQuery::TQueryClient, Fn>>(
         client,
         retry_budget,
+        request_context.get_session_timings,
         PrepareRetrySettings(request_context.settings, retry_budget, request_context.deadline),
         std::forward<Fn>(fn)
     );
@@ -54,6 +54,10 @@ struct Stats final {
     StatsCounters unnamed_queries;
     rcu::RcuMap<std::string, StatsCounters> by_query;
     rcu::RcuMap<std::string, StatsCounters> by_transaction;
+
+    // time from the start of an operation to its first attempt with a session
+    // from the pool
+    utils::statistics::Histogram get_session_timings;
 };
 
 void DumpMetric(utils::statistics::Writer& writer, const Stats& stats);
@@ -166,12 +166,18 @@ void ExecuteResponse::EnsureResultSetsNotEmpty() const {
 
 ReadTableResults::ReadTableResults(NYdb::NTable::TTablePartIterator iterator) : iterator_{std::move(iterator)} {}
 
-std::optional<Cursor> ReadTableResults::GetNextResult() {
-    auto status = impl::GetFutureValueUnchecked(iterator_.ReadNext());
+std::optional<Cursor> ReadTableResults::GetNextResult() { return GetNextResultImpl(/*prefetch=*/false); }
+
+std::optional<Cursor> ReadTableResults::GetNextResultImpl(bool prefetch) {
+    auto future = next_part_ ? std::move(*next_part_) : iterator_.ReadNext();
+    next_part_.reset();
+
+    auto status = impl::GetFutureValueUnchecked(std::move(future));
     if (!status.IsSuccess()) {
         if (status.EOS()) return std::nullopt;
         throw YdbResponseError("ReadNext", std::move(status));
     }
+    if (prefetch) next_part_.emplace(iterator_.ReadNext());
 
     const auto& res = status.ExtractPart();
     return Cursor{res};
@@ -180,17 +186,27 @@ std::optional<Cursor> ReadTableResults::GetNextResult() {
 ScanQueryResults::ScanQueryResults(TScanQueryPartIterator iterator) : iterator_{std::move(iterator)} {}
 
 std::optional<ScanQueryResults::TScanQueryPart> ScanQueryResults::GetNextResult() {
-    auto status = impl::GetFutureValueUnchecked(iterator_.ReadNext());
+    return GetNextResultImpl(/*prefetch=*/false);
+}
+
+std::optional<Cursor> ScanQueryResults::GetNextCursor() { return GetNextCursorImpl(/*prefetch=*/false); }
+
+std::optional<ScanQueryResults::TScanQueryPart> ScanQueryResults::GetNextResultImpl(bool prefetch) {
+    auto future = next_part_ ? std::move(*next_part_) : iterator_.ReadNext();
+    next_part_.reset();
+
+    auto status = impl::GetFutureValueUnchecked(std::move(future));
     if (!status.IsSuccess()) {
         if (status.EOS()) return std::nullopt;
         throw YdbResponseError("ReadNext", std::move(status));
     }
+    if (prefetch) next_part_.emplace(iterator_.ReadNext());
 
     return status;
 }
 
-std::optional<Cursor> ScanQueryResults::GetNextCursor() {
-    while (auto result = GetNextResult()) {
+std::optional<Cursor> ScanQueryResults::GetNextCursorImpl(bool prefetch) {
+    while (auto result = GetNextResultImpl(prefetch)) {
         if (result->HasResultSet()) {
             return std::optional<Cursor>{std::in_place, result->ExtractResultSet()};
         }
@@ -1,8 +1,16 @@
 #include <userver/ydb/table.hpp>
 
+#include <chrono>
+#include <deque>
+#include <vector>
+
+#include <src/api/protos/ydb_value.pb.h>
+
 #include <userver/engine/deadline.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/statistics/writer.hpp>
 #include <userver/ydb/impl/cast.hpp>
 
@@ -16,6 +24,9 @@
 USERVER_NAMESPACE_BEGIN
 
 namespace ydb {
+
+std::size_t impl::GetSerializedSize(const NYdb::TValue& value) { return value.GetProto().ByteSizeLong(); }
+
 namespace {
 
 NYdb::NTable::TTxSettings PrepareTxSettings(const OperationSettings& settings) {
@@ -70,7 +81,9 @@ TableClient::TableClient(
             .MinPoolSize(settings.min_pool_size)
             .RetryLimit(settings.get_session_retry_limit);
         NYdb::NTable::TClientSettings client_settings;
-        client_settings.SessionPoolSettings(session_pool_settings);
+        client_settings.SessionPoolSettings(session_pool_settings)
+            .UseQueryCache(settings.use_client_query_cache)
+            .QueryCacheSize(settings.client_query_cache_size);
         table_client_ = std::make_unique<NYdb::NTable::TTableClient>(driver_->GetNativeDriver(), client_settings);
         scheme_client_ = std::make_unique<NYdb::NScheme::TSchemeClient>(driver_->GetNativeDriver(), client_settings);
     }
@@ -87,6 +100,10 @@ TableClient::TableClient(
         LOG_DEBUG() << "Synchronously starting ydb client with name '" << driver_->GetDbName() << "'";
         Select1();
     }
+
+    if (settings.warmup_sessions > 0) {
+        WarmUpSessions(settings.warmup_sessions);
+    }
 }
 
 TableClient::~TableClient() {
@@ -138,6 +155,47 @@ void TableClient::BulkUpsert(std::string_view table, NYdb::TValue&& rows, Operat
     );
 }
 
+std::vector<BulkUpsertChunkStatistics> TableClient::ParallelBulkUpsertImpl(
+    std::string_view table,
+    utils::function_ref<std::optional<BulkUpsertChunk>()> next_chunk,
+    const BulkUpsertSettings& bulk_settings,
+    OperationSettings&& settings
+) {
+    UINVARIANT(bulk_settings.max_parallel_chunks > 0, "max_parallel_chunks of BulkUpsertSettings must be positive");
+
+    std::vector<BulkUpsertChunkStatistics> result;
+    // in the order of the chunks, the oldest one is awaited to start a new one
+    std::deque<engine::TaskWithResult<BulkUpsertChunkStatistics>> upserts;
+
+    while (auto chunk = next_chunk()) {
+        if (upserts.size() >= bulk_settings.max_parallel_chunks) {
+            result.push_back(upserts.front().Get());
+            upserts.pop_front();
+        }
+
+        upserts.push_back(utils::Async(
+            "ydb_parallel_bulk_upsert_chunk",
+            [this, table, settings, chunk = std::move(*chunk)]() mutable {
+                const auto start = std::chrono::steady_clock::now();
+                BulkUpsert(table, std::move(chunk.rows), std::move(settings));
+                const auto duration = std::chrono::steady_clock::now() - start;
+
+                const auto ms = std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(duration).count();
+                LOG_DEBUG() << "Upserted a chunk of " << chunk.rows_count << " rows, " << chunk.bytes
+                            << " bytes into " << table << " in " << ms << "ms";
+                return BulkUpsertChunkStatistics{
+                    chunk.rows_count,
+                    chunk.bytes,
+                    std::chrono::duration_cast<std::chrono::microseconds>(duration),
+                };
+            }
+        ));
+    }
+
+    for (auto& upsert : upserts) result.push_back(upsert.Get());
+    return result;
+}
+
 ReadTableResults TableClient::ReadTable(
     std::string_view table,
     NYdb::NTable::TReadTableSettings&& read_settings,
@@ -183,6 +241,34 @@ ScanQueryResults TableClient::ExecuteScanQuery(
     return ScanQueryResults{impl::GetFutureValueChecked(std::move(future), "ExecuteScanQuery", context)};
 }
 
+void TableClient::WarmUpSessions(std::uint32_t count) {
+    // All the sessions are held at once, so that the pool has to create each
+    // of them. They return to the pool when the results are destroyed.
+    std::vector<NYdb::NTable::TAsyncCreateSessionResult> futures;
+    futures.reserve(count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        futures.push_back(table_client_->GetSession());
+    }
+
+    std::vector<NYdb::NTable::TCreateSessionResult> sessions;
+    sessions.reserve(count);
+    for (auto& future : futures) {
+        try {
+            auto result = impl::GetFutureValueUnchecked(std::move(future));
+            if (result.IsSuccess()) {
+                sessions.push_back(std::move(result));
+            } else {
+                LOG_WARNING() << "Failed to create a warm-up session: " << result.GetIssues().ToOneLineString();
+            }
+        } catch (const std::exception& ex) {
+            LOG_WARNING() << "Failed to create a warm-up session: " << ex;
+        }
+    }
+
+    LOG_INFO() << "Created " << sessions.size() << " of " << count << " warm-up sessions of ydb database '"
+               << driver_->GetDbName() << "'";
+}
+
 void TableClient::Select1() {
     const auto response = ExecuteDataQuery(Query("SELECT 1")).GetSingleCursor().GetFirstRow().Get<std::int32_t>(0);
     if (response != 1) {
@@ -402,6 +488,7 @@ void DumpMetric(utils::statistics::Writer& writer, const TableClient& table_clie
     writer["pool"]["max-size"] = std::max(
         table_client.table_client_->GetActiveSessionsLimit(), table_client.query_client_->GetActiveSessionsLimit()
     );
+    writer["pool"]["get-session-timings"] = table_client.stats_->get_session_timings;
 }
 
 PreparedArgsBuilder TableClient::GetBuilder() const { return PreparedArgsBuilder(table_client_->GetParamsBuilder()); }
@@ -74,4 +74,35 @@ UTEST_F(YdbListIO, BulkUpsertEmptyRangeOfStructs) {
     AssertArePreFilledRows(result.GetSingleCursor(), {});
 }
 
+UTEST_F(YdbListIO, ParallelBulkUpsert) {
+    CreateTable("test_table", false);
+
+    // every row makes a chunk of its own
+    const ydb::BulkUpsertSettings bulk_settings{/*max_chunk_bytes=*/1, /*max_parallel_chunks=*/2};
+    const auto chunks = GetTableClient().ParallelBulkUpsert("test_table", kPreFilledRows, bulk_settings);
+    ASSERT_EQ(chunks.size(), 3);
+    for (const auto& chunk : chunks) {
+        EXPECT_EQ(chunk.rows, 1);
+        EXPECT_GT(chunk.bytes, 0);
+    }
+
+    auto result = GetTableClient().ExecuteDataQuery(kSelectAllRows);
+    AssertArePreFilledRows(result.GetSingleCursor(), {1, 2, 3});
+}
+
+UTEST_F(YdbListIO, ParallelBulkUpsertSingleChunk) {
+    CreateTable("test_table", false);
+
+    const auto chunks = GetTableClient().ParallelBulkUpsert("test_table", kPreFilledRows, ydb::BulkUpsertSettings{});
+    ASSERT_EQ(chunks.size(), 1);
+    EXPECT_EQ(chunks[0].rows, 3);
+
+    EXPECT_TRUE(GetTableClient()
+                    .ParallelBulkUpsert("test_table", std::vector<tests::RowValue>{}, ydb::BulkUpsertSettings{})
+                    .empty());
+
+    auto result = GetTableClient().ExecuteDataQuery(kSelectAllRows);
+    AssertArePreFilledRows(result.GetSingleCursor(), {1, 2, 3});
+}
+
 USERVER_NAMESPACE_END
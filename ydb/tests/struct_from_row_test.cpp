@@ -31,6 +31,39 @@ UTEST_F(YdbStructFromRow, StructReadRow) {
     }
 }
 
+UTEST_F(YdbStructFromRow, ReadTableChunks) {
+    CreateTable("test_table", true);
+
+    auto settings = NYdb::NTable::TReadTableSettings{}.Ordered();
+    auto results = GetTableClient().ReadTable("test_table", std::move(settings));
+
+    std::vector<tests::RowValue> items;
+    while (auto chunk = results.GetNextChunk<tests::RowValue>()) {
+        items.insert(items.end(), chunk->begin(), chunk->end());
+    }
+
+    ASSERT_EQ(items.size(), kPreFilledRows.size());
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        EXPECT_TRUE(boost::pfr::eq_fields(items[i], kPreFilledRows[i]));
+    }
+}
+
+UTEST_F(YdbStructFromRow, ScanQueryChunks) {
+    CreateTable("test_table", true);
+
+    auto results = GetTableClient().ExecuteScanQuery("SELECT * FROM test_table ORDER BY key");
+
+    std::vector<tests::RowValue> items;
+    while (auto chunk = results.GetNextChunk<tests::RowValue>()) {
+        items.insert(items.end(), chunk->begin(), chunk->end());
+    }
+
+    ASSERT_EQ(items.size(), kPreFilledRows.size());
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        EXPECT_TRUE(boost::pfr::eq_fields(items[i], kPreFilledRows[i]));
+    }
+}
+
 namespace tests {
 
 struct StructReadRowMissingColumn {